@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ARM Cortex-M performance counters based on DWT and PMU
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/perf/perf.h>
+#include <aarch32/cortex_m/dwt.h>
+#include <zephyr/arch/arm/aarch32/cortex_m/cmsis.h>
+
+#if defined(__PMU_PRESENT) && __PMU_PRESENT
+/* Armv8.1-M PMU event counters are 16 bits wide, each event is counted by
+ * a pair of counters, the odd one counting the overflows of the even one.
+ */
+static const uint16_t pmu_events[] = {
+	[SYS_PERF_INSTRUCTIONS] = ARM_PMU_INST_RETIRED,
+	[SYS_PERF_CACHE_MISSES] = ARM_PMU_L1D_CACHE_REFILL,
+	[SYS_PERF_BRANCH_MISSES] = ARM_PMU_BR_MIS_PRED,
+	[SYS_PERF_STALLS] = ARM_PMU_STALL_BACKEND,
+};
+
+#define PMU_PAIR(event) (2 * ((event) - SYS_PERF_INSTRUCTIONS))
+
+static uint32_t pmu_pair_read(uint32_t pair)
+{
+	uint32_t high, low;
+
+	do {
+		high = ARM_PMU_Get_EVCNTR(pair + 1);
+		low = ARM_PMU_Get_EVCNTR(pair);
+	} while (high != ARM_PMU_Get_EVCNTR(pair + 1));
+
+	return (high << 16) | (low & 0xffff);
+}
+#endif
+
+uint32_t arch_perf_init(void)
+{
+	uint32_t events = BIT(SYS_PERF_CYCLES);
+
+	/* The cycle counter is shared with the timing functions, it is
+	 * started but never reset here.
+	 */
+	z_arm_dwt_init();
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#if defined(__PMU_PRESENT) && __PMU_PRESENT
+	for (size_t i = SYS_PERF_INSTRUCTIONS; i < ARRAY_SIZE(pmu_events); i++) {
+		ARM_PMU_Set_EVTYPER(PMU_PAIR(i), pmu_events[i]);
+		ARM_PMU_Set_EVTYPER(PMU_PAIR(i) + 1, ARM_PMU_CHAIN);
+		events |= BIT(i);
+	}
+	ARM_PMU_CNTR_Enable(BIT_MASK(PMU_PAIR(ARRAY_SIZE(pmu_events))));
+	ARM_PMU_Enable();
+#endif
+
+	return events;
+}
+
+void arch_perf_read(uint32_t *raw)
+{
+	raw[SYS_PERF_CYCLES] = DWT->CYCCNT;
+
+#if defined(__PMU_PRESENT) && __PMU_PRESENT
+	for (size_t i = SYS_PERF_INSTRUCTIONS; i < ARRAY_SIZE(pmu_events); i++) {
+		raw[i] = pmu_pair_read(PMU_PAIR(i));
+	}
+#endif
+}
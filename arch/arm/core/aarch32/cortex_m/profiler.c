@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <kernel_arch_interface.h>
+#include <zephyr/arch/arm/aarch32/cortex_m/cmsis.h>
+
+size_t arch_profiler_sample(uintptr_t *frames, size_t max_frames)
+{
+	const struct __basic_sf *esf;
+
+	ARG_UNUSED(max_frames);
+
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+	/* Another exception is active, the thread was not interrupted */
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) == 0) {
+		return 0;
+	}
+#endif
+
+	/* Threads run on the process stack, where the exception entry
+	 * stacked the program counter. Code built for Thumb-2 does not keep
+	 * a frame chain, so only the program counter is sampled.
+	 */
+	esf = (const struct __basic_sf *)__get_PSP();
+	frames[0] = esf->pc;
+
+	return 1;
+}
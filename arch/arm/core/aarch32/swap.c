@@ -30,7 +30,7 @@ extern const int _k_neg_eagain;
  * On ARMv6-M, the intlock key is represented by the PRIMASK register,
  * as BASEPRI is not available.
  */
-int arch_swap(unsigned int key)
+__hot_code int arch_swap(unsigned int key)
 {
 	/* store off key and return value */
 	_current->arch.basepri = key;
@@ -21,6 +21,7 @@
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
 
 #include "mmu.h"
 
@@ -663,6 +664,30 @@ static void invalidate_tlb_all(void)
 	: : : "memory");
 }
 
+/* Above this number of pages, invalidating the whole TLB is cheaper */
+#define TLBI_RANGE_MAX_PAGES 64
+
+/*
+ * Invalidate the TLB entries of a range of virtual addresses for all the
+ * ASIDs, global ones included, on all the CPUs of the inner shareable
+ * domain.
+ */
+static void invalidate_tlb_range(uintptr_t virt, size_t size)
+{
+	if (size > TLBI_RANGE_MAX_PAGES * CONFIG_MMU_PAGE_SIZE) {
+		__asm__ volatile (
+		"dsb ishst; tlbi vmalle1is; dsb ish; isb"
+		: : : "memory");
+		return;
+	}
+
+	__asm__ volatile ("dsb ishst" : : : "memory");
+	for (uintptr_t va = virt; va < virt + size; va += CONFIG_MMU_PAGE_SIZE) {
+		__asm__ volatile ("tlbi vaae1is, %0" : : "r" (va >> 12) : "memory");
+	}
+	__asm__ volatile ("dsb ish; isb" : : : "memory");
+}
+
 /* zephyr execution regions with appropriate attributes */
 
 struct arm_mmu_flat_range {
@@ -1000,13 +1025,13 @@ size_t arch_virt_region_align(uintptr_t phys, size_t size)
 	int level;
 
 	for (level = XLAT_LAST_LEVEL; level >= BASE_XLAT_LEVEL; level--) {
-		level_size = 1 << LEVEL_TO_VA_SIZE_SHIFT(level);
-
-		if (size < level_size) {
-			break;
-		}
+		level_size = 1ULL << LEVEL_TO_VA_SIZE_SHIFT(level);
 
-		if ((phys & (level_size - 1))) {
+		/* The virtual address gets the offset of the physical one in
+		 * the alignment, so blocks can be used as long as the region
+		 * contains a whole aligned one.
+		 */
+		if (ROUND_UP(phys, level_size) + level_size > phys + size) {
 			break;
 		}
 
@@ -1018,11 +1043,84 @@ size_t arch_virt_region_align(uintptr_t phys, size_t size)
 
 #ifdef CONFIG_USERSPACE
 
-static uint16_t next_asid = 1;
+/*
+ * ASIDs are allocated to the domains when they are switched to, so that
+ * switching between domains needs no TLB invalidation. When they are all
+ * used, a new generation starts: the domains running on a CPU keep their
+ * ASID, the other ones get a new ASID the next time they are switched to,
+ * and each CPU invalidates its TLB before switching to another domain. ASID
+ * 0 is the one of the kernel page tables and is never allocated.
+ */
+#define ASID_MASK	(BIT64(VM_ASID_BITS) - 1)
+#define ASID_FIRST_GEN	BIT64(VM_ASID_BITS)
+
+static struct k_spinlock asid_lock;
+static uint64_t asid_generation = ASID_FIRST_GEN;
+static ATOMIC_DEFINE(asid_map, BIT(VM_ASID_BITS));
+static uint32_t next_asid = 1;
+/* ASID of the domain loaded on each CPU, 0 after a rollover */
+static uint64_t active_asid[CONFIG_MP_MAX_NUM_CPUS];
+/* ASID kept by each CPU at the last rollover */
+static uint64_t reserved_asid[CONFIG_MP_MAX_NUM_CPUS];
+/* CPUs which need to invalidate their TLB since the last rollover */
+static uint32_t asid_flush_pending;
+
+static void asid_rollover(void)
+{
+	asid_generation += ASID_FIRST_GEN;
+	(void)memset(asid_map, 0, sizeof(asid_map));
+	atomic_set_bit(asid_map, 0);
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		uint64_t asid = active_asid[i];
+
+		/* A CPU which did not switch since the previous rollover
+		 * still uses the ASID it kept then.
+		 */
+		if (asid == 0) {
+			asid = reserved_asid[i];
+		}
+
+		atomic_set_bit(asid_map, asid & ASID_MASK);
+		reserved_asid[i] = asid;
+		active_asid[i] = 0;
+	}
+
+	asid_flush_pending = BIT_MASK(arch_num_cpus());
+	next_asid = 1;
+}
 
-static uint16_t get_asid(uint64_t ttbr0)
+static uint64_t asid_alloc(struct arm_mmu_ptables *ptables)
 {
-	return ttbr0 >> TTBR_ASID_SHIFT;
+	uint64_t asid = ptables->asid;
+	bool kept = false;
+
+	/* The domain is still running on a CPU with its previous ASID */
+	for (unsigned int i = 0; (asid != 0) && (i < arch_num_cpus()); i++) {
+		if (reserved_asid[i] == asid) {
+			reserved_asid[i] = asid_generation | (asid & ASID_MASK);
+			kept = true;
+		}
+	}
+
+	if (kept) {
+		return asid_generation | (asid & ASID_MASK);
+	}
+
+	for (int pass = 0; pass < 2; pass++) {
+		for (uint32_t i = next_asid; i <= ASID_MASK; i++) {
+			if (!atomic_test_and_set_bit(asid_map, i)) {
+				next_asid = i + 1;
+				return asid_generation | i;
+			}
+		}
+
+		asid_rollover();
+	}
+
+	/* Only happens if there are more CPUs than ASIDs */
+	__ASSERT(false, "no ASID available");
+	return 0;
 }
 
 static void z_arm64_swap_ptables(struct k_thread *incoming);
@@ -1036,22 +1134,11 @@ int arch_mem_domain_init(struct k_mem_domain *domain)
 {
 	struct arm_mmu_ptables *domain_ptables = &domain->arch.ptables;
 	k_spinlock_key_t key;
-	uint16_t asid;
 
 	MMU_DEBUG("%s\n", __func__);
 
 	key = k_spin_lock(&xlat_lock);
 
-	/*
-	 * Pick a new ASID. We use round-robin
-	 * Note: `next_asid` is an uint16_t and `VM_ASID_BITS` could
-	 *  be up to 16, hence `next_asid` might overflow to 0 below.
-	 */
-	asid = next_asid++;
-	if ((next_asid >= (1UL << VM_ASID_BITS)) || (next_asid == 0)) {
-		next_asid = 1;
-	}
-
 	domain_ptables->base_xlat_table =
 		dup_table(kernel_ptables.base_xlat_table, BASE_XLAT_LEVEL);
 	k_spin_unlock(&xlat_lock, key);
@@ -1059,8 +1146,9 @@ int arch_mem_domain_init(struct k_mem_domain *domain)
 		return -ENOMEM;
 	}
 
-	domain_ptables->ttbr0 =	(((uint64_t)asid) << TTBR_ASID_SHIFT) |
-		((uint64_t)(uintptr_t)domain_ptables->base_xlat_table);
+	/* The ASID is allocated when the domain is first switched to */
+	domain_ptables->asid = 0;
+	domain_ptables->ttbr0 = (uint64_t)(uintptr_t)domain_ptables->base_xlat_table;
 
 	sys_slist_append(&domain_list, &domain->arch.node);
 	return 0;
@@ -1075,7 +1163,7 @@ static int private_map(struct arm_mmu_ptables *ptables, const char *name,
 	__ASSERT(ret == 0, "privatize_page_range() returned %d", ret);
 	ret = add_map(ptables, name, phys, virt, size, attrs | MT_NG);
 	__ASSERT(ret == 0, "add_map() returned %d", ret);
-	invalidate_tlb_all();
+	invalidate_tlb_range(virt, size);
 
 	return ret;
 }
@@ -1087,7 +1175,7 @@ static int reset_map(struct arm_mmu_ptables *ptables, const char *name,
 
 	ret = globalize_page_range(ptables, &kernel_ptables, addr, size, name);
 	__ASSERT(ret == 0, "globalize_page_range() returned %d", ret);
-	invalidate_tlb_all();
+	invalidate_tlb_range(addr, size);
 
 	return ret;
 }
@@ -1179,18 +1267,33 @@ int arch_mem_domain_thread_remove(struct k_thread *thread)
 static void z_arm64_swap_ptables(struct k_thread *incoming)
 {
 	struct arm_mmu_ptables *ptables = incoming->arch.ptables;
-	uint64_t curr_ttbr0 = read_ttbr0_el1();
-	uint64_t new_ttbr0 = ptables->ttbr0;
+	unsigned int cpu = _current_cpu->id;
+	k_spinlock_key_t key;
+	uint64_t new_ttbr0;
 
-	if (curr_ttbr0 == new_ttbr0) {
-		return; /* Already the right tables */
-	}
+	key = k_spin_lock(&asid_lock);
 
-	z_arm64_set_ttbr0(new_ttbr0);
+	if ((ptables != &kernel_ptables) &&
+	    ((ptables->asid & ~ASID_MASK) != asid_generation)) {
+		ptables->asid = asid_alloc(ptables);
+		ptables->ttbr0 = ((ptables->asid & ASID_MASK) << TTBR_ASID_SHIFT) |
+				 (uint64_t)(uintptr_t)ptables->base_xlat_table;
+	}
 
-	if (get_asid(curr_ttbr0) == get_asid(new_ttbr0)) {
+	/* The ASIDs of the previous generation may be reused */
+	if ((asid_flush_pending & BIT(cpu)) != 0U) {
+		asid_flush_pending &= ~BIT(cpu);
 		invalidate_tlb_all();
 	}
+
+	active_asid[cpu] = ptables->asid;
+	new_ttbr0 = ptables->ttbr0;
+
+	k_spin_unlock(&asid_lock, key);
+
+	if (read_ttbr0_el1() != new_ttbr0) {
+		z_arm64_set_ttbr0(new_ttbr0);
+	}
 }
 
 void z_arm64_thread_mem_domains_init(struct k_thread *incoming)
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ARM64 performance counters based on PMUv3
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/perf/perf.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/arch/arm64/lib_helpers.h>
+
+#define PMCR_E		BIT(0)
+#define PMCR_LC		BIT(6)
+#define PMCR_N_SHIFT	11
+#define PMCR_N_MASK	0x1f
+#define PMCNTEN_C	BIT(31)
+
+/* Common architectural and microarchitectural event numbers */
+static const uint16_t pmu_events[] = {
+	[SYS_PERF_INSTRUCTIONS] = 0x08,		/* INST_RETIRED */
+	[SYS_PERF_CACHE_MISSES] = 0x03,		/* L1D_CACHE_REFILL */
+	[SYS_PERF_BRANCH_MISSES] = 0x10,	/* BR_MIS_PRED */
+	[SYS_PERF_STALLS] = 0x24,		/* STALL_BACKEND */
+};
+
+/* Event counter used for each event, the cycles are counted by PMCCNTR */
+static uint8_t counter[ARRAY_SIZE(pmu_events)];
+static uint32_t counted;
+
+static bool event_implemented(uint16_t event)
+{
+	uint64_t ceid = event < 32 ? read_sysreg(pmceid0_el0) : read_sysreg(pmceid1_el0);
+
+	return (ceid & BIT64(event % 32)) != 0;
+}
+
+static void counter_select(uint8_t n)
+{
+	write_sysreg(n, pmselr_el0);
+	barrier_isync_fence_full();
+}
+
+uint32_t arch_perf_init(void)
+{
+	uint64_t pmcr = read_sysreg(pmcr_el0);
+	uint8_t num = (pmcr >> PMCR_N_SHIFT) & PMCR_N_MASK;
+	uint64_t enable = PMCNTEN_C;
+	uint32_t events = BIT(SYS_PERF_CYCLES);
+	uint8_t n = 0;
+
+	for (size_t i = SYS_PERF_INSTRUCTIONS; (i < ARRAY_SIZE(pmu_events)) && (n < num); i++) {
+		if (!event_implemented(pmu_events[i])) {
+			continue;
+		}
+
+		counter_select(n);
+		write_sysreg(pmu_events[i], pmxevtyper_el0);
+		counter[i] = n;
+		enable |= BIT(n);
+		events |= BIT(i);
+		n++;
+	}
+
+	write_sysreg(enable, pmcntenset_el0);
+	write_sysreg(pmcr | PMCR_E | PMCR_LC, pmcr_el0);
+	barrier_isync_fence_full();
+
+	counted = events;
+
+	return events;
+}
+
+void arch_perf_read(uint32_t *raw)
+{
+	raw[SYS_PERF_CYCLES] = read_sysreg(pmccntr_el0);
+
+	for (size_t i = SYS_PERF_INSTRUCTIONS; i < ARRAY_SIZE(pmu_events); i++) {
+		if ((counted & BIT(i)) != 0) {
+			counter_select(counter[i]);
+			raw[i] = read_sysreg(pmxevcntr_el0);
+		}
+	}
+}
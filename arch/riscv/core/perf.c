@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief RISC-V performance counters
+ *
+ * The cycle and instruction counters are architectural. The events of the
+ * hpmcounters are implementation defined, they are not used.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/perf/perf.h>
+#include <zephyr/arch/riscv/csr.h>
+
+uint32_t arch_perf_init(void)
+{
+	return BIT(SYS_PERF_CYCLES) | BIT(SYS_PERF_INSTRUCTIONS);
+}
+
+void arch_perf_read(uint32_t *raw)
+{
+	raw[SYS_PERF_CYCLES] = csr_read(mcycle);
+	raw[SYS_PERF_INSTRUCTIONS] = csr_read(minstret);
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <kernel_arch_interface.h>
+
+size_t arch_profiler_sample(uintptr_t *frames, size_t max_frames)
+{
+	const z_arch_esf_t *esf;
+	size_t n = 1;
+
+	/* Nested interrupts keep running on the interrupt stack */
+	if (_current_cpu->nested != 1) {
+		return 0;
+	}
+
+	/* The interrupt entry saved the stack pointer of the thread, which
+	 * points to its exception stack frame, at the base of the interrupt
+	 * stack.
+	 */
+	esf = *(const z_arch_esf_t **)(_current_cpu->irq_stack - 16);
+	frames[0] = esf->mepc;
+
+#if defined(CONFIG_OVERRIDE_FRAME_POINTER_DEFAULT) && !defined(CONFIG_OMIT_FRAME_POINTER)
+	const struct _thread_stack_info *info = &_current->stack_info;
+	uintptr_t start = info->start;
+	uintptr_t end = info->start + info->size;
+	uintptr_t fp = esf->s0;
+
+	/* The return address and the frame pointer of the caller are
+	 * stored right below the frame pointer.
+	 */
+	while ((n < max_frames) && (fp > start + 2 * sizeof(uintptr_t)) && (fp <= end) &&
+	       ((fp % sizeof(uintptr_t)) == 0)) {
+		uintptr_t prev = ((uintptr_t *)fp)[-2];
+
+		frames[n++] = ((uintptr_t *)fp)[-1];
+		if (prev <= fp) {
+			break;
+		}
+		fp = prev;
+	}
+#else
+	ARG_UNUSED(max_frames);
+#endif
+
+	return n;
+}
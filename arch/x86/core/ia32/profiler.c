@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <kernel_arch_interface.h>
+
+/* Words pushed on the thread stack by the interrupt entry, EDI first */
+#define ESP_OFFSET_EIP 4
+
+size_t arch_profiler_sample(uintptr_t *frames, size_t max_frames)
+{
+	const uint32_t *esp;
+
+	ARG_UNUSED(max_frames);
+
+	if (_current_cpu->nested != 1) {
+		return 0;
+	}
+
+	/* The interrupt entry saved the stack pointer of the thread at the
+	 * base of the interrupt stack. EBP is not saved until the handler
+	 * is called, so only the program counter is sampled.
+	 */
+	esp = *(const uint32_t **)(_current_cpu->irq_stack - sizeof(uint32_t));
+	frames[0] = esp[ESP_OFFSET_EIP];
+
+	return 1;
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <kernel_arch_interface.h>
+
+size_t arch_profiler_sample(uintptr_t *frames, size_t max_frames)
+{
+	size_t n = 1;
+
+	/* Only the outermost interrupt saves the interrupted context in the
+	 * thread struct.
+	 */
+	if (_current_cpu->nested != 1) {
+		return 0;
+	}
+
+	frames[0] = _current->callee_saved.rip;
+
+#if defined(CONFIG_OVERRIDE_FRAME_POINTER_DEFAULT) && !defined(CONFIG_OMIT_FRAME_POINTER)
+	const struct _thread_stack_info *info = &_current->stack_info;
+	uintptr_t start = info->start;
+	uintptr_t end = info->start + info->size;
+	uintptr_t bp = _current->callee_saved.rbp;
+
+	/* Each frame starts with the frame pointer of the caller, followed
+	 * by the return address.
+	 */
+	while ((n < max_frames) && (bp >= start) && (bp + 2 * sizeof(uintptr_t) <= end) &&
+	       ((bp % sizeof(uintptr_t)) == 0)) {
+		uintptr_t prev = ((uintptr_t *)bp)[0];
+
+		frames[n++] = ((uintptr_t *)bp)[1];
+		if (prev <= bp) {
+			break;
+		}
+		bp = prev;
+	}
+#else
+	ARG_UNUSED(max_frames);
+#endif
+
+	return n;
+}
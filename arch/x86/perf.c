@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief x86 performance counters based on architectural performance
+ * monitoring
+ */
+
+#include <cpuid.h> /* Header provided by the toolchain. */
+
+#include <zephyr/kernel.h>
+#include <zephyr/perf/perf.h>
+#include <zephyr/arch/x86/cpuid.h>
+#include <zephyr/arch/x86/msr.h>
+
+/* Architectural events, programmed in the general purpose counters */
+static const struct {
+	/* Bit of the event in CPUID.0AH:EBX, set if not available */
+	uint8_t cpuid_bit;
+	uint8_t event;
+	uint8_t umask;
+} arch_events[] = {
+	[SYS_PERF_CYCLES] = { 0, 0x3c, 0x00 },		/* UnHalted Core Cycles */
+	[SYS_PERF_INSTRUCTIONS] = { 1, 0xc0, 0x00 },	/* Instructions Retired */
+	[SYS_PERF_CACHE_MISSES] = { 4, 0x2e, 0x41 },	/* LLC Misses */
+	[SYS_PERF_BRANCH_MISSES] = { 6, 0xc5, 0x00 },	/* Branch Misses Retired */
+};
+
+/* General purpose counter used for each event */
+static uint8_t counter[ARRAY_SIZE(arch_events)];
+static uint32_t counted;
+
+uint32_t arch_perf_init(void)
+{
+	uint32_t eax, ebx, ecx, edx;
+	uint8_t version, num, len;
+	uint32_t events = 0;
+	uint8_t n = 0;
+
+	if (__get_cpuid(CPUID_PERF_MONITORING, &eax, &ebx, &ecx, &edx) == 0) {
+		return 0;
+	}
+
+	version = eax & 0xff;
+	num = (eax >> 8) & 0xff;
+	len = (eax >> 24) & 0xff;
+
+	if (version == 0) {
+		return 0;
+	}
+
+	for (size_t i = 0; (i < ARRAY_SIZE(arch_events)) && (n < num); i++) {
+		if ((arch_events[i].cpuid_bit >= len) ||
+		    ((ebx & BIT(arch_events[i].cpuid_bit)) != 0)) {
+			continue;
+		}
+
+		z_x86_msr_write(X86_PERFEVTSEL0_MSR + n,
+				arch_events[i].event | (arch_events[i].umask << 8) |
+				X86_PERFEVTSEL_MSR_USR | X86_PERFEVTSEL_MSR_OS |
+				X86_PERFEVTSEL_MSR_EN);
+		counter[i] = n;
+		events |= BIT(i);
+		n++;
+	}
+
+	/* Counters are also enabled globally from version 2 */
+	if (version >= 2) {
+		z_x86_msr_write(X86_PERF_GLOBAL_CTRL_MSR, BIT_MASK(n));
+	}
+
+	counted = events;
+
+	return events;
+}
+
+static inline uint32_t pmc_read(uint8_t n)
+{
+	uint32_t low, high;
+
+	__asm__ volatile("rdpmc" : "=a"(low), "=d"(high) : "c"((uint32_t)n));
+
+	return low;
+}
+
+void arch_perf_read(uint32_t *raw)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(arch_events); i++) {
+		if ((counted & BIT(i)) != 0) {
+			raw[i] = pmc_read(counter[i]);
+		}
+	}
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Xtensa performance counters
+ *
+ * Cycles are counted by CCOUNT and, on cores with the performance
+ * monitor option, instructions by the first performance counter.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/perf/perf.h>
+#include <xtensa/config/core-isa.h>
+
+#if XCHAL_NUM_PERF_COUNTERS > 0
+/* External registers of the performance monitor */
+#define PMG		0x1000
+#define PM0		0x1080
+#define PMCTRL0		0x1100
+
+#define PMG_PMEN		BIT(0)
+#define PMCTRL_KRNLCNT		BIT(3)
+#define PMCTRL_TRACELEVEL_ALL	(0xf << 4)
+#define PMCTRL_SELECT_INSN	(2 << 8)
+#define PMCTRL_MASK_INSN_ALL	(0x8dffU << 16)
+
+static inline uint32_t er_read(uint32_t reg)
+{
+	uint32_t val;
+
+	__asm__ volatile("rer %0, %1" : "=a"(val) : "a"(reg));
+
+	return val;
+}
+
+static inline void er_write(uint32_t reg, uint32_t val)
+{
+	__asm__ volatile("wer %0, %1; isync" : : "a"(val), "a"(reg));
+}
+#endif
+
+uint32_t arch_perf_init(void)
+{
+#if XCHAL_NUM_PERF_COUNTERS > 0
+	er_write(PMCTRL0, PMCTRL_MASK_INSN_ALL | PMCTRL_SELECT_INSN |
+		 PMCTRL_TRACELEVEL_ALL | PMCTRL_KRNLCNT);
+	er_write(PMG, er_read(PMG) | PMG_PMEN);
+
+	return BIT(SYS_PERF_CYCLES) | BIT(SYS_PERF_INSTRUCTIONS);
+#else
+	return BIT(SYS_PERF_CYCLES);
+#endif
+}
+
+void arch_perf_read(uint32_t *raw)
+{
+	uint32_t ccount;
+
+	__asm__ volatile ("rsr %0, CCOUNT" : "=r"(ccount));
+	raw[SYS_PERF_CYCLES] = ccount;
+
+#if XCHAL_NUM_PERF_COUNTERS > 0
+	raw[SYS_PERF_INSTRUCTIONS] = er_read(PM0);
+#endif
+}
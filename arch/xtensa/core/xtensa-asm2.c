@@ -210,6 +210,42 @@ static inline void *return_to(void *interrupted)
 	return z_arch_get_next_switch_handle(interrupted);
 }
 
+#ifdef CONFIG_PROFILER_SAMPLING
+/* Context interrupted by the outermost interrupt of each CPU */
+static void *profiler_interrupted[CONFIG_MP_MAX_NUM_CPUS];
+
+static inline void profiler_interrupted_set(void *interrupted_stack)
+{
+	if (_current_cpu->nested <= 1) {
+		profiler_interrupted[_current_cpu->id] = interrupted_stack;
+	}
+}
+
+size_t arch_profiler_sample(uintptr_t *frames, size_t max_frames)
+{
+	_xtensa_irq_bsa_t *bsa;
+
+	ARG_UNUSED(max_frames);
+
+	if (_current_cpu->nested > 1) {
+		return 0;
+	}
+
+	/* Windowed call frames cannot be walked without spilling the
+	 * register windows, only the program counter is sampled.
+	 */
+	bsa = *(_xtensa_irq_bsa_t **)profiler_interrupted[_current_cpu->id];
+	frames[0] = bsa->pc;
+
+	return 1;
+}
+#else
+static inline void profiler_interrupted_set(void *interrupted_stack)
+{
+	ARG_UNUSED(interrupted_stack);
+}
+#endif /* CONFIG_PROFILER_SAMPLING */
+
 /* The wrapper code lives here instead of in the python script that
  * generates _xtensa_handle_one_int*().  Seems cleaner, still kind of
  * ugly.
@@ -222,6 +258,7 @@ __unused void *xtensa_int##l##_c(void *interrupted_stack)	\
 {							   \
 	uint32_t irqs, intenable, m;			   \
 	usage_stop();					   \
+	profiler_interrupted_set(interrupted_stack);	   \
 	__asm__ volatile("rsr.interrupt %0" : "=r"(irqs)); \
 	__asm__ volatile("rsr.intenable %0" : "=r"(intenable)); \
 	irqs &= intenable;					\
@@ -17,6 +17,7 @@ extern "C" {
 void hwtimer_init(void);
 void hwtimer_cleanup(void);
 void hwtimer_set_real_time_mode(bool new_rt);
+void hwtimer_set_skip_silent_ticks(bool new_skip);
 void hwtimer_timer_reached(void);
 void hwtimer_wake_in_time(uint64_t time);
 void hwtimer_set_silent_ticks(int64_t sys_ticks);
@@ -17,3 +17,14 @@ static void set_realtime_default(void)
 NATIVE_TASK(set_realtime_default, PRE_BOOT_1, 0);
 
 #endif /* CONFIG_NATIVE_SIM_SLOWDOWN_TO_REAL_TIME */
+
+#if defined(CONFIG_NATIVE_SIM_SKIP_SILENT_TICKS)
+
+static void set_skip_silent_ticks_default(void)
+{
+	hwtimer_set_skip_silent_ticks(true);
+}
+
+NATIVE_TASK(set_skip_silent_ticks_default, PRE_BOOT_1, 0);
+
+#endif /* CONFIG_NATIVE_SIM_SKIP_SILENT_TICKS */
@@ -71,7 +71,17 @@ zephyr_linker_section_configure(SECTION /DISCARD/ INPUT ".igot")
 
 zephyr_linker_section(NAME .rom_start ADDRESS ${rom_start} GROUP ROM_REGION NOINPUT)
 
-zephyr_linker_section(NAME .text         GROUP TEXT_REGION)
+if(CONFIG_LINKER_FUNCTION_ORDER)
+  # The functions of the order file come first, in order, then the default
+  # input sections.
+  zephyr_linker_section(NAME .text       GROUP TEXT_REGION NOINPUT)
+  file(STRINGS ${FUNCTION_ORDER_FILE} ordered_functions REGEX "^[^#]")
+  list(TRANSFORM ordered_functions PREPEND ".text.")
+  zephyr_linker_section_configure(SECTION .text INPUT ${ordered_functions} PRIO 1)
+  zephyr_linker_section_configure(SECTION .text INPUT ".text" ".text.*" PRIO 2)
+else()
+  zephyr_linker_section(NAME .text       GROUP TEXT_REGION)
+endif()
 
 zephyr_linker_section_configure(SECTION .rel.plt  INPUT ".rel.iplt")
 zephyr_linker_section_configure(SECTION .rela.plt INPUT ".rela.iplt")
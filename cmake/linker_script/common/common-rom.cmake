@@ -154,6 +154,8 @@ endif()
 
 zephyr_iterable_section(NAME k_p4wq_initparam KVMA RAM_REGION GROUP RODATA_REGION SUBALIGN 4)
 
+zephyr_iterable_section(NAME k_irq_thread_initparam KVMA RAM_REGION GROUP RODATA_REGION SUBALIGN 4)
+
 if(CONFIG_EMUL)
   zephyr_iterable_section(NAME emul KVMA RAM_REGION GROUP RODATA_REGION SUBALIGN 4)
 endif()
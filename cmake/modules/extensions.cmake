@@ -1150,6 +1150,9 @@ endfunction(zephyr_check_compiler_flag_hardcoded)
 #    ROM_START     Inside the first output section of the image. This option is
 #                  currently only available on ARM Cortex-M, ARM Cortex-R,
 #                  x86, ARC, openisa_rv32m1, and RISC-V.
+#    TEXT_START    At the start of the text output section, before the default
+#                  input sections. This option is currently only available on
+#                  ARM Cortex-M, ARM Cortex-A/R, and RISC-V.
 #    RAM_SECTIONS  Inside the RAMABLE_REGION GROUP, not initialized.
 #    DATA_SECTIONS Inside the RAMABLE_REGION GROUP, initialized.
 #    RAMFUNC_SECTION Inside the RAMFUNC RAMABLE_REGION GROUP, not initialized.
@@ -1167,9 +1170,10 @@ endfunction(zephyr_check_compiler_flag_hardcoded)
 #
 # Use NOINIT, RWDATA, and RODATA unless they don't work for your use case.
 #
-# When placing into NOINIT, RWDATA, RODATA, ROM_START, RAMFUNC_SECTION,
-# NOCACHE_SECTION the contents of the files will be placed inside
-# an output section, so assume the section definition is already present, e.g.:
+# When placing into NOINIT, RWDATA, RODATA, ROM_START, TEXT_START,
+# RAMFUNC_SECTION, NOCACHE_SECTION the contents of the files will be placed
+# inside an output section, so assume the section definition is already present,
+# e.g.:
 #    _mysection_start = .;
 #    KEEP(*(.mysection));
 #    _mysection_end = .;
@@ -1199,6 +1203,7 @@ function(zephyr_linker_sources location)
   set(ram_sections_path  "${snippet_base}/snippets-ram-sections.ld")
   set(data_sections_path "${snippet_base}/snippets-data-sections.ld")
   set(rom_start_path     "${snippet_base}/snippets-rom-start.ld")
+  set(text_start_path    "${snippet_base}/snippets-text-start.ld")
   set(noinit_path        "${snippet_base}/snippets-noinit.ld")
   set(rwdata_path        "${snippet_base}/snippets-rwdata.ld")
   set(rodata_path        "${snippet_base}/snippets-rodata.ld")
@@ -1216,6 +1221,7 @@ function(zephyr_linker_sources location)
     file(WRITE ${ram_sections_path} "")
     file(WRITE ${data_sections_path} "")
     file(WRITE ${rom_start_path} "")
+    file(WRITE ${text_start_path} "")
     file(WRITE ${noinit_path} "")
     file(WRITE ${rwdata_path} "")
     file(WRITE ${rodata_path} "")
@@ -1236,6 +1242,8 @@ function(zephyr_linker_sources location)
     set(snippet_path "${data_sections_path}")
   elseif("${location}" STREQUAL "ROM_START")
     set(snippet_path "${rom_start_path}")
+  elseif("${location}" STREQUAL "TEXT_START")
+    set(snippet_path "${text_start_path}")
   elseif("${location}" STREQUAL "NOINIT")
     set(snippet_path "${noinit_path}")
   elseif("${location}" STREQUAL "RWDATA")
@@ -165,6 +165,7 @@ set(KERNEL_EXE_NAME   ${KERNEL_NAME}.exe)
 set(KERNEL_STAT_NAME  ${KERNEL_NAME}.stat)
 set(KERNEL_STRIP_NAME ${KERNEL_NAME}.strip)
 set(KERNEL_META_NAME  ${KERNEL_NAME}.meta)
+set(KERNEL_TCM_NAME   ${KERNEL_NAME}.tcm)
 set(KERNEL_SYMBOLS_NAME    ${KERNEL_NAME}.symbols)
 
 include(${BOARD_DIR}/board.cmake OPTIONAL)
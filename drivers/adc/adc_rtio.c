@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/adc.h>
+#include <zephyr/rtio/work.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(adc_rtio, CONFIG_ADC_LOG_LEVEL);
+
+/* A multishot request would be submitted again, and fail again, so it ends
+ * with the error.
+ */
+static void adc_iodev_fail(struct rtio_iodev_sqe *iodev_sqe, int rc)
+{
+	iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+	rtio_iodev_sqe_err(iodev_sqe, rc);
+}
+
+static void adc_iodev_read(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	struct adc_sequence sequence = *data->sequence;
+	struct adc_sequence_options options = { 0 };
+	uint32_t buf_size = adc_rtio_buf_size(data->sequence);
+	struct adc_rtio_header *header;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int rc;
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, buf_size, buf_size, &buf, &buf_len);
+	if (rc < 0) {
+		LOG_ERR("No buffer of %u bytes: %d", buf_size, rc);
+		adc_iodev_fail(iodev_sqe, rc);
+		return;
+	}
+
+	/* The samplings run back to back, without a callback for each */
+	if (sequence.options != NULL) {
+		options.interval_us = sequence.options->interval_us;
+		options.extra_samplings = sequence.options->extra_samplings;
+	}
+
+	sequence.options = &options;
+	sequence.buffer = buf + sizeof(*header);
+	sequence.buffer_size = buf_len - sizeof(*header);
+
+	header = (struct adc_rtio_header *)buf;
+	header->timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+	header->interval_us = options.interval_us;
+	header->channels = sequence.channels;
+	header->samplings = options.extra_samplings + 1;
+	header->resolution = sequence.resolution;
+
+	rc = adc_read(data->dev, &sequence);
+	if (rc < 0) {
+		adc_iodev_fail(iodev_sqe, rc);
+		return;
+	}
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void adc_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req;
+
+	if (iodev_sqe->sqe.op != RTIO_OP_RX) {
+		adc_iodev_fail(iodev_sqe, -EINVAL);
+		return;
+	}
+
+	req = rtio_work_req_alloc();
+	if (req == NULL) {
+		adc_iodev_fail(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, adc_iodev_read);
+}
+
+const struct rtio_iodev_api adc_iodev_api = {
+	.submit = adc_iodev_submit,
+};
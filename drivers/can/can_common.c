@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/drivers/can.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 
@@ -75,9 +77,340 @@ int z_impl_can_add_rx_filter_msgq(const struct device *dev, struct k_msgq *msgq,
 {
 	const struct can_driver_api *api = dev->api;
 
+	if (IS_ENABLED(CONFIG_CAN_RX_FILTER_MANAGER)) {
+		return can_rx_filter_manager_add(dev, can_msgq_put, msgq, filter);
+	}
+
 	return api->add_rx_filter(dev, can_msgq_put, msgq, filter);
 }
 
+#ifdef CONFIG_CAN_RX_FILTER_MANAGER
+/*
+ * Filters are added to the CAN controller as long as it has room for them.
+ * Once it is full, further filters are matched in software behind a spill
+ * filter, which is a hardware filter accepting every frame with the same
+ * flags. Software filters matching a single ID are hashed by that ID, the
+ * others are kept in a list.
+ */
+
+enum rx_filter_type {
+	RX_FILTER_FREE,
+	RX_FILTER_HW,
+	RX_FILTER_SW,
+	RX_FILTER_SPILL,
+};
+
+struct rx_filter {
+	sys_snode_t node;
+	const struct device *dev;
+	can_rx_callback_t callback;
+	void *user_data;
+	struct can_filter filter;
+	/* Spill filter passing frames to a software filter */
+	struct rx_filter *spill;
+	uint32_t hits;
+	/* Driver filter ID of hardware and spill filters */
+	int hw_id;
+	/* Number of software filters behind a spill filter */
+	uint16_t users;
+	uint8_t type;
+};
+
+static struct rx_filter rx_filters[CONFIG_CAN_RX_FILTER_MANAGER_COUNT];
+static sys_slist_t rx_filter_buckets[CONFIG_CAN_RX_FILTER_MANAGER_BUCKETS];
+static sys_slist_t rx_filter_masked;
+static struct k_spinlock rx_filter_lock;
+static K_MUTEX_DEFINE(rx_filter_mutex);
+
+static bool rx_filter_is_exact(const struct can_filter *filter)
+{
+	const uint32_t id_mask = (filter->flags & CAN_FILTER_IDE) != 0 ?
+				 CAN_EXT_ID_MASK : CAN_STD_ID_MASK;
+
+	return (filter->mask & id_mask) == id_mask;
+}
+
+static sys_slist_t *rx_filter_bucket(uint32_t id)
+{
+	return &rx_filter_buckets[(id ^ (id >> 11) ^ (id >> 22)) %
+				  CONFIG_CAN_RX_FILTER_MANAGER_BUCKETS];
+}
+
+static sys_slist_t *rx_filter_list(const struct rx_filter *rxf)
+{
+	if (rx_filter_is_exact(&rxf->filter)) {
+		return rx_filter_bucket(rxf->filter.id);
+	}
+
+	return &rx_filter_masked;
+}
+
+/* Callback of hardware filters */
+static void rx_filter_deliver(const struct device *dev, struct can_frame *frame,
+			      void *user_data)
+{
+	struct rx_filter *rxf = user_data;
+
+	rxf->hits++;
+	rxf->callback(dev, frame, rxf->user_data);
+}
+
+static void rx_filter_dispatch_list(sys_slist_t *list, const struct rx_filter *spill,
+				    struct can_frame *frame)
+{
+	struct rx_filter *rxf;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, rxf, node) {
+		if (rxf->spill == spill && can_frame_matches_filter(frame, &rxf->filter)) {
+			rxf->hits++;
+			rxf->callback(rxf->dev, frame, rxf->user_data);
+		}
+	}
+}
+
+/* Callback of spill filters */
+static void rx_filter_dispatch(const struct device *dev, struct can_frame *frame,
+			       void *user_data)
+{
+	struct rx_filter *spill = user_data;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&rx_filter_lock);
+	spill->hits++;
+	rx_filter_dispatch_list(rx_filter_bucket(frame->id), spill, frame);
+	rx_filter_dispatch_list(&rx_filter_masked, spill, frame);
+	k_spin_unlock(&rx_filter_lock, key);
+}
+
+static struct rx_filter *rx_filter_alloc(const struct device *dev, uint8_t type)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(rx_filters); i++) {
+		struct rx_filter *rxf = &rx_filters[i];
+
+		if (rxf->type == RX_FILTER_FREE) {
+			memset(rxf, 0, sizeof(*rxf));
+			rxf->dev = dev;
+			rxf->type = type;
+			rxf->hw_id = -1;
+
+			return rxf;
+		}
+	}
+
+	return NULL;
+}
+
+static int rx_filter_hw_add(struct rx_filter *rxf, can_rx_callback_t callback)
+{
+	const struct can_driver_api *api = rxf->dev->api;
+	int id;
+
+	id = api->add_rx_filter(rxf->dev, callback, rxf, &rxf->filter);
+	if (id < 0) {
+		return id;
+	}
+
+	rxf->hw_id = id;
+
+	return 0;
+}
+
+static void rx_filter_hw_remove(struct rx_filter *rxf)
+{
+	const struct can_driver_api *api = rxf->dev->api;
+
+	api->remove_rx_filter(rxf->dev, rxf->hw_id);
+	rxf->hw_id = -1;
+}
+
+static void rx_filter_link(struct rx_filter *rxf, struct rx_filter *spill)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&rx_filter_lock);
+	rxf->type = RX_FILTER_SW;
+	rxf->spill = spill;
+	spill->users++;
+	sys_slist_append(rx_filter_list(rxf), &rxf->node);
+	k_spin_unlock(&rx_filter_lock, key);
+}
+
+static void rx_filter_unlink(struct rx_filter *rxf)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&rx_filter_lock);
+	sys_slist_find_and_remove(rx_filter_list(rxf), &rxf->node);
+	rxf->spill->users--;
+	rxf->spill = NULL;
+	k_spin_unlock(&rx_filter_lock, key);
+}
+
+/*
+ * Get the spill filter for software filters with the given flags, adding it
+ * if needed. When the controller has no room for it, a hardware filter with
+ * the same flags is moved behind it to free its slot.
+ */
+static struct rx_filter *rx_filter_get_spill(const struct device *dev, uint8_t flags)
+{
+	struct rx_filter *victim = NULL;
+	struct rx_filter *spill;
+	int err;
+
+	for (size_t i = 0; i < ARRAY_SIZE(rx_filters); i++) {
+		struct rx_filter *rxf = &rx_filters[i];
+
+		if (rxf->dev != dev || rxf->filter.flags != flags) {
+			continue;
+		}
+
+		if (rxf->type == RX_FILTER_SPILL) {
+			return rxf;
+		}
+
+		if (rxf->type == RX_FILTER_HW && rxf->hw_id >= 0) {
+			victim = rxf;
+		}
+	}
+
+	if (victim == NULL) {
+		return NULL;
+	}
+
+	spill = rx_filter_alloc(dev, RX_FILTER_SPILL);
+	if (spill == NULL) {
+		return NULL;
+	}
+
+	spill->filter.flags = flags;
+
+	/* Frames for the victim are lost until the spill filter is added */
+	rx_filter_link(victim, spill);
+	rx_filter_hw_remove(victim);
+
+	err = rx_filter_hw_add(spill, rx_filter_dispatch);
+	if (err != 0) {
+		LOG_ERR("Failed to add spill filter (err %d)", err);
+		rx_filter_unlink(victim);
+		victim->type = RX_FILTER_HW;
+		if (rx_filter_hw_add(victim, rx_filter_deliver) != 0) {
+			LOG_ERR("Failed to restore filter %d",
+				(int)ARRAY_INDEX(rx_filters, victim));
+		}
+		spill->type = RX_FILTER_FREE;
+
+		return NULL;
+	}
+
+	return spill;
+}
+
+int can_rx_filter_manager_add(const struct device *dev, can_rx_callback_t callback,
+			      void *user_data, const struct can_filter *filter)
+{
+	struct rx_filter *spill;
+	struct rx_filter *rxf;
+	int err;
+
+	k_mutex_lock(&rx_filter_mutex, K_FOREVER);
+
+	rxf = rx_filter_alloc(dev, RX_FILTER_HW);
+	if (rxf == NULL) {
+		err = -ENOSPC;
+		goto unlock;
+	}
+
+	rxf->callback = callback;
+	rxf->user_data = user_data;
+	rxf->filter = *filter;
+
+	err = rx_filter_hw_add(rxf, rx_filter_deliver);
+	if (err == -ENOSPC) {
+		spill = rx_filter_get_spill(dev, filter->flags);
+		if (spill != NULL) {
+			rx_filter_link(rxf, spill);
+			err = 0;
+		}
+	}
+
+	if (err != 0) {
+		rxf->type = RX_FILTER_FREE;
+		goto unlock;
+	}
+
+	err = ARRAY_INDEX(rx_filters, rxf);
+
+unlock:
+	k_mutex_unlock(&rx_filter_mutex);
+
+	return err;
+}
+
+void can_rx_filter_manager_remove(const struct device *dev, int filter_id)
+{
+	struct rx_filter *spill;
+	struct rx_filter *rxf;
+
+	if (filter_id < 0 || filter_id >= ARRAY_SIZE(rx_filters)) {
+		return;
+	}
+
+	k_mutex_lock(&rx_filter_mutex, K_FOREVER);
+
+	rxf = &rx_filters[filter_id];
+	if (rxf->dev != dev) {
+		goto unlock;
+	}
+
+	if (rxf->type == RX_FILTER_HW) {
+		rx_filter_hw_remove(rxf);
+	} else if (rxf->type == RX_FILTER_SW) {
+		spill = rxf->spill;
+		rx_filter_unlink(rxf);
+
+		if (spill->users == 0) {
+			rx_filter_hw_remove(spill);
+			spill->type = RX_FILTER_FREE;
+		}
+	} else {
+		goto unlock;
+	}
+
+	rxf->type = RX_FILTER_FREE;
+
+unlock:
+	k_mutex_unlock(&rx_filter_mutex);
+}
+
+int z_impl_can_get_rx_filter_hits(const struct device *dev, int filter_id, uint32_t *hits)
+{
+	const struct rx_filter *rxf;
+
+	if (filter_id < 0 || filter_id >= ARRAY_SIZE(rx_filters)) {
+		return -EINVAL;
+	}
+
+	rxf = &rx_filters[filter_id];
+	if (rxf->dev != dev ||
+	    (rxf->type != RX_FILTER_HW && rxf->type != RX_FILTER_SW)) {
+		return -EINVAL;
+	}
+
+	*hits = rxf->hits;
+
+	return 0;
+}
+#else /* CONFIG_CAN_RX_FILTER_MANAGER */
+int z_impl_can_get_rx_filter_hits(const struct device *dev, int filter_id, uint32_t *hits)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(filter_id);
+	ARG_UNUSED(hits);
+
+	return -ENOSYS;
+}
+#endif /* CONFIG_CAN_RX_FILTER_MANAGER */
+
 /**
  * @brief Update the timing given a total number of time quanta and a sample point.
  *
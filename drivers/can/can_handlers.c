@@ -138,6 +138,16 @@ static inline int z_vrfy_can_get_max_filters(const struct device *dev, bool ide)
 }
 #include <syscalls/can_get_max_filters_mrsh.c>
 
+static inline int z_vrfy_can_get_rx_filter_hits(const struct device *dev, int filter_id,
+						uint32_t *hits)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(dev, K_OBJ_DRIVER_CAN));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(hits, sizeof(*hits)));
+
+	return z_impl_can_get_rx_filter_hits(dev, filter_id, hits);
+}
+#include <syscalls/can_get_rx_filter_hits_mrsh.c>
+
 static inline int z_vrfy_can_get_capabilities(const struct device *dev, can_mode_t *cap)
 {
 	Z_OOPS(Z_SYSCALL_DRIVER_CAN(dev, get_capabilities));
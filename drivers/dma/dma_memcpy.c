@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/cache.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/sys/atomic.h>
+
+struct dma_memcpy_ctx {
+	void *dst;
+	size_t len;
+	dma_memcpy_callback_t callback;
+	void *user_data;
+};
+
+static struct dma_memcpy_ctx ctxs[CONFIG_DMA_MEMCPY_MAX_PENDING];
+static ATOMIC_DEFINE(ctxs_used, CONFIG_DMA_MEMCPY_MAX_PENDING);
+
+static struct dma_memcpy_ctx *dma_memcpy_ctx_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(ctxs); i++) {
+		if (!atomic_test_and_set_bit(ctxs_used, i)) {
+			return &ctxs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void dma_memcpy_ctx_free(struct dma_memcpy_ctx *ctx)
+{
+	atomic_clear_bit(ctxs_used, ctx - ctxs);
+}
+
+static void dma_memcpy_done(const struct device *dev, void *user_data,
+			    uint32_t channel, int status)
+{
+	struct dma_memcpy_ctx *ctx = user_data;
+	dma_memcpy_callback_t callback = ctx->callback;
+	void *cb_user_data = ctx->user_data;
+
+	sys_cache_data_invd_range(ctx->dst, ctx->len);
+
+	dma_release_channel(dev, channel);
+	dma_memcpy_ctx_free(ctx);
+
+	callback(cb_user_data, status < 0 ? status : 0);
+}
+
+/* Widest data size the buffers and the length are aligned to */
+static uint32_t dma_memcpy_data_size(uintptr_t dst, uintptr_t src, size_t len)
+{
+	uintptr_t bits = dst | src | len;
+
+	if ((bits & 0x3) == 0) {
+		return 4;
+	} else if ((bits & 0x1) == 0) {
+		return 2;
+	}
+
+	return 1;
+}
+
+int dma_memcpy_async(const struct device *dev, void *dst, const void *src, size_t len,
+		     dma_memcpy_callback_t callback, void *user_data)
+{
+	struct dma_block_config block = {
+		.source_address = (uintptr_t)src,
+		.dest_address = (uintptr_t)dst,
+		.block_size = len,
+	};
+	struct dma_config cfg = {
+		.channel_direction = MEMORY_TO_MEMORY,
+		.error_callback_en = 1,
+		.block_count = 1,
+		.head_block = &block,
+		.dma_callback = dma_memcpy_done,
+	};
+	struct dma_memcpy_ctx *ctx = NULL;
+	int channel = -EINVAL;
+	int ret;
+
+	if (len >= CONFIG_DMA_MEMCPY_THRESHOLD) {
+		ctx = dma_memcpy_ctx_alloc();
+	}
+
+	if (ctx != NULL) {
+		channel = dma_request_channel(dev, NULL);
+		if (channel < 0) {
+			dma_memcpy_ctx_free(ctx);
+		}
+	}
+
+	/* Copies not worth a channel, or without a free one, are done here */
+	if (channel < 0) {
+		memcpy(dst, src, len);
+		callback(user_data, 0);
+		return 0;
+	}
+
+	*ctx = (struct dma_memcpy_ctx) {
+		.dst = dst,
+		.len = len,
+		.callback = callback,
+		.user_data = user_data,
+	};
+
+	cfg.source_data_size = dma_memcpy_data_size((uintptr_t)dst, (uintptr_t)src, len);
+	cfg.dest_data_size = cfg.source_data_size;
+	cfg.source_burst_length = 1;
+	cfg.dest_burst_length = 1;
+	cfg.user_data = ctx;
+
+	sys_cache_data_flush_range((void *)src, len);
+	sys_cache_data_flush_and_invd_range(dst, len);
+
+	ret = dma_config(dev, channel, &cfg);
+	if (ret == 0) {
+		ret = dma_start(dev, channel);
+	}
+
+	if (ret < 0) {
+		dma_release_channel(dev, channel);
+		dma_memcpy_ctx_free(ctx);
+	}
+
+	return ret;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/cache.h>
+#include <zephyr/drivers/dma.h>
+
+static void dma_ring_callback(const struct device *dev, void *user_data,
+			      uint32_t channel, int status)
+{
+	struct dma_ring *ring = user_data;
+	uint32_t count = atomic_get(&ring->dma_count);
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(channel);
+
+	/* Cyclic transfers call back at the end of each block */
+	if (status >= 0) {
+		count += ring->block_size;
+		atomic_set(&ring->dma_count, count);
+		status = 0;
+	}
+
+	if (ring->cfg.callback != NULL) {
+		ring->cfg.callback(ring, ring->cfg.user_data, count % ring->cfg.size, status);
+	}
+}
+
+int dma_ring_start(struct dma_ring *ring, const struct device *dev, uint32_t channel,
+		   struct dma_config *dma_cfg, const struct dma_ring_config *cfg)
+{
+	int ret;
+
+	if ((cfg->block_count < 2) || (cfg->block_count > ARRAY_SIZE(ring->blocks)) ||
+	    (cfg->size % cfg->block_count != 0)) {
+		return -EINVAL;
+	}
+
+	if ((dma_cfg->channel_direction != PERIPHERAL_TO_MEMORY) &&
+	    (dma_cfg->channel_direction != MEMORY_TO_PERIPHERAL)) {
+		return -EINVAL;
+	}
+
+	ring->dev = dev;
+	ring->channel = channel;
+	ring->dir = dma_cfg->channel_direction;
+	ring->cfg = *cfg;
+	ring->block_size = cfg->size / cfg->block_count;
+	atomic_set(&ring->dma_count, 0);
+
+	for (uint32_t i = 0; i < cfg->block_count; i++) {
+		struct dma_block_config *block = &ring->blocks[i];
+		uintptr_t addr = (uintptr_t)&cfg->buf[i * ring->block_size];
+
+		(void)memset(block, 0, sizeof(*block));
+
+		if (ring->dir == PERIPHERAL_TO_MEMORY) {
+			block->source_address = cfg->periph_addr;
+			block->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+			block->dest_address = addr;
+			block->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		} else {
+			block->source_address = addr;
+			block->source_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+			block->dest_address = cfg->periph_addr;
+			block->dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		}
+
+		block->block_size = ring->block_size;
+		block->next_block = &ring->blocks[(i + 1) % cfg->block_count];
+	}
+
+	/* A memory to peripheral ring starts with the whole buffer to send */
+	if (ring->dir == PERIPHERAL_TO_MEMORY) {
+		ring->cpu_count = 0;
+		sys_cache_data_flush_and_invd_range(cfg->buf, cfg->size);
+	} else {
+		ring->cpu_count = cfg->size;
+		sys_cache_data_flush_range(cfg->buf, cfg->size);
+	}
+
+	dma_cfg->head_block = &ring->blocks[0];
+	dma_cfg->block_count = cfg->block_count;
+	dma_cfg->cyclic = 1;
+	dma_cfg->complete_callback_en = 1;
+	dma_cfg->dma_callback = dma_ring_callback;
+	dma_cfg->user_data = ring;
+
+	ret = dma_config(dev, channel, dma_cfg);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return dma_start(dev, channel);
+}
+
+int dma_ring_stop(struct dma_ring *ring)
+{
+	return dma_stop(ring->dev, ring->channel);
+}
+
+int dma_ring_get(struct dma_ring *ring, uint8_t **data)
+{
+	uint32_t dma_count = atomic_get(&ring->dma_count);
+	uint32_t offset = ring->cpu_count % ring->cfg.size;
+	uint32_t len;
+
+	if (ring->dir == PERIPHERAL_TO_MEMORY) {
+		/* The controller is writing the block following its count */
+		len = dma_count - ring->cpu_count;
+		if (len > ring->cfg.size - ring->block_size) {
+			return -EOVERFLOW;
+		}
+	} else {
+		/* The controller is reading the block following its count */
+		if ((int32_t)(ring->cpu_count - dma_count) < (int32_t)ring->block_size) {
+			return -EOVERFLOW;
+		}
+
+		len = ring->cfg.size - (ring->cpu_count - dma_count);
+	}
+
+	len = MIN(len, ring->cfg.size - offset);
+	*data = &ring->cfg.buf[offset];
+
+	if ((ring->dir == PERIPHERAL_TO_MEMORY) && (len > 0)) {
+		sys_cache_data_invd_range(*data, len);
+	}
+
+	return len;
+}
+
+void dma_ring_put(struct dma_ring *ring, uint32_t len)
+{
+	if (ring->dir == MEMORY_TO_PERIPHERAL) {
+		sys_cache_data_flush_range(&ring->cfg.buf[ring->cpu_count % ring->cfg.size], len);
+	}
+
+	ring->cpu_count += len;
+}
+
+void dma_ring_reset(struct dma_ring *ring)
+{
+	uint32_t dma_count = atomic_get(&ring->dma_count);
+
+	/* Skip the block the controller is transferring */
+	if (ring->dir == PERIPHERAL_TO_MEMORY) {
+		ring->cpu_count = dma_count;
+	} else {
+		ring->cpu_count = dma_count + ring->block_size;
+	}
+}
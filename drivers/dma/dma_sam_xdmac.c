@@ -14,6 +14,7 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/device.h>
 #include <zephyr/init.h>
+#include <zephyr/cache.h>
 #include <string.h>
 #include <soc.h>
 #include <zephyr/drivers/dma.h>
@@ -33,6 +34,10 @@ struct sam_xdmac_channel_cfg {
 	void *user_data;
 	dma_callback_t callback;
 	uint32_t data_size;
+#if CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS > 1
+	/* Linked list of the blocks of multiple block transfers */
+	struct sam_xdmac_linked_list_desc_view2 desc[CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS];
+#endif
 };
 
 /* Device constant configuration parameters */
@@ -175,6 +180,81 @@ int sam_xdmac_transfer_configure(const struct device *dev, uint32_t channel,
 	return 0;
 }
 
+/* Addressing mode of a block, memory to memory transfers always increment */
+static uint32_t sam_xdmac_addr_mode(const struct dma_config *cfg,
+				    const struct dma_block_config *block)
+{
+	uint32_t xdmac_inc_cfg = 0;
+
+	if (cfg->channel_direction == MEMORY_TO_MEMORY) {
+		return XDMAC_CC_SAM_INCREMENTED_AM | XDMAC_CC_DAM_INCREMENTED_AM;
+	}
+
+	if (block->source_addr_adj == DMA_ADDR_ADJ_INCREMENT
+		&& cfg->channel_direction == MEMORY_TO_PERIPHERAL) {
+		xdmac_inc_cfg |= XDMAC_CC_SAM_INCREMENTED_AM;
+	} else {
+		xdmac_inc_cfg |= XDMAC_CC_SAM_FIXED_AM;
+	}
+
+	if (block->dest_addr_adj == DMA_ADDR_ADJ_INCREMENT
+		&& cfg->channel_direction == PERIPHERAL_TO_MEMORY) {
+		xdmac_inc_cfg |= XDMAC_CC_DAM_INCREMENTED_AM;
+	} else {
+		xdmac_inc_cfg |= XDMAC_CC_DAM_FIXED_AM;
+	}
+
+	return xdmac_inc_cfg;
+}
+
+#if CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS > 1
+/* Each block is a microblock described by a view 2 descriptor, which
+ * carries its own addressing mode, so that blocks to and from fixed
+ * addresses can be mixed in a single transfer.
+ */
+static int sam_xdmac_linked_list_configure(const struct device *dev, uint32_t channel,
+					   struct dma_config *cfg, uint32_t cc,
+					   struct sam_xdmac_transfer_config *transfer_cfg)
+{
+	struct sam_xdmac_dev_data *const dev_data = dev->data;
+	struct sam_xdmac_linked_list_desc_view2 *desc = dev_data->dma_channels[channel].desc;
+	uint32_t data_size = dev_data->dma_channels[channel].data_size;
+	struct dma_block_config *block = cfg->head_block;
+
+	for (uint32_t i = 0; i < cfg->block_count; i++) {
+		if (block == NULL) {
+			LOG_ERR("Missing block %u", i);
+			return -EINVAL;
+		}
+
+		desc[i].mbr_ubc = block->block_size >> data_size;
+		desc[i].mbr_sa = block->source_address;
+		desc[i].mbr_da = block->dest_address;
+		desc[i].mbr_cfg = cc | sam_xdmac_addr_mode(cfg, block);
+
+		if (i + 1 < cfg->block_count) {
+			desc[i].mbr_nda = (uint32_t)&desc[i + 1];
+			desc[i].mbr_ubc |= XDMA_UBC_NDE_FETCH_EN | XDMA_UBC_NSEN_UPDATED
+					 | XDMA_UBC_NDEN_UPDATED | XDMA_UBC_NVIEW_NDV2;
+		} else {
+			desc[i].mbr_nda = 0U;
+		}
+
+		block = block->next_block;
+	}
+
+	sys_cache_data_flush_range(desc, cfg->block_count * sizeof(desc[0]));
+
+	transfer_cfg->nda = (uint32_t)desc;
+	transfer_cfg->ndc = XDMAC_CNDC_NDE_DSCR_FETCH_EN
+			  | XDMAC_CNDC_NDSUP_SRC_PARAMS_UPDATED
+			  | XDMAC_CNDC_NDDUP_DST_PARAMS_UPDATED
+			  | XDMAC_CNDC_NDVIEW_NDV2;
+
+	return 0;
+}
+#endif
+
 static int sam_xdmac_config(const struct device *dev, uint32_t channel,
 			    struct dma_config *cfg)
 {
@@ -198,9 +278,10 @@ static int sam_xdmac_config(const struct device *dev, uint32_t channel,
 		return -EINVAL;
 	}
 
-	if (cfg->block_count != 1U) {
-		LOG_ERR("Only single block transfer is currently supported."
-			    " Please submit a patch.");
+	if (cfg->block_count == 0U || cfg->block_count > CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS) {
+		LOG_ERR("Only up to %d blocks per transfer are supported,"
+			" see CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS",
+			CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS);
 		return -EINVAL;
 	}
 
@@ -210,22 +291,6 @@ static int sam_xdmac_config(const struct device *dev, uint32_t channel,
 	dev_data->dma_channels[channel].data_size = data_size;
 	LOG_DBG("data_size=%d", data_size);
 
-	uint32_t xdmac_inc_cfg = 0;
-
-	if (cfg->head_block->source_addr_adj == DMA_ADDR_ADJ_INCREMENT
-		&& cfg->channel_direction == MEMORY_TO_PERIPHERAL) {
-		xdmac_inc_cfg |= XDMAC_CC_SAM_INCREMENTED_AM;
-	} else {
-		xdmac_inc_cfg |= XDMAC_CC_SAM_FIXED_AM;
-	}
-
-	if (cfg->head_block->dest_addr_adj == DMA_ADDR_ADJ_INCREMENT
-		&& cfg->channel_direction == PERIPHERAL_TO_MEMORY) {
-		xdmac_inc_cfg |= XDMAC_CC_DAM_INCREMENTED_AM;
-	} else {
-		xdmac_inc_cfg |= XDMAC_CC_DAM_FIXED_AM;
-	}
-
 	switch (cfg->channel_direction) {
 	case MEMORY_TO_MEMORY:
 		channel_cfg.cfg =
@@ -238,15 +303,13 @@ static int sam_xdmac_config(const struct device *dev, uint32_t channel,
 		channel_cfg.cfg =
 			  XDMAC_CC_TYPE_PER_TRAN
 			| XDMAC_CC_CSIZE(burst_size)
-			| XDMAC_CC_DSYNC_MEM2PER
-			| xdmac_inc_cfg;
+			| XDMAC_CC_DSYNC_MEM2PER;
 		break;
 	case PERIPHERAL_TO_MEMORY:
 		channel_cfg.cfg =
 			  XDMAC_CC_TYPE_PER_TRAN
 			| XDMAC_CC_CSIZE(burst_size)
-			| XDMAC_CC_DSYNC_PER2MEM
-			| xdmac_inc_cfg;
+			| XDMAC_CC_DSYNC_PER2MEM;
 		break;
 	default:
 		LOG_ERR("'channel_direction' value %d is not supported",
@@ -266,15 +329,29 @@ static int sam_xdmac_config(const struct device *dev, uint32_t channel,
 		  (cfg->complete_callback_en ? XDMAC_CIE_BIE : XDMAC_CIE_LIE)
 		| (cfg->error_callback_en ? XDMAC_INT_ERR : 0);
 
+	channel_cfg.cfg |= sam_xdmac_addr_mode(cfg, cfg->head_block);
+
 	ret = sam_xdmac_channel_configure(dev, channel, &channel_cfg);
 	if (ret < 0) {
 		return ret;
 	}
 
+	(void)memset(&transfer_cfg, 0, sizeof(transfer_cfg));
+
+#if CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS > 1
+	if (cfg->block_count > 1U) {
+		ret = sam_xdmac_linked_list_configure(dev, channel, cfg,
+				channel_cfg.cfg & ~(XDMAC_CC_SAM_Msk | XDMAC_CC_DAM_Msk),
+				&transfer_cfg);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+#endif
+
 	dev_data->dma_channels[channel].callback = cfg->dma_callback;
 	dev_data->dma_channels[channel].user_data = cfg->user_data;
 
-	(void)memset(&transfer_cfg, 0, sizeof(transfer_cfg));
 	transfer_cfg.sa = cfg->head_block->source_address;
 	transfer_cfg.da = cfg->head_block->dest_address;
 	transfer_cfg.ublen = cfg->head_block->block_size >> data_size;
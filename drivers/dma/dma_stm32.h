@@ -22,6 +22,7 @@ struct dma_stm32_stream {
 #endif /* CONFIG_DMAMUX_STM32 */
 	bool source_periph;
 	bool hal_override;
+	bool cyclic;
 	volatile bool busy;
 	uint32_t src_size;
 	uint32_t dst_size;
@@ -332,7 +332,9 @@ static void dwmac_rx_refill_thread(void *arg1, void *unused1, void *unused2)
 	struct dwmac_priv *p = arg1;
 	struct dwmac_dma_desc *d;
 	struct net_buf *frag;
-	unsigned int d_idx;
+	struct net_buf *new_frags[NB_RX_DESCS];
+	unsigned int d_idx, i, n, needed, used;
+	int got;
 
 	ARG_UNUSED(unused1);
 	ARG_UNUSED(unused2);
@@ -349,44 +351,77 @@ static void dwmac_rx_refill_thread(void *arg1, void *unused1, void *unused2)
 			break;
 		}
 
-		d = &p->rx_descs[d_idx];
+		/* then take all the others already available, to refill in one go */
+		for (n = 1; n < NB_RX_DESCS; n++) {
+			if (k_sem_take(&p->free_rx_descs, K_NO_WAIT) != 0) {
+				break;
+			}
+		}
 
-		__ASSERT(!(d->des3 & RDES3_OWN),
-			 "desc[%d]=0x%x: still hw owned! (sem/head/tail=%d/%d/%d)",
-			 d_idx, d->des3, k_sem_count_get(&p->free_rx_descs),
-			 p->rx_desc_head, p->rx_desc_tail);
+		/* get new fragments for those whose previous one was consumed */
+		needed = 0;
+		for (i = 0; i < n; i++) {
+			if (!p->rx_frags[(d_idx + i) % NB_RX_DESCS]) {
+				needed++;
+			}
+		}
 
-		frag = p->rx_frags[d_idx];
+		got = 0;
+		if (needed) {
+			got = net_pkt_get_reserve_rx_data_bulk(RX_FRAG_SIZE, new_frags,
+							       needed, K_FOREVER);
+			if (got <= 0) {
+				LOG_ERR("net_pkt_get_reserve_rx_data_bulk() failed (%d)", got);
+				for (i = 0; i < n; i++) {
+					k_sem_give(&p->free_rx_descs);
+				}
+				break;
+			}
+		}
+
+		used = 0;
+		for (i = 0; i < n; i++) {
+			d = &p->rx_descs[d_idx];
+
+			__ASSERT(!(d->des3 & RDES3_OWN),
+				 "desc[%d]=0x%x: still hw owned! (sem/head/tail=%d/%d/%d)",
+				 d_idx, d->des3, k_sem_count_get(&p->free_rx_descs),
+				 p->rx_desc_head, p->rx_desc_tail);
+
+			frag = p->rx_frags[d_idx];
 
-		/* get a new fragment if the previous one was consumed */
-		if (!frag) {
-			frag = net_pkt_get_reserve_rx_data(RX_FRAG_SIZE, K_FOREVER);
 			if (!frag) {
-				LOG_ERR("net_pkt_get_reserve_rx_data() returned NULL");
-				k_sem_give(&p->free_rx_descs);
-				break;
+				if (used == got) {
+					/* short allocation: leave the rest for the next round */
+					break;
+				}
+				frag = new_frags[used++];
+				LOG_DBG("new frag[%d] at %p", d_idx, frag->data);
+				__ASSERT(frag->size == RX_FRAG_SIZE, "");
+				sys_cache_data_invd_range(frag->data, frag->size);
+				p->rx_frags[d_idx] = frag;
+			} else {
+				LOG_DBG("reusing frag[%d] at %p", d_idx, frag->data);
 			}
-			LOG_DBG("new frag[%d] at %p", d_idx, frag->data);
-			__ASSERT(frag->size == RX_FRAG_SIZE, "");
-			sys_cache_data_invd_range(frag->data, frag->size);
-			p->rx_frags[d_idx] = frag;
-		} else {
-			LOG_DBG("reusing frag[%d] at %p", d_idx, frag->data);
+
+			/* all is good: initialize the descriptor */
+			d->des0 = phys_lo32(frag->data);
+			d->des1 = phys_hi32(frag->data);
+			d->des2 = 0;
+			d->des3 = RDES3_BUF1V | RDES3_IOC | RDES3_OWN;
+
+			/* advance to the next descriptor */
+			p->rx_desc_head = INC_WRAP(d_idx, NB_RX_DESCS);
 		}
 
-		/* all is good: initialize the descriptor */
-		d->des0 = phys_lo32(frag->data);
-		d->des1 = phys_hi32(frag->data);
-		d->des2 = 0;
-		d->des3 = RDES3_BUF1V | RDES3_IOC | RDES3_OWN;
+		for (; i < n; i++) {
+			k_sem_give(&p->free_rx_descs);
+		}
 
 		/* commit the above to memory */
 		barrier_dmem_fence_full();
 
-		/* advance to the next descriptor */
-		p->rx_desc_head = INC_WRAP(d_idx, NB_RX_DESCS);
-
-		/* lastly notify the hardware */
+		/* lastly notify the hardware, once for the whole batch */
 		REG_WRITE(DMA_CHn_RXDESC_TAIL_PTR(0), RXDESC_PHYS_L(d_idx));
 	}
 }
@@ -44,6 +44,12 @@ struct eth_ivshmem_dev_data {
 #if defined(CONFIG_NET_STATISTICS_ETHERNET)
 	struct net_stats_eth stats;
 #endif
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+	/* Serializes the RX thread with the release of lent frames */
+	struct k_spinlock rx_lock;
+	/* Incremented on each queue reset, which drops the lent frames */
+	uint32_t rx_epoch;
+#endif
 };
 
 struct eth_ivshmem_cfg_data {
@@ -52,6 +58,96 @@ struct eth_ivshmem_cfg_data {
 	void (*generate_mac_addr)(uint8_t mac_addr[6]);
 };
 
+static void eth_ivshmem_notify_peer(const struct device *dev)
+{
+	struct eth_ivshmem_dev_data *dev_data = dev->data;
+	const struct eth_ivshmem_cfg_data *cfg_data = dev->config;
+
+	ivshmem_int_peer(cfg_data->ivshmem, dev_data->peer_id, dev_data->tx_rx_vector);
+}
+
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+struct eth_ivshmem_rx_buf {
+	/* NULL until the frame is held */
+	const struct device *dev;
+	uint32_t epoch;
+	uint16_t idx;
+};
+
+static void eth_ivshmem_rx_buf_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_FIXED_DEFINE(eth_ivshmem_rx_bufs, CONFIG_ETH_IVSHMEM_RX_ZERO_COPY_BUFS,
+			  0, sizeof(struct eth_ivshmem_rx_buf), eth_ivshmem_rx_buf_destroy);
+
+/* Returns the frame to the peer once the stack is done with it */
+static void eth_ivshmem_rx_buf_destroy(struct net_buf *buf)
+{
+	struct eth_ivshmem_rx_buf rx_buf = *(struct eth_ivshmem_rx_buf *)net_buf_user_data(buf);
+	struct eth_ivshmem_dev_data *dev_data;
+	k_spinlock_key_t key;
+	int res = -EWOULDBLOCK;
+
+	net_buf_destroy(buf);
+
+	if (rx_buf.dev == NULL) {
+		return;
+	}
+
+	dev_data = rx_buf.dev->data;
+
+	key = k_spin_lock(&dev_data->rx_lock);
+	if (rx_buf.epoch == dev_data->rx_epoch) {
+		res = eth_ivshmem_queue_rx_release(&dev_data->ivshmem_queue, rx_buf.idx);
+	}
+	k_spin_unlock(&dev_data->rx_lock, key);
+
+	if (res == 0) {
+		eth_ivshmem_notify_peer(rx_buf.dev);
+	}
+}
+
+/* Lends the frame to the stack, returning -EWOULDBLOCK if it was not held */
+static int eth_ivshmem_rx_lend(const struct device *dev, struct net_pkt *pkt,
+			       struct net_buf *frag)
+{
+	struct eth_ivshmem_dev_data *dev_data = dev->data;
+	struct eth_ivshmem_rx_buf *rx_buf = net_buf_user_data(frag);
+	k_spinlock_key_t key;
+	int res;
+
+	key = k_spin_lock(&dev_data->rx_lock);
+	res = eth_ivshmem_queue_rx_hold(&dev_data->ivshmem_queue, &rx_buf->idx);
+	rx_buf->epoch = dev_data->rx_epoch;
+	k_spin_unlock(&dev_data->rx_lock, key);
+
+	if (res != 0) {
+		return res;
+	}
+
+	rx_buf->dev = dev;
+	net_pkt_append_buffer(pkt, frag);
+
+	return 0;
+}
+#endif /* CONFIG_ETH_IVSHMEM_RX_ZERO_COPY */
+
+static int eth_ivshmem_rx_complete(const struct device *dev)
+{
+	struct eth_ivshmem_dev_data *dev_data = dev->data;
+	int res;
+
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+	k_spinlock_key_t key = k_spin_lock(&dev_data->rx_lock);
+
+	res = eth_ivshmem_queue_rx_complete(&dev_data->ivshmem_queue);
+	k_spin_unlock(&dev_data->rx_lock, key);
+#else
+	res = eth_ivshmem_queue_rx_complete(&dev_data->ivshmem_queue);
+#endif
+
+	return res;
+}
+
 #if defined(CONFIG_NET_STATISTICS_ETHERNET)
 static struct net_stats_eth *eth_ivshmem_get_stats(const struct device *dev)
 {
@@ -94,7 +190,6 @@ static enum ethernet_hw_caps eth_ivshmem_caps(const struct device *dev)
 static int eth_ivshmem_send(const struct device *dev, struct net_pkt *pkt)
 {
 	struct eth_ivshmem_dev_data *dev_data = dev->data;
-	const struct eth_ivshmem_cfg_data *cfg_data = dev->config;
 	size_t len = net_pkt_get_len(pkt);
 
 	void *data;
@@ -113,20 +208,23 @@ static int eth_ivshmem_send(const struct device *dev, struct net_pkt *pkt)
 	}
 
 	res = eth_ivshmem_queue_tx_commit_buff(&dev_data->ivshmem_queue);
-	if (res == 0) {
+	if (res == 0 &&
+	    (!IS_ENABLED(CONFIG_ETH_IVSHMEM_TX_NOTIFY_EVENT) ||
+	     eth_ivshmem_queue_tx_need_notify(&dev_data->ivshmem_queue))) {
 		/* Notify peer */
-		ivshmem_int_peer(cfg_data->ivshmem, dev_data->peer_id, dev_data->tx_rx_vector);
+		eth_ivshmem_notify_peer(dev);
 	}
 
 	return res;
 }
 
-static struct net_pkt *eth_ivshmem_rx(const struct device *dev)
+/* Counts the frames returned to the peer in returned */
+static struct net_pkt *eth_ivshmem_rx(const struct device *dev, int *returned)
 {
 	struct eth_ivshmem_dev_data *dev_data = dev->data;
-	const struct eth_ivshmem_cfg_data *cfg_data = dev->config;
 	const void *rx_data;
 	size_t rx_len;
+	size_t copy_len;
 
 	int res = eth_ivshmem_queue_rx(&dev_data->ivshmem_queue, &rx_data, &rx_len);
 
@@ -138,24 +236,62 @@ static struct net_pkt *eth_ivshmem_rx(const struct device *dev)
 		return NULL;
 	}
 
+	copy_len = rx_len;
+
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+	/* The headers are copied, the stack may modify them while the peer
+	 * section is read only. Frames are copied when no buffer is left.
+	 */
+	struct net_buf *frag = NULL;
+
+	if (rx_len > CONFIG_ETH_IVSHMEM_RX_COPYBREAK) {
+		frag = net_buf_alloc_with_data(
+			&eth_ivshmem_rx_bufs,
+			(uint8_t *)rx_data + CONFIG_ETH_IVSHMEM_RX_COPYBREAK,
+			rx_len - CONFIG_ETH_IVSHMEM_RX_COPYBREAK, K_NO_WAIT);
+		if (frag != NULL) {
+			memset(net_buf_user_data(frag), 0, sizeof(struct eth_ivshmem_rx_buf));
+			copy_len = CONFIG_ETH_IVSHMEM_RX_COPYBREAK;
+		}
+	}
+#endif
+
 	struct net_pkt *pkt = net_pkt_rx_alloc_with_buffer(
-		dev_data->iface, rx_len, AF_UNSPEC, 0, K_MSEC(100));
+		dev_data->iface, copy_len, AF_UNSPEC, 0, K_MSEC(100));
 	if (pkt == NULL) {
 		LOG_ERR("Failed to allocate rx buffer");
 		eth_stats_update_errors_rx(dev_data->iface);
 		goto dequeue;
 	}
 
-	if (net_pkt_write(pkt, rx_data, rx_len) != 0) {
+	if (net_pkt_write(pkt, rx_data, copy_len) != 0) {
 		LOG_ERR("Failed to write rx packet");
 		eth_stats_update_errors_rx(dev_data->iface);
 		net_pkt_unref(pkt);
+		pkt = NULL;
+		goto dequeue;
 	}
 
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+	if (frag != NULL) {
+		if (eth_ivshmem_rx_lend(dev, pkt, frag) == 0) {
+			return pkt;
+		}
+
+		net_pkt_unref(pkt);
+		pkt = NULL;
+	}
+#endif
+
 dequeue:
-	if (eth_ivshmem_queue_rx_complete(&dev_data->ivshmem_queue) == 0) {
-		/* Notify peer */
-		ivshmem_int_peer(cfg_data->ivshmem, dev_data->peer_id, dev_data->tx_rx_vector);
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+	if (frag != NULL) {
+		net_buf_unref(frag);
+	}
+#endif
+
+	if (eth_ivshmem_rx_complete(dev) == 0) {
+		(*returned)++;
 	}
 
 	return pkt;
@@ -197,7 +333,14 @@ static void eth_ivshmem_state_update(const struct device *dev)
 			/* Peer is not ready for init */
 			break;
 		}
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+		K_SPINLOCK(&dev_data->rx_lock) {
+			dev_data->rx_epoch++;
+			eth_ivshmem_queue_reset(&dev_data->ivshmem_queue);
+		}
+#else
 		eth_ivshmem_queue_reset(&dev_data->ivshmem_queue);
+#endif
 		eth_ivshmem_set_state(dev, ETH_IVSHMEM_STATE_READY);
 		break;
 	case ETH_IVSHMEM_STATE_READY:
@@ -246,8 +389,15 @@ FUNC_NORETURN static void eth_ivshmem_thread(void *arg1, void *arg2, void *arg3)
 			continue;
 		}
 
+		int returned = 0;
+
 		while (true) {
-			struct net_pkt *pkt = eth_ivshmem_rx(dev);
+			struct net_pkt *pkt = eth_ivshmem_rx(dev, &returned);
+
+			if (returned >= CONFIG_ETH_IVSHMEM_RX_NOTIFY_BATCH) {
+				eth_ivshmem_notify_peer(dev);
+				returned = 0;
+			}
 
 			if (pkt == NULL) {
 				break;
@@ -260,6 +410,10 @@ FUNC_NORETURN static void eth_ivshmem_thread(void *arg1, void *arg2, void *arg3)
 
 			k_yield();
 		};
+
+		if (returned > 0) {
+			eth_ivshmem_notify_peer(dev);
+		}
 	}
 }
 
@@ -11,8 +11,13 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <zephyr/sys/atomic.h>
+
 #include <openamp/virtio_ring.h>
 
+/* Largest descriptor ring, see calc_vring_size() */
+#define ETH_IVSHMEM_DESC_MAX_LEN 4096
+
 struct eth_ivshmem_queue {
 	struct {
 		struct vring vring;
@@ -27,12 +32,21 @@ struct eth_ivshmem_queue {
 
 		uint32_t pending_data_head;
 		uint32_t pending_data_len;
+
+		/* Available index when the peer was last notified */
+		uint16_t notify_idx;
 	} tx;
 	struct {
 		struct vring vring;
 		void *shmem;
 		uint16_t avail_idx;
 		uint16_t used_idx;
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+		/* Frames released, by available index, which can only be
+		 * returned to the peer in order
+		 */
+		ATOMIC_DEFINE(done, ETH_IVSHMEM_DESC_MAX_LEN);
+#endif
 	} rx;
 	uint16_t desc_max_len;
 	uint32_t vring_header_size;
@@ -47,5 +61,10 @@ int eth_ivshmem_queue_tx_get_buff(struct eth_ivshmem_queue *q, void **data, size
 int eth_ivshmem_queue_tx_commit_buff(struct eth_ivshmem_queue *q);
 int eth_ivshmem_queue_rx(struct eth_ivshmem_queue *q, const void **data, size_t *len);
 int eth_ivshmem_queue_rx_complete(struct eth_ivshmem_queue *q);
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+int eth_ivshmem_queue_rx_hold(struct eth_ivshmem_queue *q, uint16_t *idx);
+int eth_ivshmem_queue_rx_release(struct eth_ivshmem_queue *q, uint16_t idx);
+#endif
+bool eth_ivshmem_queue_tx_need_notify(struct eth_ivshmem_queue *q);
 
 #endif /* ETH_IVSHMEM_PRIV_H */
@@ -26,6 +26,8 @@ static int calc_vring_size(
 static uint32_t tx_buffer_advance(uint32_t max_len, uint32_t *position, uint32_t *len);
 static int tx_clean_used(struct eth_ivshmem_queue *q);
 static int get_rx_avail_desc_idx(struct eth_ivshmem_queue *q, uint16_t *avail_desc_idx);
+static void rx_put_used(struct eth_ivshmem_queue *q, uint16_t desc_idx);
+static void rx_advance(struct eth_ivshmem_queue *q);
 
 int eth_ivshmem_queue_init(
 		struct eth_ivshmem_queue *q, uintptr_t shmem,
@@ -82,8 +84,12 @@ void eth_ivshmem_queue_reset(struct eth_ivshmem_queue *q)
 	q->tx.used_idx = 0;
 	q->tx.pending_data_head = 0;
 	q->tx.pending_data_len = 0;
+	q->tx.notify_idx = 0;
 	q->rx.avail_idx = 0;
 	q->rx.used_idx = 0;
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+	memset(q->rx.done, 0, sizeof(q->rx.done));
+#endif
 
 	memset(q->tx.shmem, 0, q->vring_header_size);
 
@@ -159,6 +165,19 @@ int eth_ivshmem_queue_tx_commit_buff(struct eth_ivshmem_queue *q)
 	return 0;
 }
 
+bool eth_ivshmem_queue_tx_need_notify(struct eth_ivshmem_queue *q)
+{
+	uint16_t old_idx = q->tx.notify_idx;
+
+	/* The peer publishes the index up to which it read the frames */
+	atomic_thread_fence(memory_order_seq_cst);
+	VRING_INVALIDATE(vring_avail_event(&q->tx.vring));
+
+	q->tx.notify_idx = q->tx.avail_idx;
+
+	return vring_need_event(vring_avail_event(&q->tx.vring), q->tx.avail_idx, old_idx);
+}
+
 int eth_ivshmem_queue_rx(struct eth_ivshmem_queue *q, const void **data, size_t *len)
 {
 	*data = NULL;
@@ -192,6 +211,17 @@ int eth_ivshmem_queue_rx(struct eth_ivshmem_queue *q, const void **data, size_t
 
 int eth_ivshmem_queue_rx_complete(struct eth_ivshmem_queue *q)
 {
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+	/* Returned behind the frames still held */
+	uint16_t idx;
+	int res = eth_ivshmem_queue_rx_hold(q, &idx);
+
+	if (res != 0) {
+		return res;
+	}
+
+	return eth_ivshmem_queue_rx_release(q, idx);
+#else
 	uint16_t avail_desc_idx;
 	int res = get_rx_avail_desc_idx(q, &avail_desc_idx);
 
@@ -199,25 +229,54 @@ int eth_ivshmem_queue_rx_complete(struct eth_ivshmem_queue *q)
 		return res;
 	}
 
-	uint16_t used_idx = q->rx.used_idx % q->desc_max_len;
+	rx_put_used(q, avail_desc_idx);
+	rx_advance(q);
 
-	q->rx.used_idx++;
-	q->rx.vring.used->ring[used_idx].id = avail_desc_idx;
-	q->rx.vring.used->ring[used_idx].len = 1;
-	VRING_FLUSH(q->rx.vring.used->ring[used_idx]);
-	atomic_thread_fence(memory_order_seq_cst);
+	return 0;
+#endif
+}
 
-	q->rx.vring.used->idx = q->rx.used_idx;
-	VRING_FLUSH(q->rx.vring.used->idx);
-	atomic_thread_fence(memory_order_seq_cst);
+#if defined(CONFIG_ETH_IVSHMEM_RX_ZERO_COPY)
+int eth_ivshmem_queue_rx_hold(struct eth_ivshmem_queue *q, uint16_t *idx)
+{
+	uint16_t avail_desc_idx;
+	int res = get_rx_avail_desc_idx(q, &avail_desc_idx);
 
-	q->rx.avail_idx++;
-	vring_avail_event(&q->rx.vring) = q->rx.avail_idx;
-	VRING_FLUSH(vring_avail_event(&q->rx.vring));
+	if (res != 0) {
+		return res;
+	}
+
+	*idx = q->rx.avail_idx;
+	rx_advance(q);
 
 	return 0;
 }
 
+int eth_ivshmem_queue_rx_release(struct eth_ivshmem_queue *q, uint16_t idx)
+{
+	uint16_t held = q->rx.avail_idx - q->rx.used_idx;
+	int res = -EWOULDBLOCK;
+
+	if ((uint16_t)(idx - q->rx.used_idx) >= held) {
+		return -EINVAL;
+	}
+
+	atomic_set_bit(q->rx.done, idx % q->desc_max_len);
+
+	while (q->rx.used_idx != q->rx.avail_idx &&
+		atomic_test_and_clear_bit(q->rx.done, q->rx.used_idx % q->desc_max_len)) {
+		uint16_t ring_idx = q->rx.used_idx % q->desc_max_len;
+
+		/* The peer does not reuse the entry before it is returned */
+		VRING_INVALIDATE(q->rx.vring.avail->ring[ring_idx]);
+		rx_put_used(q, q->rx.vring.avail->ring[ring_idx]);
+		res = 0;
+	}
+
+	return res;
+}
+#endif /* CONFIG_ETH_IVSHMEM_RX_ZERO_COPY */
+
 /**
  * Calculates the vring descriptor length and header size.
  * This must match what is calculated by the peer.
@@ -230,7 +289,7 @@ static int calc_vring_size(
 	uint32_t header_size;
 	int16_t desc_len;
 
-	for (desc_len = 4096; desc_len > 32; desc_len >>= 1) {
+	for (desc_len = ETH_IVSHMEM_DESC_MAX_LEN; desc_len > 32; desc_len >>= 1) {
 		header_size = vring_size(desc_len, ETH_IVSHMEM_VRING_ALIGNMENT);
 		header_size = ROUND_UP(header_size, ETH_IVSHMEM_VRING_ALIGNMENT);
 		if (header_size < section_size / 8) {
@@ -309,6 +368,30 @@ static int tx_clean_used(struct eth_ivshmem_queue *q)
 	return 0;
 }
 
+/* Returns a received frame to the peer */
+static void rx_put_used(struct eth_ivshmem_queue *q, uint16_t desc_idx)
+{
+	uint16_t used_idx = q->rx.used_idx % q->desc_max_len;
+
+	q->rx.used_idx++;
+	q->rx.vring.used->ring[used_idx].id = desc_idx;
+	q->rx.vring.used->ring[used_idx].len = 1;
+	VRING_FLUSH(q->rx.vring.used->ring[used_idx]);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	q->rx.vring.used->idx = q->rx.used_idx;
+	VRING_FLUSH(q->rx.vring.used->idx);
+	atomic_thread_fence(memory_order_seq_cst);
+}
+
+/* Moves to the next received frame */
+static void rx_advance(struct eth_ivshmem_queue *q)
+{
+	q->rx.avail_idx++;
+	vring_avail_event(&q->rx.vring) = q->rx.avail_idx;
+	VRING_FLUSH(vring_avail_event(&q->rx.vring));
+}
+
 static int get_rx_avail_desc_idx(struct eth_ivshmem_queue *q, uint16_t *avail_desc_idx)
 {
 	atomic_thread_fence(memory_order_seq_cst);
@@ -0,0 +1,523 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT zephyr_flash_cache
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/drivers/flash/flash_cache.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(flash_cache, CONFIG_FLASH_LOG_LEVEL);
+
+/* Offset of a cache page which holds no data */
+#define NO_PAGE ((off_t)-1)
+
+struct flash_cache_page {
+	/* Offset of the page in the flash device, NO_PAGE if unused */
+	off_t offset;
+	/* Value of the access counter at the last access of the page */
+	uint32_t used;
+	/* Range of the page written to the cache but not to the flash,
+	 * empty when dirty_start == dirty_end
+	 */
+	uint32_t dirty_start;
+	uint32_t dirty_end;
+	uint8_t *buf;
+};
+
+struct flash_cache_config {
+	const struct device *flash;
+	uint32_t page_size;
+	uint32_t page_count;
+	bool write_back;
+	bool prefetch;
+};
+
+struct flash_cache_data {
+	struct k_mutex lock;
+	struct flash_cache_page *pages;
+	uint8_t *bufs;
+	/* Access counter used to find the least recently used page */
+	uint32_t counter;
+	/* Offset of the page of the last read which missed the cache */
+	off_t last_miss;
+};
+
+static struct flash_cache_page *page_find(const struct device *dev, off_t offset)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+
+	for (uint32_t i = 0; i < cfg->page_count; i++) {
+		if (data->pages[i].offset == offset) {
+			return &data->pages[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void page_use(const struct device *dev, struct flash_cache_page *page)
+{
+	struct flash_cache_data *data = dev->data;
+
+	page->used = ++data->counter;
+}
+
+/* Write the dirty range of a page to the flash */
+static int page_flush(const struct device *dev, struct flash_cache_page *page)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	int rc;
+
+	if (page->dirty_start == page->dirty_end) {
+		return 0;
+	}
+
+	rc = flash_write(cfg->flash, page->offset + page->dirty_start,
+			 &page->buf[page->dirty_start],
+			 page->dirty_end - page->dirty_start);
+	if (rc) {
+		LOG_ERR("Failed to flush %lx (%d)", (long)page->offset, rc);
+		return rc;
+	}
+
+	page->dirty_start = 0;
+	page->dirty_end = 0;
+
+	return 0;
+}
+
+/* Get a page for the given offset, the least recently used one if the
+ * offset is not cached, and fill it from the flash.
+ */
+static int page_load(const struct device *dev, off_t offset,
+		     struct flash_cache_page **result)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+	struct flash_cache_page *page;
+	int rc;
+
+	page = page_find(dev, offset);
+	if (page != NULL) {
+		page_use(dev, page);
+		*result = page;
+		return 0;
+	}
+
+	page = &data->pages[0];
+	for (uint32_t i = 1; i < cfg->page_count; i++) {
+		if (page->offset == NO_PAGE) {
+			break;
+		}
+		if ((data->pages[i].offset == NO_PAGE) ||
+		    ((int32_t)(data->pages[i].used - page->used) < 0)) {
+			page = &data->pages[i];
+		}
+	}
+
+	rc = page_flush(dev, page);
+	if (rc) {
+		return rc;
+	}
+
+	page->offset = NO_PAGE;
+
+	rc = flash_read(cfg->flash, offset, page->buf, cfg->page_size);
+	if (rc) {
+		return rc;
+	}
+
+	page->offset = offset;
+	page_use(dev, page);
+	*result = page;
+
+	return 0;
+}
+
+static int flash_cache_read(const struct device *dev, off_t offset, void *buf,
+			    size_t len)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+	struct flash_cache_page *page, *next;
+	uint8_t *dst = buf;
+	off_t page_offset;
+	size_t chunk;
+	int rc = 0;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	while (len > 0) {
+		page_offset = ROUND_DOWN(offset, cfg->page_size);
+		chunk = MIN(len, (size_t)(page_offset + cfg->page_size - offset));
+
+		page = page_find(dev, page_offset);
+		if (page == NULL) {
+			bool sequential = (data->last_miss + cfg->page_size) == page_offset;
+
+			data->last_miss = page_offset;
+
+			rc = page_load(dev, page_offset, &page);
+			if (rc) {
+				break;
+			}
+
+			/* The next page is likely to be read too, it is
+			 * loaded now unless it is past the end of the flash.
+			 */
+			if (cfg->prefetch && sequential && (cfg->page_count > 1) &&
+			    (page_find(dev, page_offset + cfg->page_size) == NULL)) {
+				if (page_load(dev, page_offset + cfg->page_size, &next) == 0) {
+					data->last_miss = page_offset + cfg->page_size;
+				}
+				page_use(dev, page);
+			}
+		} else {
+			page_use(dev, page);
+		}
+
+		memcpy(dst, &page->buf[offset - page_offset], chunk);
+
+		dst += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return rc;
+}
+
+/* Write to the flash and update the cached copies */
+static int write_through(const struct device *dev, off_t offset, const uint8_t *src,
+			 size_t len)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_page *page;
+	off_t page_offset;
+	size_t chunk;
+	int rc;
+
+	rc = flash_write(cfg->flash, offset, src, len);
+	if (rc) {
+		return rc;
+	}
+
+	while (len > 0) {
+		page_offset = ROUND_DOWN(offset, cfg->page_size);
+		chunk = MIN(len, (size_t)(page_offset + cfg->page_size - offset));
+
+		page = page_find(dev, page_offset);
+		if (page != NULL) {
+			memcpy(&page->buf[offset - page_offset], src, chunk);
+		}
+
+		src += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+/* Write to the cache, contiguous writes to a page are written to the flash
+ * at once when the page is flushed.
+ */
+static int write_back(const struct device *dev, off_t offset, const uint8_t *src,
+		      size_t len)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_page *page;
+	uint32_t start, end;
+	off_t page_offset;
+	size_t chunk;
+	int rc;
+
+	while (len > 0) {
+		page_offset = ROUND_DOWN(offset, cfg->page_size);
+		chunk = MIN(len, (size_t)(page_offset + cfg->page_size - offset));
+		start = offset - page_offset;
+		end = start + chunk;
+
+		rc = page_load(dev, page_offset, &page);
+		if (rc) {
+			return rc;
+		}
+
+		/* The flash is never written twice at the same place, so a
+		 * write which does not extend the dirty range flushes it.
+		 */
+		if ((page->dirty_start != page->dirty_end) &&
+		    (start != page->dirty_end) && (end != page->dirty_start)) {
+			rc = page_flush(dev, page);
+			if (rc) {
+				return rc;
+			}
+		}
+
+		memcpy(&page->buf[start], src, chunk);
+
+		if (page->dirty_start == page->dirty_end) {
+			page->dirty_start = start;
+			page->dirty_end = end;
+		} else {
+			page->dirty_start = MIN(page->dirty_start, start);
+			page->dirty_end = MAX(page->dirty_end, end);
+		}
+
+		if ((page->dirty_start == 0) && (page->dirty_end == cfg->page_size)) {
+			rc = page_flush(dev, page);
+			if (rc) {
+				return rc;
+			}
+		}
+
+		src += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+static int flash_cache_write(const struct device *dev, off_t offset,
+			     const void *buf, size_t len)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+	int rc;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	if (cfg->write_back) {
+		rc = write_back(dev, offset, buf, len);
+	} else {
+		rc = write_through(dev, offset, buf, len);
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return rc;
+}
+
+static int flash_cache_erase(const struct device *dev, off_t offset, size_t size)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+	struct flash_cache_page *page;
+	int rc = 0;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	for (uint32_t i = 0; i < cfg->page_count; i++) {
+		page = &data->pages[i];
+
+		if ((page->offset == NO_PAGE) || (page->offset + cfg->page_size <= offset) ||
+		    (page->offset >= offset + size)) {
+			continue;
+		}
+
+		/* Data which is erased is not written */
+		if ((page->offset + page->dirty_start < offset) ||
+		    (page->offset + page->dirty_end > offset + size)) {
+			rc = page_flush(dev, page);
+			if (rc) {
+				goto out;
+			}
+		}
+
+		page->offset = NO_PAGE;
+		page->dirty_start = 0;
+		page->dirty_end = 0;
+	}
+
+	rc = flash_erase(cfg->flash, offset, size);
+out:
+	k_mutex_unlock(&data->lock);
+
+	return rc;
+}
+
+static const struct flash_parameters *flash_cache_get_parameters(const struct device *dev)
+{
+	const struct flash_cache_config *cfg = dev->config;
+
+	return flash_get_parameters(cfg->flash);
+}
+
+#if defined(CONFIG_FLASH_PAGE_LAYOUT)
+static void flash_cache_page_layout(const struct device *dev,
+				    const struct flash_pages_layout **layout,
+				    size_t *layout_size)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	const struct flash_driver_api *api = cfg->flash->api;
+
+	if (api->page_layout == NULL) {
+		*layout = NULL;
+		*layout_size = 0;
+		return;
+	}
+
+	api->page_layout(cfg->flash, layout, layout_size);
+}
+#endif
+
+#if defined(CONFIG_FLASH_JESD216_API)
+static int flash_cache_sfdp_read(const struct device *dev, off_t offset, void *buf,
+				 size_t len)
+{
+	const struct flash_cache_config *cfg = dev->config;
+
+	return flash_sfdp_read(cfg->flash, offset, buf, len);
+}
+
+static int flash_cache_read_jedec_id(const struct device *dev, uint8_t *id)
+{
+	const struct flash_cache_config *cfg = dev->config;
+
+	return flash_read_jedec_id(cfg->flash, id);
+}
+#endif
+
+#if defined(CONFIG_FLASH_EX_OP_ENABLED)
+static int flash_cache_ex_op(const struct device *dev, uint16_t code,
+			     const uintptr_t in, void *out)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+	int rc;
+
+	/* The operation may change the flash content in any way */
+	rc = flash_cache_invalidate(dev);
+	if (rc) {
+		return rc;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+	rc = flash_ex_op(cfg->flash, code, in, out);
+	k_mutex_unlock(&data->lock);
+
+	return rc;
+}
+#endif
+
+int flash_cache_flush(const struct device *dev)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+	int rc = 0;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	for (uint32_t i = 0; (i < cfg->page_count) && !rc; i++) {
+		rc = page_flush(dev, &data->pages[i]);
+	}
+
+	k_mutex_unlock(&data->lock);
+
+	return rc;
+}
+
+int flash_cache_invalidate(const struct device *dev)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+	int rc = 0;
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	for (uint32_t i = 0; (i < cfg->page_count) && !rc; i++) {
+		rc = page_flush(dev, &data->pages[i]);
+		if (!rc) {
+			data->pages[i].offset = NO_PAGE;
+		}
+	}
+
+	data->last_miss = NO_PAGE;
+
+	k_mutex_unlock(&data->lock);
+
+	return rc;
+}
+
+static const struct flash_driver_api flash_cache_api = {
+	.read = flash_cache_read,
+	.write = flash_cache_write,
+	.erase = flash_cache_erase,
+	.get_parameters = flash_cache_get_parameters,
+#if defined(CONFIG_FLASH_PAGE_LAYOUT)
+	.page_layout = flash_cache_page_layout,
+#endif
+#if defined(CONFIG_FLASH_JESD216_API)
+	.sfdp_read = flash_cache_sfdp_read,
+	.read_jedec_id = flash_cache_read_jedec_id,
+#endif
+#if defined(CONFIG_FLASH_EX_OP_ENABLED)
+	.ex_op = flash_cache_ex_op,
+#endif
+};
+
+static int flash_cache_init(const struct device *dev)
+{
+	const struct flash_cache_config *cfg = dev->config;
+	struct flash_cache_data *data = dev->data;
+
+	if (!device_is_ready(cfg->flash)) {
+		LOG_ERR("Flash device %s not ready", cfg->flash->name);
+		return -ENODEV;
+	}
+
+	if (cfg->page_size % flash_get_write_block_size(cfg->flash)) {
+		LOG_ERR("Cache page size not a multiple of the write block size");
+		return -EINVAL;
+	}
+
+	k_mutex_init(&data->lock);
+
+	for (uint32_t i = 0; i < cfg->page_count; i++) {
+		data->pages[i].offset = NO_PAGE;
+		data->pages[i].buf = &data->bufs[i * cfg->page_size];
+	}
+
+	data->last_miss = NO_PAGE;
+
+	return 0;
+}
+
+#define FLASH_CACHE_DEFINE(n)								\
+	BUILD_ASSERT(IS_POWER_OF_TWO(DT_INST_PROP(n, cache_page_size)),			\
+		     "Cache page size must be a power of 2");				\
+											\
+	static struct flash_cache_page flash_cache_pages_##n[DT_INST_PROP(n, cache_page_count)]; \
+	static uint8_t flash_cache_bufs_##n[DT_INST_PROP(n, cache_page_count) *	\
+					    DT_INST_PROP(n, cache_page_size)]		\
+		__aligned(sizeof(uint32_t));						\
+											\
+	static struct flash_cache_data flash_cache_data_##n = {				\
+		.pages = flash_cache_pages_##n,						\
+		.bufs = flash_cache_bufs_##n,						\
+	};										\
+											\
+	static const struct flash_cache_config flash_cache_config_##n = {		\
+		.flash = DEVICE_DT_GET(DT_INST_PHANDLE(n, flash_device)),		\
+		.page_size = DT_INST_PROP(n, cache_page_size),				\
+		.page_count = DT_INST_PROP(n, cache_page_count),			\
+		.write_back = DT_INST_PROP(n, write_back),				\
+		.prefetch = DT_INST_PROP(n, sequential_prefetch),			\
+	};										\
+											\
+	DEVICE_DT_INST_DEFINE(n, flash_cache_init, NULL,				\
+			      &flash_cache_data_##n, &flash_cache_config_##n,		\
+			      POST_KERNEL, CONFIG_FLASH_CACHE_INIT_PRIORITY,		\
+			      &flash_cache_api);
+
+DT_INST_FOREACH_STATUS_OKAY(FLASH_CACHE_DEFINE)
@@ -127,6 +127,26 @@ struct spi_nor_data {
 	 */
 	bool flag_access_32bit: 1;
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	/* Set while an erase is in progress, between the erase command and
+	 * the next check that it ended.
+	 */
+	bool erase_busy;
+
+	/* Area erased by the erase in progress */
+	off_t erase_addr;
+	size_t erase_size;
+
+	/* Cycle count at the last erase resume */
+	uint32_t erase_resume_cycle;
+
+	/* Erase suspend and resume commands, cmd_erase_sus is 0 if the
+	 * device does not support them.
+	 */
+	uint8_t cmd_erase_sus;
+	uint8_t cmd_erase_res;
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 	/* Minimal SFDP stores no dynamic configuration.  Runtime and
 	 * devicetree store page size and erase_types; runtime also
 	 * stores flash size and layout.
@@ -273,6 +293,11 @@ static inline void delay_until_exit_dpd_ok(const struct device *const dev)
  */
 #define NOR_ACCESS_32BIT_ADDR BIT(2)
 
+/* Indicates that the address is followed by a dummy byte, as required
+ * by the Fast Read command.
+ */
+#define NOR_ACCESS_DUMMY_BYTE BIT(3)
+
 /* Indicates that an access command is performing a write.  If not
  * provided access is a read.
  */
@@ -298,7 +323,7 @@ static int spi_nor_access(const struct device *const dev,
 	struct spi_nor_data *const driver_data = dev->data;
 	bool is_addressed = (access & NOR_ACCESS_ADDRESSED) != 0U;
 	bool is_write = (access & NOR_ACCESS_WRITE) != 0U;
-	uint8_t buf[5] = { 0 };
+	uint8_t buf[6] = { 0 };
 	struct spi_buf spi_buf[2] = {
 		{
 			.buf = buf,
@@ -331,6 +356,10 @@ static int spi_nor_access(const struct device *const dev,
 			memcpy(&buf[1], &addr32.u8[1], 3);
 			spi_buf[0].len += 3;
 		}
+
+		if ((access & NOR_ACCESS_DUMMY_BYTE) != 0U) {
+			spi_buf[0].len += 1;
+		}
 	};
 
 	const struct spi_buf_set tx_set = {
@@ -354,6 +383,9 @@ static int spi_nor_access(const struct device *const dev,
 	spi_nor_access(dev, opcode, 0, 0, dest, length)
 #define spi_nor_cmd_addr_read(dev, opcode, addr, dest, length) \
 	spi_nor_access(dev, opcode, NOR_ACCESS_ADDRESSED, addr, dest, length)
+#define spi_nor_cmd_addr_fast_read(dev, opcode, addr, dest, length) \
+	spi_nor_access(dev, opcode, NOR_ACCESS_ADDRESSED | NOR_ACCESS_DUMMY_BYTE, \
+		       addr, dest, length)
 #define spi_nor_cmd_write(dev, opcode) \
 	spi_nor_access(dev, opcode, NOR_ACCESS_WRITE, 0, NULL, 0)
 #define spi_nor_cmd_addr_write(dev, opcode, addr, src, length) \
@@ -458,6 +490,26 @@ static int exit_dpd(const struct device *const dev)
 	return ret;
 }
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+/* Wait for the end of the erase in progress, if any.
+ *
+ * @note The device must be externally acquired before invoking this
+ * function.
+ */
+static int spi_nor_erase_wait(const struct device *dev)
+{
+	struct spi_nor_data *const driver_data = dev->data;
+	int ret = 0;
+
+	if (driver_data->erase_busy) {
+		ret = spi_nor_wait_until_ready(dev);
+		driver_data->erase_busy = false;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 /* Everything necessary to acquire owning access to the device.
  *
  * This means taking the lock and, if necessary, waking the device
@@ -471,6 +523,11 @@ static void acquire_device(const struct device *dev)
 		k_sem_take(&driver_data->sem, K_FOREVER);
 	}
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	/* Only reads are done while an erase is in progress */
+	(void)spi_nor_erase_wait(dev);
+#endif
+
 	if (IS_ENABLED(CONFIG_SPI_NOR_IDLE_IN_DPD)) {
 		exit_dpd(dev);
 	}
@@ -660,6 +717,97 @@ static int mxicy_configure(const struct device *dev, const uint8_t *jedec_id)
 
 #endif /* DT_INST_NODE_HAS_PROP(0, mxicy_mx25r_power_mode) */
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+/* Let a read of the given area run during the erase in progress, by
+ * suspending the erase, or by waiting for its end if the area is being
+ * erased or the device does not support erase suspend.
+ *
+ * @note The device must be externally acquired before invoking this
+ * function.
+ *
+ * @return 1 if the erase was suspended, 0 if there is no erase in
+ * progress, negative errno code otherwise
+ */
+static int spi_nor_erase_suspend(const struct device *dev, off_t addr, size_t size)
+{
+	struct spi_nor_data *const driver_data = dev->data;
+	uint32_t elapsed;
+	int ret;
+
+	if (!driver_data->erase_busy) {
+		return 0;
+	}
+
+	if ((driver_data->cmd_erase_sus == 0)
+	    || ((addr < driver_data->erase_addr + driver_data->erase_size)
+		&& (driver_data->erase_addr < addr + size))) {
+		return spi_nor_erase_wait(dev);
+	}
+
+	/* Let the erase progress since it was last resumed */
+	elapsed = k_cyc_to_us_floor32(k_cycle_get_32() - driver_data->erase_resume_cycle);
+	if (elapsed < CONFIG_SPI_NOR_ERASE_RESUME_TIME) {
+		k_busy_wait(CONFIG_SPI_NOR_ERASE_RESUME_TIME - elapsed);
+	}
+
+	ret = spi_nor_cmd_write(dev, driver_data->cmd_erase_sus);
+	if (ret == 0) {
+		/* WIP is cleared once the erase is suspended */
+		ret = spi_nor_wait_until_ready(dev);
+	}
+
+	return (ret == 0) ? 1 : ret;
+}
+
+/* Resume the erase suspended by spi_nor_erase_suspend().
+ *
+ * @note The device must be externally acquired before invoking this
+ * function.
+ */
+static int spi_nor_erase_resume(const struct device *dev)
+{
+	struct spi_nor_data *const driver_data = dev->data;
+	int ret;
+
+	ret = spi_nor_cmd_write(dev, driver_data->cmd_erase_res);
+	driver_data->erase_resume_cycle = k_cycle_get_32();
+
+	return ret;
+}
+
+/* Wait for the end of the erase of the given area, which was just
+ * started, releasing the device meanwhile so that reads can suspend it.
+ *
+ * @note The device must be externally acquired before invoking this
+ * function.
+ */
+static int spi_nor_erase_poll(const struct device *dev, off_t addr, size_t size)
+{
+	struct spi_nor_data *const driver_data = dev->data;
+	int ret = 0;
+
+	driver_data->erase_addr = addr;
+	driver_data->erase_size = size;
+	driver_data->erase_busy = true;
+
+	/* Other operations end the erase in acquire_device() */
+	while (driver_data->erase_busy) {
+		k_sem_give(&driver_data->sem);
+		k_sleep(K_USEC(CONFIG_SPI_NOR_ERASE_POLL_INTERVAL));
+		k_sem_take(&driver_data->sem, K_FOREVER);
+
+		if (driver_data->erase_busy) {
+			ret = spi_nor_rdsr(dev);
+			if ((ret < 0) || ((ret & SPI_NOR_WIP_BIT) == 0)) {
+				driver_data->erase_busy = false;
+			}
+		}
+	}
+
+	return MIN(ret, 0);
+}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 			size_t size)
 {
@@ -671,11 +819,41 @@ static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	struct spi_nor_data *const driver_data = dev->data;
+	int suspended;
+
+	/* Not acquire_device(), which waits for the end of an erase */
+	k_sem_take(&driver_data->sem, K_FOREVER);
+
+	suspended = spi_nor_erase_suspend(dev, addr, size);
+	if (suspended < 0) {
+		k_sem_give(&driver_data->sem);
+		return suspended;
+	}
+#else
 	acquire_device(dev);
+#endif
 
-	ret = spi_nor_cmd_addr_read(dev, SPI_NOR_CMD_READ, addr, dest, size);
+	if (IS_ENABLED(CONFIG_SPI_NOR_FAST_READ)) {
+		ret = spi_nor_cmd_addr_fast_read(dev, SPI_NOR_CMD_READ_FAST, addr, dest, size);
+	} else {
+		ret = spi_nor_cmd_addr_read(dev, SPI_NOR_CMD_READ, addr, dest, size);
+	}
+
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	if (suspended > 0) {
+		int ret2 = spi_nor_erase_resume(dev);
+
+		if (!ret) {
+			ret = ret2;
+		}
+	}
 
+	k_sem_give(&driver_data->sem);
+#else
 	release_device(dev);
+#endif
 	return ret;
 }
 
@@ -763,6 +941,9 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 		if (size == flash_size) {
 			/* chip erase */
 			spi_nor_cmd_write(dev, SPI_NOR_CMD_CE);
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+			ret = spi_nor_erase_poll(dev, 0, flash_size);
+#endif
 			size -= flash_size;
 		} else {
 			const struct jesd216_erase_type *erase_types =
@@ -783,6 +964,9 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 			}
 			if (bet != NULL) {
 				spi_nor_cmd_addr_write(dev, bet->cmd, addr, NULL, 0);
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+				ret = spi_nor_erase_poll(dev, addr, BIT(bet->exp));
+#endif
 				addr += BIT(bet->exp);
 				size -= BIT(bet->exp);
 			} else {
@@ -953,6 +1137,22 @@ static int spi_nor_process_bfp(const struct device *dev,
 	}
 
 	data->page_size = jesd216_bfp_page_size(php, bfp);
+
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	/* DW12 and DW13 describe erase suspend and resume */
+	if (php->len_dw >= 13) {
+		uint32_t dw12 = sys_le32_to_cpu(bfp->dw10[2]);
+		uint32_t dw13 = sys_le32_to_cpu(bfp->dw10[3]);
+
+		if ((dw12 & JESD216_SFDP_BFP_DW12_SUSPRESSUP_FLG) != 0) {
+			LOG_INF("Erase suspend not supported");
+			data->cmd_erase_sus = 0;
+		} else {
+			data->cmd_erase_sus = (uint8_t)(dw13 >> 24);
+			data->cmd_erase_res = (uint8_t)(dw13 >> 16);
+		}
+	}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
 #ifdef CONFIG_SPI_NOR_SFDP_RUNTIME
 	data->flash_size = flash_size;
 #else /* CONFIG_SPI_NOR_SFDP_RUNTIME */
@@ -1144,6 +1344,14 @@ static int spi_nor_configure(const struct device *dev)
 		return -ENODEV;
 	}
 
+#ifdef CONFIG_SPI_NOR_ERASE_SUSPEND
+	struct spi_nor_data *const data = dev->data;
+
+	/* Commands of most devices, used unless SFDP provides others */
+	data->cmd_erase_sus = SPI_NOR_CMD_ERASE_SUS;
+	data->cmd_erase_res = SPI_NOR_CMD_ERASE_RES;
+#endif
+
 	/* After a soft-reset the flash might be in DPD or busy writing/erasing.
 	 * Exit DPD and wait until flash is ready.
 	 */
@@ -6,7 +6,7 @@
 
 #include "zephyr/rtio/rtio.h"
 #include <zephyr/drivers/i2c.h>
-#include <zephyr/rtio/rtio_spsc.h>
+#include <zephyr/rtio/work.h>
 #include <zephyr/sys/__assert.h>
 
 const struct rtio_iodev_api i2c_iodev_api = {
@@ -26,7 +26,7 @@ struct rtio_sqe *i2c_rtio_copy(struct rtio *r,
 		sqe = rtio_sqe_acquire(r);
 
 		if (sqe == NULL) {
-			rtio_spsc_drop_all(r->sq);
+			rtio_sqe_drop_all(r);
 			return NULL;
 		}
 
@@ -47,3 +47,105 @@ struct rtio_sqe *i2c_rtio_copy(struct rtio *r,
 
 	return sqe;
 }
+
+#ifdef CONFIG_I2C_RTIO_FALLBACK_MSGS
+
+/* Convert a submission into a message */
+static int i2c_iodev_msg(const struct rtio_sqe *sqe, struct i2c_msg *msg)
+{
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		msg->buf = sqe->buf;
+		msg->len = sqe->buf_len;
+		msg->flags = I2C_MSG_READ;
+		break;
+	case RTIO_OP_TX:
+		msg->buf = sqe->buf;
+		msg->len = sqe->buf_len;
+		msg->flags = I2C_MSG_WRITE;
+		break;
+	case RTIO_OP_TINY_TX:
+		msg->buf = (uint8_t *)sqe->tiny_buf;
+		msg->len = sqe->tiny_buf_len;
+		msg->flags = I2C_MSG_WRITE;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	msg->flags |= ((sqe->iodev_flags & RTIO_IODEV_I2C_STOP) ? I2C_MSG_STOP : 0) |
+		((sqe->iodev_flags & RTIO_IODEV_I2C_RESTART) ? I2C_MSG_RESTART : 0) |
+		((sqe->iodev_flags & RTIO_IODEV_I2C_10_BITS) ? I2C_MSG_ADDR_10_BITS : 0);
+
+	return 0;
+}
+
+/* The whole transaction is a single transfer, so that the bus is not released
+ * between a write and the following read. The work queue thread runs at the
+ * priority of the submission, so that urgent devices are the next to get the
+ * bus once it is released.
+ */
+static void i2c_iodev_fallback_work(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct i2c_dt_spec *dt_spec = iodev_sqe->sqe.iodev->data;
+	struct i2c_msg msgs[CONFIG_I2C_RTIO_FALLBACK_MSGS];
+	struct rtio_iodev_sqe *txn_curr;
+	uint8_t num_msgs = 0;
+	int rc = 0;
+
+	for (txn_curr = iodev_sqe; txn_curr != NULL; txn_curr = rtio_txn_next(txn_curr)) {
+		if (num_msgs == ARRAY_SIZE(msgs)) {
+			rc = -ENOMEM;
+			break;
+		}
+
+		rc = i2c_iodev_msg(&txn_curr->sqe, &msgs[num_msgs]);
+		if (rc < 0) {
+			break;
+		}
+
+		/* A change of direction is done with a repeated start */
+		if ((num_msgs > 0) &&
+		    ((msgs[num_msgs].flags ^ msgs[num_msgs - 1].flags) & I2C_MSG_READ)) {
+			msgs[num_msgs].flags |= I2C_MSG_RESTART;
+		}
+
+		num_msgs++;
+	}
+
+	if (rc == 0) {
+		msgs[num_msgs - 1].flags |= I2C_MSG_STOP;
+		rc = i2c_transfer(dt_spec->bus, msgs, num_msgs, dt_spec->addr);
+	}
+
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+	}
+}
+
+void i2c_iodev_submit_fallback(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	ARG_UNUSED(dev);
+
+	if (req == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, i2c_iodev_fallback_work);
+}
+
+#else
+
+void i2c_iodev_submit_fallback(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	ARG_UNUSED(dev);
+
+	rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+}
+
+#endif /* CONFIG_I2C_RTIO_FALLBACK_MSGS */
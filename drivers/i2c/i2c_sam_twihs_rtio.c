@@ -26,7 +26,6 @@
 #include <zephyr/drivers/pinctrl.h>
 #include <zephyr/drivers/clock_control/atmel_sam_pmc.h>
 #include <zephyr/rtio/rtio.h>
-#include <zephyr/rtio/rtio_executor_simple.h>
 
 #define LOG_LEVEL CONFIG_I2C_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -63,6 +62,7 @@ struct i2c_sam_twihs_dev_data {
 	struct rtio *r;
 	struct rtio_mpsc io_q;
 	struct rtio_iodev_sqe *iodev_sqe;
+	struct rtio_iodev_sqe *txn_curr;
 	const struct rtio_sqe *sqe;
 	uint32_t buf_idx;
 };
@@ -232,7 +232,8 @@ static void i2c_sam_twihs_next(const struct device *dev, bool completion)
 	}
 
 	data->iodev_sqe = CONTAINER_OF(next, struct rtio_iodev_sqe, q);
-	data->sqe = data->iodev_sqe->sqe;
+	data->txn_curr = data->iodev_sqe;
+	data->sqe = &data->txn_curr->sqe;
 	k_spin_unlock(&data->lock, key);
 
 	i2c_sam_twihs_start(dev);
@@ -255,7 +256,8 @@ static void i2c_sam_twihs_complete(const struct device *dev, int status)
 	}
 
 	if (dev_data->sqe->flags & RTIO_SQE_TRANSACTION) {
-		dev_data->sqe = rtio_spsc_next(iodev_sqe->r->sq, dev_data->sqe);
+		dev_data->txn_curr = rtio_txn_next(dev_data->txn_curr);
+		dev_data->sqe = &dev_data->txn_curr->sqe;
 		i2c_sam_twihs_start(dev);
 	} else {
 		rtio_iodev_sqe_ok(iodev_sqe, status);
@@ -352,9 +354,9 @@ static int i2c_sam_twihs_transfer(const struct device *dev, struct i2c_msg *msgs
 	__ASSERT(cqe != NULL, "Expected valid completion");
 	while (cqe != NULL) {
 		res = cqe->result;
+		rtio_cqe_release(r, cqe);
 		cqe = rtio_cqe_consume(r);
 	}
-	rtio_cqe_release_all(r);
 
 out:
 	k_sem_give(&dev_data->block_lock);
@@ -422,9 +424,7 @@ static const struct i2c_driver_api i2c_sam_twihs_driver_api = {
 			    DEVICE_DT_INST_GET(n), 0);						\
 	}											\
 												\
-	RTIO_EXECUTOR_SIMPLE_DEFINE(_i2c##n##_sam_rtio_exec);					\
 	RTIO_DEFINE(_i2c##n##_sam_rtio,								\
-		    (struct rtio_executor *)&_i2c##n##_sam_rtio_exec,				\
 		    CONFIG_I2C_SAM_TWIHS_SQ_SIZE,						\
 		    CONFIG_I2C_SAM_TWIHS_CQ_SIZE);						\
 												\
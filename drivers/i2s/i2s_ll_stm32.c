@@ -318,6 +318,13 @@ static int i2s_stm32_trigger(const struct device *dev, enum i2s_dir dir,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_I2S_RING
+	if (stream->ring.callback != NULL) {
+		LOG_ERR("Ring buffer stream running");
+		return -EIO;
+	}
+#endif
+
 	switch (cmd) {
 	case I2S_TRIGGER_START:
 		if (stream->state != I2S_STATE_READY) {
@@ -444,11 +451,21 @@ static int i2s_stm32_write(const struct device *dev, void *mem_block,
 	return 0;
 }
 
+#ifdef CONFIG_I2S_RING
+static int i2s_stm32_ring_start(const struct device *dev, enum i2s_dir dir,
+				const struct i2s_ring_config *ring);
+static int i2s_stm32_ring_stop(const struct device *dev, enum i2s_dir dir);
+#endif
+
 static const struct i2s_driver_api i2s_stm32_driver_api = {
 	.configure = i2s_stm32_configure,
 	.read = i2s_stm32_read,
 	.write = i2s_stm32_write,
 	.trigger = i2s_stm32_trigger,
+#ifdef CONFIG_I2S_RING
+	.ring_start = i2s_stm32_ring_start,
+	.ring_stop = i2s_stm32_ring_stop,
+#endif
 };
 
 #define STM32_DMA_NUM_CHANNELS		8
@@ -475,7 +492,7 @@ static int start_dma(const struct device *dev_dma, uint32_t channel,
 		     struct dma_config *dcfg, void *src,
 		     bool src_addr_increment, void *dst,
 		     bool dst_addr_increment, uint8_t fifo_threshold,
-		     uint32_t blk_size)
+		     uint32_t blk_size, bool circular)
 {
 	struct dma_block_config blk_cfg;
 	int ret;
@@ -495,6 +512,8 @@ static int start_dma(const struct device *dev_dma, uint32_t channel,
 		blk_cfg.dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
 	}
 	blk_cfg.fifo_mode_control = fifo_threshold;
+	blk_cfg.source_reload_en = circular;
+	blk_cfg.dest_reload_en = circular;
 
 	dcfg->head_block = &blk_cfg;
 
@@ -513,6 +532,39 @@ static const struct device *get_dev_from_tx_dma_channel(uint32_t dma_channel);
 static void rx_stream_disable(struct stream *stream, const struct device *dev);
 static void tx_stream_disable(struct stream *stream, const struct device *dev);
 
+#ifdef CONFIG_I2S_RING
+/* This function is executed in the interrupt context */
+static void ring_period_elapsed(const struct device *dev, struct stream *stream,
+				enum i2s_dir dir, int status)
+{
+	const struct i2s_ring_config *ring = &stream->ring;
+	uint8_t *period;
+
+	if (status < 0) {
+		stream->state = I2S_STATE_ERROR;
+		stream->stream_disable(stream, dev);
+		ring->callback(dev, dir, NULL, ring->period_size, ring->user_data);
+		return;
+	}
+
+	/* The half transfer ends the first period, the transfer complete the second */
+	period = (uint8_t *)ring->buf;
+	if (status == DMA_STATUS_COMPLETE) {
+		period += ring->period_size;
+	}
+
+	if (dir == I2S_DIR_RX) {
+		/* Assure cache coherency after DMA write operation */
+		DCACHE_INVALIDATE(period, ring->period_size);
+		ring->callback(dev, dir, period, ring->period_size, ring->user_data);
+	} else {
+		ring->callback(dev, dir, period, ring->period_size, ring->user_data);
+		/* Assure cache coherency before DMA read operation */
+		DCACHE_CLEAN(period, ring->period_size);
+	}
+}
+#endif /* CONFIG_I2S_RING */
+
 /* This function is executed in the interrupt context */
 static void dma_rx_callback(const struct device *dma_dev, void *arg,
 			    uint32_t channel, int status)
@@ -524,6 +576,13 @@ static void dma_rx_callback(const struct device *dma_dev, void *arg,
 	void *mblk_tmp;
 	int ret;
 
+#ifdef CONFIG_I2S_RING
+	if (stream->ring.callback != NULL) {
+		ring_period_elapsed(dev, stream, I2S_DIR_RX, status);
+		return;
+	}
+#endif
+
 	if (status < 0) {
 		ret = -EIO;
 		stream->state = I2S_STATE_ERROR;
@@ -591,6 +650,13 @@ static void dma_tx_callback(const struct device *dma_dev, void *arg,
 	size_t mem_block_size;
 	int ret;
 
+#ifdef CONFIG_I2S_RING
+	if (stream->ring.callback != NULL) {
+		ring_period_elapsed(dev, stream, I2S_DIR_TX, status);
+		return;
+	}
+#endif
+
 	if (status < 0) {
 		ret = -EIO;
 		stream->state = I2S_STATE_ERROR;
@@ -739,7 +805,7 @@ static int rx_stream_start(struct stream *stream, const struct device *dev)
 			(void *)LL_SPI_DMA_GetRegAddr(cfg->i2s),
 			stream->src_addr_increment, stream->mem_block,
 			stream->dst_addr_increment, stream->fifo_threshold,
-			stream->cfg.block_size);
+			stream->cfg.block_size, false);
 	if (ret < 0) {
 		LOG_ERR("Failed to start RX DMA transfer: %d", ret);
 		return ret;
@@ -783,7 +849,7 @@ static int tx_stream_start(struct stream *stream, const struct device *dev)
 			stream->mem_block, stream->src_addr_increment,
 			(void *)LL_SPI_DMA_GetRegAddr(cfg->i2s),
 			stream->dst_addr_increment, stream->fifo_threshold,
-			stream->cfg.block_size);
+			stream->cfg.block_size, false);
 	if (ret < 0) {
 		LOG_ERR("Failed to start TX DMA transfer: %d", ret);
 		return ret;
@@ -861,6 +927,125 @@ static void tx_queue_drop(struct stream *stream)
 	}
 }
 
+#ifdef CONFIG_I2S_RING
+static int i2s_stm32_ring_start(const struct device *dev, enum i2s_dir dir,
+				const struct i2s_ring_config *ring)
+{
+	const struct i2s_stm32_cfg *cfg = dev->config;
+	struct i2s_stm32_data *const dev_data = dev->data;
+	void *i2s_reg = (void *)LL_SPI_DMA_GetRegAddr(cfg->i2s);
+	struct stream *stream;
+	size_t size;
+	int ret;
+
+	if (dir == I2S_DIR_RX) {
+		stream = &dev_data->rx;
+	} else if (dir == I2S_DIR_TX) {
+		stream = &dev_data->tx;
+	} else {
+		LOG_ERR("Either RX or TX direction must be selected");
+		return -EINVAL;
+	}
+
+	if (ring->buf == NULL || ring->period_size == 0U || ring->callback == NULL) {
+		return -EINVAL;
+	}
+
+	/* The DMA interrupts at the half and at the end of a circular transfer */
+	if (ring->periods != 2U) {
+		LOG_ERR("Ring buffer streams have 2 periods");
+		return -ENOTSUP;
+	}
+
+	if (stream->state != I2S_STATE_READY) {
+		LOG_ERR("Ring start: invalid state %d", stream->state);
+		return -EIO;
+	}
+
+	__ASSERT_NO_MSG(stream->mem_block == NULL);
+
+	stream->ring = *ring;
+	size = ring->period_size * ring->periods;
+
+	if (dir == I2S_DIR_RX) {
+		if (stream->master) {
+			LL_I2S_SetTransferMode(cfg->i2s, LL_I2S_MODE_MASTER_RX);
+		} else {
+			LL_I2S_SetTransferMode(cfg->i2s, LL_I2S_MODE_SLAVE_RX);
+		}
+
+		active_dma_rx_channel[stream->dma_channel] = dev;
+
+		ret = start_dma(stream->dev_dma, stream->dma_channel,
+				&stream->dma_cfg,
+				i2s_reg, stream->src_addr_increment,
+				ring->buf, stream->dst_addr_increment,
+				stream->fifo_threshold, size, true);
+	} else {
+		/* Assure cache coherency before DMA read operation */
+		DCACHE_CLEAN(ring->buf, size);
+
+		if (stream->master) {
+			LL_I2S_SetTransferMode(cfg->i2s, LL_I2S_MODE_MASTER_TX);
+		} else {
+			LL_I2S_SetTransferMode(cfg->i2s, LL_I2S_MODE_SLAVE_TX);
+		}
+
+		active_dma_tx_channel[stream->dma_channel] = dev;
+
+		ret = start_dma(stream->dev_dma, stream->dma_channel,
+				&stream->dma_cfg,
+				ring->buf, stream->src_addr_increment,
+				i2s_reg, stream->dst_addr_increment,
+				stream->fifo_threshold, size, true);
+	}
+
+	if (ret < 0) {
+		LOG_ERR("Failed to start ring DMA transfer: %d", ret);
+		stream->ring.callback = NULL;
+		return ret;
+	}
+
+	if (dir == I2S_DIR_RX) {
+		LL_I2S_EnableDMAReq_RX(cfg->i2s);
+	} else {
+		LL_I2S_EnableDMAReq_TX(cfg->i2s);
+	}
+
+	LL_I2S_EnableIT_ERR(cfg->i2s);
+	LL_I2S_Enable(cfg->i2s);
+
+	stream->state = I2S_STATE_RUNNING;
+
+	return 0;
+}
+
+static int i2s_stm32_ring_stop(const struct device *dev, enum i2s_dir dir)
+{
+	struct i2s_stm32_data *const dev_data = dev->data;
+	struct stream *stream;
+
+	if (dir == I2S_DIR_RX) {
+		stream = &dev_data->rx;
+	} else if (dir == I2S_DIR_TX) {
+		stream = &dev_data->tx;
+	} else {
+		LOG_ERR("Either RX or TX direction must be selected");
+		return -EINVAL;
+	}
+
+	if (stream->ring.callback == NULL) {
+		return -EIO;
+	}
+
+	stream->stream_disable(stream, dev);
+	stream->ring.callback = NULL;
+	stream->state = I2S_STATE_READY;
+
+	return 0;
+}
+#endif /* CONFIG_I2S_RING */
+
 static const struct device *get_dev_from_rx_dma_channel(uint32_t dma_channel)
 {
 	return active_dma_rx_channel[dma_channel];
@@ -47,6 +47,10 @@ struct stream {
 	void *mem_block;
 	bool last_block;
 	bool master;
+#ifdef CONFIG_I2S_RING
+	/* Ring buffer stream, running if the callback is set */
+	struct i2s_ring_config ring;
+#endif
 	int (*stream_start)(struct stream *, const struct device *dev);
 	void (*stream_disable)(struct stream *, const struct device *dev);
 	void (*queue_drop)(struct stream *);
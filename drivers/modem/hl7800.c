@@ -3958,8 +3958,7 @@ static void sock_read(struct net_buf **buf, uint16_t len)
 {
 	struct hl7800_socket *sock = NULL;
 	struct net_buf *frag;
-	uint8_t c = 0U;
-	int i, hdr_len;
+	int i, n, hdr_len;
 	char ok_resp[sizeof(OK_STRING)];
 	char eof[sizeof(EOF_PATTERN)];
 	size_t out_len;
@@ -4006,19 +4005,21 @@ static void sock_read(struct net_buf **buf, uint16_t len)
 	/* add IP / protocol headers */
 	hdr_len = pkt_setup_ip_data(sock->recv_pkt, sock);
 
-	/* receive data */
-	for (i = 0; i < sock->rx_size; i++) {
-		/* pull data from buf and advance to the next frag if needed */
-		c = net_buf_get_u8(buf);
+	/* receive data, a fragment at a time */
+	for (i = 0; i < sock->rx_size; i += n) {
+		n = MIN((*buf)->len, sock->rx_size - i);
 		/* write data to packet */
-		if (net_pkt_write_u8(sock->recv_pkt, c)) {
+		if (net_pkt_write(sock->recv_pkt, (*buf)->data, n)) {
 			LOG_ERR("Unable to add data! Aborting! Bytes RXd:%d",
 				i);
 			goto rx_err;
 		}
 
-		if (!*buf && i < sock->rx_size) {
-			LOG_DBG("RX more data, bytes RXd:%d", i + 1);
+		/* pull data from buf and advance to the next frag if needed */
+		net_buf_remove(buf, n);
+
+		if (!*buf && i + n < sock->rx_size) {
+			LOG_DBG("RX more data, bytes RXd:%d", i + n);
 			/* wait for at least one more byte */
 			wait_for_modem_data(buf, 0, 1);
 			if (!*buf) {
@@ -226,6 +226,144 @@ static int process_cmd(const struct modem_cmd *cmd, size_t match_len,
 	return ret;
 }
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_TRIE)
+/*
+ * The trie indexes the response and unsolicited commands in this order, from
+ * 1, so that the command of lowest index among all the matching ones is the
+ * one the linear search would find first.
+ */
+static const struct modem_cmd *trie_cmd(struct modem_cmd_handler_data *data,
+					uint16_t idx)
+{
+	idx--;
+	if (idx < data->cmds_len[CMD_RESP]) {
+		return &data->cmds[CMD_RESP][idx];
+	}
+
+	return &data->cmds[CMD_UNSOL][idx - data->cmds_len[CMD_RESP]];
+}
+
+static uint16_t trie_child(struct modem_cmd_handler_data *data, uint16_t node,
+			   char c)
+{
+	uint16_t next = data->trie[node].child;
+
+	while (next && data->trie[next].c != c) {
+		next = data->trie[next].sibling;
+	}
+
+	return next;
+}
+
+static uint16_t trie_first(uint16_t found, uint16_t idx)
+{
+	if (!found || (idx && idx < found)) {
+		return idx;
+	}
+
+	return found;
+}
+
+static int trie_insert(struct modem_cmd_handler_data *data,
+		       const struct modem_cmd *cmd, uint16_t idx)
+{
+	uint16_t node = 0U, next;
+	size_t i;
+
+	for (i = 0; i < cmd->cmd_len; i++) {
+		next = trie_child(data, node, cmd->cmd[i]);
+		if (!next) {
+			if (data->trie_len >= ARRAY_SIZE(data->trie)) {
+				return -ENOMEM;
+			}
+
+			next = data->trie_len++;
+			data->trie[next] = (struct modem_cmd_trie_node) {
+				.sibling = data->trie[node].child,
+				.c = cmd->cmd[i],
+			};
+			data->trie[node].child = next;
+		}
+
+		node = next;
+	}
+
+	/* commands are inserted in order, keep the first one */
+	if (!data->trie[node].cmd) {
+		data->trie[node].cmd = idx;
+	}
+
+	if (cmd->direct && !data->trie[node].direct) {
+		data->trie[node].direct = idx;
+	}
+
+	return 0;
+}
+
+static void trie_build(struct modem_cmd_handler_data *data)
+{
+	uint16_t idx = 0U;
+	size_t i;
+	int j;
+
+	data->trie[0] = (struct modem_cmd_trie_node) { 0 };
+	data->trie_len = 1U;
+
+	for (j = CMD_RESP; j <= CMD_UNSOL; j++) {
+		for (i = 0; i < data->cmds_len[j]; i++) {
+			if (trie_insert(data, &data->cmds[j][i], ++idx) < 0) {
+				LOG_WRN("Commands do not fit in %d trie nodes",
+					CONFIG_MODEM_CMD_HANDLER_TRIE_NODES);
+				data->trie_len = 0U;
+				return;
+			}
+		}
+	}
+}
+
+static uint16_t trie_match_line(struct modem_cmd_handler_data *data,
+				size_t match_len)
+{
+	uint16_t node = 0U, found = data->trie[0].cmd;
+	size_t pos;
+
+	for (pos = 0; pos < match_len; pos++) {
+		node = trie_child(data, node, data->match_buf[pos]);
+		if (!node) {
+			break;
+		}
+
+		found = trie_first(found, data->trie[node].cmd);
+	}
+
+	return found;
+}
+
+static uint16_t trie_match_direct(struct modem_cmd_handler_data *data)
+{
+	struct net_buf *buf = data->rx_buf;
+	uint16_t node = 0U, found = data->trie[0].direct;
+	int pos = 0;
+
+	while (buf && buf->len) {
+		node = trie_child(data, node, *(buf->data + pos));
+		if (!node) {
+			break;
+		}
+
+		found = trie_first(found, data->trie[node].direct);
+
+		pos++;
+		if (pos >= buf->len) {
+			buf = buf->frags;
+			pos = 0;
+		}
+	}
+
+	return found;
+}
+#endif /* CONFIG_MODEM_CMD_HANDLER_TRIE */
+
 /*
  * check 3 arrays of commands for a match in match_buf:
  * - response handlers[0]
@@ -233,12 +371,26 @@ static int process_cmd(const struct modem_cmd *cmd, size_t match_len,
  * - current assigned handlers[2]
  */
 static const struct modem_cmd *find_cmd_match(
-		struct modem_cmd_handler_data *data)
+		struct modem_cmd_handler_data *data, size_t match_len)
 {
-	int j;
+	int j = 0;
 	size_t i;
 
-	for (j = 0; j < ARRAY_SIZE(data->cmds); j++) {
+#if defined(CONFIG_MODEM_CMD_HANDLER_TRIE)
+	if (data->trie_len) {
+		uint16_t idx = trie_match_line(data, match_len);
+
+		if (idx) {
+			return trie_cmd(data, idx);
+		}
+
+		j = CMD_HANDLER;
+	}
+#else
+	ARG_UNUSED(match_len);
+#endif
+
+	for (; j < ARRAY_SIZE(data->cmds); j++) {
 		if (!data->cmds[j] || data->cmds_len[j] == 0U) {
 			continue;
 		}
@@ -259,9 +411,21 @@ static const struct modem_cmd *find_cmd_match(
 static const struct modem_cmd *find_cmd_direct_match(
 		struct modem_cmd_handler_data *data)
 {
-	size_t j, i;
+	size_t j = 0, i;
+
+#if defined(CONFIG_MODEM_CMD_HANDLER_TRIE)
+	if (data->trie_len) {
+		uint16_t idx = trie_match_direct(data);
+
+		if (idx) {
+			return trie_cmd(data, idx);
+		}
 
-	for (j = 0; j < ARRAY_SIZE(data->cmds); j++) {
+		j = CMD_HANDLER;
+	}
+#endif
+
+	for (; j < ARRAY_SIZE(data->cmds); j++) {
 		if (!data->cmds[j] || data->cmds_len[j] == 0U) {
 			continue;
 		}
@@ -385,7 +549,7 @@ static void cmd_handler_process_rx_buf(struct modem_cmd_handler_data *data)
 
 		k_sem_take(&data->sem_parse_lock, K_FOREVER);
 
-		cmd = find_cmd_match(data);
+		cmd = find_cmd_match(data, match_len);
 		if (cmd) {
 			LOG_DBG("match cmd [%s] (len:%zu)",
 				cmd->cmd, match_len);
@@ -694,6 +858,10 @@ int modem_cmd_handler_init(struct modem_cmd_handler *handler,
 	/* Process end of line */
 	data->eol_len = data->eol == NULL ? 0 : strlen(data->eol);
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_TRIE)
+	trie_build(data);
+#endif
+
 	/* Store optional user data */
 	data->user_data = config->user_data;
 
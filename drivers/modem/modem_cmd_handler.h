@@ -96,10 +96,32 @@ struct setup_cmd {
 	struct modem_cmd handle_cmd;
 };
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_TRIE)
+struct modem_cmd_trie_node {
+	/* first child and next sibling nodes, 0 if none */
+	uint16_t child;
+	uint16_t sibling;
+	/* 1 + index of the first response or unsolicited command, and of
+	 * the first direct one, ending at this node, 0 if none
+	 */
+	uint16_t cmd;
+	uint16_t direct;
+	char c;
+};
+#endif
+
 struct modem_cmd_handler_data {
 	const struct modem_cmd *cmds[CMD_MAX];
 	size_t cmds_len[CMD_MAX];
 
+#if defined(CONFIG_MODEM_CMD_HANDLER_TRIE)
+	/* prefix trie of the response and unsolicited commands, not used
+	 * if trie_len is 0
+	 */
+	struct modem_cmd_trie_node trie[CONFIG_MODEM_CMD_HANDLER_TRIE_NODES];
+	uint16_t trie_len;
+#endif
+
 	char *match_buf;
 	size_t match_buf_len;
 
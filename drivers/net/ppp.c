@@ -37,7 +37,40 @@ LOG_MODULE_REGISTER(net_ppp, LOG_LEVEL);
 #include "../../subsys/net/ip/net_private.h"
 
 #define UART_BUF_LEN CONFIG_NET_PPP_UART_BUF_LEN
-#define UART_TX_BUF_LEN CONFIG_NET_PPP_ASYNC_UART_TX_BUF_LEN
+
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+#define PPP_TX_BUF_LEN CONFIG_NET_PPP_ASYNC_UART_TX_BUF_LEN
+#else
+#define PPP_TX_BUF_LEN UART_BUF_LEN
+#endif
+
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+#define PPP_RX_BUF_COUNT CONFIG_NET_PPP_ASYNC_UART_RX_BUF_COUNT
+#endif
+
+/* FCS of a frame, including its FCS field, when it has no errors */
+#define PPP_GOOD_FCS 0xf0b8
+
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+/* A buffer of the async UART, which is given back to the UART only once
+ * all its data has been parsed.
+ */
+struct ppp_rx_buf {
+	/* Number of bytes written by the UART */
+	atomic_t filled;
+
+	/* The UART is done with the buffer */
+	atomic_t released;
+
+	/* The buffer is owned by the UART or has data to parse */
+	atomic_t in_use;
+
+	/* Number of bytes parsed, only accessed by the RX work */
+	size_t parsed;
+
+	uint8_t data[UART_BUF_LEN];
+};
+#endif
 
 enum ppp_driver_state {
 	STATE_HDLC_FRAME_START,
@@ -60,29 +93,48 @@ struct ppp_driver_context {
 	/* How much free space we have in the net_pkt */
 	size_t available;
 
+#if !defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
 	/* ppp data is read into this buf */
 	uint8_t buf[UART_BUF_LEN];
+#endif
 #if defined(CONFIG_NET_PPP_ASYNC_UART)
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+	/* The frames are parsed directly from the UART buffers */
+	struct ppp_rx_buf rx_bufs[PPP_RX_BUF_COUNT];
+
+	/* Buffer being parsed, and last buffer given to the UART */
+	uint8_t rx_cur;
+	uint8_t rx_last;
+#else
 	/* with async we use 2 rx buffers */
 	uint8_t buf2[UART_BUF_LEN];
+#endif
 	struct k_work_delayable uart_recovery_work;
 
-	/* ppp buf use when sending data */
-	uint8_t send_buf[UART_TX_BUF_LEN];
+	/* ppp bufs used when sending data, one is filled while the other
+	 * one is being sent.
+	 */
+	uint8_t send_bufs[2][PPP_TX_BUF_LEN];
+	uint8_t send_idx;
 #else
 	/* ppp buf use when sending data */
-	uint8_t send_buf[UART_BUF_LEN];
+	uint8_t send_buf[PPP_TX_BUF_LEN];
 #endif
 
+	/* FCS of the frame being received */
+	uint16_t rx_fcs;
+
 	uint8_t mac_addr[6];
 	struct net_linkaddr ll_addr;
 
 	/* Flag that tells whether this instance is initialized or not */
 	atomic_t modem_init_done;
 
+#if !defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
 	/* Incoming data is routed via ring buffer */
 	struct ring_buf rx_ringbuf;
 	uint8_t rx_buf[CONFIG_NET_PPP_RINGBUF_SIZE];
+#endif
 
 	/* ISR function callback worker */
 	struct k_work cb_work;
@@ -107,29 +159,100 @@ static struct ppp_driver_context ppp_driver_context_data;
 #if defined(CONFIG_NET_PPP_ASYNC_UART)
 static bool rx_retry_pending;
 static bool uart_recovery_pending;
+#if !defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
 static uint8_t *next_buf;
+#endif
 
 static K_SEM_DEFINE(uarte_tx_finished, 0, 1);
 
-static void uart_callback(const struct device *dev,
-			  struct uart_event *evt,
-			  void *user_data)
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+/* Called from the UART callback. Returns the next buffer in order if it
+ * is free, NULL otherwise.
+ */
+static struct ppp_rx_buf *ppp_rx_buf_get(struct ppp_driver_context *ppp)
 {
-	struct ppp_driver_context *context = user_data;
-	uint8_t *p;
-	int err, ret, len, space_left;
+	uint8_t next = (ppp->rx_last + 1) % PPP_RX_BUF_COUNT;
+	struct ppp_rx_buf *rx = &ppp->rx_bufs[next];
+
+	if (atomic_get(&rx->in_use)) {
+		return NULL;
+	}
+
+	atomic_clear(&rx->filled);
+	atomic_clear(&rx->released);
+	rx->parsed = 0;
+	atomic_set(&rx->in_use, true);
+
+	ppp->rx_last = next;
+
+	return rx;
+}
+
+static void uart_callback_rx_direct(const struct device *dev,
+				    struct uart_event *evt,
+				    struct ppp_driver_context *context)
+{
+	struct ppp_rx_buf *rx;
+	int err;
 
 	switch (evt->type) {
-	case UART_TX_DONE:
-		LOG_DBG("UART_TX_DONE: sent %d bytes", evt->data.tx.len);
-		k_sem_give(&uarte_tx_finished);
+	case UART_RX_RDY:
+		rx = CONTAINER_OF(evt->data.rx.buf, struct ppp_rx_buf, data[0]);
+		atomic_set(&rx->filled, evt->data.rx.offset + evt->data.rx.len);
+
+		k_work_submit_to_queue(&context->cb_workq, &context->cb_work);
 		break;
 
-	case UART_TX_ABORTED:
-		LOG_DBG("Tx aborted");
-		k_sem_give(&uarte_tx_finished);
+	case UART_RX_BUF_REQUEST:
+		/* If every buffer still has data to parse, the UART stops
+		 * once the current one is full and is enabled again by the
+		 * recovery work.
+		 */
+		rx = ppp_rx_buf_get(context);
+		if (rx == NULL) {
+			rx_retry_pending = true;
+			break;
+		}
+
+		err = uart_rx_buf_rsp(dev, rx->data, sizeof(rx->data));
+		if (err) {
+			LOG_ERR("uart_rx_buf_rsp() err: %d", err);
+		}
+
+		break;
+
+	case UART_RX_BUF_RELEASED:
+		rx = CONTAINER_OF(evt->data.rx_buf.buf, struct ppp_rx_buf,
+				  data[0]);
+		atomic_set(&rx->released, true);
+
+		k_work_submit_to_queue(&context->cb_workq, &context->cb_work);
 		break;
 
+	case UART_RX_DISABLED:
+		if (!uart_recovery_pending) {
+			k_work_schedule(&context->uart_recovery_work,
+					K_MSEC(CONFIG_NET_PPP_ASYNC_UART_RX_RECOVERY_TIMEOUT));
+			rx_retry_pending = false;
+			uart_recovery_pending = true;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT */
+
+#if !defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+static void uart_callback_rx_ringbuf(const struct device *dev,
+				     struct uart_event *evt,
+				     struct ppp_driver_context *context)
+{
+	uint8_t *p;
+	int err, ret, len, space_left;
+
+	switch (evt->type) {
 	case UART_RX_RDY:
 		len = evt->data.rx.len;
 		p = evt->data.rx.buf + evt->data.rx.offset;
@@ -199,6 +322,29 @@ static void uart_callback(const struct device *dev,
 		}
 		break;
 
+	default:
+		break;
+	}
+}
+#endif /* !CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT */
+
+static void uart_callback(const struct device *dev,
+			  struct uart_event *evt,
+			  void *user_data)
+{
+	struct ppp_driver_context *context = user_data;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		LOG_DBG("UART_TX_DONE: sent %d bytes", evt->data.tx.len);
+		k_sem_give(&uarte_tx_finished);
+		break;
+
+	case UART_TX_ABORTED:
+		LOG_DBG("Tx aborted");
+		k_sem_give(&uarte_tx_finished);
+		break;
+
 	case UART_RX_STOPPED:
 		LOG_DBG("UART_RX_STOPPED: stop reason %d", evt->data.rx_stop.reason);
 
@@ -206,20 +352,41 @@ static void uart_callback(const struct device *dev,
 			rx_retry_pending = true;
 		}
 		break;
+
+	default:
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+		uart_callback_rx_direct(dev, evt, context);
+#else
+		uart_callback_rx_ringbuf(dev, evt, context);
+#endif
+		break;
 	}
 }
 
 static int ppp_async_uart_rx_enable(struct ppp_driver_context *context)
 {
+	uint8_t *rx_buf;
 	int err;
 
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+	struct ppp_rx_buf *rx = ppp_rx_buf_get(context);
+
+	if (rx == NULL) {
+		return -ENOBUFS;
+	}
+
+	rx_buf = rx->data;
+#else
 	next_buf = context->buf2;
+	rx_buf = context->buf;
+#endif
+
 	err = uart_callback_set(context->dev, uart_callback, (void *)context);
 	if (err) {
 		LOG_ERR("Failed to set uart callback, err %d", err);
 	}
 
-	err = uart_rx_enable(context->dev, context->buf, sizeof(context->buf),
+	err = uart_rx_enable(context->dev, rx_buf, UART_BUF_LEN,
 			     CONFIG_NET_PPP_ASYNC_UART_RX_ENABLE_TIMEOUT * USEC_PER_MSEC);
 	if (err) {
 		LOG_ERR("uart_rx_enable() failed, err %d", err);
@@ -236,6 +403,21 @@ static void uart_recovery(struct k_work *work)
 		CONTAINER_OF(work, struct ppp_driver_context, uart_recovery_work);
 	int ret;
 
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+	/* Wait for a buffer to be parsed */
+	ret = ppp_async_uart_rx_enable(ppp);
+	if (ret == -ENOBUFS) {
+		k_work_schedule(&ppp->uart_recovery_work,
+				K_MSEC(CONFIG_NET_PPP_ASYNC_UART_RX_RECOVERY_TIMEOUT));
+		return;
+	}
+
+	if (ret) {
+		LOG_ERR("ppp_async_uart_rx_enable() failed, err %d", ret);
+	}
+
+	uart_recovery_pending = false;
+#else
 	ret = ring_buf_space_get(&ppp->rx_ringbuf);
 	if (ret >= (sizeof(ppp->rx_buf) / 2)) {
 		ret = ppp_async_uart_rx_enable(ppp);
@@ -250,11 +432,81 @@ static void uart_recovery(struct k_work *work)
 		k_work_schedule(&ppp->uart_recovery_work,
 				K_MSEC(CONFIG_NET_PPP_ASYNC_UART_RX_RECOVERY_TIMEOUT));
 	}
+#endif /* CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT */
 }
 #endif
 
-static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
+#if defined(CONFIG_NET_PPP_FCS_TABLE)
+/* RFC 1662, appendix C.2 */
+static const uint16_t ppp_fcs_table[256] = {
+	0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+	0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+	0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
+	0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
+	0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
+	0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
+	0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
+	0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
+	0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
+	0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
+	0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
+	0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
+	0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
+	0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
+	0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
+	0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
+	0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
+	0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
+	0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
+	0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
+	0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
+	0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
+	0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
+	0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
+	0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
+	0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
+	0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
+	0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
+	0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
+	0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
+	0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
+	0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78,
+};
+
+static uint16_t ppp_fcs_update(uint16_t fcs, const uint8_t *data, size_t len)
+{
+	while (len--) {
+		fcs = (fcs >> 8) ^ ppp_fcs_table[(fcs ^ *data++) & 0xff];
+	}
+
+	return fcs;
+}
+#else
+static uint16_t ppp_fcs_update(uint16_t fcs, const uint8_t *data, size_t len)
+{
+	return crc16_ccitt(fcs, data, len);
+}
+#endif /* CONFIG_NET_PPP_FCS_TABLE */
+
+/* Bytes escaped when sending: the flag, the control escape and, as the
+ * async control character map is not negotiated, all the control
+ * characters. RFC 1662, ch. 4.2
+ */
+static const uint32_t ppp_escape_map[256 / 32] = {
+	[0] = 0xffffffff,
+	[0x7d / 32] = BIT(0x7d % 32) | BIT(0x7e % 32),
+};
+
+static inline bool ppp_needs_escape(uint8_t byte)
 {
+	return (ppp_escape_map[byte / 32] & BIT(byte % 32)) != 0U;
+}
+
+/* Saves the unescaped data of the frame being received */
+static int ppp_save_bytes(struct ppp_driver_context *ppp, const uint8_t *data,
+			  size_t len)
+{
+	size_t copy;
 	int ret;
 
 	if (!ppp->pkt) {
@@ -270,39 +522,48 @@ static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
 		net_pkt_cursor_init(ppp->pkt);
 
 		ppp->available = net_pkt_available_buffer(ppp->pkt);
+		ppp->rx_fcs = 0xffff;
 	}
 
 	/* Extra debugging can be enabled separately if really
 	 * needed. Normally it would just print too much data.
 	 */
 	if (0) {
-		LOG_DBG("Saving byte %02x", byte);
+		LOG_HEXDUMP_DBG(data, len, "Saving");
 	}
 
-	/* This is not very intuitive but we must allocate new buffer
-	 * before we write a byte to last available cursor position.
-	 */
-	if (ppp->available == 1) {
-		ret = net_pkt_alloc_buffer(ppp->pkt,
-					   CONFIG_NET_BUF_DATA_SIZE,
-					   AF_UNSPEC, K_NO_WAIT);
-		if (ret < 0) {
-			LOG_ERR("[%p] cannot allocate new data buffer", ppp);
-			goto out_of_mem;
+	if (IS_ENABLED(CONFIG_NET_PPP_VERIFY_FCS)) {
+		ppp->rx_fcs = ppp_fcs_update(ppp->rx_fcs, data, len);
+	}
+
+	while (len > 0) {
+		/* This is not very intuitive but we must allocate new buffer
+		 * before we write to the last available cursor position.
+		 */
+		if (ppp->available <= len) {
+			ret = net_pkt_alloc_buffer(ppp->pkt,
+						   CONFIG_NET_BUF_DATA_SIZE,
+						   AF_UNSPEC, K_NO_WAIT);
+			if (ret < 0) {
+				LOG_ERR("[%p] cannot allocate new data buffer", ppp);
+				goto out_of_mem;
+			}
+
+			ppp->available = net_pkt_available_buffer(ppp->pkt);
 		}
 
-		ppp->available = net_pkt_available_buffer(ppp->pkt);
-	}
+		copy = MIN(len, ppp->available - 1);
 
-	if (ppp->available) {
-		ret = net_pkt_write_u8(ppp->pkt, byte);
+		ret = net_pkt_write(ppp->pkt, data, copy);
 		if (ret < 0) {
 			LOG_ERR("[%p] Cannot write to pkt %p (%d)",
 				ppp, ppp->pkt, ret);
 			goto out_of_mem;
 		}
 
-		ppp->available--;
+		ppp->available -= copy;
+		data += copy;
+		len -= copy;
 	}
 
 	return 0;
@@ -313,6 +574,11 @@ out_of_mem:
 	return -ENOMEM;
 }
 
+static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
+{
+	return ppp_save_bytes(ppp, &byte, 1);
+}
+
 static const char *ppp_driver_state_str(enum ppp_driver_state state)
 {
 #if (CONFIG_NET_PPP_LOG_LEVEL >= LOG_LEVEL_DBG)
@@ -355,7 +621,11 @@ static int ppp_send_flush(struct ppp_driver_context *ppp, int off)
 	if (IS_ENABLED(CONFIG_NET_TEST)) {
 		return 0;
 	}
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+	uint8_t *buf = ppp->send_bufs[ppp->send_idx];
+#else
 	uint8_t *buf = ppp->send_buf;
+#endif
 
 	/* If we're using gsm_mux, We don't want to use poll_out because sending
 	 * one byte at a time causes each byte to get wrapped in muxing headers.
@@ -376,6 +646,9 @@ static int ppp_send_flush(struct ppp_driver_context *ppp, int off)
 			LOG_ERR("uart_tx() failed, err %d", ret);
 			k_sem_give(&uarte_tx_finished);
 		}
+
+		/* Fill the other buffer while this one is being sent */
+		ppp->send_idx ^= 1;
 #endif
 	} else {
 		while (off--) {
@@ -389,13 +662,54 @@ static int ppp_send_flush(struct ppp_driver_context *ppp, int off)
 static int ppp_send_bytes(struct ppp_driver_context *ppp,
 			  const uint8_t *data, int len, int off)
 {
-	int i;
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+	uint8_t *buf = ppp->send_bufs[ppp->send_idx];
+#else
+	uint8_t *buf = ppp->send_buf;
+#endif
+	int copy;
+
+	while (len > 0) {
+		copy = MIN(len, PPP_TX_BUF_LEN - off);
 
-	for (i = 0; i < len; i++) {
-		ppp->send_buf[off++] = data[i];
+		memcpy(&buf[off], data, copy);
+		off += copy;
+		data += copy;
+		len -= copy;
 
-		if (off >= sizeof(ppp->send_buf)) {
+		if (off >= PPP_TX_BUF_LEN) {
 			off = ppp_send_flush(ppp, off);
+#if defined(CONFIG_NET_PPP_ASYNC_UART)
+			buf = ppp->send_bufs[ppp->send_idx];
+#endif
+		}
+	}
+
+	return off;
+}
+
+/* Sends the data escaped, the runs of bytes which do not need escaping
+ * are copied at once.
+ */
+static int ppp_send_escaped(struct ppp_driver_context *ppp,
+			    const uint8_t *data, int len, int off)
+{
+	uint8_t escaped[2] = { 0x7d };
+	int run;
+
+	while (len > 0) {
+		for (run = 0; run < len && !ppp_needs_escape(data[run]); run++) {
+		}
+
+		off = ppp_send_bytes(ppp, data, run, off);
+		data += run;
+		len -= run;
+
+		if (len > 0) {
+			/* RFC 1662, ch. 4.2 */
+			escaped[1] = *data++ ^ 0x20;
+			off = ppp_send_bytes(ppp, escaped, sizeof(escaped), off);
+			len--;
 		}
 	}
 
@@ -528,27 +842,49 @@ static int ppp_input_byte(struct ppp_driver_context *ppp, uint8_t byte)
 	return ret;
 }
 
-static bool ppp_check_fcs(struct ppp_driver_context *ppp)
+/* Parses the received data up to the end of a frame. Returns the number
+ * of bytes consumed and whether a frame ended.
+ */
+static size_t ppp_input(struct ppp_driver_context *ppp, const uint8_t *data,
+			size_t len, bool *frame_end)
 {
-	struct net_buf *buf;
-	uint16_t crc;
+	size_t i = 0;
+	size_t run;
 
-	buf = ppp->pkt->buffer;
-	if (!buf) {
-		return false;
-	}
+	*frame_end = false;
 
-	crc = crc16_ccitt(0xffff, buf->data, buf->len);
+	while (i < len) {
+		/* Save the bytes which are neither flags nor escaped at once */
+		if (ppp->state == STATE_HDLC_FRAME_DATA && !ppp->next_escaped) {
+			for (run = i; run < len && data[run] != 0x7e &&
+				      data[run] != 0x7d; run++) {
+			}
 
-	buf = buf->frags;
+			if (run > i) {
+				if (ppp_save_bytes(ppp, &data[i], run - i) < 0) {
+					ppp_change_state(ppp,
+							 STATE_HDLC_FRAME_START);
+				}
 
-	while (buf) {
-		crc = crc16_ccitt(crc, buf->data, buf->len);
-		buf = buf->frags;
+				i = run;
+				continue;
+			}
+		}
+
+		if (ppp_input_byte(ppp, data[i++]) == 0) {
+			*frame_end = true;
+			break;
+		}
 	}
 
-	if (crc != 0xf0b8) {
-		LOG_DBG("Invalid FCS (0x%x)", crc);
+	return i;
+}
+
+static bool ppp_check_fcs(struct ppp_driver_context *ppp)
+{
+	/* The FCS is updated as the frame is received */
+	if (ppp->rx_fcs != PPP_GOOD_FCS) {
+		LOG_DBG("Invalid FCS (0x%x)", ppp->rx_fcs);
 #if defined(CONFIG_NET_STATISTICS_PPP)
 		ppp->stats.chkerr++;
 #endif
@@ -610,32 +946,21 @@ static uint8_t *ppp_recv_cb(uint8_t *buf, size_t *off)
 {
 	struct ppp_driver_context *ppp =
 		CONTAINER_OF(buf, struct ppp_driver_context, buf);
-	size_t i, len = *off;
+	size_t used = 0, len = *off;
+	bool frame_end;
 
-	for (i = 0; i < *off; i++) {
-		if (0) {
-			/* Extra debugging can be enabled separately if really
-			 * needed. Normally it would just print too much data.
-			 */
-			LOG_DBG("[%zd] %02x", i, buf[i]);
-		}
+	while (used < len) {
+		used += ppp_input(ppp, &buf[used], len - used, &frame_end);
 
-		if (ppp_input_byte(ppp, buf[i]) == 0) {
-			/* Ignore empty or too short frames */
-			if (ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
-				ppp_process_msg(ppp);
-				break;
-			}
+		/* Ignore empty or too short frames */
+		if (frame_end && ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
+			ppp_process_msg(ppp);
+			break;
 		}
 	}
 
-	if (i == *off) {
-		*off = 0;
-	} else {
-		*off = len - i - 1;
-
-		memmove(&buf[0], &buf[i + 1], *off);
-	}
+	*off = len - used;
+	memmove(&buf[0], &buf[used], *off);
 
 	return buf;
 }
@@ -688,15 +1013,15 @@ static bool calc_fcs(struct net_pkt *pkt, uint16_t *fcs, uint16_t protocol)
 	/* HDLC Address and Control fields */
 	c = sys_cpu_to_be16(0xff << 8 | 0x03);
 
-	crc = crc16_ccitt(0xffff, (const uint8_t *)&c, sizeof(c));
+	crc = ppp_fcs_update(0xffff, (const uint8_t *)&c, sizeof(c));
 
 	if (protocol > 0) {
-		crc = crc16_ccitt(crc, (const uint8_t *)&protocol,
-				  sizeof(protocol));
+		crc = ppp_fcs_update(crc, (const uint8_t *)&protocol,
+				     sizeof(protocol));
 	}
 
 	while (buf) {
-		crc = crc16_ccitt(crc, buf->data, buf->len);
+		crc = ppp_fcs_update(crc, buf->data, buf->len);
 		buf = buf->frags;
 	}
 
@@ -706,17 +1031,6 @@ static bool calc_fcs(struct net_pkt *pkt, uint16_t *fcs, uint16_t protocol)
 	return true;
 }
 
-static uint16_t ppp_escape_byte(uint8_t byte, int *offset)
-{
-	if (byte == 0x7e || byte == 0x7d || byte < 0x20) {
-		*offset = 0;
-		return (0x7d << 8) | (byte ^ 0x20);
-	}
-
-	*offset = 1;
-	return byte;
-}
-
 static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 {
 	struct ppp_driver_context *ppp = dev->data;
@@ -724,9 +1038,8 @@ static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 	uint16_t protocol = 0;
 	int send_off = 0;
 	uint32_t sync_addr_ctrl;
-	uint16_t fcs, escaped;
+	uint16_t fcs;
 	uint8_t byte;
-	int i, offset;
 
 #if defined(CONFIG_NET_TEST)
 	return 0;
@@ -763,15 +1076,8 @@ static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 				  sizeof(sync_addr_ctrl), send_off);
 
 	if (protocol > 0) {
-		escaped = htons(ppp_escape_byte(protocol, &offset));
-		send_off = ppp_send_bytes(ppp, (uint8_t *)&escaped + offset,
-					  offset ? 1 : 2,
-					  send_off);
-
-		escaped = htons(ppp_escape_byte(protocol >> 8, &offset));
-		send_off = ppp_send_bytes(ppp, (uint8_t *)&escaped + offset,
-					  offset ? 1 : 2,
-					  send_off);
+		send_off = ppp_send_escaped(ppp, (const uint8_t *)&protocol,
+					    sizeof(protocol), send_off);
 	}
 
 	/* Note that we do not print the first four bytes and FCS bytes at the
@@ -783,27 +1089,16 @@ static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 	}
 
 	while (buf) {
-		for (i = 0; i < buf->len; i++) {
-			/* Escape illegal bytes */
-			escaped = htons(ppp_escape_byte(buf->data[i], &offset));
-			send_off = ppp_send_bytes(ppp,
-						  (uint8_t *)&escaped + offset,
-						  offset ? 1 : 2,
-						  send_off);
-		}
+		/* Escape illegal bytes */
+		send_off = ppp_send_escaped(ppp, buf->data, buf->len, send_off);
 
 		buf = buf->frags;
 	}
 
-	escaped = htons(ppp_escape_byte(fcs, &offset));
-	send_off = ppp_send_bytes(ppp, (uint8_t *)&escaped + offset,
-				  offset ? 1 : 2,
-				  send_off);
-
-	escaped = htons(ppp_escape_byte(fcs >> 8, &offset));
-	send_off = ppp_send_bytes(ppp, (uint8_t *)&escaped + offset,
-				  offset ? 1 : 2,
-				  send_off);
+	/* The FCS is sent least significant byte first */
+	fcs = sys_cpu_to_le16(fcs);
+	send_off = ppp_send_escaped(ppp, (const uint8_t *)&fcs, sizeof(fcs),
+				    send_off);
 
 	byte = 0x7e;
 	send_off = ppp_send_bytes(ppp, &byte, 1, send_off);
@@ -814,10 +1109,64 @@ static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 }
 
 #if !defined(CONFIG_NET_TEST)
+static void ppp_input_frames(struct ppp_driver_context *ppp,
+			     const uint8_t *data, size_t len)
+{
+	bool frame_end;
+	size_t used;
+
+	while (len > 0) {
+		used = ppp_input(ppp, data, len, &frame_end);
+
+		/* Ignore empty or too short frames */
+		if (frame_end && ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
+			ppp_process_msg(ppp);
+		}
+
+		data += used;
+		len -= used;
+	}
+}
+
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+static void ppp_isr_cb_work(struct k_work *work)
+{
+	struct ppp_driver_context *ppp =
+		CONTAINER_OF(work, struct ppp_driver_context, cb_work);
+	struct ppp_rx_buf *rx;
+	bool released;
+	size_t filled;
+
+	/* The buffers are parsed in the order the UART filled them */
+	while (true) {
+		rx = &ppp->rx_bufs[ppp->rx_cur];
+		if (!atomic_get(&rx->in_use)) {
+			break;
+		}
+
+		/* Once released, the buffer is not written anymore */
+		released = atomic_get(&rx->released);
+		filled = atomic_get(&rx->filled);
+
+		if (filled > rx->parsed) {
+			ppp_input_frames(ppp, &rx->data[rx->parsed],
+					 filled - rx->parsed);
+			rx->parsed = filled;
+		}
+
+		if (!released) {
+			break;
+		}
+
+		atomic_clear(&rx->in_use);
+		ppp->rx_cur = (ppp->rx_cur + 1) % PPP_RX_BUF_COUNT;
+	}
+}
+#else
 static int ppp_consume_ringbuf(struct ppp_driver_context *ppp)
 {
 	uint8_t *data;
-	size_t len, tmp;
+	size_t len;
 	int ret;
 
 	len = ring_buf_get_claim(&ppp->rx_ringbuf, &data,
@@ -832,16 +1181,7 @@ static int ppp_consume_ringbuf(struct ppp_driver_context *ppp)
 		LOG_HEXDUMP_DBG(data, len, ppp->dev->name);
 	}
 
-	tmp = len;
-
-	do {
-		if (ppp_input_byte(ppp, *data++) == 0) {
-			/* Ignore empty or too short frames */
-			if (ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
-				ppp_process_msg(ppp);
-			}
-		}
-	} while (--tmp);
+	ppp_input_frames(ppp, data, len);
 
 	ret = ring_buf_get_finish(&ppp->rx_ringbuf, len);
 	if (ret < 0) {
@@ -861,6 +1201,7 @@ static void ppp_isr_cb_work(struct k_work *work)
 		ret = ppp_consume_ringbuf(ppp);
 	}
 }
+#endif /* CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT */
 #endif /* !CONFIG_NET_TEST */
 
 static int ppp_driver_init(const struct device *dev)
@@ -870,7 +1211,12 @@ static int ppp_driver_init(const struct device *dev)
 	LOG_DBG("[%p] dev %p", ppp, dev);
 
 #if !defined(CONFIG_NET_TEST)
+#if defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
+	ppp->rx_cur = 0;
+	ppp->rx_last = PPP_RX_BUF_COUNT - 1;
+#else
 	ring_buf_init(&ppp->rx_ringbuf, sizeof(ppp->rx_buf), ppp->rx_buf);
+#endif
 	k_work_init(&ppp->cb_work, ppp_isr_cb_work);
 
 	k_work_queue_start(&ppp->cb_workq, ppp_workq,
@@ -938,7 +1284,9 @@ use_random_mac:
 	net_if_set_link_addr(iface, ll_addr->addr, ll_addr->len,
 			     NET_LINK_ETHERNET);
 
+#if !defined(CONFIG_NET_PPP_ASYNC_UART_RX_DIRECT)
 	memset(ppp->buf, 0, sizeof(ppp->buf));
+#endif
 
 	/* If we have a GSM modem with PPP support or interface autostart is disabled
 	 * from Kconfig, then do not start the interface automatically but only
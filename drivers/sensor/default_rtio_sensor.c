@@ -9,11 +9,21 @@
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/dsp/types.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/rtio/work.h>
 
 LOG_MODULE_REGISTER(sensor_compat, CONFIG_SENSOR_LOG_LEVEL);
 
 static void sensor_submit_fallback(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe);
 
+#ifdef CONFIG_RTIO_WORKQ
+static void sensor_submit_fallback_work(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
+
+	sensor_submit_fallback(cfg->sensor, iodev_sqe);
+}
+#endif
+
 static void sensor_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
 {
 	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
@@ -22,9 +32,31 @@ static void sensor_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
 
 	if (api->submit != NULL) {
 		api->submit(dev, iodev_sqe);
-	} else {
-		sensor_submit_fallback(dev, iodev_sqe);
+		return;
 	}
+
+	/* Streaming needs the triggers of the driver */
+	if (cfg->is_streaming) {
+		LOG_ERR("Streaming not supported by %s", dev->name);
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+#ifdef CONFIG_RTIO_WORKQ
+	/* Fetch the samples in the work queue rather than in the submitter */
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	if (req == NULL) {
+		LOG_WRN("No RTIO work queue request available");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, sensor_submit_fallback_work);
+#else
+	sensor_submit_fallback(dev, iodev_sqe);
+#endif
 }
 
 const struct rtio_iodev_api __sensor_iodev_api = {
@@ -245,6 +277,87 @@ void sensor_processing_with_callback(struct rtio *ctx, sensor_processing_callbac
 	rtio_release_buffer(ctx, buf, buf_len);
 }
 
+/**
+ * @brief Decode one frame and keep the value of a channel
+ *
+ * @param[in]     decoder The decoder to use
+ * @param[in]     buffer The data buffer to parse
+ * @param[in]     channel The channel to look for
+ * @param[in,out] fit The frame iterator, moved to the next frame
+ * @param[out]    value The value of @p channel
+ * @return 1 if @p channel was found, 0 if not or if there are no more frames, <0 on error
+ */
+static int decode_frame_channel(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+				enum sensor_channel channel, sensor_frame_iterator_t *fit,
+				q31_t *value)
+{
+	const sensor_frame_iterator_t frame = *fit;
+	sensor_channel_iterator_t cit = 0;
+	enum sensor_channel channels[8];
+	q31_t values[8];
+	int found = 0;
+	int rc;
+
+	do {
+		rc = decoder->decode(buffer, fit, &cit, channels, values, ARRAY_SIZE(channels));
+		for (int i = 0; i < rc; i++) {
+			if (channels[i] == channel) {
+				*value = values[i];
+				found = 1;
+			}
+		}
+	} while (rc > 0 && *fit == frame);
+
+	return rc < 0 ? rc : found;
+}
+
+int sensor_decode_channel(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			  enum sensor_channel channel, sensor_frame_iterator_t *fit,
+			  uint16_t max_count, q31_t *values)
+{
+	sensor_frame_iterator_t frame;
+	uint16_t frame_count;
+	uint16_t count = 0;
+	int rc;
+
+	if (SENSOR_CHANNEL_3_AXIS(channel)) {
+		return -EINVAL;
+	}
+
+	if (decoder->decode_channel != NULL) {
+		return decoder->decode_channel(buffer, channel, fit, max_count, values);
+	}
+
+	/* The frame iterator counts the frames of the buffer */
+	rc = decoder->get_frame_count(buffer, &frame_count);
+	if (rc != 0) {
+		return rc;
+	}
+
+	while (count < max_count && *fit < frame_count) {
+		frame = *fit;
+		rc = decode_frame_channel(decoder, buffer, channel, fit, &values[count]);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (rc == 0) {
+			/* Leave the iterator on the frame without the channel */
+			if (*fit != frame) {
+				*fit = frame;
+				if (count == 0) {
+					return -ENODATA;
+				}
+			}
+			break;
+		}
+
+		count++;
+	}
+
+	return count;
+}
+
 /**
  * @brief Default decoder get frame count
  *
@@ -411,6 +411,10 @@ struct icm42688_dev_data {
 	const struct sensor_trigger *data_ready_trigger;
 	struct k_mutex mutex;
 #endif /* CONFIG_ICM42688_TRIGGER */
+#ifdef CONFIG_ICM42688_STREAM
+	struct rtio_iodev_sqe *streaming_sqe;
+	uint64_t timestamp;
+#endif /* CONFIG_ICM42688_STREAM */
 
 	int16_t readings[7];
 };
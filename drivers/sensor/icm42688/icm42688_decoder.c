@@ -218,26 +218,17 @@ int icm42688_encode(const struct device *dev, const enum sensor_channel *const c
 	return 0;
 }
 
-static int icm42688_one_shot_decode(const uint8_t *buffer, sensor_frame_iterator_t *fit,
+/* Decode the channels of one frame given by a mask of reading positions */
+static int icm42688_decode_readings(struct icm42688_cfg *cfg, const int16_t readings[7],
+				    uint8_t channel_mask, sensor_frame_iterator_t *fit,
 				    sensor_channel_iterator_t *cit, enum sensor_channel *channels,
 				    q31_t *values, uint8_t max_count)
 {
-	const struct icm42688_encoded_data *edata = (const struct icm42688_encoded_data *)buffer;
-	uint8_t channel_pos_read = edata->channels;
-	struct icm42688_cfg cfg = {
-		.accel_fs = edata->header.accel_fs,
-		.gyro_fs = edata->header.gyro_fs,
-	};
+	uint8_t channel_pos_read = channel_mask;
 	enum sensor_channel chan;
 	int pos;
 	int count = 0;
-	int num_samples = __builtin_popcount(channel_pos_read);
-
-	channel_pos_read = edata->channels;
-
-	if (*fit != 0) {
-		return 0;
-	}
+	int num_samples = __builtin_popcount(channel_mask);
 
 	/* Skip channels already decoded */
 	for (int i = 0; i < *cit && channel_pos_read; i++) {
@@ -252,14 +243,14 @@ static int icm42688_one_shot_decode(const uint8_t *buffer, sensor_frame_iterator
 
 		channels[count] = chan;
 
-		icm42688_convert_raw_to_q31(&cfg, chan, edata->readings[pos], &values[count]);
+		icm42688_convert_raw_to_q31(cfg, chan, readings[pos], &values[count]);
 
 		count++;
 		channel_pos_read &= ~BIT(pos);
 		*cit += 1;
 	}
 
-	if (*cit >= __builtin_popcount(edata->channels)) {
+	if (*cit >= num_samples) {
 		*fit += 1;
 		*cit = 0;
 	}
@@ -267,29 +258,227 @@ static int icm42688_one_shot_decode(const uint8_t *buffer, sensor_frame_iterator
 	return count;
 }
 
+static int icm42688_one_shot_decode(const uint8_t *buffer, sensor_frame_iterator_t *fit,
+				    sensor_channel_iterator_t *cit, enum sensor_channel *channels,
+				    q31_t *values, uint8_t max_count)
+{
+	const struct icm42688_encoded_data *edata = (const struct icm42688_encoded_data *)buffer;
+	struct icm42688_cfg cfg = {
+		.accel_fs = edata->header.accel_fs,
+		.gyro_fs = edata->header.gyro_fs,
+	};
+
+	if (*fit != 0) {
+		return 0;
+	}
+
+	return icm42688_decode_readings(&cfg, edata->readings, edata->channels, fit, cit, channels,
+					values, max_count);
+}
+
+/* Frames are the packets read from the FIFO, up to the first one flagged as empty */
+static uint16_t icm42688_fifo_frame_count(const struct icm42688_fifo_data *edata)
+{
+	uint16_t count = 0;
+
+	while ((count + 1) * ICM42688_FIFO_PACKET_SIZE <= edata->fifo_count &&
+	       !FIELD_GET(BIT_FIFO_HEAD_MSG, edata->frames[count * ICM42688_FIFO_PACKET_SIZE])) {
+		count++;
+	}
+
+	return count;
+}
+
+/* Get the reading at the given position from a FIFO packet */
+static int16_t icm42688_fifo_reading(const uint8_t *packet, int pos)
+{
+	/* Data is big endian, the temperature is 8 bits with a 64 times smaller scale */
+	if (pos == 0) {
+		return (int8_t)packet[13] * 64;
+	}
+
+	return sys_get_be16(&packet[1 + (pos - 1) * 2]);
+}
+
+/* Get the mask of reading positions held by a FIFO packet */
+static uint8_t icm42688_fifo_channels(const uint8_t *packet)
+{
+	uint8_t channel_mask = icm42688_encode_channel(SENSOR_CHAN_DIE_TEMP);
+
+	if (FIELD_GET(BIT_FIFO_HEAD_ACCEL, packet[0])) {
+		channel_mask |= icm42688_encode_channel(SENSOR_CHAN_ACCEL_XYZ);
+	}
+	if (FIELD_GET(BIT_FIFO_HEAD_GYRO, packet[0])) {
+		channel_mask |= icm42688_encode_channel(SENSOR_CHAN_GYRO_XYZ);
+	}
+
+	return channel_mask;
+}
+
+static int icm42688_fifo_decode(const uint8_t *buffer, sensor_frame_iterator_t *fit,
+				sensor_channel_iterator_t *cit, enum sensor_channel *channels,
+				q31_t *values, uint8_t max_count)
+{
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+	struct icm42688_cfg cfg = {
+		.accel_fs = edata->header.accel_fs,
+		.gyro_fs = edata->header.gyro_fs,
+	};
+	const uint8_t *packet;
+	int16_t readings[7];
+
+	if (*fit >= icm42688_fifo_frame_count(edata)) {
+		return 0;
+	}
+
+	packet = &edata->frames[*fit * ICM42688_FIFO_PACKET_SIZE];
+	for (int pos = 0; pos < ARRAY_SIZE(readings); pos++) {
+		readings[pos] = icm42688_fifo_reading(packet, pos);
+	}
+
+	return icm42688_decode_readings(&cfg, readings, icm42688_fifo_channels(packet), fit, cit,
+					channels, values, max_count);
+}
+
 static int icm42688_decoder_decode(const uint8_t *buffer, sensor_frame_iterator_t *fit,
 				   sensor_channel_iterator_t *cit, enum sensor_channel *channels,
 				   q31_t *values, uint8_t max_count)
 {
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+
+	if (header->is_fifo) {
+		return icm42688_fifo_decode(buffer, fit, cit, channels, values, max_count);
+	}
+
 	return icm42688_one_shot_decode(buffer, fit, cit, channels, values, max_count);
 }
 
 static int icm42688_decoder_get_frame_count(const uint8_t *buffer, uint16_t *frame_count)
 {
-	ARG_UNUSED(buffer);
-	*frame_count = 1;
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+
+	if (header->is_fifo) {
+		*frame_count = icm42688_fifo_frame_count((const struct icm42688_fifo_data *)buffer);
+	} else {
+		*frame_count = 1;
+	}
 	return 0;
 }
 
+static int icm42688_decoder_decode_channel(const uint8_t *buffer, enum sensor_channel channel,
+					   sensor_frame_iterator_t *fit, uint16_t max_count,
+					   q31_t *values)
+{
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+	const uint8_t channel_bit = icm42688_encode_channel(channel);
+	const int pos = icm42688_get_channel_position(channel);
+	struct icm42688_cfg cfg = {
+		.accel_fs = header->accel_fs,
+		.gyro_fs = header->gyro_fs,
+	};
+	const struct icm42688_fifo_data *fdata;
+	const uint8_t *packet;
+	uint16_t frame_count;
+	uint16_t count = 0;
+	int rc;
+
+	if (SENSOR_CHANNEL_3_AXIS(channel) || channel_bit == 0) {
+		return -EINVAL;
+	}
+
+	if (!header->is_fifo) {
+		const struct icm42688_encoded_data *edata =
+			(const struct icm42688_encoded_data *)buffer;
+
+		if (*fit != 0 || max_count == 0) {
+			return 0;
+		}
+		if ((edata->channels & channel_bit) == 0) {
+			return -ENODATA;
+		}
+
+		rc = icm42688_convert_raw_to_q31(&cfg, channel, edata->readings[pos], values);
+		if (rc != 0) {
+			return rc;
+		}
+
+		*fit = 1;
+		return 1;
+	}
+
+	/* Walk the packets directly rather than through the channel iterator */
+	fdata = (const struct icm42688_fifo_data *)buffer;
+	frame_count = icm42688_fifo_frame_count(fdata);
+	while (count < max_count && *fit < frame_count) {
+		packet = &fdata->frames[*fit * ICM42688_FIFO_PACKET_SIZE];
+		if ((icm42688_fifo_channels(packet) & channel_bit) == 0) {
+			break;
+		}
+
+		rc = icm42688_convert_raw_to_q31(&cfg, channel, icm42688_fifo_reading(packet, pos),
+						 &values[count]);
+		if (rc != 0) {
+			return rc;
+		}
+
+		count++;
+		*fit += 1;
+	}
+
+	if (count == 0 && *fit < frame_count) {
+		return -ENODATA;
+	}
+
+	return count;
+}
+
+/* Period of the ODR register values shared by the accelerometer and gyroscope */
+static const uint32_t icm42688_odr_period_ns[] = {
+	[ICM42688_ACCEL_ODR_32000] = 31250,
+	[ICM42688_ACCEL_ODR_16000] = 62500,
+	[ICM42688_ACCEL_ODR_8000] = 125000,
+	[ICM42688_ACCEL_ODR_4000] = 250000,
+	[ICM42688_ACCEL_ODR_2000] = 500000,
+	[ICM42688_ACCEL_ODR_1000] = 1000000,
+	[ICM42688_ACCEL_ODR_200] = 5000000,
+	[ICM42688_ACCEL_ODR_100] = 10000000,
+	[ICM42688_ACCEL_ODR_50] = 20000000,
+	[ICM42688_ACCEL_ODR_25] = 40000000,
+	[ICM42688_ACCEL_ODR_12_5] = 80000000,
+	[ICM42688_ACCEL_ODR_6_25] = 160000000,
+	[ICM42688_ACCEL_ODR_3_125] = 320000000,
+	[ICM42688_ACCEL_ODR_1_5625] = 640000000,
+	[ICM42688_ACCEL_ODR_500] = 2000000,
+};
+
 static int icm42688_decoder_get_timestamp(const uint8_t *buffer, uint64_t *timestamp_ns)
 {
 	const struct icm42688_decoder_header *header =
 		(const struct icm42688_decoder_header *)buffer;
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+	uint32_t period_ns;
+	uint16_t frame_count;
 
 	*timestamp_ns = header->timestamp;
+	if (!header->is_fifo) {
+		return 0;
+	}
+
+	/* The timestamp is the one of the interrupt, which comes with the last frame, and
+	 * frames are stored at the fastest of the two ODRs.
+	 */
+	frame_count = icm42688_fifo_frame_count(edata);
+	period_ns = MIN(icm42688_odr_period_ns[edata->accel_odr],
+			icm42688_odr_period_ns[edata->gyro_odr]);
+	if (frame_count > 1) {
+		*timestamp_ns -= (uint64_t)(frame_count - 1) * period_ns;
+	}
+
 	return 0;
 }
-
 static int icm42688_decoder_get_shift(const uint8_t *buffer, enum sensor_channel channel_type,
 				      int8_t *shift)
 {
@@ -299,11 +488,33 @@ static int icm42688_decoder_get_shift(const uint8_t *buffer, enum sensor_channel
 	return icm42688_get_shift(channel_type, header->accel_fs, header->gyro_fs, shift);
 }
 
+static bool icm42688_decoder_has_trigger(const uint8_t *buffer, enum sensor_trigger_type trigger)
+{
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+
+	if (!edata->header.is_fifo) {
+		return false;
+	}
+
+	switch (trigger) {
+	case SENSOR_TRIG_DATA_READY:
+		return FIELD_GET(BIT_INT_STATUS_DATA_RDY, edata->int_status);
+	case SENSOR_TRIG_FIFO_WATERMARK:
+		return FIELD_GET(BIT_INT_STATUS_FIFO_THS, edata->int_status);
+	case SENSOR_TRIG_FIFO_FULL:
+		return FIELD_GET(BIT_INT_STATUS_FIFO_FULL, edata->int_status);
+	default:
+		return false;
+	}
+}
+
 SENSOR_DECODER_API_DT_DEFINE() = {
 	.get_frame_count = icm42688_decoder_get_frame_count,
 	.get_timestamp = icm42688_decoder_get_timestamp,
 	.get_shift = icm42688_decoder_get_shift,
 	.decode = icm42688_decoder_decode,
+	.has_trigger = icm42688_decoder_has_trigger,
+	.decode_channel = icm42688_decoder_decode_channel,
 };
 
 int icm42688_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
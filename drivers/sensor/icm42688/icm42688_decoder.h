@@ -27,6 +27,19 @@ struct icm42688_encoded_data {
 	int16_t readings[7];
 };
 
+/* FIFO packet with the accelerometer, gyroscope, temperature and timestamp data */
+#define ICM42688_FIFO_PACKET_SIZE 16
+
+/* Content of the FIFO, with the header is_fifo bit set */
+struct icm42688_fifo_data {
+	struct icm42688_decoder_header header;
+	uint8_t int_status;
+	uint8_t accel_odr: 4;
+	uint8_t gyro_odr: 4;
+	uint16_t fifo_count;
+	uint8_t frames[];
+} __attribute__((__packed__));
+
 int icm42688_encode(const struct device *dev, const enum sensor_channel *const channels,
 		    const size_t num_channels, uint8_t *buf);
 
@@ -250,6 +250,15 @@
 #define BIT_ACCEL_ODR_1_5625 0x0E
 #define BIT_ACCEL_ODR_500    0x0F
 
+/* FIFO packet header */
+#define BIT_FIFO_HEAD_MSG       BIT(7)
+#define BIT_FIFO_HEAD_ACCEL     BIT(6)
+#define BIT_FIFO_HEAD_GYRO      BIT(5)
+#define BIT_FIFO_HEAD_20        BIT(4)
+#define MASK_FIFO_HEAD_TMST     GENMASK(3, 2)
+#define BIT_FIFO_HEAD_ODR_ACCEL BIT(1)
+#define BIT_FIFO_HEAD_ODR_GYRO  BIT(0)
+
 /* Bank0 FIFO_CONFIG1 */
 #define BIT_FIFO_WM_GT_TH      BIT(5)
 #define BIT_FIFO_HIRES_EN      BIT(4)
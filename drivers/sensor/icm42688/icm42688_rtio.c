@@ -8,6 +8,7 @@
 #include "icm42688.h"
 #include "icm42688_decoder.h"
 #include "icm42688_reg.h"
+#include "icm42688_rtio.h"
 #include "icm42688_spi.h"
 
 #include <zephyr/logging/log.h>
@@ -42,7 +43,7 @@ static int icm42688_rtio_sample_fetch(const struct device *dev, int16_t readings
 	return 0;
 }
 
-int icm42688_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+static int icm42688_submit_one_shot(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
 {
 	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
 	const enum sensor_channel *const channels = cfg->channels;
@@ -78,4 +79,229 @@ int icm42688_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
 	return 0;
 }
 
+#ifdef CONFIG_ICM42688_STREAM
+static int icm42688_submit_stream(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
+	struct icm42688_dev_data *data = dev->data;
+	struct icm42688_cfg new_config = data->cfg;
+	int rc = 0;
+
+	new_config.fifo_en = false;
+	for (size_t i = 0; i < cfg->count; i++) {
+		switch (cfg->triggers[i].trigger) {
+		case SENSOR_TRIG_FIFO_WATERMARK:
+		case SENSOR_TRIG_FIFO_FULL:
+			new_config.fifo_en = true;
+			break;
+		default:
+			LOG_ERR("Unsupported stream trigger %d", cfg->triggers[i].trigger);
+			rc = -ENOTSUP;
+			break;
+		}
+	}
+
+	if (rc != 0 || !new_config.fifo_en) {
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+		rtio_iodev_sqe_err(iodev_sqe, rc != 0 ? rc : -EINVAL);
+		return rc != 0 ? rc : -EINVAL;
+	}
+
+	new_config.fifo_wm = CONFIG_ICM42688_FIFO_WATERMARK;
+
+	icm42688_lock(dev);
+
+	/* A multishot request is submitted again after each completion, the FIFO then
+	 * keeps running.
+	 */
+	if (!data->cfg.fifo_en || data->cfg.fifo_wm != new_config.fifo_wm) {
+		rc = icm42688_safely_configure(dev, &new_config);
+	}
+
+	if (rc == 0) {
+		data->streaming_sqe = iodev_sqe;
+	}
+
+	icm42688_unlock(dev);
+
+	if (rc != 0) {
+		LOG_ERR("Failed to enable the FIFO");
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	}
+
+	return rc;
+}
+
+static enum sensor_stream_data_opt icm42688_stream_data_opt(const struct sensor_read_config *cfg,
+							    uint8_t int_status, bool *triggered)
+{
+	enum sensor_stream_data_opt opt = SENSOR_STREAM_DATA_NOP;
+	bool fired;
+
+	*triggered = false;
+	for (size_t i = 0; i < cfg->count; i++) {
+		switch (cfg->triggers[i].trigger) {
+		case SENSOR_TRIG_FIFO_WATERMARK:
+			fired = FIELD_GET(BIT_INT_STATUS_FIFO_THS, int_status);
+			break;
+		case SENSOR_TRIG_FIFO_FULL:
+			fired = FIELD_GET(BIT_INT_STATUS_FIFO_FULL, int_status);
+			break;
+		default:
+			fired = false;
+			break;
+		}
+
+		if (!fired) {
+			continue;
+		}
+
+		/* Including the data wins over dropping it, which wins over keeping it */
+		*triggered = true;
+		if (cfg->triggers[i].opt == SENSOR_STREAM_DATA_INCLUDE) {
+			opt = SENSOR_STREAM_DATA_INCLUDE;
+		} else if (cfg->triggers[i].opt == SENSOR_STREAM_DATA_DROP &&
+			   opt == SENSOR_STREAM_DATA_NOP) {
+			opt = SENSOR_STREAM_DATA_DROP;
+		}
+	}
+
+	return opt;
+}
+
+static void icm42688_stream_stop(const struct device *dev)
+{
+	struct icm42688_dev_data *data = dev->data;
+	struct icm42688_cfg new_config = data->cfg;
+
+	new_config.fifo_en = false;
+	if (icm42688_safely_configure(dev, &new_config) != 0) {
+		LOG_ERR("Failed to disable the FIFO");
+	}
+}
+
+void icm42688_fifo_event(const struct device *dev)
+{
+	struct icm42688_dev_data *data = dev->data;
+	const struct icm42688_dev_cfg *dev_cfg = dev->config;
+	struct rtio_iodev_sqe *iodev_sqe = data->streaming_sqe;
+	const struct sensor_read_config *cfg;
+	struct icm42688_fifo_data *edata;
+	enum sensor_stream_data_opt opt;
+	uint8_t int_status;
+	uint8_t fifo_count_buf[2];
+	uint16_t fifo_count = 0;
+	uint32_t min_buf_len = sizeof(struct icm42688_fifo_data);
+	uint32_t max_buf_len = min_buf_len;
+	uint32_t read_len = 0;
+	bool triggered;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int rc;
+
+	if (iodev_sqe == NULL) {
+		return;
+	}
+
+	data->streaming_sqe = NULL;
+
+	/* A canceled stream is not submitted again, it ends with the FIFO */
+	if (FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags)) {
+		icm42688_stream_stop(dev);
+		rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+		return;
+	}
+
+	cfg = iodev_sqe->sqe.iodev->data;
+
+	rc = icm42688_spi_read(&dev_cfg->spi, REG_INT_STATUS, &int_status, 1);
+	if (rc != 0) {
+		goto err;
+	}
+
+	opt = icm42688_stream_data_opt(cfg, int_status, &triggered);
+	if (!triggered) {
+		data->streaming_sqe = iodev_sqe;
+		return;
+	}
+
+	if (opt == SENSOR_STREAM_DATA_INCLUDE) {
+		rc = icm42688_spi_read(&dev_cfg->spi, REG_FIFO_COUNTH, fifo_count_buf, 2);
+		if (rc != 0) {
+			goto err;
+		}
+
+		fifo_count = sys_get_be16(fifo_count_buf);
+		min_buf_len += MIN(fifo_count, ICM42688_FIFO_PACKET_SIZE);
+		max_buf_len += fifo_count;
+	}
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, max_buf_len, &buf, &buf_len);
+	if (rc != 0) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		goto err;
+	}
+
+	/* The whole FIFO, or as many packets as the buffer holds, in one transfer */
+	if (opt == SENSOR_STREAM_DATA_INCLUDE) {
+		read_len = buf_len - sizeof(struct icm42688_fifo_data);
+		if (read_len < fifo_count) {
+			read_len = ROUND_DOWN(read_len, ICM42688_FIFO_PACKET_SIZE);
+		} else {
+			read_len = fifo_count;
+		}
+	}
+
+	edata = (struct icm42688_fifo_data *)buf;
+	edata->header.is_fifo = true;
+	edata->header.accel_fs = data->cfg.accel_fs;
+	edata->header.gyro_fs = data->cfg.gyro_fs;
+	edata->header.timestamp = data->timestamp;
+	edata->int_status = int_status;
+	edata->accel_odr = data->cfg.accel_odr;
+	edata->gyro_odr = data->cfg.gyro_odr;
+	edata->fifo_count = read_len;
+
+	if (read_len > 0) {
+		rc = icm42688_spi_read(&dev_cfg->spi, REG_FIFO_DATA, edata->frames, read_len);
+		if (rc != 0) {
+			goto err;
+		}
+	}
+
+	if (opt == SENSOR_STREAM_DATA_DROP) {
+		rc = icm42688_spi_single_write(&dev_cfg->spi, REG_SIGNAL_PATH_RESET,
+					       FIELD_PREP(BIT_FIFO_FLUSH, 1));
+		if (rc != 0) {
+			goto err;
+		}
+	}
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+	return;
+
+err:
+	LOG_ERR("Failed to read the FIFO: %d", rc);
+	rtio_iodev_sqe_err(iodev_sqe, rc);
+}
+#endif /* CONFIG_ICM42688_STREAM */
+
+int icm42688_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
+
+	if (cfg->is_streaming) {
+#ifdef CONFIG_ICM42688_STREAM
+		return icm42688_submit_stream(dev, iodev_sqe);
+#else
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return -ENOTSUP;
+#endif
+	}
+
+	return icm42688_submit_one_shot(dev, iodev_sqe);
+}
+
 BUILD_ASSERT(sizeof(struct icm42688_decoder_header) == 9);
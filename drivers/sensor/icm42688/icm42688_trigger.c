@@ -12,6 +12,7 @@
 
 #include "icm42688.h"
 #include "icm42688_reg.h"
+#include "icm42688_rtio.h"
 #include "icm42688_spi.h"
 #include "icm42688_trigger.h"
 
@@ -25,6 +26,11 @@ static void icm42688_gpio_callback(const struct device *dev, struct gpio_callbac
 	ARG_UNUSED(dev);
 	ARG_UNUSED(pins);
 
+#ifdef CONFIG_ICM42688_STREAM
+	/* Time of the last frame of the FIFO */
+	data->timestamp = k_ticks_to_ns_floor64(k_uptime_ticks());
+#endif
+
 #if defined(CONFIG_ICM42688_TRIGGER_OWN_THREAD)
 	k_sem_give(&data->gpio_sem);
 #elif defined(CONFIG_ICM42688_TRIGGER_GLOBAL_THREAD)
@@ -39,6 +45,10 @@ static void icm42688_thread_cb(const struct device *dev)
 
 	icm42688_lock(dev);
 
+#ifdef CONFIG_ICM42688_STREAM
+	icm42688_fifo_event(dev);
+#endif
+
 	if (data->data_ready_handler != NULL) {
 		data->data_ready_handler(dev, data->data_ready_trigger);
 	}
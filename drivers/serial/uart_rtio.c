@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/uart.h>
+#include <zephyr/rtio/rtio.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(uart_rtio, CONFIG_UART_LOG_LEVEL);
+
+static int rx_buf_alloc(struct rtio *r, uint8_t **buf, uint32_t *len)
+{
+	if (r->block_pool == NULL) {
+		return -ENOMEM;
+	}
+
+	/* Sizes are multiples of the block size so that the allocation
+	 * stops at a single block.
+	 */
+	return rtio_block_pool_alloc(r->block_pool, r->block_pool->blk_size,
+				     ROUND_UP(CONFIG_UART_RTIO_RX_BUF_SIZE,
+					      r->block_pool->blk_size),
+				     buf, len);
+}
+
+/* A multishot request would be submitted again, and fail again, if it was
+ * completed with an error which does not come from the UART, so it ends
+ * with this error.
+ */
+static void rx_fail(struct rtio_iodev_sqe *iodev_sqe, int rc)
+{
+	iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+	rtio_iodev_sqe_err(iodev_sqe, rc);
+}
+
+static void rx_start(struct uart_rtio_data *data)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	k_spinlock_key_t key;
+	struct rtio *r;
+	uint8_t *buf;
+	uint32_t len;
+	int rc;
+
+	key = k_spin_lock(&data->lock);
+
+	iodev_sqe = data->rx_sqe;
+	if ((iodev_sqe == NULL) || data->rx_enabled) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	r = iodev_sqe->r;
+	rc = rx_buf_alloc(r, &buf, &len);
+	if (rc == 0) {
+		data->rx_enabled = true;
+		data->rx_ctx = r;
+		data->rx_buf = buf;
+		data->rx_buf_len = len;
+		data->rx_len = 0;
+	} else {
+		data->rx_sqe = NULL;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	if (rc == 0) {
+		rc = uart_rx_enable(data->dev, buf, len, data->rx_timeout);
+		if (rc < 0) {
+			key = k_spin_lock(&data->lock);
+			data->rx_enabled = false;
+			data->rx_buf = NULL;
+			iodev_sqe = data->rx_sqe;
+			data->rx_sqe = NULL;
+			k_spin_unlock(&data->lock, key);
+
+			rtio_release_buffer(r, buf, len);
+		}
+	}
+
+	if ((rc < 0) && (iodev_sqe != NULL)) {
+		LOG_ERR("Cannot start receiving: %d", rc);
+		rx_fail(iodev_sqe, rc);
+	}
+}
+
+static void rx_stop(struct uart_rtio_data *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	bool stop = data->rx_enabled && !data->rx_stopping;
+
+	if (stop) {
+		data->rx_stopping = true;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	if (stop) {
+		(void)uart_rx_disable(data->dev);
+	}
+}
+
+static void rx_rdy(struct uart_rtio_data *data, const struct uart_event_rx *rx)
+{
+	data->rx_len += rx->len;
+
+	/* The line is idle, get the buffer back by restarting the receiver */
+	if ((data->rx_timeout != SYS_FOREVER_US) && (rx->offset + rx->len < data->rx_buf_len)) {
+		rx_stop(data);
+	}
+}
+
+static void rx_buf_request(struct uart_rtio_data *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	struct rtio *r;
+	uint8_t *buf;
+	uint32_t len;
+	int rc;
+
+	if ((data->rx_sqe == NULL) || data->rx_stopping || (data->rx_next != NULL)) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	/* Without a buffer, the driver stops when the current one is full and
+	 * the allocation is tried again when restarting.
+	 */
+	r = data->rx_sqe->r;
+	rc = rx_buf_alloc(r, &buf, &len);
+	if (rc == 0) {
+		data->rx_next_ctx = r;
+		data->rx_next = buf;
+		data->rx_next_len = len;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	if ((rc == 0) && (uart_rx_buf_rsp(data->dev, buf, len) < 0)) {
+		key = k_spin_lock(&data->lock);
+		data->rx_next = NULL;
+		k_spin_unlock(&data->lock, key);
+
+		rtio_release_buffer(r, buf, len);
+	}
+}
+
+static void rx_buf_released(struct uart_rtio_data *data, uint8_t *buf)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	struct rtio_iodev_sqe *iodev_sqe = data->rx_sqe;
+	struct rtio *r = data->rx_ctx;
+	uint32_t len = data->rx_buf_len;
+	uint32_t count = data->rx_len;
+	bool done;
+
+	__ASSERT_NO_MSG(buf == data->rx_buf);
+
+	data->rx_ctx = data->rx_next_ctx;
+	data->rx_buf = data->rx_next;
+	data->rx_buf_len = data->rx_next_len;
+	data->rx_len = 0;
+	data->rx_next = NULL;
+
+	if ((iodev_sqe != NULL) && (iodev_sqe->r == r) && (count > 0)) {
+		data->rx_sqe = NULL;
+	} else {
+		iodev_sqe = NULL;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	if (iodev_sqe == NULL) {
+		rtio_release_buffer(r, buf, len);
+		return;
+	}
+
+	/* The buffer is given to the request, a multishot request is then
+	 * submitted again and gets the next buffer.
+	 */
+	iodev_sqe->sqe.buf = buf;
+	iodev_sqe->sqe.buf_len = len;
+	rtio_iodev_sqe_ok(iodev_sqe, count);
+
+	key = k_spin_lock(&data->lock);
+	done = (data->rx_sqe == NULL);
+	k_spin_unlock(&data->lock, key);
+
+	if (done) {
+		rx_stop(data);
+	}
+}
+
+static void rx_stopped(struct uart_rtio_data *data, enum uart_rx_stop_reason reason)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	struct rtio_iodev_sqe *iodev_sqe = data->rx_sqe;
+
+	data->rx_sqe = NULL;
+	data->rx_stopping = true;
+
+	k_spin_unlock(&data->lock, key);
+
+	LOG_WRN("Receiving stopped: %d", reason);
+
+	/* A multishot request is submitted again, receiving is restarted once
+	 * the driver has disabled it.
+	 */
+	if (iodev_sqe != NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -EIO);
+	}
+}
+
+static void rx_disabled(struct uart_rtio_data *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->rx_enabled = false;
+	data->rx_stopping = false;
+
+	k_spin_unlock(&data->lock, key);
+
+	rx_start(data);
+}
+
+static void tx_next(struct uart_rtio_data *data);
+
+static void tx_done(struct uart_rtio_data *data, int rc)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	struct rtio_iodev_sqe *iodev_sqe = data->tx_sqe;
+
+	data->tx_sqe = NULL;
+
+	k_spin_unlock(&data->lock, key);
+
+	if (iodev_sqe != NULL) {
+		if (rc < 0) {
+			rtio_iodev_sqe_err(iodev_sqe, rc);
+		} else {
+			rtio_iodev_sqe_ok(iodev_sqe, 0);
+		}
+	}
+
+	tx_next(data);
+}
+
+static void tx_next(struct uart_rtio_data *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	struct rtio_iodev_sqe *iodev_sqe;
+	struct rtio_mpsc_node *node;
+	const struct rtio_sqe *sqe;
+	int rc;
+
+	if (data->tx_sqe != NULL) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	node = rtio_mpsc_pop(&data->tx_q);
+	if (node == NULL) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+	data->tx_sqe = iodev_sqe;
+
+	k_spin_unlock(&data->lock, key);
+
+	sqe = &iodev_sqe->sqe;
+	if (sqe->op == RTIO_OP_TINY_TX) {
+		rc = uart_tx(data->dev, sqe->tiny_buf, sqe->tiny_buf_len, SYS_FOREVER_US);
+	} else {
+		rc = uart_tx(data->dev, sqe->buf, sqe->buf_len, SYS_FOREVER_US);
+	}
+
+	if (rc < 0) {
+		tx_done(data, rc);
+	}
+}
+
+static void uart_rtio_callback(const struct device *dev, struct uart_event *evt,
+			       void *user_data)
+{
+	struct uart_rtio_data *data = user_data;
+
+	ARG_UNUSED(dev);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		tx_done(data, 0);
+		break;
+	case UART_TX_ABORTED:
+		tx_done(data, -EIO);
+		break;
+	case UART_RX_RDY:
+		rx_rdy(data, &evt->data.rx);
+		break;
+	case UART_RX_BUF_REQUEST:
+		rx_buf_request(data);
+		break;
+	case UART_RX_BUF_RELEASED:
+		rx_buf_released(data, evt->data.rx_buf.buf);
+		break;
+	case UART_RX_DISABLED:
+		rx_disabled(data);
+		break;
+	case UART_RX_STOPPED:
+		rx_stopped(data, evt->data.rx_stop.reason);
+		break;
+	default:
+		break;
+	}
+}
+
+static void uart_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct uart_rtio_data *data = iodev_sqe->sqe.iodev->data;
+	k_spinlock_key_t key;
+	int rc = 0;
+
+	if (atomic_cas(&data->cb_set, 0, 1)) {
+		rc = uart_callback_set(data->dev, uart_rtio_callback, data);
+		if (rc < 0) {
+			atomic_clear(&data->cb_set);
+		}
+	}
+
+	switch (iodev_sqe->sqe.op) {
+	case RTIO_OP_RX:
+		if (rc == 0 && (iodev_sqe->sqe.flags & RTIO_SQE_MEMPOOL_BUFFER) == 0) {
+			rc = -ENOTSUP;
+		}
+
+		if (rc == 0) {
+			key = k_spin_lock(&data->lock);
+			if (data->rx_sqe != NULL) {
+				rc = -EBUSY;
+			} else {
+				data->rx_sqe = iodev_sqe;
+			}
+			k_spin_unlock(&data->lock, key);
+		}
+
+		if (rc < 0) {
+			rx_fail(iodev_sqe, rc);
+		} else {
+			rx_start(data);
+		}
+		break;
+	case RTIO_OP_TX:
+	case RTIO_OP_TINY_TX:
+		if (rc < 0) {
+			rtio_iodev_sqe_err(iodev_sqe, rc);
+		} else {
+			rtio_mpsc_push(&data->tx_q, &iodev_sqe->q);
+			tx_next(data);
+		}
+		break;
+	default:
+		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
+		break;
+	}
+}
+
+const struct rtio_iodev_api uart_iodev_api = {
+	.submit = uart_iodev_submit,
+};
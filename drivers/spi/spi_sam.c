@@ -62,6 +62,11 @@ struct spi_sam_data {
 #ifdef CONFIG_SPI_SAM_DMA
 	struct k_sem dma_sem;
 #endif /* CONFIG_SPI_SAM_DMA */
+
+#ifdef CONFIG_SPI_SAM_DMA_CHAIN
+	struct dma_block_config tx_blocks[CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS];
+	struct dma_block_config rx_blocks[CONFIG_DMA_SAM_XDMAC_MAX_BLOCKS];
+#endif /* CONFIG_SPI_SAM_DMA_CHAIN */
 };
 
 static inline k_spinlock_key_t spi_spin_lock(const struct device *dev)
@@ -434,6 +439,159 @@ out:
 	return res;
 }
 
+#ifdef CONFIG_SPI_SAM_DMA_CHAIN
+/* Blocks transferring the buffers of a submission */
+static int spi_sam_dma_blocks(Spi *regs, const struct rtio_sqe *sqe,
+			      struct dma_block_config *tx_block,
+			      struct dma_block_config *rx_block)
+{
+	const uint8_t *tx_buf = NULL;
+	uint8_t *rx_buf = NULL;
+	uint32_t len;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		rx_buf = sqe->buf;
+		len = sqe->buf_len;
+		break;
+	case RTIO_OP_TX:
+		tx_buf = sqe->buf;
+		len = sqe->buf_len;
+		break;
+	case RTIO_OP_TINY_TX:
+		tx_buf = sqe->tiny_buf;
+		len = sqe->tiny_buf_len;
+		break;
+	case RTIO_OP_TXRX:
+		tx_buf = sqe->tx_buf;
+		rx_buf = sqe->rx_buf;
+		len = sqe->txrx_buf_len;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	if (len == 0) {
+		return -ENOTSUP;
+	}
+
+	*tx_block = (struct dma_block_config) {
+		.source_addr_adj = tx_buf != NULL ? DMA_ADDR_ADJ_INCREMENT
+						  : DMA_ADDR_ADJ_NO_CHANGE,
+		.block_size = len,
+		.source_address = tx_buf != NULL ? (uint32_t)tx_buf : (uint32_t)&tx_dummy,
+		.dest_address = (uint32_t)&regs->SPI_TDR,
+	};
+
+	*rx_block = (struct dma_block_config) {
+		.dest_addr_adj = rx_buf != NULL ? DMA_ADDR_ADJ_INCREMENT
+						: DMA_ADDR_ADJ_NO_CHANGE,
+		.block_size = len,
+		.source_address = (uint32_t)&regs->SPI_RDR,
+		.dest_address = rx_buf != NULL ? (uint32_t)rx_buf : (uint32_t)&rx_dummy,
+	};
+
+	return 0;
+}
+
+/* Start the whole current transaction as a single DMA transfer. The
+ * completion is signaled by the receive channel, which finishes last, and
+ * completes the transaction from its last submission.
+ */
+static int spi_sam_dma_chain(const struct device *dev)
+{
+	const struct spi_sam_config *drv_cfg = dev->config;
+	struct spi_sam_data *drv_data = dev->data;
+	struct rtio_iodev_sqe *iodev_sqe = drv_data->txn_head;
+	struct rtio_iodev_sqe *last = NULL;
+	uint32_t count = 0;
+	int res;
+
+	if (drv_cfg->dma_dev == NULL || (iodev_sqe->sqe.flags & RTIO_SQE_TRANSACTION) == 0) {
+		return -ENOTSUP;
+	}
+
+	for (; iodev_sqe != NULL; iodev_sqe = rtio_txn_next(iodev_sqe)) {
+		if (count == ARRAY_SIZE(drv_data->tx_blocks)) {
+			return -ENOTSUP;
+		}
+
+		res = spi_sam_dma_blocks(drv_cfg->regs, &iodev_sqe->sqe,
+					 &drv_data->tx_blocks[count], &drv_data->rx_blocks[count]);
+		if (res < 0) {
+			return res;
+		}
+
+		if (count > 0) {
+			drv_data->tx_blocks[count - 1].next_block = &drv_data->tx_blocks[count];
+			drv_data->rx_blocks[count - 1].next_block = &drv_data->rx_blocks[count];
+		}
+
+		last = iodev_sqe;
+		count++;
+	}
+
+	struct dma_config rx_dma_cfg = {
+		.source_data_size = 1,
+		.dest_data_size = 1,
+		.block_count = count,
+		.dma_slot = drv_cfg->dma_rx_perid,
+		.channel_direction = PERIPHERAL_TO_MEMORY,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.complete_callback_en = false,
+		.error_callback_en = true,
+		.dma_callback = dma_callback,
+		.user_data = (void *)dev,
+		.head_block = &drv_data->rx_blocks[0],
+	};
+
+	struct dma_config tx_dma_cfg = {
+		.source_data_size = 1,
+		.dest_data_size = 1,
+		.block_count = count,
+		.dma_slot = drv_cfg->dma_tx_perid,
+		.channel_direction = MEMORY_TO_PERIPHERAL,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.complete_callback_en = false,
+		.error_callback_en = true,
+		.dma_callback = NULL,
+		.user_data = (void *)dev,
+		.head_block = &drv_data->tx_blocks[0],
+	};
+
+	res = dma_config(drv_cfg->dma_dev, drv_cfg->dma_rx_channel, &rx_dma_cfg);
+	if (res != 0) {
+		LOG_ERR("failed to configure SPI DMA RX chain");
+		return res;
+	}
+
+	res = dma_config(drv_cfg->dma_dev, drv_cfg->dma_tx_channel, &tx_dma_cfg);
+	if (res != 0) {
+		LOG_ERR("failed to configure SPI DMA TX chain");
+		return res;
+	}
+
+	drv_data->txn_curr = last;
+
+	/* Clocking begins on tx, so start rx first */
+	res = dma_start(drv_cfg->dma_dev, drv_cfg->dma_rx_channel);
+	if (res != 0) {
+		LOG_ERR("failed to start SPI DMA RX chain");
+		return res;
+	}
+
+	res = dma_start(drv_cfg->dma_dev, drv_cfg->dma_tx_channel);
+	if (res != 0) {
+		LOG_ERR("failed to start SPI DMA TX chain");
+		dma_stop(drv_cfg->dma_dev, drv_cfg->dma_rx_channel);
+	}
+
+	return res;
+}
+#endif /* CONFIG_SPI_SAM_DMA_CHAIN */
+
 #endif /* CONFIG_SPI_SAM_DMA */
 
 
@@ -713,6 +871,16 @@ static void spi_sam_iodev_next(const struct device *dev, bool completion)
 
 		spi_sam_configure(dev, spi_cfg);
 		spi_context_cs_control(&data->ctx, true);
+
+#ifdef CONFIG_SPI_SAM_DMA_CHAIN
+		if (spi_sam_dma_chain(dev) == 0) {
+			return;
+		}
+
+		/* Run the transaction one submission at a time otherwise */
+		data->txn_curr = data->txn_head;
+#endif /* CONFIG_SPI_SAM_DMA_CHAIN */
+
 		spi_sam_iodev_start(dev);
 	}
 }
@@ -563,6 +563,12 @@ int udc_ep_enqueue(const struct device *dev, struct net_buf *const buf)
 	LOG_DBG("Queue ep 0x%02x %p len %u", cfg->addr, buf,
 		USB_EP_DIR_IS_IN(cfg->addr) ? buf->len : buf->size);
 
+	/* A ZLP is only needed after a transfer of a multiple of MPS */
+	if (USB_EP_DIR_IS_IN(cfg->addr) && bi->zlp &&
+	    (buf->len == 0 || buf->len % cfg->mps)) {
+		bi->zlp = 0;
+	}
+
 	bi->setup = 0;
 	ret = api->ep_enqueue(dev, cfg, buf);
 
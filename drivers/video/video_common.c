@@ -6,10 +6,21 @@
 #include <zephyr/kernel.h>
 
 #include <zephyr/drivers/video.h>
+#include <zephyr/linker/devicetree_regions.h>
+#include <zephyr/net/buf.h>
 
+#if DT_HAS_CHOSEN(zephyr_video_buffer_pool)
+/* Place the pool in a memory region, for instance external PSRAM */
+Z_HEAP_DEFINE_IN_SECT(video_buffer_pool,
+		      CONFIG_VIDEO_BUFFER_POOL_SZ_MAX *
+		      CONFIG_VIDEO_BUFFER_POOL_NUM_MAX,
+		      Z_GENERIC_SECTION(LINKER_DT_NODE_REGION_NAME(
+			      DT_CHOSEN(zephyr_video_buffer_pool))));
+#else
 K_HEAP_DEFINE(video_buffer_pool,
 	      CONFIG_VIDEO_BUFFER_POOL_SZ_MAX *
 	      CONFIG_VIDEO_BUFFER_POOL_NUM_MAX);
+#endif
 
 static struct video_buffer video_buf[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
@@ -39,7 +50,9 @@ struct video_buffer *video_buffer_alloc(size_t size)
 	}
 
 	/* Alloc buffer memory */
-	block->data = k_heap_alloc(&video_buffer_pool, size, K_FOREVER);
+	block->data = k_heap_aligned_alloc(&video_buffer_pool,
+					   CONFIG_VIDEO_BUFFER_POOL_ALIGN,
+					   size, K_FOREVER);
 	if (block->data == NULL) {
 		return NULL;
 	}
@@ -69,3 +82,78 @@ void video_buffer_release(struct video_buffer *vbuf)
 		k_heap_free(&video_buffer_pool, block->data);
 	}
 }
+
+#ifdef CONFIG_VIDEO_BUFFER_REF
+void video_buffer_hold(struct video_buffer *vbuf, const struct device *dev,
+		       enum video_endpoint_id ep)
+{
+	vbuf->dev = dev;
+	vbuf->ep = ep;
+	atomic_set(&vbuf->ref, 1);
+}
+
+void video_buffer_ref(struct video_buffer *vbuf)
+{
+	atomic_inc(&vbuf->ref);
+}
+
+int video_buffer_unref(struct video_buffer *vbuf)
+{
+	if (atomic_dec(&vbuf->ref) != 1) {
+		return 0;
+	}
+
+	return video_enqueue(vbuf->dev, vbuf->ep, vbuf);
+}
+#endif
+
+#ifdef CONFIG_VIDEO_BUFFER_NET_BUF
+static void video_net_buf_destroy(struct net_buf *buf)
+{
+	struct video_buffer *vbuf = *(struct video_buffer **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+	(void)video_buffer_unref(vbuf);
+}
+
+NET_BUF_POOL_FIXED_DEFINE(video_net_buf_pool, CONFIG_VIDEO_BUFFER_NET_BUF_COUNT,
+			  0, sizeof(struct video_buffer *), video_net_buf_destroy);
+
+struct net_buf *video_buffer_net_buf(struct video_buffer *vbuf,
+				     k_timeout_t timeout)
+{
+	struct net_buf *head = NULL;
+	uint8_t *data = vbuf->buffer;
+	size_t left = vbuf->bytesused;
+
+	/* The length of a network buffer is 16 bits wide */
+	do {
+		size_t len = MIN(left, UINT16_MAX);
+		struct net_buf *buf;
+
+		buf = net_buf_alloc_with_data(&video_net_buf_pool, data, len,
+					      timeout);
+		if (buf == NULL) {
+			if (head != NULL) {
+				net_buf_unref(head);
+			}
+
+			return NULL;
+		}
+
+		*(struct video_buffer **)net_buf_user_data(buf) = vbuf;
+		video_buffer_ref(vbuf);
+
+		if (head == NULL) {
+			head = buf;
+		} else {
+			net_buf_frag_add(head, buf);
+		}
+
+		data += len;
+		left -= len;
+	} while (left > 0);
+
+	return head;
+}
+#endif
@@ -188,6 +188,8 @@ struct arm_mmu_config {
 struct arm_mmu_ptables {
 	uint64_t *base_xlat_table;
 	uint64_t ttbr0;
+	/* ASID in the low VM_ASID_BITS, generation of the ASID above */
+	uint64_t asid;
 };
 
 /* Convenience macros to represent the ARMv8-A-specific
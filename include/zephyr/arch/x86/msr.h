@@ -19,6 +19,13 @@
 #define X86_APIC_BASE_MSR		0x0000001b
 #define X86_APIC_BASE_MSR_X2APIC	BIT(10)
 
+#define X86_PERFEVTSEL0_MSR		0x00000186 /* .. thru 0x0000018D */
+#define X86_PERFEVTSEL_MSR_USR		BIT(16)
+#define X86_PERFEVTSEL_MSR_OS		BIT(17)
+#define X86_PERFEVTSEL_MSR_EN		BIT(22)
+
+#define X86_PERF_GLOBAL_CTRL_MSR	0x0000038f
+
 #define X86_MTRR_DEF_TYPE_MSR		0x000002ff
 #define X86_MTRR_DEF_TYPE_MSR_ENABLE	BIT(11)
 
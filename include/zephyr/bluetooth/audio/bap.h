@@ -771,6 +771,25 @@ int bt_bap_stream_release(struct bt_bap_stream *stream);
 int bt_bap_stream_send(struct bt_bap_stream *stream, struct net_buf *buf, uint16_t seq_num,
 		       uint32_t ts);
 
+/**
+ * @brief Store the data received on an Audio stream in a ring
+ *
+ * The SDUs received on the stream are stored in @p ring instead of being
+ * given to the @ref bt_bap_stream_ops.recv callback, and are retrieved with
+ * bt_iso_rx_ring_get(). The presentation delay of the ring is set to the one
+ * of the QoS of the stream.
+ *
+ * Requires @kconfig{CONFIG_BT_ISO_RX_RING}. The ring shall be set once the
+ * stream has been configured, it is reset when the stream disconnects.
+ *
+ * @param stream Stream object.
+ * @param ring   Ring initialized with bt_iso_rx_ring_init(), or NULL to give the
+ *               data to the recv callback again.
+ *
+ * @return 0 in case of success or negative value in case of error.
+ */
+int bt_bap_stream_rx_ring_set(struct bt_bap_stream *stream, struct bt_iso_rx_ring *ring);
+
 /**
  * @defgroup bt_bap_unicast_server BAP Unicast Server APIs
  * @ingroup bt_bap
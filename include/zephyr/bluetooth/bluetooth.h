@@ -2050,6 +2050,44 @@ struct bt_le_scan_recv_info {
 	uint8_t secondary_phy;
 };
 
+#if defined(CONFIG_BT_SCAN_BATCH)
+/** Compact advertising report given to batch listeners. */
+struct bt_le_scan_report {
+	/** Advertiser LE address and type. */
+	bt_addr_le_t addr;
+
+	/** Advertising Set Identifier. */
+	uint8_t sid;
+
+	/** Strength of advertiser signal. */
+	int8_t rssi;
+
+	/** Transmit power of the advertiser. */
+	int8_t tx_power;
+
+	/** Advertising packet type. */
+	uint8_t adv_type;
+
+	/** Advertising packet properties. */
+	uint16_t adv_props;
+
+	/** Periodic advertising interval, 0 if no periodic advertising. */
+	uint16_t interval;
+
+	/** Primary advertising channel PHY. */
+	uint8_t primary_phy;
+
+	/** Secondary advertising channel PHY. */
+	uint8_t secondary_phy;
+
+	/** Length of the advertising data. */
+	uint16_t data_len;
+
+	/** Advertising data. */
+	uint8_t data[CONFIG_BT_SCAN_BATCH_DATA_LEN];
+};
+#endif /* CONFIG_BT_SCAN_BATCH */
+
 /** Listener context for (LE) scanning. */
 struct bt_le_scan_cb {
 
@@ -2062,6 +2100,19 @@ struct bt_le_scan_cb {
 	void (*recv)(const struct bt_le_scan_recv_info *info,
 		     struct net_buf_simple *buf);
 
+#if defined(CONFIG_BT_SCAN_BATCH)
+	/**
+	 * @brief Batch of advertisement packets and scan responses received.
+	 *
+	 * Called from the system work queue with the reports received since
+	 * the previous batch, in the order they were received.
+	 *
+	 * @param reports Reports of the batch.
+	 * @param count   Number of reports.
+	 */
+	void (*recv_batch)(const struct bt_le_scan_report *reports, size_t count);
+#endif /* CONFIG_BT_SCAN_BATCH */
+
 	/** @brief The scanner has stopped scanning after scan timeout. */
 	void (*timeout)(void);
 
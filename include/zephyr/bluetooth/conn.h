@@ -519,6 +519,33 @@ int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info);
 int bt_conn_get_remote_info(struct bt_conn *conn,
 			    struct bt_conn_remote_info *remote_info);
 
+/** Connection TX latency statistics */
+struct bt_conn_tx_stats {
+	/** Number of packets given to the controller */
+	uint32_t count;
+	/** Average time spent by the packets in the host, in microseconds */
+	uint32_t latency_avg_us;
+	/** Longest time spent by a packet in the host, in microseconds */
+	uint32_t latency_max_us;
+};
+
+/** @brief Get the TX latency statistics of a connection.
+ *
+ *  The latency of a packet is the time from queuing it on the connection
+ *  until its last fragment is given to the controller. The statistics are
+ *  reset when the connection is established.
+ *
+ *  @note @kconfig{CONFIG_BT_CONN_TX_STATS} must be enabled.
+ *
+ *  @param conn  Connection object.
+ *  @param stats Statistics of the connection.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ *  @return -ENOTSUP The statistics are not enabled.
+ */
+int bt_conn_get_tx_stats(const struct bt_conn *conn,
+			 struct bt_conn_tx_stats *stats);
+
 /** @brief Get connection transmit power level.
  *
  *  @param conn           Connection object.
@@ -1511,6 +1511,42 @@ struct bt_gatt_discover_params {
 int bt_gatt_discover(struct bt_conn *conn,
 		     struct bt_gatt_discover_params *params);
 
+/** @brief GATT client cache bind callback
+ *
+ *  @param conn Connection object.
+ *  @param err 0 if the discoveries of the connection are served from the
+ *             cache, negative error code otherwise.
+ */
+typedef void (*bt_gatt_client_cache_func_t)(struct bt_conn *conn, int err);
+
+/** @brief Bind a connection to the cached database of its peer.
+ *
+ *  Read the Database Hash of the peer, and look for a database with the same
+ *  hash in the GATT client cache. If the database is unknown, it is recorded
+ *  by discovering the services, characteristics and attributes of the peer,
+ *  using all its ATT bearers. Once the connection is bound, the discoveries
+ *  of the connection, except @ref BT_GATT_DISCOVER_STD_CHAR_DESC, are served
+ *  from the cache without any request to the peer, until it disconnects.
+ *
+ *  The databases are stored with @kconfig{CONFIG_BT_SETTINGS}, so that peers
+ *  sharing a database are only discovered once.
+ *
+ *  @note @kconfig{CONFIG_BT_GATT_CLIENT_CACHE} must be enabled.
+ *
+ *  @param conn Connection object.
+ *  @param func Callback run from the BT RX thread once the connection is
+ *              bound or could not be bound.
+ *
+ *  @retval 0 Successfully queued the read of the Database Hash.
+ *  @retval -EBUSY The connection is already being bound.
+ *  @retval -EALREADY The connection is already bound.
+ *
+ *  The callback gets -ENOENT if the peer has no Database Hash, -EBUSY if
+ *  another connection is recording the same database and -ENOMEM if the
+ *  database does not fit in the cache.
+ */
+int bt_gatt_client_cache_bind(struct bt_conn *conn, bt_gatt_client_cache_func_t func);
+
 struct bt_gatt_read_params;
 
 /** @typedef bt_gatt_read_func_t
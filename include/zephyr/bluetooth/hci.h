@@ -134,6 +134,28 @@ int bt_hci_register_vnd_evt_cb(bt_hci_vnd_evt_cb_t cb);
  */
 int bt_hci_le_rand(void *buffer, size_t len);
 
+/** @brief Statistics of the queues of received HCI packets. */
+struct bt_hci_rx_stats {
+	/** Number of HCI events and ACL data packets waiting to be processed */
+	uint16_t queued;
+	/** Maximum number of HCI events and ACL data packets that waited */
+	uint16_t queued_max;
+	/** Number of ISO data packets waiting to be processed, when
+	 *  @kconfig{CONFIG_BT_RECV_ISO_WORKQ} is enabled
+	 */
+	uint16_t iso_queued;
+	/** Maximum number of ISO data packets that waited */
+	uint16_t iso_queued_max;
+};
+
+/** @brief Get the statistics of the queues of received HCI packets.
+ *
+ * Requires @kconfig{CONFIG_BT_RECV_STATS}.
+ *
+ * @param stats Place to store the statistics.
+ */
+void bt_hci_get_rx_stats(struct bt_hci_rx_stats *stats);
+
 
 #ifdef __cplusplus
 }
@@ -176,6 +176,16 @@ struct bt_iso_chan {
 	 */
 	bt_security_t			required_sec_level;
 #endif /* CONFIG_BT_SMP */
+#if defined(CONFIG_BT_ISO_RX_RING) || defined(__DOXYGEN__)
+	/** @brief Ring the received SDUs are stored in
+	 *
+	 * When set, the received SDUs are stored in the ring instead of being
+	 * given to the @ref bt_iso_chan_ops.recv callback.
+	 *
+	 * Only available when @kconfig{CONFIG_BT_ISO_RX_RING} is enabled.
+	 */
+	struct bt_iso_rx_ring		*rx_ring;
+#endif /* CONFIG_BT_ISO_RX_RING */
 	/** Node used internally by the stack */
 	sys_snode_t node;
 };
@@ -307,6 +317,32 @@ struct bt_iso_recv_info {
 	uint8_t flags;
 };
 
+#if defined(CONFIG_BT_ISO_RX_RING) || defined(__DOXYGEN__)
+/** @brief Slot of an ISO RX ring, holding a received SDU. */
+struct bt_iso_rx_slot {
+	/** The received SDU, NULL if the slot is empty */
+	struct net_buf *buf;
+	/** Meta data of the received SDU */
+	struct bt_iso_recv_info info;
+};
+
+/** @brief Ring of the SDUs received on an ISO channel
+ *
+ *  The SDUs are stored by packet sequence number, without being copied, and
+ *  are released in sequence once their presentation time is reached.
+ *  The fields are private, the ring is initialized with
+ *  bt_iso_rx_ring_init().
+ */
+struct bt_iso_rx_ring {
+	struct bt_iso_rx_slot *slots;
+	uint16_t mask;
+	uint16_t seq_next;
+	bool started;
+	uint32_t delay_us;
+	struct k_spinlock lock;
+};
+#endif /* CONFIG_BT_ISO_RX_RING */
+
 /** @brief ISO Meta Data structure for transmitted ISO packets. */
 struct bt_iso_tx_info {
 	/** CIG reference point or BIG anchor point of a transmitted SDU, in microseconds. */
@@ -1007,6 +1043,52 @@ enum bt_iso_chan_type bt_iso_chan_get_type(const struct bt_iso_chan *chan);
  */
 int bt_iso_chan_get_tx_sync(const struct bt_iso_chan *chan, struct bt_iso_tx_info *info);
 
+#if defined(CONFIG_BT_ISO_RX_RING) || defined(__DOXYGEN__)
+/** @brief Initialize an ISO RX ring
+ *
+ *  Set the @ref bt_iso_chan.rx_ring field of a channel to the ring to have
+ *  the received SDUs stored in the ring. The SDUs held by the ring are
+ *  buffers of the @kconfig{CONFIG_BT_ISO_RX_BUF_COUNT} pool, so the ring
+ *  must be smaller than the pool.
+ *
+ *  @param ring     Ring object.
+ *  @param slots    Slots of the ring.
+ *  @param count    Number of slots, a power of two.
+ *  @param delay_us Presentation delay added to the timestamps of the SDUs
+ *                  before releasing them, in microseconds.
+ */
+void bt_iso_rx_ring_init(struct bt_iso_rx_ring *ring, struct bt_iso_rx_slot *slots,
+			 uint16_t count, uint32_t delay_us);
+
+/** @brief Get the next SDU of an ISO RX ring
+ *
+ *  The SDUs are released in sequence, once the timestamp of the SDU plus the
+ *  presentation delay of the ring is reached. SDUs without timestamp are
+ *  released immediately. An SDU which was not received by the time a later
+ *  SDU is released is reported as lost, so that the caller can conceal it.
+ *
+ *  @param[in]  ring   Ring object.
+ *  @param[in]  ts_now Current time, in the time base of the ISO timestamps.
+ *  @param[out] info   Meta data of the SDU.
+ *  @param[out] buf    The SDU, to be unreferenced by the caller.
+ *
+ *  @retval 0 An SDU is released.
+ *  @retval -ENODATA The next SDU was lost, @p info holds its sequence number
+ *          and @p buf is not set.
+ *  @retval -EAGAIN No SDU is due.
+ */
+int bt_iso_rx_ring_get(struct bt_iso_rx_ring *ring, uint32_t ts_now,
+		       struct bt_iso_recv_info *info, struct net_buf **buf);
+
+/** @brief Release all the SDUs of an ISO RX ring
+ *
+ *  The ring is reset when the channel it is set on disconnects.
+ *
+ *  @param ring Ring object.
+ */
+void bt_iso_rx_ring_reset(struct bt_iso_rx_ring *ring);
+#endif /* CONFIG_BT_ISO_RX_RING */
+
 /** @brief Creates a BIG as a broadcaster
  *
  *  @param[in] padv      Pointer to the periodic advertising object the BIGInfo shall be sent on.
@@ -24,6 +24,13 @@
 extern "C" {
 #endif
 
+/** Number of bins of the histogram of the time relayed frames wait to be
+ *  advertised. The first bin counts the frames which waited less than 10 ms,
+ *  each following bin doubles the upper bound of the previous one, and the
+ *  last bin counts all the frames which waited longer.
+ */
+#define BT_MESH_STAT_RELAY_LATENCY_BINS 8
+
 /** The structure that keeps statistics of mesh frames handling. */
 struct bt_mesh_statistic {
 	/** All received frames passed basic validation and decryption. */
@@ -47,6 +54,16 @@ struct bt_mesh_statistic {
 	uint32_t tx_friend_planned;
 	/** Counter of frames that succeeded to send over friend bearer. */
 	uint32_t tx_friend_succeeded;
+	/** Number of frames waiting to be relayed over advertiser bearer. */
+	uint32_t tx_adv_relay_queued;
+	/** Maximum number of frames that waited to be relayed over advertiser bearer. */
+	uint32_t tx_adv_relay_queued_max;
+	/** Counter of frames that were dropped after waiting to be relayed for longer than
+	 *  CONFIG_BT_MESH_RELAY_QUEUE_TIMEOUT.
+	 */
+	uint32_t tx_adv_relay_dropped;
+	/** Histogram of the time frames waited to be relayed over advertiser bearer. */
+	uint32_t tx_adv_relay_latency[BT_MESH_STAT_RELAY_LATENCY_BINS];
 };
 
 /** @brief Get mesh frame handling statistic.
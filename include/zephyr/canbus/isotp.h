@@ -152,6 +152,16 @@ struct isotp_msg_id {
 	uint8_t use_ext_addr : 1;
 	/** Indicates if ISO-TP fixed addressing (acc. to SAE J1939) is used */
 	uint8_t use_fixed_addr : 1;
+	/** Indicates if CAN-FD frames are used (requires CONFIG_CAN_FD_MODE) */
+	uint8_t use_fdf : 1;
+	/** Indicates if the bit rate switch is used for CAN-FD frames */
+	uint8_t use_brs : 1;
+	/**
+	 * CAN frame data length (TX_DL) for outgoing SF, FF and CF: 8, or a
+	 * valid CAN-FD data length up to 64 if CAN-FD frames are used. 0 is
+	 * the same as 8. The receiver takes its RX_DL from the received FF.
+	 */
+	uint8_t dl;
 };
 
 /*
@@ -263,6 +273,50 @@ int isotp_recv(struct isotp_recv_ctx *ctx, uint8_t *data, size_t len,
 int isotp_recv_net(struct isotp_recv_ctx *ctx, struct net_buf **buffer,
 		   k_timeout_t timeout);
 
+/**
+ * @brief Bind an address to a receiving context with a reassembly buffer.
+ *
+ * This function is similar to isotp_bind, but messages are written directly
+ * to @p buf instead of being buffered in net-buffers, which also lets
+ * messages longer than the receive buffer pool be received. Messages are
+ * read with isotp_recv_buf, isotp_recv and isotp_recv_net must not be used
+ * on the context.
+ *
+ * @param ctx     Context to store the internal states.
+ * @param can_dev The CAN device to be used for sending and receiving.
+ * @param rx_addr Identifier for incoming data.
+ * @param tx_addr Identifier for FC frames.
+ * @param opts    Flow control options.
+ * @param buf     Buffer the messages are reassembled in.
+ * @param size    Size of the buffer. Longer messages are rejected.
+ * @param timeout Timeout for FF SF buffer allocation.
+ *
+ * @retval ISOTP_N_OK on success
+ * @retval ISOTP_NO_FREE_FILTER if CAN device has no filters left.
+ */
+int isotp_bind_buf(struct isotp_recv_ctx *ctx, const struct device *can_dev,
+		   const struct isotp_msg_id *rx_addr,
+		   const struct isotp_msg_id *tx_addr,
+		   const struct isotp_fc_opts *opts,
+		   uint8_t *buf, size_t size, k_timeout_t timeout);
+
+/**
+ * @brief Wait for a message in the reassembly buffer
+ *
+ * This function blocks until a complete message has been written to the
+ * buffer given to isotp_bind_buf. The message stays in the buffer until the
+ * next call of this function or isotp_unbind. Meanwhile, the sender of a new
+ * message is held off with WAIT flow control frames.
+ *
+ * @param ctx     Context bound with isotp_bind_buf.
+ * @param timeout Timeout for incoming data.
+ *
+ * @retval Length of the message on success
+ * @retval ISOTP_RECV_TIMEOUT when "timeout" timed out
+ * @retval ISOTP_N_* on error
+ */
+int isotp_recv_buf(struct isotp_recv_ctx *ctx, k_timeout_t timeout);
+
 /**
  * @brief Send data
  *
@@ -429,7 +483,15 @@ struct isotp_recv_ctx {
 	uint8_t state;
 	uint8_t bs;
 	uint8_t wft;
+	uint8_t rx_dl;
 	uint8_t sn_expected : 4;
+	/* reassembly buffer given to isotp_bind_buf */
+	uint8_t *rx_buf;
+	size_t rx_buf_size;
+	size_t rx_buf_len;
+	struct k_sem rx_buf_sem;
+	bool rx_buf_full;
+	bool rx_buf_held;
 };
 
 /** @endcond */
@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief C++20 coroutines running on a work queue
+ *
+ * Lets asynchronous code be written as stackless coroutines instead of
+ * callbacks or a thread per activity. A coroutine returns a
+ * zephyr::task and is started on an executor, which resumes it from
+ * its work queue. Waiting on a kernel object does not block the work
+ * queue: the coroutine is suspended, a triggered work item (see
+ * k_work_poll_submit_to_queue()) watches the object, and the coroutine
+ * is resumed once the object is ready or the wait timed out:
+ *
+ * @code{.cpp}
+ * K_SEM_DEFINE(rx_sem, 0, 1);
+ * static zephyr::executor exec(&k_sys_work_q);
+ *
+ * zephyr::task rx_loop()
+ * {
+ *         while (true) {
+ *                 if (co_await zephyr::take(&rx_sem, K_MSEC(100)) != 0) {
+ *                         continue;
+ *                 }
+ *                 process();
+ *         }
+ * }
+ *
+ * zephyr::spawn(exec, rx_loop());
+ * @endcode
+ *
+ * Coroutine frames are allocated with operator new. Requires C++20, a
+ * full C++ standard library providing @c <coroutine>, and
+ * @kconfig{CONFIG_POLL}.
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_COROUTINE_HPP_
+#define ZEPHYR_INCLUDE_CPP_COROUTINE_HPP_
+
+#include <coroutine>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef CONFIG_RTIO
+#include <zephyr/rtio/rtio.h>
+#endif
+
+#ifndef CONFIG_POLL
+#error "Coroutines require CONFIG_POLL"
+#endif
+
+namespace zephyr {
+
+class executor;
+
+/**
+ * @brief Coroutine started with spawn()
+ *
+ * The coroutine does not run until it is spawned, and its frame is
+ * freed when it returns. Exceptions must not escape it.
+ */
+class task {
+public:
+	/** @cond INTERNAL_HIDDEN */
+	struct promise_type {
+		sys_snode_t node;
+		executor *exec;
+
+		task get_return_object() noexcept
+		{
+			return task(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+
+		static task get_return_object_on_allocation_failure() noexcept
+		{
+			return task(nullptr);
+		}
+
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { k_panic(); }
+	};
+
+	using handle_type = std::coroutine_handle<promise_type>;
+	/** @endcond */
+
+	task(task &&other) noexcept : handle_(other.handle_)
+	{
+		other.handle_ = nullptr;
+	}
+
+	task(const task &) = delete;
+	task &operator=(const task &) = delete;
+
+	~task()
+	{
+		if (handle_) {
+			handle_.destroy();
+		}
+	}
+
+private:
+	explicit task(handle_type handle) noexcept : handle_(handle) {}
+
+	friend int spawn(executor &exec, task &&t);
+
+	handle_type handle_;
+};
+
+/**
+ * @brief Runs coroutines on a work queue
+ *
+ * Coroutines ready to run are queued on the executor and resumed one
+ * after the other from a single work item, so the work queue must have
+ * a single thread. Like the work queue, the executor must outlive the
+ * coroutines spawned on it.
+ */
+class executor {
+public:
+	/**
+	 * @param queue Work queue to resume coroutines from
+	 */
+	explicit executor(struct k_work_q *queue) noexcept : queue_(queue)
+	{
+		k_work_init(&work_, run);
+		sys_slist_init(&ready_);
+	}
+
+	executor(const executor &) = delete;
+	executor &operator=(const executor &) = delete;
+
+	/** @brief Work queue the coroutines run on */
+	struct k_work_q *queue() const noexcept { return queue_; }
+
+	/** @cond INTERNAL_HIDDEN */
+	void post(task::handle_type handle) noexcept
+	{
+		k_spinlock_key_t key = k_spin_lock(&lock_);
+
+		handle.promise().exec = this;
+		sys_slist_append(&ready_, &handle.promise().node);
+		k_spin_unlock(&lock_, key);
+
+		k_work_submit_to_queue(queue_, &work_);
+	}
+	/** @endcond */
+
+private:
+	/*
+	 * Resuming from here rather than from the work item an awaiter
+	 * waited with lets the awaiter be destroyed by the coroutine: the
+	 * work queue still accesses a work item after its handler returns.
+	 */
+	static void run(struct k_work *work)
+	{
+		executor *self = CONTAINER_OF(work, executor, work_);
+		sys_snode_t *node;
+		k_spinlock_key_t key;
+
+		while (true) {
+			key = k_spin_lock(&self->lock_);
+			node = sys_slist_get(&self->ready_);
+			k_spin_unlock(&self->lock_, key);
+
+			if (node == nullptr) {
+				break;
+			}
+
+			task::handle_type::from_promise(
+				*CONTAINER_OF(node, task::promise_type, node)).resume();
+		}
+	}
+
+	struct k_work work_;
+	sys_slist_t ready_;
+	struct k_spinlock lock_;
+	struct k_work_q *queue_;
+};
+
+/**
+ * @brief Start a coroutine
+ *
+ * The coroutine runs from the work queue of @p exec until it returns.
+ *
+ * @param exec Executor to run the coroutine on
+ * @param t Task returned by the coroutine
+ * @retval 0 Coroutine started
+ * @retval -ENOMEM The coroutine frame could not be allocated
+ */
+inline int spawn(executor &exec, task &&t)
+{
+	if (!t.handle_) {
+		return -ENOMEM;
+	}
+
+	exec.post(t.handle_);
+	t.handle_ = nullptr;
+
+	return 0;
+}
+
+/** @cond INTERNAL_HIDDEN */
+namespace detail {
+
+/*
+ * Suspends a coroutine until one of the events is ready and attempt()
+ * succeeds, or until the timeout. attempt() is tried first so a
+ * coroutine is not suspended when the object is already available,
+ * and again each time the events signal since another consumer may
+ * have been faster. Without attempt(), an event being ready is enough.
+ */
+struct poll_wait {
+	struct k_work_poll work;
+	struct k_poll_event *events;
+	int num_events;
+	k_timepoint_t end;
+	bool (*attempt)(void *arg);
+	void *arg;
+	task::handle_type handle;
+	int result;
+
+	void submit()
+	{
+		for (int i = 0; i < num_events; i++) {
+			events[i].state = K_POLL_STATE_NOT_READY;
+		}
+
+		result = k_work_poll_submit_to_queue(handle.promise().exec->queue(), &work,
+						     events, num_events,
+						     sys_timepoint_timeout(end));
+		if (result != 0) {
+			handle.promise().exec->post(handle);
+		}
+	}
+
+	static void triggered(struct k_work *item)
+	{
+		struct k_work_poll *twork = CONTAINER_OF(item, struct k_work_poll, work);
+		poll_wait *self = CONTAINER_OF(twork, poll_wait, work);
+
+		bool done = (self->attempt != nullptr) ? self->attempt(self->arg)
+						       : (twork->poll_result == 0);
+
+		if (done) {
+			self->result = 0;
+		} else if (twork->poll_result != 0 || sys_timepoint_expired(self->end)) {
+			self->result = -EAGAIN;
+		} else {
+			self->submit();
+			return;
+		}
+
+		self->handle.promise().exec->post(self->handle);
+	}
+
+	bool ready()
+	{
+		if ((attempt != nullptr) && attempt(arg)) {
+			result = 0;
+			return true;
+		}
+
+		return false;
+	}
+
+	void suspend(task::handle_type h)
+	{
+		handle = h;
+		k_work_poll_init(&work, triggered);
+		submit();
+	}
+};
+
+} /* namespace detail */
+/** @endcond */
+
+/**
+ * @brief Awaitable resuming the coroutine once any of the events is ready
+ *
+ * The state of each event tells which ones are ready. The events must
+ * stay valid while the coroutine waits.
+ *
+ * @param events Events to wait for
+ * @param num_events Number of events
+ * @param timeout Maximum time to wait
+ * @return Awaitable yielding 0 when an event is ready, -EAGAIN on
+ *         timeout or a negative errno from k_work_poll_submit_to_queue()
+ */
+class poll {
+public:
+	poll(struct k_poll_event *events, int num_events, k_timeout_t timeout) noexcept
+	{
+		wait_.events = events;
+		wait_.num_events = num_events;
+		wait_.end = sys_timepoint_calc(timeout);
+		wait_.attempt = nullptr;
+		wait_.arg = nullptr;
+	}
+
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(task::handle_type h) noexcept { wait_.suspend(h); }
+	int await_resume() const noexcept { return wait_.result; }
+
+private:
+	detail::poll_wait wait_;
+};
+
+/**
+ * @brief Awaitable taking a semaphore
+ *
+ * @param sem Semaphore to take
+ * @param timeout Maximum time to wait
+ * @return Awaitable yielding 0 when the semaphore was taken, -EAGAIN on
+ *         timeout
+ */
+class take {
+public:
+	take(struct k_sem *sem, k_timeout_t timeout) noexcept
+	{
+		k_poll_event_init(&event_, K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, sem);
+		wait_.events = &event_;
+		wait_.num_events = 1;
+		wait_.end = sys_timepoint_calc(timeout);
+		wait_.attempt = attempt;
+		wait_.arg = sem;
+	}
+
+	bool await_ready() noexcept { return wait_.ready(); }
+	void await_suspend(task::handle_type h) noexcept { wait_.suspend(h); }
+	int await_resume() const noexcept { return wait_.result; }
+
+private:
+	static bool attempt(void *arg)
+	{
+		return k_sem_take(static_cast<struct k_sem *>(arg), K_NO_WAIT) == 0;
+	}
+
+	detail::poll_wait wait_;
+	struct k_poll_event event_;
+};
+
+/**
+ * @brief Awaitable receiving a message from a message queue
+ *
+ * @param msgq Message queue
+ * @param data Buffer receiving the message, must stay valid while the
+ *        coroutine waits
+ * @param timeout Maximum time to wait
+ * @return Awaitable yielding 0 when a message was received, -EAGAIN on
+ *         timeout
+ */
+class get {
+public:
+	get(struct k_msgq *msgq, void *data, k_timeout_t timeout) noexcept
+		: msgq_(msgq), data_(data)
+	{
+		k_poll_event_init(&event_, K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, msgq);
+		wait_.events = &event_;
+		wait_.num_events = 1;
+		wait_.end = sys_timepoint_calc(timeout);
+		wait_.attempt = attempt;
+		wait_.arg = this;
+	}
+
+	bool await_ready() noexcept { return wait_.ready(); }
+	void await_suspend(task::handle_type h) noexcept { wait_.suspend(h); }
+	int await_resume() const noexcept { return wait_.result; }
+
+private:
+	static bool attempt(void *arg)
+	{
+		get *self = static_cast<get *>(arg);
+
+		return k_msgq_get(self->msgq_, self->data_, K_NO_WAIT) == 0;
+	}
+
+	detail::poll_wait wait_;
+	struct k_poll_event event_;
+	struct k_msgq *msgq_;
+	void *data_;
+};
+
+#if defined(CONFIG_RTIO_CONSUME_SEM) || defined(__DOXYGEN__)
+/**
+ * @brief Awaitable consuming an RTIO completion queue event
+ *
+ * The event must be released with rtio_cqe_release() once handled.
+ * Requires @kconfig{CONFIG_RTIO_CONSUME_SEM}, whose semaphore tells
+ * when completions are available.
+ *
+ * @param r RTIO context
+ * @param timeout Maximum time to wait
+ * @return Awaitable yielding the completion queue event, or NULL on
+ *         timeout
+ */
+class consume {
+public:
+	consume(struct rtio *r, k_timeout_t timeout) noexcept : r_(r), cqe_(nullptr)
+	{
+		k_poll_event_init(&event_, K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, r->consume_sem);
+		wait_.events = &event_;
+		wait_.num_events = 1;
+		wait_.end = sys_timepoint_calc(timeout);
+		wait_.attempt = attempt;
+		wait_.arg = this;
+	}
+
+	bool await_ready() noexcept { return wait_.ready(); }
+	void await_suspend(task::handle_type h) noexcept { wait_.suspend(h); }
+	struct rtio_cqe *await_resume() const noexcept { return cqe_; }
+
+private:
+	static bool attempt(void *arg)
+	{
+		consume *self = static_cast<consume *>(arg);
+
+		self->cqe_ = rtio_cqe_consume(self->r_);
+
+		return self->cqe_ != nullptr;
+	}
+
+	detail::poll_wait wait_;
+	struct k_poll_event event_;
+	struct rtio *r_;
+	struct rtio_cqe *cqe_;
+};
+#endif /* CONFIG_RTIO_CONSUME_SEM */
+
+/**
+ * @brief Awaitable suspending the coroutine for some time
+ *
+ * The work queue keeps running other work meanwhile.
+ *
+ * @param timeout Time to sleep
+ */
+class sleep_for {
+public:
+	explicit sleep_for(k_timeout_t timeout) noexcept : timeout_(timeout) {}
+
+	bool await_ready() const noexcept { return K_TIMEOUT_EQ(timeout_, K_NO_WAIT); }
+
+	void await_suspend(task::handle_type h) noexcept
+	{
+		handle_ = h;
+		k_work_init_delayable(&work_, expired);
+		k_work_schedule_for_queue(h.promise().exec->queue(), &work_, timeout_);
+	}
+
+	void await_resume() const noexcept {}
+
+private:
+	static void expired(struct k_work *item)
+	{
+		struct k_work_delayable *dwork = k_work_delayable_from_work(item);
+		sleep_for *self = CONTAINER_OF(dwork, sleep_for, work_);
+
+		self->handle_.promise().exec->post(self->handle_);
+	}
+
+	struct k_work_delayable work_;
+	k_timeout_t timeout_;
+	task::handle_type handle_;
+};
+
+/**
+ * @brief Awaitable moving the coroutine to another executor
+ *
+ * The coroutine resumes from the work queue of @p exec, and keeps
+ * running there after later waits.
+ *
+ * @param exec Executor to continue on
+ */
+class resume_on {
+public:
+	explicit resume_on(executor &exec) noexcept : exec_(exec) {}
+
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(task::handle_type h) noexcept { exec_.post(h); }
+	void await_resume() const noexcept {}
+
+private:
+	executor &exec_;
+};
+
+} /* namespace zephyr */
+
+#endif /* ZEPHYR_INCLUDE_CPP_COROUTINE_HPP_ */
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Polymorphic memory resources over Zephyr allocators
+ *
+ * Adapters letting standard containers allocate from a @ref k_heap or
+ * a @ref sys_arena through @c std::pmr, so that each subsystem can use
+ * its own heap instead of contending for the global one:
+ *
+ * @code{.cpp}
+ * K_HEAP_DEFINE(sensor_heap, 2048);
+ * zephyr::heap_resource sensor_res(&sensor_heap);
+ * std::pmr::vector<int> samples(&sensor_res);
+ * @endcode
+ *
+ * Requires C++17 and a full C++ standard library providing
+ * @c <memory_resource>.
+ */
+
+#ifndef ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_
+#define ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <zephyr/kernel.h>
+
+#ifdef CONFIG_SYS_ARENA
+#include <zephyr/sys/arena.h>
+#endif
+
+namespace zephyr {
+
+/** @cond INTERNAL_HIDDEN */
+namespace detail {
+
+inline void *check_alloc(void *ptr)
+{
+	if (ptr == nullptr) {
+#ifdef __cpp_exceptions
+		throw std::bad_alloc();
+#else
+		k_panic();
+#endif
+	}
+
+	return ptr;
+}
+
+} /* namespace detail */
+/** @endcond */
+
+/**
+ * @brief Memory resource allocating from a @ref k_heap
+ *
+ * Allocations do not wait for memory to be freed. When the heap is
+ * exhausted @c std::bad_alloc is thrown, or the kernel panics if C++
+ * exceptions are disabled. The resource is as thread safe as the
+ * heap is.
+ */
+class heap_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param heap Heap to allocate from, must outlive the resource
+	 */
+	explicit heap_resource(struct k_heap *heap) noexcept : heap_(heap) {}
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t align) override
+	{
+		/* Zero-sized requests still need a distinct pointer */
+		return detail::check_alloc(k_heap_aligned_alloc(heap_, align,
+								     MAX(bytes, 1), K_NO_WAIT));
+	}
+
+	void do_deallocate(void *ptr, std::size_t, std::size_t) override
+	{
+		k_heap_free(heap_, ptr);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+
+	struct k_heap *heap_;
+};
+
+#if defined(CONFIG_SYS_ARENA) || defined(__DOXYGEN__)
+/**
+ * @brief Memory resource allocating from a @ref sys_arena
+ *
+ * Deallocation does nothing, memory is only given back by resetting or
+ * rolling back the arena, after the containers using it are destroyed.
+ * Like the arena, the resource does no locking.
+ */
+class arena_resource : public std::pmr::memory_resource {
+public:
+	/**
+	 * @param arena Arena to allocate from, must outlive the resource
+	 */
+	explicit arena_resource(struct sys_arena *arena) noexcept : arena_(arena) {}
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t align) override
+	{
+		return detail::check_alloc(sys_arena_aligned_alloc(arena_, align,
+									MAX(bytes, 1)));
+	}
+
+	void do_deallocate(void *, std::size_t, std::size_t) override
+	{
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+
+	struct sys_arena *arena_;
+};
+#endif /* CONFIG_SYS_ARENA */
+
+} /* namespace zephyr */
+
+#endif /* ZEPHYR_INCLUDE_CPP_MEMORY_RESOURCE_HPP_ */
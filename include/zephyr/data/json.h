@@ -11,6 +11,7 @@
 #include <stddef.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/types.h>
+#include <zephyr/sys_clock.h>
 #include <sys/types.h>
 
 #ifdef __cplusplus
@@ -75,6 +76,39 @@ struct json_obj_token {
 	size_t length;
 };
 
+/**
+ * @brief Function pointer type to receive the tokens of a JSON stream.
+ *
+ * @param type Token type: one of the structural tokens, JSON_TOK_STRING,
+ * JSON_TOK_NUMBER, JSON_TOK_TRUE, JSON_TOK_FALSE or JSON_TOK_NULL.
+ * @param value Token text, without the quotes for strings, whose escape
+ * sequences are left as they are. Only valid during the call.
+ * @param len Length of the token text
+ * @param user_data User data given to json_stream_init()
+ *
+ * @return 0 to continue, anything else stops the stream and is returned
+ * by json_stream_feed().
+ */
+typedef int (*json_stream_cb_t)(enum json_tokens type, const char *value,
+				size_t len, void *user_data);
+
+/**
+ * @brief Streaming JSON tokenizer
+ *
+ * The fields are private, see json_stream_init().
+ */
+struct json_stream {
+	json_stream_cb_t cb;
+	void *user_data;
+	char *buf;
+	size_t buf_size;
+	size_t len;
+	const char *literal;
+	enum json_tokens type;
+	uint8_t state;
+	uint8_t unicode_left;
+};
+
 
 struct json_obj_descr {
 	const char *field_name;
@@ -689,6 +723,53 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+/**
+ * @brief Initialize a streaming JSON tokenizer
+ *
+ * Unlike json_obj_parse(), the tokenizer does not need the whole document
+ * in memory: it is fed the data in chunks of any size, as they arrive from
+ * a socket for instance, with json_stream_feed(). Tokens within a chunk are
+ * passed to @p cb in place, only the beginning of a token which continues
+ * in the next chunk is copied to @p buf. The tokenizer checks the syntax of
+ * the tokens, not how they are nested, which is left to @p cb.
+ *
+ * @param stream Tokenizer
+ * @param buf Buffer holding tokens spanning chunks
+ * @param buf_size Size of @p buf, the maximum length of such tokens
+ * @param cb Function called for each token
+ * @param user_data User data passed to @p cb
+ */
+void json_stream_init(struct json_stream *stream, char *buf, size_t buf_size,
+		      json_stream_cb_t cb, void *user_data);
+
+/**
+ * @brief Feed a chunk of data to a streaming JSON tokenizer
+ *
+ * @param stream Tokenizer
+ * @param data Chunk of the JSON document
+ * @param len Length of the chunk
+ *
+ * @return 0 if the chunk has been processed, -EINVAL if the data is not
+ * valid JSON, -ENOMEM if a token spanning chunks does not fit in the
+ * buffer, or the value returned by the callback if it stopped the stream.
+ * The stream can not be fed after an error until json_stream_finish() is
+ * called.
+ */
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Signal the end of the data to a streaming JSON tokenizer
+ *
+ * A number at the end of the data is only passed to the callback at this
+ * point. The tokenizer is reset and can be fed a new document.
+ *
+ * @param stream Tokenizer
+ *
+ * @return 0 on success, -EINVAL if the data ends within a token, or the
+ * value returned by the callback for the last token.
+ */
+int json_stream_finish(struct json_stream *stream);
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -801,6 +882,45 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode(const struct json_obj_descr *descr, const void *val,
 		    json_append_bytes_t append_bytes, void *data);
 
+struct net_buf;
+
+/**
+ * @brief Encodes an object into a net_buf chain
+ *
+ * The data is appended to the last fragment of @p buf, fragments are
+ * allocated from the pool of @p buf when it is full, so that the object is
+ * encoded without an intermediate buffer.
+ *
+ * @note Requires @kconfig{CONFIG_NET_BUF}
+ *
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array
+ * @param val Struct holding the values
+ * @param buf Buffer to append the JSON data to
+ * @param timeout Timeout for the allocation of fragments
+ *
+ * @return 0 if object has been successfully encoded. -ENOMEM if no
+ * fragment could be allocated, the data appended so far is left in @p buf.
+ */
+int json_obj_encode_net_buf(const struct json_obj_descr *descr, size_t descr_len,
+			    const void *val, struct net_buf *buf, k_timeout_t timeout);
+
+/**
+ * @brief Encodes an array into a net_buf chain
+ *
+ * @note Requires @kconfig{CONFIG_NET_BUF}
+ *
+ * @param descr Pointer to the descriptor array
+ * @param val Struct holding the values
+ * @param buf Buffer to append the JSON data to
+ * @param timeout Timeout for the allocation of fragments
+ *
+ * @return 0 if array has been successfully encoded. -ENOMEM if no
+ * fragment could be allocated, the data appended so far is left in @p buf.
+ */
+int json_arr_encode_net_buf(const struct json_obj_descr *descr, const void *val,
+			    struct net_buf *buf, k_timeout_t timeout);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_PROFILER_H_
+#define ZEPHYR_INCLUDE_DEBUG_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup profiler Sampling profiler
+ * @ingroup os_services
+ * @brief Statistical profiler sampling the interrupted threads
+ *
+ * A periodic kernel timer samples the program counter, and where frame
+ * pointers are available the return addresses, of the thread interrupted
+ * by the system timer. Samples are kept in a ring buffer until they are
+ * read.
+ * @{
+ */
+
+/** Maximum number of addresses in a sample */
+#ifdef CONFIG_PROFILER_SAMPLING_STACK
+#define PROFILER_SAMPLE_FRAMES (1 + CONFIG_PROFILER_SAMPLING_STACK_DEPTH)
+#else
+#define PROFILER_SAMPLE_FRAMES 1
+#endif
+
+/** A sample */
+struct profiler_sample {
+	/** Thread running when the sample was taken. */
+	k_tid_t thread;
+	/**
+	 * Number of addresses in @a frames, 0 if the sample was taken while
+	 * handling an interrupt.
+	 */
+	size_t num_frames;
+	/** Program counter followed by the return addresses of the callers. */
+	uintptr_t frames[PROFILER_SAMPLE_FRAMES];
+};
+
+/**
+ * @brief Start sampling.
+ *
+ * Restarts sampling with the new rate if the profiler is running.
+ *
+ * @param rate_hz Number of samples per second, at most
+ *                @kconfig{CONFIG_SYS_CLOCK_TICKS_PER_SEC}.
+ *
+ * @return 0 on success, -EINVAL if the rate is invalid.
+ */
+int profiler_start(uint32_t rate_hz);
+
+/**
+ * @brief Stop sampling.
+ *
+ * The samples which have not been read are kept.
+ */
+void profiler_stop(void);
+
+/**
+ * @brief Get the oldest sample.
+ *
+ * @param sample Sample.
+ *
+ * @return 0 on success, -EAGAIN if there are no samples.
+ */
+int profiler_sample_get(struct profiler_sample *sample);
+
+/**
+ * @brief Get the number of samples dropped because the buffer was full.
+ *
+ * @return Number of samples dropped since the last reset.
+ */
+uint32_t profiler_dropped_get(void);
+
+/**
+ * @brief Discard the samples and clear the dropped samples counter.
+ */
+void profiler_reset(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_PROFILER_H_ */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Delta image header file
+ *
+ * This header file declares prototypes for applying delta patches to
+ * firmware images while they are written to flash.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DFU_FLASH_IMG_DELTA_H_
+#define ZEPHYR_INCLUDE_DFU_FLASH_IMG_DELTA_H_
+
+#include <zephyr/dfu/flash_img.h>
+
+/**
+ * @brief Apply delta patches to firmware images written to flash
+ * @defgroup flash_img_delta_api Delta image API
+ * @ingroup flash_img_api
+ * @{
+ *
+ * A patch rebuilds a target image from a source image, normally the one
+ * running from the primary slot, in the manner of bsdiff. It starts with
+ * the @ref FLASH_IMG_DELTA_MAGIC bytes and the size of the target image,
+ * followed by records which each hold:
+ *
+ * - the length of a diff block,
+ * - the length of an extra block,
+ * - the diff block, whose bytes are added modulo 256 to the bytes of the
+ *   source image at the current source offset, which then advances past
+ *   them,
+ * - the extra block, whose bytes are output as they are,
+ * - a signed adjustment of the source offset.
+ *
+ * Lengths and sizes are unsigned LEB128 numbers, the adjustment is a
+ * zigzag encoded LEB128 number. The lengths are those of the output, in the
+ * patch a zero byte of a diff block is followed by the number of further
+ * zero bytes, so that unchanged runs of the source image take a couple of
+ * bytes. The records are applied in order as the
+ * patch is received, so that only the parser state and a buffer of the
+ * source image are held in RAM. Patches are generated from the source and
+ * target images with scripts/utils/delta_patch.py.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** First bytes of a patch */
+#define FLASH_IMG_DELTA_MAGIC "ZDP1"
+
+/** Length of @ref FLASH_IMG_DELTA_MAGIC */
+#define FLASH_IMG_DELTA_MAGIC_LEN 4
+
+/**
+ * @brief Delta patch application context
+ *
+ * The fields are private.
+ */
+struct flash_img_delta_context {
+	struct flash_img_context *img;
+	const struct flash_area *src;
+	uint8_t src_buf[CONFIG_IMG_DELTA_SRC_BUF_SIZE];
+	size_t src_buf_off;
+	size_t src_buf_len;
+	size_t src_off;
+	size_t target_size;
+	size_t written;
+	size_t block_left;
+	size_t extra_len;
+	uint64_t num;
+	uint8_t num_shift;
+	uint8_t state;
+};
+
+/**
+ * @brief Initialize context needed for applying a patch.
+ *
+ * The target image is written through @p img, which must have been
+ * initialized with flash_img_init_id() or flash_img_init().
+ *
+ * @param ctx         context to be initialized
+ * @param img         flash image context the target image is written to
+ * @param src_area_id flash area id of partition holding the source image
+ * @return  0 on success, negative errno code on fail
+ */
+int flash_img_delta_init(struct flash_img_delta_context *ctx,
+			 struct flash_img_context *img, uint8_t src_area_id);
+
+/**
+ * @brief Process a chunk of a patch.
+ *
+ * The patch may be split in chunks of any size. The reconstructed target
+ * image is written with flash_img_buffered_write(), a final call with
+ * flush set to true, once the whole patch has been processed, writes out
+ * the remaining buffered data.
+ *
+ * @param ctx   context
+ * @param data  patch data
+ * @param len   number of bytes of patch data
+ * @param flush when true the patch must be complete and the target image
+ *              is flushed to flash
+ * @return  0 on success, -EINVAL if the patch is malformed, does not
+ *          apply to the source image or is incomplete when flushing,
+ *          other negative errno code on fail
+ */
+int flash_img_delta_write(struct flash_img_delta_context *ctx,
+			  const uint8_t *data, size_t len, bool flush);
+
+/**
+ * @brief Get the size of the target image of a patch.
+ *
+ * @param data beginning of the patch
+ * @param len  number of bytes available at @p data
+ * @param size target image size
+ * @return  0 on success, -EINVAL if @p data is not the beginning of a
+ *          patch or is too short to hold the size
+ */
+int flash_img_delta_target_size(const uint8_t *data, size_t len, size_t *size);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif	/* ZEPHYR_INCLUDE_DFU_FLASH_IMG_DELTA_H_ */
@@ -16,6 +16,7 @@
 #include <zephyr/device.h>
 #include <zephyr/dt-bindings/adc/adc.h>
 #include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -858,6 +859,79 @@ static inline bool adc_is_ready_dt(const struct adc_dt_spec *spec)
 	return device_is_ready(spec->dev);
 }
 
+#if defined(CONFIG_ADC_RTIO) || defined(DOXYGEN)
+
+/**
+ * @brief Header of the buffers of ADC RTIO iodevs
+ *
+ * Followed by the samples of each sampling, with a sample of each channel
+ * of the sequence starting from the one with the lowest ID. Samples are 16
+ * bits wide, or 32 bits with resolutions above 16 bits.
+ */
+struct adc_rtio_header {
+	/** Time of the first sampling, in nanoseconds of system uptime */
+	uint64_t timestamp_ns;
+	/** Interval between samplings, in microseconds */
+	uint32_t interval_us;
+	/** Bit-mask of the channels sampled */
+	uint32_t channels;
+	/** Number of samplings in the buffer */
+	uint16_t samplings;
+	/** Resolution of the samples */
+	uint8_t resolution;
+};
+
+/**
+ * @brief Data of an ADC RTIO iodev
+ */
+struct adc_iodev_data {
+	/** ADC device */
+	const struct device *dev;
+	/** Sequence run for each buffer, its buffer is ignored */
+	const struct adc_sequence *sequence;
+};
+
+extern const struct rtio_iodev_api adc_iodev_api;
+
+/**
+ * @brief Define an RTIO iodev reading an ADC
+ *
+ * Each read runs @p seq into a buffer of the memory pool of the RTIO
+ * context, which starts with a struct adc_rtio_header. The samplings of the
+ * sequence, extra_samplings + 1 of them, are done back to back at its
+ * interval, without callback. A multishot read streams buffers until it is
+ * canceled.
+ *
+ * @param name Name of the iodev.
+ * @param node_id Devicetree node identifier of the ADC.
+ * @param seq Pointer to the sequence run for each buffer.
+ */
+#define ADC_IODEV_DEFINE(name, node_id, seq)						\
+	static const struct adc_iodev_data _adc_iodev_data_##name = {			\
+		.dev = DEVICE_DT_GET(node_id),						\
+		.sequence = (seq),							\
+	};										\
+	RTIO_IODEV_DEFINE(name, &adc_iodev_api, (void *)&_adc_iodev_data_##name)
+
+/**
+ * @brief Get the size of the buffers of an ADC RTIO iodev
+ *
+ * @param sequence Sequence of the iodev.
+ *
+ * @return Size of the header and of the samples of all the samplings.
+ */
+static inline size_t adc_rtio_buf_size(const struct adc_sequence *sequence)
+{
+	uint32_t samplings = 1 + ((sequence->options != NULL) ?
+				  sequence->options->extra_samplings : 0);
+	size_t sample_size = (sequence->resolution > 16) ? sizeof(uint32_t) : sizeof(uint16_t);
+
+	return sizeof(struct adc_rtio_header) +
+	       samplings * POPCOUNT(sequence->channels) * sample_size;
+}
+
+#endif /* CONFIG_ADC_RTIO */
+
 /**
  * @}
  */
@@ -1131,6 +1131,13 @@ __syscall int can_send(const struct device *dev, const struct can_frame *frame,
  * @{
  */
 
+/** @cond INTERNAL_HIDDEN */
+/* RX filter manager, see CONFIG_CAN_RX_FILTER_MANAGER */
+int can_rx_filter_manager_add(const struct device *dev, can_rx_callback_t callback,
+			      void *user_data, const struct can_filter *filter);
+void can_rx_filter_manager_remove(const struct device *dev, int filter_id);
+/** @endcond */
+
 /**
  * @brief Add a callback function for a given CAN filter
  *
@@ -1143,6 +1150,9 @@ __syscall int can_send(const struct device *dev, const struct can_frame *frame,
  *
  * The same callback function can be used for multiple filters.
  *
+ * With @kconfig{CONFIG_CAN_RX_FILTER_MANAGER}, filters which do not fit in the
+ * hardware filters of the CAN controller are matched in software instead.
+ *
  * @param dev       Pointer to the device structure for the driver instance.
  * @param callback  This function is called by the CAN controller driver whenever
  *                  a frame matching the filter is received.
@@ -1163,6 +1173,10 @@ static inline int can_add_rx_filter(const struct device *dev, can_rx_callback_t
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_CAN_RX_FILTER_MANAGER)) {
+		return can_rx_filter_manager_add(dev, callback, user_data, filter);
+	}
+
 	return api->add_rx_filter(dev, callback, user_data, filter);
 }
 
@@ -1223,9 +1237,30 @@ static inline void z_impl_can_remove_rx_filter(const struct device *dev, int fil
 {
 	const struct can_driver_api *api = (const struct can_driver_api *)dev->api;
 
+	if (IS_ENABLED(CONFIG_CAN_RX_FILTER_MANAGER)) {
+		can_rx_filter_manager_remove(dev, filter_id);
+		return;
+	}
+
 	return api->remove_rx_filter(dev, filter_id);
 }
 
+/**
+ * @brief Get the number of frames received through a CAN RX filter
+ *
+ * The count wraps around and is only available with
+ * @kconfig{CONFIG_CAN_RX_FILTER_MANAGER}.
+ *
+ * @param dev       Pointer to the device structure for the driver instance.
+ * @param filter_id Filter ID
+ * @param[out] hits Number of frames passed to the filter callback.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if there is no such filter.
+ * @retval -ENOSYS if the RX filter manager is not enabled.
+ */
+__syscall int can_get_rx_filter_hits(const struct device *dev, int filter_id, uint32_t *hits);
+
 /**
  * @brief Get maximum number of RX filters
  *
@@ -703,6 +703,170 @@ static inline uint32_t dma_burst_index(uint32_t burst)
  */
 #define DMA_BUF_ADDR_ALIGNMENT(node) DT_PROP(node, dma_buf_addr_alignment)
 
+#if defined(CONFIG_DMA_RING) || defined(DOXYGEN)
+
+struct dma_ring;
+
+/**
+ * @brief Callback of a DMA ring
+ *
+ * Called from the DMA callback each time the controller is done with a block
+ * of the ring.
+ *
+ * @param ring DMA ring.
+ * @param user_data User data given to dma_ring_start().
+ * @param dma_pos Index in the ring buffer the controller writes, for
+ *                peripheral to memory rings, or reads, for memory to
+ *                peripheral rings, next.
+ * @param status 0 on success, a negative error code of the controller
+ *               otherwise.
+ */
+typedef void (*dma_ring_callback_t)(struct dma_ring *ring, void *user_data,
+				    uint32_t dma_pos, int status);
+
+/**
+ * @brief Configuration of a DMA ring
+ */
+struct dma_ring_config {
+	/** Address of the data register of the peripheral */
+	uint32_t periph_addr;
+	/** Ring buffer */
+	uint8_t *buf;
+	/** Size of the ring buffer, a multiple of the number of blocks */
+	uint32_t size;
+	/** Number of blocks the ring buffer is split into, at least 2 */
+	uint32_t block_count;
+	/** Callback called as each block completes, may be NULL */
+	dma_ring_callback_t callback;
+	/** User data given to the callback */
+	void *user_data;
+};
+
+/**
+ * @brief DMA ring
+ *
+ * Continuous stream between a peripheral and a ring buffer, run by a cyclic
+ * transfer of the blocks of the ring. The fields are private.
+ */
+struct dma_ring {
+	const struct device *dev;
+	uint32_t channel;
+	enum dma_channel_direction dir;
+	struct dma_ring_config cfg;
+	uint32_t block_size;
+	/* Bytes transferred by the controller and by the CPU since the start,
+	 * their difference is the data, or free space, available.
+	 */
+	atomic_t dma_count;
+	uint32_t cpu_count;
+	struct dma_block_config blocks[CONFIG_DMA_RING_MAX_BLOCKS];
+};
+
+/**
+ * @brief Start a DMA ring
+ *
+ * Runs a cyclic transfer of the blocks of the ring buffer, with a callback
+ * at the end of each block. The client sets the direction, either
+ * @ref PERIPHERAL_TO_MEMORY or @ref MEMORY_TO_PERIPHERAL, the slot, data
+ * sizes and burst lengths of @p dma_cfg, the other fields are set by the
+ * ring. A memory to peripheral ring starts with the whole buffer to send.
+ *
+ * @param ring DMA ring.
+ * @param dev DMA controller.
+ * @param channel Channel of the controller.
+ * @param dma_cfg Channel configuration.
+ * @param cfg Ring configuration.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the configuration is invalid.
+ * @retval Negative errno code of the controller otherwise.
+ */
+int dma_ring_start(struct dma_ring *ring, const struct device *dev, uint32_t channel,
+		   struct dma_config *dma_cfg, const struct dma_ring_config *cfg);
+
+/**
+ * @brief Stop a DMA ring
+ *
+ * @param ring DMA ring.
+ *
+ * @retval 0 If successful.
+ * @retval Negative errno code of the controller otherwise.
+ */
+int dma_ring_stop(struct dma_ring *ring);
+
+/**
+ * @brief Get the contiguous data, or free space, of a DMA ring
+ *
+ * For a peripheral to memory ring, this is the data received which the
+ * client has not consumed yet. For a memory to peripheral ring, this is the
+ * space the client can fill with the next data to send.
+ *
+ * @param ring DMA ring.
+ * @param data Set to the start of the data, or free space.
+ *
+ * @return Number of contiguous bytes at @p data.
+ * @retval -EOVERFLOW If the controller overtook the client, received data
+ *         was overwritten or stale data was sent. Call dma_ring_reset() to
+ *         resynchronize.
+ */
+int dma_ring_get(struct dma_ring *ring, uint8_t **data);
+
+/**
+ * @brief Consume data, or commit data to send, of a DMA ring
+ *
+ * @param ring DMA ring.
+ * @param len Number of bytes consumed, or written, after dma_ring_get().
+ */
+void dma_ring_put(struct dma_ring *ring, uint32_t len);
+
+/**
+ * @brief Resynchronize the client with the controller of a DMA ring
+ *
+ * Drops the data received, or to send, after an overflow.
+ *
+ * @param ring DMA ring.
+ */
+void dma_ring_reset(struct dma_ring *ring);
+
+#endif /* CONFIG_DMA_RING */
+
+#if defined(CONFIG_DMA_MEMCPY) || defined(DOXYGEN)
+
+/**
+ * @brief Callback of an asynchronous copy
+ *
+ * @param user_data User data given to dma_memcpy_async().
+ * @param status 0 on success, a negative error code of the controller
+ *               otherwise.
+ */
+typedef void (*dma_memcpy_callback_t)(void *user_data, int status);
+
+/**
+ * @brief Copy memory asynchronously with a DMA controller
+ *
+ * Copies of at least CONFIG_DMA_MEMCPY_THRESHOLD bytes run on a free memory
+ * to memory channel of the controller, requested with
+ * dma_request_channel() and released when the copy completes. Smaller
+ * copies, or copies for which no channel is free, are done with memcpy()
+ * and the callback is called before returning. The data caches are
+ * maintained for both buffers.
+ *
+ * @param dev DMA controller.
+ * @param dst Destination buffer.
+ * @param src Source buffer.
+ * @param len Number of bytes to copy.
+ * @param callback Callback called once the copy is done, in the context of
+ *                 the DMA interrupt.
+ * @param user_data User data given to the callback.
+ *
+ * @retval 0 If the copy is done, or started.
+ * @retval Negative errno code of the controller otherwise.
+ */
+int dma_memcpy_async(const struct device *dev, void *dst, const void *src, size_t len,
+		     dma_memcpy_callback_t callback, void *user_data);
+
+#endif /* CONFIG_DMA_MEMCPY */
+
 /**
  * Get the device tree property describing the buffer size alignment
  *
@@ -26,6 +26,9 @@
 #include <stddef.h>
 #include <sys/types.h>
 #include <zephyr/device.h>
+#ifdef CONFIG_PERF_STATS_FLASH_WRITE
+#include <zephyr/stats/perf_stats.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -208,9 +211,16 @@ static inline int z_impl_flash_write(const struct device *dev, off_t offset,
 	const struct flash_driver_api *api =
 		(const struct flash_driver_api *)dev->api;
 	int rc;
+#ifdef CONFIG_PERF_STATS_FLASH_WRITE
+	uint32_t start = perf_stats_start();
+#endif
 
 	rc = api->write(dev, offset, data, len);
 
+#ifdef CONFIG_PERF_STATS_FLASH_WRITE
+	perf_stats_stop(PERF_STATS_HIST(flash_write), start);
+#endif
+
 	return rc;
 }
 
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ZEPHYR_INCLUDE_DRIVERS_FLASH_FLASH_CACHE_H__
+#define __ZEPHYR_INCLUDE_DRIVERS_FLASH_FLASH_CACHE_H__
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief Flash cache specific API.
+ *
+ * Extension for the "zephyr,flash-cache" devices, which cache the pages of
+ * another flash device in RAM.
+ */
+
+/**
+ * @brief Write the data held by the cache to the flash.
+ *
+ * With the "write-back" property, the data written to the cache device is
+ * only written to the flash when its cache page is reused, when the writes
+ * to the page are not contiguous, when a full cache page is written, or by
+ * this function. It must be called when the data must survive a reset or a
+ * power loss.
+ *
+ * @param dev flash cache device.
+ *
+ * @return 0 on success, negative errno code on failure of the flash write.
+ */
+int flash_cache_flush(const struct device *dev);
+
+/**
+ * @brief Flush and drop the content of the cache.
+ *
+ * Must be called when the flash is changed other than through the cache
+ * device.
+ *
+ * @param dev flash cache device.
+ *
+ * @return 0 on success, negative errno code on failure of the flash write.
+ */
+int flash_cache_invalidate(const struct device *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ZEPHYR_INCLUDE_DRIVERS_FLASH_FLASH_CACHE_H__ */
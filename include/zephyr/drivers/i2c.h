@@ -964,6 +964,18 @@ static inline int i2c_transfer_signal(const struct device *dev,
 
 #if defined(CONFIG_I2C_RTIO) || defined(DOXYGEN)
 
+/**
+ * @brief Fallback to submit request(s) to an I2C device without RTIO support
+ *
+ * Runs the transaction with i2c_transfer() in the RTIO work queue, see
+ * CONFIG_I2C_RTIO_FALLBACK_MSGS.
+ *
+ * @param dev I2C controller
+ * @param iodev_sqe Prepared submissions queue entry connected to an iodev
+ *                  defined by I2C_DT_IODEV_DEFINE.
+ */
+void i2c_iodev_submit_fallback(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe);
+
 /**
  * @brief Submit request(s) to an I2C device with RTIO
  *
@@ -972,10 +984,15 @@ static inline int i2c_transfer_signal(const struct device *dev,
  */
 static inline void i2c_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
 {
-	const struct i2c_dt_spec *dt_spec = iodev_sqe->sqe->iodev->data;
+	const struct i2c_dt_spec *dt_spec = iodev_sqe->sqe.iodev->data;
 	const struct device *dev = dt_spec->bus;
 	const struct i2c_driver_api *api = (const struct i2c_driver_api *)dev->api;
 
+	if (api->iodev_submit == NULL) {
+		i2c_iodev_submit_fallback(dev, iodev_sqe);
+		return;
+	}
+
 	api->iodev_submit(dt_spec->bus, iodev_sqe);
 }
 
@@ -23,6 +23,8 @@
  * @{
  */
 
+#include <errno.h>
+
 #include <zephyr/types.h>
 #include <zephyr/device.h>
 
@@ -309,6 +311,48 @@ struct i2s_config {
 	int32_t timeout;
 };
 
+/**
+ * @brief Period elapsed callback of a ring buffer stream
+ *
+ * Called from interrupt context each time the DMA is done with a period
+ * of the ring. For RX the period holds the samples just received, for TX
+ * it was just sent and can be refilled. Either way the period must be
+ * handled before the DMA comes back to it, one ring later.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction, I2S_DIR_RX or I2S_DIR_TX.
+ * @param period Period of the ring that elapsed, or NULL if the stream
+ *        stopped on an error and is in the ERROR state.
+ * @param size Size of the period in bytes.
+ * @param user_data User data given in the ring configuration.
+ */
+typedef void (*i2s_period_callback_t)(const struct device *dev, enum i2s_dir dir,
+				      void *period, size_t size, void *user_data);
+
+/**
+ * @brief Ring buffer stream configuration
+ *
+ * The ring is owned by the application, which reads from or writes to
+ * its periods in place. On cores with a data cache, the ring should be
+ * placed in non-cacheable memory, or TX periods written outside of the
+ * callback flushed from the cache by the application.
+ *
+ * @param buf Ring of @p periods periods, aligned as required by the DMA.
+ * @param period_size Size of a period in bytes, a multiple of the frame
+ *        size. Sets the latency: the application is notified once per
+ *        period.
+ * @param periods Number of periods in the ring.
+ * @param callback Called each time a period elapsed.
+ * @param user_data Passed to @p callback.
+ */
+struct i2s_ring_config {
+	void *buf;
+	size_t period_size;
+	uint8_t periods;
+	i2s_period_callback_t callback;
+	void *user_data;
+};
+
 /**
  * @cond INTERNAL_HIDDEN
  *
@@ -323,6 +367,11 @@ __subsystem struct i2s_driver_api {
 	int (*write)(const struct device *dev, void *mem_block, size_t size);
 	int (*trigger)(const struct device *dev, enum i2s_dir dir,
 		       enum i2s_trigger_cmd cmd);
+#ifdef CONFIG_I2S_RING
+	int (*ring_start)(const struct device *dev, enum i2s_dir dir,
+			  const struct i2s_ring_config *ring);
+	int (*ring_stop)(const struct device *dev, enum i2s_dir dir);
+#endif
 };
 /**
  * @endcond
@@ -532,6 +581,72 @@ static inline int z_impl_i2s_trigger(const struct device *dev,
 	return api->trigger(dev, dir, cmd);
 }
 
+#if defined(CONFIG_I2S_RING) || defined(__DOXYGEN__)
+/**
+ * @brief Start a ring buffer stream.
+ *
+ * Instead of queuing memory blocks, the DMA continuously cycles through
+ * the ring and the callback of @p ring is called each time a period
+ * elapsed, without any block to allocate, queue or free. The latency is
+ * bounded by the period size. The stream must have been configured with
+ * i2s_configure(), its mem_slab, block_size and timeout being ignored.
+ *
+ * For TX the ring should be filled before the stream is started. The
+ * stream runs until stopped with i2s_ring_stop(), the trigger commands
+ * being rejected meanwhile.
+ *
+ * This function is not available to user mode threads.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction, I2S_DIR_RX or I2S_DIR_TX.
+ * @param ring Ring configuration, copied by the driver.
+ *
+ * @retval 0 If successful, the stream is in RUNNING state.
+ * @retval -EINVAL Invalid argument.
+ * @retval -EIO The stream is not in READY state.
+ * @retval -ENOTSUP The ring geometry is not supported by the driver.
+ * @retval -ENOSYS The driver does not support ring buffer streams.
+ */
+static inline int i2s_ring_start(const struct device *dev, enum i2s_dir dir,
+				 const struct i2s_ring_config *ring)
+{
+	const struct i2s_driver_api *api =
+		(const struct i2s_driver_api *)dev->api;
+
+	if (api->ring_start == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->ring_start(dev, dir, ring);
+}
+
+/**
+ * @brief Stop a ring buffer stream.
+ *
+ * The transfer stops immediately and the stream goes back to READY
+ * state, including from the ERROR state.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param dir Stream direction, I2S_DIR_RX or I2S_DIR_TX.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL Invalid argument.
+ * @retval -EIO No ring buffer stream was started.
+ * @retval -ENOSYS The driver does not support ring buffer streams.
+ */
+static inline int i2s_ring_stop(const struct device *dev, enum i2s_dir dir)
+{
+	const struct i2s_driver_api *api =
+		(const struct i2s_driver_api *)dev->api;
+
+	if (api->ring_stop == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->ring_stop(dev, dir);
+}
+#endif /* CONFIG_I2S_RING */
+
 /**
  * @}
  */
@@ -246,6 +246,12 @@ enum sensor_trigger_type {
 
 	/** Trigger fires when no motion has been detected for a while. */
 	SENSOR_TRIG_STATIONARY,
+
+	/** Trigger fires when the FIFO watermark has been reached. */
+	SENSOR_TRIG_FIFO_WATERMARK,
+
+	/** Trigger fires when the FIFO becomes full. */
+	SENSOR_TRIG_FIFO_FULL,
 	/**
 	 * Number of all common sensor triggers.
 	 */
@@ -500,6 +506,37 @@ struct sensor_decoder_api {
 	int (*decode)(const uint8_t *buffer, sensor_frame_iterator_t *fit,
 		      sensor_channel_iterator_t *cit, enum sensor_channel *channels, q31_t *values,
 		      uint8_t max_count);
+
+	/**
+	 * @brief Check if the given trigger type is present
+	 *
+	 * Optional, only used for buffers produced by :c:func:`sensor_stream`.
+	 *
+	 * @param[in] buffer The buffer provided on the :c:struct:`rtio` context
+	 * @param[in] trigger The trigger type in question
+	 * @return Whether the trigger is present in the buffer
+	 */
+	bool (*has_trigger)(const uint8_t *buffer, enum sensor_trigger_type trigger);
+
+	/**
+	 * @brief Decode a single channel of consecutive frames
+	 *
+	 * Optional, :c:func:`sensor_decode_channel` falls back to @ref decode when not set. The
+	 * values of the channel are written contiguously, one per frame, so that buffers holding
+	 * many frames are decoded in one call, straight into arrays usable with the DSP
+	 * functions. Decoding stops before the first frame which does not hold @p channel.
+	 *
+	 * @param[in]     buffer The buffer provided on the :c:struct:`rtio` context
+	 * @param[in]     channel The single axis channel to decode
+	 * @param[in,out] fit The current frame iterator, moved past the decoded frames
+	 * @param[in]     max_count The maximum number of frames to decode
+	 * @param[out]    values The scaled data that was decoded, @p max_count long
+	 * @return Number of decoded frames, 0 if there are no more frames
+	 * @return -ENODATA if the current frame does not hold @p channel
+	 * @return <0 on error
+	 */
+	int (*decode_channel)(const uint8_t *buffer, enum sensor_channel channel,
+			      sensor_frame_iterator_t *fit, uint16_t max_count, q31_t *values);
 };
 
 /**
@@ -511,13 +548,37 @@ struct sensor_decoder_api {
 typedef int (*sensor_get_decoder_t)(const struct device *dev,
 				    const struct sensor_decoder_api **api);
 
+/**
+ * @brief Options for what to do with the associated data when a trigger is consumed
+ */
+enum sensor_stream_data_opt {
+	/** @brief Include whatever data is associated with the trigger */
+	SENSOR_STREAM_DATA_INCLUDE = 0,
+	/** @brief Do nothing with the associated trigger data, it may be consumed later */
+	SENSOR_STREAM_DATA_NOP = 1,
+	/** @brief Flush/clear whatever data is associated with the trigger */
+	SENSOR_STREAM_DATA_DROP = 2,
+};
+
+/**
+ * @brief Trigger of a streaming sensor iodev and what to do with its data
+ */
+struct sensor_stream_trigger {
+	enum sensor_trigger_type trigger;
+	enum sensor_stream_data_opt opt;
+};
+
 /*
  * Internal data structure used to store information about the IODevice for async reading and
  * streaming sensor data.
  */
 struct sensor_read_config {
 	const struct device *sensor;
-	enum sensor_channel *const channels;
+	const bool is_streaming;
+	union {
+		enum sensor_channel *const channels;
+		struct sensor_stream_trigger *const triggers;
+	};
 	size_t count;
 	const size_t max;
 };
@@ -540,12 +601,44 @@ struct sensor_read_config {
 	static enum sensor_channel __channel_array_##name[] = {__VA_ARGS__};                       \
 	static struct sensor_read_config __sensor_read_config_##name = {                           \
 		.sensor = DEVICE_DT_GET(dt_node),                                                  \
+		.is_streaming = false,                                                             \
 		.channels = __channel_array_##name,                                                \
 		.count = ARRAY_SIZE(__channel_array_##name),                                       \
 		.max = ARRAY_SIZE(__channel_array_##name),                                         \
 	};                                                                                         \
 	RTIO_IODEV_DEFINE(name, &__sensor_iodev_api, &__sensor_read_config_##name)
 
+/**
+ * @brief Define a stream instance of a sensor
+ *
+ * Use this macro to generate a :c:struct:`rtio_iodev` for starting a stream that's triggered by
+ * specific interrupts. Each completion of the stream carries the data associated with the
+ * triggers that fired, e.g. the content of the FIFO when its watermark is reached. Example:
+ *
+ * @code(.c)
+ * SENSOR_DT_STREAM_IODEV(icm42688_stream, DT_NODELABEL(icm42688),
+ *     {SENSOR_TRIG_FIFO_FULL, SENSOR_STREAM_DATA_INCLUDE},
+ *     {SENSOR_TRIG_FIFO_WATERMARK, SENSOR_STREAM_DATA_INCLUDE});
+ *
+ * int main(void) {
+ *   struct rtio_sqe *handle;
+ *   sensor_stream(&icm42688_stream, &rtio, NULL, &handle);
+ *   k_msleep(1000);
+ *   rtio_sqe_cancel(handle);
+ * }
+ * @endcode
+ */
+#define SENSOR_DT_STREAM_IODEV(name, dt_node, ...)                                                 \
+	static struct sensor_stream_trigger __trigger_array_##name[] = {__VA_ARGS__};              \
+	static struct sensor_read_config __sensor_read_config_##name = {                           \
+		.sensor = DEVICE_DT_GET(dt_node),                                                  \
+		.is_streaming = true,                                                              \
+		.triggers = __trigger_array_##name,                                                \
+		.count = ARRAY_SIZE(__trigger_array_##name),                                       \
+		.max = ARRAY_SIZE(__trigger_array_##name),                                         \
+	};                                                                                         \
+	RTIO_IODEV_DEFINE(name, &__sensor_iodev_api, &__sensor_read_config_##name)
+
 /* Used to submit an RTIO sqe to the sensor's iodev */
 typedef int (*sensor_submit_t)(const struct device *sensor, struct rtio_iodev_sqe *sqe);
 
@@ -894,6 +987,45 @@ static inline int sensor_read(struct rtio_iodev *iodev, struct rtio *ctx, void *
 	return 0;
 }
 
+/**
+ * @brief Start streaming data from a sensor.
+ *
+ * Using the triggers of @p iodev, submit a multishot read to @p ctx. Each time one of the triggers
+ * fires, a completion is generated with a buffer taken from the RTIO's internal mempool. For FIFO
+ * triggers, the buffer holds all the frames drained from the FIFO, which can be iterated with the
+ * sensor's decoder. The stream runs until it is canceled with :c:func:`rtio_sqe_cancel` on
+ * @p handle.
+ *
+ * @param[in]  iodev The iodev created by :c:macro:`SENSOR_DT_STREAM_IODEV`
+ * @param[in]  ctx The RTIO context to service the stream
+ * @param[in]  userdata Optional userdata that will be available with each completion
+ * @param[out] handle Optional handle of the submission, used to cancel the stream
+ * @return 0 on success
+ * @return < 0 on error
+ */
+static inline int sensor_stream(struct rtio_iodev *iodev, struct rtio *ctx, void *userdata,
+				struct rtio_sqe **handle)
+{
+	if (IS_ENABLED(CONFIG_USERSPACE)) {
+		struct rtio_sqe sqe;
+
+		rtio_sqe_prep_read_multishot(&sqe, iodev, RTIO_PRIO_NORM, userdata);
+		rtio_sqe_copy_in_get_handles(ctx, &sqe, handle, 1);
+	} else {
+		struct rtio_sqe *sqe = rtio_sqe_acquire(ctx);
+
+		if (sqe == NULL) {
+			return -ENOMEM;
+		}
+		if (handle != NULL) {
+			*handle = sqe;
+		}
+		rtio_sqe_prep_read_multishot(sqe, iodev, RTIO_PRIO_NORM, userdata);
+	}
+	rtio_submit(ctx, 0);
+	return 0;
+}
+
 /**
  * @typedef sensor_processing_callback_t
  * @brief Callback function used with the helper processing function.
@@ -921,6 +1053,29 @@ typedef void (*sensor_processing_callback_t)(int result, uint8_t *buf, uint32_t
  */
 void sensor_processing_with_callback(struct rtio *ctx, sensor_processing_callback_t cb);
 
+/**
+ * @brief Decode a single channel of consecutive frames into an array
+ *
+ * Gives the values of @p channel for up to @p max_count frames, starting at @p fit, as one
+ * contiguous array. Calling it for each channel of interest turns a buffer holding many frames,
+ * such as the content of a FIFO, into one array per channel which can be processed with the DSP
+ * functions. All the values share the shift given by the decoder's get_shift. Decoders without
+ * a batch implementation are iterated frame by frame with their decode function.
+ *
+ * @param[in]     decoder The decoder of the sensor which produced @p buffer
+ * @param[in]     buffer The buffer provided on the :c:struct:`rtio` context
+ * @param[in]     channel The single axis channel to decode
+ * @param[in,out] fit The current frame iterator, moved past the decoded frames
+ * @param[in]     max_count The maximum number of frames to decode
+ * @param[out]    values The decoded values, one per frame
+ * @return Number of decoded frames, 0 if there are no more frames
+ * @return -ENODATA if the current frame does not hold @p channel
+ * @return < 0 on error
+ */
+int sensor_decode_channel(const struct sensor_decoder_api *decoder, const uint8_t *buffer,
+			  enum sensor_channel channel, sensor_frame_iterator_t *fit,
+			  uint16_t max_count, q31_t *values);
+
 #endif /* defined(CONFIG_SENSOR_ASYNC_API) || defined(__DOXYGEN__) */
 
 /**
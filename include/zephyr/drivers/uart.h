@@ -25,6 +25,10 @@
 
 #include <zephyr/device.h>
 
+#ifdef CONFIG_UART_RTIO
+#include <zephyr/rtio/rtio.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -1665,6 +1669,72 @@ static inline int z_impl_uart_drv_cmd(const struct device *dev, uint32_t cmd,
 #endif
 }
 
+#if defined(CONFIG_UART_RTIO) || defined(DOXYGEN)
+
+/**
+ * @brief Data of a UART RTIO iodev
+ *
+ * Defined with UART_DT_IODEV_DEFINE, the fields are private.
+ */
+struct uart_rtio_data {
+	const struct device *dev;
+	int32_t rx_timeout;
+	struct k_spinlock lock;
+	atomic_t cb_set;
+	/* Read request which the received data completes */
+	struct rtio_iodev_sqe *rx_sqe;
+	/* Buffer being filled by the driver */
+	struct rtio *rx_ctx;
+	uint8_t *rx_buf;
+	uint32_t rx_buf_len;
+	uint32_t rx_len;
+	/* Buffer given to the driver after the current one */
+	struct rtio *rx_next_ctx;
+	uint8_t *rx_next;
+	uint32_t rx_next_len;
+	bool rx_enabled;
+	bool rx_stopping;
+	/* Write requests */
+	struct rtio_mpsc tx_q;
+	struct rtio_iodev_sqe *tx_sqe;
+};
+
+extern const struct rtio_iodev_api uart_iodev_api;
+
+/**
+ * @brief Define an iodev for a UART
+ *
+ * The iodev uses the asynchronous API of the UART, whose callback must not be
+ * set by anything else.
+ *
+ * Write requests (RTIO_OP_TX and RTIO_OP_TINY_TX) are sent one after another.
+ *
+ * A single read request is handled at a time, its buffer must be allocated
+ * from the memory pool of the RTIO context, see rtio_sqe_prep_read_with_pool()
+ * and rtio_sqe_prep_read_multishot(). The data is received in place, in
+ * buffers of up to CONFIG_UART_RTIO_RX_BUF_SIZE bytes, and a request is
+ * completed with each buffer holding data, with the number of received bytes
+ * as the result. A multishot request keeps the receiver enabled, for the next
+ * buffers to be given to the driver without any gap.
+ *
+ * @param name Name of the iodev.
+ * @param node_id Devicetree node identifier of the UART.
+ * @param rx_timeout_ Time in microseconds after which a buffer that is not
+ *        full is completed if no more data is received, or SYS_FOREVER_US
+ *        to complete full buffers only. The receiver is restarted to get the
+ *        partially filled buffer back, data received while it is restarted
+ *        may be lost if the UART does not buffer it.
+ */
+#define UART_DT_IODEV_DEFINE(name, node_id, rx_timeout_)				\
+	static struct uart_rtio_data _uart_rtio_data_##name = {			\
+		.dev = DEVICE_DT_GET(node_id),						\
+		.rx_timeout = (rx_timeout_),						\
+		.tx_q = RTIO_MPSC_INIT((_uart_rtio_data_##name.tx_q)),			\
+	};										\
+	RTIO_IODEV_DEFINE(name, &uart_iodev_api, &_uart_rtio_data_##name)
+
+#endif /* CONFIG_UART_RTIO */
+
 #ifdef __cplusplus
 }
 #endif
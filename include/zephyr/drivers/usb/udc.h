@@ -632,7 +632,11 @@ int udc_ep_buf_free(const struct device *dev, struct net_buf *const buf);
 /**
  * @brief Set ZLP flag in requests metadata.
  *
- * The controller should send a ZLP at the end of the transfer.
+ * The controller should send a ZLP at the end of the transfer. The flag
+ * is cleared when the buffer is enqueued unless the transfer length is
+ * a multiple of the endpoint maximum packet size, so that it can be set
+ * for every transfer which may need to be terminated, without the caller
+ * knowing the maximum packet size of the current bus speed.
  *
  * @param[in] buf    Pointer to UDC request buffer
  */
@@ -94,6 +94,18 @@ struct video_caps {
 	uint8_t min_vbuf_count;
 };
 
+/**
+ * @brief video_endpoint_id enum
+ *
+ * Identify the video device endpoint.
+ */
+enum video_endpoint_id {
+	VIDEO_EP_NONE,
+	VIDEO_EP_ANY,
+	VIDEO_EP_IN,
+	VIDEO_EP_OUT,
+};
+
 /**
  * @struct video_buffer
  * @brief Video buffer structure
@@ -114,18 +126,14 @@ struct video_buffer {
 	 * endpoints.
 	 */
 	uint32_t timestamp;
-};
-
-/**
- * @brief video_endpoint_id enum
- *
- * Identify the video device endpoint.
- */
-enum video_endpoint_id {
-	VIDEO_EP_NONE,
-	VIDEO_EP_ANY,
-	VIDEO_EP_IN,
-	VIDEO_EP_OUT,
+#ifdef CONFIG_VIDEO_BUFFER_REF
+	/** number of references, see video_buffer_hold(). */
+	atomic_t ref;
+	/** device the buffer is enqueued to on its last release. */
+	const struct device *dev;
+	/** endpoint the buffer is enqueued to on its last release. */
+	enum video_endpoint_id ep;
+#endif
 };
 
 /**
@@ -574,6 +582,65 @@ struct video_buffer *video_buffer_alloc(size_t size);
  */
 void video_buffer_release(struct video_buffer *buf);
 
+#if defined(CONFIG_VIDEO_BUFFER_REF) || defined(__DOXYGEN__)
+/**
+ * @brief Hold a dequeued video buffer.
+ *
+ * Take the first reference to a buffer dequeued from @p ep of @p dev. The
+ * buffer can then be shared with video_buffer_ref(), for instance with an
+ * encoder and the network stack, without copying it. It is enqueued back to
+ * @p ep of @p dev when the last reference is released with
+ * video_buffer_unref().
+ *
+ * @param buf Pointer to the video buffer.
+ * @param dev Pointer to the device structure the buffer returns to.
+ * @param ep Endpoint ID the buffer returns to.
+ */
+void video_buffer_hold(struct video_buffer *buf, const struct device *dev,
+		       enum video_endpoint_id ep);
+
+/**
+ * @brief Take a reference to a held video buffer.
+ *
+ * @param buf Pointer to the video buffer.
+ */
+void video_buffer_ref(struct video_buffer *buf);
+
+/**
+ * @brief Release a reference to a held video buffer.
+ *
+ * The buffer is enqueued back to its endpoint when the last reference is
+ * released, in the context of the caller, which may be an interrupt.
+ *
+ * @param buf Pointer to the video buffer.
+ *
+ * @retval 0 Is successful.
+ * @retval <0 Error enqueuing the buffer, see video_enqueue().
+ */
+int video_buffer_unref(struct video_buffer *buf);
+#endif
+
+#if defined(CONFIG_VIDEO_BUFFER_NET_BUF) || defined(__DOXYGEN__)
+struct net_buf;
+
+/**
+ * @brief Wrap the data of a held video buffer in network buffers.
+ *
+ * The network buffers point to the data of the video buffer, which is not
+ * copied. A buffer chain is returned for frames larger than a network
+ * buffer can hold. Each network buffer holds a reference to the video
+ * buffer, which is released when the network buffer is freed.
+ *
+ * @param buf Pointer to a video buffer held with video_buffer_hold().
+ * @param timeout Timeout to wait for free network buffers.
+ *
+ * @retval pointer to the first network buffer of the chain
+ * @retval NULL if no network buffers are available
+ */
+struct net_buf *video_buffer_net_buf(struct video_buffer *buf,
+				     k_timeout_t timeout);
+#endif
+
 
 /* fourcc - four-character-code */
 #define video_fourcc(a, b, c, d)\
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/pipeline.h
+ *
+ * @brief Public APIs for DSP streaming pipelines
+ */
+
+#ifndef INCLUDE_ZEPHYR_DSP_PIPELINE_H_
+#define INCLUDE_ZEPHYR_DSP_PIPELINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/dsp/types.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/util.h>
+
+#ifdef CONFIG_DSP_PIPELINE_CMSIS
+/* Must come before arm_math.h, see zdsp_backend.h */
+#include <zephyr/kernel.h>
+#include <arm_math.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_pipeline Streaming Pipelines
+ *
+ * A pipeline runs blocks of Q15 samples through a chain of stages
+ * (filters, decimators, transforms, measurements). The blocks are
+ * processed where they are, typically in buffers handed out by an I2S
+ * or ADC driver, stages that cannot work in place alternating between
+ * the block and a single scratch buffer of the pipeline. The time each
+ * stage takes can be accounted in cycles with
+ * @kconfig{CONFIG_DSP_PIPELINE_STATS}, to budget the CPU per stage.
+ *
+ * A pipeline and its stages do no locking, a pipeline must be used from
+ * a single thread at a time.
+ * @{
+ */
+
+struct zdsp_stage;
+
+/**
+ * @brief Process a block of samples
+ *
+ * @param stage Stage
+ * @param in Samples to process, may be modified
+ * @param out Buffer receiving the output. Equal to @p in for stages
+ *        flagged @ref ZDSP_STAGE_IN_PLACE and NULL for stages flagged
+ *        @ref ZDSP_STAGE_TAP.
+ * @param len Number of samples in @p in, updated to the number of
+ *        samples written to @p out. An output never has more samples
+ *        than its input.
+ * @return 0 on success, negative errno otherwise
+ */
+typedef int (*zdsp_stage_process_t)(struct zdsp_stage *stage, q15_t *in, q15_t *out,
+				    size_t *len);
+
+/** @brief The stage can write its output over its input */
+#define ZDSP_STAGE_IN_PLACE BIT(0)
+
+/** @brief The stage only reads its input, which is passed on unchanged */
+#define ZDSP_STAGE_TAP BIT(1)
+
+/**
+ * @brief Processing time spent by a stage
+ */
+struct zdsp_stage_stats {
+	/** Number of blocks processed */
+	uint32_t blocks;
+	/** Number of input samples processed */
+	uint32_t samples;
+	/** Total cycles spent processing */
+	uint64_t cycles;
+	/** Most cycles spent on a single block */
+	uint32_t max_cycles;
+};
+
+/**
+ * @brief Pipeline stage
+ *
+ * Usually embedded in the state of a specific stage, as done by
+ * the stages below.
+ */
+struct zdsp_stage {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	/** @endcond */
+	/** Processing function */
+	zdsp_stage_process_t process;
+	/** Name, for reporting */
+	const char *name;
+	/** ZDSP_STAGE_* flags */
+	uint32_t flags;
+#if defined(CONFIG_DSP_PIPELINE_STATS) || defined(__DOXYGEN__)
+	/** Processing time, see zdsp_stage_stats_get() */
+	struct zdsp_stage_stats stats;
+#endif
+};
+
+/**
+ * @brief Pipeline of stages
+ */
+struct zdsp_pipeline {
+	/** @cond INTERNAL_HIDDEN */
+	sys_slist_t stages;
+	q15_t *scratch;
+	size_t scratch_len;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a stage
+ *
+ * Used to implement custom stages.
+ *
+ * @param stage Stage to initialize
+ * @param name Name of the stage
+ * @param process Processing function
+ * @param flags ZDSP_STAGE_* flags
+ */
+void zdsp_stage_init(struct zdsp_stage *stage, const char *name,
+		     zdsp_stage_process_t process, uint32_t flags);
+
+/**
+ * @brief Initialize a pipeline
+ *
+ * @param pipeline Pipeline to initialize
+ * @param scratch Buffer used by the stages that do not work in place,
+ *        or NULL if all stages do
+ * @param scratch_len Number of samples @p scratch holds, at least the
+ *        largest block passed to such a stage
+ */
+void zdsp_pipeline_init(struct zdsp_pipeline *pipeline, q15_t *scratch,
+			size_t scratch_len);
+
+/**
+ * @brief Append a stage to a pipeline
+ *
+ * @param pipeline Pipeline
+ * @param stage Stage to run after the stages already added
+ */
+void zdsp_pipeline_add(struct zdsp_pipeline *pipeline, struct zdsp_stage *stage);
+
+/**
+ * @brief Run a block of samples through a pipeline
+ *
+ * The output ends up either in @p data or in the scratch buffer of the
+ * pipeline, and stays valid until the next call.
+ *
+ * @param pipeline Pipeline
+ * @param data Samples to process, modified by the stages
+ * @param len Number of samples in @p data, updated to the number of
+ *        output samples
+ * @param out Set to the output samples
+ * @retval 0 on success
+ * @retval -ENOMEM the scratch buffer is too small for the block
+ * @return other negative errno returned by a stage, which stops
+ *         the processing of the block
+ */
+int zdsp_pipeline_process(struct zdsp_pipeline *pipeline, q15_t *data, size_t *len,
+			  q15_t **out);
+
+#if defined(CONFIG_DSP_PIPELINE_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the processing time spent by a stage
+ *
+ * @param stage Stage
+ * @param stats Filled with the processing time since the stage was
+ *        initialized or its statistics reset
+ */
+void zdsp_stage_stats_get(const struct zdsp_stage *stage, struct zdsp_stage_stats *stats);
+
+/**
+ * @brief Reset the processing time accounted to a stage
+ *
+ * @param stage Stage
+ */
+void zdsp_stage_stats_reset(struct zdsp_stage *stage);
+#endif /* CONFIG_DSP_PIPELINE_STATS */
+
+#if defined(CONFIG_DSP_PIPELINE_CMSIS) || defined(__DOXYGEN__)
+
+/**
+ * @brief FIR filter stage
+ */
+struct zdsp_fir_q15 {
+	/** Stage to add to a pipeline */
+	struct zdsp_stage stage;
+	/** @cond INTERNAL_HIDDEN */
+	arm_fir_instance_q15 inst;
+	uint32_t block_size;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a FIR filter stage
+ *
+ * @param fir Stage to initialize
+ * @param coeffs @p num_taps coefficients in time reversed order
+ * @param num_taps Number of coefficients, even and at least 4
+ * @param state Buffer of @p num_taps + @p block_size - 1 samples
+ * @param block_size Largest block the stage processes
+ * @retval 0 on success
+ * @retval -EINVAL invalid number of coefficients
+ */
+int zdsp_fir_q15_init(struct zdsp_fir_q15 *fir, const q15_t *coeffs, uint16_t num_taps,
+		      q15_t *state, uint32_t block_size);
+
+/**
+ * @brief Biquad cascade filter stage, in direct form I
+ */
+struct zdsp_biquad_q15 {
+	/** Stage to add to a pipeline */
+	struct zdsp_stage stage;
+	/** @cond INTERNAL_HIDDEN */
+	arm_biquad_casd_df1_inst_q15 inst;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a biquad cascade filter stage
+ *
+ * @param biquad Stage to initialize
+ * @param num_stages Number of second order sections
+ * @param coeffs 6 coefficients per section: b0, 0, b1, b2, a1, a2
+ * @param state Buffer of 4 samples per section
+ * @param post_shift Shift applied to the output of each section
+ */
+void zdsp_biquad_q15_init(struct zdsp_biquad_q15 *biquad, uint8_t num_stages,
+			  const q15_t *coeffs, q15_t *state, int8_t post_shift);
+
+/**
+ * @brief FIR decimator stage
+ */
+struct zdsp_decimate_q15 {
+	/** Stage to add to a pipeline */
+	struct zdsp_stage stage;
+	/** @cond INTERNAL_HIDDEN */
+	arm_fir_decimate_instance_q15 inst;
+	uint32_t block_size;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a FIR decimator stage
+ *
+ * Blocks are filtered and only one sample out of @p factor is kept.
+ *
+ * @param decimate Stage to initialize
+ * @param coeffs @p num_taps coefficients of the anti-aliasing filter in
+ *        time reversed order
+ * @param num_taps Number of coefficients
+ * @param factor Decimation factor, which divides the size of all blocks
+ * @param state Buffer of @p num_taps + @p block_size - 1 samples
+ * @param block_size Largest block the stage processes
+ * @retval 0 on success
+ * @retval -EINVAL @p block_size is not a multiple of @p factor
+ */
+int zdsp_decimate_q15_init(struct zdsp_decimate_q15 *decimate, const q15_t *coeffs,
+			   uint16_t num_taps, uint8_t factor, q15_t *state,
+			   uint32_t block_size);
+
+/**
+ * @brief RMS measurement stage
+ *
+ * Passes the samples on unchanged.
+ */
+struct zdsp_rms_q15 {
+	/** Stage to add to a pipeline */
+	struct zdsp_stage stage;
+	/** Root mean square of the last block */
+	q15_t rms;
+};
+
+/**
+ * @brief Initialize a RMS measurement stage
+ *
+ * @param rms Stage to initialize
+ */
+void zdsp_rms_q15_init(struct zdsp_rms_q15 *rms);
+
+/**
+ * @brief FFT magnitude stage
+ *
+ * Replaces a block of @p fft_len samples by the magnitudes of the first
+ * @p fft_len / 2 bins of its real FFT, scaled as by arm_rfft_q15() and
+ * arm_cmplx_mag_q15().
+ */
+struct zdsp_fft_q15 {
+	/** Stage to add to a pipeline */
+	struct zdsp_stage stage;
+	/** @cond INTERNAL_HIDDEN */
+	arm_rfft_instance_q15 inst;
+	q15_t *buf;
+	uint32_t fft_len;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a FFT magnitude stage
+ *
+ * The CMSIS-DSP tables for @p fft_len must be enabled.
+ *
+ * @param fft Stage to initialize
+ * @param fft_len Number of samples per block, a power of two from 32
+ *        to 8192
+ * @param buf Buffer of 2 * @p fft_len samples
+ * @retval 0 on success
+ * @retval -EINVAL unsupported FFT length
+ */
+int zdsp_fft_q15_init(struct zdsp_fft_q15 *fft, uint32_t fft_len, q15_t *buf);
+
+#endif /* CONFIG_DSP_PIPELINE_CMSIS */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_ZEPHYR_DSP_PIPELINE_H_ */
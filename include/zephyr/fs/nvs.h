@@ -60,6 +60,26 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_LOOKUP_INDEX
+	/** ID of each entry of the lookup cache */
+	uint16_t lookup_ids[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	/** Flag indicating that some IDs did not fit in the lookup cache */
+	bool lookup_overflow;
+#endif
+#if CONFIG_NVS_GC_BACKGROUND
+	/** Background garbage collection work */
+	struct k_work gc_work;
+	/** Address of the next page to erase in the garbage collected sector */
+	uint32_t gc_erase_addr;
+	/** Number of bytes left to erase in the garbage collected sector */
+	uint32_t gc_erase_len;
+	/** Flash page size */
+	size_t gc_page_size;
+	/** Sector left with too little free space by the last background
+	 * garbage collection
+	 */
+	uint32_t gc_full_sector;
+#endif
 };
 
 /**
@@ -194,6 +194,32 @@ struct init_entry {
 			.dev = NULL,                                           \
 	}
 
+/**
+ * @brief Time spent in an init entry during boot
+ *
+ * @see sys_init_profile_get()
+ */
+struct init_profile_record {
+	/** Init entry, NULL if it was not run. */
+	const struct init_entry *entry;
+	/** Duration of the entry, in cycles of the timing functions. */
+	uint64_t cycles;
+};
+
+/**
+ * @brief Get the boot time profile of the init entries
+ *
+ * The records are in the order of the init entries, the time spent in each
+ * of them is measured with the timing functions when
+ * CONFIG_INIT_PROFILING is enabled. Entries run before the timing
+ * counter of the platform is started may report 0 cycles.
+ *
+ * @param records Set to the records.
+ *
+ * @return Number of records.
+ */
+size_t sys_init_profile_get(const struct init_profile_record **records);
+
 /** @} */
 
 #ifdef __cplusplus
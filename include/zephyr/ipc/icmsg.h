@@ -59,6 +59,9 @@ struct icmsg_data_t {
 	struct k_work_delayable notify_work;
 	struct k_work mbox_work;
 	atomic_t state;
+#if CONFIG_IPC_SERVICE_ICMSG_RX_POLL_US > 0
+	struct k_work_delayable poll_work;
+#endif
 	/* No-copy */
 #ifdef CONFIG_IPC_SERVICE_ICMSG_NOCOPY_RX
 	atomic_t rx_buffer_state;
@@ -436,6 +436,24 @@ __syscall int k_thread_stack_space_get(const struct k_thread *thread,
 				       size_t *unused_ptr);
 #endif
 
+#if defined(CONFIG_THREAD_STACK_WATERMARK) || defined(__DOXYGEN__)
+/**
+ * @brief Obtain the sampled unused stack space of a thread
+ *
+ * Returns the space below the lowest stack pointer of @a thread seen when it
+ * was switched out, in constant time. The frames reached between context
+ * switches are missed, so the unused space may be overestimated compared to
+ * k_thread_stack_space_get(), which scans the stack.
+ *
+ * @param thread Thread to inspect stack information
+ * @param unused_ptr Output parameter, filled in with the unused stack space
+ *	of the target thread in bytes.
+ * @return 0 on success
+ * @return -EINVAL Thread has no stack
+ */
+int k_thread_stack_watermark_get(const struct k_thread *thread, size_t *unused_ptr);
+#endif
+
 #if (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 /**
  * @brief Assign the system heap as a thread's resource pool
@@ -520,6 +538,24 @@ static inline int32_t k_msleep(int32_t ms)
  */
 __syscall int32_t k_usleep(int32_t us);
 
+#if defined(CONFIG_TIMER_SLACK) || defined(__DOXYGEN__)
+/**
+ * @brief Set the timer slack of a thread.
+ *
+ * The sleeps of the thread may then last up to @p slack longer than
+ * requested, so that their wakeups coalesce with other timeouts and the
+ * system wakes up less often.  The slack does not apply to the timeouts
+ * of the thread waiting on kernel objects.
+ *
+ * @note You should enable @kconfig{CONFIG_TIMER_SLACK} in your project
+ * configuration.
+ *
+ * @param thread Thread to operate upon
+ * @param slack Maximum delay of the sleeps, K_NO_WAIT for none
+ */
+__syscall void k_thread_timer_slack_set(k_tid_t thread, k_timeout_t slack);
+#endif
+
 /**
  * @brief Cause the current thread to busy wait.
  *
@@ -878,6 +914,41 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
  *
  */
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Attach a constant bandwidth server to a thread
+ *
+ * Reserves @a budget cycles of CPU time every @a period cycles for the
+ * thread, both in k_cycle_get_32() units.  The thread's deadline is set
+ * to the end of the current period and advanced by @a period at every
+ * period boundary, so threads sharing a static priority are scheduled
+ * earliest-deadline-first.  A thread running out of budget before the
+ * end of its period is throttled (made unrunnable) until the next
+ * period starts, so an overrunning thread cannot steal time reserved
+ * for others.
+ *
+ * The reservation is subject to admission control: the sum of
+ * budget/period over all threads with a server must stay within
+ * @kconfig{CONFIG_SCHED_DEADLINE_CBS_MAX_UTILIZATION} percent of each
+ * CPU.  Call this before starting the thread to admit it at creation.
+ *
+ * Periods that end with the thread still runnable (i.e. it did not
+ * block before its deadline) are counted as deadline misses, and
+ * reported along with the throttle count in k_thread_runtime_stats.
+ *
+ * @param thread Thread to attach the server to
+ * @param budget Budget per period in cycles, 0 to detach the server
+ * @param period Period in cycles
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the budget exceeds the period, or period is 0
+ * @retval -EBUSY if admitting the reservation would exceed the
+ *         configured utilization bound
+ */
+__syscall int k_thread_cbs_set(k_tid_t thread, uint32_t budget,
+			       uint32_t period);
+#endif
 #endif
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -2973,6 +3044,32 @@ __syscall int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
  */
 __syscall int k_mutex_unlock(struct k_mutex *mutex);
 
+#if defined(CONFIG_MUTEX_ADAPTIVE_SPIN) || defined(__DOXYGEN__)
+/**
+ * @brief Mutex adaptive spinning statistics
+ *
+ * Counters over all mutexes since boot, see
+ * @kconfig{CONFIG_MUTEX_ADAPTIVE_SPIN}.
+ */
+struct k_mutex_spin_stats {
+	/** Number of times a contended lock spun on a running owner */
+	uint32_t spins;
+	/** Number of those spins that acquired the mutex without pending */
+	uint32_t acquired;
+};
+
+/**
+ * @brief Get mutex adaptive spinning statistics
+ *
+ * The ratio of @a acquired to @a spins tells how often spinning saved a
+ * context switch pair, to tune
+ * @kconfig{CONFIG_MUTEX_ADAPTIVE_SPIN_CYCLES}.
+ *
+ * @param stats Storage for the statistics
+ */
+void k_mutex_spin_stats_get(struct k_mutex_spin_stats *stats);
+#endif
+
 /**
  * @}
  */
@@ -3055,6 +3152,332 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/*
+ * Lock state word: the number of readers holding the lock in the low
+ * bits, plus a flag for a writer holding it and a flag for threads
+ * pending on either wait queue.  Uncontended acquisition and release
+ * only ever touch this word.
+ */
+#define Z_RWLOCK_WRITER  BIT(31)
+#define Z_RWLOCK_WAITERS BIT(30)
+#define Z_RWLOCK_READERS BIT_MASK(30)
+
+/**
+ * @endcond
+ */
+
+/**
+ * Reader-writer lock structure
+ */
+struct k_rwlock {
+	/** Lock state, see Z_RWLOCK_* */
+	atomic_t state;
+	/** Readers waiting for the lock */
+	_wait_q_t readers;
+	/** Writers waiting for the lock */
+	_wait_q_t writers;
+	/** Writer holding the lock, or NULL */
+	atomic_ptr_t owner;
+	/** Original priority of the writer holding the lock */
+	int owner_orig_prio;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj)                                              \
+	{                                                                      \
+		.state = ATOMIC_INIT(0),                                       \
+		.readers = Z_WAIT_Q_INIT(&obj.readers),                        \
+		.writers = Z_WAIT_Q_INIT(&obj.writers),                        \
+		.owner = ATOMIC_PTR_INIT(NULL),                                \
+		.owner_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO,           \
+	}
+/**
+ * @endcond
+ */
+
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the lock.
+ */
+#define K_RWLOCK_DEFINE(name)                                                  \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) =                              \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a reader-writer lock.
+ *
+ * Upon completion, the lock is available and does not have an owner.
+ *
+ * @param rwlock Address of the lock.
+ *
+ * @retval 0 Lock object created
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for reading.
+ *
+ * Any number of threads may hold the lock for reading at once.  The lock
+ * prefers writers: once a writer is waiting, new readers wait behind it so
+ * a steady stream of readers cannot starve writers.  Taking an uncontended
+ * lock is a single atomic operation.
+ *
+ * Read locks are not recursive: a thread must not take the lock for reading
+ * again while holding it, as that can deadlock against a waiting writer.
+ *
+ * @param rwlock Address of the lock.
+ * @param timeout Waiting period to lock the lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock taken for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Release a read lock on a reader-writer lock.
+ *
+ * @param rwlock Address of the lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EINVAL The lock is not held for reading.
+ */
+__syscall int k_rwlock_read_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for writing.
+ *
+ * Waits until no reader or writer holds the lock.  While a writer waits
+ * on a lock held by another writer, the holder's priority is raised to
+ * the waiter's, as for @ref k_mutex.  Readers are not tracked
+ * individually, so their priorities are not raised.
+ *
+ * @param rwlock Address of the lock.
+ * @param timeout Waiting period to lock the lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock taken for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Release a write lock on a reader-writer lock.
+ *
+ * If writers are waiting, the lock is handed to the highest priority one;
+ * otherwise all waiting readers are woken.
+ *
+ * @param rwlock Address of the lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EPERM The current thread does not hold the lock for writing.
+ */
+__syscall int k_rwlock_write_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
+#ifdef CONFIG_IRQ_THREAD
+
+struct k_irq_thread;
+
+/**
+ * @brief Handler of an interrupt thread
+ *
+ * @param arg Argument given when defining the interrupt thread.
+ */
+typedef void (*k_irq_thread_handler_t)(void *arg);
+
+/**
+ * Latency statistics of an interrupt thread
+ */
+struct k_irq_thread_stats {
+	/** Number of times the handler ran */
+	uint32_t count;
+	/** Shortest time from waking the thread to running the handler, in cycles */
+	uint32_t min_cycles;
+	/** Longest time from waking the thread to running the handler, in cycles */
+	uint32_t max_cycles;
+	/** Sum of the times from waking the thread to running the handler, in cycles */
+	uint64_t total_cycles;
+};
+
+/**
+ * Interrupt thread structure
+ */
+struct k_irq_thread {
+	/** Handler thread */
+	struct k_thread thread;
+	/** Stack of the handler thread */
+	k_thread_stack_t *stack;
+	/** Size of the stack */
+	size_t stack_size;
+	/** Handler run by the thread */
+	k_irq_thread_handler_t handler;
+	/** Argument of the handler */
+	void *arg;
+	/** Interrupt line masked until the handler ran, or -1 */
+	int irq;
+	/** Priority of the handler thread */
+	int prio;
+	/** Number of wake-ups since the handler last ran */
+	atomic_t pending;
+	/** Where the handler thread waits to be woken */
+	_wait_q_t wait_q;
+	/** Protects busy and flush_q */
+	struct k_spinlock lock;
+	/** Whether the handler is running */
+	bool busy;
+	/** Threads waiting for the handler to be done */
+	_wait_q_t flush_q;
+#ifdef CONFIG_IRQ_THREAD_STATS
+	/** Cycle count when the thread was woken */
+	uint32_t wake_cycles;
+	/** Latency statistics */
+	struct k_irq_thread_stats stats;
+#endif
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+struct k_irq_thread_initparam {
+	struct k_irq_thread *irq_thread;
+};
+/**
+ * @endcond
+ */
+
+/**
+ * @defgroup irq_thread_apis Interrupt Thread APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Statically define an interrupt thread.
+ *
+ * The handler thread is started at boot. Its handler runs in thread context
+ * each time the thread is woken by k_irq_thread_wake(), usually from the
+ * interrupt service routine of a driver, with the wake-ups that happen while
+ * it runs coalesced into a single run.
+ *
+ * When @p irq is not -1, k_irq_thread_isr() can be connected to the interrupt
+ * line directly. The line is then masked from the interrupt until the handler
+ * ran, for level triggered interrupts that the handler acknowledges.
+ *
+ * @param name Name of the interrupt thread.
+ * @param irq_line Interrupt line masked until the handler ran, or -1.
+ * @param handler_fn Handler run by the thread.
+ * @param handler_arg Argument of the handler.
+ * @param stack_sz Stack size of the handler thread.
+ * @param thread_prio Priority of the handler thread.
+ */
+#define K_IRQ_THREAD_DEFINE(name, irq_line, handler_fn, handler_arg,           \
+			    stack_sz, thread_prio)                             \
+	static K_KERNEL_STACK_DEFINE(_k_irq_thread_stack_##name, stack_sz);    \
+	struct k_irq_thread name = {                                           \
+		.stack = _k_irq_thread_stack_##name,                           \
+		.stack_size = K_KERNEL_STACK_SIZEOF(_k_irq_thread_stack_##name), \
+		.handler = handler_fn,                                         \
+		.arg = handler_arg,                                            \
+		.irq = irq_line,                                               \
+		.prio = thread_prio,                                           \
+		.pending = ATOMIC_INIT(0),                                     \
+		.wait_q = Z_WAIT_Q_INIT(&name.wait_q),                         \
+		.flush_q = Z_WAIT_Q_INIT(&name.flush_q),                       \
+	};                                                                     \
+	static const STRUCT_SECTION_ITERABLE(k_irq_thread_initparam,           \
+					     _k_irq_thread_init_##name) = {    \
+		.irq_thread = &name,                                           \
+	}
+
+/**
+ * @brief Wake an interrupt thread.
+ *
+ * The handler thread is made ready directly, without going through a kernel
+ * object, so that it runs on the way out of the interrupt if it has a higher
+ * priority than the interrupted thread. A handler thread suspended with
+ * k_thread_suspend() stays suspended, its handler runs once it is resumed.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param irq_thread Address of the interrupt thread.
+ */
+void k_irq_thread_wake(struct k_irq_thread *irq_thread);
+
+/**
+ * @brief Interrupt service routine waking an interrupt thread.
+ *
+ * To be connected to an interrupt line with the interrupt thread as
+ * argument. It masks the interrupt line of the interrupt thread, if any,
+ * until the handler ran, and wakes the thread.
+ *
+ * @param arg Address of the interrupt thread.
+ */
+void k_irq_thread_isr(const void *arg);
+
+/**
+ * @brief Wait for the handler of an interrupt thread to be done.
+ *
+ * Waits until the handler ran for all the wake-ups that happened before the
+ * call. While waiting, the handler thread runs at the priority of the caller
+ * if it is higher than its own.
+ *
+ * @param irq_thread Address of the interrupt thread.
+ * @param timeout Waiting period, or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 The handler is done.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_irq_thread_flush(struct k_irq_thread *irq_thread, k_timeout_t timeout);
+
+#ifdef CONFIG_IRQ_THREAD_STATS
+/**
+ * @brief Get the latency statistics of an interrupt thread.
+ *
+ * @param irq_thread Address of the interrupt thread.
+ * @param stats Statistics to fill.
+ */
+void k_irq_thread_stats_get(struct k_irq_thread *irq_thread,
+			    struct k_irq_thread_stats *stats);
+
+/**
+ * @brief Reset the latency statistics of an interrupt thread.
+ *
+ * @param irq_thread Address of the interrupt thread.
+ */
+void k_irq_thread_stats_reset(struct k_irq_thread *irq_thread);
+#endif /* CONFIG_IRQ_THREAD_STATS */
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_IRQ_THREAD */
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -3204,6 +3627,7 @@ static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 
 struct k_work_delayable;
 struct k_work_sync;
+struct k_work_q_thread;
 
 /**
  * INTERNAL_HIDDEN @endcond
@@ -3417,6 +3841,37 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+#if defined(CONFIG_WORKQUEUE_MULTI_THREAD) || defined(__DOXYGEN__)
+/** @brief Add a thread to a work queue.
+ *
+ * The thread processes the work items of the queue along with the thread
+ * started by k_work_queue_start() and the other added threads, so that
+ * independent work items run concurrently.  A work item still never runs
+ * in two threads at the same time: while it runs, a resubmission waits in
+ * the queue until it completes.
+ *
+ * Work items submitted to a queue with several threads must not rely on
+ * being serialized with the other work items of the queue.
+ *
+ * @param queue pointer to the queue structure, which must have been started.
+ *
+ * @param wthread pointer to the work queue thread structure.
+ *
+ * @param stack pointer to the thread stack area.
+ *
+ * @param stack_size size of the thread stack area, in bytes.
+ *
+ * @param prio initial thread priority
+ *
+ * @param cfg optional additional configuration parameters.  Only the name
+ * and the CPU mask are used.  Pass @c NULL if not required.
+ */
+void k_work_queue_thread_add(struct k_work_q *queue,
+			     struct k_work_q_thread *wthread,
+			     k_thread_stack_t *stack, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg);
+#endif /* CONFIG_WORKQUEUE_MULTI_THREAD */
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -3498,6 +3953,24 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 static inline struct k_work_delayable *
 k_work_delayable_from_work(struct k_work *work);
 
+#if defined(CONFIG_TIMER_SLACK) || defined(__DOXYGEN__)
+/** @brief Set the timer slack of a delayable work item.
+ *
+ * The work item may then be submitted up to @p slack after the delay
+ * given when scheduling it, so that its timeout coalesces with other
+ * timeouts and the system wakes up less often.  This applies to the
+ * following calls to k_work_schedule() and k_work_reschedule().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param slack the maximum delay of the submission, K_NO_WAIT for none.
+ */
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack);
+#endif /* CONFIG_TIMER_SLACK */
+
 /** @brief Busy state flags from the delayable work item.
  *
  * @funcprops \isr_ok
@@ -3850,6 +4323,11 @@ struct k_work_delayable {
 
 	/* The queue to which the work should be submitted. */
 	struct k_work_q *queue;
+
+#ifdef CONFIG_TIMER_SLACK
+	/* Ticks the timeout may be delayed by. */
+	k_ticks_t slack;
+#endif
 };
 
 #define Z_WORK_DELAYABLE_INITIALIZER(work_handler) { \
@@ -3907,6 +4385,21 @@ struct z_work_canceller {
 	struct k_sem sem;
 };
 
+/* Record used to wait for work to complete a flush on a queue with several
+ * threads.
+ *
+ * The record is inserted into a global list of pending flushes and tracks
+ * the instances of the work item which were queued or running when the
+ * flush started.  It is removed and woken when they complete.
+ */
+struct z_work_flush_waiter {
+	sys_snode_t node;
+	struct k_work *work;
+	struct k_sem sem;
+	bool queued;
+	bool running;
+};
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
@@ -3928,6 +4421,9 @@ struct k_work_sync {
 	union {
 		struct z_work_flusher flusher;
 		struct z_work_canceller canceller;
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+		struct z_work_flush_waiter waiter;
+#endif
 	};
 };
 
@@ -3957,7 +4453,29 @@ struct k_work_queue_config {
 	 * control.
 	 */
 	bool no_yield;
+
+#if defined(CONFIG_SCHED_CPU_MASK) || defined(__DOXYGEN__)
+	/** The CPUs the work queue thread may run on.
+	 *
+	 * If left 0 the thread may run on any CPU.
+	 */
+	uint32_t cpu_mask;
+#endif
+};
+
+#if defined(CONFIG_WORKQUEUE_MULTI_THREAD) || defined(__DOXYGEN__)
+/** @brief An additional thread of a work queue.
+ *
+ * @see k_work_queue_thread_add
+ */
+struct k_work_q_thread {
+	/* The thread that animates the work. */
+	struct k_thread thread;
+
+	/* Node in the list of the additional threads of the queue. */
+	sys_snode_t node;
 };
+#endif /* CONFIG_WORKQUEUE_MULTI_THREAD */
 
 /** @brief A structure used to hold work until it can be processed. */
 struct k_work_q {
@@ -3979,6 +4497,14 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+	/* Additional threads animating the work. */
+	sys_slist_t threads;
+
+	/* Number of work items being processed. */
+	uint16_t busy;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4379,6 +4905,13 @@ struct k_msgq {
 	/** Message queue */
 	uint8_t flags;
 
+#if defined(CONFIG_MSGQ_ZERO_COPY) || defined(__DOXYGEN__)
+	/** Threads waiting for free space, the others wait in wait_q */
+	_wait_q_t put_wait_q;
+	/** Purged messages still held behind a message claimed for reading */
+	uint32_t purged_msgs;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_msgq)
 };
 /**
@@ -4386,6 +4919,13 @@ struct k_msgq {
  */
 
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+#define Z_MSGQ_PUT_WAIT_Q_INIT(obj) \
+	.put_wait_q = Z_WAIT_Q_INIT(&obj.put_wait_q),
+#else
+#define Z_MSGQ_PUT_WAIT_Q_INIT(obj)
+#endif
+
 #define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
@@ -4397,6 +4937,7 @@ struct k_msgq {
 	.write_ptr = q_buffer, \
 	.used_msgs = 0, \
 	_POLL_EVENT_OBJ_INIT(obj) \
+	Z_MSGQ_PUT_WAIT_Q_INIT(obj) \
 	}
 
 /**
@@ -4405,6 +4946,8 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_PUT_CLAIMED	BIT(1)
+#define K_MSGQ_FLAG_GET_CLAIMED	BIT(2)
 
 /**
  * @brief Message Queue Attributes
@@ -4615,7 +5158,13 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	uint32_t claimed = (msgq->flags & K_MSGQ_FLAG_PUT_CLAIMED) != 0U ? 1U : 0U;
+
+	return msgq->max_msgs - msgq->used_msgs - msgq->purged_msgs - claimed;
+#else
 	return msgq->max_msgs - msgq->used_msgs;
+#endif
 }
 
 /**
@@ -4634,6 +5183,92 @@ static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 	return msgq->used_msgs;
 }
 
+#if defined(CONFIG_MSGQ_ZERO_COPY) || defined(__DOXYGEN__)
+
+/**
+ * @brief Claim the next free slot of a message queue for writing in place.
+ *
+ * This routine reserves the slot the next message will be stored in and
+ * returns its address, so the message can be built there instead of being
+ * copied in by k_msgq_put().  The message is sent when the caller is done
+ * with it by k_msgq_put_commit().
+ *
+ * Only one slot can be claimed for writing at a time: while it is, other
+ * writers wait as if the queue were full, which keeps messages in order.
+ * Readers are not affected.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Not available to user mode threads, which cannot access the
+ * message buffer.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Filled with the address of the claimed slot, which has room
+ *             for one message.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_put_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Send the message written in place by k_msgq_put_claim().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL No slot is claimed for writing.
+ */
+int k_msgq_put_commit(struct k_msgq *msgq);
+
+/**
+ * @brief Claim the first message of a message queue for reading in place.
+ *
+ * This routine returns the address of the first message without copying
+ * it out.  The message stays in its slot until k_msgq_get_finish()
+ * removes it from the queue.
+ *
+ * Only one message can be claimed for reading at a time: while it is,
+ * other readers wait as if the queue were empty.  Writers are not
+ * affected, except that the claimed slot is not free.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Not available to user mode threads, which cannot access the
+ * message buffer.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Filled with the address of the message.
+ * @param timeout Waiting period for a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_get_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Remove the message read in place by k_msgq_get_claim().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message removed.
+ * @retval -EINVAL No message is claimed for reading.
+ */
+int k_msgq_get_finish(struct k_msgq *msgq);
+
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 /** @} */
 
 /**
@@ -4821,6 +5456,16 @@ struct k_pipe {
 	SYS_PORT_TRACING_TRACKING_FIELD(k_pipe)
 };
 
+/**
+ * @brief Segment of a vectored pipe transfer
+ *
+ * @see k_pipe_putv(), k_pipe_getv()
+ */
+struct k_pipe_iovec {
+	void  *base;    /**< Start of the segment */
+	size_t len;     /**< Length of the segment in bytes */
+};
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -4953,6 +5598,68 @@ __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
 			 size_t bytes_to_read, size_t *bytes_read,
 			 size_t min_xfer, k_timeout_t timeout);
 
+/**
+ * @brief Write data gathered from several buffers to a pipe.
+ *
+ * This routine behaves like k_pipe_put(), writing the segments of @a iov
+ * one after the other as a single stream of bytes. All segments are
+ * transferred to waiting readers and to the pipe buffer while holding
+ * the pipe lock once, so that readers never observe them separated by
+ * data from other writers.
+ *
+ * The segment array is not copied, and must not be modified until the
+ * call returns.
+ *
+ * @note This routine cannot be called from user mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param iov Array of segments to write.
+ * @param iovcnt Number of segments in @a iov.
+ * @param bytes_written Address of area to hold the number of bytes written.
+ * @param min_xfer Minimum number of bytes to write.
+ * @param timeout Waiting period to wait for the data to be written,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least @a min_xfer bytes of data were written.
+ * @retval -EINVAL invalid parameters supplied
+ * @retval -EIO Returned without waiting; zero data bytes were written.
+ * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
+ *                 minus one data bytes were written.
+ */
+int k_pipe_putv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+		size_t iovcnt, size_t *bytes_written, size_t min_xfer,
+		k_timeout_t timeout);
+
+/**
+ * @brief Read data from a pipe, scattering it to several buffers.
+ *
+ * This routine behaves like k_pipe_get(), filling the segments of @a iov
+ * one after the other from a single stream of bytes, and taking the pipe
+ * lock once for all of them.
+ *
+ * The segment array is not copied, and must not be modified until the
+ * call returns.
+ *
+ * @note This routine cannot be called from user mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param iov Array of segments to fill.
+ * @param iovcnt Number of segments in @a iov.
+ * @param bytes_read Address of area to hold the number of bytes read.
+ * @param min_xfer Minimum number of data bytes to read.
+ * @param timeout Waiting period to wait for the data to be read,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least @a min_xfer bytes of data were read.
+ * @retval -EINVAL invalid parameters supplied
+ * @retval -EIO Returned without waiting; zero data bytes were read.
+ * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
+ *                 minus one data bytes were read.
+ */
+int k_pipe_getv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+		size_t iovcnt, size_t *bytes_read, size_t min_xfer,
+		k_timeout_t timeout);
+
 /**
  * @brief Query the number of bytes that may be read from @a pipe.
  *
@@ -5010,10 +5717,23 @@ struct k_mem_slab {
 	uint32_t num_blocks;
 	size_t block_size;
 	char *buffer;
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	/* Index + 1 of the first free block in the low idx_bits bits,
+	 * modification count above
+	 */
+	atomic_t free_head;
+	atomic_t waiters;
+	atomic_t num_used;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_t max_used;
+#endif
+	uint8_t idx_bits;
+#else
 	char *free_list;
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
+#endif
 #endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
@@ -5027,8 +5747,6 @@ struct k_mem_slab {
 	.num_blocks = slab_num_blocks, \
 	.block_size = slab_block_size, \
 	.buffer = slab_buffer, \
-	.free_list = NULL, \
-	.num_used = 0, \
 	}
 
 
@@ -5155,6 +5873,48 @@ extern int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
 
+/**
+ * @brief Allocate several memory blocks from a memory slab.
+ *
+ * This routine allocates up to @a count memory blocks from a memory
+ * slab, taking the slab lock only once.  It returns as many blocks as
+ * are available without waiting; only if none is available does it
+ * wait for a single block, as k_mem_slab_alloc() would.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array of at least @a count block addresses, filled in with
+ *        the blocks allocated.
+ * @param count Maximum number of blocks to allocate.
+ * @param timeout Non-negative waiting period to wait for a first block.
+ *        Use K_NO_WAIT to return without waiting,
+ *        or K_FOREVER to wait as long as necessary.
+ *
+ * @return Number of blocks allocated, between 1 and @a count, or 0 if
+ *         @a count is 0.
+ * @retval -ENOMEM Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+extern int k_mem_slab_alloc_bulk(struct k_mem_slab *slab, void **mem,
+				 uint32_t count, k_timeout_t timeout);
+
+/**
+ * @brief Free several memory blocks allocated from a memory slab.
+ *
+ * This routine releases @a count memory blocks back to their memory
+ * slab, taking the slab lock only once.  Threads waiting for blocks
+ * are handed blocks first.
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array of @a count block addresses.
+ * @param count Number of blocks to free.
+ */
+extern void k_mem_slab_free_bulk(struct k_mem_slab *slab, void **mem,
+				 uint32_t count);
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5167,7 +5927,11 @@ extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	return (uint32_t)atomic_get(&slab->num_used);
+#else
 	return slab->num_used;
+#endif
 }
 
 /**
@@ -5182,7 +5946,9 @@ static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
 {
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+#if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION) && defined(CONFIG_MEM_SLAB_LOCKFREE)
+	return (uint32_t)atomic_get(&slab->max_used);
+#elif defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION)
 	return slab->max_used;
 #else
 	ARG_UNUSED(slab);
@@ -5202,7 +5968,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->num_blocks - slab->num_used;
+	return slab->num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5241,10 +6007,32 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_KHEAP_MAGAZINES
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+struct z_heap_magazine {
+	void *rounds[CONFIG_KHEAP_MAGAZINE_ROUNDS];
+	uint8_t count;
+};
+
+/* One CPU's magazines, one per size class */
+struct z_heap_cpu_cache {
+	struct k_spinlock lock;
+	struct z_heap_magazine mags[CONFIG_KHEAP_MAGAZINE_CLASSES];
+};
+/** @endcond */
+#endif
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_KHEAP_MAGAZINES
+	struct z_heap_cpu_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Allocations that found the heap empty and flushed the caches */
+	atomic_t cache_waiters;
+#endif
 };
 
 /**
@@ -5323,7 +6111,15 @@ void k_heap_free(struct k_heap *h, void *mem);
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
+#if defined(CONFIG_SYS_HEAP_TLSF) && (CONFIG_SYS_HEAP_TLSF_SL_BITS == 1)
+#define Z_HEAP_MIN_SIZE (sizeof(void *) > 4 ? 72 : 60)
+#elif defined(CONFIG_SYS_HEAP_TLSF) && (CONFIG_SYS_HEAP_TLSF_SL_BITS == 2)
+#define Z_HEAP_MIN_SIZE (sizeof(void *) > 4 ? 88 : 76)
+#elif defined(CONFIG_SYS_HEAP_TLSF)
+#define Z_HEAP_MIN_SIZE (sizeof(void *) > 4 ? 96 : 84)
+#else
 #define Z_HEAP_MIN_SIZE (sizeof(void *) > 4 ? 56 : 44)
+#endif
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -5770,6 +6566,87 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+#if defined(CONFIG_POLL_SET) || defined(__DOXYGEN__)
+
+/**
+ * @brief Persistent set of poll events
+ *
+ * The events of a poll set stay registered on their objects between waits,
+ * and the events whose object became ready are moved to a ready list, so
+ * that waiting on the set costs time in the number of ready events rather
+ * than in the number of events of the set.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set The poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add a poll event to a poll set.
+ *
+ * The event, initialized with k_poll_event_init(), stays registered on its
+ * object until it is removed from the set with k_poll_set_remove(), and must
+ * not be passed to k_poll() meanwhile.
+ *
+ * @param set The poll set.
+ * @param event The event to add.
+ *
+ * @retval 0 The event was added.
+ * @retval -EBUSY The event is already registered on an object.
+ * @retval -EINVAL The event has no object to poll.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove a poll event from a poll set.
+ *
+ * @param set The poll set.
+ * @param event The event to remove.
+ *
+ * @retval 0 The event was removed.
+ * @retval -EINVAL The event is not in the set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * Returns the events whose object is ready, with their state field set as
+ * by k_poll(). As with k_poll(), the objects are not acquired: an event is
+ * returned again by the next wait for as long as its object stays ready, and
+ * a K_POLL_STATE_CANCELLED state is only returned once.
+ *
+ * The set can be waited on by several threads, each event being returned to
+ * one of them. This API is not available to user mode threads.
+ *
+ * @param set The poll set.
+ * @param events Array filled in with the ready events.
+ * @param max_events Size of the array.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events returned, at least 1.
+ * @retval -EAGAIN Waiting period timed out, or the events which made the
+ *         thread ready were no longer ready when it ran.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, k_timeout_t timeout);
+
+#endif /* CONFIG_POLL_SET */
+
 /**
  * @internal
  */
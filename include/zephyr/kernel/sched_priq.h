@@ -43,16 +43,29 @@ void z_priq_rb_add(struct _priq_rb *pq, struct k_thread *thread);
 void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread);
 struct k_thread *z_priq_rb_best(struct _priq_rb *pq);
 
-/* Traditional/textbook "multi-queue" structure.  Separate lists for a
- * small number (max 32 here) of fixed priorities.  This corresponds
- * to the original Zephyr scheduler.  RAM requirements are
- * comparatively high, but performance is very fast.  Won't work with
- * features like deadline scheduling which need large priority spaces
- * to represent their requirements.
+/* Traditional/textbook "multi-queue" structure.  Separate lists for
+ * each of the fixed priorities.  This corresponds to the original
+ * Zephyr scheduler.  RAM requirements are comparatively high, but
+ * performance is very fast.  Won't work with features like deadline
+ * scheduling which need large priority spaces to represent their
+ * requirements.
+ *
+ * Non-empty lists are tracked in a bitmap of one bit per priority.
+ * When there are more priorities than bits in a long, a second level
+ * "words" mask tracks which bitmap words are non-zero, so finding the
+ * best queue stays two count-trailing-zeros operations regardless of
+ * the number of priorities.
  */
+#define K_NUM_THREAD_PRIO \
+	(CONFIG_NUM_PREEMPT_PRIORITIES + CONFIG_NUM_COOP_PRIORITIES + 1)
+#define PRIQ_BITMAP_SIZE (DIV_ROUND_UP(K_NUM_THREAD_PRIO, BITS_PER_LONG))
+
 struct _priq_mq {
-	sys_dlist_t queues[32];
-	unsigned int bitmask; /* bit 1<<i set if queues[i] is non-empty */
+	sys_dlist_t queues[K_NUM_THREAD_PRIO];
+#if PRIQ_BITMAP_SIZE > 1
+	unsigned long words; /* bit 1<<i set if bitmask[i] is non-zero */
+#endif
+	unsigned long bitmask[PRIQ_BITMAP_SIZE]; /* bit set if queue is non-empty */
 };
 
 struct k_thread *z_priq_mq_best(struct _priq_mq *pq);
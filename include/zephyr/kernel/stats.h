@@ -30,4 +30,31 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || defined(__DOXYGEN__)
+/** Kinds of wait of the blocked time histograms. */
+enum k_sched_wait_type {
+	K_SCHED_WAIT_OBJECT,    /**< pended on a kernel object */
+	K_SCHED_WAIT_SLEEP,     /**< sleeping for a timeout */
+	K_SCHED_WAIT_SUSPEND,   /**< suspended */
+	K_SCHED_WAIT_TYPES      /**< number of kinds of wait */
+};
+
+/**
+ * Scheduling latency histograms of a thread.
+ *
+ * Bucket 0 counts durations below
+ * 2^CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT cycles, bucket n the
+ * durations below twice the bound of bucket n - 1, and the last bucket
+ * all the longer durations.
+ */
+struct k_sched_latency_stats {
+	/** Time from being made ready to running */
+	uint32_t ready[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	/** Time spent preempted, from being switched out while runnable */
+	uint32_t preempted[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	/** Time spent blocked, by kind of wait */
+	uint32_t blocked[K_SCHED_WAIT_TYPES][CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+};
+#endif
+
 #endif
@@ -41,6 +41,7 @@ struct __thread_entry {
 #endif
 
 struct k_thread;
+struct k_pipe_iovec;
 
 /*
  * This _pipe_desc structure is used by the pipes kernel module when
@@ -51,6 +52,8 @@ struct _pipe_desc {
 	sys_dnode_t      node;
 	unsigned char   *buffer;         /* Position in src/dest buffer */
 	size_t           bytes_to_xfer;  /* # bytes left to transfer */
+	size_t           seg_left;       /* # bytes left in current segment */
+	const struct k_pipe_iovec *iov;  /* Next segment, if vectored */
 	struct k_thread *thread;         /* Back pointer to pended thread */
 };
 
@@ -105,6 +108,24 @@ struct _thread_base {
 	int prio_deadline;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	/* Constant bandwidth server, see k_thread_cbs_set() */
+	struct {
+		uint32_t budget;	/* cycles per period, 0 if unused */
+		uint32_t period;	/* cycles */
+		int32_t remaining;	/* budget left in this period */
+		uint32_t switched_in;	/* cycle stamp when last switched in */
+		uint32_t deadline_misses;
+		uint32_t overruns;
+		struct _timeout period_timeout;
+	} cbs;
+#endif
+
+#ifdef CONFIG_TIMER_SLACK
+	/* Slack of the sleeps of the thread, see k_thread_timer_slack_set() */
+	k_ticks_t timer_slack;
+#endif
+
 	uint32_t order_key;
 
 #ifdef CONFIG_SMP
@@ -141,6 +162,13 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	struct k_sched_latency_stats latency;
+	/* Start of the current ready, preempted or blocked period */
+	uint32_t latency_start;
+	uint8_t latency_state;
+#endif
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -167,6 +195,11 @@ struct _thread_stack_info {
 	 * is the initial stack pointer for a thread. May be 0.
 	 */
 	size_t delta;
+
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	/* Lowest stack pointer sampled when the thread was switched out */
+	uintptr_t watermark;
+#endif
 };
 
 typedef struct _thread_stack_info _thread_stack_info_t;
@@ -182,6 +215,17 @@ struct _mem_domain_info {
 
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+/* Kernel object which passed validation, valid while the generation of
+ * the object caches is unchanged.
+ */
+struct _obj_cache_entry {
+	const void *obj;
+	uint64_t gen;
+	uint8_t type;
+};
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+
 #ifdef CONFIG_THREAD_USERSPACE_LOCAL_DATA
 struct _thread_userspace_local_data {
 #if defined(CONFIG_ERRNO) && !defined(CONFIG_ERRNO_IN_TLS) && !defined(CONFIG_LIBC_ERRNO)
@@ -224,6 +268,24 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	/*
+	 * Number of periods the thread's deadline server ended with the
+	 * thread still runnable, and the number of times it was throttled
+	 * for running out of budget.  Always zero for CPU statistics.
+	 */
+	uint32_t deadline_misses;
+	uint32_t budget_overruns;
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	/*
+	 * Scheduling latency histograms of the thread. Always zero for CPU
+	 * statistics.
+	 */
+	struct k_sched_latency_stats latency;
+#endif
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -313,6 +375,11 @@ struct k_thread {
 	void *syscall_frame;
 #endif /* CONFIG_USERSPACE */
 
+#if defined(CONFIG_USERSPACE_OBJ_CACHE)
+	/** cache of the kernel objects validated for the thread */
+	struct _obj_cache_entry obj_cache[CONFIG_USERSPACE_OBJ_CACHE_SIZE];
+#endif
+
 
 #if defined(CONFIG_USE_SWITCH)
 	/* When using __switch() a few previously arch-specific items
@@ -343,6 +410,13 @@ struct k_thread {
 	struct _pipe_desc pipe_desc;
 #endif
 
+#ifdef CONFIG_SYS_PERF_THREAD
+	/** Performance counters of the thread */
+	struct sys_perf_counters perf;
+	/** Counter values when the thread was last switched in */
+	struct sys_perf_snapshot perf_start;
+#endif
+
 	/** arch-specifics: must always be at the end */
 	struct _thread_arch arch;
 };
@@ -62,6 +62,9 @@ extern "C" {
 /* Thread is being aborted */
 #define _THREAD_ABORTING (BIT(5))
 
+/* Thread has exhausted its deadline server budget */
+#define _THREAD_THROTTLED (BIT(6))
+
 /* Thread is present in the ready queue */
 #define _THREAD_QUEUED (BIT(7))
 
@@ -110,7 +113,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -161,7 +164,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -184,8 +187,8 @@ struct z_kernel {
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	/* Need to signal an IPI at the next scheduling point */
-	bool pending_ipi;
+	/* Bitmap of CPUs to signal an IPI at the next scheduling point */
+	atomic_t pending_ipi;
 #endif
 };
 
@@ -247,6 +250,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Index of the CPU timeout queue this timeout is filed on */
+	uint8_t cpu;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -22,16 +22,31 @@
 #define __imr __in_section_unique(imr)
 #define __imrdata __in_section_unique(imrdata)
 
+/* Attribute macros to place code and data into tightly coupled memory */
+#define __itcm_section Z_GENERIC_SECTION(_ITCM_SECTION_NAME)
+#define __dtcm_data_section Z_GENERIC_SECTION(_DTCM_DATA_SECTION_NAME)
+#define __dtcm_bss_section Z_GENERIC_SECTION(_DTCM_BSS_SECTION_NAME)
+#define __dtcm_noinit_section Z_GENERIC_SECTION(_DTCM_NOINIT_SECTION_NAME)
+
+/* Kernel hot paths, in tightly coupled memory when enabled */
+#if defined(CONFIG_HOT_CODE_ITCM)
+#define __hot_code __in_section_unique(itcm)
+#else
+#define __hot_code
+#endif /* CONFIG_HOT_CODE_ITCM */
+
+#if defined(CONFIG_HOT_DATA_DTCM)
+#define __hot_data __in_section_unique(dtcm_data)
+#else
+#define __hot_data
+#endif /* CONFIG_HOT_DATA_DTCM */
+
 #if defined(CONFIG_ARM)
 #define __kinetis_flash_config_section __in_section_unique(_KINETIS_FLASH_CONFIG_SECTION_NAME)
 #define __ti_ccfg_section Z_GENERIC_SECTION(_TI_CCFG_SECTION_NAME)
 #define __ccm_data_section Z_GENERIC_SECTION(_CCM_DATA_SECTION_NAME)
 #define __ccm_bss_section Z_GENERIC_SECTION(_CCM_BSS_SECTION_NAME)
 #define __ccm_noinit_section Z_GENERIC_SECTION(_CCM_NOINIT_SECTION_NAME)
-#define __itcm_section Z_GENERIC_SECTION(_ITCM_SECTION_NAME)
-#define __dtcm_data_section Z_GENERIC_SECTION(_DTCM_DATA_SECTION_NAME)
-#define __dtcm_bss_section Z_GENERIC_SECTION(_DTCM_BSS_SECTION_NAME)
-#define __dtcm_noinit_section Z_GENERIC_SECTION(_DTCM_NOINIT_SECTION_NAME)
 #define __ocm_data_section Z_GENERIC_SECTION(_OCM_DATA_SECTION_NAME)
 #define __ocm_bss_section Z_GENERIC_SECTION(_OCM_BSS_SECTION_NAME)
 #define __imx_boot_conf_section Z_GENERIC_SECTION(_IMX_BOOT_CONF_SECTION_NAME)
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_RETENTION_H_
+#define ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_RETENTION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/logging/log_output.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Retained memory logger backend
+ * @defgroup log_backend_retention Retained memory logger backend
+ * @ingroup log_backend
+ *
+ * The backend keeps the most recent log messages, unformatted, in the
+ * retained memory area chosen with "zephyr,log-retained-mem" so that they
+ * survive a reset of the device.
+ * @{
+ */
+
+/**
+ * @brief Get the size of the retained log messages.
+ *
+ * @return Number of bytes which can be read with
+ *         log_backend_retention_read(), 0 if the backend is not ready.
+ */
+size_t log_backend_retention_size(void);
+
+/**
+ * @brief Read the retained log messages.
+ *
+ * The messages are read oldest first. Each message is a raw
+ * struct log_msg, padded to a multiple of 4 bytes, whose string pointers
+ * and source refer to the image which wrote it. New messages replace the
+ * oldest ones, so the messages should be read while logging is idle.
+ *
+ * @param offset Offset of the first byte to read.
+ * @param buf Buffer.
+ * @param len Length of the buffer.
+ *
+ * @return Number of bytes read, 0 at the end of the messages, or -ENODEV if
+ *         the backend is not ready.
+ */
+int log_backend_retention_read(size_t offset, void *buf, size_t len);
+
+/**
+ * @brief Format the retained log messages.
+ *
+ * @param output Log output instance.
+ * @param flags Log output flags, see @ref LOG_OUTPUT_FLAG_LEVEL and others.
+ *
+ * @return Number of formatted messages, -ENODEV if the backend is not ready
+ *         or -EIO if the retained messages are corrupted.
+ */
+int log_backend_retention_dump(const struct log_output *output, uint32_t flags);
+
+/**
+ * @brief Discard the retained log messages.
+ *
+ * @return 0 on success, -ENODEV if the backend is not ready.
+ */
+int log_backend_retention_clear(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_RETENTION_H_ */
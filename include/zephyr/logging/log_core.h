@@ -12,6 +12,8 @@
 #include <stdint.h>
 #include <stdarg.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/iterable_sections.h>
 
 /* This header file keeps all macros and functions needed for creating logging
  * messages (macros like @ref LOG_ERR).
@@ -192,6 +194,50 @@ static inline char z_log_minimal_level_to_char(int level)
 
 #define Z_LOG_INST(_inst) COND_CODE_1(CONFIG_LOG, (_inst), NULL)
 
+/** @internal
+ * @brief Rate limiting state of a logging call site.
+ */
+struct log_ratelimit {
+	/* Time window in the upper bits, messages in the window in the lower
+	 * bits.
+	 */
+	atomic_t state;
+
+	/* Source and level of the call site, set when it starts suppressing
+	 * messages.
+	 */
+	const void *source;
+	uint8_t level;
+};
+
+/** @internal
+ * @brief Check the rate limit of a call site.
+ *
+ * @param rl Rate limiting state of the call site.
+ * @param source Source of the message.
+ * @param level Level of the message.
+ *
+ * @return true if the message can be logged.
+ */
+bool z_log_ratelimit_check(struct log_ratelimit *rl, const void *source,
+			   uint8_t level);
+
+/** @internal
+ * @brief Rate limit the call site of a logging macro.
+ *
+ * The state is kernel memory, user mode messages are not rate limited.
+ */
+#ifdef CONFIG_LOG_RATELIMIT
+#define Z_LOG_RATELIMIT(_src, _level, _is_user_context) \
+	static STRUCT_SECTION_ITERABLE(log_ratelimit, _log_rl); \
+	if (!(_is_user_context) && \
+	    !z_log_ratelimit_check(&_log_rl, _src, _level)) { \
+		break; \
+	}
+#else
+#define Z_LOG_RATELIMIT(_src, _level, _is_user_context)
+#endif
+
 /*****************************************************************************/
 /****************** Macros for standard logging ******************************/
 /*****************************************************************************/
@@ -236,6 +282,7 @@ static inline char z_log_minimal_level_to_char(int level)
 	int _mode; \
 	void *_src = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? \
 		(void *)_dsource : (void *)_source; \
+	Z_LOG_RATELIMIT(_src, _level, is_user_context); \
 	Z_LOG_MSG_CREATE(UTIL_NOT(IS_ENABLED(CONFIG_USERSPACE)), _mode, \
 				  Z_LOG_LOCAL_DOMAIN_ID, _src, _level, NULL,\
 			  0, __VA_ARGS__); \
@@ -312,6 +359,7 @@ static inline char z_log_minimal_level_to_char(int level)
 	int mode; \
 	void *_src = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? \
 		(void *)_dsource : (void *)_source; \
+	Z_LOG_RATELIMIT(_src, _level, is_user_context); \
 	Z_LOG_MSG_CREATE(UTIL_NOT(IS_ENABLED(CONFIG_USERSPACE)), mode, \
 				  Z_LOG_LOCAL_DOMAIN_ID, _src, _level, \
 			  _data, _len, \
@@ -94,6 +94,19 @@ __syscall bool log_process(void);
  */
 __syscall uint32_t log_buffered_cnt(void);
 
+/**
+ * @brief Get number of messages of a CPU which were dropped.
+ *
+ * Messages are counted per CPU only with CONFIG_LOG_PERCPU_BUFFERS, the
+ * function returns 0 otherwise. The count is not cleared when the drops are
+ * reported to the backends.
+ *
+ * @param cpu CPU index.
+ *
+ * @return Number of messages dropped since the logger was initialized.
+ */
+uint32_t log_cpu_dropped_cnt_get(unsigned int cpu);
+
 /** @brief Get number of independent logger sources (modules and instances)
  *
  * @param domain_id Domain ID.
@@ -47,6 +47,20 @@ struct log_dict_output_dropped_msg_t {
 	uint16_t num_dropped_messages;
 } __packed;
 
+/**
+ * With CONFIG_LOG_DICTIONARY_COMPACT, a message starts with one byte
+ * holding the type in bits 0-1, the domain in bits 2-4 and the level in
+ * bits 5-7. It is followed by unsigned LEB128 variable length integers:
+ * package length, data length, source ID and timestamp for a normal
+ * message, number of dropped messages for a dropped message.
+ */
+#define LOG_DICT_OUTPUT_COMPACT_TYPE_MASK 0x3
+#define LOG_DICT_OUTPUT_COMPACT_DOMAIN_POS 2
+#define LOG_DICT_OUTPUT_COMPACT_LEVEL_POS 5
+
+/** Largest compact header: type byte, two lengths and two 64-bit values. */
+#define LOG_DICT_OUTPUT_COMPACT_HDR_MAX_LEN (1 + 2 + 2 + 10 + 10)
+
 /** @brief Process log messages v2 for dictionary-based logging.
  *
  * Function is using provided context with the buffer and output function to
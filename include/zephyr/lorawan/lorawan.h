@@ -157,8 +157,9 @@ struct lorawan_downlink_cb {
 	/**
 	 * @brief Callback function to run on downlink data
 	 *
-	 * @note Callbacks are run on the system workqueue,
-	 *       and should therefore be as short as possible.
+	 * @note Callbacks are run on the system workqueue, or on a dedicated
+	 *       work queue with CONFIG_LORAWAN_DOWNLINK_WORKQ, and should
+	 *       therefore be as short as possible.
 	 *
 	 * @param port Port message was sent on
 	 * @param data_pending Network server has more downlink packets pending
@@ -330,6 +331,60 @@ void lorawan_get_payload_sizes(uint8_t *max_next_payload_size,
  */
 int lorawan_set_region(enum lorawan_region region);
 
+#ifdef CONFIG_LORAWAN_TX_QUEUE
+
+/**
+ * @brief Queue the uplink ahead of queued uplinks sent without this flag
+ */
+#define LORAWAN_SEND_PRIORITY BIT(0)
+
+/**
+ * @brief Allow merging the payload into a queued uplink
+ *
+ * The payload is appended to the last queued uplink which has not been sent
+ * yet, if it was also queued with this flag and has the same port, message
+ * type, callback and user data, and if the merged payload fits into the next
+ * uplink. The callback is then called once for the merged uplink.
+ */
+#define LORAWAN_SEND_COALESCE BIT(1)
+
+/**
+ * @brief Callback called once a queued uplink was sent
+ *
+ * @param err       0 if the uplink was sent, negative errno code of
+ *                  lorawan_send() otherwise
+ * @param user_data User data passed to lorawan_send_async()
+ */
+typedef void (*lorawan_send_cb_t)(int err, void *user_data);
+
+/**
+ * @brief Queue data to be sent to the LoRaWAN network
+ *
+ * The data is copied and sent with lorawan_send() from a dedicated work
+ * queue, the function does not wait for the MAC to be idle. Uplinks are sent
+ * in the order they are queued, except for @ref LORAWAN_SEND_PRIORITY.
+ *
+ * @param port      Port to be used for sending data
+ * @param data      Data buffer to be sent
+ * @param len       Length of the buffer, at most
+ *                  CONFIG_LORAWAN_TX_QUEUE_MAX_PAYLOAD bytes
+ * @param type      Specifies if the message shall be confirmed or unconfirmed
+ * @param flags     @ref LORAWAN_SEND_PRIORITY and @ref LORAWAN_SEND_COALESCE
+ * @param cb        Callback called from the work queue once the uplink was
+ *                  sent, may be NULL
+ * @param user_data User data passed to the callback
+ *
+ * @retval 0 if the data was queued
+ * @retval -EINVAL if @p data is NULL
+ * @retval -EMSGSIZE if @p len exceeds the maximum queued payload size
+ * @retval -ENOMEM if the queue is full
+ */
+int lorawan_send_async(uint8_t port, const uint8_t *data, uint8_t len,
+		       enum lorawan_message_type type, uint8_t flags,
+		       lorawan_send_cb_t cb, void *user_data);
+
+#endif /* CONFIG_LORAWAN_TX_QUEUE */
+
 #ifdef CONFIG_LORAWAN_APP_CLOCK_SYNC
 
 /**
@@ -178,6 +178,7 @@ struct img_mgmt_upload_req {
 	struct zcbor_string img_data;
 	struct zcbor_string data_sha;
 	bool upgrade;			/* Only allow greater version numbers. */
+	bool delta;			/* Data is a delta patch. */
 };
 
 /** Global state for upload in progress. */
@@ -191,6 +192,10 @@ struct img_mgmt_state {
 	/** Hash of image data; used for resumption of a partial upload. */
 	uint8_t data_sha_len;
 	uint8_t data_sha[IMG_MGMT_DATA_SHA_LEN];
+	/** Whether the data is a delta patch, see CONFIG_MCUMGR_GRP_IMG_DELTA. */
+	bool delta;
+	/** Flash area holding the image the delta patch applies to. */
+	int delta_src_area_id;
 };
 
 /** Describes what to do during processing of an upload request. */
@@ -205,6 +210,8 @@ struct img_mgmt_upload_action {
 	bool proceed;
 	/** Whether to erase the destination flash area. */
 	bool erase;
+	/** The size of the image rebuilt from a delta patch. */
+	size_t delta_size;
 #ifdef CONFIG_MCUMGR_GRP_IMG_VERBOSE_ERR
 	/** "rsn" string to be sent as explanation for "rc" code */
 	const char *rc_rsn;
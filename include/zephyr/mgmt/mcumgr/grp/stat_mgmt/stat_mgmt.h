@@ -17,6 +17,7 @@ extern "C" {
  */
 #define STAT_MGMT_ID_SHOW   0
 #define STAT_MGMT_ID_LIST   1
+#define STAT_MGMT_ID_PERF   2
 
 /**
  * Command result codes for statistics management group.
@@ -14,6 +14,7 @@ extern "C" {
  * Command IDs for zephyr basic management group.
  */
 #define ZEPHYR_MGMT_GRP_BASIC_CMD_ERASE_STORAGE	0	/* Command to erase storage partition */
+#define ZEPHYR_MGMT_GRP_BASIC_CMD_RETAINED_LOGS	1	/* Command to read retained logs */
 
 /**
  * Command result codes for statistics management group.
@@ -33,6 +34,9 @@ enum zephyr_basic_group_ret_code_t {
 
 	/** Erasing the flash area has failed. */
 	ZEPHYR_MGMT_GRP_CMD_RC_FLASH_ERASE_FAILED,
+
+	/** The retained memory log backend is not ready. */
+	ZEPHYR_MGMT_GRP_CMD_RC_RETAINED_LOGS_NOT_READY,
 };
 
 #ifdef __cplusplus
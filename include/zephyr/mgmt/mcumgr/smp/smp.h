@@ -60,6 +60,14 @@ struct cbor_nb_writer {
 	uint16_t error_group;
 	uint16_t error_ret;
 #endif
+
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+	/* Buffer being encoded, the last one chained to nb */
+	struct net_buf *frag;
+	/* Transport and request further buffers are allocated for */
+	struct smp_transport *smpt;
+	const struct net_buf *req;
+#endif
 };
 
 /**
@@ -121,6 +129,31 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *req);
  */
 bool smp_add_cmd_ret(zcbor_state_t *zse, uint16_t group, uint16_t ret);
 
+/**
+ * @brief Makes room for the next part of a pending outgoing response
+ *
+ * Handlers encoding responses of unbounded size call this before each entry. If less than
+ * @p len bytes are left in the current buffer and CONFIG_MCUMGR_SMP_STREAMING_RESPONSE is
+ * enabled for a transport which supports it, the encoding continues in a new buffer of the SMP
+ * pool. Otherwise, this has no effect and the entry is encoded in the space that is left.
+ *
+ * @param zse		The zcbor encoder to use.
+ * @param len		Maximum encoded size of the next entry.
+ *
+ * @return true on success, false if no buffer could be allocated.
+ */
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+bool smp_stream_reserve(zcbor_state_t *zse, size_t len);
+#else
+static inline bool smp_stream_reserve(zcbor_state_t *zse, size_t len)
+{
+	ARG_UNUSED(zse);
+	ARG_UNUSED(len);
+
+	return true;
+}
+#endif
+
 #if IS_ENABLED(CONFIG_MCUMGR_SMP_SUPPORT_ORIGINAL_PROTOCOL)
 /** @typedef	smp_translate_error_fn
  * @brief	Translates a SMP version 2 error response to a legacy SMP version 1 error code.
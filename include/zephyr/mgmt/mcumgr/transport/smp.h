@@ -125,6 +125,13 @@ struct smp_transport {
 	/* Function pointers */
 	struct smp_transport_api_t functions;
 
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+	/* Set if the buffers of a response can be output one after the other, the peer
+	 * reassembling it from the length in its header.
+	 */
+	bool fragmented_output;
+#endif
+
 #ifdef CONFIG_MCUMGR_TRANSPORT_REASSEMBLY
 	/* Packet reassembly internal data, API access only */
 	struct {
@@ -360,6 +360,65 @@ struct modbus_user_callbacks {
 	int (*holding_reg_wr_fp)(uint16_t addr, float reg);
 };
 
+/**
+ * @brief Modbus server table type
+ */
+enum modbus_table_type {
+	/** Coils, read with FC01 and written with FC05 and FC15 */
+	MODBUS_TABLE_COILS,
+	/** Discrete inputs, read with FC02 */
+	MODBUS_TABLE_DISCRETE_INPUTS,
+	/** Input registers, read with FC04 */
+	MODBUS_TABLE_INPUT_REGS,
+	/** Holding registers, read with FC03 and written with FC06 and FC16 */
+	MODBUS_TABLE_HOLDING_REGS,
+};
+
+struct modbus_table;
+
+/**
+ * @brief Modbus server table callback
+ *
+ * @param table      Table being accessed
+ * @param addr       Address of the first coil, input or register accessed
+ * @param num        Number of coils, inputs or registers accessed
+ *
+ * @retval           0 If the access can proceed, a negative value makes the
+ *                   server respond with a Server Device Failure exception
+ */
+typedef int (*modbus_table_cb_t)(const struct modbus_table *table,
+				 uint16_t addr, uint16_t num);
+
+/**
+ * @brief Modbus server table
+ *
+ * A table maps a contiguous range of addresses to memory. Requests which
+ * fall completely within a table are served from the memory, with at most
+ * one callback per request instead of one call of the
+ * @ref modbus_user_callbacks per coil or register. Tables take precedence
+ * over the user callbacks, including the floating-point register range.
+ */
+struct modbus_table {
+	/** Type of the table */
+	enum modbus_table_type type;
+	/** Address of the first coil, input or register */
+	uint16_t addr;
+	/** Number of coils, inputs or registers */
+	uint16_t num;
+	/**
+	 * Table data. Registers are an array of uint16_t in CPU byte order,
+	 * coils and discrete inputs are packed 8 per byte, starting with the
+	 * least significant bit of the first byte.
+	 */
+	void *data;
+	/** Called before the data is read, e.g. to update it, may be NULL */
+	modbus_table_cb_t read_cb;
+	/** Called after the data was written, e.g. to apply it, may be NULL */
+	modbus_table_cb_t write_cb;
+	/** User data of the table */
+	void *user_data;
+};
+
 /**
  * @brief Get Modbus interface index according to interface name
  *
@@ -421,10 +480,14 @@ struct modbus_serial_param {
  * @brief Modbus server parameter
  */
 struct modbus_server_param {
-	/** Pointer to the User Callback structure */
+	/** Pointer to the User Callback structure, may be NULL if tables are used */
 	struct modbus_user_callbacks *user_cb;
 	/** Modbus unit ID of the server */
 	uint8_t unit_id;
+	/** Memory backed tables of the server, see @ref modbus_table */
+	const struct modbus_table *tables;
+	/** Number of tables */
+	size_t num_tables;
 };
 
 struct modbus_raw_cb {
@@ -95,6 +95,12 @@ struct shared_multi_heap_region {
 
 	/** Memory heap size in bytes */
 	size_t size;
+
+	/**
+	 * Latency class of the memory, zero being the fastest.  Among
+	 * the regions with the same attribute, faster ones are used first.
+	 */
+	unsigned int latency;
 };
 
 /**
@@ -145,6 +151,24 @@ void *shared_multi_heap_alloc(enum shared_multi_heap_attr attr, size_t bytes);
 void *shared_multi_heap_aligned_alloc(enum shared_multi_heap_attr attr,
 				      size_t align, size_t bytes);
 
+/**
+ * @brief Move a block to a faster region
+ *
+ * Moves a block allocated with @p attr to the fastest region with the
+ * same attribute that has room for it, if that region has a lower
+ * latency class than the one holding the block.  All references to the
+ * block must be updated to the returned pointer.
+ *
+ * @param attr		capability / attribute the block was allocated with.
+ * @param block		block allocated by shared_multi_heap_alloc or
+ *			shared_multi_heap_aligned_alloc.
+ * @param align		alignment the block was allocated with, or zero.
+ * @retval ptr		the new address of the block, or @p block if it was
+ *			not moved.
+ */
+void *shared_multi_heap_migrate(enum shared_multi_heap_attr attr, void *block,
+				size_t align);
+
 /**
  * @brief Free memory from the shared multi-heap pool
  *
@@ -1288,6 +1288,51 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
 						k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate several variable length buffers from a pool.
+ *
+ * Allocates up to @a count buffers, each able to fit @a size bytes,
+ * claiming unused buffers from the pool under a single lock.  Returns as
+ * many buffers as are available without waiting; only if none is does
+ * it wait for a single buffer as net_buf_alloc_len() would.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param size Amount of data each buffer must be able to fit.
+ * @param bufs Array of at least @a count entries, filled in with the
+ *        buffers allocated.
+ * @param count Maximum number of buffers to allocate.
+ * @param timeout Affects the action taken should the pool be empty.
+ *        If K_NO_WAIT, then return immediately. If K_FOREVER, then
+ *        wait as long as necessary. Otherwise, wait until the specified
+ *        timeout.
+ *
+ * @return Number of buffers allocated, or 0 if @a count is 0.
+ * @retval -ENOMEM No buffer could be allocated.
+ */
+int __must_check net_buf_alloc_len_bulk(struct net_buf_pool *pool, size_t size,
+					struct net_buf **bufs, int count,
+					k_timeout_t timeout);
+
+/**
+ * @brief Allocate several fixed buffers from a pool.
+ *
+ * Same as net_buf_alloc_len_bulk() with the data size of the
+ * fixed-size pool.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param bufs Array of at least @a count entries, filled in with the
+ *        buffers allocated.
+ * @param count Maximum number of buffers to allocate.
+ * @param timeout Affects the action taken should the pool be empty,
+ *        see net_buf_alloc_len_bulk().
+ *
+ * @return Number of buffers allocated, or 0 if @a count is 0.
+ * @retval -ENOMEM No buffer could be allocated.
+ */
+int __must_check net_buf_alloc_bulk(struct net_buf_pool *pool,
+				    struct net_buf **bufs, int count,
+				    k_timeout_t timeout);
+
 /**
  * @brief Allocate a new buffer from a pool but with external data pointer.
  *
@@ -1429,6 +1474,19 @@ void net_buf_unref_debug(struct net_buf *buf, const char *func, int line);
 void net_buf_unref(struct net_buf *buf);
 #endif
 
+/**
+ * @brief Decrements the reference count of several buffers.
+ *
+ * Same as calling net_buf_unref() on each buffer, except that buffers
+ * reaching a zero reference count are returned to their pool in
+ * batches, with a single queue operation for each run of buffers from
+ * the same pool.
+ *
+ * @param bufs Array of @a count valid buffer pointers.
+ * @param count Number of buffers.
+ */
+void net_buf_unref_bulk(struct net_buf **bufs, int count);
+
 /**
  * @brief Increment the reference count of a buffer.
  *
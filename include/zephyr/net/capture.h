@@ -201,13 +201,22 @@ static inline int net_capture_send(const struct device *dev, struct net_if *ifac
  * @param iface Network interface the packet is being sent
  * @param pkt The network packet that is sent
  */
+#if defined(CONFIG_NET_CAPTURE_RING)
+void net_capture_ring_pkt(struct net_if *iface, struct net_pkt *pkt);
+#else
+static inline void net_capture_ring_pkt(struct net_if *iface, struct net_pkt *pkt)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+}
+#endif
+
 #if defined(CONFIG_NET_CAPTURE)
 void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt);
 #else
 static inline void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 {
-	ARG_UNUSED(iface);
-	ARG_UNUSED(pkt);
+	net_capture_ring_pkt(iface, pkt);
 }
 #endif
 
@@ -250,6 +259,84 @@ static inline void net_capture_foreach(net_capture_cb_t cb, void *user_data)
 
 /** @endcond */
 
+/**
+ * @typedef net_capture_ring_write_cb_t
+ * @brief Callback used to write the exported capture ring
+ *
+ * @param data Chunk of the pcapng data
+ * @param len Length of the chunk
+ * @param user_data A valid pointer to user data or NULL
+ *
+ * @return 0 if ok, <0 to stop the export
+ */
+typedef int (*net_capture_ring_write_cb_t)(const void *data, size_t len,
+					   void *user_data);
+
+/**
+ * @brief Start or stop recording packets in the capture ring.
+ *
+ * @param enable True to start recording, false to stop
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+void net_capture_ring_enable(bool enable);
+#else
+static inline void net_capture_ring_enable(bool enable)
+{
+	ARG_UNUSED(enable);
+}
+#endif
+
+/**
+ * @brief Check if packets are recorded in the capture ring.
+ *
+ * @return True if recording, false otherwise
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+bool net_capture_ring_is_enabled(void);
+#else
+static inline bool net_capture_ring_is_enabled(void)
+{
+	return false;
+}
+#endif
+
+/**
+ * @brief Remove all the packets recorded in the capture ring.
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+void net_capture_ring_clear(void);
+#else
+static inline void net_capture_ring_clear(void)
+{
+}
+#endif
+
+/**
+ * @brief Export the packets recorded in the capture ring.
+ *
+ * @details The packets are written in pcapng format, oldest first, with
+ *          one interface description block per network interface. The
+ *          recording continues during the export; packets overwritten
+ *          while being exported are skipped.
+ *
+ * @param cb Callback called with each chunk of the pcapng data
+ * @param user_data User supplied data
+ *
+ * @return Number of packets exported, <0 if the export failed
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+int net_capture_ring_export(net_capture_ring_write_cb_t cb, void *user_data);
+#else
+static inline int net_capture_ring_export(net_capture_ring_write_cb_t cb,
+					  void *user_data)
+{
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @}
  */
@@ -46,6 +46,27 @@ typedef void (*coap_client_response_cb_t)(int16_t result_code,
 					  size_t offset, const uint8_t *payload, size_t len,
 					  bool last_block, void *user_data);
 
+/**
+ * @typedef coap_client_payload_cb_t
+ * @brief Callback providing the payload of a CoAP request.
+ *
+ * An alternative to a payload buffer, for payloads which are too large to be held in RAM.
+ * The callback is called each time a message of the request is built, with an increasing
+ * offset. The payload is sent blockwise unless the first call sets @p last_block, so every
+ * block except the last one must be exactly @p len bytes long. The callback may be called
+ * again with the same offset when a message is retransmitted.
+ *
+ * @param offset Payload offset from the beginning of the request.
+ * @param payload Set to the payload of the block. Only needs to be valid during the call.
+ * @param len Maximum length of the block on input, length of the block on output.
+ * @param last_block Set to true if this is the last block of the payload.
+ * @param user_data User provided context.
+ *
+ * @return Zero on success, otherwise a negative error code which aborts the request.
+ */
+typedef int (*coap_client_payload_cb_t)(size_t offset, const uint8_t **payload, size_t *len,
+					bool *last_block, void *user_data);
+
 /**
  * @brief Representation of a CoAP client request.
  */
@@ -56,6 +77,7 @@ struct coap_client_request {
 	enum coap_content_format fmt;       /**< Content format to be used */
 	uint8_t *payload;	            /**< User allocated buffer for send request */
 	size_t len;		            /**< Length of the payload */
+	coap_client_payload_cb_t payload_cb; /**< Optional payload callback, instead of payload */
 	coap_client_response_cb_t cb;       /**< Callback when response received */
 	struct coap_client_option *options; /**< Extra options to be added to request */
 	uint8_t num_options;                /**< Number of extra options */
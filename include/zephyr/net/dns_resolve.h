@@ -240,6 +240,13 @@ struct dns_resolve_context {
 		 * cannot be used to find correct pending query.
 		 */
 		uint16_t query_hash;
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+		/** Query whose answer is shared with this one, which is then
+		 * not sent to the servers.
+		 */
+		struct dns_pending_query *leader;
+#endif
 	} queries[CONFIG_DNS_NUM_CONCUR_QUERIES];
 
 	/** Is this context in use */
@@ -377,6 +384,36 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 		     void *user_data,
 		     int32_t timeout);
 
+/**
+ * DNS answer cache statistics.
+ */
+struct dns_resolve_cache_stats {
+	/** Names answered from the cache */
+	uint32_t hits;
+	/** Names answered as non-existent from the cache */
+	uint32_t negative_hits;
+	/** Names not found in the cache */
+	uint32_t misses;
+	/** Names queried again before their cached addresses expired */
+	uint32_t prefetches;
+};
+
+/**
+ * @brief Get the statistics of the DNS answer cache.
+ *
+ * @details Requires :kconfig:option:`CONFIG_DNS_RESOLVER_CACHE`.
+ *
+ * @param stats Statistics to fill.
+ */
+void dns_resolve_cache_get_stats(struct dns_resolve_cache_stats *stats);
+
+/**
+ * @brief Remove all the answers from the DNS answer cache.
+ *
+ * @details Requires :kconfig:option:`CONFIG_DNS_RESOLVER_CACHE`.
+ */
+void dns_resolve_cache_flush(void);
+
 /**
  * @brief Get default DNS context.
  *
@@ -179,6 +179,12 @@ enum ethernet_hw_caps {
 
 	/** TXTIME supported */
 	ETHERNET_TXTIME			= BIT(19),
+
+	/** TCP segmentation offload supported, packets with a non-zero
+	 * net_pkt_gso_size() are split into segments of that size by the
+	 * driver
+	 */
+	ETHERNET_HW_TX_TSO		= BIT(20),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -468,6 +474,17 @@ struct ethernet_api {
 
 	/** Send a network packet */
 	int (*send)(const struct device *dev, struct net_pkt *pkt);
+
+#if defined(CONFIG_NET_NAPI)
+	/** Receive at most budget frames from the RX ring with
+	 * net_recv_data(), and return their number. Optional, a driver
+	 * which sets it schedules the polling with net_eth_napi_schedule()
+	 * instead of receiving the frames from its interrupt handler. When
+	 * the ring is empty, the driver calls net_eth_napi_complete() and
+	 * then re-enables its RX interrupt.
+	 */
+	int (*poll)(const struct device *dev, int budget);
+#endif /* CONFIG_NET_NAPI */
 };
 
 /* Make sure that the network interface API is properly setup inside
@@ -614,6 +631,11 @@ struct ethernet_context {
 
 	/** Types of Ethernet network interfaces */
 	enum ethernet_if_types eth_if_type;
+
+#if defined(CONFIG_NET_NAPI)
+	/** RX polling context, used if the driver has a poll function */
+	struct net_napi napi;
+#endif
 };
 
 /**
@@ -970,6 +992,38 @@ void net_eth_carrier_on(struct net_if *iface);
  */
 void net_eth_carrier_off(struct net_if *iface);
 
+#if defined(CONFIG_NET_NAPI) || defined(__DOXYGEN__)
+/**
+ * @brief Schedule the RX polling of an ethernet driver.
+ *
+ * Called from the RX interrupt handler of a driver which implements the
+ * poll function of its API, after masking the RX interrupt.
+ *
+ * @param iface Network interface
+ */
+static inline void net_eth_napi_schedule(struct net_if *iface)
+{
+	struct ethernet_context *ctx = net_if_l2_data(iface);
+
+	net_napi_schedule(&ctx->napi);
+}
+
+/**
+ * @brief Tell that the RX ring of an ethernet driver is empty.
+ *
+ * Called from the poll function of the driver, before re-enabling the RX
+ * interrupt.
+ *
+ * @param iface Network interface
+ */
+static inline void net_eth_napi_complete(struct net_if *iface)
+{
+	struct ethernet_context *ctx = net_if_l2_data(iface);
+
+	net_napi_complete(&ctx->napi);
+}
+#endif /* CONFIG_NET_NAPI */
+
 /**
  * @brief Set promiscuous mode either ON or OFF.
  *
@@ -0,0 +1,222 @@
+/** @file
+ * @brief HTTP server API
+ */
+
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_
+#define ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_
+
+/**
+ * @brief HTTP server API
+ * @defgroup http_server HTTP server API
+ * @ingroup networking
+ * @{
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/net/http/method.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/net/http/status.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** HTTP client connection, opaque to the resource handlers */
+struct http_client_ctx;
+
+/** Type of an HTTP resource */
+enum http_resource_type {
+	/** Constant data, see @ref http_resource_detail_static */
+	HTTP_RESOURCE_TYPE_STATIC,
+
+	/** Data generated by a callback, see @ref http_resource_detail_dynamic */
+	HTTP_RESOURCE_TYPE_DYNAMIC,
+
+	/** File of a mounted file system, see @ref http_resource_detail_file */
+	HTTP_RESOURCE_TYPE_FILE,
+
+	/** Websocket endpoint, see @ref http_resource_detail_websocket */
+	HTTP_RESOURCE_TYPE_WEBSOCKET,
+};
+
+/**
+ * @brief Common detail of the HTTP resources
+ *
+ * The detail given to HTTP_RESOURCE_DEFINE() must be one of the
+ * http_resource_detail_* structures, which all start with this one.
+ */
+struct http_resource_detail {
+	/** Bitmask of the accepted methods, BIT(HTTP_GET) and so on */
+	uint32_t bitmask_of_supported_http_methods;
+
+	/** Type of the resource */
+	enum http_resource_type type;
+
+	/** Content-Type header of the responses, or NULL */
+	const char *content_type;
+
+	/** Content-Encoding header of the responses, or NULL */
+	const char *content_encoding;
+};
+
+/** Detail of a resource of type @ref HTTP_RESOURCE_TYPE_STATIC */
+struct http_resource_detail_static {
+	struct http_resource_detail common;
+
+	/** Body of the responses */
+	const void *static_data;
+
+	/** Length of the body */
+	size_t static_data_len;
+};
+
+/**
+ * @typedef http_resource_dynamic_cb_t
+ * @brief Handler of a dynamic HTTP resource.
+ *
+ * The handler is invoked for each part of the request body as it is
+ * received, then once more with @p final set when the whole request has
+ * been received. It responds with http_server_response_begin(),
+ * http_server_response_write() and http_server_response_end(), at any
+ * time. If it did not start a response once the request is complete, a
+ * "204 No Content" response is sent.
+ *
+ * @param client Client connection.
+ * @param data Part of the request body, NULL if @p len is 0.
+ * @param len Length of the part.
+ * @param final The whole request has been received.
+ * @param user_data User data of the resource.
+ *
+ * @return 0 if ok, <0 to answer the request with an error.
+ */
+typedef int (*http_resource_dynamic_cb_t)(struct http_client_ctx *client,
+					  const uint8_t *data, size_t len,
+					  bool final, void *user_data);
+
+/** Detail of a resource of type @ref HTTP_RESOURCE_TYPE_DYNAMIC */
+struct http_resource_detail_dynamic {
+	struct http_resource_detail common;
+
+	/** Request handler */
+	http_resource_dynamic_cb_t cb;
+
+	/** User data given to the handler */
+	void *user_data;
+};
+
+/** Detail of a resource of type @ref HTTP_RESOURCE_TYPE_FILE */
+struct http_resource_detail_file {
+	struct http_resource_detail common;
+
+	/** Path of the file, for example "/lfs/index.html" */
+	const char *path;
+};
+
+/**
+ * @typedef http_resource_websocket_cb_t
+ * @brief Handler of a Websocket HTTP resource.
+ *
+ * Invoked once the connection has been upgraded. The handler owns the
+ * Websocket until it returns and must close it with websocket_disconnect()
+ * before that. The server then closes the underlying connection.
+ *
+ * @param ws_sock Websocket id, see websocket_send_msg() and
+ *        websocket_recv_msg().
+ * @param user_data User data of the resource.
+ */
+typedef void (*http_resource_websocket_cb_t)(int ws_sock, void *user_data);
+
+/** Detail of a resource of type @ref HTTP_RESOURCE_TYPE_WEBSOCKET */
+struct http_resource_detail_websocket {
+	struct http_resource_detail common;
+
+	/** Websocket handler */
+	http_resource_websocket_cb_t cb;
+
+	/** User data given to the handler */
+	void *user_data;
+};
+
+/**
+ * @brief Start the HTTP server.
+ *
+ * Opens the listening socket of every service defined with
+ * HTTP_SERVICE_DEFINE() and starts the worker threads which serve the
+ * clients. The services must be bound to an IPv4 or IPv6 address.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int http_server_start(void);
+
+/**
+ * @brief Get the method of the request being served.
+ *
+ * @param client Client connection.
+ *
+ * @return Request method.
+ */
+enum http_method http_server_request_method(struct http_client_ctx *client);
+
+/**
+ * @brief Get the URL of the request being served.
+ *
+ * @param client Client connection.
+ *
+ * @return Request URL, including the query.
+ */
+const char *http_server_request_url(struct http_client_ctx *client);
+
+/**
+ * @brief Start the response of a dynamic resource.
+ *
+ * Sends the status line and the headers. The body then follows in chunks,
+ * unless the client only talks HTTP/1.0, in which case the connection is
+ * closed at the end of the response.
+ *
+ * @param client Client connection.
+ * @param status Response status.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int http_server_response_begin(struct http_client_ctx *client,
+			       enum http_status status);
+
+/**
+ * @brief Send a part of the response body.
+ *
+ * @param client Client connection.
+ * @param data Data to send.
+ * @param len Length of the data.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int http_server_response_write(struct http_client_ctx *client,
+			       const void *data, size_t len);
+
+/**
+ * @brief End the response of a dynamic resource.
+ *
+ * @param client Client connection.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+int http_server_response_end(struct http_client_ctx *client);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_ */
@@ -2257,5 +2257,20 @@ int lwm2m_security_mode(struct lwm2m_ctx *ctx);
  */
 int lwm2m_set_default_sockopt(struct lwm2m_ctx *ctx);
 
+/**
+ * @brief Expose the performance histograms in a BinaryAppDataContainer.
+ *
+ * Creates the instance @p obj_inst_id of the BinaryAppDataContainer object
+ * (19) if it does not exist, and the instance 0 of its Data resource, which
+ * reads as all the histograms encoded by perf_stats_encode_all(). To be called
+ * once per object instance.
+ *
+ * Requires CONFIG_LWM2M_PERF_STATS.
+ *
+ * @param obj_inst_id Object instance ID.
+ * @return 0 for success or negative in case of error.
+ */
+int lwm2m_perf_stats_register(uint16_t obj_inst_id);
+
 #endif	/* ZEPHYR_INCLUDE_NET_LWM2M_H_ */
 /**@}  */
@@ -450,6 +450,22 @@ struct mqtt_transport {
 #endif
 };
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+/** @brief Internal. Publication waiting for an acknowledgment. */
+struct mqtt_inflight_msg {
+	/** Publication. The topic and payload belong to the application. */
+	struct mqtt_publish_param param;
+
+	/** Wall clock value (in milliseconds) when the packet was last
+	 *  sent.
+	 */
+	uint32_t sent_at;
+
+	/** Packet waiting for an acknowledgment, 0 if the entry is free. */
+	uint8_t state;
+};
+#endif /* CONFIG_MQTT_INFLIGHT */
+
 /** @brief MQTT internal state. */
 struct mqtt_internal {
 	/** Internal. Mutex to protect access to the client instance. */
@@ -468,6 +484,14 @@ struct mqtt_internal {
 
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
+
+#if defined(CONFIG_MQTT_INFLIGHT)
+	/** Internal. QoS 1 and QoS 2 publications not acknowledged yet. */
+	struct mqtt_inflight_msg inflight[CONFIG_MQTT_INFLIGHT_WINDOW];
+
+	/** Internal. Last message id allocated to a publication. */
+	uint16_t last_message_id;
+#endif /* CONFIG_MQTT_INFLIGHT */
 };
 
 /**
@@ -597,16 +621,49 @@ int mqtt_connect(struct mqtt_client *client);
 /**
  * @brief API to publish messages on topics.
  *
+ * The payload is sent from the application buffer, it is not copied.
+ *
+ * With @kconfig{CONFIG_MQTT_INFLIGHT}, QoS 1 and QoS 2 publications are kept
+ * until they are acknowledged, and sent again by @ref mqtt_live if the
+ * acknowledgment does not come in time, or after reconnecting to a session
+ * that is still present on the broker. The topic and the payload shall then
+ * stay valid until @ref MQTT_EVT_PUBACK or @ref MQTT_EVT_PUBCOMP. A message
+ * id of 0 is replaced by a free one, and PUBREL is sent by the library.
+ *
  * @param[in] client Client instance for which the procedure is requested.
  *                   Shall not be NULL.
  * @param[in] param Parameters to be used for the publish message.
  *                  Shall not be NULL.
  *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ *         With @kconfig{CONFIG_MQTT_INFLIGHT}, -EAGAIN if
+ *         @kconfig{CONFIG_MQTT_INFLIGHT_WINDOW} publications are waiting for
+ *         an acknowledgment, and -EBUSY if the message id is in use.
  */
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to publish several messages with a single transport write.
+ *
+ * The headers of the messages are encoded one after the other in the
+ * transmit buffer, and sent together with the payloads, which are not
+ * copied. This saves a transport write and a TCP segment per message when
+ * publishing many small messages. Messages are handled as with
+ * @ref mqtt_publish.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] params Parameters of the publish messages. Shall not be NULL.
+ * @param[in] count Number of messages in @p params.
+ *
+ * @return Number of messages published, which is lower than @p count if
+ *         the in-flight window got full, or a negative error code (errno.h)
+ *         if none could be published.
+ */
+int mqtt_publish_bulk(struct mqtt_client *client,
+		      const struct mqtt_publish_param *params, size_t count);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
@@ -639,6 +696,9 @@ int mqtt_publish_qos2_receive(struct mqtt_client *client,
  * @brief API used by client to request release of QoS2 publish message.
  *        Should be called on reception of @ref MQTT_EVT_PUBREC.
  *
+ * @note With @kconfig{CONFIG_MQTT_INFLIGHT}, the release of messages published
+ *       by @ref mqtt_publish is already sent, and this call does nothing.
+ *
  * @param[in] client Client instance for which the procedure is requested.
  *                   Shall not be NULL.
  * @param[in] param Identifies message being released.
@@ -733,6 +793,8 @@ int mqtt_abort(struct mqtt_client *client);
  *        makes it possible to respect the Keep Alive time agreed with the
  *        broker on connection. @ref mqtt_connect for details on Keep Alive
  *        time.
+ * @note  With @kconfig{CONFIG_MQTT_INFLIGHT}, this function also sends again
+ *        the publications which are not acknowledged in time.
  *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
  */
@@ -746,7 +808,8 @@ int mqtt_live(struct mqtt_client *client);
  *
  * @return Time in milliseconds until next keep alive message is expected to
  *         be sent. Function will return -1 if keep alive messages are
- *         not enabled.
+ *         not enabled. With @kconfig{CONFIG_MQTT_INFLIGHT}, the time until
+ *         the next retransmission is returned if it is sooner.
  */
 int mqtt_keepalive_time_left(const struct mqtt_client *client);
 
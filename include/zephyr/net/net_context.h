@@ -282,6 +282,11 @@ __net_socket struct net_context {
 		/** Mutex used by condition variable */
 		struct k_mutex *lock;
 	} cond;
+
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	/** epoll instances watching the socket */
+	sys_slist_t epoll;
+#endif /* CONFIG_NET_SOCKETS_EPOLL */
 #endif /* CONFIG_NET_SOCKETS */
 
 #if defined(CONFIG_NET_OFFLOAD)
@@ -322,6 +327,14 @@ __net_socket struct net_context {
 #endif
 #if defined(CONFIG_NET_CONTEXT_DSCP_ECN)
 		uint8_t dscp_ecn;
+#endif
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+		struct {
+			net_context_zerocopy_cb_t cb;
+			void *user_data;
+			/** Identifier of the next zero-copy send */
+			uint32_t next_id;
+		} zerocopy;
 #endif
 	} options;
 
@@ -1073,6 +1086,30 @@ enum net_context_option {
 	NET_OPT_RCVBUF		= 6,
 	NET_OPT_SNDBUF		= 7,
 	NET_OPT_DSCP_ECN	= 8,
+	NET_OPT_ZEROCOPY	= 9,
+};
+
+/**
+ * @typedef net_context_zerocopy_cb_t
+ * @brief Completion callback of zero-copy sends
+ *
+ * @details Called once the network stack no longer references the data of
+ * a zero-copy send, so the application may reuse that memory. The call
+ * comes from the context releasing the last network buffer, possibly an
+ * interrupt handler, so it must not block.
+ *
+ * @param id Identifier of the send, sends are numbered from 0 for each
+ *           network context.
+ * @param user_data User data given with the callback.
+ */
+typedef void (*net_context_zerocopy_cb_t)(uint32_t id, void *user_data);
+
+/** Value of the NET_OPT_ZEROCOPY option */
+struct net_context_zerocopy {
+	/** Completion callback */
+	net_context_zerocopy_cb_t cb;
+	/** User data passed to the callback */
+	void *user_data;
 };
 
 /**
@@ -446,6 +446,56 @@ struct net_traffic_class {
 	k_thread_stack_t *stack;
 };
 
+#if defined(CONFIG_NET_NAPI) || defined(__DOXYGEN__)
+/**
+ * @brief Receive polling context of a network device.
+ *
+ * Instead of passing each received packet from its interrupt handler, a
+ * device masks its receive interrupt and schedules its polling context with
+ * net_napi_schedule(). The RX thread then calls the poll function with a
+ * budget, until the device reports that it has no more packets.
+ */
+struct net_napi {
+	/** Node in the list of the scheduled contexts */
+	sys_snode_t node;
+
+	/**
+	 * Receive at most @a budget packets. A device which has no more
+	 * packets must call net_napi_complete() before re-enabling its
+	 * receive interrupt, and is only polled again once scheduled again.
+	 * A device which did not call net_napi_complete() is polled again.
+	 * Returns the number of packets received.
+	 */
+	int (*poll)(struct net_napi *napi, int budget);
+
+	/** Whether the context is scheduled */
+	atomic_t scheduled;
+
+	/** Whether the poll function runs, internal to the network stack */
+	bool polling;
+};
+
+/**
+ * @brief Schedule the polling of a network device.
+ *
+ * Called from the interrupt handler of the device, after masking its
+ * receive interrupt. Does nothing if the context is already scheduled.
+ *
+ * @param napi Polling context of the device
+ */
+void net_napi_schedule(struct net_napi *napi);
+
+/**
+ * @brief Tell that a network device has no more packets to be polled.
+ *
+ * Called from the poll function, before the receive interrupt of the device
+ * is re-enabled.
+ *
+ * @param napi Polling context of the device
+ */
+void net_napi_complete(struct net_napi *napi);
+#endif /* CONFIG_NET_NAPI */
+
 /**
  * @typedef net_socket_create_t
 
@@ -2230,6 +2280,16 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface);
  */
 bool net_if_need_calc_tx_checksum(struct net_if *iface);
 
+/**
+ * @brief Check if the network interface segments TCP packets itself
+ *
+ * @param iface Network interface
+ *
+ * @return True if the driver splits packets with a non-zero
+ * net_pkt_gso_size() into TCP segments, false otherwise.
+ */
+bool net_if_tso_capable(struct net_if *iface);
+
 /**
  * @brief Get interface according to index
  *
@@ -161,6 +161,31 @@ struct net_mgmt_event_callback {
 		 */
 		uint32_t raised_event;
 	};
+
+#if defined(CONFIG_NET_MGMT_EVENT_WORKQ) || defined(__DOXYGEN__)
+	/** Work queue running the handler, or NULL to run it from the
+	 * network management thread. Set with
+	 * net_mgmt_event_callback_set_workq().
+	 */
+	struct k_work_q *workq;
+
+	/** Meant to be used internally, to run the handler from the work
+	 * queue on the pending events.
+	 */
+	struct k_work work;
+	sys_slist_t pending;
+
+	/** Merge an event with an identical event still pending, of the
+	 * same type and interface and with the same information.
+	 */
+	bool coalesce;
+
+	/** Number of events merged with a pending event */
+	uint32_t coalesced;
+
+	/** Number of events dropped as no entry was free to queue them */
+	uint32_t dropped;
+#endif /* CONFIG_NET_MGMT_EVENT_WORKQ */
 };
 
 /**
@@ -180,11 +205,36 @@ void net_mgmt_init_event_callback(struct net_mgmt_event_callback *cb,
 
 	cb->handler = handler;
 	cb->event_mask = mgmt_event_mask;
+#ifdef CONFIG_NET_MGMT_EVENT_WORKQ
+	cb->workq = NULL;
+#endif
 };
 #else
 #define net_mgmt_init_event_callback(...)
 #endif
 
+#if defined(CONFIG_NET_MGMT_EVENT_WORKQ) || defined(__DOXYGEN__)
+/**
+ * @brief Run the handler of a callback from a work queue
+ *
+ * Events are then copied to a pool of pending events, and the handler is run
+ * from the work queue instead of the network management thread, so that it
+ * does not delay the handlers of other callbacks. Must be called after
+ * net_mgmt_init_event_callback(), before adding the callback.
+ *
+ * net_mgmt_del_event_callback() waits for a running handler to return and
+ * drops the events still pending, so the callback can be freed or reused
+ * once it returned. The handler may delete its own callback, which then
+ * must stay valid until the handler returns.
+ *
+ * @param cb A valid application's callback structure pointer.
+ * @param workq Work queue running the handler.
+ * @param coalesce Merge an event with an identical event still pending.
+ */
+void net_mgmt_event_callback_set_workq(struct net_mgmt_event_callback *cb,
+				       struct k_work_q *workq, bool coalesce);
+#endif /* CONFIG_NET_MGMT_EVENT_WORKQ */
+
 /**
  * @brief Add a user callback
  * @param cb A valid pointer on user's callback to add.
@@ -309,6 +359,31 @@ static inline int net_mgmt_event_wait_on_iface(struct net_if *iface,
 }
 #endif
 
+/**
+ * @brief Network management event delivery statistics
+ */
+struct net_mgmt_event_stats {
+	/** Events dropped as the event queue was full */
+	uint32_t queue_overflows;
+	/** Events dropped as no pending event was free for a work queue */
+	uint32_t workq_overflows;
+	/** Events merged with an identical pending event */
+	uint32_t coalesced;
+};
+
+/**
+ * @brief Get the event delivery statistics
+ * @param stats Filled with the statistics since boot.
+ */
+#ifdef CONFIG_NET_MGMT_EVENT
+void net_mgmt_event_stats_get(struct net_mgmt_event_stats *stats);
+#else
+static inline void net_mgmt_event_stats_get(struct net_mgmt_event_stats *stats)
+{
+	*stats = (struct net_mgmt_event_stats){ 0 };
+}
+#endif
+
 /**
  * @brief Used by the core of the network stack to initialize the network
  *        event processing.
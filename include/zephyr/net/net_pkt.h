@@ -203,6 +203,10 @@ struct net_pkt {
 	uint8_t l2_processed : 1; /* Set to 1 if this packet has already been
 				   * processed by the L2
 				   */
+	uint8_t rx_batched : 1;   /* Set to 1 if this packet is processed in
+				   * a receive batch. Useful only if
+				   * defined(CONFIG_NET_TCP_RX_BATCH).
+				   */
 
 	/* bitfield byte alignment boundary */
 
@@ -267,6 +271,20 @@ struct net_pkt {
 #endif /* CONFIG_NET_IP_DSCP_ECN */
 #endif /* CONFIG_NET_IP */
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/* Segment size to split this TCP packet at before it is sent,
+	 * or 0 if it is a single segment.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_TCP_GSO */
+
+#if defined(CONFIG_NET_RX_STEERING)
+	/* Flow hash of a received packet, set by the driver if the
+	 * hardware computed it (RSS), or 0 if unknown.
+	 */
+	uint32_t rx_hash;
+#endif /* CONFIG_NET_RX_STEERING */
+
 #if defined(CONFIG_NET_VLAN)
 	/* VLAN TCI (Tag Control Information). This contains the Priority
 	 * Code Point (PCP), Drop Eligible Indicator (DEI) and VLAN
@@ -407,6 +425,18 @@ static inline void net_pkt_set_l2_processed(struct net_pkt *pkt,
 	pkt->l2_processed = is_l2_processed;
 }
 
+static inline bool net_pkt_is_rx_batched(struct net_pkt *pkt)
+{
+	return IS_ENABLED(CONFIG_NET_TCP_RX_BATCH) ? !!(pkt->rx_batched) : 0;
+}
+
+static inline void net_pkt_set_rx_batched(struct net_pkt *pkt, bool is_rx_batched)
+{
+	if (IS_ENABLED(CONFIG_NET_TCP_RX_BATCH)) {
+		pkt->rx_batched = is_rx_batched;
+	}
+}
+
 static inline uint8_t net_pkt_ip_hdr_len(struct net_pkt *pkt)
 {
 #if defined(CONFIG_NET_IP)
@@ -860,6 +890,56 @@ static inline void net_pkt_set_ipv6_fragment_id(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_IPV6_FRAGMENT */
 
+#if defined(CONFIG_NET_TCP_GSO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	pkt->gso_size = size;
+}
+#else /* CONFIG_NET_TCP_GSO */
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(size);
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
+#if defined(CONFIG_NET_RX_STEERING)
+static inline uint32_t net_pkt_rx_hash(struct net_pkt *pkt)
+{
+	return pkt->rx_hash;
+}
+
+static inline void net_pkt_set_rx_hash(struct net_pkt *pkt, uint32_t hash)
+{
+	pkt->rx_hash = hash;
+}
+#else /* CONFIG_NET_RX_STEERING */
+static inline uint32_t net_pkt_rx_hash(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_rx_hash(struct net_pkt *pkt, uint32_t hash)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(hash);
+}
+#endif /* CONFIG_NET_RX_STEERING */
+
 static inline uint8_t net_pkt_priority(struct net_pkt *pkt)
 {
 	return pkt->priority;
@@ -1319,6 +1399,21 @@ static inline bool net_pkt_filter_local_in_recv_ok(struct net_pkt *pkt)
 
 #endif /* CONFIG_NET_PKT_FILTER && CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK */
 
+#if defined(CONFIG_NET_PKT_FILTER) && defined(CONFIG_NET_PKT_FILTER_CAPTURE_HOOK)
+
+bool net_pkt_filter_capture_ok(struct net_pkt *pkt);
+
+#else
+
+static inline bool net_pkt_filter_capture_ok(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return true;
+}
+
+#endif /* CONFIG_NET_PKT_FILTER && CONFIG_NET_PKT_FILTER_CAPTURE_HOOK */
+
 /* @endcond */
 
 /**
@@ -1467,6 +1562,26 @@ void net_pkt_print_frags(struct net_pkt *pkt);
 struct net_buf *net_pkt_get_reserve_rx_data(size_t min_len, k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Get several RX DATA buffers from pool.
+ *
+ * @details For drivers refilling a receive descriptor ring: allocates
+ * up to @a count fragments in one go.  Waits, as set by @a timeout, only
+ * if no fragment at all is available.
+ *
+ * @param min_len Minimum length of each requested fragment.
+ * @param frags Array of at least @a count entries, filled in with the
+ *        fragments allocated.
+ * @param count Maximum number of fragments to allocate.
+ * @param timeout Affects the action taken should the net buf pool be empty.
+ *        If K_NO_WAIT, then return immediately. If K_FOREVER, then
+ *        wait as long as necessary. Otherwise, wait up to the specified time.
+ *
+ * @return Number of fragments allocated, negative errno otherwise.
+ */
+int net_pkt_get_reserve_rx_data_bulk(size_t min_len, struct net_buf **frags,
+				     int count, k_timeout_t timeout);
+
 /**
  * @brief Get TX DATA buffer from pool.
  * Normally you should use net_pkt_get_frag() instead.
@@ -57,10 +57,39 @@ extern struct npf_rule npf_default_ok;
 /** @brief Default rule list termination for rejecting a packet */
 extern struct npf_rule npf_default_drop;
 
+/** @cond INTERNAL_HIDDEN */
+
+/* Fields of a packet identifying its flow for the verdict cache */
+struct npf_flow_key {
+	struct net_if *iface;
+	struct net_if *orig_iface;
+	uint8_t src_addr[16];
+	uint8_t dst_addr[16];
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t family;
+	uint8_t proto;
+};
+
+struct npf_verdict_cache_entry {
+	struct npf_flow_key key;
+	enum net_verdict result;
+	bool valid;
+};
+
+/** @endcond */
+
 /** @brief rule set for a given test location */
 struct npf_rule_list {
 	sys_slist_t rule_head;
 	struct k_spinlock lock;
+#if defined(CONFIG_NET_PKT_FILTER_VERDICT_CACHE)
+	/** @cond INTERNAL_HIDDEN */
+	bool cacheable;		/* All tests only depend on the flow */
+	bool cache_flow;	/* IP addresses or ports are tested */
+	struct npf_verdict_cache_entry cache[CONFIG_NET_PKT_FILTER_VERDICT_CACHE_SIZE];
+	/** @endcond */
+#endif
 };
 
 /** @brief  rule list applied to outgoing packets */
@@ -73,6 +102,8 @@ extern struct npf_rule_list npf_local_in_recv_rules;
 extern struct npf_rule_list npf_ipv4_recv_rules;
 /** @brief rule list applied for IPv6 incoming packets */
 extern struct npf_rule_list npf_ipv6_recv_rules;
+/** @brief rule list selecting the packets recorded in the capture ring */
+extern struct npf_rule_list npf_capture_rules;
 
 /**
  * @brief Insert a rule at the front of given rule list
@@ -138,6 +169,13 @@ bool npf_remove_all_rules(struct npf_rule_list *rules);
 #define npf_remove_all_ipv6_recv_rules() npf_remove_all_rules(&npf_ipv6_recv_rules)
 #endif /* CONFIG_NET_PKT_FILTER_IPV6_HOOK */
 
+#ifdef CONFIG_NET_PKT_FILTER_CAPTURE_HOOK
+#define npf_insert_capture_rule(rule) npf_insert_rule(&npf_capture_rules, rule)
+#define npf_append_capture_rule(rule) npf_append_rule(&npf_capture_rules, rule)
+#define npf_remove_capture_rule(rule) npf_remove_rule(&npf_capture_rules, rule)
+#define npf_remove_all_capture_rules() npf_remove_all_rules(&npf_capture_rules)
+#endif /* CONFIG_NET_PKT_FILTER_CAPTURE_HOOK */
+
 /**
  * @brief Statically define one packet filter rule
  *
@@ -377,6 +415,55 @@ extern npf_test_fn_t npf_ip_src_addr_unmatch;
 		.test.fn = npf_ip_src_addr_unmatch, \
 	}
 
+/** @cond INTERNAL_HIDDEN */
+
+struct npf_test_port_bounds {
+	struct npf_test test;
+	uint16_t min;
+	uint16_t max;
+};
+
+extern npf_test_fn_t npf_src_port_inbounds;
+extern npf_test_fn_t npf_dst_port_inbounds;
+
+/** @endcond */
+
+/**
+ * @brief Statically define a "source port range" packet filter condition
+ *
+ * This tests if the packet is a TCP or UDP packet whose source port is
+ * within the given bounds. The transport header must directly follow the
+ * IP header, so IPv6 packets carrying extension headers never match.
+ *
+ * @param _name Name of the condition
+ * @param _min_port Lower bound of the source port
+ * @param _max_port Higher bound of the source port
+ */
+#define NPF_SRC_PORT_RANGE(_name, _min_port, _max_port) \
+	struct npf_test_port_bounds _name = { \
+		.min = (_min_port), \
+		.max = (_max_port), \
+		.test.fn = npf_src_port_inbounds, \
+	}
+
+/**
+ * @brief Statically define a "destination port range" packet filter condition
+ *
+ * This tests if the packet is a TCP or UDP packet whose destination port is
+ * within the given bounds. The transport header must directly follow the
+ * IP header, so IPv6 packets carrying extension headers never match.
+ *
+ * @param _name Name of the condition
+ * @param _min_port Lower bound of the destination port
+ * @param _max_port Higher bound of the destination port
+ */
+#define NPF_DST_PORT_RANGE(_name, _min_port, _max_port) \
+	struct npf_test_port_bounds _name = { \
+		.min = (_min_port), \
+		.max = (_max_port), \
+		.test.fn = npf_dst_port_inbounds, \
+	}
+
 /** @} */
 
 /**
@@ -219,6 +219,26 @@ struct net_stats_ipv4_igmp {
 	net_stats_t drop;
 };
 
+/**
+ * @brief IP fragment reassembly statistics
+ */
+struct net_stats_ip_frag {
+	/** Number of successfully reassembled packets */
+	net_stats_t reassembled;
+
+	/** Number of reassemblies that timed out */
+	net_stats_t timeout;
+
+	/** Number of incomplete reassemblies evicted to make room */
+	net_stats_t evicted;
+
+	/** Number of dropped fragments */
+	net_stats_t drop;
+
+	/** Sum of the reassembly times, in milliseconds */
+	uint64_t latency_sum;
+};
+
 /**
  * @brief Network packet transfer times for calculating average TX time
  */
@@ -342,6 +362,16 @@ struct net_stats {
 	struct net_stats_ipv4_igmp ipv4_igmp;
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_IPV4_FRAGMENT)
+	/** IPv4 fragment reassembly statistics */
+	struct net_stats_ip_frag ipv4_frag;
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_FRAGMENT)
+	/** IPv6 fragment reassembly statistics */
+	struct net_stats_ip_frag ipv6_frag;
+#endif
+
 #if NET_TC_COUNT > 1
 	/** Traffic class statistics */
 	struct net_stats_tc tc;
@@ -27,6 +27,7 @@
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/dns_resolve.h>
 #include <zephyr/net/socket_select.h>
+#include <zephyr/net/socket_epoll.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <stdlib.h>
 
@@ -64,6 +65,12 @@ struct zsock_pollfd {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: Do not block once the first message has been received */
+#define ZSOCK_MSG_WAITFORONE 0x10000
+/** zsock_sendmsg: Send from the application buffers without copying them,
+ *  see SO_ZEROCOPY_CB
+ */
+#define ZSOCK_MSG_ZEROCOPY 0x4000000
 
 /* Well-known values, e.g. from Linux man 2 shutdown:
  * "The constants SHUT_RD, SHUT_WR, SHUT_RDWR have the value 0, 1, 2,
@@ -158,12 +165,39 @@ struct zsock_pollfd {
 /** Socket option to control TLS session caching on a socket. Accepted values:
  *  - 0 - Disabled.
  *  - 1 - Enabled.
+ *
+ *  Client sessions are stored per peer hostname, if set with TLS_HOSTNAME,
+ *  or per peer address otherwise. Servers also issue session tickets if
+ *  CONFIG_MBEDTLS_SSL_SESSION_TICKETS is enabled.
  */
 #define TLS_SESSION_CACHE 12
 /** Write-only socket option to purge session cache immediately.
  *  This option accepts any value.
  */
 #define TLS_SESSION_CACHE_PURGE 13
+/** Socket option to control the use of the DTLS Connection ID extension
+ *  (RFC 9146) on a DTLS socket. Accepted values:
+ *  - 0 - Disabled.
+ *  - 1 - Supported, the peer may assign a connection ID used by this end
+ *        when sending records.
+ *  - 2 - Enabled, both ends use a connection ID.
+ *  Requires CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID and takes effect on the
+ *  next handshake.
+ */
+#define TLS_DTLS_CID 14
+/** Socket option to set or get the connection ID used by the peer to send
+ *  records to this end. If not set, a random value is generated when
+ *  TLS_DTLS_CID is enabled.
+ */
+#define TLS_DTLS_CID_VALUE 15
+/** Read-only socket option to get the connection ID used by this end to
+ *  send records to the peer.
+ */
+#define TLS_DTLS_PEER_CID_VALUE 16
+/** Read-only socket option to get the status of the connection ID
+ *  negotiation, see TLS_DTLS_CID_STATUS_* values.
+ */
+#define TLS_DTLS_CID_STATUS 17
 
 /** @} */
 
@@ -184,6 +218,17 @@ struct zsock_pollfd {
 #define TLS_SESSION_CACHE_DISABLED 0 /**< Disable TLS session caching. */
 #define TLS_SESSION_CACHE_ENABLED 1 /**< Enable TLS session caching. */
 
+/* Valid values for TLS_DTLS_CID option */
+#define TLS_DTLS_CID_DISABLED 0  /**< Connection ID not used. */
+#define TLS_DTLS_CID_SUPPORTED 1 /**< Peer connection ID used if offered. */
+#define TLS_DTLS_CID_ENABLED 2   /**< Connection ID used by both ends. */
+
+/* Values returned by TLS_DTLS_CID_STATUS option */
+#define TLS_DTLS_CID_STATUS_DISABLED 0      /**< Connection ID not in use. */
+#define TLS_DTLS_CID_STATUS_DOWNLINK 1      /**< Used by received records. */
+#define TLS_DTLS_CID_STATUS_UPLINK 2        /**< Used by sent records. */
+#define TLS_DTLS_CID_STATUS_BIDIRECTIONAL 3 /**< Used in both directions. */
+
 struct zsock_addrinfo {
 	struct zsock_addrinfo *ai_next;
 	int ai_flags;
@@ -404,6 +449,24 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send multiple messages on a socket
+ *
+ * @details
+ * @rst
+ * See `Linux man page
+ * <https://man7.org/linux/man-pages/man2/sendmmsg.2.html>`__
+ * for normative description.
+ * The socket is locked once for the whole batch. The number of bytes sent
+ * for each message is returned in its ``msg_len`` field. An error is only
+ * reported if no message could be sent.
+ * This function is also exposed as ``sendmmsg()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -420,6 +483,27 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
 				 int flags, struct sockaddr *src_addr,
 				 socklen_t *addrlen);
 
+/**
+ * @brief Receive multiple messages from a socket
+ *
+ * @details
+ * @rst
+ * See `Linux man page
+ * <https://man7.org/linux/man-pages/man2/recvmmsg.2.html>`__
+ * for normative description.
+ * Only datagram sockets are supported. The socket is locked once, and all
+ * the datagrams already queued are received in one pass, up to ``vlen``.
+ * Ancillary data is not supported, ``msg_controllen`` is set to 0.
+ * The ``timeout`` argument of the Linux call is not supported. Only the
+ * first datagram is waited for, with the receive timeout of the socket, as
+ * if ``ZSOCK_MSG_WAITFORONE`` was always given.
+ * This function is also exposed as ``recvmmsg()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -438,6 +522,72 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+struct net_buf;
+
+/**
+ * @brief Receive data from a socket without copying it
+ *
+ * @details
+ * @rst
+ * Zephyr-specific. Instead of copying the received data into a caller
+ * buffer, hand over the network buffers holding the data of the next
+ * received packet, or datagram, in ``*frags``. The buffers must be given
+ * back with :c:func:`zsock_recv_zc_release` once the data has been
+ * consumed. For a stream socket, the data keeps using the receive window
+ * until then, so holding it for long slows down the peer. It also keeps
+ * buffers of the RX pool in use.
+ *
+ * Only native sockets support it. The only flag supported is
+ * ``ZSOCK_MSG_DONTWAIT``. The source address is only set for datagram
+ * sockets.
+ *
+ * Requires :kconfig:option:`CONFIG_NET_SOCKETS_RECV_ZC`. This function
+ * is not available to user mode threads.
+ * @endrst
+ *
+ * @param sock Socket descriptor.
+ * @param frags Set to the chain of buffers holding the data, NULL if none.
+ * @param flags Receive flags.
+ * @param src_addr Source address of the datagram, can be NULL.
+ * @param addrlen Length of src_addr, updated to the actual length.
+ *
+ * @return Number of bytes in @a frags, 0 at the end of a stream, or -1
+ *         with errno set on error.
+ */
+ssize_t zsock_recvfrom_zc(int sock, struct net_buf **frags, int flags,
+			  struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Receive data from a connected peer without copying it
+ *
+ * @details
+ * @rst
+ * Same as :c:func:`zsock_recvfrom_zc` without the source address.
+ * @endrst
+ */
+static inline ssize_t zsock_recv_zc(int sock, struct net_buf **frags,
+				    int flags)
+{
+	return zsock_recvfrom_zc(sock, frags, flags, NULL, NULL);
+}
+
+/**
+ * @brief Release the data received with zsock_recvfrom_zc()
+ *
+ * @details
+ * @rst
+ * Free the buffers and, for a stream socket, open the receive window
+ * again by the amount of data they hold. The buffers are freed even when
+ * the socket was closed in the meantime.
+ * @endrst
+ *
+ * @param sock Socket descriptor the data was received on.
+ * @param frags Buffers returned by zsock_recvfrom_zc(), can be NULL.
+ *
+ * @return 0 on success, -1 with errno set if the socket is invalid.
+ */
+int zsock_recv_zc_release(int sock, struct net_buf *frags);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -778,6 +928,13 @@ static inline ssize_t sendmsg(int sock, const struct msghdr *message,
 	return zsock_sendmsg(sock, message, flags);
 }
 
+/** POSIX wrapper for @ref zsock_sendmmsg */
+static inline int sendmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
 /** POSIX wrapper for @ref zsock_recvfrom */
 static inline ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags,
 			       struct sockaddr *src_addr, socklen_t *addrlen)
@@ -785,6 +942,13 @@ static inline ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags,
 	return zsock_recvfrom(sock, buf, max_len, flags, src_addr, addrlen);
 }
 
+/** POSIX wrapper for @ref zsock_recvmmsg */
+static inline int recvmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_recvmmsg(sock, msgvec, vlen, flags);
+}
+
 /** POSIX wrapper for @ref zsock_poll */
 static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 {
@@ -888,6 +1052,10 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
 /** POSIX wrapper for @ref ZSOCK_MSG_WAITALL */
 #define MSG_WAITALL ZSOCK_MSG_WAITALL
+/** POSIX wrapper for @ref ZSOCK_MSG_WAITFORONE */
+#define MSG_WAITFORONE ZSOCK_MSG_WAITFORONE
+/** POSIX wrapper for @ref ZSOCK_MSG_ZEROCOPY */
+#define MSG_ZEROCOPY ZSOCK_MSG_ZEROCOPY
 
 /** POSIX wrapper for @ref ZSOCK_SHUT_RD */
 #define SHUT_RD ZSOCK_SHUT_RD
@@ -989,6 +1157,8 @@ struct ifreq {
 /* Socket options for IPPROTO_TCP level */
 /** sockopt: Disable TCP buffering (ignored, for compatibility) */
 #define TCP_NODELAY 1
+/** sockopt: Congestion control algorithm, set and returned as a name */
+#define TCP_CONGESTION 13
 
 /* Socket options for IPPROTO_IP level */
 /** sockopt: Set or receive the Type-Of-Service value for an outgoing packet. */
@@ -1012,6 +1182,28 @@ struct ifreq {
 /** sockopt: Enable SOCKS5 for Socket */
 #define SO_SOCKS5 60
 
+/** sockopt: Completion callback of the sends done with ZSOCK_MSG_ZEROCOPY
+ *  (Zephyr specific, struct zsock_zerocopy_cb value)
+ */
+#define SO_ZEROCOPY_CB 0x1001
+
+/**
+ * @brief Value of the SO_ZEROCOPY_CB socket option
+ *
+ * The buffers given to a zsock_sendmsg() call with ZSOCK_MSG_ZEROCOPY must
+ * stay valid and unchanged until @a cb is called with the identifier of
+ * that call. Calls are numbered from 0 for each socket, only the ones that
+ * succeeded count. The callback comes once the data is acknowledged by the
+ * peer for a stream socket, or transmitted for a datagram socket. It may
+ * run in an interrupt handler, so it must not block.
+ */
+struct zsock_zerocopy_cb {
+	/** Completion callback */
+	void (*cb)(uint32_t id, void *user_data);
+	/** User data passed to the callback */
+	void *user_data;
+};
+
 /** listen: The maximum backlog queue length (ignored, for compatibility) */
 #define SOMAXCONN 128
 
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+
+/**
+ * @brief BSD Sockets compatible API
+ * @defgroup bsd_sockets BSD Sockets compatible API
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/types.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ZSOCK_EPOLL* values are compatible with Linux */
+/** zsock_epoll_create1: Close the instance on exec (ignored) */
+#define ZSOCK_EPOLL_CLOEXEC 0x80000
+
+/** zsock_epoll_ctl: Add a file descriptor to the interest list */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** zsock_epoll_ctl: Remove a file descriptor from the interest list */
+#define ZSOCK_EPOLL_CTL_DEL 2
+/** zsock_epoll_ctl: Change the events of a file descriptor */
+#define ZSOCK_EPOLL_CTL_MOD 3
+
+/** zsock_epoll_event: Readability, same as ZSOCK_POLLIN */
+#define ZSOCK_EPOLLIN 0x001
+/** zsock_epoll_event: Compatibility value, ignored */
+#define ZSOCK_EPOLLPRI 0x002
+/** zsock_epoll_event: Writability, same as ZSOCK_POLLOUT */
+#define ZSOCK_EPOLLOUT 0x004
+/** zsock_epoll_event: Error condition (always reported) */
+#define ZSOCK_EPOLLERR 0x008
+/** zsock_epoll_event: Closed connection (always reported) */
+#define ZSOCK_EPOLLHUP 0x010
+/** zsock_epoll_event: Report the file descriptor once, until re-armed with
+ *  ZSOCK_EPOLL_CTL_MOD
+ */
+#define ZSOCK_EPOLLONESHOT (1U << 30)
+/** zsock_epoll_event: Edge-triggered, report only new events */
+#define ZSOCK_EPOLLET (1U << 31)
+
+/** User data of a zsock_epoll_event */
+typedef union zsock_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} zsock_epoll_data_t;
+
+/** Event registered with zsock_epoll_ctl() and returned by zsock_epoll_wait() */
+struct zsock_epoll_event {
+	/** ZSOCK_EPOLL* event mask */
+	uint32_t events;
+	/** User data, returned as is */
+	zsock_epoll_data_t data;
+};
+
+/**
+ * @brief Create an epoll instance
+ *
+ * @details
+ * @rst
+ * See `Linux man page
+ * <https://man7.org/linux/man-pages/man2/epoll_create1.2.html>`__
+ * for normative description.
+ * The instance keeps an interest list of file descriptors and a list of
+ * the ready ones, fed by the notifications of the file descriptors, so
+ * that :c:func:`zsock_epoll_wait()` costs O(ready) instead of the O(n) of
+ * :c:func:`zsock_poll()`. Sockets, socketpairs and eventfds can be added.
+ * The instance is closed with :c:func:`zsock_close()`, and can itself be
+ * polled for readability.
+ * This function is also exposed as ``epoll_create1()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_epoll_create1(int flags);
+
+/**
+ * @brief Add, change or remove a file descriptor of an epoll instance
+ *
+ * @details
+ * @rst
+ * See `Linux man page
+ * <https://man7.org/linux/man-pages/man2/epoll_ctl.2.html>`__
+ * for normative description.
+ * A file descriptor is removed from all the instances when it is closed.
+ * Adding an epoll instance to another one is not supported (EPERM).
+ * This function is also exposed as ``epoll_ctl()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_epoll_ctl(int epfd, int op, int fd,
+			      struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for events on an epoll instance
+ *
+ * @details
+ * @rst
+ * See `Linux man page
+ * <https://man7.org/linux/man-pages/man2/epoll_wait.2.html>`__
+ * for normative description.
+ * This function is also exposed as ``epoll_wait()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ * @endrst
+ */
+__syscall int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			       int maxevents, int timeout);
+
+/**
+ * @internal
+ * @brief Tell the epoll instances watching an object that its state changed
+ *
+ * Called by the file descriptor implementations which return @p watchers
+ * from the ZFD_IOCTL_EPOLL_WATCHERS ioctl, whenever the object may have
+ * become readable or writable, or got an error. Can be called from any
+ * thread, but not from an ISR.
+ *
+ * @param watchers Watcher list of the object
+ */
+void zsock_epoll_notify(sys_slist_t *watchers);
+
+/**
+ * @internal
+ * @brief Remove an object from the epoll instances watching it
+ *
+ * Called by the file descriptor implementations when the object is closed.
+ *
+ * @param watchers Watcher list of the object
+ */
+void zsock_epoll_forget(sys_slist_t *watchers);
+
+#ifdef CONFIG_NET_SOCKETS_POSIX_NAMES
+
+#define EPOLL_CLOEXEC ZSOCK_EPOLL_CLOEXEC
+#define EPOLL_CTL_ADD ZSOCK_EPOLL_CTL_ADD
+#define EPOLL_CTL_DEL ZSOCK_EPOLL_CTL_DEL
+#define EPOLL_CTL_MOD ZSOCK_EPOLL_CTL_MOD
+#define EPOLLIN ZSOCK_EPOLLIN
+#define EPOLLPRI ZSOCK_EPOLLPRI
+#define EPOLLOUT ZSOCK_EPOLLOUT
+#define EPOLLERR ZSOCK_EPOLLERR
+#define EPOLLHUP ZSOCK_EPOLLHUP
+#define EPOLLONESHOT ZSOCK_EPOLLONESHOT
+#define EPOLLET ZSOCK_EPOLLET
+
+#define epoll_data_t zsock_epoll_data_t
+#define epoll_event zsock_epoll_event
+
+static inline int epoll_create1(int flags)
+{
+	return zsock_epoll_create1(flags);
+}
+
+static inline int epoll_ctl(int epfd, int op, int fd,
+			    struct zsock_epoll_event *event)
+{
+	return zsock_epoll_ctl(epfd, op, fd, event);
+}
+
+static inline int epoll_wait(int epfd, struct zsock_epoll_event *events,
+			     int maxevents, int timeout)
+{
+	return zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+
+#endif /* CONFIG_NET_SOCKETS_POSIX_NAMES */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <syscalls/socket_epoll.h>
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_ */
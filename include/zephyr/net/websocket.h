@@ -126,6 +126,23 @@ struct websocket_request {
 int websocket_connect(int http_sock, struct websocket_request *req,
 		      int32_t timeout, void *user_data);
 
+/**
+ * @brief Register the server side of a Websocket connection.
+ *
+ * @details The HTTP upgrade handshake must have been done by the caller,
+ * typically an HTTP server. The returned value is a new socket descriptor
+ * that can be used to send / receive data using the BSD socket API. The
+ * messages sent to the client must not be masked.
+ *
+ * @param http_sock Socket id of the connection from the client. It must not
+ *        be closed before the Websocket.
+ * @param recv_buf Buffer where the received data is stored temporarily.
+ * @param recv_buf_len Length of the buffer.
+ *
+ * @return Websocket id to be used when sending/receiving Websocket data.
+ */
+int websocket_register(int http_sock, uint8_t *recv_buf, size_t recv_buf_len);
+
 /**
  * @brief Send websocket msg to peer.
  *
@@ -151,6 +168,30 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout);
 
+/**
+ * @brief Send websocket msg to peer, gathering the payload from several
+ * buffers.
+ *
+ * @details Unmasked messages are sent without copying the payload, the
+ * header and the buffers are passed to the socket in one call. Masked
+ * messages are assembled and masked in a temporary buffer.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param iov Buffers of the payload.
+ * @param iovcnt Number of buffers, at most 8.
+ * @param opcode Operation code (text, binary, ping, pong, close)
+ * @param mask Mask the data, see RFC 6455 for details
+ * @param final Is this final message for this message send, see
+ *        websocket_send_msg().
+ * @param timeout How long to try to send the message. The value is in
+ *        milliseconds. Value SYS_FOREVER_MS means to wait forever.
+ *
+ * @return <0 if error, >=0 amount of bytes sent
+ */
+int websocket_send_msgv(int ws_sock, const struct iovec *iov, int iovcnt,
+			enum websocket_opcode opcode, bool mask, bool final,
+			int32_t timeout);
+
 /**
  * @brief Receive websocket msg from peer.
  *
@@ -37,6 +37,10 @@ struct zperf_upload_params {
 	struct {
 		uint8_t tos;
 		int tcp_nodelay;
+		/** Number of parallel streams, 0 meaning 1. The UDP rate is
+		 * shared by the streams.
+		 */
+		uint8_t num_streams;
 	} options;
 };
 
@@ -55,6 +59,32 @@ struct zperf_results {
 	uint32_t client_time_in_us;
 	uint32_t packet_size;
 	uint32_t nb_packets_errors;
+	/** CPU load during the session in percent, 0 if not measured */
+	uint32_t cpu_usage;
+};
+
+/** Round-trip latency results */
+struct zperf_latency_results {
+	/** Number of requests sent */
+	uint32_t nb_packets_sent;
+	/** Number of replies received in time */
+	uint32_t nb_packets_rcvd;
+	/** Minimum round-trip time, in us */
+	uint32_t min_us;
+	/** Maximum round-trip time, in us */
+	uint32_t max_us;
+	/** Average round-trip time, in us */
+	uint32_t avg_us;
+	/** Median round-trip time, in us */
+	uint32_t p50_us;
+	/** 99th percentile of the round-trip time, in us */
+	uint32_t p99_us;
+	/** 99.9th percentile of the round-trip time, in us */
+	uint32_t p999_us;
+	/** Duration of the session, in us */
+	uint32_t client_time_in_us;
+	/** CPU load during the session in percent, 0 if not measured */
+	uint32_t cpu_usage;
 };
 
 /**
@@ -122,6 +152,24 @@ int zperf_udp_upload_async(const struct zperf_upload_params *param,
 int zperf_tcp_upload_async(const struct zperf_upload_params *param,
 			   zperf_callback callback, void *user_data);
 
+/**
+ * @brief Synchronous UDP round-trip latency measurement. Datagrams are sent
+ *        at the given rate to a UDP echo server, and the time until each
+ *        of them comes back is measured. The function blocks until the
+ *        measurement is complete.
+ *
+ * @details The percentiles are computed from a histogram whose buckets
+ *          have a relative width of 1/16, so they are accurate to about
+ *          6%.
+ *
+ * @param param Upload parameters, peer_addr being the echo server.
+ * @param result Session results.
+ *
+ * @return 0 if session completed successfully, a negative error code otherwise.
+ */
+int zperf_udp_latency(const struct zperf_upload_params *param,
+		      struct zperf_latency_results *result);
+
 /**
  * @brief Start UDP server.
  *
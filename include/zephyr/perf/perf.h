@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PERF_PERF_H_
+#define ZEPHYR_INCLUDE_PERF_PERF_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/perf/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hardware performance counter APIs
+ * @defgroup sys_perf_api Performance counter APIs
+ * @ingroup os_services
+ *
+ * Portable access to the cycle, instruction, cache miss, branch miss and
+ * stall counters of the CPU. Which events are counted depends on the CPU,
+ * see sys_perf_events_get().
+ *
+ * Counters are 32 bits wide: a measurement must not span more than 2^32
+ * occurrences of an event.
+ * @{
+ */
+
+/**
+ * @brief Get the counted events.
+ *
+ * @return Bit mask of the events, BIT(SYS_PERF_CYCLES) and others, which
+ *         are counted on this system.
+ */
+uint32_t sys_perf_events_get(void);
+
+/**
+ * @brief Read the counters of the current CPU.
+ *
+ * @param snapshot Counter values.
+ */
+void sys_perf_snapshot(struct sys_perf_snapshot *snapshot);
+
+/**
+ * @brief Compute the events counted between two snapshots.
+ *
+ * Both snapshots must have been taken on the same CPU.
+ *
+ * @param start Snapshot taken at the beginning of the measurement.
+ * @param end Snapshot taken at the end of the measurement.
+ * @param counters Number of events, 0 for the events which are not counted.
+ */
+void sys_perf_elapsed(const struct sys_perf_snapshot *start,
+		      const struct sys_perf_snapshot *end,
+		      struct sys_perf_counters *counters);
+
+/**
+ * @brief Get the events counted while a thread was running.
+ *
+ * Events are only counted while threads are running with
+ * @kconfig{CONFIG_SYS_PERF_THREAD}. The events counted since the thread
+ * was switched in are included when it is the current thread.
+ *
+ * @param thread Thread.
+ * @param counters Number of events.
+ *
+ * @return 0 on success, -ENOTSUP if threads are not tracked.
+ */
+int sys_perf_thread_get(k_tid_t thread, struct sys_perf_counters *counters);
+
+/**
+ * @brief Get the number of instructions per 100 cycles.
+ *
+ * @param counters Number of events.
+ *
+ * @return Instructions per cycle, multiplied by 100, or 0 if cycles or
+ *         instructions are not counted.
+ */
+static inline uint32_t sys_perf_ipc_x100(const struct sys_perf_counters *counters)
+{
+	uint64_t cycles = counters->count[SYS_PERF_CYCLES];
+
+	if (cycles == 0) {
+		return 0;
+	}
+
+	return (uint32_t)((counters->count[SYS_PERF_INSTRUCTIONS] * 100) / cycles);
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_PERF_PERF_H_ */
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PERF_TYPES_H_
+#define ZEPHYR_INCLUDE_PERF_TYPES_H_
+
+#include <stdint.h>
+
+/** Hardware performance events */
+enum sys_perf_event {
+	/** Core clock cycles */
+	SYS_PERF_CYCLES,
+	/** Retired instructions */
+	SYS_PERF_INSTRUCTIONS,
+	/**
+	 * Cache misses: last level cache misses on x86, level 1 data cache
+	 * refills on Arm
+	 */
+	SYS_PERF_CACHE_MISSES,
+	/** Mispredicted branches */
+	SYS_PERF_BRANCH_MISSES,
+	/** Cycles in which no instruction was issued because of a stall */
+	SYS_PERF_STALLS,
+
+	SYS_PERF_EVENTS
+};
+
+/** Raw counter values, see sys_perf_snapshot() */
+struct sys_perf_snapshot {
+	uint32_t raw[SYS_PERF_EVENTS];
+};
+
+/** Event counts */
+struct sys_perf_counters {
+	uint64_t count[SYS_PERF_EVENTS];
+};
+
+#endif /* ZEPHYR_INCLUDE_PERF_TYPES_H_ */
@@ -50,6 +50,8 @@ enum pm_device_flag {
 	PM_DEVICE_FLAG_PD,
 	/** Indicates if device runtime PM should be automatically enabled */
 	PM_DEVICE_FLAG_RUNTIME_AUTO,
+	/** Indicates if the device holds a reference taken to resume it ahead */
+	PM_DEVICE_FLAG_RUNTIME_AHEAD,
 };
 
 /** @endcond */
@@ -120,6 +122,27 @@ typedef int (*pm_device_action_cb_t)(const struct device *dev,
 typedef bool (*pm_device_action_failed_cb_t)(const struct device *dev,
 					 int err);
 
+/**
+ * @brief Device runtime PM resume statistics
+ */
+struct pm_device_runtime_stats {
+	/** Number of resumes done by pm_device_runtime_get() */
+	uint32_t resume_count;
+	/** Number of resumes which had to wait for an asynchronous suspend */
+	uint32_t resume_wait_count;
+	/**
+	 * Number of gets which needed no resume, because a batched suspend
+	 * had not started yet or the device was resumed ahead
+	 */
+	uint32_t resume_avoided_count;
+	/** Latency of the last resume, in cycles */
+	uint32_t resume_last_cyc;
+	/** Maximum resume latency, in cycles */
+	uint32_t resume_max_cyc;
+	/** Sum of the resume latencies, in cycles */
+	uint64_t resume_total_cyc;
+};
+
 /**
  * @brief Device PM info
  */
@@ -135,6 +158,18 @@ struct pm_device {
 	uint32_t usage;
 	/** Work object for asynchronous calls */
 	struct k_work_delayable work;
+#if defined(CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH) || defined(__DOXYGEN__)
+	/** Node in the list of devices waiting for a batched suspend */
+	sys_snode_t batch_node;
+#endif
+#if defined(CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD) || defined(__DOXYGEN__)
+	/** Work object to resume the device ahead */
+	struct k_work_delayable ahead_work;
+#endif
+#if defined(CONFIG_PM_DEVICE_RUNTIME_STATS) || defined(__DOXYGEN__)
+	/** Resume statistics */
+	struct pm_device_runtime_stats stats;
+#endif
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 #ifdef CONFIG_PM_DEVICE_POWER_DOMAIN
 	/** Power Domain it belongs */
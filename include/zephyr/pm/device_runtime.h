@@ -156,6 +156,47 @@ int pm_device_runtime_put_async(const struct device *dev);
  */
 bool pm_device_runtime_is_enabled(const struct device *dev);
 
+#if defined(CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD) || defined(__DOXYGEN__)
+/**
+ * @brief Resume a device ahead of known activity.
+ *
+ * Once @p delay has passed, the device is resumed from the system work queue
+ * and held active by a reference of its own. The next
+ * pm_device_runtime_get() takes over this reference and returns without
+ * resuming the device, so that the resume latency is not spent in the path
+ * handling the activity. If there is no get within
+ * CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD_HOLD_MS, the reference is released
+ * with pm_device_runtime_put_async().
+ *
+ * This is meant for activity known in advance, e.g. a timer which starts a
+ * measurement or a transfer submitted for later.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dev Device instance.
+ * @param delay Time until the device is resumed, it should end about the
+ * resume latency of the device before the activity starts.
+ *
+ * @retval 0 If the resume is scheduled or the device already held active.
+ * @retval -ENOTSUP If device runtime PM is not enabled for the device.
+ */
+int pm_device_runtime_resume_ahead(const struct device *dev, k_timeout_t delay);
+#endif
+
+#if defined(CONFIG_PM_DEVICE_RUNTIME_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the resume statistics of a device.
+ *
+ * @param dev Device instance.
+ * @param stats Copy of the statistics.
+ *
+ * @retval 0 If it succeeds.
+ * @retval -ENOTSUP If the device does not support PM.
+ */
+int pm_device_runtime_stats_get(const struct device *dev,
+				struct pm_device_runtime_stats *stats);
+#endif
+
 #else
 
 static inline int pm_device_runtime_auto_enable(const struct device *dev)
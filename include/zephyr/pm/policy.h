@@ -81,6 +81,25 @@ struct pm_policy_event {
  */
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks);
 
+#if defined(CONFIG_PM_POLICY_PREDICTIVE) || defined(__DOXYGEN__)
+/**
+ * @brief Function to report the time spent in a PM state
+ *
+ * This function is called by the power subsystem once the CPU woke up from
+ * a power state, so that the policy can learn from the idle durations.
+ *
+ * @param cpu CPU index.
+ * @param cyc Number of hardware cycles spent in the power state.
+ */
+void pm_policy_residency_update(uint8_t cpu, uint32_t cyc);
+#else
+static inline void pm_policy_residency_update(uint8_t cpu, uint32_t cyc)
+{
+	ARG_UNUSED(cpu);
+	ARG_UNUSED(cyc);
+}
+#endif
+
 /** @endcond */
 
 /** Special value for 'all substates'. */
@@ -41,6 +41,22 @@ int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 int mq_timedsend(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 		 unsigned int msg_prio, const struct timespec *abstime);
 
+#if defined(CONFIG_POSIX_MQUEUE_FD) || defined(__DOXYGEN__)
+/**
+ * @brief Get the file descriptor of a message queue descriptor.
+ *
+ * The file descriptor can be waited on with poll() or select(): it is
+ * readable when the queue holds a message and writable when it has room
+ * for one. read() and write() on it receive and send a message without
+ * blocking. It is valid until mq_close() is called.
+ *
+ * @param mqdes Message queue descriptor.
+ *
+ * @return The file descriptor, or -1 with errno set.
+ */
+int mq_getfd_np(mqd_t mqdes);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
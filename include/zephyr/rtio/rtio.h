@@ -1390,6 +1390,30 @@ static inline int z_impl_rtio_cqe_copy_out(struct rtio *r,
 	return copied;
 }
 
+/**
+ * @brief Copy an array of SQEs in, submit them and copy an array of CQEs out
+ *
+ * Equivalent to rtio_sqe_copy_in(), rtio_submit() and rtio_cqe_copy_out(),
+ * in a single system call when called from user mode, so that a thread can
+ * queue many submissions and reap many completions at once. The SQEs of a
+ * single call which use the same iodev have their access to it checked once.
+ *
+ * The completions which are copied out are not necessarily those of the
+ * submissions of the same call.
+ *
+ * @param r RTIO context
+ * @param sqes Pointer to an array of SQEs, may be NULL if @p sqe_count is 0
+ * @param sqe_count Count of sqes in array
+ * @param cqes Pointer to an array of CQEs, may be NULL if @p cqe_count is 0
+ * @param cqe_count Count of cqes in array
+ * @param timeout Time to wait to gather @p cqe_count completions
+ *
+ * @retval copy_count Count of copied CQEs (0 to cqe_count)
+ * @retval -ENOMEM not enough room in the queue, nothing was submitted
+ */
+__syscall int rtio_submit_copy(struct rtio *r, const struct rtio_sqe *sqes, size_t sqe_count,
+			       struct rtio_cqe *cqes, size_t cqe_count, k_timeout_t timeout);
+
 /**
  * @brief Submit I/O requests to the underlying executor
  *
@@ -1449,6 +1473,27 @@ static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 	return res;
 }
 
+static inline int z_impl_rtio_submit_copy(struct rtio *r, const struct rtio_sqe *sqes,
+					  size_t sqe_count, struct rtio_cqe *cqes,
+					  size_t cqe_count, k_timeout_t timeout)
+{
+	int res;
+
+	if (sqe_count > 0) {
+		res = z_impl_rtio_sqe_copy_in_get_handles(r, sqes, NULL, sqe_count);
+		if (res < 0) {
+			return res;
+		}
+	}
+
+	res = z_impl_rtio_submit(r, 0);
+	if ((res < 0) || (cqe_count == 0)) {
+		return res;
+	}
+
+	return z_impl_rtio_cqe_copy_out(r, cqes, cqe_count, timeout);
+}
+
 /**
  * @}
  */
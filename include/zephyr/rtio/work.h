@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_RTIO_WORK_H_
+#define ZEPHYR_INCLUDE_RTIO_WORK_H_
+
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/p4wq.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief RTIO Work Queue API
+ * @defgroup rtio_work RTIO Work Queue API
+ * @ingroup rtio
+ * @{
+ */
+
+/**
+ * @brief Handler of a request run by the RTIO work queue
+ *
+ * The handler may block, it completes the submission with
+ * rtio_iodev_sqe_ok() or rtio_iodev_sqe_err().
+ *
+ * @param iodev_sqe Submission to handle
+ */
+typedef void (*rtio_work_submit_t)(struct rtio_iodev_sqe *iodev_sqe);
+
+/**
+ * @brief Request of the RTIO work queue
+ *
+ * The fields are private.
+ */
+struct rtio_work_req {
+	struct k_p4wq_work work;
+	struct rtio_iodev_sqe *iodev_sqe;
+	rtio_work_submit_t handler;
+};
+
+/**
+ * @brief Allocate a request of the RTIO work queue
+ *
+ * This can be called from the submit function of an iodev, in any context.
+ *
+ * @return Request to pass to rtio_work_req_submit(), NULL if all the
+ *         requests of the pool are in use.
+ */
+struct rtio_work_req *rtio_work_req_alloc(void);
+
+/**
+ * @brief Run a submission in a thread of the RTIO work queue
+ *
+ * Lets iodevs whose operations are synchronous handle their submissions
+ * without blocking the submitter. The handler runs in one of the
+ * CONFIG_RTIO_WORKQ_THREADS threads of the pool, at a thread priority
+ * given by the priority of the submission, so that the requests of
+ * independent chains run concurrently. The request is released when the
+ * handler returns.
+ *
+ * @param req Request allocated with rtio_work_req_alloc().
+ * @param iodev_sqe Submission to handle.
+ * @param handler Handler called with @p iodev_sqe.
+ */
+void rtio_work_req_submit(struct rtio_work_req *req, struct rtio_iodev_sqe *iodev_sqe,
+			  rtio_work_submit_t handler);
+
+/**
+ * @brief Get the number of requests of the RTIO work queue in use
+ *
+ * @return Number of allocated requests which have not been released.
+ */
+uint32_t rtio_work_req_used_count_get(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_RTIO_WORK_H_ */
@@ -64,6 +64,9 @@ struct sd_card {
 	enum card_status status; /*!< Card status */
 	enum card_type type; /*!< Card type */
 	uint32_t flags; /*!< Card flags */
+#if defined(CONFIG_SD_DEFER_WRITE_BUSY) || defined(__DOXYGEN__)
+	bool write_busy; /*!< Card may be busy programming written data */
+#endif
 	uint8_t card_buffer[CONFIG_SD_BUFFER_SIZE]
 		__aligned(CONFIG_SDHC_BUFFER_ALIGNMENT); /* Card internal buffer */
 };
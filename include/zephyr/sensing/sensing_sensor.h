@@ -146,6 +146,11 @@ static inline void *sensing_sensor_get_ctx_data(
  * runtime, the runtime will help delivered the data to it's all clients
  * according clients' configurations such as reporter interval, data change sensitivity.
  *
+ * The sensor runs at the shortest interval requested by its clients, a client
+ * with a longer interval only gets one of every N samples. All the clients are
+ * given @p buf itself, without a copy, from the calling thread, so the buffer
+ * only needs to stay valid until this function returns.
+ *
  * @param dev The sensor instance device structure.
  *
  * @param buf The data buffer.
@@ -314,6 +314,34 @@ int settings_save(void);
  */
 int settings_save_one(const char *name, const void *value, size_t val_len);
 
+/**
+ * Settings item written by settings_save_batch().
+ */
+struct settings_batch_item {
+	/** Name/key of the settings item. */
+	const char *name;
+	/** Value of the settings item, NULL to delete the item. */
+	const void *value;
+	/** Length of the value, 0 to delete the item. */
+	size_t val_len;
+};
+
+/**
+ * Write several serialized values to persisted storage.
+ *
+ * The values are written without any other write in between, and only the
+ * last item with a given name is written. The backend is notified of the
+ * start and the end of the batch, which lets it defer its own bookkeeping
+ * writes. Writing stops at the first error, the items written before it are
+ * kept.
+ *
+ * @param items Items to write, in order.
+ * @param count Number of items.
+ *
+ * @return 0 on success, non-zero on failure.
+ */
+int settings_save_batch(const struct settings_batch_item *items, size_t count);
+
 /**
  * Delete a single serialized in persisted storage.
  *
@@ -419,7 +447,7 @@ struct settings_store_itf {
 	 */
 
 	int (*csi_save_start)(struct settings_store *cs);
-	/**< Handler called before an export operation.
+	/**< Handler called before an export operation or a batch of writes.
 	 *
 	 * Parameters:
 	 *  - cs - Corresponding backend handler node
@@ -437,7 +465,7 @@ struct settings_store_itf {
 	 */
 
 	int (*csi_save_end)(struct settings_store *cs);
-	/**< Handler called after an export operation.
+	/**< Handler called after an export operation or a batch of writes.
 	 *
 	 * Parameters:
 	 *  - cs - Corresponding backend handler node
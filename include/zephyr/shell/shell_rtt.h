@@ -19,6 +19,8 @@ struct shell_rtt {
 	shell_transport_handler_t handler;
 	struct k_timer timer;
 	void *context;
+	/* Output waits for the host to read the up-buffer. */
+	bool tx_pending;
 };
 
 #define SHELL_RTT_DEFINE(_name)					\
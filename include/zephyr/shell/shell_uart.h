@@ -28,6 +28,11 @@ struct shell_uart_ctrl_blk {
 #ifdef CONFIG_MCUMGR_TRANSPORT_SHELL
 	struct smp_shell_data smp;
 #endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC
+	uint8_t rx_bufs[2][CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_SIZE];
+	uint8_t rx_buf_idx;
+	bool rx_stopped;
+#endif /* CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC */
 };
 
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
@@ -42,6 +47,16 @@ struct shell_uart_ctrl_blk {
 #define Z_UART_SHELL_DTR_TIMER_DECLARE(_name) static struct k_timer _name##_dtr_timer
 #define Z_UART_SHELL_DTR_TIMER_PTR(_name) (&_name##_dtr_timer)
 
+#elif defined(CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC)
+#define Z_UART_SHELL_TX_RINGBUF_DECLARE(_name, _size) \
+	RING_BUF_DECLARE(_name##_tx_ringbuf, _size)
+
+#define Z_UART_SHELL_RX_TIMER_DECLARE(_name) /* Empty */
+#define Z_UART_SHELL_TX_RINGBUF_PTR(_name) (&_name##_tx_ringbuf)
+#define Z_UART_SHELL_RX_TIMER_PTR(_name) NULL
+#define Z_UART_SHELL_DTR_TIMER_DECLARE(_name) /* Empty */
+#define Z_UART_SHELL_DTR_TIMER_PTR(_name) NULL
+
 #else /* CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN */
 #define Z_UART_SHELL_TX_RINGBUF_DECLARE(_name, _size) /* Empty */
 #define Z_UART_SHELL_RX_TIMER_DECLARE(_name) static struct k_timer _name##_timer
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Performance histograms.
+ *
+ * A performance histogram counts the durations of a hot path, in cycles of
+ * k_cycle_get_32(), in log-linear buckets: durations below
+ * PERF_STATS_SUB_BUCKETS each have their own bucket, and every power of two
+ * above is split into PERF_STATS_SUB_BUCKETS buckets of equal width. The
+ * relative error of a bucket is thus bounded by 1 / PERF_STATS_SUB_BUCKETS.
+ *
+ * Each CPU records into its own copy of the buckets, with only its local
+ * interrupts locked, and the copies are summed when the histogram is read.
+ * Histograms are defined with PERF_STATS_HIST_DEFINE(), and can be exported
+ * in CBOR with the statistics management group of mcumgr and with LwM2M.
+ */
+
+#ifndef ZEPHYR_INCLUDE_STATS_PERF_STATS_H_
+#define ZEPHYR_INCLUDE_STATS_PERF_STATS_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+
+#ifdef CONFIG_PERF_STATS_CBOR
+#include <zcbor_common.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Performance histograms
+ * @defgroup perf_stats Performance histograms
+ * @ingroup stats
+ * @{
+ */
+
+/** Number of buckets per power of two */
+#define PERF_STATS_SUB_BUCKETS BIT(CONFIG_PERF_STATS_SUB_BUCKETS_LOG2)
+
+/** Number of buckets covering durations of up to UINT32_MAX cycles */
+#define PERF_STATS_BUCKETS \
+	((33 - CONFIG_PERF_STATS_SUB_BUCKETS_LOG2) * PERF_STATS_SUB_BUCKETS)
+
+/** @cond INTERNAL_HIDDEN */
+struct perf_stats_cpu {
+	uint32_t counts[PERF_STATS_BUCKETS];
+	uint64_t sum;
+	uint32_t max;
+};
+/** @endcond */
+
+/** Performance histogram */
+struct perf_stats_hist {
+	/** Name of the histogram */
+	const char *name;
+	/** @cond INTERNAL_HIDDEN */
+	struct perf_stats_cpu cpu[CONFIG_MP_MAX_NUM_CPUS];
+	/** @endcond */
+};
+
+/** Histogram summed across the CPUs */
+struct perf_stats_snapshot {
+	/** Number of durations in each bucket */
+	uint32_t counts[PERF_STATS_BUCKETS];
+	/** Number of durations recorded */
+	uint64_t count;
+	/** Sum of the durations, in cycles */
+	uint64_t sum;
+	/** Longest duration, in cycles */
+	uint32_t max;
+};
+
+/**
+ * @brief Defines a performance histogram.
+ *
+ * @param _name Name of the histogram, also used to find and export it.
+ */
+#define PERF_STATS_HIST_DEFINE(_name)						\
+	STRUCT_SECTION_ITERABLE(perf_stats_hist, perf_stats_hist_##_name) = {	\
+		.name = #_name,							\
+	}
+
+/**
+ * @brief Declares a performance histogram defined in another file.
+ *
+ * @param _name Name of the histogram.
+ */
+#define PERF_STATS_HIST_DECLARE(_name) \
+	extern struct perf_stats_hist perf_stats_hist_##_name
+
+/**
+ * @brief Gets a pointer to a performance histogram.
+ *
+ * @param _name Name of the histogram.
+ */
+#define PERF_STATS_HIST(_name) (&perf_stats_hist_##_name)
+
+/**
+ * @brief Gets the bucket of a duration.
+ *
+ * @param cycles Duration in cycles.
+ *
+ * @return Index of the bucket.
+ */
+static inline uint32_t perf_stats_bucket(uint32_t cycles)
+{
+	uint32_t exp;
+
+	if (cycles < PERF_STATS_SUB_BUCKETS) {
+		return cycles;
+	}
+
+	exp = 31U - __builtin_clz(cycles);
+
+	return ((exp - CONFIG_PERF_STATS_SUB_BUCKETS_LOG2 + 1U) <<
+		CONFIG_PERF_STATS_SUB_BUCKETS_LOG2) |
+	       ((cycles >> (exp - CONFIG_PERF_STATS_SUB_BUCKETS_LOG2)) &
+		(PERF_STATS_SUB_BUCKETS - 1U));
+}
+
+/**
+ * @brief Gets the shortest duration counted in a bucket.
+ *
+ * @param bucket Index of the bucket.
+ *
+ * @return Duration in cycles.
+ */
+uint32_t perf_stats_bucket_min(uint32_t bucket);
+
+/**
+ * @brief Records a duration.
+ *
+ * Can be called from ISRs.
+ *
+ * @param hist Histogram.
+ * @param cycles Duration in cycles.
+ */
+void perf_stats_record(struct perf_stats_hist *hist, uint32_t cycles);
+
+/**
+ * @brief Starts timing a duration.
+ *
+ * @return Start of the duration, to be passed to perf_stats_stop().
+ */
+static inline uint32_t perf_stats_start(void)
+{
+	return k_cycle_get_32();
+}
+
+/**
+ * @brief Records the duration since perf_stats_start().
+ *
+ * @param hist Histogram.
+ * @param start Value returned by perf_stats_start().
+ */
+static inline void perf_stats_stop(struct perf_stats_hist *hist, uint32_t start)
+{
+	perf_stats_record(hist, k_cycle_get_32() - start);
+}
+
+/**
+ * @brief Sums the copies of a histogram recorded by each CPU.
+ *
+ * The counts of the other CPUs are read while they may record, so that the
+ * snapshot may miss their last durations.
+ *
+ * @param hist Histogram.
+ * @param snap Snapshot filled in.
+ */
+void perf_stats_snapshot(const struct perf_stats_hist *hist,
+			 struct perf_stats_snapshot *snap);
+
+/**
+ * @brief Clears a histogram.
+ *
+ * @param hist Histogram.
+ */
+void perf_stats_reset(struct perf_stats_hist *hist);
+
+/**
+ * @brief Finds a histogram by name.
+ *
+ * @param name Name of the histogram.
+ *
+ * @return Histogram, or NULL if none has this name.
+ */
+struct perf_stats_hist *perf_stats_find(const char *name);
+
+#if defined(CONFIG_PERF_STATS_CBOR) || defined(__DOXYGEN__)
+
+/**
+ * @brief Largest size of a histogram encoded with perf_stats_encode().
+ */
+#define PERF_STATS_CBOR_MAX_LEN (48 + PERF_STATS_BUCKETS * 10)
+
+/**
+ * @brief Encodes a histogram in CBOR.
+ *
+ * The histogram is encoded as a map of:
+ *
+ * - "n": number of durations recorded
+ * - "s": sum of the durations, in cycles
+ * - "m": longest duration, in cycles
+ * - "hz": frequency of the cycles
+ * - "sb": log2 of the number of buckets per power of two
+ * - "b": array of the buckets which are not empty, as pairs of the bucket
+ *   index followed by its count
+ *
+ * @param zse Encoder state.
+ * @param hist Histogram.
+ *
+ * @return true on success, false if the encoder ran out of space.
+ */
+bool perf_stats_encode(zcbor_state_t *zse, const struct perf_stats_hist *hist);
+
+/**
+ * @brief Encodes all the histograms in a buffer.
+ *
+ * The histograms are encoded as a CBOR map of their names to each histogram,
+ * as encoded by perf_stats_encode().
+ *
+ * @param buf Buffer.
+ * @param size Size of the buffer.
+ * @param len Set to the length of the encoded histograms.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if the buffer is too small.
+ */
+int perf_stats_encode_all(uint8_t *buf, size_t size, size_t *len);
+
+#endif /* CONFIG_PERF_STATS_CBOR */
+
+/**
+ * @}
+ */
+
+#ifdef CONFIG_PERF_STATS_ISR
+PERF_STATS_HIST_DECLARE(isr);
+#endif
+
+#ifdef CONFIG_PERF_STATS_SYSCALL
+PERF_STATS_HIST_DECLARE(syscall);
+#endif
+
+#ifdef CONFIG_PERF_STATS_NET_RX
+PERF_STATS_HIST_DECLARE(net_rx);
+#endif
+
+#ifdef CONFIG_PERF_STATS_FLASH_WRITE
+PERF_STATS_HIST_DECLARE(flash_write);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_STATS_PERF_STATS_H_ */
@@ -23,6 +23,7 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,6 +40,10 @@ extern "C" {
  * instance by using a SHA function). The write buffer 'buf' provided in
  * stream_flash_init is used as a read buffer for this purpose.
  *
+ * With CONFIG_STREAM_FLASH_ASYNC, the callback is invoked from the work
+ * queue writing the data, with the half of the write buffer which was
+ * written.
+ *
  * @param buf Pointer to the data read.
  * @param len The length of the data read.
  * @param offset The offset the data was read from.
@@ -63,6 +68,12 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	struct k_work work; /* Writes the pending buffer */
+	uint8_t *pending_buf; /* Buffer being written by the work */
+	size_t pending_bytes; /* Number of bytes in the pending buffer */
+	int pending_rc; /* Result of the write of the pending buffer */
+#endif
 };
 
 /**
@@ -73,12 +84,17 @@ struct stream_flash_ctx {
  * @param buf Write buffer
  * @param buf_len Length of write buffer. Can not be larger than the page size.
  *                Must be multiple of the flash device write-block-size.
+ *                With CONFIG_STREAM_FLASH_ASYNC, these requirements apply
+ *                to each half of the buffer.
  * @param offset Offset within flash device to start writing to
  * @param size Number of bytes available for performing buffered write.
  *             If this is '0', the size will be set to the total size
  *             of the flash device minus the offset.
  * @param cb Callback to be invoked on completed flash write operations.
  *
+ * @note With CONFIG_STREAM_FLASH_ASYNC, a context which is in use must be
+ *       flushed before it is initialized again.
+ *
  * @return non-negative on success, negative errno code on fail
  */
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
@@ -91,7 +107,9 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
  *
  * @param ctx context
  *
- * @return Number of payload bytes written to flash.
+ * @return Number of payload bytes written to flash. With
+ *         CONFIG_STREAM_FLASH_ASYNC, the bytes written in the background are
+ *         only counted after a following write or a flush.
  */
 size_t stream_flash_bytes_written(struct stream_flash_ctx *ctx);
 
@@ -109,6 +127,8 @@ size_t stream_flash_bytes_written(struct stream_flash_ctx *ctx);
  *        A flush write should be the last write operation in a sequence of
  *        write operations for given context (although this is not mandatory
  *        if the total data size is a multiple of the buffer size).
+ *        With CONFIG_STREAM_FLASH_ASYNC, a flush write also waits for
+ *        the end of the writes done in the background.
  *
  * @return non-negative on success, negative errno code on fail
  */
@@ -476,6 +476,19 @@ static inline uint32_t arch_proc_id(void);
  */
 void arch_sched_ipi(void);
 
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+/**
+ * Send a scheduling interrupt to a set of CPUs
+ *
+ * This will invoke z_sched_ipi() on every CPU whose bit is set in
+ * @a cpu_bitmap (bit N for CPU N, as in _kernel.cpus[]).  The bit of
+ * the calling CPU is ignored.
+ *
+ * @param cpu_bitmap Bitmap of the CPUs to interrupt
+ */
+void arch_sched_directed_ipi(uint32_t cpu_bitmap);
+#endif
+
 #endif /* CONFIG_SMP */
 
 /**
@@ -767,7 +780,9 @@ int arch_buffer_validate(void *addr, size_t size, int write);
  * Some MMU HW requires some region to be aligned to some of the intermediate
  * block alignment in order to reduce table usage.
  * This call returns the optimal virtual address alignment in order to permit
- * such optimization in the following MMU mapping call.
+ * such optimization in the following MMU mapping call. The virtual address
+ * is given the same offset as @p phys within this alignment, so @p phys does
+ * not need to be aligned for the blocks inside the region to be used.
  *
  * @param[in] phys Physical address of region to be mapped, aligned to MMU_PAGE_SIZE
  * @param[in] size Size of region to be mapped, aligned to MMU_PAGE_SIZE
@@ -1155,6 +1170,44 @@ uint32_t arch_timing_freq_get_mhz(void);
 
 #endif /* CONFIG_TIMING_FUNCTIONS */
 
+#ifdef CONFIG_SYS_PERF
+#include <zephyr/perf/types.h>
+
+/**
+ * @defgroup arch-perf Architecture performance counter APIs
+ * @ingroup arch-interface
+ * @{
+ */
+
+/**
+ * @brief Start the performance counters of the current CPU.
+ *
+ * Called with interrupts locked, once on each CPU, before its counters
+ * are first read.
+ *
+ * @return Bit mask of the events (see enum sys_perf_event) counted.
+ *
+ * @see sys_perf_events_get()
+ */
+uint32_t arch_perf_init(void);
+
+/**
+ * @brief Read the performance counters of the current CPU.
+ *
+ * Called with interrupts locked. Only the values of the events returned
+ * by arch_perf_init() are written.
+ *
+ * @param raw Counter values, indexed by enum sys_perf_event. Only their
+ *            32 least significant bits are used.
+ *
+ * @see sys_perf_snapshot()
+ */
+void arch_perf_read(uint32_t *raw);
+
+/** @} */
+
+#endif /* CONFIG_SYS_PERF */
+
 #ifdef CONFIG_PCIE_MSI_MULTI_VECTOR
 
 struct msi_vector;
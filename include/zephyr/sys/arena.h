@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_ARENA_H_
+
+#include <stddef.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/sys_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_arena_apis Arena Allocator APIs
+ * @ingroup memory_management
+ * @{
+ */
+
+/**
+ * @brief Default alignment of sys_arena_alloc()
+ */
+#define SYS_ARENA_ALIGN __alignof__(z_max_align_t)
+
+/** @cond INTERNAL_HIDDEN */
+struct sys_arena_chunk {
+	struct sys_arena_chunk *next;
+	size_t size;
+	size_t used;
+};
+/** @endcond */
+
+/**
+ * @brief Arena allocator
+ *
+ * An arena hands out memory by bumping a pointer through a chunk and
+ * never frees individual allocations.  Everything allocated from it is
+ * released at once by sys_arena_reset(), or back to an earlier point by
+ * sys_arena_rollback().  This suits the many small, short-lived objects
+ * built while handling a single request, which would otherwise each
+ * cost a heap allocation and a free.
+ *
+ * Memory comes from an optional caller-provided buffer and, once that
+ * is exhausted, from chunks allocated in an optional backing
+ * @ref sys_heap.  Like sys_heap itself, an arena does no locking: the
+ * caller must serialize all operations on it and on its backing heap.
+ */
+struct sys_arena {
+	/* Chunk allocations are carved from, newest first */
+	struct sys_arena_chunk *cur;
+	/* Chunk made from the caller's buffer, never freed */
+	struct sys_arena_chunk *base;
+	struct sys_heap *backing;
+	size_t chunk_size;
+};
+
+/**
+ * @brief Arena position saved by sys_arena_checkpoint()
+ */
+struct sys_arena_mark {
+	/** @cond INTERNAL_HIDDEN */
+	struct sys_arena_chunk *chunk;
+	size_t used;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize an arena
+ *
+ * @param arena Arena to initialize
+ * @param mem Initial buffer, or NULL to allocate only from @p backing
+ * @param bytes Size of @p mem in bytes
+ * @param backing Heap to allocate overflow chunks from, or NULL to
+ *        fail allocations once @p mem is exhausted
+ * @param chunk_size Minimum usable size of overflow chunks.  Larger
+ *        requests get a chunk of their own size.
+ */
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes,
+		    struct sys_heap *backing, size_t chunk_size);
+
+/**
+ * @brief Allocate aligned memory from an arena
+ *
+ * @param arena Arena to allocate from
+ * @param align Alignment in bytes, a power of two
+ * @param bytes Number of bytes requested
+ * @return Pointer to the memory, or NULL if @p bytes is zero or the
+ *         arena cannot grow
+ */
+void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align, size_t bytes);
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * The memory is aligned to @ref SYS_ARENA_ALIGN.
+ *
+ * @param arena Arena to allocate from
+ * @param bytes Number of bytes requested
+ * @return Pointer to the memory, or NULL if @p bytes is zero or the
+ *         arena cannot grow
+ */
+static inline void *sys_arena_alloc(struct sys_arena *arena, size_t bytes)
+{
+	return sys_arena_aligned_alloc(arena, SYS_ARENA_ALIGN, bytes);
+}
+
+/**
+ * @brief Save the current position of an arena
+ *
+ * @param arena Arena
+ * @return Mark to pass to sys_arena_rollback()
+ */
+static inline struct sys_arena_mark sys_arena_checkpoint(struct sys_arena *arena)
+{
+	return (struct sys_arena_mark) {
+		.chunk = arena->cur,
+		.used = (arena->cur != NULL) ? arena->cur->used : 0,
+	};
+}
+
+/**
+ * @brief Release everything allocated since a checkpoint
+ *
+ * Overflow chunks added since the checkpoint are returned to the
+ * backing heap.  Marks taken after @p mark become invalid, so nested
+ * checkpoints may be skipped over but not rolled back to afterwards.
+ *
+ * @param arena Arena
+ * @param mark Value returned by sys_arena_checkpoint()
+ */
+void sys_arena_rollback(struct sys_arena *arena, struct sys_arena_mark mark);
+
+/**
+ * @brief Release everything allocated from an arena
+ *
+ * All overflow chunks are returned to the backing heap and the
+ * caller's buffer becomes entirely available again.  This takes
+ * constant time when the arena never overflowed.
+ *
+ * @param arena Arena
+ */
+void sys_arena_reset(struct sys_arena *arena);
+
+/**
+ * @brief Get the number of bytes handed out by an arena
+ *
+ * Includes alignment padding, but not space left unused at the end of
+ * a chunk that could not fit the next allocation.
+ *
+ * @param arena Arena
+ * @return Bytes in use across all chunks
+ */
+size_t sys_arena_used_get(struct sys_arena *arena);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_ARENA_H_ */
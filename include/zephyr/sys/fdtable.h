@@ -166,6 +166,7 @@ enum {
 	ZFD_IOCTL_POLL_UPDATE,
 	ZFD_IOCTL_POLL_OFFLOAD,
 	ZFD_IOCTL_SET_LOCK,
+	ZFD_IOCTL_EPOLL_WATCHERS,
 };
 
 #ifdef __cplusplus
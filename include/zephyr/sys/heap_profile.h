@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HEAP_PROFILE_H_
+#define ZEPHYR_INCLUDE_SYS_HEAP_PROFILE_H_
+
+#include <stddef.h>
+#include <zephyr/types.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/sys_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup heap_profile_apis Heap Profiler APIs
+ * @ingroup memory_management
+ * @{
+ */
+
+/**
+ * @brief Number of request size classes in a heap profile
+ *
+ * Class @c n counts requests of up to 8 << n bytes, and the last class
+ * also counts everything larger.
+ */
+#define SYS_HEAP_PROFILE_SIZE_CLASSES 12
+
+#if defined(CONFIG_SYS_HEAP_PROFILE_STATS) || defined(__DOXYGEN__)
+
+#include <zephyr/stats/stats.h>
+
+/** @cond INTERNAL_HIDDEN */
+
+STATS_SECT_START(heap_profile)
+STATS_SECT_ENTRY32(allocs)
+STATS_SECT_ENTRY32(failures)
+STATS_SECT_ENTRY32(max_allocated)
+STATS_SECT_ENTRY32(free_bytes)
+STATS_SECT_ENTRY32(largest_free)
+STATS_SECT_ENTRY32(frag_permille)
+STATS_SECT_END;
+
+/** @endcond */
+
+#endif /* CONFIG_SYS_HEAP_PROFILE_STATS */
+
+/**
+ * @brief Allocations charged to one call site
+ */
+struct sys_heap_profile_site {
+	/** Return address of the allocation call */
+	void *site;
+	/** Successful allocations */
+	uint32_t count;
+	/** Failed allocations */
+	uint32_t failures;
+	/** Total bytes requested by successful allocations */
+	uint64_t bytes;
+};
+
+/**
+ * @brief Heap profile
+ *
+ * Counts the allocations made from one heap, by call site and by
+ * request size.  Call sites are the return addresses of the outermost
+ * allocation call, for example of k_malloc() rather than of the
+ * sys_heap_alloc() it is built on, and can be resolved with addr2line
+ * against the zephyr.elf of the build.  An allocation made as a tail
+ * call is charged to the caller of the function making it.  Once the
+ * site table is full, allocations from further sites are only counted
+ * in @ref other_sites.
+ *
+ * Reallocations are counted as allocations of the new size.
+ */
+struct sys_heap_profile {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	struct k_spinlock lock;
+	struct k_spinlock *heap_lock;
+	/** @endcond */
+
+	/** Name, for the shell and for mcumgr statistics */
+	const char *name;
+	/** Profiled heap */
+	struct sys_heap *heap;
+	/** Successful allocations */
+	uint32_t allocs;
+	/** Failed allocations */
+	uint32_t failures;
+	/** Allocations from sites not in the site table */
+	uint32_t other_sites;
+	/** Largest request served */
+	size_t max_request;
+	/** Successful allocations by size class */
+	uint32_t sizes[SYS_HEAP_PROFILE_SIZE_CLASSES];
+	/** Site table, in no particular order; unused entries have a NULL site */
+	struct sys_heap_profile_site sites[CONFIG_SYS_HEAP_PROFILE_SITES];
+#ifdef CONFIG_SYS_HEAP_PROFILE_STATS
+	/** @cond INTERNAL_HIDDEN */
+	STATS_SECT_DECL(heap_profile) stats;
+	/** @endcond */
+#endif
+};
+
+/**
+ * @brief Free memory layout of a heap
+ */
+struct sys_heap_frag_info {
+	/** Bytes available in free chunks */
+	size_t free_bytes;
+	/** Largest block that can currently be allocated */
+	size_t largest_free;
+	/** Number of free chunks */
+	size_t free_chunks;
+	/**
+	 * Fragmentation index in thousandths: 0 when all free memory
+	 * forms a single block, approaching 1000 as it shatters into
+	 * many small ones.
+	 */
+	uint32_t frag_permille;
+	/** High-water mark of allocated bytes */
+	size_t max_allocated;
+};
+
+/**
+ * @brief Start profiling a heap
+ *
+ * The profile is cleared and registered for sys_heap_profile_foreach(),
+ * and with @kconfig{CONFIG_SYS_HEAP_PROFILE_STATS} as a statistics
+ * group named @p name.  The system heap is profiled as "system"
+ * automatically.  Initializing the heap again stops the recording, but
+ * the profile stays registered, so this is meant for heaps that live
+ * as long as the system.
+ *
+ * @param heap Heap to profile
+ * @param prof Profile to fill
+ * @param name Name of the profile, must remain valid
+ * @param heap_lock Lock serializing operations on @p heap, taken to
+ *        inspect its free memory, or NULL if the caller of
+ *        sys_heap_profile_frag_get() serializes them instead
+ * @retval 0 on success
+ * @retval -EALREADY if @p heap is already profiled
+ */
+int sys_heap_profile_attach(struct sys_heap *heap, struct sys_heap_profile *prof,
+			    const char *name, struct k_spinlock *heap_lock);
+
+/**
+ * @brief Clear the counters of a heap profile
+ *
+ * @param prof Profile
+ */
+void sys_heap_profile_reset(struct sys_heap_profile *prof);
+
+/**
+ * @brief Get the free memory layout of a heap
+ *
+ * Walks all free chunks of the heap, so takes time proportional to
+ * their number.  Like other sys_heap functions it must not run
+ * concurrently with operations on the same heap.
+ *
+ * @param heap Heap
+ * @param info Filled with the layout
+ */
+void sys_heap_frag_get(struct sys_heap *heap, struct sys_heap_frag_info *info);
+
+/**
+ * @brief Get the free memory layout of a profiled heap
+ *
+ * Like sys_heap_frag_get(), taking the heap lock given to
+ * sys_heap_profile_attach() if any.  Also refreshes the corresponding
+ * entries of the statistics group, which are not updated otherwise.
+ *
+ * @param prof Profile
+ * @param info Filled with the layout
+ */
+void sys_heap_profile_frag_get(struct sys_heap_profile *prof,
+			       struct sys_heap_frag_info *info);
+
+/**
+ * @brief Callback for sys_heap_profile_foreach()
+ *
+ * @param prof Profile
+ * @param user_data Value passed to sys_heap_profile_foreach()
+ */
+typedef void (*sys_heap_profile_cb_t)(struct sys_heap_profile *prof, void *user_data);
+
+/**
+ * @brief Call a function for every attached heap profile
+ *
+ * @param cb Function to call
+ * @param user_data Passed to @p cb
+ */
+void sys_heap_profile_foreach(sys_heap_profile_cb_t cb, void *user_data);
+
+/**
+ * @brief Find an attached heap profile by name
+ *
+ * @param name Profile name
+ * @return The profile, or NULL if none has that name
+ */
+struct sys_heap_profile *sys_heap_profile_find(const char *name);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HEAP_PROFILE_H_ */
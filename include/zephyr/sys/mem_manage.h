@@ -504,6 +504,19 @@ __syscall void k_mem_paging_histogram_backing_store_page_in_get(
 __syscall void k_mem_paging_histogram_backing_store_page_out_get(
 	struct k_mem_paging_histogram_t *hist);
 
+/**
+ * Get the page fault timing histogram
+ *
+ * This populates the timing histogram struct being passed in
+ * as argument. The time of a page fault covers the whole handling
+ * of the fault, eviction, page-out, page-in and read-ahead. Its
+ * bins use the bounds of the backing store histograms.
+ *
+ * @param[in,out] hist Timing histogram struct to be filled.
+ */
+__syscall void k_mem_paging_histogram_page_fault_get(
+	struct k_mem_paging_histogram_t *hist);
+
 #include <syscalls/mem_manage.h>
 
 /** @} */
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_MPMC_QUEUE_H_
+#define ZEPHYR_INCLUDE_SYS_MPMC_QUEUE_H_
+
+#include <stddef.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#ifdef CONFIG_MULTITHREADING
+#include <zephyr/kernel.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Multi producer, multi consumer queue API
+ * @defgroup mpmc_queue_apis MPMC queue APIs
+ * @ingroup datastructure_apis
+ *
+ * A bounded queue of fixed-size items, in which producers and consumers
+ * in any number of threads, interrupts and CPUs synchronize with atomic
+ * operations on a sequence number per slot instead of a lock.  Putting
+ * and getting copy the item into and out of its slot.
+ *
+ * The non-blocking calls never enter the scheduler except to wake a
+ * thread waiting in sys_mpmc_queue_put_wait() or
+ * sys_mpmc_queue_get_wait(), which block only when the queue is full or
+ * empty.
+ *
+ * A producer or consumer preempted between claiming a slot and copying
+ * its item holds up the other side at that slot until it resumes, so the
+ * queue may briefly appear full or empty while other slots are usable.
+ *
+ * The queue is not a kernel object and cannot be used from user mode.
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Each slot holds its sequence number followed by the item */
+#define Z_MPMC_QUEUE_STRIDE(item_size) \
+	(ROUND_UP(item_size, sizeof(atomic_t)) + sizeof(atomic_t))
+
+#ifdef CONFIG_MULTITHREADING
+#define Z_MPMC_QUEUE_WAIT_INITIALIZER(obj) \
+	.not_empty = Z_SEM_INITIALIZER(obj.not_empty, 0, 1), \
+	.not_full = Z_SEM_INITIALIZER(obj.not_full, 0, 1),
+#else
+#define Z_MPMC_QUEUE_WAIT_INITIALIZER(obj)
+#endif
+
+/** @endcond */
+
+/**
+ * @brief Multi producer, multi consumer queue
+ */
+struct sys_mpmc_queue {
+	/** @cond INTERNAL_HIDDEN */
+	atomic_t head;
+	atomic_t tail;
+	uint8_t *buf;
+	size_t stride;
+	size_t item_size;
+	uint32_t mask;
+#ifdef CONFIG_MULTITHREADING
+	atomic_t get_waiters;
+	atomic_t put_waiters;
+	struct k_sem not_empty;
+	struct k_sem not_full;
+#endif
+	/** @endcond */
+};
+
+/**
+ * @brief Size of the buffer of a queue
+ *
+ * @param item_size Size of an item in bytes
+ * @param count Number of items
+ */
+#define SYS_MPMC_QUEUE_BUF_SIZE(item_size, count) \
+	(Z_MPMC_QUEUE_STRIDE(item_size) * (count))
+
+/**
+ * @brief Statically define and initialize a queue
+ *
+ * @param name Name of the queue
+ * @param item_sz Size of an item in bytes
+ * @param cnt Number of items, a power of two
+ */
+#define SYS_MPMC_QUEUE_DEFINE(name, item_sz, cnt)				\
+	BUILD_ASSERT(IS_POWER_OF_TWO(cnt), "queue length must be a power of two"); \
+	static atomic_t _sys_mpmc_queue_buf_##name[				\
+		SYS_MPMC_QUEUE_BUF_SIZE(item_sz, cnt) / sizeof(atomic_t)];	\
+	struct sys_mpmc_queue name = {						\
+		.buf = (uint8_t *)_sys_mpmc_queue_buf_##name,			\
+		.stride = Z_MPMC_QUEUE_STRIDE(item_sz),				\
+		.item_size = (item_sz),						\
+		.mask = (cnt) - 1,						\
+		Z_MPMC_QUEUE_WAIT_INITIALIZER(name)				\
+	}
+
+/**
+ * @brief Initialize a queue
+ *
+ * @param q Queue
+ * @param buf Buffer of SYS_MPMC_QUEUE_BUF_SIZE(@p item_size, @p count)
+ *        bytes, aligned to an atomic_t
+ * @param item_size Size of an item in bytes
+ * @param count Number of items, a power of two
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @p count is not a power of two or @p buf is
+ *         misaligned
+ */
+int sys_mpmc_queue_init(struct sys_mpmc_queue *q, void *buf, size_t item_size,
+			uint32_t count);
+
+/**
+ * @brief Put an item at the end of a queue
+ *
+ * @param q Queue
+ * @param item Item to copy into the queue
+ *
+ * @retval 0 on success
+ * @retval -ENOMSG if the queue is full
+ */
+int sys_mpmc_queue_put(struct sys_mpmc_queue *q, const void *item);
+
+/**
+ * @brief Get the item at the front of a queue
+ *
+ * @param q Queue
+ * @param item Filled with the item
+ *
+ * @retval 0 on success
+ * @retval -ENOMSG if the queue is empty
+ */
+int sys_mpmc_queue_get(struct sys_mpmc_queue *q, void *item);
+
+#if defined(CONFIG_MULTITHREADING) || defined(__DOXYGEN__)
+
+/**
+ * @brief Put an item at the end of a queue, waiting for room
+ *
+ * Like sys_mpmc_queue_put(), waiting for a consumer to make room while
+ * the queue is full.  Waiters are not ordered between themselves.
+ *
+ * @note Can be called by ISRs only with @p timeout set to K_NO_WAIT.
+ *
+ * @param q Queue
+ * @param item Item to copy into the queue
+ * @param timeout Waiting period, or one of the special values K_NO_WAIT
+ *        and K_FOREVER
+ *
+ * @retval 0 on success
+ * @retval -ENOMSG if the queue is full and @p timeout is K_NO_WAIT
+ * @retval -EAGAIN if the queue was still full at the end of @p timeout
+ */
+int sys_mpmc_queue_put_wait(struct sys_mpmc_queue *q, const void *item,
+			    k_timeout_t timeout);
+
+/**
+ * @brief Get the item at the front of a queue, waiting for one
+ *
+ * Like sys_mpmc_queue_get(), waiting for a producer while the queue is
+ * empty.  Waiters are not ordered between themselves.
+ *
+ * @note Can be called by ISRs only with @p timeout set to K_NO_WAIT.
+ *
+ * @param q Queue
+ * @param item Filled with the item
+ * @param timeout Waiting period, or one of the special values K_NO_WAIT
+ *        and K_FOREVER
+ *
+ * @retval 0 on success
+ * @retval -ENOMSG if the queue is empty and @p timeout is K_NO_WAIT
+ * @retval -EAGAIN if the queue was still empty at the end of @p timeout
+ */
+int sys_mpmc_queue_get_wait(struct sys_mpmc_queue *q, void *item,
+			    k_timeout_t timeout);
+
+#endif /* CONFIG_MULTITHREADING */
+
+/**
+ * @brief Get the number of items in a queue
+ *
+ * The value is only a snapshot while other contexts use the queue.
+ *
+ * @param q Queue
+ *
+ * @return Number of items
+ */
+static inline uint32_t sys_mpmc_queue_num_used_get(struct sys_mpmc_queue *q)
+{
+	/* Loading the tail first keeps the head from lagging behind it */
+	unsigned long tail = (unsigned long)atomic_get(&q->tail);
+	uint32_t used = (uint32_t)((unsigned long)atomic_get(&q->head) - tail);
+
+	return MIN(used, q->mask + 1U);
+}
+
+/**
+ * @brief Get the capacity of a queue
+ *
+ * @param q Queue
+ *
+ * @return Number of items the queue holds when full
+ */
+static inline uint32_t sys_mpmc_queue_capacity(struct sys_mpmc_queue *q)
+{
+	return q->mask + 1U;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_MPMC_QUEUE_H_ */
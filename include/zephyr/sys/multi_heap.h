@@ -6,9 +6,20 @@
 #define ZEPHYR_INCLUDE_SYS_MULTI_HEAP_H_
 
 #include <zephyr/types.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
 
 #define MAX_MULTI_HEAPS 8
 
+/**
+ * @brief Number of allocation size classes counted per heap
+ *
+ * With @kconfig{CONFIG_SYS_MULTI_HEAP_STATS}, class @c n counts
+ * allocations of up to 16 << n bytes, and the last class also counts
+ * everything larger.
+ */
+#define SYS_MULTI_HEAP_STATS_SIZES 8
+
 /**
  * @brief Multi-heap allocator
  *
@@ -55,6 +66,11 @@ typedef void *(*sys_multi_heap_fn_t)(struct sys_multi_heap *mheap, void *cfg,
 struct sys_multi_heap_rec {
 	struct sys_heap *heap;
 	void *user_data;
+	/* Latency class, lower is faster */
+	unsigned int latency;
+#ifdef CONFIG_SYS_MULTI_HEAP_STATS
+	atomic_t served[SYS_MULTI_HEAP_STATS_SIZES];
+#endif
 };
 
 struct sys_multi_heap {
@@ -162,4 +178,118 @@ const struct sys_multi_heap_rec *sys_multi_heap_get_heap(const struct sys_multi_
  */
 void sys_multi_heap_free(struct sys_multi_heap *mheap, void *block);
 
+/**
+ * @brief Set the latency class of a heap
+ *
+ * Latency classes rank the heaps of a multi heap from the fastest
+ * memory (class zero, for example TCM) to the slowest (for example
+ * external PSRAM).  They drive sys_multi_heap_placement_choice() and
+ * sys_multi_heap_migrate().  Heaps are in class zero when added.
+ *
+ * @param mheap Multi heap pointer
+ * @param heap A heap previously added to @p mheap
+ * @param latency Latency class of @p heap
+ * @retval 0 on success
+ * @retval -ENOENT if @p heap is not part of @p mheap
+ */
+int sys_multi_heap_set_latency(struct sys_multi_heap *mheap,
+			       struct sys_heap *heap, unsigned int latency);
+
+/** Placement may fall back to slower latency classes */
+#define SYS_MULTI_HEAP_FALLBACK_SLOWER BIT(0)
+
+/** Placement may fall back to faster latency classes */
+#define SYS_MULTI_HEAP_FALLBACK_FASTER BIT(1)
+
+/**
+ * @brief Placement hint for sys_multi_heap_placement_choice()
+ */
+struct sys_multi_heap_hint {
+	/** Preferred latency class */
+	unsigned int latency;
+	/** SYS_MULTI_HEAP_FALLBACK_* flags */
+	unsigned int flags;
+};
+
+/**
+ * @brief Define a placement hint
+ *
+ * Hints are usually defined once per call site and passed by address
+ * as the configuration parameter of sys_multi_heap_alloc().
+ *
+ * @param name Name of the hint
+ * @param _latency Preferred latency class
+ * @param _flags SYS_MULTI_HEAP_FALLBACK_* flags
+ */
+#define SYS_MULTI_HEAP_HINT_DEFINE(name, _latency, _flags) \
+	struct sys_multi_heap_hint name = { \
+		.latency = (_latency), \
+		.flags = (_flags), \
+	}
+
+/**
+ * @brief Latency class placement policy
+ *
+ * A choice function for sys_multi_heap_init() that interprets the
+ * configuration parameter as a pointer to a struct sys_multi_heap_hint.
+ * Heaps of the preferred latency class are tried first, in memory
+ * order.  With SYS_MULTI_HEAP_FALLBACK_SLOWER, slower classes are then
+ * tried from the nearest one outwards, and likewise faster classes
+ * with SYS_MULTI_HEAP_FALLBACK_FASTER.  A NULL hint asks for the
+ * fastest memory with fallback to slower classes.
+ *
+ * @param mheap Multi heap pointer
+ * @param cfg Pointer to a struct sys_multi_heap_hint, or NULL
+ * @param align Alignment of requested memory (or zero for no alignment)
+ * @param size The user-specified allocation size in bytes
+ * @return A pointer to the allocated memory, or NULL
+ */
+void *sys_multi_heap_placement_choice(struct sys_multi_heap *mheap, void *cfg,
+				      size_t align, size_t size);
+
+/**
+ * @brief Move a block to faster memory
+ *
+ * Allocates a block of the same usable size by calling the choice
+ * function with @p cfg, and if it lands in a faster latency class than
+ * @p block, copies the contents over and frees @p block.  Otherwise the
+ * new allocation is dropped and @p block is left untouched.  Intended
+ * for long-lived buffers found to be hot after they were allocated.
+ *
+ * The caller must make sure nothing else references @p block, since
+ * all references have to be updated to the returned pointer.
+ *
+ * @param mheap Multi heap pointer
+ * @param block Block allocated from @p mheap
+ * @param cfg Opaque configuration parameter, as for sys_multi_heap_fn_t
+ * @param align Alignment @p block was allocated with, or zero
+ * @return The block's new address, or @p block if it was not moved
+ */
+void *sys_multi_heap_migrate(struct sys_multi_heap *mheap, void *block,
+			     void *cfg, size_t align);
+
+/**
+ * @brief Per-heap allocation statistics
+ */
+struct sys_multi_heap_stats {
+	/** Allocations served, by size class (see SYS_MULTI_HEAP_STATS_SIZES) */
+	uint32_t served[SYS_MULTI_HEAP_STATS_SIZES];
+};
+
+/**
+ * @brief Get the allocation statistics of a heap
+ *
+ * Requires @kconfig{CONFIG_SYS_MULTI_HEAP_STATS}.  Counts every
+ * successful allocation and migration the multi heap served from
+ * @p heap since it was added.
+ *
+ * @param mheap Multi heap pointer
+ * @param heap A heap previously added to @p mheap
+ * @param stats Filled with the statistics
+ * @retval 0 on success
+ * @retval -ENOENT if @p heap is not part of @p mheap
+ */
+int sys_multi_heap_stats_get(struct sys_multi_heap *mheap, struct sys_heap *heap,
+			     struct sys_multi_heap_stats *stats);
+
 #endif /* ZEPHYR_INCLUDE_SYS_MULTI_HEAP_H_ */
@@ -33,6 +33,10 @@ struct k_p4wq_work {
 	k_p4wq_handler_t handler;
 	bool sync;
 	struct k_sem done_sem;
+#ifdef CONFIG_P4WQ_PER_CPU
+	/* CPUs the item may run on, 0 for any */
+	uint32_t cpu_mask;
+#endif
 
 	/* reserved for implementation */
 	union {
@@ -41,6 +45,9 @@ struct k_p4wq_work {
 	};
 	struct k_thread *thread;
 	struct k_p4wq *queue;
+#ifdef CONFIG_P4WQ_PER_CPU
+	uint8_t cpu;
+#endif
 };
 
 #define K_P4WQ_QUEUE_PER_THREAD		BIT(0)
@@ -67,7 +74,11 @@ struct k_p4wq {
 	_wait_q_t waitq;
 
 	/* Work items waiting for processing */
+#ifdef CONFIG_P4WQ_PER_CPU
+	struct rbtree cpu_queue[CONFIG_MP_MAX_NUM_CPUS];
+#else
 	struct rbtree queue;
+#endif
 
 	/* Work items in progress */
 	sys_dlist_t active;
@@ -174,6 +185,12 @@ void k_p4wq_add_thread(struct k_p4wq *queue, struct k_thread *thread,
  * higher-priority work items are available.  The handler may be
  * invoked on any CPU.
  *
+ * With @kconfig{CONFIG_P4WQ_PER_CPU}, the item is queued on the
+ * submitting CPU, or on the first CPU of its cpu_mask if it may not run
+ * there.  Worker threads take items from the queue of their CPU, and
+ * steal from the queues of other CPUs only the items of strictly higher
+ * priority which may run on their CPU.
+ *
  * The caller must not mutate the struct while it is stored in the
  * queue.  The memory should remain unchanged until k_p4wq_cancel() is
  * called or until the entry to the handler function.
@@ -38,16 +38,27 @@
  * structure of the tree being generated dynamically via a stack as
  * the tree is recursed.  So the overall memory overhead of a node is
  * just two pointers, identical with a doubly-linked list.
+ *
+ * With CONFIG_RB_PARENT, nodes get a third pointer to their parent.
+ * Removal then needs no search and in-order iteration needs no stack
+ * (see rb_next() and rb_prev()).  With CONFIG_RB_AUGMENT on top of
+ * it, the tree maintains per-node data derived from the subtree of
+ * each node (e.g. a subtree maximum for interval trees) through a
+ * callback.
  */
 
 #ifndef ZEPHYR_INCLUDE_SYS_RB_H_
 #define ZEPHYR_INCLUDE_SYS_RB_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 struct rbnode {
 	struct rbnode *children[2];
+#ifdef CONFIG_RB_PARENT
+	struct rbnode *parent;
+#endif
 };
 
 /* Theoretical maximum depth of tree based on pointer size. If memory
@@ -80,9 +91,24 @@ struct rbnode {
  */
 typedef bool (*rb_lessthan_t)(struct rbnode *a, struct rbnode *b);
 
+/**
+ * @typedef rb_augment_t
+ * @brief Red/black tree augmentation callback
+ *
+ * Recomputes the data the user keeps in the container of the node
+ * from the node itself and from its children, see rb_left() and
+ * rb_right(), whose data is already up to date.  Called by the tree
+ * for every node whose subtree changed, bottom up.  Only available
+ * with CONFIG_RB_AUGMENT.
+ */
+typedef void (*rb_augment_t)(struct rbnode *node);
+
 struct rbtree {
 	struct rbnode *root;
 	rb_lessthan_t lessthan_fn;
+#ifdef CONFIG_RB_AUGMENT
+	rb_augment_t augment_fn;
+#endif
 	int max_depth;
 #ifdef CONFIG_MISRA_SANE
 	struct rbnode *iter_stack[Z_MAX_RBTREE_DEPTH];
@@ -106,9 +132,73 @@ void rb_insert(struct rbtree *tree, struct rbnode *node);
 
 /**
  * @brief Remove node from tree
+ *
+ * With CONFIG_RB_PARENT, the path to the node is found by following
+ * its parent pointers instead of searching the tree, so a node which
+ * was never inserted must have been zeroed.
  */
 void rb_remove(struct rbtree *tree, struct rbnode *node);
 
+/**
+ * @brief Build a tree from an array of sorted nodes
+ *
+ * Links the nodes into a balanced tree in linear time, which is
+ * cheaper than inserting them one by one.  The tree must be empty and
+ * the nodes must be sorted in increasing order according to the
+ * tree's lessthan_fn, which is not called.
+ *
+ * @param tree An empty tree
+ * @param nodes Array of pointers to the nodes, sorted
+ * @param count Number of nodes in the array
+ */
+void rb_build_sorted(struct rbtree *tree, struct rbnode **nodes, size_t count);
+
+/**
+ * @brief Returns the left child of a node
+ *
+ * Meant for augmentation callbacks and for searching the tree.
+ */
+static inline struct rbnode *rb_left(struct rbnode *node)
+{
+	return z_rb_child(node, 0U);
+}
+
+/**
+ * @brief Returns the right child of a node
+ *
+ * Meant for augmentation callbacks and for searching the tree.
+ */
+static inline struct rbnode *rb_right(struct rbnode *node)
+{
+	return z_rb_child(node, 1U);
+}
+
+#ifdef CONFIG_RB_PARENT
+/**
+ * @brief Returns the parent of a node, NULL for the root
+ */
+static inline struct rbnode *rb_parent(struct rbnode *node)
+{
+	return node->parent;
+}
+
+/**
+ * @brief Returns the in-order successor of a node of a tree
+ *
+ * Runs in amortized constant time and needs no stack.
+ *
+ * @return The next node, NULL if node is the highest-sorted one
+ */
+struct rbnode *rb_next(struct rbnode *node);
+
+/**
+ * @brief Returns the in-order predecessor of a node of a tree
+ *
+ * @return The previous node, NULL if node is the lowest-sorted one
+ */
+struct rbnode *rb_prev(struct rbnode *node);
+#endif
+
 /**
  * @brief Returns the lowest-sorted member of the tree
  */
@@ -152,6 +242,15 @@ static inline void rb_walk(struct rbtree *tree, rb_visit_t visit_fn,
 }
 #endif
 
+#ifdef CONFIG_RB_PARENT
+struct _rb_foreach {
+	struct rbnode *cur;
+};
+
+#define _RB_FOREACH_INIT(tree, node) {					\
+	.cur = NULL							\
+}
+#else
 struct _rb_foreach {
 	struct rbnode **stack;
 	uint8_t *is_left;
@@ -172,6 +271,7 @@ struct _rb_foreach {
 	.top     = -1							\
 }
 #endif
+#endif
 
 struct rbnode *z_rb_foreach_next(struct rbtree *tree, struct _rb_foreach *f);
 
@@ -182,7 +282,8 @@ struct rbnode *z_rb_foreach_next(struct rbtree *tree, struct _rb_foreach *f);
  * be clumsy for some purposes and on some architectures wastes
  * significant memory in stack frames.  This macro implements a
  * non-recursive "foreach" loop that can iterate directly on the tree,
- * at a moderate cost in code size.
+ * at a moderate cost in code size.  With CONFIG_RB_PARENT, the loop
+ * needs no stack either.
  *
  * Note that the resulting loop is not safe against modifications to
  * the tree.  Changes to the tree structure during the loop will
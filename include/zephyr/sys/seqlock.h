@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SEQLOCK_H_
+#define ZEPHYR_INCLUDE_SYS_SEQLOCK_H_
+
+#include <stdbool.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup seqlock_apis Sequence lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Sequence lock
+ *
+ * A sequence lock protects a small piece of shared data that is read
+ * far more often than it is written.  Writers serialize on a spinlock
+ * and bump a sequence counter before and after modifying the data.
+ * Readers never take a lock: they copy the data out and retry if the
+ * counter shows a writer was active in the meantime.
+ *
+ * Readers must only copy data out inside the read section, never act
+ * on it, since they may observe a torn state that is then discarded.
+ * Data containing pointers the reader would follow is not a good fit.
+ *
+ * Typical reader:
+ *
+ * @code
+ * uint32_t seq;
+ *
+ * do {
+ *         seq = sys_seqlock_read_begin(&sl);
+ *         copy = shared;
+ * } while (sys_seqlock_read_retry(&sl, seq));
+ * @endcode
+ */
+struct sys_seqlock {
+	/* Odd while a write is in progress */
+	atomic_t seq;
+	struct k_spinlock lock;
+};
+
+/**
+ * @brief Statically define and initialize a sequence lock
+ *
+ * @param name Name of the sequence lock.
+ */
+#define SYS_SEQLOCK_DEFINE(name) \
+	struct sys_seqlock name = { 0 }
+
+/**
+ * @brief Initialize a sequence lock
+ *
+ * @param sl Sequence lock
+ */
+static inline void sys_seqlock_init(struct sys_seqlock *sl)
+{
+	*sl = (struct sys_seqlock) { 0 };
+}
+
+/**
+ * @brief Open a write section on a lock whose writers are already serialized
+ *
+ * For data whose writers are already serialized by an outer lock held
+ * with interrupts masked, so an extra spinlock would be redundant.
+ * Callers must not mix this with sys_seqlock_write_lock() on the same
+ * sequence lock.
+ *
+ * @param sl Sequence lock
+ */
+static ALWAYS_INLINE void sys_seqlock_write_begin(struct sys_seqlock *sl)
+{
+	(void)atomic_inc(&sl->seq);
+	barrier_dmem_fence_full();
+}
+
+/**
+ * @brief Close a write section opened with sys_seqlock_write_begin()
+ *
+ * @param sl Sequence lock
+ */
+static ALWAYS_INLINE void sys_seqlock_write_end(struct sys_seqlock *sl)
+{
+	barrier_dmem_fence_full();
+	(void)atomic_inc(&sl->seq);
+}
+
+/**
+ * @brief Lock a sequence lock for writing
+ *
+ * Takes the writer spinlock, masking interrupts locally, and opens a
+ * write section.  Readers started before the matching
+ * sys_seqlock_write_unlock() will retry.
+ *
+ * @param sl Sequence lock
+ * @return Spinlock key to pass to sys_seqlock_write_unlock()
+ */
+static ALWAYS_INLINE k_spinlock_key_t sys_seqlock_write_lock(struct sys_seqlock *sl)
+{
+	k_spinlock_key_t key = k_spin_lock(&sl->lock);
+
+	sys_seqlock_write_begin(sl);
+
+	return key;
+}
+
+/**
+ * @brief Unlock a sequence lock locked for writing
+ *
+ * @param sl Sequence lock
+ * @param key Key returned by sys_seqlock_write_lock()
+ */
+static ALWAYS_INLINE void sys_seqlock_write_unlock(struct sys_seqlock *sl,
+						   k_spinlock_key_t key)
+{
+	sys_seqlock_write_end(sl);
+	k_spin_unlock(&sl->lock, key);
+}
+
+/**
+ * @brief Start a read section
+ *
+ * Waits for any write in progress on another CPU to finish.  Writers
+ * on the local CPU run with interrupts masked, so a reader can never
+ * spin on a write it interrupted.
+ *
+ * @param sl Sequence lock
+ * @return Sequence value to pass to sys_seqlock_read_retry()
+ */
+static ALWAYS_INLINE uint32_t sys_seqlock_read_begin(struct sys_seqlock *sl)
+{
+	uint32_t seq;
+
+	do {
+		seq = (uint32_t)atomic_get(&sl->seq);
+	} while ((seq & 1U) != 0U);
+	barrier_dmem_fence_full();
+
+	return seq;
+}
+
+/**
+ * @brief End a read section
+ *
+ * @param sl Sequence lock
+ * @param seq Value returned by the matching sys_seqlock_read_begin()
+ * @return true if a writer intervened and the data must be read again
+ */
+static ALWAYS_INLINE bool sys_seqlock_read_retry(struct sys_seqlock *sl,
+						 uint32_t seq)
+{
+	barrier_dmem_fence_full();
+
+	return (uint32_t)atomic_get(&sl->seq) != seq;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SEQLOCK_H_ */
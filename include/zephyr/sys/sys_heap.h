@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <zephyr/types.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/mem_stats.h>
 
 #ifdef __cplusplus
@@ -57,6 +58,16 @@ struct sys_heap {
 	struct z_heap *heap;
 	void *init_mem;
 	size_t init_bytes;
+#if defined(CONFIG_KHEAP_MAGAZINES) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+	/* Bytes allocated from the heap but parked unused in a cache
+	 * layered on top of it, updated without the heap's lock.
+	 */
+	atomic_t cached_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_PROFILE
+	/* See sys_heap_profile_attach() */
+	struct sys_heap_profile *profile;
+#endif
 };
 
 struct z_heap_stress_result {
@@ -195,6 +206,60 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
  */
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem);
 
+#ifdef CONFIG_KHEAP_MAGAZINES
+/**
+ * @cond INTERNAL_HIDDEN
+ *
+ * Account for an allocated block being parked in (@a cached true) or
+ * taken back out of a cache layered on top of the heap, so that
+ * runtime statistics and heap listeners see it as free while parked.
+ * Only reads the block's own header, so the caller need not hold
+ * whatever lock serializes the heap.
+ */
+void z_sys_heap_cache_account(struct sys_heap *heap, void *mem, bool cached);
+/** @endcond */
+#endif
+
+/**
+ * @cond INTERNAL_HIDDEN
+ *
+ * Heap profiler hooks.  Allocation wrappers layered on top of a
+ * sys_heap pass their own caller as the call site, so allocations are
+ * charged to the code that asked for the memory rather than to the
+ * wrapper.  A NULL site is not recorded, for wrappers that record the
+ * allocation themselves once it is complete.
+ */
+#ifdef CONFIG_SYS_HEAP_PROFILE
+#define Z_SYS_HEAP_SITE() __builtin_return_address(0)
+
+void z_sys_heap_profile_log(struct sys_heap *heap, void *site, size_t bytes,
+			    bool ok);
+
+static inline void z_sys_heap_profile_record(struct sys_heap *heap, void *site,
+					     size_t bytes, bool ok)
+{
+	if (heap->profile != NULL && site != NULL) {
+		z_sys_heap_profile_log(heap, site, bytes, ok);
+	}
+}
+#else
+#define Z_SYS_HEAP_SITE() NULL
+
+static inline void z_sys_heap_profile_record(struct sys_heap *heap, void *site,
+					     size_t bytes, bool ok)
+{
+	(void)heap;
+	(void)site;
+	(void)bytes;
+	(void)ok;
+}
+#endif
+
+/* sys_heap_aligned_alloc() charged to @a site */
+void *z_sys_heap_aligned_alloc_at(struct sys_heap *heap, size_t align,
+				  size_t bytes, void *site);
+/** @endcond */
+
 /** @brief Validate heap integrity
  *
  * Validates the internal integrity of a sys_heap.  Intended for unit
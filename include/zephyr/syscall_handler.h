@@ -445,11 +445,35 @@ static inline int z_obj_validation_check(struct z_object *ko,
 	return ret;
 }
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+/**
+ * Validate a kernel object, looking it up in the object cache of the
+ * current thread first.
+ *
+ * Same as z_obj_validation_check() on the object found by
+ * z_object_find(), but the validations of initialized objects which
+ * succeeded are cached.
+ *
+ * @param obj Address of the kernel object
+ * @param otype Expected type of the kernel object, or K_OBJ_ANY
+ * @param init Indicate whether the object needs to already be in initialized
+ *             or uninitialized state, or that we don't care
+ * @return See z_object_validate()
+ */
+int z_obj_cached_validation_check(const void *obj, enum k_objects otype,
+				  enum _obj_init_check init);
+
+#define Z_SYSCALL_IS_OBJ(ptr, type, init) \
+	Z_SYSCALL_VERIFY_MSG(z_obj_cached_validation_check(		\
+				     (const void *)ptr,			\
+				     type, init) == 0, "access denied")
+#else
 #define Z_SYSCALL_IS_OBJ(ptr, type, init) \
 	Z_SYSCALL_VERIFY_MSG(z_obj_validation_check(			\
 				     z_object_find((const void *)ptr),	\
 				     (const void *)ptr,			\
 				     type, init) == 0, "access denied")
+#endif
 
 /**
  * @brief Runtime check driver object pointer for presence of operation
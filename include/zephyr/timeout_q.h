@@ -30,6 +30,13 @@ static inline void z_init_timeout(struct _timeout *to)
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout);
 
+/* Like z_add_timeout(), with an expiry which may be delayed by up to
+ * slack ticks to coalesce with other timeouts when CONFIG_TIMER_SLACK is
+ * enabled.
+ */
+void z_add_timeout_slack(struct _timeout *to, _timeout_func_t fn,
+			 k_timeout_t timeout, k_ticks_t slack);
+
 int z_abort_timeout(struct _timeout *to);
 
 static inline bool z_is_inactive_timeout(const struct _timeout *to)
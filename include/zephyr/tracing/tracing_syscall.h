@@ -11,6 +11,20 @@
 #include "tracing_sysview_syscall.h"
 #elif defined CONFIG_TRACING_TEST
 #include "tracing_test_syscall.h"
+#elif defined CONFIG_PERF_STATS_SYSCALL
+
+#include <stdint.h>
+
+uint32_t perf_stats_syscall_enter(void);
+void perf_stats_syscall_exit(uint32_t start);
+
+/* Times the syscalls into the "syscall" performance histogram */
+#define sys_port_trace_syscall_enter(id, name, ...) \
+	uint32_t perf_stats_syscall_start = perf_stats_syscall_enter()
+
+#define sys_port_trace_syscall_exit(id, name, ...) \
+	perf_stats_syscall_exit(perf_stats_syscall_start)
+
 #else
 
 /**
@@ -22,6 +22,24 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Publishing statistics of a channel.
+ *
+ * The times are in microseconds.
+ */
+struct zbus_channel_pub_stats {
+	/** Number of publications, including the forced notifications. */
+	uint32_t count;
+	/** Maximum time taken by a publication, from the call until the return. */
+	uint32_t time_max;
+	/** Total time taken by the publications. */
+	uint64_t time_total;
+	/** Maximum time spent notifying the observers by a publication. */
+	uint32_t observers_time_max;
+	/** Total time spent notifying the observers. */
+	uint64_t observers_time_total;
+};
+
 /**
  * @brief Type used to represent a channel.
  *
@@ -63,6 +81,11 @@ struct zbus_channel {
 	sys_slist_t *runtime_observers;
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS_POOL_SIZE  */
 
+#if defined(CONFIG_ZBUS_CHANNEL_PUB_STATS) || defined(__DOXYGEN__)
+	/** Publishing statistics. They are updated with the channel locked. */
+	struct zbus_channel_pub_stats *const pub_stats;
+#endif /* CONFIG_ZBUS_CHANNEL_PUB_STATS */
+
 	/** Channel observer list. Represents the channel's observers list, it can be empty or
 	 * have listeners and subscribers mixed in any sequence.
 	 */
@@ -96,6 +119,13 @@ struct zbus_observer {
 
 	/** Observer callback function. It turns the observer into a listener. */
 	void (*const callback)(const struct zbus_channel *chan);
+
+#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER) || defined(__DOXYGEN__)
+	/** Observer message FIFO. It turns the observer into a message subscriber, which
+	 * receives a copy of the published messages.
+	 */
+	struct k_fifo *const message_fifo;
+#endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -136,6 +166,14 @@ struct zbus_observer {
 #define ZBUS_RUNTIME_OBSERVERS_LIST_INIT(_slist_name) /* No runtime observers */
 #endif
 
+#if defined(CONFIG_ZBUS_CHANNEL_PUB_STATS)
+#define ZBUS_CHANNEL_PUB_STATS_DECL(_stats_name) static struct zbus_channel_pub_stats _stats_name
+#define ZBUS_CHANNEL_PUB_STATS_INIT(_stats_name) .pub_stats = &_stats_name,
+#else
+#define ZBUS_CHANNEL_PUB_STATS_DECL(_stats_name)
+#define ZBUS_CHANNEL_PUB_STATS_INIT(_stats_name) /* No publishing statistics */
+#endif
+
 #if defined(CONFIG_ZBUS_STRUCTS_ITERABLE_ACCESS)
 #define _ZBUS_STRUCT_DECLARE(_type, _name) STRUCT_SECTION_ITERABLE(_type, _name)
 #else
@@ -196,6 +234,7 @@ struct zbus_observer {
 	static _type _CONCAT(_zbus_message_, _name) = _init_val;                             \
 	static K_MUTEX_DEFINE(_CONCAT(_zbus_mutex_, _name));                                 \
 	ZBUS_RUNTIME_OBSERVERS_LIST_DECL(_CONCAT(_runtime_observers_, _name));               \
+	ZBUS_CHANNEL_PUB_STATS_DECL(_CONCAT(_zbus_pub_stats_, _name));                       \
 	FOR_EACH_NONEMPTY_TERM(_ZBUS_OBS_EXTERN, (;), _observers)                            \
 	static const struct zbus_observer *const _CONCAT(_zbus_observers_, _name)[] = {      \
 	FOR_EACH_NONEMPTY_TERM(ZBUS_REF, (,), _observers) NULL};                             \
@@ -208,6 +247,8 @@ struct zbus_observer {
 		.mutex = &_CONCAT(_zbus_mutex_, _name),	       /* Channel's Mutex */         \
 		ZBUS_RUNTIME_OBSERVERS_LIST_INIT(                                            \
 			_CONCAT(_runtime_observers_, _name))   /* Runtime observer list */   \
+		ZBUS_CHANNEL_PUB_STATS_INIT(                                                 \
+			_CONCAT(_zbus_pub_stats_, _name))      /* Publishing statistics */   \
 		.observers = _CONCAT(_zbus_observers_, _name)} /* Static observer list */
 
 /**
@@ -258,6 +299,25 @@ struct zbus_observer {
 					       .enabled = true,                                    \
 				       .queue = NULL, .callback = (_cb)}
 
+#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER) || defined(__DOXYGEN__)
+/**
+ * @brief Define and initialize a message subscriber.
+ *
+ * This macro defines an observer of message subscriber type. It defines a FIFO where the bus puts
+ * a copy of each message published to the channels observed, and initialize the ``struct
+ * zbus_observer`` defining the message subscriber.
+ *
+ * @param[in] _name The message subscriber's name.
+ */
+#define ZBUS_MSG_SUBSCRIBER_DEFINE(_name)                                                          \
+	static K_FIFO_DEFINE(_zbus_observer_fifo_##_name);                                         \
+	_ZBUS_STRUCT_DECLARE(zbus_observer,                                                        \
+			     _name) = {ZBUS_OBSERVER_NAME_INIT(_name) /* Name field */             \
+					       .enabled = true,                                    \
+				       .queue = NULL, .callback = NULL,                            \
+				       .message_fifo = &_zbus_observer_fifo_##_name}
+#endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+
 /**
  *
  * @brief Publish to a channel
@@ -577,6 +637,52 @@ static inline const char *zbus_obs_name(const struct zbus_observer *obs)
 int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **chan,
 		  k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER) || defined(__DOXYGEN__)
+/**
+ * @brief Wait for a channel message.
+ *
+ * This routine makes the message subscriber to wait for a message. The message is the copy of the
+ * channel's message made when it was published, the channel does not need to be read or claimed.
+ *
+ * @param[in] sub The message subscriber's reference.
+ * @param[out] chan The channel's reference.
+ * @param[out] msg Reference to the message where the function copies the message to. It must be
+ * as large as the channel's message.
+ * @param[in] timeout Waiting period for a message arrival,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL The observer is not a message subscriber.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the CONFIG_ZBUS_ASSERT_MOCK is enabled.
+ */
+int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel **chan,
+		      void *msg, k_timeout_t timeout);
+#endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUB_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the publishing statistics of a channel.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] stats Reference to the statistics where the function copies the channel's
+ * statistics to.
+ * @param[in] reset Reset the channel's statistics after copying them.
+ * @param[in] timeout Waiting period to lock the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Statistics read.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the CONFIG_ZBUS_ASSERT_MOCK is enabled.
+ */
+int zbus_chan_pub_stats_get(const struct zbus_channel *chan, struct zbus_channel_pub_stats *stats,
+			    bool reset, k_timeout_t timeout);
+#endif /* CONFIG_ZBUS_CHANNEL_PUB_STATS */
+
 #if defined(CONFIG_ZBUS_STRUCTS_ITERABLE_ACCESS) || defined(__DOXYGEN__)
 /**
  *
@@ -38,14 +38,16 @@ int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
 
 	key = k_spin_lock(&futex_data->lock);
 
-	do {
+	if (wake_all) {
+		woken = (unsigned int)z_sched_wake_batch(&futex_data->wait_q, 0, NULL);
+	} else {
 		thread = z_unpend_first_thread(&futex_data->wait_q);
 		if (thread != NULL) {
 			woken++;
 			arch_thread_return_value_set(thread, 0);
 			z_ready_thread(thread);
 		}
-	} while (thread && wake_all);
+	}
 
 	z_reschedule(&futex_data->lock, key);
 
@@ -587,6 +587,30 @@ uint16_t arch_coredump_tgt_code_get(void);
 
 /** @} */
 
+/**
+ * @defgroup arch-profiler Architecture-specific sampling profiler APIs
+ * @ingroup arch-interface
+ * @{
+ */
+
+/**
+ * @brief Sample the call stack of the interrupted thread
+ *
+ * Called from an interrupt handler, with interrupts locked. Stores the
+ * program counter at which the current interrupt preempted the current
+ * thread followed, where frame pointers can be followed, by the return
+ * addresses of its callers.
+ *
+ * @param frames Array of addresses to fill.
+ * @param max_frames Size of @a frames, at least 1.
+ *
+ * @return Number of addresses stored, 0 if the interrupt did not preempt
+ *         a thread (e.g. it preempted another interrupt).
+ */
+size_t arch_profiler_sample(uintptr_t *frames, size_t max_frames);
+
+/** @} */
+
 /**
  * @defgroup arch-tls Architecture-specific Thread Local Storage APIs
  * @ingroup arch-interface
@@ -104,6 +104,10 @@ static inline void *z_thread_malloc(size_t size)
 	return z_thread_aligned_alloc(0, size);
 }
 
+/* k_heap_aligned_alloc() charged to the heap profiler call site @a site */
+void *z_kheap_aligned_alloc_at(struct k_heap *h, size_t align, size_t bytes,
+			       k_timeout_t timeout, void *site);
+
 /* set and clear essential thread flag */
 
 extern void z_thread_essential_set(void);
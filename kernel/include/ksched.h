@@ -61,6 +61,7 @@ void z_sched_abort(struct k_thread *thread);
 void z_sched_ipi(void);
 void z_sched_start(struct k_thread *thread);
 void z_ready_thread(struct k_thread *thread);
+bool z_thread_active_elsewhere(struct k_thread *thread);
 void z_requeue_current(struct k_thread *curr);
 struct k_thread *z_swap_next_thread(void);
 void z_thread_abort(struct k_thread *thread);
@@ -108,7 +109,8 @@ static inline bool z_is_thread_prevented_from_running(struct k_thread *thread)
 	uint8_t state = thread->base.thread_state;
 
 	return (state & (_THREAD_PENDING | _THREAD_PRESTART | _THREAD_DEAD |
-			 _THREAD_DUMMY | _THREAD_SUSPENDED)) != 0U;
+			 _THREAD_DUMMY | _THREAD_SUSPENDED |
+			 _THREAD_THROTTLED)) != 0U;
 
 }
 
@@ -327,11 +329,25 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data);
  */
 void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 
+/**
+ * Wake up all threads pending on the provided wait queue as one batch
+ *
+ * All threads are moved to the ready queue under a single hold of the
+ * scheduler lock, and the next thread to run is recomputed (and an IPI
+ * flagged) once for the whole batch rather than once per thread.  Waking
+ * many threads this way costs one reschedule instead of one per waiter.
+ *
+ * @param wait_q Wait queue to wake up
+ * @param swap_retval Swap return value for each woken thread
+ * @param swap_data Data return value to supplement swap_retval. May be NULL.
+ * @return Number of threads woken up
+ */
+int z_sched_wake_batch(_wait_q_t *wait_q, int swap_retval, void *swap_data);
+
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * Convenience wrapper for z_sched_wake_batch().
  *
  * @param wait_q Wait queue to wake up the highest prio thread
  * @param swap_retval Swap return value for woken thread
@@ -342,16 +358,21 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
 				    void *swap_data)
 {
-	bool woken = false;
-
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
-
-	/* True if we woke at least one thread up */
-	return woken;
+	return z_sched_wake_batch(wait_q, swap_retval, swap_data) > 0;
 }
 
+#ifdef CONFIG_EVENTS
+/**
+ * Wake up a list of threads collected by an event post as one batch
+ *
+ * Like z_sched_wake_thread() for every thread on the list linked through
+ * next_event_link, with a single reschedule for the whole list.
+ *
+ * @param head First thread on the list, may be NULL
+ */
+void z_sched_wake_event_list(struct k_thread *head);
+#endif
+
 /**
  * Atomically put the current thread to sleep on a wait queue, with timeout
  *
@@ -375,6 +396,30 @@ static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data);
 
+#ifdef CONFIG_IRQ_THREAD
+/**
+ * @brief Pend the current thread until it is woken as an interrupt thread
+ *
+ * Returns immediately if @p pending is not zero. Checking it and pending
+ * the thread are atomic with z_sched_irq_thread_wake(), which must be called
+ * after incrementing @p pending.
+ *
+ * @param pending Wake-up count of the current thread.
+ * @param wait_q Wait queue of the current thread only.
+ */
+void z_sched_irq_thread_wait(atomic_t *pending, _wait_q_t *wait_q);
+
+/**
+ * @brief Wake an interrupt thread
+ *
+ * Readies the thread waiting in z_sched_irq_thread_wait() on @p wait_q, if
+ * any. May be called from an ISR.
+ *
+ * @param wait_q Wait queue of the interrupt thread.
+ */
+void z_sched_irq_thread_wake(_wait_q_t *wait_q);
+#endif /* CONFIG_IRQ_THREAD */
+
 /**
  * @brief Walks the wait queue invoking the callback on each waiting thread
  *
@@ -428,9 +473,70 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Charge and arm deadline server budgets on context switch
+ *
+ * Called with the scheduler lock held, before @a thread becomes
+ * _current on this CPU.  Without CONFIG_USE_SWITCH this is called from
+ * z_thread_mark_switched_in() instead, once @a thread already is
+ * _current.
+ */
+void z_sched_cbs_switch(struct k_thread *thread);
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+/**
+ * @brief Record the latency of a thread made ready
+ *
+ * Called with the scheduler lock held when @a thread is added to the
+ * run queue after being created, woken up or resumed.
+ */
+void z_sched_latency_ready(struct k_thread *thread);
+
+/**
+ * @brief Start the preempted or blocked period of a thread
+ *
+ * Called with local interrupts masked when @a thread, the current
+ * thread, is switched out.
+ */
+void z_sched_latency_switched_out(struct k_thread *thread);
+
+/**
+ * @brief Record the ready or preempted latency of a thread
+ *
+ * Called with local interrupts masked when @a thread is switched in.
+ */
+void z_sched_latency_switched_in(struct k_thread *thread);
+#endif
+
+#ifdef CONFIG_SYS_PERF_THREAD
+/**
+ * @brief Charge the performance counters to the switched threads
+ *
+ * Called with local interrupts masked when @a from, if not NULL, is
+ * switched out and when @a to, if not NULL, is switched in.
+ */
+void z_sys_perf_switch(struct k_thread *from, struct k_thread *to);
+#endif
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	z_sched_cbs_switch(thread);
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	if (thread != _current) {
+		z_sched_latency_switched_out(_current);
+		z_sched_latency_switched_in(thread);
+	}
+#endif
+#ifdef CONFIG_SYS_PERF_THREAD
+	if (thread != _current) {
+		z_sys_perf_switch(_current, thread);
+	}
+#endif
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	z_sched_usage_stop();
 	z_sched_usage_start(thread);
@@ -17,6 +17,23 @@ extern void z_check_stack_sentinel(void);
 #define z_check_stack_sentinel() /**/
 #endif
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+/* Lowers the watermark of the current thread to the current stack frame,
+ * only called when switching from the thread stack.
+ */
+static ALWAYS_INLINE void z_stack_watermark_sample(void)
+{
+	struct k_thread *thread = _current;
+	uintptr_t sp = (uintptr_t)&thread;
+
+	if ((sp < thread->stack_info.watermark) && (sp >= thread->stack_info.start)) {
+		thread->stack_info.watermark = sp;
+	}
+}
+#else
+#define z_stack_watermark_sample() /**/
+#endif
+
 extern struct k_spinlock sched_spinlock;
 
 /* In SMP, the irq_lock() is a spinlock which is implicitly released
@@ -105,6 +122,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 	old_thread = _current;
 
 	z_check_stack_sentinel();
+	z_stack_watermark_sample();
 
 	old_thread->swap_retval = -EAGAIN;
 
@@ -206,6 +224,7 @@ static inline int z_swap_irqlock(unsigned int key)
 {
 	int ret;
 	z_check_stack_sentinel();
+	z_stack_watermark_sample();
 	ret = arch_swap(key);
 	return ret;
 }
@@ -246,6 +265,9 @@ static inline void z_dummy_thread_init(struct k_thread *dummy_thread)
 #ifdef CONFIG_THREAD_STACK_INFO
 	dummy_thread->stack_info.start = 0U;
 	dummy_thread->stack_info.size = 0U;
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	dummy_thread->stack_info.watermark = 0U;
+#endif
 #endif
 #ifdef CONFIG_USERSPACE
 	dummy_thread->mem_domain_info.mem_domain = &k_mem_domain_default;
@@ -225,6 +225,213 @@ extern volatile uintptr_t __stack_chk_guard;
 __pinned_bss
 bool z_sys_post_kernel;
 
+#ifdef CONFIG_INIT_PROFILING
+static struct init_profile_record init_profile[CONFIG_INIT_PROFILING_MAX_ENTRIES];
+
+size_t sys_init_profile_get(const struct init_profile_record **records)
+{
+	*records = init_profile;
+
+	return MIN(ARRAY_SIZE(init_profile), __init_end - __init_start);
+}
+
+static inline timing_t init_profile_start(void)
+{
+	return timing_counter_get();
+}
+
+static void init_profile_end(const struct init_entry *entry, timing_t start)
+{
+	timing_t end = timing_counter_get();
+	size_t idx = entry - __init_start;
+
+	/* Each entry has its own record, devices initialized in parallel
+	 * do not share them.
+	 */
+	if (idx < ARRAY_SIZE(init_profile)) {
+		init_profile[idx].entry = entry;
+		init_profile[idx].cycles = timing_cycles_get(&start, &end);
+	}
+}
+#else
+static inline timing_t init_profile_start(void)
+{
+	return 0;
+}
+
+static inline void init_profile_end(const struct init_entry *entry, timing_t start)
+{
+	ARG_UNUSED(entry);
+	ARG_UNUSED(start);
+}
+#endif /* CONFIG_INIT_PROFILING */
+
+static void do_device_init(const struct init_entry *entry)
+{
+	const struct device *dev = entry->dev;
+	timing_t start = init_profile_start();
+	int rc = 0;
+
+	if (entry->init_fn.dev != NULL) {
+		rc = entry->init_fn.dev(dev);
+		/* Mark device initialized. If initialization
+		 * failed, record the error condition.
+		 */
+		if (rc != 0) {
+			if (rc < 0) {
+				rc = -rc;
+			}
+			if (rc > UINT8_MAX) {
+				rc = UINT8_MAX;
+			}
+			dev->state->init_res = rc;
+		}
+	}
+
+	dev->state->initialized = true;
+
+	if (rc == 0) {
+		/* Run automatic device runtime enablement */
+		(void)pm_device_runtime_auto_enable(dev);
+	}
+
+	init_profile_end(entry, start);
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+static K_THREAD_STACK_ARRAY_DEFINE(init_stacks, CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_threads[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+
+/* Protects the batch and the initialized state of its devices */
+static K_MUTEX_DEFINE(init_lock);
+/* Signaled when a device of the batch is initialized */
+static K_CONDVAR_DEFINE(init_cond);
+
+/* Run of consecutive device entries initialized in parallel */
+static struct {
+	const struct init_entry *start;
+	const struct init_entry *next;
+	const struct init_entry *end;
+} init_batch;
+
+static bool in_init_batch(const struct init_entry *start,
+			  const struct init_entry *end,
+			  const struct device *dev)
+{
+	for (const struct init_entry *entry = start; entry < end; entry++) {
+		if (entry->dev == dev) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Wait until the devices required by the device of an entry are initialized,
+ * if they come before it in the batch. Those were already taken by other
+ * threads, which only wait on entries before theirs, so they cannot be
+ * waiting on this one. The other required devices were initialized before
+ * the batch, or are initialized after the entry as without parallel
+ * initialization.
+ */
+static void wait_required_devices(const struct init_entry *entry)
+{
+	const struct device *dev = entry->dev;
+	const device_handle_t *handles;
+	size_t count;
+
+	handles = device_required_handles_get(dev, &count);
+
+	k_mutex_lock(&init_lock, K_FOREVER);
+
+	for (size_t i = 0; i < count; i++) {
+		const struct device *req = device_from_handle(handles[i]);
+
+		if (req == NULL) {
+			continue;
+		}
+
+		if (!in_init_batch(init_batch.start, entry, req)) {
+			if (in_init_batch(entry + 1, init_batch.end, req)) {
+				/* Misordered init priorities */
+				LOG_WRN("%s initialized before %s, which it requires",
+					dev->name, req->name);
+			}
+			continue;
+		}
+
+		while (!req->state->initialized) {
+			k_condvar_wait(&init_cond, &init_lock, K_FOREVER);
+		}
+	}
+
+	k_mutex_unlock(&init_lock);
+}
+
+static void init_batch_run(void)
+{
+	while (true) {
+		const struct init_entry *entry;
+
+		k_mutex_lock(&init_lock, K_FOREVER);
+		entry = init_batch.next;
+		if (entry < init_batch.end) {
+			init_batch.next++;
+		}
+		k_mutex_unlock(&init_lock);
+
+		if (entry >= init_batch.end) {
+			return;
+		}
+
+		wait_required_devices(entry);
+		do_device_init(entry);
+
+		k_mutex_lock(&init_lock, K_FOREVER);
+		k_condvar_broadcast(&init_cond);
+		k_mutex_unlock(&init_lock);
+	}
+}
+
+static void init_thread_main(void *unused1, void *unused2, void *unused3)
+{
+	ARG_UNUSED(unused1);
+	ARG_UNUSED(unused2);
+	ARG_UNUSED(unused3);
+
+	init_batch_run();
+}
+
+/* Initialize consecutive devices of a level in the additional threads and
+ * the current one, and return once they are all initialized.
+ */
+static void init_devices_parallel(const struct init_entry *start,
+				  const struct init_entry *end)
+{
+	size_t num_threads = MIN(ARRAY_SIZE(init_threads), end - start - 1);
+	int prio = k_thread_priority_get(k_current_get());
+
+	init_batch.start = start;
+	init_batch.next = start;
+	init_batch.end = end;
+
+	for (size_t i = 0; i < num_threads; i++) {
+		(void)k_thread_create(&init_threads[i], init_stacks[i],
+				      K_THREAD_STACK_SIZEOF(init_stacks[i]),
+				      init_thread_main, NULL, NULL, NULL,
+				      prio, 0, K_NO_WAIT);
+		k_thread_name_set(&init_threads[i], "device_init");
+	}
+
+	init_batch_run();
+
+	for (size_t i = 0; i < num_threads; i++) {
+		(void)k_thread_join(&init_threads[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -253,35 +460,32 @@ static void z_sys_init_run_level(enum init_level level)
 	const struct init_entry *entry;
 
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
-		const struct device *dev = entry->dev;
-
-		if (dev != NULL) {
-			int rc = 0;
-
-			if (entry->init_fn.dev != NULL) {
-				rc = entry->init_fn.dev(dev);
-				/* Mark device initialized. If initialization
-				 * failed, record the error condition.
-				 */
-				if (rc != 0) {
-					if (rc < 0) {
-						rc = -rc;
-					}
-					if (rc > UINT8_MAX) {
-						rc = UINT8_MAX;
-					}
-					dev->state->init_res = rc;
-				}
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+		if ((entry->dev != NULL) &&
+		    ((level == INIT_LEVEL_POST_KERNEL) ||
+		     (level == INIT_LEVEL_APPLICATION))) {
+			const struct init_entry *end = entry;
+
+			/* SYS_INIT functions may rely on all the entries
+			 * before them, so they end the batch.
+			 */
+			while ((end < levels[level+1]) && (end->dev != NULL)) {
+				end++;
 			}
 
-			dev->state->initialized = true;
+			init_devices_parallel(entry, end);
+			entry = end - 1;
+			continue;
+		}
+#endif
 
-			if (rc == 0) {
-				/* Run automatic device runtime enablement */
-				(void)pm_device_runtime_auto_enable(dev);
-			}
+		if (entry->dev != NULL) {
+			do_device_init(entry);
 		} else {
+			timing_t start = init_profile_start();
+
 			(void)entry->init_fn.sys();
+			init_profile_end(entry, start);
 		}
 	}
 }
@@ -527,6 +731,11 @@ FUNC_NORETURN void z_cstart(void)
 	/* gcov hook needed to get the coverage report.*/
 	gcov_static_init();
 
+#ifdef CONFIG_INIT_PROFILING
+	timing_init();
+	timing_start();
+#endif
+
 	/* initialize early init calls */
 	z_sys_init_run_level(INIT_LEVEL_EARLY);
 
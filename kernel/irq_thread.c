@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * Interrupt threads: handlers deferred from interrupts to dedicated threads
+ * which the interrupts wake directly.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/irq.h>
+#include <ksched.h>
+#include <wait_q.h>
+
+#ifdef CONFIG_IRQ_THREAD_STATS
+static void stats_update(struct k_irq_thread *irq_thread)
+{
+	uint32_t cycles = k_cycle_get_32() - irq_thread->wake_cycles;
+	struct k_irq_thread_stats *stats = &irq_thread->stats;
+
+	if ((stats->count == 0U) || (cycles < stats->min_cycles)) {
+		stats->min_cycles = cycles;
+	}
+	if (cycles > stats->max_cycles) {
+		stats->max_cycles = cycles;
+	}
+	stats->total_cycles += cycles;
+	stats->count++;
+}
+
+void k_irq_thread_stats_get(struct k_irq_thread *irq_thread,
+			    struct k_irq_thread_stats *stats)
+{
+	K_SPINLOCK(&irq_thread->lock) {
+		*stats = irq_thread->stats;
+	}
+}
+
+void k_irq_thread_stats_reset(struct k_irq_thread *irq_thread)
+{
+	K_SPINLOCK(&irq_thread->lock) {
+		irq_thread->stats = (struct k_irq_thread_stats){ 0 };
+	}
+}
+#endif /* CONFIG_IRQ_THREAD_STATS */
+
+void k_irq_thread_wake(struct k_irq_thread *irq_thread)
+{
+#ifdef CONFIG_IRQ_THREAD_STATS
+	uint32_t cycles = k_cycle_get_32();
+
+	/* Under the lock the handler thread reads the wake time with */
+	K_SPINLOCK(&irq_thread->lock) {
+		if (atomic_inc(&irq_thread->pending) == 0) {
+			irq_thread->wake_cycles = cycles;
+		}
+	}
+#else
+	(void)atomic_inc(&irq_thread->pending);
+#endif
+
+	z_sched_irq_thread_wake(&irq_thread->wait_q);
+}
+
+void k_irq_thread_isr(const void *arg)
+{
+	struct k_irq_thread *irq_thread = (struct k_irq_thread *)arg;
+
+	if (irq_thread->irq >= 0) {
+		irq_disable(irq_thread->irq);
+	}
+
+	k_irq_thread_wake(irq_thread);
+}
+
+int k_irq_thread_flush(struct k_irq_thread *irq_thread, k_timeout_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&irq_thread->lock);
+
+	if (!irq_thread->busy && (atomic_get(&irq_thread->pending) == 0)) {
+		k_spin_unlock(&irq_thread->lock, key);
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&irq_thread->lock, key);
+		return -EBUSY;
+	}
+
+	/* The handler thread inherits the priority of the waiter, it gets its
+	 * own back once done.
+	 */
+	if (z_is_prio_higher(_current->base.prio, irq_thread->thread.base.prio)) {
+		(void)z_set_prio(&irq_thread->thread, _current->base.prio);
+	}
+
+	return z_sched_wait(&irq_thread->lock, key, &irq_thread->flush_q, timeout, NULL);
+}
+
+static bool irq_thread_next(struct k_irq_thread *irq_thread)
+{
+	k_spinlock_key_t key = k_spin_lock(&irq_thread->lock);
+	bool busy;
+
+	/* The wake-ups that happened so far are all handled by the next run */
+	busy = (atomic_set(&irq_thread->pending, 0) != 0);
+	irq_thread->busy = busy;
+
+#ifdef CONFIG_IRQ_THREAD_STATS
+	if (busy) {
+		stats_update(irq_thread);
+	}
+#endif
+
+	if (!busy) {
+		if (irq_thread->thread.base.prio != irq_thread->prio) {
+			(void)z_set_prio(&irq_thread->thread, irq_thread->prio);
+		}
+		(void)z_sched_wake_all(&irq_thread->flush_q, 0, NULL);
+	}
+
+	k_spin_unlock(&irq_thread->lock, key);
+
+	return busy;
+}
+
+static void irq_thread_entry(void *p1, void *p2, void *p3)
+{
+	struct k_irq_thread *irq_thread = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		z_sched_irq_thread_wait(&irq_thread->pending, &irq_thread->wait_q);
+
+		while (irq_thread_next(irq_thread)) {
+			irq_thread->handler(irq_thread->arg);
+
+			if (irq_thread->irq >= 0) {
+				irq_enable(irq_thread->irq);
+			}
+		}
+	}
+}
+
+static int irq_thread_init(void)
+{
+	STRUCT_SECTION_FOREACH(k_irq_thread_initparam, param) {
+		struct k_irq_thread *irq_thread = param->irq_thread;
+		k_tid_t tid = k_thread_create(&irq_thread->thread, irq_thread->stack,
+					      irq_thread->stack_size, irq_thread_entry,
+					      irq_thread, NULL, NULL, irq_thread->prio,
+					      0, K_NO_WAIT);
+
+		k_thread_name_set(tid, "irq_thread");
+	}
+
+	return 0;
+}
+
+SYS_INIT(irq_thread_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
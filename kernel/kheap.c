@@ -5,16 +5,225 @@
  */
 
 #include <zephyr/kernel.h>
+#include <string.h>
 #include <ksched.h>
+#include <kernel_internal.h>
 #include <zephyr/wait_q.h>
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
 
+#ifdef CONFIG_KHEAP_MAGAZINES
+/*
+ * Small blocks freed to a k_heap are parked in per-CPU magazines, one
+ * per size class, and handed back out on the same CPU without taking
+ * the heap lock.  An empty magazine is refilled, and a full one
+ * drained, half a magazine at a time under the heap lock.  Each CPU's
+ * magazines have their own lock, which is only contended when an
+ * allocation that found the heap empty flushes every CPU's magazines
+ * back into it.
+ *
+ * Lock order is cache lock, then heap lock.
+ */
+#define MAG_MIN_BYTES 16U
+#define MAG_CLASSES CONFIG_KHEAP_MAGAZINE_CLASSES
+#define MAG_ROUNDS CONFIG_KHEAP_MAGAZINE_ROUNDS
+#define MAG_BATCH (MAG_ROUNDS / 2)
+
+static inline size_t mag_bytes(int c)
+{
+	return (size_t)MAG_MIN_BYTES << c;
+}
+
+/* Class serving a request of @a bytes, or -1 */
+static int mag_alloc_class(size_t bytes)
+{
+	for (int c = 0; c < MAG_CLASSES; c++) {
+		if (bytes <= mag_bytes(c)) {
+			return c;
+		}
+	}
+	return -1;
+}
+
+/* Class a block with @a usable bytes can be parked in.  Blocks twice
+ * the size of their class or more are not cached, so that a large
+ * block freed once doesn't end up serving small requests.
+ */
+static int mag_free_class(size_t usable)
+{
+	for (int c = MAG_CLASSES - 1; c >= 0; c--) {
+		if (usable >= mag_bytes(c)) {
+			return (usable < mag_bytes(c + 1)) ? c : -1;
+		}
+	}
+	return -1;
+}
+
+/* Called with the cache lock held */
+static void mag_refill(struct k_heap *h, struct z_heap_magazine *mag, int c)
+{
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+	while (mag->count < MAG_BATCH) {
+		void *mem = z_sys_heap_aligned_alloc_at(&h->heap, sizeof(void *),
+							mag_bytes(c), NULL);
+
+		if (mem == NULL) {
+			break;
+		}
+		z_sys_heap_cache_account(&h->heap, mem, true);
+		mag->rounds[mag->count++] = mem;
+	}
+
+	k_spin_unlock(&h->lock, key);
+}
+
+/* Called with the cache lock held */
+static void mag_drain(struct k_heap *h, struct z_heap_magazine *mag, int keep)
+{
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+	while (mag->count > keep) {
+		void *mem = mag->rounds[--mag->count];
+
+		z_sys_heap_cache_account(&h->heap, mem, false);
+		sys_heap_free(&h->heap, mem);
+	}
+
+	k_spin_unlock(&h->lock, key);
+}
+
+/* Called with the cache lock held */
+static void cache_drain(struct k_heap *h, struct z_heap_cpu_cache *cache)
+{
+	for (int c = 0; c < MAG_CLASSES; c++) {
+		if (cache->mags[c].count != 0U) {
+			mag_drain(h, &cache->mags[c], 0);
+		}
+	}
+}
+
+static void cache_flush_all(struct k_heap *h)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		K_SPINLOCK(&h->cache[i].lock) {
+			cache_drain(h, &h->cache[i]);
+		}
+	}
+}
+
+/* The cache of the current CPU, which we stay on until cache_unlock() */
+static struct z_heap_cpu_cache *cache_lock(struct k_heap *h,
+					   unsigned int *irq,
+					   k_spinlock_key_t *key)
+{
+	struct z_heap_cpu_cache *cache;
+
+	*irq = arch_irq_lock();
+	cache = &h->cache[_current_cpu->id];
+	*key = k_spin_lock(&cache->lock);
+
+	return cache;
+}
+
+static void cache_unlock(struct z_heap_cpu_cache *cache, unsigned int irq,
+			 k_spinlock_key_t key)
+{
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+}
+
+static void *cache_alloc(struct k_heap *h, size_t bytes)
+{
+	struct z_heap_cpu_cache *cache;
+	struct z_heap_magazine *mag;
+	k_spinlock_key_t key;
+	unsigned int irq;
+	void *mem = NULL;
+	int c = mag_alloc_class(bytes);
+
+	if ((c < 0) || (bytes == 0U)) {
+		return NULL;
+	}
+
+	cache = cache_lock(h, &irq, &key);
+	mag = &cache->mags[c];
+
+	if (mag->count == 0U) {
+		mag_refill(h, mag, c);
+	}
+	if (mag->count != 0U) {
+		mem = mag->rounds[--mag->count];
+		z_sys_heap_cache_account(&h->heap, mem, false);
+	}
+
+	cache_unlock(cache, irq, key);
+
+	return mem;
+}
+
+static bool cache_free(struct k_heap *h, void *mem)
+{
+	struct z_heap_cpu_cache *cache;
+	struct z_heap_magazine *mag;
+	k_spinlock_key_t key;
+	unsigned int irq;
+	bool flushed = false;
+	int c;
+
+	if (((uintptr_t)mem & (sizeof(void *) - 1)) != 0U) {
+		return false;
+	}
+
+	c = mag_free_class(sys_heap_usable_size(&h->heap, mem));
+	if (c < 0) {
+		return false;
+	}
+
+	cache = cache_lock(h, &irq, &key);
+	mag = &cache->mags[c];
+
+	if (mag->count == MAG_ROUNDS) {
+		mag_drain(h, mag, MAG_ROUNDS - MAG_BATCH);
+	}
+	z_sys_heap_cache_account(&h->heap, mem, true);
+	mag->rounds[mag->count++] = mem;
+
+	/* Someone found the heap empty and may be waiting for memory.
+	 * They set the flag before flushing this cache, so either their
+	 * flush got our block or we see the flag here.
+	 */
+	if (atomic_get(&h->cache_waiters) != 0) {
+		cache_drain(h, cache);
+		flushed = true;
+	}
+
+	cache_unlock(cache, irq, key);
+
+	if (flushed) {
+		key = k_spin_lock(&h->lock);
+		if (z_unpend_all(&h->wait_q) != 0) {
+			z_reschedule(&h->lock, key);
+		} else {
+			k_spin_unlock(&h->lock, key);
+		}
+	}
+
+	return true;
+}
+#endif /* CONFIG_KHEAP_MAGAZINES */
+
 void k_heap_init(struct k_heap *h, void *mem, size_t bytes)
 {
 	z_waitq_init(&h->wait_q);
 	sys_heap_init(&h->heap, mem, bytes);
+#ifdef CONFIG_KHEAP_MAGAZINES
+	(void)memset(h->cache, 0, sizeof(h->cache));
+	atomic_clear(&h->cache_waiters);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, h);
 }
@@ -61,12 +270,26 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
-void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
-			k_timeout_t timeout)
+void *z_kheap_aligned_alloc_at(struct k_heap *h, size_t align, size_t bytes,
+			       k_timeout_t timeout, void *site)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_KHEAP_MAGAZINES
+	bool flushed = false;
+
+	if (align <= sizeof(void *)) {
+		ret = cache_alloc(h, bytes);
+		if (ret != NULL) {
+			z_sys_heap_profile_record(&h->heap, site, bytes, true);
+			SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, h, timeout);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, h, timeout, ret);
+			return ret;
+		}
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&h->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, h, timeout);
@@ -76,7 +299,21 @@ void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 	bool blocked_alloc = false;
 
 	while (ret == NULL) {
-		ret = sys_heap_aligned_alloc(&h->heap, align, bytes);
+		ret = z_sys_heap_aligned_alloc_at(&h->heap, align, bytes, NULL);
+
+#ifdef CONFIG_KHEAP_MAGAZINES
+		if ((ret == NULL) && !flushed) {
+			/* The memory may be parked in magazines: have
+			 * frees bypass them while we try again and wait.
+			 */
+			flushed = true;
+			atomic_inc(&h->cache_waiters);
+			k_spin_unlock(&h->lock, key);
+			cache_flush_all(h);
+			key = k_spin_lock(&h->lock);
+			continue;
+		}
+#endif
 
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -101,14 +338,30 @@ void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, h, timeout, ret);
 
 	k_spin_unlock(&h->lock, key);
+
+#ifdef CONFIG_KHEAP_MAGAZINES
+	if (flushed) {
+		atomic_dec(&h->cache_waiters);
+	}
+#endif
+
+	z_sys_heap_profile_record(&h->heap, site, bytes, ret != NULL);
+
 	return ret;
 }
 
+void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
+			k_timeout_t timeout)
+{
+	return z_kheap_aligned_alloc_at(h, align, bytes, timeout, Z_SYS_HEAP_SITE());
+}
+
 void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, alloc, h, timeout);
 
-	void *ret = k_heap_aligned_alloc(h, sizeof(void *), bytes, timeout);
+	void *ret = z_kheap_aligned_alloc_at(h, sizeof(void *), bytes, timeout,
+					     Z_SYS_HEAP_SITE());
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, h, timeout, ret);
 
@@ -117,6 +370,13 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 
 void k_heap_free(struct k_heap *h, void *mem)
 {
+#ifdef CONFIG_KHEAP_MAGAZINES
+	if ((mem != NULL) && cache_free(h, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, h);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&h->lock);
 
 	sys_heap_free(&h->heap, mem);
@@ -16,6 +16,109 @@
 #include <zephyr/sys/check.h>
 #include <zephyr/sys/iterable_sections.h>
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+/*
+ * Free blocks form a Treiber stack linked by block index, so that the
+ * head fits in one atomic_t next to a modification count: a pop that
+ * raced with a pop and push of the same block then fails its CAS
+ * rather than installing a stale next link.  Popping reads the link
+ * of a block another CPU may just have taken, which is harmless as
+ * the slab buffer is never unmapped and the CAS then fails.
+ */
+#define IDX_MASK(slab) (BIT((slab)->idx_bits) - 1UL)
+
+static inline atomic_val_t head_make(struct k_mem_slab *slab,
+				     atomic_val_t old, uintptr_t idx)
+{
+	unsigned long count = ((unsigned long)old >> slab->idx_bits) + 1UL;
+
+	return (atomic_val_t)((count << slab->idx_bits) | idx);
+}
+
+static void *free_list_pop(struct k_mem_slab *slab)
+{
+	atomic_val_t old, new;
+	char *block;
+
+	do {
+		old = atomic_get(&slab->free_head);
+		uintptr_t idx = (unsigned long)old & IDX_MASK(slab);
+
+		if (idx == 0U) {
+			return NULL;
+		}
+
+		block = slab->buffer + (idx - 1U) * slab->block_size;
+		new = head_make(slab, old, *(volatile uintptr_t *)block);
+	} while (!atomic_cas(&slab->free_head, old, new));
+
+	return block;
+}
+
+static void free_list_push(struct k_mem_slab *slab, char *block)
+{
+	uintptr_t idx = (block - slab->buffer) / slab->block_size + 1U;
+	atomic_val_t old, new;
+
+	do {
+		old = atomic_get(&slab->free_head);
+		*(volatile uintptr_t *)block = (unsigned long)old & IDX_MASK(slab);
+		new = head_make(slab, old, idx);
+	} while (!atomic_cas(&slab->free_head, old, new));
+}
+
+static inline void num_used_inc(struct k_mem_slab *slab)
+{
+	atomic_val_t used = atomic_inc(&slab->num_used) + 1;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_val_t max;
+
+	do {
+		max = atomic_get(&slab->max_used);
+	} while (used > max && !atomic_cas(&slab->max_used, max, used));
+#else
+	ARG_UNUSED(used);
+#endif
+}
+
+static inline void num_used_dec(struct k_mem_slab *slab)
+{
+	(void)atomic_dec(&slab->num_used);
+}
+#else
+static void *free_list_pop(struct k_mem_slab *slab)
+{
+	char *block = slab->free_list;
+
+	if (block != NULL) {
+		slab->free_list = *(char **)block;
+	}
+
+	return block;
+}
+
+static void free_list_push(struct k_mem_slab *slab, char *block)
+{
+	*(char **)block = slab->free_list;
+	slab->free_list = block;
+}
+
+static inline void num_used_inc(struct k_mem_slab *slab)
+{
+	slab->num_used++;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->max_used = MAX(slab->num_used, slab->max_used);
+#endif
+}
+
+static inline void num_used_dec(struct k_mem_slab *slab)
+{
+	slab->num_used--;
+}
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -36,12 +139,18 @@ static int create_free_list(struct k_mem_slab *slab)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	/* Room for indices up to num_blocks, the rest counts modifications */
+	slab->idx_bits = 32U - __builtin_clz(slab->num_blocks | 1U);
+	atomic_clear(&slab->free_head);
+	atomic_clear(&slab->waiters);
+#else
 	slab->free_list = NULL;
+#endif
 	p = slab->buffer;
 
 	for (j = 0U; j < slab->num_blocks; j++) {
-		*(char **)p = slab->free_list;
-		slab->free_list = p;
+		free_list_push(slab, p);
 		p += slab->block_size;
 	}
 	return 0;
@@ -81,11 +190,18 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->num_blocks = num_blocks;
 	slab->block_size = block_size;
 	slab->buffer = buffer;
-	slab->num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	atomic_clear(&slab->num_used);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_clear(&slab->max_used);
+#endif
+#else
+	slab->num_used = 0U;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->max_used = 0U;
+#endif
 #endif
 
 	rc = create_free_list(slab);
@@ -103,21 +219,45 @@ out:
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
+	char *block;
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
-	if (slab->free_list != NULL) {
-		/* take a free block */
-		*mem = slab->free_list;
-		slab->free_list = *(char **)(slab->free_list);
-		slab->num_used++;
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	block = free_list_pop(slab);
+	if (block != NULL) {
+		num_used_inc(slab);
+		*mem = block;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		return 0;
+	}
 
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->max_used = MAX(slab->num_used, slab->max_used);
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) || !IS_ENABLED(CONFIG_MULTITHREADING)) {
+		*mem = NULL;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, -ENOMEM);
+		return -ENOMEM;
+	}
+#endif
+
+	key = k_spin_lock(&slab->lock);
+
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	/* Announce ourselves before the final look at the free list:
+	 * a concurrent lock-free free either leaves its block where we
+	 * find it, or sees us waiting and hands the block over under
+	 * the lock.
+	 */
+	(void)atomic_inc(&slab->waiters);
 #endif
 
+	block = free_list_pop(slab);
+	if (block != NULL) {
+		/* take a free block */
+		*mem = block;
+		num_used_inc(slab);
+
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
 		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
@@ -133,11 +273,19 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+		(void)atomic_dec(&slab->waiters);
+#endif
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
 	}
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	(void)atomic_dec(&slab->waiters);
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 	k_spin_unlock(&slab->lock, key);
@@ -147,10 +295,53 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	if (atomic_get(&slab->waiters) == 0) {
+		free_list_push(slab, *mem);
+		num_used_dec(slab);
+
+		/* Pairs with the waiter count increment in the allocation
+		 * slow path: if a thread started waiting meanwhile it may
+		 * already be pending without having seen our block.
+		 */
+		if (atomic_get(&slab->waiters) == 0 || !IS_ENABLED(CONFIG_MULTITHREADING)) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+			return;
+		}
+
+		key = k_spin_lock(&slab->lock);
+		if (z_waitq_head(&slab->wait_q) != NULL) {
+			char *block = free_list_pop(slab);
+
+			if (block != NULL) {
+				struct k_thread *pending_thread =
+					z_unpend_first_thread(&slab->wait_q);
+
+				num_used_inc(slab);
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+				z_thread_return_value_set_with_data(pending_thread, 0, block);
+				z_ready_thread(pending_thread);
+				z_reschedule(&slab->lock, key);
+				return;
+			}
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		k_spin_unlock(&slab->lock, key);
+		return;
+	}
+
+	key = k_spin_lock(&slab->lock);
+	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
+#else
+	key = k_spin_lock(&slab->lock);
 	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
+#endif
 		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
 
 		if (pending_thread != NULL) {
@@ -162,15 +353,85 @@ void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 			return;
 		}
 	}
-	**(char ***) mem = slab->free_list;
-	slab->free_list = *(char **) mem;
-	slab->num_used--;
+	free_list_push(slab, *mem);
+	num_used_dec(slab);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
 	k_spin_unlock(&slab->lock, key);
 }
 
+int k_mem_slab_alloc_bulk(struct k_mem_slab *slab, void **mem,
+			  uint32_t count, k_timeout_t timeout)
+{
+	uint32_t n = 0U;
+	char *block;
+	int result;
+
+	if (count == 0U) {
+		return 0;
+	}
+
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	while (n < count && (block = free_list_pop(slab)) != NULL) {
+		num_used_inc(slab);
+		mem[n++] = block;
+	}
+#else
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	while (n < count && (block = free_list_pop(slab)) != NULL) {
+		num_used_inc(slab);
+		mem[n++] = block;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+#endif
+
+	if (n > 0U) {
+		return (int)n;
+	}
+
+	/* Nothing free: wait for a single block like any allocation */
+	result = k_mem_slab_alloc(slab, &mem[0], timeout);
+
+	return (result == 0) ? 1 : result;
+}
+
+void k_mem_slab_free_bulk(struct k_mem_slab *slab, void **mem, uint32_t count)
+{
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	/* Frees are lock-free already unless handing blocks to waiters */
+	for (uint32_t i = 0U; i < count; i++) {
+		k_mem_slab_free(slab, &mem[i]);
+	}
+#else
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool woken = false;
+
+	for (uint32_t i = 0U; i < count; i++) {
+		if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
+			struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+			if (pending_thread != NULL) {
+				z_thread_return_value_set_with_data(pending_thread, 0, mem[i]);
+				z_ready_thread(pending_thread);
+				woken = true;
+				continue;
+			}
+		}
+		free_list_push(slab, mem[i]);
+		num_used_dec(slab);
+	}
+
+	if (woken) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+#endif
+}
+
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
 	if ((slab == NULL) || (stats == NULL)) {
@@ -179,10 +440,12 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->num_used * slab->block_size;
-	stats->free_bytes = (slab->num_blocks - slab->num_used) * slab->block_size;
+	uint32_t num_used = k_mem_slab_num_used_get(slab);
+
+	stats->allocated_bytes = num_used * slab->block_size;
+	stats->free_bytes = (slab->num_blocks - num_used) * slab->block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	stats->max_allocated_bytes = slab->max_used * slab->block_size;
+	stats->max_allocated_bytes = k_mem_slab_max_used_get(slab) * slab->block_size;
 #else
 	stats->max_allocated_bytes = 0;
 #endif
@@ -201,7 +464,11 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	atomic_set(&slab->max_used, atomic_get(&slab->num_used));
+#else
 	slab->max_used = slab->num_used;
+#endif
 
 	k_spin_unlock(&slab->lock, key);
 
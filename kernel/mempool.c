@@ -5,11 +5,14 @@
  */
 
 #include <zephyr/kernel.h>
+#include <kernel_internal.h>
 #include <string.h>
+#include <zephyr/init.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
 
-static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size)
+static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size,
+				  void *site)
 {
 	void *mem;
 	struct k_heap **heap_ref;
@@ -26,7 +29,7 @@ static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size
 	}
 	__align = align | sizeof(heap_ref);
 
-	mem = k_heap_aligned_alloc(heap, __align, size, K_NO_WAIT);
+	mem = z_kheap_aligned_alloc_at(heap, __align, size, K_NO_WAIT, site);
 	if (mem == NULL) {
 		return NULL;
 	}
@@ -61,7 +64,22 @@ void k_free(void *ptr)
 K_HEAP_DEFINE(_system_heap, CONFIG_HEAP_MEM_POOL_SIZE);
 #define _SYSTEM_HEAP (&_system_heap)
 
-void *k_aligned_alloc(size_t align, size_t size)
+#ifdef CONFIG_SYS_HEAP_PROFILE
+#include <zephyr/sys/heap_profile.h>
+
+static struct sys_heap_profile system_heap_profile;
+
+static int system_heap_profile_init(void)
+{
+	return sys_heap_profile_attach(&_SYSTEM_HEAP->heap, &system_heap_profile,
+				       "system", &_SYSTEM_HEAP->lock);
+}
+
+/* After the k_heap statics are initialized */
+SYS_INIT(system_heap_profile_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif
+
+static void *system_aligned_alloc(size_t align, size_t size, void *site)
 {
 	__ASSERT(align / sizeof(void *) >= 1
 		&& (align % sizeof(void *)) == 0,
@@ -72,24 +90,34 @@ void *k_aligned_alloc(size_t align, size_t size)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP);
 
-	void *ret = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+	void *ret = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size, site);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP, ret);
 
 	return ret;
 }
 
-void *k_malloc(size_t size)
+void *k_aligned_alloc(size_t align, size_t size)
+{
+	return system_aligned_alloc(align, size, Z_SYS_HEAP_SITE());
+}
+
+static void *system_malloc(size_t size, void *site)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_malloc, _SYSTEM_HEAP);
 
-	void *ret = k_aligned_alloc(sizeof(void *), size);
+	void *ret = system_aligned_alloc(sizeof(void *), size, site);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_malloc, _SYSTEM_HEAP, ret);
 
 	return ret;
 }
 
+void *k_malloc(size_t size)
+{
+	return system_malloc(size, Z_SYS_HEAP_SITE());
+}
+
 void *k_calloc(size_t nmemb, size_t size)
 {
 	void *ret;
@@ -103,7 +131,7 @@ void *k_calloc(size_t nmemb, size_t size)
 		return NULL;
 	}
 
-	ret = k_malloc(bounds);
+	ret = system_malloc(bounds, Z_SYS_HEAP_SITE());
 	if (ret != NULL) {
 		(void)memset(ret, 0, bounds);
 	}
@@ -133,7 +161,7 @@ void *z_thread_aligned_alloc(size_t align, size_t size)
 	}
 
 	if (heap != NULL) {
-		ret = z_heap_aligned_alloc(heap, align, size);
+		ret = z_heap_aligned_alloc(heap, align, size, Z_SYS_HEAP_SITE());
 	} else {
 		ret = NULL;
 	}
@@ -252,7 +252,10 @@ static void virt_region_free(void *vaddr, size_t size)
 	(void)sys_bitarray_free(&virt_region_bitmap, num_bits, offset);
 }
 
-static void *virt_region_alloc(size_t size, size_t align)
+/* Allocate a virtual region whose address is @p align_offset past a
+ * multiple of @p align.
+ */
+static void *virt_region_alloc(size_t size, size_t align, size_t align_offset)
 {
 	uintptr_t dest_addr;
 	size_t alloc_size;
@@ -281,7 +284,8 @@ static void *virt_region_alloc(size_t size, size_t align)
 	dest_addr = virt_from_bitmap_offset(offset, alloc_size);
 
 	if (alloc_size > size) {
-		uintptr_t aligned_dest_addr = ROUND_UP(dest_addr, align);
+		uintptr_t aligned_dest_addr = ROUND_UP(dest_addr - align_offset, align) +
+					      align_offset;
 
 		/* Here is the memory organization when trying to get an aligned
 		 * virtual address:
@@ -550,7 +554,7 @@ void *k_mem_map(size_t size, uint32_t flags)
 	 */
 	total_size = size + CONFIG_MMU_PAGE_SIZE * 2;
 
-	dst = virt_region_alloc(total_size, CONFIG_MMU_PAGE_SIZE);
+	dst = virt_region_alloc(total_size, CONFIG_MMU_PAGE_SIZE, 0);
 	if (dst == NULL) {
 		/* Address space has no free region */
 		goto out;
@@ -753,7 +757,12 @@ void z_phys_map(uint8_t **virt_ptr, uintptr_t phys, size_t size, uint32_t flags)
 		}
 	} else {
 		/* Obtain an appropriately sized chunk of virtual memory */
-		dest_addr = virt_region_alloc(aligned_size, align_boundary);
+		/* Same offset as the physical address in the alignment, so that
+		 * the aligned blocks inside the region can use large mappings
+		 * even if the region itself is not aligned.
+		 */
+		dest_addr = virt_region_alloc(aligned_size, align_boundary,
+					      aligned_phys & (align_boundary - 1));
 		if (!dest_addr) {
 			goto fail;
 		}
@@ -959,6 +968,7 @@ struct k_mem_paging_stats_t paging_stats;
 extern struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_out;
+extern struct k_mem_paging_histogram_t z_paging_histogram_page_fault;
 #endif
 
 static inline void do_backing_store_page_in(uintptr_t location)
@@ -1332,7 +1342,10 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+/* Read-ahead page-ins only use free page frames, evicting a page to read
+ * another one which may never be accessed would not help.
+ */
+static bool do_page_fault(void *addr, bool pin, bool readahead)
 {
 	struct z_page_frame *pf;
 	int key, ret;
@@ -1411,9 +1424,15 @@ static bool do_page_fault(void *addr, bool pin)
 	__ASSERT(status == ARCH_PAGE_LOCATION_PAGED_OUT,
 		 "unexpected status value %d", status);
 
-	paging_stats_faults_inc(faulting_thread, key);
-
 	pf = free_page_frame_list_get();
+	if ((pf == NULL) && readahead) {
+		goto out;
+	}
+
+	if (!readahead) {
+		paging_stats_faults_inc(faulting_thread, key);
+	}
+
 	if (pf == NULL) {
 		/* Need to evict a page frame */
 		pf = do_eviction_select(&dirty);
@@ -1464,7 +1483,7 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1481,7 +1500,7 @@ static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1494,9 +1513,73 @@ void k_mem_pin(void *addr, size_t size)
 	virt_region_foreach(addr, size, do_mem_pin);
 }
 
+#if CONFIG_DEMAND_PAGING_READAHEAD > 0
+/* Page of the last fault, a fault on the page after it is sequential */
+static uintptr_t last_fault_page;
+
+static void page_readahead(void *addr)
+{
+	uintptr_t page = ROUND_DOWN(POINTER_TO_UINT(addr), CONFIG_MMU_PAGE_SIZE);
+	bool sequential = (page == last_fault_page + CONFIG_MMU_PAGE_SIZE);
+
+	last_fault_page = page;
+	if (!sequential) {
+		return;
+	}
+
+	/* Stops at the end of the mapping, where the location is bad, and
+	 * once there are no free page frames left.
+	 */
+	for (int i = 1; i <= CONFIG_DEMAND_PAGING_READAHEAD; i++) {
+		void *next = UINT_TO_POINTER(page + i * CONFIG_MMU_PAGE_SIZE);
+
+		if ((z_free_page_count == 0U) || !do_page_fault(next, false, true)) {
+			break;
+		}
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD > 0 */
+
 bool z_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	bool ret;
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+	uint32_t time_diff;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+
+	time_start = timing_counter_get();
+#else
+	uint32_t time_start;
+
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	ret = do_page_fault(addr, false, false);
+
+#if CONFIG_DEMAND_PAGING_READAHEAD > 0
+	if (ret) {
+		page_readahead(addr);
+	}
+#endif
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_end = timing_counter_get();
+	time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
+#else
+	time_diff = k_cycle_get_32() - time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+
+	if (ret) {
+		z_paging_histogram_inc(&z_paging_histogram_page_fault, time_diff);
+	}
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	return ret;
 }
 
 static void do_mem_unpin(void *addr)
@@ -32,6 +32,171 @@ static inline void handle_poll_events(struct k_msgq *msgq, uint32_t state)
 }
 #endif /* CONFIG_POLL */
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+/* Stands for the message of threads waiting to claim a slot */
+static char claim_waiter;
+
+#define PUT_WAIT_Q(msgq) (&(msgq)->put_wait_q)
+
+static inline bool msgq_can_put(struct k_msgq *msgq)
+{
+	return (msgq->flags & K_MSGQ_FLAG_PUT_CLAIMED) == 0U &&
+	       msgq->used_msgs + msgq->purged_msgs < msgq->max_msgs;
+}
+
+static inline bool msgq_can_get(struct k_msgq *msgq)
+{
+	return (msgq->flags & K_MSGQ_FLAG_GET_CLAIMED) == 0U &&
+	       msgq->used_msgs > 0U;
+}
+#else
+/* Writers and readers never wait at the same time and share wait_q */
+#define PUT_WAIT_Q(msgq) (&(msgq)->wait_q)
+
+static inline bool msgq_can_put(struct k_msgq *msgq)
+{
+	return msgq->used_msgs < msgq->max_msgs;
+}
+
+static inline bool msgq_can_get(struct k_msgq *msgq)
+{
+	return msgq->used_msgs > 0U;
+}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
+/* Slot msgs messages after ptr, at most max_msgs */
+static inline char *msgq_next(struct k_msgq *msgq, char *ptr, uint32_t msgs)
+{
+	size_t offset = (ptr - msgq->buffer_start) + msgs * msgq->msg_size;
+	size_t size = msgq->buffer_end - msgq->buffer_start;
+
+	if (offset >= size) {
+		offset -= size;
+	}
+
+	return msgq->buffer_start + offset;
+}
+
+static void msgq_write(struct k_msgq *msgq, const void *data)
+{
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+	(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
+	msgq->write_ptr = msgq_next(msgq, msgq->write_ptr, 1);
+	msgq->used_msgs++;
+}
+
+static void msgq_read(struct k_msgq *msgq, void *data)
+{
+	(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
+	msgq->read_ptr = msgq_next(msgq, msgq->read_ptr, 1);
+	msgq->used_msgs--;
+}
+
+/* Pop the first waiting reader, if it can be handed a message directly
+ * instead of going through the buffer
+ */
+static struct k_thread *msgq_direct_reader(struct k_msgq *msgq)
+{
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	struct k_thread *thread;
+
+	if (!(msgq->used_msgs == 0U &&
+	      (msgq->flags & K_MSGQ_FLAG_GET_CLAIMED) == 0U)) {
+		return NULL;
+	}
+
+	thread = z_waitq_head(&msgq->wait_q);
+	if (thread == NULL || thread->base.swap_data == &claim_waiter) {
+		return NULL;
+	}
+	z_unpend_thread(thread);
+
+	return thread;
+#else
+	return z_unpend_first_thread(&msgq->wait_q);
+#endif
+}
+
+/* Serve waiting writers while there is room, returns true if any was woken */
+static bool msgq_wake_writers(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	bool woken = false;
+
+	while (msgq_can_put(msgq)) {
+		pending_thread = z_unpend_first_thread(PUT_WAIT_Q(msgq));
+		if (pending_thread == NULL) {
+			break;
+		}
+
+#ifdef CONFIG_MSGQ_ZERO_COPY
+		if (pending_thread->base.swap_data == &claim_waiter) {
+			msgq->flags |= K_MSGQ_FLAG_PUT_CLAIMED;
+		} else
+#endif
+		{
+			/* add thread's message to queue */
+			msgq_write(msgq, pending_thread->base.swap_data);
+#ifdef CONFIG_POLL
+			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif
+		}
+
+		/* wake up waiting thread */
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+#ifdef CONFIG_MSGQ_ZERO_COPY
+/* Serve waiting readers while there are messages, returns true if any
+ * was woken
+ */
+static bool msgq_wake_readers(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	bool woken = false;
+
+	while (msgq_can_get(msgq)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		if (pending_thread->base.swap_data == &claim_waiter) {
+			msgq->flags |= K_MSGQ_FLAG_GET_CLAIMED;
+		} else {
+			msgq_read(msgq, pending_thread->base.swap_data);
+		}
+
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+/* Serve both sides after a claim ended, until neither can progress */
+static bool msgq_wake_all(struct k_msgq *msgq)
+{
+	bool woken = false;
+	bool progress;
+
+	do {
+		progress = msgq_wake_readers(msgq);
+		progress = msgq_wake_writers(msgq) || progress;
+		woken = woken || progress;
+	} while (progress);
+
+	return woken;
+}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -45,6 +210,10 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	z_waitq_init(&msgq->put_wait_q);
+	msgq->purged_msgs = 0;
+#endif
 #ifdef CONFIG_POLL
 	sys_dlist_init(&msgq->poll_events);
 #endif	/* CONFIG_POLL */
@@ -96,7 +265,8 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, cleanup, msgq);
 
-	CHECKIF(z_waitq_head(&msgq->wait_q) != NULL) {
+	CHECKIF(z_waitq_head(&msgq->wait_q) != NULL ||
+		z_waitq_head(PUT_WAIT_Q(msgq)) != NULL) {
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, cleanup, msgq, -EBUSY);
 
 		return -EBUSY;
@@ -125,9 +295,9 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+	if (msgq_can_put(msgq)) {
 		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		pending_thread = msgq_direct_reader(msgq);
 		if (pending_thread != NULL) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
 
@@ -141,17 +311,18 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 			return 0;
 		} else {
 			/* put message in queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
+			msgq_write(msgq, data);
 #ifdef CONFIG_POLL
 			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
+#ifdef CONFIG_MSGQ_ZERO_COPY
+			/* a reader waiting to claim the message */
+			if (msgq_wake_all(msgq)) {
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
+				z_reschedule(&msgq->lock, key);
+				return 0;
+			}
+#endif
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -163,7 +334,7 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 		/* wait for put message success, failure, or timeout */
 		_current->base.swap_data = (void *) data;
 
-		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		result = z_pend_curr(&msgq->lock, key, PUT_WAIT_Q(msgq), timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
 		return result;
 	}
@@ -210,41 +381,20 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	k_spinlock_key_t key;
-	struct k_thread *pending_thread;
 	int result;
 
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
-	if (msgq->used_msgs > 0U) {
+	if (msgq_can_get(msgq)) {
 		/* take first available message from queue */
-		(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
+		msgq_read(msgq, data);
 
 		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (pending_thread != NULL) {
+		if (msgq_wake_writers(msgq)) {
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
-			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
-
-			/* wake up waiting thread */
-			arch_thread_return_value_set(pending_thread, 0);
-			z_ready_thread(pending_thread);
 			z_reschedule(&msgq->lock, key);
 
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, 0);
@@ -285,6 +435,136 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+int k_msgq_put_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq_can_put(msgq)) {
+		msgq->flags |= K_MSGQ_FLAG_PUT_CLAIMED;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* the slot is claimed on our behalf by whoever frees it,
+		 * and write_ptr cannot move while it is
+		 */
+		_current->base.swap_data = &claim_waiter;
+		result = z_pend_curr(&msgq->lock, key, PUT_WAIT_Q(msgq), timeout);
+		if (result == 0) {
+			*data = msgq->write_ptr;
+		}
+		return result;
+	}
+
+	if (result == 0) {
+		*data = msgq->write_ptr;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_put_commit(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+
+	CHECKIF((msgq->flags & K_MSGQ_FLAG_PUT_CLAIMED) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+
+		return -EINVAL;
+	}
+
+	/* the message is already in place */
+	msgq->flags &= ~K_MSGQ_FLAG_PUT_CLAIMED;
+	msgq->write_ptr = msgq_next(msgq, msgq->write_ptr, 1);
+	msgq->used_msgs++;
+#ifdef CONFIG_POLL
+	handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif
+
+	if (msgq_wake_all(msgq)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+int k_msgq_get_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if (msgq_can_get(msgq)) {
+		msgq->flags |= K_MSGQ_FLAG_GET_CLAIMED;
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		/* the message is claimed on our behalf by whoever sends it,
+		 * and read_ptr cannot move while it is
+		 */
+		_current->base.swap_data = &claim_waiter;
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result == 0) {
+			*data = msgq->read_ptr;
+		}
+		return result;
+	}
+
+	if (result == 0) {
+		*data = msgq->read_ptr;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_get_finish(struct k_msgq *msgq)
+{
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+
+	CHECKIF((msgq->flags & K_MSGQ_FLAG_GET_CLAIMED) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_GET_CLAIMED;
+	msgq->read_ptr = msgq_next(msgq, msgq->read_ptr, 1U + msgq->purged_msgs);
+	msgq->used_msgs--;
+	msgq->purged_msgs = 0;
+
+#ifdef CONFIG_POLL
+	/* pollers could not take the messages behind the claimed one */
+	if (msgq->used_msgs > 0U) {
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	}
+#endif
+
+	if (msgq_wake_all(msgq)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -330,8 +610,16 @@ int z_impl_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > idx) {
+		uint32_t slot = idx;
+
+#ifdef CONFIG_MSGQ_ZERO_COPY
+		/* skip purged messages behind one claimed for reading */
+		if (idx > 0U) {
+			slot += msgq->purged_msgs;
+		}
+#endif
 		bytes_to_end = (msgq->buffer_end - msgq->read_ptr);
-		byte_offset = idx * msgq->msg_size;
+		byte_offset = slot * msgq->msg_size;
 		start_addr = msgq->read_ptr;
 		/* check item available in start/end of ring buffer */
 		if (bytes_to_end <= byte_offset) {
@@ -375,11 +663,23 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
 
 	/* wake up any threads that are waiting to write */
-	while ((pending_thread = z_unpend_first_thread(&msgq->wait_q)) != NULL) {
+	while ((pending_thread = z_unpend_first_thread(PUT_WAIT_Q(msgq))) != NULL) {
 		arch_thread_return_value_set(pending_thread, -ENOMSG);
 		z_ready_thread(pending_thread);
 	}
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	if ((msgq->flags & K_MSGQ_FLAG_GET_CLAIMED) != 0U) {
+		/* The claimed message stays in place, the slots of the others
+		 * are released with it by k_msgq_get_finish()
+		 */
+		msgq->purged_msgs += msgq->used_msgs - 1U;
+		msgq->used_msgs = 1U;
+		z_reschedule(&msgq->lock, key);
+		return;
+	}
+#endif
+
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
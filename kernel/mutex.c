@@ -69,6 +69,62 @@ static inline int z_vrfy_k_mutex_init(struct k_mutex *mutex)
 #include <syscalls/k_mutex_init_mrsh.c>
 #endif
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+static atomic_t spin_count;
+static atomic_t spin_acquired;
+
+/* Called with the lock held on a mutex owned by another thread.  If
+ * that owner is running on another CPU it is likely to release the
+ * mutex soon, so wait for that for a bounded time instead of pending
+ * right away.  Returns true with the lock held if the mutex became
+ * free; the lock is held again (with *key updated) either way.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	uint32_t start = k_cycle_get_32();
+	bool free;
+
+	if (!z_thread_active_elsewhere(mutex->owner)) {
+		return false;
+	}
+
+	atomic_inc(&spin_count);
+
+	do {
+		k_spin_unlock(&lock, *key);
+
+		while ((k_cycle_get_32() - start) < CONFIG_MUTEX_ADAPTIVE_SPIN_CYCLES) {
+			if (*(volatile uint32_t *)&mutex->lock_count == 0U) {
+				break;
+			}
+			arch_spin_relax();
+		}
+
+		*key = k_spin_lock(&lock);
+		free = (mutex->lock_count == 0U);
+
+		/* Lost the race to another locker (or the mutex was
+		 * handed to a waiter): keep spinning within the bound
+		 * while the new owner is running.
+		 */
+	} while (!free &&
+		 ((k_cycle_get_32() - start) < CONFIG_MUTEX_ADAPTIVE_SPIN_CYCLES) &&
+		 z_thread_active_elsewhere(mutex->owner));
+
+	if (free) {
+		atomic_inc(&spin_acquired);
+	}
+
+	return free;
+}
+
+void k_mutex_spin_stats_get(struct k_mutex_spin_stats *stats)
+{
+	stats->spins = (uint32_t)atomic_get(&spin_count);
+	stats->acquired = (uint32_t)atomic_get(&spin_acquired);
+}
+#endif
+
 static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
 {
 	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
@@ -104,6 +160,13 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		(void)mutex_spin(mutex, &key);
+	}
+#endif
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
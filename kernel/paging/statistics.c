@@ -16,6 +16,7 @@ extern struct k_mem_paging_stats_t paging_stats;
 struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
 struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_out;
+struct k_mem_paging_histogram_t z_paging_histogram_page_fault;
 
 #ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
 
@@ -160,6 +161,15 @@ void z_paging_histogram_init(void)
 	memcpy(z_paging_histogram_backing_store_page_out.bounds,
 	       k_mem_paging_backing_store_histogram_bounds,
 	       sizeof(z_paging_histogram_backing_store_page_out.bounds));
+
+	/* A page fault is dominated by its backing store accesses, so it
+	 * uses the same bounds.
+	 */
+	memset(&z_paging_histogram_page_fault, 0,
+	       sizeof(z_paging_histogram_page_fault));
+	memcpy(z_paging_histogram_page_fault.bounds,
+	       k_mem_paging_backing_store_histogram_bounds,
+	       sizeof(z_paging_histogram_page_fault.bounds));
 }
 
 /**
@@ -219,6 +229,18 @@ void z_impl_k_mem_paging_histogram_backing_store_page_out_get(
 	       sizeof(z_paging_histogram_backing_store_page_out));
 }
 
+void z_impl_k_mem_paging_histogram_page_fault_get(
+	struct k_mem_paging_histogram_t *hist)
+{
+	if (hist == NULL) {
+		return;
+	}
+
+	/* Copy histogram */
+	memcpy(hist, &z_paging_histogram_page_fault,
+	       sizeof(z_paging_histogram_page_fault));
+}
+
 #ifdef CONFIG_USERSPACE
 static inline
 void z_vrfy_k_mem_paging_histogram_eviction_get(
@@ -246,6 +268,15 @@ void z_vrfy_k_mem_paging_histogram_backing_store_page_out_get(
 	z_impl_k_mem_paging_histogram_backing_store_page_out_get(hist);
 }
 #include <syscalls/k_mem_paging_histogram_backing_store_page_out_get_mrsh.c>
+
+static inline
+void z_vrfy_k_mem_paging_histogram_page_fault_get(
+	struct k_mem_paging_histogram_t *hist)
+{
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(hist, sizeof(*hist)));
+	z_impl_k_mem_paging_histogram_page_fault_get(hist);
+}
+#include <syscalls/k_mem_paging_histogram_page_fault_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
@@ -20,6 +20,7 @@
 #include <zephyr/syscall_handler.h>
 #include <kernel_internal.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 struct waitq_walk_data {
 	sys_dlist_t *list;
@@ -28,9 +29,9 @@ struct waitq_walk_data {
 };
 
 static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
-			     void *data, size_t bytes_to_read,
-			     size_t *bytes_read, size_t min_xfer,
-			     k_timeout_t timeout);
+			     void *data, const struct k_pipe_iovec *iov,
+			     size_t bytes_to_read, size_t *bytes_read,
+			     size_t min_xfer, k_timeout_t timeout);
 
 void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 {
@@ -105,8 +106,8 @@ void z_impl_k_pipe_flush(struct k_pipe *pipe)
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
-	(void) pipe_get_internal(key, pipe, NULL, (size_t) -1, &bytes_read, 0U,
-				 K_NO_WAIT);
+	(void) pipe_get_internal(key, pipe, NULL, NULL, (size_t) -1,
+				 &bytes_read, 0U, K_NO_WAIT);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, flush, pipe);
 }
@@ -130,7 +131,7 @@ void z_impl_k_pipe_buffer_flush(struct k_pipe *pipe)
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	if (pipe->buffer != NULL) {
-		(void) pipe_get_internal(key, pipe, NULL, pipe->size,
+		(void) pipe_get_internal(key, pipe, NULL, NULL, pipe->size,
 					 &bytes_read, 0U, K_NO_WAIT);
 	} else {
 		k_spin_unlock(&pipe->lock, key);
@@ -206,6 +207,64 @@ static size_t pipe_xfer(unsigned char *dest, size_t dest_size,
 	return num_bytes;
 }
 
+/**
+ * @brief Advance a pipe descriptor by @a num_bytes
+ *
+ * Once the current segment of a vectored descriptor is exhausted, the
+ * descriptor moves on to the next non-empty segment, so that its buffer
+ * always addresses at least one byte until the transfer is complete.
+ */
+static void pipe_desc_advance(struct _pipe_desc *desc, size_t num_bytes)
+{
+	if (desc->buffer != NULL) {
+		desc->buffer += num_bytes;
+	}
+	desc->bytes_to_xfer -= num_bytes;
+	desc->seg_left -= num_bytes;
+
+	while ((desc->seg_left == 0U) && (desc->bytes_to_xfer != 0U)) {
+		desc->buffer = desc->iov->base;
+		desc->seg_left = desc->iov->len;
+		desc->iov++;
+	}
+}
+
+/**
+ * @brief Set up a pipe descriptor
+ *
+ * The descriptor covers either @a bytes_to_xfer bytes at @a buffer, or if
+ * @a iov is not NULL the segments of @a iov, of @a bytes_to_xfer bytes in
+ * total.
+ */
+static void pipe_desc_init(struct _pipe_desc *desc, unsigned char *buffer,
+			   const struct k_pipe_iovec *iov,
+			   size_t bytes_to_xfer, struct k_thread *thread)
+{
+	desc->buffer        = buffer;
+	desc->bytes_to_xfer = bytes_to_xfer;
+	desc->seg_left      = (iov != NULL) ? 0U : bytes_to_xfer;
+	desc->iov           = iov;
+	desc->thread        = thread;
+
+	pipe_desc_advance(desc, 0U);
+}
+
+/**
+ * @brief Copy bytes from the current segment of @a src to that of @a dest
+ *
+ * @return Number of bytes copied
+ */
+static size_t pipe_desc_xfer(struct _pipe_desc *dest, struct _pipe_desc *src)
+{
+	size_t num_bytes = pipe_xfer(dest->buffer, dest->seg_left,
+				     src->buffer, src->seg_left);
+
+	pipe_desc_advance(dest, num_bytes);
+	pipe_desc_advance(src, num_bytes);
+
+	return num_bytes;
+}
+
 /**
  * @brief Callback routine used to populate wait list
  *
@@ -266,19 +325,13 @@ static size_t pipe_buffer_list_populate(sys_dlist_t         *list,
 {
 	sys_dlist_append(list, &desc[0].node);
 
-	desc[0].thread = NULL;
-	desc[0].buffer = &buffer[start];
-
 	if (start < end) {
-		desc[0].bytes_to_xfer = end - start;
+		pipe_desc_init(&desc[0], &buffer[start], NULL, end - start, NULL);
 		return end - start;
 	}
 
-	desc[0].bytes_to_xfer = size - start;
-
-	desc[1].thread = NULL;
-	desc[1].buffer = &buffer[0];
-	desc[1].bytes_to_xfer = end;
+	pipe_desc_init(&desc[0], &buffer[start], NULL, size - start, NULL);
+	pipe_desc_init(&desc[1], &buffer[0], NULL, end, NULL);
 
 	sys_dlist_append(list, &desc[1].node);
 
@@ -327,17 +380,10 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	dest = (struct _pipe_desc *)sys_dlist_get(dest_list);
 
 	while ((src != NULL) && (dest != NULL)) {
-		bytes_copied = pipe_xfer(dest->buffer, dest->bytes_to_xfer,
-					 src->buffer, src->bytes_to_xfer);
+		bytes_copied = pipe_desc_xfer(dest, src);
 
 		num_bytes_written   += bytes_copied;
 
-		dest->buffer        += bytes_copied;
-		dest->bytes_to_xfer -= bytes_copied;
-
-		src->buffer         += bytes_copied;
-		src->bytes_to_xfer  -= bytes_copied;
-
 		if (dest->thread == NULL) {
 
 			/* Writing to the pipe buffer. Update details. */
@@ -369,9 +415,10 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
-int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
-		     size_t *bytes_written, size_t min_xfer,
-		      k_timeout_t timeout)
+static int pipe_put_internal(struct k_pipe *pipe, void *data,
+			     const struct k_pipe_iovec *iov,
+			     size_t bytes_to_write, size_t *bytes_written,
+			     size_t min_xfer, k_timeout_t timeout)
 {
 	struct _pipe_desc  pipe_desc[2];
 	struct _pipe_desc  isr_desc;
@@ -381,18 +428,6 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 	size_t             bytes_can_write;
 	bool               reschedule_needed = false;
 
-	__ASSERT(((arch_is_in_isr() == false) ||
-		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, put, pipe, timeout);
-
-	CHECKIF((min_xfer > bytes_to_write) || bytes_written == NULL) {
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout,
-					       -EINVAL);
-
-		return -EINVAL;
-	}
-
 	sys_dlist_init(&src_list);
 	sys_dlist_init(&dest_list);
 
@@ -424,9 +459,6 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 		k_spin_unlock(&pipe->lock, key);
 		*bytes_written = 0U;
 
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe,
-					       timeout, -EIO);
-
 		return -EIO;
 	}
 
@@ -437,9 +469,7 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 
 	src_desc = k_is_in_isr() ? &isr_desc : &_current->pipe_desc;
 
-	src_desc->buffer        = data;
-	src_desc->bytes_to_xfer = bytes_to_write;
-	src_desc->thread        = _current;
+	pipe_desc_init(src_desc, data, iov, bytes_to_write, _current);
 	sys_dlist_append(&src_list, &src_desc->node);
 
 	*bytes_written = pipe_write(pipe, &src_list,
@@ -471,8 +501,6 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 			k_spin_unlock(&pipe->lock, key);
 		}
 
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout, 0);
-
 		return 0;
 	}
 
@@ -496,14 +524,78 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 
 	*bytes_written = bytes_to_write - src_desc->bytes_to_xfer;
 
-	int ret = pipe_return_code(min_xfer, src_desc->bytes_to_xfer,
-				   bytes_to_write);
+	return pipe_return_code(min_xfer, src_desc->bytes_to_xfer,
+				bytes_to_write);
+}
+
+/**
+ * @brief Total length of the segments of a vectored transfer
+ *
+ * @return 0 on success, -EINVAL if the array is invalid or the total
+ *         length overflows
+ */
+static int pipe_iovec_len(const struct k_pipe_iovec *iov, size_t iovcnt,
+			  size_t *len)
+{
+	size_t total = 0U;
+
+	if ((iov == NULL) && (iovcnt != 0U)) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < iovcnt; i++) {
+		if (size_add_overflow(total, iov[i].len, &total)) {
+			return -EINVAL;
+		}
+	}
+
+	*len = total;
+
+	return 0;
+}
+
+int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
+		     size_t *bytes_written, size_t min_xfer,
+		      k_timeout_t timeout)
+{
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, put, pipe, timeout);
+
+	CHECKIF((min_xfer > bytes_to_write) || bytes_written == NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout,
+					       -EINVAL);
+
+		return -EINVAL;
+	}
+
+	int ret = pipe_put_internal(pipe, data, NULL, bytes_to_write,
+				    bytes_written, min_xfer, timeout);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, put, pipe, timeout, ret);
 
 	return ret;
 }
 
+int k_pipe_putv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+		size_t iovcnt, size_t *bytes_written, size_t min_xfer,
+		k_timeout_t timeout)
+{
+	size_t bytes_to_write;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	CHECKIF((pipe_iovec_len(iov, iovcnt, &bytes_to_write) != 0) ||
+		(min_xfer > bytes_to_write) || bytes_written == NULL) {
+		return -EINVAL;
+	}
+
+	return pipe_put_internal(pipe, NULL, iov, bytes_to_write,
+				 bytes_written, min_xfer, timeout);
+}
+
 #ifdef CONFIG_USERSPACE
 int z_vrfy_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 		     size_t *bytes_written, size_t min_xfer,
@@ -521,9 +613,9 @@ int z_vrfy_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 #endif
 
 static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
-			     void *data, size_t bytes_to_read,
-			     size_t *bytes_read, size_t min_xfer,
-			     k_timeout_t timeout)
+			     void *data, const struct k_pipe_iovec *iov,
+			     size_t bytes_to_read, size_t *bytes_read,
+			     size_t min_xfer, k_timeout_t timeout)
 {
 	sys_dlist_t         src_list;
 	struct _pipe_desc   pipe_desc[2];
@@ -575,27 +667,14 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 	dest_desc = k_is_in_isr() ? &isr_desc : &_current->pipe_desc;
 
-	dest_desc->buffer = data;
-	dest_desc->bytes_to_xfer = bytes_to_read;
-	dest_desc->thread = _current;
+	pipe_desc_init(dest_desc, data, iov, bytes_to_read, _current);
 
 	src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	while (src_desc != NULL) {
-		bytes_copied = pipe_xfer(dest_desc->buffer,
-					  dest_desc->bytes_to_xfer,
-					  src_desc->buffer,
-					  src_desc->bytes_to_xfer);
+		bytes_copied = pipe_desc_xfer(dest_desc, src_desc);
 
 		num_bytes_read += bytes_copied;
 
-		src_desc->buffer += bytes_copied;
-		src_desc->bytes_to_xfer -= bytes_copied;
-
-		if (dest_desc->buffer != NULL) {
-			dest_desc->buffer += bytes_copied;
-		}
-		dest_desc->bytes_to_xfer -= bytes_copied;
-
 		if (src_desc->thread == NULL) {
 
 			/* Reading from the pipe buffer. Update details. */
@@ -614,7 +693,12 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 			reschedule_needed = true;
 		}
-		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
+
+		/* A source may span several destination segments */
+		if ((src_desc->bytes_to_xfer == 0U) ||
+		    (dest_desc->bytes_to_xfer == 0U)) {
+			src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
+		}
 	}
 
 	if (pipe->bytes_used != pipe->size) {
@@ -705,14 +789,34 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
-	int ret = pipe_get_internal(key, pipe, data, bytes_to_read, bytes_read,
-				    min_xfer, timeout);
+	int ret = pipe_get_internal(key, pipe, data, NULL, bytes_to_read,
+				    bytes_read, min_xfer, timeout);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, get, pipe, timeout, ret);
 
 	return ret;
 }
 
+int k_pipe_getv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+		size_t iovcnt, size_t *bytes_read, size_t min_xfer,
+		k_timeout_t timeout)
+{
+	size_t bytes_to_read;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	CHECKIF((pipe_iovec_len(iov, iovcnt, &bytes_to_read) != 0) ||
+		(min_xfer > bytes_to_read) || bytes_read == NULL) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	return pipe_get_internal(key, pipe, NULL, iov, bytes_to_read,
+				 bytes_read, min_xfer, timeout);
+}
+
 #ifdef CONFIG_USERSPACE
 int z_vrfy_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 		      size_t *bytes_read, size_t min_xfer, k_timeout_t timeout)
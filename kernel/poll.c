@@ -34,10 +34,13 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+#ifdef CONFIG_POLL_SET
+static int signal_set(struct k_poll_event *event, uint32_t state);
+#endif
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -81,7 +84,8 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
-		if (event->msgq->used_msgs > 0) {
+		if (event->msgq->used_msgs > 0 &&
+		    (event->msgq->flags & K_MSGQ_FLAG_GET_CLAIMED) == 0U) {
 			*state = K_POLL_STATE_MSGQ_DATA_AVAILABLE;
 			return true;
 		}
@@ -108,22 +112,30 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread priority, their events are signaled last */
+static inline bool poller_is_set(struct z_poller *p)
+{
+	return IS_ENABLED(CONFIG_POLL_SET) && (p != NULL) && (p->mode == MODE_SET);
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || poller_is_set(poller) ||
+		(!poller_is_set(pending->poller) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+							   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (poller_is_set(pending->poller) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -447,6 +459,12 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	int retcode = 0;
 
 	if (poller != NULL) {
+#ifdef CONFIG_POLL_SET
+		/* The event stays in its set, so its poller is kept */
+		if (poller->mode == MODE_SET) {
+			return signal_set(event, state);
+		}
+#endif
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
@@ -813,3 +831,174 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+#ifdef CONFIG_POLL_SET
+/* must be called with interrupts locked */
+static int signal_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set,
+					      poller);
+
+	/* The object took the event off its list, it waits on the ready list
+	 * until a wait finds its object no longer ready.
+	 */
+	event->state = state;
+	sys_dlist_append(&set->ready, &event->_node);
+	(void)z_sched_wake(&set->wait_q, 0, NULL);
+
+	return 0;
+}
+
+/* must be called with the poll lock held */
+static int set_harvest(struct k_poll_set *set, struct k_poll_event **events,
+		       int max_events)
+{
+	struct k_poll_event *event, *next;
+	sys_dlist_t kept;
+	int num_events = 0;
+
+	sys_dlist_init(&kept);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&set->ready, event, next, _node) {
+		uint32_t state = event->state & K_POLL_STATE_CANCELLED;
+		uint32_t met;
+
+		if (num_events == max_events) {
+			break;
+		}
+
+		/* Only the cancellation is taken from the signal, the object
+		 * may have been taken since it was signaled.
+		 */
+		if (is_condition_met(event, &met)) {
+			state |= met;
+		}
+
+		sys_dlist_remove(&event->_node);
+
+		if (state == K_POLL_STATE_NOT_READY) {
+			event->state = K_POLL_STATE_NOT_READY;
+			register_event(event, &set->poller);
+			continue;
+		}
+
+		event->state = state;
+		events[num_events++] = event;
+
+		/* A cancellation is returned once, an object ready for as
+		 * long as it stays ready.
+		 */
+		if ((state & K_POLL_STATE_CANCELLED) != 0U) {
+			register_event(event, &set->poller);
+		} else {
+			sys_dlist_append(&kept, &event->_node);
+		}
+	}
+
+	/* Requeued behind the events not returned, to be fair to them */
+	while (!sys_dlist_is_empty(&kept)) {
+		sys_dlist_append(&set->ready, sys_dlist_get(&kept));
+	}
+
+	return num_events;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key;
+	uint32_t state;
+
+	__ASSERT(set != NULL, "NULL set\n");
+	__ASSERT(event != NULL, "NULL event\n");
+
+	if ((event->type == K_POLL_TYPE_IGNORE) || (event->obj == NULL)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	event->state = K_POLL_STATE_NOT_READY;
+
+	if (!is_condition_met(event, &state)) {
+		register_event(event, &set->poller);
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	event->poller = &set->poller;
+	(void)signal_set(event, state);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(set != NULL, "NULL set\n");
+	__ASSERT(event != NULL, "NULL event\n");
+
+	key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	/* Either on its object or on the ready list */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int num_events;
+	int swap_rc;
+
+	__ASSERT(set != NULL, "NULL set\n");
+	__ASSERT(events != NULL, "NULL events\n");
+	__ASSERT(max_events > 0, "no room for events\n");
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	key = k_spin_lock(&lock);
+
+	num_events = set_harvest(set, events, max_events);
+	if ((num_events > 0) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&lock, key);
+		return (num_events > 0) ? num_events : -EAGAIN;
+	}
+
+	swap_rc = z_pend_curr(&lock, key, &set->wait_q, timeout);
+	if (swap_rc != 0) {
+		return swap_rc;
+	}
+
+	key = k_spin_lock(&lock);
+	num_events = set_harvest(set, events, max_events);
+	k_spin_unlock(&lock, key);
+
+	return (num_events > 0) ? num_events : -EAGAIN;
+}
+#endif /* CONFIG_POLL_SET */
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief reader-writer lock kernel services
+ *
+ * The lock state lives in a single atomic word holding the reader count,
+ * a writer-held flag and a waiters flag.  Uncontended read and write
+ * acquisition and release are a single compare-and-swap on that word.
+ * The slow paths run under a spinlock and pend on separate reader and
+ * writer wait queues.
+ *
+ * Any thread that pends first sets the waiters flag (under the spinlock),
+ * which sends every later acquisition and release to the slow path.  A
+ * release with waiters present hands the lock over directly: to the best
+ * waiting writer if there is one, else to all waiting readers at once.
+ * New readers also wait while a writer is waiting, so writers are not
+ * starved.
+ *
+ * As with k_mutex, a writer pending on a lock held by another writer
+ * raises the holder's priority, and the holder returns to its original
+ * priority on release.
+ *
+ * The owner is set under the spinlock, except by the fast path
+ * acquisition which claims it before taking the lock and gives it back
+ * if that fails.  The fast path release clears it after releasing the
+ * lock, only if it still names the releasing thread.  Under the
+ * spinlock, with the writer bit and the waiters flag set, it thus names
+ * the writer holding the lock, which cannot release it meanwhile.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <ksched.h>
+#include <zephyr/wait_q.h>
+#include <errno.h>
+#include <zephyr/syscall_handler.h>
+
+#define WRITER  Z_RWLOCK_WRITER
+#define WAITERS Z_RWLOCK_WAITERS
+#define READERS Z_RWLOCK_READERS
+
+/* Global, like the k_mutex lock: writer priority inheritance touches
+ * owner thread priorities which aren't "part of" a single lock.
+ */
+static struct k_spinlock lock;
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	atomic_set(&rwlock->state, 0);
+	z_waitq_init(&rwlock->readers);
+	z_waitq_init(&rwlock->writers);
+	atomic_ptr_clear(&rwlock->owner);
+	rwlock->owner_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO;
+
+	z_object_init(rwlock);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	Z_OOPS(Z_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock);
+}
+#include <syscalls/k_rwlock_init_mrsh.c>
+#endif
+
+static inline bool has_waiters(struct k_rwlock *rwlock)
+{
+	return (z_waitq_head(&rwlock->readers) != NULL) ||
+	       (z_waitq_head(&rwlock->writers) != NULL);
+}
+
+/* Called with the lock held.  The owner may briefly be NULL while a
+ * writer takes the lock on the fast path, and then is not boosted.
+ */
+static bool adjust_owner_prio(struct k_rwlock *rwlock, int32_t new_prio)
+{
+	struct k_thread *owner = atomic_ptr_get(&rwlock->owner);
+
+	if ((owner != NULL) && (owner->base.prio != new_prio)) {
+		return z_set_prio(owner, new_prio);
+	}
+	return false;
+}
+
+/* Priority the writer holding the lock should run at given the writers
+ * now waiting for it.
+ */
+static int32_t owner_prio(struct k_rwlock *rwlock)
+{
+	struct k_thread *waiter = z_waitq_head(&rwlock->writers);
+	int32_t prio = rwlock->owner_orig_prio;
+
+	if ((waiter != NULL) && z_is_prio_higher(waiter->base.prio, prio)) {
+		prio = z_get_new_prio_with_ceiling(waiter->base.prio);
+	}
+
+	return prio;
+}
+
+/* Called with the lock held and no writer holding the rwlock: hands it
+ * to the best waiting writer once the readers are gone, or to all
+ * waiting readers if no writer waits.  Returns true if a thread was
+ * woken.
+ */
+static bool hand_over(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+	struct k_thread *thread;
+	bool woken = false;
+
+	__ASSERT_NO_MSG((state & WRITER) == 0);
+
+	if (z_waitq_head(&rwlock->writers) != NULL) {
+		if ((state & READERS) != 0) {
+			/* The last reader out hands over */
+			return false;
+		}
+
+		thread = z_unpend_first_thread(&rwlock->writers);
+	} else {
+		thread = NULL;
+	}
+
+	if (thread != NULL) {
+		rwlock->owner_orig_prio = thread->base.prio;
+		atomic_ptr_set(&rwlock->owner, thread);
+		atomic_set(&rwlock->state,
+			   WRITER | (has_waiters(rwlock) ? WAITERS : 0));
+		(void)adjust_owner_prio(rwlock, owner_prio(rwlock));
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		return true;
+	}
+
+	/* No writer waiting: admit every waiting reader at once */
+	while ((thread = z_unpend_first_thread(&rwlock->readers)) != NULL) {
+		/* Counted in before it can run and release */
+		(void)atomic_inc(&rwlock->state);
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		woken = true;
+	}
+	if (!has_waiters(rwlock)) {
+		(void)atomic_and(&rwlock->state, ~WAITERS);
+	}
+
+	return woken;
+}
+
+/* Called with the lock held after a waiter timed out: drops the waiters
+ * flag if it was the last waiter, and unblocks readers that were only
+ * waiting behind it.
+ */
+static bool waiter_gone(struct k_rwlock *rwlock)
+{
+	bool resched;
+
+	if ((atomic_get(&rwlock->state) & WRITER) != 0) {
+		/* Before the owner can release the lock on the fast path */
+		resched = adjust_owner_prio(rwlock, owner_prio(rwlock));
+		if (!has_waiters(rwlock)) {
+			(void)atomic_and(&rwlock->state, ~WAITERS);
+		}
+		return resched;
+	}
+
+	return hand_over(rwlock);
+}
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	atomic_val_t state;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	/* Fast path: no writer, nobody waiting */
+	state = atomic_get(&rwlock->state);
+	if (((state & (WRITER | WAITERS)) == 0) &&
+	    atomic_cas(&rwlock->state, state, state + 1)) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		state = atomic_get(&rwlock->state);
+
+		if (((state & WRITER) == 0) &&
+		    (z_waitq_head(&rwlock->writers) == NULL)) {
+			if (atomic_cas(&rwlock->state, state, state + 1)) {
+				k_spin_unlock(&lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EBUSY;
+		}
+
+		if (((state & WAITERS) != 0) ||
+		    atomic_cas(&rwlock->state, state, state | WAITERS)) {
+			break;
+		}
+	}
+
+	ret = z_pend_curr(&lock, key, &rwlock->readers, timeout);
+	if (ret == 0) {
+		/* Woken by hand_over(), which counted us in */
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	if (waiter_gone(rwlock)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock,
+					    k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <syscalls/k_rwlock_read_lock_mrsh.c>
+#endif
+
+int z_impl_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	atomic_val_t state;
+
+	/* Fast path: nobody waiting, just drop our count */
+	do {
+		state = atomic_get(&rwlock->state);
+
+		if (((state & WRITER) != 0) || ((state & READERS) == 0)) {
+			return -EINVAL;
+		}
+		if ((state & WAITERS) != 0) {
+			break;
+		}
+	} while (!atomic_cas(&rwlock->state, state, state - 1));
+
+	if ((state & WAITERS) == 0) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	(void)atomic_dec(&rwlock->state);
+	if (hand_over(rwlock)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_unlock(rwlock);
+}
+#include <syscalls/k_rwlock_read_unlock_mrsh.c>
+#endif
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	struct k_thread *owner;
+	k_spinlock_key_t key;
+	atomic_val_t state;
+	bool resched = false;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	/* Fast path: completely free, and the last writer done clearing
+	 * the owner.  The owner is claimed first, so that it is never stale
+	 * once the writer bit is set.
+	 */
+	if (atomic_ptr_cas(&rwlock->owner, NULL, _current)) {
+		if (atomic_cas(&rwlock->state, 0, WRITER)) {
+			rwlock->owner_orig_prio = _current->base.prio;
+			return 0;
+		}
+		/* Unless a slow path writer replaced it meanwhile */
+		(void)atomic_ptr_cas(&rwlock->owner, _current, NULL);
+	}
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		state = atomic_get(&rwlock->state);
+
+		if ((state & (WRITER | READERS)) == 0) {
+			if (atomic_cas(&rwlock->state, state, state | WRITER)) {
+				rwlock->owner_orig_prio = _current->base.prio;
+				atomic_ptr_set(&rwlock->owner, _current);
+				k_spin_unlock(&lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EBUSY;
+		}
+
+		if (((state & WAITERS) != 0) ||
+		    atomic_cas(&rwlock->state, state, state | WAITERS)) {
+			break;
+		}
+	}
+
+	/* The waiters flag keeps the owner from releasing the lock until
+	 * we pend
+	 */
+	owner = atomic_ptr_get(&rwlock->owner);
+	if (((state & WRITER) != 0) && (owner != NULL) &&
+	    z_is_prio_higher(_current->base.prio, owner->base.prio)) {
+		resched = adjust_owner_prio(rwlock,
+			z_get_new_prio_with_ceiling(_current->base.prio));
+	}
+
+	ret = z_pend_curr(&lock, key, &rwlock->writers, timeout);
+	if (ret == 0) {
+		/* Woken by hand_over(), which made us the owner */
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	resched = waiter_gone(rwlock) || resched;
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock,
+					     k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <syscalls/k_rwlock_write_lock_mrsh.c>
+#endif
+
+int z_impl_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	int32_t prio = rwlock->owner_orig_prio;
+
+	if ((atomic_ptr_get(&rwlock->owner) != _current) ||
+	    ((atomic_get(&rwlock->state) & WRITER) == 0)) {
+		return -EPERM;
+	}
+
+	/* Fast path: nobody waiting and our priority not raised.  It can
+	 * only be raised by a writer that set the waiters flag first, so
+	 * the compare-and-swap catches any raise after the check.  Only a
+	 * slow path writer, which sets the owner under the lock, can take
+	 * the lock before we clear it, hence the compare.
+	 */
+	if ((_current->base.prio == prio) &&
+	    atomic_cas(&rwlock->state, WRITER, 0)) {
+		(void)atomic_ptr_cas(&rwlock->owner, _current, NULL);
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+	atomic_ptr_clear(&rwlock->owner);
+
+	/* Waiters flag set: they are pending on the wait queues (having
+	 * possibly raised our priority), or were and have timed out.
+	 */
+	if (_current->base.prio != prio) {
+		(void)z_set_prio(_current, prio);
+	}
+	(void)atomic_and(&rwlock->state, ~WRITER);
+
+	(void)hand_over(rwlock);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_unlock(rwlock);
+}
+#include <syscalls/k_rwlock_write_unlock_mrsh.c>
+#endif
@@ -213,6 +213,9 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	/* Stable while queued, it only changes when switched in */
+	return &_kernel.cpus[thread->base.cpu].ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
 #endif
@@ -220,7 +223,7 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
@@ -237,10 +240,45 @@ static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 	_priq_run_remove(thread_runq(thread), thread);
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+static ALWAYS_INLINE bool should_steal(struct k_thread *remote,
+				       struct k_thread *local)
+{
+	if (local == NULL) {
+		return true;
+	}
+
+	return (z_sched_prio_cmp(remote, local) > 0) &&
+		((local->base.prio - remote->base.prio) >=
+		 CONFIG_SCHED_PER_CPU_RUNQ_TOLERANCE);
+}
+
+/* Best thread of the local queue, unless another CPU's queue holds
+ * a sufficiently better one, in which case that one gets stolen.  All
+ * the queues are protected by sched_spinlock, like the shared one.
+ */
+static ALWAYS_INLINE struct k_thread *runq_best(void)
+{
+	unsigned int id = _current_cpu->id;
+	struct k_thread *thread = _priq_run_best(curr_cpu_runq());
+
+	for (unsigned int i = 1; i < arch_num_cpus(); i++) {
+		unsigned int cpu = (id + i) % arch_num_cpus();
+		struct k_thread *t = _priq_run_best(&_kernel.cpus[cpu].ready_q.runq);
+
+		if ((t != NULL) && should_steal(t, thread)) {
+			thread = t;
+		}
+	}
+
+	return thread;
+}
+#else
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
 	return _priq_run_best(curr_cpu_runq());
 }
+#endif
 
 /* _current is never in the run queue until context switch on
  * SMP configurations, see z_requeue_current()
@@ -283,9 +321,14 @@ static void signal_pending_ipi(void)
 	 */
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		if (_kernel.pending_ipi) {
-			_kernel.pending_ipi = false;
+		uint32_t cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+
+		if (cpu_bitmap != 0U) {
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+			arch_sched_directed_ipi(cpu_bitmap);
+#else
 			arch_sched_ipi();
+#endif
 		}
 	}
 #endif
@@ -404,12 +447,61 @@ static void move_thread_to_end_of_prio_q(struct k_thread *thread)
 	update_cache(thread == _current);
 }
 
-static void flag_ipi(void)
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 32, "IPI bitmaps are 32 bits wide");
+
+/* Returns the set of other CPUs that @thread, having just been readied
+ * or reprioritized, could preempt: those it may run on that are idle or
+ * running something of lower priority that can be preempted by it, plus
+ * any CPU currently running the thread itself.  Must be called with the
+ * scheduler lock held so the other CPUs' _current values are stable.
+ */
+static uint32_t ipi_mask_create(struct k_thread *thread)
 {
+	uint32_t ipi_mask = 0U;
+
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	if (arch_num_cpus() > 1) {
-		_kernel.pending_ipi = true;
+	uint32_t id = _current_cpu->id;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (uint32_t i = 0; i < num_cpus; i++) {
+		struct k_thread *cpu_thread = _kernel.cpus[i].current;
+
+		if ((i == id) || (cpu_thread == NULL)) {
+			continue;
+		}
+
+		if (cpu_thread == thread) {
+			ipi_mask |= BIT(i);
+			continue;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((thread->base.cpu_mask & BIT(i)) == 0U) {
+			continue;
+		}
+#endif
+
+		if (z_is_idle_thread_object(cpu_thread) ||
+		    ((z_sched_prio_cmp(thread, cpu_thread) > 0) &&
+		     (is_preempt(cpu_thread) || is_metairq(thread)))) {
+			ipi_mask |= BIT(i);
+		}
+	}
+#else
+	ARG_UNUSED(thread);
+#endif
+
+	return ipi_mask;
+}
+
+static void flag_ipi(uint32_t ipi_mask)
+{
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	if ((arch_num_cpus() > 1) && (ipi_mask != 0U)) {
+		(void)atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
 	}
+#else
+	ARG_UNUSED(ipi_mask);
 #endif
 }
 
@@ -467,7 +559,7 @@ static void slice_timeout(struct _timeout *t)
 	 * the specific core, but that's not part of the API yet.
 	 */
 	if (IS_ENABLED(CONFIG_SMP) && cpu != _current_cpu->id) {
-		flag_ipi();
+		flag_ipi(BIT(cpu));
 	}
 }
 
@@ -582,7 +674,7 @@ static void update_cache(int preempt_ok)
 #endif
 }
 
-static bool thread_active_elsewhere(struct k_thread *thread)
+bool z_thread_active_elsewhere(struct k_thread *thread)
 {
 	/* True if the thread is currently running on another CPU.
 	 * There are more scalable designs to answer this question in
@@ -603,7 +695,11 @@ static bool thread_active_elsewhere(struct k_thread *thread)
 	return false;
 }
 
-static void ready_thread(struct k_thread *thread)
+/* Adds the thread to the run queue without recomputing the cache or
+ * flagging an IPI, so wakeup batches can do both once at the end.
+ * Returns true if the thread was queued.
+ */
+static bool ready_thread_batched(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
 	__ASSERT_NO_MSG(arch_mem_coherent(thread));
@@ -615,16 +711,27 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		z_sched_latency_ready(thread);
+#endif
 		queue_thread(thread);
+		return true;
+	}
+	return false;
+}
+
+static void ready_thread(struct k_thread *thread)
+{
+	if (ready_thread_batched(thread)) {
 		update_cache(0);
-		flag_ipi();
+		flag_ipi(ipi_mask_create(thread));
 	}
 }
 
 void z_ready_thread(struct k_thread *thread)
 {
 	K_SPINLOCK(&sched_spinlock) {
-		if (!thread_active_elsewhere(thread)) {
+		if (!z_thread_active_elsewhere(thread)) {
 			ready_thread(thread);
 		}
 	}
@@ -926,6 +1033,7 @@ bool z_set_prio(struct k_thread *thread, int prio)
 				thread->base.prio = prio;
 			}
 			update_cache(1);
+			flag_ipi(ipi_mask_create(thread));
 		} else {
 			thread->base.prio = prio;
 		}
@@ -940,8 +1048,6 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 {
 	bool need_sched = z_set_prio(thread, prio);
 
-	flag_ipi();
-
 	if (need_sched && _current->base.sched_locked == 0U) {
 		z_reschedule_unlocked();
 	}
@@ -974,7 +1080,7 @@ static inline bool need_swap(void)
 #endif
 }
 
-void z_reschedule(struct k_spinlock *lock, k_spinlock_key_t key)
+__hot_code void z_reschedule(struct k_spinlock *lock, k_spinlock_key_t key)
 {
 	if (resched(key.key) && need_swap()) {
 		z_swap(lock, key);
@@ -1078,7 +1184,7 @@ static inline void set_current(struct k_thread *new_thread)
  * @retval Handle for the next thread to execute, or @p interrupted when
  *         no new thread is to be scheduled.
  */
-void *z_get_next_switch_handle(void *interrupted)
+__hot_code void *z_get_next_switch_handle(void *interrupted)
 {
 	z_check_stack_sentinel();
 
@@ -1101,6 +1207,7 @@ void *z_get_next_switch_handle(void *interrupted)
 			arch_cohere_stacks(old_thread, interrupted, new_thread);
 
 			_current_cpu->swap_ok = 0;
+			new_thread->base.cpu = arch_curr_cpu()->id;
 			set_current(new_thread);
 
 #ifdef CONFIG_TIMESLICING
@@ -1228,39 +1335,58 @@ struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 }
 
 #ifdef CONFIG_SCHED_MULTIQ
-# if (K_LOWEST_THREAD_PRIO - K_HIGHEST_THREAD_PRIO) > 31
-# error Too many priorities for multiqueue scheduler (max 32)
-# endif
+BUILD_ASSERT(PRIQ_BITMAP_SIZE <= BITS_PER_LONG,
+	     "Too many priorities for multiqueue scheduler");
 
 static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 					struct k_thread *thread)
 {
-	int priority_bit = thread->base.prio - K_HIGHEST_THREAD_PRIO;
+	unsigned int priority_bit = thread->base.prio - K_HIGHEST_THREAD_PRIO;
+	unsigned int word = priority_bit / BITS_PER_LONG;
 
 	sys_dlist_append(&pq->queues[priority_bit], &thread->base.qnode_dlist);
-	pq->bitmask |= BIT(priority_bit);
+	pq->bitmask[word] |= BIT(priority_bit % BITS_PER_LONG);
+#if PRIQ_BITMAP_SIZE > 1
+	pq->words |= BIT(word);
+#endif
 }
 
 static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 					   struct k_thread *thread)
 {
-	int priority_bit = thread->base.prio - K_HIGHEST_THREAD_PRIO;
+	unsigned int priority_bit = thread->base.prio - K_HIGHEST_THREAD_PRIO;
+	unsigned int word = priority_bit / BITS_PER_LONG;
 
 	sys_dlist_remove(&thread->base.qnode_dlist);
 	if (sys_dlist_is_empty(&pq->queues[priority_bit])) {
-		pq->bitmask &= ~BIT(priority_bit);
+		pq->bitmask[word] &= ~BIT(priority_bit % BITS_PER_LONG);
+#if PRIQ_BITMAP_SIZE > 1
+		if (pq->bitmask[word] == 0UL) {
+			pq->words &= ~BIT(word);
+		}
+#endif
 	}
 }
 #endif
 
 struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 {
-	if (!pq->bitmask) {
+	unsigned int word = 0;
+
+#if PRIQ_BITMAP_SIZE > 1
+	if (pq->words == 0UL) {
+		return NULL;
+	}
+	word = __builtin_ctzl(pq->words);
+#else
+	if (pq->bitmask[0] == 0UL) {
 		return NULL;
 	}
+#endif
 
 	struct k_thread *thread = NULL;
-	sys_dlist_t *l = &pq->queues[__builtin_ctz(pq->bitmask)];
+	sys_dlist_t *l = &pq->queues[word * BITS_PER_LONG +
+				     __builtin_ctzl(pq->bitmask[word])];
 	sys_dnode_t *n = sys_dlist_peek_head(l);
 
 	if (n != NULL) {
@@ -1269,15 +1395,47 @@ struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 	return thread;
 }
 
+/* Unpends and readies every thread on the wait queue under a single
+ * hold of the scheduler lock, then recomputes the cache and flags an
+ * IPI once for the whole batch instead of once per thread.
+ */
+static int wake_all_locked(_wait_q_t *wait_q, bool set_retval,
+			   int swap_retval, void *swap_data)
+{
+	struct k_thread *thread;
+	uint32_t ipi_mask = 0U;
+	bool readied = false;
+	int woken = 0;
+
+	while ((thread = _priq_wait_best(&wait_q->waitq)) != NULL) {
+		if (set_retval) {
+			z_thread_return_value_set_with_data(thread,
+							    swap_retval,
+							    swap_data);
+		}
+		unpend_thread_no_timeout(thread);
+		(void)z_abort_thread_timeout(thread);
+		if (ready_thread_batched(thread)) {
+			ipi_mask |= ipi_mask_create(thread);
+			readied = true;
+		}
+		woken++;
+	}
+
+	if (readied) {
+		update_cache(0);
+		flag_ipi(ipi_mask);
+	}
+
+	return woken;
+}
+
 int z_unpend_all(_wait_q_t *wait_q)
 {
 	int need_sched = 0;
-	struct k_thread *thread;
 
-	while ((thread = z_waitq_head(wait_q)) != NULL) {
-		z_unpend_thread(thread);
-		z_ready_thread(thread);
-		need_sched = 1;
+	K_SPINLOCK(&sched_spinlock) {
+		need_sched = (wake_all_locked(wait_q, false, 0, NULL) != 0) ? 1 : 0;
 	}
 
 	return need_sched;
@@ -1292,7 +1450,7 @@ void init_ready_q(struct _ready_q *rq)
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+	for (int i = 0; i < ARRAY_SIZE(rq->runq.queues); i++) {
 		sys_dlist_init(&rq->runq.queues[i]);
 	}
 #else
@@ -1302,7 +1460,7 @@ void init_ready_q(struct _ready_q *rq)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
@@ -1382,6 +1540,231 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 }
 #include <syscalls/k_thread_deadline_set_mrsh.c>
 #endif
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/* Constant bandwidth servers.  Each thread with a server carries a
+ * budget that is charged at context switch and refilled by a per-thread
+ * period timeout, which also moves the thread's deadline one period
+ * forward.  A single enforcement timeout fires when the running
+ * thread's remaining budget is used up and throttles it until its next
+ * period starts.  Utilization is tracked in parts per million.
+ */
+static struct _timeout cbs_enforce_timeout;
+static struct k_thread *cbs_running;
+static uint32_t cbs_utilization;
+
+#define CBS_UTIL_SCALE 1000000U
+#define CBS_UTIL_MAX (CONFIG_SCHED_DEADLINE_CBS_MAX_UTILIZATION * (CBS_UTIL_SCALE / 100U))
+
+static inline bool has_cbs(struct k_thread *thread)
+{
+	return thread->base.cbs.budget != 0U;
+}
+
+static void cbs_charge(uint32_t now)
+{
+	struct k_thread *thread = cbs_running;
+
+	if (thread != NULL) {
+		thread->base.cbs.remaining -=
+			(int32_t)(now - thread->base.cbs.switched_in);
+		thread->base.cbs.switched_in = now;
+	}
+}
+
+static void cbs_throttle(struct k_thread *thread)
+{
+	if (z_is_thread_queued(thread)) {
+		dequeue_thread(thread);
+	}
+	thread->base.thread_state |= _THREAD_THROTTLED;
+	thread->base.cbs.overruns++;
+	update_cache(0);
+}
+
+static void cbs_enforce(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	K_SPINLOCK(&sched_spinlock) {
+		struct k_thread *thread = cbs_running;
+
+		cbs_charge(k_cycle_get_32());
+		if ((thread != NULL) && (thread->base.cbs.remaining <= 0) &&
+		    !z_is_thread_prevented_from_running(thread)) {
+			cbs_throttle(thread);
+		}
+	}
+}
+
+static void cbs_arm(struct k_thread *thread, uint32_t now)
+{
+	z_abort_timeout(&cbs_enforce_timeout);
+	cbs_running = NULL;
+
+	if (!has_cbs(thread)) {
+		return;
+	}
+
+	cbs_running = thread;
+	thread->base.cbs.switched_in = now;
+	if (thread->base.cbs.remaining <= 0) {
+		/* Out of budget on the way in (e.g. it was charged
+		 * while a lock kept it running): throttle right away.
+		 */
+		z_add_timeout(&cbs_enforce_timeout, cbs_enforce, K_NO_WAIT);
+	} else {
+		z_add_timeout(&cbs_enforce_timeout, cbs_enforce,
+			      K_TICKS(k_cyc_to_ticks_ceil32(thread->base.cbs.remaining)));
+	}
+}
+
+void z_sched_cbs_switch(struct k_thread *thread)
+{
+	uint32_t now = k_cycle_get_32();
+
+	cbs_charge(now);
+	if ((thread != cbs_running) || (thread != _current)) {
+		cbs_arm(thread, now);
+	}
+}
+
+static void cbs_period(struct _timeout *t)
+{
+	struct k_thread *thread = CONTAINER_OF(t, struct k_thread,
+					       base.cbs.period_timeout);
+
+	K_SPINLOCK(&sched_spinlock) {
+		uint8_t state = thread->base.thread_state;
+		bool throttled = (state & _THREAD_THROTTLED) != 0U;
+		uint32_t now = k_cycle_get_32();
+
+		if (!has_cbs(thread) || (state & _THREAD_DEAD) != 0U) {
+			K_SPINLOCK_BREAK;
+		}
+
+		/* Still wanting the CPU at its deadline: the job did
+		 * not complete within the period.
+		 */
+		if (throttled || !z_is_thread_prevented_from_running(thread)) {
+			thread->base.cbs.deadline_misses++;
+		}
+
+		if (thread == cbs_running) {
+			cbs_charge(now);
+		}
+		thread->base.cbs.remaining = (int32_t)thread->base.cbs.budget;
+		thread->base.prio_deadline += (int)thread->base.cbs.period;
+
+		z_add_timeout(&thread->base.cbs.period_timeout, cbs_period,
+			      K_TICKS(k_cyc_to_ticks_near32(thread->base.cbs.period)));
+
+		if (thread == cbs_running) {
+			cbs_arm(thread, now);
+		}
+
+		if (throttled) {
+			thread->base.thread_state &= ~_THREAD_THROTTLED;
+			ready_thread(thread);
+		} else if (z_is_thread_queued(thread)) {
+			/* Re-sort for the new deadline */
+			dequeue_thread(thread);
+			queue_thread(thread);
+			update_cache(0);
+		}
+	}
+}
+
+static void cbs_detach(struct k_thread *thread)
+{
+	if (!has_cbs(thread)) {
+		return;
+	}
+
+	cbs_utilization -= (uint32_t)(((uint64_t)thread->base.cbs.budget * CBS_UTIL_SCALE) /
+				      thread->base.cbs.period);
+	thread->base.cbs.budget = 0U;
+	z_abort_timeout(&thread->base.cbs.period_timeout);
+
+	if (thread == cbs_running) {
+		z_abort_timeout(&cbs_enforce_timeout);
+		cbs_running = NULL;
+	}
+
+	if ((thread->base.thread_state & _THREAD_THROTTLED) != 0U) {
+		thread->base.thread_state &= ~_THREAD_THROTTLED;
+		ready_thread(thread);
+	}
+}
+
+int z_impl_k_thread_cbs_set(k_tid_t tid, uint32_t budget, uint32_t period)
+{
+	struct k_thread *thread = tid;
+	uint32_t util;
+	int ret = 0;
+
+	if ((budget != 0U) && ((period == 0U) || (budget > period))) {
+		return -EINVAL;
+	}
+
+	util = (budget == 0U) ? 0U
+			      : (uint32_t)(((uint64_t)budget * CBS_UTIL_SCALE) / period);
+
+	K_SPINLOCK(&sched_spinlock) {
+		uint32_t others = cbs_utilization;
+		uint32_t now = k_cycle_get_32();
+
+		if (has_cbs(thread)) {
+			others -= (uint32_t)(((uint64_t)thread->base.cbs.budget *
+					      CBS_UTIL_SCALE) / thread->base.cbs.period);
+		}
+		if (others + util > CBS_UTIL_MAX) {
+			ret = -EBUSY;
+			K_SPINLOCK_BREAK;
+		}
+
+		if (thread == cbs_running) {
+			cbs_charge(now);
+		}
+		cbs_detach(thread);
+		if (budget == 0U) {
+			K_SPINLOCK_BREAK;
+		}
+
+		cbs_utilization += util;
+		thread->base.cbs.budget = budget;
+		thread->base.cbs.period = period;
+		thread->base.cbs.remaining = (int32_t)budget;
+		thread->base.prio_deadline = (int)(now + period);
+		z_add_timeout(&thread->base.cbs.period_timeout, cbs_period,
+			      K_TICKS(k_cyc_to_ticks_near32(period)));
+
+		if (thread == _current) {
+			cbs_arm(thread, now);
+		}
+		if (z_is_thread_queued(thread)) {
+			dequeue_thread(thread);
+			queue_thread(thread);
+			update_cache(0);
+		}
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_cbs_set(k_tid_t tid, uint32_t budget,
+					  uint32_t period)
+{
+	struct k_thread *thread = tid;
+
+	Z_OOPS(Z_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+
+	return z_impl_k_thread_cbs_set((k_tid_t)thread, budget, period);
+}
+#include <syscalls/k_thread_cbs_set_mrsh.c>
+#endif
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 #endif
 
 bool k_can_yield(void)
@@ -1443,7 +1826,12 @@ static int32_t z_tick_sleep(k_ticks_t ticks)
 	pending_current = _current;
 #endif
 	unready_thread(_current);
+#ifdef CONFIG_TIMER_SLACK
+	z_add_timeout_slack(&_current->base.timeout, z_thread_timeout, timeout,
+			    _current->base.timer_slack);
+#else
 	z_add_thread_timeout(_current, timeout);
+#endif
 	z_mark_thread_as_suspended(_current);
 
 	(void)z_swap(&sched_spinlock, key);
@@ -1495,6 +1883,30 @@ static inline int32_t z_vrfy_k_sleep(k_timeout_t timeout)
 #include <syscalls/k_sleep_mrsh.c>
 #endif
 
+#ifdef CONFIG_TIMER_SLACK
+void z_impl_k_thread_timer_slack_set(k_tid_t thread, k_timeout_t slack)
+{
+	__ASSERT(!K_TIMEOUT_EQ(slack, K_FOREVER), "");
+	__ASSERT(Z_TICK_ABS(slack.ticks) < 0, "absolute slack");
+
+	thread->base.timer_slack = slack.ticks;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_thread_timer_slack_set(k_tid_t thread,
+						   k_timeout_t slack)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+	Z_OOPS(Z_SYSCALL_VERIFY_MSG(!K_TIMEOUT_EQ(slack, K_FOREVER) &&
+				    (Z_TICK_ABS(slack.ticks) < 0),
+				    "invalid slack"));
+
+	z_impl_k_thread_timer_slack_set(thread, slack);
+}
+#include <syscalls/k_thread_timer_slack_set_mrsh.c>
+#endif
+#endif /* CONFIG_TIMER_SLACK */
+
 int32_t z_impl_k_usleep(int us)
 {
 	int32_t ticks;
@@ -1535,8 +1947,6 @@ void z_impl_k_wakeup(k_tid_t thread)
 	z_mark_thread_as_not_suspended(thread);
 	z_ready_thread(thread);
 
-	flag_ipi();
-
 	if (!arch_is_in_isr()) {
 		z_reschedule_unlocked();
 	}
@@ -1711,6 +2121,9 @@ static void end_thread(struct k_thread *thread)
 			unpend_thread_no_timeout(thread);
 		}
 		(void)z_abort_thread_timeout(thread);
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		cbs_detach(thread);
+#endif
 		unpend_all(&thread->join_queue);
 		update_cache(1);
 
@@ -1753,7 +2166,7 @@ void z_thread_abort(struct k_thread *thread)
 		end_thread(thread);
 	}
 
-	bool active = thread_active_elsewhere(thread);
+	bool active = z_thread_active_elsewhere(thread);
 
 	if (active) {
 		/* It's running somewhere else, flag and poke */
@@ -1918,6 +2331,52 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	return ret;
 }
 
+int z_sched_wake_batch(_wait_q_t *wait_q, int swap_retval, void *swap_data)
+{
+	int woken = 0;
+
+	K_SPINLOCK(&sched_spinlock) {
+		woken = wake_all_locked(wait_q, true, swap_retval, swap_data);
+	}
+
+	return woken;
+}
+
+#ifdef CONFIG_EVENTS
+void z_sched_wake_event_list(struct k_thread *head)
+{
+	K_SPINLOCK(&sched_spinlock) {
+		struct k_thread *thread = head;
+		uint32_t ipi_mask = 0U;
+		bool readied = false;
+
+		while (thread != NULL) {
+			struct k_thread *next = thread->next_event_link;
+			bool killed = ((thread->base.thread_state &
+					(_THREAD_DEAD | _THREAD_ABORTING)) != 0U);
+
+			thread->no_wake_on_timeout = false;
+			if (!killed) {
+				if (thread->base.pended_on != NULL) {
+					unpend_thread_no_timeout(thread);
+				}
+				z_mark_thread_as_started(thread);
+				if (ready_thread_batched(thread)) {
+					ipi_mask |= ipi_mask_create(thread);
+					readied = true;
+				}
+			}
+			thread = next;
+		}
+
+		if (readied) {
+			update_cache(0);
+			flag_ipi(ipi_mask);
+		}
+	}
+}
+#endif
+
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
 {
@@ -1929,6 +2388,40 @@ int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 	return ret;
 }
 
+#ifdef CONFIG_IRQ_THREAD
+void z_sched_irq_thread_wait(atomic_t *pending, _wait_q_t *wait_q)
+{
+	k_spinlock_key_t key = k_spin_lock(&sched_spinlock);
+
+	if (atomic_get(pending) != 0) {
+		k_spin_unlock(&sched_spinlock, key);
+		return;
+	}
+
+	/* Pended on its own wait queue, so that only its waker readies it and
+	 * k_thread_suspend() still applies on top.
+	 */
+	pend_locked(_current, wait_q, K_FOREVER);
+
+	(void)z_swap(&sched_spinlock, key);
+}
+
+void z_sched_irq_thread_wake(_wait_q_t *wait_q)
+{
+	k_spinlock_key_t key = k_spin_lock(&sched_spinlock);
+	struct k_thread *thread = _priq_wait_best(&wait_q->waitq);
+
+	if (thread != NULL) {
+		z_thread_return_value_set_with_data(thread, 0, NULL);
+		unpend_thread_no_timeout(thread);
+		ready_thread(thread);
+	}
+
+	/* From an ISR, the switch happens on interrupt exit */
+	z_reschedule(&sched_spinlock, key);
+}
+#endif /* CONFIG_IRQ_THREAD */
+
 int z_sched_waitq_walk(_wait_q_t  *wait_q,
 		       int (*func)(struct k_thread *, void *), void *data)
 {
@@ -518,6 +518,9 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 	new_thread->stack_info.delta = delta;
 #endif
 	stack_ptr -= delta;
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	new_thread->stack_info.watermark = (uintptr_t)stack_ptr;
+#endif
 
 	return stack_ptr;
 }
@@ -545,6 +548,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	z_object_init(stack);
 	new_thread->stack_obj = stack;
 	new_thread->syscall_frame = NULL;
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	(void)memset(new_thread->obj_cache, 0, sizeof(new_thread->obj_cache));
+#endif
 
 	/* Any given thread has access to itself */
 	k_object_access_grant(new_thread, new_thread);
@@ -636,6 +642,13 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	new_thread->base.usage.track_usage =
 		CONFIG_SCHED_THREAD_USAGE_AUTO_ENABLE;
 #endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	new_thread->base.latency = (struct k_sched_latency_stats) {};
+	new_thread->base.latency_state = 0;
+#endif
+#ifdef CONFIG_SYS_PERF_THREAD
+	new_thread->perf = (struct sys_perf_counters) {};
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, create, new_thread);
 
@@ -814,6 +827,15 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 	thread_base->slice_expired = NULL;
 #endif
 
+#ifdef CONFIG_TIMER_SLACK
+	thread_base->timer_slack = 0;
+#endif
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	/* No server and no statistics left from a previous thread */
+	(void)memset(&thread_base->cbs, 0, sizeof(thread_base->cbs));
+#endif
+
 	/* swap_data does not need to be initialized */
 
 	z_init_thread_timeout(thread_base);
@@ -1026,6 +1048,20 @@ int z_vrfy_k_thread_stack_space_get(const struct k_thread *thread,
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_INIT_STACKS && CONFIG_THREAD_STACK_INFO */
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+int k_thread_stack_watermark_get(const struct k_thread *thread, size_t *unused_ptr)
+{
+	/* Dummy threads have no stack */
+	if (thread->stack_info.watermark == 0U) {
+		return -EINVAL;
+	}
+
+	*unused_ptr = thread->stack_info.watermark - thread->stack_info.start;
+
+	return 0;
+}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 #ifdef CONFIG_USERSPACE
 static inline k_ticks_t z_vrfy_k_thread_timeout_remaining_ticks(
 						    const struct k_thread *t)
@@ -1047,9 +1083,18 @@ static inline k_ticks_t z_vrfy_k_thread_timeout_expires_ticks(
 #ifdef CONFIG_INSTRUMENT_THREAD_SWITCHING
 void z_thread_mark_switched_in(void)
 {
+#if defined(CONFIG_SCHED_DEADLINE_CBS) && !defined(CONFIG_USE_SWITCH)
+	z_sched_cbs_switch(_current);
+#endif
 #if defined(CONFIG_SCHED_THREAD_USAGE) && !defined(CONFIG_USE_SWITCH)
 	z_sched_usage_start(_current);
 #endif
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) && !defined(CONFIG_USE_SWITCH)
+	z_sched_latency_switched_in(_current);
+#endif
+#if defined(CONFIG_SYS_PERF_THREAD) && !defined(CONFIG_USE_SWITCH)
+	z_sys_perf_switch(NULL, _current);
+#endif
 
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
@@ -1058,6 +1103,12 @@ void z_thread_mark_switched_in(void)
 
 void z_thread_mark_switched_out(void)
 {
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) && !defined(CONFIG_USE_SWITCH)
+	z_sched_latency_switched_out(_current);
+#endif
+#if defined(CONFIG_SYS_PERF_THREAD) && !defined(CONFIG_USE_SWITCH)
+	z_sys_perf_switch(_current, NULL);
+#endif
 #if defined(CONFIG_SCHED_THREAD_USAGE) && !defined(CONFIG_USE_SWITCH)
 	z_sched_usage_stop();
 #endif
@@ -1087,6 +1138,11 @@ int k_thread_runtime_stats_get(k_tid_t thread,
 	*stats = (k_thread_runtime_stats_t) {};
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	stats->deadline_misses = thread->base.cbs.deadline_misses;
+	stats->budget_overruns = thread->base.cbs.overruns;
+#endif
+
 	return 0;
 }
 
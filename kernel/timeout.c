@@ -11,13 +11,20 @@
 #include <zephyr/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/seqlock.h>
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 static struct k_spinlock timeout_lock;
 
+/* Lets sys_clock_tick_get() read curr_tick without timeout_lock.  Only
+ * written with timeout_lock held, with one write section per locked
+ * region of sys_clock_announce(), so readers see exactly the states a
+ * timeout_lock holder would.
+ */
+static struct sys_seqlock tick_seq;
+
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
 		  ? K_TICKS_FOREVER : INT_MAX)
 
@@ -36,29 +43,412 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
-static struct _timeout *first(void)
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/*
+ * Hierarchical timing wheel.
+ *
+ * Each level holds WHEEL_SLOTS buckets, level N covering
+ * WHEEL_SLOTS^N ticks per bucket.  A timeout is stored with its
+ * absolute expiry tick in dticks and lives at the level of the most
+ * significant "digit" in which its expiry differs from q->tick, so
+ * every timeout on level N shares all digits above N with q->tick
+ * and has a greater digit N.  Whenever q->tick moves into a new
+ * bucket on level N, that bucket is cascaded into the lower levels.
+ * Expiries too far ahead for the wheel go to an overflow list that is
+ * re-sorted when q->tick crosses the wheel's full range.
+ *
+ * This makes insertion and removal O(1).  The earliest timeout is
+ * always found in the first non-empty bucket of the lowest populated
+ * level and is cached, so next_timeout() stays exact for tickless
+ * idle.
+ */
+#define WHEEL_BITS   5
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+BUILD_ASSERT(WHEEL_BITS * WHEEL_LEVELS < 31,
+	     "timeout wheel range must fit in a signed 32 bit delta");
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+struct timeout_q {
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	struct k_spinlock lock;
+#endif
+	/* Tick the queue contents are relative to, tracks curr_tick */
+	uint64_t tick;
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+	/* Bucket occupancy per level, a bucket is only valid if its bit is set */
+	uint32_t map[WHEEL_LEVELS];
+	sys_dlist_t overflow;
+	/* Cached earliest expiry tick, UINT64_MAX if the wheel is empty */
+	uint64_t next;
+	bool next_valid;
+#else
+	sys_dlist_t list;
+#endif
+};
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+#define TIMEOUT_Q_INIT(i, _)						\
+	{								\
+		.overflow = SYS_DLIST_STATIC_INIT(&timeout_qs[i].overflow),	\
+		.next = UINT64_MAX,					\
+		.next_valid = true,					\
+	}
+#else
+#define TIMEOUT_Q_INIT(i, _)						\
+	{								\
+		.list = SYS_DLIST_STATIC_INIT(&timeout_qs[i].list),	\
+	}
+#endif
+
+#ifdef CONFIG_TIMEOUT_PER_CPU
+#define NUM_TIMEOUT_QS CONFIG_MP_MAX_NUM_CPUS
+#else
+#define NUM_TIMEOUT_QS 1
+#endif
+
+static struct timeout_q timeout_qs[NUM_TIMEOUT_QS] __hot_data = {
+	LISTIFY(NUM_TIMEOUT_QS, TIMEOUT_Q_INIT, (,))
+};
+
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+static inline uint64_t wheel_expiry(struct timeout_q *q,
+				    const struct _timeout *t)
+{
+	/* dticks may be truncated to 32 bits, rebuild it around q->tick */
+	return q->tick + (k_ticks_t)((uint64_t)t->dticks - q->tick);
+}
+
+static inline uint32_t wheel_digit(uint64_t tick, int level)
+{
+	return (uint32_t)(tick >> (level * WHEEL_BITS)) & WHEEL_MASK;
+}
+
+/* Returns the level a given expiry belongs to, WHEEL_LEVELS for overflow */
+static int wheel_level(struct timeout_q *q, uint64_t expiry)
 {
-	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
+	uint64_t diff = expiry ^ q->tick;
+
+	if (diff == 0U) {
+		return 0;
+	}
+
+	return MIN((63 - u64_count_leading_zeros(diff)) / WHEEL_BITS,
+		   WHEEL_LEVELS);
+}
+
+static void wheel_place(struct timeout_q *q, struct _timeout *t)
+{
+	uint64_t expiry = wheel_expiry(q, t);
+	int level = wheel_level(q, expiry);
+	uint32_t idx;
+
+	if (level == WHEEL_LEVELS) {
+		sys_dlist_append(&q->overflow, &t->node);
+		return;
+	}
+
+	idx = wheel_digit(expiry, level);
+	if ((q->map[level] & BIT(idx)) == 0U) {
+		sys_dlist_init(&q->wheel[level][idx]);
+		q->map[level] |= BIT(idx);
+	}
+	sys_dlist_append(&q->wheel[level][idx], &t->node);
+}
+
+static uint64_t wheel_list_min(struct timeout_q *q, sys_dlist_t *list)
+{
+	uint64_t min = UINT64_MAX;
+	struct _timeout *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+		min = MIN(min, wheel_expiry(q, t));
+	}
+
+	return min;
+}
+
+static uint64_t wheel_find_next(struct timeout_q *q)
+{
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		uint32_t idx;
+
+		if (q->map[level] == 0U) {
+			continue;
+		}
+
+		idx = u32_count_trailing_zeros(q->map[level]);
+		if (level == 0) {
+			return (q->tick & ~(uint64_t)WHEEL_MASK) | idx;
+		}
+
+		return wheel_list_min(q, &q->wheel[level][idx]);
+	}
+
+	return wheel_list_min(q, &q->overflow);
+}
+
+static void wheel_move(sys_dlist_t *from, sys_dlist_t *to)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(from)) != NULL) {
+		sys_dlist_append(to, node);
+	}
+}
+
+static void wheel_cascade(struct timeout_q *q, sys_dlist_t *list)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		wheel_place(q, CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+static k_ticks_t q_next(struct timeout_q *q)
+{
+	if (!q->next_valid) {
+		q->next = wheel_find_next(q);
+		q->next_valid = true;
+	}
+
+	return q->next == UINT64_MAX ? -1 : (k_ticks_t)(q->next - q->tick);
+}
+
+/* Returns true if the new timeout is now the earliest one */
+static bool q_insert(struct timeout_q *q, struct _timeout *to,
+		     k_ticks_t ticks)
+{
+	uint64_t expiry = q->tick + MAX(0, ticks);
+
+	to->dticks = (k_ticks_t)expiry;
+	wheel_place(q, to);
+
+	if (!q->next_valid) {
+		return true;
+	}
+	if (expiry < q->next) {
+		q->next = expiry;
+		return true;
+	}
+
+	return false;
+}
+
+static void q_remove(struct timeout_q *q, struct _timeout *t)
+{
+	uint64_t expiry = wheel_expiry(q, t);
+	int level = wheel_level(q, expiry);
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS) {
+		uint32_t idx = wheel_digit(expiry, level);
+
+		if (sys_dlist_is_empty(&q->wheel[level][idx])) {
+			q->map[level] &= ~BIT(idx);
+		}
+	}
+
+	if (expiry == q->next) {
+		q->next_valid = false;
+	}
+}
+
+static k_ticks_t q_ticks(struct timeout_q *q, const struct _timeout *t)
+{
+	return (k_ticks_t)(wheel_expiry(q, t) - q->tick);
+}
+
+/* Moves q->tick forward by at most the distance to the next expiry */
+static void q_advance(struct timeout_q *q, k_ticks_t dt)
+{
+	uint64_t prev = q->tick;
+
+	q->tick += dt;
+
+	if ((prev >> (WHEEL_LEVELS * WHEEL_BITS)) !=
+	    (q->tick >> (WHEEL_LEVELS * WHEEL_BITS))) {
+		sys_dlist_t list;
+
+		sys_dlist_init(&list);
+		wheel_move(&q->overflow, &list);
+		wheel_cascade(q, &list);
+	}
+
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		uint32_t idx = wheel_digit(q->tick, level);
+
+		if ((prev >> (level * WHEEL_BITS)) ==
+		    (q->tick >> (level * WHEEL_BITS))) {
+			continue;
+		}
+
+		if ((q->map[level] & BIT(idx)) != 0U) {
+			q->map[level] &= ~BIT(idx);
+			wheel_cascade(q, &q->wheel[level][idx]);
+		}
+	}
+}
+
+/* Pops a timeout expiring at q->tick, if any */
+static struct _timeout *q_pop_expired(struct timeout_q *q)
+{
+	uint32_t idx = wheel_digit(q->tick, 0);
+	sys_dnode_t *node;
+
+	if ((q->map[0] & BIT(idx)) == 0U) {
+		return NULL;
+	}
+
+	node = sys_dlist_get(&q->wheel[0][idx]);
+	if (sys_dlist_is_empty(&q->wheel[0][idx])) {
+		q->map[0] &= ~BIT(idx);
+	}
+	q->next_valid = false;
+
+	return CONTAINER_OF(node, struct _timeout, node);
+}
+
+#ifdef CONFIG_ZTEST
+/* Re-files all pending timeouts relative to a new q->tick */
+static void q_set_tick(struct timeout_q *q, uint64_t tick)
+{
+	sys_dlist_t list;
+	struct _timeout *t;
+
+	sys_dlist_init(&list);
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		while (q->map[level] != 0U) {
+			uint32_t idx = u32_count_trailing_zeros(q->map[level]);
+
+			q->map[level] &= ~BIT(idx);
+			wheel_move(&q->wheel[level][idx], &list);
+		}
+	}
+	wheel_move(&q->overflow, &list);
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&list, t, node) {
+		t->dticks = (k_ticks_t)(tick + q_ticks(q, t));
+	}
+
+	q->tick = tick;
+	q->next_valid = false;
+	wheel_cascade(q, &list);
+}
+#endif /* CONFIG_ZTEST */
+
+#else /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+static struct _timeout *first(struct timeout_q *q)
+{
+	sys_dnode_t *t = sys_dlist_peek_head(&q->list);
 
 	return t == NULL ? NULL : CONTAINER_OF(t, struct _timeout, node);
 }
 
-static struct _timeout *next(struct _timeout *t)
+static struct _timeout *next(struct timeout_q *q, struct _timeout *t)
 {
-	sys_dnode_t *n = sys_dlist_peek_next(&timeout_list, &t->node);
+	sys_dnode_t *n = sys_dlist_peek_next(&q->list, &t->node);
 
 	return n == NULL ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
-static void remove_timeout(struct _timeout *t)
+static k_ticks_t q_next(struct timeout_q *q)
+{
+	struct _timeout *to = first(q);
+
+	return to == NULL ? -1 : to->dticks;
+}
+
+/* Returns true if the new timeout is now the earliest one */
+static bool q_insert(struct timeout_q *q, struct _timeout *to,
+		     k_ticks_t ticks)
 {
-	if (next(t) != NULL) {
-		next(t)->dticks += t->dticks;
+	struct _timeout *t;
+
+	to->dticks = ticks;
+
+	for (t = first(q); t != NULL; t = next(q, t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&q->list, &to->node);
+	}
+
+	return to == first(q);
+}
+
+static void q_remove(struct timeout_q *q, struct _timeout *t)
+{
+	if (next(q, t) != NULL) {
+		next(q, t)->dticks += t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
 }
 
+static k_ticks_t q_ticks(struct timeout_q *q, const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(q); t != NULL; t = next(q, t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+/* Moves q->tick forward by at most the distance to the next expiry */
+static void q_advance(struct timeout_q *q, k_ticks_t dt)
+{
+	struct _timeout *t = first(q);
+
+	if (t != NULL) {
+		t->dticks -= dt;
+	}
+	q->tick += dt;
+}
+
+/* Pops a timeout expiring at q->tick, if any */
+static struct _timeout *q_pop_expired(struct timeout_q *q)
+{
+	struct _timeout *t = first(q);
+
+	if ((t == NULL) || (t->dticks > 0)) {
+		return NULL;
+	}
+
+	q_remove(q, t);
+
+	return t;
+}
+
+#ifdef CONFIG_ZTEST
+static void q_set_tick(struct timeout_q *q, uint64_t tick)
+{
+	q->tick = tick;
+}
+#endif /* CONFIG_ZTEST */
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -80,25 +470,200 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
+#ifdef CONFIG_TIMEOUT_PER_CPU
+/*
+ * Each CPU files the timeouts it arms on its own queue under its own
+ * lock, so arming and aborting timeouts on different CPUs does not
+ * contend.  Anything looking at all queues at once (expiry
+ * processing, timer programming) takes timeout_lock first and then
+ * every queue lock in index order.  announce_remaining is only
+ * written with all of those held, so queue lock holders can read it
+ * for the elapsed() check.
+ */
+static inline struct timeout_q *local_q(void)
+{
+	/* Migrating right after this is harmless, any queue will do */
+	return &timeout_qs[arch_curr_cpu()->id];
+}
+
+static inline k_spinlock_key_t q_lock(struct timeout_q *q)
+{
+	return k_spin_lock(&q->lock);
+}
+
+static inline void q_unlock(struct timeout_q *q, k_spinlock_key_t key)
+{
+	k_spin_unlock(&q->lock, key);
+}
+
+/* Locks the queue a timeout is filed on, which may change until locked */
+static struct timeout_q *timeout_q_lock(const struct _timeout *to,
+					k_spinlock_key_t *key)
+{
+	struct timeout_q *q;
+
+	do {
+		q = &timeout_qs[to->cpu];
+		*key = q_lock(q);
+		if (q == &timeout_qs[to->cpu]) {
+			break;
+		}
+		q_unlock(q, *key);
+	} while (true);
+
+	return q;
+}
+
+/* Must hold timeout_lock */
+static void all_q_lock(k_spinlock_key_t *keys)
+{
+	for (int i = 0; i < NUM_TIMEOUT_QS; i++) {
+		keys[i] = q_lock(&timeout_qs[i]);
+	}
+}
+
+static void all_q_unlock(k_spinlock_key_t *keys)
+{
+	for (int i = NUM_TIMEOUT_QS - 1; i >= 0; i--) {
+		q_unlock(&timeout_qs[i], keys[i]);
+	}
+}
+#else
+static inline struct timeout_q *local_q(void)
+{
+	return &timeout_qs[0];
+}
+
+static inline k_spinlock_key_t q_lock(struct timeout_q *q)
+{
+	ARG_UNUSED(q);
+
+	return k_spin_lock(&timeout_lock);
+}
+
+static inline void q_unlock(struct timeout_q *q, k_spinlock_key_t key)
+{
+	ARG_UNUSED(q);
+
+	k_spin_unlock(&timeout_lock, key);
+}
+
+static struct timeout_q *timeout_q_lock(const struct _timeout *to,
+					k_spinlock_key_t *key)
+{
+	ARG_UNUSED(to);
+
+	*key = k_spin_lock(&timeout_lock);
+
+	return &timeout_qs[0];
+}
+
+/* The only queue is protected by timeout_lock itself */
+static inline void all_q_lock(k_spinlock_key_t *keys)
+{
+	ARG_UNUSED(keys);
+}
+
+static inline void all_q_unlock(k_spinlock_key_t *keys)
+{
+	ARG_UNUSED(keys);
+}
+#endif /* CONFIG_TIMEOUT_PER_CPU */
+
+/* Returns the queue holding the earliest timeout, all queues locked */
+static struct timeout_q *first_q(k_ticks_t *ticks)
+{
+	struct timeout_q *first = NULL;
+
+	*ticks = -1;
+	for (int i = 0; i < NUM_TIMEOUT_QS; i++) {
+		k_ticks_t dt = q_next(&timeout_qs[i]);
+
+		if ((dt >= 0) && ((first == NULL) || (dt < *ticks))) {
+			first = &timeout_qs[i];
+			*ticks = dt;
+		}
+	}
+
+	return first;
+}
+
+/* All queues locked */
 static int32_t next_timeout(void)
 {
-	struct _timeout *to = first();
+	k_ticks_t ticks;
 	int32_t ticks_elapsed = elapsed();
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	(void)first_q(&ticks);
+
+	if ((ticks < 0) ||
+	    ((int64_t)(ticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, ticks - ticks_elapsed);
 	}
 
 	return ret;
 }
 
+#ifdef CONFIG_TIMEOUT_PER_CPU
+static void reprogram_timeout(void)
+{
+	k_spinlock_key_t keys[NUM_TIMEOUT_QS];
+
+	K_SPINLOCK(&timeout_lock) {
+		all_q_lock(keys);
+		sys_clock_set_timeout(next_timeout(), false);
+		all_q_unlock(keys);
+	}
+}
+#endif
+
+#ifdef CONFIG_TIMER_SLACK
+/* Delay an expiry, relative to the queue tick, by up to slack ticks so
+ * that it coalesces with other timeouts.
+ *
+ * The expiry is aligned with the next expiry of the queue if that falls
+ * within the slack window.  Otherwise it is rounded up to a multiple of
+ * the largest power of two not above the slack, so that timeouts with
+ * similar slacks expire on the same ticks.
+ */
+static k_ticks_t apply_slack(struct timeout_q *q, k_ticks_t ticks,
+			     k_ticks_t slack)
+{
+	k_ticks_t next = q_next(q);
+	uint64_t granule, expiry;
+
+	if (slack <= 0) {
+		return ticks;
+	}
+
+	if ((next >= ticks) && (next - ticks <= slack)) {
+		return next;
+	}
+
+	granule = BIT64(63 - __builtin_clzll((uint64_t)slack));
+	expiry = ROUND_UP(q->tick + ticks, granule);
+
+	return (k_ticks_t)(expiry - q->tick);
+}
+#endif /* CONFIG_TIMER_SLACK */
+
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout)
 {
+	z_add_timeout_slack(to, fn, timeout, 0);
+}
+
+void z_add_timeout_slack(struct _timeout *to, _timeout_func_t fn,
+			 k_timeout_t timeout, k_ticks_t slack)
+{
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	k_ticks_t ticks;
+	bool first;
+
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		return;
 	}
@@ -110,105 +675,122 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 
-	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+	q = local_q();
+	key = q_lock(q);
 
-		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
-		    Z_TICK_ABS(timeout.ticks) >= 0) {
-			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	to->cpu = q - timeout_qs;
+#endif
 
-			to->dticks = MAX(1, ticks);
-		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
-		}
+	if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
+	    Z_TICK_ABS(timeout.ticks) >= 0) {
+		ticks = MAX(1, Z_TICK_ABS(timeout.ticks) - q->tick);
+	} else {
+		ticks = timeout.ticks + 1 + elapsed();
+	}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
+#ifdef CONFIG_TIMER_SLACK
+	ticks = apply_slack(q, ticks, slack);
+#else
+	ARG_UNUSED(slack);
+#endif
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+	first = q_insert(q, to, ticks);
 
-		if (to == first()) {
-			sys_clock_set_timeout(next_timeout(), false);
-		}
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* The timer is programmed for all queues, outside our queue lock */
+	q_unlock(q, key);
+	if (first) {
+		reprogram_timeout();
+	}
+#else
+	if (first) {
+		sys_clock_set_timeout(next_timeout(), false);
 	}
+	q_unlock(q, key);
+#endif
 }
 
 int z_abort_timeout(struct _timeout *to)
 {
+	struct timeout_q *q;
+	k_spinlock_key_t key;
 	int ret = -EINVAL;
 
-	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
-			remove_timeout(to);
-			ret = 0;
-		}
+	q = timeout_q_lock(to, &key);
+	if (sys_dnode_is_linked(&to->node)) {
+		q_remove(q, to);
+		ret = 0;
 	}
+	q_unlock(q, key);
 
 	return ret;
 }
 
 /* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
+static k_ticks_t timeout_rem(struct timeout_q *q,
+			     const struct _timeout *timeout)
 {
-	k_ticks_t ticks = 0;
-
 	if (z_is_inactive_timeout(timeout)) {
 		return 0;
 	}
 
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks - elapsed();
+	return q_ticks(q, timeout) - elapsed();
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
-	k_ticks_t ticks = 0;
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	k_ticks_t ticks;
 
-	K_SPINLOCK(&timeout_lock) {
-		ticks = timeout_rem(timeout);
-	}
+	q = timeout_q_lock(timeout, &key);
+	ticks = timeout_rem(q, timeout);
+	q_unlock(q, key);
 
 	return ticks;
 }
 
 k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 {
-	k_ticks_t ticks = 0;
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	k_ticks_t ticks;
 
-	K_SPINLOCK(&timeout_lock) {
-		ticks = curr_tick + timeout_rem(timeout);
-	}
+	q = timeout_q_lock(timeout, &key);
+	ticks = q->tick + timeout_rem(q, timeout);
+	q_unlock(q, key);
 
 	return ticks;
 }
 
 int32_t z_get_next_timeout_expiry(void)
 {
+	k_spinlock_key_t keys[NUM_TIMEOUT_QS];
 	int32_t ret = (int32_t) K_TICKS_FOREVER;
 
 	K_SPINLOCK(&timeout_lock) {
+		all_q_lock(keys);
 		ret = next_timeout();
+		all_q_unlock(keys);
 	}
 	return ret;
 }
 
-void sys_clock_announce(int32_t ticks)
+static void advance(k_ticks_t dt)
+{
+	for (int i = 0; i < NUM_TIMEOUT_QS; i++) {
+		q_advance(&timeout_qs[i], dt);
+	}
+	curr_tick += dt;
+}
+
+__hot_code void sys_clock_announce(int32_t ticks)
 {
+	k_spinlock_key_t keys[NUM_TIMEOUT_QS];
 	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+	struct timeout_q *q;
+	k_ticks_t dt;
 
 	/* We release the lock around the callbacks below, so on SMP
 	 * systems someone might be already running the loop.  Don't
@@ -216,40 +798,43 @@ void sys_clock_announce(int32_t ticks)
 	 * timeouts and confuse apps), just increment the tick count
 	 * and return.
 	 */
+	all_q_lock(keys);
 	if (IS_ENABLED(CONFIG_SMP) && (announce_remaining != 0)) {
 		announce_remaining += ticks;
+		all_q_unlock(keys);
 		k_spin_unlock(&timeout_lock, key);
 		return;
 	}
 
+	sys_seqlock_write_begin(&tick_seq);
 	announce_remaining = ticks;
 
-	struct _timeout *t = first();
-
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
+	for (q = first_q(&dt);
+	     (q != NULL) && (dt <= announce_remaining);
+	     q = first_q(&dt)) {
+		struct _timeout *t;
 
-		curr_tick += dt;
+		advance(dt);
+		t = q_pop_expired(q);
 		t->dticks = 0;
-		remove_timeout(t);
 
+		sys_seqlock_write_end(&tick_seq);
+		all_q_unlock(keys);
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
 		key = k_spin_lock(&timeout_lock);
+		all_q_lock(keys);
+		sys_seqlock_write_begin(&tick_seq);
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
-
-	curr_tick += announce_remaining;
+	advance(announce_remaining);
 	announce_remaining = 0;
+	sys_seqlock_write_end(&tick_seq);
 
 	sys_clock_set_timeout(next_timeout(), false);
 
+	all_q_unlock(keys);
 	k_spin_unlock(&timeout_lock, key);
 
 #ifdef CONFIG_TIMESLICING
@@ -259,11 +844,22 @@ void sys_clock_announce(int32_t ticks)
 
 int64_t sys_clock_tick_get(void)
 {
-	uint64_t t = 0U;
+	uint64_t t;
+	uint32_t seq;
 
-	K_SPINLOCK(&timeout_lock) {
+	/* The driver is still queried with interrupts masked: that is
+	 * all the locking it needs against its own ISR on this CPU, and
+	 * drivers for SMP systems lock their own state.
+	 */
+	do {
+		unsigned int key;
+
+		seq = sys_seqlock_read_begin(&tick_seq);
+		key = arch_irq_lock();
 		t = curr_tick + elapsed();
-	}
+		arch_irq_unlock(key);
+	} while (sys_seqlock_read_retry(&tick_seq, seq));
+
 	return t;
 }
 
@@ -329,7 +925,18 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
-	curr_tick = tick;
+	k_spinlock_key_t keys[NUM_TIMEOUT_QS];
+
+	K_SPINLOCK(&timeout_lock) {
+		all_q_lock(keys);
+		for (int i = 0; i < NUM_TIMEOUT_QS; i++) {
+			q_set_tick(&timeout_qs[i], tick);
+		}
+		sys_seqlock_write_begin(&tick_seq);
+		curr_tick = tick;
+		sys_seqlock_write_end(&tick_seq);
+		all_q_unlock(keys);
+	}
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
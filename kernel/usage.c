@@ -9,6 +9,7 @@
 #include <zephyr/timing/timing.h>
 #include <ksched.h>
 #include <zephyr/spinlock.h>
+#include <zephyr/sys/seqlock.h>
 #include <zephyr/sys/check.h>
 
 /* Need one of these for this to work */
@@ -16,7 +17,11 @@
 #error "No data backend configured for CONFIG_SCHED_THREAD_USAGE"
 #endif
 
-static struct k_spinlock usage_lock;
+/* Writers update the usage counters under the write lock; reading
+ * another thread's or another CPU's counters is only a copy and does
+ * not need to stop them.
+ */
+static struct sys_seqlock usage_seq;
 
 static uint32_t usage_now(void)
 {
@@ -76,7 +81,7 @@ void z_sched_usage_start(struct k_thread *thread)
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	k_spinlock_key_t  key;
 
-	key = k_spin_lock(&usage_lock);
+	key = sys_seqlock_write_lock(&usage_seq);
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
 
@@ -85,7 +90,7 @@ void z_sched_usage_start(struct k_thread *thread)
 		thread->base.usage.current = 0;
 	}
 
-	k_spin_unlock(&usage_lock, key);
+	sys_seqlock_write_unlock(&usage_seq, key);
 #else
 	/* One write through a volatile pointer doesn't require
 	 * synchronization as long as _usage() treats it as volatile
@@ -98,7 +103,7 @@ void z_sched_usage_start(struct k_thread *thread)
 
 void z_sched_usage_stop(void)
 {
-	k_spinlock_key_t k   = k_spin_lock(&usage_lock);
+	k_spinlock_key_t k   = sys_seqlock_write_lock(&usage_seq);
 
 	struct _cpu     *cpu = _current_cpu;
 
@@ -115,114 +120,265 @@ void z_sched_usage_stop(void)
 	}
 
 	cpu->usage0 = 0;
-	k_spin_unlock(&usage_lock, k);
+	sys_seqlock_write_unlock(&usage_seq, k);
 }
 
-#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
-void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
+/*
+ * Bring the stats of this CPU and of the thread running on it up to
+ * date, restarting the current usage window at the present time.
+ */
+static void sched_current_update_usage(struct _cpu *cpu)
 {
-	k_spinlock_key_t  key;
-	struct _cpu *cpu;
+	uint32_t now = usage_now();
+	uint32_t cycles = now - cpu->usage0;
 
-	key = k_spin_lock(&usage_lock);
-	cpu = _current_cpu;
+	if (cpu->current->base.usage.track_usage) {
+		sched_thread_update_usage(cpu->current, cycles);
+	}
 
+	sched_cpu_update_usage(cpu, cycles);
 
-	if (&_kernel.cpus[cpu_id] == cpu) {
-		uint32_t  now = usage_now();
-		uint32_t cycles = now - cpu->usage0;
+	cpu->usage0 = now;
+}
 
-		/*
-		 * Getting stats for the current CPU. Update both its
-		 * current thread stats and the CPU stats as the CPU's
-		 * [usage0] field will also get updated. This keeps all
-		 * that information up-to-date.
-		 */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+/* What the thread is doing since [latency_start] */
+enum {
+	LATENCY_NONE,           /* running, or not tracked */
+	LATENCY_READY,
+	LATENCY_PREEMPTED,
+	LATENCY_BLOCKED,        /* + enum k_sched_wait_type */
+};
 
-		if (cpu->current->base.usage.track_usage) {
-			sched_thread_update_usage(cpu->current, cycles);
-		}
+static bool latency_tracked(struct k_thread *thread)
+{
+	return thread->base.usage.track_usage &&
+	       !z_is_idle_thread_object(thread) &&
+	       !z_is_thread_state_set(thread, _THREAD_DUMMY);
+}
 
-		sched_cpu_update_usage(cpu, cycles);
+static void latency_record(uint32_t *histogram, uint32_t start, uint32_t now)
+{
+	uint32_t cycles = (now - start) >> CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT;
+	unsigned int bucket = (cycles == 0U) ? 0U : (LOG2(cycles) + 1U);
+
+	histogram[MIN(bucket, CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS - 1U)]++;
+}
+
+void z_sched_latency_ready(struct k_thread *thread)
+{
+	k_spinlock_key_t key;
+	uint8_t state;
+	uint32_t now;
 
-		cpu->usage0 = now;
+	if (!latency_tracked(thread)) {
+		return;
+	}
+
+	key = sys_seqlock_write_lock(&usage_seq);
+
+	now = usage_now();
+	state = thread->base.latency_state;
+
+	if (state >= LATENCY_BLOCKED) {
+		latency_record(thread->base.latency.blocked[state - LATENCY_BLOCKED],
+			       thread->base.latency_start, now);
+	}
+
+	/* A ready or preempted thread which was suspended and resumed
+	 * starts waiting again from now.
+	 */
+	thread->base.latency_state = LATENCY_READY;
+	thread->base.latency_start = now;
+
+	sys_seqlock_write_unlock(&usage_seq, key);
+}
+
+void z_sched_latency_switched_out(struct k_thread *thread)
+{
+	k_spinlock_key_t key;
+	uint8_t state;
+
+	if (!latency_tracked(thread)) {
+		return;
 	}
 
+	if (z_is_thread_queued(thread)) {
+		state = LATENCY_PREEMPTED;
+	} else if (z_is_thread_pending(thread)) {
+		state = LATENCY_BLOCKED + K_SCHED_WAIT_OBJECT;
+	} else if (z_is_thread_suspended(thread)) {
+		state = LATENCY_BLOCKED + (z_is_thread_timeout_active(thread) ?
+					   K_SCHED_WAIT_SLEEP : K_SCHED_WAIT_SUSPEND);
+	} else {
+		/* Aborted */
+		state = LATENCY_NONE;
+	}
+
+	key = sys_seqlock_write_lock(&usage_seq);
+
+	thread->base.latency_state = state;
+	thread->base.latency_start = usage_now();
+
+	sys_seqlock_write_unlock(&usage_seq, key);
+}
+
+void z_sched_latency_switched_in(struct k_thread *thread)
+{
+	k_spinlock_key_t key;
+	uint8_t state;
+
+	if (!latency_tracked(thread)) {
+		return;
+	}
+
+	key = sys_seqlock_write_lock(&usage_seq);
+
+	state = thread->base.latency_state;
+
+	if (state == LATENCY_READY) {
+		latency_record(thread->base.latency.ready,
+			       thread->base.latency_start, usage_now());
+	} else if (state == LATENCY_PREEMPTED) {
+		latency_record(thread->base.latency.preempted,
+			       thread->base.latency_start, usage_now());
+	}
+
+	thread->base.latency_state = LATENCY_NONE;
+
+	sys_seqlock_write_unlock(&usage_seq, key);
+}
+#endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+static void sched_cpu_copy_usage(struct _cpu *cpu,
+				 struct k_thread_runtime_stats *stats)
+{
 	stats->total_cycles     = cpu->usage.total;
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+	/* Read once: a racing writer may change it under a reader */
+	uint32_t num_windows = cpu->usage.num_windows;
+
 	stats->current_cycles   = cpu->usage.current;
 	stats->peak_cycles      = cpu->usage.longest;
 
-	if (cpu->usage.num_windows == 0) {
+	if (num_windows == 0) {
 		stats->average_cycles = 0;
 	} else {
-		stats->average_cycles = stats->total_cycles /
-					cpu->usage.num_windows;
+		stats->average_cycles = stats->total_cycles / num_windows;
 	}
 #endif
 
-	stats->idle_cycles =
-		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
+	stats->idle_cycles = cpu->idle_thread->base.usage.total;
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
-
-	k_spin_unlock(&usage_lock, key);
 }
-#endif
 
-void z_sched_thread_usage(struct k_thread *thread,
-			  struct k_thread_runtime_stats *stats)
+static bool cpu_is_local(struct _cpu *cpu)
 {
-	struct _cpu *cpu;
-	k_spinlock_key_t  key;
+	unsigned int key = arch_irq_lock();
+	bool local = (_current_cpu == cpu);
 
-	key = k_spin_lock(&usage_lock);
-	cpu = _current_cpu;
+	arch_irq_unlock(key);
 
+	return local;
+}
 
-	if (thread == cpu->current) {
-		uint32_t now = usage_now();
-		uint32_t cycles = now - cpu->usage0;
+void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
+{
+	struct _cpu *cpu = &_kernel.cpus[cpu_id];
+	k_spinlock_key_t  key;
+	uint32_t seq;
+
+	if (cpu_is_local(cpu)) {
+		key = sys_seqlock_write_lock(&usage_seq);
 
 		/*
-		 * Getting stats for the current thread. Update both the
-		 * current thread stats and its CPU stats as the CPU's
+		 * Getting stats for the current CPU. Update both its
+		 * current thread stats and the CPU stats as the CPU's
 		 * [usage0] field will also get updated. This keeps all
-		 * that information up-to-date.
+		 * that information up-to-date.  We may have migrated
+		 * since the check, in which case this is a plain copy.
 		 */
 
-		if (thread->base.usage.track_usage) {
-			sched_thread_update_usage(thread, cycles);
+		if (cpu == _current_cpu) {
+			sched_current_update_usage(cpu);
 		}
 
-		sched_cpu_update_usage(cpu, cycles);
+		sched_cpu_copy_usage(cpu, stats);
 
-		cpu->usage0 = now;
+		sys_seqlock_write_unlock(&usage_seq, key);
+		return;
 	}
 
-	stats->execution_cycles = thread->base.usage.total;
-	stats->total_cycles     = thread->base.usage.total;
+	/* Another CPU's stats: copy them out without stopping it */
+	do {
+		seq = sys_seqlock_read_begin(&usage_seq);
+		sched_cpu_copy_usage(cpu, stats);
+	} while (sys_seqlock_read_retry(&usage_seq, seq));
+}
+#endif
 
-	/* Copy-out the thread's usage stats */
+static void sched_thread_copy_usage(struct k_thread *thread,
+				    struct k_thread_runtime_stats *stats)
+{
+	stats->execution_cycles = thread->base.usage.total;
+	stats->total_cycles     = stats->execution_cycles;
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+	/* Read once: a racing writer may change it under a reader */
+	uint32_t num_windows = thread->base.usage.num_windows;
+
 	stats->current_cycles = thread->base.usage.current;
 	stats->peak_cycles    = thread->base.usage.longest;
 
-	if (thread->base.usage.num_windows == 0) {
+	if (num_windows == 0) {
 		stats->average_cycles = 0;
 	} else {
-		stats->average_cycles = stats->total_cycles /
-					thread->base.usage.num_windows;
+		stats->average_cycles = stats->total_cycles / num_windows;
 	}
 #endif
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
 #endif
-	stats->execution_cycles = thread->base.usage.total;
 
-	k_spin_unlock(&usage_lock, key);
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	stats->latency = thread->base.latency;
+#endif
+}
+
+void z_sched_thread_usage(struct k_thread *thread,
+			  struct k_thread_runtime_stats *stats)
+{
+	k_spinlock_key_t  key;
+	uint32_t seq;
+
+	if (thread == _current) {
+		key = sys_seqlock_write_lock(&usage_seq);
+
+		/*
+		 * Getting stats for the current thread. Update both the
+		 * current thread stats and its CPU stats as the CPU's
+		 * [usage0] field will also get updated. This keeps all
+		 * that information up-to-date.
+		 */
+
+		sched_current_update_usage(_current_cpu);
+		sched_thread_copy_usage(thread, stats);
+
+		sys_seqlock_write_unlock(&usage_seq, key);
+		return;
+	}
+
+	/*
+	 * The thread is not running here, so there is nothing to
+	 * update: copy its stats out without stopping their writers.
+	 */
+	do {
+		seq = sys_seqlock_read_begin(&usage_seq);
+		sched_thread_copy_usage(thread, stats);
+	} while (sys_seqlock_read_retry(&usage_seq, seq));
 }
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -234,7 +390,7 @@ int k_thread_runtime_stats_enable(k_tid_t  thread)
 		return -EINVAL;
 	}
 
-	key = k_spin_lock(&usage_lock);
+	key = sys_seqlock_write_lock(&usage_seq);
 
 	if (!thread->base.usage.track_usage) {
 		thread->base.usage.track_usage = true;
@@ -242,7 +398,7 @@ int k_thread_runtime_stats_enable(k_tid_t  thread)
 		thread->base.usage.current = 0;
 	}
 
-	k_spin_unlock(&usage_lock, key);
+	sys_seqlock_write_unlock(&usage_seq, key);
 
 	return 0;
 }
@@ -255,7 +411,7 @@ int k_thread_runtime_stats_disable(k_tid_t  thread)
 		return -EINVAL;
 	}
 
-	key = k_spin_lock(&usage_lock);
+	key = sys_seqlock_write_lock(&usage_seq);
 	struct _cpu *cpu = _current_cpu;
 
 	if (thread->base.usage.track_usage) {
@@ -269,7 +425,7 @@ int k_thread_runtime_stats_disable(k_tid_t  thread)
 		}
 	}
 
-	k_spin_unlock(&usage_lock, key);
+	sys_seqlock_write_unlock(&usage_seq, key);
 
 	return 0;
 }
@@ -280,7 +436,7 @@ void k_sys_runtime_stats_enable(void)
 {
 	k_spinlock_key_t  key;
 
-	key = k_spin_lock(&usage_lock);
+	key = sys_seqlock_write_lock(&usage_seq);
 
 	if (_current_cpu->usage.track_usage) {
 
@@ -290,7 +446,7 @@ void k_sys_runtime_stats_enable(void)
 		 * nothing left to do.
 		 */
 
-		k_spin_unlock(&usage_lock, key);
+		sys_seqlock_write_unlock(&usage_seq, key);
 		return;
 	}
 
@@ -306,7 +462,7 @@ void k_sys_runtime_stats_enable(void)
 #endif
 	}
 
-	k_spin_unlock(&usage_lock, key);
+	sys_seqlock_write_unlock(&usage_seq, key);
 }
 
 void k_sys_runtime_stats_disable(void)
@@ -314,7 +470,7 @@ void k_sys_runtime_stats_disable(void)
 	struct _cpu *cpu;
 	k_spinlock_key_t key;
 
-	key = k_spin_lock(&usage_lock);
+	key = sys_seqlock_write_lock(&usage_seq);
 
 	if (!_current_cpu->usage.track_usage) {
 
@@ -324,7 +480,7 @@ void k_sys_runtime_stats_disable(void)
 		 * nothing left to do.
 		 */
 
-		k_spin_unlock(&usage_lock, key);
+		sys_seqlock_write_unlock(&usage_seq, key);
 		return;
 	}
 
@@ -340,6 +496,6 @@ void k_sys_runtime_stats_disable(void)
 		cpu->usage.track_usage = false;
 	}
 
-	k_spin_unlock(&usage_lock, key);
+	sys_seqlock_write_unlock(&usage_seq, key);
 }
 #endif
@@ -20,6 +20,7 @@
 #include <zephyr/app_memory/app_memdomain.h>
 #include <zephyr/sys/libc-hooks.h>
 #include <zephyr/sys/mutex.h>
+#include <zephyr/sys/seqlock.h>
 #include <inttypes.h>
 #include <zephyr/linker/linker-defs.h>
 
@@ -79,6 +80,45 @@ extern uint8_t _thread_idx_map[CONFIG_MAX_THREAD_BYTES];
 
 static void clear_perms_cb(struct z_object *ko, void *ctx_ptr);
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_USERSPACE_OBJ_CACHE_SIZE),
+	     "CONFIG_USERSPACE_OBJ_CACHE_SIZE must be a power of two");
+
+/* Generation of the object caches of all the threads, an entry is only
+ * valid if it was filled during the current generation. It is 64 bits
+ * wide so that it never wraps: user threads can bump it at will, and a
+ * wrapped generation would validate stale entries again.
+ */
+static uint64_t obj_cache_gen;
+static SYS_SEQLOCK_DEFINE(obj_cache_seqlock);
+
+/* Called whenever a validation which succeeded may now fail */
+static inline void obj_cache_invalidate(void)
+{
+	k_spinlock_key_t key = sys_seqlock_write_lock(&obj_cache_seqlock);
+
+	obj_cache_gen++;
+	sys_seqlock_write_unlock(&obj_cache_seqlock, key);
+}
+
+static inline uint64_t obj_cache_gen_get(void)
+{
+	uint64_t gen;
+	uint32_t seq;
+
+	do {
+		seq = sys_seqlock_read_begin(&obj_cache_seqlock);
+		gen = obj_cache_gen;
+	} while (sys_seqlock_read_retry(&obj_cache_seqlock, seq));
+
+	return gen;
+}
+#else
+static inline void obj_cache_invalidate(void)
+{
+}
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+
 const char *otype_to_str(enum k_objects otype)
 {
 	const char *ret;
@@ -177,15 +217,27 @@ extern struct z_object *z_object_gperf_find(const void *obj);
 extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 					     void *context);
 
-/*
- * Linked list of allocated kernel objects, for iteration over all allocated
- * objects (and potentially deleting them during iteration).
- */
-static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_DYNAMIC_OBJECTS_HASH_SIZE),
+	     "CONFIG_DYNAMIC_OBJECTS_HASH_SIZE must be a power of two");
+
+#define OBJ_BUCKET_INIT(i, _) SYS_DLIST_STATIC_INIT(&obj_table[i])
 
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Hash table of allocated kernel objects, indexed by their address, for
+ * finding them and for iteration over all allocated objects (and potentially
+ * deleting them during iteration).
  */
+static sys_dlist_t obj_table[CONFIG_DYNAMIC_OBJECTS_HASH_SIZE] = {
+	LISTIFY(CONFIG_DYNAMIC_OBJECTS_HASH_SIZE, OBJ_BUCKET_INIT, (,))
+};
+
+static sys_dlist_t *obj_bucket(const void *obj)
+{
+	/* Fibonacci hashing, the low bits of heap addresses are mostly 0 */
+	uint32_t hash = (uint32_t)POINTER_TO_UINT(obj) * 2654435769U;
+
+	return &obj_table[(hash >> 16) & (CONFIG_DYNAMIC_OBJECTS_HASH_SIZE - 1)];
+}
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -226,14 +278,9 @@ static struct dyn_obj *dyn_object_find(void *obj)
 	struct dyn_obj *node;
 	k_spinlock_key_t key;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
 	key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
+	SYS_DLIST_FOR_EACH_CONTAINER(obj_bucket(obj), node, dobj_list) {
 		if (node->kobj.name == obj) {
 			goto end;
 		}
@@ -367,7 +414,7 @@ static struct z_object *dynamic_object_create(enum k_objects otype, size_t align
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	sys_dlist_append(obj_bucket(dyn->kobj.name), &dyn->dobj_list);
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -467,6 +514,7 @@ void k_object_free(void *obj)
 			thread_idx_free(dyn->kobj.data.thread_id);
 		}
 	}
+	obj_cache_invalidate();
 	k_spin_unlock(&objfree_lock, key);
 
 	if (dyn != NULL) {
@@ -505,8 +553,10 @@ void z_object_wordlist_foreach(_wordlist_cb_func_t func, void *context)
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&obj_list, obj, next, dobj_list) {
-		func(&obj->kobj, context);
+	for (size_t i = 0; i < ARRAY_SIZE(obj_table); i++) {
+		SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&obj_table[i], obj, next, dobj_list) {
+			func(&obj->kobj, context);
+		}
 	}
 	k_spin_unlock(&lists_lock, key);
 }
@@ -530,6 +580,7 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 	k_spinlock_key_t key = k_spin_lock(&obj_lock);
 
 	sys_bitfield_clear_bit((mem_addr_t)&ko->perms, index);
+	obj_cache_invalidate();
 
 #ifdef CONFIG_DYNAMIC_OBJECTS
 	if ((ko->flags & K_OBJ_FLAG_ALLOC) == 0U) {
@@ -754,6 +805,39 @@ int z_object_validate(struct z_object *ko, enum k_objects otype,
 	return 0;
 }
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+int z_obj_cached_validation_check(const void *obj, enum k_objects otype,
+				  enum _obj_init_check init)
+{
+	uintptr_t idx = (POINTER_TO_UINT(obj) / sizeof(void *)) &
+			(CONFIG_USERSPACE_OBJ_CACHE_SIZE - 1);
+	struct _obj_cache_entry *entry = &_current->obj_cache[idx];
+	uint64_t gen = obj_cache_gen_get();
+	int ret;
+
+	/* Only the checks of initialized objects are cached, the other ones
+	 * are done when creating and initializing objects, not on each use.
+	 */
+	if ((init == _OBJ_INIT_TRUE) && (entry->obj == obj) &&
+	    (entry->type == otype) && (entry->gen == gen)) {
+		return 0;
+	}
+
+	ret = z_obj_validation_check(z_object_find(obj), obj, otype, init);
+
+	/* The generation was read before the checks, so a revocation
+	 * racing with them leaves the entry invalid.
+	 */
+	if ((ret == 0) && (init == _OBJ_INIT_TRUE)) {
+		entry->obj = obj;
+		entry->type = otype;
+		entry->gen = gen;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+
 void z_object_init(const void *obj)
 {
 	struct z_object *ko;
@@ -785,6 +869,7 @@ void z_object_recycle(const void *obj)
 
 	if (ko != NULL) {
 		(void)memset(ko->perms, 0, sizeof(ko->perms));
+		obj_cache_invalidate();
 		z_thread_perms_set(ko, k_current_get());
 		ko->flags |= K_OBJ_FLAG_INITIALIZED;
 	}
@@ -801,6 +886,7 @@ void z_object_uninit(const void *obj)
 	}
 
 	ko->flags &= ~K_OBJ_FLAG_INITIALIZED;
+	obj_cache_invalidate();
 }
 
 /*
@@ -96,6 +96,98 @@ static inline void init_work_cancel(struct z_work_canceller *canceler,
 	sys_slist_append(&pending_cancels, &canceler->node);
 }
 
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+/* List of pending flushes of work items on queues with several threads.
+ *
+ * A flusher item queued behind the work item could run in another thread
+ * while the work item is still running, so these flushes instead track the
+ * instances of the work item to wait for.
+ */
+static sys_slist_t pending_flushes;
+
+static inline bool queue_is_multi_thread(const struct k_work_q *queue)
+{
+	return !sys_slist_is_empty(&queue->threads);
+}
+
+/* Initialize a flush waiter record and add it to the list of pending
+ * flushes.
+ *
+ * Invoked with work lock held.
+ */
+static inline void init_flush_waiter(struct z_work_flush_waiter *waiter,
+				     struct k_work *work)
+{
+	k_sem_init(&waiter->sem, 0, 1);
+	waiter->work = work;
+	waiter->queued = flag_test(&work->flags, K_WORK_QUEUED_BIT);
+	waiter->running = flag_test(&work->flags, K_WORK_RUNNING_BIT);
+	sys_slist_append(&pending_flushes, &waiter->node);
+}
+
+/* Update the flush waiters of a work item whose queued instance was
+ * dispatched to a thread, removed from the queue, or whose running
+ * instance completed, releasing the waiters with nothing left to wait for.
+ *
+ * Invoked with work lock held.
+ */
+static void update_flush_waiters_locked(struct k_work *work,
+					bool dispatched, bool removed,
+					bool completed)
+{
+	struct z_work_flush_waiter *waiter, *tmp;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&pending_flushes, waiter, tmp, node) {
+		if (waiter->work != work) {
+			prev = &waiter->node;
+			continue;
+		}
+
+		if (dispatched && waiter->queued) {
+			waiter->queued = false;
+			waiter->running = true;
+		}
+		if (removed) {
+			waiter->queued = false;
+		}
+		if (completed) {
+			waiter->running = false;
+		}
+
+		if (!waiter->queued && !waiter->running) {
+			sys_slist_remove(&pending_flushes, prev, &waiter->node);
+			k_sem_give(&waiter->sem);
+		} else {
+			prev = &waiter->node;
+		}
+	}
+}
+
+/* Determine whether the current thread is one of the threads of a queue. */
+static bool is_queue_thread(struct k_work_q *queue)
+{
+	struct k_work_q_thread *wthread;
+
+	if (_current == &queue->thread) {
+		return true;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->threads, wthread, node) {
+		if (_current == &wthread->thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+#else
+static inline bool is_queue_thread(struct k_work_q *queue)
+{
+	return _current == &queue->thread;
+}
+#endif /* CONFIG_WORKQUEUE_MULTI_THREAD */
+
 /* Complete cancellation of a work item and unlock held lock.
  *
  * Invoked with work lock held.
@@ -204,6 +296,9 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
 		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+		update_flush_waiters_locked(work, false, true, false);
+#endif
 	}
 }
 
@@ -256,7 +351,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret = -EBUSY;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = !k_is_in_isr() && is_queue_thread(queue);
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -427,22 +522,32 @@ int k_work_submit(struct k_work *work)
  *
  * @retval false otherwise.  No wait required.
  */
-static bool work_flush_locked(struct k_work *work,
-			      struct z_work_flusher *flusher)
+static struct k_sem *work_flush_locked(struct k_work *work,
+				       struct k_work_sync *sync)
 {
 	bool need_flush = (flags_get(&work->flags)
 			   & (K_WORK_QUEUED | K_WORK_RUNNING)) != 0U;
 
-	if (need_flush) {
-		struct k_work_q *queue = work->queue;
+	if (!need_flush) {
+		return NULL;
+	}
 
-		__ASSERT_NO_MSG(queue != NULL);
+	struct k_work_q *queue = work->queue;
 
-		queue_flusher_locked(queue, work, flusher);
-		notify_queue_locked(queue);
+	__ASSERT_NO_MSG(queue != NULL);
+
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+	if (queue_is_multi_thread(queue)) {
+		init_flush_waiter(&sync->waiter, work);
+
+		return &sync->waiter.sem;
 	}
+#endif
 
-	return need_flush;
+	queue_flusher_locked(queue, work, &sync->flusher);
+	notify_queue_locked(queue);
+
+	return &sync->flusher.sem;
 }
 
 bool k_work_flush(struct k_work *work,
@@ -458,10 +563,10 @@ bool k_work_flush(struct k_work *work,
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, flush, work);
 
-	struct z_work_flusher *flusher = &sync->flusher;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	bool need_flush = work_flush_locked(work, flusher);
+	struct k_sem *sem = work_flush_locked(work, sync);
+	bool need_flush = (sem != NULL);
 
 	k_spin_unlock(&lock, key);
 
@@ -469,7 +574,7 @@ bool k_work_flush(struct k_work *work,
 	if (need_flush) {
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work, flush, work, K_FOREVER);
 
-		k_sem_take(&flusher->sem, K_FOREVER);
+		k_sem_take(sem, K_FOREVER);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, flush, work, need_flush);
@@ -596,6 +701,65 @@ bool k_work_cancel_sync(struct k_work *work,
  *
  * @param workq_ptr pointer to the work queue structure
  */
+/* Take the next work item to run from the pending list of a queue.
+ *
+ * With several threads, an item still running in another thread stays
+ * queued until it completes, so that a work item never runs concurrently
+ * with itself.
+ *
+ * Invoked with work lock held.
+ */
+static sys_snode_t *queue_next_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+	if (queue_is_multi_thread(queue)) {
+		sys_snode_t *prev = NULL;
+		sys_snode_t *node;
+
+		SYS_SLIST_FOR_EACH_NODE(&queue->pending, node) {
+			struct k_work *work = CONTAINER_OF(node, struct k_work, node);
+
+			if (!flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+				sys_slist_remove(&queue->pending, prev, node);
+				return node;
+			}
+
+			prev = node;
+		}
+
+		return NULL;
+	}
+#endif
+
+	return sys_slist_get(&queue->pending);
+}
+
+/* Mark a queue as having a work item active that's not on the pending
+ * list, or no longer, counting the active items of its threads.
+ *
+ * Invoked with work lock held.
+ */
+static inline void queue_set_busy_locked(struct k_work_q *queue, bool busy)
+{
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+	if (busy) {
+		queue->busy++;
+	} else {
+		__ASSERT_NO_MSG(queue->busy > 0);
+		queue->busy--;
+		if (queue->busy > 0) {
+			return;
+		}
+	}
+#endif
+
+	if (busy) {
+		flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	} else {
+		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	}
+}
+
 static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 {
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
@@ -608,15 +772,18 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_next_locked(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+			queue_set_busy_locked(queue, true);
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+			update_flush_waiters_locked(work, true, false, false);
+#endif
 
 			/* Static code analysis tool can raise a false-positive violation
 			 * in the line below that 'work' is checked for null after being
@@ -631,8 +798,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
-					       K_WORK_QUEUE_DRAIN_BIT)) {
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)
+			   && flag_test_and_clear(&queue->flags,
+						  K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
 			 * immediate reschedule; released threads get their
@@ -678,8 +846,11 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
 			finalize_cancel_locked(work);
 		}
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+		update_flush_waiters_locked(work, false, false, true);
+#endif
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		queue_set_busy_locked(queue, false);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -703,6 +874,28 @@ void k_work_queue_init(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_INIT(k_work_queue, queue);
 }
 
+/* Restrict a thread of a work queue to the CPUs of its configuration. */
+static void work_queue_thread_cpu_mask_set(struct k_thread *thread,
+					   const struct k_work_queue_config *cfg)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	if ((cfg == NULL) || (cfg->cpu_mask == 0U)) {
+		return;
+	}
+
+	(void)k_thread_cpu_mask_clear(thread);
+
+	for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		if ((cfg->cpu_mask & BIT(cpu)) != 0U) {
+			(void)k_thread_cpu_mask_enable(thread, cpu);
+		}
+	}
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cfg);
+#endif
+}
+
 void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack,
 			size_t stack_size,
@@ -719,6 +912,10 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+	sys_slist_init(&queue->threads);
+	queue->busy = 0;
+#endif
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -738,11 +935,46 @@ void k_work_queue_start(struct k_work_q *queue,
 		k_thread_name_set(&queue->thread, cfg->name);
 	}
 
+	work_queue_thread_cpu_mask_set(&queue->thread, cfg);
+
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+void k_work_queue_thread_add(struct k_work_q *queue,
+			     struct k_work_q_thread *wthread,
+			     k_thread_stack_t *stack,
+			     size_t stack_size,
+			     int prio,
+			     const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(wthread);
+	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	(void)k_thread_create(&wthread->thread, stack, stack_size,
+			      work_queue_main, queue, NULL, NULL,
+			      prio, 0, K_FOREVER);
+
+	if ((cfg != NULL) && (cfg->name != NULL)) {
+		k_thread_name_set(&wthread->thread, cfg->name);
+	}
+
+	work_queue_thread_cpu_mask_set(&wthread->thread, cfg);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	sys_slist_append(&queue->threads, &wthread->node);
+
+	k_spin_unlock(&lock, key);
+
+	k_thread_start(&wthread->thread);
+}
+#endif /* CONFIG_WORKQUEUE_MULTI_THREAD */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -843,6 +1075,21 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_INIT(k_work_delayable, dwork);
 }
 
+#ifdef CONFIG_TIMER_SLACK
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+	__ASSERT_NO_MSG(!K_TIMEOUT_EQ(slack, K_FOREVER));
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	dwork->slack = slack.ticks;
+
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_TIMER_SLACK */
+
 static inline int work_delayable_busy_get_locked(const struct k_work_delayable *dwork)
 {
 	return flags_get(&dwork->work.flags) & K_WORK_MASK;
@@ -895,7 +1142,11 @@ static int schedule_for_queue_locked(struct k_work_q **queuep,
 	dwork->queue = *queuep;
 
 	/* Add timeout */
+#ifdef CONFIG_TIMER_SLACK
+	z_add_timeout_slack(&dwork->timeout, work_timeout, delay, dwork->slack);
+#else
 	z_add_timeout(&dwork->timeout, work_timeout, delay);
+#endif
 
 	return ret;
 }
@@ -1080,7 +1331,6 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, flush_delayable, dwork, sync);
 
 	struct k_work *work = &dwork->work;
-	struct z_work_flusher *flusher = &sync->flusher;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	/* If it's idle release the lock and return immediately. */
@@ -1102,13 +1352,14 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 	}
 
 	/* Wait for it to finish */
-	bool need_flush = work_flush_locked(work, flusher);
+	struct k_sem *sem = work_flush_locked(work, sync);
+	bool need_flush = (sem != NULL);
 
 	k_spin_unlock(&lock, key);
 
 	/* If necessary wait until the flusher item completes */
 	if (need_flush) {
-		k_sem_take(&flusher->sem, K_FOREVER);
+		k_sem_take(sem, K_FOREVER);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, flush_delayable, dwork, sync, need_flush);
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * Slabs backing operator new, smallest blocks first. Each buffer is
+ * aligned to the block size so every block is aligned to its size too.
+ */
+K_MEM_SLAB_DEFINE_STATIC(cpp_pool_16, 16, CONFIG_CPP_NEW_POOL_BLOCKS, 16);
+K_MEM_SLAB_DEFINE_STATIC(cpp_pool_32, 32, CONFIG_CPP_NEW_POOL_BLOCKS, 32);
+K_MEM_SLAB_DEFINE_STATIC(cpp_pool_64, 64, CONFIG_CPP_NEW_POOL_BLOCKS, 64);
+K_MEM_SLAB_DEFINE_STATIC(cpp_pool_128, 128, CONFIG_CPP_NEW_POOL_BLOCKS, 128);
+
+static struct k_mem_slab *const cpp_pools[] = {
+	&cpp_pool_16,
+	&cpp_pool_32,
+	&cpp_pool_64,
+	&cpp_pool_128,
+};
+
+static bool cpp_pool_owns(struct k_mem_slab *slab, void *ptr)
+{
+	uintptr_t start = (uintptr_t)slab->buffer;
+	uintptr_t end = start + slab->num_blocks * slab->block_size;
+
+	return (uintptr_t)ptr >= start && (uintptr_t)ptr < end;
+}
+
+/*
+ * Called by operator new, with an alignment of zero when the default
+ * alignment is enough.
+ */
+void *z_cpp_pool_alloc(size_t size, size_t align)
+{
+	size_t need = MAX(size, align);
+	void *ptr;
+
+	/* A full slab sends the request on to the next size class */
+	for (size_t i = 0; i < ARRAY_SIZE(cpp_pools); i++) {
+		if (need <= cpp_pools[i]->block_size &&
+		    k_mem_slab_alloc(cpp_pools[i], &ptr, K_NO_WAIT) == 0) {
+			return ptr;
+		}
+	}
+
+	if (align == 0) {
+		return malloc(size);
+	}
+
+	return aligned_alloc(align, size);
+}
+
+void z_cpp_pool_free(void *ptr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cpp_pools); i++) {
+		if (cpp_pool_owns(cpp_pools[i], ptr)) {
+			k_mem_slab_free(cpp_pools[i], &ptr);
+			return;
+		}
+	}
+
+	free(ptr);
+}
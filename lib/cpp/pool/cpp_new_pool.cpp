@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <new>
+
+#if __cplusplus < 201103L
+#define NOEXCEPT
+#else /* >= C++11 */
+#define NOEXCEPT noexcept
+#endif /* __cplusplus */
+
+#if __cplusplus < 202002L
+#define NODISCARD
+#else
+#define NODISCARD [[nodiscard]]
+#endif /* __cplusplus */
+
+extern "C" {
+void *z_cpp_pool_alloc(size_t size, size_t align);
+void z_cpp_pool_free(void *ptr);
+}
+
+static void *pool_new(size_t size, size_t align)
+{
+	void *ptr = z_cpp_pool_alloc(size, align);
+
+#ifdef __cpp_exceptions
+	if (ptr == NULL) {
+		throw std::bad_alloc();
+	}
+#endif
+
+	return ptr;
+}
+
+NODISCARD void* operator new(size_t size)
+{
+	return pool_new(size, 0);
+}
+
+NODISCARD void* operator new[](size_t size)
+{
+	return pool_new(size, 0);
+}
+
+NODISCARD void* operator new(std::size_t size, const std::nothrow_t& tag) NOEXCEPT
+{
+	return z_cpp_pool_alloc(size, 0);
+}
+
+NODISCARD void* operator new[](std::size_t size, const std::nothrow_t& tag) NOEXCEPT
+{
+	return z_cpp_pool_alloc(size, 0);
+}
+
+#if __cplusplus >= 201703L
+NODISCARD void* operator new(size_t size, std::align_val_t al)
+{
+	return pool_new(size, static_cast<size_t>(al));
+}
+
+NODISCARD void* operator new[](std::size_t size, std::align_val_t al)
+{
+	return pool_new(size, static_cast<size_t>(al));
+}
+
+NODISCARD void* operator new(std::size_t size, std::align_val_t al,
+			     const std::nothrow_t&) NOEXCEPT
+{
+	return z_cpp_pool_alloc(size, static_cast<size_t>(al));
+}
+
+NODISCARD void* operator new[](std::size_t size, std::align_val_t al,
+			       const std::nothrow_t&) NOEXCEPT
+{
+	return z_cpp_pool_alloc(size, static_cast<size_t>(al));
+}
+#endif /* __cplusplus >= 201703L */
+
+void operator delete(void* ptr) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete[](void* ptr) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+#if (__cplusplus > 201103L)
+void operator delete(void* ptr, size_t) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+#endif // __cplusplus > 201103L
+
+/*
+ * Aligned allocations may come from the slabs too, so the aligned
+ * deletes must not be left to the C++ library.
+ */
+#if __cplusplus >= 201703L
+void operator delete(void* ptr, std::align_val_t) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) NOEXCEPT
+{
+	z_cpp_pool_free(ptr);
+}
+#endif /* __cplusplus >= 201703L */
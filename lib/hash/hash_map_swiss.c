@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_swiss.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/*
+ * Slots are grouped, each group holding a control byte per slot followed by
+ * the keys and the values of its slots. A control byte is either EMPTY or
+ * the 7 low bits of the hash of the key in the slot, so that the slots of a
+ * group which may hold a key are found by comparing all of its control bytes
+ * at once, with SSE2 where available and within a 64-bit word otherwise.
+ *
+ * A key is placed in the first group of its probe sequence with an empty
+ * slot. Instead of leaving tombstones behind on removal, each group counts
+ * the keys which were placed past it because it was full: a lookup stops at
+ * the first group with a zero count, and a removal decrements the counts
+ * along the probe sequence of the removed key.
+ */
+
+#define EMPTY 0x80
+
+#ifdef __SSE2__
+#define GROUP_WIDTH 16
+#define MASK_SHIFT  0
+
+typedef uint32_t group_mask_t;
+
+static inline group_mask_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	__m128i c = _mm_loadu_si128((const __m128i *)ctrl);
+
+	return (group_mask_t)_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8((char)h2)));
+}
+
+static inline group_mask_t group_match_empty(const uint8_t *ctrl)
+{
+	return (group_mask_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+}
+#else
+#define GROUP_WIDTH 8
+#define MASK_SHIFT  3
+
+#define LSBS 0x0101010101010101ULL
+#define MSBS 0x8080808080808080ULL
+
+typedef uint64_t group_mask_t;
+
+/*
+ * Control bytes are loaded little-endian, so that slot i is byte i of the
+ * word whatever the byte order of the CPU.
+ */
+
+/* may report slots whose control byte differs, never EMPTY ones */
+static inline group_mask_t group_match(const uint8_t *ctrl, uint8_t h2)
+{
+	uint64_t x = sys_get_le64(ctrl) ^ (LSBS * h2);
+
+	return (x - LSBS) & ~x & MSBS;
+}
+
+static inline group_mask_t group_match_empty(const uint8_t *ctrl)
+{
+	return sys_get_le64(ctrl) & MSBS;
+}
+#endif
+
+static inline size_t group_mask_next(group_mask_t mask)
+{
+	return (size_t)u64_count_trailing_zeros(mask) >> MASK_SHIFT;
+}
+
+struct swiss_group {
+	uint8_t ctrl[GROUP_WIDTH];
+	/* keys placed past this group, saturates at UINT8_MAX */
+	uint8_t overflow;
+	uint64_t keys[GROUP_WIDTH];
+	uint64_t values[GROUP_WIDTH];
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_swiss_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+
+static inline size_t sys_hashmap_swiss_n_groups(const struct sys_hashmap *map)
+{
+	return map->data->n_buckets / GROUP_WIDTH;
+}
+
+static struct swiss_group *sys_hashmap_swiss_find(const struct sys_hashmap *map, uint64_t key,
+						  uint32_t hash, size_t *slot)
+{
+	size_t idx;
+	group_mask_t mask;
+	struct swiss_group *group;
+	const uint8_t h2 = hash & 0x7f;
+	const size_t n_groups = sys_hashmap_swiss_n_groups(map);
+	struct swiss_group *const groups = map->data->buckets;
+
+	/* triangular probing visits every group when their number is a power of 2 */
+	for (size_t i = 0, g = hash >> 7; i < n_groups; g += ++i) {
+		group = &groups[g & (n_groups - 1)];
+
+		for (mask = group_match(group->ctrl, h2); mask != 0; mask &= mask - 1) {
+			idx = group_mask_next(mask);
+			if (group->ctrl[idx] == h2 && group->keys[idx] == key) {
+				*slot = idx;
+				return group;
+			}
+		}
+
+		if (group->overflow == 0) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static int sys_hashmap_swiss_insert_no_rehash(struct sys_hashmap *map, uint64_t key,
+					      uint64_t value, uint64_t *old_value)
+{
+	size_t idx;
+	group_mask_t mask;
+	struct swiss_group *group;
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+	const size_t n_groups = sys_hashmap_swiss_n_groups(map);
+	struct swiss_group *const groups = map->data->buckets;
+
+	group = sys_hashmap_swiss_find(map, key, hash, &idx);
+	if (group != NULL) {
+		if (old_value != NULL) {
+			*old_value = group->values[idx];
+		}
+
+		group->values[idx] = value;
+
+		return 0;
+	}
+
+	for (size_t i = 0, g = hash >> 7; i < n_groups; g += ++i) {
+		group = &groups[g & (n_groups - 1)];
+
+		mask = group_match_empty(group->ctrl);
+		if (mask != 0) {
+			idx = group_mask_next(mask);
+			group->ctrl[idx] = hash & 0x7f;
+			group->keys[idx] = key;
+			group->values[idx] = value;
+			++map->data->size;
+
+			return 1;
+		}
+
+		if (group->overflow < UINT8_MAX) {
+			++group->overflow;
+		}
+	}
+
+	__ASSERT(false, "No empty slot, the load factor must be below 100");
+
+	return -ENOSPC;
+}
+
+static int sys_hashmap_swiss_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_size;
+	size_t old_n_groups;
+	size_t new_n_buckets = 0;
+	struct swiss_group *group;
+	struct swiss_group *old_groups;
+	struct swiss_group *new_groups;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, 0, &new_n_buckets)) {
+		return 0;
+	}
+
+	if (new_n_buckets != 0) {
+		new_n_buckets = ROUND_UP(new_n_buckets, GROUP_WIDTH);
+	}
+
+	if (new_n_buckets == data->n_buckets) {
+		/* a single group can not shrink */
+		return 0;
+	}
+
+	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	/* extract all entries from the hashmap */
+	old_size = data->size;
+	old_n_groups = data->n_buckets / GROUP_WIDTH;
+	old_groups = (struct swiss_group *)data->buckets;
+
+	new_groups = (struct swiss_group *)map->alloc_func(
+		NULL, new_n_buckets / GROUP_WIDTH * sizeof(*new_groups));
+	if (new_groups == NULL && new_n_buckets != 0) {
+		return -ENOMEM;
+	}
+
+	for (size_t i = 0; i < new_n_buckets / GROUP_WIDTH; ++i) {
+		memset(new_groups[i].ctrl, EMPTY, sizeof(new_groups[i].ctrl));
+		new_groups[i].overflow = 0;
+	}
+
+	data->size = 0;
+	data->buckets = new_groups;
+	data->n_buckets = new_n_buckets;
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0, j = 0; i < old_n_groups && j < old_size; ++i) {
+		group = &old_groups[i];
+
+		for (size_t k = 0; k < GROUP_WIDTH; ++k) {
+			if (group->ctrl[k] != EMPTY) {
+				sys_hashmap_swiss_insert_no_rehash(map, group->keys[k],
+								   group->values[k], NULL);
+				++j;
+			}
+		}
+	}
+
+	/* free the old Hashmap */
+	map->alloc_func(old_groups, 0);
+
+	return 0;
+}
+
+static void sys_hashmap_swiss_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	struct swiss_group *group;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct swiss_group *groups = map->data->buckets;
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = (void *)0;
+	}
+
+	/* the state is the index of the next slot to look at */
+	i = (uintptr_t)it->state;
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		group = &groups[i / GROUP_WIDTH];
+		if (group->ctrl[i % GROUP_WIDTH] != EMPTY) {
+			it->state = (void *)(uintptr_t)(i + 1);
+			it->key = group->keys[i % GROUP_WIDTH];
+			it->value = group->values[i % GROUP_WIDTH];
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Swiss Table Hashmap API
+ */
+
+static void sys_hashmap_swiss_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_swiss_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_swiss_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct swiss_group *group;
+	struct sys_hashmap_swiss_data *data = (struct sys_hashmap_swiss_data *)map->data;
+	struct swiss_group *groups = data->buckets;
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		group = &groups[i / GROUP_WIDTH];
+		if (group->ctrl[i % GROUP_WIDTH] != EMPTY) {
+			cb(group->keys[i % GROUP_WIDTH], group->values[i % GROUP_WIDTH], cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+}
+
+static inline int sys_hashmap_swiss_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					   uint64_t *old_value)
+{
+	int ret;
+
+	ret = sys_hashmap_swiss_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return sys_hashmap_swiss_insert_no_rehash(map, key, value, old_value);
+}
+
+static bool sys_hashmap_swiss_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t idx;
+	struct swiss_group *group;
+	struct swiss_group *found;
+	uint32_t hash;
+	const size_t n_groups = sys_hashmap_swiss_n_groups(map);
+	struct swiss_group *const groups = map->data->buckets;
+
+	if (n_groups == 0) {
+		return false;
+	}
+
+	hash = map->hash_func(&key, sizeof(key));
+	found = sys_hashmap_swiss_find(map, key, hash, &idx);
+	if (found == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = found->values[idx];
+	}
+
+	found->ctrl[idx] = EMPTY;
+	--map->data->size;
+
+	/* the key no longer overflows the groups probed before its own */
+	for (size_t i = 0, g = hash >> 7; i < n_groups; g += ++i) {
+		group = &groups[g & (n_groups - 1)];
+		if (group == found) {
+			break;
+		}
+
+		if (group->overflow < UINT8_MAX) {
+			--group->overflow;
+		}
+	}
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_swiss_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_swiss_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t idx;
+	struct swiss_group *group;
+
+	if (map->data->n_buckets == 0) {
+		return false;
+	}
+
+	group = sys_hashmap_swiss_find(map, key, map->hash_func(&key, sizeof(key)), &idx);
+	if (group == NULL) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = group->values[idx];
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_swiss_api = {
+	.iter = sys_hashmap_swiss_iter,
+	.clear = sys_hashmap_swiss_clear,
+	.insert = sys_hashmap_swiss_insert,
+	.remove = sys_hashmap_swiss_remove,
+	.get = sys_hashmap_swiss_get,
+};
@@ -10,6 +10,29 @@
 #include <stdint.h>
 #include <sys/types.h>
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+#define WORD_SIZE sizeof(mem_word_t)
+#define WORD_MASK (WORD_SIZE - 1)
+
+/* Words with all of their bytes set to 0x01 and to 0x80 */
+#define WORD_ONES ((mem_word_t)-1 / 0xFF)
+#define WORD_HIGHS (WORD_ONES << 7)
+
+/* Non-zero if one of the bytes of the word is zero */
+#define WORD_HAS_ZERO(w) (((w) - WORD_ONES) & ~(w) & WORD_HIGHS)
+
+/* Merges the bytes following the first <shift> ones of word <a> in
+ * memory with the first bytes of word <b>
+ */
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define WORD_MERGE(a, b, shift) \
+	(((a) << (8 * (shift))) | ((b) >> (8 * (WORD_SIZE - (shift)))))
+#else
+#define WORD_MERGE(a, b, shift) \
+	(((a) >> (8 * (shift))) | ((b) << (8 * (WORD_SIZE - (shift)))))
+#endif
+#endif
+
 /**
  *
  * @brief Copy a string
@@ -106,14 +129,37 @@ char *strrchr(const char *s, int c)
 
 size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *start = s;
+
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* do byte-sized scanning until word-aligned */
+
+	while (((uintptr_t)s & WORD_MASK) != 0) {
+		if (*s == '\0') {
+			return s - start;
+		}
+		s++;
+	}
+
+	/* scan a word at a time for the word holding the terminator; an
+	 * aligned word never straddles pages or memory protection regions
+	 * even if it extends past the end of the string
+	 */
+
+	const mem_word_t *s_word = (const mem_word_t *)s;
+
+	while (WORD_HAS_ZERO(*s_word) == 0) {
+		s_word++;
+	}
+
+	s = (const char *)s_word;
+#endif
 
 	while (*s != '\0') {
 		s++;
-		n++;
 	}
 
-	return n;
+	return s - start;
 }
 
 /**
@@ -222,6 +268,35 @@ int memcmp(const void *m1, const void *m2, size_t n)
 	const char *c1 = m1;
 	const char *c2 = m2;
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* skip the identical words of areas with the same alignment, the
+	 * first difference is then located by the byte loop
+	 */
+
+	if ((((uintptr_t)c1 ^ (uintptr_t)c2) & WORD_MASK) == 0) {
+		while ((n > 0) && (((uintptr_t)c1 & WORD_MASK) != 0) &&
+		       (*c1 == *c2)) {
+			c1++;
+			c2++;
+			n--;
+		}
+
+		if (((uintptr_t)c1 & WORD_MASK) == 0) {
+			const mem_word_t *w1 = (const mem_word_t *)c1;
+			const mem_word_t *w2 = (const mem_word_t *)c2;
+
+			while ((n >= WORD_SIZE) && (*w1 == *w2)) {
+				w1++;
+				w2++;
+				n -= WORD_SIZE;
+			}
+
+			c1 = (const char *)w1;
+			c2 = (const char *)w2;
+		}
+	}
+#endif
+
 	if (!n) {
 		return 0;
 	}
@@ -278,39 +353,69 @@ void *memmove(void *d, const void *s, size_t n)
 
 void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 {
-	/* attempt word-sized copying only if buffers have identical alignment */
-
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
 
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
-	const uintptr_t mask = sizeof(mem_word_t) - 1;
-
-	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
-
-		/* do byte-sized copying until word-aligned or finished */
+	/* do byte-sized copying until the destination is word-aligned */
 
-		while (((uintptr_t)d_byte) & mask) {
-			if (n == 0) {
-				return d;
-			}
-			*(d_byte++) = *(s_byte++);
-			n--;
+	while (((uintptr_t)d_byte) & WORD_MASK) {
+		if (n == 0) {
+			return d;
 		}
+		*(d_byte++) = *(s_byte++);
+		n--;
+	}
 
-		/* do word-sized copying as long as possible */
+	mem_word_t *d_word = (mem_word_t *)d_byte;
+	const uintptr_t shift = (uintptr_t)s_byte & WORD_MASK;
 
-		mem_word_t *d_word = (mem_word_t *)d_byte;
+	if (shift == 0) {
 		const mem_word_t *s_word = (const mem_word_t *)s_byte;
 
-		while (n >= sizeof(mem_word_t)) {
+		/* copy four words at a time, which compilers turn into
+		 * load/store multiple instructions where available
+		 */
+
+		while (n >= 4 * WORD_SIZE) {
+			d_word[0] = s_word[0];
+			d_word[1] = s_word[1];
+			d_word[2] = s_word[2];
+			d_word[3] = s_word[3];
+			d_word += 4;
+			s_word += 4;
+			n -= 4 * WORD_SIZE;
+		}
+
+		while (n >= WORD_SIZE) {
 			*(d_word++) = *(s_word++);
-			n -= sizeof(mem_word_t);
+			n -= WORD_SIZE;
 		}
 
-		d_byte = (unsigned char *)d_word;
-		s_byte = (unsigned char *)s_word;
+		s_byte = (const unsigned char *)s_word;
+	} else if (n >= WORD_SIZE) {
+		/* the source is misaligned: read aligned words and merge
+		 * each two of them into a destination word. The first and
+		 * last words read may hold bytes outside of the source,
+		 * which cannot fault as they are part of an aligned word.
+		 */
+
+		const mem_word_t *s_word =
+			(const mem_word_t *)(s_byte - shift);
+		mem_word_t prev = *(s_word++);
+		mem_word_t next;
+
+		while (n >= WORD_SIZE) {
+			next = *(s_word++);
+			*(d_word++) = WORD_MERGE(prev, next, shift);
+			prev = next;
+			n -= WORD_SIZE;
+		}
+
+		s_byte = (const unsigned char *)s_word - WORD_SIZE + shift;
 	}
+
+	d_byte = (unsigned char *)d_word;
 #endif
 
 	/* do byte-sized copying until finished */
@@ -338,7 +443,7 @@ void *memset(void *buf, int c, size_t n)
 	unsigned char c_byte = (unsigned char)c;
 
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
-	while (((uintptr_t)d_byte) & (sizeof(mem_word_t) - 1)) {
+	while (((uintptr_t)d_byte) & WORD_MASK) {
 		if (n == 0) {
 			return buf;
 		}
@@ -357,9 +462,18 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
-	while (n >= sizeof(mem_word_t)) {
+	while (n >= 4 * WORD_SIZE) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+		n -= 4 * WORD_SIZE;
+	}
+
+	while (n >= WORD_SIZE) {
 		*(d_word++) = c_word;
-		n -= sizeof(mem_word_t);
+		n -= WORD_SIZE;
 	}
 
 	/* do byte-sized initialization until finished */
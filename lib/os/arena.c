@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/arena.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+static inline uint8_t *chunk_data(struct sys_arena_chunk *c)
+{
+	return (uint8_t *)(c + 1);
+}
+
+/* Carve an allocation out of a chunk, or return NULL if it won't fit */
+static void *chunk_alloc(struct sys_arena_chunk *c, size_t align, size_t bytes)
+{
+	uintptr_t start = (uintptr_t)chunk_data(c);
+	uintptr_t p = ROUND_UP(start + c->used, align);
+
+	if ((p - start) > c->size || bytes > (c->size - (p - start))) {
+		return NULL;
+	}
+
+	c->used = (p - start) + bytes;
+
+	return (void *)p;
+}
+
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes,
+		    struct sys_heap *backing, size_t chunk_size)
+{
+	uintptr_t addr = ROUND_UP((uintptr_t)mem, __alignof__(struct sys_arena_chunk));
+	size_t hdr = (addr - (uintptr_t)mem) + sizeof(struct sys_arena_chunk);
+
+	*arena = (struct sys_arena) {
+		.backing = backing,
+		.chunk_size = chunk_size,
+	};
+
+	if (mem != NULL && bytes > hdr) {
+		arena->base = (struct sys_arena_chunk *)addr;
+		*arena->base = (struct sys_arena_chunk) {
+			.size = bytes - hdr,
+		};
+		arena->cur = arena->base;
+	}
+}
+
+void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align, size_t bytes)
+{
+	struct sys_arena_chunk *c;
+	size_t size;
+	void *ret;
+
+	__ASSERT(align != 0 && (align & (align - 1)) == 0,
+		 "align must be a power of two");
+
+	if (bytes == 0) {
+		return NULL;
+	}
+
+	if (arena->cur != NULL) {
+		ret = chunk_alloc(arena->cur, align, bytes);
+		if (ret != NULL) {
+			return ret;
+		}
+	}
+
+	if (arena->backing == NULL) {
+		return NULL;
+	}
+
+	/* Leave room to align the allocation wherever the chunk lands */
+	if (size_add_overflow(bytes, align - 1, &size)) {
+		return NULL;
+	}
+	size = MAX(size, arena->chunk_size);
+	if (size_add_overflow(size, sizeof(*c), &size)) {
+		return NULL;
+	}
+
+	c = sys_heap_alloc(arena->backing, size);
+	if (c == NULL) {
+		return NULL;
+	}
+
+	*c = (struct sys_arena_chunk) {
+		.next = arena->cur,
+		.size = size - sizeof(*c),
+	};
+	arena->cur = c;
+
+	return chunk_alloc(c, align, bytes);
+}
+
+void sys_arena_rollback(struct sys_arena *arena, struct sys_arena_mark mark)
+{
+	struct sys_arena_chunk *c = arena->cur;
+
+	while (c != mark.chunk) {
+		struct sys_arena_chunk *next = c->next;
+
+		__ASSERT(c != arena->base, "mark not from this arena");
+		sys_heap_free(arena->backing, c);
+		c = next;
+	}
+
+	arena->cur = c;
+	if (c != NULL) {
+		__ASSERT(mark.used <= c->used, "mark invalidated by a rollback");
+		c->used = mark.used;
+	}
+}
+
+void sys_arena_reset(struct sys_arena *arena)
+{
+	sys_arena_rollback(arena, (struct sys_arena_mark) {
+		.chunk = arena->base,
+		.used = 0,
+	});
+}
+
+size_t sys_arena_used_get(struct sys_arena *arena)
+{
+	size_t used = 0;
+
+	for (struct sys_arena_chunk *c = arena->cur; c != NULL; c = c->next) {
+		used += c->used;
+	}
+
+	return used;
+}
@@ -785,6 +785,45 @@ static inline size_t conversion_radix(char specifier)
  * generated representation.  The returned pointer is to the first
  * character of the representation.
  */
+#ifdef CONFIG_CBPRINTF_FAST_CONV
+/* Decimal representations of 0 to 99 */
+static const char digit_pairs[200] =
+	"00010203040506070809101112131415161718192021222324252627282930313233"
+	"34353637383940414243444546474849505152535455565758596061626364656667"
+	"6869707172737475767778798081828384858687888990919293949596979899";
+
+/* Writes the given value in decimal backwards from bpe, two digits per
+ * division, and returns the first character of the representation.
+ */
+static char *encode_dec(uint_value_type value, char *bps, const char *bpe)
+{
+	char *bp = bps + (bpe - bps);
+
+	while ((value >= 100U) && ((bp - bps) >= 2)) {
+		unsigned int pair = (unsigned int)(value % 100U) * 2U;
+
+		value /= 100U;
+		*--bp = digit_pairs[pair + 1U];
+		*--bp = digit_pairs[pair];
+	}
+
+	if (value >= 10U) {
+		if ((bp - bps) >= 2) {
+			unsigned int pair = (unsigned int)value * 2U;
+
+			*--bp = digit_pairs[pair + 1U];
+			*--bp = digit_pairs[pair];
+		}
+	} else if (bps < bp) {
+		*--bp = '0' + (unsigned int)value;
+	} else {
+		;
+	}
+
+	return bp;
+}
+#endif
+
 static char *encode_uint(uint_value_type value,
 			 struct conversion *conv,
 			 char *bps,
@@ -794,6 +833,21 @@ static char *encode_uint(uint_value_type value,
 	const unsigned int radix = conversion_radix(conv->specifier);
 	char *bp = bps + (bpe - bps);
 
+#ifdef CONFIG_CBPRINTF_FAST_CONV
+	if (radix == 10U) {
+		bp = encode_dec(value, bps, bpe);
+	} else {
+		/* Power of two radix: shift instead of dividing */
+		const unsigned int shift = (radix == 16U) ? 4U : 3U;
+		const char *digits = upcase ? "0123456789ABCDEF"
+					    : "0123456789abcdef";
+
+		do {
+			*--bp = digits[value & (radix - 1U)];
+			value >>= shift;
+		} while ((value != 0) && (bps < bp));
+	}
+#else
 	do {
 		unsigned int lsv = (unsigned int)(value % radix);
 
@@ -801,6 +855,7 @@ static char *encode_uint(uint_value_type value,
 			: upcase ? ('A' + lsv - 10) : ('a' + lsv - 10);
 		value /= radix;
 	} while ((value != 0) && (bps < bp));
+#endif
 
 	/* Record required alternate forms.  This can be determined
 	 * from the radix without re-checking specifier.
@@ -843,6 +898,103 @@ static char *encode_uint(uint_value_type value,
  */
 #define BIT_63 BIT64(63)
 
+#ifdef CONFIG_CBPRINTF_FAST_CONV
+/* Highest precision converted by encode_float_fixed(), which keeps
+ * its output within CONVERTED_FP_BUFLEN along with 16 integer digits.
+ */
+#define FIXED_PREC_MAX 6
+
+/* Converts the absolute value of a double for a %f conversion with a
+ * precision of at most FIXED_PREC_MAX, when its integer part has less
+ * than 53 bits and its fractional part at most 60.  The integer part
+ * is converted as such and the fractional part as a 60-bit fixed point
+ * value, which is exact and avoids the decimal exponent scaling of
+ * encode_float().  Ties are rounded to even.
+ *
+ * Returns the end of the converted value, or NULL if the value can't
+ * be converted this way.
+ */
+static char *encode_float_fixed(uint64_t u64, struct conversion *conv,
+				int precision, char *buf)
+{
+	int expo = (u64 >> FRACTION_BITS) & BIT_MASK(EXPONENT_BITS);
+	uint64_t mant = u64 & BIT64_MASK(FRACTION_BITS);
+	const int ival_bits = MIN(FRACTION_BITS + 1,
+				  (int)(CHAR_BIT * sizeof(uint_value_type)) - 1);
+	uint_value_type ival;
+	uint64_t fract;
+	int shift;
+
+	if ((precision > FIXED_PREC_MAX) || (expo == 0)) {
+		return NULL;
+	}
+
+	/* value = mant * 2^-shift */
+	mant |= BIT64(FRACTION_BITS);
+	shift = 1023 + FRACTION_BITS - expo;
+
+	if ((shift > 60) || ((FRACTION_BITS + 1 - shift) > ival_bits)) {
+		return NULL;
+	}
+
+	if (shift <= 0) {
+		ival = (uint_value_type)(mant << -shift);
+		fract = 0;
+	} else {
+		ival = (uint_value_type)(mant >> shift);
+		fract = (mant & (BIT64(shift) - 1U)) << (60 - shift);
+	}
+
+	char tmp[CONVERTED_INT_BUFLEN];
+	const char *tpe = tmp + sizeof(tmp);
+	const char *tp = encode_dec(ival, tmp, tpe);
+	char *sp = buf;
+
+	while (tp < tpe) {
+		*buf++ = *tp++;
+	}
+
+	if (conv->flag_hash || (precision > 0)) {
+		*buf++ = '.';
+	}
+
+	while (precision-- > 0) {
+		fract *= 10U;
+		*buf++ = (char)(fract >> 60) + '0';
+		fract &= BIT64(60) - 1U;
+	}
+
+	/* Round on the remainder, propagating the carry up the digits */
+	char *dp = buf;
+
+	while ((dp > sp) && (*(dp - 1) == '.')) {
+		--dp;
+	}
+
+	if ((fract > BIT64(59)) ||
+	    ((fract == BIT64(59)) && (((*(dp - 1) - '0') & 1) != 0))) {
+		while (dp > sp) {
+			--dp;
+			if (*dp == '.') {
+				continue;
+			}
+			if (*dp != '9') {
+				++*dp;
+				return buf;
+			}
+			*dp = '0';
+		}
+
+		/* Carried out of the leading digit */
+		(void)memmove(sp + 1, sp, buf - sp);
+		*sp = '1';
+		++buf;
+	}
+
+	return buf;
+}
+#endif
+
 /* Convert the IEEE 754-2008 double to text format.
  *
  * @param value the 64-bit floating point value.
@@ -938,6 +1090,18 @@ static char *encode_float(double value,
 		c = 'f';
 	}
 
+#ifdef CONFIG_CBPRINTF_FAST_CONV
+	if (c == 'f') {
+		char *fbe = encode_float_fixed(u.u64, conv, precision, buf);
+
+		if (fbe != NULL) {
+			*bpe = fbe;
+			*fbe = 0;
+			return bps;
+		}
+	}
+#endif
+
 	/* Handle converting to the hex representation. */
 	if (IS_ENABLED(CONFIG_CBPRINTF_FP_A_SUPPORT)
 	    && (IS_ENABLED(CONFIG_CBPRINTF_FP_ALWAYS_A)
@@ -1374,7 +1538,17 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 
 	while (*fp != 0) {
 		if (*fp != '%') {
-			OUTC(*fp++);
+			if (IS_ENABLED(CONFIG_CBPRINTF_FAST_CONV)) {
+				/* Emit the run of literal text at once */
+				const char *sp = fp;
+
+				while ((*fp != 0) && (*fp != '%')) {
+					++fp;
+				}
+				OUTS(sp, fp);
+			} else {
+				OUTC(*fp++);
+			}
 			continue;
 		}
 
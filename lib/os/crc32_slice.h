@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LIB_OS_CRC32_SLICE_H_
+#define ZEPHYR_LIB_OS_CRC32_SLICE_H_
+
+#include <zephyr/sys/byteorder.h>
+
+#ifdef CONFIG_CRC32_SLICE_BY_8
+#define CRC32_SLICES 8
+#else
+#define CRC32_SLICES 4
+#endif
+
+/*
+ * Update a reflected CRC-32 four or eight bytes at a time (slicing-by-4/8).
+ * Table 0 is the usual byte-wise table, table k gives the CRC of a byte
+ * followed by k zero bytes. The CRC is neither inverted on entry nor on
+ * exit.
+ */
+static inline uint32_t crc32_slice_update(const uint32_t table[CRC32_SLICES][256],
+					  uint32_t crc, const uint8_t *data,
+					  size_t len)
+{
+#ifdef CONFIG_CRC32_SLICE_BY_8
+	for (; len >= 8; len -= 8, data += 8) {
+		uint32_t one = crc ^ sys_get_le32(data);
+		uint32_t two = sys_get_le32(data + 4);
+
+		crc = table[7][one & 0xff] ^ table[6][(one >> 8) & 0xff] ^
+		      table[5][(one >> 16) & 0xff] ^ table[4][one >> 24] ^
+		      table[3][two & 0xff] ^ table[2][(two >> 8) & 0xff] ^
+		      table[1][(two >> 16) & 0xff] ^ table[0][two >> 24];
+	}
+#endif
+
+	for (; len >= 4; len -= 4, data += 4) {
+		crc ^= sys_get_le32(data);
+		crc = table[3][crc & 0xff] ^ table[2][(crc >> 8) & 0xff] ^
+		      table[1][(crc >> 16) & 0xff] ^ table[0][crc >> 24];
+	}
+
+	for (; len > 0; len--, data++) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xff];
+	}
+
+	return crc;
+}
+
+#endif /* ZEPHYR_LIB_OS_CRC32_SLICE_H_ */
@@ -60,6 +60,17 @@ static struct fd_entry fdtable[CONFIG_POSIX_MAX_FDS] = {
 #endif
 };
 
+/*
+ * Bitmap of the entries in use, so that allocation does not have to look at
+ * the reference count of each entry. A bit is set when the entry is reserved
+ * and cleared once the entry has been released and cleaned up.
+ */
+static atomic_t fdtable_used[ATOMIC_BITMAP_SIZE(CONFIG_POSIX_MAX_FDS)] = {
+#ifdef CONFIG_POSIX_API
+	ATOMIC_INIT(BIT_MASK(3)),
+#endif
+};
+
 static K_MUTEX_DEFINE(fdtable_lock);
 
 static int z_fd_ref(int fd)
@@ -89,16 +100,23 @@ static int z_fd_unref(int fd)
 
 	fdtable[fd].obj = NULL;
 	fdtable[fd].vtable = NULL;
+	atomic_clear_bit(fdtable_used, fd);
 
 	return 0;
 }
 
 static int _find_fd_entry(void)
 {
-	int fd;
+	for (int i = 0; i < ARRAY_SIZE(fdtable_used); i++) {
+		atomic_val_t free = ~atomic_get(&fdtable_used[i]);
+		int fd;
 
-	for (fd = 0; fd < ARRAY_SIZE(fdtable); fd++) {
-		if (!atomic_get(&fdtable[fd].refcount)) {
+		if (free == 0) {
+			continue;
+		}
+
+		fd = i * ATOMIC_BITS + __builtin_ctzl((unsigned long)free);
+		if (fd < ARRAY_SIZE(fdtable)) {
 			return fd;
 		}
 	}
@@ -208,6 +226,7 @@ int z_reserve_fd(void)
 	fd = _find_fd_entry();
 	if (fd >= 0) {
 		/* Mark entry as used, z_finalize_fd() will fill it in. */
+		atomic_set_bit(fdtable_used, fd);
 		(void)z_fd_ref(fd);
 		fdtable[fd].obj = NULL;
 		fdtable[fd].vtable = NULL;
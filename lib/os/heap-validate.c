@@ -56,7 +56,7 @@ static inline void check_nexts(struct z_heap *h, int bidx)
 {
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
-	bool emptybit = (h->avail_buckets & BIT(bidx)) == 0;
+	bool emptybit = !free_list_avail(h, bidx);
 	bool emptylist = b->next == 0;
 	bool empties_match = emptybit == emptylist;
 
@@ -114,6 +114,15 @@ bool sys_heap_validate(struct sys_heap *heap)
 
 	get_alloc_info(h, &allocated_bytes, &free_bytes);
 	sys_heap_runtime_stats_get(heap, &stat);
+#ifdef CONFIG_KHEAP_MAGAZINES
+	/* Blocks parked in magazines are allocated as far as the heap
+	 * itself is concerned
+	 */
+	size_t cached = (size_t)atomic_get(&heap->cached_bytes);
+
+	stat.allocated_bytes += cached;
+	stat.free_bytes -= cached;
+#endif
 	if ((stat.allocated_bytes != allocated_bytes) ||
 	    (stat.free_bytes != free_bytes)) {
 		return false;
@@ -124,7 +133,7 @@ bool sys_heap_validate(struct sys_heap *heap)
 	 * should be correct, and all chunk entries should point into
 	 * valid unused chunks.  Mark those chunks USED, temporarily.
 	 */
-	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
+	for (int b = 0; b < nb_free_lists(h); b++) {
 		chunkid_t c0 = h->buckets[b].next;
 		uint32_t n = 0;
 
@@ -138,7 +147,7 @@ bool sys_heap_validate(struct sys_heap *heap)
 			set_chunk_used(h, c, true);
 		}
 
-		bool empty = (h->avail_buckets & BIT(b)) == 0;
+		bool empty = !free_list_avail(h, b);
 		bool zero = n == 0;
 
 		if (empty != zero) {
@@ -150,6 +159,19 @@ bool sys_heap_validate(struct sys_heap *heap)
 		}
 	}
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+	/* A first level bit is set exactly when its class has a
+	 * non-empty second level list
+	 */
+	for (int fl = 0; fl <= bucket_idx(h, h->end_chunk); fl++) {
+		bool fl_empty = (h->avail_buckets & BIT(fl)) == 0;
+
+		if (fl_empty != (sl_bitmaps(h)[fl] == 0U)) {
+			return false;
+		}
+	}
+#endif
+
 	/*
 	 * Walk through the chunks linearly again, verifying that all chunks
 	 * but solo headers are now USED (i.e. all free blocks were found
@@ -176,7 +198,7 @@ bool sys_heap_validate(struct sys_heap *heap)
 	 * pass caught all the blocks and that they now show UNUSED.
 	 * Mark them USED.
 	 */
-	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
+	for (int b = 0; b < nb_free_lists(h); b++) {
 		chunkid_t c0 = h->buckets[b].next;
 		int n = 0;
 
@@ -350,7 +372,7 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
  */
 void heap_print_info(struct z_heap *h, bool dump_chunks)
 {
-	int i, nb_buckets = bucket_idx(h, h->end_chunk) + 1;
+	int i, nb_buckets = nb_free_lists(h);
 	size_t free_bytes, allocated_bytes, total, overhead;
 
 	printk("Heap at %p contains %d units in %d buckets\n\n",
@@ -374,7 +396,7 @@ void heap_print_info(struct z_heap *h, bool dump_chunks)
 		}
 		if (count) {
 			printk("%9d %12d %12d %12d %12zd\n",
-			       i, (1 << i) - 1 + min_chunk_size(h), count,
+			       i, free_list_min_size(h, i), count,
 			       largest, chunksz_to_bytes(h, largest));
 		}
 	}
@@ -424,6 +446,14 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
 	stats->allocated_bytes = heap->heap->allocated_bytes;
 	stats->max_allocated_bytes = heap->heap->max_allocated_bytes;
 
+#ifdef CONFIG_KHEAP_MAGAZINES
+	/* Blocks parked in k_heap magazines are free to their users */
+	size_t cached = (size_t)atomic_get(&heap->cached_bytes);
+
+	stats->free_bytes += cached;
+	stats->allocated_bytes -= cached;
+#endif
+
 	return 0;
 }
 
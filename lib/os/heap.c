@@ -31,17 +31,41 @@ static void *chunk_mem(struct z_heap *h, chunkid_t c)
 	return ret;
 }
 
+static void free_list_set_avail(struct z_heap *h, int bidx, bool avail)
+{
+#ifdef CONFIG_SYS_HEAP_TLSF
+	int fl = list_fl(bidx);
+	uint32_t *sl_map = &sl_bitmaps(h)[fl];
+
+	if (avail) {
+		*sl_map |= BIT(bidx - fl_base(fl));
+		h->avail_buckets |= BIT(fl);
+	} else {
+		*sl_map &= ~BIT(bidx - fl_base(fl));
+		if (*sl_map == 0U) {
+			h->avail_buckets &= ~BIT(fl);
+		}
+	}
+#else
+	if (avail) {
+		h->avail_buckets |= BIT(bidx);
+	} else {
+		h->avail_buckets &= ~BIT(bidx);
+	}
+#endif
+}
+
 static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 {
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
 	CHECK(!chunk_used(h, c));
 	CHECK(b->next != 0);
-	CHECK(h->avail_buckets & BIT(bidx));
+	CHECK(free_list_avail(h, bidx));
 
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
-		h->avail_buckets &= ~BIT(bidx);
+		free_list_set_avail(h, bidx, false);
 		b->next = 0;
 	} else {
 		chunkid_t first = prev_free_chunk(h, c),
@@ -60,7 +84,7 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 static void free_list_remove(struct z_heap *h, chunkid_t c)
 {
 	if (!solo_free_header(h, c)) {
-		int bidx = bucket_idx(h, chunk_size(h, c));
+		int bidx = free_list_idx(h, chunk_size(h, c));
 		free_list_remove_bidx(h, c, bidx);
 	}
 }
@@ -70,15 +94,15 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
 	if (b->next == 0U) {
-		CHECK((h->avail_buckets & BIT(bidx)) == 0);
+		CHECK(!free_list_avail(h, bidx));
 
 		/* Empty list, first item */
-		h->avail_buckets |= BIT(bidx);
+		free_list_set_avail(h, bidx, true);
 		b->next = c;
 		set_prev_free_chunk(h, c, c);
 		set_next_free_chunk(h, c, c);
 	} else {
-		CHECK(h->avail_buckets & BIT(bidx));
+		CHECK(free_list_avail(h, bidx));
 
 		/* Insert before (!) the "next" pointer */
 		chunkid_t second = b->next;
@@ -98,7 +122,7 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 static void free_list_add(struct z_heap *h, chunkid_t c)
 {
 	if (!solo_free_header(h, c)) {
-		int bidx = bucket_idx(h, chunk_size(h, c));
+		int bidx = free_list_idx(h, chunk_size(h, c));
 		free_list_add_bidx(h, c, bidx);
 	}
 }
@@ -208,6 +232,93 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
+#ifdef CONFIG_KHEAP_MAGAZINES
+void z_sys_heap_cache_account(struct sys_heap *heap, void *mem, bool cached)
+{
+	struct z_heap *h = heap->heap;
+	chunkid_t c = mem_to_chunkid(h, mem);
+	size_t bytes = chunksz_to_bytes(h, chunk_size(h, c));
+
+	ARG_UNUSED(bytes);
+	__ASSERT(chunk_used(h, c), "caching free memory at %p", mem);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	if (cached) {
+		(void)atomic_add(&heap->cached_bytes, (atomic_val_t)bytes);
+	} else {
+		(void)atomic_sub(&heap->cached_bytes, (atomic_val_t)bytes);
+	}
+#endif
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	if (cached) {
+		heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem, bytes);
+	} else {
+		heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem, bytes);
+	}
+#endif
+}
+#endif
+
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Good fit in two bitmap lookups: round the request up to the next
+ * second level boundary so any chunk in the list found is big enough,
+ * then take the first non-empty list at or above it.  Only if that
+ * fails is the head of the request's own list checked, which may
+ * still hold a chunk that fits.
+ */
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+{
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+	int fl = 31 - __builtin_clz(usable_sz);
+	int bi = free_list_idx(h, sz);
+
+	if (fl > SL_BITS) {
+		usable_sz += BIT(fl - SL_BITS) - 1;
+		fl = 31 - __builtin_clz(usable_sz);
+	}
+
+	CHECK(bi < nb_free_lists(h));
+
+	uint32_t *sl_maps = sl_bitmaps(h);
+	uint32_t smask = 0U;
+
+	if (fl <= bucket_idx(h, h->end_chunk)) {
+		int shift = sl_shift(fl);
+		unsigned int sl = (usable_sz >> shift) - BIT(fl - shift);
+
+		smask = sl_maps[fl] & ~BIT_MASK(sl);
+		if (smask == 0U) {
+			uint32_t fmask = h->avail_buckets & ~BIT_MASK(fl + 1);
+
+			if (fmask != 0U) {
+				fl = __builtin_ctz(fmask);
+				smask = sl_maps[fl];
+			}
+		}
+	}
+
+	if (smask != 0U) {
+		int fit = fl_base(fl) + __builtin_ctz(smask);
+		chunkid_t c = h->buckets[fit].next;
+
+		free_list_remove_bidx(h, c, fit);
+		CHECK(chunk_size(h, c) >= sz);
+		return c;
+	}
+
+	if (free_list_avail(h, bi)) {
+		chunkid_t c = h->buckets[bi].next;
+
+		if (chunk_size(h, c) >= sz) {
+			free_list_remove_bidx(h, c, bi);
+			return c;
+		}
+	}
+
+	return 0;
+}
+#else
 static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 {
 	int bi = bucket_idx(h, sz);
@@ -259,8 +370,9 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 
 	return 0;
 }
+#endif
 
-void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+static void *heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	void *mem;
@@ -298,7 +410,7 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	return mem;
 }
 
-void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+static void *heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	size_t gap, rew;
@@ -316,7 +428,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 		gap = MIN(rew, chunk_header_bytes(h));
 	} else {
 		if (align <= chunk_header_bytes(h)) {
-			return sys_heap_alloc(heap, bytes);
+			return heap_alloc(heap, bytes);
 		}
 		rew = 0;
 		gap = chunk_header_bytes(h);
@@ -376,14 +488,38 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	return mem;
 }
 
-void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
-			       size_t align, size_t bytes)
+void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+{
+	void *mem = heap_alloc(heap, bytes);
+
+	z_sys_heap_profile_record(heap, Z_SYS_HEAP_SITE(), bytes, mem != NULL);
+
+	return mem;
+}
+
+void *z_sys_heap_aligned_alloc_at(struct sys_heap *heap, size_t align,
+				  size_t bytes, void *site)
+{
+	void *mem = heap_aligned_alloc(heap, align, bytes);
+
+	z_sys_heap_profile_record(heap, site, bytes, mem != NULL);
+
+	return mem;
+}
+
+void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+{
+	return z_sys_heap_aligned_alloc_at(heap, align, bytes, Z_SYS_HEAP_SITE());
+}
+
+static void *heap_aligned_realloc(struct sys_heap *heap, void *ptr,
+				  size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 
 	/* special realloc semantics */
 	if (ptr == NULL) {
-		return sys_heap_aligned_alloc(heap, align, bytes);
+		return heap_aligned_alloc(heap, align, bytes);
 	}
 	if (bytes == 0) {
 		sys_heap_free(heap, ptr);
@@ -471,7 +607,7 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	 * The calls to allocation and free functions generate
 	 * notification already, so there is no need to those here.
 	 */
-	void *ptr2 = sys_heap_aligned_alloc(heap, align, bytes);
+	void *ptr2 = heap_aligned_alloc(heap, align, bytes);
 
 	if (ptr2 != NULL) {
 		size_t prev_size = chunksz_to_bytes(h, chunk_size(h, c)) - align_gap;
@@ -482,6 +618,18 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	return ptr2;
 }
 
+void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
+			       size_t align, size_t bytes)
+{
+	void *mem = heap_aligned_realloc(heap, ptr, align, bytes);
+
+	if (bytes != 0U) {
+		z_sys_heap_profile_record(heap, Z_SYS_HEAP_SITE(), bytes, mem != NULL);
+	}
+
+	return mem;
+}
+
 void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 {
 	IF_ENABLED(CONFIG_MSAN, (__sanitizer_dtor_callback(mem, bytes)));
@@ -508,6 +656,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 
 	struct z_heap *h = (struct z_heap *)addr;
 	heap->heap = h;
+#if defined(CONFIG_KHEAP_MAGAZINES) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+	atomic_clear(&heap->cached_bytes);
+#endif
+#ifdef CONFIG_SYS_HEAP_PROFILE
+	heap->profile = NULL;
+#endif
 	h->end_chunk = heap_sz;
 	h->avail_buckets = 0;
 
@@ -517,15 +671,27 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->max_allocated_bytes = 0;
 #endif
 
-	int nb_buckets = bucket_idx(h, heap_sz) + 1;
-	chunksz_t chunk0_size = chunksz(sizeof(struct z_heap) +
-				     nb_buckets * sizeof(struct z_heap_bucket));
+	int nb_buckets = nb_free_lists(h);
+	size_t lists_bytes = nb_buckets * sizeof(struct z_heap_bucket);
+
+#ifdef CONFIG_SYS_HEAP_TLSF
+	int nb_fl = bucket_idx(h, heap_sz) + 1;
+
+	lists_bytes += nb_fl * sizeof(uint32_t);
+#endif
+
+	chunksz_t chunk0_size = chunksz(sizeof(struct z_heap) + lists_bytes);
 
 	__ASSERT(chunk0_size + min_chunk_size(h) <= heap_sz, "heap size is too small");
 
 	for (int i = 0; i < nb_buckets; i++) {
 		h->buckets[i].next = 0;
 	}
+#ifdef CONFIG_SYS_HEAP_TLSF
+	for (int i = 0; i < nb_fl; i++) {
+		sl_bitmaps(h)[i] = 0;
+	}
+#endif
 
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
@@ -41,7 +41,8 @@
  *   FREE_NEXT: Chunk ID of the next node in a free list.
  *
  * The free lists are circular lists, one for each power-of-two size
- * category.  The free list pointers exist only for free chunks,
+ * category (or a fixed number of linear subdivisions of each with
+ * CONFIG_SYS_HEAP_TLSF).  The free list pointers exist only for free chunks,
  * obviously.  This memory is part of the user's buffer when
  * allocated.
  *
@@ -253,6 +254,100 @@ static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 	return 31 - __builtin_clz(usable_sz);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/*
+ * Two-level segregated fit: each power-of-two bucket above is a
+ * "first level" class, split linearly into up to 2^SL_BITS "second
+ * level" free lists.  Small classes hold fewer distinct sizes than
+ * that and get one list per size.  avail_buckets has a bit per first
+ * level class, and an array of per-class second level bitmaps
+ * follows the list heads in chunk0.
+ */
+#define SL_BITS CONFIG_SYS_HEAP_TLSF_SL_BITS
+#define SL_COUNT BIT(SL_BITS)
+
+/* Index of the first free list of first level class fl */
+static inline int fl_base(int fl)
+{
+	return (fl <= SL_BITS) ? (int)BIT(fl) - 1
+			       : (int)SL_COUNT - 1 + (fl - SL_BITS) * (int)SL_COUNT;
+}
+
+/* First level class owning free list idx */
+static inline int list_fl(int idx)
+{
+	if (idx < (int)SL_COUNT - 1) {
+		return 31 - __builtin_clz(idx + 1);
+	}
+	return SL_BITS + (idx - ((int)SL_COUNT - 1)) / (int)SL_COUNT;
+}
+
+/* Log2 of the size range covered by one list of class fl */
+static inline int sl_shift(int fl)
+{
+	return (fl > SL_BITS) ? fl - SL_BITS : 0;
+}
+
+/* Free list holding chunks of size sz */
+static inline int free_list_idx(struct z_heap *h, chunksz_t sz)
+{
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+	int fl = 31 - __builtin_clz(usable_sz);
+	int shift = sl_shift(fl);
+
+	return fl_base(fl) + (int)(usable_sz >> shift) - (int)BIT(fl - shift);
+}
+
+/* No chunk can be bigger than the heap, so the top class gets only
+ * the lists it can actually use.
+ */
+static inline int nb_free_lists(struct z_heap *h)
+{
+	return free_list_idx(h, h->end_chunk) + 1;
+}
+
+static inline uint32_t *sl_bitmaps(struct z_heap *h)
+{
+	return (uint32_t *)&h->buckets[nb_free_lists(h)];
+}
+
+/* Smallest chunk size held by free list idx */
+static inline chunksz_t free_list_min_size(struct z_heap *h, int idx)
+{
+	int fl = list_fl(idx);
+	unsigned int sl = idx - fl_base(fl);
+
+	return BIT(fl) + (sl << sl_shift(fl)) - 1 + min_chunk_size(h);
+}
+
+static inline bool free_list_avail(struct z_heap *h, int idx)
+{
+	int fl = list_fl(idx);
+
+	return (sl_bitmaps(h)[fl] & BIT(idx - fl_base(fl))) != 0U;
+}
+#else
+static inline int nb_free_lists(struct z_heap *h)
+{
+	return bucket_idx(h, h->end_chunk) + 1;
+}
+
+static inline int free_list_idx(struct z_heap *h, chunksz_t sz)
+{
+	return bucket_idx(h, sz);
+}
+
+static inline chunksz_t free_list_min_size(struct z_heap *h, int idx)
+{
+	return BIT(idx) - 1 + min_chunk_size(h);
+}
+
+static inline bool free_list_avail(struct z_heap *h, int idx)
+{
+	return (h->avail_buckets & BIT(idx)) != 0U;
+}
+#endif
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
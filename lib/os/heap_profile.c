@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/heap_profile.h>
+#include <zephyr/sys/util.h>
+#include "heap.h"
+
+#ifdef CONFIG_SYS_HEAP_PROFILE_STATS
+STATS_NAME_START(heap_profile)
+STATS_NAME(heap_profile, allocs)
+STATS_NAME(heap_profile, failures)
+STATS_NAME(heap_profile, max_allocated)
+STATS_NAME(heap_profile, free_bytes)
+STATS_NAME(heap_profile, largest_free)
+STATS_NAME(heap_profile, frag_permille)
+STATS_NAME_END(heap_profile);
+
+#define PROF_STATS_INC(prof, var) STATS_INC((prof)->stats, var)
+#define PROF_STATS_SET(prof, var, n) STATS_SET((prof)->stats, var, n)
+#else
+#define PROF_STATS_INC(prof, var)
+#define PROF_STATS_SET(prof, var, n)
+#endif
+
+static sys_slist_t profiles = SYS_SLIST_STATIC_INIT(&profiles);
+static struct k_spinlock profiles_lock;
+
+static unsigned int size_class(size_t bytes)
+{
+	unsigned int cls = 0;
+
+	while (cls < SYS_HEAP_PROFILE_SIZE_CLASSES - 1 && bytes > ((size_t)8 << cls)) {
+		cls++;
+	}
+
+	return cls;
+}
+
+/* Open addressing on the return address, whose low bits are mostly
+ * instruction alignment
+ */
+static struct sys_heap_profile_site *site_get(struct sys_heap_profile *prof,
+					      void *site)
+{
+	unsigned int n = ARRAY_SIZE(prof->sites);
+	unsigned int i = ((uintptr_t)site >> 2) % n;
+
+	for (unsigned int probe = 0; probe < n; probe++) {
+		struct sys_heap_profile_site *s = &prof->sites[i];
+
+		if (s->site == site) {
+			return s;
+		}
+		if (s->site == NULL) {
+			s->site = site;
+			return s;
+		}
+		i = (i + 1 == n) ? 0 : i + 1;
+	}
+
+	return NULL;
+}
+
+void z_sys_heap_profile_log(struct sys_heap *heap, void *site, size_t bytes,
+			    bool ok)
+{
+	struct sys_heap_profile *prof = heap->profile;
+	k_spinlock_key_t key = k_spin_lock(&prof->lock);
+	struct sys_heap_profile_site *s = site_get(prof, site);
+
+	if (ok) {
+		prof->allocs++;
+		prof->sizes[size_class(bytes)]++;
+		prof->max_request = MAX(prof->max_request, bytes);
+		PROF_STATS_INC(prof, allocs);
+	} else {
+		prof->failures++;
+		PROF_STATS_INC(prof, failures);
+	}
+
+	if (s == NULL) {
+		prof->other_sites++;
+	} else if (ok) {
+		s->count++;
+		s->bytes += bytes;
+	} else {
+		s->failures++;
+	}
+
+	k_spin_unlock(&prof->lock, key);
+}
+
+int sys_heap_profile_attach(struct sys_heap *heap, struct sys_heap_profile *prof,
+			    const char *name, struct k_spinlock *heap_lock)
+{
+	k_spinlock_key_t key;
+
+	if (heap->profile != NULL) {
+		return -EALREADY;
+	}
+
+	*prof = (struct sys_heap_profile) {
+		.heap_lock = heap_lock,
+		.name = name,
+		.heap = heap,
+	};
+
+#ifdef CONFIG_SYS_HEAP_PROFILE_STATS
+	stats_init(&prof->stats.s_hdr, STATS_SIZE_32,
+		   (sizeof(prof->stats) - sizeof(struct stats_hdr)) / STATS_SIZE_32,
+		   STATS_NAME_INIT_PARMS(heap_profile));
+	(void)stats_register(name, &prof->stats.s_hdr);
+#endif
+
+	key = k_spin_lock(&profiles_lock);
+	sys_slist_append(&profiles, &prof->node);
+	k_spin_unlock(&profiles_lock, key);
+
+	/* Publish last: allocations start recording from here on */
+	heap->profile = prof;
+
+	return 0;
+}
+
+void sys_heap_profile_reset(struct sys_heap_profile *prof)
+{
+	k_spinlock_key_t key = k_spin_lock(&prof->lock);
+
+	prof->allocs = 0;
+	prof->failures = 0;
+	prof->other_sites = 0;
+	prof->max_request = 0;
+	(void)memset(prof->sizes, 0, sizeof(prof->sizes));
+	(void)memset(prof->sites, 0, sizeof(prof->sites));
+	PROF_STATS_SET(prof, allocs, 0);
+	PROF_STATS_SET(prof, failures, 0);
+
+	k_spin_unlock(&prof->lock, key);
+}
+
+void sys_heap_frag_get(struct sys_heap *heap, struct sys_heap_frag_info *info)
+{
+	struct z_heap *h = heap->heap;
+
+	*info = (struct sys_heap_frag_info) { 0 };
+
+	for (int b = 0; b < nb_free_lists(h); b++) {
+		chunkid_t c0 = h->buckets[b].next;
+		chunkid_t c = c0;
+
+		if (c0 == 0) {
+			continue;
+		}
+
+		do {
+			size_t bytes = chunksz_to_bytes(h, chunk_size(h, c));
+
+			info->free_bytes += bytes;
+			info->largest_free = MAX(info->largest_free, bytes);
+			info->free_chunks++;
+			c = next_free_chunk(h, c);
+		} while (c != c0);
+	}
+
+	if (info->free_bytes != 0U) {
+		info->frag_permille = 1000U - (uint32_t)(((uint64_t)info->largest_free * 1000U) /
+							 info->free_bytes);
+	}
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	info->max_allocated = h->max_allocated_bytes;
+#endif
+}
+
+void sys_heap_profile_frag_get(struct sys_heap_profile *prof,
+			       struct sys_heap_frag_info *info)
+{
+	k_spinlock_key_t key;
+
+	if (prof->heap_lock != NULL) {
+		key = k_spin_lock(prof->heap_lock);
+		sys_heap_frag_get(prof->heap, info);
+		k_spin_unlock(prof->heap_lock, key);
+	} else {
+		sys_heap_frag_get(prof->heap, info);
+	}
+
+	PROF_STATS_SET(prof, max_allocated, info->max_allocated);
+	PROF_STATS_SET(prof, free_bytes, info->free_bytes);
+	PROF_STATS_SET(prof, largest_free, info->largest_free);
+	PROF_STATS_SET(prof, frag_permille, info->frag_permille);
+}
+
+void sys_heap_profile_foreach(sys_heap_profile_cb_t cb, void *user_data)
+{
+	struct sys_heap_profile *prof;
+
+	/* Profiles are only ever appended, so the list can be walked
+	 * without holding the lock across callbacks
+	 */
+	SYS_SLIST_FOR_EACH_CONTAINER(&profiles, prof, node) {
+		cb(prof, user_data);
+	}
+}
+
+struct sys_heap_profile *sys_heap_profile_find(const char *name)
+{
+	struct sys_heap_profile *prof;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&profiles, prof, node) {
+		if (strcmp(prof->name, name) == 0) {
+			return prof;
+		}
+	}
+
+	return NULL;
+}
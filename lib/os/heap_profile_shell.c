@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/heap_profile.h>
+
+static void print_summary(struct sys_heap_profile *prof, void *user_data)
+{
+	const struct shell *sh = user_data;
+	struct sys_heap_frag_info info;
+
+	sys_heap_profile_frag_get(prof, &info);
+
+	shell_print(sh, "%-16s %10u %8u %10zu %10zu %10zu %5u.%u%%", prof->name,
+		    prof->allocs, prof->failures, info.max_allocated, info.free_bytes,
+		    info.largest_free, info.frag_permille / 10U, info.frag_permille % 10U);
+}
+
+static int cmd_list(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-16s %10s %8s %10s %10s %10s %7s", "name", "allocs", "failed",
+		    "max used", "free", "largest", "frag");
+	sys_heap_profile_foreach(print_summary, (void *)sh);
+
+	return 0;
+}
+
+static struct sys_heap_profile *get_profile(const struct shell *sh, const char *name)
+{
+	struct sys_heap_profile *prof = sys_heap_profile_find(name);
+
+	if (prof == NULL) {
+		shell_error(sh, "no heap profile named '%s'", name);
+	}
+
+	return prof;
+}
+
+static int cmd_show(const struct shell *sh, size_t argc, char **argv)
+{
+	struct sys_heap_profile *prof = get_profile(sh, argv[1]);
+	struct sys_heap_profile_site site;
+	struct sys_heap_frag_info info;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(argc);
+
+	if (prof == NULL) {
+		return -ENOENT;
+	}
+
+	sys_heap_profile_frag_get(prof, &info);
+
+	shell_print(sh, "allocs:         %u", prof->allocs);
+	shell_print(sh, "failed:         %u", prof->failures);
+	shell_print(sh, "max. request:   %zu", prof->max_request);
+	shell_print(sh, "max. allocated: %zu", info.max_allocated);
+	shell_print(sh, "free:           %zu in %zu chunks", info.free_bytes, info.free_chunks);
+	shell_print(sh, "largest free:   %zu", info.largest_free);
+	shell_print(sh, "fragmentation:  %u.%u%%", info.frag_permille / 10U,
+		    info.frag_permille % 10U);
+
+	shell_print(sh, "\nrequest size   allocs");
+	for (int i = 0; i < SYS_HEAP_PROFILE_SIZE_CLASSES; i++) {
+		if (i == SYS_HEAP_PROFILE_SIZE_CLASSES - 1) {
+			shell_print(sh, "> %-10zu %8u", (size_t)8 << (i - 1), prof->sizes[i]);
+		} else {
+			shell_print(sh, "<= %-9zu %8u", (size_t)8 << i, prof->sizes[i]);
+		}
+	}
+
+	shell_print(sh, "\n%-18s %10s %8s %12s", "call site", "allocs", "failed", "bytes");
+	for (size_t i = 0; i < ARRAY_SIZE(prof->sites); i++) {
+		/* Copy out under the lock, print without it */
+		key = k_spin_lock(&prof->lock);
+		site = prof->sites[i];
+		k_spin_unlock(&prof->lock, key);
+
+		if (site.site != NULL) {
+			shell_print(sh, "%-18p %10u %8u %12llu", site.site, site.count,
+				    site.failures, (unsigned long long)site.bytes);
+		}
+	}
+	if (prof->other_sites != 0U) {
+		shell_print(sh, "%-18s %10u", "(other sites)", prof->other_sites);
+	}
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	struct sys_heap_profile *prof = get_profile(sh, argv[1]);
+
+	ARG_UNUSED(argc);
+
+	if (prof == NULL) {
+		return -ENOENT;
+	}
+
+	sys_heap_profile_reset(prof);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_heap_profile,
+	SHELL_CMD_ARG(list, NULL, "List profiled heaps", cmd_list, 1, 0),
+	SHELL_CMD_ARG(show, NULL, "Show call sites and size classes of a heap\n"
+		      "Usage: heap_profile show <name>", cmd_show, 2, 0),
+	SHELL_CMD_ARG(reset, NULL, "Clear the counters of a heap profile\n"
+		      "Usage: heap_profile reset <name>", cmd_reset, 2, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(heap_profile, &sub_heap_profile, "Heap profiler", NULL);
@@ -16,6 +16,9 @@
 #include <zephyr/types.h>
 
 #include <zephyr/data/json.h>
+#ifdef CONFIG_NET_BUF
+#include <zephyr/net/buf.h>
+#endif
 
 struct json_obj_key_value {
 	const char *key;
@@ -94,7 +97,15 @@ static void *lexer_string(struct json_lexer *lex)
 	ignore(lex);
 
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+		/* Skip plain characters without going through next() */
+		while (lex->pos < lex->end && *lex->pos != '"' && *lex->pos != '\\' &&
+		       *lex->pos != '\0') {
+			lex->pos++;
+		}
+
+		chr = next(lex);
 
 		if (chr == '\0') {
 			emit(lex, JSON_TOK_ERROR);
@@ -805,18 +816,24 @@ static int json_escape_internal(const char *str,
 				json_append_bytes_t append_bytes,
 				void *data)
 {
-	const char *cur;
+	const char *cur = str;
+	const char *run;
 	int ret = 0;
 
-	for (cur = str; ret == 0 && *cur; cur++) {
-		char escaped = escape_as(*cur);
+	while (ret == 0 && *cur) {
+		/* Append characters which need no escaping in one go */
+		for (run = cur; *cur && !escape_as(*cur); cur++) {
+		}
+
+		if (cur != run) {
+			ret = append_bytes(run, cur - run, data);
+		}
 
-		if (escaped) {
-			char bytes[2] = { '\\', escaped };
+		if (ret == 0 && *cur) {
+			char bytes[2] = { '\\', escape_as(*cur) };
 
 			ret = append_bytes(bytes, 2, data);
-		} else {
-			ret = append_bytes(cur, 1, data);
+			cur++;
 		}
 	}
 
@@ -1128,6 +1145,42 @@ int json_arr_encode_buf(const struct json_obj_descr *descr, const void *val,
 	return json_arr_encode(descr, val, append_bytes_to_buf, &appender);
 }
 
+#ifdef CONFIG_NET_BUF
+struct net_buf_appender {
+	struct net_buf *buf;
+	k_timeout_t timeout;
+};
+
+static int append_bytes_to_net_buf(const char *bytes, size_t len, void *data)
+{
+	struct net_buf_appender *appender = data;
+
+	if (net_buf_append_bytes(appender->buf, len, bytes, appender->timeout,
+				 NULL, NULL) < len) {
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+int json_obj_encode_net_buf(const struct json_obj_descr *descr, size_t descr_len,
+			    const void *val, struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf_appender appender = { .buf = buf, .timeout = timeout };
+
+	return json_obj_encode(descr, descr_len, val, append_bytes_to_net_buf,
+			       &appender);
+}
+
+int json_arr_encode_net_buf(const struct json_obj_descr *descr, const void *val,
+			    struct net_buf *buf, k_timeout_t timeout)
+{
+	struct net_buf_appender appender = { .buf = buf, .timeout = timeout };
+
+	return json_arr_encode(descr, val, append_bytes_to_net_buf, &appender);
+}
+#endif /* CONFIG_NET_BUF */
+
 static int measure_bytes(const char *bytes, size_t len, void *data)
 {
 	ssize_t *total = data;
@@ -1166,3 +1219,262 @@ ssize_t json_calc_encoded_arr_len(const struct json_obj_descr *descr,
 
 	return total;
 }
+
+enum json_stream_state {
+	STREAM_VALUE,
+	STREAM_STRING,
+	STREAM_STRING_ESCAPE,
+	STREAM_STRING_UNICODE,
+	STREAM_NUMBER,
+	STREAM_LITERAL,
+	STREAM_ERROR,
+};
+
+void json_stream_init(struct json_stream *stream, char *buf, size_t buf_size,
+		      json_stream_cb_t cb, void *user_data)
+{
+	stream->cb = cb;
+	stream->user_data = user_data;
+	stream->buf = buf;
+	stream->buf_size = buf_size;
+	stream->len = 0;
+	stream->literal = NULL;
+	stream->state = STREAM_VALUE;
+	stream->type = JSON_TOK_NONE;
+	stream->unicode_left = 0;
+}
+
+static int stream_hold(struct json_stream *stream, const char *start, size_t len)
+{
+	if (len > stream->buf_size - stream->len) {
+		return -ENOMEM;
+	}
+
+	memcpy(&stream->buf[stream->len], start, len);
+	stream->len += len;
+
+	return 0;
+}
+
+/* Emit the token ending at end, held partly in the buffer if it spans chunks */
+static int stream_emit(struct json_stream *stream, const char *start, const char *end)
+{
+	int ret;
+
+	stream->state = STREAM_VALUE;
+
+	if (stream->len == 0) {
+		return stream->cb(stream->type, start, end - start, stream->user_data);
+	}
+
+	if (end != start) {
+		ret = stream_hold(stream, start, end - start);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	ret = stream->cb(stream->type, stream->buf, stream->len, stream->user_data);
+	stream->len = 0;
+
+	return ret;
+}
+
+static inline bool stream_number_char(char chr)
+{
+	return isdigit((unsigned char)chr) != 0 || chr == '.' || chr == 'e' ||
+	       chr == 'E' || chr == '+' || chr == '-';
+}
+
+static int stream_value(struct json_stream *stream, const char **pos)
+{
+	const char *cur = *pos;
+
+	switch (*cur) {
+	case '{':
+	case '}':
+	case '[':
+	case ']':
+	case ',':
+	case ':':
+		stream->type = (enum json_tokens)*cur;
+		*pos = cur + 1;
+		return stream_emit(stream, cur, cur + 1);
+	case '"':
+		stream->type = JSON_TOK_STRING;
+		stream->state = STREAM_STRING;
+		break;
+	case 't':
+		stream->literal = "rue";
+		stream->type = JSON_TOK_TRUE;
+		stream->state = STREAM_LITERAL;
+		break;
+	case 'f':
+		stream->literal = "alse";
+		stream->type = JSON_TOK_FALSE;
+		stream->state = STREAM_LITERAL;
+		break;
+	case 'n':
+		stream->literal = "ull";
+		stream->type = JSON_TOK_NULL;
+		stream->state = STREAM_LITERAL;
+		break;
+	default:
+		if (*cur != '-' && isdigit((unsigned char)*cur) == 0) {
+			return -EINVAL;
+		}
+
+		stream->type = JSON_TOK_NUMBER;
+		stream->state = STREAM_NUMBER;
+		break;
+	}
+
+	*pos = cur + 1;
+
+	return 0;
+}
+
+static int stream_feed(struct json_stream *stream, const char *data, size_t len)
+{
+	const char *cur = data;
+	const char *end = data + len;
+	/* Start of the pending token within this chunk */
+	const char *start = data;
+	int ret = 0;
+
+	while (cur < end) {
+		switch (stream->state) {
+		case STREAM_VALUE:
+			while (cur < end && (*cur == ' ' || *cur == '\t' || *cur == '\n' ||
+					     *cur == '\r')) {
+				cur++;
+			}
+
+			if (cur == end) {
+				return 0;
+			}
+
+			/* Strings start after the quote, other tokens at it */
+			start = (*cur == '"') ? cur + 1 : cur;
+			ret = stream_value(stream, &cur);
+			break;
+		case STREAM_STRING:
+			while (cur < end && *cur != '"' && *cur != '\\' &&
+			       (unsigned char)*cur >= 0x20) {
+				cur++;
+			}
+
+			if (cur == end) {
+				break;
+			}
+
+			if (*cur == '"') {
+				ret = stream_emit(stream, start, cur);
+			} else if (*cur == '\\') {
+				stream->state = STREAM_STRING_ESCAPE;
+			} else {
+				ret = -EINVAL;
+			}
+
+			cur++;
+			break;
+		case STREAM_STRING_ESCAPE:
+			switch (*cur++) {
+			case '"':
+			case '\\':
+			case '/':
+			case 'b':
+			case 'f':
+			case 'n':
+			case 'r':
+			case 't':
+				stream->state = STREAM_STRING;
+				break;
+			case 'u':
+				stream->unicode_left = 4;
+				stream->state = STREAM_STRING_UNICODE;
+				break;
+			default:
+				ret = -EINVAL;
+				break;
+			}
+			break;
+		case STREAM_STRING_UNICODE:
+			if (isxdigit((unsigned char)*cur++) == 0) {
+				ret = -EINVAL;
+			} else if (--stream->unicode_left == 0) {
+				stream->state = STREAM_STRING;
+			}
+			break;
+		case STREAM_NUMBER:
+			while (cur < end && stream_number_char(*cur)) {
+				cur++;
+			}
+
+			if (cur < end) {
+				ret = stream_emit(stream, start, cur);
+			}
+			break;
+		case STREAM_LITERAL:
+			if (*cur++ != *stream->literal++) {
+				ret = -EINVAL;
+			} else if (*stream->literal == '\0') {
+				ret = stream_emit(stream, start, cur);
+			}
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	/* Hold on to the part of a token which continues in the next chunk */
+	if (stream->state != STREAM_VALUE) {
+		return stream_hold(stream, start, end - start);
+	}
+
+	return 0;
+}
+
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len)
+{
+	int ret;
+
+	if (stream->state == STREAM_ERROR) {
+		return -EINVAL;
+	}
+
+	ret = stream_feed(stream, data, len);
+	if (ret != 0) {
+		/* The rest of the chunk is lost, the stream can not resume */
+		stream->state = STREAM_ERROR;
+	}
+
+	return ret;
+}
+
+int json_stream_finish(struct json_stream *stream)
+{
+	int ret;
+
+	switch (stream->state) {
+	case STREAM_VALUE:
+		ret = 0;
+		break;
+	case STREAM_NUMBER:
+		/* A number is only known to be complete at the end of the data */
+		ret = stream_emit(stream, NULL, NULL);
+		break;
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	json_stream_init(stream, stream->buf, stream->buf_size, stream->cb,
+			 stream->user_data);
+
+	return ret;
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Bounded MPMC queue after Dmitry Vyukov's design: the slot at position
+ * pos is free for the producer claiming pos when its sequence number is
+ * pos, and holds an item for the consumer claiming pos once it is
+ * pos + 1.  Claiming a position is a compare-and-swap on the head or the
+ * tail, and releasing the slot a store to its sequence number.
+ *
+ * Sequence numbers are stored minus the slot index, so that a zeroed
+ * buffer is an empty queue and queues can be defined statically.
+ * Positions wrap around, so they are compared through their difference.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/mpmc_queue.h>
+
+static inline atomic_t *slot_seq(struct sys_mpmc_queue *q, uint32_t idx)
+{
+	return (atomic_t *)(q->buf + (size_t)idx * q->stride);
+}
+
+static inline void *slot_data(struct sys_mpmc_queue *q, uint32_t idx)
+{
+	return q->buf + (size_t)idx * q->stride + sizeof(atomic_t);
+}
+
+/* Sequence number of slot idx relative to position pos */
+static inline long seq_diff(struct sys_mpmc_queue *q, uint32_t idx, unsigned long pos)
+{
+	unsigned long seq = (unsigned long)atomic_get(slot_seq(q, idx)) + idx;
+
+	return (long)(seq - pos);
+}
+
+static inline void seq_set(struct sys_mpmc_queue *q, uint32_t idx, unsigned long seq)
+{
+	(void)atomic_set(slot_seq(q, idx), (atomic_val_t)(seq - idx));
+}
+
+#ifdef CONFIG_MULTITHREADING
+static inline void wake(atomic_t *waiters, struct k_sem *sem)
+{
+	/* Pairs with the retry after a waiter registers itself: either it
+	 * sees the slot just released or this sees it waiting.
+	 */
+	if (atomic_get(waiters) != 0) {
+		k_sem_give(sem);
+	}
+}
+#endif
+
+int sys_mpmc_queue_init(struct sys_mpmc_queue *q, void *buf, size_t item_size,
+			uint32_t count)
+{
+	if (!IS_POWER_OF_TWO(count) || ((uintptr_t)buf % sizeof(atomic_t)) != 0U) {
+		return -EINVAL;
+	}
+
+	q->buf = buf;
+	q->stride = Z_MPMC_QUEUE_STRIDE(item_size);
+	q->item_size = item_size;
+	q->mask = count - 1U;
+	(void)memset(buf, 0, SYS_MPMC_QUEUE_BUF_SIZE(item_size, count));
+	atomic_clear(&q->head);
+	atomic_clear(&q->tail);
+
+#ifdef CONFIG_MULTITHREADING
+	atomic_clear(&q->get_waiters);
+	atomic_clear(&q->put_waiters);
+	k_sem_init(&q->not_empty, 0, 1);
+	k_sem_init(&q->not_full, 0, 1);
+#endif
+
+	return 0;
+}
+
+int sys_mpmc_queue_put(struct sys_mpmc_queue *q, const void *item)
+{
+	unsigned long pos = (unsigned long)atomic_get(&q->head);
+	uint32_t idx;
+
+	for (;;) {
+		long diff;
+
+		idx = pos & q->mask;
+		diff = seq_diff(q, idx, pos);
+
+		if (diff == 0) {
+			if (atomic_cas(&q->head, (atomic_val_t)pos, (atomic_val_t)(pos + 1))) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* Slot still holds the item from one lap ago */
+			return -ENOMSG;
+		}
+
+		/* Another producer claimed pos */
+		pos = (unsigned long)atomic_get(&q->head);
+	}
+
+	(void)memcpy(slot_data(q, idx), item, q->item_size);
+	seq_set(q, idx, pos + 1);
+
+#ifdef CONFIG_MULTITHREADING
+	wake(&q->get_waiters, &q->not_empty);
+#endif
+
+	return 0;
+}
+
+int sys_mpmc_queue_get(struct sys_mpmc_queue *q, void *item)
+{
+	unsigned long pos = (unsigned long)atomic_get(&q->tail);
+	uint32_t idx;
+
+	for (;;) {
+		long diff;
+
+		idx = pos & q->mask;
+		diff = seq_diff(q, idx, pos + 1);
+
+		if (diff == 0) {
+			if (atomic_cas(&q->tail, (atomic_val_t)pos, (atomic_val_t)(pos + 1))) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* Slot not filled yet */
+			return -ENOMSG;
+		}
+
+		/* Another consumer claimed pos */
+		pos = (unsigned long)atomic_get(&q->tail);
+	}
+
+	(void)memcpy(item, slot_data(q, idx), q->item_size);
+	seq_set(q, idx, pos + q->mask + 1);
+
+#ifdef CONFIG_MULTITHREADING
+	wake(&q->put_waiters, &q->not_full);
+#endif
+
+	return 0;
+}
+
+#ifdef CONFIG_MULTITHREADING
+
+/* Retry op until it succeeds, sleeping on sem between attempts.  The
+ * semaphore only tells that the other side made progress, stale counts
+ * merely cost an extra attempt.
+ */
+static int wait_for(struct sys_mpmc_queue *q, int (*op)(struct sys_mpmc_queue *, void *),
+		    void *item, atomic_t *waiters, struct k_sem *sem, k_timeout_t timeout)
+{
+	k_timepoint_t end;
+	int ret = op(q, item);
+
+	if (ret == 0 || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return ret;
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	do {
+		(void)atomic_inc(waiters);
+		ret = op(q, item);
+		if (ret != 0) {
+			ret = k_sem_take(sem, sys_timepoint_timeout(end));
+			if (ret == 0) {
+				ret = op(q, item);
+			} else {
+				/* -EBUSY once the timepoint has passed */
+				ret = -EAGAIN;
+			}
+		}
+		(void)atomic_dec(waiters);
+	} while (ret == -ENOMSG);
+
+	return ret;
+}
+
+static int put_op(struct sys_mpmc_queue *q, void *item)
+{
+	return sys_mpmc_queue_put(q, item);
+}
+
+int sys_mpmc_queue_put_wait(struct sys_mpmc_queue *q, const void *item,
+			    k_timeout_t timeout)
+{
+	return wait_for(q, put_op, (void *)item, &q->put_waiters, &q->not_full, timeout);
+}
+
+int sys_mpmc_queue_get_wait(struct sys_mpmc_queue *q, void *item,
+			    k_timeout_t timeout)
+{
+	return wait_for(q, sys_mpmc_queue_get, item, &q->get_waiters, &q->not_empty,
+			timeout);
+}
+
+#endif /* CONFIG_MULTITHREADING */
@@ -1,6 +1,8 @@
 /* Copyright (c) 2021 Intel Corporation
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <errno.h>
+#include <string.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/sys_heap.h>
@@ -17,8 +19,10 @@ void sys_multi_heap_add_heap(struct sys_multi_heap *mheap,
 {
 	__ASSERT_NO_MSG(mheap->nheaps < ARRAY_SIZE(mheap->heaps));
 
-	mheap->heaps[mheap->nheaps].heap = heap;
-	mheap->heaps[mheap->nheaps++].user_data = user_data;
+	mheap->heaps[mheap->nheaps++] = (struct sys_multi_heap_rec) {
+		.heap = heap,
+		.user_data = user_data,
+	};
 
 	/* Now sort them in memory order, simple extraction sort */
 	for (int i = 0; i < mheap->nheaps; i++) {
@@ -40,15 +44,62 @@ void sys_multi_heap_add_heap(struct sys_multi_heap *mheap,
 	}
 }
 
+static struct sys_multi_heap_rec *find_rec(struct sys_multi_heap *mheap,
+					   struct sys_heap *heap)
+{
+	for (int i = 0; i < mheap->nheaps; i++) {
+		if (mheap->heaps[i].heap == heap) {
+			return &mheap->heaps[i];
+		}
+	}
+
+	return NULL;
+}
+
+static inline struct sys_multi_heap_rec *block_rec(struct sys_multi_heap *mheap,
+						   void *block)
+{
+	/* The records belong to mheap, only the lookup API is const */
+	return (struct sys_multi_heap_rec *)sys_multi_heap_get_heap(mheap, block);
+}
+
+static void record_alloc(struct sys_multi_heap_rec *rec, size_t bytes)
+{
+#ifdef CONFIG_SYS_MULTI_HEAP_STATS
+	unsigned int cls = 0;
+
+	while (cls < SYS_MULTI_HEAP_STATS_SIZES - 1 && bytes > (16U << cls)) {
+		cls++;
+	}
+
+	(void)atomic_inc(&rec->served[cls]);
+#else
+	ARG_UNUSED(rec);
+	ARG_UNUSED(bytes);
+#endif
+}
+
+static void *multi_heap_alloc(struct sys_multi_heap *mheap, void *cfg,
+			      size_t align, size_t bytes)
+{
+	void *block = mheap->choice(mheap, cfg, align, bytes);
+
+	if (IS_ENABLED(CONFIG_SYS_MULTI_HEAP_STATS) && block != NULL) {
+		record_alloc(block_rec(mheap, block), bytes);
+	}
+
+	return block;
+}
+
 void *sys_multi_heap_alloc(struct sys_multi_heap *mheap, void *cfg, size_t bytes)
 {
-	return mheap->choice(mheap, cfg, 0, bytes);
+	return multi_heap_alloc(mheap, cfg, 0, bytes);
 }
 
 void *sys_multi_heap_aligned_alloc(struct sys_multi_heap *mheap,
 				   void *cfg, size_t align, size_t bytes)
 {
-	return mheap->choice(mheap, cfg, align, bytes);
+	return multi_heap_alloc(mheap, cfg, align, bytes);
 }
 
 const struct sys_multi_heap_rec *sys_multi_heap_get_heap(const struct sys_multi_heap *mheap,
@@ -90,3 +141,128 @@ void sys_multi_heap_free(struct sys_multi_heap *mheap, void *block)
 		sys_heap_free(heap->heap, block);
 	}
 }
+
+int sys_multi_heap_set_latency(struct sys_multi_heap *mheap,
+			       struct sys_heap *heap, unsigned int latency)
+{
+	struct sys_multi_heap_rec *rec = find_rec(mheap, heap);
+
+	if (rec == NULL) {
+		return -ENOENT;
+	}
+
+	rec->latency = latency;
+
+	return 0;
+}
+
+/* Order in which a hint tries latency classes: the preferred one, then
+ * slower ones from the nearest outwards, then faster ones likewise.
+ * Classes the hint does not allow sort last and are never tried.
+ */
+static uint64_t placement_rank(const struct sys_multi_heap_hint *hint,
+			       unsigned int latency)
+{
+	if (latency == hint->latency) {
+		return 0;
+	} else if (latency > hint->latency) {
+		return (hint->flags & SYS_MULTI_HEAP_FALLBACK_SLOWER) != 0U ?
+			latency - hint->latency : UINT64_MAX;
+	} else {
+		return (hint->flags & SYS_MULTI_HEAP_FALLBACK_FASTER) != 0U ?
+			BIT64(32) + (hint->latency - latency) : UINT64_MAX;
+	}
+}
+
+void *sys_multi_heap_placement_choice(struct sys_multi_heap *mheap, void *cfg,
+				      size_t align, size_t size)
+{
+	static const struct sys_multi_heap_hint fastest = {
+		.latency = 0,
+		.flags = SYS_MULTI_HEAP_FALLBACK_SLOWER,
+	};
+	const struct sys_multi_heap_hint *hint = (cfg != NULL) ? cfg : &fastest;
+	uint64_t rank[MAX_MULTI_HEAPS];
+	uint8_t order[MAX_MULTI_HEAPS];
+	int n = 0;
+
+	/* Stable insertion sort by rank, so equal classes stay in
+	 * memory order
+	 */
+	for (int i = 0; i < mheap->nheaps; i++) {
+		uint64_t r = placement_rank(hint, mheap->heaps[i].latency);
+		int j;
+
+		if (r == UINT64_MAX) {
+			continue;
+		}
+
+		for (j = n; j > 0 && rank[j - 1] > r; j--) {
+			rank[j] = rank[j - 1];
+			order[j] = order[j - 1];
+		}
+		rank[j] = r;
+		order[j] = i;
+		n++;
+	}
+
+	for (int i = 0; i < n; i++) {
+		void *block = sys_heap_aligned_alloc(mheap->heaps[order[i]].heap,
+						     align, size);
+
+		if (block != NULL) {
+			return block;
+		}
+	}
+
+	return NULL;
+}
+
+void *sys_multi_heap_migrate(struct sys_multi_heap *mheap, void *block,
+			     void *cfg, size_t align)
+{
+	struct sys_multi_heap_rec *from, *to;
+	size_t bytes;
+	void *moved;
+
+	if (block == NULL) {
+		return NULL;
+	}
+
+	from = block_rec(mheap, block);
+	bytes = sys_heap_usable_size(from->heap, block);
+	moved = mheap->choice(mheap, cfg, align, bytes);
+	if (moved == NULL) {
+		return block;
+	}
+
+	to = block_rec(mheap, moved);
+	if (to->latency >= from->latency) {
+		sys_heap_free(to->heap, moved);
+		return block;
+	}
+
+	memcpy(moved, block, bytes);
+	sys_heap_free(from->heap, block);
+	record_alloc(to, bytes);
+
+	return moved;
+}
+
+#ifdef CONFIG_SYS_MULTI_HEAP_STATS
+int sys_multi_heap_stats_get(struct sys_multi_heap *mheap, struct sys_heap *heap,
+			     struct sys_multi_heap_stats *stats)
+{
+	struct sys_multi_heap_rec *rec = find_rec(mheap, heap);
+
+	if (rec == NULL) {
+		return -ENOENT;
+	}
+
+	for (int i = 0; i < SYS_MULTI_HEAP_STATS_SIZES; i++) {
+		stats->served[i] = (uint32_t)atomic_get(&rec->served[i]);
+	}
+
+	return 0;
+}
+#endif
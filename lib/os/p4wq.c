@@ -71,6 +71,121 @@ static inline bool item_lessthan(struct k_p4wq_work *a, struct k_p4wq_work *b)
 	return false;
 }
 
+#ifdef CONFIG_P4WQ_PER_CPU
+static inline bool item_cpu_ok(struct k_p4wq_work *item, int cpu)
+{
+	return (item->cpu_mask == 0U) || ((item->cpu_mask & BIT(cpu)) != 0U);
+}
+
+static inline struct rbtree *item_tree(struct k_p4wq *queue,
+				       struct k_p4wq_work *item)
+{
+	return &queue->cpu_queue[item->cpu];
+}
+
+/* Items go to the queue of the submitting CPU, if they may run there */
+static void queue_insert(struct k_p4wq *queue, struct k_p4wq_work *item)
+{
+	int cpu = _current_cpu->id;
+
+	if (!item_cpu_ok(item, cpu)) {
+		cpu = find_lsb_set(item->cpu_mask) - 1;
+	}
+
+	__ASSERT_NO_MSG(cpu < arch_num_cpus());
+	item->cpu = cpu;
+	rb_insert(item_tree(queue, item), &item->rbnode);
+}
+
+/* Take the highest priority item of the queue of the current CPU, unless
+ * the queue of another CPU has one of strictly higher priority which may
+ * run here.  Only the highest priority item of each queue is considered.
+ */
+static struct k_p4wq_work *queue_take(struct k_p4wq *queue)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	int cpu = _current_cpu->id;
+	struct k_p4wq_work *best = NULL;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct rbnode *r = rb_get_max(&queue->cpu_queue[(cpu + i) % num_cpus]);
+		struct k_p4wq_work *w;
+
+		if (r == NULL) {
+			continue;
+		}
+
+		w = CONTAINER_OF(r, struct k_p4wq_work, rbnode);
+		if (item_cpu_ok(w, cpu) && ((best == NULL) || item_lessthan(best, w))) {
+			best = w;
+		}
+	}
+
+	if (best != NULL) {
+		rb_remove(item_tree(queue, best), &best->rbnode);
+	}
+
+	return best;
+}
+#else
+static inline struct rbtree *item_tree(struct k_p4wq *queue,
+				       struct k_p4wq_work *item)
+{
+	ARG_UNUSED(item);
+
+	return &queue->queue;
+}
+
+static void queue_insert(struct k_p4wq *queue, struct k_p4wq_work *item)
+{
+	rb_insert(&queue->queue, &item->rbnode);
+}
+
+static struct k_p4wq_work *queue_take(struct k_p4wq *queue)
+{
+	struct rbnode *r = rb_get_max(&queue->queue);
+
+	if (r == NULL) {
+		return NULL;
+	}
+
+	rb_remove(&queue->queue, r);
+
+	return CONTAINER_OF(r, struct k_p4wq_work, rbnode);
+}
+#endif /* CONFIG_P4WQ_PER_CPU */
+
+/* Restrict the worker thread woken for an item to the CPUs the item may
+ * run on, while it is still pended.
+ */
+static void set_cpu_mask(struct k_p4wq *queue, struct k_thread *th,
+			 struct k_p4wq_work *item)
+{
+#ifdef CONFIG_P4WQ_PER_CPU
+	if (queue->flags & K_P4WQ_USER_CPU_MASK) {
+		return;
+	}
+
+	(void)k_thread_cpu_mask_clear(th);
+
+	if (IS_ENABLED(CONFIG_SCHED_CPU_MASK_PIN_ONLY)) {
+		(void)k_thread_cpu_mask_enable(th, item->cpu);
+	} else if (item->cpu_mask == 0U) {
+		(void)k_thread_cpu_mask_enable_all(th);
+	} else {
+		for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+			if (item->cpu_mask & BIT(i)) {
+				(void)k_thread_cpu_mask_enable(th, i);
+			}
+		}
+	}
+#else
+	ARG_UNUSED(queue);
+	ARG_UNUSED(th);
+	ARG_UNUSED(item);
+#endif
+}
+
 static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 {
 	ARG_UNUSED(p1);
@@ -79,13 +194,9 @@ static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 	k_spinlock_key_t k = k_spin_lock(&queue->lock);
 
 	while (true) {
-		struct rbnode *r = rb_get_max(&queue->queue);
+		struct k_p4wq_work *w = queue_take(queue);
 
-		if (r) {
-			struct k_p4wq_work *w
-				= CONTAINER_OF(r, struct k_p4wq_work, rbnode);
-
-			rb_remove(&queue->queue, r);
+		if (w) {
 			w->thread = _current;
 			sys_dlist_append(&queue->active, &w->dlnode);
 			set_prio(_current, w);
@@ -126,7 +237,13 @@ void k_p4wq_init(struct k_p4wq *queue)
 {
 	memset(queue, 0, sizeof(*queue));
 	z_waitq_init(&queue->waitq);
+#ifdef CONFIG_P4WQ_PER_CPU
+	for (int i = 0; i < ARRAY_SIZE(queue->cpu_queue); i++) {
+		queue->cpu_queue[i].lessthan_fn = rb_lessthan;
+	}
+#else
 	queue->queue.lessthan_fn = rb_lessthan;
+#endif
 	sys_dlist_init(&queue->active);
 }
 
@@ -234,14 +351,14 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 	}
 	__ASSERT_NO_MSG(item->thread == NULL);
 
-	rb_insert(&queue->queue, &item->rbnode);
+	queue_insert(queue, item);
 	item->queue = queue;
 
 	/* If there were other items already ahead of it in the queue,
 	 * then we don't need to revisit active thread state and can
 	 * return.
 	 */
-	if (rb_get_max(&queue->queue) != &item->rbnode) {
+	if (rb_get_max(item_tree(queue, item)) != &item->rbnode) {
 		goto out;
 	}
 
@@ -274,13 +391,16 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 	 * error: we are breaking our promise about run order.
 	 * Complain.
 	 */
-	struct k_thread *th = z_unpend_first_thread(&queue->waitq);
+	struct k_thread *th = z_waitq_head(&queue->waitq);
 
 	if (th == NULL) {
 		LOG_WRN("Out of worker threads, priority guarantee violated");
 		goto out;
 	}
 
+	set_cpu_mask(queue, th, item);
+	th = z_unpend_first_thread(&queue->waitq);
+
 	set_prio(th, item);
 	z_ready_thread(th);
 	z_reschedule(&queue->lock, k);
@@ -294,10 +414,10 @@ out:
 bool k_p4wq_cancel(struct k_p4wq *queue, struct k_p4wq_work *item)
 {
 	k_spinlock_key_t k = k_spin_lock(&queue->lock);
-	bool ret = rb_contains(&queue->queue, &item->rbnode);
+	bool ret = rb_contains(item_tree(queue, item), &item->rbnode);
 
 	if (ret) {
-		rb_remove(&queue->queue, &item->rbnode);
+		rb_remove(item_tree(queue, item), &item->rbnode);
 		k_sem_give(&item->done_sem);
 	}
 
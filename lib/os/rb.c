@@ -31,6 +31,16 @@ static struct rbnode *get_child(struct rbnode *n, uint8_t side)
 	return (struct rbnode *) l;
 }
 
+static void set_parent(struct rbnode *n, struct rbnode *parent)
+{
+#ifdef CONFIG_RB_PARENT
+	n->parent = parent;
+#else
+	ARG_UNUSED(n);
+	ARG_UNUSED(parent);
+#endif
+}
+
 static void set_child(struct rbnode *n, uint8_t side, void *val)
 {
 	CHECK(n);
@@ -42,6 +52,36 @@ static void set_child(struct rbnode *n, uint8_t side, void *val)
 
 		n->children[0] = (void *) (new | (old & 1UL));
 	}
+
+	if (val != NULL) {
+		set_parent(val, n);
+	}
+}
+
+/* Recomputes the augmented data of a node from its children */
+static void augment(struct rbtree *tree, struct rbnode *n)
+{
+#ifdef CONFIG_RB_AUGMENT
+	if (tree->augment_fn != NULL) {
+		tree->augment_fn(n);
+	}
+#else
+	ARG_UNUSED(tree);
+	ARG_UNUSED(n);
+#endif
+}
+
+/* Recomputes the augmented data of a node and all of its ancestors */
+static void augment_up(struct rbtree *tree, struct rbnode *n)
+{
+#ifdef CONFIG_RB_AUGMENT
+	for (; (tree->augment_fn != NULL) && (n != NULL); n = n->parent) {
+		tree->augment_fn(n);
+	}
+#else
+	ARG_UNUSED(tree);
+	ARG_UNUSED(n);
+#endif
 }
 
 static enum rb_color get_color(struct rbnode *n)
@@ -117,15 +157,17 @@ static uint8_t get_side(struct rbnode *parent, struct rbnode *child)
 
 /* Swaps the position of the two nodes at the top of the provided
  * stack, modifying the stack accordingly. Does not change the color
- * of either node.  That is, it effects the following transition (or
- * its mirror if N is on the other side of P, of course):
+ * of either node, but recomputes their augmented data (the subtree
+ * of the pair as a whole is unchanged).  That is, it effects the
+ * following transition (or its mirror if N is on the other side of P,
+ * of course):
  *
  *    P          N
  *  N  c  -->  a   P
  * a b            b c
  *
  */
-static void rotate(struct rbnode **stack, int stacksz)
+static void rotate(struct rbtree *tree, struct rbnode **stack, int stacksz)
 {
 	CHECK(stacksz >= 2);
 
@@ -139,6 +181,8 @@ static void rotate(struct rbnode **stack, int stacksz)
 		struct rbnode *grandparent = stack[stacksz - 3];
 
 		set_child(grandparent, get_side(grandparent, parent), child);
+	} else {
+		set_parent(child, NULL);
 	}
 
 	set_child(child, side, a);
@@ -146,13 +190,16 @@ static void rotate(struct rbnode **stack, int stacksz)
 	set_child(parent, side, b);
 	stack[stacksz - 2] = child;
 	stack[stacksz - 1] = parent;
+
+	augment(tree, parent);
+	augment(tree, child);
 }
 
 /* The node at the top of the provided stack is red, and its parent is
  * too.  Iteratively fix the tree so it becomes a valid red black tree
  * again
  */
-static void fix_extra_red(struct rbnode **stack, int stacksz)
+static void fix_extra_red(struct rbtree *tree, struct rbnode **stack, int stacksz)
 {
 	while (stacksz > 1) {
 		struct rbnode *node = stack[stacksz - 1];
@@ -198,11 +245,11 @@ static void fix_extra_red(struct rbnode **stack, int stacksz)
 		uint8_t parent_side = get_side(parent, node);
 
 		if (parent_side != side) {
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 		}
 
 		/* Rotate the grandparent with parent, swapping colors */
-		rotate(stack, stacksz - 1);
+		rotate(tree, stack, stacksz - 1);
 		set_color(stack[stacksz - 3], BLACK);
 		set_color(stack[stacksz - 2], RED);
 		return;
@@ -222,7 +269,9 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 	if (tree->root == NULL) {
 		tree->root = node;
 		tree->max_depth = 1;
+		set_parent(node, NULL);
 		set_color(node, BLACK);
+		augment(tree, node);
 		return;
 	}
 
@@ -240,9 +289,10 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 
 	set_child(parent, side, node);
 	set_color(node, RED);
+	augment_up(tree, node);
 
 	stack[stacksz++] = node;
-	fix_extra_red(stack, stacksz);
+	fix_extra_red(tree, stack, stacksz);
 
 	if (stacksz > tree->max_depth) {
 		tree->max_depth = stacksz;
@@ -263,8 +313,8 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
  * then clean it up (replace it with a simple NULL child in the
  * parent) when finished.
  */
-static void fix_missing_black(struct rbnode **stack, int stacksz,
-			      struct rbnode *null_node)
+static void fix_missing_black(struct rbtree *tree, struct rbnode **stack,
+			      int stacksz, struct rbnode *null_node)
 {
 	/* Loop upward until we reach the root */
 	while (stacksz > 1) {
@@ -284,7 +334,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 		 */
 		if (!is_black(sib)) {
 			stack[stacksz - 1] = sib;
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 			set_color(parent, RED);
 			set_color(sib, BLACK);
 			stack[stacksz++] = n;
@@ -334,7 +384,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 
 			stack[stacksz - 1] = sib;
 			stack[stacksz++] = inner;
-			rotate(stack, stacksz);
+			rotate(tree, stack, stacksz);
 			set_color(sib, RED);
 			set_color(inner, BLACK);
 
@@ -356,7 +406,7 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 		set_color(parent, BLACK);
 		set_color(outer, BLACK);
 		stack[stacksz - 1] = sib;
-		rotate(stack, stacksz);
+		rotate(tree, stack, stacksz);
 		if (n == null_node) {
 			set_child(parent, n_side, NULL);
 		}
@@ -364,6 +414,40 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 	}
 }
 
+#ifdef CONFIG_RB_PARENT
+/* Stacks the path from the root down to the node by following its
+ * parent pointers, so that the tree needs not be searched.  Each link
+ * is checked, which catches nodes that are not part of the tree.
+ * Returns 0 if node is not in the tree.
+ */
+static int stack_parents(struct rbtree *tree, struct rbnode *node,
+			 struct rbnode **stack)
+{
+	int sz = 0;
+	struct rbnode *n;
+
+	for (n = node; (n != NULL) && (sz <= tree->max_depth); n = n->parent) {
+		if ((n->parent != NULL) && (get_child(n->parent, 0U) != n) &&
+		    (get_child(n->parent, 1U) != n)) {
+			return 0;
+		}
+		sz++;
+	}
+
+	if ((n != NULL) || (sz == 0) || (sz > tree->max_depth)) {
+		return 0;
+	}
+
+	n = node;
+	for (int i = sz - 1; i >= 0; i--) {
+		stack[i] = n;
+		n = n->parent;
+	}
+
+	return (stack[0] == tree->root) ? sz : 0;
+}
+#endif
+
 void rb_remove(struct rbtree *tree, struct rbnode *node)
 {
 	struct rbnode *tmp;
@@ -373,11 +457,23 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 	struct rbnode *stack[tree->max_depth + 1];
 #endif
 
+	if (tree->root == NULL) {
+		return;
+	}
+
+#ifdef CONFIG_RB_PARENT
+	int stacksz = stack_parents(tree, node, stack);
+
+	if (stacksz == 0) {
+		return;
+	}
+#else
 	int stacksz = find_and_stack(tree, node, stack);
 
 	if (node != stack[stacksz - 1]) {
 		return;
 	}
+#endif
 
 	/* We can only remove a node with zero or one child, if we
 	 * have two then pick the "biggest" child of side 0 (smallest
@@ -418,6 +514,7 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 			set_child(hiparent, get_side(hiparent, node), node2);
 		} else {
 			tree->root = node2;
+			set_parent(node2, NULL);
 		}
 
 		if (loparent == node) {
@@ -456,6 +553,7 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 	if (stacksz < 2) {
 		tree->root = child;
 		if (child != NULL) {
+			set_parent(child, NULL);
 			set_color(child, BLACK);
 		} else {
 			tree->max_depth = 0;
@@ -472,7 +570,7 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 	 */
 	if (child == NULL) {
 		if (is_black(node)) {
-			fix_missing_black(stack, stacksz, node);
+			fix_missing_black(tree, stack, stacksz, node);
 		} else {
 			/* Red childless nodes can just be dropped */
 			set_child(parent, get_side(parent, node), NULL);
@@ -491,6 +589,14 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 
 	/* We may have rotated up into the root! */
 	tree->root = stack[0];
+
+#ifdef CONFIG_RB_PARENT
+	/* The node was unlinked from its parent, which is still recorded
+	 * in it: update the nodes which had it in their subtree.
+	 */
+	augment_up(tree, node->parent);
+	node->parent = NULL;
+#endif
 }
 
 #ifndef CONFIG_MISRA_SANE
@@ -525,6 +631,19 @@ bool rb_contains(struct rbtree *tree, struct rbnode *node)
 	return n == node;
 }
 
+#ifdef CONFIG_RB_PARENT
+struct rbnode *z_rb_foreach_next(struct rbtree *tree, struct _rb_foreach *f)
+{
+	/* The loop stops on NULL, which thus marks the first call */
+	if (f->cur == NULL) {
+		f->cur = rb_get_min(tree);
+	} else {
+		f->cur = rb_next(f->cur);
+	}
+
+	return f->cur;
+}
+#else
 /* Pushes the node and its chain of left-side children onto the stack
  * in the foreach struct, returning the last node, which is the next
  * node to iterate.  By construction node will always be a right child
@@ -597,3 +716,83 @@ struct rbnode *z_rb_foreach_next(struct rbtree *tree, struct _rb_foreach *f)
 	f->top--;
 	return (f->top >= 0) ? f->stack[f->top] : NULL;
 }
+#endif
+
+#ifdef CONFIG_RB_PARENT
+static struct rbnode *step(struct rbnode *node, uint8_t side)
+{
+	struct rbnode *n = get_child(node, side);
+	uint8_t other = (side == 0U) ? 1U : 0U;
+
+	/* The next node down is the far end of the subtree on that side */
+	if (n != NULL) {
+		while (get_child(n, other) != NULL) {
+			n = get_child(n, other);
+		}
+		return n;
+	}
+
+	/* Otherwise, walk up until coming from the other side */
+	for (n = node->parent; (n != NULL) && (get_child(n, side) == node);
+	     n = n->parent) {
+		node = n;
+	}
+
+	return n;
+}
+
+struct rbnode *rb_next(struct rbnode *node)
+{
+	return step(node, 1U);
+}
+
+struct rbnode *rb_prev(struct rbnode *node)
+{
+	return step(node, 0U);
+}
+#endif
+
+/* Links nodes[0..count-1] as a perfectly balanced subtree and returns
+ * its root.  Nodes at red_depth are the only red ones, which is the
+ * bottom level of the tree when it is not complete: all paths then
+ * have the same number of black nodes.
+ */
+static struct rbnode *build_sorted(struct rbtree *tree, struct rbnode **nodes,
+				   size_t count, int depth, int red_depth)
+{
+	size_t mid = count / 2;
+	struct rbnode *n = nodes[mid];
+
+	set_child(n, 0U, (mid > 0) ?
+		  build_sorted(tree, nodes, mid, depth + 1, red_depth) : NULL);
+	set_child(n, 1U, (count - mid > 1) ?
+		  build_sorted(tree, &nodes[mid + 1], count - mid - 1,
+			       depth + 1, red_depth) : NULL);
+	set_color(n, (depth == red_depth) ? RED : BLACK);
+	augment(tree, n);
+
+	return n;
+}
+
+void rb_build_sorted(struct rbtree *tree, struct rbnode **nodes, size_t count)
+{
+	int depth = 0;
+
+	__ASSERT(tree->root == NULL, "tree not empty");
+
+	if (count == 0) {
+		return;
+	}
+
+	while ((count >> depth) > 1) {
+		depth++;
+	}
+
+	/* A full tree of depth + 1 levels needs no red node at all */
+	bool full = ((count + 1) & count) == 0;
+
+	tree->root = build_sorted(tree, nodes, count, 0, full ? -1 : depth);
+	tree->max_depth = depth + 1;
+	set_parent(tree->root, NULL);
+	set_color(tree->root, BLACK);
+}
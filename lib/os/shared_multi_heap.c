@@ -15,6 +15,9 @@ static struct sys_multi_heap shared_multi_heap;
 
 static struct {
 	struct sys_heap heap_pool[MAX_MULTI_HEAPS];
+	/* heap_pool indexes, fastest region first */
+	uint8_t order[MAX_MULTI_HEAPS];
+	unsigned int latency[MAX_MULTI_HEAPS];
 	unsigned int heap_cnt;
 } smh_data[MAX_SHARED_MULTI_HEAP_ATTR];
 
@@ -34,7 +37,7 @@ static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, s
 	block = NULL;
 
 	for (size_t hdx = 0; hdx < smh_data[attr].heap_cnt; hdx++) {
-		h = &smh_data[attr].heap_pool[hdx];
+		h = &smh_data[attr].heap_pool[smh_data[attr].order[hdx]];
 
 		if (h->heap == NULL) {
 			return NULL;
@@ -53,7 +56,7 @@ int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_da
 {
 	enum shared_multi_heap_attr attr;
 	struct sys_heap *h;
-	unsigned int slot;
+	unsigned int slot, pos;
 
 	attr = region->attr;
 
@@ -71,6 +74,19 @@ int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_da
 
 	sys_heap_init(h, (void *) region->addr, region->size);
 	sys_multi_heap_add_heap(&shared_multi_heap, h, user_data);
+	(void)sys_multi_heap_set_latency(&shared_multi_heap, h, region->latency);
+
+	/* Keep regions of equal latency in the order they were added */
+	for (pos = slot; pos > 0; pos--) {
+		uint8_t prev = smh_data[attr].order[pos - 1];
+
+		if (smh_data[attr].latency[prev] <= region->latency) {
+			break;
+		}
+		smh_data[attr].order[pos] = prev;
+	}
+	smh_data[attr].order[pos] = slot;
+	smh_data[attr].latency[slot] = region->latency;
 
 	smh_data[attr].heap_cnt++;
 
@@ -102,6 +118,17 @@ void *shared_multi_heap_aligned_alloc(enum shared_multi_heap_attr attr,
 					    align, bytes);
 }
 
+void *shared_multi_heap_migrate(enum shared_multi_heap_attr attr, void *block,
+				size_t align)
+{
+	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || block == NULL) {
+		return block;
+	}
+
+	return sys_multi_heap_migrate(&shared_multi_heap, block, (void *)(long) attr,
+				      align);
+}
+
 int shared_multi_heap_pool_init(void)
 {
 	static atomic_t state;
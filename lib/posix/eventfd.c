@@ -22,6 +22,9 @@ struct eventfd {
 	struct k_spinlock lock;
 	eventfd_t cnt;
 	int flags;
+#ifdef CONFIG_NET_SOCKETS_EPOLL
+	sys_slist_t epoll;
+#endif
 };
 
 static ssize_t eventfd_rw_op(void *obj, void *buf, size_t sz,
@@ -46,6 +49,15 @@ static inline bool eventfd_is_blocking(struct eventfd *efd)
 	return (efd->flags & EFD_NONBLOCK) == 0;
 }
 
+static inline void eventfd_epoll_notify(struct eventfd *efd)
+{
+#ifdef CONFIG_NET_SOCKETS_EPOLL
+	zsock_epoll_notify(&efd->epoll);
+#else
+	ARG_UNUSED(efd);
+#endif
+}
+
 static int eventfd_poll_prepare(struct eventfd *efd,
 				struct zsock_pollfd *pfd,
 				struct k_poll_event **pev,
@@ -123,6 +135,7 @@ static int eventfd_read_locked(struct eventfd *efd, eventfd_t *value)
 	}
 
 	k_poll_signal_raise(&efd->write_sig, 0);
+	eventfd_epoll_notify(efd);
 
 	return 0;
 }
@@ -154,6 +167,7 @@ static int eventfd_write_locked(struct eventfd *efd, eventfd_t *value)
 	}
 
 	k_poll_signal_raise(&efd->read_sig, 0);
+	eventfd_epoll_notify(efd);
 
 	return 0;
 }
@@ -202,6 +216,10 @@ static int eventfd_close_op(void *obj)
 	err = sys_bitarray_free(&efds_bitarray, 1, (struct eventfd *)obj - efds);
 	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
 
+#ifdef CONFIG_NET_SOCKETS_EPOLL
+	zsock_epoll_forget(&efd->epoll);
+#endif
+
 	efd->flags = 0;
 	efd->cnt = 0;
 
@@ -274,6 +292,16 @@ static int eventfd_ioctl_op(void *obj, unsigned int request, va_list args)
 		ret = eventfd_poll_update(obj, pfd, pev);
 	} break;
 
+#ifdef CONFIG_NET_SOCKETS_EPOLL
+	case ZFD_IOCTL_EPOLL_WATCHERS: {
+		sys_slist_t **watchers;
+
+		watchers = va_arg(args, sys_slist_t **);
+		*watchers = &efd->epoll;
+		ret = 0;
+	} break;
+#endif
+
 	default:
 		errno = EOPNOTSUPP;
 		ret = -1;
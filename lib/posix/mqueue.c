@@ -9,6 +9,10 @@
 #include <zephyr/sys/atomic.h>
 #include <zephyr/posix/time.h>
 #include <zephyr/posix/mqueue.h>
+#ifdef CONFIG_POSIX_MQUEUE_FD
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/fdtable.h>
+#endif
 
 typedef struct mqueue_object {
 	sys_snode_t snode;
@@ -17,12 +21,21 @@ typedef struct mqueue_object {
 	struct k_msgq queue;
 	atomic_t ref_count;
 	char *name;
+#ifdef CONFIG_POSIX_MQUEUE_FD
+	/* Raised while the queue has a message, resp. room for one */
+	struct k_poll_signal read_sig;
+	struct k_poll_signal write_sig;
+	struct k_spinlock sig_lock;
+#endif
 } mqueue_object;
 
 typedef struct mqueue_desc {
 	char *mem_desc;
 	mqueue_object *mqueue;
 	uint32_t  flags;
+#ifdef CONFIG_POSIX_MQUEUE_FD
+	int fd;
+#endif
 } mqueue_desc;
 
 K_SEM_DEFINE(mq_sem, 1, 1);
@@ -37,6 +50,9 @@ static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_le
 static int receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
 			   k_timeout_t timeout);
 static void remove_mq(mqueue_object *msg_queue);
+static void update_signals(mqueue_object *msg_queue);
+static int open_fd(mqueue_desc *mqd);
+static void close_fd(mqueue_desc *mqd);
 
 #if defined(__sparc__)
 /*
@@ -160,6 +176,11 @@ mqd_t mq_open(const char *name, int oflags, ...)
 		/* initialize zephyr message queue */
 		k_msgq_init(&msg_queue->queue, msg_queue->mem_buffer, msg_size,
 			    max_msgs);
+#ifdef CONFIG_POSIX_MQUEUE_FD
+		k_poll_signal_init(&msg_queue->read_sig);
+		k_poll_signal_init(&msg_queue->write_sig);
+		update_signals(msg_queue);
+#endif
 		k_sem_take(&mq_sem, K_FOREVER);
 		sys_slist_append(&mq_list, (sys_snode_t *)&(msg_queue->snode));
 		k_sem_give(&mq_sem);
@@ -170,6 +191,13 @@ mqd_t mq_open(const char *name, int oflags, ...)
 
 	msg_queue_desc->mqueue = msg_queue;
 	msg_queue_desc->flags = (oflags & O_NONBLOCK) != 0 ? O_NONBLOCK : 0;
+
+	if (open_fd(msg_queue_desc) < 0) {
+		mq_close((mqd_t)msg_queue_desc);
+		errno = ENFILE;
+		return (mqd_t)mqd;
+	}
+
 	return (mqd_t)msg_queue_desc;
 
 free_mq_buffer:
@@ -197,6 +225,8 @@ int mq_close(mqd_t mqdes)
 		return -1;
 	}
 
+	close_fd(mqd);
+
 	atomic_dec(&mqd->mqueue->ref_count);
 
 	/* remove mq if marked for unlink */
@@ -395,6 +425,8 @@ static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_le
 		return ret;
 	}
 
+	update_signals(mqd->mqueue);
+
 	return 0;
 }
 
@@ -421,11 +453,196 @@ static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
 		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
 	} else {
 		ret = mqd->mqueue->queue.msg_size;
+		update_signals(mqd->mqueue);
 	}
 
 	return ret;
 }
 
+#ifdef CONFIG_POSIX_MQUEUE_FD
+/*
+ * Make the poll signals reflect the state of the queue. This is called after
+ * each change of the state, and the lock ensures the last update wins so that
+ * concurrent senders and receivers cannot leave a stale signal raised.
+ */
+static void update_signals(mqueue_object *msg_queue)
+{
+	k_spinlock_key_t key = k_spin_lock(&msg_queue->sig_lock);
+
+	if (k_msgq_num_used_get(&msg_queue->queue) > 0) {
+		k_poll_signal_raise(&msg_queue->read_sig, 0);
+	} else {
+		k_poll_signal_reset(&msg_queue->read_sig);
+	}
+
+	if (k_msgq_num_free_get(&msg_queue->queue) > 0) {
+		k_poll_signal_raise(&msg_queue->write_sig, 0);
+	} else {
+		k_poll_signal_reset(&msg_queue->write_sig);
+	}
+
+	k_spin_unlock(&msg_queue->sig_lock, key);
+}
+
+static int mq_poll_prepare(mqueue_desc *mqd, struct zsock_pollfd *pfd,
+			   struct k_poll_event **pev, struct k_poll_event *pev_end)
+{
+	if (pfd->events & ZSOCK_POLLIN) {
+		if (*pev == pev_end) {
+			errno = ENOMEM;
+			return -1;
+		}
+
+		k_poll_event_init(*pev, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+				  &mqd->mqueue->read_sig);
+		(*pev)++;
+	}
+
+	if (pfd->events & ZSOCK_POLLOUT) {
+		if (*pev == pev_end) {
+			errno = ENOMEM;
+			return -1;
+		}
+
+		k_poll_event_init(*pev, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+				  &mqd->mqueue->write_sig);
+		(*pev)++;
+	}
+
+	return 0;
+}
+
+static int mq_poll_update(mqueue_desc *mqd, struct zsock_pollfd *pfd,
+			  struct k_poll_event **pev)
+{
+	struct k_msgq *queue = &mqd->mqueue->queue;
+
+	if (pfd->events & ZSOCK_POLLIN) {
+		pfd->revents |= ZSOCK_POLLIN * (k_msgq_num_used_get(queue) > 0);
+		(*pev)++;
+	}
+
+	if (pfd->events & ZSOCK_POLLOUT) {
+		pfd->revents |= ZSOCK_POLLOUT * (k_msgq_num_free_get(queue) > 0);
+		(*pev)++;
+	}
+
+	return 0;
+}
+
+/* The descriptor lock is held by read() and write(), which thus do not block
+ * so that poll() on the same descriptor is not held up.
+ */
+static ssize_t mq_fd_read(void *obj, void *buf, size_t sz)
+{
+	return receive_message(obj, buf, sz, K_NO_WAIT);
+}
+
+static ssize_t mq_fd_write(void *obj, const void *buf, size_t sz)
+{
+	int ret = send_message(obj, buf, sz, K_NO_WAIT);
+
+	return ret < 0 ? ret : sz;
+}
+
+/* Closing the file descriptor detaches it, the queue stays open */
+static int mq_fd_close(void *obj)
+{
+	mqueue_desc *mqd = obj;
+
+	mqd->fd = -1;
+
+	return 0;
+}
+
+static int mq_fd_ioctl(void *obj, unsigned int request, va_list args)
+{
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+		struct k_poll_event *pev_end;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+		pev_end = va_arg(args, struct k_poll_event *);
+
+		return mq_poll_prepare(obj, pfd, pev, pev_end);
+	}
+
+	case ZFD_IOCTL_POLL_UPDATE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+
+		return mq_poll_update(obj, pfd, pev);
+	}
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable mq_fd_vtable = {
+	.read = mq_fd_read,
+	.write = mq_fd_write,
+	.close = mq_fd_close,
+	.ioctl = mq_fd_ioctl,
+};
+
+static int open_fd(mqueue_desc *mqd)
+{
+	mqd->fd = z_alloc_fd(mqd, &mq_fd_vtable);
+
+	return mqd->fd;
+}
+
+static void close_fd(mqueue_desc *mqd)
+{
+	if (mqd->fd >= 0) {
+		z_free_fd(mqd->fd);
+		mqd->fd = -1;
+	}
+}
+
+/**
+ * @brief Get the file descriptor of a message queue descriptor.
+ *
+ * Zephyr extension, as in FreeBSD.
+ */
+int mq_getfd_np(mqd_t mqdes)
+{
+	mqueue_desc *mqd = (mqueue_desc *)mqdes;
+
+	if ((mqd == NULL) || (mqd->fd < 0)) {
+		errno = EBADF;
+		return -1;
+	}
+
+	return mqd->fd;
+}
+#else
+static inline void update_signals(mqueue_object *msg_queue)
+{
+	ARG_UNUSED(msg_queue);
+}
+
+static inline int open_fd(mqueue_desc *mqd)
+{
+	ARG_UNUSED(mqd);
+
+	return 0;
+}
+
+static inline void close_fd(mqueue_desc *mqd)
+{
+	ARG_UNUSED(mqd);
+}
+#endif /* CONFIG_POSIX_MQUEUE_FD */
+
 static void remove_mq(mqueue_object *msg_queue)
 {
 	if (atomic_cas(&msg_queue->ref_count, 0, 0)) {
@@ -12,8 +12,6 @@
 #include <zephyr/posix/pthread.h>
 #include <zephyr/sys/bitarray.h>
 
-static struct k_spinlock pthread_mutex_spinlock;
-
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
 
 #define MUTEX_MAX_REC_LOCK 32767
@@ -104,18 +102,22 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 	size_t bit;
 	int ret = 0;
 	struct k_mutex *m;
-	k_spinlock_key_t key;
 
 	m = to_posix_mutex(mu);
 	if (m == NULL) {
 		return EINVAL;
 	}
 
-	bit = posix_mutex_to_offset(m);
-	type = posix_mutex_type[bit];
-
-	key = k_spin_lock(&pthread_mutex_spinlock);
+	/*
+	 * No lock is needed to check the owner: only the current thread can
+	 * make itself the owner, or stop being the owner, so the outcome of the
+	 * comparison cannot change under us. An uncontended lock thus goes
+	 * straight to k_mutex_lock().
+	 */
 	if (m->owner == k_current_get()) {
+		bit = posix_mutex_to_offset(m);
+		type = posix_mutex_type[bit];
+
 		switch (type) {
 		case PTHREAD_MUTEX_NORMAL:
 			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -123,7 +125,6 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 				break;
 			}
 			/* On most POSIX systems, this usually results in an infinite loop */
-			k_spin_unlock(&pthread_mutex_spinlock, key);
 			do {
 				(void)k_sleep(K_FOREVER);
 			} while (true);
@@ -143,7 +144,6 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 			break;
 		}
 	}
-	k_spin_unlock(&pthread_mutex_spinlock, key);
 
 	if (ret == 0) {
 		ret = k_mutex_lock(m, timeout);
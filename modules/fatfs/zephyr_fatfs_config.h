@@ -63,6 +63,19 @@
 #define FF_FS_EXFAT		CONFIG_FS_FATFS_EXFAT
 #endif /* defined(CONFIG_FS_FATFS_EXFAT) */
 
+#if defined(CONFIG_FS_FATFS_EXPAND)
+#undef FF_USE_EXPAND
+#define FF_USE_EXPAND		CONFIG_FS_FATFS_EXPAND
+#endif /* defined(CONFIG_FS_FATFS_EXPAND) */
+
+#if defined(CONFIG_FS_FATFS_FILE_BUFFER)
+#undef FF_FS_TINY
+#define FF_FS_TINY 0
+#else
+#undef FF_FS_TINY
+#define FF_FS_TINY 1
+#endif /* defined(CONFIG_FS_FATFS_FILE_BUFFER) */
+
 #if defined(CONFIG_FS_FATFS_REENTRANT)
 #undef FF_FS_REENTRANT
 #undef FF_FS_TIMEOUT
@@ -75,9 +88,6 @@
  * These options are override from default values, but have no Kconfig
  * options.
  */
-#undef FF_FS_TINY
-#define FF_FS_TINY 1
-
 #undef FF_FS_NORTC
 #define FF_FS_NORTC 1
 
@@ -48,6 +48,28 @@ static bool is_panic_mode;
 static const uint8_t *write_buffer;
 static uint16_t write_length;
 
+#if defined(CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC)
+struct ot_uart_rx_buf {
+	/* Held by the driver and by each chunk not processed yet */
+	atomic_t refs;
+	uint8_t data[CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC_BUF_SIZE];
+};
+
+struct ot_uart_rx_chunk {
+	struct ot_uart_rx_buf *buf;
+	const uint8_t *data;
+	size_t len;
+};
+
+static struct ot_uart_rx_buf rx_bufs[CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC_BUFS];
+K_MSGQ_DEFINE(rx_chunks, sizeof(struct ot_uart_rx_chunk),
+	      CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC_CHUNKS, 4);
+static atomic_t rx_stopped;
+static bool use_async;
+#else
+#define use_async false
+#endif /* CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC */
+
 static void uart_rx_handle(const struct device *dev)
 {
 	uint8_t *data;
@@ -117,6 +139,111 @@ static void uart_callback(const struct device *dev, void *user_data)
 	}
 }
 
+#if defined(CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC)
+static struct ot_uart_rx_buf *rx_buf_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(rx_bufs); i++) {
+		if (atomic_cas(&rx_bufs[i].refs, 0, 1)) {
+			return &rx_bufs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void rx_buf_unref(const uint8_t *data)
+{
+	struct ot_uart_rx_buf *buf = CONTAINER_OF(data, struct ot_uart_rx_buf, data);
+
+	atomic_dec(&buf->refs);
+}
+
+/* Received data is decoded by the OpenThread thread straight from the DMA
+ * buffers, which are given back to the driver once processed.
+ */
+static void uart_async_callback(const struct device *dev, struct uart_event *evt,
+				void *user_data)
+{
+	struct ot_uart_rx_chunk chunk;
+	struct ot_uart_rx_buf *buf;
+
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		ot_uart.tx_busy = 0;
+		atomic_set(&(ot_uart.tx_finished), 1);
+		otSysEventSignalPending();
+		break;
+	case UART_RX_RDY:
+		chunk.buf = CONTAINER_OF(evt->data.rx.buf, struct ot_uart_rx_buf, data);
+		chunk.data = &evt->data.rx.buf[evt->data.rx.offset];
+		chunk.len = evt->data.rx.len;
+
+		atomic_inc(&chunk.buf->refs);
+		if (k_msgq_put(&rx_chunks, &chunk, K_NO_WAIT) != 0) {
+			LOG_WRN("RX chunk queue full.");
+			atomic_dec(&chunk.buf->refs);
+			break;
+		}
+
+		otSysEventSignalPending();
+		break;
+	case UART_RX_BUF_REQUEST:
+		/* Without a free buffer, reception stops when the current one
+		 * is full, and is restarted once the buffers are processed.
+		 */
+		buf = rx_buf_alloc();
+		if (buf != NULL) {
+			uart_rx_buf_rsp(dev, buf->data, sizeof(buf->data));
+		}
+		break;
+	case UART_RX_BUF_RELEASED:
+		rx_buf_unref(evt->data.rx_buf.buf);
+		break;
+	case UART_RX_DISABLED:
+		atomic_set(&rx_stopped, 1);
+		otSysEventSignalPending();
+		break;
+	default:
+		break;
+	}
+}
+
+static void uart_async_rx_start(void)
+{
+	struct ot_uart_rx_buf *buf = rx_buf_alloc();
+
+	if (buf == NULL) {
+		/* Retried once some buffers are processed */
+		return;
+	}
+
+	atomic_set(&rx_stopped, 0);
+	if (uart_rx_enable(ot_uart.dev, buf->data, sizeof(buf->data),
+			   CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC_RX_TIMEOUT_US) != 0) {
+		LOG_ERR("Failed to enable UART RX");
+		atomic_dec(&buf->refs);
+		atomic_set(&rx_stopped, 1);
+	}
+}
+
+static void uart_async_process(void)
+{
+	struct ot_uart_rx_chunk chunk;
+
+	while (k_msgq_get(&rx_chunks, &chunk, K_NO_WAIT) == 0) {
+		otPlatUartReceived(chunk.data, chunk.len);
+		atomic_dec(&chunk.buf->refs);
+	}
+
+	if (atomic_get(&rx_stopped) && !is_panic_mode) {
+		uart_async_rx_start();
+	}
+}
+#endif /* CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC */
+
 void otPlatUartReceived(const uint8_t *aBuf, uint16_t aBufLength)
 {
 	otNcpHdlcReceive(aBuf, aBufLength);
@@ -132,6 +259,12 @@ void platformUartProcess(otInstance *aInstance)
 	uint32_t len = 0;
 	const uint8_t *data;
 
+#if defined(CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC)
+	if (use_async) {
+		uart_async_process();
+	}
+#endif
+
 	/* Process UART RX */
 	while ((len = ring_buf_get_claim(
 			ot_uart.rx_ringbuf,
@@ -164,9 +297,16 @@ otError otPlatUartEnable(void)
 		return OT_ERROR_FAILED;
 	}
 
-	uart_irq_callback_user_data_set(ot_uart.dev,
-					uart_callback,
-					(void *)&ot_uart);
+#if defined(CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC)
+	/* UARTs without the asynchronous API, such as CDC ACM, use interrupts */
+	use_async = uart_callback_set(ot_uart.dev, uart_async_callback, NULL) == 0;
+#endif
+
+	if (!use_async) {
+		uart_irq_callback_user_data_set(ot_uart.dev,
+						uart_callback,
+						(void *)&ot_uart);
+	}
 
 	if (DT_NODE_HAS_COMPAT(DT_CHOSEN(zephyr_ot_uart), zephyr_cdc_acm_uart)) {
 		int ret;
@@ -198,6 +338,13 @@ otError otPlatUartEnable(void)
 		(void)uart_line_ctrl_set(ot_uart.dev, UART_LINE_CTRL_DSR, 1);
 	}
 
+#if defined(CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC)
+	if (use_async) {
+		uart_async_rx_start();
+		return OT_ERROR_NONE;
+	}
+#endif
+
 	uart_irq_rx_enable(ot_uart.dev);
 
 	return OT_ERROR_NONE;
@@ -213,6 +360,14 @@ otError otPlatUartDisable(void)
 		}
 	}
 
+#if defined(CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC)
+	if (use_async) {
+		(void)uart_tx_abort(ot_uart.dev);
+		(void)uart_rx_disable(ot_uart.dev);
+		return OT_ERROR_NONE;
+	}
+#endif
+
 	uart_irq_tx_disable(ot_uart.dev);
 	uart_irq_rx_disable(ot_uart.dev);
 	return OT_ERROR_NONE;
@@ -233,6 +388,12 @@ otError otPlatUartSend(const uint8_t *aBuf, uint16_t aBufLength)
 			 * without using interrupts
 			 */
 			otPlatUartFlush();
+		} else if (use_async) {
+			/* The encoded frame is sent by DMA from the caller buffer */
+			if (uart_tx(ot_uart.dev, aBuf, aBufLength, SYS_FOREVER_US) != 0) {
+				ot_uart.tx_busy = 0;
+				return OT_ERROR_FAILED;
+			}
 		} else {
 			uart_irq_tx_enable(ot_uart.dev);
 		}
@@ -246,6 +407,14 @@ otError otPlatUartFlush(void)
 {
 	otError result = OT_ERROR_NONE;
 
+	if (use_async && !is_panic_mode) {
+		/* The transfer reports its completion */
+		while (atomic_get(&ot_uart.tx_busy) == 1) {
+			k_busy_wait(100);
+		}
+		return result;
+	}
+
 	if (write_length) {
 		for (size_t i = 0; i < write_length; i++) {
 			uart_poll_out(ot_uart.dev, *(write_buffer+i));
@@ -264,6 +433,14 @@ void platformUartPanic(void)
 	/* In panic mode data are send without using interrupts.
 	 * Reception in this mode is not supported.
 	 */
+#if defined(CONFIG_OPENTHREAD_COPROCESSOR_UART_ASYNC)
+	if (use_async) {
+		(void)uart_tx_abort(ot_uart.dev);
+		(void)uart_rx_disable(ot_uart.dev);
+		return;
+	}
+#endif
+
 	uart_irq_tx_disable(ot_uart.dev);
 	uart_irq_rx_disable(ot_uart.dev);
 }
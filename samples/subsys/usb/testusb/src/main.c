@@ -7,13 +7,73 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/usb/usb_device.h>
+#include <zephyr/usb/usbd.h>
 LOG_MODULE_REGISTER(main);
 
+#if defined(CONFIG_USB_DEVICE_STACK_NEXT)
+USBD_CONFIGURATION_DEFINE(config_1, USB_SCD_SELF_POWERED, 200);
+
+USBD_DESC_LANG_DEFINE(sample_lang);
+USBD_DESC_MANUFACTURER_DEFINE(sample_mfr, "ZEPHYR");
+USBD_DESC_PRODUCT_DEFINE(sample_product, "Zephyr testusb sample");
+
+USBD_DEVICE_DEFINE(sample_usbd,
+		   DEVICE_DT_GET(DT_NODELABEL(zephyr_udc0)),
+		   0x2fe3, 0x0009);
+
+static int enable_usb_device_next(void)
+{
+	int err;
+
+	err = usbd_add_descriptor(&sample_usbd, &sample_lang);
+	if (err) {
+		LOG_ERR("Failed to initialize language descriptor (%d)", err);
+		return err;
+	}
+
+	err = usbd_add_descriptor(&sample_usbd, &sample_mfr);
+	if (err) {
+		LOG_ERR("Failed to initialize manufacturer descriptor (%d)", err);
+		return err;
+	}
+
+	err = usbd_add_descriptor(&sample_usbd, &sample_product);
+	if (err) {
+		LOG_ERR("Failed to initialize product descriptor (%d)", err);
+		return err;
+	}
+
+	err = usbd_add_configuration(&sample_usbd, &config_1);
+	if (err) {
+		LOG_ERR("Failed to add configuration (%d)", err);
+		return err;
+	}
+
+	err = usbd_register_class(&sample_usbd, "loopback_0", 1);
+	if (err) {
+		LOG_ERR("Failed to register loopback class (%d)", err);
+		return err;
+	}
+
+	err = usbd_init(&sample_usbd);
+	if (err) {
+		LOG_ERR("Failed to initialize device support");
+		return err;
+	}
+
+	return usbd_enable(&sample_usbd);
+}
+#endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK_NEXT) */
+
 int main(void)
 {
 	int ret;
 
+#if defined(CONFIG_USB_DEVICE_STACK_NEXT)
+	ret = enable_usb_device_next();
+#else
 	ret = usb_enable(NULL);
+#endif
 	if (ret != 0) {
 		LOG_ERR("Failed to enable USB");
 		return 0;
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 Intel Corporation
+#
+# SPDX-License-Identifier: Apache-2.0
+
+'''
+Script to order functions by their measured hotness.
+
+The "profile" command turns program counter samples, taken on the target
+with a debugger or decoded from trace data, into a function order file:
+the names of the sampled functions of a Zephyr ELF file, hottest first,
+one per line. Each line of the samples file is an address, optionally
+followed by a number of hits, lines starting with '#' are ignored.
+
+The "linker" command turns a function order file into a linker script
+snippet placing the input section of each function, in order, at the
+start of the text section, see CONFIG_LINKER_FUNCTION_ORDER.
+'''
+
+import argparse
+import bisect
+import sys
+from collections import Counter
+
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+
+def read_functions(elf_path):
+    functions = []
+    with open(elf_path, 'rb') as f:
+        elf = ELFFile(f)
+        symtab = elf.get_section_by_name('.symtab')
+        if not isinstance(symtab, SymbolTableSection):
+            sys.exit(f'{elf_path} has no symbol table')
+
+        for sym in symtab.iter_symbols():
+            if sym['st_info']['type'] == 'STT_FUNC' and sym['st_size'] > 0:
+                # The Thumb bit is not part of the address
+                start = sym['st_value'] & ~1
+                functions.append((start, start + sym['st_size'], sym.name))
+
+    functions.sort()
+    return functions
+
+
+def read_samples(samples_path):
+    samples = Counter()
+    with open(samples_path) as f:
+        for line in f:
+            fields = line.split()
+            if not fields or fields[0].startswith('#'):
+                continue
+            hits = int(fields[1], 0) if len(fields) > 1 else 1
+            samples[int(fields[0], 16)] += hits
+
+    return samples
+
+
+def profile(args):
+    functions = read_functions(args.kernel)
+    starts = [func[0] for func in functions]
+    hits = Counter()
+
+    for addr, count in read_samples(args.samples).items():
+        i = bisect.bisect_right(starts, addr) - 1
+        if i >= 0 and addr < functions[i][1]:
+            hits[functions[i][2]] += count
+
+    with open(args.output, 'w') as out:
+        for name, _ in hits.most_common(args.max_functions):
+            out.write(f'{name}\n')
+
+
+def linker(args):
+    with open(args.order) as f:
+        names = [line.strip() for line in f]
+
+    with open(args.output, 'w') as out:
+        out.write('/* Generated by gen_function_order.py, do not edit */\n')
+        for name in names:
+            if name and not name.startswith('#'):
+                out.write(f'\t*(.text.{name})\n')
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    profile_parser = subparsers.add_parser(
+        'profile', help='generate a function order file from samples')
+    profile_parser.add_argument('-k', '--kernel', required=True,
+                                help='Zephyr ELF file the samples come from')
+    profile_parser.add_argument('-s', '--samples', required=True,
+                                help='program counter samples')
+    profile_parser.add_argument('-n', '--max-functions', type=int,
+                                help='number of functions to order')
+    profile_parser.add_argument('-o', '--output', required=True,
+                                help='function order file')
+    profile_parser.set_defaults(func=profile)
+
+    linker_parser = subparsers.add_parser(
+        'linker', help='generate a linker script snippet from an order file')
+    linker_parser.add_argument('-i', '--order', required=True,
+                               help='function order file')
+    linker_parser.add_argument('-o', '--output', required=True,
+                               help='linker script snippet')
+    linker_parser.set_defaults(func=linker)
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
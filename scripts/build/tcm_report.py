@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 Intel Corporation
+#
+# SPDX-License-Identifier: Apache-2.0
+
+'''
+Script to report what is placed in tightly coupled memory.
+
+This script lists the functions and variables of the ITCM and DTCM output
+sections of a Zephyr ELF file, with their sizes, so that what was moved
+there with __hot_code, __hot_data or the other TCM section attributes can
+be reviewed after each build.
+'''
+
+import argparse
+import sys
+
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+TCM_SECTIONS = ('.itcm', '.dtcm_data', '.dtcm_bss', '.dtcm_noinit')
+
+
+def tcm_symbols(elf):
+    sections = {}
+    for index, section in enumerate(elf.iter_sections()):
+        if section.name in TCM_SECTIONS:
+            sections[index] = section
+
+    symbols = {index: [] for index in sections}
+    symtab = elf.get_section_by_name('.symtab')
+    if isinstance(symtab, SymbolTableSection):
+        for sym in symtab.iter_symbols():
+            index = sym['st_shndx']
+            if (index in symbols and sym['st_size'] > 0 and
+                    sym['st_info']['type'] in ('STT_FUNC', 'STT_OBJECT')):
+                symbols[index].append(sym)
+
+    return sections, symbols
+
+
+def write_report(out, sections, symbols):
+    if not sections:
+        out.write('No tightly coupled memory section\n')
+        return
+
+    for index, section in sections.items():
+        out.write(f"{section.name}: {section['sh_size']} bytes "
+                  f"at {section['sh_addr']:#010x}\n")
+        for sym in sorted(symbols[index], key=lambda s: s['st_value']):
+            out.write(f"  {sym['st_value']:#010x} {sym['st_size']:8} "
+                      f"{sym.name}\n")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+
+    parser.add_argument('-k', '--kernel', required=True,
+                        help='Zephyr ELF file')
+    parser.add_argument('-o', '--output',
+                        help='Report file, standard output by default')
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+
+    with open(args.kernel, 'rb') as f:
+        sections, symbols = tcm_symbols(ELFFile(f))
+
+    if args.output:
+        with open(args.output, 'w') as out:
+            write_report(out, sections, symbols)
+    else:
+        write_report(sys.stdout, sections, symbols)
+
+
+if __name__ == '__main__':
+    main()
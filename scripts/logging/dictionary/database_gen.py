@@ -257,6 +257,11 @@ def process_kconfigs(elf, database):
         database.add_kconfig("CONFIG_LOG_TIMESTAMP_64BIT",
                              kconfigs['CONFIG_LOG_TIMESTAMP_64BIT'])
 
+    # Fixed size or variable length message header?
+    if "CONFIG_LOG_DICTIONARY_COMPACT" in kconfigs:
+        database.add_kconfig("CONFIG_LOG_DICTIONARY_COMPACT",
+                             kconfigs['CONFIG_LOG_DICTIONARY_COMPACT'])
+
 
 def extract_logging_subsys_information(elf, database, string_mappings):
     """
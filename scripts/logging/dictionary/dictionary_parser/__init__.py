@@ -15,8 +15,8 @@ def get_parser(database):
     """Get the parser object based on database"""
     db_ver = int(database.get_version())
 
-    # DB version 1 and 2 correspond to v1 parser
-    if db_ver in [1, 2]:
+    # DB version 1 to 3 correspond to v1 parser
+    if db_ver in [1, 2, 3]:
         return LogParserV1(database)
 
     return None
@@ -59,7 +59,7 @@ class LogDatabase():
     """Class of log database"""
     # Update this if database format of dictionary based logging
     # has changed
-    ZEPHYR_DICT_LOG_VER = 2
+    ZEPHYR_DICT_LOG_VER = 3
 
     LITTLE_ENDIAN = True
     BIG_ENDIAN = False
@@ -63,10 +63,33 @@ MSG_TYPE_DROPPED = 1
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
 
+# With CONFIG_LOG_DICTIONARY_COMPACT, the first byte holds the message
+# type, domain and level, followed by LEB128 variable length integers.
+# Keep in sync with include/logging/log_output_dict.h.
+COMPACT_TYPE_MASK = 0x3
+COMPACT_DOMAIN_POS = 2
+COMPACT_LEVEL_POS = 5
+
 
 logger = logging.getLogger("parser")
 
 
+def decode_varint(logdata, offset):
+    """Decode an unsigned LEB128 integer, return it with the next offset"""
+    value = 0
+    shift = 0
+
+    while True:
+        byte = logdata[offset]
+        offset += 1
+
+        value |= (byte & 0x7f) << shift
+        shift += 7
+
+        if (byte & 0x80) == 0:
+            return (value, offset)
+
+
 def get_log_level_str_color(lvl):
     """Convert numeric log level to string"""
     if lvl < 0 or lvl >= len(LOG_LEVELS):
@@ -187,6 +210,8 @@ class LogParserV1(LogParser):
         else:
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_32
 
+        self.compact = "CONFIG_LOG_DICTIONARY_COMPACT" in self.database.get_kconfigs()
+
         self.data_types = DataTypes(self.database)
 
 
@@ -356,9 +381,8 @@ class LogParserV1(LogParser):
                   hex_vals, hex_padding, chr_vals))
 
 
-    def parse_one_normal_msg(self, logdata, offset):
-        """Parse one normal log message and print the encoded message"""
-        # Parse log message header
+    def parse_msg_hdr(self, logdata, offset):
+        """Parse the fixed size header of a normal log message"""
         log_desc, source_id = struct.unpack_from(self.fmt_msg_hdr, logdata, offset)
         offset += struct.calcsize(self.fmt_msg_hdr)
 
@@ -371,6 +395,33 @@ class LogParserV1(LogParser):
         pkg_len = (log_desc >> 6) & int(math.pow(2, 10) - 1)
         data_len = (log_desc >> 16) & int(math.pow(2, 12) - 1)
 
+        return (domain_id, level, pkg_len, data_len, source_id, timestamp, offset)
+
+
+    @staticmethod
+    def parse_compact_msg_hdr(msg_desc, logdata, offset):
+        """Parse the variable length header of a normal log message"""
+        domain_id = (msg_desc >> COMPACT_DOMAIN_POS) & 0x07
+        level = (msg_desc >> COMPACT_LEVEL_POS) & 0x07
+
+        pkg_len, offset = decode_varint(logdata, offset)
+        data_len, offset = decode_varint(logdata, offset)
+        source_id, offset = decode_varint(logdata, offset)
+        timestamp, offset = decode_varint(logdata, offset)
+
+        return (domain_id, level, pkg_len, data_len, source_id, timestamp, offset)
+
+
+    def parse_one_normal_msg(self, logdata, offset, msg_desc=0):
+        """Parse one normal log message and print the encoded message"""
+        # Parse log message header
+        if self.compact:
+            hdr = self.parse_compact_msg_hdr(msg_desc, logdata, offset)
+        else:
+            hdr = self.parse_msg_hdr(logdata, offset)
+
+        domain_id, level, pkg_len, data_len, source_id, timestamp, offset = hdr
+
         level_str, color = get_log_level_str_color(level)
         source_id_str = self.database.get_log_source_string(domain_id, source_id)
 
@@ -448,17 +499,25 @@ class LogParserV1(LogParser):
 
         while offset < len(logdata):
             # Get message type
-            msg_type = struct.unpack_from(self.fmt_msg_type, logdata, offset)[0]
+            msg_desc = struct.unpack_from(self.fmt_msg_type, logdata, offset)[0]
             offset += struct.calcsize(self.fmt_msg_type)
 
+            if self.compact:
+                msg_type = msg_desc & COMPACT_TYPE_MASK
+            else:
+                msg_type = msg_desc
+
             if msg_type == MSG_TYPE_DROPPED:
-                num_dropped = struct.unpack_from(self.fmt_dropped_cnt, logdata, offset)
-                offset += struct.calcsize(self.fmt_dropped_cnt)
+                if self.compact:
+                    num_dropped, offset = decode_varint(logdata, offset)
+                else:
+                    num_dropped = struct.unpack_from(self.fmt_dropped_cnt, logdata, offset)[0]
+                    offset += struct.calcsize(self.fmt_dropped_cnt)
 
                 print(f"--- {num_dropped} messages dropped ---")
 
             elif msg_type == MSG_TYPE_NORMAL:
-                ret = self.parse_one_normal_msg(logdata, offset)
+                ret = self.parse_one_normal_msg(logdata, offset, msg_desc)
                 if ret is None:
                     return False
 
@@ -66,9 +66,13 @@ static uint64_t hw_timer_awake_timer;
 
 static uint64_t tick_p; /* Period of the ticker */
 static int64_t silent_ticks;
+/* Next tick of the ticker, silent or not, when skipping the silent ones */
+static uint64_t tick_next;
 
 static bool real_time_mode;
 
+static bool skip_silent_ticks;
+
 static bool reset_rtc; /*"Reset" the RTC on boot*/
 
 /*
@@ -112,6 +116,16 @@ void hwtimer_set_real_time_mode(bool new_rt)
 	real_time_mode = new_rt;
 }
 
+/**
+ * Let the ticker go straight to its next tick which is not silent, instead of
+ * going through each silent tick. This does not change when the tick
+ * interrupts are raised, only how fast idle periods are simulated.
+ */
+void hwtimer_set_skip_silent_ticks(bool new_skip)
+{
+	skip_silent_ticks = new_skip;
+}
+
 static void hwtimer_update_timer(void)
 {
 	hw_timer_timer = NSI_MIN(hw_timer_tick_timer, hw_timer_awake_timer);
@@ -165,6 +179,31 @@ void hwtimer_enable(uint64_t period)
 {
 	tick_p = period;
 	hw_timer_tick_timer = nsi_hws_get_time() + tick_p;
+	tick_next = hw_timer_tick_timer;
+	hwtimer_update_timer();
+	nsi_hws_find_next_event();
+}
+
+/* First tick of the ticker, silent or not, which is not past */
+static uint64_t hwtimer_get_next_tick(void)
+{
+	uint64_t now = nsi_hws_get_time();
+
+	if (tick_next < now) {
+		tick_next += (now - tick_next + tick_p - 1) / tick_p * tick_p;
+	}
+
+	return tick_next;
+}
+
+/* Move the ticker to its next tick which is not silent */
+static void hwtimer_skip_silent_ticks(void)
+{
+	/* The kernel cannot be announced more ticks at once anyhow */
+	int64_t skip = silent_ticks < INT32_MAX ? silent_ticks : INT32_MAX;
+
+	hw_timer_tick_timer = hwtimer_get_next_tick() + skip * tick_p;
+	silent_ticks -= skip;
 	hwtimer_update_timer();
 	nsi_hws_find_next_event();
 }
@@ -210,6 +249,13 @@ static void hwtimer_tick_timer_reached(void)
 	} else {
 		hw_irq_ctrl_set_irq(TIMER_TICK_IRQ);
 	}
+
+	if (skip_silent_ticks) {
+		tick_next = hw_timer_tick_timer;
+		if (silent_ticks > 0) {
+			hwtimer_skip_silent_ticks();
+		}
+	}
 }
 
 static void hwtimer_awake_timer_reached(void)
@@ -258,10 +304,20 @@ void hwtimer_wake_in_time(uint64_t time)
 void hwtimer_set_silent_ticks(int64_t sys_ticks)
 {
 	silent_ticks = sys_ticks;
+
+	if (skip_silent_ticks && tick_p != 0) {
+		hwtimer_skip_silent_ticks();
+	}
 }
 
 int64_t hwtimer_get_pending_silent_ticks(void)
 {
+	if (skip_silent_ticks && tick_p != 0) {
+		/* Including the ticks skipped already */
+		return silent_ticks +
+		       (hw_timer_tick_timer - hwtimer_get_next_tick()) / tick_p;
+	}
+
 	return silent_ticks;
 }
 
@@ -427,6 +483,13 @@ static void cmd_no_realtime_found(char *argv, int offset)
 	hwtimer_set_real_time_mode(false);
 }
 
+static void cmd_skip_silent_ticks_found(char *argv, int offset)
+{
+	NSI_ARG_UNUSED(argv);
+	NSI_ARG_UNUSED(offset);
+	hwtimer_set_skip_silent_ticks(true);
+}
+
 static void cmd_rtcoffset_found(char *argv, int offset)
 {
 	NSI_ARG_UNUSED(argv);
@@ -484,6 +547,15 @@ static void nsi_add_time_options(void)
 				    "the simulated time as fast as possible and decoupled from "
 				    "the host time"
 		},
+		{
+			.is_switch = true,
+			.option = "skip-silent-ticks",
+			.type = 'b',
+			.call_when_found = cmd_skip_silent_ticks_found,
+			.descript = "Go straight to the next system tick the kernel waits for "
+				    "when it is idle, instead of simulating each tick in between. "
+				    "In real time mode, sleep until then at once"
+		},
 		{
 			.option = "rt-drift",
 			.name = "dratio",
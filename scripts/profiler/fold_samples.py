@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 Intel Corporation
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Turn the output of the "profiler dump" shell command into folded stacks.
+
+Each output line is a semicolon separated call stack, outermost function
+first, followed by the number of samples, as expected by flamegraph.pl
+(https://github.com/brendangregg/FlameGraph):
+
+    fold_samples.py zephyr.elf dump.log | flamegraph.pl > profile.svg
+"""
+
+import argparse
+import bisect
+import collections
+import re
+import sys
+
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+LINE_RE = re.compile(r'^\s*([STD]) ([0-9a-fA-F]+)(.*)$')
+
+
+class Symbols:
+    def __init__(self, elf_path):
+        funcs = []
+
+        with open(elf_path, 'rb') as f:
+            elf = ELFFile(f)
+            # The lowest bit of Thumb function addresses is set
+            mask = ~1 if elf['e_machine'] == 'EM_ARM' else ~0
+
+            for section in elf.iter_sections():
+                if not isinstance(section, SymbolTableSection):
+                    continue
+                for sym in section.iter_symbols():
+                    if (sym['st_info']['type'] == 'STT_FUNC' and
+                            sym['st_size'] > 0):
+                        funcs.append((sym['st_value'] & mask,
+                                      sym['st_size'], sym.name))
+
+        funcs.sort()
+        self.starts = [start for start, _, _ in funcs]
+        self.funcs = funcs
+
+    def lookup(self, addr):
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i >= 0:
+            start, size, name = self.funcs[i]
+            if addr < start + size:
+                return name
+
+        return f'0x{addr:x}'
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     allow_abbrev=False)
+
+    parser.add_argument('elf', help='ELF file of the profiled image')
+    parser.add_argument('dump', nargs='?', type=argparse.FileType('r'),
+                        default=sys.stdin,
+                        help='output of "profiler dump" (default: stdin)')
+    parser.add_argument('--no-threads', action='store_true',
+                        help='do not split the stacks by thread')
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    symbols = Symbols(args.elf)
+    threads = {}
+    stacks = collections.Counter()
+    dropped = 0
+
+    for line in args.dump:
+        match = LINE_RE.match(line.strip())
+        if not match:
+            continue
+
+        kind, value, rest = match.groups()
+        if kind == 'S':
+            addrs = [int(addr, 16) for addr in rest.split()]
+            stacks[(value, tuple(addrs))] += 1
+        elif kind == 'T':
+            threads[value] = rest.strip() or f'0x{value}'
+        else:
+            dropped += int(value)
+
+    for (thread, addrs), count in sorted(stacks.items()):
+        if addrs:
+            # Return addresses follow the call instruction
+            names = [symbols.lookup(addrs[0])]
+            names += [symbols.lookup(addr - 1) for addr in addrs[1:]]
+            names.reverse()
+        else:
+            names = ['[interrupt]']
+
+        if not args.no_threads:
+            names.insert(0, threads.get(thread, f'0x{thread}'))
+
+        print(f"{';'.join(names)} {count}")
+
+    if dropped:
+        print(f'warning: {dropped} samples dropped', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""
+Utility script to create and apply delta patches of firmware images
+
+Usage::
+
+    python $ZEPHYR_BASE/scripts/utils/delta_patch.py create old.bin new.bin patch.bin
+    python $ZEPHYR_BASE/scripts/utils/delta_patch.py apply old.bin patch.bin new.bin
+
+The old image is the one running on the device, normally read back from the
+primary slot or kept from the previous release; the new image is the signed
+image that the device would otherwise download. The patch format is described
+in include/zephyr/dfu/flash_img_delta.h, patches are applied on the device
+with the flash_img_delta API (CONFIG_IMG_DELTA).
+
+
+Copyright (c) 2023 Intel Corporation
+SPDX-License-Identifier: Apache-2.0
+"""
+
+import argparse
+import sys
+
+
+MAGIC = b"ZDP1"
+
+# Length of the blocks of the old image which are indexed to find matches
+BLOCK_LEN = 16
+# Step between indexed blocks of the old image
+BLOCK_STEP = 4
+# A match is extended while it keeps improving within this many bytes
+EXTEND_SLACK = 64
+
+
+def num_encode(val):
+    out = bytearray()
+    while True:
+        byte = val & 0x7F
+        val >>= 7
+        if val:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def num_decode(data, pos):
+    val = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        val |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return val, pos
+
+
+def zigzag_encode(val):
+    return (val << 1) if val >= 0 else ((-val << 1) - 1)
+
+
+def zigzag_decode(val):
+    return (val >> 1) ^ -(val & 1)
+
+
+def diff_encode(diff):
+    """Encodes a diff block, a zero byte is followed by the number of zero
+    bytes which follow it."""
+    out = bytearray()
+    pos = 0
+    while pos < len(diff):
+        if diff[pos]:
+            out.append(diff[pos])
+            pos += 1
+            continue
+        end = pos
+        while end < len(diff) and not diff[end]:
+            end += 1
+        out.append(0)
+        out += num_encode(end - pos - 1)
+        pos = end
+    return bytes(out)
+
+
+def diff_decode(patch, pos, length):
+    """Decodes a diff block of the given length, returns it and the offset
+    following it."""
+    diff = bytearray()
+    while len(diff) < length:
+        byte = patch[pos]
+        pos += 1
+        if byte:
+            diff.append(byte)
+            continue
+        run, pos = num_decode(patch, pos)
+        diff += bytes(run + 1)
+    if len(diff) != length:
+        raise ValueError("diff block overruns its length")
+    return bytes(diff), pos
+
+
+def extend(old, new, old_pos, new_pos):
+    """Returns the length of the approximate match starting at the given offsets,
+    bytes of the match may differ as long as most of them are equal."""
+    best_len = 0
+    best_score = 0
+    score = 0
+    i = 0
+    while old_pos + i < len(old) and new_pos + i < len(new):
+        score += 1 if old[old_pos + i] == new[new_pos + i] else -1
+        i += 1
+        if score > best_score:
+            best_score = score
+            best_len = i
+        elif i - best_len > EXTEND_SLACK:
+            break
+    return best_len
+
+
+def find_matches(old, new):
+    """Returns a list of (new offset, old offset, length) of matches, in order
+    of the new image and not overlapping in it."""
+    index = {}
+    for pos in range(0, len(old) - BLOCK_LEN + 1, BLOCK_STEP):
+        index.setdefault(old[pos:pos + BLOCK_LEN], pos)
+
+    matches = []
+    pos = 0
+    # The old offset following the last match, code that only moved is often
+    # followed by more code which moved by the same amount
+    next_old = 0
+    while pos + BLOCK_LEN <= len(new):
+        length = 0
+        if next_old + BLOCK_LEN <= len(old) and \
+                old[next_old:next_old + BLOCK_LEN] == new[pos:pos + BLOCK_LEN]:
+            old_pos = next_old
+            length = extend(old, new, old_pos, pos)
+        else:
+            old_pos = index.get(new[pos:pos + BLOCK_LEN])
+            if old_pos is not None:
+                length = extend(old, new, old_pos, pos)
+
+        if length < BLOCK_LEN:
+            pos += 1
+            continue
+
+        matches.append((pos, old_pos, length))
+        pos += length
+        next_old = old_pos + length
+
+    return matches
+
+
+def create(old, new):
+    patch = bytearray(MAGIC)
+    patch += num_encode(len(new))
+
+    if not new:
+        return bytes(patch)
+
+    matches = find_matches(old, new)
+    src = 0
+    if not matches or matches[0][:2] != (0, 0):
+        # Leading data which matches nothing in the old image
+        end = matches[0][0] if matches else len(new)
+        src = matches[0][1] if matches else 0
+        patch += num_encode(0) + num_encode(end)
+        patch += new[:end]
+        patch += num_encode(zigzag_encode(src))
+
+    for i, (new_pos, old_pos, length) in enumerate(matches):
+        assert old_pos == src
+        end = matches[i + 1][0] if i + 1 < len(matches) else len(new)
+        next_src = matches[i + 1][1] if i + 1 < len(matches) else old_pos + length
+
+        patch += num_encode(length) + num_encode(end - new_pos - length)
+        patch += diff_encode(bytes((new[new_pos + j] - old[old_pos + j]) & 0xFF
+                                   for j in range(length)))
+        patch += new[new_pos + length:end]
+        patch += num_encode(zigzag_encode(next_src - old_pos - length))
+        src = next_src
+
+    return bytes(patch)
+
+
+def apply(old, patch):
+    if patch[:len(MAGIC)] != MAGIC:
+        raise ValueError("not a delta patch")
+
+    size, pos = num_decode(patch, len(MAGIC))
+    new = bytearray()
+    src = 0
+    while len(new) < size:
+        diff_len, pos = num_decode(patch, pos)
+        extra_len, pos = num_decode(patch, pos)
+        if src + diff_len > len(old) or len(new) + diff_len + extra_len > size:
+            raise ValueError("patch does not apply to the old image")
+        diff, pos = diff_decode(patch, pos, diff_len)
+        new += bytes((diff[j] + old[src + j]) & 0xFF for j in range(diff_len))
+        src += diff_len
+        new += patch[pos:pos + extra_len]
+        pos += extra_len
+        adjust, pos = num_decode(patch, pos)
+        src += zigzag_decode(adjust)
+        if src < 0 or src > len(old):
+            raise ValueError("patch does not apply to the old image")
+
+    if pos != len(patch):
+        raise ValueError("trailing data after the patch")
+
+    return bytes(new)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+    )
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    create_parser = sub.add_parser("create", help="create a patch")
+    create_parser.add_argument("old", type=argparse.FileType("rb"))
+    create_parser.add_argument("new", type=argparse.FileType("rb"))
+    create_parser.add_argument("patch", type=argparse.FileType("wb"))
+
+    apply_parser = sub.add_parser("apply", help="apply a patch")
+    apply_parser.add_argument("old", type=argparse.FileType("rb"))
+    apply_parser.add_argument("patch", type=argparse.FileType("rb"))
+    apply_parser.add_argument("new", type=argparse.FileType("wb"))
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+
+    if args.command == "create":
+        old = args.old.read()
+        new = args.new.read()
+        patch = create(old, new)
+        if apply(old, patch) != new:
+            sys.exit("internal error: patch does not rebuild the new image")
+        args.patch.write(patch)
+        print(f"{len(new)} byte image, {len(patch)} byte patch "
+              f"({100 * len(patch) / max(len(new), 1):.1f}%)")
+    else:
+        try:
+            args.new.write(apply(args.old.read(), args.patch.read()))
+        except (ValueError, IndexError) as e:
+            sys.exit(f"error: {e}")
+
+
+if __name__ == "__main__":
+    main()
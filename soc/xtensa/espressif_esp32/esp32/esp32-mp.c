@@ -290,6 +290,14 @@ void arch_start_cpu(int cpu_num, k_thread_stack_t *stack, int sz,
 	smp_log("ESP32: APPCPU initialized");
 }
 
+void arch_sched_directed_ipi(uint32_t cpu_bitmap)
+{
+	/* Only two cores: the only possible target is the other one */
+	if ((cpu_bitmap & BIT(esp_core_id() ^ 1)) != 0) {
+		arch_sched_ipi();
+	}
+}
+
 void arch_sched_ipi(void)
 {
 	const int core_id = esp_core_id();
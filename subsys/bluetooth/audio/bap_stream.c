@@ -258,6 +258,26 @@ int bt_bap_stream_send(struct bt_bap_stream *stream, struct net_buf *buf,
 }
 #endif /* CONFIG_BT_AUDIO_TX */
 
+#if defined(CONFIG_BT_ISO_RX_RING)
+int bt_bap_stream_rx_ring_set(struct bt_bap_stream *stream, struct bt_iso_rx_ring *ring)
+{
+	struct bt_iso_chan *chan = bt_bap_stream_iso_chan_get(stream);
+
+	if (chan == NULL) {
+		LOG_DBG("Stream %p not configured", stream);
+		return -EINVAL;
+	}
+
+	if (ring != NULL && stream->qos != NULL) {
+		ring->delay_us = stream->qos->pd;
+	}
+
+	chan->rx_ring = ring;
+
+	return 0;
+}
+#endif /* CONFIG_BT_ISO_RX_RING */
+
 #if defined(CONFIG_BT_BAP_UNICAST)
 
 /** Checks if the stream can terminate the CIS
@@ -6,6 +6,7 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
 #include <zephyr/types.h>
 #include <soc.h>
 
@@ -105,6 +106,9 @@ struct ticker_node {
 #endif /* !CONFIG_BT_TICKER_LOW_LAT &&
 	* !CONFIG_BT_TICKER_SLOT_AGNOSTIC
 	*/
+#if defined(CONFIG_BT_TICKER_STATS)
+	struct ticker_stats stats;	    /* Collision statistics */
+#endif /* CONFIG_BT_TICKER_STATS */
 };
 
 struct ticker_expire_info_internal {
@@ -312,6 +316,12 @@ struct ticker_instance {
 					 */
 #endif /* !CONFIG_BT_TICKER_SLOT_AGNOSTIC */
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	uint32_t ticks_stats_slot_end;	/* Absolute ticks at the end of the
+					 * last expired slot reservation
+					 */
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #if defined(CONFIG_BT_TICKER_EXT_EXPIRE_INFO)
 	struct ticker_expire_info_internal expire_infos[TICKER_EXPIRE_INFO_MAX];
 	bool expire_infos_outdated;
@@ -1191,6 +1201,37 @@ static void ticker_job_update_expire_infos(struct ticker_instance *instance)
 
 #endif /* CONFIG_BT_TICKER_EXT_EXPIRE_INFO */
 
+#if defined(CONFIG_BT_TICKER_STATS)
+/**
+ * @brief Account the idle time before a slot reservation
+ *
+ * @details Adds the ticks elapsed since the end of the previous slot
+ * reservation to the statistics of the ticker node starting its slot, and
+ * records the end of the new one. Back to back, or overlapping, slot
+ * reservations add no idle ticks.
+ *
+ * @param instance        Pointer to ticker instance
+ * @param ticker          Pointer to ticker node starting its slot
+ * @param ticks_at_expire Absolute ticks at which the slot starts
+ * @internal
+ */
+static void ticker_stats_slot_start(struct ticker_instance *instance,
+				    struct ticker_node *ticker,
+				    uint32_t ticks_at_expire)
+{
+	uint32_t ticks_idle;
+
+	ticks_idle = ticker_ticks_diff_get(ticks_at_expire,
+					   instance->ticks_stats_slot_end);
+	if (!(ticks_idle & BIT(HAL_TICKER_CNTR_MSBIT))) {
+		ticker->stats.ticks_idle += ticks_idle;
+	}
+
+	instance->ticks_stats_slot_end = (ticks_at_expire + ticker->ticks_slot) &
+					 HAL_TICKER_CNTR_MASK;
+}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 /**
  * @brief Ticker worker
  *
@@ -1289,6 +1330,10 @@ void ticker_worker(void *param)
 		    (slot_reserved ||
 		     (instance->ticks_slot_previous > ticks_expired) ||
 		     ticker_resolve_collision(node, ticker))) {
+#if defined(CONFIG_BT_TICKER_STATS)
+			ticker->stats.collisions++;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #if defined(CONFIG_BT_TICKER_EXT)
 			struct ticker_ext *ext_data = ticker->ext_data;
 
@@ -1319,12 +1364,21 @@ void ticker_worker(void *param)
 				 * latency or pending re-schedule. Skip this
 				 * ticker node. Mark it as elapsed.
 				 */
+#if defined(CONFIG_BT_TICKER_STATS)
+				if (!TICKER_RESCHEDULE_PENDING(ticker)) {
+					ticker->stats.skipped++;
+				}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 				ticker->ack--;
 				continue;
 			}
 
 			/* Continue but perform shallow expiry */
 			must_expire_skip = 1U;
+#if defined(CONFIG_BT_TICKER_STATS)
+			ticker->stats.skipped++;
+#endif /* CONFIG_BT_TICKER_STATS */
 		}
 
 #if defined(CONFIG_BT_TICKER_EXT)
@@ -1417,9 +1471,18 @@ void ticker_worker(void *param)
 
 #if !defined(CONFIG_BT_TICKER_LOW_LAT) && \
 	!defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC)
+#if defined(CONFIG_BT_TICKER_STATS)
+				ticker->stats.expired++;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 				if (ticker->ticks_slot != 0U) {
 					/* Any further nodes will be skipped */
 					slot_reserved = 1U;
+
+#if defined(CONFIG_BT_TICKER_STATS)
+					ticker_stats_slot_start(instance, ticker,
+								ticks_at_expire);
+#endif /* CONFIG_BT_TICKER_STATS */
 				}
 #endif /* !CONFIG_BT_TICKER_LOW_LAT &&
 	* !CONFIG_BT_TICKER_SLOT_AGNOSTIC
@@ -2249,6 +2312,10 @@ static inline uint32_t ticker_job_op_start(struct ticker_instance *instance,
 	ticker->lazy_current = 0U;
 	ticker->force = 1U;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	(void)memset(&ticker->stats, 0, sizeof(ticker->stats));
+#endif /* CONFIG_BT_TICKER_STATS */
+
 	return TICKER_STATUS_SUCCESS;
 }
 
@@ -3229,6 +3296,10 @@ uint8_t ticker_init(uint8_t instance_index, uint8_t count_node, void *node,
 	instance->ticks_slot_previous = 0U;
 #endif /* !CONFIG_BT_TICKER_SLOT_AGNOSTIC */
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	instance->ticks_stats_slot_end = instance->ticks_current;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #if defined(CONFIG_BT_TICKER_EXT_EXPIRE_INFO)
 	for (int i = 0; i < TICKER_EXPIRE_INFO_MAX; i++) {
 		instance->expire_infos[i].ticker_id = TICKER_NULL;
@@ -3942,6 +4013,35 @@ uint8_t ticker_priority_set(uint8_t instance_index, uint8_t user_id, uint8_t tic
 	* CONFIG_BT_TICKER_PRIORITY_SET
 	*/
 
+#if defined(CONFIG_BT_TICKER_STATS)
+/**
+ * @brief Get the collision statistics of a ticker node
+ *
+ * @details The counters are updated by ticker_worker without locking,
+ * hence a read preempted by the worker may be inconsistent by one event.
+ *
+ * @param instance_index Index of ticker instance
+ * @param ticker_id      Id of ticker node
+ * @param stats          Pointer to the statistics to fill
+ *
+ * @return TICKER_STATUS_SUCCESS, or TICKER_STATUS_FAILURE if the ticker id
+ * is invalid
+ */
+uint8_t ticker_stats_get(uint8_t instance_index, uint8_t ticker_id,
+			 struct ticker_stats *stats)
+{
+	struct ticker_instance *instance = &_instance[instance_index];
+
+	if (ticker_id >= instance->count_node) {
+		return TICKER_STATUS_FAILURE;
+	}
+
+	*stats = instance->nodes[ticker_id].stats;
+
+	return TICKER_STATUS_SUCCESS;
+}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 /**
  * @brief Schedule ticker job
  *
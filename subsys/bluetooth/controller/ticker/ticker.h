@@ -37,13 +37,19 @@
 
 /** \brief Timer node type size.
  */
+#if defined(CONFIG_BT_TICKER_STATS)
+#define TICKER_NODE_STATS_SIZE  16
+#else /* !CONFIG_BT_TICKER_STATS */
+#define TICKER_NODE_STATS_SIZE  0
+#endif /* !CONFIG_BT_TICKER_STATS */
+
 #if defined(CONFIG_BT_TICKER_EXT)
 #if defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC)
 #define TICKER_NODE_T_SIZE      40
 #elif defined(CONFIG_BT_TICKER_LOW_LAT)
 #define TICKER_NODE_T_SIZE      44
 #else
-#define TICKER_NODE_T_SIZE      48
+#define TICKER_NODE_T_SIZE      (48 + TICKER_NODE_STATS_SIZE)
 #endif /* CONFIG_BT_TICKER_SLOT_AGNOSTIC */
 #else /* CONFIG_BT_TICKER_EXT */
 #if defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC)
@@ -51,7 +57,7 @@
 #elif defined(CONFIG_BT_TICKER_LOW_LAT)
 #define TICKER_NODE_T_SIZE      40
 #else
-#define TICKER_NODE_T_SIZE      44
+#define TICKER_NODE_T_SIZE      (44 + TICKER_NODE_STATS_SIZE)
 #endif /* CONFIG_BT_TICKER_SLOT_AGNOSTIC */
 #endif /* CONFIG_BT_TICKER_EXT */
 
@@ -210,6 +216,22 @@ uint8_t ticker_priority_set(uint8_t instance_index, uint8_t user_id,
 			     ticker_op_func fp_op_func, void *op_context);
 #endif /* !CONFIG_BT_TICKER_LOW_LAT && !CONFIG_BT_TICKER_SLOT_AGNOSTIC */
 
+#if defined(CONFIG_BT_TICKER_STATS)
+/** \brief Ticker node statistics, reset when the node is started.
+ */
+struct ticker_stats {
+	uint32_t expired;    /* Expirations given to the timeout function */
+	uint32_t collisions; /* Expirations overlapping a reserved slot */
+	uint32_t skipped;    /* Collisions resulting in a skipped event */
+	uint32_t ticks_idle; /* Ticks since the end of the previous slot
+			      * reservation, summed at each slot start
+			      */
+};
+
+uint8_t ticker_stats_get(uint8_t instance_index, uint8_t ticker_id,
+			 struct ticker_stats *stats);
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #if defined(CONFIG_BT_TICKER_EXT)
 struct ticker_ext {
 #if !defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC)
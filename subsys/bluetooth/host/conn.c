@@ -55,6 +55,10 @@ struct tx_meta {
 	bool is_cont;
 	/* Indicates whether the ISO PDU contains a timestamp */
 	bool iso_has_ts;
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	/* Cycle count when the buffer was queued */
+	uint32_t enqueued;
+#endif /* CONFIG_BT_CONN_TX_STATS */
 };
 
 BUILD_ASSERT(sizeof(struct tx_meta) == CONFIG_BT_CONN_TX_USER_DATA_SIZE,
@@ -475,6 +479,9 @@ int bt_conn_send_cb(struct bt_conn *conn, struct net_buf *buf,
 	}
 
 	tx_data(buf)->is_cont = false;
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	tx_data(buf)->enqueued = k_cycle_get_32();
+#endif /* CONFIG_BT_CONN_TX_STATS */
 
 	net_buf_put(&conn->tx_queue, buf);
 	return 0;
@@ -569,6 +576,84 @@ static inline uint16_t conn_mtu(struct bt_conn *conn)
 #endif /* CONFIG_BT_CONN */
 }
 
+/* ISO data is time bound, only the ACL connections take turns */
+static bool tx_sched_fits(struct bt_conn *conn, uint16_t len)
+{
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+	if (conn->type != BT_CONN_TYPE_ISO) {
+		return conn->tx_deficit >= len;
+	}
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+
+	return true;
+}
+
+static void tx_sched_charge(struct bt_conn *conn, uint16_t len)
+{
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+	if (conn->type != BT_CONN_TYPE_ISO) {
+		conn->tx_deficit -= len;
+	}
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+}
+
+static void tx_sched_round(struct bt_conn *conn)
+{
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+	uint32_t quantum = MAX(CONFIG_BT_CONN_TX_SCHED_QUANTUM, conn_mtu(conn));
+
+	/* Bounded, so that a connection which keeps finding the controller
+	 * buffers taken by the others does not build up a burst.
+	 */
+	conn->tx_deficit = MIN(conn->tx_deficit + quantum, 2 * quantum);
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+}
+
+/* Next buffer sent by a connection in the same round, if any */
+static struct net_buf *tx_sched_next(struct bt_conn *conn, int err)
+{
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+	struct net_buf *buf;
+
+	if (conn->type == BT_CONN_TYPE_ISO) {
+		return NULL;
+	}
+
+	buf = k_fifo_peek_head(&conn->tx_queue);
+	if (buf == NULL) {
+		/* An idle connection does not keep its deficit */
+		conn->tx_deficit = 0;
+	}
+
+	return (err == 0) ? buf : NULL;
+#else
+	return NULL;
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+}
+
+static uint32_t tx_stats_start(struct net_buf *buf)
+{
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	return tx_data(buf)->enqueued;
+#else
+	return 0;
+#endif /* CONFIG_BT_CONN_TX_STATS */
+}
+
+static void tx_stats_update(struct bt_conn *conn, uint32_t start)
+{
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	uint32_t latency = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	unsigned int key;
+
+	key = irq_lock();
+	conn->tx_count++;
+	conn->tx_latency_sum_us += latency;
+	conn->tx_latency_max_us = MAX(conn->tx_latency_max_us, latency);
+	irq_unlock(key);
+#endif /* CONFIG_BT_CONN_TX_STATS */
+}
+
 static int do_send_frag(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 {
 	struct bt_conn_tx *tx = tx_data(buf)->tx;
@@ -668,18 +753,30 @@ static int send_frag(struct bt_conn *conn,
 		     struct net_buf *buf, struct net_buf *frag,
 		     uint8_t flags)
 {
+	uint16_t frag_len = buf->len;
+
+	if (frag) {
+		size_t iso_hdr = flags == FRAG_START ? iso_hdr_len(buf, conn) : 0;
+
+		frag_len = MIN(conn_mtu(conn) + iso_hdr, net_buf_tailroom(frag));
+	}
+
+	/* Check if the connection has sent its share of the round */
+	if (!tx_sched_fits(conn, frag_len)) {
+		LOG_DBG("round quantum used");
+		return -EAGAIN;
+	}
+
 	/* Check if the controller can accept ACL packets */
 	if (k_sem_take(bt_conn_get_pkts(conn), K_NO_WAIT)) {
 		LOG_DBG("no controller bufs");
 		return -ENOBUFS;
 	}
 
+	tx_sched_charge(conn, frag_len);
+
 	/* Add the data to the buffer */
 	if (frag) {
-		size_t iso_hdr = flags == FRAG_START ? iso_hdr_len(buf, conn) : 0;
-		uint16_t frag_len = MIN(conn_mtu(conn) + iso_hdr,
-					net_buf_tailroom(frag));
-
 		net_buf_add_mem(frag, buf->data, frag_len);
 		net_buf_pull(buf, frag_len);
 	} else {
@@ -888,8 +985,19 @@ int bt_conn_prepare_events(struct k_poll_event events[])
 			  K_POLL_MODE_NOTIFY_ONLY, &conn_change);
 
 #if defined(CONFIG_BT_CONN)
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+	/* The events are processed in order, start each round with the
+	 * next connection so that they get the controller buffers in turn.
+	 */
+	static uint8_t first;
+
+	first = (first + 1) % ARRAY_SIZE(acl_conns);
+#else
+	const uint8_t first = 0;
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+
 	for (i = 0; i < ARRAY_SIZE(acl_conns); i++) {
-		conn = &acl_conns[i];
+		conn = &acl_conns[(first + i) % ARRAY_SIZE(acl_conns)];
 
 		if (!conn_prepare_events(conn, &events[ev_count])) {
 			ev_count++;
@@ -933,25 +1041,36 @@ void bt_conn_process_tx(struct bt_conn *conn)
 	buf = k_fifo_peek_head(&conn->tx_queue);
 	BT_ASSERT(buf);
 
-	/* Since we used `peek`, the queue still owns the reference to the
-	 * buffer, so we need to take an explicit additional reference here.
-	 */
-	buf = net_buf_ref(buf);
-	err = send_buf(conn, buf);
-	net_buf_unref(buf);
-
-	if (err  == -EIO) {
-		struct bt_conn_tx *tx = tx_data(buf)->tx;
+	tx_sched_round(conn);
 
-		tx_data(buf)->tx = NULL;
+	while (buf) {
+		uint32_t start = tx_stats_start(buf);
 
-		/* destroy the buffer */
+		/* Since we used `peek`, the queue still owns the reference to
+		 * the buffer, so we need to take an explicit additional
+		 * reference here.
+		 */
+		buf = net_buf_ref(buf);
+		err = send_buf(conn, buf);
 		net_buf_unref(buf);
 
-		/* destroy the tx context (and any associated meta-data) */
-		if (tx) {
-			conn_tx_destroy(conn, tx);
+		if (err == 0) {
+			tx_stats_update(conn, start);
+		} else if (err == -EIO) {
+			struct bt_conn_tx *tx = tx_data(buf)->tx;
+
+			tx_data(buf)->tx = NULL;
+
+			/* destroy the buffer */
+			net_buf_unref(buf);
+
+			/* destroy the tx context (and any associated meta-data) */
+			if (tx) {
+				conn_tx_destroy(conn, tx);
+			}
 		}
+
+		buf = tx_sched_next(conn, err);
 	}
 }
 
@@ -2569,6 +2688,25 @@ int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
 	return -EINVAL;
 }
 
+int bt_conn_get_tx_stats(const struct bt_conn *conn,
+			 struct bt_conn_tx_stats *stats)
+{
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	unsigned int key;
+
+	key = irq_lock();
+	stats->count = conn->tx_count;
+	stats->latency_max_us = conn->tx_latency_max_us;
+	stats->latency_avg_us = conn->tx_count ?
+				(uint32_t)(conn->tx_latency_sum_us / conn->tx_count) : 0U;
+	irq_unlock(key);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif /* CONFIG_BT_CONN_TX_STATS */
+}
+
 int bt_conn_get_remote_info(struct bt_conn *conn,
 			    struct bt_conn_remote_info *remote_info)
 {
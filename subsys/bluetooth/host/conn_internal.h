@@ -205,6 +205,18 @@ struct bt_conn {
 	/* Queue for outgoing ACL data */
 	struct k_fifo		tx_queue;
 
+#if defined(CONFIG_BT_CONN_TX_SCHED_DRR)
+	/* Bytes the connection may still send in the current round */
+	uint32_t		tx_deficit;
+#endif /* CONFIG_BT_CONN_TX_SCHED_DRR */
+
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	/* Packets given to the controller and their latencies */
+	uint32_t		tx_count;
+	uint32_t		tx_latency_max_us;
+	uint64_t		tx_latency_sum_us;
+#endif /* CONFIG_BT_CONN_TX_STATS */
+
 	/* Active L2CAP channels */
 	sys_slist_t		channels;
 
@@ -16,6 +16,7 @@
 #include <zephyr/bluetooth/hci.h>
 #include <zephyr/bluetooth/conn.h>
 #include <zephyr/bluetooth/crypto.h>
+#include <zephyr/crypto/crypto.h>
 
 #include <tinycrypt/constants.h>
 #include <tinycrypt/hmac_prng.h>
@@ -111,11 +112,83 @@ int bt_rand(void *buf, size_t len)
 }
 #endif /* CONFIG_BT_HOST_CRYPTO_PRNG */
 
+#if defined(CONFIG_BT_HOST_CRYPTO_DRV)
+/* Returns -ENOTSUP when the driver cannot be used, the block is then
+ * encrypted by TinyCrypt.
+ */
+static int drv_encrypt_be(const uint8_t key[16], const uint8_t plaintext[16],
+			  uint8_t enc_data[16])
+{
+	const struct device *dev;
+	struct cipher_ctx ctx = {
+		.keylen = 16,
+		.key.bit_stream = (uint8_t *)key,
+		.flags = CAP_RAW_KEY | CAP_SYNC_OPS | CAP_SEPARATE_IO_BUFS,
+	};
+	struct cipher_pkt pkt = {
+		.in_buf = (uint8_t *)plaintext,
+		.in_len = 16,
+		.out_buf = enc_data,
+		.out_buf_max = 16,
+	};
+	int err;
+
+	dev = device_get_binding(CONFIG_BT_HOST_CRYPTO_DRV_NAME);
+	if (dev == NULL || !device_is_ready(dev)) {
+		return -ENOTSUP;
+	}
+
+	err = cipher_begin_session(dev, &ctx, CRYPTO_CIPHER_ALGO_AES,
+				   CRYPTO_CIPHER_MODE_ECB,
+				   CRYPTO_CIPHER_OP_ENCRYPT);
+	if (err) {
+		LOG_DBG("Cannot begin crypto session (err %d)", err);
+		return -ENOTSUP;
+	}
+
+	err = cipher_block_op(&ctx, &pkt);
+	if (err) {
+		LOG_ERR("Crypto driver failed to encrypt (err %d)", err);
+		err = -EIO;
+	}
+
+	cipher_free_session(dev, &ctx);
+
+	return err;
+}
+#endif /* CONFIG_BT_HOST_CRYPTO_DRV */
+
+static int aes_encrypt_be(const uint8_t key[16], const uint8_t plaintext[16],
+			  uint8_t enc_data[16])
+{
+	struct tc_aes_key_sched_struct s;
+
+#if defined(CONFIG_BT_HOST_CRYPTO_DRV)
+	int err;
+
+	err = drv_encrypt_be(key, plaintext, enc_data);
+	if (err != -ENOTSUP) {
+		return err;
+	}
+#endif /* CONFIG_BT_HOST_CRYPTO_DRV */
+
+	if (tc_aes128_set_encrypt_key(&s, key) == TC_CRYPTO_FAIL) {
+		return -EINVAL;
+	}
+
+	if (tc_aes_encrypt(enc_data, plaintext, &s) == TC_CRYPTO_FAIL) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 int bt_encrypt_le(const uint8_t key[16], const uint8_t plaintext[16],
 		  uint8_t enc_data[16])
 {
-	struct tc_aes_key_sched_struct s;
+	uint8_t tmp_key[16];
 	uint8_t tmp[16];
+	int err;
 
 	CHECKIF(key == NULL || plaintext == NULL || enc_data == NULL) {
 		return -EINVAL;
@@ -124,16 +197,12 @@ int bt_encrypt_le(const uint8_t key[16], const uint8_t plaintext[16],
 	LOG_DBG("key %s", bt_hex(key, 16));
 	LOG_DBG("plaintext %s", bt_hex(plaintext, 16));
 
-	sys_memcpy_swap(tmp, key, 16);
-
-	if (tc_aes128_set_encrypt_key(&s, tmp) == TC_CRYPTO_FAIL) {
-		return -EINVAL;
-	}
-
+	sys_memcpy_swap(tmp_key, key, 16);
 	sys_memcpy_swap(tmp, plaintext, 16);
 
-	if (tc_aes_encrypt(enc_data, tmp, &s) == TC_CRYPTO_FAIL) {
-		return -EINVAL;
+	err = aes_encrypt_be(tmp_key, tmp, enc_data);
+	if (err) {
+		return err;
 	}
 
 	sys_mem_swap(enc_data, 16);
@@ -146,7 +215,7 @@ int bt_encrypt_le(const uint8_t key[16], const uint8_t plaintext[16],
 int bt_encrypt_be(const uint8_t key[16], const uint8_t plaintext[16],
 		  uint8_t enc_data[16])
 {
-	struct tc_aes_key_sched_struct s;
+	int err;
 
 	CHECKIF(key == NULL || plaintext == NULL || enc_data == NULL) {
 		return -EINVAL;
@@ -155,12 +224,9 @@ int bt_encrypt_be(const uint8_t key[16], const uint8_t plaintext[16],
 	LOG_DBG("key %s", bt_hex(key, 16));
 	LOG_DBG("plaintext %s", bt_hex(plaintext, 16));
 
-	if (tc_aes128_set_encrypt_key(&s, key) == TC_CRYPTO_FAIL) {
-		return -EINVAL;
-	}
-
-	if (tc_aes_encrypt(enc_data, plaintext, &s) == TC_CRYPTO_FAIL) {
-		return -EINVAL;
+	err = aes_encrypt_be(key, plaintext, enc_data);
+	if (err) {
+		return err;
 	}
 
 	LOG_DBG("enc_data %s", bt_hex(enc_data, 16));
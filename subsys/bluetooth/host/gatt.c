@@ -1466,6 +1466,10 @@ void bt_gatt_init(void)
 
 	sys_slist_init(&callback_list);
 
+	if (IS_ENABLED(CONFIG_BT_GATT_CLIENT_CACHE)) {
+		bt_gatt_client_cache_init();
+	}
+
 #if defined(CONFIG_BT_GATT_CACHING)
 	k_work_init_delayable(&db_hash.work, db_hash_process);
 
@@ -1954,6 +1958,29 @@ static uint8_t gatt_foreach_iter(const struct bt_gatt_attr *attr,
 	return result;
 }
 
+#if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+/* Index of the first attribute of a service whose handle is not below the
+ * given one. The handles of the attributes of a service are ascending.
+ */
+static size_t gatt_attr_lower_bound(const struct bt_gatt_service *svc, uint16_t handle)
+{
+	size_t lo = 0;
+	size_t hi = svc->attr_count;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (svc->attrs[mid].handle < handle) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+#endif /* CONFIG_BT_GATT_DYNAMIC_DB */
+
 static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 				    const struct bt_uuid *uuid,
 				    const void *attr_data, uint16_t num_matches,
@@ -1974,7 +2001,13 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 			}
 		}
 
-		for (i = 0; i < svc->attr_count; i++) {
+		/* Start from the first attribute in range, the next services
+		 * are all in range.
+		 */
+		i = gatt_attr_lower_bound(svc, start_handle);
+		start_handle = 0;
+
+		for (; i < svc->attr_count; i++) {
 			struct bt_gatt_attr *attr = &svc->attrs[i];
 
 			if (gatt_foreach_iter(attr, attr->handle,
@@ -2012,7 +2045,13 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 				continue;
 			}
 
-			for (i = 0; i < static_svc->attr_count; i++, handle++) {
+			/* Handles of static services are contiguous, start
+			 * from the first attribute in range.
+			 */
+			i = (start_handle > handle) ? (start_handle - handle) : 0;
+			handle += i;
+
+			for (; i < static_svc->attr_count; i++, handle++) {
 				if (gatt_foreach_iter(&static_svc->attrs[i],
 						      handle, start_handle,
 						      end_handle, uuid,
@@ -4531,6 +4570,11 @@ int bt_gatt_discover(struct bt_conn *conn,
 		return -ENOTCONN;
 	}
 
+	if (IS_ENABLED(CONFIG_BT_GATT_CLIENT_CACHE) &&
+	    bt_gatt_client_cache_discover(conn, params)) {
+		return 0;
+	}
+
 	switch (params->type) {
 	case BT_GATT_DISCOVER_PRIMARY:
 	case BT_GATT_DISCOVER_SECONDARY:
@@ -6274,6 +6318,10 @@ void bt_gatt_disconnected(struct bt_conn *conn)
 	LOG_DBG("conn %p", conn);
 	bt_gatt_foreach_attr(0x0001, 0xffff, disconnected_cb, conn);
 
+	if (IS_ENABLED(CONFIG_BT_GATT_CLIENT_CACHE)) {
+		bt_gatt_client_cache_disconnected(conn);
+	}
+
 #if defined(CONFIG_BT_GATT_NOTIFY_MULTIPLE)
 	/* Clear pending notifications */
 	cleanup_notify(conn);
@@ -0,0 +1,630 @@
+/* gatt_cache.c - GATT client database cache */
+
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/settings/settings.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/bluetooth/gatt.h>
+
+#include "conn_internal.h"
+#include "settings.h"
+#include "gatt_internal.h"
+
+#define LOG_LEVEL CONFIG_BT_GATT_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(bt_gatt_cache);
+
+/* Discoveries run by a connection to record a database, they are issued
+ * together so that they use all the ATT bearers of the connection.
+ */
+static const uint8_t cache_passes[] = {
+	BT_GATT_DISCOVER_PRIMARY,
+	BT_GATT_DISCOVER_SECONDARY,
+	BT_GATT_DISCOVER_INCLUDE,
+	BT_GATT_DISCOVER_CHARACTERISTIC,
+	BT_GATT_DISCOVER_ATTRIBUTE,
+};
+
+/* Discoveries of a connection waiting to be served from the cache */
+#define CACHE_REPLAY_MAX 4
+
+enum {
+	CACHE_FREE,
+	CACHE_FILLING,
+	CACHE_VALID,
+};
+
+/* Attribute found by one of the discoveries of cache_passes */
+struct gatt_cache_attr {
+	uint16_t handle;
+	/* Service end handle, include start handle or value handle */
+	uint16_t handle1;
+	/* Include end handle */
+	uint16_t handle2;
+	uint8_t type;
+	uint8_t properties;
+	union {
+		struct bt_uuid uuid;
+		struct bt_uuid_16 u16;
+		struct bt_uuid_32 u32;
+		struct bt_uuid_128 u128;
+	} uuid;
+};
+
+struct gatt_cache_db {
+	/* Stored part, the attributes are stored up to count */
+	uint8_t hash[16];
+	uint16_t count;
+	struct gatt_cache_attr attrs[CONFIG_BT_GATT_CLIENT_CACHE_ATTRS];
+
+	uint8_t state;
+	/* Number of connections bound to the database */
+	uint8_t users;
+	uint32_t used;
+};
+
+struct gatt_cache_conn {
+	struct bt_conn *conn;
+	struct gatt_cache_db *db;
+	bt_gatt_client_cache_func_t func;
+
+	struct bt_gatt_read_params read;
+	struct bt_gatt_discover_params disc[ARRAY_SIZE(cache_passes)];
+	uint8_t pending;
+	int err;
+
+	struct k_work replay_work;
+	struct k_spinlock lock;
+	struct bt_gatt_discover_params *replay[CACHE_REPLAY_MAX];
+	uint8_t replay_count;
+};
+
+static struct gatt_cache_db cache_dbs[CONFIG_BT_GATT_CLIENT_CACHE_DBS];
+static struct gatt_cache_conn cache_conns[CONFIG_BT_MAX_CONN];
+
+#define CACHE_DB_STORE_LEN(_count) \
+	(offsetof(struct gatt_cache_db, attrs) + (_count) * sizeof(struct gatt_cache_attr))
+
+static void cache_uuid_set(struct gatt_cache_attr *entry, const struct bt_uuid *uuid)
+{
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		entry->uuid.u16 = *BT_UUID_16(uuid);
+		break;
+	case BT_UUID_TYPE_32:
+		entry->uuid.u32 = *BT_UUID_32(uuid);
+		break;
+	case BT_UUID_TYPE_128:
+		entry->uuid.u128 = *BT_UUID_128(uuid);
+		break;
+	}
+}
+
+static void cache_db_store(struct gatt_cache_db *db)
+{
+#if defined(CONFIG_BT_SETTINGS)
+	char key[BT_SETTINGS_KEY_MAX];
+	int err;
+
+	snprintk(key, sizeof(key), "gatt_cache/%u", (unsigned int)ARRAY_INDEX(cache_dbs, db));
+
+	err = bt_settings_store(key, 0, NULL, db, CACHE_DB_STORE_LEN(db->count));
+	if (err) {
+		LOG_ERR("Failed to store GATT cache (err %d)", err);
+	}
+#endif /* CONFIG_BT_SETTINGS */
+}
+
+static struct gatt_cache_db *cache_db_find(const uint8_t *hash)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_dbs); i++) {
+		if (cache_dbs[i].state != CACHE_FREE &&
+		    !memcmp(cache_dbs[i].hash, hash, sizeof(cache_dbs[i].hash))) {
+			return &cache_dbs[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Get a free database, or the least recently used one without users */
+static struct gatt_cache_db *cache_db_alloc(void)
+{
+	struct gatt_cache_db *lru = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_dbs); i++) {
+		struct gatt_cache_db *db = &cache_dbs[i];
+
+		if (db->state == CACHE_FREE) {
+			return db;
+		}
+
+		if (db->state == CACHE_VALID && db->users == 0U &&
+		    (lru == NULL || (int32_t)(db->used - lru->used) < 0)) {
+			lru = db;
+		}
+	}
+
+	return lru;
+}
+
+static void cache_bind(struct gatt_cache_conn *cc, struct bt_conn *conn,
+		       struct gatt_cache_db *db)
+{
+	cc->conn = conn;
+	cc->db = db;
+	db->users++;
+	db->used = k_uptime_get_32();
+}
+
+static void cache_bind_done(struct gatt_cache_conn *cc, struct bt_conn *conn, int err)
+{
+	bt_gatt_client_cache_func_t func = cc->func;
+
+	cc->func = NULL;
+	func(conn, err);
+}
+
+static void cache_fill_done(struct gatt_cache_conn *cc, struct bt_conn *conn)
+{
+	struct gatt_cache_db *db = cc->db;
+	int err = cc->err;
+
+	if (err == 0 && conn->state != BT_CONN_CONNECTED) {
+		err = -ENOTCONN;
+	}
+
+	if (err) {
+		LOG_WRN("Failed to record GATT database (err %d)", err);
+		db->state = CACHE_FREE;
+		cc->db = NULL;
+		cache_bind_done(cc, conn, err);
+		return;
+	}
+
+	LOG_DBG("GATT database recorded, %u attributes", db->count);
+
+	db->state = CACHE_VALID;
+	cache_db_store(db);
+
+	cache_bind(cc, conn, db);
+	cache_bind_done(cc, conn, 0);
+}
+
+static uint8_t cache_fill_cb(struct bt_conn *conn, const struct bt_gatt_attr *attr,
+			     struct bt_gatt_discover_params *params)
+{
+	struct gatt_cache_conn *cc = &cache_conns[bt_conn_index(conn)];
+	struct gatt_cache_db *db = cc->db;
+	struct gatt_cache_attr *entry;
+
+	if (attr == NULL || cc->err) {
+		goto done;
+	}
+
+	if (db->count == ARRAY_SIZE(db->attrs)) {
+		cc->err = -ENOMEM;
+		goto done;
+	}
+
+	entry = &db->attrs[db->count++];
+	(void)memset(entry, 0, sizeof(*entry));
+	entry->handle = attr->handle;
+	entry->type = params->type;
+
+	switch (params->type) {
+	case BT_GATT_DISCOVER_PRIMARY:
+	case BT_GATT_DISCOVER_SECONDARY: {
+		const struct bt_gatt_service_val *svc = attr->user_data;
+
+		entry->handle1 = svc->end_handle;
+		cache_uuid_set(entry, svc->uuid);
+		break;
+	}
+	case BT_GATT_DISCOVER_INCLUDE: {
+		const struct bt_gatt_include *incl = attr->user_data;
+
+		entry->handle1 = incl->start_handle;
+		entry->handle2 = incl->end_handle;
+		cache_uuid_set(entry, incl->uuid);
+		break;
+	}
+	case BT_GATT_DISCOVER_CHARACTERISTIC: {
+		const struct bt_gatt_chrc *chrc = attr->user_data;
+
+		entry->handle1 = chrc->value_handle;
+		entry->properties = chrc->properties;
+		cache_uuid_set(entry, chrc->uuid);
+		break;
+	}
+	default:
+		cache_uuid_set(entry, attr->uuid);
+		break;
+	}
+
+	return BT_GATT_ITER_CONTINUE;
+
+done:
+	if (--cc->pending == 0U) {
+		cache_fill_done(cc, conn);
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+static void cache_fill(struct gatt_cache_conn *cc, struct bt_conn *conn)
+{
+	cc->err = 0;
+	cc->pending = 0U;
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_passes); i++) {
+		struct bt_gatt_discover_params *params = &cc->disc[i];
+		int err;
+
+		(void)memset(params, 0, sizeof(*params));
+		params->type = cache_passes[i];
+		params->start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+		params->end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+		params->func = cache_fill_cb;
+
+		err = bt_gatt_discover(conn, params);
+		if (err) {
+			cc->err = err;
+			break;
+		}
+
+		cc->pending++;
+	}
+
+	if (cc->pending == 0U) {
+		cache_fill_done(cc, conn);
+	}
+}
+
+static uint8_t cache_hash_read_cb(struct bt_conn *conn, uint8_t err,
+				  struct bt_gatt_read_params *params,
+				  const void *data, uint16_t length)
+{
+	struct gatt_cache_conn *cc = CONTAINER_OF(params, struct gatt_cache_conn, read);
+	struct gatt_cache_db *db;
+
+	if (err || data == NULL) {
+		LOG_DBG("No Database Hash (err 0x%02x)", err);
+		cache_bind_done(cc, conn, -ENOENT);
+		return BT_GATT_ITER_STOP;
+	}
+
+	if (length != sizeof(db->hash)) {
+		cache_bind_done(cc, conn, -EINVAL);
+		return BT_GATT_ITER_STOP;
+	}
+
+	LOG_HEXDUMP_DBG(data, length, "Database Hash: ");
+
+	db = cache_db_find(data);
+	if (db != NULL && db->state == CACHE_VALID) {
+		cache_bind(cc, conn, db);
+		cache_bind_done(cc, conn, 0);
+		return BT_GATT_ITER_STOP;
+	}
+
+	/* Another connection is recording the same database */
+	if (db != NULL) {
+		cache_bind_done(cc, conn, -EBUSY);
+		return BT_GATT_ITER_STOP;
+	}
+
+	db = cache_db_alloc();
+	if (db == NULL) {
+		cache_bind_done(cc, conn, -ENOMEM);
+		return BT_GATT_ITER_STOP;
+	}
+
+	memcpy(db->hash, data, sizeof(db->hash));
+	db->count = 0U;
+	db->state = CACHE_FILLING;
+	cc->db = db;
+
+	cache_fill(cc, conn);
+
+	return BT_GATT_ITER_STOP;
+}
+
+int bt_gatt_client_cache_bind(struct bt_conn *conn, bt_gatt_client_cache_func_t func)
+{
+	struct gatt_cache_conn *cc;
+	int err;
+
+	__ASSERT(conn, "invalid parameters\n");
+	__ASSERT(func, "invalid parameters\n");
+
+	if (conn->type != BT_CONN_TYPE_LE) {
+		return -EINVAL;
+	}
+
+	if (conn->state != BT_CONN_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	cc = &cache_conns[bt_conn_index(conn)];
+	if (cc->func != NULL) {
+		return -EBUSY;
+	}
+
+	if (cc->db != NULL) {
+		return -EALREADY;
+	}
+
+	cc->func = func;
+	cc->read.func = cache_hash_read_cb;
+	cc->read.handle_count = 0U;
+	cc->read.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	cc->read.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+	cc->read.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+
+	err = bt_gatt_read(conn, &cc->read);
+	if (err) {
+		cc->func = NULL;
+	}
+
+	return err;
+}
+
+static bool cache_replay_attr(struct bt_conn *conn, struct bt_gatt_discover_params *params,
+			      const struct gatt_cache_attr *entry)
+{
+	struct bt_gatt_attr attr = {
+		.handle = entry->handle,
+	};
+	union {
+		struct bt_gatt_service_val svc;
+		struct bt_gatt_include incl;
+		struct bt_gatt_chrc chrc;
+	} value;
+
+	switch (entry->type) {
+	case BT_GATT_DISCOVER_PRIMARY:
+	case BT_GATT_DISCOVER_SECONDARY:
+		value.svc.uuid = &entry->uuid.uuid;
+		value.svc.end_handle = entry->handle1;
+		attr.uuid = (entry->type == BT_GATT_DISCOVER_PRIMARY) ?
+			    BT_UUID_GATT_PRIMARY : BT_UUID_GATT_SECONDARY;
+		attr.user_data = &value.svc;
+		break;
+	case BT_GATT_DISCOVER_INCLUDE:
+		value.incl.uuid = &entry->uuid.uuid;
+		value.incl.start_handle = entry->handle1;
+		value.incl.end_handle = entry->handle2;
+		attr.uuid = BT_UUID_GATT_INCLUDE;
+		attr.user_data = &value.incl;
+		break;
+	case BT_GATT_DISCOVER_CHARACTERISTIC:
+		value.chrc = (struct bt_gatt_chrc)BT_GATT_CHRC_INIT(
+			&entry->uuid.uuid, entry->handle1, entry->properties);
+		attr.uuid = BT_UUID_GATT_CHRC;
+		attr.user_data = &value.chrc;
+		break;
+	default:
+		/* No user_data in this case */
+		attr.uuid = &entry->uuid.uuid;
+		break;
+	}
+
+	return params->func(conn, &attr, params) == BT_GATT_ITER_CONTINUE;
+}
+
+/* Report the attributes a discovery would find, in the same way */
+static void cache_replay(struct bt_conn *conn, const struct gatt_cache_db *db,
+			 struct bt_gatt_discover_params *params)
+{
+	uint8_t type = params->type;
+	bool skip = false;
+
+	if (type == BT_GATT_DISCOVER_DESCRIPTOR) {
+		type = BT_GATT_DISCOVER_ATTRIBUTE;
+	}
+
+	for (uint16_t i = 0U; i < db->count; i++) {
+		const struct gatt_cache_attr *entry = &db->attrs[i];
+		const struct bt_uuid *uuid = &entry->uuid.uuid;
+
+		if (entry->type != type || entry->handle < params->start_handle ||
+		    entry->handle > params->end_handle) {
+			continue;
+		}
+
+		if (skip) {
+			skip = false;
+			continue;
+		}
+
+		/* Skip if UUID is set but doesn't match */
+		if (params->uuid && bt_uuid_cmp(uuid, params->uuid)) {
+			continue;
+		}
+
+		if (params->type == BT_GATT_DISCOVER_DESCRIPTOR) {
+			/* Skip attributes that are not considered
+			 * descriptors.
+			 */
+			if (!bt_uuid_cmp(uuid, BT_UUID_GATT_PRIMARY) ||
+			    !bt_uuid_cmp(uuid, BT_UUID_GATT_SECONDARY) ||
+			    !bt_uuid_cmp(uuid, BT_UUID_GATT_INCLUDE)) {
+				continue;
+			}
+
+			/* If Characteristic Declaration skip ahead as the next
+			 * entry must be its value.
+			 */
+			if (!bt_uuid_cmp(uuid, BT_UUID_GATT_CHRC)) {
+				skip = true;
+				continue;
+			}
+		}
+
+		if (!cache_replay_attr(conn, params, entry)) {
+			return;
+		}
+	}
+
+	params->func(conn, NULL, params);
+}
+
+static struct bt_gatt_discover_params *cache_replay_get(struct gatt_cache_conn *cc)
+{
+	struct bt_gatt_discover_params *params = NULL;
+	k_spinlock_key_t key = k_spin_lock(&cc->lock);
+
+	if (cc->replay_count > 0U) {
+		params = cc->replay[0];
+		cc->replay_count--;
+		memmove(&cc->replay[0], &cc->replay[1],
+			cc->replay_count * sizeof(cc->replay[0]));
+	}
+
+	k_spin_unlock(&cc->lock, key);
+
+	return params;
+}
+
+static void cache_replay_work(struct k_work *work)
+{
+	struct gatt_cache_conn *cc = CONTAINER_OF(work, struct gatt_cache_conn, replay_work);
+	struct bt_gatt_discover_params *params;
+
+	while ((params = cache_replay_get(cc)) != NULL) {
+		struct gatt_cache_db *db = cc->db;
+
+		if (db == NULL) {
+			params->func(cc->conn, NULL, params);
+			continue;
+		}
+
+		cache_replay(cc->conn, db, params);
+	}
+}
+
+bool bt_gatt_client_cache_discover(struct bt_conn *conn,
+				   struct bt_gatt_discover_params *params)
+{
+	struct gatt_cache_conn *cc;
+	k_spinlock_key_t key;
+	bool queued = false;
+
+	if (conn->type != BT_CONN_TYPE_LE ||
+	    params->type == BT_GATT_DISCOVER_STD_CHAR_DESC) {
+		return false;
+	}
+
+	cc = &cache_conns[bt_conn_index(conn)];
+	if (cc->db == NULL || cc->db->state != CACHE_VALID) {
+		return false;
+	}
+
+	/* The discovery is completed from the system work queue, not from
+	 * the caller, so that discoveries started from the callback of the
+	 * previous one do not nest.
+	 */
+	key = k_spin_lock(&cc->lock);
+	if (cc->replay_count < ARRAY_SIZE(cc->replay)) {
+		cc->replay[cc->replay_count++] = params;
+		queued = true;
+	}
+	k_spin_unlock(&cc->lock, key);
+
+	if (queued) {
+		k_work_submit(&cc->replay_work);
+	}
+
+	return queued;
+}
+
+void bt_gatt_client_cache_disconnected(struct bt_conn *conn)
+{
+	struct gatt_cache_conn *cc;
+
+	if (conn->type != BT_CONN_TYPE_LE) {
+		return;
+	}
+
+	cc = &cache_conns[bt_conn_index(conn)];
+
+	/* A database being recorded is dropped when its discoveries end */
+	if (cc->db == NULL || cc->db->state != CACHE_VALID) {
+		return;
+	}
+
+	cc->db->users--;
+	cc->db = NULL;
+
+	/* Pending discoveries are completed without results */
+	k_work_submit(&cc->replay_work);
+}
+
+void bt_gatt_client_cache_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_conns); i++) {
+		k_work_init(&cache_conns[i].replay_work, cache_replay_work);
+	}
+}
+
+#if defined(CONFIG_BT_SETTINGS)
+static int cache_set(const char *name, size_t len_rd, settings_read_cb read_cb,
+		     void *cb_arg)
+{
+	struct gatt_cache_db *db;
+	unsigned long index;
+	ssize_t len;
+
+	if (!name) {
+		LOG_ERR("Insufficient number of arguments");
+		return -EINVAL;
+	}
+
+	index = strtoul(name, NULL, 10);
+	if (index >= ARRAY_SIZE(cache_dbs)) {
+		/* The number of databases was lowered */
+		return 0;
+	}
+
+	if (len_rd < CACHE_DB_STORE_LEN(0) ||
+	    len_rd > CACHE_DB_STORE_LEN(CONFIG_BT_GATT_CLIENT_CACHE_ATTRS)) {
+		LOG_WRN("Invalid GATT cache size %zu", len_rd);
+		return 0;
+	}
+
+	db = &cache_dbs[index];
+	len = read_cb(cb_arg, db, len_rd);
+	if (len < 0) {
+		LOG_ERR("Failed to decode value (err %zd)", len);
+		return len;
+	}
+
+	if (len != CACHE_DB_STORE_LEN(db->count)) {
+		LOG_WRN("Invalid GATT cache %lu", index);
+		db->count = 0U;
+		return 0;
+	}
+
+	db->state = CACHE_VALID;
+
+	LOG_HEXDUMP_DBG(db->hash, sizeof(db->hash), "Stored Hash: ");
+
+	return 0;
+}
+
+BT_SETTINGS_DEFINE(gatt_cache, "gatt_cache", cache_set, NULL);
+#endif /* CONFIG_BT_SETTINGS */
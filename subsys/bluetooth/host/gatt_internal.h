@@ -47,6 +47,12 @@ void bt_gatt_notification(struct bt_conn *conn, uint16_t handle,
 
 void bt_gatt_mult_notification(struct bt_conn *conn, const void *data,
 			       uint16_t length);
+
+/* Serve a discovery from the cached database of the connection, if any */
+bool bt_gatt_client_cache_discover(struct bt_conn *conn,
+				   struct bt_gatt_discover_params *params);
+void bt_gatt_client_cache_disconnected(struct bt_conn *conn);
+void bt_gatt_client_cache_init(void);
 #else
 static inline void bt_gatt_notification(struct bt_conn *conn, uint16_t handle,
 					const void *data, uint16_t length)
@@ -74,6 +74,12 @@ static struct k_work_q bt_workq;
 static K_KERNEL_STACK_DEFINE(rx_thread_stack, CONFIG_BT_RX_STACK_SIZE);
 #endif /* CONFIG_BT_RECV_WORKQ_BT */
 #endif /* !CONFIG_BT_RECV_BLOCKING */
+#if defined(CONFIG_BT_RECV_ISO_WORKQ)
+static void rx_iso_work_handler(struct k_work *work);
+static K_WORK_DEFINE(rx_iso_work, rx_iso_work_handler);
+static struct k_work_q bt_iso_workq;
+static K_KERNEL_STACK_DEFINE(rx_iso_thread_stack, CONFIG_BT_RX_ISO_STACK_SIZE);
+#endif /* CONFIG_BT_RECV_ISO_WORKQ */
 static struct k_thread tx_thread_data;
 static K_KERNEL_STACK_DEFINE(tx_thread_stack, CONFIG_BT_HCI_TX_STACK_SIZE);
 
@@ -3721,11 +3727,75 @@ void hci_event_prio(struct net_buf *buf)
 	}
 }
 
+#if defined(CONFIG_BT_RECV_STATS)
+static struct {
+	atomic_t queued;
+	uint16_t queued_max;
+	atomic_t iso_queued;
+	uint16_t iso_queued_max;
+} rx_stats;
+
+static void rx_stats_put(atomic_t *queued, uint16_t *queued_max)
+{
+	atomic_val_t count = atomic_inc(queued) + 1;
+
+	if (count > *queued_max) {
+		*queued_max = count;
+	}
+}
+
+void bt_hci_get_rx_stats(struct bt_hci_rx_stats *stats)
+{
+	stats->queued = atomic_get(&rx_stats.queued);
+	stats->queued_max = rx_stats.queued_max;
+	stats->iso_queued = atomic_get(&rx_stats.iso_queued);
+	stats->iso_queued_max = rx_stats.iso_queued_max;
+}
+#endif /* CONFIG_BT_RECV_STATS */
+
+#if defined(CONFIG_BT_RECV_ISO_WORKQ)
+static void rx_iso_queue_put(struct net_buf *buf)
+{
+	int err;
+
+	net_buf_slist_put(&bt_dev.rx_iso_queue, buf);
+
+#if defined(CONFIG_BT_RECV_STATS)
+	rx_stats_put(&rx_stats.iso_queued, &rx_stats.iso_queued_max);
+#endif /* CONFIG_BT_RECV_STATS */
+
+	err = k_work_submit_to_queue(&bt_iso_workq, &rx_iso_work);
+	if (err < 0) {
+		LOG_ERR("Could not submit rx_iso_work: %d", err);
+	}
+}
+
+static void rx_iso_work_handler(struct k_work *work)
+{
+	struct net_buf *buf;
+
+	/* ISO data is the only traffic of this work queue, so the queue is
+	 * drained at once.
+	 */
+	while ((buf = net_buf_slist_get(&bt_dev.rx_iso_queue))) {
+#if defined(CONFIG_BT_RECV_STATS)
+		atomic_dec(&rx_stats.iso_queued);
+#endif /* CONFIG_BT_RECV_STATS */
+
+		hci_iso(buf);
+	}
+}
+#endif /* CONFIG_BT_RECV_ISO_WORKQ */
+
 #if !defined(CONFIG_BT_RECV_BLOCKING)
 static void rx_queue_put(struct net_buf *buf)
 {
 	net_buf_slist_put(&bt_dev.rx_queue, buf);
 
+#if defined(CONFIG_BT_RECV_STATS)
+	rx_stats_put(&rx_stats.queued, &rx_stats.queued_max);
+#endif /* CONFIG_BT_RECV_STATS */
+
 #if defined(CONFIG_BT_RECV_WORKQ_SYS)
 	const int err = k_work_submit(&rx_work);
 #elif defined(CONFIG_BT_RECV_WORKQ_BT)
@@ -3776,6 +3846,8 @@ int bt_recv(struct net_buf *buf)
 	case BT_BUF_ISO_IN:
 #if defined(CONFIG_BT_RECV_BLOCKING)
 		hci_iso(buf);
+#elif defined(CONFIG_BT_RECV_ISO_WORKQ)
+		rx_iso_queue_put(buf);
 #else
 		rx_queue_put(buf);
 #endif
@@ -3889,6 +3961,10 @@ static void rx_work_handler(struct k_work *work)
 		return;
 	}
 
+#if defined(CONFIG_BT_RECV_STATS)
+	atomic_dec(&rx_stats.queued);
+#endif /* CONFIG_BT_RECV_STATS */
+
 	LOG_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
 
 	switch (bt_buf_get_type(buf)) {
@@ -3986,6 +4062,15 @@ int bt_enable(bt_ready_cb_t cb)
 	k_thread_name_set(&bt_workq.thread, "BT RX");
 #endif
 
+#if defined(CONFIG_BT_RECV_ISO_WORKQ)
+	/* ISO RX thread */
+	k_work_queue_init(&bt_iso_workq);
+	k_work_queue_start(&bt_iso_workq, rx_iso_thread_stack,
+			   CONFIG_BT_RX_ISO_STACK_SIZE,
+			   K_PRIO_COOP(CONFIG_BT_RX_ISO_PRIO), NULL);
+	k_thread_name_set(&bt_iso_workq.thread, "BT RX ISO");
+#endif /* CONFIG_BT_RECV_ISO_WORKQ */
+
 	err = bt_dev.drv->open();
 	if (err) {
 		LOG_ERR("HCI driver open failed (%d)", err);
@@ -4066,6 +4151,11 @@ int bt_disable(void)
 	k_thread_abort(&bt_workq.thread);
 #endif
 
+#if defined(CONFIG_BT_RECV_ISO_WORKQ)
+	/* Abort ISO RX thread */
+	k_thread_abort(&bt_iso_workq.thread);
+#endif /* CONFIG_BT_RECV_ISO_WORKQ */
+
 	bt_monitor_send(BT_MONITOR_CLOSE_INDEX, NULL, 0);
 
 	/* Clear BT_DEV_ENABLE here to prevent early bt_enable() calls, before disable is
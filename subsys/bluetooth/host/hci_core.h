@@ -371,6 +371,11 @@ struct bt_dev {
 	sys_slist_t rx_queue;
 #endif
 
+#if defined(CONFIG_BT_RECV_ISO_WORKQ)
+	/* Queue for incoming ISO data */
+	sys_slist_t rx_iso_queue;
+#endif
+
 	/* Queue for outgoing HCI commands */
 	struct k_fifo		cmd_tx_queue;
 
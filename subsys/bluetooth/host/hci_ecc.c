@@ -43,6 +43,11 @@ LOG_MODULE_REGISTER(bt_hci_ecc);
 static void ecc_process(struct k_work *work);
 K_WORK_DEFINE(ecc_work, ecc_process);
 
+#if CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0
+static void key_pool_fill(struct k_work *work);
+static K_WORK_DEFINE(key_pool_work, key_pool_fill);
+#endif /* CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0 */
+
 /* based on Core Specification 4.2 Vol 3. Part H 2.3.5.6.1 */
 static const uint8_t debug_private_key_be[BT_PRIV_KEY_LEN] = {
 	0x3f, 0x49, 0xf6, 0xd4, 0xa3, 0xc5, 0x5f, 0x38,
@@ -72,6 +77,19 @@ static struct {
 	};
 } ecc;
 
+#if CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0
+/* Key pairs generated in advance. The pool is only used from the long
+ * workqueue, it does not need locking.
+ */
+static struct {
+	struct {
+		uint8_t private_key_be[BT_PRIV_KEY_LEN];
+		uint8_t public_key_be[BT_PUB_KEY_LEN];
+	} keys[CONFIG_BT_TINYCRYPT_ECC_KEY_POOL];
+	uint8_t count;
+} key_pool;
+#endif /* CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0 */
+
 static void send_cmd_status(uint16_t opcode, uint8_t status)
 {
 	struct bt_hci_evt_cmd_status *evt;
@@ -99,26 +117,80 @@ static void send_cmd_status(uint16_t opcode, uint8_t status)
 	}
 }
 
-static uint8_t generate_keys(void)
+static uint8_t make_key(uint8_t public_key_be[BT_PUB_KEY_LEN],
+			uint8_t private_key_be[BT_PRIV_KEY_LEN])
 {
 	do {
 		int rc;
 
-		rc = uECC_make_key(ecc.public_key_be, ecc.private_key_be,
-				   &curve_secp256r1);
+		rc = uECC_make_key(public_key_be, private_key_be, &curve_secp256r1);
 		if (rc == TC_CRYPTO_FAIL) {
 			LOG_ERR("Failed to create ECC public/private pair");
 			return BT_HCI_ERR_UNSPECIFIED;
 		}
 
 	/* make sure generated key isn't debug key */
-	} while (memcmp(ecc.private_key_be, debug_private_key_be, BT_PRIV_KEY_LEN) == 0);
+	} while (memcmp(private_key_be, debug_private_key_be, BT_PRIV_KEY_LEN) == 0);
+
+	return 0;
+}
+
+#if CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0
+static bool key_pool_get(void)
+{
+	if (key_pool.count == 0U) {
+		return false;
+	}
+
+	key_pool.count--;
+	memcpy(ecc.private_key_be, key_pool.keys[key_pool.count].private_key_be,
+	       BT_PRIV_KEY_LEN);
+	memcpy(ecc.public_key_be, key_pool.keys[key_pool.count].public_key_be,
+	       BT_PUB_KEY_LEN);
+	(void)memset(&key_pool.keys[key_pool.count], 0,
+		     sizeof(key_pool.keys[key_pool.count]));
+
+	return true;
+}
+
+/* Generates one key pair at a time so that a pending command waits for one
+ * generation at most.
+ */
+static void key_pool_fill(struct k_work *work)
+{
+	if (key_pool.count >= ARRAY_SIZE(key_pool.keys)) {
+		return;
+	}
+
+	if (make_key(key_pool.keys[key_pool.count].public_key_be,
+		     key_pool.keys[key_pool.count].private_key_be)) {
+		return;
+	}
+
+	key_pool.count++;
+
+	bt_long_wq_submit(work);
+}
+#endif /* CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0 */
 
-	if (IS_ENABLED(CONFIG_BT_LOG_SNIFFER_INFO)) {
+static uint8_t generate_keys(void)
+{
+	uint8_t status;
+
+#if CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0
+	if (key_pool_get()) {
+		status = 0U;
+	} else
+#endif /* CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0 */
+	{
+		status = make_key(ecc.public_key_be, ecc.private_key_be);
+	}
+
+	if (status == 0U && IS_ENABLED(CONFIG_BT_LOG_SNIFFER_INFO)) {
 		LOG_INF("SC private key 0x%s", bt_hex(ecc.private_key_be, BT_PRIV_KEY_LEN));
 	}
 
-	return 0;
+	return status;
 }
 
 static void emulate_le_p256_public_key_cmd(void)
@@ -218,6 +290,11 @@ static void ecc_process(struct k_work *work)
 	} else {
 		__ASSERT(0, "Unhandled ECC command");
 	}
+
+#if CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0
+	/* Refill the pool once the command is completed */
+	bt_long_wq_submit(&key_pool_work);
+#endif /* CONFIG_BT_TINYCRYPT_ECC_KEY_POOL > 0 */
 }
 
 static void clear_ecc_events(struct net_buf *buf)
@@ -455,6 +455,12 @@ static void bt_iso_chan_disconnected(struct bt_iso_chan *chan, uint8_t reason)
 		}
 	}
 
+#if defined(CONFIG_BT_ISO_RX_RING)
+	if (chan->rx_ring != NULL) {
+		bt_iso_rx_ring_reset(chan->rx_ring);
+	}
+#endif /* CONFIG_BT_ISO_RX_RING */
+
 	if (chan->ops->disconnected) {
 		chan->ops->disconnected(chan, reason);
 	}
@@ -579,6 +585,136 @@ struct net_buf *bt_iso_get_rx(k_timeout_t timeout)
 	return buf;
 }
 
+#if defined(CONFIG_BT_ISO_RX_RING)
+void bt_iso_rx_ring_init(struct bt_iso_rx_ring *ring, struct bt_iso_rx_slot *slots,
+			 uint16_t count, uint32_t delay_us)
+{
+	__ASSERT(count > 0U && IS_POWER_OF_TWO(count), "Invalid count %u", count);
+
+	(void)memset(ring, 0, sizeof(*ring));
+	(void)memset(slots, 0, sizeof(*slots) * count);
+
+	ring->slots = slots;
+	ring->mask = count - 1U;
+	ring->delay_us = delay_us;
+}
+
+static void iso_rx_slot_release(struct bt_iso_rx_slot *slot)
+{
+	if (slot->buf != NULL) {
+		net_buf_unref(slot->buf);
+		slot->buf = NULL;
+	}
+}
+
+/* The SDUs are stored in the slot of their sequence number, the slots of the
+ * sequence numbers not fitting the ring anymore are released.
+ */
+static void iso_rx_ring_put(struct bt_iso_rx_ring *ring, const struct bt_iso_recv_info *info,
+			    struct net_buf *buf)
+{
+	k_spinlock_key_t key = k_spin_lock(&ring->lock);
+	struct bt_iso_rx_slot *slot;
+	uint16_t offset;
+
+	if (!ring->started) {
+		ring->seq_next = info->seq_num;
+		ring->started = true;
+	}
+
+	offset = info->seq_num - ring->seq_next;
+	if (offset >= BIT(15)) {
+		k_spin_unlock(&ring->lock, key);
+
+		LOG_DBG("Late SDU %u, expecting %u", info->seq_num, ring->seq_next);
+		return;
+	}
+
+	while (offset > ring->mask) {
+		iso_rx_slot_release(&ring->slots[ring->seq_next & ring->mask]);
+		ring->seq_next++;
+		offset--;
+	}
+
+	slot = &ring->slots[info->seq_num & ring->mask];
+	iso_rx_slot_release(slot);
+	slot->buf = net_buf_ref(buf);
+	slot->info = *info;
+
+	k_spin_unlock(&ring->lock, key);
+}
+
+static bool iso_rx_slot_due(const struct bt_iso_rx_ring *ring,
+			    const struct bt_iso_rx_slot *slot, uint32_t ts_now)
+{
+	if (slot->buf == NULL) {
+		return false;
+	}
+
+	if (!(slot->info.flags & BT_ISO_FLAGS_TS)) {
+		return true;
+	}
+
+	return (int32_t)(ts_now - (slot->info.ts + ring->delay_us)) >= 0;
+}
+
+int bt_iso_rx_ring_get(struct bt_iso_rx_ring *ring, uint32_t ts_now,
+		       struct bt_iso_recv_info *info, struct net_buf **buf)
+{
+	k_spinlock_key_t key = k_spin_lock(&ring->lock);
+	struct bt_iso_rx_slot *slot;
+	int err = -EAGAIN;
+
+	if (!ring->started) {
+		goto unlock;
+	}
+
+	slot = &ring->slots[ring->seq_next & ring->mask];
+	if (slot->buf != NULL) {
+		if (iso_rx_slot_due(ring, slot, ts_now)) {
+			*info = slot->info;
+			*buf = slot->buf;
+			slot->buf = NULL;
+			ring->seq_next++;
+			err = 0;
+		}
+
+		goto unlock;
+	}
+
+	/* The next SDU is lost once a later one is due */
+	for (uint16_t i = 1U; i <= ring->mask; i++) {
+		if (iso_rx_slot_due(ring, &ring->slots[(ring->seq_next + i) & ring->mask],
+				    ts_now)) {
+			info->ts = 0U;
+			info->seq_num = ring->seq_next;
+			info->flags = BT_ISO_FLAGS_LOST;
+			ring->seq_next++;
+			err = -ENODATA;
+			break;
+		}
+	}
+
+unlock:
+	k_spin_unlock(&ring->lock, key);
+
+	return err;
+}
+
+void bt_iso_rx_ring_reset(struct bt_iso_rx_ring *ring)
+{
+	k_spinlock_key_t key = k_spin_lock(&ring->lock);
+
+	for (uint16_t i = 0U; i <= ring->mask; i++) {
+		iso_rx_slot_release(&ring->slots[i]);
+	}
+
+	ring->started = false;
+
+	k_spin_unlock(&ring->lock, key);
+}
+#endif /* CONFIG_BT_ISO_RX_RING */
+
 void bt_iso_recv(struct bt_conn *iso, struct net_buf *buf, uint8_t flags)
 {
 	struct bt_hci_iso_data_hdr *hdr;
@@ -717,12 +853,17 @@ void bt_iso_recv(struct bt_conn *iso, struct net_buf *buf, uint8_t flags)
 	chan = iso_chan(iso);
 	if (chan == NULL) {
 		LOG_ERR("Could not lookup chan from receiving ISO");
+#if defined(CONFIG_BT_ISO_RX_RING)
+	} else if (chan->rx_ring != NULL) {
+		iso_rx_ring_put(chan->rx_ring, iso_info(iso->rx), iso->rx);
+#endif /* CONFIG_BT_ISO_RX_RING */
 	} else if (chan->ops->recv != NULL) {
 		chan->ops->recv(chan, iso_info(iso->rx), iso->rx);
 	}
 
 	bt_conn_reset_rx_state(iso);
 }
+
 #endif /* CONFIG_BT_ISO_UNICAST) || defined(CONFIG_BT_ISO_SYNC_RECEIVER */
 
 #if defined(CONFIG_BT_ISO_UNICAST) || defined(CONFIG_BT_ISO_BROADCASTER)
@@ -436,43 +436,180 @@ static uint8_t get_adv_props_legacy(uint8_t evt_type)
 	}
 }
 
-static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
-			struct net_buf_simple *buf, uint16_t len)
+#if defined(CONFIG_BT_SCAN_DUP_FILTER)
+struct dup_filter_entry {
+	uint32_t hash;
+	uint32_t time;
+};
+
+static struct dup_filter_entry dup_filter[CONFIG_BT_SCAN_DUP_FILTER_SIZE];
+
+/* FNV-1a */
+static uint32_t dup_filter_hash(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	return hash;
+}
+#endif /* CONFIG_BT_SCAN_DUP_FILTER */
+
+static void dup_filter_reset(void)
+{
+#if defined(CONFIG_BT_SCAN_DUP_FILTER)
+	(void)memset(dup_filter, 0, sizeof(dup_filter));
+#endif /* CONFIG_BT_SCAN_DUP_FILTER */
+}
+
+static bool adv_is_duplicate(const bt_addr_le_t *addr, uint8_t adv_type,
+			     const uint8_t *data, uint16_t len)
+{
+#if defined(CONFIG_BT_SCAN_DUP_FILTER)
+	struct dup_filter_entry *entry;
+	uint32_t now = k_uptime_get_32();
+	uint32_t hash = 2166136261U;
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_SCAN_FILTER_DUP)) {
+		return false;
+	}
+
+	hash = dup_filter_hash(hash, addr, sizeof(*addr));
+	hash = dup_filter_hash(hash, &adv_type, sizeof(adv_type));
+	hash = dup_filter_hash(hash, data, len);
+
+	entry = &dup_filter[hash % ARRAY_SIZE(dup_filter)];
+	if (entry->hash == hash && (now - entry->time) < CONFIG_BT_SCAN_DUP_FILTER_WINDOW) {
+		return true;
+	}
+
+	entry->hash = hash;
+	entry->time = now;
+#endif /* CONFIG_BT_SCAN_DUP_FILTER */
+
+	return false;
+}
+
+#if defined(CONFIG_BT_SCAN_BATCH)
+/* Ring of reports written by the RX thread and delivered to the batch
+ * listeners from the system work queue.
+ */
+static struct bt_le_scan_report batch_ring[CONFIG_BT_SCAN_BATCH_COUNT];
+static uint16_t batch_head;
+static uint16_t batch_tail;
+static uint16_t batch_used;
+static struct k_spinlock batch_lock;
+
+static void batch_work_handler(struct k_work *work)
 {
 	struct bt_le_scan_cb *listener, *next;
-	struct net_buf_simple_state state;
-	bt_addr_le_t id_addr;
+	k_spinlock_key_t key;
+	uint16_t count;
 
-	LOG_DBG("%s event %u, len %u, rssi %d dBm", bt_addr_le_str(addr), info->adv_type, len,
-		info->rssi);
+	ARG_UNUSED(work);
 
-	if (!IS_ENABLED(CONFIG_BT_PRIVACY) &&
-	    !IS_ENABLED(CONFIG_BT_SCAN_WITH_IDENTITY) &&
-	    atomic_test_bit(bt_dev.flags, BT_DEV_EXPLICIT_SCAN) &&
-	    (info->adv_props & BT_HCI_LE_ADV_PROP_DIRECT)) {
-		LOG_DBG("Dropped direct adv report");
+	while (1) {
+		key = k_spin_lock(&batch_lock);
+		/* Contiguous reports of the ring */
+		count = MIN(batch_used, ARRAY_SIZE(batch_ring) - batch_tail);
+		k_spin_unlock(&batch_lock, key);
+
+		if (count == 0U) {
+			break;
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&scan_cbs, listener, next, node) {
+			if (listener->recv_batch) {
+				listener->recv_batch(&batch_ring[batch_tail], count);
+			}
+		}
+
+		key = k_spin_lock(&batch_lock);
+		batch_tail = (batch_tail + count) % ARRAY_SIZE(batch_ring);
+		batch_used -= count;
+		k_spin_unlock(&batch_lock, key);
+	}
+}
+
+static K_WORK_DEFINE(batch_work, batch_work_handler);
+#endif /* CONFIG_BT_SCAN_BATCH */
+
+static void adv_batch_put(const bt_addr_le_t *addr, const struct bt_le_scan_recv_info *info,
+			  const uint8_t *data, uint16_t len)
+{
+#if defined(CONFIG_BT_SCAN_BATCH)
+	struct bt_le_scan_cb *listener;
+	struct bt_le_scan_report *report;
+	k_spinlock_key_t key;
+	bool full;
+
+	if (len > sizeof(report->data)) {
 		return;
 	}
 
-	if (bt_addr_le_is_resolved(addr)) {
-		bt_addr_le_copy_resolved(&id_addr, addr);
-	} else if (addr->type == BT_HCI_PEER_ADDR_ANONYMOUS) {
-		bt_addr_le_copy(&id_addr, BT_ADDR_LE_ANY);
-	} else {
-		bt_addr_le_copy(&id_addr,
-				bt_lookup_id_addr(BT_ID_DEFAULT, addr));
+	SYS_SLIST_FOR_EACH_CONTAINER(&scan_cbs, listener, node) {
+		if (listener->recv_batch) {
+			break;
+		}
+	}
+
+	if (listener == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&batch_lock);
+	full = (batch_used == ARRAY_SIZE(batch_ring));
+	k_spin_unlock(&batch_lock, key);
+
+	if (full) {
+		LOG_DBG("Dropped adv report, batch full");
+		return;
 	}
 
+	/* Only the RX thread writes, the slot is free until batch_used is
+	 * incremented.
+	 */
+	report = &batch_ring[batch_head];
+	bt_addr_le_copy(&report->addr, addr);
+	report->sid = info->sid;
+	report->rssi = info->rssi;
+	report->tx_power = info->tx_power;
+	report->adv_type = info->adv_type;
+	report->adv_props = info->adv_props;
+	report->interval = info->interval;
+	report->primary_phy = info->primary_phy;
+	report->secondary_phy = info->secondary_phy;
+	report->data_len = len;
+	memcpy(report->data, data, len);
+
+	batch_head = (batch_head + 1U) % ARRAY_SIZE(batch_ring);
+
+	key = k_spin_lock(&batch_lock);
+	batch_used++;
+	k_spin_unlock(&batch_lock, key);
+
+	k_work_submit(&batch_work);
+#endif /* CONFIG_BT_SCAN_BATCH */
+}
+
+static void le_adv_notify(bt_addr_le_t *id_addr, struct bt_le_scan_recv_info *info,
+			  struct net_buf_simple *buf, uint16_t len)
+{
+	struct bt_le_scan_cb *listener, *next;
+	struct net_buf_simple_state state;
+
 	if (scan_dev_found_cb) {
 		net_buf_simple_save(buf, &state);
 
 		buf->len = len;
-		scan_dev_found_cb(&id_addr, info->rssi, info->adv_type, buf);
+		scan_dev_found_cb(id_addr, info->rssi, info->adv_type, buf);
 
 		net_buf_simple_restore(buf, &state);
 	}
 
-	info->addr = &id_addr;
+	info->addr = id_addr;
 
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&scan_cbs, listener, next, node) {
 		if (listener->recv) {
@@ -487,6 +624,39 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 
 	/* Clear pointer to this stack frame before returning to calling function */
 	info->addr = NULL;
+}
+
+static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
+			struct net_buf_simple *buf, uint16_t len)
+{
+	bt_addr_le_t id_addr;
+
+	LOG_DBG("%s event %u, len %u, rssi %d dBm", bt_addr_le_str(addr), info->adv_type, len,
+		info->rssi);
+
+	if (!IS_ENABLED(CONFIG_BT_PRIVACY) &&
+	    !IS_ENABLED(CONFIG_BT_SCAN_WITH_IDENTITY) &&
+	    atomic_test_bit(bt_dev.flags, BT_DEV_EXPLICIT_SCAN) &&
+	    (info->adv_props & BT_HCI_LE_ADV_PROP_DIRECT)) {
+		LOG_DBG("Dropped direct adv report");
+		return;
+	}
+
+	if (bt_addr_le_is_resolved(addr)) {
+		bt_addr_le_copy_resolved(&id_addr, addr);
+	} else if (addr->type == BT_HCI_PEER_ADDR_ANONYMOUS) {
+		bt_addr_le_copy(&id_addr, BT_ADDR_LE_ANY);
+	} else {
+		bt_addr_le_copy(&id_addr,
+				bt_lookup_id_addr(BT_ID_DEFAULT, addr));
+	}
+
+	if (adv_is_duplicate(&id_addr, info->adv_type, buf->data, len)) {
+		LOG_DBG("Dropped duplicate adv report");
+	} else {
+		adv_batch_put(&id_addr, info, buf->data, len);
+		le_adv_notify(&id_addr, info, buf, len);
+	}
 
 #if defined(CONFIG_BT_CENTRAL)
 	check_pending_conn(&id_addr, addr, info->adv_props);
@@ -1483,6 +1653,7 @@ int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
 
 	atomic_set_bit_to(bt_dev.flags, BT_DEV_SCAN_FILTER_DUP,
 			  param->options & BT_LE_SCAN_OPT_FILTER_DUPLICATE);
+	dup_filter_reset();
 
 #if defined(CONFIG_BT_FILTER_ACCEPT_LIST)
 	atomic_set_bit_to(bt_dev.flags, BT_DEV_SCAN_FILTERED,
@@ -102,6 +102,45 @@ NET_BUF_POOL_DEFINE(friend_buf_pool, CONFIG_BT_MESH_FRIEND_LPN_COUNT,
 static struct bt_mesh_adv adv_friend_pool[CONFIG_BT_MESH_FRIEND_LPN_COUNT];
 #endif
 
+/* Relayed messages which waited in the queue for longer than
+ * CONFIG_BT_MESH_RELAY_QUEUE_TIMEOUT are dropped, so that a burst of
+ * relayed messages does not delay the following ones indefinitely.
+ */
+static struct net_buf *adv_buf_get(struct k_fifo *fifo, k_timeout_t timeout)
+{
+	struct net_buf *buf;
+
+	for (buf = net_buf_get(fifo, timeout); buf; buf = net_buf_get(fifo, K_NO_WAIT)) {
+#if defined(CONFIG_BT_MESH_RELAY)
+		uint32_t wait_ms;
+		bool dropped;
+
+		if (!(BT_MESH_ADV(buf)->tag & BT_MESH_RELAY_ADV)) {
+			return buf;
+		}
+
+		wait_ms = k_uptime_get_32() - BT_MESH_ADV(buf)->timestamp;
+		dropped = CONFIG_BT_MESH_RELAY_QUEUE_TIMEOUT > 0 &&
+			  wait_ms > CONFIG_BT_MESH_RELAY_QUEUE_TIMEOUT;
+
+		if (IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
+			bt_mesh_stat_relay_dequeued(wait_ms, dropped);
+		}
+
+		if (!dropped) {
+			return buf;
+		}
+
+		LOG_DBG("Dropping relayed message queued for %u ms", wait_ms);
+		net_buf_unref(buf);
+#else
+		return buf;
+#endif
+	}
+
+	return NULL;
+}
+
 static struct net_buf *bt_mesh_adv_create_from_pool(struct net_buf_pool *buf_pool,
 						    struct bt_mesh_adv *adv_pool,
 						    enum bt_mesh_adv_type type,
@@ -165,7 +204,7 @@ static struct net_buf *process_events(struct k_poll_event *ev, int count)
 
 		switch (ev->state) {
 		case K_POLL_STATE_FIFO_DATA_AVAILABLE:
-			return net_buf_get(ev->fifo, K_NO_WAIT);
+			return adv_buf_get(ev->fifo, K_NO_WAIT);
 		case K_POLL_STATE_NOT_READY:
 		case K_POLL_STATE_CANCELLED:
 			break;
@@ -205,12 +244,12 @@ struct net_buf *bt_mesh_adv_buf_get(k_timeout_t timeout)
 struct net_buf *bt_mesh_adv_buf_get_by_tag(uint8_t tag, k_timeout_t timeout)
 {
 	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE) && tag & BT_MESH_FRIEND_ADV) {
-		return net_buf_get(&bt_mesh_friend_queue, timeout);
+		return adv_buf_get(&bt_mesh_friend_queue, timeout);
 	}
 
 #if CONFIG_BT_MESH_RELAY_ADV_SETS
 	if (tag & BT_MESH_RELAY_ADV) {
-		return net_buf_get(&bt_mesh_relay_queue, timeout);
+		return adv_buf_get(&bt_mesh_relay_queue, timeout);
 	}
 #endif
 
@@ -219,7 +258,7 @@ struct net_buf *bt_mesh_adv_buf_get_by_tag(uint8_t tag, k_timeout_t timeout)
 #else /* !(CONFIG_BT_MESH_RELAY_ADV_SETS || CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE) */
 struct net_buf *bt_mesh_adv_buf_get(k_timeout_t timeout)
 {
-	return net_buf_get(&bt_mesh_adv_queue, timeout);
+	return adv_buf_get(&bt_mesh_adv_queue, timeout);
 }
 
 struct net_buf *bt_mesh_adv_buf_get_by_tag(uint8_t tag, k_timeout_t timeout)
@@ -255,6 +294,10 @@ void bt_mesh_adv_send(struct net_buf *buf, const struct bt_mesh_send_cb *cb,
 	BT_MESH_ADV(buf)->cb_data = cb_data;
 	BT_MESH_ADV(buf)->busy = 1U;
 
+#if defined(CONFIG_BT_MESH_RELAY)
+	BT_MESH_ADV(buf)->timestamp = k_uptime_get_32();
+#endif
+
 	if (IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
 		bt_mesh_stat_planned_count(BT_MESH_ADV(buf));
 	}
@@ -48,6 +48,11 @@ struct bt_mesh_adv {
 		  tag:4;
 
 	uint8_t      xmit;
+
+#if defined(CONFIG_BT_MESH_RELAY)
+	/* Uptime in milliseconds when queued */
+	uint32_t     timestamp;
+#endif
 };
 
 /* Lookup table for Advertising data types for bt_mesh_adv_type: */
@@ -76,11 +76,24 @@ struct iv_val {
 	      iv_duration:7;
 } __packed;
 
-static struct {
-	uint32_t src : 15, /* MSb of source is always 0 */
-	      seq : 17;
-} msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
-static uint16_t msg_cache_next;
+/* Cache of recently seen values, indexed by a hash table. The oldest value
+ * is replaced when the cache is full. The buckets and the chains hold the
+ * value index plus one, zero ending a chain.
+ */
+#define NET_CACHE_BUCKETS BIT(LOG2CEIL(CONFIG_BT_MESH_MSG_CACHE_SIZE))
+
+struct net_cache {
+	uint32_t val[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+	uint16_t chain[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+	uint16_t buckets[NET_CACHE_BUCKETS];
+	uint16_t next;
+	uint16_t count;
+};
+
+/* Values are the 15 bits of source address (MSb is always 0) followed by
+ * the 17 LSbs of sequence number.
+ */
+static struct net_cache msg_cache;
 
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
@@ -115,62 +128,96 @@ K_MEM_SLAB_DEFINE(loopback_buf_pool,
 		  sizeof(struct loopback_buf),
 		  CONFIG_BT_MESH_LOOPBACK_BUFS, __alignof__(struct loopback_buf));
 
-static uint32_t dup_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
-static int   dup_cache_next;
+/* Values are the XOR of the last 8 bytes of the encrypted PDUs */
+static struct net_cache dup_cache;
 
-static bool check_dup(struct net_buf_simple *data)
+static uint16_t *net_cache_bucket(struct net_cache *cache, uint32_t val)
 {
-	const uint8_t *tail = net_buf_simple_tail(data);
-	uint32_t val;
-	int i;
+	/* Multiplicative hashing, source addresses and sequence numbers are
+	 * mostly sequential.
+	 */
+	return &cache->buckets[((val * 2654435761U) >> 16) & (NET_CACHE_BUCKETS - 1)];
+}
 
-	val = sys_get_be32(tail - 4) ^ sys_get_be32(tail - 8);
+static bool net_cache_match(struct net_cache *cache, uint32_t val)
+{
+	uint16_t i;
 
-	for (i = dup_cache_next; i > 0;) {
-		if (dup_cache[--i] == val) {
+	for (i = *net_cache_bucket(cache, val); i; i = cache->chain[i - 1]) {
+		if (cache->val[i - 1] == val) {
 			return true;
 		}
 	}
 
-	for (i = ARRAY_SIZE(dup_cache); i > dup_cache_next;) {
-		if (dup_cache[--i] == val) {
-			return true;
-		}
-	}
+	return false;
+}
 
-	dup_cache_next %= ARRAY_SIZE(dup_cache);
-	dup_cache[dup_cache_next++] = val;
+static void net_cache_unlink(struct net_cache *cache, uint16_t idx)
+{
+	uint16_t *i = net_cache_bucket(cache, cache->val[idx]);
 
-	return false;
+	while (*i != idx + 1) {
+		i = &cache->chain[*i - 1];
+	}
+
+	*i = cache->chain[idx];
 }
 
-static bool msg_cache_match(struct net_buf_simple *pdu)
+static void net_cache_add(struct net_cache *cache, uint32_t val)
 {
-	uint16_t i;
+	uint16_t *bucket = net_cache_bucket(cache, val);
 
-	for (i = msg_cache_next; i > 0U;) {
-		if (msg_cache[--i].src == SRC(pdu->data) &&
-		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
-			return true;
-		}
+	if (cache->count == ARRAY_SIZE(cache->val)) {
+		net_cache_unlink(cache, cache->next);
+	} else {
+		cache->count++;
 	}
 
-	for (i = ARRAY_SIZE(msg_cache); i > msg_cache_next;) {
-		if (msg_cache[--i].src == SRC(pdu->data) &&
-		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
-			return true;
-		}
+	cache->val[cache->next] = val;
+	cache->chain[cache->next] = *bucket;
+	*bucket = cache->next + 1;
+
+	cache->next = (cache->next + 1) % ARRAY_SIZE(cache->val);
+}
+
+/* Remove the most recently added value */
+static void net_cache_rewind(struct net_cache *cache)
+{
+	if (!cache->count) {
+		return;
 	}
 
+	cache->next = (cache->next + ARRAY_SIZE(cache->val) - 1) % ARRAY_SIZE(cache->val);
+	cache->count--;
+
+	net_cache_unlink(cache, cache->next);
+}
+
+static bool check_dup(struct net_buf_simple *data)
+{
+	const uint8_t *tail = net_buf_simple_tail(data);
+	uint32_t val;
+
+	val = sys_get_be32(tail - 4) ^ sys_get_be32(tail - 8);
+
+	if (net_cache_match(&dup_cache, val)) {
+		return true;
+	}
+
+	net_cache_add(&dup_cache, val);
+
 	return false;
 }
 
+static bool msg_cache_match(struct net_buf_simple *pdu)
+{
+	return net_cache_match(&msg_cache, ((uint32_t)SRC(pdu->data) << 17) |
+				(SEQ(pdu->data) & BIT_MASK(17)));
+}
+
 static void msg_cache_add(struct bt_mesh_net_rx *rx)
 {
-	msg_cache_next %= ARRAY_SIZE(msg_cache);
-	msg_cache[msg_cache_next].src = rx->ctx.addr;
-	msg_cache[msg_cache_next].seq = rx->seq;
-	msg_cache_next++;
+	net_cache_add(&msg_cache, ((uint32_t)rx->ctx.addr << 17) | (rx->seq & BIT_MASK(17)));
 }
 
 static void store_iv(bool only_duration)
@@ -214,8 +261,7 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 		return err;
 	}
 
-	(void)memset(msg_cache, 0, sizeof(msg_cache));
-	msg_cache_next = 0U;
+	(void)memset(&msg_cache, 0, sizeof(msg_cache));
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -884,8 +930,10 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 		 */
 		LOG_WRN("Removing rejected message from Network Message Cache");
 		/* Rewind the next index now that we're not using this entry */
-		msg_cache[--msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
-		dup_cache[--dup_cache_next] = 0;
+		net_cache_rewind(&msg_cache);
+		if (net_if == BT_MESH_NET_IF_ADV) {
+			net_cache_rewind(&dup_cache);
+		}
 		return;
 	} else if (err == -EBADMSG) {
 		LOG_DBG("Not relaying message rejected by the Transport layer");
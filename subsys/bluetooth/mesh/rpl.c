@@ -29,6 +29,12 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(bt_mesh_rpl);
 
+#if defined(CONFIG_BT_MESH_RPL_STORE_BATCH)
+#define RPL_STORE_BATCH CONFIG_BT_MESH_RPL_STORE_BATCH
+#else
+#define RPL_STORE_BATCH 0
+#endif
+
 /* Replay Protection List information for persistent storage. */
 struct rpl_val {
 	uint32_t seq:24,
@@ -38,6 +44,15 @@ struct rpl_val {
 static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 static ATOMIC_DEFINE(store, CONFIG_BT_MESH_CRPL);
 
+/* Index of the entries by source address. Unicast addresses are mostly
+ * allocated sequentially, so their low bits select the bucket. The buckets
+ * and the chains hold the entry index plus one, zero ending a chain.
+ */
+#define RPL_BUCKETS BIT(LOG2CEIL(CONFIG_BT_MESH_CRPL))
+
+static uint16_t rpl_buckets[RPL_BUCKETS];
+static uint16_t rpl_chain[CONFIG_BT_MESH_CRPL];
+
 enum {
 	PENDING_CLEAR,
 	PENDING_RESET,
@@ -49,6 +64,55 @@ static inline int rpl_idx(const struct bt_mesh_rpl *rpl)
 	return rpl - &replay_list[0];
 }
 
+static void rpl_index_add(struct bt_mesh_rpl *rpl)
+{
+	uint16_t *bucket = &rpl_buckets[rpl->src & (RPL_BUCKETS - 1)];
+	int i = rpl_idx(rpl);
+
+	rpl_chain[i] = *bucket;
+	*bucket = i + 1;
+}
+
+/* Entries are removed and moved in bulk only, when the list is cleared,
+ * reset or compacted, so the index is then built again.
+ */
+static void rpl_index_rebuild(void)
+{
+	(void)memset(rpl_buckets, 0, sizeof(rpl_buckets));
+
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (replay_list[i].src) {
+			rpl_index_add(&replay_list[i]);
+		}
+	}
+}
+
+static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
+{
+	uint16_t i;
+
+	for (i = rpl_buckets[src & (RPL_BUCKETS - 1)]; i; i = rpl_chain[i - 1]) {
+		if (replay_list[i - 1].src == src) {
+			return &replay_list[i - 1];
+		}
+	}
+
+	return NULL;
+}
+
+static struct bt_mesh_rpl *rpl_free_get(void)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (!replay_list[i].src) {
+			return &replay_list[i];
+		}
+	}
+
+	return NULL;
+}
+
 static void clear_rpl(struct bt_mesh_rpl *rpl)
 {
 	int err;
@@ -92,7 +156,15 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
-	rpl->src = rx->ctx.addr;
+	if (!rpl->src) {
+		rpl->src = rx->ctx.addr;
+		rpl_index_add(rpl);
+	} else if (rpl->src != rx->ctx.addr) {
+		/* Free slot taken by another source since it was matched */
+		rpl->src = rx->ctx.addr;
+		rpl_index_rebuild();
+	}
+
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
 
@@ -110,7 +182,6 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match)
 {
 	struct bt_mesh_rpl *rpl;
-	int i;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -122,42 +193,38 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		rpl = &replay_list[i];
-
-		/* Empty slot */
-		if (!rpl->src) {
+	/* Existing slot for given address */
+	rpl = bt_mesh_rpl_find(rx->ctx.addr);
+	if (rpl) {
+		if (!rpl->old_iv &&
+		    atomic_test_bit(&rpl_flags, PENDING_RESET) &&
+		    !atomic_test_bit(store, rpl_idx(rpl))) {
+			/* Until rpl reset is finished, entry with old_iv == false and
+			 * without "store" bit set will be removed, therefore it can be
+			 * reused. If such entry is reused, "store" bit will be set and
+			 * the entry won't be removed.
+			 */
 			goto match;
 		}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (!rpl->old_iv &&
-			    atomic_test_bit(&rpl_flags, PENDING_RESET) &&
-			    !atomic_test_bit(store, i)) {
-				/* Until rpl reset is finished, entry with old_iv == false and
-				 * without "store" bit set will be removed, therefore it can be
-				 * reused. If such entry is reused, "store" bit will be set and
-				 * the entry won't be removed.
-				 */
-				goto match;
-			}
-
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+		if (rx->old_iv && !rpl->old_iv) {
+			return true;
+		}
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				goto match;
-			} else {
-				return true;
-			}
+		if ((!rx->old_iv && rpl->old_iv) ||
+		    rpl->seq < rx->seq) {
+			goto match;
+		} else {
+			return true;
 		}
 	}
 
-	LOG_ERR("RPL is full!");
-	return true;
+	/* Empty slot */
+	rpl = rpl_free_get();
+	if (!rpl) {
+		LOG_ERR("RPL is full!");
+		return true;
+	}
 
 match:
 	if (match) {
@@ -175,6 +242,7 @@ void bt_mesh_rpl_clear(void)
 
 	if (!IS_ENABLED(CONFIG_BT_SETTINGS)) {
 		(void)memset(replay_list, 0, sizeof(replay_list));
+		rpl_index_rebuild();
 		return;
 	}
 
@@ -183,31 +251,16 @@ void bt_mesh_rpl_clear(void)
 	bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_RPL_PENDING);
 }
 
-static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
-{
-	int i;
-
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (replay_list[i].src == src) {
-			return &replay_list[i];
-		}
-	}
-
-	return NULL;
-}
-
 static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 {
-	int i;
+	struct bt_mesh_rpl *rpl = rpl_free_get();
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (!replay_list[i].src) {
-			replay_list[i].src = src;
-			return &replay_list[i];
-		}
+	if (rpl) {
+		rpl->src = src;
+		rpl_index_add(rpl);
 	}
 
-	return NULL;
+	return rpl;
 }
 
 void bt_mesh_rpl_reset(void)
@@ -261,6 +314,7 @@ void bt_mesh_rpl_reset(void)
 		}
 
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_rebuild();
 	}
 }
 
@@ -284,6 +338,7 @@ static int rpl_set(const char *name, size_t len_rd,
 		LOG_DBG("val (null)");
 		if (entry) {
 			(void)memset(entry, 0, sizeof(*entry));
+			rpl_index_rebuild();
 		} else {
 			LOG_WRN("Unable to find RPL entry for 0x%04x", src);
 		}
@@ -343,6 +398,8 @@ static void store_rpl(struct bt_mesh_rpl *entry)
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
 {
+	bool postponed = false;
+	int stored = 0;
 	int shift = 0;
 	int last = 0;
 	bool clr;
@@ -371,12 +428,20 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 		if (clr) {
 			clear_rpl(rpl);
 			shift++;
+		} else if (!rst && RPL_STORE_BATCH > 0 &&
+			   stored >= RPL_STORE_BATCH &&
+			   atomic_test_bit(store, i)) {
+			/* Nothing is shifted without a reset, the entry is
+			 * stored in a later pass.
+			 */
+			postponed = true;
 		} else if (atomic_test_and_clear_bit(store, i)) {
 			if (shift > 0) {
 				replay_list[i - shift] = *rpl;
 			}
 
 			store_rpl(&replay_list[i - shift]);
+			stored++;
 		} else if (rst) {
 			clear_rpl(rpl);
 
@@ -402,5 +467,13 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 
 	if (addr == BT_MESH_ADDR_ALL_NODES) {
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+
+		if (shift > 0) {
+			rpl_index_rebuild();
+		}
+	}
+
+	if (postponed) {
+		bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_RPL_PENDING);
 	}
 }
@@ -19,7 +19,13 @@ void bt_mesh_stat_get(struct bt_mesh_statistic *st)
 
 void bt_mesh_stat_reset(void)
 {
+	uint32_t queued = stat.tx_adv_relay_queued;
+
 	memset(&stat, 0, sizeof(struct bt_mesh_statistic));
+
+	/* Frames still in the queue are dequeued later on */
+	stat.tx_adv_relay_queued = queued;
+	stat.tx_adv_relay_queued_max = queued;
 }
 
 void bt_mesh_stat_planned_count(struct bt_mesh_adv *adv)
@@ -28,11 +34,31 @@ void bt_mesh_stat_planned_count(struct bt_mesh_adv *adv)
 		stat.tx_local_planned++;
 	} else if (adv->tag & BT_MESH_RELAY_ADV) {
 		stat.tx_adv_relay_planned++;
+		stat.tx_adv_relay_queued++;
+		stat.tx_adv_relay_queued_max = MAX(stat.tx_adv_relay_queued,
+						   stat.tx_adv_relay_queued_max);
 	} else if (adv->tag & BT_MESH_FRIEND_ADV) {
 		stat.tx_friend_planned++;
 	}
 }
 
+void bt_mesh_stat_relay_dequeued(uint32_t wait_ms, bool dropped)
+{
+	int bin;
+
+	if (stat.tx_adv_relay_queued) {
+		stat.tx_adv_relay_queued--;
+	}
+
+	if (dropped) {
+		stat.tx_adv_relay_dropped++;
+		return;
+	}
+
+	bin = (wait_ms < 10) ? 0 : LOG2(wait_ms / 10) + 1;
+	stat.tx_adv_relay_latency[MIN(bin, BT_MESH_STAT_RELAY_LATENCY_BINS - 1)]++;
+}
+
 void bt_mesh_stat_succeeded_count(struct bt_mesh_adv *adv)
 {
 	if (adv->tag & BT_MESH_LOCAL_ADV) {
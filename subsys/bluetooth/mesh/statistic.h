@@ -9,6 +9,7 @@
 
 void bt_mesh_stat_planned_count(struct bt_mesh_adv *adv);
 void bt_mesh_stat_succeeded_count(struct bt_mesh_adv *adv);
+void bt_mesh_stat_relay_dequeued(uint32_t wait_ms, bool dropped);
 void bt_mesh_stat_rx(enum bt_mesh_net_if net_if);
 
 #endif /* ZEPHYR_SUBSYS_BLUETOOTH_MESH_STATISTIC_H_ */
@@ -27,7 +27,7 @@ NET_BUF_POOL_DEFINE(isotp_rx_pool, CONFIG_ISOTP_RX_BUF_COUNT,
 		    receive_pool_free);
 
 NET_BUF_POOL_DEFINE(isotp_rx_sf_ff_pool, CONFIG_ISOTP_RX_SF_FF_BUF_COUNT,
-		    ISOTP_CAN_DL, sizeof(uint32_t), receive_ff_sf_pool_free);
+		    ISOTP_CAN_DL_MAX, sizeof(uint32_t), receive_ff_sf_pool_free);
 
 static struct isotp_global_ctx global_ctx = {
 	.alloc_list = SYS_SLIST_STATIC_INIT(&global_ctx.alloc_list),
@@ -41,6 +41,41 @@ NET_BUF_POOL_VAR_DEFINE(isotp_tx_pool, CONFIG_ISOTP_TX_BUF_COUNT,
 
 static void receive_state_machine(struct isotp_recv_ctx *ctx);
 
+static inline uint8_t get_frame_flags(const struct isotp_msg_id *addr)
+{
+	return (addr->ide != 0 ? CAN_FRAME_IDE : 0) |
+	       (addr->use_fdf != 0 ? CAN_FRAME_FDF : 0) |
+	       (addr->use_brs != 0 ? CAN_FRAME_BRS : 0);
+}
+
+/* TX_DL of an address. Frames longer than 8 bytes need CAN-FD */
+static inline uint8_t get_tx_dl(const struct isotp_msg_id *addr)
+{
+	if (IS_ENABLED(CONFIG_CAN_FD_MODE) && addr->use_fdf &&
+	    addr->dl > ISOTP_CAN_DL) {
+		return addr->dl;
+	}
+
+	return ISOTP_CAN_DL;
+}
+
+/*
+ * Set the DLC for a frame carrying len bytes. The frame is padded up to the
+ * next valid CAN-FD data length if needed.
+ */
+static void set_frame_len(struct can_frame *frame, size_t len)
+{
+	size_t frame_len = len;
+
+#ifdef CONFIG_ISOTP_ENABLE_TX_PADDING
+	/* AUTOSAR requirement SWS_CanTp_00347 and SWS_CanTp_00348 */
+	frame_len = MAX(frame_len, ISOTP_CAN_DL);
+#endif
+	frame->dlc = can_bytes_to_dlc(frame_len);
+	frame_len = can_dlc_to_bytes(frame->dlc);
+	memset(&frame->data[len], 0xCC, frame_len - len);
+}
+
 /*
  * Wake every context that is waiting for a buffer
  */
@@ -109,7 +144,7 @@ static inline uint32_t receive_get_sf_length(struct net_buf *buf)
 	uint8_t len = net_buf_pull_u8(buf) & ISOTP_PCI_SF_DL_MASK;
 
 	/* Single frames > 16 bytes (CAN-FD only) */
-	if (IS_ENABLED(ISOTP_USE_CAN_FD) && !len) {
+	if (IS_ENABLED(CONFIG_CAN_FD_MODE) && !len) {
 		len = net_buf_pull_u8(buf);
 	}
 
@@ -119,11 +154,10 @@ static inline uint32_t receive_get_sf_length(struct net_buf *buf)
 static void receive_send_fc(struct isotp_recv_ctx *ctx, uint8_t fs)
 {
 	struct can_frame frame = {
-		.flags = ctx->tx_addr.ide != 0 ? CAN_FRAME_IDE : 0,
+		.flags = get_frame_flags(&ctx->tx_addr),
 		.id = ctx->tx_addr.ext_id
 	};
 	uint8_t *data = frame.data;
-	uint8_t payload_len;
 	int ret;
 
 	__ASSERT_NO_MSG(!(fs & ISOTP_PCI_TYPE_MASK));
@@ -133,17 +167,10 @@ static void receive_send_fc(struct isotp_recv_ctx *ctx, uint8_t fs)
 	}
 
 	*data++ = ISOTP_PCI_TYPE_FC | fs;
-	*data++ = ctx->opts.bs;
+	/* BS of the block allocated for, which may exceed opts.bs */
+	*data++ = fs == ISOTP_PCI_FS_CTS ? ctx->bs : ctx->opts.bs;
 	*data++ = ctx->opts.stmin;
-	payload_len = data - frame.data;
-
-#ifdef CONFIG_ISOTP_ENABLE_TX_PADDING
-	/* AUTOSAR requirement SWS_CanTp_00347 */
-	memset(&frame.data[payload_len], 0xCC, ISOTP_CAN_DL - payload_len);
-	frame.dlc = ISOTP_CAN_DL;
-#else
-	frame.dlc = payload_len;
-#endif
+	set_frame_len(&frame, data - frame.data);
 
 	ret = can_send(ctx->can_dev, &frame, K_MSEC(ISOTP_A),
 		       receive_can_tx, ctx);
@@ -187,6 +214,39 @@ static inline struct net_buf *receive_alloc_buffer_chain(uint32_t len)
 	return buf;
 }
 
+/*
+ * Extend the buffer chain of a block by the free buffers of the pool, up to the
+ * remaining length. Returns the number of CFs the chain can hold.
+ */
+static uint8_t receive_grow_block(struct isotp_recv_ctx *ctx,
+				  struct net_buf *buf, size_t cf_len)
+{
+	struct net_buf *frag, *last = net_buf_frag_last(buf);
+	size_t max_len = MIN(ctx->length, UINT8_MAX * cf_len);
+	size_t len = 0;
+	size_t bs;
+
+	for (frag = buf; frag; frag = frag->frags) {
+		len += net_buf_tailroom(frag);
+	}
+
+	while (len < max_len) {
+		frag = net_buf_alloc_fixed(&isotp_rx_pool, K_NO_WAIT);
+		if (!frag) {
+			break;
+		}
+
+		net_buf_frag_insert(last, frag);
+		last = frag;
+		len += net_buf_tailroom(frag);
+	}
+
+	bs = len >= ctx->length ? DIV_ROUND_UP(ctx->length, cf_len) :
+		len / cf_len;
+
+	return MIN(bs, UINT8_MAX);
+}
+
 static void receive_timeout_handler(struct _timeout *to)
 {
 	struct isotp_recv_ctx *ctx = CONTAINER_OF(to, struct isotp_recv_ctx,
@@ -209,24 +269,39 @@ static void receive_timeout_handler(struct _timeout *to)
 static int receive_alloc_buffer(struct isotp_recv_ctx *ctx)
 {
 	struct net_buf *buf = NULL;
+	size_t cf_len = ctx->rx_dl - (ctx->rx_addr.use_ext_addr ? 2 : 1);
+	uint8_t bs = ctx->opts.bs;
+	bool allocated;
 
-	if (ctx->opts.bs == 0) {
-		/* Alloc all buffers because we can't wait during reception */
-		buf = receive_alloc_buffer_chain(ctx->length);
+	if (ctx->rx_buf) {
+		/* Wait until the application is done with the last message */
+		allocated = !ctx->rx_buf_full;
 	} else {
-		buf = receive_alloc_buffer_chain(ctx->opts.bs *
-						 (ISOTP_CAN_DL - 1));
+		if (bs == 0) {
+			/* Alloc all buffers because we can't wait during reception */
+			buf = receive_alloc_buffer_chain(ctx->length);
+		} else {
+			buf = receive_alloc_buffer_chain(bs * cf_len);
+			if (buf && IS_ENABLED(CONFIG_ISOTP_RX_ADAPTIVE_BS)) {
+				bs = receive_grow_block(ctx, buf, cf_len);
+			}
+		}
+
+		allocated = buf != NULL;
 	}
 
-	if (!buf) {
+	if (!allocated) {
 		z_add_timeout(&ctx->timeout, receive_timeout_handler,
 			      K_MSEC(ISOTP_ALLOC_TIMEOUT));
 
 		if (ctx->wft == ISOTP_WFT_FIRST) {
 			LOG_DBG("Allocation failed. Append to alloc list");
 			ctx->wft = 0;
-			sys_slist_append(&global_ctx.alloc_list,
-					 &ctx->alloc_node);
+			/* isotp_recv_buf wakes contexts with a reassembly buffer */
+			if (!ctx->rx_buf) {
+				sys_slist_append(&global_ctx.alloc_list,
+						 &ctx->alloc_node);
+			}
 		} else {
 			LOG_DBG("Allocation failed. Send WAIT frame");
 			ctx->state = ISOTP_RX_STATE_SEND_WAIT;
@@ -243,16 +318,47 @@ static int receive_alloc_buffer(struct isotp_recv_ctx *ctx)
 					  &ctx->alloc_node);
 	}
 
-	if (ctx->opts.bs != 0) {
+	if (ctx->rx_buf) {
+		if (ctx->buf) {
+			/* FF payload, the CFs are appended to it */
+			memcpy(ctx->rx_buf, ctx->buf->data, ctx->buf->len);
+			ctx->rx_buf_len = ctx->buf->len;
+			net_buf_unref(ctx->buf);
+			ctx->buf = NULL;
+		}
+
+		if (IS_ENABLED(CONFIG_ISOTP_RX_ADAPTIVE_BS)) {
+			/* The whole message fits, no need for further FC */
+			bs = 0;
+		}
+	} else if (ctx->opts.bs != 0) {
 		ctx->buf = buf;
 	} else {
 		net_buf_frag_insert(ctx->buf, buf);
 	}
 
 	ctx->act_frag = buf;
+	ctx->bs = bs;
 	return 0;
 }
 
+static void receive_sf_to_rx_buf(struct isotp_recv_ctx *ctx)
+{
+	if (ctx->length > ctx->rx_buf_size) {
+		LOG_ERR("SF length is %d but buffer has only %zu bytes",
+			ctx->length, ctx->rx_buf_size);
+		ctx->error_nr = ISOTP_N_BUFFER_OVERFLW;
+	} else {
+		memcpy(ctx->rx_buf, ctx->buf->data, ctx->length);
+		ctx->rx_buf_len = ctx->length;
+		ctx->rx_buf_full = true;
+	}
+
+	k_sem_give(&ctx->rx_buf_sem);
+	net_buf_unref(ctx->buf);
+	ctx->buf = NULL;
+}
+
 static void receive_state_machine(struct isotp_recv_ctx *ctx)
 {
 	int ret;
@@ -260,11 +366,21 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 
 	switch (ctx->state) {
 	case ISOTP_RX_STATE_PROCESS_SF:
+		if (ctx->rx_buf && ctx->rx_buf_full) {
+			LOG_DBG("SM SF waits for the reassembly buffer");
+			break;
+		}
+
 		ctx->length = receive_get_sf_length(ctx->buf);
-		ud_rem_len = net_buf_user_data(ctx->buf);
-		*ud_rem_len = 0;
 		LOG_DBG("SM process SF of length %d", ctx->length);
-		net_buf_put(&ctx->fifo, ctx->buf);
+		if (ctx->rx_buf) {
+			receive_sf_to_rx_buf(ctx);
+		} else {
+			ud_rem_len = net_buf_user_data(ctx->buf);
+			*ud_rem_len = 0;
+			net_buf_put(&ctx->fifo, ctx->buf);
+		}
+
 		ctx->state = ISOTP_RX_STATE_RECYCLE;
 		receive_state_machine(ctx);
 		break;
@@ -272,8 +388,17 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 	case ISOTP_RX_STATE_PROCESS_FF:
 		ctx->length = receive_get_ff_length(ctx->buf);
 		LOG_DBG("SM process FF. Length: %d", ctx->length);
+		if (ctx->rx_buf && (ctx->length > ctx->rx_buf_size ||
+				    ctx->length < ctx->buf->len)) {
+			LOG_ERR("Pkt length is %d but buffer has only %zu bytes",
+				ctx->length, ctx->rx_buf_size);
+			receive_report_error(ctx, ISOTP_N_BUFFER_OVERFLW);
+			receive_state_machine(ctx);
+			break;
+		}
+
 		ctx->length -= ctx->buf->len;
-		if (ctx->opts.bs == 0 &&
+		if (!ctx->rx_buf && ctx->opts.bs == 0 &&
 		    ctx->length > CONFIG_ISOTP_RX_BUF_COUNT *
 		    CONFIG_ISOTP_RX_BUF_SIZE) {
 			LOG_ERR("Pkt length is %d but buffer has only %d bytes",
@@ -285,8 +410,7 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 			break;
 		}
 
-		if (ctx->opts.bs) {
-			ctx->bs = ctx->opts.bs;
+		if (!ctx->rx_buf && ctx->opts.bs) {
 			ud_rem_len = net_buf_user_data(ctx->buf);
 			*ud_rem_len = ctx->length;
 			net_buf_put(&ctx->fifo, ctx->buf);
@@ -339,8 +463,15 @@ static void receive_state_machine(struct isotp_recv_ctx *ctx)
 		}
 
 		k_fifo_cancel_wait(&ctx->fifo);
-		net_buf_unref(ctx->buf);
-		ctx->buf = NULL;
+		if (ctx->rx_buf) {
+			k_sem_give(&ctx->rx_buf_sem);
+		}
+
+		if (ctx->buf) {
+			net_buf_unref(ctx->buf);
+			ctx->buf = NULL;
+		}
+
 		ctx->state = ISOTP_RX_STATE_RECYCLE;
 		__fallthrough;
 	case ISOTP_RX_STATE_RECYCLE:
@@ -376,7 +507,9 @@ static void receive_work_handler(struct k_work *item)
 static void process_ff_sf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 {
 	int index = 0;
-	uint8_t payload_len;
+	uint8_t frame_len = can_dlc_to_bytes(frame->dlc);
+	size_t payload_len;
+	uint8_t sf_dl;
 	uint32_t rx_sa;		/* ISO-TP fixed source address (if used) */
 
 	if (ctx->rx_addr.use_ext_addr) {
@@ -403,12 +536,17 @@ static void process_ff_sf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 	switch (frame->data[index] & ISOTP_PCI_TYPE_MASK) {
 	case ISOTP_PCI_TYPE_FF:
 		LOG_DBG("Got FF IRQ");
-		if (frame->dlc != ISOTP_CAN_DL) {
+		/* The FF sets RX_DL, which is 8 or a longer CAN-FD length */
+		if (frame_len != ISOTP_CAN_DL &&
+		    !(IS_ENABLED(CONFIG_CAN_FD_MODE) &&
+		      (frame->flags & CAN_FRAME_FDF) != 0 &&
+		      frame_len > ISOTP_CAN_DL)) {
 			LOG_INF("FF DLC invalid. Ignore");
 			return;
 		}
 
-		payload_len = ISOTP_CAN_DL;
+		payload_len = frame_len;
+		ctx->rx_dl = frame_len;
 		ctx->state = ISOTP_RX_STATE_PROCESS_FF;
 		ctx->sn_expected = 1;
 		break;
@@ -417,16 +555,24 @@ static void process_ff_sf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 		LOG_DBG("Got SF IRQ");
 #ifdef CONFIG_ISOTP_REQUIRE_RX_PADDING
 		/* AUTOSAR requirement SWS_CanTp_00345 */
-		if (frame->dlc != ISOTP_CAN_DL) {
+		if (frame_len < ISOTP_CAN_DL) {
 			LOG_INF("SF DLC invalid. Ignore");
 			return;
 		}
 #endif
 
-		payload_len = index + 1 + (frame->data[index] &
-						ISOTP_PCI_SF_DL_MASK);
+		sf_dl = frame->data[index] & ISOTP_PCI_SF_DL_MASK;
+		if (sf_dl == 0 && frame_len > ISOTP_CAN_DL) {
+			/* CAN-FD escape sequence, SF_DL is in the next byte */
+			payload_len = index + 2 + frame->data[index + 1];
+		} else if (sf_dl == 0) {
+			LOG_INF("SF DL invalid. Ignore");
+			return;
+		} else {
+			payload_len = index + 1 + sf_dl;
+		}
 
-		if (payload_len > frame->dlc) {
+		if (payload_len > frame_len) {
 			LOG_INF("SF DL does not fit. Ignore");
 			return;
 		}
@@ -445,7 +591,16 @@ static void process_ff_sf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 static inline void receive_add_mem(struct isotp_recv_ctx *ctx, uint8_t *data,
 				   size_t len)
 {
-	size_t tailroom = net_buf_tailroom(ctx->act_frag);
+	size_t tailroom;
+
+	if (ctx->rx_buf) {
+		/* The message length was checked against the buffer size */
+		memcpy(&ctx->rx_buf[ctx->rx_buf_len], data, len);
+		ctx->rx_buf_len += len;
+		return;
+	}
+
+	tailroom = net_buf_tailroom(ctx->act_frag);
 
 	if (tailroom >= len) {
 		net_buf_add_mem(ctx->act_frag, data, len);
@@ -466,7 +621,8 @@ static inline void receive_add_mem(struct isotp_recv_ctx *ctx, uint8_t *data,
 
 static void process_cf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 {
-	uint32_t *ud_rem_len = (uint32_t *)net_buf_user_data(ctx->buf);
+	uint8_t frame_len = can_dlc_to_bytes(frame->dlc);
+	uint32_t *ud_rem_len;
 	int index = 0;
 	uint32_t data_len;
 
@@ -497,7 +653,7 @@ static void process_cf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 
 #ifdef CONFIG_ISOTP_REQUIRE_RX_PADDING
 	/* AUTOSAR requirement SWS_CanTp_00346 */
-	if (frame->dlc != ISOTP_CAN_DL) {
+	if (frame_len < ISOTP_CAN_DL) {
 		LOG_ERR("CF DL invalid");
 		receive_report_error(ctx, ISOTP_N_ERROR);
 		return;
@@ -505,7 +661,7 @@ static void process_cf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 #endif
 
 	LOG_DBG("Got CF irq. Appending data");
-	data_len = (ctx->length > frame->dlc - index) ? frame->dlc - index :
+	data_len = (ctx->length > frame_len - index) ? frame_len - index :
 		ctx->length;
 	receive_add_mem(ctx, &frame->data[index], data_len);
 	ctx->length -= data_len;
@@ -513,16 +669,26 @@ static void process_cf(struct isotp_recv_ctx *ctx, struct can_frame *frame)
 
 	if (ctx->length == 0) {
 		ctx->state = ISOTP_RX_STATE_RECYCLE;
-		*ud_rem_len = 0;
-		net_buf_put(&ctx->fifo, ctx->buf);
+		if (ctx->rx_buf) {
+			ctx->rx_buf_full = true;
+			k_sem_give(&ctx->rx_buf_sem);
+		} else {
+			ud_rem_len = net_buf_user_data(ctx->buf);
+			*ud_rem_len = 0;
+			net_buf_put(&ctx->fifo, ctx->buf);
+		}
+
 		return;
 	}
 
-	if (ctx->opts.bs && !--ctx->bs) {
+	if (ctx->bs && !--ctx->bs) {
 		LOG_DBG("Block is complete. Allocate new buffer");
-		ctx->bs = ctx->opts.bs;
-		*ud_rem_len = ctx->length;
-		net_buf_put(&ctx->fifo, ctx->buf);
+		if (!ctx->rx_buf) {
+			ud_rem_len = net_buf_user_data(ctx->buf);
+			*ud_rem_len = ctx->length;
+			net_buf_put(&ctx->fifo, ctx->buf);
+		}
+
 		ctx->state = ISOTP_RX_STATE_TRY_ALLOC;
 	}
 }
@@ -571,7 +737,8 @@ static inline int attach_ff_filter(struct isotp_recv_ctx *ctx)
 	}
 
 	struct can_filter filter = {
-		.flags = CAN_FILTER_DATA | ((ctx->rx_addr.ide != 0) ? CAN_FILTER_IDE : 0),
+		.flags = CAN_FILTER_DATA | ((ctx->rx_addr.ide != 0) ? CAN_FILTER_IDE : 0) |
+			 ((ctx->rx_addr.use_fdf != 0) ? CAN_FILTER_FDF : 0),
 		.id = ctx->rx_addr.ext_id,
 		.mask = mask
 	};
@@ -586,11 +753,11 @@ static inline int attach_ff_filter(struct isotp_recv_ctx *ctx)
 	return 0;
 }
 
-int isotp_bind(struct isotp_recv_ctx *ctx, const struct device *can_dev,
-	       const struct isotp_msg_id *rx_addr,
-	       const struct isotp_msg_id *tx_addr,
-	       const struct isotp_fc_opts *opts,
-	       k_timeout_t timeout)
+static int bind(struct isotp_recv_ctx *ctx, const struct device *can_dev,
+		const struct isotp_msg_id *rx_addr,
+		const struct isotp_msg_id *tx_addr,
+		const struct isotp_fc_opts *opts,
+		uint8_t *buf, size_t size, k_timeout_t timeout)
 {
 	int ret;
 
@@ -611,6 +778,13 @@ int isotp_bind(struct isotp_recv_ctx *ctx, const struct device *can_dev,
 	ctx->opts = *opts;
 	ctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
 
+	ctx->rx_buf = buf;
+	ctx->rx_buf_size = size;
+	ctx->rx_buf_len = 0;
+	ctx->rx_buf_full = false;
+	ctx->rx_buf_held = false;
+	k_sem_init(&ctx->rx_buf_sem, 0, K_SEM_MAX_LIMIT);
+
 	LOG_DBG("Binding to addr: 0x%x. Responding on 0x%x",
 		ctx->rx_addr.ext_id, ctx->tx_addr.ext_id);
 
@@ -634,6 +808,26 @@ int isotp_bind(struct isotp_recv_ctx *ctx, const struct device *can_dev,
 	return ISOTP_N_OK;
 }
 
+int isotp_bind(struct isotp_recv_ctx *ctx, const struct device *can_dev,
+	       const struct isotp_msg_id *rx_addr,
+	       const struct isotp_msg_id *tx_addr,
+	       const struct isotp_fc_opts *opts,
+	       k_timeout_t timeout)
+{
+	return bind(ctx, can_dev, rx_addr, tx_addr, opts, NULL, 0, timeout);
+}
+
+int isotp_bind_buf(struct isotp_recv_ctx *ctx, const struct device *can_dev,
+		   const struct isotp_msg_id *rx_addr,
+		   const struct isotp_msg_id *tx_addr,
+		   const struct isotp_fc_opts *opts,
+		   uint8_t *buf, size_t size, k_timeout_t timeout)
+{
+	__ASSERT(buf && size, "Reassembly buffer is empty");
+
+	return bind(ctx, can_dev, rx_addr, tx_addr, opts, buf, size, timeout);
+}
+
 void isotp_unbind(struct isotp_recv_ctx *ctx)
 {
 	struct net_buf *buf;
@@ -657,6 +851,12 @@ void isotp_unbind(struct isotp_recv_ctx *ctx)
 
 	k_fifo_cancel_wait(&ctx->fifo);
 
+	if (ctx->rx_buf) {
+		ctx->rx_buf_full = false;
+		ctx->rx_buf_held = false;
+		k_sem_give(&ctx->rx_buf_sem);
+	}
+
 	if (ctx->buf) {
 		net_buf_unref(ctx->buf);
 	}
@@ -664,6 +864,35 @@ void isotp_unbind(struct isotp_recv_ctx *ctx)
 	LOG_DBG("Unbound");
 }
 
+int isotp_recv_buf(struct isotp_recv_ctx *ctx, k_timeout_t timeout)
+{
+	int err;
+
+	__ASSERT(ctx->rx_buf, "Context is not bound with isotp_bind_buf");
+
+	if (ctx->rx_buf_held) {
+		/* The application is done with the last message */
+		ctx->rx_buf_held = false;
+		ctx->rx_buf_full = false;
+		k_work_submit(&ctx->work);
+	}
+
+	if (k_sem_take(&ctx->rx_buf_sem, timeout) != 0) {
+		return ISOTP_RECV_TIMEOUT;
+	}
+
+	if (!ctx->rx_buf_full) {
+		err = ctx->error_nr ? ctx->error_nr : ISOTP_RECV_TIMEOUT;
+		ctx->error_nr = 0;
+
+		return err;
+	}
+
+	ctx->rx_buf_held = true;
+
+	return ctx->rx_buf_len;
+}
+
 int isotp_recv_net(struct isotp_recv_ctx *ctx, struct net_buf **buffer,
 		   k_timeout_t timeout)
 {
@@ -777,7 +1006,7 @@ static void send_process_fc(struct isotp_send_ctx *ctx,
 
 #ifdef CONFIG_ISOTP_REQUIRE_RX_PADDING
 	/* AUTOSAR requirement SWS_CanTp_00349 */
-	if (frame->dlc != ISOTP_CAN_DL) {
+	if (can_dlc_to_bytes(frame->dlc) < ISOTP_CAN_DL) {
 		LOG_ERR("FC DL invalid. Ignore");
 		send_report_error(ctx, ISOTP_N_ERROR);
 		return;
@@ -789,7 +1018,8 @@ static void send_process_fc(struct isotp_send_ctx *ctx,
 		ctx->state = ISOTP_TX_SEND_CF;
 		ctx->wft = 0;
 		ctx->tx_backlog = 0;
-		k_sem_reset(&ctx->tx_sem);
+		k_sem_init(&ctx->tx_sem, CONFIG_ISOTP_TX_CF_QUEUE_DEPTH - 1,
+			   CONFIG_ISOTP_TX_CF_QUEUE_DEPTH);
 		ctx->opts.bs = *data++;
 		ctx->opts.stmin = *data++;
 		ctx->bs = ctx->opts.bs;
@@ -864,7 +1094,7 @@ static void pull_data_ctx(struct isotp_send_ctx *ctx, size_t len)
 static inline int send_sf(struct isotp_send_ctx *ctx)
 {
 	struct can_frame frame = {
-		.flags = ctx->tx_addr.ide != 0 ? CAN_FRAME_IDE : 0,
+		.flags = get_frame_flags(&ctx->tx_addr),
 		.id = ctx->tx_addr.ext_id
 	};
 	size_t len = get_ctx_data_length(ctx);
@@ -879,18 +1109,17 @@ static inline int send_sf(struct isotp_send_ctx *ctx)
 		frame.data[index++] = ctx->tx_addr.ext_addr;
 	}
 
-	frame.data[index++] = ISOTP_PCI_TYPE_SF | len;
+	if (len < ISOTP_CAN_DL - index) {
+		frame.data[index++] = ISOTP_PCI_TYPE_SF | len;
+	} else {
+		/* CAN-FD escape sequence, SF_DL is in the next byte */
+		frame.data[index++] = ISOTP_PCI_TYPE_SF;
+		frame.data[index++] = len;
+	}
 
-	__ASSERT_NO_MSG(len <= ISOTP_CAN_DL - index);
+	__ASSERT_NO_MSG(len <= get_tx_dl(&ctx->tx_addr) - index);
 	memcpy(&frame.data[index], data, len);
-
-#ifdef CONFIG_ISOTP_ENABLE_TX_PADDING
-	/* AUTOSAR requirement SWS_CanTp_00348 */
-	memset(&frame.data[index + len], 0xCC, ISOTP_CAN_DL - len - index);
-	frame.dlc = ISOTP_CAN_DL;
-#else
-	frame.dlc = len + index;
-#endif
+	set_frame_len(&frame, index + len);
 
 	ctx->state = ISOTP_TX_SEND_SF;
 	ret = can_send(ctx->can_dev, &frame, K_MSEC(ISOTP_A),
@@ -900,10 +1129,11 @@ static inline int send_sf(struct isotp_send_ctx *ctx)
 
 static inline int send_ff(struct isotp_send_ctx *ctx)
 {
+	uint8_t tx_dl = get_tx_dl(&ctx->tx_addr);
 	struct can_frame frame = {
-		.flags = ctx->tx_addr.ide != 0 ? CAN_FRAME_IDE : 0,
+		.flags = get_frame_flags(&ctx->tx_addr),
 		.id = ctx->tx_addr.ext_id,
-		.dlc = ISOTP_CAN_DL
+		.dlc = can_bytes_to_dlc(tx_dl)
 	};
 	int index = 0;
 	size_t len = get_ctx_data_length(ctx);
@@ -931,8 +1161,8 @@ static inline int send_ff(struct isotp_send_ctx *ctx)
 	 */
 	ctx->sn = 1;
 	data = get_data_ctx(ctx);
-	pull_data_ctx(ctx, ISOTP_CAN_DL - index);
-	memcpy(&frame.data[index], data, ISOTP_CAN_DL - index);
+	pull_data_ctx(ctx, tx_dl - index);
+	memcpy(&frame.data[index], data, tx_dl - index);
 
 	ret = can_send(ctx->can_dev, &frame, K_MSEC(ISOTP_A),
 		       send_can_tx_cb, ctx);
@@ -942,7 +1172,7 @@ static inline int send_ff(struct isotp_send_ctx *ctx)
 static inline int send_cf(struct isotp_send_ctx *ctx)
 {
 	struct can_frame frame = {
-		.flags = ctx->tx_addr.ide != 0 ? CAN_FRAME_IDE : 0,
+		.flags = get_frame_flags(&ctx->tx_addr),
 		.id = ctx->tx_addr.ext_id,
 	};
 	int index = 0;
@@ -959,18 +1189,11 @@ static inline int send_cf(struct isotp_send_ctx *ctx)
 	frame.data[index++] = ISOTP_PCI_TYPE_CF | ctx->sn;
 
 	rem_len = get_ctx_data_length(ctx);
-	len = MIN(rem_len, ISOTP_CAN_DL - index);
+	len = MIN(rem_len, get_tx_dl(&ctx->tx_addr) - index);
 	rem_len -= len;
 	data = get_data_ctx(ctx);
 	memcpy(&frame.data[index], data, len);
-
-#ifdef CONFIG_ISOTP_ENABLE_TX_PADDING
-	/* AUTOSAR requirement SWS_CanTp_00348 */
-	memset(&frame.data[index + len], 0xCC, ISOTP_CAN_DL - len - index);
-	frame.dlc = ISOTP_CAN_DL;
-#else
-	frame.dlc = len + index;
-#endif
+	set_frame_len(&frame, index + len);
 
 	ret = can_send(ctx->can_dev, &frame, K_MSEC(ISOTP_A),
 		       send_can_tx_cb, ctx);
@@ -1074,7 +1297,11 @@ static void send_state_machine(struct isotp_send_ctx *ctx)
 				break;
 			}
 
-			/* Ensure FIFO style transmission of CF */
+			/*
+			 * Ensure FIFO style transmission of CF, with up to
+			 * CONFIG_ISOTP_TX_CF_QUEUE_DEPTH CFs queued in the CAN
+			 * controller.
+			 */
 			k_sem_take(&ctx->tx_sem, K_FOREVER);
 		} while (ret > 0);
 
@@ -1126,7 +1353,8 @@ static void send_work_handler(struct k_work *item)
 static inline int attach_fc_filter(struct isotp_send_ctx *ctx)
 {
 	struct can_filter filter = {
-		.flags = CAN_FILTER_DATA | ((ctx->rx_addr.ide != 0) ? CAN_FILTER_IDE : 0),
+		.flags = CAN_FILTER_DATA | ((ctx->rx_addr.ide != 0) ? CAN_FILTER_IDE : 0) |
+			 ((ctx->rx_addr.use_fdf != 0) ? CAN_FILTER_FDF : 0),
 		.id = ctx->rx_addr.ext_id,
 		.mask = CAN_EXT_ID_MASK
 	};
@@ -1146,12 +1374,16 @@ static int send(struct isotp_send_ctx *ctx, const struct device *can_dev,
 		const struct isotp_msg_id *rx_addr,
 		isotp_tx_callback_t complete_cb, void *cb_arg)
 {
+	uint8_t tx_dl = get_tx_dl(tx_addr);
+	size_t sf_dl_max;
 	size_t len;
 	int ret;
 
 	__ASSERT_NO_MSG(ctx);
 	__ASSERT_NO_MSG(can_dev);
 	__ASSERT_NO_MSG(rx_addr && tx_addr);
+	__ASSERT(can_dlc_to_bytes(can_bytes_to_dlc(tx_dl)) == tx_dl,
+		 "Invalid CAN data length");
 
 	if (complete_cb) {
 		ctx->fin_cb.cb = complete_cb;
@@ -1162,7 +1394,8 @@ static int send(struct isotp_send_ctx *ctx, const struct device *can_dev,
 		ctx->has_callback = 0;
 	}
 
-	k_sem_init(&ctx->tx_sem, 0, 1);
+	k_sem_init(&ctx->tx_sem, CONFIG_ISOTP_TX_CF_QUEUE_DEPTH - 1,
+		   CONFIG_ISOTP_TX_CF_QUEUE_DEPTH);
 	ctx->can_dev = can_dev;
 	ctx->tx_addr = *tx_addr;
 	ctx->rx_addr = *rx_addr;
@@ -1174,7 +1407,10 @@ static int send(struct isotp_send_ctx *ctx, const struct device *can_dev,
 	len = get_ctx_data_length(ctx);
 	LOG_DBG("Send %zu bytes to addr 0x%x and listen on 0x%x", len,
 		ctx->tx_addr.ext_id, ctx->rx_addr.ext_id);
-	if (len > ISOTP_CAN_DL - (tx_addr->use_ext_addr ? 2 : 1)) {
+	/* SFs longer than a classic frame need the CAN-FD escape sequence */
+	sf_dl_max = tx_dl - (tx_dl > ISOTP_CAN_DL ? 2 : 1) -
+		    (tx_addr->use_ext_addr ? 1 : 0);
+	if (len > sf_dl_max) {
 		ret = attach_fc_filter(ctx);
 		if (ret) {
 			LOG_ERR("Can't attach fc filter: %d", ret);
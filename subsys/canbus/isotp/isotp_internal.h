@@ -28,13 +28,15 @@
  * PCI     Process Control Information
  */
 
-/* This is for future use when we have CAN-FD */
-#ifdef ISOTP_USE_CAN_FD
-/* #define ISOTP_CAN_DL CONFIG_ISOTP_TX_DL* */
+/* CAN_DL of classic CAN, the minimum for FF and padded frames */
 #define ISOTP_CAN_DL 8
+
+/* Largest CAN_DL, frames up to 64 bytes need CAN-FD */
+#ifdef CONFIG_CAN_FD_MODE
+#define ISOTP_CAN_DL_MAX 64
 #else
-#define ISOTP_CAN_DL 8
-#endif/*ISOTP_USE_CAN_FD*/
+#define ISOTP_CAN_DL_MAX ISOTP_CAN_DL
+#endif
 
 /* Protocol control information*/
 #define ISOTP_PCI_SF 0x00 /* Single frame*/
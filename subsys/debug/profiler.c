@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/debug/profiler.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <kernel_internal.h>
+
+/* Samples are stored as ring buffer items whose value is the number of
+ * frames and whose data are the thread followed by the frames.
+ */
+#define SAMPLE_WORDS(n) (((n) + 1) * sizeof(uintptr_t) / sizeof(uint32_t))
+
+RING_BUF_ITEM_DECLARE(samples, CONFIG_PROFILER_SAMPLING_BUFFER_SIZE / sizeof(uint32_t));
+
+static struct k_spinlock lock;
+static uint32_t dropped;
+
+static void sample(struct k_timer *timer)
+{
+	uintptr_t data[1 + PROFILER_SAMPLE_FRAMES];
+	k_spinlock_key_t key;
+	size_t n;
+
+	ARG_UNUSED(timer);
+
+	/* The timer expires in the system timer interrupt, which preempted
+	 * the current thread unless it preempted another interrupt.
+	 */
+	data[0] = (uintptr_t)_current;
+	n = arch_profiler_sample(&data[1], PROFILER_SAMPLE_FRAMES);
+
+	key = k_spin_lock(&lock);
+	if (ring_buf_item_put(&samples, 0, n, (uint32_t *)data, SAMPLE_WORDS(n)) != 0) {
+		dropped++;
+	}
+	k_spin_unlock(&lock, key);
+}
+
+static K_TIMER_DEFINE(timer, sample, NULL);
+
+int profiler_start(uint32_t rate_hz)
+{
+	k_timeout_t period;
+
+	if ((rate_hz == 0) || (rate_hz > CONFIG_SYS_CLOCK_TICKS_PER_SEC)) {
+		return -EINVAL;
+	}
+
+	period = K_TICKS(CONFIG_SYS_CLOCK_TICKS_PER_SEC / rate_hz);
+	k_timer_start(&timer, period, period);
+
+	return 0;
+}
+
+void profiler_stop(void)
+{
+	k_timer_stop(&timer);
+}
+
+int profiler_sample_get(struct profiler_sample *sample)
+{
+	uintptr_t data[1 + PROFILER_SAMPLE_FRAMES];
+	k_spinlock_key_t key;
+	uint16_t type;
+	uint8_t size32 = ARRAY_SIZE(data) * sizeof(uintptr_t) / sizeof(uint32_t);
+	uint8_t n;
+	int err;
+
+	key = k_spin_lock(&lock);
+	err = ring_buf_item_get(&samples, &type, &n, (uint32_t *)data, &size32);
+	k_spin_unlock(&lock, key);
+
+	if (err != 0) {
+		return -EAGAIN;
+	}
+
+	sample->thread = (k_tid_t)data[0];
+	sample->num_frames = n;
+	memcpy(sample->frames, &data[1], n * sizeof(uintptr_t));
+
+	return 0;
+}
+
+uint32_t profiler_dropped_get(void)
+{
+	return dropped;
+}
+
+void profiler_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ring_buf_reset(&samples);
+	dropped = 0;
+	k_spin_unlock(&lock, key);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/debug/profiler.h>
+#include <zephyr/shell/shell.h>
+
+static int cmd_start(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t rate = strtoul(argv[1], NULL, 10);
+	int err;
+
+	ARG_UNUSED(argc);
+
+	err = profiler_start(rate);
+	if (err != 0) {
+		shell_error(sh, "Invalid rate: %s", argv[1]);
+		return err;
+	}
+
+	return 0;
+}
+
+static int cmd_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	profiler_stop();
+
+	return 0;
+}
+
+#ifdef CONFIG_THREAD_MONITOR
+static void thread_print(const struct k_thread *thread, void *user_data)
+{
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	shell_print((const struct shell *)user_data, "T %" PRIxPTR " %s",
+		    (uintptr_t)thread, (name != NULL) ? name : "");
+}
+#endif
+
+/* Prints a line per sample, "S <thread> <pc> <return addresses>", the
+ * address is missing when the sample hit an interrupt. They are followed by
+ * a line per thread, "T <thread> <name>", and the number of dropped samples,
+ * "D <count>", for scripts/profiler/fold_samples.py.
+ */
+static int cmd_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	struct profiler_sample sample;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	while (profiler_sample_get(&sample) == 0) {
+		shell_fprintf(sh, SHELL_NORMAL, "S %" PRIxPTR, (uintptr_t)sample.thread);
+		for (size_t i = 0; i < sample.num_frames; i++) {
+			shell_fprintf(sh, SHELL_NORMAL, " %" PRIxPTR, sample.frames[i]);
+		}
+		shell_fprintf(sh, SHELL_NORMAL, "\n");
+	}
+
+#ifdef CONFIG_THREAD_MONITOR
+	k_thread_foreach(thread_print, (void *)sh);
+#endif
+
+	shell_print(sh, "D %u", profiler_dropped_get());
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	profiler_reset();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_profiler,
+	SHELL_CMD_ARG(start, NULL, "<rate_hz>", cmd_start, 2, 0),
+	SHELL_CMD(stop, NULL, "Stop sampling.", cmd_stop),
+	SHELL_CMD(dump, NULL, "Print and remove the samples.", cmd_dump),
+	SHELL_CMD(reset, NULL, "Discard the samples.", cmd_reset),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+
+SHELL_CMD_REGISTER(profiler, &sub_profiler, "Sampling profiler commands", NULL);
@@ -94,7 +94,11 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 		snprintk(hexname, sizeof(hexname), "%p", (void *)thread);
 	}
 
+#ifdef CONFIG_THREAD_ANALYZER_STACK_WATERMARK
+	err = k_thread_stack_watermark_get(thread, &unused);
+#else
 	err = k_thread_stack_space_get(thread, &unused);
+#endif
 	if (err) {
 		THREAD_ANALYZER_PRINT(
 			THREAD_ANALYZER_FMT(
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* The page frames form a circle swept by a hand. A page frame whose page was
+ * accessed since the hand last passed gets a second chance: its accessed
+ * state is cleared and the hand moves on. The first page frame found not
+ * accessed is evicted, it approximates the least recently used one.
+ *
+ * Clean pages are cheaper to evict, so on the first turn a not accessed
+ * dirty page is only remembered and the sweep goes on, looking for a clean
+ * one. After a full turn every accessed state was cleared, so the sweep
+ * ends by the second turn at the latest.
+ */
+static size_t hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *dirty_pf = NULL;
+	uintptr_t flags;
+
+	for (size_t i = 0; i < 2 * Z_NUM_PAGE_FRAMES; i++) {
+		struct z_page_frame *pf = &z_page_frames[hand];
+
+		hand = (hand + 1) % Z_NUM_PAGE_FRAMES;
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Clears the accessed state while getting it */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			continue;
+		}
+
+		if ((flags & ARCH_DATA_PAGE_DIRTY) == 0UL) {
+			*dirty_ptr = false;
+			return pf;
+		}
+
+		if (dirty_pf == NULL) {
+			dirty_pf = pf;
+		} else if (dirty_pf == pf) {
+			/* A full turn without a clean page */
+			break;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(dirty_pf != NULL, "no page to evict");
+
+	*dirty_ptr = true;
+
+	return dirty_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
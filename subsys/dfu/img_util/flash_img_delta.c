@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/dfu/flash_img_delta.h>
+#include <zephyr/storage/flash_map.h>
+
+/* Size of the buffer holding reconstructed diff bytes before they are written */
+#define DIFF_CHUNK_SIZE 64
+
+enum delta_state {
+	DELTA_MAGIC,
+	DELTA_TARGET_SIZE,
+	DELTA_DIFF_LEN,
+	DELTA_EXTRA_LEN,
+	DELTA_DIFF,
+	DELTA_DIFF_RUN,
+	DELTA_EXTRA,
+	DELTA_ADJUST,
+	DELTA_DONE,
+};
+
+/*
+ * Adds a byte to the LEB128 number being parsed, returns 1 once the number
+ * is complete, 0 if more bytes are needed.
+ */
+static int num_parse(struct flash_img_delta_context *ctx, uint8_t byte, uint64_t *val)
+{
+	ctx->num |= (uint64_t)(byte & 0x7f) << ctx->num_shift;
+
+	if ((byte & 0x80) != 0) {
+		ctx->num_shift += 7;
+
+		return (ctx->num_shift > 63) ? -EINVAL : 0;
+	}
+
+	*val = ctx->num;
+	ctx->num = 0;
+	ctx->num_shift = 0;
+
+	return 1;
+}
+
+/* Makes the source image at the source offset available in the buffer */
+static int src_load(struct flash_img_delta_context *ctx)
+{
+	size_t len;
+	int rc;
+
+	if (ctx->src_off >= ctx->src_buf_off &&
+	    ctx->src_off < ctx->src_buf_off + ctx->src_buf_len) {
+		return 0;
+	}
+
+	if (ctx->src_off >= ctx->src->fa_size) {
+		return -EINVAL;
+	}
+
+	len = MIN(sizeof(ctx->src_buf), ctx->src->fa_size - ctx->src_off);
+	rc = flash_area_read(ctx->src, ctx->src_off, ctx->src_buf, len);
+	if (rc != 0) {
+		ctx->src_buf_len = 0;
+		return rc;
+	}
+
+	ctx->src_buf_off = ctx->src_off;
+	ctx->src_buf_len = len;
+
+	return 0;
+}
+
+/*
+ * Outputs diff bytes added to the source image, a NULL @p data stands for
+ * zero diff bytes. Returns the number of diff bytes processed.
+ */
+static int diff_apply(struct flash_img_delta_context *ctx, const uint8_t *data, size_t len)
+{
+	uint8_t out[DIFF_CHUNK_SIZE];
+	const uint8_t *src;
+	size_t n;
+	int rc;
+
+	rc = src_load(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+
+	src = &ctx->src_buf[ctx->src_off - ctx->src_buf_off];
+	n = MIN(MIN(len, ctx->block_left), sizeof(out));
+	n = MIN(n, ctx->src_buf_off + ctx->src_buf_len - ctx->src_off);
+
+	if (data == NULL) {
+		memcpy(out, src, n);
+	} else {
+		for (size_t i = 0; i < n; i++) {
+			out[i] = data[i] + src[i];
+		}
+	}
+
+	rc = flash_img_buffered_write(ctx->img, out, n, false);
+	if (rc != 0) {
+		return rc;
+	}
+
+	ctx->src_off += n;
+	ctx->block_left -= n;
+	ctx->written += n;
+
+	return n;
+}
+
+/* Copies a run of source bytes matched by zero diff bytes */
+static int diff_run_apply(struct flash_img_delta_context *ctx, uint64_t run)
+{
+	int rc;
+
+	if (run >= ctx->block_left) {
+		return -EINVAL;
+	}
+
+	/* The zero byte which started the run is part of it */
+	run++;
+
+	while (run > 0) {
+		rc = diff_apply(ctx, NULL, run);
+		if (rc < 0) {
+			return rc;
+		}
+
+		run -= rc;
+	}
+
+	ctx->state = DELTA_DIFF;
+
+	return 0;
+}
+
+/* Handles a complete number of the patch */
+static int num_handle(struct flash_img_delta_context *ctx, uint64_t val)
+{
+	int64_t adjust;
+
+	switch (ctx->state) {
+	case DELTA_TARGET_SIZE:
+		if (val > ctx->img->flash_area->fa_size) {
+			return -EINVAL;
+		}
+
+		ctx->target_size = val;
+		ctx->state = (ctx->target_size == 0) ? DELTA_DONE : DELTA_DIFF_LEN;
+		break;
+
+	case DELTA_DIFF_LEN:
+		if (val > ctx->target_size - ctx->written) {
+			return -EINVAL;
+		}
+
+		ctx->block_left = val;
+		ctx->state = DELTA_EXTRA_LEN;
+		break;
+
+	case DELTA_EXTRA_LEN:
+		if (val > ctx->target_size - ctx->written - ctx->block_left) {
+			return -EINVAL;
+		}
+
+		ctx->extra_len = val;
+		ctx->state = DELTA_DIFF;
+		break;
+
+	case DELTA_ADJUST:
+		/* Zigzag encoding */
+		adjust = (int64_t)(val >> 1) ^ -(int64_t)(val & 1);
+
+		if ((adjust < 0 && (uint64_t)-adjust > ctx->src_off) ||
+		    (adjust > 0 && (uint64_t)adjust > ctx->src->fa_size - ctx->src_off)) {
+			return -EINVAL;
+		}
+
+		ctx->src_off += adjust;
+		ctx->state = (ctx->written == ctx->target_size) ? DELTA_DONE : DELTA_DIFF_LEN;
+		break;
+
+	case DELTA_DIFF_RUN:
+		return diff_run_apply(ctx, val);
+
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+int flash_img_delta_write(struct flash_img_delta_context *ctx,
+			  const uint8_t *data, size_t len, bool flush)
+{
+	const uint8_t *zero;
+	uint64_t val;
+	size_t n;
+	int rc;
+
+	while (len > 0) {
+		switch (ctx->state) {
+		case DELTA_MAGIC:
+			if (*data != FLASH_IMG_DELTA_MAGIC[ctx->block_left]) {
+				return -EINVAL;
+			}
+
+			data++;
+			len--;
+
+			if (++ctx->block_left == FLASH_IMG_DELTA_MAGIC_LEN) {
+				ctx->block_left = 0;
+				ctx->state = DELTA_TARGET_SIZE;
+			}
+			break;
+
+		case DELTA_TARGET_SIZE:
+		case DELTA_DIFF_LEN:
+		case DELTA_EXTRA_LEN:
+		case DELTA_DIFF_RUN:
+		case DELTA_ADJUST:
+			rc = num_parse(ctx, *data, &val);
+			data++;
+			len--;
+
+			if (rc > 0) {
+				rc = num_handle(ctx, val);
+			}
+
+			if (rc < 0) {
+				return rc;
+			}
+			break;
+
+		case DELTA_DIFF:
+			if (ctx->block_left == 0) {
+				ctx->block_left = ctx->extra_len;
+				ctx->state = DELTA_EXTRA;
+				break;
+			}
+
+			if (*data == 0U) {
+				/* Run of zero diff bytes */
+				ctx->state = DELTA_DIFF_RUN;
+				data++;
+				len--;
+				break;
+			}
+
+			/* Diff bytes up to the next run */
+			n = MIN(len, ctx->block_left);
+			zero = memchr(data, 0, n);
+			rc = diff_apply(ctx, data, (zero != NULL) ? (size_t)(zero - data) : n);
+			if (rc < 0) {
+				return rc;
+			}
+
+			data += rc;
+			len -= rc;
+			break;
+
+		case DELTA_EXTRA:
+			if (ctx->block_left == 0) {
+				ctx->state = DELTA_ADJUST;
+				break;
+			}
+
+			rc = MIN(len, ctx->block_left);
+
+			if (flash_img_buffered_write(ctx->img, data, rc, false) != 0) {
+				return -EIO;
+			}
+
+			ctx->block_left -= rc;
+			ctx->written += rc;
+			data += rc;
+			len -= rc;
+			break;
+
+		default:
+			/* Data past the end of the patch */
+			return -EINVAL;
+		}
+	}
+
+	if (!flush) {
+		return 0;
+	}
+
+	if (ctx->state != DELTA_DONE) {
+		return -EINVAL;
+	}
+
+	flash_area_close(ctx->src);
+
+	/* data may be NULL when only flushing */
+	return flash_img_buffered_write(ctx->img, ctx->src_buf, 0, true);
+}
+
+int flash_img_delta_target_size(const uint8_t *data, size_t len, size_t *size)
+{
+	uint64_t val = 0;
+
+	if (len < FLASH_IMG_DELTA_MAGIC_LEN ||
+	    memcmp(data, FLASH_IMG_DELTA_MAGIC, FLASH_IMG_DELTA_MAGIC_LEN) != 0) {
+		return -EINVAL;
+	}
+
+	for (size_t i = FLASH_IMG_DELTA_MAGIC_LEN, shift = 0; i < len && shift < 64;
+	     i++, shift += 7) {
+		val |= (uint64_t)(data[i] & 0x7f) << shift;
+
+		if ((data[i] & 0x80) == 0) {
+			if (val > SIZE_MAX) {
+				return -EINVAL;
+			}
+
+			*size = val;
+			return 0;
+		}
+	}
+
+	return -EINVAL;
+}
+
+int flash_img_delta_init(struct flash_img_delta_context *ctx,
+			 struct flash_img_context *img, uint8_t src_area_id)
+{
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->img = img;
+
+	return flash_area_open(src_area_id, &ctx->src);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/dsp/pipeline.h>
+
+void zdsp_stage_init(struct zdsp_stage *stage, const char *name,
+		     zdsp_stage_process_t process, uint32_t flags)
+{
+	stage->process = process;
+	stage->name = name;
+	stage->flags = flags;
+#ifdef CONFIG_DSP_PIPELINE_STATS
+	zdsp_stage_stats_reset(stage);
+#endif
+}
+
+void zdsp_pipeline_init(struct zdsp_pipeline *pipeline, q15_t *scratch,
+			size_t scratch_len)
+{
+	sys_slist_init(&pipeline->stages);
+	pipeline->scratch = scratch;
+	pipeline->scratch_len = scratch_len;
+}
+
+void zdsp_pipeline_add(struct zdsp_pipeline *pipeline, struct zdsp_stage *stage)
+{
+	sys_slist_append(&pipeline->stages, &stage->node);
+}
+
+static int stage_run(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+#ifdef CONFIG_DSP_PIPELINE_STATS
+	size_t in_len = *len;
+	uint32_t start = k_cycle_get_32();
+	uint32_t cycles;
+	int ret;
+
+	ret = stage->process(stage, in, out, len);
+
+	cycles = k_cycle_get_32() - start;
+	stage->stats.blocks++;
+	stage->stats.samples += in_len;
+	stage->stats.cycles += cycles;
+	stage->stats.max_cycles = MAX(stage->stats.max_cycles, cycles);
+
+	return ret;
+#else
+	return stage->process(stage, in, out, len);
+#endif
+}
+
+int zdsp_pipeline_process(struct zdsp_pipeline *pipeline, q15_t *data, size_t *len,
+			  q15_t **out)
+{
+	struct zdsp_stage *stage;
+	q15_t *cur = data;
+	q15_t *next;
+	size_t tap_len;
+	int ret;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&pipeline->stages, stage, node) {
+		if ((stage->flags & ZDSP_STAGE_TAP) != 0U) {
+			tap_len = *len;
+			ret = stage_run(stage, cur, NULL, &tap_len);
+		} else if ((stage->flags & ZDSP_STAGE_IN_PLACE) != 0U) {
+			ret = stage_run(stage, cur, cur, len);
+		} else {
+			/* Ping-pong between the block and the scratch buffer */
+			if (cur == data) {
+				if (*len > pipeline->scratch_len) {
+					return -ENOMEM;
+				}
+				next = pipeline->scratch;
+			} else {
+				next = data;
+			}
+
+			ret = stage_run(stage, cur, next, len);
+			cur = next;
+		}
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	*out = cur;
+
+	return 0;
+}
+
+#ifdef CONFIG_DSP_PIPELINE_STATS
+void zdsp_stage_stats_get(const struct zdsp_stage *stage, struct zdsp_stage_stats *stats)
+{
+	*stats = stage->stats;
+}
+
+void zdsp_stage_stats_reset(struct zdsp_stage *stage)
+{
+	memset(&stage->stats, 0, sizeof(stage->stats));
+}
+#endif /* CONFIG_DSP_PIPELINE_STATS */
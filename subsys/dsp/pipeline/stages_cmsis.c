@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/dsp/pipeline.h>
+
+static int fir_process(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+	struct zdsp_fir_q15 *fir = CONTAINER_OF(stage, struct zdsp_fir_q15, stage);
+
+	if (*len > fir->block_size) {
+		return -EINVAL;
+	}
+
+	arm_fir_q15(&fir->inst, in, out, *len);
+
+	return 0;
+}
+
+int zdsp_fir_q15_init(struct zdsp_fir_q15 *fir, const q15_t *coeffs, uint16_t num_taps,
+		      q15_t *state, uint32_t block_size)
+{
+	if (arm_fir_init_q15(&fir->inst, num_taps, coeffs, state, block_size) !=
+	    ARM_MATH_SUCCESS) {
+		return -EINVAL;
+	}
+
+	fir->block_size = block_size;
+	zdsp_stage_init(&fir->stage, "fir", fir_process, 0);
+
+	return 0;
+}
+
+static int biquad_process(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+	struct zdsp_biquad_q15 *biquad = CONTAINER_OF(stage, struct zdsp_biquad_q15, stage);
+
+	arm_biquad_cascade_df1_q15(&biquad->inst, in, out, *len);
+
+	return 0;
+}
+
+void zdsp_biquad_q15_init(struct zdsp_biquad_q15 *biquad, uint8_t num_stages,
+			  const q15_t *coeffs, q15_t *state, int8_t post_shift)
+{
+	arm_biquad_cascade_df1_init_q15(&biquad->inst, num_stages, coeffs, state, post_shift);
+	zdsp_stage_init(&biquad->stage, "biquad", biquad_process, ZDSP_STAGE_IN_PLACE);
+}
+
+static int decimate_process(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+	struct zdsp_decimate_q15 *decimate =
+		CONTAINER_OF(stage, struct zdsp_decimate_q15, stage);
+
+	if (*len > decimate->block_size || (*len % decimate->inst.M) != 0U) {
+		return -EINVAL;
+	}
+
+	arm_fir_decimate_q15(&decimate->inst, in, out, *len);
+	*len /= decimate->inst.M;
+
+	return 0;
+}
+
+int zdsp_decimate_q15_init(struct zdsp_decimate_q15 *decimate, const q15_t *coeffs,
+			   uint16_t num_taps, uint8_t factor, q15_t *state,
+			   uint32_t block_size)
+{
+	if (arm_fir_decimate_init_q15(&decimate->inst, num_taps, factor, coeffs, state,
+				      block_size) != ARM_MATH_SUCCESS) {
+		return -EINVAL;
+	}
+
+	decimate->block_size = block_size;
+	zdsp_stage_init(&decimate->stage, "decimate", decimate_process, 0);
+
+	return 0;
+}
+
+static int rms_process(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+	struct zdsp_rms_q15 *rms = CONTAINER_OF(stage, struct zdsp_rms_q15, stage);
+
+	ARG_UNUSED(out);
+
+	if (*len > 0) {
+		arm_rms_q15(in, *len, &rms->rms);
+	}
+
+	return 0;
+}
+
+void zdsp_rms_q15_init(struct zdsp_rms_q15 *rms)
+{
+	rms->rms = 0;
+	zdsp_stage_init(&rms->stage, "rms", rms_process, ZDSP_STAGE_TAP);
+}
+
+static int fft_process(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+	struct zdsp_fft_q15 *fft = CONTAINER_OF(stage, struct zdsp_fft_q15, stage);
+
+	if (*len != fft->fft_len) {
+		return -EINVAL;
+	}
+
+	/* The complex spectrum goes to the stage buffer, the magnitudes back over the input */
+	arm_rfft_q15(&fft->inst, in, fft->buf);
+	arm_cmplx_mag_q15(fft->buf, out, fft->fft_len / 2);
+	*len = fft->fft_len / 2;
+
+	return 0;
+}
+
+int zdsp_fft_q15_init(struct zdsp_fft_q15 *fft, uint32_t fft_len, q15_t *buf)
+{
+	if (arm_rfft_init_q15(&fft->inst, fft_len, 0, 1) != ARM_MATH_SUCCESS) {
+		return -EINVAL;
+	}
+
+	fft->buf = buf;
+	fft->fft_len = fft_len;
+	zdsp_stage_init(&fft->stage, "fft", fft_process, ZDSP_STAGE_IN_PLACE);
+
+	return 0;
+}
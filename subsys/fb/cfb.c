@@ -23,6 +23,14 @@ static inline uint8_t byte_reverse(uint8_t b)
 	return b;
 }
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+/* Columns of a tile row changed since the last finalize, clean if x0 > x1 */
+struct cfb_dirty_span {
+	uint16_t x0;
+	uint16_t x1;
+};
+#endif
+
 struct char_framebuffer {
 	/** Pointer to a buffer in RAM */
 	uint8_t *buf;
@@ -59,10 +67,60 @@ struct char_framebuffer {
 
 	/** Inverted */
 	bool inverted;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+	/** Dirty columns of each tile row */
+	struct cfb_dirty_span *dirty;
+#endif
 };
 
 static struct char_framebuffer char_fb;
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+static void mark_dirty(const struct char_framebuffer *fb, int32_t x0, int32_t y0,
+		       int32_t x1, int32_t y1)
+{
+	x0 = MAX(x0, 0);
+	y0 = MAX(y0, 0);
+	x1 = MIN(x1, fb->x_res - 1);
+	y1 = MIN(y1, fb->y_res - 1);
+
+	if (x0 > x1 || y0 > y1) {
+		return;
+	}
+
+	for (size_t i = y0 / fb->ppt; i <= y1 / fb->ppt; i++) {
+		struct cfb_dirty_span *span = &fb->dirty[i];
+
+		if (span->x0 > span->x1) {
+			span->x0 = x0;
+			span->x1 = x1;
+		} else {
+			span->x0 = MIN(span->x0, x0);
+			span->x1 = MAX(span->x1, x1);
+		}
+	}
+}
+
+static void mark_clean(const struct char_framebuffer *fb, size_t first, size_t num)
+{
+	for (size_t i = first; i < first + num; i++) {
+		fb->dirty[i].x0 = UINT16_MAX;
+		fb->dirty[i].x1 = 0;
+	}
+}
+#else
+static inline void mark_dirty(const struct char_framebuffer *fb, int32_t x0, int32_t y0,
+			      int32_t x1, int32_t y1)
+{
+}
+#endif
+
+static inline void mark_all_dirty(const struct char_framebuffer *fb)
+{
+	mark_dirty(fb, 0, 0, fb->x_res - 1, fb->y_res - 1);
+}
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, char c)
 {
 	return (uint8_t *)fptr->data +
@@ -180,6 +238,8 @@ static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
 		}
 	}
 
+	mark_dirty(fb, x, y, x + fptr->width - 1, y + fptr->height - 1);
+
 	return fptr->width;
 }
 
@@ -202,6 +262,7 @@ static inline void draw_point(struct char_framebuffer *fb, int16_t x, int16_t y)
 	}
 
 	fb->buf[index + x] |= m;
+	mark_dirty(fb, x, y, x, y);
 }
 
 static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
@@ -337,6 +398,8 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 			height = fb->y_res - y;
 		}
 
+		mark_dirty(fb, x, y, x + width - 1, y + height - 1);
+
 		for (size_t i = x; i < x + width; i++) {
 			for (size_t j = y; j < (y + height); j++) {
 				/*
@@ -395,14 +458,82 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 	return -EINVAL;
 }
 
-static int cfb_invert(const struct char_framebuffer *fb)
+static void cfb_invert(uint8_t *buf, size_t len)
 {
-	for (size_t i = 0; i < fb->x_res * fb->y_res / 8U; i++) {
-		fb->buf[i] = ~fb->buf[i];
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = ~buf[i];
+	}
+}
+
+/*
+ * Write @p num tile rows starting at tile row @p first, columns @p x to
+ * @p x + @p width - 1, to the display. The area must be contiguous in the
+ * framebuffer, that is either a single tile row or whole tile rows.
+ */
+static int cfb_write(const struct device *dev, const struct char_framebuffer *fb,
+		     uint16_t x, size_t first, uint16_t width, size_t num)
+{
+	const struct display_driver_api *api = dev->api;
+	struct display_buffer_descriptor desc;
+	uint8_t *buf = fb->buf + first * fb->x_res + x;
+	int err;
+
+	desc.buf_size = width * num;
+	desc.width = width;
+	desc.height = num * fb->ppt;
+	desc.pitch = width;
+
+	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
+		cfb_invert(buf, desc.buf_size);
+		err = api->write(dev, x, first * fb->ppt, &desc, buf);
+		cfb_invert(buf, desc.buf_size);
+		return err;
+	}
+
+	return api->write(dev, x, first * fb->ppt, &desc, buf);
+}
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+/*
+ * Write the dirty spans of the framebuffer to the display. Adjacent tile
+ * rows which are dirty over the whole width are merged into a single write,
+ * the other ones are written one by one as only their span is contiguous.
+ */
+static int cfb_write_dirty(const struct device *dev, const struct char_framebuffer *fb)
+{
+	const size_t rows = fb->y_res / fb->ppt;
+	size_t i = 0;
+	int err;
+
+	while (i < rows) {
+		const struct cfb_dirty_span *span = &fb->dirty[i];
+		const bool full = (span->x0 == 0 && span->x1 == fb->x_res - 1);
+		size_t num = 1;
+
+		if (span->x0 > span->x1) {
+			i++;
+			continue;
+		}
+
+		while (full && i + num < rows &&
+		       fb->dirty[i + num].x0 == 0 &&
+		       fb->dirty[i + num].x1 == fb->x_res - 1) {
+			num++;
+		}
+
+		err = cfb_write(dev, fb, span->x0, i, span->x1 - span->x0 + 1, num);
+		if (err) {
+			/* Remaining spans are kept to be written next time */
+			return err;
+		}
+
+		mark_clean(fb, i, num);
+		i += num;
 	}
 
 	return 0;
 }
+#endif
 
 int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 {
@@ -418,6 +549,7 @@ int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 	desc.height = fb->y_res;
 	desc.pitch = fb->x_res;
 	memset(fb->buf, 0, fb->size);
+	mark_all_dirty(fb);
 
 	if (clear_display) {
 		cfb_framebuffer_finalize(dev);
@@ -436,34 +568,24 @@ int cfb_framebuffer_invert(const struct device *dev)
 	}
 
 	fb->inverted = !fb->inverted;
+	mark_all_dirty(fb);
 
 	return 0;
 }
 
 int cfb_framebuffer_finalize(const struct device *dev)
 {
-	const struct display_driver_api *api = dev->api;
 	const struct char_framebuffer *fb = &char_fb;
-	struct display_buffer_descriptor desc;
-	int err;
 
 	if (!fb || !fb->buf) {
 		return -ENODEV;
 	}
 
-	desc.buf_size = fb->size;
-	desc.width = fb->x_res;
-	desc.height = fb->y_res;
-	desc.pitch = fb->x_res;
-
-	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
-		cfb_invert(fb);
-		err = api->write(dev, 0, 0, &desc, fb->buf);
-		cfb_invert(fb);
-		return err;
-	}
-
-	return api->write(dev, 0, 0, &desc, fb->buf);
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+	return cfb_write_dirty(dev, fb);
+#else
+	return cfb_write(dev, fb, 0, 0, fb->x_res, fb->y_res / fb->ppt);
+#endif
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -574,5 +696,18 @@ int cfb_framebuffer_init(const struct device *dev)
 
 	memset(fb->buf, 0, fb->size);
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+	fb->dirty = k_malloc(fb->y_res / fb->ppt * sizeof(*fb->dirty));
+	if (!fb->dirty) {
+		k_free(fb->buf);
+		fb->buf = NULL;
+		return -ENOMEM;
+	}
+
+	/* Display RAM content is unknown, the first finalize writes everything */
+	mark_clean(fb, 0, fb->y_res / fb->ppt);
+	mark_all_dirty(fb);
+#endif
+
 	return 0;
 }
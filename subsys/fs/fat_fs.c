@@ -252,6 +252,20 @@ static int fatfs_truncate(struct fs_file_t *zfp, off_t length)
 #if !defined(CONFIG_FS_FATFS_READ_ONLY)
 	off_t cur_length = f_size((FIL *)zfp->filep);
 
+#if defined(CONFIG_FS_FATFS_EXPAND)
+	/*
+	 * Allocate contiguous clusters to an empty file, so that writing
+	 * it does not search the FAT for free clusters. Fall back to
+	 * f_lseek when there is no contiguous free area of that size.
+	 */
+	if ((cur_length == 0) && (length > 0)) {
+		res = f_expand(zfp->filep, length, 1);
+		if ((res != FR_OK) && (res != FR_DENIED)) {
+			return translate_error(res);
+		}
+	}
+#endif
+
 	/* f_lseek expands file if new position is larger than file size */
 	res = f_lseek(zfp->filep, length);
 	if (res != FR_OK) {
@@ -277,14 +291,21 @@ static int fatfs_truncate(struct fs_file_t *zfp, off_t length)
 		 * The FS module does caching and optimization of
 		 * writes. Here we write 1 byte at a time to avoid
 		 * using additional code and memory for doing any
-		 * optimization.
+		 * optimization, unless clusters are preallocated
+		 * for streaming writes, where whole sectors are
+		 * written.
 		 */
+#if defined(CONFIG_FS_FATFS_EXPAND)
+		static const uint8_t zeroes[CONFIG_FS_FATFS_MAX_SS];
+#else
+		static const uint8_t zeroes[1];
+#endif
 		unsigned int bw;
-		uint8_t c = 0U;
 
-		for (int i = cur_length; i < length; i++) {
-			res = f_write(zfp->filep, &c, 1, &bw);
-			if (res != FR_OK) {
+		for (off_t i = cur_length; i < length; i += bw) {
+			res = f_write(zfp->filep, zeroes,
+				      MIN(sizeof(zeroes), length - i), &bw);
+			if ((res != FR_OK) || (bw == 0)) {
 				break;
 			}
 		}
@@ -21,6 +21,9 @@
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 #include <zephyr/drivers/flash.h>
 #include <zephyr/storage/flash_map.h>
+#ifdef CONFIG_FLASH_CACHE
+#include <zephyr/drivers/flash/flash_cache.h>
+#endif
 #endif
 #ifdef CONFIG_FS_LITTLEFS_BLK_DEV
 #include <zephyr/storage/disk_access.h>
@@ -199,6 +202,18 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 
 	return errno_to_lfs(rc);
 }
+
+#ifdef CONFIG_FLASH_CACHE
+/* Partitions defined under a zephyr,flash-cache node are accessed
+ * through the cache, whose buffered writes must reach the flash when
+ * littlefs syncs.
+ */
+#define FLASH_CACHE_DEVICE(node_id) DEVICE_DT_GET(node_id),
+
+static const struct device *const flash_caches[] = {
+	DT_FOREACH_STATUS_OKAY(zephyr_flash_cache, FLASH_CACHE_DEVICE)
+};
+#endif /* CONFIG_FLASH_CACHE */
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
 
 #ifdef CONFIG_FS_LITTLEFS_BLK_DEV
@@ -253,6 +268,16 @@ static int lfs_api_erase_blk(const struct lfs_config *c, lfs_block_t block)
 
 static int lfs_api_sync(const struct lfs_config *c)
 {
+#if defined(CONFIG_FS_LITTLEFS_FMP_DEV) && defined(CONFIG_FLASH_CACHE)
+	const struct flash_area *fa = c->context;
+
+	for (size_t i = 0; i < ARRAY_SIZE(flash_caches); i++) {
+		if (flash_caches[i] == fa->fa_dev) {
+			return errno_to_lfs(flash_cache_flush(fa->fa_dev));
+		}
+	}
+#endif
+
 	return LFS_ERR_OK;
 }
 
@@ -18,6 +18,9 @@ LOG_MODULE_REGISTER(fs_nvs, CONFIG_NVS_LOG_LEVEL);
 
 static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate);
 static int nvs_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry);
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+static int nvs_lookup_cache_snapshot_load(struct nvs_fs *fs);
+#endif
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 
@@ -40,14 +43,134 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	return pos % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+/* The lookup index is an open addressing hash table: each entry holds the
+ * address of the most recent ate of one id, and an id which does not fit at
+ * its hash position is stored in the next free entry. Entries of removed ids
+ * are marked deleted, so that the ids stored after them are still found.
+ */
+
+/* return the entry of id, or -1 if it is not in the index */
+static int nvs_lookup_index_find(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if (fs->lookup_cache[pos] == NVS_LOOKUP_CACHE_NO_ADDR) {
+			break;
+		}
+		if ((fs->lookup_cache[pos] != NVS_LOOKUP_INDEX_DELETED) &&
+		    (fs->lookup_ids[pos] == id)) {
+			return pos;
+		}
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	return -1;
+}
+
+static void nvs_lookup_index_remove(struct nvs_fs *fs, uint16_t id)
+{
+	int pos = nvs_lookup_index_find(fs, id);
+
+	if (pos < 0) {
+		return;
+	}
+
+	fs->lookup_cache[pos] = NVS_LOOKUP_INDEX_DELETED;
+
+	/* deleted entries followed by a free one are not needed anymore */
+	if (fs->lookup_cache[(pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE] !=
+	    NVS_LOOKUP_CACHE_NO_ADDR) {
+		return;
+	}
+
+	while (fs->lookup_cache[pos] == NVS_LOOKUP_INDEX_DELETED) {
+		fs->lookup_cache[pos] = NVS_LOOKUP_CACHE_NO_ADDR;
+		pos = (pos + CONFIG_NVS_LOOKUP_CACHE_SIZE - 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+}
+#endif /* CONFIG_NVS_LOOKUP_INDEX */
+
+/* return the address from which the most recent ate of id is searched, or
+ * NVS_LOOKUP_CACHE_NO_ADDR if there is no ate for id.
+ */
+static uint32_t nvs_lookup_cache_get(struct nvs_fs *fs, uint16_t id)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	int pos = nvs_lookup_index_find(fs, id);
+
+	if (pos >= 0) {
+		return fs->lookup_cache[pos];
+	}
+
+	/* the ids which did not fit are searched in all ate's */
+	return fs->lookup_overflow ? fs->ate_wra : NVS_LOOKUP_CACHE_NO_ADDR;
+#else
+	return fs->lookup_cache[nvs_lookup_cache_pos(id)];
+#endif
+}
+
+static void nvs_lookup_cache_set(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	size_t pos = nvs_lookup_cache_pos(id);
+	int free_pos = -1;
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if (fs->lookup_cache[pos] == NVS_LOOKUP_CACHE_NO_ADDR) {
+			if (free_pos < 0) {
+				free_pos = pos;
+			}
+			break;
+		}
+		if (fs->lookup_cache[pos] == NVS_LOOKUP_INDEX_DELETED) {
+			if (free_pos < 0) {
+				free_pos = pos;
+			}
+		} else if (fs->lookup_ids[pos] == id) {
+			fs->lookup_cache[pos] = addr;
+			return;
+		}
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	if (free_pos < 0) {
+		if (!fs->lookup_overflow) {
+			LOG_WRN("Lookup cache full, increase NVS_LOOKUP_CACHE_SIZE");
+		}
+		fs->lookup_overflow = true;
+		return;
+	}
+
+	fs->lookup_cache[free_pos] = addr;
+	fs->lookup_ids[free_pos] = id;
+#else
+	fs->lookup_cache[nvs_lookup_cache_pos(id)] = addr;
+#endif
+}
+
+static void nvs_lookup_cache_clear(struct nvs_fs *fs)
+{
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	fs->lookup_overflow = false;
+#endif
+}
+
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr, ate_addr;
-	uint32_t *cache_entry;
 	struct nvs_ate ate;
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+	if (nvs_lookup_cache_snapshot_load(fs) == 0) {
+		return 0;
+	}
+#endif
+
+	nvs_lookup_cache_clear(fs);
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -59,11 +182,10 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
-
-		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
+		if (ate.id != 0xFFFF &&
+		    nvs_lookup_cache_get(fs, ate.id) == NVS_LOOKUP_CACHE_NO_ADDR &&
 		    nvs_ate_valid(fs, &ate)) {
-			*cache_entry = ate_addr;
+			nvs_lookup_cache_set(fs, ate.id, ate_addr);
 		}
 
 		if (addr == fs->ate_wra) {
@@ -74,6 +196,7 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 	return 0;
 }
 
+#ifndef CONFIG_NVS_LOOKUP_INDEX
 static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
 {
 	uint32_t *cache_entry = fs->lookup_cache;
@@ -85,6 +208,7 @@ static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
 		}
 	}
 }
+#endif
 
 #endif /* CONFIG_NVS_LOOKUP_CACHE */
 
@@ -170,7 +294,7 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
-		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		nvs_lookup_cache_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -303,7 +427,8 @@ static int nvs_flash_erase_sector(struct nvs_fs *fs, uint32_t addr)
 	LOG_DBG("Erasing flash at %lx, len %d", (long int) offset,
 		fs->sector_size);
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_LOOKUP_CACHE) && !defined(CONFIG_NVS_LOOKUP_INDEX)
+	/* the lookup index is updated by nvs_gc() instead */
 	nvs_lookup_cache_invalidate(fs, addr >> ADDR_SECT_SHIFT);
 #endif
 	rc = flash_erase(fs->flash_device, offset, fs->sector_size);
@@ -320,6 +445,83 @@ static int nvs_flash_erase_sector(struct nvs_fs *fs, uint32_t addr)
 	return rc;
 }
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+static K_THREAD_STACK_DEFINE(nvs_gc_stack, CONFIG_NVS_GC_BACKGROUND_STACK_SIZE);
+static struct k_work_q nvs_gc_work_q;
+
+static int nvs_gc_work_q_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "nvs_gc"};
+
+	k_work_queue_init(&nvs_gc_work_q);
+
+	k_work_queue_start(&nvs_gc_work_q, nvs_gc_stack,
+			   K_THREAD_STACK_SIZEOF(nvs_gc_stack),
+			   CONFIG_NVS_GC_BACKGROUND_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(nvs_gc_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+/* erase len bytes of the sector left by the garbage collection and verify
+ * erase was OK.
+ * return 0 if OK, errorcode on error.
+ */
+static int nvs_gc_erase(struct nvs_fs *fs, uint32_t len)
+{
+	int rc;
+	off_t offset;
+
+	offset = fs->offset;
+	offset += fs->sector_size * (fs->gc_erase_addr >> ADDR_SECT_SHIFT);
+	offset += fs->gc_erase_addr & ADDR_OFFS_MASK;
+
+	LOG_DBG("Erasing flash at %lx, len %d", (long int) offset, len);
+
+	rc = flash_erase(fs->flash_device, offset, len);
+	if (rc) {
+		return rc;
+	}
+
+	if (nvs_flash_cmp_const(fs, fs->gc_erase_addr,
+				fs->flash_parameters->erase_value, len)) {
+		return -ENXIO;
+	}
+
+	fs->gc_erase_addr += len;
+	fs->gc_erase_len -= len;
+
+	return 0;
+}
+
+/* erase what is left of the sector left by the garbage collection, before
+ * the write sector moves to it.
+ */
+static int nvs_gc_erase_pending(struct nvs_fs *fs)
+{
+	if (!fs->gc_erase_len) {
+		return 0;
+	}
+
+	return nvs_gc_erase(fs, fs->gc_erase_len);
+}
+
+/* leave the erase of the garbage collected sector to the work queue */
+static void nvs_gc_erase_defer(struct nvs_fs *fs, uint32_t addr)
+{
+	addr &= ADDR_SECT_MASK;
+
+#if defined(CONFIG_NVS_LOOKUP_CACHE) && !defined(CONFIG_NVS_LOOKUP_INDEX)
+	nvs_lookup_cache_invalidate(fs, addr >> ADDR_SECT_SHIFT);
+#endif
+	fs->gc_erase_addr = addr;
+	fs->gc_erase_len = fs->sector_size;
+
+	(void)k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 /* crc update on allocation entry */
 static void nvs_ate_crc8_update(struct nvs_ate *entry)
 {
@@ -429,6 +631,197 @@ static int nvs_flash_wrt_entry(struct nvs_fs *fs, uint16_t id, const void *data,
 }
 /* end of flash routines */
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+/* A snapshot of the lookup cache is stored as the data of an ate with the
+ * special-purpose identifier 0xFFFF: the cache followed by a trailer. It is
+ * written in each sector after gc, so that nvs_mount() only needs to replay
+ * the ate's of the write sector which follow the snapshot.
+ */
+struct nvs_snapshot_trailer {
+	uint32_t ate_addr;	/* address of the snapshot ate */
+	uint32_t crc32;		/* crc32 of the cache and ate_addr */
+};
+
+/* size of the cache in a snapshot */
+static inline size_t nvs_snapshot_cache_size(struct nvs_fs *fs)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	return nvs_al_size(fs, sizeof(fs->lookup_cache)) +
+	       nvs_al_size(fs, sizeof(fs->lookup_ids));
+#else
+	return nvs_al_size(fs, sizeof(fs->lookup_cache));
+#endif
+}
+
+/* size of the data of a snapshot */
+static inline size_t nvs_snapshot_len(struct nvs_fs *fs)
+{
+	return nvs_snapshot_cache_size(fs) + sizeof(struct nvs_snapshot_trailer);
+}
+
+static uint32_t nvs_snapshot_crc32(struct nvs_fs *fs, uint32_t ate_addr)
+{
+	uint32_t crc;
+
+	crc = crc32_ieee((const uint8_t *)fs->lookup_cache,
+			 sizeof(fs->lookup_cache));
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	crc = crc32_ieee_update(crc, (const uint8_t *)fs->lookup_ids,
+				sizeof(fs->lookup_ids));
+#endif
+
+	return crc32_ieee_update(crc, (const uint8_t *)&ate_addr,
+				 sizeof(ate_addr));
+}
+
+/* store a snapshot of the lookup cache, if it fits in the write sector */
+static void nvs_lookup_cache_snapshot_write(struct nvs_fs *fs)
+{
+	struct nvs_snapshot_trailer trailer;
+	struct nvs_ate entry;
+	size_t ate_size, len;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	len = nvs_snapshot_len(fs);
+
+	/* Leave space for a delete ate */
+	if (fs->ate_wra < (fs->data_wra + nvs_al_size(fs, len) + ate_size)) {
+		return;
+	}
+
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	/* the ids which did not fit are only found by a full rebuild */
+	if (fs->lookup_overflow) {
+		return;
+	}
+#endif
+
+	trailer.ate_addr = fs->ate_wra;
+	trailer.crc32 = nvs_snapshot_crc32(fs, trailer.ate_addr);
+
+	entry.id = 0xFFFF;
+	entry.offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+	entry.len = (uint16_t)len;
+	entry.part = 0xff;
+
+	nvs_ate_crc8_update(&entry);
+
+	if (nvs_flash_data_wrt(fs, fs->lookup_cache, sizeof(fs->lookup_cache)) ||
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	    nvs_flash_data_wrt(fs, fs->lookup_ids, sizeof(fs->lookup_ids)) ||
+#endif
+	    nvs_flash_data_wrt(fs, &trailer, sizeof(trailer)) ||
+	    nvs_flash_ate_wrt(fs, &entry)) {
+		LOG_WRN("Failed to write lookup cache snapshot");
+	}
+}
+
+/* Load the lookup cache from the most recent snapshot of the write sector
+ * and replay the ate's written after it.
+ * return 0 if OK, -ENOENT if there is no valid snapshot, errcode on error.
+ */
+static int nvs_lookup_cache_snapshot_load(struct nvs_fs *fs)
+{
+	struct nvs_snapshot_trailer trailer;
+	struct nvs_ate ate;
+	uint32_t addr, snapshot_addr, data_addr;
+	size_t ate_size, cache_size;
+	int rc;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	cache_size = nvs_snapshot_cache_size(fs);
+
+	/* search the snapshot from the newest ate of the write sector */
+	snapshot_addr = NVS_LOOKUP_CACHE_NO_ADDR;
+	addr = fs->ate_wra + ate_size;
+	while ((addr & ADDR_OFFS_MASK) < (fs->sector_size - ate_size)) {
+		rc = nvs_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+		if ((ate.id == 0xFFFF) && (ate.len == nvs_snapshot_len(fs)) &&
+		    nvs_ate_valid(fs, &ate)) {
+			snapshot_addr = addr;
+			break;
+		}
+		addr += ate_size;
+	}
+
+	if (snapshot_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		return -ENOENT;
+	}
+
+	data_addr = (snapshot_addr & ADDR_SECT_MASK) + ate.offset;
+	rc = nvs_flash_rd(fs, data_addr, fs->lookup_cache,
+			  sizeof(fs->lookup_cache));
+	if (rc) {
+		return rc;
+	}
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	rc = nvs_flash_rd(fs, data_addr + nvs_al_size(fs, sizeof(fs->lookup_cache)),
+			  fs->lookup_ids, sizeof(fs->lookup_ids));
+	if (rc) {
+		return rc;
+	}
+	fs->lookup_overflow = false;
+#endif
+	rc = nvs_flash_rd(fs, data_addr + cache_size, &trailer, sizeof(trailer));
+	if (rc) {
+		return rc;
+	}
+
+	/* a snapshot moved by gc is not valid at its new address */
+	if ((trailer.ate_addr != snapshot_addr) ||
+	    (trailer.crc32 != nvs_snapshot_crc32(fs, snapshot_addr))) {
+		LOG_WRN("Invalid lookup cache snapshot");
+		return -ENOENT;
+	}
+
+	/* drop the entries whose ate does not exist anymore */
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if ((fs->lookup_cache[i] == NVS_LOOKUP_CACHE_NO_ADDR) ||
+		    (fs->lookup_cache[i] == NVS_LOOKUP_INDEX_DELETED)) {
+			continue;
+		}
+		if ((fs->lookup_cache[i] >> ADDR_SECT_SHIFT) >= fs->sector_count) {
+			return -ENOENT;
+		}
+		rc = nvs_flash_ate_rd(fs, fs->lookup_cache[i], &ate);
+		if (rc) {
+			return rc;
+		}
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+		/* keep the entry to find the ids stored after it */
+		if ((ate.id == 0xFFFF) || !nvs_ate_valid(fs, &ate) ||
+		    (ate.id != fs->lookup_ids[i])) {
+			fs->lookup_cache[i] = NVS_LOOKUP_INDEX_DELETED;
+		}
+#else
+		if ((ate.id == 0xFFFF) || !nvs_ate_valid(fs, &ate) ||
+		    (nvs_lookup_cache_pos(ate.id) != i)) {
+			fs->lookup_cache[i] = NVS_LOOKUP_CACHE_NO_ADDR;
+		}
+#endif
+	}
+
+	/* replay the ate's written after the snapshot, oldest first */
+	for (addr = snapshot_addr - ate_size; addr > fs->ate_wra;
+	     addr -= ate_size) {
+		rc = nvs_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+		if ((ate.id != 0xFFFF) && nvs_ate_valid(fs, &ate)) {
+			nvs_lookup_cache_set(fs, ate.id, addr);
+		}
+	}
+
+	LOG_DBG("Lookup cache loaded from snapshot at %x", snapshot_addr);
+
+	return 0;
+}
+#endif /* CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT */
+
 /* If the closing ate is invalid, its offset cannot be trusted and
  * the last valid ate of the sector should instead try to be recovered by going
  * through all ate's.
@@ -508,6 +901,17 @@ static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate)
 		return 0;
 	}
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	/* the garbage collected sector which is not erased yet is also the
+	 * end of the filesystem
+	 */
+	if (fs->gc_erase_len &&
+	    (((*addr) & ADDR_SECT_MASK) == (fs->gc_erase_addr & ADDR_SECT_MASK))) {
+		*addr = fs->ate_wra;
+		return 0;
+	}
+#endif
+
 	/* Update the address if the close ate is valid.
 	 */
 	if (nvs_close_ate_valid(fs, &close_ate)) {
@@ -631,8 +1035,15 @@ static int nvs_gc(struct nvs_fs *fs)
 			continue;
 		}
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+		/* snapshots are only valid where they were written */
+		if (gc_ate.id == 0xFFFF) {
+			continue;
+		}
+#endif
+
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
+		wlk_addr = nvs_lookup_cache_get(fs, gc_ate.id);
 
 		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -680,6 +1091,12 @@ static int nvs_gc(struct nvs_fs *fs)
 				return rc;
 			}
 		}
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+		/* no ate of a deleted id is left after gc */
+		if ((wlk_prev_addr == gc_prev_addr) && !gc_ate.len) {
+			nvs_lookup_index_remove(fs, gc_ate.id);
+		}
+#endif
 	} while (gc_prev_addr != stop_addr);
 
 gc_done:
@@ -695,6 +1112,13 @@ gc_done:
 		if (rc) {
 			return rc;
 		}
+#ifdef CONFIG_NVS_GC_BACKGROUND
+		/* an interrupted erase is completed at startup once the gc
+		 * done ate is written
+		 */
+		nvs_gc_erase_defer(fs, sec_addr);
+		return 0;
+#endif
 	}
 
 	/* Erase the gc'ed sector */
@@ -705,6 +1129,55 @@ gc_done:
 	return 0;
 }
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+/* check whether the free space of the write sector fell below the threshold */
+static bool nvs_gc_background_needed(struct nvs_fs *fs)
+{
+	if (!fs->ready || fs->gc_erase_len ||
+	    ((fs->ate_wra & ADDR_SECT_MASK) == fs->gc_full_sector)) {
+		return false;
+	}
+
+	return ((fs->ate_wra - fs->data_wra) * 100U) <
+	       (CONFIG_NVS_GC_BACKGROUND_THRESHOLD * fs->sector_size);
+}
+
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc = 0;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	if (fs->gc_erase_len) {
+		/* erase one page at a time, writes wait for one page at most */
+		rc = nvs_gc_erase(fs, MIN(fs->gc_erase_len, fs->gc_page_size));
+	} else if (nvs_gc_background_needed(fs)) {
+		rc = nvs_sector_close(fs);
+		if (!rc) {
+			rc = nvs_gc(fs);
+		}
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+		if (!rc) {
+			nvs_lookup_cache_snapshot_write(fs);
+		}
+#endif
+		/* do not move again when the live data fills the new sector */
+		if (!rc && nvs_gc_background_needed(fs)) {
+			fs->gc_full_sector = fs->ate_wra & ADDR_SECT_MASK;
+		}
+	}
+
+	if (rc) {
+		LOG_ERR("Background garbage collection failed (%d)", rc);
+	} else if (fs->gc_erase_len || nvs_gc_background_needed(fs)) {
+		(void)k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -870,9 +1343,14 @@ static int nvs_startup(struct nvs_fs *fs)
 		 * So, temporarily, we set the lookup cache to the end of the fs.
 		 * The cache will be rebuilt afterwards
 		 **/
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+		nvs_lookup_cache_clear(fs);
+		fs->lookup_overflow = true;
+#else
 		for (int i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
 			fs->lookup_cache[i] = fs->ate_wra;
 		}
+#endif
 #endif
 		rc = nvs_gc(fs);
 		goto end;
@@ -936,6 +1414,13 @@ int nvs_clear(struct nvs_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	fs->gc_erase_len = 0U;
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -957,6 +1442,16 @@ int nvs_mount(struct nvs_fs *fs)
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	struct k_work_sync sync;
+
+	/* the erase left by a previous mount is completed at startup */
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+	fs->gc_erase_len = 0U;
+	fs->gc_full_sector = NVS_GC_NO_SECTOR;
+#endif
+
 	k_mutex_init(&fs->nvs_lock);
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
@@ -983,6 +1478,18 @@ int nvs_mount(struct nvs_fs *fs)
 		LOG_ERR("Invalid sector size");
 		return -EINVAL;
 	}
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	fs->gc_page_size = info.size;
+#endif
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+	/* check that a lookup cache snapshot leaves space for data */
+	if ((nvs_al_size(fs, nvs_snapshot_len(fs)) +
+	     5 * nvs_al_size(fs, sizeof(struct nvs_ate))) >= fs->sector_size) {
+		LOG_ERR("Lookup cache snapshot does not fit in a sector");
+		return -EINVAL;
+	}
+#endif
 
 	/* check the number of sectors, it should be at least 2 */
 	if (fs->sector_count < 2) {
@@ -1012,7 +1519,7 @@ int nvs_mount(struct nvs_fs *fs)
 ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 {
 	int rc, gc_count;
-	size_t ate_size, data_size;
+	size_t ate_size, data_size, max_len;
 	struct nvs_ate wlk_ate;
 	uint32_t wlk_addr, rd_addr;
 	uint16_t required_space = 0U; /* no space, appropriate for delete ate */
@@ -1030,14 +1537,18 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	 * where: 1 ate for data, 1 ate for sector close, 1 ate for gc done,
 	 * and 1 ate to always allow a delete.
 	 */
-	if ((len > (fs->sector_size - 4 * ate_size)) ||
-	    ((len > 0) && (data == NULL))) {
+	max_len = fs->sector_size - 4 * ate_size;
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+	/* and the lookup cache snapshot with its ate */
+	max_len -= nvs_al_size(fs, nvs_snapshot_len(fs)) + ate_size;
+#endif
+	if ((len > max_len) || ((len > 0) && (data == NULL))) {
 		return -EINVAL;
 	}
 
 	/* find latest entry with same id */
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1122,6 +1633,14 @@ no_cached_entry:
 		}
 
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+		rc = nvs_gc_erase_pending(fs);
+		if (rc) {
+			goto end;
+		}
+		fs->gc_full_sector = NVS_GC_NO_SECTOR;
+#endif
+
 		rc = nvs_sector_close(fs);
 		if (rc) {
 			goto end;
@@ -1131,9 +1650,17 @@ no_cached_entry:
 		if (rc) {
 			goto end;
 		}
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+		nvs_lookup_cache_snapshot_write(fs);
+#endif
 		gc_count++;
 	}
 	rc = len;
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	if (nvs_gc_background_needed(fs)) {
+		(void)k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+	}
+#endif
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
@@ -1167,7 +1694,7 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	cnt_his = 0U;
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
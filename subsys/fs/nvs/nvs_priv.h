@@ -29,6 +29,11 @@ extern "C" {
 #define NVS_BLOCK_SIZE 32
 
 #define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
+/* Entry of the lookup index whose ID was removed */
+#define NVS_LOOKUP_INDEX_DELETED 0xFFFFFFFE
+
+/* No sector is left full by the background garbage collection */
+#define NVS_GC_NO_SECTOR 0xFFFFFFFF
 
 /* Allocation Table Entry */
 struct nvs_ate {
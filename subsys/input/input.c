@@ -11,7 +11,7 @@
 
 LOG_MODULE_REGISTER(input, CONFIG_INPUT_LOG_LEVEL);
 
-#ifdef CONFIG_INPUT_MODE_THREAD
+#if defined(CONFIG_INPUT_MODE_THREAD) && !defined(CONFIG_INPUT_BATCH)
 
 K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 	      CONFIG_INPUT_QUEUE_MAX_MSGS, 4);
@@ -27,9 +27,335 @@ static void input_process(struct input_event *evt)
 	}
 }
 
+#ifdef CONFIG_INPUT_BATCH
+
+#define INPUT_BATCH_MAX_EVENTS CONFIG_INPUT_BATCH_MAX_EVENTS
+
+struct input_batch {
+	const struct device *dev;
+	sys_snode_t node;
+	bool used;
+	bool queued;
+	/* Listeners of the device by index, unless there are too many */
+	bool all_listeners;
+	uint32_t listeners;
+	/* Events reported since the last sync */
+	struct input_event pending[INPUT_BATCH_MAX_EVENTS];
+	uint8_t pending_len;
+	/* Frames waiting for the input thread */
+	struct input_event ready[INPUT_BATCH_MAX_EVENTS];
+	uint8_t ready_len;
+	/* Start of the last frame in ready, whether it is a complete frame
+	 * of axis events only, which a new one can be merged with, and
+	 * whether it is not complete yet
+	 */
+	uint8_t last_frame;
+	bool last_motion;
+	bool last_open;
+};
+
+static struct input_batch input_batches[CONFIG_INPUT_BATCH_DEVICES];
+static sys_slist_t input_ready_list = SYS_SLIST_STATIC_INIT(&input_ready_list);
+static struct k_spinlock input_lock;
+static K_SEM_DEFINE(input_ready, 0, K_SEM_MAX_LIMIT);
+static K_SEM_DEFINE(input_space, 0, 1);
+
+static bool input_is_axis(const struct input_event *evt)
+{
+	return evt->type == INPUT_EV_ABS || evt->type == INPUT_EV_REL;
+}
+
+/* Finds an earlier event of the same axis in a frame */
+static struct input_event *input_find_axis(struct input_event *evts, int len,
+					   const struct input_event *evt)
+{
+	if (!input_is_axis(evt)) {
+		return NULL;
+	}
+
+	for (int i = 0; i < len; i++) {
+		if (evts[i].type == evt->type && evts[i].code == evt->code) {
+			return &evts[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Absolute values replace each other, relative ones add up */
+static void input_merge_axis(struct input_event *prev,
+			     const struct input_event *evt)
+{
+	if (evt->type == INPUT_EV_ABS) {
+		prev->value = evt->value;
+	} else {
+		prev->value = CLAMP((int64_t)prev->value + evt->value,
+				    INT32_MIN, INT32_MAX);
+	}
+}
+
+static void input_batch_listeners(struct input_batch *batch)
+{
+	int i = 0;
+
+	batch->listeners = 0;
+	batch->all_listeners = false;
+
+	STRUCT_SECTION_FOREACH(input_listener, listener) {
+		if (listener->dev == NULL || listener->dev == batch->dev) {
+			if (i >= 32) {
+				batch->all_listeners = true;
+				return;
+			}
+			batch->listeners |= BIT(i);
+		}
+		i++;
+	}
+}
+
+static struct input_batch *input_batch_get(const struct device *dev)
+{
+	struct input_batch *free = NULL;
+
+	for (int i = 0; i < ARRAY_SIZE(input_batches); i++) {
+		if (!input_batches[i].used) {
+			free = free != NULL ? free : &input_batches[i];
+		} else if (input_batches[i].dev == dev) {
+			return &input_batches[i];
+		}
+	}
+
+	if (free != NULL) {
+		free->dev = dev;
+		free->used = true;
+		input_batch_listeners(free);
+	}
+
+	return free;
+}
+
+/* Returns the number of pending events which do not merge with the ready
+ * ones, and where the pending frame goes in the ready frames
+ */
+static int input_batch_flush_len(struct input_batch *batch, bool sync,
+				 int *start)
+{
+	bool motion = sync && batch->last_motion;
+	int len = 0;
+
+	for (int i = 0; i < batch->pending_len; i++) {
+		motion = motion && input_is_axis(&batch->pending[i]);
+	}
+
+	*start = motion ? batch->last_frame : batch->ready_len;
+
+	for (int i = 0; i < batch->pending_len; i++) {
+		if (input_find_axis(&batch->ready[*start],
+				    batch->ready_len - *start,
+				    &batch->pending[i]) == NULL) {
+			len++;
+		}
+	}
+
+	return len;
+}
+
+/* Moves the pending events to the ready frames, returns false if they do
+ * not fit
+ */
+static bool input_batch_flush(struct input_batch *batch, bool sync)
+{
+	struct input_event *prev;
+	bool motion = sync;
+	int start;
+
+	if (batch->ready_len + input_batch_flush_len(batch, sync, &start) >
+	    INPUT_BATCH_MAX_EVENTS) {
+		return false;
+	}
+
+	for (int i = 0; i < batch->pending_len; i++) {
+		motion = motion && input_is_axis(&batch->pending[i]);
+	}
+
+	/* The merged frame ends with its last event */
+	for (int i = start; i < batch->ready_len; i++) {
+		batch->ready[i].sync = 0;
+	}
+
+	for (int i = 0; i < batch->pending_len; i++) {
+		prev = input_find_axis(&batch->ready[start],
+				       batch->ready_len - start,
+				       &batch->pending[i]);
+		if (prev != NULL) {
+			input_merge_axis(prev, &batch->pending[i]);
+		} else {
+			batch->ready[batch->ready_len++] = batch->pending[i];
+		}
+	}
+
+	if (sync && batch->ready_len > 0) {
+		batch->ready[batch->ready_len - 1].sync = 1;
+	}
+
+	/* A partial frame is continued by the next flush */
+	if (!batch->last_open) {
+		batch->last_frame = start;
+	}
+	batch->last_motion = motion && !batch->last_open;
+	batch->last_open = !sync;
+	batch->pending_len = 0;
+
+	return true;
+}
+
+/* Returns -ENOSPC, leaving the batch untouched, if the event does not fit
+ * until the input thread takes the ready frames
+ */
+static int input_batch_add(struct input_batch *batch,
+			   const struct input_event *evt)
+{
+	struct input_event *prev;
+	int start;
+
+	prev = input_find_axis(batch->pending, batch->pending_len, evt);
+	if (prev != NULL) {
+		/* Merging does not change where the frame goes */
+		if (evt->sync && batch->ready_len +
+		    input_batch_flush_len(batch, true, &start) >
+		    INPUT_BATCH_MAX_EVENTS) {
+			return -ENOSPC;
+		}
+
+		input_merge_axis(prev, evt);
+	} else {
+		if (batch->pending_len == INPUT_BATCH_MAX_EVENTS &&
+		    !input_batch_flush(batch, false)) {
+			return -ENOSPC;
+		}
+
+		prev = &batch->pending[batch->pending_len++];
+		*prev = *evt;
+		prev->sync = 0;
+
+		if (evt->sync && batch->ready_len +
+		    input_batch_flush_len(batch, true, &start) >
+		    INPUT_BATCH_MAX_EVENTS) {
+			batch->pending_len--;
+			return -ENOSPC;
+		}
+	}
+
+	if (evt->sync) {
+		input_batch_flush(batch, true);
+	}
+
+	return 0;
+}
+
+static int input_batch_report(struct input_event *evt, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct input_batch *batch;
+	k_spinlock_key_t key;
+	bool queue;
+	int ret;
+
+	while (true) {
+		key = k_spin_lock(&input_lock);
+
+		batch = input_batch_get(evt->dev);
+		if (batch == NULL) {
+			k_spin_unlock(&input_lock, key);
+			LOG_ERR("No batch left for device %p", evt->dev);
+			return -ENOMEM;
+		}
+
+		ret = input_batch_add(batch, evt);
+
+		queue = batch->ready_len > 0 && !batch->queued;
+		if (queue) {
+			batch->queued = true;
+			sys_slist_append(&input_ready_list, &batch->node);
+		}
+
+		k_spin_unlock(&input_lock, key);
+
+		if (queue) {
+			k_sem_give(&input_ready);
+		}
+
+		if (ret != -ENOSPC) {
+			return 0;
+		}
+
+		/* Wait for the input thread to take some frames */
+		if (k_sem_take(&input_space, sys_timepoint_timeout(end)) != 0) {
+			return K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? -ENOMSG : -EAGAIN;
+		}
+	}
+}
+
+static void input_batch_process(struct input_batch *batch,
+				struct input_event *evts, int len)
+{
+	const struct input_listener *listener;
+	uint32_t listeners;
+
+	for (int i = 0; i < len; i++) {
+		if (batch->all_listeners) {
+			input_process(&evts[i]);
+			continue;
+		}
+
+		for (listeners = batch->listeners; listeners != 0;
+		     listeners &= listeners - 1) {
+			STRUCT_SECTION_GET(input_listener,
+					   find_lsb_set(listeners) - 1,
+					   &listener);
+			listener->callback(&evts[i]);
+		}
+	}
+}
+
+static void input_batch_thread(void)
+{
+	struct input_event evts[INPUT_BATCH_MAX_EVENTS];
+	struct input_batch *batch;
+	k_spinlock_key_t key;
+	int len;
+
+	while (true) {
+		k_sem_take(&input_ready, K_FOREVER);
+
+		key = k_spin_lock(&input_lock);
+
+		batch = CONTAINER_OF(sys_slist_get_not_empty(&input_ready_list),
+				     struct input_batch, node);
+		len = batch->ready_len;
+		memcpy(evts, batch->ready, len * sizeof(evts[0]));
+		batch->ready_len = 0;
+		batch->last_frame = 0;
+		batch->last_motion = false;
+		batch->queued = false;
+
+		k_spin_unlock(&input_lock, key);
+
+		k_sem_give(&input_space);
+
+		input_batch_process(batch, evts, len);
+	}
+}
+
+#endif /* CONFIG_INPUT_BATCH */
+
 bool input_queue_empty(void)
 {
-#ifdef CONFIG_INPUT_MODE_THREAD
+#ifdef CONFIG_INPUT_BATCH
+	if (!sys_slist_is_empty(&input_ready_list)) {
+		return false;
+	}
+#elif defined(CONFIG_INPUT_MODE_THREAD)
 	if (k_msgq_num_used_get(&input_msgq) > 0) {
 		return false;
 	}
@@ -49,7 +375,9 @@ int input_report(const struct device *dev,
 		.value = value,
 	};
 
-#ifdef CONFIG_INPUT_MODE_THREAD
+#ifdef CONFIG_INPUT_BATCH
+	return input_batch_report(&evt, timeout);
+#elif defined(CONFIG_INPUT_MODE_THREAD)
 	return k_msgq_put(&input_msgq, &evt, timeout);
 #else
 	input_process(&evt);
@@ -61,6 +389,9 @@ int input_report(const struct device *dev,
 
 static void input_thread(void)
 {
+#ifdef CONFIG_INPUT_BATCH
+	input_batch_thread();
+#else
 	struct input_event evt;
 	int ret;
 
@@ -73,6 +404,7 @@ static void input_thread(void)
 
 		input_process(&evt);
 	}
+#endif
 }
 
 #define INPUT_THREAD_PRIORITY \
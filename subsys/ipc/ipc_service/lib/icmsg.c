@@ -45,6 +45,9 @@ static int mbox_deinit(const struct icmsg_config_t *conf,
 
 	(void)k_work_cancel(&dev_data->mbox_work);
 	(void)k_work_cancel_delayable(&dev_data->notify_work);
+#if CONFIG_IPC_SERVICE_ICMSG_RX_POLL_US > 0
+	(void)k_work_cancel_delayable(&dev_data->poll_work);
+#endif
 
 	return 0;
 }
@@ -233,6 +236,40 @@ static void mbox_callback(const struct device *instance, uint32_t channel,
 	submit_work_if_buffer_free(dev_data);
 }
 
+#if CONFIG_IPC_SERVICE_ICMSG_RX_POLL_US > 0
+static void poll_process(struct k_work *item)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
+	struct icmsg_data_t *dev_data =
+		CONTAINER_OF(dwork, struct icmsg_data_t, poll_work);
+
+	submit_work_if_buffer_free_and_data_available(dev_data);
+
+	(void)k_work_schedule(dwork, K_USEC(CONFIG_IPC_SERVICE_ICMSG_RX_POLL_US));
+}
+#endif
+
+/* Notifies the remote instance of a sent message. With coalescing, the
+ * notification work is scheduled unless already pending, so that the
+ * messages sent until it runs share its signal.
+ */
+static int notify_remote(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data)
+{
+	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
+
+	if (CONFIG_IPC_SERVICE_ICMSG_NOTIFY_COALESCE_US > 0) {
+		int ret;
+
+		ret = k_work_schedule(&dev_data->notify_work,
+				      K_USEC(CONFIG_IPC_SERVICE_ICMSG_NOTIFY_COALESCE_US));
+
+		return ret < 0 ? ret : 0;
+	}
+
+	return mbox_send(&conf->mbox_tx, NULL);
+}
+
 static int mbox_init(const struct icmsg_config_t *conf,
 		     struct icmsg_data_t *dev_data)
 {
@@ -246,7 +283,18 @@ static int mbox_init(const struct icmsg_config_t *conf,
 		return err;
 	}
 
-	return mbox_set_enabled(&conf->mbox_rx, 1);
+	err = mbox_set_enabled(&conf->mbox_rx, 1);
+	if (err != 0) {
+		return err;
+	}
+
+#if CONFIG_IPC_SERVICE_ICMSG_RX_POLL_US > 0
+	k_work_init_delayable(&dev_data->poll_work, poll_process);
+	(void)k_work_schedule(&dev_data->poll_work,
+			      K_USEC(CONFIG_IPC_SERVICE_ICMSG_RX_POLL_US));
+#endif
+
+	return 0;
 }
 
 int icmsg_open(const struct icmsg_config_t *conf,
@@ -347,9 +395,7 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	}
 	sent_bytes = write_ret;
 
-	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
-
-	ret = mbox_send(&conf->mbox_tx, NULL);
+	ret = notify_remote(conf, dev_data);
 	if (ret) {
 		return ret;
 	}
@@ -448,9 +494,7 @@ int icmsg_send_nocopy(const struct icmsg_config_t *conf,
 	ret = release_tx_buffer(dev_data);
 	__ASSERT_NO_MSG(!ret);
 
-	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
-
-	ret = mbox_send(&conf->mbox_tx, NULL);
+	ret = notify_remote(conf, dev_data);
 	if (ret) {
 		return ret;
 	}
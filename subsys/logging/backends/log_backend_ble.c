@@ -5,6 +5,8 @@
  */
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/logging/log_backend_std.h>
 #include <zephyr/logging/log_backend_ble.h>
 #include <zephyr/bluetooth/gatt.h>
 #include <zephyr/bluetooth/conn.h>
@@ -126,6 +128,9 @@ static int line_out(uint8_t *data, size_t length, void *output_ctx)
 		notify_len = LOG_BACKEND_BLE_BUF_SIZE;
 	}
 
+	/* Binary dictionary output must not be padded nor cut */
+	notify_len = MIN(notify_len, length);
+
 	struct bt_gatt_notify_params notify_param = {
 		.uuid = NULL,
 		.attr = log_characteristic,
@@ -142,7 +147,7 @@ static int line_out(uint8_t *data, size_t length, void *output_ctx)
 	/* ignore notification result and continue sending msg*/
 	ARG_UNUSED(notify_res);
 
-	return length;
+	return notify_len;
 }
 
 LOG_OUTPUT_DEFINE(log_output_ble, line_out, output_buf, sizeof(output_buf));
@@ -161,6 +166,22 @@ static void process(const struct log_backend *const backend, union log_msg_gener
 	log_output_func(&log_output_ble, &msg->log, flags);
 }
 
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	if (panic_mode) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) &&
+	    log_format_current == LOG_OUTPUT_DICT) {
+		log_dict_output_dropped_process(&log_output_ble, cnt);
+	} else {
+		log_backend_std_dropped(&log_output_ble, cnt);
+	}
+}
+
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
 	ARG_UNUSED(backend);
@@ -195,7 +216,8 @@ static int backend_ready(const struct log_backend *const backend)
 }
 
 const struct log_backend_api log_backend_ble_api = {.process = process,
-						    .dropped = NULL,
+						    .dropped = IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ?
+								NULL : dropped,
 						    .panic = panic,
 						    .init = init_ble,
 						    .is_ready = backend_ready,
@@ -470,7 +470,8 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 {
 	ARG_UNUSED(backend);
 
-	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY)) {
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) &&
+	    log_format_current == LOG_OUTPUT_DICT) {
 		log_dict_output_dropped_process(&log_output, cnt);
 	} else {
 		log_backend_std_dropped(&log_output, cnt);
@@ -10,6 +10,8 @@ LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/logging/log_backend_std.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_context.h>
 
@@ -190,6 +192,22 @@ static void process(const struct log_backend *const backend,
 	log_output_func(&log_output_net, &msg->log, flags);
 }
 
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	if (panic_mode) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) &&
+	    log_format_current == LOG_OUTPUT_DICT) {
+		log_dict_output_dropped_process(&log_output_net, cnt);
+	} else {
+		log_backend_std_dropped(&log_output_net, cnt);
+	}
+}
+
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
 	log_format_current = log_type;
@@ -223,6 +241,7 @@ const struct log_backend_api log_backend_net_api = {
 	.panic = panic,
 	.init = init_net,
 	.process = process,
+	.dropped = IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ? NULL : dropped,
 	.format_set = format_set,
 };
 
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/retained_mem.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_retention.h>
+#include <zephyr/logging/log_core.h>
+#include <zephyr/logging/log_msg.h>
+#include <zephyr/sys/crc.h>
+
+#define RETENTION_MAGIC 0x52474f4c /* "LOGR" */
+
+/* Messages are stored as they are, one after another, in the data area
+ * which follows the header. When a message does not fit before the end of
+ * the area, the end is left unused (from wrap) and the message is stored
+ * at the beginning.
+ *
+ * The header is updated after the oldest messages are dropped and after
+ * the new message is written, so that it always describes complete
+ * messages, whenever the device is reset.
+ */
+struct retention_hdr {
+	uint32_t magic;
+	/* Identifies the image which wrote the messages. */
+	uint32_t image;
+	/* Offset of the next message. */
+	uint32_t head;
+	/* Offset of the oldest message. */
+	uint32_t tail;
+	/* End of the messages when tail > head. */
+	uint32_t wrap;
+	/* CRC-32 of the previous fields. */
+	uint32_t crc;
+};
+
+#define DATA_OFFSET sizeof(struct retention_hdr)
+
+static const struct device *const dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_log_retained_mem));
+
+static struct retention_hdr hdr;
+static uint32_t data_size;
+static bool loaded;
+static bool panic_mode;
+static K_MUTEX_DEFINE(lock);
+
+/* Buffer used to format messages, which must be aligned in memory. */
+static uint8_t msg_buf[CONFIG_LOG_BACKEND_RETENTION_MSG_MAX_SIZE]
+	__aligned(Z_LOG_MSG_ALIGNMENT);
+
+static void retention_lock(void)
+{
+	/* After a panic, messages are processed in the panicking context
+	 * and nothing else accesses the messages.
+	 */
+	if (!panic_mode) {
+		(void)k_mutex_lock(&lock, K_FOREVER);
+	}
+}
+
+static void retention_unlock(void)
+{
+	if (!panic_mode) {
+		(void)k_mutex_unlock(&lock);
+	}
+}
+
+/* Messages refer to the strings and the sources of the image which wrote
+ * them, they are discarded when another image is started.
+ */
+static uint32_t image_id(void)
+{
+	const uint8_t *start = (const uint8_t *)TYPE_SECTION_START(log_const);
+	const uint8_t *end = (const uint8_t *)TYPE_SECTION_END(log_const);
+
+	return crc32_ieee(start, end - start);
+}
+
+static uint32_t hdr_crc(void)
+{
+	return crc32_ieee((const uint8_t *)&hdr, offsetof(struct retention_hdr, crc));
+}
+
+static void hdr_commit(void)
+{
+	hdr.crc = hdr_crc();
+	(void)retained_mem_write(dev, 0, (const uint8_t *)&hdr, sizeof(hdr));
+}
+
+static bool hdr_valid(void)
+{
+	return (hdr.magic == RETENTION_MAGIC) && (hdr.crc == hdr_crc()) &&
+	       (hdr.image == image_id()) &&
+	       (hdr.head <= data_size) && (hdr.wrap <= data_size) &&
+	       (hdr.tail <= MAX(hdr.head, hdr.wrap)) &&
+	       (((hdr.head | hdr.tail | hdr.wrap) % sizeof(uint32_t)) == 0);
+}
+
+static void reset(void)
+{
+	hdr.magic = RETENTION_MAGIC;
+	hdr.image = image_id();
+	hdr.head = 0;
+	hdr.tail = 0;
+	hdr.wrap = data_size;
+	hdr_commit();
+}
+
+static int load(void)
+{
+	ssize_t size;
+
+	if (!device_is_ready(dev)) {
+		return -EBUSY;
+	}
+
+	size = retained_mem_size(dev);
+	if (size <= (ssize_t)DATA_OFFSET) {
+		return -ENOSPC;
+	}
+
+	data_size = ROUND_DOWN(size - DATA_OFFSET, sizeof(uint32_t));
+
+	if ((retained_mem_read(dev, 0, (uint8_t *)&hdr, sizeof(hdr)) < 0) || !hdr_valid()) {
+		reset();
+	}
+
+	loaded = true;
+
+	return 0;
+}
+
+static uint32_t msg_len(uint32_t offset)
+{
+	struct log_msg_desc desc;
+
+	(void)retained_mem_read(dev, DATA_OFFSET + offset, (uint8_t *)&desc, sizeof(desc));
+
+	return log_msg_get_total_wlen(desc) * sizeof(uint32_t);
+}
+
+static void drop_oldest(void)
+{
+	uint32_t len = msg_len(hdr.tail);
+
+	if (hdr.tail > hdr.head) {
+		hdr.tail += len;
+		if (hdr.tail >= hdr.wrap) {
+			hdr.tail = 0;
+		}
+	} else {
+		hdr.tail = MIN(hdr.tail + len, hdr.head);
+	}
+}
+
+static void msg_store(struct log_msg *msg)
+{
+	uint32_t len = log_msg_get_total_wlen(msg->hdr.desc) * sizeof(uint32_t);
+	uint32_t tail = hdr.tail;
+	uint32_t pos = hdr.head;
+
+	if ((len > data_size) || (len > sizeof(msg_buf))) {
+		return;
+	}
+
+	if (pos + len > data_size) {
+		while (hdr.tail > hdr.head) {
+			drop_oldest();
+		}
+
+		hdr.wrap = hdr.head;
+		pos = 0;
+	}
+
+	while ((hdr.tail != hdr.head) && (hdr.tail >= pos) && (hdr.tail <= pos + len)) {
+		drop_oldest();
+	}
+
+	if (hdr.tail == hdr.head) {
+		hdr.tail = pos;
+	}
+
+	if ((hdr.tail != tail) || (pos != hdr.head)) {
+		hdr_commit();
+	}
+
+	(void)retained_mem_write(dev, DATA_OFFSET + pos, (const uint8_t *)msg, len);
+
+	hdr.head = pos + len;
+	hdr_commit();
+}
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	ARG_UNUSED(backend);
+
+	if (!loaded || !z_log_item_is_msg(msg)) {
+		return;
+	}
+
+	retention_lock();
+	msg_store(&msg->log);
+	retention_unlock();
+}
+
+static void panic(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+
+	panic_mode = true;
+}
+
+static int is_ready(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+
+	return loaded ? 0 : load();
+}
+
+static const struct log_backend_api log_backend_retention_api = {
+	.process = process,
+	.panic = panic,
+	.is_ready = is_ready,
+};
+
+LOG_BACKEND_DEFINE(log_backend_retention, log_backend_retention_api,
+		   IS_ENABLED(CONFIG_LOG_BACKEND_RETENTION_AUTOSTART));
+
+/* Size of the messages before and after the wrap. */
+static void segments_get(uint32_t *first, uint32_t *second)
+{
+	if (hdr.tail <= hdr.head) {
+		*first = hdr.head - hdr.tail;
+		*second = 0;
+	} else {
+		*first = hdr.wrap - hdr.tail;
+		*second = hdr.head;
+	}
+}
+
+size_t log_backend_retention_size(void)
+{
+	uint32_t first, second;
+
+	if (!loaded) {
+		return 0;
+	}
+
+	retention_lock();
+	segments_get(&first, &second);
+	retention_unlock();
+
+	return first + second;
+}
+
+int log_backend_retention_read(size_t offset, void *buf, size_t len)
+{
+	uint32_t first, second;
+	size_t total = 0;
+	size_t chunk;
+
+	if (!loaded) {
+		return -ENODEV;
+	}
+
+	retention_lock();
+	segments_get(&first, &second);
+
+	if (offset < first) {
+		chunk = MIN(len, first - offset);
+		(void)retained_mem_read(dev, DATA_OFFSET + hdr.tail + offset, buf, chunk);
+		total = chunk;
+		offset = first;
+	}
+
+	if ((offset >= first) && (offset - first < second) && (total < len)) {
+		chunk = MIN(len - total, second - (offset - first));
+		(void)retained_mem_read(dev, DATA_OFFSET + offset - first,
+					(uint8_t *)buf + total, chunk);
+		total += chunk;
+	}
+
+	retention_unlock();
+
+	return total;
+}
+
+int log_backend_retention_dump(const struct log_output *output, uint32_t flags)
+{
+	uint32_t offset;
+	uint32_t end;
+	uint32_t len;
+	int cnt = 0;
+
+	if (!loaded) {
+		return -ENODEV;
+	}
+
+	retention_lock();
+
+	offset = hdr.tail;
+	while (offset != hdr.head) {
+		end = (offset > hdr.head) ? hdr.wrap : hdr.head;
+		len = msg_len(offset);
+
+		if ((len > sizeof(msg_buf)) || (offset + len > end)) {
+			cnt = -EIO;
+			break;
+		}
+
+		(void)retained_mem_read(dev, DATA_OFFSET + offset, msg_buf, len);
+		log_output_msg_process(output, (struct log_msg *)msg_buf, flags);
+		cnt++;
+
+		offset += len;
+		if ((offset > hdr.head) && (offset >= hdr.wrap)) {
+			offset = 0;
+		}
+	}
+
+	retention_unlock();
+
+	return cnt;
+}
+
+int log_backend_retention_clear(void)
+{
+	if (!loaded) {
+		return -ENODEV;
+	}
+
+	retention_lock();
+	reset();
+	retention_unlock();
+
+	return 0;
+}
@@ -7,6 +7,7 @@
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_std.h>
 #include <SEGGER_RTT.h>
 
@@ -72,6 +73,7 @@ static int data_out_drop_mode(uint8_t *data, size_t length, void *ctx);
 static int char_out_drop_mode(uint8_t data);
 static int line_out_drop_mode(void);
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_RTT_OUTPUT_DEFAULT;
+static bool line_overflow;
 
 static inline bool is_sync_mode(void)
 {
@@ -83,6 +85,43 @@ static inline bool is_panic_mode(void)
 	return panic_mode;
 }
 
+/* Dictionary output is binary, there are no lines. A whole message is
+ * gathered in the line buffer, then written or dropped at once by
+ * dict_msg_out_drop_mode(), a partial message would corrupt the stream.
+ */
+static int dict_out_drop_mode(uint8_t *data, size_t length)
+{
+	if (line_pos + length > line_buf + sizeof(line_buf)) {
+		line_overflow = true;
+	} else {
+		memcpy(line_pos, data, length);
+		line_pos += length;
+	}
+
+	return length;
+}
+
+static void dict_msg_out_drop_mode(void)
+{
+	int ret = 0;
+
+	if (!line_overflow) {
+		RTT_LOCK();
+		ret = SEGGER_RTT_WriteSkipNoLock(CONFIG_LOG_BACKEND_RTT_BUFFER,
+						 line_buf, line_pos - line_buf);
+		RTT_UNLOCK();
+	}
+
+	if (ret == 0) {
+		drop_cnt++;
+	} else {
+		drop_cnt = 0;
+	}
+
+	line_pos = line_buf;
+	line_overflow = false;
+}
+
 static int data_out_drop_mode(uint8_t *data, size_t length, void *ctx)
 {
 	(void) ctx;
@@ -92,6 +131,11 @@ static int data_out_drop_mode(uint8_t *data, size_t length, void *ctx)
 		return data_out_block_mode(data, length, ctx);
 	}
 
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) &&
+	    log_format_current == LOG_OUTPUT_DICT) {
+		return dict_out_drop_mode(data, length);
+	}
+
 	for (pos = data; pos < data + length; pos++) {
 		if (char_out_drop_mode(*pos)) {
 			break;
@@ -281,7 +325,12 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 {
 	ARG_UNUSED(backend);
 
-	log_backend_std_dropped(&log_output_rtt, cnt);
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) &&
+	    log_format_current == LOG_OUTPUT_DICT) {
+		log_dict_output_dropped_process(&log_output_rtt, cnt);
+	} else {
+		log_backend_std_dropped(&log_output_rtt, cnt);
+	}
 }
 
 static void process(const struct log_backend *const backend,
@@ -291,6 +340,21 @@ static void process(const struct log_backend *const backend,
 
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_RTT_MODE_DROP) &&
+	    IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) &&
+	    log_format_current == LOG_OUTPUT_DICT && !is_sync_mode()) {
+		/* Messages dropped by the backend are reported along with
+		 * the next message.
+		 */
+		if (drop_cnt > 0) {
+			log_dict_output_dropped_process(&log_output_rtt, drop_cnt);
+		}
+
+		log_output_func(&log_output_rtt, &msg->log, flags);
+		dict_msg_out_drop_mode();
+		return;
+	}
+
 	log_output_func(&log_output_rtt, &msg->log, flags);
 }
 
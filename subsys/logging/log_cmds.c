@@ -8,6 +8,8 @@
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_internal.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_backend_retention.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <string.h>
 
@@ -382,6 +384,55 @@ static int cmd_log_mem(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+#ifdef CONFIG_LOG_BACKEND_RETENTION
+static int retained_out(uint8_t *data, size_t length, void *ctx)
+{
+	shell_fprintf((const struct shell *)ctx, SHELL_NORMAL, "%.*s", (int)length, data);
+
+	return length;
+}
+
+static uint8_t retained_out_buf[64];
+LOG_OUTPUT_DEFINE(retained_output, retained_out, retained_out_buf,
+		  sizeof(retained_out_buf));
+
+static int cmd_log_retained_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	int cnt;
+
+	log_output_ctx_set(&retained_output, (void *)sh);
+
+	cnt = log_backend_retention_dump(&retained_output, log_backend_std_get_flags());
+	if (cnt < 0) {
+		shell_error(sh, "Failed to read retained messages (%d)", cnt);
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "%d retained messages", cnt);
+
+	return 0;
+}
+
+static int cmd_log_retained_clear(const struct shell *sh, size_t argc, char **argv)
+{
+	if (log_backend_retention_clear() < 0) {
+		shell_error(sh, "Retained memory backend not ready");
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_log_retained,
+	SHELL_CMD_ARG(dump, NULL, "Print retained messages.", cmd_log_retained_dump, 1, 0),
+	SHELL_CMD_ARG(clear, NULL, "Discard retained messages.", cmd_log_retained_clear, 1, 0),
+	SHELL_SUBCMD_SET_END);
+
+#define SUB_LOG_RETAINED (&sub_log_retained)
+#else
+#define SUB_LOG_RETAINED NULL
+#endif /* CONFIG_LOG_BACKEND_RETENTION */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_log_backend,
 	SHELL_CMD_ARG(disable, &dsub_module_name,
 		  "'log disable <module_0> .. <module_n>' disables logs in "
@@ -438,6 +489,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		       cmd_log_self_status),
 	SHELL_COND_CMD(CONFIG_LOG_MODE_DEFERRED, mem, NULL, "Logger memory usage",
 		       cmd_log_mem),
+	SHELL_COND_CMD(CONFIG_LOG_BACKEND_RETENTION, retained, SUB_LOG_RETAINED,
+		       "Messages kept in retained memory", NULL),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(log, &sub_log_stat, "Commands for controlling logger",
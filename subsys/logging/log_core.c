@@ -16,6 +16,7 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/hash_function.h>
 #include <ctype.h>
 #include <zephyr/logging/log_frontend.h>
 #include <zephyr/syscall_handler.h>
@@ -63,11 +64,17 @@ LOG_MODULE_REGISTER(log);
 #define CONFIG_LOG_FAILURE_REPORT_PERIOD 0
 #endif
 
+#ifndef CONFIG_LOG_RATELIMIT_BURST
+#define CONFIG_LOG_RATELIMIT_BURST 1
+#endif
+
+#ifndef CONFIG_LOG_RATELIMIT_INTERVAL_MS
+#define CONFIG_LOG_RATELIMIT_INTERVAL_MS 1
+#endif
+
 #ifndef CONFIG_LOG_ALWAYS_RUNTIME
 BUILD_ASSERT(!IS_ENABLED(CONFIG_NO_OPTIMIZATIONS),
 	     "Option must be enabled when CONFIG_NO_OPTIMIZATIONS is set");
-BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
-	     "Option must be enabled when CONFIG_LOG_MODE_IMMEDIATE is set");
 #endif
 
 static const log_format_func_t format_table[] = {
@@ -132,6 +139,26 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 };
 #endif
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+/* CPU 0 uses log_buffer, the other CPUs have a buffer of the same size.
+ * The buffers follow log_buffer in the iterable section, in CPU order, so
+ * that the messages are merged by z_log_msg_claim_oldest().
+ */
+#define PERCPU_BUFFER_CNT (CONFIG_MP_MAX_NUM_CPUS - 1)
+
+static STRUCT_SECTION_ITERABLE_ARRAY(log_msg_ptr, log_msg_ptr_cpu, PERCPU_BUFFER_CNT);
+static STRUCT_SECTION_ITERABLE_ARRAY_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer,
+					       log_buffer_cpu, PERCPU_BUFFER_CNT);
+
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
+	percpu_buf32[PERCPU_BUFFER_CNT][CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+
+static atomic_t cpu_dropped_cnt[CONFIG_MP_MAX_NUM_CPUS];
+
+static void percpu_notify_drop(const struct mpsc_pbuf_buffer *buffer,
+			       const union mpsc_pbuf_generic *item);
+#endif
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -141,6 +168,8 @@ static char tag[CONFIG_LOG_TAG_MAX_LEN + 1] =
 	COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, ({}), (CONFIG_LOG_TAG_DEFAULT));
 
 static void msg_process(union log_msg_generic *msg);
+static bool reports_pending(void);
+static void reports_flush(bool force);
 
 static log_timestamp_t dummy_timestamp(void)
 {
@@ -396,6 +425,8 @@ void z_impl_log_panic(void)
 	}
 
 	if (!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		reports_flush(true);
+
 		/* Flush */
 		while (log_process() == true) {
 		}
@@ -520,6 +551,8 @@ bool z_impl_log_process(void)
 		k_timer_start(&log_process_thread_timer, backoff, K_NO_WAIT);
 
 		return false;
+	} else {
+		reports_flush(false);
 	}
 
 	if (IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
@@ -582,9 +615,164 @@ bool z_log_dropped_pending(void)
 	return dropped_cnt > 0;
 }
 
+#ifdef CONFIG_LOG_RATELIMIT
+/* The state of a call site holds the time window in the upper bits and the
+ * number of messages of the window in the lower bits, so that a message
+ * under the limit only costs one compare and swap.
+ */
+#define RATELIMIT_CNT_BITS 10
+#define RATELIMIT_CNT_MASK BIT_MASK(RATELIMIT_CNT_BITS)
+#define RATELIMIT_WINDOW(state) ((state) & ~(atomic_val_t)RATELIMIT_CNT_MASK)
+
+BUILD_ASSERT(CONFIG_LOG_RATELIMIT_BURST < RATELIMIT_CNT_MASK);
+
+/* Set when a call site starts suppressing messages */
+static atomic_t ratelimit_pending;
+
+static atomic_val_t ratelimit_window(void)
+{
+	uintptr_t window = k_uptime_get_32() / CONFIG_LOG_RATELIMIT_INTERVAL_MS;
+
+	return (atomic_val_t)(window << RATELIMIT_CNT_BITS);
+}
+
+static void ratelimit_report(const void *source, uint8_t level, uint32_t cnt)
+{
+	z_log_msg_runtime_create(Z_LOG_LOCAL_DOMAIN_ID, source, level, NULL, 0, 0,
+				 "%u messages suppressed", cnt);
+}
+
+bool z_log_ratelimit_check(struct log_ratelimit *rl, const void *source,
+			   uint8_t level)
+{
+	atomic_val_t window = ratelimit_window();
+	atomic_val_t old, next;
+	uint32_t cnt;
+	bool expired;
+
+	do {
+		old = atomic_get(&rl->state);
+		cnt = old & RATELIMIT_CNT_MASK;
+		expired = RATELIMIT_WINDOW(old) != window;
+
+		if (expired) {
+			next = window | 1;
+		} else if (cnt < RATELIMIT_CNT_MASK) {
+			next = old + 1;
+		} else {
+			/* Suppressed count saturated */
+			return false;
+		}
+	} while (!atomic_cas(&rl->state, old, next));
+
+	if (expired) {
+		if (cnt > CONFIG_LOG_RATELIMIT_BURST) {
+			ratelimit_report(source, level,
+					 cnt - CONFIG_LOG_RATELIMIT_BURST);
+		}
+
+		return true;
+	}
+
+	if (cnt < CONFIG_LOG_RATELIMIT_BURST) {
+		return true;
+	}
+
+	if (cnt == CONFIG_LOG_RATELIMIT_BURST) {
+		rl->source = source;
+		rl->level = level;
+		atomic_set(&ratelimit_pending, 1);
+	}
+
+	return false;
+}
+
+/* Reports the messages suppressed by the call sites whose window expired,
+ * in case they do not log again.
+ */
+static void ratelimit_flush(void)
+{
+	atomic_val_t window = ratelimit_window();
+
+	if (!atomic_cas(&ratelimit_pending, 1, 0)) {
+		return;
+	}
+
+	STRUCT_SECTION_FOREACH(log_ratelimit, rl) {
+		atomic_val_t old = atomic_get(&rl->state);
+		uint32_t cnt = old & RATELIMIT_CNT_MASK;
+
+		if (cnt <= CONFIG_LOG_RATELIMIT_BURST) {
+			continue;
+		}
+
+		if (RATELIMIT_WINDOW(old) == window) {
+			atomic_set(&ratelimit_pending, 1);
+		} else if (atomic_cas(&rl->state, old, RATELIMIT_WINDOW(old))) {
+			ratelimit_report(rl->source, rl->level,
+					 cnt - CONFIG_LOG_RATELIMIT_BURST);
+		}
+	}
+}
+#endif /* CONFIG_LOG_RATELIMIT */
+
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+static struct mpsc_pbuf_buffer *cpu_buffer(unsigned int cpu)
+{
+	return cpu == 0 ? &log_buffer : &log_buffer_cpu[cpu - 1];
+}
+
+static unsigned int buffer_cpu(const struct mpsc_pbuf_buffer *buffer)
+{
+	return buffer == &log_buffer ? 0 : buffer - log_buffer_cpu + 1;
+}
+
+static void percpu_notify_drop(const struct mpsc_pbuf_buffer *buffer,
+			       const union mpsc_pbuf_generic *item)
+{
+	atomic_inc(&cpu_dropped_cnt[buffer_cpu(buffer)]);
+	z_log_notify_drop(buffer, item);
+}
+
+/* A thread may migrate to another CPU between the allocation and the
+ * commit of a message, so the buffer of the message is found from its
+ * address.
+ */
+static struct mpsc_pbuf_buffer *msg_buffer(const struct log_msg *msg)
+{
+	const uint32_t *addr = (const uint32_t *)msg;
+	int i;
+
+	for (i = 0; i < PERCPU_BUFFER_CNT; i++) {
+		if (addr >= percpu_buf32[i] &&
+		    addr < percpu_buf32[i] + ARRAY_SIZE(percpu_buf32[i])) {
+			return &log_buffer_cpu[i];
+		}
+	}
+
+	return &log_buffer;
+}
+#endif
+
 void z_log_msg_init(void)
 {
-#ifdef CONFIG_MPSC_PBUF
+#if defined(CONFIG_LOG_PERCPU_BUFFERS)
+	struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+	config.notify_drop = percpu_notify_drop;
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		if (cpu > 0) {
+			config.buf = percpu_buf32[cpu - 1];
+			log_msg_ptr_cpu[cpu - 1].msg = NULL;
+		}
+
+		mpsc_pbuf_init(cpu_buffer(cpu), &config);
+		atomic_clear(&cpu_dropped_cnt[cpu]);
+	}
+
+	curr_log_buffer = &log_buffer;
+#elif defined(CONFIG_MPSC_PBUF)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
@@ -602,7 +790,21 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	/* The CPU may change right after it is read, which only costs some
+	 * contention on the buffer of the other CPU.
+	 */
+	unsigned int cpu = arch_curr_cpu()->id;
+	struct log_msg *msg = msg_alloc(cpu_buffer(cpu), wlen);
+
+	if (msg == NULL) {
+		atomic_inc(&cpu_dropped_cnt[cpu]);
+	}
+
+	return msg;
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -621,10 +823,180 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 	z_log_msg_post_finalize();
 }
 
+#ifdef CONFIG_LOG_DEDUPLICATION
+static struct k_spinlock dedup_lock;
+static const void *dedup_source;
+static uint32_t dedup_hash;
+static uint32_t dedup_repeat;
+static uint8_t dedup_level;
+static int64_t dedup_last;
+
+static void dedup_report(const void *source, uint8_t level, uint32_t repeat)
+{
+	z_log_msg_runtime_create(Z_LOG_LOCAL_DOMAIN_ID, source, level, NULL, 0, 0,
+				 "last message repeated %u times", repeat);
+}
+
+static void msg_discard(struct log_msg *msg)
+{
+#ifdef CONFIG_MPSC_PBUF
+	if (IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+		mpsc_pbuf_discard(msg_buffer(msg), (union mpsc_pbuf_generic *)msg);
+#else
+		mpsc_pbuf_discard(&log_buffer, (union mpsc_pbuf_generic *)msg);
+#endif
+	}
+#endif
+}
+
+/* Messages are stored in allocation order, so a message which ends a series
+ * of repetitions is moved after the report of the repetitions.
+ */
+static void msg_recommit(struct log_msg *msg)
+{
+	uint32_t wlen = log_msg_get_total_wlen(msg->hdr.desc);
+	struct log_msg *copy = z_log_msg_alloc(wlen);
+
+	if (copy != NULL) {
+		memcpy(copy, msg, wlen * sizeof(uint32_t));
+	} else {
+		z_log_dropped(false);
+	}
+
+	msg_discard(msg);
+
+	if (copy != NULL) {
+		z_log_msg_commit(copy);
+	}
+}
+
+/* Returns true if the message was consumed: discarded as a repetition of the
+ * previous message, or committed again after the report of the repetitions.
+ */
+static bool dedup_check(struct log_msg *msg)
+{
+	struct log_msg_desc desc = msg->hdr.desc;
+	const void *prev_source;
+	uint8_t prev_level;
+	uint32_t repeat;
+	uint32_t hash;
+	k_spinlock_key_t key;
+
+	if (desc.level == LOG_LEVEL_INTERNAL_RAW_STRING) {
+		return false;
+	}
+
+	hash = sys_hash32(msg->data, desc.package_len + desc.data_len);
+
+	key = k_spin_lock(&dedup_lock);
+
+	if (msg->hdr.source == dedup_source && desc.level == dedup_level &&
+	    hash == dedup_hash) {
+		dedup_repeat++;
+		dedup_last = k_uptime_get();
+		k_spin_unlock(&dedup_lock, key);
+
+		msg_discard(msg);
+
+		return true;
+	}
+
+	prev_source = dedup_source;
+	prev_level = dedup_level;
+	repeat = dedup_repeat;
+
+	dedup_source = msg->hdr.source;
+	dedup_level = desc.level;
+	dedup_hash = hash;
+	dedup_repeat = 0;
+
+	k_spin_unlock(&dedup_lock, key);
+
+	if (repeat == 0) {
+		return false;
+	}
+
+	/* In immediate mode the report is already processed */
+	dedup_report(prev_source, prev_level, repeat);
+	if (IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		return false;
+	}
+
+	msg_recommit(msg);
+
+	return true;
+}
+
+/* Reports the repetitions of the last message if it was not repeated for a
+ * while, in case no other message comes.
+ */
+static void dedup_flush(bool force)
+{
+	const void *source;
+	uint8_t level;
+	uint32_t repeat;
+	k_spinlock_key_t key = k_spin_lock(&dedup_lock);
+
+	if (dedup_repeat == 0 ||
+	    (!force && (k_uptime_get() - dedup_last) < CONFIG_LOG_FAILURE_REPORT_PERIOD)) {
+		k_spin_unlock(&dedup_lock, key);
+
+		return;
+	}
+
+	source = dedup_source;
+	level = dedup_level;
+	repeat = dedup_repeat;
+
+	/* The next message is not a repetition anymore */
+	dedup_level = LOG_LEVEL_INTERNAL_RAW_STRING;
+	dedup_repeat = 0;
+
+	k_spin_unlock(&dedup_lock, key);
+
+	dedup_report(source, level, repeat);
+}
+#endif /* CONFIG_LOG_DEDUPLICATION */
+
+static bool reports_pending(void)
+{
+	bool pending = false;
+
+#ifdef CONFIG_LOG_RATELIMIT
+	pending = pending || atomic_get(&ratelimit_pending) != 0;
+#endif
+#ifdef CONFIG_LOG_DEDUPLICATION
+	pending = pending || dedup_repeat > 0;
+#endif
+
+	return pending;
+}
+
+static void reports_flush(bool force)
+{
+#ifdef CONFIG_LOG_RATELIMIT
+	ratelimit_flush();
+#endif
+#ifdef CONFIG_LOG_DEDUPLICATION
+	dedup_flush(force);
+#endif
+}
+
 void z_log_msg_commit(struct log_msg *msg)
 {
+#ifdef CONFIG_LOG_DEDUPLICATION
+	if (dedup_check(msg)) {
+		return;
+	}
+#endif
+
 	msg->hdr.timestamp = timestamp_func();
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	msg_commit(msg_buffer(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -711,7 +1083,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+	     IS_ENABLED(CONFIG_LOG_PERCPU_BUFFERS)) && len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -746,7 +1119,8 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+	if ((!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) &&
+	     !IS_ENABLED(CONFIG_LOG_PERCPU_BUFFERS)) || (len == 1)) {
 		return msg_pending(&log_buffer);
 	}
 
@@ -828,6 +1202,16 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 
 	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	for (int i = 0; i < PERCPU_BUFFER_CNT; i++) {
+		uint32_t size, used;
+
+		mpsc_pbuf_get_utilization(&log_buffer_cpu[i], &size, &used);
+		*buf_size += size;
+		*usage += used;
+	}
+#endif
+
 	return 0;
 }
 
@@ -839,7 +1223,37 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	uint32_t cpu_max;
+	int ret;
+
+	ret = mpsc_pbuf_get_max_utilization(&log_buffer, max);
+
+	/* Sum of the peaks of the buffers, which may not have been reached
+	 * at the same time.
+	 */
+	for (int i = 0; ret == 0 && i < PERCPU_BUFFER_CNT; i++) {
+		ret = mpsc_pbuf_get_max_utilization(&log_buffer_cpu[i], &cpu_max);
+		*max += cpu_max;
+	}
+
+	return ret;
+#else
 	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+#endif
+}
+
+uint32_t log_cpu_dropped_cnt_get(unsigned int cpu)
+{
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	if (cpu < ARRAY_SIZE(cpu_dropped_cnt)) {
+		return atomic_get(&cpu_dropped_cnt[cpu]);
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif
+
+	return 0;
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
@@ -895,7 +1309,13 @@ static void log_process_thread_func(void *dummy1, void *dummy2, void *dummy3)
 				processed_any = false;
 				log_backend_notify_all(LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
 			}
-			(void)k_sem_take(&log_process_thread_sem, timeout);
+			/* Wake up to send the pending reports even if no
+			 * message comes.
+			 */
+			(void)k_sem_take(&log_process_thread_sem,
+					 reports_pending() ?
+					 K_MSEC(MAX(CONFIG_LOG_FAILURE_REPORT_PERIOD, 1)) :
+					 timeout);
 		} else {
 			processed_any = true;
 		}
@@ -54,12 +54,13 @@ void z_impl_z_log_msg_static_create(const void *source,
 
 	struct log_msg_desc out_desc = desc;
 	int inlen = desc.package_len;
+	uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RW_STR |
+			 CBPRINTF_PACKAGE_CONVERT_PTR_CHECK;
+	uint16_t strl[4];
 	struct log_msg *msg;
+	size_t msg_wlen;
 
 	if (inlen > 0) {
-		uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RW_STR |
-				 CBPRINTF_PACKAGE_CONVERT_PTR_CHECK;
-		uint16_t strl[4];
 		int len;
 
 		len = cbprintf_package_copy(package, inlen,
@@ -78,15 +79,26 @@ void z_impl_z_log_msg_static_create(const void *source,
 		 * when strings are copied into the package.
 		 */
 		out_desc.package_len = len;
-		msg = z_log_msg_alloc(log_msg_get_total_wlen(out_desc));
-		if (msg) {
-			len = cbprintf_package_copy(package, inlen,
-						    msg->data, out_desc.package_len,
-						    flags, strl, ARRAY_SIZE(strl));
-			__ASSERT_NO_MSG(len >= 0);
-		}
+	}
+
+	msg_wlen = log_msg_get_total_wlen(out_desc);
+
+	/* In immediate mode the message is processed before returning so it
+	 * is built on the stack.
+	 */
+	if (IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		msg = alloca(msg_wlen * sizeof(int));
 	} else {
-		msg = z_log_msg_alloc(log_msg_get_total_wlen(out_desc));
+		msg = z_log_msg_alloc(msg_wlen);
+	}
+
+	if (msg && inlen > 0) {
+		int len = cbprintf_package_copy(package, inlen,
+						msg->data, out_desc.package_len,
+						flags, strl, ARRAY_SIZE(strl));
+
+		__ASSERT_NO_MSG(len >= 0);
+		(void)len;
 	}
 
 	z_log_msg_finalize(msg, source, out_desc, data);
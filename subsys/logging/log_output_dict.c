@@ -11,6 +11,7 @@
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
 
 static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 			 void *ctx)
@@ -24,39 +25,108 @@ static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 	} while (len != 0);
 }
 
+/* Parts of a message are gathered in the output buffer, so that backends
+ * sending datagrams or notifications get a whole message at once when it
+ * fits. In immediate mode the buffer is not used, as for text output.
+ */
+static void dict_write(const struct log_output *output, uint8_t *data,
+		       size_t len)
+{
+	struct log_output_control_block *cb = output->control_block;
+	size_t chunk;
+
+	if (IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		buffer_write(output->func, data, len, cb->ctx);
+		return;
+	}
+
+	while (len > 0) {
+		if (atomic_get(&cb->offset) == output->size) {
+			log_output_flush(output);
+		}
+
+		chunk = MIN(len, output->size - atomic_get(&cb->offset));
+		memcpy(&output->buf[atomic_get(&cb->offset)], data, chunk);
+		atomic_add(&cb->offset, chunk);
+
+		data += chunk;
+		len -= chunk;
+	}
+}
+
+static size_t varint_encode(uint8_t *buf, uint64_t value)
+{
+	size_t len = 0;
+
+	do {
+		buf[len] = value & 0x7f;
+		value >>= 7;
+		if (value != 0) {
+			buf[len] |= 0x80;
+		}
+		len++;
+	} while (value != 0);
+
+	return len;
+}
+
+static size_t compact_hdr_encode(uint8_t *buf, struct log_msg *msg,
+				 uintptr_t source)
+{
+	size_t len = 0;
+
+	buf[len++] = MSG_NORMAL |
+		     (msg->hdr.desc.domain << LOG_DICT_OUTPUT_COMPACT_DOMAIN_POS) |
+		     (msg->hdr.desc.level << LOG_DICT_OUTPUT_COMPACT_LEVEL_POS);
+	len += varint_encode(&buf[len], msg->hdr.desc.package_len);
+	len += varint_encode(&buf[len], msg->hdr.desc.data_len);
+	len += varint_encode(&buf[len], source);
+	len += varint_encode(&buf[len], msg->hdr.timestamp);
+
+	return len;
+}
+
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
 {
-	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
+	uintptr_t source_id;
 
-	/* Keep sync with header in struct log_msg */
-	output_hdr.type = MSG_NORMAL;
-	output_hdr.domain = msg->hdr.desc.domain;
-	output_hdr.level = msg->hdr.desc.level;
-	output_hdr.package_len = msg->hdr.desc.package_len;
-	output_hdr.data_len = msg->hdr.desc.data_len;
-	output_hdr.timestamp = msg->hdr.timestamp;
+	source_id = (source != NULL) ?
+			(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+				log_dynamic_source_id(source) :
+				log_const_source_id(source)) :
+			0U;
 
-	output_hdr.source = (source != NULL) ?
-				(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
-					log_dynamic_source_id(source) :
-					log_const_source_id(source)) :
-				0U;
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT)) {
+		uint8_t hdr[LOG_DICT_OUTPUT_COMPACT_HDR_MAX_LEN];
 
-	buffer_write(output->func, (uint8_t *)&output_hdr, sizeof(output_hdr),
-		     (void *)output);
+		dict_write(output, hdr, compact_hdr_encode(hdr, msg, source_id));
+	} else {
+		struct log_dict_output_normal_msg_hdr_t output_hdr;
+
+		/* Keep sync with header in struct log_msg */
+		output_hdr.type = MSG_NORMAL;
+		output_hdr.domain = msg->hdr.desc.domain;
+		output_hdr.level = msg->hdr.desc.level;
+		output_hdr.package_len = msg->hdr.desc.package_len;
+		output_hdr.data_len = msg->hdr.desc.data_len;
+		output_hdr.timestamp = msg->hdr.timestamp;
+		output_hdr.source = source_id;
+
+		dict_write(output, (uint8_t *)&output_hdr, sizeof(output_hdr));
+	}
 
 	size_t len;
 	uint8_t *data = log_msg_get_package(msg, &len);
 
 	if (len > 0U) {
-		buffer_write(output->func, data, len, (void *)output);
+		dict_write(output, data, len);
 	}
 
 	data = log_msg_get_data(msg, &len);
 	if (len > 0U) {
-		buffer_write(output->func, data, len, (void *)output);
+		dict_write(output, data, len);
 	}
 
 	log_output_flush(output);
@@ -64,11 +134,19 @@ void log_dict_output_msg_process(const struct log_output *output,
 
 void log_dict_output_dropped_process(const struct log_output *output, uint32_t cnt)
 {
-	struct log_dict_output_dropped_msg_t msg;
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT)) {
+		uint8_t msg[1 + 5];
+
+		msg[0] = MSG_DROPPED_MSG;
+		dict_write(output, msg, 1 + varint_encode(&msg[1], cnt));
+	} else {
+		struct log_dict_output_dropped_msg_t msg;
 
-	msg.type = MSG_DROPPED_MSG;
-	msg.num_dropped_messages = MIN(cnt, 9999);
+		msg.type = MSG_DROPPED_MSG;
+		msg.num_dropped_messages = MIN(cnt, 9999);
 
-	buffer_write(output->func, (uint8_t *)&msg, sizeof(msg),
-		     (void *)output);
+		dict_write(output, (uint8_t *)&msg, sizeof(msg));
+	}
+
+	log_output_flush(output);
 }
@@ -7,6 +7,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <errno.h>
+#include <string.h>
 #include <zephyr/lorawan/lorawan.h>
 
 #include "lw_priv.h"
@@ -75,6 +76,24 @@ static LoRaMacRegion_t selected_region = DEFAULT_LORAWAN_REGION;
 static uint8_t (*get_battery_level_user)(void);
 static void (*dr_change_cb)(enum lorawan_datarate dr);
 
+#ifdef CONFIG_LORAWAN_DOWNLINK_WORKQ
+struct downlink_msg {
+	int16_t rssi;
+	int8_t snr;
+	uint8_t port;
+	bool data_pending;
+	uint8_t len;
+	uint8_t data[CONFIG_LORAWAN_DOWNLINK_MAX_PAYLOAD];
+};
+
+K_THREAD_STACK_DEFINE(downlink_stack, CONFIG_LORAWAN_DOWNLINK_WORKQ_STACK_SIZE);
+K_MSGQ_DEFINE(downlink_msgq, sizeof(struct downlink_msg),
+	      CONFIG_LORAWAN_DOWNLINK_QUEUE_SIZE, 4);
+
+static struct k_work_q downlink_workq;
+static struct k_work downlink_work;
+#endif
+
 /* implementation required by the soft-se (software secure element) */
 void BoardGetUniqueId(uint8_t *id)
 {
@@ -133,10 +152,62 @@ static void mcps_confirm_handler(McpsConfirm_t *mcps_confirm)
 	k_sem_give(&mcps_confirm_sem);
 }
 
-static void mcps_indication_handler(McpsIndication_t *mcps_indication)
+static void downlink_dispatch(uint8_t port, bool data_pending, int16_t rssi,
+			      int8_t snr, uint8_t len, const uint8_t *data)
 {
 	struct lorawan_downlink_cb *cb;
 
+	/* Iterate over all registered downlink callbacks */
+	SYS_SLIST_FOR_EACH_CONTAINER(&dl_callbacks, cb, node) {
+		if ((cb->port == LW_RECV_PORT_ANY) || (cb->port == port)) {
+			cb->cb(port, data_pending, rssi, snr, len, data);
+		}
+	}
+}
+
+#ifdef CONFIG_LORAWAN_DOWNLINK_WORKQ
+static void downlink_work_handler(struct k_work *work)
+{
+	struct downlink_msg msg;
+
+	ARG_UNUSED(work);
+
+	while (k_msgq_get(&downlink_msgq, &msg, K_NO_WAIT) == 0) {
+		downlink_dispatch(msg.port, msg.data_pending, msg.rssi, msg.snr,
+				  msg.len, (msg.len > 0) ? msg.data : NULL);
+	}
+}
+
+static void downlink_queue(McpsIndication_t *mcps_indication)
+{
+	struct downlink_msg msg;
+
+	if (mcps_indication->BufferSize > sizeof(msg.data)) {
+		LOG_WRN("Downlink of %u bytes dropped", mcps_indication->BufferSize);
+		return;
+	}
+
+	msg.port = mcps_indication->Port;
+	/* IsUplinkTxPending also indicates pending downlinks */
+	msg.data_pending = mcps_indication->IsUplinkTxPending == 1;
+	msg.rssi = mcps_indication->Rssi;
+	msg.snr = mcps_indication->Snr;
+	msg.len = mcps_indication->BufferSize;
+	if (msg.len > 0) {
+		memcpy(msg.data, mcps_indication->Buffer, msg.len);
+	}
+
+	if (k_msgq_put(&downlink_msgq, &msg, K_NO_WAIT) != 0) {
+		LOG_WRN("Downlink queue full, downlink dropped");
+		return;
+	}
+
+	k_work_submit_to_queue(&downlink_workq, &downlink_work);
+}
+#endif /* CONFIG_LORAWAN_DOWNLINK_WORKQ */
+
+static void mcps_indication_handler(McpsIndication_t *mcps_indication)
+{
 	LOG_DBG("Received McpsIndication %d", mcps_indication->McpsIndication);
 
 	if (mcps_indication->Status != LORAMAC_EVENT_INFO_STATUS_OK) {
@@ -150,18 +221,16 @@ static void mcps_indication_handler(McpsIndication_t *mcps_indication)
 		datarate_observe(false);
 	}
 
-	/* Iterate over all registered downlink callbacks */
-	SYS_SLIST_FOR_EACH_CONTAINER(&dl_callbacks, cb, node) {
-		if ((cb->port == LW_RECV_PORT_ANY) ||
-		    (cb->port == mcps_indication->Port)) {
-			cb->cb(mcps_indication->Port,
-			       /* IsUplinkTxPending also indicates pending downlinks */
-			       mcps_indication->IsUplinkTxPending == 1,
-			       mcps_indication->Rssi, mcps_indication->Snr,
-			       mcps_indication->BufferSize,
-			       mcps_indication->Buffer);
-		}
-	}
+#ifdef CONFIG_LORAWAN_DOWNLINK_WORKQ
+	downlink_queue(mcps_indication);
+#else
+	downlink_dispatch(mcps_indication->Port,
+			  /* IsUplinkTxPending also indicates pending downlinks */
+			  mcps_indication->IsUplinkTxPending == 1,
+			  mcps_indication->Rssi, mcps_indication->Snr,
+			  mcps_indication->BufferSize,
+			  mcps_indication->Buffer);
+#endif
 
 	last_mcps_indication_status = mcps_indication->Status;
 }
@@ -705,6 +774,14 @@ static int lorawan_init(void)
 
 	mac_callbacks.MacProcessNotify = mac_process_notify;
 
+#ifdef CONFIG_LORAWAN_DOWNLINK_WORKQ
+	k_work_init(&downlink_work, downlink_work_handler);
+	k_work_queue_start(&downlink_workq, downlink_stack,
+			   K_THREAD_STACK_SIZEOF(downlink_stack),
+			   CONFIG_LORAWAN_DOWNLINK_WORKQ_PRIORITY, NULL);
+	k_thread_name_set(&downlink_workq.thread, "lorawan_dl");
+#endif
+
 	return 0;
 }
 
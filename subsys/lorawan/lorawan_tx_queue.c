@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/lorawan/lorawan.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(lorawan, CONFIG_LORAWAN_LOG_LEVEL);
+
+struct tx_queue_msg {
+	sys_snode_t node;
+	lorawan_send_cb_t cb;
+	void *user_data;
+	enum lorawan_message_type type;
+	uint8_t flags;
+	uint8_t port;
+	uint8_t len;
+	uint8_t data[CONFIG_LORAWAN_TX_QUEUE_MAX_PAYLOAD];
+};
+
+K_THREAD_STACK_DEFINE(tx_queue_stack, CONFIG_LORAWAN_TX_QUEUE_STACK_SIZE);
+
+/*
+ * lorawan_send() blocks until the MAC is done with the uplink, a dedicated
+ * work queue keeps this from stalling the system work queue.
+ */
+static struct k_work_q tx_queue_workq;
+static struct k_work tx_queue_work;
+
+K_MEM_SLAB_DEFINE_STATIC(tx_queue_slab, sizeof(struct tx_queue_msg),
+			 CONFIG_LORAWAN_TX_QUEUE_SIZE, 4);
+
+/* Uplinks waiting to be sent, priority uplinks first */
+static sys_slist_t tx_queue_list;
+static struct k_spinlock tx_queue_lock;
+
+static void tx_queue_handler(struct k_work *work)
+{
+	struct tx_queue_msg *msg;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+	int err;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		key = k_spin_lock(&tx_queue_lock);
+		node = sys_slist_get(&tx_queue_list);
+		k_spin_unlock(&tx_queue_lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		/* The message is no longer in the list, nothing is merged into it */
+		msg = CONTAINER_OF(node, struct tx_queue_msg, node);
+
+		err = lorawan_send(msg->port, msg->data, msg->len, msg->type);
+		if (err != 0) {
+			LOG_ERR("Sending queued uplink to port %d failed: %d",
+				msg->port, err);
+		}
+
+		if (msg->cb != NULL) {
+			msg->cb(err, msg->user_data);
+		}
+
+		k_mem_slab_free(&tx_queue_slab, (void *)msg);
+	}
+}
+
+/* Returns the last queued message the payload can be merged into, if any */
+static struct tx_queue_msg *tx_queue_coalesce_find(uint8_t port, uint8_t len,
+						   enum lorawan_message_type type,
+						   lorawan_send_cb_t cb,
+						   void *user_data,
+						   uint8_t max_len)
+{
+	struct tx_queue_msg *msg;
+	struct tx_queue_msg *last = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&tx_queue_list, msg, node) {
+		if ((msg->flags & LORAWAN_SEND_COALESCE) != 0U &&
+		    msg->port == port && msg->type == type &&
+		    msg->cb == cb && msg->user_data == user_data) {
+			last = msg;
+		}
+	}
+
+	if (last == NULL || last->len + len > max_len) {
+		return NULL;
+	}
+
+	return last;
+}
+
+int lorawan_send_async(uint8_t port, const uint8_t *data, uint8_t len,
+		       enum lorawan_message_type type, uint8_t flags,
+		       lorawan_send_cb_t cb, void *user_data)
+{
+	struct tx_queue_msg *msg;
+	struct tx_queue_msg *prio;
+	struct tx_queue_msg *prev = NULL;
+	k_spinlock_key_t key;
+	uint8_t max_next_len;
+	uint8_t max_len;
+
+	if (data == NULL) {
+		return -EINVAL;
+	}
+
+	if (len > CONFIG_LORAWAN_TX_QUEUE_MAX_PAYLOAD) {
+		return -EMSGSIZE;
+	}
+
+	if ((flags & LORAWAN_SEND_COALESCE) != 0U) {
+		lorawan_get_payload_sizes(&max_next_len, &max_len);
+		max_len = MIN(max_len, CONFIG_LORAWAN_TX_QUEUE_MAX_PAYLOAD);
+
+		key = k_spin_lock(&tx_queue_lock);
+		msg = tx_queue_coalesce_find(port, len, type, cb, user_data, max_len);
+		if (msg != NULL) {
+			memcpy(&msg->data[msg->len], data, len);
+			msg->len += len;
+			k_spin_unlock(&tx_queue_lock, key);
+
+			LOG_DBG("Merged %u bytes into queued uplink to port %d", len, port);
+			return 0;
+		}
+		k_spin_unlock(&tx_queue_lock, key);
+	}
+
+	if (k_mem_slab_alloc(&tx_queue_slab, (void **)&msg, K_NO_WAIT) != 0) {
+		return -ENOMEM;
+	}
+
+	msg->cb = cb;
+	msg->user_data = user_data;
+	msg->type = type;
+	msg->flags = flags;
+	msg->port = port;
+	msg->len = len;
+	memcpy(msg->data, data, len);
+
+	key = k_spin_lock(&tx_queue_lock);
+
+	if ((flags & LORAWAN_SEND_PRIORITY) != 0U) {
+		/* Behind the priority uplinks queued before */
+		SYS_SLIST_FOR_EACH_CONTAINER(&tx_queue_list, prio, node) {
+			if ((prio->flags & LORAWAN_SEND_PRIORITY) == 0U) {
+				break;
+			}
+			prev = prio;
+		}
+
+		if (prev == NULL) {
+			sys_slist_prepend(&tx_queue_list, &msg->node);
+		} else {
+			sys_slist_insert(&tx_queue_list, &prev->node, &msg->node);
+		}
+	} else {
+		sys_slist_append(&tx_queue_list, &msg->node);
+	}
+
+	k_spin_unlock(&tx_queue_lock, key);
+
+	k_work_submit_to_queue(&tx_queue_workq, &tx_queue_work);
+
+	return 0;
+}
+
+static int lorawan_tx_queue_init(void)
+{
+	sys_slist_init(&tx_queue_list);
+	k_work_init(&tx_queue_work, tx_queue_handler);
+
+	k_work_queue_start(&tx_queue_workq, tx_queue_stack,
+			   K_THREAD_STACK_SIZEOF(tx_queue_stack),
+			   CONFIG_LORAWAN_TX_QUEUE_PRIORITY, NULL);
+	k_thread_name_set(&tx_queue_workq.thread, "lorawan_tx");
+
+	return 0;
+}
+
+SYS_INIT(lorawan_tx_queue_init, POST_KERNEL, 0);
@@ -13,7 +13,9 @@
 #include <mgmt/mcumgr/grp/fs_mgmt/fs_mgmt_config.h>
 #include <mgmt/mcumgr/grp/fs_mgmt/fs_mgmt_hash_checksum_sha256.h>
 
-#if defined(CONFIG_TINYCRYPT_SHA256)
+#if defined(CONFIG_MCUMGR_GRP_FS_HASH_SHA256_CRYPTO_DEV)
+#include <zephyr/crypto/crypto.h>
+#elif defined(CONFIG_TINYCRYPT_SHA256)
 #include <tinycrypt/constants.h>
 #include <tinycrypt/sha256.h>
 #else
@@ -23,7 +25,71 @@
 
 #define SHA256_DIGEST_SIZE 32
 
-#if defined(CONFIG_TINYCRYPT_SHA256)
+#if defined(CONFIG_MCUMGR_GRP_FS_HASH_SHA256_CRYPTO_DEV)
+/* Crypto device SHA256 implementation */
+static int fs_mgmt_hash_checksum_sha256(struct fs_file_t *file, uint8_t *output,
+					size_t *out_len, size_t len)
+{
+	const struct device *dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_crypto));
+	int rc = 0;
+	ssize_t bytes_read = 0;
+	size_t read_size = CONFIG_MCUMGR_GRP_FS_CHECKSUM_HASH_CHUNK_SIZE;
+	uint8_t buffer[CONFIG_MCUMGR_GRP_FS_CHECKSUM_HASH_CHUNK_SIZE];
+	struct hash_ctx ctx = {
+		.flags = CAP_SEPARATE_IO_BUFS | CAP_SYNC_OPS,
+	};
+	struct hash_pkt pkt = {
+		.in_buf = buffer,
+		.out_buf = output,
+	};
+
+	/* Clear variables prior to calculation */
+	*out_len = 0;
+	memset(output, 0, SHA256_DIGEST_SIZE);
+
+	if (!device_is_ready(dev) ||
+	    hash_begin_session(dev, &ctx, CRYPTO_HASH_ALGO_SHA256) != 0) {
+		return MGMT_ERR_EUNKNOWN;
+	}
+
+	/* Read all data from file and add to SHA256 hash calculation */
+	do {
+		if ((read_size + *out_len) >= len) {
+			/* Limit read size to size of requested data */
+			read_size = len - *out_len;
+		}
+
+		bytes_read = fs_read(file, buffer, read_size);
+
+		if (bytes_read < 0) {
+			/* Failed to read file data, pass generic unknown error back */
+			rc = MGMT_ERR_EUNKNOWN;
+			goto error;
+		} else if (bytes_read > 0) {
+			pkt.in_len = bytes_read;
+
+			if (hash_update(&ctx, &pkt) != 0) {
+				rc = MGMT_ERR_EUNKNOWN;
+				goto error;
+			}
+
+			*out_len += bytes_read;
+		}
+	} while (bytes_read > 0 && *out_len < len);
+
+	/* Finalise SHA256 hash calculation and store output in provided output buffer */
+	pkt.in_len = 0;
+
+	if (hash_compute(&ctx, &pkt) != 0) {
+		rc = MGMT_ERR_EUNKNOWN;
+	}
+
+error:
+	hash_free_session(dev, &ctx);
+
+	return rc;
+}
+#elif defined(CONFIG_TINYCRYPT_SHA256)
 /* Tinycrypt SHA256 implementation */
 static int fs_mgmt_hash_checksum_sha256(struct fs_file_t *file, uint8_t *output,
 					size_t *out_len, size_t len)
@@ -103,6 +103,17 @@ uint8_t img_mgmt_state_flags(int query_slot);
  */
 int img_mgmt_erase_image_data(unsigned int off, unsigned int num_bytes);
 
+/**
+ * Forgets the last verified image, to be called before a slot is written or erased.
+ */
+#ifdef CONFIG_MCUMGR_GRP_IMG_CHECK_CACHE
+void img_mgmt_check_cache_invalidate(void);
+#else
+static inline void img_mgmt_check_cache_invalidate(void)
+{
+}
+#endif
+
 /**
  * Erases a flash sector as image upload crosses a sector boundary.
  * Erasing the entire flash size at one time can take significant time,
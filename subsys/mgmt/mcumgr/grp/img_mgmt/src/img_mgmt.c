@@ -86,6 +86,37 @@ struct img_mgmt_state g_img_mgmt_state;
 static K_MUTEX_DEFINE(img_mgmt_mutex);
 #endif
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_CHECK_CACHE
+/* Last image verified in a slot, forgotten when a slot is written or erased */
+static struct {
+	int area_id;
+	size_t size;
+	uint8_t data_sha[IMG_MGMT_DATA_SHA_LEN];
+} img_mgmt_check_cache = {
+	.area_id = -1,
+};
+
+void img_mgmt_check_cache_invalidate(void)
+{
+	img_mgmt_check_cache.area_id = -1;
+}
+#endif
+
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+/* Chunk received ahead of the expected offset, free if len is 0 */
+struct img_mgmt_upload_range {
+	size_t off;
+	size_t len;
+};
+
+/* Data at image offset off is held at index off % CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW, all
+ * the buffered data is within the window following the expected offset.
+ */
+static uint8_t img_mgmt_upload_window_buf[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW];
+static struct img_mgmt_upload_range
+	img_mgmt_upload_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNKS];
+#endif
+
 #ifdef CONFIG_MCUMGR_GRP_IMG_VERBOSE_ERR
 const char *img_mgmt_err_str_app_reject = "app reject";
 const char *img_mgmt_err_str_hdr_malformed = "header malformed";
@@ -303,6 +334,44 @@ img_mgmt_find_by_hash(uint8_t *find, struct image_version *ver)
 	return -1;
 }
 
+#ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
+/*
+ * Checks that the slot being uploaded to holds the data whose full SHA256 hash was given
+ * with the first chunk, returns 0 if it does.
+ */
+static int
+img_mgmt_check_upload_data(struct flash_img_context *ctx)
+{
+	struct flash_img_check fic = {
+		.match = g_img_mgmt_state.data_sha,
+		.clen = g_img_mgmt_state.size,
+	};
+	int rc;
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_CHECK_CACHE
+	if (img_mgmt_check_cache.area_id == g_img_mgmt_state.area_id &&
+	    img_mgmt_check_cache.size == g_img_mgmt_state.size &&
+	    memcmp(img_mgmt_check_cache.data_sha, g_img_mgmt_state.data_sha,
+		   IMG_MGMT_DATA_SHA_LEN) == 0) {
+		return 0;
+	}
+#endif
+
+	rc = flash_img_check(ctx, &fic, g_img_mgmt_state.area_id);
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_CHECK_CACHE
+	if (rc == 0) {
+		img_mgmt_check_cache.area_id = g_img_mgmt_state.area_id;
+		img_mgmt_check_cache.size = g_img_mgmt_state.size;
+		memcpy(img_mgmt_check_cache.data_sha, g_img_mgmt_state.data_sha,
+		       IMG_MGMT_DATA_SHA_LEN);
+	}
+#endif
+
+	return rc;
+}
+#endif
+
 /*
  * Resets upload status to defaults (no upload in progress)
  */
@@ -315,9 +384,116 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+	memset(img_mgmt_upload_window, 0, sizeof(img_mgmt_upload_window));
+#endif
 	img_mgmt_release_lock();
 }
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+/*
+ * Buffers a chunk received ahead of the expected offset, returns false if it is dropped
+ */
+static bool
+img_mgmt_upload_window_put(const struct img_mgmt_upload_req *req)
+{
+	size_t off = req->off;
+	const uint8_t *data = req->img_data.value;
+	size_t len = req->img_data.len;
+	struct img_mgmt_upload_range *range = NULL;
+
+	if (g_img_mgmt_state.area_id == -1 || len == 0 || off <= g_img_mgmt_state.off ||
+	    off + len > g_img_mgmt_state.size ||
+	    off + len > g_img_mgmt_state.off + CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW) {
+		return false;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_upload_window); i++) {
+		if (img_mgmt_upload_window[i].len != 0 && img_mgmt_upload_window[i].off == off &&
+		    img_mgmt_upload_window[i].len >= len) {
+			/* Retransmission of a buffered chunk */
+			return true;
+		}
+
+		if (range == NULL && img_mgmt_upload_window[i].len == 0) {
+			range = &img_mgmt_upload_window[i];
+		}
+	}
+
+	if (range == NULL) {
+		return false;
+	}
+
+	range->off = off;
+	range->len = len;
+
+	while (len > 0) {
+		size_t pos = off % CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW;
+		size_t n = MIN(len, CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW - pos);
+
+		memcpy(&img_mgmt_upload_window_buf[pos], data, n);
+		off += n;
+		data += n;
+		len -= n;
+	}
+
+	return true;
+}
+
+/*
+ * Writes the buffered chunks which follow the expected offset, sets last if the end of the
+ * image has been written.
+ */
+static int
+img_mgmt_upload_window_drain(bool *last)
+{
+	bool progress;
+
+	do {
+		progress = false;
+
+		for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_upload_window); i++) {
+			struct img_mgmt_upload_range *range = &img_mgmt_upload_window[i];
+			size_t end = range->off + range->len;
+			size_t len;
+
+			if (range->len == 0 || range->off > g_img_mgmt_state.off) {
+				continue;
+			}
+
+			range->len = 0;
+
+			if (end <= g_img_mgmt_state.off) {
+				/* Already written */
+				continue;
+			}
+
+			len = end - g_img_mgmt_state.off;
+			progress = true;
+
+			while (len > 0) {
+				size_t pos = g_img_mgmt_state.off % CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW;
+				size_t n = MIN(len, CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW - pos);
+				int rc;
+
+				*last = (g_img_mgmt_state.off + n == g_img_mgmt_state.size);
+				rc = img_mgmt_write_image_data(g_img_mgmt_state.off,
+							       &img_mgmt_upload_window_buf[pos], n,
+							       *last);
+				if (rc != 0) {
+					return rc;
+				}
+
+				g_img_mgmt_state.off += n;
+				len -= n;
+			}
+		}
+	} while (progress);
+
+	return 0;
+}
+#endif
+
 static int
 img_mgmt_get_other_slot(void)
 {
@@ -469,6 +645,7 @@ img_mgmt_upload(struct smp_streamer *ctxt)
 		.img_data = { 0 },
 		.data_sha = { 0 },
 		.upgrade = false,
+		.delta = false,
 		.image = 0,
 	};
 	int rc;
@@ -497,7 +674,10 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		ZCBOR_MAP_DECODE_KEY_DECODER("len", zcbor_size_decode, &req.size),
 		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_size_decode, &req.off),
 		ZCBOR_MAP_DECODE_KEY_DECODER("sha", zcbor_bstr_decode, &req.data_sha),
-		ZCBOR_MAP_DECODE_KEY_DECODER("upgrade", zcbor_bool_decode, &req.upgrade)
+		ZCBOR_MAP_DECODE_KEY_DECODER("upgrade", zcbor_bool_decode, &req.upgrade),
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+		ZCBOR_MAP_DECODE_KEY_DECODER("delta", zcbor_bool_decode, &req.delta),
+#endif
 	};
 
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
@@ -543,6 +723,12 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		/* Request specifies incorrect offset.  Respond with a success code and
 		 * the correct offset.
 		 */
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		/* Keep a chunk sent ahead to write it once the data before it arrives */
+		if (!img_mgmt_upload_window_put(&req)) {
+			LOG_DBG("Dropped image chunk at offset %zu", req.off);
+		}
+#endif
 		rc = img_mgmt_upload_good_rsp(ctxt);
 		img_mgmt_release_lock();
 		return rc;
@@ -580,11 +766,21 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		 */
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 		struct flash_img_context ctx;
-		struct flash_img_check fic;
 #endif
 
 		g_img_mgmt_state.off = 0;
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+		/* A delta patch applies to the image running from the primary slot */
+		g_img_mgmt_state.delta = req.delta;
+		g_img_mgmt_state.delta_src_area_id =
+			img_mgmt_flash_area_id(img_mgmt_active_slot(req.image));
+#endif
+
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		memset(img_mgmt_upload_window, 0, sizeof(img_mgmt_upload_window));
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &ret_rc,
 					   &ret_group);
@@ -608,13 +804,11 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 		/* Check if the existing image hash matches the hash of the underlying data,
 		 * this check can only be performed if the provided hash is a full SHA256 hash
 		 * of the file that is being uploaded, do not attempt the check if the length
-		 * of the provided hash is less.
+		 * of the provided hash is less or if the file is a delta patch.
 		 */
-		if (g_img_mgmt_state.data_sha_len == IMG_MGMT_DATA_SHA_LEN) {
-			fic.match = g_img_mgmt_state.data_sha;
-			fic.clen = g_img_mgmt_state.size;
-
-			if (flash_img_check(&ctx, &fic, g_img_mgmt_state.area_id) == 0) {
+		if (g_img_mgmt_state.data_sha_len == IMG_MGMT_DATA_SHA_LEN &&
+		    !g_img_mgmt_state.delta) {
+			if (img_mgmt_check_upload_data(&ctx) == 0) {
 				/* Underlying data already matches, no need to upload any more,
 				 * set offset to image size so client knows upload has finished.
 				 */
@@ -633,9 +827,10 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #endif
 
 #ifndef CONFIG_IMG_ERASE_PROGRESSIVELY
-		/* erase the entire req.size all at once */
+		/* erase the entire image size all at once */
 		if (action.erase) {
-			rc = img_mgmt_erase_image_data(0, req.size);
+			rc = img_mgmt_erase_image_data(0, g_img_mgmt_state.delta ?
+							  action.delta_size : req.size);
 			if (rc != 0) {
 				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(&action,
 					img_mgmt_err_str_flash_erase_failed);
@@ -661,7 +856,13 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+			/* Chunks received ahead may now follow the written data */
+			rc = img_mgmt_upload_window_drain(&last);
+#endif
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
@@ -686,13 +887,13 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 			static struct flash_img_context ctx;
 
-			if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) == 0) {
-				struct flash_img_check fic = {
-					.match = g_img_mgmt_state.data_sha,
-					.clen = g_img_mgmt_state.size,
-				};
-
-				if (flash_img_check(&ctx, &fic, g_img_mgmt_state.area_id) == 0) {
+			if (g_img_mgmt_state.delta) {
+				/* The hash is that of the patch, MCUboot validates the rebuilt
+				 * image before booting it.
+				 */
+				LOG_INF("Delta patch applied");
+			} else if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) == 0) {
+				if (img_mgmt_check_upload_data(&ctx) == 0) {
 					data_match = true;
 				} else {
 					LOG_ERR("Uploaded image sha256 hash verification failed");
@@ -732,7 +933,7 @@ end:
 		rc = img_mgmt_upload_good_rsp(ctxt);
 
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
-		if (last && rc == MGMT_ERR_EOK) {
+		if (last && rc == MGMT_ERR_EOK && !g_img_mgmt_state.delta) {
 			/* Append status to last packet */
 			ok = zcbor_tstr_put_lit(zse, "match")	&&
 			     zcbor_bool_put(zse, data_match);
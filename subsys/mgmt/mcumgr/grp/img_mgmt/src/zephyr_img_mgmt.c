@@ -19,6 +19,10 @@
 
 #include <mgmt/mcumgr/grp/img_mgmt/img_mgmt_priv.h>
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+#include <zephyr/dfu/flash_img_delta.h>
+#endif
+
 LOG_MODULE_DECLARE(mcumgr_img_grp, CONFIG_MCUMGR_GRP_IMG_LOG_LEVEL);
 
 #define SLOT0_PARTITION		slot0_partition
@@ -304,6 +308,7 @@ int img_mgmt_erase_slot(int slot)
 	rc = img_mgmt_flash_check_empty_inner(fa);
 
 	if (rc == 0) {
+		img_mgmt_check_cache_invalidate();
 		rc = flash_area_erase(fa, 0, fa->fa_size);
 
 		if (rc != 0) {
@@ -374,6 +379,44 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 	return 0;
 }
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+static struct flash_img_delta_context img_mgmt_delta_ctx;
+
+/*
+ * Prepares a new upload of a delta patch, which is applied to the image it was created from
+ * while the image it rebuilds is written through the flash image context.
+ */
+static int img_mgmt_delta_init(struct flash_img_context *ctx)
+{
+	if (!g_img_mgmt_state.delta) {
+		return 0;
+	}
+
+	return flash_img_delta_init(&img_mgmt_delta_ctx, ctx, g_img_mgmt_state.delta_src_area_id);
+}
+
+static int img_mgmt_buffered_write(struct flash_img_context *ctx, const void *data,
+				   unsigned int num_bytes, bool last)
+{
+	if (g_img_mgmt_state.delta) {
+		return flash_img_delta_write(&img_mgmt_delta_ctx, data, num_bytes, last);
+	}
+
+	return flash_img_buffered_write(ctx, data, num_bytes, last);
+}
+#else
+static inline int img_mgmt_delta_init(struct flash_img_context *ctx)
+{
+	return 0;
+}
+
+static inline int img_mgmt_buffered_write(struct flash_img_context *ctx, const void *data,
+					  unsigned int num_bytes, bool last)
+{
+	return flash_img_buffered_write(ctx, data, num_bytes, last);
+}
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_USE_HEAP_FOR_FLASH_IMG_CONTEXT)
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last)
@@ -389,6 +432,8 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 	int rc = IMG_MGMT_RET_RC_OK;
 	static struct flash_img_context *ctx;
 
+	img_mgmt_check_cache_invalidate();
+
 	if (offset != 0 && ctx == NULL) {
 		return IMG_MGMT_RET_RC_FLASH_CONTEXT_NOT_SET;
 	}
@@ -403,13 +448,14 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 			return IMG_MGMT_RET_RC_NO_FREE_MEMORY;
 		}
 
-		if (flash_img_init_id(ctx, g_img_mgmt_state.area_id) != 0) {
+		if (flash_img_init_id(ctx, g_img_mgmt_state.area_id) != 0 ||
+		    img_mgmt_delta_init(ctx) != 0) {
 			rc = IMG_MGMT_RET_RC_FLASH_OPEN_FAILED;
 			goto out;
 		}
 	}
 
-	if (flash_img_buffered_write(ctx, data, num_bytes, last) != 0) {
+	if (img_mgmt_buffered_write(ctx, data, num_bytes, last) != 0) {
 		rc = IMG_MGMT_RET_RC_FLASH_WRITE_FAILED;
 		goto out;
 	}
@@ -428,13 +474,16 @@ int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned in
 {
 	static struct flash_img_context ctx;
 
+	img_mgmt_check_cache_invalidate();
+
 	if (offset == 0) {
-		if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) != 0) {
+		if (flash_img_init_id(&ctx, g_img_mgmt_state.area_id) != 0 ||
+		    img_mgmt_delta_init(&ctx) != 0) {
 			return IMG_MGMT_RET_RC_FLASH_OPEN_FAILED;
 		}
 	}
 
-	if (flash_img_buffered_write(&ctx, data, num_bytes, last) != 0) {
+	if (img_mgmt_buffered_write(&ctx, data, num_bytes, last) != 0) {
 		return IMG_MGMT_RET_RC_FLASH_WRITE_FAILED;
 	}
 
@@ -478,6 +527,7 @@ int img_mgmt_erase_image_data(unsigned int off, unsigned int num_bytes)
 
 	size_t erase_size = page.start_offset + page.size - fa->fa_off;
 
+	img_mgmt_check_cache_invalidate();
 	rc = flash_area_erase(fa, 0, erase_size);
 
 	if (rc != 0) {
@@ -571,8 +621,25 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 	if (req->off == 0) {
 		/* First upload chunk. */
 		const struct flash_area *fa;
+		size_t img_size = req->size;
+		bool delta = false;
+
+#ifdef CONFIG_MCUMGR_GRP_IMG_DELTA
+		delta = req->delta;
+		if (delta) {
+			/* The image header is only known once the patch is applied */
+			if (flash_img_delta_target_size(req->img_data.value, req->img_data.len,
+							&img_size) != 0) {
+				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
+					img_mgmt_err_str_magic_mismatch);
+				return IMG_MGMT_RET_RC_INVALID_IMAGE_HEADER_MAGIC;
+			}
+
+			action->delta_size = img_size;
+		}
+#endif
 
-		if (req->img_data.len < sizeof(struct image_header)) {
+		if (!delta && req->img_data.len < sizeof(struct image_header)) {
 			/*  Image header is the first thing in the image */
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, img_mgmt_err_str_hdr_malformed);
 			return IMG_MGMT_RET_RC_INVALID_IMAGE_HEADER;
@@ -586,7 +653,7 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 		action->size = req->size;
 
 		hdr = (struct image_header *)req->img_data.value;
-		if (hdr->ih_magic != IMAGE_MAGIC) {
+		if (!delta && hdr->ih_magic != IMAGE_MAGIC) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action, img_mgmt_err_str_magic_mismatch);
 			return IMG_MGMT_RET_RC_INVALID_IMAGE_HEADER_MAGIC;
 		}
@@ -625,16 +692,16 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 		}
 
 		/* Check that the area is of sufficient size to store the new image */
-		if (req->size > fa->fa_size) {
+		if (img_size > fa->fa_size) {
 			IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 				img_mgmt_err_str_image_too_large);
 			flash_area_close(fa);
-			LOG_ERR("Upload too large for slot: %u > %u", req->size, fa->fa_size);
+			LOG_ERR("Upload too large for slot: %zu > %zu", img_size, fa->fa_size);
 			return IMG_MGMT_RET_RC_INVALID_IMAGE_TOO_LARGE;
 		}
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_REJECT_DIRECT_XIP_MISMATCHED_SLOT)
-		if (hdr->ih_flags & IMAGE_F_ROM_FIXED) {
+		if (!delta && (hdr->ih_flags & IMAGE_F_ROM_FIXED)) {
 			if (fa->fa_off != hdr->ih_load_addr) {
 				IMG_MGMT_UPLOAD_ACTION_SET_RC_RSN(action,
 					img_mgmt_err_str_image_bad_flash_addr);
@@ -646,7 +713,7 @@ int img_mgmt_upload_inspect(const struct img_mgmt_upload_req *req,
 
 		flash_area_close(fa);
 
-		if (req->upgrade) {
+		if (req->upgrade && !delta) {
 			/* User specified upgrade-only. Make sure new image version is
 			 * greater than that of the currently running image.
 			 */
@@ -61,6 +61,12 @@ static K_TIMER_DEFINE(os_mgmt_reset_timer, os_mgmt_reset_cb, NULL);
  */
 #define TASKSTAT_COLUMNS_MAX	20
 
+/*
+ * Upper bound of the encoded size of a taskstat entry: the thread name and
+ * all the columns with their largest values.
+ */
+#define TASKSTAT_ENTRY_MAX_SIZE	(CONFIG_MCUMGR_GRP_OS_TASKSTAT_THREAD_NAME_LEN + 120)
+
 #ifdef CONFIG_MCUMGR_GRP_OS_TASKSTAT
 /* Thread iterator information passing structure */
 struct thread_iterator_info {
@@ -256,6 +262,7 @@ static void os_mgmt_taskstat_encode_one(const struct k_thread *thread, void *use
 
 	if (iterator_ctx->ok == true) {
 		iterator_ctx->ok =
+			smp_stream_reserve(iterator_ctx->zse, TASKSTAT_ENTRY_MAX_SIZE)		&&
 			os_mgmt_taskstat_encode_thread_name(iterator_ctx->zse,
 							    iterator_ctx->thread_idx, thread)	&&
 			zcbor_map_start_encode(iterator_ctx->zse, TASKSTAT_COLUMNS_MAX)		&&
@@ -359,6 +366,11 @@ os_mgmt_mcumgr_params(struct smp_streamer *ctxt)
 	     zcbor_tstr_put_lit(zse, "buf_count")		&&
 	     zcbor_uint32_put(zse, CONFIG_MCUMGR_TRANSPORT_NETBUF_COUNT);
 
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW) && CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+	ok = ok && zcbor_tstr_put_lit(zse, "img_upload_window")	&&
+	     zcbor_uint32_put(zse, CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW);
+#endif
+
 	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
 }
 #endif
@@ -6,6 +6,9 @@
 
 #include <zephyr/sys/util.h>
 #include <zephyr/stats/stats.h>
+#ifdef CONFIG_MCUMGR_GRP_STAT_PERF
+#include <zephyr/stats/perf_stats.h>
+#endif
 #include <zephyr/logging/log.h>
 #include <string.h>
 #include <stdio.h>
@@ -108,7 +111,9 @@ stat_mgmt_foreach_entry(zcbor_state_t *zse, const char *group_name, stat_mgmt_fo
 static int
 stat_mgmt_cb_encode(zcbor_state_t *zse, struct stat_mgmt_entry *entry)
 {
-	bool ok = zcbor_tstr_put_term(zse, entry->name) &&
+	/* Name with its header of up to 3 bytes followed by a value of up to 5 bytes */
+	bool ok = smp_stream_reserve(zse, strlen(entry->name) + 8) &&
+		  zcbor_tstr_put_term(zse, entry->name) &&
 		  zcbor_uint32_put(zse, entry->value);
 
 	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
@@ -228,7 +233,8 @@ stat_mgmt_list(struct smp_streamer *ctxt)
 	do {
 		cur = stats_group_get_next(cur);
 		if (cur != NULL) {
-			ok = zcbor_tstr_put_term(zse, cur->s_name);
+			ok = smp_stream_reserve(zse, strlen(cur->s_name) + 3) &&
+			     zcbor_tstr_put_term(zse, cur->s_name);
 		}
 	} while (ok && cur != NULL);
 
@@ -239,6 +245,90 @@ stat_mgmt_list(struct smp_streamer *ctxt)
 	return 0;
 }
 
+#ifdef CONFIG_MCUMGR_GRP_STAT_PERF
+static bool
+stat_mgmt_perf_encode(zcbor_state_t *zse, const struct perf_stats_hist *hist)
+{
+	return smp_stream_reserve(zse, strlen(hist->name) + 3 + PERF_STATS_CBOR_MAX_LEN) &&
+	       zcbor_tstr_put_term(zse, hist->name) &&
+	       perf_stats_encode(zse, hist);
+}
+
+/**
+ * Command handler: stat perf
+ */
+static int
+stat_mgmt_perf(struct smp_streamer *ctxt)
+{
+	struct zcbor_string value = { 0 };
+	zcbor_state_t *zse = ctxt->writer->zs;
+	zcbor_state_t *zsd = ctxt->reader->zs;
+	char hist_name[CONFIG_MCUMGR_GRP_STAT_MAX_NAME_LEN];
+	struct perf_stats_hist *hist = NULL;
+	size_t counter;
+	bool ok;
+
+	if (!zcbor_map_start_decode(zsd)) {
+		return MGMT_ERR_EUNKNOWN;
+	}
+
+	/* Only interested in the optional "name" keyword */
+	do {
+		struct zcbor_string key;
+		static const char name_key[] = "name";
+
+		ok = zcbor_tstr_decode(zsd, &key);
+
+		if (ok) {
+			if (key.len == (ARRAY_SIZE(name_key) - 1) &&
+			    memcmp(key.value, name_key, ARRAY_SIZE(name_key) - 1) == 0) {
+				ok = zcbor_tstr_decode(zsd, &value);
+				if (!ok) {
+					return MGMT_ERR_EINVAL;
+				}
+				break;
+			}
+
+			ok = zcbor_any_skip(zsd, NULL);
+		}
+	} while (ok);
+
+	if (value.len != 0) {
+		if (value.len >= ARRAY_SIZE(hist_name)) {
+			return MGMT_ERR_EINVAL;
+		}
+
+		memcpy(hist_name, value.value, value.len);
+		hist_name[value.len] = '\0';
+
+		hist = perf_stats_find(hist_name);
+		if (hist == NULL) {
+			ok = smp_add_cmd_ret(zse, ZEPHYR_MGMT_GRP_BASIC,
+					     STAT_MGMT_RET_RC_INVALID_GROUP);
+			return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
+		}
+		counter = 1;
+	} else {
+		STRUCT_SECTION_COUNT(perf_stats_hist, &counter);
+	}
+
+	ok = zcbor_tstr_put_lit(zse, "perf") &&
+	     zcbor_map_start_encode(zse, counter);
+
+	if (hist != NULL) {
+		ok = ok && stat_mgmt_perf_encode(zse, hist);
+	} else {
+		STRUCT_SECTION_FOREACH(perf_stats_hist, cur) {
+			ok = ok && stat_mgmt_perf_encode(zse, cur);
+		}
+	}
+
+	ok = ok && zcbor_map_end_encode(zse, counter);
+
+	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
+}
+#endif /* CONFIG_MCUMGR_GRP_STAT_PERF */
+
 #ifdef CONFIG_MCUMGR_SMP_SUPPORT_ORIGINAL_PROTOCOL
 /*
  * @brief	Translate stat mgmt group error code into MCUmgr error code
@@ -273,6 +363,9 @@ static int stat_mgmt_translate_error_code(uint16_t ret)
 static struct mgmt_handler stat_mgmt_handlers[] = {
 	[STAT_MGMT_ID_SHOW] = { stat_mgmt_show, NULL },
 	[STAT_MGMT_ID_LIST] = { stat_mgmt_list, NULL },
+#ifdef CONFIG_MCUMGR_GRP_STAT_PERF
+	[STAT_MGMT_ID_PERF] = { stat_mgmt_perf, NULL },
+#endif
 };
 
 #define STAT_MGMT_HANDLER_CNT ARRAY_SIZE(stat_mgmt_handlers)
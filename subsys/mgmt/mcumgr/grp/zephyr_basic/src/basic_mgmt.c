@@ -7,14 +7,23 @@
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend_retention.h>
 #include <zephyr/storage/flash_map.h>
+#include <limits.h>
+
+#include <zcbor_common.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
 
 #include <zephyr/mgmt/mcumgr/mgmt/mgmt.h>
 #include <zephyr/mgmt/mcumgr/mgmt/handlers.h>
 #include <zephyr/mgmt/mcumgr/grp/zephyr/zephyr_basic.h>
 
+#include <mgmt/mcumgr/util/zcbor_bulk.h>
+
 LOG_MODULE_REGISTER(mcumgr_zbasic_grp, CONFIG_MCUMGR_GRP_ZBASIC_LOG_LEVEL);
 
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_STORAGE_ERASE
 #define ERASE_TARGET		storage_partition
 #define ERASE_TARGET_ID		FIXED_PARTITION_ID(ERASE_TARGET)
 
@@ -63,6 +72,57 @@ static int storage_erase_handler(struct smp_streamer *ctxt)
 
 	return MGMT_ERR_EOK;
 }
+#endif
+
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_RETAINED_LOGS
+/*
+ * Reads a chunk of the retained log messages, like a file download: the
+ * request gives the offset of the chunk and the response to the first
+ * request also contains the total length.
+ */
+static int retained_logs_handler(struct smp_streamer *ctxt)
+{
+	uint8_t data[CONFIG_MCUMGR_GRP_ZBASIC_RETAINED_LOGS_CHUNK_SIZE];
+	zcbor_state_t *zse = ctxt->writer->zs;
+	zcbor_state_t *zsd = ctxt->reader->zs;
+	uint64_t off = ULLONG_MAX;
+	size_t decoded;
+	size_t len;
+	int rc;
+	bool ok;
+
+	struct zcbor_map_decode_key_val retained_logs_decode[] = {
+		ZCBOR_MAP_DECODE_KEY_DECODER("off", zcbor_uint64_decode, &off),
+	};
+
+	ok = zcbor_map_decode_bulk(zsd, retained_logs_decode, ARRAY_SIZE(retained_logs_decode),
+				   &decoded) == 0;
+
+	if (!ok || off == ULLONG_MAX) {
+		return MGMT_ERR_EINVAL;
+	}
+
+	len = log_backend_retention_size();
+	if (off > len) {
+		return MGMT_ERR_EINVAL;
+	}
+
+	rc = log_backend_retention_read(off, data, sizeof(data));
+	if (rc < 0) {
+		ok = smp_add_cmd_ret(zse, ZEPHYR_MGMT_GRP_BASIC,
+				     ZEPHYR_MGMT_GRP_CMD_RC_RETAINED_LOGS_NOT_READY);
+	} else {
+		ok = zcbor_tstr_put_lit(zse, "off")		&&
+		     zcbor_uint64_put(zse, off)			&&
+		     zcbor_tstr_put_lit(zse, "data")		&&
+		     zcbor_bstr_encode_ptr(zse, data, rc)		&&
+		     ((off != 0)					||
+			(zcbor_tstr_put_lit(zse, "len") && zcbor_uint64_put(zse, len)));
+	}
+
+	return ok ? MGMT_ERR_EOK : MGMT_ERR_EMSGSIZE;
+}
+#endif
 
 #ifdef CONFIG_MCUMGR_SMP_SUPPORT_ORIGINAL_PROTOCOL
 /*
@@ -78,6 +138,7 @@ static int zephyr_basic_group_translate_error_code(uint16_t ret)
 
 	switch (ret) {
 	case ZEPHYR_MGMT_GRP_CMD_RC_FLASH_OPEN_FAILED:
+	case ZEPHYR_MGMT_GRP_CMD_RC_RETAINED_LOGS_NOT_READY:
 		rc = MGMT_ERR_ENOENT;
 		break;
 
@@ -95,10 +156,18 @@ static int zephyr_basic_group_translate_error_code(uint16_t ret)
 #endif
 
 static const struct mgmt_handler zephyr_mgmt_basic_handlers[] = {
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_STORAGE_ERASE
 	[ZEPHYR_MGMT_GRP_BASIC_CMD_ERASE_STORAGE] = {
 		.mh_read  = NULL,
 		.mh_write = storage_erase_handler,
 	},
+#endif
+#ifdef CONFIG_MCUMGR_GRP_ZBASIC_RETAINED_LOGS
+	[ZEPHYR_MGMT_GRP_BASIC_CMD_RETAINED_LOGS] = {
+		.mh_read  = retained_logs_handler,
+		.mh_write = NULL,
+	},
+#endif
 };
 
 static struct mgmt_group zephyr_basic_mgmt_group = {
@@ -63,6 +63,108 @@ static void cbor_nb_writer_init(struct cbor_nb_writer *cnw, struct net_buf *nb)
 	cnw->nb->len = sizeof(struct smp_hdr);
 	zcbor_new_encode_state(cnw->zs, 2, nb->data + sizeof(struct smp_hdr),
 			       net_buf_tailroom(nb), 0);
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+	cnw->frag = nb;
+#endif
+}
+
+/**
+ * Sets the length of the encoded response and returns it, header included.
+ */
+static size_t cbor_nb_writer_finish(struct cbor_nb_writer *cnw)
+{
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+	cnw->frag->len = cnw->zs->payload_mut - cnw->frag->data;
+
+	return net_buf_frags_len(cnw->nb);
+#else
+	cnw->nb->len = cnw->zs->payload_mut - cnw->nb->data;
+
+	return cnw->nb->len;
+#endif
+}
+
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+bool smp_stream_reserve(zcbor_state_t *zse, size_t len)
+{
+	struct cbor_nb_writer *cnw = CONTAINER_OF(zse, struct cbor_nb_writer, zs);
+	struct net_buf *frag;
+
+	if ((size_t)(zse->payload_end - zse->payload_mut) >= len ||
+	    !cnw->smpt->fragmented_output) {
+		return true;
+	}
+
+	frag = smp_alloc_rsp(cnw->req, cnw->smpt);
+	if (frag == NULL) {
+		return false;
+	}
+
+	/* Map and list ends are not backed up without ZCBOR_CANONICAL, the encoding simply
+	 * carries on at the start of the new buffer.
+	 */
+	cnw->frag->len = zse->payload_mut - cnw->frag->data;
+	net_buf_frag_add(cnw->nb, frag);
+	cnw->frag = frag;
+	zse->payload_mut = frag->data;
+	zse->payload_end = frag->data + net_buf_tailroom(frag);
+
+	return true;
+}
+#endif
+
+/**
+ * Frees the buffers chained to a response, each holds a copy of the transport user data.
+ */
+static void smp_free_frags(struct net_buf *nb, struct smp_transport *smpt)
+{
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+	struct net_buf *frag;
+
+	if (nb == NULL) {
+		return;
+	}
+
+	while (nb->frags != NULL) {
+		frag = nb->frags;
+		nb->frags = frag->frags;
+		frag->frags = NULL;
+		smp_free_buf(frag, smpt);
+	}
+#else
+	ARG_UNUSED(nb);
+	ARG_UNUSED(smpt);
+#endif
+}
+
+/**
+ * Transmits a response, consuming it.
+ */
+static int smp_output_rsp(struct smp_streamer *streamer, struct net_buf *rsp)
+{
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+	struct net_buf *frag;
+	int rc = 0;
+
+	/* The buffers are output in order, the peer reassembles them */
+	while (rsp != NULL && rc == 0) {
+		frag = rsp;
+		rsp = frag->frags;
+		frag->frags = NULL;
+		rc = streamer->smpt->functions.output(frag);
+	}
+
+	while (rsp != NULL) {
+		frag = rsp;
+		rsp = frag->frags;
+		frag->frags = NULL;
+		smp_free_buf(frag, streamer->smpt);
+	}
+
+	return rc;
+#else
+	return streamer->smpt->functions.output(rsp);
+#endif
 }
 
 /**
@@ -136,9 +238,7 @@ static int smp_build_err_rsp(struct smp_streamer *streamer, const struct smp_hdr
 		return MGMT_ERR_EMSGSIZE;
 	}
 
-	smp_make_rsp_hdr(req_hdr, &rsp_hdr,
-			 zsp->payload_mut - nbw->nb->data - MGMT_HDR_SIZE);
-	nbw->nb->len = zsp->payload_mut - nbw->nb->data;
+	smp_make_rsp_hdr(req_hdr, &rsp_hdr, cbor_nb_writer_finish(nbw) - MGMT_HDR_SIZE);
 	smp_write_hdr(streamer, &rsp_hdr);
 
 	return 0;
@@ -260,7 +360,7 @@ static int smp_handle_single_req(struct smp_streamer *streamer, const struct smp
 {
 	struct smp_hdr rsp_hdr;
 	struct cbor_nb_writer *nbw = streamer->writer;
-	zcbor_state_t *zsp = nbw->zs;
+	size_t len;
 	int rc;
 
 #ifdef CONFIG_MCUMGR_SMP_SUPPORT_ORIGINAL_PROTOCOL
@@ -294,9 +394,13 @@ static int smp_handle_single_req(struct smp_streamer *streamer, const struct smp
 	}
 #endif
 
-	smp_make_rsp_hdr(req_hdr, &rsp_hdr,
-			 zsp->payload_mut - nbw->nb->data - MGMT_HDR_SIZE);
-	nbw->nb->len = zsp->payload_mut - nbw->nb->data;
+	len = cbor_nb_writer_finish(nbw) - MGMT_HDR_SIZE;
+	if (len > UINT16_MAX) {
+		/* Does not fit the length field of the header */
+		return MGMT_ERR_EMSGSIZE;
+	}
+
+	smp_make_rsp_hdr(req_hdr, &rsp_hdr, len);
 	smp_write_hdr(streamer, &rsp_hdr);
 
 	return 0;
@@ -328,6 +432,7 @@ static void smp_on_err(struct smp_streamer *streamer, const struct smp_hdr *req_
 	}
 
 	/* Clear the partial response from the buffer, if any. */
+	smp_free_frags(rsp, streamer->smpt);
 	cbor_nb_writer_init(streamer->writer, rsp);
 
 	/* Build and transmit the error response. */
@@ -408,6 +513,10 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *vreq)
 			}
 
 			cbor_nb_reader_init(streamer->reader, req);
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+			streamer->writer->smpt = streamer->smpt;
+			streamer->writer->req = req;
+#endif
 			cbor_nb_writer_init(streamer->writer, rsp);
 
 			/* Process the request payload and build the response. */
@@ -417,7 +526,7 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *vreq)
 			}
 
 			/* Send the response. */
-			rc = streamer->smpt->functions.output(rsp);
+			rc = smp_output_rsp(streamer, rsp);
 			rsp = NULL;
 		} else if (IS_ENABLED(CONFIG_SMP_CLIENT) && (req_hdr.nh_op == MGMT_OP_READ_RSP ||
 			   req_hdr.nh_op == MGMT_OP_WRITE_RSP)) {
@@ -468,6 +577,7 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *vreq)
 	}
 
 	smp_free_buf(req, streamer->smpt);
+	smp_free_frags(rsp, streamer->smpt);
 	smp_free_buf(rsp, streamer->smpt);
 
 	return rc;
@@ -662,6 +662,10 @@ static void smp_bt_setup(void)
 	smp_bt_transport.functions.ud_copy = smp_bt_ud_copy;
 	smp_bt_transport.functions.ud_free = smp_bt_ud_free;
 	smp_bt_transport.functions.query_valid_check = smp_bt_query_valid_check;
+#ifdef CONFIG_MCUMGR_SMP_STREAMING_RESPONSE
+	/* Responses span notifications, the client reassembles them from their header */
+	smp_bt_transport.fragmented_output = true;
+#endif
 
 	rc = smp_transport_init(&smp_bt_transport);
 
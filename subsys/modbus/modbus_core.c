@@ -65,6 +65,9 @@ static struct modbus_context mb_ctx_tbl[] = {
 #endif
 };
 
+/* Used by servers which only have tables, every callback is NULL */
+static struct modbus_user_callbacks mbs_no_user_cb;
+
 static void modbus_rx_handler(struct k_work *item)
 {
 	struct modbus_context *ctx;
@@ -222,8 +225,8 @@ int modbus_init_server(const int iface, struct modbus_iface_param param)
 		goto init_server_error;
 	}
 
-	if (param.server.user_cb == NULL) {
-		LOG_ERR("User callbacks should be available");
+	if (param.server.user_cb == NULL && param.server.num_tables == 0) {
+		LOG_ERR("User callbacks or tables should be available");
 		rc = -EINVAL;
 		goto init_server_error;
 	}
@@ -261,7 +264,10 @@ int modbus_init_server(const int iface, struct modbus_iface_param param)
 	}
 
 	ctx->unit_id = param.server.unit_id;
-	ctx->mbs_user_cb = param.server.user_cb;
+	ctx->mbs_user_cb = (param.server.user_cb != NULL) ?
+			   param.server.user_cb : &mbs_no_user_cb;
+	ctx->mbs_tables = param.server.tables;
+	ctx->mbs_num_tables = param.server.num_tables;
 	if (IS_ENABLED(CONFIG_MODBUS_FC08_DIAGNOSTIC)) {
 		modbus_reset_stats(ctx);
 	}
@@ -323,6 +329,7 @@ int modbus_init_client(const int iface, struct modbus_iface_param param)
 
 	ctx->unit_id = 0;
 	ctx->mbs_user_cb = NULL;
+	ctx->mbs_num_tables = 0;
 	ctx->rxwait_to = param.rx_timeout;
 
 	return 0;
@@ -364,6 +371,7 @@ int modbus_disable(const uint8_t iface)
 	ctx->unit_id = 0;
 	ctx->mode = MODBUS_MODE_RTU;
 	ctx->mbs_user_cb = NULL;
+	ctx->mbs_num_tables = 0;
 	atomic_clear_bit(&ctx->state, MODBUS_STATE_CONFIGURED);
 
 	LOG_INF("Modbus interface %u disabled", iface);
@@ -118,6 +118,10 @@ struct modbus_context {
 	uint32_t rxwait_to;
 	/* Pointer to user server callbacks */
 	struct modbus_user_callbacks *mbs_user_cb;
+	/* Memory backed server tables */
+	const struct modbus_table *mbs_tables;
+	/* Number of server tables */
+	size_t mbs_num_tables;
 	/* Interface state */
 	atomic_t state;
 
@@ -91,6 +91,151 @@ static void mbs_exception_rsp(struct modbus_context *ctx, uint8_t excep_code)
 	ctx->tx_adu.length = 1;
 }
 
+/*
+ * Find the server table of the given type which holds the whole range of
+ * the request, tables are only used for requests which fit in one table.
+ */
+static const struct modbus_table *mbs_find_table(struct modbus_context *ctx,
+						 enum modbus_table_type type,
+						 uint16_t addr, uint16_t qty)
+{
+	for (size_t i = 0; i < ctx->mbs_num_tables; i++) {
+		const struct modbus_table *table = &ctx->mbs_tables[i];
+
+		if (table->type == type && addr >= table->addr &&
+		    (uint32_t)addr + qty <= (uint32_t)table->addr + table->num) {
+			return table;
+		}
+	}
+
+	return NULL;
+}
+
+/* Read coils or discrete inputs from a table, FC01 and FC02 */
+static bool mbs_table_bits_read(struct modbus_context *ctx,
+				const struct modbus_table *table,
+				uint16_t addr, uint16_t qty, uint16_t limit)
+{
+	const uint8_t *bits = table->data;
+	uint16_t offset = addr - table->addr;
+	uint8_t shift = offset % 8;
+	uint8_t *presp = &ctx->tx_adu.data[1];
+	uint16_t num_bytes;
+
+	if (qty == 0 || qty > limit) {
+		LOG_ERR("Number of coils or inputs limit exceeded");
+		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_VAL);
+		return true;
+	}
+
+	if (table->read_cb != NULL && table->read_cb(table, addr, qty) != 0) {
+		mbs_exception_rsp(ctx, MODBUS_EXC_SERVER_DEVICE_FAILURE);
+		return true;
+	}
+
+	num_bytes = DIV_ROUND_UP(qty, 8);
+	ctx->tx_adu.length = num_bytes + 1;
+	ctx->tx_adu.data[0] = (uint8_t)num_bytes;
+	bits += offset / 8;
+
+	if (shift == 0) {
+		memcpy(presp, bits, num_bytes);
+	} else {
+		for (uint16_t i = 0; i < num_bytes; i++) {
+			presp[i] = bits[i] >> shift;
+			/* Avoid reading past the end of the table */
+			if (i * 8 + 8 - shift < qty) {
+				presp[i] |= bits[i + 1] << (8 - shift);
+			}
+		}
+	}
+
+	/* Unused bits of the last byte are zero */
+	if ((qty % 8) != 0) {
+		presp[num_bytes - 1] &= BIT_MASK(qty % 8);
+	}
+
+	return true;
+}
+
+/* Read holding or input registers from a table, FC03 and FC04 */
+static bool mbs_table_regs_read(struct modbus_context *ctx,
+				const struct modbus_table *table,
+				uint16_t addr, uint16_t qty, uint16_t limit)
+{
+	const uint16_t *regs = table->data;
+	uint8_t *presp = &ctx->tx_adu.data[1];
+
+	if (qty == 0 || qty > limit) {
+		LOG_ERR("Number of registers limit exceeded");
+		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_VAL);
+		return true;
+	}
+
+	if (table->read_cb != NULL && table->read_cb(table, addr, qty) != 0) {
+		mbs_exception_rsp(ctx, MODBUS_EXC_SERVER_DEVICE_FAILURE);
+		return true;
+	}
+
+	ctx->tx_adu.length = qty * sizeof(uint16_t) + 1;
+	ctx->tx_adu.data[0] = (uint8_t)(qty * sizeof(uint16_t));
+	regs += addr - table->addr;
+
+	for (uint16_t i = 0; i < qty; i++) {
+		sys_put_be16(regs[i], presp);
+		presp += sizeof(uint16_t);
+	}
+
+	return true;
+}
+
+/*
+ * Write coils to a table, FC05 and FC15. The coil values are packed as in
+ * the FC15 request.
+ */
+static int mbs_table_coils_write(const struct modbus_table *table,
+				 uint16_t addr, uint16_t qty,
+				 const uint8_t *values)
+{
+	uint8_t *bits = table->data;
+	uint16_t offset = addr - table->addr;
+
+	for (uint16_t i = 0; i < qty; i++) {
+		uint16_t bit = offset + i;
+
+		WRITE_BIT(bits[bit / 8], bit % 8, values[i / 8] & BIT(i % 8));
+	}
+
+	if (table->write_cb != NULL) {
+		return table->write_cb(table, addr, qty);
+	}
+
+	return 0;
+}
+
+/*
+ * Write holding registers to a table, FC06 and FC16. The register values
+ * are big endian, as in the request.
+ */
+static int mbs_table_regs_write(const struct modbus_table *table,
+				uint16_t addr, uint16_t qty,
+				const uint8_t *values)
+{
+	uint16_t *regs = table->data;
+
+	regs += addr - table->addr;
+
+	for (uint16_t i = 0; i < qty; i++) {
+		regs[i] = sys_get_be16(&values[i * sizeof(uint16_t)]);
+	}
+
+	if (table->write_cb != NULL) {
+		return table->write_cb(table, addr, qty);
+	}
+
+	return 0;
+}
+
 /*
  * FC 01 (0x01) Read Coils
  *
@@ -108,6 +253,7 @@ static bool mbs_fc01_coil_read(struct modbus_context *ctx)
 {
 	const uint16_t coils_limit = 2000;
 	const uint8_t request_len = 4;
+	const struct modbus_table *table;
 	uint8_t *presp;
 	bool coil_state;
 	int err;
@@ -122,14 +268,20 @@ static bool mbs_fc01_coil_read(struct modbus_context *ctx)
 		return false;
 	}
 
+	coil_addr = sys_get_be16(&ctx->rx_adu.data[0]);
+	coil_qty = sys_get_be16(&ctx->rx_adu.data[2]);
+
+	table = mbs_find_table(ctx, MODBUS_TABLE_COILS, coil_addr, coil_qty);
+	if (table != NULL) {
+		return mbs_table_bits_read(ctx, table, coil_addr, coil_qty,
+					   coils_limit);
+	}
+
 	if (ctx->mbs_user_cb->coil_rd == NULL) {
 		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 		return true;
 	}
 
-	coil_addr = sys_get_be16(&ctx->rx_adu.data[0]);
-	coil_qty = sys_get_be16(&ctx->rx_adu.data[2]);
-
 	/* Make sure we don't exceed the allowed limit per request */
 	if (coil_qty == 0 || coil_qty > coils_limit) {
 		LOG_ERR("Number of coils limit exceeded");
@@ -207,6 +359,7 @@ static bool mbs_fc02_di_read(struct modbus_context *ctx)
 {
 	const uint16_t di_limit = 2000;
 	const uint8_t request_len = 4;
+	const struct modbus_table *table;
 	uint8_t *presp;
 	bool di_state;
 	int err;
@@ -221,14 +374,19 @@ static bool mbs_fc02_di_read(struct modbus_context *ctx)
 		return false;
 	}
 
+	di_addr = sys_get_be16(&ctx->rx_adu.data[0]);
+	di_qty = sys_get_be16(&ctx->rx_adu.data[2]);
+
+	table = mbs_find_table(ctx, MODBUS_TABLE_DISCRETE_INPUTS, di_addr, di_qty);
+	if (table != NULL) {
+		return mbs_table_bits_read(ctx, table, di_addr, di_qty, di_limit);
+	}
+
 	if (ctx->mbs_user_cb->discrete_input_rd == NULL) {
 		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 		return true;
 	}
 
-	di_addr = sys_get_be16(&ctx->rx_adu.data[0]);
-	di_qty = sys_get_be16(&ctx->rx_adu.data[2]);
-
 	/* Make sure we don't exceed the allowed limit per request */
 	if (di_qty == 0 || di_qty > di_limit) {
 		LOG_ERR("Number of inputs limit exceeded");
@@ -308,6 +466,7 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 {
 	const uint16_t regs_limit = 125;
 	const uint8_t request_len = 4;
+	const struct modbus_table *table;
 	uint8_t *presp;
 	uint16_t err;
 	uint16_t reg_addr;
@@ -322,6 +481,12 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 	reg_addr = sys_get_be16(&ctx->rx_adu.data[0]);
 	reg_qty = sys_get_be16(&ctx->rx_adu.data[2]);
 
+	table = mbs_find_table(ctx, MODBUS_TABLE_HOLDING_REGS, reg_addr, reg_qty);
+	if (table != NULL) {
+		return mbs_table_regs_read(ctx, table, reg_addr, reg_qty,
+					   regs_limit);
+	}
+
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Read integer register */
@@ -418,6 +583,7 @@ static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 {
 	const uint16_t regs_limit = 125;
 	const uint8_t request_len = 4;
+	const struct modbus_table *table;
 	uint8_t *presp;
 	int err;
 	uint16_t reg_addr;
@@ -432,6 +598,12 @@ static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 	reg_addr = sys_get_be16(&ctx->rx_adu.data[0]);
 	reg_qty = sys_get_be16(&ctx->rx_adu.data[2]);
 
+	table = mbs_find_table(ctx, MODBUS_TABLE_INPUT_REGS, reg_addr, reg_qty);
+	if (table != NULL) {
+		return mbs_table_regs_read(ctx, table, reg_addr, reg_qty,
+					   regs_limit);
+	}
+
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Read integer register */
@@ -532,17 +704,13 @@ static bool mbs_fc05_coil_write(struct modbus_context *ctx)
 	uint16_t coil_addr;
 	uint16_t coil_val;
 	bool coil_state;
+	const struct modbus_table *table;
 
 	if (ctx->rx_adu.length != request_len) {
 		LOG_ERR("Wrong request length %u", ctx->rx_adu.length);
 		return false;
 	}
 
-	if (ctx->mbs_user_cb->coil_wr == NULL) {
-		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
-		return true;
-	}
-
 	/* Get the desired coil address and coil value */
 	coil_addr = sys_get_be16(&ctx->rx_adu.data[0]);
 	coil_val = sys_get_be16(&ctx->rx_adu.data[2]);
@@ -554,6 +722,23 @@ static bool mbs_fc05_coil_write(struct modbus_context *ctx)
 		coil_state = true;
 	}
 
+	table = mbs_find_table(ctx, MODBUS_TABLE_COILS, coil_addr, 1);
+	if (table != NULL) {
+		uint8_t value = coil_state ? BIT(0) : 0;
+
+		if (mbs_table_coils_write(table, coil_addr, 1, &value) != 0) {
+			mbs_exception_rsp(ctx, MODBUS_EXC_SERVER_DEVICE_FAILURE);
+			return true;
+		}
+
+		goto coil_written;
+	}
+
+	if (ctx->mbs_user_cb->coil_wr == NULL) {
+		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
+		return true;
+	}
+
 	err = ctx->mbs_user_cb->coil_wr(coil_addr, coil_state);
 
 	if (err != 0) {
@@ -562,6 +747,7 @@ static bool mbs_fc05_coil_write(struct modbus_context *ctx)
 		return true;
 	}
 
+coil_written:
 	/* Assemble response payload */
 	ctx->tx_adu.length = response_len;
 	sys_put_be16(coil_addr, &ctx->tx_adu.data[0]);
@@ -590,20 +776,32 @@ static bool mbs_fc06_hreg_write(struct modbus_context *ctx)
 	int err;
 	uint16_t reg_addr;
 	uint16_t reg_val;
+	const struct modbus_table *table;
 
 	if (ctx->rx_adu.length != request_len) {
 		LOG_ERR("Wrong request length %u", ctx->rx_adu.length);
 		return false;
 	}
 
+	reg_addr = sys_get_be16(&ctx->rx_adu.data[0]);
+	reg_val = sys_get_be16(&ctx->rx_adu.data[2]);
+
+	table = mbs_find_table(ctx, MODBUS_TABLE_HOLDING_REGS, reg_addr, 1);
+	if (table != NULL) {
+		if (mbs_table_regs_write(table, reg_addr, 1,
+					 &ctx->rx_adu.data[2]) != 0) {
+			mbs_exception_rsp(ctx, MODBUS_EXC_SERVER_DEVICE_FAILURE);
+			return true;
+		}
+
+		goto reg_written;
+	}
+
 	if (ctx->mbs_user_cb->holding_reg_wr == NULL) {
 		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 		return true;
 	}
 
-	reg_addr = sys_get_be16(&ctx->rx_adu.data[0]);
-	reg_val = sys_get_be16(&ctx->rx_adu.data[2]);
-
 	err = ctx->mbs_user_cb->holding_reg_wr(reg_addr, reg_val);
 
 	if (err != 0) {
@@ -612,6 +810,7 @@ static bool mbs_fc06_hreg_write(struct modbus_context *ctx)
 		return true;
 	}
 
+reg_written:
 	/* Assemble response payload */
 	ctx->tx_adu.length = response_len;
 	sys_put_be16(reg_addr, &ctx->tx_adu.data[0]);
@@ -734,22 +933,24 @@ static bool mbs_fc15_coils_write(struct modbus_context *ctx)
 	uint16_t coil_cntr;
 	uint8_t data_ix;
 	bool coil_state;
+	const struct modbus_table *table;
 
 	if (ctx->rx_adu.length < request_len) {
 		LOG_ERR("Wrong request length %u", ctx->rx_adu.length);
 		return false;
 	}
 
-	if (ctx->mbs_user_cb->coil_wr == NULL) {
-		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
-		return true;
-	}
-
 	coil_addr = sys_get_be16(&ctx->rx_adu.data[0]);
 	coil_qty = sys_get_be16(&ctx->rx_adu.data[2]);
 	/* Get the byte count for the data. */
 	num_bytes = ctx->rx_adu.data[4];
 
+	table = mbs_find_table(ctx, MODBUS_TABLE_COILS, coil_addr, coil_qty);
+	if (table == NULL && ctx->mbs_user_cb->coil_wr == NULL) {
+		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
+		return true;
+	}
+
 	if (coil_qty == 0 || coil_qty > coils_limit) {
 		LOG_ERR("Number of coils limit exceeded");
 		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_VAL);
@@ -764,6 +965,16 @@ static bool mbs_fc15_coils_write(struct modbus_context *ctx)
 		return true;
 	}
 
+	if (table != NULL) {
+		if (mbs_table_coils_write(table, coil_addr, coil_qty,
+					  &ctx->rx_adu.data[5]) != 0) {
+			mbs_exception_rsp(ctx, MODBUS_EXC_SERVER_DEVICE_FAILURE);
+			return true;
+		}
+
+		goto coils_written;
+	}
+
 	coil_cntr = 0;
 	/* The 1st coil data byte is 6th element in payload */
 	data_ix = 5;
@@ -795,6 +1006,7 @@ static bool mbs_fc15_coils_write(struct modbus_context *ctx)
 		coil_cntr++;
 	}
 
+coils_written:
 	/* Assemble response payload */
 	ctx->tx_adu.length = response_len;
 	sys_put_be16(coil_addr, &ctx->tx_adu.data[0]);
@@ -834,6 +1046,7 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 	uint16_t reg_qty;
 	uint16_t num_bytes;
 	uint8_t reg_size;
+	const struct modbus_table *table;
 
 	if (ctx->rx_adu.length < request_len) {
 		LOG_ERR("Wrong request length %u", ctx->rx_adu.length);
@@ -845,6 +1058,30 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 	/* Get the byte count for the data. */
 	num_bytes = ctx->rx_adu.data[4];
 
+	table = mbs_find_table(ctx, MODBUS_TABLE_HOLDING_REGS, reg_addr, reg_qty);
+	if (table != NULL) {
+		if (reg_qty == 0 || reg_qty > regs_limit) {
+			LOG_ERR("Number of registers limit exceeded");
+			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_VAL);
+			return true;
+		}
+
+		if ((ctx->rx_adu.length - 5) != num_bytes ||
+		    num_bytes != reg_qty * sizeof(uint16_t)) {
+			LOG_ERR("Mismatch in the number of bytes");
+			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_VAL);
+			return true;
+		}
+
+		if (mbs_table_regs_write(table, reg_addr, reg_qty,
+					 &ctx->rx_adu.data[5]) != 0) {
+			mbs_exception_rsp(ctx, MODBUS_EXC_SERVER_DEVICE_FAILURE);
+			return true;
+		}
+
+		goto regs_written;
+	}
+
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Write integer register */
@@ -918,6 +1155,7 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 		}
 	}
 
+regs_written:
 	/* Assemble response payload */
 	ctx->tx_adu.length = response_len;
 	sys_put_be16(reg_addr, &ctx->tx_adu.data[0]);
@@ -232,6 +232,40 @@ static void data_unref(struct net_buf *buf, uint8_t *data)
 	pool->alloc->cb->unref(buf, data);
 }
 
+/* Attach data to a buffer just taken from its pool and initialize it */
+static int buf_init(struct net_buf_pool *pool, struct net_buf *buf, size_t size,
+		    k_timeout_t timeout)
+{
+	if (size) {
+#if __ASSERT_ON
+		size_t req_size = size;
+#endif
+		buf->__buf = data_alloc(buf, &size, timeout);
+		if (!buf->__buf) {
+			net_buf_destroy(buf);
+			return -ENOMEM;
+		}
+
+#if __ASSERT_ON
+		NET_BUF_ASSERT(req_size <= size);
+#endif
+	} else {
+		buf->__buf = NULL;
+	}
+
+	buf->ref   = 1U;
+	buf->flags = 0U;
+	buf->frags = NULL;
+	buf->size  = size;
+	net_buf_reset(buf);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_dec(&pool->avail_count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+#endif
+	return 0;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -318,37 +352,69 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 success:
 	NET_BUF_DBG("allocated buf %p", buf);
 
-	if (size) {
-#if __ASSERT_ON
-		size_t req_size = size;
-#endif
-		timeout = sys_timepoint_timeout(end);
-		buf->__buf = data_alloc(buf, &size, timeout);
-		if (!buf->__buf) {
-			NET_BUF_ERR("%s():%d: Failed to allocate data",
-				    func, line);
-			net_buf_destroy(buf);
-			return NULL;
+	if (buf_init(pool, buf, size, sys_timepoint_timeout(end)) != 0) {
+		NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+		return NULL;
+	}
+
+	return buf;
+}
+
+int net_buf_alloc_len_bulk(struct net_buf_pool *pool, size_t size,
+			   struct net_buf **bufs, int count, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int n = 0, ok = 0;
+
+	__ASSERT_NO_MSG(pool);
+
+	if (count <= 0) {
+		return 0;
+	}
+
+	/* Recycled buffers first, as net_buf_alloc_len() does */
+	while (n < count) {
+		bufs[n] = k_lifo_get(&pool->free, K_NO_WAIT);
+		if (!bufs[n]) {
+			break;
 		}
+		n++;
+	}
 
-#if __ASSERT_ON
-		NET_BUF_ASSERT(req_size <= size);
-#endif
-	} else {
-		buf->__buf = NULL;
+	/* Then claim never used buffers in one go */
+	key = k_spin_lock(&pool->lock);
+	while (n < count && pool->uninit_count) {
+		bufs[n++] = pool_get_uninit(pool, pool->uninit_count--);
 	}
+	k_spin_unlock(&pool->lock, key);
 
-	buf->ref   = 1U;
-	buf->flags = 0U;
-	buf->frags = NULL;
-	buf->size  = size;
-	net_buf_reset(buf);
+	if (n == 0) {
+		bufs[0] = net_buf_alloc_len(pool, size, timeout);
+		return bufs[0] ? 1 : -ENOMEM;
+	}
 
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-	atomic_dec(&pool->avail_count);
-	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
-#endif
-	return buf;
+	/* Keep the buffers that got their data packed at the front */
+	for (int i = 0; i < n; i++) {
+		struct net_buf *buf = bufs[i];
+
+		if (buf_init(pool, buf, size, sys_timepoint_timeout(end)) == 0) {
+			bufs[ok++] = buf;
+		}
+	}
+
+	NET_BUF_DBG("allocated %d/%d bufs from pool %p", ok, count, pool);
+
+	return ok ? ok : -ENOMEM;
+}
+
+int net_buf_alloc_bulk(struct net_buf_pool *pool, struct net_buf **bufs,
+		       int count, k_timeout_t timeout)
+{
+	const struct net_buf_pool_fixed *fixed = pool->alloc->alloc_data;
+
+	return net_buf_alloc_len_bulk(pool, fixed->data_size, bufs, count,
+				      timeout);
 }
 
 #if defined(CONFIG_NET_BUF_LOG)
@@ -458,6 +524,38 @@ void net_buf_put(struct k_fifo *fifo, struct net_buf *buf)
 	k_fifo_put(fifo, buf);
 }
 
+/* Drop a reference, releasing the data once the last one is gone.
+ * Returns the pool the buffer must then be returned to, or NULL.
+ */
+static struct net_buf_pool *buf_release(struct net_buf *buf)
+{
+	struct net_buf_pool *pool;
+
+	NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf, buf->ref,
+		    buf->pool_id, buf->frags);
+
+	if (--buf->ref > 0) {
+		return NULL;
+	}
+
+	if (buf->__buf) {
+		data_unref(buf, buf->__buf);
+		buf->__buf = NULL;
+	}
+
+	buf->data = NULL;
+	buf->frags = NULL;
+
+	pool = net_buf_pool_get(buf->pool_id);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_inc(&pool->avail_count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) <= pool->buf_count);
+#endif
+
+	return pool;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 void net_buf_unref_debug(struct net_buf *buf, const char *func, int line)
 #else
@@ -477,28 +575,11 @@ void net_buf_unref(struct net_buf *buf)
 			return;
 		}
 #endif
-		NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf, buf->ref,
-			    buf->pool_id, buf->frags);
-
-		if (--buf->ref > 0) {
+		pool = buf_release(buf);
+		if (!pool) {
 			return;
 		}
 
-		if (buf->__buf) {
-			data_unref(buf, buf->__buf);
-			buf->__buf = NULL;
-		}
-
-		buf->data = NULL;
-		buf->frags = NULL;
-
-		pool = net_buf_pool_get(buf->pool_id);
-
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-		atomic_inc(&pool->avail_count);
-		__ASSERT_NO_MSG(atomic_get(&pool->avail_count) <= pool->buf_count);
-#endif
-
 		if (pool->destroy) {
 			pool->destroy(buf);
 		} else {
@@ -509,6 +590,55 @@ void net_buf_unref(struct net_buf *buf)
 	}
 }
 
+void net_buf_unref_bulk(struct net_buf **bufs, int count)
+{
+	struct net_buf_pool *batch_pool = NULL;
+	struct net_buf *head = NULL, *tail = NULL;
+
+	for (int i = 0; i < count; i++) {
+		struct net_buf *buf = bufs[i];
+
+		while (buf) {
+			struct net_buf *frags = buf->frags;
+			struct net_buf_pool *pool = buf_release(buf);
+
+			if (!pool) {
+				break;
+			}
+
+			if (pool->destroy) {
+				pool->destroy(buf);
+				buf = frags;
+				continue;
+			}
+
+			/* Chain consecutive buffers of a pool and return
+			 * them with a single queue operation.
+			 */
+			if (pool != batch_pool && head) {
+				k_queue_append_list(&batch_pool->free._queue,
+						    head, tail);
+				head = NULL;
+			}
+
+			batch_pool = pool;
+			buf->node.next = NULL;
+			if (head) {
+				tail->node.next = &buf->node;
+			} else {
+				head = buf;
+			}
+			tail = buf;
+
+			buf = frags;
+		}
+	}
+
+	if (head) {
+		k_queue_append_list(&batch_pool->free._queue, head, tail);
+	}
+}
+
 struct net_buf *net_buf_ref(struct net_buf *buf)
 {
 	__ASSERT_NO_MSG(buf);
@@ -46,6 +46,34 @@ static inline uint8_t get_6co_cid(struct net_icmpv6_nd_opt_6co *opt)
 static struct net_6lo_context ctx_6co[CONFIG_NET_MAX_6LO_CONTEXTS];
 #endif
 
+#if defined(CONFIG_NET_6LO_COMPRESS_CACHE)
+/* The address part of the IPHC header only depends on the addresses of
+ * the packet and on the contexts, so it is computed once per flow and then
+ * copied to the following packets.
+ */
+struct net_6lo_compress_entry {
+	struct net_if *iface;
+	struct in6_addr src;
+	struct in6_addr dst;
+	struct net_linkaddr_storage ll_src;
+	struct net_linkaddr_storage ll_dst;
+
+	/* Dispatch, CID, SAC, SAM, M, DAC and DAM bits of the IPHC header */
+	uint16_t iphc;
+
+	/* Context identifier extension, if CID is set */
+	uint8_t cid;
+
+	/* Inlined source and destination addresses, as they are sent */
+	uint8_t addr_len;
+	uint8_t addr[2 * sizeof(struct in6_addr)];
+};
+
+static struct net_6lo_compress_entry compress_cache[CONFIG_NET_6LO_COMPRESS_CACHE_SIZE];
+static uint8_t compress_cache_next;
+static struct k_spinlock compress_cache_lock;
+#endif
+
 static const uint8_t udp_nhc_inline_size_table[] = {4, 3, 3, 1};
 
 static const uint8_t tf_inline_size_table[] = {4, 3, 1, 0};
@@ -155,6 +183,115 @@ static inline bool net_6lo_maddr_48_bit_compressible(struct in6_addr *addr)
 		 (addr->s6_addr[10] == 0x00));
 }
 
+#if defined(CONFIG_NET_6LO_COMPRESS_CACHE)
+static bool compress_cache_ll_ok(const struct net_linkaddr *lladdr)
+{
+	return lladdr->addr != NULL && lladdr->len <= NET_LINK_ADDR_MAX_LENGTH;
+}
+
+static bool compress_cache_ll_match(const struct net_linkaddr_storage *cached,
+				    const struct net_linkaddr *lladdr)
+{
+	return cached->len == lladdr->len && cached->type == lladdr->type &&
+	       !memcmp(cached->addr, lladdr->addr, lladdr->len);
+}
+
+static void compress_cache_ll_set(struct net_linkaddr_storage *cached,
+				  const struct net_linkaddr *lladdr)
+{
+	cached->type = lladdr->type;
+	cached->len = lladdr->len;
+	memcpy(cached->addr, lladdr->addr, lladdr->len);
+}
+
+/* Inlines the cached addresses of the flow of the packet before
+ * inline_ptr. Returns false if the flow is not cached.
+ */
+static bool compress_cache_get(struct net_pkt *pkt, struct net_ipv6_hdr *ipv6,
+			       uint8_t **inline_ptr, uint16_t *iphc,
+			       uint8_t *cid)
+{
+	struct net_linkaddr *ll_src = net_pkt_lladdr_src(pkt);
+	struct net_linkaddr *ll_dst = net_pkt_lladdr_dst(pkt);
+	struct net_6lo_compress_entry *entry;
+	k_spinlock_key_t key;
+	bool found = false;
+	int i;
+
+	if (!compress_cache_ll_ok(ll_src) || !compress_cache_ll_ok(ll_dst)) {
+		return false;
+	}
+
+	key = k_spin_lock(&compress_cache_lock);
+
+	for (i = 0; i < ARRAY_SIZE(compress_cache); i++) {
+		entry = &compress_cache[i];
+
+		if (entry->iface != net_pkt_iface(pkt) ||
+		    !net_ipv6_addr_cmp_raw(entry->dst.s6_addr, ipv6->dst) ||
+		    !net_ipv6_addr_cmp_raw(entry->src.s6_addr, ipv6->src) ||
+		    !compress_cache_ll_match(&entry->ll_dst, ll_dst) ||
+		    !compress_cache_ll_match(&entry->ll_src, ll_src)) {
+			continue;
+		}
+
+		*inline_ptr -= entry->addr_len;
+		memcpy(*inline_ptr, entry->addr, entry->addr_len);
+		*iphc = entry->iphc;
+		*cid = entry->cid;
+		found = true;
+		break;
+	}
+
+	k_spin_unlock(&compress_cache_lock, key);
+
+	return found;
+}
+
+/* Caches the addresses of the packet inlined at addr */
+static void compress_cache_put(struct net_pkt *pkt, struct net_ipv6_hdr *ipv6,
+			       const uint8_t *addr, uint8_t addr_len,
+			       uint16_t iphc, uint8_t cid)
+{
+	struct net_linkaddr *ll_src = net_pkt_lladdr_src(pkt);
+	struct net_linkaddr *ll_dst = net_pkt_lladdr_dst(pkt);
+	struct net_6lo_compress_entry *entry;
+	k_spinlock_key_t key;
+
+	if (!compress_cache_ll_ok(ll_src) || !compress_cache_ll_ok(ll_dst) ||
+	    addr_len > sizeof(entry->addr)) {
+		return;
+	}
+
+	key = k_spin_lock(&compress_cache_lock);
+
+	/* Replace the entries in turn */
+	entry = &compress_cache[compress_cache_next];
+	compress_cache_next = (compress_cache_next + 1) % ARRAY_SIZE(compress_cache);
+
+	entry->iface = net_pkt_iface(pkt);
+	net_ipv6_addr_copy_raw(entry->src.s6_addr, ipv6->src);
+	net_ipv6_addr_copy_raw(entry->dst.s6_addr, ipv6->dst);
+	compress_cache_ll_set(&entry->ll_src, ll_src);
+	compress_cache_ll_set(&entry->ll_dst, ll_dst);
+	entry->iphc = iphc;
+	entry->cid = cid;
+	entry->addr_len = addr_len;
+	memcpy(entry->addr, addr, addr_len);
+
+	k_spin_unlock(&compress_cache_lock, key);
+}
+
+static void compress_cache_flush(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&compress_cache_lock);
+
+	memset(compress_cache, 0, sizeof(compress_cache));
+
+	k_spin_unlock(&compress_cache_lock, key);
+}
+#endif /* CONFIG_NET_6LO_COMPRESS_CACHE */
+
 #if defined(CONFIG_NET_6LO_CONTEXT)
 /* RFC 6775, 4.2, 5.4.2, 5.4.3 and 7.2*/
 static inline void set_6lo_context(struct net_if *iface, uint8_t index,
@@ -178,6 +315,11 @@ void net_6lo_set_context(struct net_if *iface,
 	int unused = -1;
 	uint8_t i;
 
+#if defined(CONFIG_NET_6LO_COMPRESS_CACHE)
+	/* The cached flows may have been compressed with the old contexts */
+	compress_cache_flush();
+#endif
+
 	/* If the context information already exists, update or remove
 	 * as per data.
 	 */
@@ -736,6 +878,10 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 	struct net_ipv6_hdr *ipv6 = NET_IPV6_HDR(pkt);
 	struct net_udp_hdr *udp;
 	uint8_t *inline_pos;
+	uint8_t cid = 0U;
+#if defined(CONFIG_NET_6LO_COMPRESS_CACHE)
+	uint8_t *addr_end;
+#endif
 
 	if (pkt->frags->len < NET_IPV6H_LEN) {
 		NET_ERR("Invalid length %d, min %d",
@@ -759,6 +905,14 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 		inline_pos = compress_nh_udp(udp, inline_pos, false);
 	}
 
+#if defined(CONFIG_NET_6LO_COMPRESS_CACHE)
+	addr_end = inline_pos;
+
+	if (compress_cache_get(pkt, ipv6, &inline_pos, &iphc, &cid)) {
+		goto addr_done;
+	}
+#endif
+
 	if (net_6lo_ll_prefix_padded_with_zeros((struct in6_addr *)ipv6->dst)) {
 		inline_pos = compress_da(ipv6, pkt, inline_pos, &iphc);
 		goto da_end;
@@ -807,24 +961,30 @@ da_end:
 	inline_pos = set_sa_inline(ipv6, inline_pos, &iphc);
 sa_end:
 
+#if defined(CONFIG_NET_6LO_CONTEXT)
+	if (src_ctx) {
+		cid = src_ctx->cid << 4;
+	}
+
+	if (dst_ctx) {
+		cid |= dst_ctx->cid & 0x0F;
+	}
+#endif
+
+#if defined(CONFIG_NET_6LO_COMPRESS_CACHE)
+	compress_cache_put(pkt, ipv6, inline_pos, addr_end - inline_pos, iphc,
+			   cid);
+addr_done:
+#endif
+
 	inline_pos = compress_hoplimit(ipv6, inline_pos, &iphc);
 	inline_pos = compress_nh(ipv6, inline_pos, &iphc);
 	inline_pos = compress_tfl(ipv6, inline_pos, &iphc);
 
-#if defined(CONFIG_NET_6LO_CONTEXT)
 	if (iphc & NET_6LO_IPHC_CID_1) {
 		inline_pos -= sizeof(uint8_t);
-		*inline_pos = 0;
-
-		if (src_ctx) {
-			*inline_pos = src_ctx->cid << 4;
-		}
-
-		if (dst_ctx) {
-			*inline_pos |= dst_ctx->cid & 0x0F;
-		}
+		*inline_pos = cid;
 	}
-#endif
 
 	inline_pos -= sizeof(iphc);
 	iphc = htons(iphc);
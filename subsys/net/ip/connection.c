@@ -18,6 +18,8 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #include <errno.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/hash_function.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
@@ -116,6 +118,125 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Connections with both addresses and ports specified */
+#define NET_CONN_FULLY_SPEC (NET_CONN_REMOTE_ADDR_SPEC |		\
+			     NET_CONN_LOCAL_ADDR_SPEC |			\
+			     NET_CONN_REMOTE_PORT_SPEC |		\
+			     NET_CONN_LOCAL_PORT_SPEC)
+
+/* Fully specified connections by addresses and ports, other connections
+ * by local port, and connections without a local port.
+ */
+static sys_slist_t conn_exact[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_by_port[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_wildcard;
+
+/* Odd while conn_lock holders change the lists, so that lookups done
+ * without the lock can tell that they raced with them.
+ */
+static atomic_t conn_seq;
+
+struct conn_hash_key {
+	uint8_t remote_addr[sizeof(struct in6_addr)];
+	uint8_t local_addr[sizeof(struct in6_addr)];
+	uint16_t remote_port;
+	uint16_t local_port;
+	uint16_t proto;
+	uint16_t family;
+};
+
+/* Ports are in network byte order */
+static uint32_t conn_hash_exact(uint16_t proto, uint8_t family,
+				const uint8_t *remote_addr,
+				const uint8_t *local_addr,
+				uint16_t remote_port, uint16_t local_port)
+{
+	struct conn_hash_key key = {
+		.remote_port = remote_port,
+		.local_port = local_port,
+		.proto = proto,
+		.family = family,
+	};
+	size_t len = family == AF_INET6 ? sizeof(struct in6_addr) :
+					  sizeof(struct in_addr);
+
+	memcpy(key.remote_addr, remote_addr, len);
+	memcpy(key.local_addr, local_addr, len);
+
+	return sys_hash32_murmur3(&key, sizeof(key)) %
+		CONFIG_NET_CONN_HASH_BUCKETS;
+}
+
+static uint32_t conn_hash_port(uint16_t proto, uint16_t local_port)
+{
+	uint32_t key = ((uint32_t)proto << 16) | local_port;
+
+	return sys_hash32_murmur3(&key, sizeof(key)) %
+		CONFIG_NET_CONN_HASH_BUCKETS;
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	if ((conn->family == AF_INET || conn->family == AF_INET6) &&
+	    (conn->flags & NET_CONN_FULLY_SPEC) == NET_CONN_FULLY_SPEC) {
+		const uint8_t *remote, *local;
+
+		if (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6) {
+			remote = net_sin6(&conn->remote_addr)->sin6_addr.s6_addr;
+			local = net_sin6(&conn->local_addr)->sin6_addr.s6_addr;
+		} else {
+			remote = net_sin(&conn->remote_addr)->sin_addr.s4_addr;
+			local = net_sin(&conn->local_addr)->sin_addr.s4_addr;
+		}
+
+		return &conn_exact[conn_hash_exact(conn->proto, conn->family,
+						   remote, local,
+						   net_sin(&conn->remote_addr)->sin_port,
+						   net_sin(&conn->local_addr)->sin_port)];
+	}
+
+	if ((conn->family == AF_INET || conn->family == AF_INET6 ||
+	     conn->family == AF_UNSPEC) &&
+	    (conn->flags & NET_CONN_LOCAL_PORT_SPEC)) {
+		return &conn_by_port[conn_hash_port(conn->proto,
+						    net_sin(&conn->local_addr)->sin_port)];
+	}
+
+	return &conn_wildcard;
+}
+
+static void conn_seq_begin(void)
+{
+	(void)atomic_inc(&conn_seq);
+	barrier_dmem_fence_full();
+}
+
+static void conn_seq_end(void)
+{
+	barrier_dmem_fence_full();
+	(void)atomic_inc(&conn_seq);
+}
+
+/* Called with conn_lock held */
+static void conn_hash_add(struct net_conn *conn)
+{
+	conn_seq_begin();
+	sys_slist_prepend(conn_hash_list(conn), &conn->hash_node);
+	conn_seq_end();
+}
+
+static void conn_hash_remove(struct net_conn *conn)
+{
+	sys_slist_find_and_remove(conn_hash_list(conn), &conn->hash_node);
+}
+#else
+#define conn_seq_begin(...)
+#define conn_seq_end(...)
+#define conn_hash_add(...)
+#define conn_hash_remove(...)
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -141,6 +262,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -396,10 +518,17 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	NET_DBG("Connection handler %p removed", conn);
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
-	sys_slist_find_and_remove(&conn_used, &conn->node);
-	k_mutex_unlock(&conn_lock);
 
+	/* Lookups without the lock may still be looking at the handler,
+	 * keep them from using it until it has been cleared.
+	 */
+	conn_seq_begin();
+	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_remove(conn);
 	conn_set_unused(conn);
+	conn_seq_end();
+
+	k_mutex_unlock(&conn_lock);
 
 	return 0;
 }
@@ -477,6 +606,147 @@ static bool conn_addr_cmp(struct net_pkt *pkt,
 	return true;
 }
 
+/* Check the TCP/UDP ports and addresses of a connection against a packet */
+static bool conn_addr_port_match(struct net_conn *conn, struct net_pkt *pkt,
+				 union net_ip_header *ip_hdr,
+				 uint16_t src_port, uint16_t dst_port)
+{
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+		return false; /* wrong local address */
+	}
+
+	return true;
+}
+
+static bool conn_iface_match(struct net_conn *conn, struct net_pkt *pkt)
+{
+	return conn->context == NULL ||
+	       !net_context_is_bound_to_iface(conn->context) ||
+	       net_pkt_iface(pkt) == net_context_get_iface(conn->context);
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+static bool conn_ip_match(struct net_conn *conn, struct net_pkt *pkt,
+			  union net_ip_header *ip_hdr, uint8_t proto,
+			  uint16_t src_port, uint16_t dst_port)
+{
+	if (conn->family != AF_UNSPEC && conn->family != net_pkt_family(pkt)) {
+		return false;
+	}
+
+	return conn->proto == proto && conn_iface_match(conn, pkt) &&
+	       conn_addr_port_match(conn, pkt, ip_hdr, src_port, dst_port);
+}
+
+/* Rank the candidates of a list like net_conn_input() does */
+static void conn_hash_rank(sys_slist_t *list, struct net_pkt *pkt,
+			   union net_ip_header *ip_hdr, uint8_t proto,
+			   uint16_t src_port, uint16_t dst_port,
+			   struct net_conn **best_match, int16_t *best_rank)
+{
+	struct net_conn *conn;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, conn, hash_node) {
+		if (!conn_ip_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			continue;
+		}
+
+		if (*best_match != NULL &&
+		    (*best_match)->flags & NET_CONN_REMOTE_PORT_SPEC) {
+			return; /* do not override listening connection */
+		}
+
+		if (*best_rank < NET_CONN_RANK(conn->flags)) {
+			*best_rank = NET_CONN_RANK(conn->flags);
+			*best_match = conn;
+		}
+	}
+}
+
+static struct net_conn *conn_hash_find(struct net_pkt *pkt,
+				       union net_ip_header *ip_hdr,
+				       uint8_t proto, uint16_t src_port,
+				       uint16_t dst_port)
+{
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	struct net_conn *conn;
+	const uint8_t *src, *dst;
+	uint32_t bucket;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		src = ip_hdr->ipv6->src;
+		dst = ip_hdr->ipv6->dst;
+	} else {
+		src = ip_hdr->ipv4->src;
+		dst = ip_hdr->ipv4->dst;
+	}
+
+	/* A fully specified connection outranks all others */
+	bucket = conn_hash_exact(proto, net_pkt_family(pkt), src, dst,
+				 src_port, dst_port);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_exact[bucket], conn, hash_node) {
+		if (conn_ip_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			return conn;
+		}
+	}
+
+	bucket = conn_hash_port(proto, dst_port);
+
+	conn_hash_rank(&conn_by_port[bucket], pkt, ip_hdr, proto, src_port,
+		       dst_port, &best_match, &best_rank);
+	conn_hash_rank(&conn_wildcard, pkt, ip_hdr, proto, src_port,
+		       dst_port, &best_match, &best_rank);
+
+	return best_match;
+}
+
+/* Find the handler of a unicast TCP or UDP packet */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto, uint16_t src_port,
+					 uint16_t dst_port)
+{
+	atomic_val_t seq = atomic_get(&conn_seq);
+	struct net_conn *conn;
+
+	if ((seq & 1) == 0) {
+		conn = conn_hash_find(pkt, ip_hdr, proto, src_port, dst_port);
+
+		barrier_dmem_fence_full();
+		if (atomic_get(&conn_seq) == seq) {
+			return conn;
+		}
+	}
+
+	/* Handlers were changed meanwhile, wait for that to finish */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn = conn_hash_find(pkt, ip_hdr, proto, src_port, dst_port);
+	k_mutex_unlock(&conn_lock);
+
+	return conn;
+}
+#else
+#define conn_hash_lookup(...) NULL
+#endif /* CONFIG_NET_CONN_HASH */
+
 static inline void conn_send_icmp_error(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_DISABLE_ICMP_DESTINATION_UNREACHABLE)) {
@@ -639,11 +909,17 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    (proto == IPPROTO_UDP || proto == IPPROTO_TCP) &&
+	    !(is_mcast_pkt || is_bcast_pkt)) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+		goto deliver;
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
-		if (conn->context != NULL &&
-		    net_context_is_bound_to_iface(conn->context) &&
-		    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+		if (!conn_iface_match(conn, pkt)) {
 			continue; /* wrong interface */
 		}
 
@@ -716,24 +992,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 			/* Is the candidate connection matching the packet's TCP/UDP
 			 * address and port?
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
-
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
-
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-				continue; /* wrong local address */
+			if (!conn_addr_port_match(conn, pkt, ip_hdr, src_port, dst_port)) {
+				continue;
 			}
 
 			/* If we have an existing best_match, and that one
@@ -811,6 +1071,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		return NET_OK;
 	}
 
+deliver:
 	if (best_match) {
 		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x", best_match, best_match->cb,
 			best_match->user_data, best_match->flags);
@@ -862,6 +1123,15 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	for (i = 0; i < CONFIG_NET_CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_exact[i]);
+		sys_slist_init(&conn_by_port[i]);
+	}
+
+	sys_slist_init(&conn_wildcard);
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
@@ -283,6 +283,12 @@ struct net_ipv4_reassembly {
 	/** Pointers to pending fragments */
 	struct net_pkt *pkt[CONFIG_NET_IPV4_FRAGMENT_MAX_PKT];
 
+	/** Uptime when the reassembly was started, in milliseconds */
+	uint32_t start;
+
+	/** Amount of fragment data held by the reassembly, in bytes */
+	size_t buffered;
+
 	/** IPv4 fragment identification */
 	uint16_t id;
 	uint8_t protocol;
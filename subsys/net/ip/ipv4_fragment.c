@@ -27,10 +27,45 @@ LOG_MODULE_DECLARE(net_ipv4, CONFIG_NET_IPV4_LOG_LEVEL);
 /* Timeout for various buffer allocations in this file. */
 #define NET_BUF_TIMEOUT K_MSEC(100)
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT_MAX_BUFFERED)
+#define REASSEMBLY_MAX_BUFFERED CONFIG_NET_IPV4_FRAGMENT_MAX_BUFFERED
+#else
+#define REASSEMBLY_MAX_BUFFERED 0
+#endif
+
 static void reassembly_timeout(struct k_work *work);
+static void reassembly_evict(struct net_ipv4_reassembly *reass);
 
 static struct net_ipv4_reassembly reassembly[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
 
+/* Fragment data held by all the pending reassemblies, in bytes */
+static size_t reassembly_buffered;
+
+static struct net_ipv4_reassembly *reassembly_oldest(struct net_ipv4_reassembly *skip)
+{
+	struct net_ipv4_reassembly *oldest = NULL;
+	k_ticks_t oldest_remaining = 0;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+		k_ticks_t remaining = k_work_delayable_remaining_get(&reassembly[i].timer);
+
+		if (!remaining || &reassembly[i] == skip) {
+			continue;
+		}
+
+		/* All the reassemblies have the same timeout, so the one which
+		 * expires first is the oldest.
+		 */
+		if (!oldest || remaining < oldest_remaining) {
+			oldest = &reassembly[i];
+			oldest_remaining = remaining;
+		}
+	}
+
+	return oldest;
+}
+
 static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *src,
 						  struct in_addr *dst, uint8_t protocol)
 {
@@ -55,7 +90,19 @@ static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *s
 	}
 
 	if (avail < 0) {
-		return NULL;
+		struct net_ipv4_reassembly *oldest;
+
+		if (!IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT_EVICT)) {
+			return NULL;
+		}
+
+		oldest = reassembly_oldest(NULL);
+		if (!oldest) {
+			return NULL;
+		}
+
+		reassembly_evict(oldest);
+		avail = oldest - reassembly;
 	}
 
 	k_work_reschedule(&reassembly[avail].timer, K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
@@ -65,6 +112,7 @@ static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *s
 
 	reassembly[avail].protocol = protocol;
 	reassembly[avail].id = id;
+	reassembly[avail].start = k_uptime_get_32();
 
 	return &reassembly[avail];
 }
@@ -92,6 +140,9 @@ static bool reassembly_cancel(uint32_t id, struct in_addr *src, struct in_addr *
 
 		reassembly[i].id = 0U;
 
+		reassembly_buffered -= reassembly[i].buffered;
+		reassembly[i].buffered = 0U;
+
 		for (j = 0; j < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; j++) {
 			if (!reassembly[i].pkt[j]) {
 				continue;
@@ -126,6 +177,10 @@ static void reassembly_timeout(struct k_work *work)
 
 	reassembly_info("Reassembly cancelled", reass);
 
+	if (reass->pkt[0]) {
+		net_stats_update_ipv4_frag_timeout(net_pkt_iface(reass->pkt[0]));
+	}
+
 	/* Send a ICMPv4 Time Exceeded only if we received the first fragment */
 	if (reass->pkt[0] && net_pkt_ipv4_fragment_offset(reass->pkt[0]) == 0) {
 		net_icmpv4_send_error(reass->pkt[0], NET_ICMPV4_TIME_EXCEEDED,
@@ -135,6 +190,20 @@ static void reassembly_timeout(struct k_work *work)
 	reassembly_cancel(reass->id, &reass->src, &reass->dst);
 }
 
+/* Drop an incomplete reassembly to make room for another one. Unlike a
+ * timeout, no ICMPv4 error is sent as the sender did nothing wrong.
+ */
+static void reassembly_evict(struct net_ipv4_reassembly *reass)
+{
+	reassembly_info("Reassembly evicted", reass);
+
+	if (reass->pkt[0]) {
+		net_stats_update_ipv4_frag_evicted(net_pkt_iface(reass->pkt[0]));
+	}
+
+	reassembly_cancel(reass->id, &reass->src, &reass->dst);
+}
+
 static void reassemble_packet(struct net_ipv4_reassembly *reass)
 {
 	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
@@ -147,6 +216,9 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 
 	NET_ASSERT(reass->pkt[0]);
 
+	reassembly_buffered -= reass->buffered;
+	reass->buffered = 0U;
+
 	last = net_buf_frag_last(reass->pkt[0]->buffer);
 
 	/* We start from 2nd packet which is then appended to the first one */
@@ -205,6 +277,9 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 
 	LOG_DBG("New pkt %p IPv4 len is %d bytes", pkt, net_pkt_get_len(pkt));
 
+	net_stats_update_ipv4_frag_reassembled(net_pkt_iface(pkt),
+					       k_uptime_get_32() - reass->start);
+
 	/* We need to use the queue when feeding the packet back into the
 	 * IP stack as we might run out of stack if we call processing_data()
 	 * directly. As the packet does not contain link layer header, we
@@ -289,6 +364,55 @@ static int fragments_are_ready(struct net_ipv4_reassembly *reass)
 	return 1;
 }
 
+/* Chain the data of the fragments that are contiguous with the previous one
+ * to that fragment, so that their net_pkt can be released before the whole
+ * packet has been received.
+ */
+static void coalesce_packets(struct net_ipv4_reassembly *reass)
+{
+	int i = 1;
+
+	while (i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT && reass->pkt[i]) {
+		struct net_pkt *prev = reass->pkt[i - 1];
+		struct net_pkt *pkt = reass->pkt[i];
+		uint16_t flags;
+
+		if (net_pkt_ipv4_fragment_offset(pkt) !=
+		    net_pkt_ipv4_fragment_offset(prev) +
+		    net_pkt_get_len(prev) - net_pkt_ip_hdr_len(prev)) {
+			i++;
+			continue;
+		}
+
+		net_pkt_cursor_init(pkt);
+
+		if (net_pkt_pull(pkt, net_pkt_ip_hdr_len(pkt))) {
+			/* Leave it to the reassembly */
+			i++;
+			continue;
+		}
+
+		LOG_DBG("Coalescing pkt %p (offset 0x%x) into %p", pkt,
+			net_pkt_ipv4_fragment_offset(pkt), prev);
+
+		net_buf_frag_last(prev->buffer)->frags = pkt->buffer;
+		pkt->buffer = NULL;
+
+		/* The merged fragment starts where the previous one did and
+		 * ends where this one does.
+		 */
+		flags = (prev->ipv4_fragment.flags & ~NET_IPV4_MORE_FRAG_MASK) |
+			(pkt->ipv4_fragment.flags & NET_IPV4_MORE_FRAG_MASK);
+		net_pkt_set_ipv4_fragment_flags(prev, flags);
+
+		net_pkt_unref(pkt);
+
+		memmove(&reass->pkt[i], &reass->pkt[i + 1],
+			sizeof(void *) * (CONFIG_NET_IPV4_FRAGMENT_MAX_PKT - i - 1));
+		reass->pkt[CONFIG_NET_IPV4_FRAGMENT_MAX_PKT - 1] = NULL;
+	}
+}
+
 static int shift_packets(struct net_ipv4_reassembly *reass, int pos)
 {
 	int i;
@@ -318,6 +442,7 @@ static int shift_packets(struct net_ipv4_reassembly *reass, int pos)
 enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ipv4_hdr *hdr)
 {
 	struct net_ipv4_reassembly *reass = NULL;
+	size_t len = net_pkt_get_len(pkt);
 	uint16_t flag;
 	bool found;
 	uint8_t more;
@@ -332,6 +457,7 @@ enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ip
 			       (struct in_addr *)hdr->dst, hdr->proto);
 	if (!reass) {
 		LOG_ERR("Cannot get reassembly slot, dropping pkt %p", pkt);
+		net_stats_update_ipv4_frag_drop(net_pkt_iface(pkt));
 		goto drop;
 	}
 
@@ -344,9 +470,30 @@ enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ip
 		 */
 		net_icmpv4_send_error(pkt, NET_ICMPV4_BAD_IP_HEADER,
 				      NET_ICMPV4_BAD_IP_HEADER_LENGTH);
+		net_stats_update_ipv4_frag_drop(net_pkt_iface(pkt));
 		goto drop;
 	}
 
+	if (REASSEMBLY_MAX_BUFFERED > 0) {
+		struct net_ipv4_reassembly *oldest;
+
+		while (reassembly_buffered + len > REASSEMBLY_MAX_BUFFERED) {
+			oldest = reassembly_oldest(reass);
+			if (!oldest) {
+				break;
+			}
+
+			reassembly_evict(oldest);
+		}
+
+		if (reassembly_buffered + len > REASSEMBLY_MAX_BUFFERED) {
+			LOG_ERR("Reassembly buffer full, dropping id 0x%x", reass->id);
+			net_stats_update_ipv4_frag_drop(net_pkt_iface(pkt));
+			net_pkt_unref(pkt);
+			goto drop;
+		}
+	}
+
 	/* The fragments might come in wrong order so place them in the reassembly chain in the
 	 * correct order.
 	 */
@@ -378,10 +525,14 @@ enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ip
 		 * must be discarded at this point.
 		 */
 		LOG_ERR("No slots available for 0x%x", reass->id);
+		net_stats_update_ipv4_frag_drop(net_pkt_iface(pkt));
 		net_pkt_unref(pkt);
 		goto drop;
 	}
 
+	reass->buffered += len;
+	reassembly_buffered += len;
+
 	ret = fragments_are_ready(reass);
 	if (ret < 0) {
 		LOG_ERR("Reassembled IPv4 verify failed, dropping id %u", reass->id);
@@ -391,11 +542,16 @@ enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ip
 			reass->pkt[i] = NULL;
 		}
 
+		net_stats_update_ipv4_frag_drop(net_pkt_iface(pkt));
 		net_pkt_unref(pkt);
 		goto drop;
 	} else if (ret == 0) {
 		reassembly_info("Reassembly nth pkt", reass);
 
+		if (IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT_COALESCE)) {
+			coalesce_packets(reass);
+		}
+
 		LOG_DBG("More fragments to be received");
 		goto accept;
 	}
@@ -586,9 +742,9 @@ enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
 	}
 
 	/* If we have already fragmented the packet, the ID field will contain a non-zero value
-	 * and we can skip other checks.
+	 * and we can skip other checks. TCP super-packets are segmented by the driver instead.
 	 */
-	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0) {
+	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0 && net_pkt_gso_size(pkt) == 0) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
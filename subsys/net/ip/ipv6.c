@@ -296,6 +296,36 @@ static enum net_verdict ipv6_route_packet(struct net_pkt *pkt,
 	struct in6_addr *nexthop;
 	bool found;
 
+#if defined(CONFIG_NET_ROUTE_FLOW_CACHE)
+	struct net_if *route_iface;
+	struct in6_addr flow_nexthop;
+
+	if (net_route_flow_get(net_pkt_iface(pkt), (struct in6_addr *)hdr->src,
+			       (struct in6_addr *)hdr->dst, &route_iface,
+			       &flow_nexthop)) {
+		int ret;
+
+		net_pkt_set_orig_iface(pkt, net_pkt_iface(pkt));
+
+		if (route_iface) {
+			net_pkt_set_iface(pkt, route_iface);
+		}
+
+		ret = net_route_packet(pkt, &flow_nexthop);
+		if (ret >= 0) {
+			return NET_OK;
+		}
+
+		if (ret != -ENOENT && ret != -ESRCH) {
+			goto drop;
+		}
+
+		/* The next hop is gone, look up the route again. */
+		net_route_flow_flush();
+		net_pkt_set_iface(pkt, net_pkt_orig_iface(pkt));
+	}
+#endif /* CONFIG_NET_ROUTE_FLOW_CACHE */
+
 	/* Check if the packet can be routed */
 	if (IS_ENABLED(CONFIG_NET_ROUTING)) {
 		found = net_route_get_info(NULL, (struct in6_addr *)hdr->dst,
@@ -341,6 +371,13 @@ static enum net_verdict ipv6_route_packet(struct net_pkt *pkt,
 				  (struct in6_addr *)hdr->src, 128);
 		}
 
+#if defined(CONFIG_NET_ROUTE_FLOW_CACHE)
+		net_route_flow_add(net_pkt_orig_iface(pkt),
+				   (struct in6_addr *)hdr->src,
+				   (struct in6_addr *)hdr->dst,
+				   route ? route->iface : NULL, nexthop);
+#endif
+
 		ret = net_route_packet(pkt, nexthop);
 		if (ret < 0) {
 			NET_DBG("Cannot re-route pkt %p via %s "
@@ -420,6 +420,12 @@ struct net_ipv6_reassembly {
 	/** Pointers to pending fragments */
 	struct net_pkt *pkt[CONFIG_NET_IPV6_FRAGMENT_MAX_PKT];
 
+	/** Uptime when the reassembly was started, in milliseconds */
+	uint32_t start;
+
+	/** Amount of fragment data held by the reassembly, in bytes */
+	size_t buffered;
+
 	/** IPv6 fragment identification */
 	uint32_t id;
 };
@@ -40,12 +40,22 @@ LOG_MODULE_DECLARE(net_ipv6, CONFIG_NET_IPV6_LOG_LEVEL);
 
 #define FRAG_BUF_WAIT K_MSEC(10) /* how long to max wait for a buffer */
 
+#if defined(CONFIG_NET_IPV6_FRAGMENT_MAX_BUFFERED)
+#define REASSEMBLY_MAX_BUFFERED CONFIG_NET_IPV6_FRAGMENT_MAX_BUFFERED
+#else
+#define REASSEMBLY_MAX_BUFFERED 0
+#endif
+
 static void reassembly_timeout(struct k_work *work);
+static void reassembly_evict(struct net_ipv6_reassembly *reass);
 static bool reassembly_init_done;
 
 static struct net_ipv6_reassembly
 reassembly[CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT];
 
+/* Fragment data held by all the pending reassemblies, in bytes */
+static size_t reassembly_buffered;
+
 int net_ipv6_find_last_ext_hdr(struct net_pkt *pkt, uint16_t *next_hdr_off,
 			       uint16_t *last_hdr_off)
 {
@@ -120,6 +130,33 @@ fail:
 	return -EINVAL;
 }
 
+static struct net_ipv6_reassembly *
+reassembly_oldest(struct net_ipv6_reassembly *skip)
+{
+	struct net_ipv6_reassembly *oldest = NULL;
+	k_ticks_t oldest_remaining = 0;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
+		k_ticks_t remaining =
+			k_work_delayable_remaining_get(&reassembly[i].timer);
+
+		if (!remaining || &reassembly[i] == skip) {
+			continue;
+		}
+
+		/* All the reassemblies have the same timeout, so the one
+		 * which expires first is the oldest.
+		 */
+		if (!oldest || remaining < oldest_remaining) {
+			oldest = &reassembly[i];
+			oldest_remaining = remaining;
+		}
+	}
+
+	return oldest;
+}
+
 static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 						  struct in6_addr *src,
 						  struct in6_addr *dst)
@@ -144,7 +181,19 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 	}
 
 	if (avail < 0) {
-		return NULL;
+		struct net_ipv6_reassembly *oldest;
+
+		if (!IS_ENABLED(CONFIG_NET_IPV6_FRAGMENT_EVICT)) {
+			return NULL;
+		}
+
+		oldest = reassembly_oldest(NULL);
+		if (!oldest) {
+			return NULL;
+		}
+
+		reassembly_evict(oldest);
+		avail = oldest - reassembly;
 	}
 
 	k_work_reschedule(&reassembly[avail].timer, IPV6_REASSEMBLY_TIMEOUT);
@@ -153,6 +202,7 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 	net_ipaddr_copy(&reassembly[avail].dst, dst);
 
 	reassembly[avail].id = id;
+	reassembly[avail].start = k_uptime_get_32();
 
 	return &reassembly[avail];
 }
@@ -183,6 +233,9 @@ static bool reassembly_cancel(uint32_t id,
 
 		reassembly[i].id = 0U;
 
+		reassembly_buffered -= reassembly[i].buffered;
+		reassembly[i].buffered = 0U;
+
 		for (j = 0; j < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; j++) {
 			if (!reassembly[i].pkt[j]) {
 				continue;
@@ -218,6 +271,11 @@ static void reassembly_timeout(struct k_work *work)
 
 	reassembly_info("Reassembly cancelled", reass);
 
+	if (reass->pkt[0]) {
+		net_stats_update_ipv6_frag_timeout(
+					net_pkt_iface(reass->pkt[0]));
+	}
+
 	/* Send a ICMPv6 Time Exceeded only if we received the first fragment (RFC 2460 Sec. 5) */
 	if (reass->pkt[0] && net_pkt_ipv6_fragment_offset(reass->pkt[0]) == 0) {
 		net_icmpv6_send_error(reass->pkt[0], NET_ICMPV6_TIME_EXCEEDED, 1, 0);
@@ -226,6 +284,21 @@ static void reassembly_timeout(struct k_work *work)
 	reassembly_cancel(reass->id, &reass->src, &reass->dst);
 }
 
+/* Drop an incomplete reassembly to make room for another one. Unlike a
+ * timeout, no ICMPv6 error is sent as the sender did nothing wrong.
+ */
+static void reassembly_evict(struct net_ipv6_reassembly *reass)
+{
+	reassembly_info("Reassembly evicted", reass);
+
+	if (reass->pkt[0]) {
+		net_stats_update_ipv6_frag_evicted(
+					net_pkt_iface(reass->pkt[0]));
+	}
+
+	reassembly_cancel(reass->id, &reass->src, &reass->dst);
+}
+
 static void reassemble_packet(struct net_ipv6_reassembly *reass)
 {
 	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv6_access, struct net_ipv6_hdr);
@@ -244,6 +317,9 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 
 	NET_ASSERT(reass->pkt[0]);
 
+	reassembly_buffered -= reass->buffered;
+	reass->buffered = 0U;
+
 	last = net_buf_frag_last(reass->pkt[0]->buffer);
 
 	/* We start from 2nd packet which is then appended to
@@ -341,6 +417,9 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 	NET_DBG("New pkt %p IPv6 len is %d bytes", pkt,
 		len + NET_IPV6H_LEN);
 
+	net_stats_update_ipv6_frag_reassembled(net_pkt_iface(pkt),
+					       k_uptime_get_32() - reass->start);
+
 	/* We need to use the queue when feeding the packet back into the
 	 * IP stack as we might run out of stack if we call processing_data()
 	 * directly. As the packet does not contain link layer header, we
@@ -427,6 +506,58 @@ static int fragments_are_ready(struct net_ipv6_reassembly *reass)
 	return 1;
 }
 
+/* Chain the data of the fragments that are contiguous with the previous
+ * one to that fragment, so that their net_pkt can be released before the
+ * whole packet has been received.
+ */
+static void coalesce_packets(struct net_ipv6_reassembly *reass)
+{
+	int i = 1;
+
+	while (i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT && reass->pkt[i]) {
+		struct net_pkt *prev = reass->pkt[i - 1];
+		struct net_pkt *pkt = reass->pkt[i];
+		uint16_t flags;
+
+		if (net_pkt_ipv6_fragment_offset(pkt) !=
+		    net_pkt_ipv6_fragment_offset(prev) +
+		    net_pkt_get_len(prev) - net_pkt_ipv6_fragment_start(prev) -
+		    sizeof(struct net_ipv6_frag_hdr)) {
+			i++;
+			continue;
+		}
+
+		net_pkt_cursor_init(pkt);
+
+		/* Get rid of IPv6 and fragment header */
+		if (net_pkt_pull(pkt, net_pkt_ipv6_fragment_start(pkt) +
+				 sizeof(struct net_ipv6_frag_hdr))) {
+			/* Leave it to the reassembly */
+			i++;
+			continue;
+		}
+
+		NET_DBG("Coalescing pkt %p (offset 0x%x) into %p", pkt,
+			net_pkt_ipv6_fragment_offset(pkt), prev);
+
+		net_buf_frag_last(prev->buffer)->frags = pkt->buffer;
+		pkt->buffer = NULL;
+
+		/* The merged fragment starts where the previous one did and
+		 * ends where this one does.
+		 */
+		flags = (prev->ipv6_fragment.flags & NET_IPV6_FRAGH_OFFSET_MASK) |
+			(pkt->ipv6_fragment.flags & 0x01);
+		net_pkt_set_ipv6_fragment_flags(prev, flags);
+
+		net_pkt_unref(pkt);
+
+		memmove(&reass->pkt[i], &reass->pkt[i + 1],
+			sizeof(void *) * (CONFIG_NET_IPV6_FRAGMENT_MAX_PKT - i - 1));
+		reass->pkt[CONFIG_NET_IPV6_FRAGMENT_MAX_PKT - 1] = NULL;
+	}
+}
+
 static int shift_packets(struct net_ipv6_reassembly *reass, int pos)
 {
 	int i;
@@ -464,6 +595,7 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 	bool found;
 	uint8_t more;
 	uint32_t id;
+	size_t len;
 	int ret;
 	int i;
 
@@ -494,6 +626,7 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 			       (struct in6_addr *)hdr->dst);
 	if (!reass) {
 		NET_DBG("Cannot get reassembly slot, dropping pkt %p", pkt);
+		net_stats_update_ipv6_frag_drop(net_pkt_iface(pkt));
 		goto drop;
 	}
 
@@ -507,9 +640,33 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		 */
 		net_icmpv6_send_error(pkt, NET_ICMPV6_PARAM_PROBLEM,
 				      NET_ICMPV6_PARAM_PROB_HEADER, NET_IPV6H_LENGTH_OFFSET);
+		net_stats_update_ipv6_frag_drop(net_pkt_iface(pkt));
 		goto drop;
 	}
 
+	len = net_pkt_get_len(pkt);
+
+	if (REASSEMBLY_MAX_BUFFERED > 0) {
+		struct net_ipv6_reassembly *oldest;
+
+		while (reassembly_buffered + len > REASSEMBLY_MAX_BUFFERED) {
+			oldest = reassembly_oldest(reass);
+			if (!oldest) {
+				break;
+			}
+
+			reassembly_evict(oldest);
+		}
+
+		if (reassembly_buffered + len > REASSEMBLY_MAX_BUFFERED) {
+			NET_DBG("Reassembly buffer full, dropping id 0x%x",
+				reass->id);
+			net_stats_update_ipv6_frag_drop(net_pkt_iface(pkt));
+			net_pkt_unref(pkt);
+			goto drop;
+		}
+	}
+
 	/* The fragments might come in wrong order so place them
 	 * in reassembly chain in correct order.
 	 */
@@ -541,10 +698,14 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		 * list. We must discard the whole packet at this point.
 		 */
 		NET_DBG("No slots available for 0x%x", reass->id);
+		net_stats_update_ipv6_frag_drop(net_pkt_iface(pkt));
 		net_pkt_unref(pkt);
 		goto drop;
 	}
 
+	reass->buffered += len;
+	reassembly_buffered += len;
+
 	ret = fragments_are_ready(reass);
 	if (ret < 0) {
 		NET_DBG("Reassembled IPv6 verify failed, dropping id %u",
@@ -555,11 +716,16 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 			reass->pkt[i] = NULL;
 		}
 
+		net_stats_update_ipv6_frag_drop(net_pkt_iface(pkt));
 		net_pkt_unref(pkt);
 		goto drop;
 	} else if (ret == 0) {
 		reassembly_info("Reassembly nth pkt", reass);
 
+		if (IS_ENABLED(CONFIG_NET_IPV6_FRAGMENT_COALESCE)) {
+			coalesce_packets(reass);
+		}
+
 		NET_DBG("More fragments to be received");
 		goto accept;
 	}
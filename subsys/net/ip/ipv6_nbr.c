@@ -18,6 +18,7 @@ LOG_MODULE_DECLARE(net_ipv6, CONFIG_NET_IPV6_LOG_LEVEL);
 
 #include <errno.h>
 #include <stdlib.h>
+#include <zephyr/sys/hash_function.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
@@ -255,10 +256,79 @@ void nbr_print(void)
 #define nbr_print(...)
 #endif
 
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+#define NBR_HASH_END 0xff
+
+/* Neighbors in use by IPv6 address, chained by their index in the pool.
+ * The interface is not hashed as it is optional in lookups.
+ */
+static uint8_t nbr_hash[CONFIG_NET_IPV6_NBR_HASH_BUCKETS] = {
+	[0 ... (CONFIG_NET_IPV6_NBR_HASH_BUCKETS - 1)] = NBR_HASH_END
+};
+static uint8_t nbr_hash_next[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+
+static uint8_t *nbr_hash_head(const struct in6_addr *addr)
+{
+	return &nbr_hash[sys_hash32_murmur3(addr, sizeof(*addr)) %
+			 CONFIG_NET_IPV6_NBR_HASH_BUCKETS];
+}
+
+static uint8_t nbr_index(struct net_nbr *nbr)
+{
+	return ((uint8_t *)nbr - (uint8_t *)net_neighbor_pool) /
+		sizeof(net_neighbor_pool[0]);
+}
+
+static void nbr_hash_add(struct net_nbr *nbr)
+{
+	uint8_t *head = nbr_hash_head(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t idx = nbr_index(nbr);
+
+	nbr_hash_next[idx] = *head;
+	*head = idx;
+}
+
+static void nbr_hash_remove(struct net_nbr *nbr)
+{
+	uint8_t *link = nbr_hash_head(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t idx = nbr_index(nbr);
+
+	while (*link != NBR_HASH_END) {
+		if (*link == idx) {
+			*link = nbr_hash_next[idx];
+			break;
+		}
+
+		link = &nbr_hash_next[*link];
+	}
+}
+#else
+#define nbr_hash_add(...)
+#define nbr_hash_remove(...)
+#endif /* CONFIG_NET_IPV6_NBR_HASH */
+
 static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+	uint8_t i;
+
+	for (i = *nbr_hash_head(addr); i != NBR_HASH_END;
+	     i = nbr_hash_next[i]) {
+		struct net_nbr *nbr = get_nbr(i);
+
+		if (iface && nbr->iface != iface) {
+			continue;
+		}
+
+		if (net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, addr)) {
+			return nbr;
+		}
+	}
+
+	return NULL;
+#else
 	int i;
 
 	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
@@ -278,6 +348,7 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 	}
 
 	return NULL;
+#endif
 }
 
 static inline void nbr_clear_ns_pending(struct net_ipv6_nbr_data *data)
@@ -407,6 +478,7 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+	nbr_hash_add(nbr);
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
@@ -430,6 +502,9 @@ static struct net_nbr *nbr_new(struct net_if *iface,
 
 	nbr_init(nbr, iface, addr, is_router, state);
 
+	/* The new neighbor may be a shorter path than a cached flow. */
+	net_route_flow_flush();
+
 	NET_DBG("nbr %p iface %p/%d state %d IPv6 %s",
 		nbr, iface, net_if_get_by_iface(iface), state,
 		net_sprint_ipv6_addr(addr));
@@ -650,6 +725,8 @@ void net_neighbor_data_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
+	nbr_hash_remove(nbr);
+
 	return;
 }
 
@@ -784,9 +861,10 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. TCP
+	 * super-packets are segmented by the driver instead.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U && net_pkt_gso_size(pkt) == 0U) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
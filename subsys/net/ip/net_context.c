@@ -1231,6 +1231,25 @@ static int get_context_txtime(struct net_context *context,
 #endif
 }
 
+static int get_context_zerocopy(struct net_context *context,
+				void *value, size_t *len)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	struct net_context_zerocopy *zc = value;
+
+	zc->cb = context->options.zerocopy.cb;
+	zc->user_data = context->options.zerocopy.user_data;
+
+	if (len) {
+		*len = sizeof(struct net_context_zerocopy);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 static int get_context_rcvtimeo(struct net_context *context,
 				void *value, size_t *len)
 {
@@ -1341,6 +1360,105 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 	return ret;
 }
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+struct zerocopy_data {
+	net_context_zerocopy_cb_t cb;
+	void *user_data;
+	uint32_t id;
+	/* Only the last buffer of a successful send reports it */
+	bool armed;
+};
+
+static void zerocopy_buf_destroy(struct net_buf *buf)
+{
+	struct zerocopy_data zc = *(struct zerocopy_data *)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+
+	if (zc.armed && zc.cb) {
+		zc.cb(zc.id, zc.user_data);
+	}
+}
+
+NET_BUF_POOL_FIXED_DEFINE(zerocopy_bufs, CONFIG_NET_CONTEXT_ZEROCOPY_BUF_COUNT,
+			  0, sizeof(struct zerocopy_data), zerocopy_buf_destroy);
+
+/* Append the data of msghdr to pkt as buffers referencing it. A reference
+ * to the last buffer is returned in last, for context_zerocopy_done().
+ */
+static int context_append_zerocopy(struct net_pkt *pkt,
+				   const struct msghdr *msghdr,
+				   struct net_buf **last)
+{
+	*last = NULL;
+
+	for (int i = 0; i < msghdr->msg_iovlen; i++) {
+		uint8_t *data = msghdr->msg_iov[i].iov_base;
+		size_t left = msghdr->msg_iov[i].iov_len;
+
+		while (left > 0) {
+			size_t len = MIN(left, UINT16_MAX);
+			struct net_buf *buf;
+
+			buf = net_buf_alloc_with_data(&zerocopy_bufs, data, len,
+						      K_NO_WAIT);
+			if (!buf) {
+				return -ENOBUFS;
+			}
+
+			memset(net_buf_user_data(buf), 0,
+			       sizeof(struct zerocopy_data));
+			net_pkt_append_buffer(pkt, buf);
+
+			*last = buf;
+			data += len;
+			left -= len;
+		}
+	}
+
+	if (*last) {
+		net_buf_ref(*last);
+	}
+
+	return 0;
+}
+
+/* Release the reference taken by context_append_zerocopy(), reporting
+ * the send once the last buffer is freed if it succeeded.
+ */
+static void context_zerocopy_done(struct net_context *context,
+				  struct net_buf *last, bool sent)
+{
+	struct zerocopy_data *zc;
+
+	if (!last) {
+		return;
+	}
+
+	if (sent) {
+		zc = net_buf_user_data(last);
+		zc->cb = context->options.zerocopy.cb;
+		zc->user_data = context->options.zerocopy.user_data;
+		zc->id = context->options.zerocopy.next_id++;
+		zc->armed = true;
+	}
+
+	net_buf_unref(last);
+}
+#else
+static inline int context_append_zerocopy(struct net_pkt *pkt,
+					  const struct msghdr *msghdr,
+					  struct net_buf **last)
+{
+	return -EOPNOTSUPP;
+}
+
+static inline void context_zerocopy_done(struct net_context *context,
+					 struct net_buf *last, bool sent)
+{
+}
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 static int context_setup_udp_packet(struct net_context *context,
 				    struct net_pkt *pkt,
 				    const void *buf,
@@ -1476,9 +1594,12 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  int flags)
 {
 	const struct msghdr *msghdr = NULL;
+	struct net_buf *zc_last = NULL;
+	bool zerocopy = false;
 	struct net_if *iface;
 	struct net_pkt *pkt;
 	size_t tmp_len;
@@ -1499,6 +1620,23 @@ static int context_sendto(struct net_context *context,
 		return -EDESTADDRREQ;
 	}
 
+	if (flags & ZSOCK_MSG_ZEROCOPY) {
+		/* Only the native TCP and UDP stacks can send from the
+		 * application buffers.
+		 */
+		if (!IS_ENABLED(CONFIG_NET_CONTEXT_ZEROCOPY) || !msghdr ||
+		    (net_context_get_proto(context) != IPPROTO_TCP &&
+		     net_context_get_proto(context) != IPPROTO_UDP) ||
+		    (net_context_get_family(context) != AF_INET &&
+		     net_context_get_family(context) != AF_INET6) ||
+		    (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+		     net_if_is_ip_offloaded(net_context_get_iface(context)))) {
+			return -EOPNOTSUPP;
+		}
+
+		zerocopy = true;
+	}
+
 	if (IS_ENABLED(CONFIG_NET_IPV6) &&
 	    net_context_get_family(context) == AF_INET6) {
 		const struct sockaddr_in6 *addr6 =
@@ -1689,7 +1827,7 @@ static int context_sendto(struct net_context *context,
 		return -ENETDOWN;
 	}
 
-	pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	pkt = context_alloc_pkt(context, zerocopy ? 0 : len, PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -1697,7 +1835,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (!zerocopy && tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
 				tmp_len, len);
@@ -1750,19 +1888,36 @@ static int context_sendto(struct net_context *context,
 		}
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, pkt, buf, len, msghdr,
+		ret = context_setup_udp_packet(context, pkt, buf,
+					       zerocopy ? 0 : len, msghdr,
 					       dst_addr, addrlen);
 		if (ret < 0) {
 			goto fail;
 		}
 
+		if (zerocopy) {
+			ret = context_append_zerocopy(pkt, msghdr, &zc_last);
+			if (ret < 0) {
+				goto fail;
+			}
+		}
+
 		context_finalize_packet(context, pkt);
 
 		ret = net_send_data(pkt);
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_proto(context) == IPPROTO_TCP) {
 
-		ret = context_write_data(pkt, buf, len, msghdr);
+		if (zerocopy) {
+			/* Only the application data is queued */
+			net_buf_unref(pkt->buffer);
+			pkt->buffer = NULL;
+
+			ret = context_append_zerocopy(pkt, msghdr, &zc_last);
+		} else {
+			ret = context_write_data(pkt, buf, len, msghdr);
+		}
+
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1825,8 +1980,11 @@ static int context_sendto(struct net_context *context,
 		goto fail;
 	}
 
+	context_zerocopy_done(context, zc_last, true);
+
 	return len;
 fail:
+	context_zerocopy_done(context, zc_last, false);
 	net_pkt_unref(pkt);
 
 	return ret;
@@ -1868,7 +2026,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, 0);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -1887,7 +2045,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, flags);
 
 	k_mutex_unlock(&context->lock);
 
@@ -1908,7 +2066,7 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, 0);
 
 	k_mutex_unlock(&context->lock);
 
@@ -2248,6 +2406,25 @@ static int set_context_txtime(struct net_context *context,
 #endif
 }
 
+static int set_context_zerocopy(struct net_context *context,
+				const void *value, size_t len)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	const struct net_context_zerocopy *zc = value;
+
+	if (len != sizeof(struct net_context_zerocopy)) {
+		return -EINVAL;
+	}
+
+	context->options.zerocopy.cb = zc->cb;
+	context->options.zerocopy.user_data = zc->user_data;
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 static int set_context_proxy(struct net_context *context,
 			     const void *value, size_t len)
 {
@@ -2407,6 +2584,9 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_DSCP_ECN:
 		ret = set_context_dscp_ecn(context, value, len);
 		break;
+	case NET_OPT_ZEROCOPY:
+		ret = set_context_zerocopy(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -2453,6 +2633,9 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_DSCP_ECN:
 		ret = get_context_dscp_ecn(context, value, len);
 		break;
+	case NET_OPT_ZEROCOPY:
+		ret = get_context_zerocopy(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
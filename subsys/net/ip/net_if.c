@@ -28,6 +28,8 @@ LOG_MODULE_REGISTER(net_if, CONFIG_NET_IF_LOG_LEVEL);
 #include "ipv4.h"
 #include "ipv6.h"
 #include "ipv4_autoconf_internal.h"
+#include "route.h"
+#include "tcp_internal.h"
 
 #include "net_stats.h"
 
@@ -474,6 +476,23 @@ enum net_verdict net_if_send_data(struct net_if *iface, struct net_pkt *pkt)
 		net_pkt_lladdr_src(pkt)->len = net_pkt_lladdr_if(pkt)->len;
 	}
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/* Split TCP super-packets that the driver cannot segment itself,
+	 * the segments are sent separately like IP fragments.
+	 */
+	if (net_pkt_gso_size(pkt) > 0 && !net_if_tso_capable(iface)) {
+		if (net_tcp_gso_send(pkt) < 0) {
+			verdict = NET_DROP;
+			status = -ENOBUFS;
+			goto done;
+		}
+
+		net_pkt_unref(pkt);
+		verdict = NET_CONTINUE;
+		goto done;
+	}
+#endif
+
 #if defined(CONFIG_NET_LOOPBACK)
 	/* If the packet is destined back to us, then there is no need to do
 	 * additional checks, so let the packet through.
@@ -729,6 +748,8 @@ static void iface_router_notify_deletion(struct net_if_router *router,
 			net_sprint_ipv6_addr(net_if_router_ipv6(router)),
 			delete_reason);
 
+		net_route_flow_flush();
+
 		net_mgmt_event_notify_with_info(NET_EVENT_IPV6_ROUTER_DEL,
 						router->iface,
 						&router->address.in6_addr,
@@ -856,6 +877,7 @@ static struct net_if_router *iface_router_add(struct net_if *iface,
 		if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
 			memcpy(net_if_router_ipv6(&routers[i]), addr,
 			       sizeof(struct in6_addr));
+			net_route_flow_flush();
 			net_mgmt_event_notify_with_info(
 					NET_EVENT_IPV6_ROUTER_ADD, iface,
 					&routers[i].address.in6_addr,
@@ -1219,6 +1241,7 @@ static void dad_timeout(struct k_work *work)
 			net_sprint_ipv6_addr(&ifaddr->address.in6_addr));
 
 		ifaddr->addr_state = NET_ADDR_PREFERRED;
+		net_if_ipv6_addr_cache_flush();
 
 		/* Because we do not know the interface at this point,
 		 * we need to lookup for it.
@@ -1244,6 +1267,7 @@ static void net_if_ipv6_start_dad(struct net_if *iface,
 				  struct net_if_addr *ifaddr)
 {
 	ifaddr->addr_state = NET_ADDR_TENTATIVE;
+	net_if_ipv6_addr_cache_flush();
 
 	if (net_if_is_up(iface)) {
 		NET_DBG("Interface %p ll addr %s tentative IPv6 addr %s",
@@ -1361,6 +1385,7 @@ static inline void net_if_ipv6_start_dad(struct net_if *iface,
 					 struct net_if_addr *ifaddr)
 {
 	ifaddr->addr_state = NET_ADDR_PREFERRED;
+	net_if_ipv6_addr_cache_flush();
 }
 
 #define iface_ipv6_dad_init(...)
@@ -1499,11 +1524,218 @@ static inline void iface_ipv6_nd_init(void)
 #define iface_ipv6_nd_init(...)
 #endif /* CONFIG_NET_IPV6_ND */
 
+#if defined(CONFIG_NET_IPV6_ADDR_CACHE)
+/* The unicast addresses of all the interfaces, hashed by address with linear
+ * probing, and the source addresses last selected per destination. Both are
+ * of the generation of the addresses they were built from, which changes
+ * whenever an address is added, removed or changes state. As the generation
+ * starts at 1, unused entries are never valid.
+ */
+#define IPV6_ADDR_TABLE_SIZE \
+	(2 * NET_IF_MAX_IPV6_ADDR * CONFIG_NET_IF_MAX_IPV6_COUNT + 1)
+
+struct ipv6_addr_slot {
+	struct net_if_addr *ifaddr;
+	struct net_if *iface;
+};
+
+struct ipv6_src_slot {
+	struct in6_addr dst;
+	struct net_if *dst_iface;
+	const struct in6_addr *src;
+	atomic_val_t gen;
+	/* Chosen on more than the /64 prefix of the destination */
+	bool exact;
+};
+
+static K_MUTEX_DEFINE(ipv6_cache_lock);
+static atomic_t ipv6_addr_gen = ATOMIC_INIT(1);
+static atomic_val_t ipv6_addr_table_gen;
+static struct ipv6_addr_slot ipv6_addr_table[IPV6_ADDR_TABLE_SIZE];
+static struct ipv6_src_slot ipv6_src_cache[CONFIG_NET_IPV6_SRC_ADDR_CACHE_SIZE];
+
+void net_if_ipv6_addr_cache_flush(void)
+{
+	atomic_inc(&ipv6_addr_gen);
+}
+
+static uint32_t ipv6_addr_hash(uint32_t hash, const struct in6_addr *addr,
+			       int words)
+{
+	int i;
+
+	for (i = 0; i < words; i++) {
+		hash = (hash ^ UNALIGNED_GET(&addr->s6_addr32[i])) * 0x9e3779b1U;
+	}
+
+	return hash >> 16;
+}
+
+/* Called with the cache locked. The interfaces are not locked, as some
+ * lookups are done with an interface locked, which would order the locks both
+ * ways. An address changing meanwhile leaves the table of an older
+ * generation, so that the next lookup rebuilds it.
+ */
+static void ipv6_addr_table_rebuild(atomic_val_t gen)
+{
+	(void)memset(ipv6_addr_table, 0, sizeof(ipv6_addr_table));
+
+	STRUCT_SECTION_FOREACH(net_if, iface) {
+		struct net_if_ipv6 *ipv6 = iface->config.ip.ipv6;
+		uint32_t slot;
+		int i;
+
+		if (!ipv6) {
+			continue;
+		}
+
+		for (i = 0; i < NET_IF_MAX_IPV6_ADDR; i++) {
+			struct net_if_addr *ifaddr = &ipv6->unicast[i];
+
+			if (!ifaddr->is_used ||
+			    ifaddr->address.family != AF_INET6) {
+				continue;
+			}
+
+			slot = ipv6_addr_hash(0, &ifaddr->address.in6_addr, 4) %
+			       IPV6_ADDR_TABLE_SIZE;
+			while (ipv6_addr_table[slot].ifaddr != NULL) {
+				slot = (slot + 1) % IPV6_ADDR_TABLE_SIZE;
+			}
+
+			ipv6_addr_table[slot].ifaddr = ifaddr;
+			ipv6_addr_table[slot].iface = iface;
+		}
+	}
+
+	ipv6_addr_table_gen = gen;
+}
+
+static struct net_if_addr *ipv6_addr_table_lookup(const struct in6_addr *addr,
+						  struct net_if **ret)
+{
+	struct net_if_addr *ifaddr = NULL;
+	atomic_val_t gen;
+	uint32_t slot;
+
+	k_mutex_lock(&ipv6_cache_lock, K_FOREVER);
+
+	gen = atomic_get(&ipv6_addr_gen);
+	if (ipv6_addr_table_gen != gen) {
+		ipv6_addr_table_rebuild(gen);
+	}
+
+	/* Addresses of several interfaces are found in interface order */
+	for (slot = ipv6_addr_hash(0, addr, 4) % IPV6_ADDR_TABLE_SIZE;
+	     ipv6_addr_table[slot].ifaddr != NULL;
+	     slot = (slot + 1) % IPV6_ADDR_TABLE_SIZE) {
+		struct net_if_addr *cur = ipv6_addr_table[slot].ifaddr;
+
+		if (cur->is_used &&
+		    net_ipv6_addr_cmp(addr, &cur->address.in6_addr)) {
+			if (ret) {
+				*ret = ipv6_addr_table[slot].iface;
+			}
+
+			ifaddr = cur;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&ipv6_cache_lock);
+
+	return ifaddr;
+}
+
+static struct ipv6_src_slot *ipv6_src_slot_get(struct net_if *dst_iface,
+					       const struct in6_addr *dst,
+					       bool exact)
+{
+	uint32_t hash;
+
+	hash = ipv6_addr_hash(POINTER_TO_UINT(dst_iface), dst, exact ? 4 : 2);
+
+	return &ipv6_src_cache[hash % ARRAY_SIZE(ipv6_src_cache)];
+}
+
+static struct ipv6_src_slot *ipv6_src_cache_find(struct net_if *dst_iface,
+						 const struct in6_addr *dst,
+						 bool exact)
+{
+	struct ipv6_src_slot *entry = ipv6_src_slot_get(dst_iface, dst, exact);
+
+	if (entry->gen == atomic_get(&ipv6_addr_gen) && entry->exact == exact &&
+	    entry->dst_iface == dst_iface &&
+	    net_ipv6_is_prefix(entry->dst.s6_addr, dst->s6_addr,
+			       exact ? 128 : 64)) {
+		return entry;
+	}
+
+	return NULL;
+}
+
+static bool ipv6_src_cache_get(struct net_if *dst_iface,
+			       const struct in6_addr *dst,
+			       const struct in6_addr **src)
+{
+	struct ipv6_src_slot *entry;
+
+	k_mutex_lock(&ipv6_cache_lock, K_FOREVER);
+
+	/* A source chosen on the prefix of the destination, or else on the
+	 * whole destination address.
+	 */
+	entry = ipv6_src_cache_find(dst_iface, dst, false);
+	if (entry == NULL) {
+		entry = ipv6_src_cache_find(dst_iface, dst, true);
+	}
+
+	if (entry != NULL) {
+		*src = entry->src;
+	}
+
+	k_mutex_unlock(&ipv6_cache_lock);
+
+	return entry != NULL;
+}
+
+static void ipv6_src_cache_add(atomic_val_t gen, struct net_if *dst_iface,
+			       const struct in6_addr *dst,
+			       const struct in6_addr *src, bool exact)
+{
+	struct ipv6_src_slot *entry;
+
+	k_mutex_lock(&ipv6_cache_lock, K_FOREVER);
+
+	entry = ipv6_src_slot_get(dst_iface, dst, exact);
+	entry->dst_iface = dst_iface;
+	entry->src = src;
+	entry->exact = exact;
+	net_ipaddr_copy(&entry->dst, dst);
+	entry->gen = gen;
+
+	k_mutex_unlock(&ipv6_cache_lock);
+}
+#else
+static inline struct net_if_addr *ipv6_addr_table_lookup(const struct in6_addr *addr,
+							 struct net_if **ret)
+{
+	ARG_UNUSED(addr);
+	ARG_UNUSED(ret);
+
+	return NULL;
+}
+#endif /* CONFIG_NET_IPV6_ADDR_CACHE */
+
 struct net_if_addr *net_if_ipv6_addr_lookup(const struct in6_addr *addr,
 					    struct net_if **ret)
 {
 	struct net_if_addr *ifaddr = NULL;
 
+	if (IS_ENABLED(CONFIG_NET_IPV6_ADDR_CACHE)) {
+		return ipv6_addr_table_lookup(addr, ret);
+	}
+
 	STRUCT_SECTION_FOREACH(net_if, iface) {
 		struct net_if_ipv6 *ipv6;
 		int i;
@@ -1611,6 +1843,7 @@ static void address_expired(struct net_if_addr *ifaddr)
 		net_sprint_ipv6_addr(&ifaddr->address.in6_addr));
 
 	ifaddr->addr_state = NET_ADDR_DEPRECATED;
+	net_if_ipv6_addr_cache_flush();
 
 	sys_slist_find_and_remove(&active_address_lifetime_timers,
 				  &ifaddr->lifetime.node);
@@ -1683,6 +1916,7 @@ void net_if_ipv6_addr_update_lifetime(struct net_if_addr *ifaddr,
 		vlifetime);
 
 	ifaddr->addr_state = NET_ADDR_PREFERRED;
+	net_if_ipv6_addr_cache_flush();
 
 	address_start_timer(ifaddr, vlifetime);
 
@@ -1791,6 +2025,8 @@ struct net_if_addr *net_if_ipv6_addr_add(struct net_if *iface,
 			ipv6->unicast[i].addr_state = NET_ADDR_PREFERRED;
 		}
 
+		net_if_ipv6_addr_cache_flush();
+
 		net_mgmt_event_notify_with_info(
 			NET_EVENT_IPV6_ADDR_ADD, iface,
 			&ipv6->unicast[i].address.in6_addr,
@@ -1876,6 +2112,7 @@ bool net_if_ipv6_addr_rm(struct net_if *iface, const struct in6_addr *addr)
 #endif
 
 		ipv6->unicast[found].is_used = false;
+		net_if_ipv6_addr_cache_flush();
 
 		if (maddr_count == 1) {
 			/* remove the solicited-node multicast address only if no other
@@ -2790,7 +3027,8 @@ static inline bool is_proper_ipv6_address(struct net_if_addr *addr)
 
 static struct in6_addr *net_if_ipv6_get_best_match(struct net_if *iface,
 						   const struct in6_addr *dst,
-						   uint8_t *best_so_far)
+						   uint8_t *best_so_far,
+						   bool *tentative)
 {
 	struct net_if_ipv6 *ipv6;
 	struct in6_addr *src = NULL;
@@ -2805,6 +3043,11 @@ static struct in6_addr *net_if_ipv6_get_best_match(struct net_if *iface,
 	}
 
 	for (i = 0; i < NET_IF_MAX_IPV6_ADDR; i++) {
+		if (ipv6->unicast[i].is_used &&
+		    ipv6->unicast[i].addr_state == NET_ADDR_TENTATIVE) {
+			*tentative = true;
+		}
+
 		if (!is_proper_ipv6_address(&ipv6->unicast[i])) {
 			continue;
 		}
@@ -2835,24 +3078,45 @@ const struct in6_addr *net_if_ipv6_select_src_addr(struct net_if *dst_iface,
 {
 	const struct in6_addr *src = NULL;
 	uint8_t best_match = 0U;
+	bool tentative = false;
 
 	if (!net_ipv6_is_ll_addr(dst) && !net_ipv6_is_addr_mcast_link(dst)) {
+#if defined(CONFIG_NET_IPV6_ADDR_CACHE)
+		atomic_val_t gen = atomic_get(&ipv6_addr_gen);
+
+		if (ipv6_src_cache_get(dst_iface, dst, &src)) {
+			goto found;
+		}
+#endif
+
 		/* If caller has supplied interface, then use that */
 		if (dst_iface) {
 			src = net_if_ipv6_get_best_match(dst_iface, dst,
-							 &best_match);
+							 &best_match,
+							 &tentative);
 		} else {
 			STRUCT_SECTION_FOREACH(net_if, iface) {
 				struct in6_addr *addr;
 
 				addr = net_if_ipv6_get_best_match(iface, dst,
-								  &best_match);
+								  &best_match,
+								  &tentative);
 				if (addr) {
 					src = addr;
 				}
 			}
 		}
 
+#if defined(CONFIG_NET_IPV6_ADDR_CACHE)
+		/* Below 64 bits, the longest match only depends on the prefix
+		 * of the destination. Tentative addresses are not cached, as
+		 * they may be made preferred without flushing the cache.
+		 */
+		if (!tentative) {
+			ipv6_src_cache_add(gen, dst_iface, dst, src,
+					   best_match >= 64U);
+		}
+#endif
 	} else {
 		if (dst_iface) {
 			src = net_if_ipv6_get_ll(dst_iface, NET_ADDR_PREFERRED);
@@ -2870,6 +3134,9 @@ const struct in6_addr *net_if_ipv6_select_src_addr(struct net_if *dst_iface,
 		}
 	}
 
+#if defined(CONFIG_NET_IPV6_ADDR_CACHE)
+found:
+#endif
 	if (!src) {
 		src = net_ipv6_unspecified_address();
 		goto out;
@@ -4188,6 +4455,21 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface)
 	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD);
 }
 
+bool net_if_tso_capable(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
+		return false;
+	}
+
+	return !!(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TX_TSO);
+#else
+	ARG_UNUSED(iface);
+
+	return false;
+#endif
+}
+
 int net_if_get_by_iface(struct net_if *iface)
 {
 	if (!(iface >= _net_if_list_start && iface < _net_if_list_end)) {
@@ -41,7 +41,24 @@ static K_MUTEX_DEFINE(net_mgmt_event_lock);
 K_KERNEL_STACK_DEFINE(mgmt_stack, CONFIG_NET_MGMT_EVENT_STACK_SIZE);
 static struct k_thread mgmt_thread_data;
 static uint32_t global_event_mask;
-static sys_slist_t event_callbacks = SYS_SLIST_STATIC_INIT(&event_callbacks);
+static struct net_mgmt_event_stats mgmt_stats;
+
+/* Callbacks hashed on the layer and layer code of their event mask, which
+ * events have to match exactly. A zeroed list is empty.
+ */
+static sys_slist_t event_callbacks[CONFIG_NET_MGMT_EVENT_CALLBACK_BUCKETS];
+
+#ifdef CONFIG_NET_MGMT_EVENT_WORKQ
+/* Event waiting for the work queue of a callback */
+struct mgmt_event_pending {
+	sys_snode_t node;
+	struct mgmt_event_entry entry;
+};
+
+static struct mgmt_event_pending pending_pool[CONFIG_NET_MGMT_EVENT_WORKQ_POOL_SIZE];
+static sys_slist_t pending_free = SYS_SLIST_STATIC_INIT(&pending_free);
+static struct k_spinlock pending_lock;
+#endif /* CONFIG_NET_MGMT_EVENT_WORKQ */
 
 /* event structure used to prevent increasing the stack usage on the caller thread */
 static struct mgmt_event_entry new_event;
@@ -85,6 +102,7 @@ static inline void mgmt_push_event(uint32_t mgmt_event, struct net_if *iface,
 			 "try increasing the 'CONFIG_NET_MGMT_EVENT_QUEUE_SIZE' "
 			 "or 'CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT' options.",
 			 mgmt_event);
+		mgmt_stats.queue_overflows++;
 	}
 
 	(void)k_mutex_unlock(&net_mgmt_event_lock);
@@ -96,6 +114,13 @@ static inline void mgmt_pop_event(struct mgmt_event_entry *dst)
 	} while (k_msgq_get(&event_msgq, dst, K_FOREVER) != 0);
 }
 
+static inline sys_slist_t *mgmt_event_callbacks(uint32_t event)
+{
+	uint32_t key = (event & (NET_MGMT_LAYER_MASK | NET_MGMT_LAYER_CODE_MASK)) >> 16;
+
+	return &event_callbacks[key % ARRAY_SIZE(event_callbacks)];
+}
+
 static inline void mgmt_add_event_mask(uint32_t event_mask)
 {
 	global_event_mask |= event_mask;
@@ -107,8 +132,10 @@ static inline void mgmt_rebuild_global_event_mask(void)
 
 	global_event_mask = 0U;
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		mgmt_add_event_mask(cb->event_mask);
+	for (size_t i = 0; i < ARRAY_SIZE(event_callbacks); i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks[i], cb, tmp, node) {
+			mgmt_add_event_mask(cb->event_mask);
+		}
 	}
 }
 
@@ -125,8 +152,149 @@ static inline bool mgmt_is_event_handled(uint32_t mgmt_event)
 		 NET_MGMT_GET_COMMAND(mgmt_event)));
 }
 
+static inline void mgmt_set_info(struct net_mgmt_event_callback *cb,
+				 const struct mgmt_event_entry * const mgmt_event)
+{
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+	if (mgmt_event->info_length) {
+		cb->info = (void *)mgmt_event->info;
+		cb->info_length = mgmt_event->info_length;
+	} else {
+		cb->info = NULL;
+		cb->info_length = 0;
+	}
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+}
+
+#ifdef CONFIG_NET_MGMT_EVENT_WORKQ
+static bool mgmt_event_equal(const struct mgmt_event_entry *a,
+			     const struct mgmt_event_entry *b)
+{
+	if (a->event != b->event || a->iface != b->iface) {
+		return false;
+	}
+
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+	if (a->info_length != b->info_length ||
+	    memcmp(a->info, b->info, a->info_length) != 0) {
+		return false;
+	}
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+
+	return true;
+}
+
+static void mgmt_queue_event(struct net_mgmt_event_callback *cb,
+			     const struct mgmt_event_entry * const mgmt_event)
+{
+	struct mgmt_event_pending *pending;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	key = k_spin_lock(&pending_lock);
+
+	if (cb->coalesce) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&cb->pending, pending, node) {
+			if (mgmt_event_equal(&pending->entry, mgmt_event)) {
+				cb->coalesced++;
+				mgmt_stats.coalesced++;
+				k_spin_unlock(&pending_lock, key);
+				return;
+			}
+		}
+	}
+
+	node = sys_slist_get(&pending_free);
+	if (node == NULL) {
+		cb->dropped++;
+		mgmt_stats.workq_overflows++;
+		k_spin_unlock(&pending_lock, key);
+
+		NET_WARN("No free pending event for callback %p, try increasing "
+			 "'CONFIG_NET_MGMT_EVENT_WORKQ_POOL_SIZE'", cb);
+		return;
+	}
+
+	pending = CONTAINER_OF(node, struct mgmt_event_pending, node);
+	pending->entry = *mgmt_event;
+	sys_slist_append(&cb->pending, node);
+
+	k_spin_unlock(&pending_lock, key);
+
+	k_work_submit_to_queue(cb->workq, &cb->work);
+}
+
+static void mgmt_event_work_handler(struct k_work *work)
+{
+	struct net_mgmt_event_callback *cb =
+		CONTAINER_OF(work, struct net_mgmt_event_callback, work);
+	struct mgmt_event_pending *pending;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	while (true) {
+		key = k_spin_lock(&pending_lock);
+		node = sys_slist_get(&cb->pending);
+		k_spin_unlock(&pending_lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		pending = CONTAINER_OF(node, struct mgmt_event_pending, node);
+
+		mgmt_set_info(cb, &pending->entry);
+		cb->handler(cb, pending->entry.event, pending->entry.iface);
+
+		key = k_spin_lock(&pending_lock);
+		sys_slist_append(&pending_free, node);
+		k_spin_unlock(&pending_lock, key);
+	}
+}
+
+void net_mgmt_event_callback_set_workq(struct net_mgmt_event_callback *cb,
+				       struct k_work_q *workq, bool coalesce)
+{
+	__ASSERT(workq, "Work queue pointer should not be NULL");
+
+	cb->workq = workq;
+	cb->coalesce = coalesce;
+	cb->coalesced = 0U;
+	cb->dropped = 0U;
+	sys_slist_init(&cb->pending);
+	k_work_init(&cb->work, mgmt_event_work_handler);
+}
+
+/* Called without net_mgmt_callback_lock, which the handler may take */
+static void mgmt_flush_pending(struct net_mgmt_event_callback *cb)
+{
+	struct k_work_sync sync;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	if (k_current_get() == k_work_queue_thread_get(cb->workq)) {
+		/* From the handler itself, or from another item of its work
+		 * queue while the handler cannot run: the handler finishes
+		 * with the events it already took once it returns.
+		 */
+		(void)k_work_cancel(&cb->work);
+	} else {
+		(void)k_work_cancel_sync(&cb->work, &sync);
+	}
+
+	key = k_spin_lock(&pending_lock);
+
+	while ((node = sys_slist_get(&cb->pending)) != NULL) {
+		sys_slist_append(&pending_free, node);
+	}
+
+	k_spin_unlock(&pending_lock, key);
+}
+#endif /* CONFIG_NET_MGMT_EVENT_WORKQ */
+
 static inline void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt_event)
 {
+	sys_slist_t *callbacks = mgmt_event_callbacks(mgmt_event->event);
 	sys_snode_t *prev = NULL;
 	struct net_mgmt_event_callback *cb, *tmp;
 
@@ -135,7 +303,7 @@ static inline void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt
 		NET_MGMT_GET_LAYER_CODE(mgmt_event->event),
 		NET_MGMT_GET_COMMAND(mgmt_event->event));
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(callbacks, cb, tmp, node) {
 		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
 		      NET_MGMT_GET_LAYER(cb->event_mask)) ||
 		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
@@ -147,15 +315,17 @@ static inline void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt
 			continue;
 		}
 
-#ifdef CONFIG_NET_MGMT_EVENT_INFO
-		if (mgmt_event->info_length) {
-			cb->info = (void *)mgmt_event->info;
-			cb->info_length = mgmt_event->info_length;
-		} else {
-			cb->info = NULL;
-			cb->info_length = 0;
+#ifdef CONFIG_NET_MGMT_EVENT_WORKQ
+		/* The handler owns the info of the callback while running */
+		if (!NET_MGMT_EVENT_SYNCHRONOUS(cb->event_mask) &&
+		    cb->workq != NULL) {
+			mgmt_queue_event(cb, mgmt_event);
+			prev = &cb->node;
+			continue;
 		}
-#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+#endif /* CONFIG_NET_MGMT_EVENT_WORKQ */
+
+		mgmt_set_info(cb, mgmt_event);
 
 		if (NET_MGMT_EVENT_SYNCHRONOUS(cb->event_mask)) {
 			struct mgmt_event_wait *sync_data =
@@ -172,7 +342,7 @@ static inline void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt
 			cb->raised_event = mgmt_event->event;
 			sync_data->iface = mgmt_event->iface;
 
-			sys_slist_remove(&event_callbacks, prev, &cb->node);
+			sys_slist_remove(callbacks, prev, &cb->node);
 
 			k_sem_give(cb->sync_call);
 		} else {
@@ -269,7 +439,7 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb)
 
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
-	sys_slist_prepend(&event_callbacks, &cb->node);
+	sys_slist_prepend(mgmt_event_callbacks(cb->event_mask), &cb->node);
 
 	mgmt_add_event_mask(cb->event_mask);
 
@@ -282,11 +452,18 @@ void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb)
 
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	sys_slist_find_and_remove(mgmt_event_callbacks(cb->event_mask), &cb->node);
 
 	mgmt_rebuild_global_event_mask();
 
 	(void)k_mutex_unlock(&net_mgmt_callback_lock);
+
+#ifdef CONFIG_NET_MGMT_EVENT_WORKQ
+	/* No event can be queued for the callback anymore */
+	if (!NET_MGMT_EVENT_SYNCHRONOUS(cb->event_mask) && cb->workq != NULL) {
+		mgmt_flush_pending(cb);
+	}
+#endif /* CONFIG_NET_MGMT_EVENT_WORKQ */
 }
 
 void net_mgmt_event_notify_with_info(uint32_t mgmt_event, struct net_if *iface,
@@ -329,6 +506,11 @@ int net_mgmt_event_wait_on_iface(struct net_if *iface,
 				    timeout);
 }
 
+void net_mgmt_event_stats_get(struct net_mgmt_event_stats *stats)
+{
+	*stats = mgmt_stats;
+}
+
 void net_mgmt_event_init(void)
 {
 #if defined(CONFIG_NET_TC_THREAD_COOPERATIVE)
@@ -338,6 +520,12 @@ void net_mgmt_event_init(void)
 #define THREAD_PRIORITY K_PRIO_PREEMPT(CONFIG_NUM_PREEMPT_PRIORITIES - 1)
 #endif
 
+#ifdef CONFIG_NET_MGMT_EVENT_WORKQ
+	for (size_t i = 0; i < ARRAY_SIZE(pending_pool); i++) {
+		sys_slist_append(&pending_free, &pending_pool[i].node);
+	}
+#endif /* CONFIG_NET_MGMT_EVENT_WORKQ */
+
 	k_thread_create(&mgmt_thread_data, mgmt_stack,
 			K_KERNEL_STACK_SIZEOF(mgmt_stack),
 			(k_thread_entry_t)mgmt_thread, NULL, NULL, NULL,
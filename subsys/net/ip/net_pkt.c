@@ -480,6 +480,32 @@ struct net_buf *net_pkt_get_reserve_tx_data(size_t min_len, k_timeout_t timeout)
 
 #endif /* NET_LOG_LEVEL >= LOG_LEVEL_DBG */
 
+int net_pkt_get_reserve_rx_data_bulk(size_t min_len, struct net_buf **frags,
+				     int count, k_timeout_t timeout)
+{
+	int ret;
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+#if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
+	if (min_len > CONFIG_NET_BUF_DATA_SIZE) {
+		NET_ERR("Requested too large fragment. Increase CONFIG_NET_BUF_DATA_SIZE.");
+		return -EINVAL;
+	}
+
+	ret = net_buf_alloc_bulk(&rx_bufs, frags, count, timeout);
+#else
+	ret = net_buf_alloc_len_bulk(&rx_bufs, min_len, frags, count, timeout);
+#endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
+
+	for (int i = 0; i < ret; i++) {
+		net_pkt_alloc_add(frags[i], false, __func__, __LINE__);
+	}
+
+	return ret;
+}
 
 #if defined(CONFIG_NET_CONTEXT_NET_PKT_POOL)
 static inline struct k_mem_slab *get_tx_slab(struct net_context *context)
@@ -1198,10 +1224,10 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 }
 
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
-static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout,
-				 const char *caller, int line)
+static __hot_code struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout,
+					    const char *caller, int line)
 #else
-static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
+static __hot_code struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
 #endif
 {
 	struct net_pkt *pkt;
@@ -1807,6 +1833,8 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_vlan_tag(clone_pkt, net_pkt_vlan_tag(pkt));
 	net_pkt_set_timestamp(clone_pkt, net_pkt_timestamp(pkt));
 	net_pkt_set_priority(clone_pkt, net_pkt_priority(pkt));
+	net_pkt_set_gso_size(clone_pkt, net_pkt_gso_size(pkt));
+	net_pkt_set_rx_hash(clone_pkt, net_pkt_rx_hash(pkt));
 	net_pkt_set_orig_iface(clone_pkt, net_pkt_orig_iface(pkt));
 	net_pkt_set_captured(clone_pkt, net_pkt_is_captured(pkt));
 
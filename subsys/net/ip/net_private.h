@@ -71,6 +71,23 @@ static inline const char *net_context_state(struct net_context *context)
 }
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+/* Wake the epoll instances watching the socket of the context */
+extern void net_socket_epoll_notify(struct net_context *context);
+#else
+static inline void net_socket_epoll_notify(struct net_context *context)
+{
+	ARG_UNUSED(context);
+}
+#endif
+
+#if defined(CONFIG_NET_IPV6_ADDR_CACHE)
+/* Invalidate the cached IPv6 address lookups, after changing an address */
+extern void net_if_ipv6_addr_cache_flush(void);
+#else
+static inline void net_if_ipv6_addr_cache_flush(void) { }
+#endif
+
 #if defined(CONFIG_NET_NATIVE)
 enum net_verdict net_ipv4_input(struct net_pkt *pkt);
 enum net_verdict net_ipv6_input(struct net_pkt *pkt, bool is_loopback);
@@ -153,6 +170,39 @@ extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 extern uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
 
+/**
+ * @brief Update a checksum after some of the data it covers was rewritten
+ *
+ * Avoids computing the checksum again over the whole data, e.g. when only
+ * header fields are changed. The rewritten data must start at an even
+ * offset of the checksummed data.
+ *
+ * @param chksum	Checksum field, as stored in the header
+ * @param old_data	Data before the change
+ * @param new_data	Data after the change
+ * @param len		Length of the data, must be even
+ *
+ * @return New value of the checksum field
+ */
+uint16_t net_chksum_update(uint16_t chksum, const uint8_t *old_data,
+			   const uint8_t *new_data, size_t len);
+
+/**
+ * @brief Update a checksum after a 16-bit field it covers was rewritten
+ *
+ * @param chksum	Checksum field, as stored in the header
+ * @param old_val	Field before the change, as stored in the header
+ * @param new_val	Field after the change, as stored in the header
+ *
+ * @return New value of the checksum field
+ */
+static inline uint16_t net_chksum_update16(uint16_t chksum, uint16_t old_val,
+					   uint16_t new_val)
+{
+	return net_chksum_update(chksum, (const uint8_t *)&old_val,
+				 (const uint8_t *)&new_val, sizeof(uint16_t));
+}
+
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
  *        to the upper layers
@@ -66,6 +66,10 @@ LOG_MODULE_REGISTER(net_shell, LOG_LEVEL_DBG);
 
 #include <zephyr/net/capture.h>
 
+#if defined(CONFIG_NET_CAPTURE_RING) && defined(CONFIG_FILE_SYSTEM)
+#include <zephyr/fs/fs.h>
+#endif
+
 #if defined(CONFIG_NET_GPTP)
 #include <zephyr/net/gptp.h>
 #include "ethernet/gptp/gptp_messages.h"
@@ -1240,6 +1244,14 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	   GET_STAT(iface, ipv6_mld.sent),
 	   GET_STAT(iface, ipv6_mld.drop));
 #endif /* CONFIG_NET_STATISTICS_MLD */
+#if defined(CONFIG_NET_STATISTICS_IPV6_FRAGMENT)
+	PR("IPv6 frag reas %d\ttmout\t%d\tevict\t%d\tdrop\t%d\tlatency\t%" PRIu64 " ms\n",
+	   GET_STAT(iface, ipv6_frag.reassembled),
+	   GET_STAT(iface, ipv6_frag.timeout),
+	   GET_STAT(iface, ipv6_frag.evicted),
+	   GET_STAT(iface, ipv6_frag.drop),
+	   GET_STAT(iface, ipv6_frag.latency_sum));
+#endif /* CONFIG_NET_STATISTICS_IPV6_FRAGMENT */
 #endif /* CONFIG_NET_STATISTICS_IPV6 */
 
 #if defined(CONFIG_NET_STATISTICS_IPV4) && defined(CONFIG_NET_NATIVE_IPV4)
@@ -1248,6 +1260,14 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	   GET_STAT(iface, ipv4.sent),
 	   GET_STAT(iface, ipv4.drop),
 	   GET_STAT(iface, ipv4.forwarded));
+#if defined(CONFIG_NET_STATISTICS_IPV4_FRAGMENT)
+	PR("IPv4 frag reas %d\ttmout\t%d\tevict\t%d\tdrop\t%d\tlatency\t%" PRIu64 " ms\n",
+	   GET_STAT(iface, ipv4_frag.reassembled),
+	   GET_STAT(iface, ipv4_frag.timeout),
+	   GET_STAT(iface, ipv4_frag.evicted),
+	   GET_STAT(iface, ipv4_frag.drop),
+	   GET_STAT(iface, ipv4_frag.latency_sum));
+#endif /* CONFIG_NET_STATISTICS_IPV4_FRAGMENT */
 #endif /* CONFIG_NET_STATISTICS_IPV4 */
 
 	PR("IP vhlerr      %d\thblener\t%d\tlblener\t%d\n",
@@ -2019,6 +2039,160 @@ static int cmd_net_capture_disable(const struct shell *sh, size_t argc,
 	return 0;
 }
 
+#if defined(CONFIG_NET_CAPTURE_RING)
+struct capture_dump_data {
+	const struct shell *sh;
+	uint32_t offset;
+	size_t len;
+	uint8_t line[16];
+#if defined(CONFIG_FILE_SYSTEM)
+	struct fs_file_t file;
+#endif
+};
+
+static void capture_dump_line(struct capture_dump_data *data)
+{
+	const struct shell *sh = data->sh;
+	char hex[sizeof(data->line) * 3 + 1] = { 0 };
+	int i;
+
+	for (i = 0; i < data->len; i++) {
+		snprintk(&hex[i * 3], 4, " %02x", data->line[i]);
+	}
+
+	/* Same layout as xxd, so that "xxd -r" converts it back */
+	PR("%08x:%s\n", data->offset, hex);
+
+	data->offset += data->len;
+	data->len = 0;
+}
+
+static int capture_dump_cb(const void *buf, size_t len, void *user_data)
+{
+	struct capture_dump_data *data = user_data;
+	const uint8_t *ptr = buf;
+
+	while (len > 0) {
+		size_t copy = MIN(len, sizeof(data->line) - data->len);
+
+		memcpy(&data->line[data->len], ptr, copy);
+		data->len += copy;
+		ptr += copy;
+		len -= copy;
+
+		if (data->len == sizeof(data->line)) {
+			capture_dump_line(data);
+		}
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_FILE_SYSTEM)
+static int capture_dump_file_cb(const void *buf, size_t len, void *user_data)
+{
+	struct capture_dump_data *data = user_data;
+	ssize_t ret;
+
+	ret = fs_write(&data->file, buf, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return (size_t)ret == len ? 0 : -ENOSPC;
+}
+#endif /* CONFIG_FILE_SYSTEM */
+#endif /* CONFIG_NET_CAPTURE_RING */
+
+static int cmd_net_capture_ring(const struct shell *sh, size_t argc,
+				char *argv[])
+{
+#if defined(CONFIG_NET_CAPTURE_RING)
+	if (argc > 1) {
+		if (strcmp(argv[1], "on") == 0) {
+			net_capture_ring_enable(true);
+		} else if (strcmp(argv[1], "off") == 0) {
+			net_capture_ring_enable(false);
+		} else if (strcmp(argv[1], "clear") == 0) {
+			net_capture_ring_clear();
+		} else {
+			PR_WARNING("Unknown argument %s\n", argv[1]);
+			return -ENOEXEC;
+		}
+	}
+
+	PR_INFO("Network packet capture ring %s\n",
+		net_capture_ring_is_enabled() ? "enabled" : "disabled");
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "network packet capture ring");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_capture_dump(const struct shell *sh, size_t argc,
+				char *argv[])
+{
+#if defined(CONFIG_NET_CAPTURE_RING)
+	struct capture_dump_data data = {
+		.sh = sh,
+	};
+	int ret;
+
+	if (argc > 1) {
+#if defined(CONFIG_FILE_SYSTEM)
+		int err;
+
+		fs_file_t_init(&data.file);
+
+		/* Replace the previous capture, if any */
+		(void)fs_unlink(argv[1]);
+
+		ret = fs_open(&data.file, argv[1], FS_O_CREATE | FS_O_WRITE);
+		if (ret < 0) {
+			PR_WARNING("Cannot open %s (%d)\n", argv[1], ret);
+			return -ENOEXEC;
+		}
+
+		ret = net_capture_ring_export(capture_dump_file_cb, &data);
+
+		err = fs_close(&data.file);
+		if (ret >= 0 && err < 0) {
+			ret = err;
+		}
+#else
+		PR_INFO("Set %s to enable %s support.\n",
+			"CONFIG_FILE_SYSTEM", "file system");
+		return -ENOEXEC;
+#endif
+	} else {
+		ret = net_capture_ring_export(capture_dump_cb, &data);
+		if (data.len > 0) {
+			capture_dump_line(&data);
+		}
+	}
+
+	if (ret < 0) {
+		PR_WARNING("Capture %s failed (%d)\n", "dump", ret);
+		return -ENOEXEC;
+	}
+
+	PR_INFO("%d packets exported\n", ret);
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "network packet capture ring");
+#endif
+
+	return 0;
+}
+
 static int cmd_net_conn(const struct shell *sh, size_t argc, char *argv[])
 {
 	ARG_UNUSED(argc);
@@ -2205,6 +2379,15 @@ static void print_dns_info(const struct shell *sh,
 			   remaining);
 		}
 	}
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	struct dns_resolve_cache_stats stats;
+
+	dns_resolve_cache_get_stats(&stats);
+
+	PR("Cache hits %u negative hits %u misses %u prefetches %u\n",
+	   stats.hits, stats.negative_hits, stats.misses, stats.prefetches);
+#endif
 }
 #endif
 
@@ -2969,6 +3152,39 @@ static const char *selected_role_str(int port)
 	return "<unknown>";
 }
 
+#if defined(CONFIG_NET_GPTP_STATISTICS)
+static void gptp_print_dist(const struct shell *sh, const char *name,
+			    const struct gptp_stats_dist *dist)
+{
+	PR("%s distribution (ns)\n", name);
+
+	if (dist->count == 0U) {
+		PR("\tNo samples\n");
+		return;
+	}
+
+	PR("\tSamples %u, min %" PRId64 ", max %" PRId64 ", mean %" PRId64
+	   "\n", dist->count, dist->min, dist->max,
+	   dist->sum / (int64_t)dist->count);
+
+	for (int i = 0; i < GPTP_STATS_DIST_BUCKETS; i++) {
+		if (dist->buckets[i] == 0U) {
+			continue;
+		}
+
+		if (i == 0) {
+			PR("\t|x| < 16       : %u\n", dist->buckets[i]);
+		} else if (i == GPTP_STATS_DIST_BUCKETS - 1) {
+			PR("\t|x| >= %-8u: %u\n", (uint32_t)BIT(i + 3),
+			   dist->buckets[i]);
+		} else {
+			PR("\t|x| < %-9u: %u\n", (uint32_t)BIT(i + 4),
+			   dist->buckets[i]);
+		}
+	}
+}
+#endif /* CONFIG_NET_GPTP_STATISTICS */
+
 static void gptp_print_port_info(const struct shell *sh, int port)
 {
 	struct gptp_port_bmca_data *port_bmca_data;
@@ -3244,6 +3460,9 @@ static void gptp_print_port_info(const struct shell *sh, int port)
 	   "messages", "sent", port_param_ds->tx_pdelay_resp_fup_count);
 	PR("Announce %s %s                 : %u\n",
 	   "messages", "sent", port_param_ds->tx_announce_count);
+
+	gptp_print_dist(sh, "Offset from master", &port_param_ds->offset);
+	gptp_print_dist(sh, "Path delay", &port_param_ds->path_delay);
 #endif /* CONFIG_NET_GPTP_STATISTICS */
 }
 #endif /* CONFIG_NET_GPTP */
@@ -6249,6 +6468,15 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 		  cmd_net_capture_enable),
 	SHELL_CMD(disable, NULL, "Disable network packet capture.",
 		  cmd_net_capture_disable),
+	SHELL_CMD(ring, NULL, "Control the network packet capture ring.\n"
+		  "'net capture ring [on | off | clear]'",
+		  cmd_net_capture_ring),
+	SHELL_CMD(dump, NULL, "Export the network packet capture ring in "
+		  "pcapng format.\n"
+		  "'net capture dump [file]'\n"
+		  "Without a file, the data is printed in hex, use \"xxd -r\" "
+		  "to convert it back",
+		  cmd_net_capture_dump),
 	SHELL_SUBCMD_SET_END
 );
 
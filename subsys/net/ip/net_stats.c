@@ -17,6 +17,7 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
 #include <string.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <zephyr/net/net_core.h>
 
 #include "net_stats.h"
@@ -97,6 +98,15 @@ static inline void stats(struct net_if *iface)
 			 GET_STAT(iface, ipv6_mld.sent),
 			 GET_STAT(iface, ipv6_mld.drop));
 #endif /* CONFIG_NET_STATISTICS_MLD */
+#if defined(CONFIG_NET_STATISTICS_IPV6_FRAGMENT)
+		NET_INFO("IPv6 frag reas %d\ttmout\t%d\tevict\t%d\tdrop\t%d"
+			 "\tlatency\t%" PRIu64 " ms",
+			 GET_STAT(iface, ipv6_frag.reassembled),
+			 GET_STAT(iface, ipv6_frag.timeout),
+			 GET_STAT(iface, ipv6_frag.evicted),
+			 GET_STAT(iface, ipv6_frag.drop),
+			 GET_STAT(iface, ipv6_frag.latency_sum));
+#endif /* CONFIG_NET_STATISTICS_IPV6_FRAGMENT */
 #endif /* CONFIG_NET_STATISTICS_IPV6 */
 
 #if defined(CONFIG_NET_STATISTICS_IPV4)
@@ -105,6 +115,15 @@ static inline void stats(struct net_if *iface)
 			 GET_STAT(iface, ipv4.sent),
 			 GET_STAT(iface, ipv4.drop),
 			 GET_STAT(iface, ipv4.forwarded));
+#if defined(CONFIG_NET_STATISTICS_IPV4_FRAGMENT)
+		NET_INFO("IPv4 frag reas %d\ttmout\t%d\tevict\t%d\tdrop\t%d"
+			 "\tlatency\t%" PRIu64 " ms",
+			 GET_STAT(iface, ipv4_frag.reassembled),
+			 GET_STAT(iface, ipv4_frag.timeout),
+			 GET_STAT(iface, ipv4_frag.evicted),
+			 GET_STAT(iface, ipv4_frag.drop),
+			 GET_STAT(iface, ipv4_frag.latency_sum));
+#endif /* CONFIG_NET_STATISTICS_IPV4_FRAGMENT */
 #endif /* CONFIG_NET_STATISTICS_IPV4 */
 
 		NET_INFO("IP vhlerr      %d\thblener\t%d\tlblener\t%d",
@@ -345,6 +345,64 @@ static inline void net_stats_update_ipv4_igmp_drop(struct net_if *iface)
 #define net_stats_update_ipv4_igmp_drop(iface)
 #endif /* CONFIG_NET_STATISTICS_IGMP */
 
+#if defined(CONFIG_NET_STATISTICS_IPV4_FRAGMENT) && defined(CONFIG_NET_NATIVE)
+static inline void net_stats_update_ipv4_frag_reassembled(struct net_if *iface,
+							   uint32_t latency)
+{
+	UPDATE_STAT(iface, stats.ipv4_frag.reassembled++);
+	UPDATE_STAT(iface, stats.ipv4_frag.latency_sum += latency);
+}
+
+static inline void net_stats_update_ipv4_frag_timeout(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv4_frag.timeout++);
+}
+
+static inline void net_stats_update_ipv4_frag_evicted(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv4_frag.evicted++);
+}
+
+static inline void net_stats_update_ipv4_frag_drop(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv4_frag.drop++);
+}
+#else
+#define net_stats_update_ipv4_frag_reassembled(iface, latency)
+#define net_stats_update_ipv4_frag_timeout(iface)
+#define net_stats_update_ipv4_frag_evicted(iface)
+#define net_stats_update_ipv4_frag_drop(iface)
+#endif /* CONFIG_NET_STATISTICS_IPV4_FRAGMENT */
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_FRAGMENT) && defined(CONFIG_NET_NATIVE)
+static inline void net_stats_update_ipv6_frag_reassembled(struct net_if *iface,
+							   uint32_t latency)
+{
+	UPDATE_STAT(iface, stats.ipv6_frag.reassembled++);
+	UPDATE_STAT(iface, stats.ipv6_frag.latency_sum += latency);
+}
+
+static inline void net_stats_update_ipv6_frag_timeout(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv6_frag.timeout++);
+}
+
+static inline void net_stats_update_ipv6_frag_evicted(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv6_frag.evicted++);
+}
+
+static inline void net_stats_update_ipv6_frag_drop(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv6_frag.drop++);
+}
+#else
+#define net_stats_update_ipv6_frag_reassembled(iface, latency)
+#define net_stats_update_ipv6_frag_timeout(iface)
+#define net_stats_update_ipv6_frag_evicted(iface)
+#define net_stats_update_ipv6_frag_drop(iface)
+#endif /* CONFIG_NET_STATISTICS_IPV6_FRAGMENT */
+
 #if defined(CONFIG_NET_PKT_TXTIME_STATS) && defined(CONFIG_NET_STATISTICS)
 static inline void net_stats_update_tx_time(struct net_if *iface,
 					    uint32_t start_time,
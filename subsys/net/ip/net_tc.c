@@ -9,27 +9,39 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 
 #include <zephyr/kernel.h>
 #include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_function.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
 
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "tcp_internal.h"
 
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
- * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * where y indicates the traffic class id. The value of y can be from 0 to 7,
+ * or up to 63 for RX if there are several queues per traffic class.
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[yy]")
+
+/* Number of RX queues, each with its own thread, per traffic class */
+#if defined(CONFIG_NET_RX_STEERING)
+#define NET_RX_QUEUES CONFIG_NET_RX_STEERING_QUEUES
+#else
+#define NET_RX_QUEUES 1
+#endif
 
 /* Stacks for TX work queue */
 K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT * NET_RX_QUEUES,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
@@ -37,7 +49,17 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+/* The queues of traffic class tc are at [tc * NET_RX_QUEUES] onwards */
+static struct net_traffic_class rx_classes[NET_TC_RX_COUNT * NET_RX_QUEUES];
+#endif
+
+#if defined(CONFIG_NET_NAPI)
+/* Scheduled polling contexts, polled by the RX thread of napi_tc */
+static sys_slist_t napi_list = SYS_SLIST_STATIC_INIT(&napi_list);
+static struct k_spinlock napi_lock;
+static struct k_poll_signal napi_signal = K_POLL_SIGNAL_INITIALIZER(napi_signal);
+static uint8_t napi_tc;
+static bool napi_polling;
 #endif
 
 #if NET_TC_RX_COUNT > 0 || NET_TC_TX_COUNT > 0
@@ -60,12 +82,121 @@ bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 	return true;
 }
 
+#if defined(CONFIG_NET_RX_STEERING)
+struct rx_flow_key {
+	uint8_t src[sizeof(struct in6_addr)];
+	uint8_t dst[sizeof(struct in6_addr)];
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint16_t proto;
+};
+
+/* Compute the flow hash of a received packet from the headers in its first
+ * buffer. The packets that cannot be parsed get the hash 0.
+ */
+static uint32_t rx_flow_hash(struct net_pkt *pkt)
+{
+	struct rx_flow_key key = { 0 };
+	const uint8_t *data = pkt->buffer->data;
+	size_t len = pkt->buffer->len;
+	size_t hdr_len;
+	bool ports;
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(net_pkt_iface(pkt)) == &NET_L2_GET_NAME(ETHERNET)) {
+		uint16_t type;
+
+		if (len < sizeof(struct net_eth_hdr)) {
+			return 0;
+		}
+
+		type = sys_get_be16(data + offsetof(struct net_eth_hdr, type));
+		data += sizeof(struct net_eth_hdr);
+		len -= sizeof(struct net_eth_hdr);
+
+		if (type == NET_ETH_PTYPE_VLAN) {
+			if (len < 4) {
+				return 0;
+			}
+
+			type = sys_get_be16(data + 2);
+			data += 4;
+			len -= 4;
+		}
+
+		if (type != NET_ETH_PTYPE_IP && type != NET_ETH_PTYPE_IPV6) {
+			return 0;
+		}
+	}
+#endif
+
+	if (len >= NET_IPV4H_LEN && (data[0] >> 4) == 4) {
+		hdr_len = (data[0] & 0x0f) * 4U;
+		key.proto = data[9];
+		memcpy(key.src, data + 12, sizeof(struct in_addr));
+		memcpy(key.dst, data + 16, sizeof(struct in_addr));
+
+		/* Fragments have no ports, or only the first one. Hash all
+		 * of them without ports so that they stay in the same queue.
+		 */
+		ports = (sys_get_be16(data + 6) & 0x3fff) == 0;
+	} else if (len >= NET_IPV6H_LEN && (data[0] >> 4) == 6) {
+		hdr_len = NET_IPV6H_LEN;
+		key.proto = data[6];
+		memcpy(key.src, data + 8, sizeof(struct in6_addr));
+		memcpy(key.dst, data + 24, sizeof(struct in6_addr));
+		ports = true;
+	} else {
+		return 0;
+	}
+
+	if (ports && (key.proto == IPPROTO_TCP || key.proto == IPPROTO_UDP) &&
+	    len >= hdr_len + 2 * sizeof(uint16_t)) {
+		memcpy(&key.src_port, data + hdr_len, sizeof(uint16_t));
+		memcpy(&key.dst_port, data + hdr_len + sizeof(uint16_t),
+		       sizeof(uint16_t));
+	}
+
+	return sys_hash32_murmur3(&key, sizeof(key));
+}
+
+static uint8_t rx_queue(uint8_t tc, struct net_pkt *pkt)
+{
+	uint32_t hash = net_pkt_rx_hash(pkt);
+
+	if (hash == 0U) {
+		hash = rx_flow_hash(pkt);
+		net_pkt_set_rx_hash(pkt, hash);
+	}
+
+	return tc * NET_RX_QUEUES + hash % NET_RX_QUEUES;
+}
+#else
+static inline uint8_t rx_queue(uint8_t tc, struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return tc;
+}
+#endif /* CONFIG_NET_RX_STEERING */
+
 void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_RX_COUNT > 0
+	uint8_t queue = rx_queue(tc, pkt);
+
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
-	submit_to_queue(&rx_classes[tc].fifo, pkt);
+#if defined(CONFIG_NET_NAPI)
+	/* Received from a poll of this very thread, no need to queue it */
+	if (napi_polling && k_current_get() == &rx_classes[queue].handler) {
+		net_pkt_set_rx_batched(pkt, true);
+		net_process_rx_packet(pkt);
+		return;
+	}
+#endif
+
+	submit_to_queue(&rx_classes[queue].fifo, pkt);
 #else
 	ARG_UNUSED(tc);
 	ARG_UNUSED(pkt);
@@ -236,18 +367,144 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #endif
 #endif
 
+#if defined(CONFIG_NET_NAPI)
+void net_napi_schedule(struct net_napi *napi)
+{
+	k_spinlock_key_t key;
+
+	if (atomic_set(&napi->scheduled, 1)) {
+		return;
+	}
+
+	key = k_spin_lock(&napi_lock);
+	/* Otherwise appended by napi_poll() once its poll function returns */
+	if (!napi->polling) {
+		sys_slist_append(&napi_list, &napi->node);
+	}
+	k_spin_unlock(&napi_lock, key);
+
+	k_poll_signal_raise(&napi_signal, 0);
+}
+
+void net_napi_complete(struct net_napi *napi)
+{
+	atomic_clear(&napi->scheduled);
+}
+
+/* Poll each scheduled context once. Return true if some still have work. */
+static bool napi_poll(void)
+{
+	k_spinlock_key_t key;
+	struct net_napi *napi;
+	sys_slist_t list;
+	sys_snode_t *node;
+	bool pending = false;
+
+	key = k_spin_lock(&napi_lock);
+	list = napi_list;
+	sys_slist_init(&napi_list);
+	k_spin_unlock(&napi_lock, key);
+
+	if (sys_slist_is_empty(&list)) {
+		return false;
+	}
+
+	napi_polling = true;
+
+	while ((node = sys_slist_get(&list)) != NULL) {
+		napi = CONTAINER_OF(node, struct net_napi, node);
+
+		key = k_spin_lock(&napi_lock);
+		napi->polling = true;
+		k_spin_unlock(&napi_lock, key);
+
+		(void)napi->poll(napi, CONFIG_NET_NAPI_BUDGET);
+
+		/* Still scheduled if the device has more packets, or if its
+		 * interrupt scheduled it again after it completed.
+		 */
+		key = k_spin_lock(&napi_lock);
+		napi->polling = false;
+		if (atomic_get(&napi->scheduled) != 0) {
+			sys_slist_append(&napi_list, node);
+			pending = true;
+		}
+		k_spin_unlock(&napi_lock, key);
+	}
+
+	napi_polling = false;
+
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+	net_tcp_rx_batch_flush();
+#endif
+
+	return pending;
+}
+
+/* Get the next queued packet, polling the scheduled devices while waiting */
+static struct net_pkt *napi_fifo_get(struct k_fifo *fifo)
+{
+	struct k_poll_event events[] = {
+		K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+					 K_POLL_MODE_NOTIFY_ONLY, fifo),
+		K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL,
+					 K_POLL_MODE_NOTIFY_ONLY, &napi_signal),
+	};
+	struct net_pkt *pkt;
+	bool pending;
+
+	while (1) {
+		k_poll_signal_reset(&napi_signal);
+
+		pending = napi_poll();
+
+		pkt = k_fifo_get(fifo, K_NO_WAIT);
+		if (pkt != NULL || pending) {
+			return pkt;
+		}
+
+		(void)k_poll(events, ARRAY_SIZE(events), K_FOREVER);
+
+		events[0].state = K_POLL_STATE_NOT_READY;
+		events[1].state = K_POLL_STATE_NOT_READY;
+	}
+}
+#endif /* CONFIG_NET_NAPI */
+
 #if NET_TC_RX_COUNT > 0
 static void tc_rx_handler(struct k_fifo *fifo)
 {
 	struct net_pkt *pkt;
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+	int batched = 0;
+#endif
 
 	while (1) {
+#if defined(CONFIG_NET_NAPI)
+		if (fifo == &rx_classes[napi_tc * NET_RX_QUEUES].fifo) {
+			pkt = napi_fifo_get(fifo);
+		} else {
+			pkt = k_fifo_get(fifo, K_FOREVER);
+		}
+#else
 		pkt = k_fifo_get(fifo, K_FOREVER);
+#endif
 		if (pkt == NULL) {
 			continue;
 		}
 
+		/* The batch is flushed below before waiting for more packets */
+		net_pkt_set_rx_batched(pkt, true);
+
 		net_process_rx_packet(pkt);
+
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+		if (k_fifo_is_empty(fifo) ||
+		    ++batched >= CONFIG_NET_TCP_RX_BATCH_MAX) {
+			net_tcp_rx_batch_flush();
+			batched = 0;
+		}
+#endif
 	}
 }
 #endif
@@ -343,12 +600,16 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+#if defined(CONFIG_NET_NAPI)
+	napi_tc = net_rx_priority2tc(CONFIG_NET_RX_DEFAULT_PRIORITY);
+#endif
+
+	for (i = 0; i < NET_TC_RX_COUNT * NET_RX_QUEUES; i++) {
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		thread_priority = rx_tc2thread(i / NET_RX_QUEUES);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -382,6 +643,11 @@ void net_tc_rx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_RX_STEERING) && defined(CONFIG_SCHED_CPU_MASK)
+		/* Process the queues of a traffic class on different CPUs */
+		(void)k_thread_cpu_pin(tid, (i % NET_RX_QUEUES) % arch_num_cpus());
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
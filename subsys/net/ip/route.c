@@ -269,6 +269,307 @@ static int nbr_nexthop_put(struct net_nbr *nbr)
 			route->iface);					\
 	} } while (0)
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+/* Path-compressed binary trie of the route prefixes. There is a node for
+ * each prefix which has routes, and for each point where prefixes diverge,
+ * so at most two nodes per route.
+ */
+struct net_route_trie_node {
+	struct net_route_trie_node *child[2];
+	struct net_route_trie_node *parent;
+
+	/* Routes to this prefix, on different interfaces */
+	sys_slist_t routes;
+
+	struct in6_addr prefix;
+	uint8_t prefix_len;
+};
+
+static struct net_route_trie_node trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct net_route_trie_node *trie_free;
+static struct net_route_trie_node *trie_root;
+
+static inline int addr_bit(const struct in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8] >> (7 - (bit % 8))) & 1;
+}
+
+/* Number of leading bits of addr matching the prefix of node */
+static uint8_t trie_common_len(const struct net_route_trie_node *node,
+			       const struct in6_addr *addr, uint8_t len)
+{
+	uint8_t max = MIN(node->prefix_len, len);
+	uint8_t bit = 0U;
+	uint8_t diff;
+
+	while (bit < max) {
+		diff = node->prefix.s6_addr[bit / 8] ^ addr->s6_addr[bit / 8];
+		if (diff == 0U) {
+			bit += 8U;
+			continue;
+		}
+
+		while (!(diff & 0x80)) {
+			diff <<= 1;
+			bit++;
+		}
+
+		break;
+	}
+
+	return MIN(bit, max);
+}
+
+static struct net_route_trie_node *trie_node_alloc(const struct in6_addr *addr,
+						   uint8_t len)
+{
+	struct net_route_trie_node *node = trie_free;
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	trie_free = node->parent;
+
+	memset(node, 0, sizeof(*node));
+	memcpy(node->prefix.s6_addr, addr->s6_addr, len / 8);
+
+	if (len % 8) {
+		node->prefix.s6_addr[len / 8] = addr->s6_addr[len / 8] &
+						(uint8_t)(0xff << (8 - len % 8));
+	}
+
+	node->prefix_len = len;
+
+	return node;
+}
+
+static void trie_node_free(struct net_route_trie_node *node)
+{
+	node->parent = trie_free;
+	trie_free = node;
+}
+
+/* Pointer to the link from the parent of node, or to the root */
+static struct net_route_trie_node **trie_link(struct net_route_trie_node *node)
+{
+	struct net_route_trie_node *parent = node->parent;
+
+	if (parent == NULL) {
+		return &trie_root;
+	}
+
+	return &parent->child[addr_bit(&node->prefix, parent->prefix_len)];
+}
+
+static int trie_insert(struct net_route_entry *route)
+{
+	struct net_route_trie_node **link = &trie_root;
+	struct net_route_trie_node *parent = NULL;
+	struct net_route_trie_node *node, *leaf, *branch;
+	uint8_t len = route->prefix_len;
+	uint8_t common = 0U;
+
+	while ((node = *link) != NULL) {
+		common = trie_common_len(node, &route->addr, len);
+		if (common < node->prefix_len) {
+			break;
+		}
+
+		if (node->prefix_len == len) {
+			goto found;
+		}
+
+		parent = node;
+		link = &node->child[addr_bit(&route->addr, node->prefix_len)];
+	}
+
+	leaf = trie_node_alloc(&route->addr, len);
+	if (leaf == NULL) {
+		return -ENOMEM;
+	}
+
+	leaf->parent = parent;
+
+	if (node != NULL && common == len) {
+		/* The new prefix contains the one of node */
+		leaf->child[addr_bit(&node->prefix, len)] = node;
+		node->parent = leaf;
+	} else if (node != NULL) {
+		/* The prefixes diverge, join them under a new branch */
+		branch = trie_node_alloc(&route->addr, common);
+		if (branch == NULL) {
+			trie_node_free(leaf);
+			return -ENOMEM;
+		}
+
+		branch->parent = parent;
+		branch->child[addr_bit(&node->prefix, common)] = node;
+		branch->child[addr_bit(&route->addr, common)] = leaf;
+		node->parent = branch;
+		leaf->parent = branch;
+
+		*link = branch;
+		node = leaf;
+		goto found;
+	}
+
+	*link = leaf;
+	node = leaf;
+
+found:
+	sys_slist_prepend(&node->routes, &route->prefix_node);
+	route->trie = node;
+
+	return 0;
+}
+
+static void trie_remove(struct net_route_entry *route)
+{
+	struct net_route_trie_node *node = route->trie;
+	struct net_route_trie_node *parent, *child;
+
+	if (node == NULL) {
+		return;
+	}
+
+	sys_slist_find_and_remove(&node->routes, &route->prefix_node);
+	route->trie = NULL;
+
+	/* Drop the nodes which have no routes and do not branch anymore */
+	while (node != NULL && sys_slist_is_empty(&node->routes) &&
+	       (node->child[0] == NULL || node->child[1] == NULL)) {
+		parent = node->parent;
+		child = node->child[0] ? node->child[0] : node->child[1];
+
+		*trie_link(node) = child;
+		if (child != NULL) {
+			child->parent = parent;
+		}
+
+		trie_node_free(node);
+		node = parent;
+	}
+}
+
+static struct net_route_entry *trie_lookup(struct net_if *iface,
+					   struct in6_addr *dst)
+{
+	struct net_route_trie_node *node = trie_root;
+	struct net_route_entry *route, *found = NULL;
+
+	/* Longer prefixes are deeper, the last match is the longest one */
+	while (node != NULL &&
+	       trie_common_len(node, dst, 128) == node->prefix_len) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, prefix_node) {
+			if (!iface || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->prefix_len == 128U) {
+			break;
+		}
+
+		node = node->child[addr_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+
+static void trie_init(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(trie_nodes); i++) {
+		trie_node_free(&trie_nodes[i]);
+	}
+}
+#endif /* CONFIG_NET_ROUTE_TRIE */
+
+#if defined(CONFIG_NET_ROUTE_FLOW_CACHE)
+struct net_route_flow {
+	struct in6_addr src;
+	struct in6_addr dst;
+	struct in6_addr nexthop;
+	struct net_if *iface;
+	struct net_if *route_iface;
+	atomic_val_t gen;
+};
+
+static struct net_route_flow flows[CONFIG_NET_ROUTE_FLOW_CACHE_SIZE];
+
+/* Cached flows of an older generation are stale. As the generation starts
+ * at 1, unused entries are never valid.
+ */
+static atomic_t flow_gen = ATOMIC_INIT(1);
+
+static struct net_route_flow *flow_slot(struct net_if *iface,
+					const struct in6_addr *src,
+					const struct in6_addr *dst)
+{
+	uint32_t hash = POINTER_TO_UINT(iface);
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		hash = (hash ^ UNALIGNED_GET(&src->s6_addr32[i])) * 0x9e3779b1U;
+		hash = (hash ^ UNALIGNED_GET(&dst->s6_addr32[i])) * 0x9e3779b1U;
+	}
+
+	return &flows[(hash >> 16) % ARRAY_SIZE(flows)];
+}
+
+bool net_route_flow_get(struct net_if *iface,
+			const struct in6_addr *src,
+			const struct in6_addr *dst,
+			struct net_if **route_iface,
+			struct in6_addr *nexthop)
+{
+	struct net_route_flow *flow;
+	bool ret = false;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	flow = flow_slot(iface, src, dst);
+	if (flow->gen == atomic_get(&flow_gen) && flow->iface == iface &&
+	    net_ipv6_addr_cmp(&flow->dst, dst) &&
+	    net_ipv6_addr_cmp(&flow->src, src)) {
+		*route_iface = flow->route_iface;
+		net_ipaddr_copy(nexthop, &flow->nexthop);
+		ret = true;
+	}
+
+	k_mutex_unlock(&lock);
+
+	return ret;
+}
+
+void net_route_flow_add(struct net_if *iface,
+			const struct in6_addr *src,
+			const struct in6_addr *dst,
+			struct net_if *route_iface,
+			const struct in6_addr *nexthop)
+{
+	struct net_route_flow *flow;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	flow = flow_slot(iface, src, dst);
+	flow->iface = iface;
+	flow->route_iface = route_iface;
+	net_ipaddr_copy(&flow->src, src);
+	net_ipaddr_copy(&flow->dst, dst);
+	net_ipaddr_copy(&flow->nexthop, nexthop);
+	flow->gen = atomic_get(&flow_gen);
+
+	k_mutex_unlock(&lock);
+}
+
+void net_route_flow_flush(void)
+{
+	atomic_inc(&flow_gen);
+}
+#endif /* CONFIG_NET_ROUTE_FLOW_CACHE */
+
 /* Route was accessed, so place it in front of the routes list */
 static inline void update_route_access(struct net_route_entry *route)
 {
@@ -279,13 +580,17 @@ static inline void update_route_access(struct net_route_entry *route)
 struct net_route_entry *net_route_lookup(struct net_if *iface,
 					 struct in6_addr *dst)
 {
-	struct net_route_entry *route, *found = NULL;
-	uint8_t longest_match = 0U;
-	int i;
+	struct net_route_entry *found = NULL;
 
 	k_mutex_lock(&lock, K_FOREVER);
 
-	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	found = trie_lookup(iface, dst);
+#else
+	struct net_route_entry *route;
+	uint8_t longest_match = 0U;
+
+	for (int i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
 		if (!nbr->ref) {
@@ -306,6 +611,7 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 			longest_match = route->prefix_len;
 		}
 	}
+#endif
 
 	if (found) {
 		net_route_info("Found", found, dst);
@@ -317,6 +623,33 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 	return found;
 }
 
+/* Find the route to exactly this prefix, not the longest matching one */
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *addr,
+					  uint8_t prefix_len)
+{
+	struct net_route_entry *route;
+	struct net_nbr *nbr;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_MAX_ROUTES; i++) {
+		nbr = get_nbr(i);
+		if (!nbr->ref || nbr->iface != iface) {
+			continue;
+		}
+
+		route = net_route_data(nbr);
+
+		if (route->prefix_len == prefix_len &&
+		    net_ipv6_is_prefix(addr->s6_addr, route->addr.s6_addr,
+				       prefix_len)) {
+			return route;
+		}
+	}
+
+	return NULL;
+}
+
 static inline bool route_preference_is_lower(uint8_t old, uint8_t new)
 {
 	if (new == NET_ROUTE_PREFERENCE_RESERVED || (new & 0xfc) != 0) {
@@ -370,7 +703,7 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 			net_sprint_ll_addr(nexthop_lladdr->addr, nexthop_lladdr->len));
 	}
 
-	route = net_route_lookup(iface, addr);
+	route = route_find(iface, addr, prefix_len);
 	if (route) {
 		/* Update nexthop if not the same */
 		struct in6_addr *nexthop_addr;
@@ -451,6 +784,16 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	route->iface = iface;
 	route->preference = preference;
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	if (trie_insert(route) < 0) {
+		NET_ERR("No route trie node available!");
+		net_nbr_unref(tmp);
+		nbr_free(nbr);
+		route = NULL;
+		goto exit;
+	}
+#endif
+
 	net_route_update_lifetime(route, lifetime);
 
 	sys_slist_prepend(&routes, &route->node);
@@ -466,6 +809,8 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	net_route_info("Added", route, addr);
 
+	net_route_flow_flush();
+
 #if defined(CONFIG_NET_MGMT_EVENT_INFO)
 	net_ipaddr_copy(&info.addr, addr);
 	net_ipaddr_copy(&info.nexthop, nexthop);
@@ -597,6 +942,8 @@ int net_route_del(struct net_route_entry *route)
 
 	sys_slist_find_and_remove(&routes, &route->node);
 
+	net_route_flow_flush();
+
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
 		k_mutex_unlock(&lock);
@@ -605,6 +952,10 @@ int net_route_del(struct net_route_entry *route)
 
 	net_route_info("Deleted", route, &route->addr);
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	trie_remove(route);
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&route->nexthop, nexthop_route, node) {
 		if (!nexthop_route->nbr) {
 			continue;
@@ -1101,4 +1452,8 @@ void net_route_init(void)
 		CONFIG_NET_MAX_NEXTHOPS, sizeof(net_route_nexthop_pool));
 
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
+
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	trie_init();
+#endif
 }
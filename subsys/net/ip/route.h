@@ -68,6 +68,14 @@ struct net_route_entry {
 
 	/** Is the route valid forever */
 	uint8_t is_infinite : 1;
+
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	/** Node in the route list of the prefix trie node. */
+	sys_snode_t prefix_node;
+
+	/** Prefix trie node of the route. */
+	struct net_route_trie_node *trie;
+#endif
 };
 
 /* Route preference values, as defined in RFC 4191 */
@@ -319,6 +327,51 @@ int net_route_packet(struct net_pkt *pkt, struct in6_addr *nexthop);
  */
 int net_route_packet_if(struct net_pkt *pkt, struct net_if *iface);
 
+#if defined(CONFIG_NET_ROUTE_FLOW_CACHE) && defined(CONFIG_NET_NATIVE)
+/**
+ * @brief Get the cached forwarding decision of a flow.
+ *
+ * @param iface Network interface the packet was received from.
+ * @param src Source address of the packet.
+ * @param dst Destination address of the packet.
+ * @param route_iface Set to the interface of the route, or NULL if the packet
+ * interface is kept.
+ * @param nexthop Set to the next hop of the packet.
+ *
+ * @return True if the flow is cached, false otherwise.
+ */
+bool net_route_flow_get(struct net_if *iface,
+			const struct in6_addr *src,
+			const struct in6_addr *dst,
+			struct net_if **route_iface,
+			struct in6_addr *nexthop);
+
+/**
+ * @brief Cache the forwarding decision of a flow.
+ *
+ * @param iface Network interface the packet was received from.
+ * @param src Source address of the packet.
+ * @param dst Destination address of the packet.
+ * @param route_iface Interface of the route, or NULL to keep the packet
+ * interface.
+ * @param nexthop Next hop of the packet.
+ */
+void net_route_flow_add(struct net_if *iface,
+			const struct in6_addr *src,
+			const struct in6_addr *dst,
+			struct net_if *route_iface,
+			const struct in6_addr *nexthop);
+
+/**
+ * @brief Forget all the cached flows.
+ *
+ * Called when a route, neighbor or router changes. Does not take any lock.
+ */
+void net_route_flow_flush(void);
+#else
+static inline void net_route_flow_flush(void) { }
+#endif /* CONFIG_NET_ROUTE_FLOW_CACHE */
+
 #if defined(CONFIG_NET_ROUTE) && defined(CONFIG_NET_NATIVE)
 void net_route_init(void);
 #else
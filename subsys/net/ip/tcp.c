@@ -56,12 +56,18 @@ static int tcp_tx_window =
 	CONFIG_NET_BUF_DATA_POOL_SIZE / 3;
 #endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
 #endif
-#ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
+#if defined(CONFIG_NET_TCP_RANDOMIZED_RTO) || defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
 #define TCP_RTO_MS (conn->rto)
 #else
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
+#if defined(CONFIG_NET_TCP_GSO)
+#define TCP_GSO_MAX_SEGS CONFIG_NET_TCP_GSO_MAX_SEGS
+#else
+#define TCP_GSO_MAX_SEGS 1
+#endif
+
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -72,7 +78,15 @@ K_MEM_SLAB_DEFINE_STATIC(tcp_conns_slab, sizeof(struct tcp),
 static struct k_work_q tcp_work_q;
 static K_KERNEL_STACK_DEFINE(work_q_stack, CONFIG_NET_TCP_WORKQ_STACK_SIZE);
 
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+/* Connections holding data coalesced since the last flush */
+static sys_slist_t tcp_rx_batch_conns = SYS_SLIST_STATIC_INIT(&tcp_rx_batch_conns);
+static struct k_spinlock tcp_rx_batch_lock;
+#endif
+
 static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt);
+static void tcp_conn_ref(struct tcp *conn);
+static int tcp_pkt_pull(struct net_pkt *pkt, size_t len);
 static bool is_destination_local(struct net_pkt *pkt);
 static void tcp_out(struct tcp *conn, uint8_t flags);
 static const char *tcp_state_to_str(enum tcp_state state, bool prefix);
@@ -372,8 +386,14 @@ out:
 
 static void tcp_derive_rto(struct tcp *conn)
 {
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+	/* Start from the RTO estimated from the measured RTT */
+	uint32_t base_rto = conn->cc.rto;
+#else
+	uint32_t base_rto = (uint32_t)tcp_rto;
+#endif
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
-	/* Compute a randomized rto 1 and 1.5 times tcp_rto */
+	/* Compute a randomized rto 1 and 1.5 times the base rto */
 	uint32_t gain;
 	uint8_t gain8;
 	uint32_t rto;
@@ -384,11 +404,14 @@ static void tcp_derive_rto(struct tcp *conn)
 	gain = (uint32_t)gain8;
 	gain += 1 << 9;
 
-	rto = (uint32_t)tcp_rto;
+	rto = base_rto;
 	rto = (gain * rto) >> 9;
-	conn->rto = (uint16_t)rto;
+	conn->rto = rto;
+#elif defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+	conn->rto = base_rto;
 #else
 	ARG_UNUSED(conn);
+	ARG_UNUSED(base_rto);
 #endif
 }
 
@@ -432,6 +455,13 @@ static int tcp_conn_unref(struct tcp *conn)
 
 	k_mutex_lock(&tcp_lock, K_FOREVER);
 
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+	if (conn->rx_batch != NULL) {
+		k_fifo_put(&conn->recv_data, conn->rx_batch);
+		conn->rx_batch = NULL;
+	}
+#endif
+
 	/* If there is any pending data, pass that to application */
 	while ((pkt = k_fifo_get(&conn->recv_data, K_NO_WAIT)) != NULL) {
 		if (net_context_packet_received(
@@ -457,10 +487,15 @@ static int tcp_conn_unref(struct tcp *conn)
 	k_work_cancel_delayable(&conn->send_data_timer);
 	tcp_pkt_unref(conn->send_data);
 
-	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT) {
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT && conn->queue_recv_data) {
 		tcp_pkt_unref(conn->queue_recv_data);
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
+	tcp_ooo_flush(conn);
+#endif
+
 	(void)k_work_cancel_delayable(&conn->timewait_timer);
 	(void)k_work_cancel_delayable(&conn->fin_timer);
 	(void)k_work_cancel_delayable(&conn->persist_timer);
@@ -683,8 +718,16 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+#if defined(CONFIG_NET_TCP_SACK)
+	/* Segments carrying SACK blocks have no MSS option, the one of the
+	 * SYN remains valid.
+	 */
+	recv_options->sack_perm_found = false;
+	recv_options->sack_cnt = 0;
+#else
+	recv_options->mss_found = false;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -733,6 +776,41 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#if defined(CONFIG_NET_TCP_SACK)
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if ((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE != 0 ||
+			    opt_len < 2 + NET_TCP_SACK_BLOCK_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = 2; i < opt_len &&
+			     recv_options->sack_cnt < NET_TCP_SACK_MAX_BLOCKS;
+			     i += NET_TCP_SACK_BLOCK_SIZE) {
+				struct tcp_seq_range *block =
+					&recv_options->sack[recv_options->sack_cnt];
+				uint32_t left, right;
+
+				left = ntohl(UNALIGNED_GET((uint32_t *)(options + i)));
+				right = ntohl(UNALIGNED_GET((uint32_t *)(options + i + 4)));
+				if (net_tcp_seq_cmp(right, left) <= 0) {
+					continue;
+				}
+
+				block->seq = left;
+				block->len = right - left;
+				recv_options->sack_cnt++;
+			}
+			break;
+#endif /* CONFIG_NET_TCP_SACK */
 		default:
 			continue;
 		}
@@ -793,9 +871,247 @@ static int tcp_update_recv_wnd(struct tcp *conn, int32_t delta)
 	return 0;
 }
 
+/* Drop len bytes from the start of a buffer chain, return the new head.
+ * The data left is not moved, it may be application data referenced by
+ * a zero-copy send.
+ */
+static struct net_buf *tcp_buf_pull(struct net_buf *buf, size_t len)
+{
+	while (buf && len > 0) {
+		if (len < buf->len) {
+			net_buf_pull(buf, len);
+			break;
+		}
+
+		len -= buf->len;
+		buf = net_buf_frag_del(NULL, buf);
+	}
+
+	return buf;
+}
+
+#if defined(CONFIG_NET_TCP_SACK)
+/* Keep the first len bytes of a buffer chain, return the new head */
+static struct net_buf *tcp_buf_trim(struct net_buf *buf, size_t len)
+{
+	struct net_buf *head = buf;
+	struct net_buf *prev = NULL;
+
+	while (buf && len >= buf->len) {
+		len -= buf->len;
+		prev = buf;
+		buf = buf->frags;
+	}
+
+	if (buf && len > 0) {
+		buf->len = len;
+		prev = buf;
+		buf = buf->frags;
+	}
+
+	if (prev) {
+		prev->frags = NULL;
+	} else {
+		head = NULL;
+	}
+
+	if (buf) {
+		net_buf_unref(buf);
+	}
+
+	return head;
+}
+
+static void tcp_ooo_remove(struct tcp_sack *sack, int first, int count)
+{
+	memmove(&sack->ooo[first], &sack->ooo[first + count],
+		(sack->ooo_cnt - first - count) * sizeof(sack->ooo[0]));
+	sack->ooo_cnt -= count;
+}
+
+static void tcp_ooo_flush(struct tcp *conn)
+{
+	struct tcp_sack *sack = &conn->sack;
+
+	for (int i = 0; i < sack->ooo_cnt; i++) {
+		net_buf_unref(sack->ooo[i].buf);
+	}
+
+	sack->ooo_cnt = 0;
+}
+
+/* Index of the first range ending at or after seq, the ranges are
+ * ordered by their offset from the next expected sequence number.
+ */
+static int tcp_ooo_find(struct tcp *conn, uint32_t seq)
+{
+	struct tcp_sack *sack = &conn->sack;
+	uint32_t offset = seq - conn->ack;
+	int low = 0;
+	int high = sack->ooo_cnt;
+
+	while (low < high) {
+		int mid = (low + high) / 2;
+		struct tcp_ooo_range *range = &sack->ooo[mid];
+
+		if (range->seq + range->len - conn->ack < offset) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/* Store len bytes of out-of-order data in buf starting at seq, merging
+ * it with the ranges it overlaps or touches.
+ */
+static void tcp_ooo_insert(struct tcp *conn, struct net_buf *buf,
+			   uint32_t seq, uint32_t len)
+{
+	struct tcp_sack *sack = &conn->sack;
+	struct tcp_ooo_range *range;
+	uint32_t end = seq + len;
+	int first = tcp_ooo_find(conn, seq);
+	int last = first;
+	struct net_buf *head = NULL;
+	struct net_buf *tail = NULL;
+
+	while (last < sack->ooo_cnt &&
+	       sack->ooo[last].seq - conn->ack <= end - conn->ack) {
+		last++;
+	}
+
+	if (first == last) {
+		/* Not touching any range */
+		if (sack->ooo_cnt == CONFIG_NET_TCP_SACK_MAX_RANGES) {
+			if (first == sack->ooo_cnt) {
+				net_buf_unref(buf);
+				return;
+			}
+
+			/* Keep what is closest to being delivered */
+			net_buf_unref(sack->ooo[sack->ooo_cnt - 1].buf);
+			sack->ooo_cnt--;
+		}
+
+		memmove(&sack->ooo[first + 1], &sack->ooo[first],
+			(sack->ooo_cnt - first) * sizeof(sack->ooo[0]));
+		sack->ooo_cnt++;
+
+		range = &sack->ooo[first];
+		range->seq = seq;
+		range->len = len;
+		range->buf = buf;
+		return;
+	}
+
+	last--;
+	range = &sack->ooo[first];
+
+	if (range->seq - conn->ack <= seq - conn->ack &&
+	    range->seq + range->len - conn->ack >= end - conn->ack) {
+		/* Nothing new */
+		net_buf_unref(buf);
+		return;
+	}
+
+	if (net_tcp_seq_cmp(range->seq, seq) < 0) {
+		/* Keep the start of the first range, drop what overlaps */
+		head = range->buf;
+		range->buf = NULL;
+		buf = tcp_buf_pull(buf, range->seq + range->len - seq);
+		len -= range->seq + range->len - seq;
+		seq = range->seq + range->len;
+	}
+
+	range = &sack->ooo[last];
+
+	if (net_tcp_seq_cmp(range->seq + range->len, end) > 0) {
+		/* Keep the end of the last range, drop what overlaps */
+		tail = range->buf;
+		range->buf = NULL;
+		buf = tcp_buf_trim(buf, range->seq - seq);
+		len = range->seq - seq;
+	}
+
+	if (head) {
+		seq = sack->ooo[first].seq;
+		len += sack->ooo[first].len;
+		if (buf) {
+			net_buf_frag_add(head, buf);
+		}
+
+		buf = head;
+	}
+
+	if (tail) {
+		len += sack->ooo[last].len;
+		if (buf) {
+			net_buf_frag_add(buf, tail);
+		} else {
+			buf = tail;
+		}
+	}
+
+	/* The ranges in between are covered by the new data */
+	for (int i = first; i <= last; i++) {
+		if (sack->ooo[i].buf) {
+			net_buf_unref(sack->ooo[i].buf);
+		}
+	}
+
+	range = &sack->ooo[first];
+	range->seq = seq;
+	range->len = len;
+	range->buf = buf;
+
+	tcp_ooo_remove(sack, first + 1, last - first);
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 static size_t tcp_check_pending_data(struct tcp *conn, struct net_pkt *pkt,
 				     size_t len)
 {
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack *sack = &conn->sack;
+	uint32_t seq = th_seq(th_get(pkt));
+	size_t pending_len = 0;
+
+	while (sack->ooo_cnt > 0) {
+		struct tcp_ooo_range *range = &sack->ooo[0];
+		uint32_t expected_seq = seq + len;
+		int32_t tail = (int32_t)(range->seq + range->len - expected_seq);
+
+		if (net_tcp_seq_cmp(range->seq, expected_seq) > 0) {
+			break;
+		}
+
+		if (tail > 0) {
+			/* Append what the packet does not hold yet */
+			range->buf = tcp_buf_pull(range->buf, range->len - tail);
+			net_buf_frag_add(pkt->buffer, range->buf);
+			range->buf = NULL;
+
+			NET_DBG("Found pending data seq %u len %d",
+				expected_seq, tail);
+
+			pending_len += tail;
+			len += tail;
+		} else {
+			net_buf_unref(range->buf);
+		}
+
+		tcp_ooo_remove(sack, 0, 1);
+	}
+
+	if (sack->ooo_cnt == 0) {
+		k_work_cancel_delayable(&conn->recv_queue_timer);
+	}
+
+	return pending_len;
+#else
 	size_t pending_len = 0;
 
 	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT &&
@@ -853,7 +1169,42 @@ static size_t tcp_check_pending_data(struct tcp *conn, struct net_pkt *pkt,
 	}
 
 	return pending_len;
+#endif /* CONFIG_NET_TCP_SACK */
+}
+
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+/* Add the data of pkt, with the cursor at its start, to the batch of
+ * the connection. The first packet of a batch carries the data of the
+ * following ones, whose headers are dropped.
+ */
+static void tcp_rx_batch_add(struct tcp *conn, struct net_pkt *pkt, size_t len)
+{
+	k_spinlock_key_t key;
+
+	if (conn->rx_batch == NULL) {
+		conn->rx_batch = pkt;
+	} else if (tcp_pkt_pull(pkt, net_pkt_get_len(pkt) - len) < 0) {
+		/* Cannot happen as len is at most the packet length, but
+		 * keep the data in order anyway.
+		 */
+		k_fifo_put(&conn->recv_data, conn->rx_batch);
+		conn->rx_batch = pkt;
+	} else {
+		net_buf_frag_add(conn->rx_batch->buffer, pkt->buffer);
+		pkt->buffer = NULL;
+		tcp_pkt_unref(pkt);
+	}
+
+	if (!conn->rx_batch_listed) {
+		conn->rx_batch_listed = true;
+		tcp_conn_ref(conn);
+
+		key = k_spin_lock(&tcp_rx_batch_lock);
+		sys_slist_append(&tcp_rx_batch_conns, &conn->rx_batch_node);
+		k_spin_unlock(&tcp_rx_batch_lock, key);
+	}
 }
+#endif /* CONFIG_NET_TCP_RX_BATCH */
 
 static enum net_verdict tcp_data_get(struct tcp *conn, struct net_pkt *pkt, size_t *len)
 {
@@ -883,6 +1234,13 @@ static enum net_verdict tcp_data_get(struct tcp *conn, struct net_pkt *pkt, size
 		 * data is placed in fifo which is flushed in tcp_in()
 		 * after unlocking the conn
 		 */
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+		if (net_pkt_is_rx_batched(pkt)) {
+			tcp_rx_batch_add(conn, pkt, *len);
+			ret = NET_OK;
+			goto out;
+		}
+#endif
 		k_fifo_put(&conn->recv_data, pkt);
 
 		ret = NET_OK;
@@ -906,6 +1264,43 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* Number of SACK blocks to report in an ACK */
+static int tcp_sack_blocks(struct tcp *conn)
+{
+	if (!conn->sack.permitted) {
+		return 0;
+	}
+
+	return MIN(conn->sack.ooo_cnt, NET_TCP_SACK_MAX_BLOCKS);
+}
+#endif
+
+/* Length of the options of an outgoing segment, a multiple of 4 */
+static size_t tcp_options_len(struct tcp *conn, uint8_t flags)
+{
+	size_t len = 0;
+
+	if (conn->send_options.mss_found) {
+		len += NET_TCP_MSS_SIZE;
+	}
+
+#if defined(CONFIG_NET_TCP_SACK)
+	if (conn->send_options.sack_perm_found) {
+		len += 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+	}
+
+	if ((flags & ACK) && tcp_sack_blocks(conn) > 0) {
+		len += 2 * NET_TCP_NOP_SIZE + 2 +
+		       tcp_sack_blocks(conn) * NET_TCP_SACK_BLOCK_SIZE;
+	}
+#else
+	ARG_UNUSED(flags);
+#endif
+
+	return len;
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -921,11 +1316,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + tcp_options_len(conn, flags) / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -986,6 +1377,46 @@ static int get_tcp_nodelay(struct tcp *conn, void *value, size_t *len)
 	return 0;
 }
 
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+#define TCP_CC_NAME_MAX 16
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	char name[TCP_CC_NAME_MAX];
+	const struct tcp_cc_ops *ops;
+
+	len = MIN(len, sizeof(name) - 1);
+	memcpy(name, value, len);
+	name[len] = '\0';
+
+	ops = tcp_cc_find(name);
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	tcp_cc_select(conn, ops);
+
+	return 0;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	size_t name_len = strlen(conn->cc.ops->name) + 1;
+
+	if (len == NULL || *len == 0) {
+		return -EINVAL;
+	}
+
+	/* Truncate like Linux does, the result is always terminated */
+	name_len = MIN(name_len, *len);
+	memcpy(value, conn->cc.ops->name, name_len - 1);
+	((char *)value)[name_len - 1] = '\0';
+	*len = name_len;
+
+	return 0;
+}
+#endif /* CONFIG_NET_TCP_CONGESTION_CONTROL */
+
 static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(mss_opt_access, struct tcp_mss_option);
@@ -1005,6 +1436,72 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+static void tcp_sack_block_put(uint8_t *opt, uint32_t seq, uint32_t len)
+{
+	UNALIGNED_PUT(htonl(seq), (uint32_t *)opt);
+	UNALIGNED_PUT(htonl(seq + len), (uint32_t *)(opt + 4));
+}
+
+/* Add the SACK permitted option and the SACK blocks, the block holding
+ * the latest out-of-order segment comes first (RFC 2018).
+ */
+static int net_tcp_set_sack_opt(struct tcp *conn, struct net_pkt *pkt,
+				uint8_t flags)
+{
+	uint8_t opts[2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE +
+		     2 * NET_TCP_NOP_SIZE + 2 +
+		     NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE];
+	struct tcp_sack *sack = &conn->sack;
+	int blocks = (flags & ACK) ? tcp_sack_blocks(conn) : 0;
+	size_t len = 0;
+	int first = 0;
+
+	if (conn->send_options.sack_perm_found) {
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_SACK_PERM_OPT;
+		opts[len++] = NET_TCP_SACK_PERM_SIZE;
+	}
+
+	if (blocks > 0) {
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_SACK_OPT;
+		opts[len++] = 2 + blocks * NET_TCP_SACK_BLOCK_SIZE;
+
+		for (int i = 0; i < sack->ooo_cnt; i++) {
+			if (sack->ooo_last_seq - sack->ooo[i].seq <
+			    sack->ooo[i].len) {
+				first = i;
+				break;
+			}
+		}
+
+		tcp_sack_block_put(&opts[len], sack->ooo[first].seq,
+				   sack->ooo[first].len);
+		len += NET_TCP_SACK_BLOCK_SIZE;
+
+		for (int i = 0; i < sack->ooo_cnt && blocks > 1; i++) {
+			if (i == first) {
+				continue;
+			}
+
+			tcp_sack_block_put(&opts[len], sack->ooo[i].seq,
+					   sack->ooo[i].len);
+			len += NET_TCP_SACK_BLOCK_SIZE;
+			blocks--;
+		}
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	return net_pkt_write(pkt, opts, len);
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1031,14 +1528,10 @@ static bool is_destination_local(struct net_pkt *pkt)
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	size_t alloc_len = sizeof(struct tcphdr) + tcp_options_len(conn, flags);
 	struct net_pkt *pkt;
 	int ret = 0;
 
-	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
-	}
-
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1048,6 +1541,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	if (data) {
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
 		data->buffer = NULL;
 	}
 
@@ -1071,6 +1565,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	ret = net_tcp_set_sack_opt(conn, pkt, flags);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+#endif
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1096,132 +1598,551 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	} else if (tcp_send_process_no_lock(conn)) {
 		tcp_conn_close(conn, -ETIMEDOUT);
 	}
-out:
-	return ret;
-}
+out:
+	return ret;
+}
+
+static void tcp_out(struct tcp *conn, uint8_t flags)
+{
+	(void)tcp_out_ext(conn, flags, NULL /* no data */, conn->seq);
+}
+
+#if defined(CONFIG_NET_TCP_GSO)
+/* Send len bytes of data at offset of the super-packet pkt, with a copy
+ * of its headers of hdrs_len bytes.
+ */
+static int tcp_gso_send_segment(struct net_pkt *pkt, size_t hdrs_len,
+				size_t offset, size_t len, bool last)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	struct net_pkt *seg;
+	struct tcphdr *th;
+	int ret;
+
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdrs_len + len,
+					net_pkt_family(pkt), IPPROTO_TCP,
+					TCP_PKT_ALLOC_TIMEOUT);
+	if (!seg) {
+		return -ENOBUFS;
+	}
+
+	net_pkt_set_context(seg, net_pkt_context(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_ttl(seg, net_pkt_ipv4_ttl(pkt));
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		net_pkt_set_ipv6_hop_limit(seg, net_pkt_ipv6_hop_limit(pkt));
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_hdr_prev(seg, net_pkt_ipv6_hdr_prev(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_copy(seg, pkt, hdrs_len) < 0 ||
+	    net_pkt_skip(pkt, offset) < 0 ||
+	    net_pkt_copy(seg, pkt, len) < 0) {
+		ret = -ENOBUFS;
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		/* The checksum is computed over the header as is */
+		NET_IPV4_HDR(seg)->chksum = 0U;
+	}
+
+	/* Only the last segment pushes the data */
+	net_pkt_skip(seg, net_pkt_ip_hdr_len(seg) + net_pkt_ip_opts_len(seg));
+	th = (struct tcphdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!th) {
+		ret = -ENOBUFS;
+		goto fail;
+	}
+
+	UNALIGNED_PUT(htonl(th_seq(th) + offset), &th->th_seq);
+
+	if (!last) {
+		UNALIGNED_PUT(th_flags(th) & ~PSH, &th->th_flags);
+	}
+
+	ret = net_pkt_set_data(seg, &tcp_access);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	ret = tcp_finalize_pkt(seg);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	net_pkt_set_overwrite(seg, false);
+	net_pkt_cursor_init(seg);
+
+	ret = net_send_data(seg);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return 0;
+
+fail:
+	tcp_pkt_unref(seg);
+
+	return ret;
+}
+
+int net_tcp_gso_send(struct net_pkt *pkt)
+{
+	size_t gso_size = net_pkt_gso_size(pkt);
+	size_t hdrs_len, data_len, offset, len;
+	int ret;
+
+	hdrs_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+		   th_off(th_get(pkt)) * 4;
+	data_len = net_pkt_get_len(pkt) - hdrs_len;
+
+	for (offset = 0; offset < data_len; offset += len) {
+		len = MIN(gso_size, data_len - offset);
+
+		ret = tcp_gso_send_segment(pkt, hdrs_len, offset, len,
+					   offset + len == data_len);
+		if (ret < 0) {
+			NET_DBG("Cannot send segment at %zu (%d)", offset, ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
+static int tcp_pkt_pull(struct net_pkt *pkt, size_t len)
+{
+	int total = net_pkt_get_len(pkt);
+	int ret = 0;
+
+	if (len > total) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	pkt->buffer = tcp_buf_pull(pkt->buffer, len);
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_trim_buffer(pkt);
+ out:
+	return ret;
+}
+
+static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
+			size_t len)
+{
+	net_pkt_cursor_init(to);
+	net_pkt_cursor_init(from);
+
+	if (pos) {
+		net_pkt_set_overwrite(from, true);
+		net_pkt_skip(from, pos);
+	}
+
+	return net_pkt_copy(to, from, len);
+}
+
+static bool tcp_window_full(struct tcp *conn)
+{
+	bool window_full = (conn->send_data_total >= conn->send_win);
+
+	NET_DBG("conn: %p window_full=%hu", conn, window_full);
+
+	return window_full;
+}
+
+/* Unblock the senders, waking the epoll waiters of the socket if the
+ * window was full.
+ */
+static void tcp_tx_sem_give(struct tcp *conn)
+{
+	bool blocked = k_sem_count_get(&conn->tx_sem) == 0;
+
+	k_sem_give(&conn->tx_sem);
+
+	if (blocked) {
+		net_socket_epoll_notify(conn->context);
+	}
+}
+
+/* The amount of data the peer and, with congestion control, the
+ * network accept in flight.
+ */
+static int tcp_send_wnd(struct tcp *conn)
+{
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+	return MIN(conn->send_win, conn->cc.cwnd);
+#else
+	return conn->send_win;
+#endif
+}
+
+static int tcp_unsent_len(struct tcp *conn)
+{
+	int send_wnd = tcp_send_wnd(conn);
+	int unsent_len;
+
+	if (conn->unacked_len > conn->send_data_total) {
+		NET_ERR("total=%zu, unacked_len=%d",
+			conn->send_data_total, conn->unacked_len);
+		unsent_len = -ERANGE;
+		goto out;
+	}
+
+	unsent_len = conn->send_data_total - conn->unacked_len;
+	if (conn->unacked_len >= send_wnd) {
+		unsent_len = 0;
+	} else {
+		unsent_len = MIN(unsent_len, send_wnd - conn->unacked_len);
+	}
+ out:
+	NET_DBG("unsent_len=%d", unsent_len);
+
+	return unsent_len;
+}
+
+/* Send len bytes of unsent data in one packet, which is a super-packet
+ * to split at gso_size unless that is 0.
+ */
+static int tcp_send_data_pkt(struct tcp *conn, int len, uint16_t gso_size)
+{
+	struct net_pkt *pkt;
+	int ret = 0;
+
+	if (gso_size > 0) {
+		/* Do not wait for the buffers of a super-packet */
+		pkt = tcp_pkt_alloc_no_wait(conn, len);
+		if (!pkt) {
+			ret = -ENOBUFS;
+			goto out;
+		}
+	} else {
+		pkt = tcp_pkt_alloc(conn, len);
+		if (!pkt) {
+			NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
+			ret = -ENOBUFS;
+			goto out;
+		}
+	}
+
+	net_pkt_set_gso_size(pkt, gso_size);
+
+	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		ret = -ENOBUFS;
+		goto out;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	if (ret == 0) {
+		conn->unacked_len += len;
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+		tcp_cc_sent(conn, conn->seq + conn->unacked_len);
+#endif
+
+		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+			net_stats_update_tcp_resent(conn->iface, len);
+			net_stats_update_tcp_seg_rexmit(conn->iface);
+		} else {
+			net_stats_update_tcp_sent(conn->iface, len);
+			net_stats_update_tcp_seg_sent(conn->iface);
+		}
+	}
+
+	/* The data we want to send, has been moved to the send queue so we
+	 * can unref the head net_pkt. If there was an error, we need to remove
+	 * the packet anyway.
+	 */
+	tcp_pkt_unref(pkt);
+
+	conn_send_data_dump(conn);
+
+ out:
+	return ret;
+}
+
+/* The MSS left for the data once the options of a segment are added */
+static int tcp_data_mss(struct tcp *conn)
+{
+	return conn_mss(conn) - tcp_options_len(conn, PSH | ACK);
+}
+
+static int tcp_send_data(struct tcp *conn)
+{
+	int mss = tcp_data_mss(conn);
+	int ret = 0;
+	int len;
+
+	len = MIN3(conn->send_data_total - conn->unacked_len,
+		   tcp_send_wnd(conn) - conn->unacked_len,
+		   mss * TCP_GSO_MAX_SEGS);
+	if (len <= 0) {
+		NET_DBG("conn: %p no data to send", conn);
+		ret = -ENODATA;
+		goto out;
+	}
+
+	if (len > mss) {
+		/* Rather send a single segment than wait for the buffers
+		 * of a super-packet.
+		 */
+		ret = tcp_send_data_pkt(conn, len, mss);
+		if (ret != -ENOBUFS) {
+			goto out;
+		}
+
+		len = mss;
+	}
+
+	ret = tcp_send_data_pkt(conn, len, 0);
+ out:
+	return ret;
+}
+
+#if defined(CONFIG_NET_TCP_SACK)
+/* Add the block [left, right) to the scoreboard, merging it with the
+ * ranges it overlaps or touches. When the scoreboard is full, the
+ * highest range is forgotten.
+ */
+static void tcp_sack_add(struct tcp *conn, uint32_t left, uint32_t right)
+{
+	struct tcp_sack *sack = &conn->sack;
+	struct tcp_seq_range *range;
+	int first = 0;
+	int last;
+
+	while (first < sack->sacked_cnt &&
+	       net_tcp_seq_cmp(sack->sacked[first].seq + sack->sacked[first].len,
+			       left) < 0) {
+		first++;
+	}
+
+	for (last = first; last < sack->sacked_cnt; last++) {
+		range = &sack->sacked[last];
+
+		if (net_tcp_seq_cmp(range->seq, right) > 0) {
+			break;
+		}
+
+		if (net_tcp_seq_cmp(range->seq, left) < 0) {
+			left = range->seq;
+		}
+
+		if (net_tcp_seq_cmp(range->seq + range->len, right) > 0) {
+			right = range->seq + range->len;
+		}
+	}
+
+	if (first == last && sack->sacked_cnt == CONFIG_NET_TCP_SACK_MAX_RANGES) {
+		if (first == sack->sacked_cnt) {
+			return;
+		}
+
+		sack->sacked_cnt--;
+	}
+
+	memmove(&sack->sacked[first + 1], &sack->sacked[last],
+		(sack->sacked_cnt - last) * sizeof(sack->sacked[0]));
+	sack->sacked_cnt -= last - first - 1;
+
+	range = &sack->sacked[first];
+	range->seq = left;
+	range->len = right - left;
+}
+
+/* Update the scoreboard of the data SACKed by the peer with the
+ * cumulative ack and the SACK blocks of the received segment.
+ */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	struct tcp_options *opts = &conn->recv_options;
+	struct tcp_sack *sack = &conn->sack;
+	uint32_t snd_max = conn->seq + conn->send_data_total;
+	int i;
+
+	if (!sack->permitted || net_tcp_seq_cmp(ack, conn->seq) < 0) {
+		return;
+	}
+
+	for (i = 0; i < sack->sacked_cnt; i++) {
+		struct tcp_seq_range *range = &sack->sacked[i];
+
+		if (net_tcp_seq_cmp(range->seq + range->len, ack) > 0) {
+			if (net_tcp_seq_cmp(range->seq, ack) < 0) {
+				range->len -= ack - range->seq;
+				range->seq = ack;
+			}
+
+			break;
+		}
+	}
+
+	memmove(&sack->sacked[0], &sack->sacked[i],
+		(sack->sacked_cnt - i) * sizeof(sack->sacked[0]));
+	sack->sacked_cnt -= i;
+
+	for (i = 0; i < opts->sack_cnt; i++) {
+		uint32_t left = opts->sack[i].seq;
+		uint32_t right = left + opts->sack[i].len;
+
+		/* Ignore D-SACK blocks and blocks outside of what was sent */
+		if (net_tcp_seq_cmp(left, ack) <= 0 ||
+		    net_tcp_seq_cmp(right, snd_max) > 0) {
+			continue;
+		}
+
+		tcp_sack_add(conn, left, right);
+	}
 
-static void tcp_out(struct tcp *conn, uint8_t flags)
-{
-	(void)tcp_out_ext(conn, flags, NULL /* no data */, conn->seq);
+	if (net_tcp_seq_cmp(sack->rexmit_high, ack) < 0) {
+		sack->rexmit_high = ack;
+	}
+
+	if (sack->sacked_cnt == 0) {
+		sack->rto_kept = false;
+	}
 }
 
-static int tcp_pkt_pull(struct net_pkt *pkt, size_t len)
+/* Send len bytes of the send queue starting offset bytes after
+ * conn->seq, in segments of at most one MSS.
+ */
+static int tcp_send_range(struct tcp *conn, int offset, int len)
 {
-	int total = net_pkt_get_len(pkt);
+	int temp_unacked_len = conn->unacked_len;
+	int mss = tcp_data_mss(conn);
 	int ret = 0;
 
-	if (len > total) {
-		ret = -EINVAL;
-		goto out;
+	conn->unacked_len = offset;
+
+	while (len > 0 && ret == 0) {
+		int seg_len = MIN(len, mss);
+
+		ret = tcp_send_data_pkt(conn, seg_len, 0);
+		len -= seg_len;
 	}
 
-	net_pkt_cursor_init(pkt);
-	net_pkt_set_overwrite(pkt, true);
-	net_pkt_pull(pkt, len);
-	net_pkt_trim_buffer(pkt);
- out:
+	/* Restore the current transmission */
+	conn->unacked_len = MAX(temp_unacked_len, conn->unacked_len);
+
 	return ret;
 }
 
-static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
-			size_t len)
+/* Retransmit one segment of the lowest hole of the scoreboard that is
+ * considered lost, which it is once DUPLICATE_ACK_RETRANSMIT_TRHESHOLD
+ * segments above it were SACKed (RFC 6675) or when forced. Return true
+ * if data was sent.
+ */
+static bool tcp_sack_retransmit(struct tcp *conn, bool force)
 {
-	net_pkt_cursor_init(to);
-	net_pkt_cursor_init(from);
+	struct tcp_sack *sack = &conn->sack;
+	uint32_t lost_limit = DUPLICATE_ACK_RETRANSMIT_TRHESHOLD * conn_mss(conn);
+	uint32_t start = conn->seq;
+	uint32_t sacked_above = 0;
+	int len;
 
-	if (pos) {
-		net_pkt_set_overwrite(from, true);
-		net_pkt_skip(from, pos);
+	for (int i = 0; i < sack->sacked_cnt; i++) {
+		sacked_above += sack->sacked[i].len;
 	}
 
-	return net_pkt_copy(to, from, len);
-}
+	if (net_tcp_seq_cmp(sack->rexmit_high, start) > 0) {
+		start = sack->rexmit_high;
+	}
 
-static bool tcp_window_full(struct tcp *conn)
-{
-	bool window_full = (conn->send_data_total >= conn->send_win);
+	for (int i = 0; i < sack->sacked_cnt; i++) {
+		struct tcp_seq_range *range = &sack->sacked[i];
 
-	NET_DBG("conn: %p window_full=%hu", conn, window_full);
+		if (net_tcp_seq_cmp(range->seq, start) > 0) {
+			if (!force && sacked_above < lost_limit) {
+				break;
+			}
 
-	return window_full;
-}
+			len = MIN(range->seq - start, tcp_data_mss(conn));
+			if (tcp_send_range(conn, start - conn->seq, len) < 0) {
+				break;
+			}
 
-static int tcp_unsent_len(struct tcp *conn)
-{
-	int unsent_len;
+			sack->rexmit_high = start + len;
 
-	if (conn->unacked_len > conn->send_data_total) {
-		NET_ERR("total=%zu, unacked_len=%d",
-			conn->send_data_total, conn->unacked_len);
-		unsent_len = -ERANGE;
-		goto out;
-	}
+			return true;
+		}
 
-	unsent_len = conn->send_data_total - conn->unacked_len;
-	if (conn->unacked_len >= conn->send_win) {
-		unsent_len = 0;
-	} else {
-		unsent_len = MIN(unsent_len, conn->send_win - conn->unacked_len);
+		if (net_tcp_seq_cmp(range->seq + range->len, start) > 0) {
+			start = range->seq + range->len;
+		}
+
+		sacked_above -= range->len;
 	}
- out:
-	NET_DBG("unsent_len=%d", unsent_len);
 
-	return unsent_len;
+	return false;
 }
 
-static int tcp_send_data(struct tcp *conn)
+/* On the first timeout, the SACKed data stays in flight and only the
+ * holes are resent. On the next ones, the peer is assumed to have
+ * reneged and the scoreboard is cleared (RFC 2018).
+ */
+static bool tcp_sack_rto_retransmit(struct tcp *conn)
 {
-	int ret = 0;
-	int len;
-	struct net_pkt *pkt;
+	struct tcp_sack *sack = &conn->sack;
 
-	len = MIN3(conn->send_data_total - conn->unacked_len,
-		   conn->send_win - conn->unacked_len,
-		   conn_mss(conn));
-	if (len == 0) {
-		NET_DBG("conn: %p no data to send", conn);
-		ret = -ENODATA;
-		goto out;
+	if (sack->sacked_cnt == 0) {
+		return false;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
-	if (!pkt) {
-		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
+	if (conn->send_data_retries > 0) {
+		sack->sacked_cnt = 0;
+		sack->rto_kept = false;
+		return false;
 	}
 
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
-	if (ret < 0) {
-		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
-	}
+	sack->rexmit_high = conn->seq;
+	sack->rto_kept = true;
 
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
-	if (ret == 0) {
-		conn->unacked_len += len;
+	return tcp_sack_retransmit(conn, true);
+}
+#else
+static inline bool tcp_sack_rto_retransmit(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
 
-		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
-			net_stats_update_tcp_resent(conn->iface, len);
-			net_stats_update_tcp_seg_rexmit(conn->iface);
-		} else {
-			net_stats_update_tcp_sent(conn->iface, len);
-			net_stats_update_tcp_seg_sent(conn->iface);
-		}
+	return false;
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
+#ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
+/* Resend the oldest unacknowledged data, leaving the rest in flight */
+static void tcp_fast_retransmit(struct tcp *conn)
+{
+	int temp_unacked_len = conn->unacked_len;
+
+#if defined(CONFIG_NET_TCP_SACK)
+	if (conn->sack.sacked_cnt > 0) {
+		(void)tcp_sack_retransmit(conn, true);
+		return;
 	}
+#endif
 
-	/* The data we want to send, has been moved to the send queue so we
-	 * can unref the head net_pkt. If there was an error, we need to remove
-	 * the packet anyway.
-	 */
-	tcp_pkt_unref(pkt);
+	conn->unacked_len = 0;
 
-	conn_send_data_dump(conn);
+	(void)tcp_send_data(conn);
 
- out:
-	return ret;
+	/* Restore the current transmission */
+	conn->unacked_len = temp_unacked_len;
 }
+#endif
 
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
@@ -1278,12 +2199,19 @@ static void tcp_cleanup_recv_queue(struct k_work *work)
 
 	k_mutex_lock(&conn->lock, K_FOREVER);
 
+#if defined(CONFIG_NET_TCP_SACK)
+	NET_DBG("Cleanup recv queue conn %p ranges %d", conn,
+		conn->sack.ooo_cnt);
+
+	tcp_ooo_flush(conn);
+#else
 	NET_DBG("Cleanup recv queue conn %p len %zd seq %u", conn,
 		net_pkt_get_len(conn->queue_recv_data),
 		tcp_get_seq(conn->queue_recv_data->buffer));
 
 	net_buf_unref(conn->queue_recv_data->buffer);
 	conn->queue_recv_data->buffer = NULL;
+#endif
 
 	k_mutex_unlock(&conn->lock);
 }
@@ -1306,10 +2234,24 @@ static void tcp_resend_data(struct k_work *work)
 		goto out;
 	}
 
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+	/* Only the first timeout of a retransmission episode is a new
+	 * congestion signal.
+	 */
+	if (conn->send_data_retries == 0) {
+		tcp_cc_timeout(conn);
+	}
+#endif
+
 	conn->data_mode = TCP_DATA_MODE_RESEND;
-	conn->unacked_len = 0;
 
-	ret = tcp_send_data(conn);
+	if (tcp_sack_rto_retransmit(conn)) {
+		ret = 0;
+	} else {
+		conn->unacked_len = 0;
+		ret = tcp_send_data(conn);
+	}
+
 	conn->send_data_retries++;
 	if (ret == 0) {
 		if (conn->in_close && conn->send_data_total == 0) {
@@ -1455,7 +2397,9 @@ static struct tcp *tcp_conn_alloc(void)
 
 	memset(conn, 0, sizeof(*conn));
 
-	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT) {
+	/* With SACK the out-of-order data is kept in conn->sack */
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT &&
+	    !IS_ENABLED(CONFIG_NET_TCP_SACK)) {
 		conn->queue_recv_data = tcp_rx_pkt_alloc(conn, 0);
 		if (conn->queue_recv_data == NULL) {
 			NET_ERR("Cannot allocate %s queue for conn %p", "recv",
@@ -1485,6 +2429,10 @@ static struct tcp *tcp_conn_alloc(void)
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+	conn->cc.ops = tcp_cc_default();
+	conn->cc.rto = tcp_rto;
+#endif
 
 	/* The ISN value will be set when we get the connection attempt or
 	 * when trying to create a connection.
@@ -1609,6 +2557,10 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 		net_ipaddr_copy(&conn_old->context->remote, &conn->dst.sa);
 
 		conn->accepted_conn = conn_old;
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+		/* Accepted connections inherit the listener's algorithm */
+		conn->cc.ops = conn_old->cc.ops;
+#endif
 	}
  in:
 	if (conn) {
@@ -1819,6 +2771,26 @@ static bool tcp_validate_seq(struct tcp *conn, struct tcphdr *hdr)
 		(net_tcp_seq_cmp(th_seq(hdr), conn->ack + conn->recv_win) < 0);
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
+				size_t len, uint32_t seq)
+{
+	NET_DBG("conn: %p len %zd seq %u ack %u", conn, len, seq, conn->ack);
+
+	tcp_ooo_insert(conn, pkt->buffer, seq, len);
+
+	/* The queue took over the received data, free only the pkt */
+	pkt->buffer = NULL;
+	conn->sack.ooo_last_seq = seq;
+
+	if (conn->sack.ooo_cnt > 0 &&
+	    !k_work_delayable_is_pending(&conn->recv_queue_timer)) {
+		k_work_reschedule_for_queue(
+			&tcp_work_q, &conn->recv_queue_timer,
+			K_MSEC(CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT));
+	}
+}
+#else
 static bool check_seq_list(struct net_buf *buf)
 {
 	struct net_buf *last = NULL;
@@ -1980,6 +2952,21 @@ static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 		}
 	}
 }
+#endif /* CONFIG_NET_TCP_SACK */
+
+/* Delay ACK response in case of small window or missing PSH,
+ * as described in RFC 813.
+ */
+static void tcp_data_ack(struct tcp *conn)
+{
+	if (tcp_short_window(conn)) {
+		k_work_schedule_for_queue(&tcp_work_q, &conn->ack_timer,
+					  ACK_DELAY);
+	} else {
+		k_work_cancel_delayable(&conn->ack_timer);
+		tcp_out(conn, ACK);
+	}
+}
 
 static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
 					  size_t *len)
@@ -1995,20 +2982,100 @@ static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
 	net_stats_update_tcp_seg_recv(conn->iface);
 	conn_ack(conn, *len);
 
-	/* Delay ACK response in case of small window or missing PSH,
-	 * as described in RFC 813.
-	 */
-	if (tcp_short_window(conn)) {
-		k_work_schedule_for_queue(&tcp_work_q, &conn->ack_timer,
-					  ACK_DELAY);
-	} else {
-		k_work_cancel_delayable(&conn->ack_timer);
-		tcp_out(conn, ACK);
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+	/* The whole batch is acknowledged once it is flushed */
+	if (conn->rx_batch != NULL) {
+		conn->rx_batch_ack = true;
+		return ret;
 	}
+#endif
+
+	tcp_data_ack(conn);
 
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+/* Whether pkt can join the batch of the connection, that is, carries
+ * nothing but an in-order segment of an established connection.
+ */
+static bool tcp_rx_batchable(struct tcp *conn, struct net_pkt *pkt,
+			     struct tcphdr *th, uint8_t fl)
+{
+	if (pkt == NULL || th == NULL || !net_pkt_is_rx_batched(pkt)) {
+		return false;
+	}
+
+	if (conn->state != TCP_ESTABLISHED || (fl & ~PSH) != ACK) {
+		return false;
+	}
+
+	return tcp_data_len(pkt) == 0 || th_seq(th) == conn->ack;
+}
+
+/* Hand the batch over to the recv fifo. Called with conn->lock held. */
+static void tcp_rx_batch_release(struct tcp *conn)
+{
+	if (conn->rx_batch != NULL) {
+		k_fifo_put(&conn->recv_data, conn->rx_batch);
+		conn->rx_batch = NULL;
+	}
+
+	if (conn->rx_batch_ack) {
+		conn->rx_batch_ack = false;
+		tcp_data_ack(conn);
+	}
+}
+
+void net_tcp_rx_batch_flush(void)
+{
+	struct net_conn *conn_handler;
+	struct net_pkt *recv_pkt;
+	void *recv_user_data;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+	struct tcp *conn;
+
+	while (true) {
+		key = k_spin_lock(&tcp_rx_batch_lock);
+		node = sys_slist_get(&tcp_rx_batch_conns);
+		k_spin_unlock(&tcp_rx_batch_lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		conn = CONTAINER_OF(node, struct tcp, rx_batch_node);
+		conn_handler = NULL;
+
+		k_mutex_lock(&conn->lock, K_FOREVER);
+
+		tcp_rx_batch_release(conn);
+		conn->rx_batch_listed = false;
+
+		if (conn->context) {
+			conn_handler = (struct net_conn *)conn->context->conn_handler;
+		}
+
+		recv_user_data = conn->recv_user_data;
+
+		k_mutex_unlock(&conn->lock);
+
+		/* Like at the end of tcp_in(), without the connection lock */
+		while (conn_handler &&
+		       (recv_pkt = k_fifo_get(&conn->recv_data, K_NO_WAIT)) != NULL) {
+			if (net_context_packet_received(conn_handler, recv_pkt, NULL,
+							NULL, recv_user_data) ==
+			    NET_DROP) {
+				tcp_pkt_unref(recv_pkt);
+			}
+		}
+
+		tcp_conn_unref(conn);
+	}
+}
+#endif /* CONFIG_NET_TCP_RX_BATCH */
+
 static void tcp_out_of_order_data(struct tcp *conn, struct net_pkt *pkt,
 				  size_t data_len, uint32_t seq)
 {
@@ -2099,6 +3166,17 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 	NET_DBG("%s", tcp_conn_state(conn, pkt));
 
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+	/* Anything else than more in-order data ends the batch first */
+	if (!tcp_rx_batchable(conn, pkt, th, fl)) {
+		if (pkt != NULL) {
+			net_pkt_set_rx_batched(pkt, false);
+		}
+
+		tcp_rx_batch_release(conn);
+	}
+#endif
+
 	if (th && th_off(th) < 5) {
 		tcp_out(conn, RST);
 		do_close = true;
@@ -2122,6 +3200,11 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto next_state;
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	/* SACK blocks are only valid for the segment carrying them */
+	conn->recv_options.sack_cnt = 0;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
 						  tcp_options_len)) {
 		NET_DBG("DROP: Invalid TCP option list");
@@ -2169,7 +3252,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		if (tcp_window_full(conn)) {
 			(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 		} else {
-			k_sem_give(&conn->tx_sem);
+			tcp_tx_sem_give(conn);
 		}
 	}
 
@@ -2181,9 +3264,17 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+#if defined(CONFIG_NET_TCP_SACK)
+			/* SACK is used only if the peer offered it */
+			conn->sack.permitted = conn->recv_options.sack_perm_found;
+			conn->send_options.sack_perm_found = conn->sack.permitted;
+#endif
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->send_options.sack_perm_found = false;
+#endif
 			conn_seq(conn, + 1);
 			next = TCP_SYN_RECEIVED;
 
@@ -2195,8 +3286,14 @@ next_state:
 			verdict = NET_OK;
 		} else {
 			conn->send_options.mss_found = true;
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->send_options.sack_perm_found = true;
+#endif
 			tcp_out(conn, SYN);
 			conn->send_options.mss_found = false;
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->send_options.sack_perm_found = false;
+#endif
 			conn_seq(conn, + 1);
 			next = TCP_SYN_SENT;
 		}
@@ -2207,6 +3304,9 @@ next_state:
 			k_work_cancel_delayable(&conn->establish_timer);
 			tcp_send_timer_cancel(conn);
 			next = TCP_ESTABLISHED;
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+			tcp_cc_init(conn);
+#endif
 			tcp_conn_ref(conn);
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
@@ -2247,6 +3347,9 @@ next_state:
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
 			conn_ack(conn, th_seq(th) + 1);
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->sack.permitted = conn->recv_options.sack_perm_found;
+#endif
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
 				if (verdict == NET_OK) {
@@ -2260,6 +3363,9 @@ next_state:
 			}
 
 			next = TCP_ESTABLISHED;
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+			tcp_cc_init(conn);
+#endif
 			tcp_conn_ref(conn);
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
@@ -2312,6 +3418,12 @@ next_state:
 			break;
 		}
 
+#if defined(CONFIG_NET_TCP_SACK)
+		if (th && FL(&fl, &, ACK)) {
+			tcp_sack_update(conn, th_ack(th));
+		}
+#endif
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -2331,16 +3443,35 @@ next_state:
 			/* Only do fast retransmit when not already in a resend state */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
 			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
-				/* Apply a fast retransmit */
-				int temp_unacked_len = conn->unacked_len;
-
-				conn->unacked_len = 0;
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+				tcp_cc_fast_retransmit(conn);
+#endif
+				tcp_fast_retransmit(conn);
+			}
 
-				(void)tcp_send_data(conn);
+#if defined(CONFIG_NET_TCP_SACK)
+			/* The SACKed data tells about more losses than the
+			 * duplicate ACKs do.
+			 */
+			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+			    (conn->dup_ack_cnt != DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+			    (conn->sack.sacked_cnt > 0) &&
+			    tcp_sack_retransmit(conn, false)) {
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+				tcp_cc_fast_retransmit(conn);
+#endif
+			}
+#endif
 
-				/* Restore the current transmission */
-				conn->unacked_len = temp_unacked_len;
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+			    (conn->dup_ack_cnt != DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+			    (conn->send_data_total > 0) && (len == 0) &&
+			    tcp_cc_dup_ack(conn)) {
+				/* The window was inflated, send new data */
+				(void)tcp_send_queued_data(conn);
 			}
+#endif
 		}
 #endif
 		NET_ASSERT((conn->send_data_total == 0) ||
@@ -2379,20 +3510,49 @@ next_state:
 			}
 
 			if (!tcp_window_full(conn)) {
-				k_sem_give(&conn->tx_sem);
+				tcp_tx_sem_give(conn);
 			}
 
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+#ifdef CONFIG_NET_TCP_CONGESTION_CONTROL
+			if (tcp_cc_ack(conn, conn->seq, len_acked) &&
+			    (conn->data_mode == TCP_DATA_MODE_SEND)) {
+				/* A partial ACK in fast recovery means the
+				 * next segment was lost as well.
+				 */
+				tcp_fast_retransmit(conn);
+			}
+
+			if (conn->cc.rto_changed) {
+				conn->cc.rto_changed = false;
+				tcp_derive_rto(conn);
+			}
+#endif
+
 			conn_send_data_dump(conn);
 
 			conn->send_data_retries = 0;
 			if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+#if defined(CONFIG_NET_TCP_SACK)
+				/* The SACKed data was kept in flight */
+				if (!conn->sack.rto_kept) {
+					conn->unacked_len = 0;
+				}
+#else
 				conn->unacked_len = 0;
+#endif
 				tcp_derive_rto(conn);
 			}
 			conn->data_mode = TCP_DATA_MODE_SEND;
+
+#if defined(CONFIG_NET_TCP_SACK)
+			/* After a timeout, all the holes are lost */
+			if (conn->sack.rto_kept) {
+				(void)tcp_sack_retransmit(conn, true);
+			}
+#endif
 			if (conn->send_data_total > 0) {
 				k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer,
 					    K_MSEC(TCP_RTO_MS));
@@ -2469,7 +3629,7 @@ next_state:
 		if (tcp_window_full(conn)) {
 			(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 		} else {
-			k_sem_give(&conn->tx_sem);
+			tcp_tx_sem_give(conn);
 		}
 
 		break;
@@ -2635,6 +3795,7 @@ next_state:
 			}
 
 			k_sem_give(&conn->connect_sem);
+			net_socket_epoll_notify(conn->context);
 		}
 
 		goto next_state;
@@ -3481,6 +4642,13 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_NODELAY:
 		ret = set_tcp_nodelay(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+		ret = set_tcp_congestion(conn, value, len);
+#else
+		ret = -ENOPROTOOPT;
+#endif
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -3506,6 +4674,13 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_NODELAY:
 		ret = get_tcp_nodelay(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+		ret = get_tcp_congestion(conn, value, len);
+#else
+		ret = -ENOPROTOOPT;
+#endif
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
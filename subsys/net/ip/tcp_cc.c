@@ -0,0 +1,533 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_ip.h>
+#include "tcp_internal.h"
+
+/* RFC 6298 bounds the RTO to 60 s at most. Below, the initial RTO is
+ * kept as the minimum, so that the estimate only ever makes the timer
+ * more patient than before.
+ */
+#define TCP_CC_RTO_MIN_MS CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT
+#define TCP_CC_RTO_MAX_MS 60000
+
+/* Initial window, RFC 3390 */
+#define TCP_CC_INIT_WND(_mss) MIN(4U * (_mss), MAX(2U * (_mss), 4380U))
+
+static void tcp_cc_slow_start(struct tcp *conn, uint32_t acked)
+{
+	conn->cc.cwnd += MIN(acked, (uint32_t)conn_mss(conn));
+}
+
+/* NewReno, RFC 5681 and RFC 6582 */
+
+struct tcp_newreno {
+	uint32_t bytes_acked;
+};
+
+static void tcp_newreno_cong_avoid(struct tcp *conn, uint32_t acked)
+{
+	struct tcp_newreno *nr = tcp_cc_priv(conn, struct tcp_newreno);
+
+	if (conn->cc.cwnd < conn->cc.ssthresh) {
+		tcp_cc_slow_start(conn, acked);
+		return;
+	}
+
+	/* Appropriate byte counting, one MSS per window acknowledged */
+	nr->bytes_acked += acked;
+	if (nr->bytes_acked >= conn->cc.cwnd) {
+		nr->bytes_acked -= conn->cc.cwnd;
+		conn->cc.cwnd += conn_mss(conn);
+	}
+}
+
+static uint32_t tcp_newreno_ssthresh(struct tcp *conn)
+{
+	return MAX((uint32_t)conn->unacked_len / 2, 2U * conn_mss(conn));
+}
+
+static const struct tcp_cc_ops tcp_cc_newreno = {
+	.name = "reno",
+	.cong_avoid = tcp_newreno_cong_avoid,
+	.ssthresh = tcp_newreno_ssthresh,
+};
+
+#if defined(CONFIG_NET_TCP_CC_CUBIC)
+/* CUBIC, RFC 8312. Windows are in bytes and times in milliseconds. */
+
+#define CUBIC_BETA 717 /* 0.7, scaled by 1024 */
+#define CUBIC_ALPHA 542 /* 3 * (1 - beta) / (1 + beta), scaled by 1024 */
+/* K = cubic_root(W_max - cwnd / C) with C = 0.4 segments/s^3 */
+#define CUBIC_K_SCALE 2500000000ULL
+/* Beyond this distance from K the window is far outside the 16-bit
+ * window range anyway, and the cube still fits 64 bits.
+ */
+#define CUBIC_MAX_OFFS_MS 30000U
+
+struct tcp_cubic {
+	uint32_t w_max;
+	uint32_t epoch_start;
+	uint32_t k;
+	uint32_t origin;
+	uint32_t w_est;
+};
+
+static uint32_t cubic_root(uint64_t a)
+{
+	uint32_t x = 0U;
+
+	for (int bit = 20; bit >= 0; bit--) {
+		uint64_t y = x | BIT(bit);
+
+		if (y * y * y <= a) {
+			x = y;
+		}
+	}
+
+	return x;
+}
+
+static void tcp_cubic_cong_avoid(struct tcp *conn, uint32_t acked)
+{
+	struct tcp_cubic *cubic = tcp_cc_priv(conn, struct tcp_cubic);
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->cc.cwnd;
+	uint32_t now = k_uptime_get_32();
+	uint32_t target, t, offs;
+	uint64_t delta;
+
+	if (cwnd < conn->cc.ssthresh) {
+		tcp_cc_slow_start(conn, acked);
+		return;
+	}
+
+	if (cubic->epoch_start == 0U) {
+		cubic->epoch_start = now ? now : 1U;
+		cubic->w_est = cwnd;
+
+		if (cwnd < cubic->w_max) {
+			cubic->k = cubic_root((cubic->w_max - cwnd) *
+					      CUBIC_K_SCALE / mss);
+			cubic->origin = cubic->w_max;
+		} else {
+			cubic->k = 0U;
+			cubic->origin = cwnd;
+		}
+	}
+
+	/* The window one RTT from now */
+	t = now - cubic->epoch_start + (conn->cc.srtt >> 3);
+	offs = MIN(t > cubic->k ? t - cubic->k : cubic->k - t,
+		   CUBIC_MAX_OFFS_MS);
+	delta = (uint64_t)offs * offs * offs * 4U * mss / 10000000000ULL;
+
+	if (t < cubic->k) {
+		target = cubic->origin - MIN(delta, (uint64_t)cubic->origin);
+	} else {
+		target = cubic->origin + MIN(delta, (uint64_t)UINT16_MAX);
+	}
+
+	/* Grow by at most half the window per RTT */
+	target = MIN(target, cwnd + cwnd / 2U);
+
+	/* TCP-friendly region, never grow slower than NewReno would */
+	cubic->w_est += (uint64_t)acked * mss * CUBIC_ALPHA / 1024U / cwnd;
+	target = MAX(target, cubic->w_est);
+
+	if (target > cwnd) {
+		conn->cc.cwnd += MAX((uint64_t)(target - cwnd) * acked / cwnd, 1U);
+	}
+}
+
+static uint32_t tcp_cubic_ssthresh(struct tcp *conn)
+{
+	struct tcp_cubic *cubic = tcp_cc_priv(conn, struct tcp_cubic);
+	uint32_t cwnd = conn->cc.cwnd;
+
+	cubic->epoch_start = 0U;
+
+	/* Fast convergence, release bandwidth to newer flows */
+	if (cwnd < cubic->w_max) {
+		cubic->w_max = cwnd * (1024U + CUBIC_BETA) / 2048U;
+	} else {
+		cubic->w_max = cwnd;
+	}
+
+	return MAX(cwnd * CUBIC_BETA / 1024U, 2U * conn_mss(conn));
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	struct tcp_cubic *cubic = tcp_cc_priv(conn, struct tcp_cubic);
+
+	cubic->epoch_start = 0U;
+}
+
+static const struct tcp_cc_ops tcp_cc_cubic = {
+	.name = "cubic",
+	.cong_avoid = tcp_cubic_cong_avoid,
+	.ssthresh = tcp_cubic_ssthresh,
+	.timeout = tcp_cubic_timeout,
+};
+#endif /* CONFIG_NET_TCP_CC_CUBIC */
+
+#if defined(CONFIG_NET_TCP_CC_BBR)
+/* BBR-lite. Bandwidth is in bytes/s, gains are scaled by 256. Each RTT
+ * sample starts a new round.
+ */
+
+#define BBR_FULL_BW_THRESH 320 /* 1.25 */
+#define BBR_FULL_BW_ROUNDS 3
+#define BBR_BW_WIN_ROUNDS 10
+#define BBR_MIN_RTT_WIN_MS 10000
+#define BBR_PROBE_RTT_MS 200
+#define BBR_MIN_CWND_SEGS 4U
+
+/* Twice the PROBE_BW pacing gain cycle of BBR, as the window is the
+ * only control without pacing.
+ */
+static const uint16_t bbr_cycle_gain[] = {
+	640, 384, 512, 512, 512, 512, 512, 512,
+};
+
+enum tcp_bbr_mode {
+	BBR_STARTUP,
+	BBR_PROBE_BW,
+	BBR_PROBE_RTT,
+};
+
+struct tcp_bbr {
+	uint8_t mode;
+	uint8_t cycle_idx;
+	uint8_t full_bw_cnt;
+	bool full_bw_reached;
+	uint32_t round;
+	uint32_t max_bw;
+	uint32_t max_bw_round;
+	uint32_t full_bw;
+	uint32_t min_rtt;
+	uint32_t min_rtt_stamp;
+	uint32_t probe_rtt_done;
+	uint32_t last_delivered;
+	uint32_t last_stamp;
+};
+
+static uint32_t tcp_bbr_bdp(struct tcp_bbr *bbr)
+{
+	return (uint64_t)bbr->max_bw * bbr->min_rtt / MSEC_PER_SEC;
+}
+
+static void tcp_bbr_cong_avoid(struct tcp *conn, uint32_t acked)
+{
+	struct tcp_bbr *bbr = tcp_cc_priv(conn, struct tcp_bbr);
+	uint32_t min_cwnd = BBR_MIN_CWND_SEGS * conn_mss(conn);
+	uint32_t bdp = tcp_bbr_bdp(bbr);
+	uint32_t target;
+
+	if (bbr->mode == BBR_PROBE_RTT) {
+		conn->cc.cwnd = min_cwnd;
+		return;
+	}
+
+	if (bbr->mode == BBR_STARTUP || bdp == 0U) {
+		conn->cc.cwnd += acked;
+		return;
+	}
+
+	target = MAX((uint64_t)bdp * bbr_cycle_gain[bbr->cycle_idx] / 256U,
+		     min_cwnd);
+	conn->cc.cwnd = MIN(conn->cc.cwnd + acked, target);
+}
+
+static void tcp_bbr_rtt_sample(struct tcp *conn, uint32_t rtt_ms)
+{
+	struct tcp_bbr *bbr = tcp_cc_priv(conn, struct tcp_bbr);
+	uint32_t now = k_uptime_get_32();
+	bool min_rtt_expired = (now - bbr->min_rtt_stamp) > BBR_MIN_RTT_WIN_MS;
+	uint32_t interval = now - bbr->last_stamp;
+
+	bbr->round++;
+
+	if (bbr->round > 1U && interval > 0U) {
+		uint32_t bw = (uint64_t)(conn->cc.delivered - bbr->last_delivered) *
+			      MSEC_PER_SEC / interval;
+
+		if (bw >= bbr->max_bw ||
+		    (bbr->round - bbr->max_bw_round) > BBR_BW_WIN_ROUNDS) {
+			bbr->max_bw = bw;
+			bbr->max_bw_round = bbr->round;
+		}
+	}
+
+	bbr->last_delivered = conn->cc.delivered;
+	bbr->last_stamp = now;
+
+	if (bbr->min_rtt == 0U || rtt_ms <= bbr->min_rtt || min_rtt_expired) {
+		bbr->min_rtt = MAX(rtt_ms, 1U);
+		bbr->min_rtt_stamp = now;
+	}
+
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		if (bbr->max_bw >= (uint64_t)bbr->full_bw * BBR_FULL_BW_THRESH / 256U) {
+			bbr->full_bw = bbr->max_bw;
+			bbr->full_bw_cnt = 0U;
+		} else if (++bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS) {
+			bbr->full_bw_reached = true;
+			bbr->mode = BBR_PROBE_BW;
+			bbr->cycle_idx = 0U;
+		}
+		break;
+	case BBR_PROBE_BW:
+		if (min_rtt_expired) {
+			bbr->mode = BBR_PROBE_RTT;
+			bbr->probe_rtt_done = now + MAX(BBR_PROBE_RTT_MS, rtt_ms);
+		} else {
+			bbr->cycle_idx = (bbr->cycle_idx + 1U) %
+					 ARRAY_SIZE(bbr_cycle_gain);
+		}
+		break;
+	case BBR_PROBE_RTT:
+		if ((int32_t)(now - bbr->probe_rtt_done) >= 0) {
+			bbr->mode = bbr->full_bw_reached ? BBR_PROBE_BW :
+							   BBR_STARTUP;
+			bbr->min_rtt_stamp = now;
+		}
+		break;
+	}
+}
+
+static uint32_t tcp_bbr_ssthresh(struct tcp *conn)
+{
+	struct tcp_bbr *bbr = tcp_cc_priv(conn, struct tcp_bbr);
+	uint32_t bdp = tcp_bbr_bdp(bbr);
+
+	/* Losses are not a congestion signal, keep the modelled window */
+	if (bdp == 0U) {
+		return tcp_newreno_ssthresh(conn);
+	}
+
+	return MAX(bdp, BBR_MIN_CWND_SEGS * conn_mss(conn));
+}
+
+static void tcp_bbr_init(struct tcp *conn)
+{
+	struct tcp_bbr *bbr = tcp_cc_priv(conn, struct tcp_bbr);
+
+	bbr->mode = BBR_STARTUP;
+	bbr->min_rtt_stamp = k_uptime_get_32();
+	bbr->last_stamp = bbr->min_rtt_stamp;
+	bbr->last_delivered = conn->cc.delivered;
+}
+
+static const struct tcp_cc_ops tcp_cc_bbr = {
+	.name = "bbr",
+	.init = tcp_bbr_init,
+	.cong_avoid = tcp_bbr_cong_avoid,
+	.ssthresh = tcp_bbr_ssthresh,
+	.rtt_sample = tcp_bbr_rtt_sample,
+};
+#endif /* CONFIG_NET_TCP_CC_BBR */
+
+static const struct tcp_cc_ops *const tcp_cc_algos[] = {
+	&tcp_cc_newreno,
+#if defined(CONFIG_NET_TCP_CC_CUBIC)
+	&tcp_cc_cubic,
+#endif
+#if defined(CONFIG_NET_TCP_CC_BBR)
+	&tcp_cc_bbr,
+#endif
+};
+
+const struct tcp_cc_ops *tcp_cc_default(void)
+{
+#if defined(CONFIG_NET_TCP_CC_DEFAULT_CUBIC)
+	return &tcp_cc_cubic;
+#elif defined(CONFIG_NET_TCP_CC_DEFAULT_BBR)
+	return &tcp_cc_bbr;
+#else
+	return &tcp_cc_newreno;
+#endif
+}
+
+const struct tcp_cc_ops *tcp_cc_find(const char *name)
+{
+	for (int i = 0; i < ARRAY_SIZE(tcp_cc_algos); i++) {
+		if (is(tcp_cc_algos[i]->name, name)) {
+			return tcp_cc_algos[i];
+		}
+	}
+
+	return NULL;
+}
+
+void tcp_cc_select(struct tcp *conn, const struct tcp_cc_ops *ops)
+{
+	conn->cc.ops = ops;
+	memset(conn->cc.priv, 0, sizeof(conn->cc.priv));
+
+	/* Before the connection is established, tcp_cc_init() does this */
+	if (conn->cc.cwnd > 0U && ops->init) {
+		ops->init(conn);
+	}
+}
+
+void tcp_cc_init(struct tcp *conn)
+{
+	struct tcp_cc *cc = &conn->cc;
+	uint32_t mss = conn_mss(conn);
+
+	cc->cwnd = TCP_CC_INIT_WND(mss);
+	cc->ssthresh = conn->send_win_max;
+	cc->snd_max = conn->seq;
+	cc->recover = conn->seq;
+	cc->rtt_timing = false;
+	cc->in_recovery = false;
+
+	tcp_cc_select(conn, cc->ops);
+
+	NET_DBG("conn: %p cc: %s cwnd=%u", conn, cc->ops->name, cc->cwnd);
+}
+
+void tcp_cc_sent(struct tcp *conn, uint32_t end_seq)
+{
+	struct tcp_cc *cc = &conn->cc;
+
+	/* Karn's algorithm, retransmitted data is never timed */
+	if (net_tcp_seq_cmp(end_seq, cc->snd_max) <= 0) {
+		return;
+	}
+
+	cc->snd_max = end_seq;
+
+	if (!cc->rtt_timing && !cc->in_recovery) {
+		cc->rtt_timing = true;
+		cc->rtt_seq = end_seq;
+		cc->rtt_start = k_uptime_get_32();
+	}
+}
+
+/* RFC 6298 */
+static void tcp_cc_rtt_update(struct tcp *conn, uint32_t rtt_ms)
+{
+	struct tcp_cc *cc = &conn->cc;
+	uint32_t rto;
+
+	if (cc->srtt == 0U) {
+		cc->srtt = rtt_ms << 3;
+		cc->rttvar = rtt_ms << 1;
+	} else {
+		int32_t delta = (int32_t)rtt_ms - (int32_t)(cc->srtt >> 3);
+
+		cc->srtt += delta;
+		cc->rttvar += abs(delta) - (cc->rttvar >> 2);
+	}
+
+	rto = (cc->srtt >> 3) + MAX(cc->rttvar, 1U);
+	rto = CLAMP(rto, TCP_CC_RTO_MIN_MS, TCP_CC_RTO_MAX_MS);
+	if (rto != cc->rto) {
+		cc->rto = rto;
+		cc->rto_changed = true;
+	}
+
+	NET_DBG("conn: %p rtt=%u srtt=%u rttvar=%u rto=%u", conn, rtt_ms,
+		cc->srtt >> 3, cc->rttvar >> 2, cc->rto);
+
+	if (cc->ops->rtt_sample) {
+		cc->ops->rtt_sample(conn, rtt_ms);
+	}
+}
+
+bool tcp_cc_ack(struct tcp *conn, uint32_t ack, uint32_t acked)
+{
+	struct tcp_cc *cc = &conn->cc;
+	uint32_t mss = conn_mss(conn);
+	bool partial_ack = false;
+
+	cc->delivered += acked;
+
+	if (cc->rtt_timing && net_tcp_seq_cmp(ack, cc->rtt_seq) >= 0) {
+		cc->rtt_timing = false;
+		tcp_cc_rtt_update(conn, k_uptime_get_32() - cc->rtt_start);
+	}
+
+	if (cc->in_recovery) {
+		if (net_tcp_seq_cmp(ack, cc->recover) < 0) {
+			/* Partial ACK, deflate by the data acknowledged and
+			 * let the caller retransmit the next hole.
+			 */
+			cc->cwnd -= MIN(cc->cwnd, acked);
+			if (acked >= mss) {
+				cc->cwnd += mss;
+			}
+
+			partial_ack = true;
+		} else {
+			cc->in_recovery = false;
+			cc->cwnd = cc->ssthresh;
+		}
+	} else {
+		cc->ops->cong_avoid(conn, acked);
+	}
+
+	cc->cwnd = MAX(MIN(cc->cwnd, conn->send_win_max), mss);
+
+	return partial_ack;
+}
+
+void tcp_cc_fast_retransmit(struct tcp *conn)
+{
+	struct tcp_cc *cc = &conn->cc;
+
+	if (cc->in_recovery) {
+		return;
+	}
+
+	cc->ssthresh = cc->ops->ssthresh(conn);
+	cc->cwnd = cc->ssthresh + 3U * conn_mss(conn);
+	cc->recover = cc->snd_max;
+	cc->in_recovery = true;
+	cc->rtt_timing = false;
+
+	NET_DBG("conn: %p fast recovery, ssthresh=%u", conn, cc->ssthresh);
+}
+
+bool tcp_cc_dup_ack(struct tcp *conn)
+{
+	struct tcp_cc *cc = &conn->cc;
+
+	if (!cc->in_recovery) {
+		return false;
+	}
+
+	/* Each duplicate ACK means another segment left the network */
+	cc->cwnd += conn_mss(conn);
+
+	return true;
+}
+
+void tcp_cc_timeout(struct tcp *conn)
+{
+	struct tcp_cc *cc = &conn->cc;
+
+	cc->ssthresh = cc->ops->ssthresh(conn);
+	cc->cwnd = conn_mss(conn);
+	cc->in_recovery = false;
+	cc->rtt_timing = false;
+
+	if (cc->ops->timeout) {
+		cc->ops->timeout(conn);
+	}
+
+	NET_DBG("conn: %p timeout, ssthresh=%u", conn, cc->ssthresh);
+}
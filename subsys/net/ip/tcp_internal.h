@@ -32,6 +32,7 @@ extern "C" {
 
 enum tcp_conn_option {
 	TCP_OPT_NODELAY	= 1,
+	TCP_OPT_CONGESTION = 2,
 };
 
 /**
@@ -353,6 +354,39 @@ void net_tcp_init(void);
 #define net_tcp_init(...)
 #endif
 
+/**
+ * @brief End a receive batch
+ *
+ * Pass the data coalesced from the segments received since the previous
+ * call to the applications, and acknowledge it.
+ */
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+void net_tcp_rx_batch_flush(void);
+#else
+#define net_tcp_rx_batch_flush(...)
+#endif
+
+/**
+ * @brief Send a TCP super-packet as separate segments
+ *
+ * Split a packet built with a non-zero net_pkt_gso_size() into segments
+ * of that size, with their own headers, and send each of them. The
+ * super-packet itself is left to the caller.
+ *
+ * @param pkt Network packet
+ *
+ * @return 0 if all segments were sent, < 0 if error
+ */
+#if defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_send(struct net_pkt *pkt);
+#else
+static inline int net_tcp_gso_send(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Set tcp specific options of a socket
  *
@@ -78,6 +78,21 @@
 	_pkt;								\
 })
 
+#define tcp_pkt_alloc_no_wait(_conn, _len)				\
+({									\
+	struct net_pkt *_pkt;						\
+									\
+	_pkt = net_pkt_alloc_with_buffer((_conn)->iface,		\
+			(_len),						\
+			net_context_get_family((_conn)->context),	\
+			IPPROTO_TCP,					\
+			K_NO_WAIT);					\
+									\
+	tp_pkt_alloc(_pkt, tp_basename(__FILE__), __LINE__);		\
+									\
+	_pkt;								\
+})
+
 #define tcp_rx_pkt_alloc(_conn, _len)					\
 ({									\
 	struct net_pkt *_pkt;						\
@@ -209,20 +224,101 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* SACK blocks fitting in the option space along with two NOPs */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+/* A range of sequence space */
+struct tcp_seq_range {
+	uint32_t seq;
+	uint32_t len;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+#if defined(CONFIG_NET_TCP_SACK)
+	bool sack_perm_found : 1;
+	uint8_t sack_cnt;
+	struct tcp_seq_range sack[NET_TCP_SACK_MAX_BLOCKS];
+#endif
+};
+
+#if defined(CONFIG_NET_TCP_SACK)
+/* Out-of-order data, the buffers hold len bytes starting at seq */
+struct tcp_ooo_range {
+	uint32_t seq;
+	uint32_t len;
+	struct net_buf *buf;
+};
+
+struct tcp_sack {
+	/* Received out of order, disjoint and sorted by sequence */
+	struct tcp_ooo_range ooo[CONFIG_NET_TCP_SACK_MAX_RANGES];
+	/* Sent data SACKed by the peer, disjoint and sorted by sequence */
+	struct tcp_seq_range sacked[CONFIG_NET_TCP_SACK_MAX_RANGES];
+	uint32_t ooo_last_seq; /* latest out-of-order segment received */
+	uint32_t rexmit_high;  /* holes below this were retransmitted */
+	uint8_t ooo_cnt;
+	uint8_t sacked_cnt;
+	bool permitted : 1;    /* negotiated with the peer */
+	bool rto_kept : 1;     /* SACKed data kept in flight after an RTO */
+};
+#endif /* CONFIG_NET_TCP_SACK */
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+struct tcp;
+
+/* Congestion control algorithm, all window sizes are in bytes */
+struct tcp_cc_ops {
+	const char *name;
+	/* Initialize the private state, cwnd and ssthresh are already set */
+	void (*init)(struct tcp *conn);
+	/* New data was acknowledged outside of loss recovery */
+	void (*cong_avoid)(struct tcp *conn, uint32_t acked);
+	/* Return the slow start threshold to use after a loss */
+	uint32_t (*ssthresh)(struct tcp *conn);
+	/* A round-trip time was measured (optional) */
+	void (*rtt_sample)(struct tcp *conn, uint32_t rtt_ms);
+	/* The retransmission timer expired (optional) */
+	void (*timeout)(struct tcp *conn);
+};
+
+#define TCP_CC_PRIV_WORDS 12
+
+struct tcp_cc {
+	const struct tcp_cc_ops *ops;
+	uint32_t cwnd;
+	uint32_t ssthresh;
+	uint32_t snd_max;   /* end of the highest sequence sent */
+	uint32_t recover;   /* snd_max when loss recovery started */
+	uint32_t delivered; /* total bytes acknowledged */
+	uint32_t srtt;      /* smoothed RTT in ms, scaled by 8 */
+	uint32_t rttvar;    /* RTT variation in ms, scaled by 4 */
+	uint32_t rtt_seq;   /* ACK covering the timed segment */
+	uint32_t rtt_start; /* uptime when the timed segment was sent */
+	uint32_t rto;       /* RTO derived from the RTT estimate in ms */
+	bool rtt_timing : 1;
+	bool in_recovery : 1;
+	bool rto_changed : 1;
+	uint32_t priv[TCP_CC_PRIV_WORDS]; /* algorithm private state */
 };
 
+#define tcp_cc_priv(_conn, _type)					({										BUILD_ASSERT(sizeof(_type) <= sizeof((_conn)->cc.priv));		(_type *)(_conn)->cc.priv;					})
+#endif /* CONFIG_NET_TCP_CONGESTION_CONTROL */
+
 struct tcp { /* TCP connection */
 	sys_snode_t next;
 	struct net_context *context;
@@ -240,6 +336,10 @@ struct tcp { /* TCP connection */
 	struct k_sem connect_sem; /* semaphore for blocking connect */
 	struct k_sem tx_sem; /* Semaphore indicating if transfers are blocked . */
 	struct k_fifo recv_data;  /* temp queue before passing data to app */
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+	struct net_pkt *rx_batch; /* data coalesced in the current rx batch */
+	sys_snode_t rx_batch_node;
+#endif
 	struct tcp_options recv_options;
 	struct tcp_options send_options;
 	struct k_work_delayable send_timer;
@@ -271,8 +371,14 @@ struct tcp { /* TCP connection */
 	uint16_t recv_win;
 	uint16_t send_win_max;
 	uint16_t send_win;
-#ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
-	uint16_t rto;
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+	struct tcp_cc cc;
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack sack;
+#endif
+#if defined(CONFIG_NET_TCP_RANDOMIZED_RTO) || defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+	uint32_t rto;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -283,6 +389,10 @@ struct tcp { /* TCP connection */
 	bool in_connect : 1;
 	bool in_close : 1;
 	bool tcp_nodelay : 1;
+#if defined(CONFIG_NET_TCP_RX_BATCH)
+	bool rx_batch_listed : 1;
+	bool rx_batch_ack : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -302,3 +412,18 @@ struct tcp { /* TCP connection */
 	_flags(_fl, _op, _mask, strlen("" #_args) ? _args : true)
 
 typedef void (*net_tcp_cb_t)(struct tcp *conn, void *user_data);
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+/* Congestion control, implemented in tcp_cc.c. The connection lock must
+ * be held when calling these.
+ */
+const struct tcp_cc_ops *tcp_cc_default(void);
+const struct tcp_cc_ops *tcp_cc_find(const char *name);
+void tcp_cc_select(struct tcp *conn, const struct tcp_cc_ops *ops);
+void tcp_cc_init(struct tcp *conn);
+void tcp_cc_sent(struct tcp *conn, uint32_t end_seq);
+bool tcp_cc_ack(struct tcp *conn, uint32_t ack, uint32_t acked);
+void tcp_cc_fast_retransmit(struct tcp *conn);
+bool tcp_cc_dup_ack(struct tcp *conn);
+void tcp_cc_timeout(struct tcp *conn);
+#endif
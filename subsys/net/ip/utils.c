@@ -582,6 +582,29 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	}
 }
 
+/* Incremental update as in RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m').
+ * The one's complement sum does not depend on the byte order, so the words
+ * are summed as they are stored, like the checksum field.
+ */
+uint16_t net_chksum_update(uint16_t chksum, const uint8_t *old_data,
+			   const uint8_t *new_data, size_t len)
+{
+	uint64_t sum = (uint16_t)~chksum;
+
+	NET_ASSERT(len % sizeof(uint16_t) == 0U);
+
+	for (size_t i = 0; i < len; i += sizeof(uint16_t)) {
+		sum += (uint16_t)~UNALIGNED_GET((uint16_t *)(old_data + i));
+		sum += UNALIGNED_GET((uint16_t *)(new_data + i));
+	}
+
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	return ~sum;
+}
+
 static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 {
 	struct net_pkt_cursor *cur = &pkt->cursor;
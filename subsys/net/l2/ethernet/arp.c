@@ -12,6 +12,7 @@
 LOG_MODULE_REGISTER(net_arp, CONFIG_NET_ARP_LOG_LEVEL);
 
 #include <errno.h>
+#include <zephyr/sys/hash_function.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_if.h>
@@ -34,6 +35,59 @@ static struct k_work_delayable arp_request_timer;
 
 static struct k_mutex arp_mutex;
 
+#if defined(CONFIG_NET_ARP_HASH)
+/* The entries of arp_table, by interface and IPv4 address */
+static sys_slist_t arp_hash[CONFIG_NET_ARP_HASH_BUCKETS];
+
+static sys_slist_t *arp_hash_list(struct net_if *iface, struct in_addr *addr)
+{
+	uint32_t key[2];
+
+	memcpy(&key[0], addr, sizeof(struct in_addr));
+	key[1] = (uint32_t)POINTER_TO_UINT(iface);
+
+	return &arp_hash[sys_hash32_murmur3(key, sizeof(key)) %
+			 CONFIG_NET_ARP_HASH_BUCKETS];
+}
+
+static struct arp_entry *arp_table_find(struct net_if *iface,
+					struct in_addr *dst)
+{
+	struct arp_entry *entry;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(arp_hash_list(iface, dst), entry,
+				     hash_node) {
+		if (entry->iface == iface &&
+		    net_ipv4_addr_cmp(&entry->ip, dst)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void arp_table_add(struct arp_entry *entry)
+{
+	entry->last_used = k_uptime_get_32();
+
+	sys_slist_prepend(&arp_table, &entry->node);
+	sys_slist_prepend(arp_hash_list(entry->iface, &entry->ip),
+			  &entry->hash_node);
+}
+
+static void arp_table_remove(struct arp_entry *entry, sys_snode_t *prev)
+{
+	sys_slist_remove(&arp_table, prev, &entry->node);
+	sys_slist_find_and_remove(arp_hash_list(entry->iface, &entry->ip),
+				  &entry->hash_node);
+}
+#else
+#define arp_table_find(iface, dst) arp_entry_find(&arp_table, iface, dst, NULL)
+#define arp_table_add(entry) sys_slist_prepend(&arp_table, &(entry)->node)
+#define arp_table_remove(entry, prev) \
+	sys_slist_remove(&arp_table, prev, &(entry)->node)
+#endif /* CONFIG_NET_ARP_HASH */
+
 static void arp_entry_cleanup(struct arp_entry *entry, bool pending)
 {
 	NET_DBG("%p", entry);
@@ -83,11 +137,21 @@ static struct arp_entry *arp_entry_find(sys_slist_t *list,
 static inline struct arp_entry *arp_entry_find_move_first(struct net_if *iface,
 							  struct in_addr *dst)
 {
-	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
 	NET_DBG("dst %s", net_sprint_ipv4_addr(dst));
 
+#if defined(CONFIG_NET_ARP_HASH)
+	entry = arp_table_find(iface, dst);
+	if (entry) {
+		/* Moving the entry first would need its predecessor in
+		 * the table, so the last use is remembered instead.
+		 */
+		entry->last_used = k_uptime_get_32();
+	}
+#else
+	sys_snode_t *prev = NULL;
+
 	entry = arp_entry_find(&arp_table, iface, dst, &prev);
 	if (entry) {
 		/* Let's assume the target is going to be accessed
@@ -100,6 +164,7 @@ static inline struct arp_entry *arp_entry_find_move_first(struct net_if *iface,
 			sys_slist_prepend(&arp_table, &entry->node);
 		}
 	}
+#endif
 
 	return entry;
 }
@@ -151,6 +216,27 @@ static struct arp_entry *arp_entry_get_free(void)
 
 static struct arp_entry *arp_entry_get_last_from_table(void)
 {
+#if defined(CONFIG_NET_ARP_HASH)
+	struct arp_entry *entry, *oldest = NULL;
+	sys_snode_t *prev = NULL, *oldest_prev = NULL;
+
+	/* Take out the least recently used entry */
+	SYS_SLIST_FOR_EACH_CONTAINER(&arp_table, entry, node) {
+		if (!oldest ||
+		    (int32_t)(entry->last_used - oldest->last_used) <= 0) {
+			oldest = entry;
+			oldest_prev = prev;
+		}
+
+		prev = &entry->node;
+	}
+
+	if (oldest) {
+		arp_table_remove(oldest, oldest_prev);
+	}
+
+	return oldest;
+#else
 	sys_snode_t *node;
 
 	/* We assume last entry is the oldest one,
@@ -165,6 +251,7 @@ static struct arp_entry *arp_entry_get_last_from_table(void)
 	sys_slist_find_and_remove(&arp_table, node);
 
 	return CONTAINER_OF(node, struct arp_entry, node);
+#endif
 }
 
 
@@ -442,10 +529,9 @@ static void arp_gratuitous(struct net_if *iface,
 			   struct in_addr *src,
 			   struct net_eth_addr *hwaddr)
 {
-	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
-	entry = arp_entry_find(&arp_table, iface, src, &prev);
+	entry = arp_table_find(iface, src);
 	if (entry) {
 		NET_DBG("Gratuitous ARP hwaddr %s -> %s",
 			net_sprint_ll_addr((const uint8_t *)&entry->eth,
@@ -477,10 +563,9 @@ static void arp_update(struct net_if *iface,
 		}
 
 		if (force) {
-			sys_snode_t *prev = NULL;
 			struct arp_entry *entry;
 
-			entry = arp_entry_find(&arp_table, iface, src, &prev);
+			entry = arp_table_find(iface, src);
 			if (entry) {
 				memcpy(&entry->eth, hwaddr,
 				       sizeof(struct net_eth_addr));
@@ -499,7 +584,7 @@ static void arp_update(struct net_if *iface,
 					entry->iface = iface;
 					net_ipaddr_copy(&entry->ip, src);
 					memcpy(&entry->eth, hwaddr, sizeof(entry->eth));
-					sys_slist_prepend(&arp_table, &entry->node);
+					arp_table_add(entry);
 				}
 			}
 		}
@@ -511,7 +596,7 @@ static void arp_update(struct net_if *iface,
 	memcpy(&entry->eth, hwaddr, sizeof(struct net_eth_addr));
 
 	/* Inserting entry into the table */
-	sys_slist_prepend(&arp_table, &entry->node);
+	arp_table_add(entry);
 
 	while (!k_fifo_is_empty(&entry->pending_queue)) {
 		pkt = k_fifo_get(&entry->pending_queue, K_FOREVER);
@@ -726,9 +811,9 @@ void net_arp_clear_cache(struct net_if *iface)
 			continue;
 		}
 
+		arp_table_remove(entry, prev);
 		arp_entry_cleanup(entry, false);
 
-		sys_slist_remove(&arp_table, prev, &entry->node);
 		sys_slist_prepend(&arp_free_entries, &entry->node);
 	}
 
@@ -798,6 +883,12 @@ void net_arp_init(void)
 	sys_slist_init(&arp_pending_entries);
 	sys_slist_init(&arp_table);
 
+#if defined(CONFIG_NET_ARP_HASH)
+	for (i = 0; i < CONFIG_NET_ARP_HASH_BUCKETS; i++) {
+		sys_slist_init(&arp_hash[i]);
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_ARP_TABLE_SIZE; i++) {
 		/* Inserting entry as free with initialised packet queue */
 		k_fifo_init(&arp_entries[i].pending_queue);
@@ -59,6 +59,10 @@ struct arp_entry {
 	struct in_addr ip;
 	struct net_eth_addr eth;
 	struct k_fifo pending_queue;
+#if defined(CONFIG_NET_ARP_HASH)
+	sys_snode_t hash_node;
+	uint32_t last_used;
+#endif
 };
 
 typedef void (*net_arp_cb_t)(struct arp_entry *entry,
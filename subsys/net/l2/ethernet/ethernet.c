@@ -1090,6 +1090,18 @@ static void carrier_on_off(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_NET_NAPI)
+static int ethernet_napi_poll(struct net_napi *napi, int budget)
+{
+	struct ethernet_context *ctx = CONTAINER_OF(napi, struct ethernet_context,
+						    napi);
+	const struct device *dev = net_if_get_device(ctx->iface);
+	const struct ethernet_api *api = dev->api;
+
+	return api->poll(dev, budget);
+}
+#endif
+
 void net_eth_carrier_on(struct net_if *iface)
 {
 	struct ethernet_context *ctx = net_if_l2_data(iface);
@@ -1209,6 +1221,11 @@ void ethernet_init(struct net_if *iface)
 	ctx->iface = iface;
 	k_work_init(&ctx->carrier_work, carrier_on_off);
 
+#if defined(CONFIG_NET_NAPI)
+	/* Only scheduled by the drivers which have a poll function */
+	ctx->napi.poll = ethernet_napi_poll;
+#endif
+
 	if (net_eth_get_hw_capabilities(iface) & ETHERNET_PROMISC_MODE) {
 		ctx->ethernet_l2_flags |= NET_L2_PROMISC_MODE;
 	}
@@ -60,6 +60,40 @@ bool gptp_is_slave_port(int port)
 	return (GPTP_GLOBAL_DS()->selected_role[port] == GPTP_PORT_SLAVE);
 }
 
+void gptp_wake_up(void)
+{
+	/* Makes the thread return from its wait on the RX queue. If the
+	 * thread is not waiting, it runs the state machines anyway before
+	 * waiting again.
+	 */
+	k_fifo_cancel_wait(&gptp_rx_queue);
+}
+
+#if defined(CONFIG_NET_GPTP_STATISTICS)
+void gptp_stats_dist_add(struct gptp_stats_dist *dist, int64_t value)
+{
+	uint64_t mag = value < 0 ? -(uint64_t)value : (uint64_t)value;
+	int bucket = 0;
+
+	if (mag >= 16U) {
+		bucket = MIN(63 - __builtin_clzll(mag) - 3,
+			     GPTP_STATS_DIST_BUCKETS - 1);
+	}
+
+	if (dist->count == 0U) {
+		dist->min = value;
+		dist->max = value;
+	} else {
+		dist->min = MIN(dist->min, value);
+		dist->max = MAX(dist->max, value);
+	}
+
+	dist->count++;
+	dist->sum += value;
+	dist->buckets[bucket]++;
+}
+#endif /* CONFIG_NET_GPTP_STATISTICS */
+
 /*
  * Use the given port to generate the clock identity
  * for the device.
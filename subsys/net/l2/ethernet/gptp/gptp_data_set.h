@@ -470,6 +470,33 @@ struct gptp_port_ds {
 	bool neighbor_rate_ratio_valid : 1;
 };
 
+/** Number of buckets of a gPTP value distribution. */
+#define GPTP_STATS_DIST_BUCKETS 16
+
+/**
+ * @brief Distribution of a value in nanoseconds.
+ *
+ * The first bucket counts the values whose magnitude is below 16 ns, bucket n
+ * the magnitudes in [2^(n+3), 2^(n+4)) ns, and the last bucket also counts
+ * all the larger ones.
+ */
+struct gptp_stats_dist {
+	/** Number of values. */
+	uint32_t count;
+
+	/** Smallest value. */
+	int64_t min;
+
+	/** Largest value. */
+	int64_t max;
+
+	/** Sum of the values. */
+	int64_t sum;
+
+	/** Number of values in each bucket of magnitude. */
+	uint32_t buckets[GPTP_STATS_DIST_BUCKETS];
+};
+
 /**
  * @brief Port Parameter Statistics.
  *
@@ -526,6 +553,12 @@ struct gptp_port_param_ds {
 
 	/** Neighbor propagation delay threshold exceeded. */
 	uint32_t neighbor_prop_delay_exceeded;
+
+	/** Offsets from the master of the local clock, on a slave port. */
+	struct gptp_stats_dist offset;
+
+	/** Neighbor propagation delays. */
+	struct gptp_stats_dist path_delay;
 };
 
 /**
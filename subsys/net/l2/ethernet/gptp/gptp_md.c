@@ -325,6 +325,8 @@ static void gptp_md_compute_prop_time(int port)
 	prop_time /= 2;
 
 	port_ds->neighbor_prop_delay = prop_time;
+
+	GPTP_STATS_DIST_ADD(port, path_delay, (int64_t)prop_time);
 }
 
 static void gptp_md_pdelay_compute(int port)
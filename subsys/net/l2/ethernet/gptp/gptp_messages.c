@@ -103,6 +103,9 @@ static void gptp_sync_timestamp_callback(struct net_pkt *pkt)
 
 		/* The pkt was ref'ed in gptp_send_sync() */
 		net_pkt_unref(pkt);
+
+		/* Send the Follow Up now rather than on the next tick */
+		gptp_wake_up();
 	}
 }
 
@@ -730,6 +730,58 @@ static void gptp_mi_clk_slave_sync_compute(void)
 }
 
 #if defined(CONFIG_NET_GPTP_USE_DEFAULT_CLOCK_UPDATE)
+#if defined(CONFIG_NET_GPTP_SERVO_PI)
+/* Largest frequency correction of the servo, in ppb */
+#define GPTP_SERVO_PI_MAX_PPB 500000.0
+
+static struct {
+	/* Filtered offset from the master, in ns */
+	int64_t offset;
+	/* Integral term, in ppb */
+	double integral;
+	bool valid;
+} servo;
+
+static void gptp_servo_pi_reset(void)
+{
+	servo.integral = 0;
+	servo.valid = false;
+}
+
+/* The offset is corrected on top of the syntonization to the neighbor rate
+ * ratio, which is measured again between two updates, so that the
+ * corrections below are not cumulative.
+ */
+static void gptp_servo_pi_update(const struct device *clk, double rate_ratio,
+				 int64_t offset)
+{
+	double ppb;
+
+	if (!servo.valid) {
+		servo.offset = offset;
+		servo.valid = true;
+	} else {
+		servo.offset += (offset - servo.offset) >>
+			CONFIG_NET_GPTP_SERVO_PI_FILTER_LOG2;
+	}
+
+	servo.integral += servo.offset * CONFIG_NET_GPTP_SERVO_PI_KI / 1000.0;
+	servo.integral = CLAMP(servo.integral, -GPTP_SERVO_PI_MAX_PPB,
+			       GPTP_SERVO_PI_MAX_PPB);
+	ppb = servo.integral;
+
+	if (IS_ENABLED(CONFIG_NET_GPTP_SERVO_PI_FREQ_ONLY)) {
+		ppb += servo.offset * CONFIG_NET_GPTP_SERVO_PI_KP / 1000.0;
+		ppb = CLAMP(ppb, -GPTP_SERVO_PI_MAX_PPB, GPTP_SERVO_PI_MAX_PPB);
+	} else {
+		ptp_clock_adjust(clk, (int)(servo.offset *
+					    CONFIG_NET_GPTP_SERVO_PI_KP / 1000));
+	}
+
+	ptp_clock_rate_adjust(clk, rate_ratio * (1.0 + ppb / NSEC_PER_SEC));
+}
+#endif /* CONFIG_NET_GPTP_SERVO_PI */
+
 static void gptp_update_local_port_clock(void)
 {
 	struct gptp_clk_slave_sync_state *state;
@@ -777,6 +829,23 @@ static void gptp_update_local_port_clock(void)
 		nanosecond_diff = -(int64_t)NSEC_PER_SEC + nanosecond_diff;
 	}
 
+	if (second_diff == 0) {
+		GPTP_STATS_DIST_ADD(port, offset, nanosecond_diff);
+	}
+
+#if defined(CONFIG_NET_GPTP_SERVO_PI)
+	if (second_diff == 0 &&
+	    nanosecond_diff >= -CONFIG_NET_GPTP_SERVO_PI_STEP_THRESHOLD &&
+	    nanosecond_diff <= CONFIG_NET_GPTP_SERVO_PI_STEP_THRESHOLD) {
+		gptp_servo_pi_update(clk, port_ds->neighbor_rate_ratio,
+				     nanosecond_diff);
+		return;
+	}
+
+	/* The clock is stepped, start over from the new offset */
+	gptp_servo_pi_reset();
+#endif
+
 	ptp_clock_rate_adjust(clk, port_ds->neighbor_rate_ratio);
 
 	/* If time difference is too high, set the clock value.
@@ -26,10 +26,33 @@ extern "C" {
 
 #if defined(CONFIG_NET_GPTP_STATISTICS)
 #define GPTP_STATS_INC(port, var) (GPTP_PORT_PARAM_DS(port)->var++)
+#define GPTP_STATS_DIST_ADD(port, var, value) \
+	gptp_stats_dist_add(&GPTP_PORT_PARAM_DS(port)->var, value)
 #else
 #define GPTP_STATS_INC(port, var)
+#define GPTP_STATS_DIST_ADD(port, var, value)
 #endif
 
+#if defined(CONFIG_NET_GPTP_STATISTICS)
+struct gptp_stats_dist;
+
+/**
+ * @brief Add a value to a distribution.
+ *
+ * @param dist Distribution.
+ * @param value Value in nanoseconds.
+ */
+void gptp_stats_dist_add(struct gptp_stats_dist *dist, int64_t value);
+#endif
+
+/**
+ * @brief Wake up the gPTP thread.
+ *
+ * Runs the state machines without waiting for their next periodic run, for
+ * instance as soon as the TX timestamp of a message is known.
+ */
+void gptp_wake_up(void);
+
 /**
  * @brief Is a slave acting as a slave.
  *
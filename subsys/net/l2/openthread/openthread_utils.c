@@ -14,6 +14,7 @@ LOG_MODULE_DECLARE(net_l2_openthread, CONFIG_OPENTHREAD_L2_LOG_LEVEL);
 #include <openthread/ip6.h>
 #include <openthread/thread.h>
 
+#include "net_private.h"
 #include "openthread_utils.h"
 
 #define ALOC16_MASK 0xfc
@@ -154,6 +155,7 @@ void add_ipv6_addr_to_zephyr(struct openthread_context *context)
 
 		if_addr->is_mesh_local = is_mesh_local(
 					context, address->mAddress.mFields.m8);
+		net_if_ipv6_addr_cache_flush();
 	}
 }
 
@@ -193,6 +195,7 @@ void add_ipv6_addr_to_ot(struct openthread_context *context,
 
 	if_addr->is_mesh_local = is_mesh_local(
 			context, ipv6->unicast[i].address.in6_addr.s6_addr);
+	net_if_ipv6_addr_cache_flush();
 
 	addr.mValid = true;
 	addr.mPreferred = true;
@@ -233,6 +233,7 @@ static void add_iid_address(struct net_if *iface, uint8_t *iid)
 		 * as a preferred one.
 		 */
 		ifaddr->addr_state = NET_ADDR_PREFERRED;
+		net_if_ipv6_addr_cache_flush();
 	}
 }
 
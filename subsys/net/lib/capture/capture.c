@@ -505,6 +505,8 @@ void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 	struct net_pkt *captured;
 	sys_snode_t *sn, *sns;
 
+	net_capture_ring_pkt(iface, pkt);
+
 	/* We must prevent to capture network packet that is already captured
 	 * in order to avoid recursion.
 	 */
@@ -0,0 +1,291 @@
+/** @file
+ * @brief Network packet capture ring
+ *
+ * Records the first bytes of the network packets in a ring buffer which
+ * can be exported in pcapng format.
+ */
+
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/capture.h>
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_CAPTURE_RING_SIZE),
+	     "CONFIG_NET_CAPTURE_RING_SIZE must be a power of two");
+
+#define RING_MASK (CONFIG_NET_CAPTURE_RING_SIZE - 1)
+
+/* pcapng block types and link types */
+#define PCAPNG_SHB 0x0A0D0D0A
+#define PCAPNG_IDB 0x00000001
+#define PCAPNG_EPB 0x00000006
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1A2B3C4D
+
+#define LINKTYPE_ETHERNET 1
+#define LINKTYPE_RAW 101
+#define LINKTYPE_IEEE802_15_4_NOFCS 230
+
+struct capture_record {
+	/** Index of the packet plus one once the record is complete */
+	atomic_t seq;
+
+	/** Capture time, in cycles or ticks */
+	uint64_t stamp;
+
+	/** Length of the packet */
+	uint32_t orig_len;
+
+	/** Number of bytes recorded */
+	uint16_t caplen;
+
+	/** Index of the network interface */
+	uint8_t iface;
+
+	uint8_t data[CONFIG_NET_CAPTURE_RING_SNAPLEN];
+};
+
+struct pcapng_shb {
+	uint32_t type;
+	uint32_t len;
+	uint32_t magic;
+	uint16_t major;
+	uint16_t minor;
+	int64_t section_len;
+	uint32_t len_trailer;
+} __packed;
+
+struct pcapng_idb {
+	uint32_t type;
+	uint32_t len;
+	uint16_t link_type;
+	uint16_t reserved;
+	uint32_t snaplen;
+	uint32_t len_trailer;
+} __packed;
+
+struct pcapng_epb {
+	uint32_t type;
+	uint32_t len;
+	uint32_t iface_id;
+	uint32_t ts_high;
+	uint32_t ts_low;
+	uint32_t caplen;
+	uint32_t orig_len;
+} __packed;
+
+struct export_ctx {
+	net_capture_ring_write_cb_t cb;
+	void *user_data;
+	int ret;
+};
+
+static struct capture_record ring[CONFIG_NET_CAPTURE_RING_SIZE];
+static atomic_t ring_head;
+static atomic_t ring_enabled = ATOMIC_INIT(IS_ENABLED(CONFIG_NET_CAPTURE_RING_AUTOSTART));
+
+/* Serializes the exports, which share the record copy */
+static K_MUTEX_DEFINE(export_lock);
+static struct capture_record export_record;
+
+static inline uint64_t capture_stamp(void)
+{
+#if defined(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)
+	return k_cycle_get_64();
+#else
+	return k_uptime_ticks();
+#endif
+}
+
+static inline uint64_t capture_stamp_to_us(uint64_t stamp)
+{
+#if defined(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)
+	return k_cyc_to_us_floor64(stamp);
+#else
+	return k_ticks_to_us_floor64(stamp);
+#endif
+}
+
+void net_capture_ring_pkt(struct net_if *iface, struct net_pkt *pkt)
+{
+	struct capture_record *record;
+	struct net_buf *buf;
+	atomic_val_t idx;
+	uint16_t len = 0;
+
+	if (!atomic_get(&ring_enabled) || !net_pkt_filter_capture_ok(pkt)) {
+		return;
+	}
+
+	/* Writers only contend on the head index. A record is marked
+	 * incomplete while it is written so that readers skip it.
+	 */
+	idx = atomic_inc(&ring_head);
+	record = &ring[idx & RING_MASK];
+
+	atomic_set(&record->seq, idx);
+
+	for (buf = pkt->buffer; buf != NULL && len < sizeof(record->data);
+	     buf = buf->frags) {
+		uint16_t copy = MIN(buf->len, sizeof(record->data) - len);
+
+		memcpy(&record->data[len], buf->data, copy);
+		len += copy;
+	}
+
+	record->stamp = capture_stamp();
+	record->orig_len = net_pkt_get_len(pkt);
+	record->caplen = len;
+	record->iface = net_if_get_by_iface(iface);
+
+	atomic_set(&record->seq, idx + 1);
+}
+
+void net_capture_ring_enable(bool enable)
+{
+	atomic_set(&ring_enabled, enable);
+}
+
+bool net_capture_ring_is_enabled(void)
+{
+	return atomic_get(&ring_enabled);
+}
+
+void net_capture_ring_clear(void)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(ring); i++) {
+		atomic_set(&ring[i].seq, 0);
+	}
+}
+
+static int export_write(struct export_ctx *ctx, const void *data, size_t len)
+{
+	if (ctx->ret == 0 && len > 0) {
+		ctx->ret = ctx->cb(data, len, ctx->user_data);
+	}
+
+	return ctx->ret;
+}
+
+static uint16_t iface_link_type(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return LINKTYPE_ETHERNET;
+	}
+#endif
+
+#if defined(CONFIG_NET_L2_IEEE802154)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(IEEE802154)) {
+		return LINKTYPE_IEEE802_15_4_NOFCS;
+	}
+#endif
+
+	return LINKTYPE_RAW;
+}
+
+/* The interfaces are iterated in index order, so the pcapng interface
+ * identifier of an interface is its index minus one.
+ */
+static void export_iface_cb(struct net_if *iface, void *user_data)
+{
+	struct pcapng_idb idb = {
+		.type = PCAPNG_IDB,
+		.len = sizeof(idb),
+		.link_type = iface_link_type(iface),
+		.snaplen = CONFIG_NET_CAPTURE_RING_SNAPLEN,
+		.len_trailer = sizeof(idb),
+	};
+
+	export_write(user_data, &idb, sizeof(idb));
+}
+
+/* Must be invoked with export_lock held. Returns false if the record was
+ * overwritten or is being written.
+ */
+static bool export_copy(atomic_val_t idx)
+{
+	struct capture_record *record = &ring[idx & RING_MASK];
+
+	if (atomic_get(&record->seq) != idx + 1) {
+		return false;
+	}
+
+	memcpy(&export_record, record, sizeof(export_record));
+
+	barrier_dmem_fence_full();
+
+	return atomic_get(&record->seq) == idx + 1;
+}
+
+static void export_record_write(struct export_ctx *ctx)
+{
+	static const uint8_t padding[3];
+	uint32_t padded = ROUND_UP(export_record.caplen, 4);
+	uint64_t ts = capture_stamp_to_us(export_record.stamp);
+	struct pcapng_epb epb = {
+		.type = PCAPNG_EPB,
+		.len = sizeof(epb) + padded + sizeof(uint32_t),
+		.iface_id = export_record.iface - 1,
+		.ts_high = ts >> 32,
+		.ts_low = (uint32_t)ts,
+		.caplen = export_record.caplen,
+		.orig_len = export_record.orig_len,
+	};
+
+	export_write(ctx, &epb, sizeof(epb));
+	export_write(ctx, export_record.data, export_record.caplen);
+	export_write(ctx, padding, padded - export_record.caplen);
+	export_write(ctx, &epb.len, sizeof(epb.len));
+}
+
+int net_capture_ring_export(net_capture_ring_write_cb_t cb, void *user_data)
+{
+	struct export_ctx ctx = {
+		.cb = cb,
+		.user_data = user_data,
+	};
+	struct pcapng_shb shb = {
+		.type = PCAPNG_SHB,
+		.len = sizeof(shb),
+		.magic = PCAPNG_BYTE_ORDER_MAGIC,
+		.major = 1,
+		.minor = 0,
+		.section_len = -1,
+		.len_trailer = sizeof(shb),
+	};
+	atomic_val_t head, idx;
+	int count = 0;
+
+	k_mutex_lock(&export_lock, K_FOREVER);
+
+	export_write(&ctx, &shb, sizeof(shb));
+	net_if_foreach(export_iface_cb, &ctx);
+
+	head = atomic_get(&ring_head);
+	idx = (unsigned long)head < CONFIG_NET_CAPTURE_RING_SIZE ?
+	      0 : head - CONFIG_NET_CAPTURE_RING_SIZE;
+
+	for (; idx != head && ctx.ret == 0; idx++) {
+		if (!export_copy(idx)) {
+			continue;
+		}
+
+		export_record_write(&ctx);
+		count++;
+	}
+
+	k_mutex_unlock(&export_lock);
+
+	return ctx.ret < 0 ? ctx.ret : count;
+}
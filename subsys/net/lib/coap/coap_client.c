@@ -240,6 +240,76 @@ static enum coap_block_size coap_client_default_block_size(void)
 	return COAP_BLOCK_256;
 }
 
+static int coap_client_stream_payload(struct coap_client_request *req,
+				      struct coap_client_internal_request *internal_req,
+				      const uint8_t **payload, size_t *payload_len)
+{
+	struct coap_block_context *blk_ctx = &internal_req->send_blk_ctx;
+	size_t block_in_bytes = coap_block_size_to_bytes(coap_client_default_block_size());
+	size_t offset = blk_ctx->current;
+	bool last_block = true;
+	int ret;
+
+	*payload_len = block_in_bytes;
+
+	ret = req->payload_cb(offset, payload, payload_len, &last_block, req->user_data);
+	if (ret < 0) {
+		LOG_ERR("Payload callback failed %d", ret);
+		return ret;
+	}
+
+	if (*payload_len > block_in_bytes ||
+	    (!last_block && *payload_len != block_in_bytes)) {
+		LOG_ERR("Invalid payload length %zu at offset %zu", *payload_len, offset);
+		return -EINVAL;
+	}
+
+	/* Whole payload in a single message */
+	if (blk_ctx->total_size == 0 && last_block) {
+		return 0;
+	}
+
+	if (blk_ctx->total_size == 0) {
+		coap_block_transfer_init(blk_ctx, coap_client_default_block_size(), 0);
+	}
+
+	/* The total size is not known in advance, make the more flag of the block1 option
+	 * follow the callback.
+	 */
+	blk_ctx->total_size = offset + *payload_len + (last_block ? 0 : 1);
+
+	return 0;
+}
+
+static int coap_client_get_payload(struct coap_client_request *req,
+				   struct coap_client_internal_request *internal_req,
+				   const uint8_t **payload, size_t *payload_len)
+{
+	struct coap_block_context *blk_ctx = &internal_req->send_blk_ctx;
+	size_t block_in_bytes;
+
+	if (req->payload_cb) {
+		return coap_client_stream_payload(req, internal_req, payload, payload_len);
+	}
+
+	if (blk_ctx->total_size == 0 && req->len <= CONFIG_COAP_CLIENT_MESSAGE_SIZE) {
+		*payload = req->payload;
+		*payload_len = req->len;
+		return 0;
+	}
+
+	if (blk_ctx->total_size == 0) {
+		coap_block_transfer_init(blk_ctx, coap_client_default_block_size(), req->len);
+	}
+
+	block_in_bytes = coap_block_size_to_bytes(blk_ctx->block_size);
+
+	*payload = req->payload + blk_ctx->current;
+	*payload_len = MIN(blk_ctx->total_size - blk_ctx->current, block_in_bytes);
+
+	return 0;
+}
+
 static int coap_client_init_request(struct coap_client *client,
 				    struct coap_client_request *req,
 				    struct coap_client_internal_request *internal_req,
@@ -276,7 +346,7 @@ static int coap_client_init_request(struct coap_client *client,
 	}
 
 	/* Add content format option only if there is a payload */
-	if (req->payload) {
+	if (req->payload || req->payload_cb) {
 		ret = coap_append_option_int(&internal_req->request,
 					     COAP_OPTION_CONTENT_FORMAT, req->fmt);
 
@@ -308,19 +378,17 @@ static int coap_client_init_request(struct coap_client *client,
 		}
 	}
 
-	if (req->payload) {
-		uint16_t payload_len;
-		uint16_t offset;
+	if (req->payload || req->payload_cb) {
+		const uint8_t *payload;
+		size_t payload_len;
 
-		/* Blockwise send ongoing, add block1 */
-		if (internal_req->send_blk_ctx.total_size > 0 ||
-		   (req->len > CONFIG_COAP_CLIENT_MESSAGE_SIZE)) {
+		ret = coap_client_get_payload(req, internal_req, &payload, &payload_len);
+		if (ret < 0) {
+			goto out;
+		}
 
-			if (internal_req->send_blk_ctx.total_size == 0) {
-				coap_block_transfer_init(&internal_req->send_blk_ctx,
-							 coap_client_default_block_size(),
-							 req->len);
-			}
+		/* Blockwise send ongoing, add block1 */
+		if (internal_req->send_blk_ctx.total_size > 0) {
 			ret = coap_append_block1_option(&internal_req->request,
 							&internal_req->send_blk_ctx);
 
@@ -337,23 +405,7 @@ static int coap_client_init_request(struct coap_client *client,
 			goto out;
 		}
 
-		if (internal_req->send_blk_ctx.total_size > 0) {
-			uint16_t block_in_bytes =
-				coap_block_size_to_bytes(internal_req->send_blk_ctx.block_size);
-
-			payload_len = internal_req->send_blk_ctx.total_size -
-				      internal_req->send_blk_ctx.current;
-			if (payload_len > block_in_bytes) {
-				payload_len = block_in_bytes;
-			}
-			offset = internal_req->send_blk_ctx.current;
-		} else {
-			payload_len = req->len;
-			offset = 0;
-		}
-
-		ret = coap_packet_append_payload(&internal_req->request, req->payload + offset,
-						 payload_len);
+		ret = coap_packet_append_payload(&internal_req->request, payload, payload_len);
 
 		if (ret < 0) {
 			LOG_ERR("Failed to append payload to CoAP message");
@@ -0,0 +1,275 @@
+/** @file
+ * @brief DNS answer cache
+ */
+
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
+
+#include <errno.h>
+#include <string.h>
+#include <strings.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+
+#include "dns_cache.h"
+
+struct dns_cache_entry {
+	/** Address of the name, unused in negative entries */
+	struct dns_addrinfo info;
+
+	/** Uptime when the entry expires, in ms */
+	int64_t expiry;
+
+	/** Time to live of the entry, in seconds */
+	uint32_t ttl;
+
+	enum dns_query_type type;
+
+	/** The entry is in use, unless it has expired */
+	bool in_use : 1;
+
+	/** The name has no address of the type */
+	bool negative : 1;
+
+	/** The name is being queried again */
+	bool refreshing : 1;
+
+	char query[CONFIG_DNS_RESOLVER_CACHE_NAME_LEN];
+};
+
+static struct dns_cache_entry dns_cache[CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES];
+static struct dns_resolve_cache_stats dns_cache_stats;
+static K_MUTEX_DEFINE(dns_cache_lock);
+
+/* Must be invoked with dns_cache_lock held */
+static bool entry_valid(struct dns_cache_entry *entry, int64_t now)
+{
+	if (entry->in_use && entry->expiry - now <= 0) {
+		entry->in_use = false;
+	}
+
+	return entry->in_use;
+}
+
+static bool entry_match(struct dns_cache_entry *entry, const char *query,
+			enum dns_query_type type)
+{
+	return entry->type == type &&
+		strncasecmp(entry->query, query, sizeof(entry->query)) == 0;
+}
+
+/* Must be invoked with dns_cache_lock held. Returns the entry which expires
+ * first if the cache is full.
+ */
+static struct dns_cache_entry *entry_get_free(int64_t now)
+{
+	struct dns_cache_entry *oldest = NULL;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *entry = &dns_cache[i];
+
+		if (!entry_valid(entry, now)) {
+			return entry;
+		}
+
+		if (!oldest || entry->expiry < oldest->expiry) {
+			oldest = entry;
+		}
+	}
+
+	return oldest;
+}
+
+/* Must be invoked with dns_cache_lock held */
+static void entry_set(struct dns_cache_entry *entry, const char *query,
+		      enum dns_query_type type, uint32_t ttl, int64_t now)
+{
+	strcpy(entry->query, query);
+	entry->type = type;
+	entry->ttl = ttl;
+	entry->expiry = now + (int64_t)ttl * MSEC_PER_SEC;
+	entry->in_use = true;
+	entry->refreshing = false;
+}
+
+/* Must be invoked with dns_cache_lock held */
+static void remove_entries(const char *query, enum dns_query_type type,
+			   bool negative, int64_t now)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *entry = &dns_cache[i];
+
+		if (entry_valid(entry, now) && entry->negative == negative &&
+		    entry_match(entry, query, type)) {
+			entry->in_use = false;
+		}
+	}
+}
+
+void dns_cache_add(const char *query, enum dns_query_type type,
+		   const struct dns_addrinfo *info, uint32_t ttl)
+{
+	struct dns_cache_entry *entry = NULL;
+	int64_t now;
+	int i;
+
+	if (ttl == 0 || strlen(query) >= CONFIG_DNS_RESOLVER_CACHE_NAME_LEN) {
+		return;
+	}
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	now = k_uptime_get();
+
+	remove_entries(query, type, true, now);
+
+	for (i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *iter = &dns_cache[i];
+
+		if (entry_valid(iter, now) && entry_match(iter, query, type) &&
+		    iter->info.ai_addrlen == info->ai_addrlen &&
+		    memcmp(&iter->info.ai_addr, &info->ai_addr,
+			   info->ai_addrlen) == 0) {
+			entry = iter;
+			break;
+		}
+	}
+
+	if (!entry) {
+		entry = entry_get_free(now);
+		memcpy(&entry->info, info, sizeof(entry->info));
+		entry->negative = false;
+	}
+
+	entry_set(entry, query, type, ttl, now);
+
+	NET_DBG("Cached %s type %d for %u s", query, type, ttl);
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_cache_add_negative(const char *query, enum dns_query_type type)
+{
+	struct dns_cache_entry *entry;
+	int64_t now;
+
+	if (CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL == 0 ||
+	    strlen(query) >= CONFIG_DNS_RESOLVER_CACHE_NAME_LEN) {
+		return;
+	}
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	now = k_uptime_get();
+
+	remove_entries(query, type, false, now);
+	remove_entries(query, type, true, now);
+
+	entry = entry_get_free(now);
+	entry->negative = true;
+	entry_set(entry, query, type, CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL,
+		  now);
+
+	NET_DBG("Cached %s type %d as non-existent", query, type);
+
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+int dns_cache_find(const char *query, enum dns_query_type type,
+		   struct dns_addrinfo *info, size_t info_len, bool *refresh)
+{
+	bool expiring = false;
+	bool refreshing = false;
+	int64_t now;
+	int count = 0;
+	int i;
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	now = k_uptime_get();
+
+	for (i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *entry = &dns_cache[i];
+
+		if (!entry_valid(entry, now) || !entry_match(entry, query, type)) {
+			continue;
+		}
+
+		if (entry->negative) {
+			count = -ENOENT;
+			break;
+		}
+
+		/* Query again during the last tenth of the time to live */
+		if ((entry->expiry - now) * 10 <
+		    (int64_t)entry->ttl * MSEC_PER_SEC) {
+			expiring = true;
+		}
+
+		refreshing |= entry->refreshing;
+
+		if (count < (int)info_len) {
+			memcpy(&info[count++], &entry->info, sizeof(*info));
+		}
+	}
+
+	if (count > 0) {
+		dns_cache_stats.hits++;
+	} else if (count < 0) {
+		dns_cache_stats.negative_hits++;
+	} else {
+		dns_cache_stats.misses++;
+	}
+
+	if (refresh) {
+		*refresh = count > 0 && expiring && !refreshing;
+	}
+
+	if (refresh && *refresh) {
+		for (i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+			struct dns_cache_entry *entry = &dns_cache[i];
+
+			if (entry_valid(entry, now) &&
+			    entry_match(entry, query, type)) {
+				entry->refreshing = true;
+			}
+		}
+
+		dns_cache_stats.prefetches++;
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+
+	return count;
+}
+
+void dns_resolve_cache_get_stats(struct dns_resolve_cache_stats *stats)
+{
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+	*stats = dns_cache_stats;
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_resolve_cache_flush(void)
+{
+	int i;
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *entry = &dns_cache[i];
+
+		entry->in_use = false;
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+}
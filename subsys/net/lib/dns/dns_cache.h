@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DNS_CACHE_H_
+#define DNS_CACHE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/net/dns_resolve.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Add an address of a name to the cache
+ *
+ * An existing entry with the same address has its time to live updated.
+ * A negative entry of the name is removed.
+ *
+ * @param query Name that was resolved
+ * @param type Type of the query
+ * @param info Address of the name
+ * @param ttl Time to live of the address, in seconds
+ */
+void dns_cache_add(const char *query, enum dns_query_type type,
+		   const struct dns_addrinfo *info, uint32_t ttl);
+
+/**
+ * @brief Remember that a name has no address of a type
+ *
+ * The addresses of the name are removed from the cache. Does nothing
+ * if CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL is 0.
+ *
+ * @param query Name that was resolved
+ * @param type Type of the query
+ */
+void dns_cache_add_negative(const char *query, enum dns_query_type type);
+
+/**
+ * @brief Find the cached addresses of a name
+ *
+ * @param query Name to resolve
+ * @param type Type of the query
+ * @param info Array filled with the addresses
+ * @param info_len Number of elements in @p info
+ * @param refresh If not NULL, set to true if the name should be queried
+ *        again as its addresses are about to expire. This is reported only
+ *        once per answer.
+ *
+ * @return Number of addresses found, 0 if the name is not cached, or
+ *         -ENOENT if the name is known to have no address of the type.
+ */
+int dns_cache_find(const char *query, enum dns_query_type type,
+		   struct dns_addrinfo *info, size_t info_len, bool *refresh);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DNS_CACHE_H_ */
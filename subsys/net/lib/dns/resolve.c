@@ -16,6 +16,7 @@ LOG_MODULE_REGISTER(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 #include <zephyr/types.h>
 #include <zephyr/random/rand32.h>
 #include <string.h>
+#include <strings.h>
 #include <errno.h>
 #include <stdlib.h>
 
@@ -26,6 +27,7 @@ LOG_MODULE_REGISTER(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 #include <zephyr/net/dns_resolve.h>
 #include "dns_pack.h"
 #include "dns_internal.h"
+#include "dns_cache.h"
 
 #define DNS_SERVER_COUNT CONFIG_DNS_RESOLVER_MAX_SERVERS
 #define SERVER_COUNT     (DNS_SERVER_COUNT + DNS_MAX_MCAST_SERVERS)
@@ -68,6 +70,9 @@ LOG_MODULE_REGISTER(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 #define DNS_IPV4_LEN		sizeof(struct in_addr)
 #define DNS_IPV6_LEN		sizeof(struct in6_addr)
 
+/* Timeout of the queries refreshing cached names */
+#define DNS_PREFETCH_TIMEOUT_MS	2000
+
 NET_BUF_POOL_DEFINE(dns_msg_pool, DNS_RESOLVER_BUF_CTR,
 		    DNS_RESOLVER_MAX_BUF_SIZE, 0, NULL);
 
@@ -441,6 +446,43 @@ static void release_query(struct dns_pending_query *pending_query)
 	}
 }
 
+/* Invoke the callbacks of a query slot and of the slots sharing its answer.
+ *
+ * Must be invoked with context lock held.
+ */
+static void invoke_shared_callbacks(struct dns_resolve_context *ctx,
+				    int status, struct dns_addrinfo *info,
+				    int idx)
+{
+	invoke_query_callback(status, info, &ctx->queries[idx]);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	for (int i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		if (ctx->queries[i].leader == &ctx->queries[idx]) {
+			invoke_query_callback(status, info, &ctx->queries[i]);
+		}
+	}
+#endif
+}
+
+/* Release a query slot and the slots sharing its answer.
+ *
+ * Must be invoked with context lock held.
+ */
+static void release_shared_queries(struct dns_resolve_context *ctx, int idx)
+{
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	for (int i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		if (ctx->queries[i].leader == &ctx->queries[idx]) {
+			ctx->queries[i].leader = NULL;
+			release_query(&ctx->queries[i]);
+		}
+	}
+#endif
+
+	release_query(&ctx->queries[idx]);
+}
+
 /* Must be invoked with context lock held */
 static inline int get_slot_by_id(struct dns_resolve_context *ctx,
 				 uint16_t dns_id,
@@ -472,7 +514,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		     uint16_t *query_hash)
 {
 	struct dns_addrinfo info = { 0 };
-	uint32_t ttl; /* RR ttl, so far it is not passed to caller */
+	uint32_t ttl; /* RR ttl, only passed to the cache */
 	uint8_t *src, *addr;
 	const char *query_name;
 	int address_size;
@@ -633,8 +675,15 @@ query_known:
 			src = dns_msg->msg + dns_msg->response_position;
 			memcpy(addr, src, address_size);
 
-			invoke_query_callback(DNS_EAI_INPROGRESS, &info,
-					      &ctx->queries[*query_idx]);
+			if (IS_ENABLED(CONFIG_DNS_RESOLVER_CACHE) &&
+			    ctx->queries[*query_idx].query != NULL) {
+				dns_cache_add(ctx->queries[*query_idx].query,
+					      ctx->queries[*query_idx].query_type,
+					      &info, ttl);
+			}
+
+			invoke_shared_callbacks(ctx, DNS_EAI_INPROGRESS, &info,
+						*query_idx);
 			items++;
 			break;
 
@@ -743,15 +792,23 @@ static int dns_read(struct dns_resolve_context *ctx,
 		goto finished;
 	}
 
+	/* Only remember names that do not exist, not server failures */
+	if (IS_ENABLED(CONFIG_DNS_RESOLVER_CACHE) && ret == DNS_EAI_NODATA &&
+	    query_idx >= 0 && ctx->queries[query_idx].query != NULL &&
+	    dns_header_rcode(dns_msg.msg) == DNS_HEADER_NAMEERROR) {
+		dns_cache_add_negative(ctx->queries[query_idx].query,
+				       ctx->queries[query_idx].query_type);
+	}
+
 	if (ret < 0 || query_idx < 0 ||
 	    query_idx > CONFIG_DNS_NUM_CONCUR_QUERIES) {
 		goto quit;
 	}
 
-	invoke_query_callback(ret, NULL, &ctx->queries[query_idx]);
+	invoke_shared_callbacks(ctx, ret, NULL, query_idx);
 
 	/* Marks the end of the results */
-	release_query(&ctx->queries[query_idx]);
+	release_shared_queries(ctx, query_idx);
 
 	net_pkt_unref(pkt);
 
@@ -853,10 +910,10 @@ quit:
 		goto free_buf;
 	}
 
-	invoke_query_callback(ret, NULL, &ctx->queries[i]);
+	invoke_shared_callbacks(ctx, ret, NULL, i);
 
 	/* Marks the end of the results */
-	release_query(&ctx->queries[i]);
+	release_shared_queries(ctx, i);
 
 free_buf:
 	if (dns_data) {
@@ -951,9 +1008,9 @@ static int dns_write(struct dns_resolve_context *ctx,
 /* Must be invoked with context lock held */
 static void dns_resolve_cancel_slot(struct dns_resolve_context *ctx, int slot)
 {
-	invoke_query_callback(DNS_EAI_CANCELED, NULL, &ctx->queries[slot]);
+	invoke_shared_callbacks(ctx, DNS_EAI_CANCELED, NULL, slot);
 
-	release_query(&ctx->queries[slot]);
+	release_shared_queries(ctx, slot);
 }
 
 /* Must be invoked with context lock held */
@@ -1105,6 +1162,115 @@ static void query_timeout(struct k_work *work)
 	k_mutex_unlock(&pending_query->ctx->lock);
 }
 
+static int resolve_name(struct dns_resolve_context *ctx,
+			const char *query,
+			enum dns_query_type type,
+			uint16_t *dns_id,
+			dns_resolve_cb_t cb,
+			void *user_data,
+			int32_t timeout,
+			bool use_cache);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+/* Name being refreshed in the background, one at a time */
+static char prefetch_query[CONFIG_DNS_RESOLVER_CACHE_NAME_LEN];
+static atomic_t prefetch_busy;
+
+static void prefetch_cb(enum dns_resolve_status status,
+			struct dns_addrinfo *info,
+			void *user_data)
+{
+	ARG_UNUSED(info);
+	ARG_UNUSED(user_data);
+
+	/* The answers were added to the cache when they were received */
+	if (status != DNS_EAI_INPROGRESS) {
+		atomic_clear(&prefetch_busy);
+	}
+}
+
+static void prefetch(struct dns_resolve_context *ctx, const char *query,
+		     enum dns_query_type type)
+{
+	if (!atomic_cas(&prefetch_busy, 0, 1)) {
+		return;
+	}
+
+	NET_DBG("Refreshing %s type %d", query, type);
+
+	strcpy(prefetch_query, query);
+
+	if (resolve_name(ctx, prefetch_query, type, NULL, prefetch_cb, NULL,
+			 DNS_PREFETCH_TIMEOUT_MS, false) < 0) {
+		atomic_clear(&prefetch_busy);
+	}
+}
+
+/* Answer a query from the cache, returns false if the name is not cached */
+static bool resolve_from_cache(struct dns_resolve_context *ctx,
+			       const char *query,
+			       enum dns_query_type type,
+			       dns_resolve_cb_t cb,
+			       void *user_data)
+{
+	struct dns_addrinfo info[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES];
+	bool refresh = false;
+	int count;
+	int i;
+
+	count = dns_cache_find(query, type, info, ARRAY_SIZE(info),
+			       IS_ENABLED(CONFIG_DNS_RESOLVER_CACHE_PREFETCH) &&
+			       !atomic_get(&prefetch_busy) ? &refresh : NULL);
+	if (count == 0) {
+		return false;
+	}
+
+	if (count < 0) {
+		cb(DNS_EAI_NODATA, NULL, user_data);
+		return true;
+	}
+
+	for (i = 0; i < count; i++) {
+		cb(DNS_EAI_INPROGRESS, &info[i], user_data);
+	}
+
+	cb(DNS_EAI_ALLDONE, NULL, user_data);
+
+	if (refresh) {
+		prefetch(ctx, query, type);
+	}
+
+	return true;
+}
+
+/* Find a query of the same name that is being sent to the servers.
+ *
+ * Must be invoked with context lock held.
+ */
+static struct dns_pending_query *get_leader(struct dns_resolve_context *ctx,
+					    int idx)
+{
+	struct dns_pending_query *query = &ctx->queries[idx];
+	int i;
+
+	for (i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		struct dns_pending_query *leader = &ctx->queries[i];
+
+		if (i == idx || !check_query_active(leader, false) ||
+		    leader->query == NULL || leader->leader != NULL) {
+			continue;
+		}
+
+		if (leader->query_type == query->query_type &&
+		    strcasecmp(leader->query, query->query) == 0) {
+			return leader;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 int dns_resolve_name(struct dns_resolve_context *ctx,
 		     const char *query,
 		     enum dns_query_type type,
@@ -1112,6 +1278,19 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 		     dns_resolve_cb_t cb,
 		     void *user_data,
 		     int32_t timeout)
+{
+	return resolve_name(ctx, query, type, dns_id, cb, user_data, timeout,
+			    true);
+}
+
+static int resolve_name(struct dns_resolve_context *ctx,
+			const char *query,
+			enum dns_query_type type,
+			uint16_t *dns_id,
+			dns_resolve_cb_t cb,
+			void *user_data,
+			int32_t timeout,
+			bool use_cache)
 {
 	k_timeout_t tout;
 	struct net_buf *dns_data = NULL;
@@ -1182,6 +1361,12 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	}
 
 try_resolve:
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	if (use_cache && resolve_from_cache(ctx, query, type, cb, user_data)) {
+		return 0;
+	}
+#endif
+
 	k_mutex_lock(&ctx->lock, K_FOREVER);
 
 	if (ctx->state != DNS_RESOLVE_CONTEXT_ACTIVE) {
@@ -1205,6 +1390,30 @@ try_resolve:
 
 	k_work_init_delayable(&ctx->queries[i].timer, query_timeout);
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	/* Wait for the answer of a query of the same name instead of sending
+	 * another one. The slot keeps its own id and timeout, so that it can
+	 * be cancelled separately.
+	 */
+	ctx->queries[i].leader = get_leader(ctx, i);
+	if (ctx->queries[i].leader != NULL) {
+		ctx->queries[i].id = sys_rand32_get();
+
+		if (dns_id) {
+			*dns_id = ctx->queries[i].id;
+		}
+
+		NET_DBG("[%u] sharing the query of %s", i, query);
+
+		ret = k_work_reschedule(&ctx->queries[i].timer, tout);
+		if (ret >= 0) {
+			ret = 0;
+		}
+
+		goto quit;
+	}
+#endif
+
 	dns_data = net_buf_alloc(&dns_msg_pool, ctx->buf_timeout);
 	if (!dns_data) {
 		ret = -ENOMEM;
@@ -1471,6 +1680,11 @@ int dns_resolve_reconfigure(struct dns_resolve_context *ctx,
 		}
 	}
 
+	/* The answers of the previous servers might not be valid anymore */
+	if (IS_ENABLED(CONFIG_DNS_RESOLVER_CACHE)) {
+		dns_resolve_cache_flush();
+	}
+
 	err = dns_resolve_init_locked(ctx, servers, servers_sa);
 
 unlock:
@@ -0,0 +1,980 @@
+/** @file
+ * @brief HTTP/1.1 server
+ *
+ * A pool of worker threads serves the clients of the services defined with
+ * HTTP_SERVICE_DEFINE(). The workers take turns waiting for new
+ * connections, then each one serves its client until the connection is
+ * closed.
+ */
+
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http/parser.h>
+#include <zephyr/net/http/server.h>
+
+#if defined(CONFIG_FILE_SYSTEM)
+#include <zephyr/fs/fs.h>
+#endif
+
+#if defined(CONFIG_HTTP_SERVER_WEBSOCKET)
+#include <zephyr/net/websocket.h>
+#include <zephyr/sys/base64.h>
+#include <mbedtls/sha1.h>
+
+#define WS_MAGIC "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define WS_KEY_HEADER "Sec-WebSocket-Key"
+#define WS_KEY_LEN 24
+#define WS_SHA1_OUTPUT_LEN 20
+#endif
+
+struct http_server_listener {
+	const struct http_service_desc *service;
+	atomic_t clients;
+};
+
+struct http_client_ctx {
+	int fd;
+	struct http_server_listener *listener;
+	struct http_parser parser;
+	const struct http_resource_detail *resource;
+
+	/** Status of the error response, 0 if the request is valid */
+	enum http_status error;
+
+	/** Number of requests received on the connection */
+	int requests;
+
+	/** Bytes of headers received in the current request */
+	size_t header_len;
+	size_t url_len;
+
+	bool in_message : 1;
+	bool keep_alive : 1;
+	bool close : 1;
+	bool upgrade : 1;
+	bool response_started : 1;
+	bool response_ended : 1;
+	bool chunked : 1;
+	bool head : 1;
+
+#if defined(CONFIG_HTTP_SERVER_WEBSOCKET)
+	bool in_header_value : 1;
+	bool ws_key_field : 1;
+	size_t field_len;
+	size_t ws_key_len;
+	char field[sizeof(WS_KEY_HEADER)];
+	char ws_key[WS_KEY_LEN + 1];
+#endif
+
+	char url[CONFIG_HTTP_SERVER_MAX_URL_LENGTH + 1];
+	uint8_t rx_buf[CONFIG_HTTP_SERVER_CLIENT_BUFFER_SIZE];
+	uint8_t tx_buf[CONFIG_HTTP_SERVER_CLIENT_BUFFER_SIZE];
+};
+
+static struct http_server_listener listeners[CONFIG_HTTP_SERVER_MAX_SERVICES];
+static struct zsock_pollfd listen_fds[CONFIG_HTTP_SERVER_MAX_SERVICES];
+static int listeners_count;
+
+static struct http_client_ctx clients[CONFIG_HTTP_SERVER_NUM_WORKERS];
+static struct k_thread workers[CONFIG_HTTP_SERVER_NUM_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks,
+				   CONFIG_HTTP_SERVER_NUM_WORKERS,
+				   CONFIG_HTTP_SERVER_STACK_SIZE);
+
+/* The worker holding the lock waits for the next connection */
+static K_MUTEX_DEFINE(accept_lock);
+static bool server_started;
+
+static const char *status_reason(enum http_status status)
+{
+	switch (status) {
+	case HTTP_101_SWITCHING_PROTOCOLS:
+		return "Switching Protocols";
+	case HTTP_200_OK:
+		return "OK";
+	case HTTP_204_NO_CONTENT:
+		return "No Content";
+	case HTTP_400_BAD_REQUEST:
+		return "Bad Request";
+	case HTTP_404_NOT_FOUND:
+		return "Not Found";
+	case HTTP_405_METHOD_NOT_ALLOWED:
+		return "Method Not Allowed";
+	case HTTP_408_REQUEST_TIMEOUT:
+		return "Request Timeout";
+	case HTTP_414_URI_TOO_LONG:
+		return "URI Too Long";
+	case HTTP_431_REQUEST_HEADER_FIELDS_TOO_LARGE:
+		return "Request Header Fields Too Large";
+	case HTTP_500_INTERNAL_SERVER_ERROR:
+		return "Internal Server Error";
+	case HTTP_503_SERVICE_UNAVAILABLE:
+		return "Service Unavailable";
+	default:
+		break;
+	}
+
+	/* The reason phrase may be empty */
+	return "";
+}
+
+static int sendall(int sock, const void *buf, size_t len)
+{
+	while (len > 0) {
+		ssize_t out_len = zsock_send(sock, buf, len, 0);
+
+		if (out_len < 0) {
+			return -errno;
+		}
+
+		buf = (const uint8_t *)buf + out_len;
+		len -= out_len;
+	}
+
+	return 0;
+}
+
+static int sendmsg_all(int sock, struct iovec *iov, int iovcnt)
+{
+	struct msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = iovcnt,
+	};
+	ssize_t out_len;
+
+	out_len = zsock_sendmsg(sock, &msg, 0);
+	if (out_len < 0) {
+		return -errno;
+	}
+
+	/* Send what the socket did not take at once */
+	for (int i = 0; i < iovcnt; i++) {
+		if (out_len >= iov[i].iov_len) {
+			out_len -= iov[i].iov_len;
+			continue;
+		}
+
+		if (sendall(sock, (uint8_t *)iov[i].iov_base + out_len,
+			    iov[i].iov_len - out_len) < 0) {
+			return -errno;
+		}
+
+		out_len = 0;
+	}
+
+	return 0;
+}
+
+static int head_append(struct http_client_ctx *client, int len,
+		       const char *fmt, ...)
+{
+	va_list args;
+	int ret;
+
+	if (len < 0 || len >= sizeof(client->tx_buf)) {
+		return -ENOMEM;
+	}
+
+	va_start(args, fmt);
+	ret = vsnprintk((char *)&client->tx_buf[len], sizeof(client->tx_buf) - len,
+			fmt, args);
+	va_end(args);
+
+	return ret < 0 ? ret : len + ret;
+}
+
+/* Sends the status line and headers of a response. A negative content
+ * length means that the length of the body is not known.
+ */
+static int send_head(struct http_client_ctx *client, enum http_status status,
+		     const struct http_resource_detail *detail,
+		     ssize_t content_len)
+{
+	int len;
+
+	len = head_append(client, 0, "HTTP/1.1 %d %s\r\n", status,
+			  status_reason(status));
+
+	if (detail != NULL && detail->content_type != NULL) {
+		len = head_append(client, len, "Content-Type: %s\r\n",
+				  detail->content_type);
+	}
+
+	if (detail != NULL && detail->content_encoding != NULL) {
+		len = head_append(client, len, "Content-Encoding: %s\r\n",
+				  detail->content_encoding);
+	}
+
+	if (content_len >= 0) {
+		len = head_append(client, len, "Content-Length: %zd\r\n",
+				  content_len);
+	} else if (client->chunked) {
+		len = head_append(client, len,
+				  "Transfer-Encoding: chunked\r\n");
+	} else {
+		/* The end of the body is marked by closing the connection */
+		client->keep_alive = false;
+	}
+
+	if (!client->keep_alive) {
+		len = head_append(client, len, "Connection: close\r\n");
+	} else if (client->parser.http_minor == 0) {
+		len = head_append(client, len, "Connection: keep-alive\r\n");
+	}
+
+	len = head_append(client, len, "\r\n");
+	if (len < 0 || len >= sizeof(client->tx_buf)) {
+		NET_ERR("[%d] Response headers do not fit", client->fd);
+		return -ENOMEM;
+	}
+
+	client->response_started = true;
+
+	return sendall(client->fd, client->tx_buf, len);
+}
+
+static int send_error(struct http_client_ctx *client, enum http_status status)
+{
+	NET_DBG("[%d] Error %d", client->fd, status);
+
+	/* Close the connection after the error responses which come before
+	 * the end of the request.
+	 */
+	if (client->in_message) {
+		client->keep_alive = false;
+	}
+
+	client->response_ended = true;
+
+	return send_head(client, status, NULL, 0);
+}
+
+enum http_method http_server_request_method(struct http_client_ctx *client)
+{
+	return client->parser.method;
+}
+
+const char *http_server_request_url(struct http_client_ctx *client)
+{
+	return client->url;
+}
+
+int http_server_response_begin(struct http_client_ctx *client,
+			       enum http_status status)
+{
+	if (client->response_started) {
+		return -EALREADY;
+	}
+
+	/* Chunked encoding is not understood by HTTP/1.0 clients */
+	client->chunked = client->parser.http_major > 1 ||
+			  client->parser.http_minor > 0;
+
+	return send_head(client, status, client->resource, -1);
+}
+
+int http_server_response_write(struct http_client_ctx *client,
+			       const void *data, size_t len)
+{
+	struct iovec iov[3];
+	char size[sizeof("ffffffff\r\n")];
+
+	if (!client->response_started || client->response_ended) {
+		return -EINVAL;
+	}
+
+	if (client->head || len == 0) {
+		return 0;
+	}
+
+	if (!client->chunked) {
+		return sendall(client->fd, data, len);
+	}
+
+	iov[0].iov_base = size;
+	iov[0].iov_len = snprintk(size, sizeof(size), "%x\r\n",
+				  (unsigned int)len);
+	iov[1].iov_base = (void *)data;
+	iov[1].iov_len = len;
+	iov[2].iov_base = "\r\n";
+	iov[2].iov_len = 2;
+
+	return sendmsg_all(client->fd, iov, ARRAY_SIZE(iov));
+}
+
+int http_server_response_end(struct http_client_ctx *client)
+{
+	static const char last_chunk[] = "0\r\n\r\n";
+
+	if (!client->response_started || client->response_ended) {
+		return -EINVAL;
+	}
+
+	client->response_ended = true;
+
+	if (client->head || !client->chunked) {
+		return 0;
+	}
+
+	return sendall(client->fd, last_chunk, sizeof(last_chunk) - 1);
+}
+
+static const struct http_resource_detail *
+find_resource(const struct http_service_desc *service, const char *url)
+{
+	size_t path_len = strcspn(url, "?#");
+
+	HTTP_SERVICE_FOREACH_RESOURCE(service, res) {
+		if (strlen(res->resource) == path_len &&
+		    strncmp(res->resource, url, path_len) == 0) {
+			return res->detail;
+		}
+	}
+
+	return NULL;
+}
+
+static int serve_static(struct http_client_ctx *client)
+{
+	const struct http_resource_detail_static *detail =
+		(const struct http_resource_detail_static *)client->resource;
+	int ret;
+
+	ret = send_head(client, HTTP_200_OK, &detail->common,
+			detail->static_data_len);
+	if (ret < 0 || client->head) {
+		return ret;
+	}
+
+	return sendall(client->fd, detail->static_data,
+		       detail->static_data_len);
+}
+
+static int serve_dynamic(struct http_client_ctx *client, const uint8_t *data,
+			 size_t len, bool final)
+{
+	const struct http_resource_detail_dynamic *detail =
+		(const struct http_resource_detail_dynamic *)client->resource;
+	int ret;
+
+	ret = detail->cb(client, data, len, final, detail->user_data);
+	if (ret < 0) {
+		NET_DBG("[%d] Handler failed (%d)", client->fd, ret);
+
+		if (client->response_started) {
+			/* Too late for an error response */
+			client->keep_alive = false;
+			client->response_ended = true;
+			return ret;
+		}
+
+		client->error = HTTP_500_INTERNAL_SERVER_ERROR;
+		return 0;
+	}
+
+	if (!final) {
+		return 0;
+	}
+
+	if (!client->response_started) {
+		return send_error(client, HTTP_204_NO_CONTENT);
+	}
+
+	if (!client->response_ended) {
+		return http_server_response_end(client);
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_FILE_SYSTEM)
+/* The file is read in blocks in the transmit buffer, which keeps the memory
+ * used by a client bounded whatever the file size.
+ */
+static int serve_file(struct http_client_ctx *client)
+{
+	const struct http_resource_detail_file *detail =
+		(const struct http_resource_detail_file *)client->resource;
+	struct fs_dirent entry;
+	struct fs_file_t file;
+	ssize_t len;
+	size_t sent = 0;
+	int ret;
+
+	if (fs_stat(detail->path, &entry) < 0 || entry.type != FS_DIR_ENTRY_FILE) {
+		return send_error(client, HTTP_404_NOT_FOUND);
+	}
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, detail->path, FS_O_READ);
+	if (ret < 0) {
+		NET_ERR("[%d] Cannot open %s (%d)", client->fd, detail->path,
+			ret);
+		return send_error(client, HTTP_500_INTERNAL_SERVER_ERROR);
+	}
+
+	ret = send_head(client, HTTP_200_OK, &detail->common, entry.size);
+
+	while (ret == 0 && !client->head && sent < entry.size) {
+		len = fs_read(&file, client->tx_buf, sizeof(client->tx_buf));
+		if (len <= 0) {
+			/* The announced length cannot be honoured anymore */
+			NET_ERR("[%d] Cannot read %s (%zd)", client->fd,
+				detail->path, len);
+			ret = len < 0 ? len : -EIO;
+			break;
+		}
+
+		ret = sendall(client->fd, client->tx_buf, len);
+		sent += len;
+	}
+
+	fs_close(&file);
+
+	return ret;
+}
+#else
+static int serve_file(struct http_client_ctx *client)
+{
+	return send_error(client, HTTP_404_NOT_FOUND);
+}
+#endif /* CONFIG_FILE_SYSTEM */
+
+static int on_message_begin(struct http_parser *parser)
+{
+	struct http_client_ctx *client = parser->data;
+
+	client->in_message = true;
+	client->resource = NULL;
+	client->error = 0;
+	client->header_len = 0;
+	client->url_len = 0;
+	client->url[0] = '\0';
+	client->response_started = false;
+	client->response_ended = false;
+	client->chunked = false;
+
+#if defined(CONFIG_HTTP_SERVER_WEBSOCKET)
+	client->in_header_value = false;
+	client->ws_key_field = false;
+	client->field_len = 0;
+	client->ws_key_len = 0;
+	client->ws_key[0] = '\0';
+#endif
+
+	return 0;
+}
+
+static int on_url(struct http_parser *parser, const char *at, size_t length)
+{
+	struct http_client_ctx *client = parser->data;
+
+	if (client->url_len + length > CONFIG_HTTP_SERVER_MAX_URL_LENGTH) {
+		client->error = HTTP_414_URI_TOO_LONG;
+		return -1;
+	}
+
+	memcpy(&client->url[client->url_len], at, length);
+	client->url_len += length;
+	client->url[client->url_len] = '\0';
+
+	return 0;
+}
+
+static int count_header(struct http_client_ctx *client, size_t length)
+{
+	client->header_len += length;
+	if (client->header_len > CONFIG_HTTP_SERVER_MAX_HEADER_SIZE) {
+		client->error = HTTP_431_REQUEST_HEADER_FIELDS_TOO_LARGE;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int on_header_field(struct http_parser *parser, const char *at,
+			   size_t length)
+{
+	struct http_client_ctx *client = parser->data;
+
+#if defined(CONFIG_HTTP_SERVER_WEBSOCKET)
+	/* The name of a header may come in several parts */
+	if (client->in_header_value) {
+		client->in_header_value = false;
+		client->field_len = 0;
+	}
+
+	if (client->field_len + length < sizeof(client->field)) {
+		memcpy(&client->field[client->field_len], at, length);
+	}
+
+	client->field_len += length;
+#endif
+
+	return count_header(client, length);
+}
+
+static int on_header_value(struct http_parser *parser, const char *at,
+			   size_t length)
+{
+	struct http_client_ctx *client = parser->data;
+
+#if defined(CONFIG_HTTP_SERVER_WEBSOCKET)
+	if (!client->in_header_value) {
+		client->in_header_value = true;
+		client->ws_key_field =
+			client->field_len == sizeof(WS_KEY_HEADER) - 1 &&
+			strncasecmp(client->field, WS_KEY_HEADER,
+				    client->field_len) == 0;
+	}
+
+	if (client->ws_key_field &&
+	    client->ws_key_len + length < sizeof(client->ws_key)) {
+		memcpy(&client->ws_key[client->ws_key_len], at, length);
+		client->ws_key_len += length;
+		client->ws_key[client->ws_key_len] = '\0';
+	}
+#endif
+
+	return count_header(client, length);
+}
+
+static int on_headers_complete(struct http_parser *parser)
+{
+	struct http_client_ctx *client = parser->data;
+
+	client->head = parser->method == HTTP_HEAD;
+
+	client->resource = find_resource(client->listener->service,
+					 client->url);
+	if (client->resource == NULL) {
+		client->error = HTTP_404_NOT_FOUND;
+	} else if (parser->method >= 32 ||
+		   !(client->resource->bitmask_of_supported_http_methods &
+		     BIT(parser->method))) {
+		client->error = HTTP_405_METHOD_NOT_ALLOWED;
+	}
+
+	return 0;
+}
+
+static int on_body(struct http_parser *parser, const char *at, size_t length)
+{
+	struct http_client_ctx *client = parser->data;
+
+	/* Only the dynamic resources care about the request body, which is
+	 * passed on as it is received.
+	 */
+	if (client->error != 0 || client->resource->type != HTTP_RESOURCE_TYPE_DYNAMIC) {
+		return 0;
+	}
+
+	if (serve_dynamic(client, (const uint8_t *)at, length, false) < 0) {
+		client->close = true;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int serve_request(struct http_client_ctx *client)
+{
+	if (client->error != 0) {
+		return send_error(client, client->error);
+	}
+
+	switch (client->resource->type) {
+	case HTTP_RESOURCE_TYPE_STATIC:
+		return serve_static(client);
+	case HTTP_RESOURCE_TYPE_DYNAMIC:
+		return serve_dynamic(client, NULL, 0, true);
+	case HTTP_RESOURCE_TYPE_FILE:
+		return serve_file(client);
+	default:
+		/* Websockets need an upgrade request */
+		return send_error(client, HTTP_400_BAD_REQUEST);
+	}
+}
+
+static int on_message_complete(struct http_parser *parser)
+{
+	struct http_client_ctx *client = parser->data;
+	int ret;
+
+	client->requests++;
+
+	client->keep_alive = http_should_keep_alive(parser) &&
+		(CONFIG_HTTP_SERVER_MAX_REQUESTS_PER_CONN == 0 ||
+		 client->requests < CONFIG_HTTP_SERVER_MAX_REQUESTS_PER_CONN);
+
+	/* The parser stops after an upgrade request, which is handled once
+	 * it returns.
+	 */
+	if (parser->upgrade) {
+		client->upgrade = true;
+		return 0;
+	}
+
+	client->in_message = false;
+
+	/* The responses are sent in the order of the requests, so the
+	 * pipelined requests which follow in the buffer wait for this one.
+	 */
+	ret = serve_request(client);
+	if (ret < 0 || !client->keep_alive) {
+		client->close = true;
+		http_parser_pause(parser, 1);
+	}
+
+	return 0;
+}
+
+static const struct http_parser_settings parser_settings = {
+	.on_message_begin = on_message_begin,
+	.on_url = on_url,
+	.on_header_field = on_header_field,
+	.on_header_value = on_header_value,
+	.on_headers_complete = on_headers_complete,
+	.on_body = on_body,
+	.on_message_complete = on_message_complete,
+};
+
+#if defined(CONFIG_HTTP_SERVER_WEBSOCKET)
+static int upgrade_websocket(struct http_client_ctx *client)
+{
+	const struct http_resource_detail_websocket *detail =
+		(const struct http_resource_detail_websocket *)client->resource;
+	uint8_t sha1[WS_SHA1_OUTPUT_LEN];
+	char accept[WS_KEY_LEN + 8 + 1];
+	size_t olen;
+	int len, ws_sock, ret;
+
+	if (client->ws_key_len == 0) {
+		return send_error(client, HTTP_400_BAD_REQUEST);
+	}
+
+	len = snprintk((char *)client->tx_buf, sizeof(client->tx_buf), "%s%s",
+		       client->ws_key, WS_MAGIC);
+	mbedtls_sha1(client->tx_buf, len, sha1);
+
+	ret = base64_encode(accept, sizeof(accept), &olen, sha1, sizeof(sha1));
+	if (ret < 0) {
+		return send_error(client, HTTP_500_INTERNAL_SERVER_ERROR);
+	}
+
+	len = snprintk((char *)client->tx_buf, sizeof(client->tx_buf),
+		       "HTTP/1.1 101 %s\r\n"
+		       "Upgrade: websocket\r\n"
+		       "Connection: Upgrade\r\n"
+		       "Sec-WebSocket-Accept: %s\r\n\r\n",
+		       status_reason(HTTP_101_SWITCHING_PROTOCOLS), accept);
+
+	ret = sendall(client->fd, client->tx_buf, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The client does not send frames before the handshake response, so
+	 * the receive buffer is free for the Websocket.
+	 */
+	ws_sock = websocket_register(client->fd, client->rx_buf,
+				     sizeof(client->rx_buf));
+	if (ws_sock < 0) {
+		NET_ERR("[%d] Cannot register Websocket (%d)", client->fd,
+			ws_sock);
+		return ws_sock;
+	}
+
+	NET_DBG("[%d] Upgraded to Websocket %d", client->fd, ws_sock);
+
+	detail->cb(ws_sock, detail->user_data);
+
+	return 0;
+}
+#else
+static int upgrade_websocket(struct http_client_ctx *client)
+{
+	return send_error(client, HTTP_400_BAD_REQUEST);
+}
+#endif /* CONFIG_HTTP_SERVER_WEBSOCKET */
+
+static void handle_upgrade(struct http_client_ctx *client)
+{
+	client->keep_alive = false;
+
+	if (client->error != 0) {
+		(void)send_error(client, client->error);
+	} else if (client->resource->type == HTTP_RESOURCE_TYPE_WEBSOCKET) {
+		(void)upgrade_websocket(client);
+	} else {
+		/* Other protocols are not supported, the request is
+		 * served as is.
+		 */
+		client->in_message = false;
+		(void)serve_request(client);
+	}
+}
+
+static void serve_client(struct http_client_ctx *client)
+{
+	struct timeval timeo = {
+		.tv_sec = CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT /
+			  MSEC_PER_SEC,
+		.tv_usec = (CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT %
+			    MSEC_PER_SEC) * USEC_PER_MSEC,
+	};
+	ssize_t received;
+	size_t parsed;
+
+	(void)zsock_setsockopt(client->fd, SOL_SOCKET, SO_RCVTIMEO, &timeo,
+			       sizeof(timeo));
+	(void)zsock_setsockopt(client->fd, SOL_SOCKET, SO_SNDTIMEO, &timeo,
+			       sizeof(timeo));
+
+	http_parser_init(&client->parser, HTTP_REQUEST);
+	client->parser.data = client;
+	client->requests = 0;
+	client->in_message = false;
+	client->close = false;
+	client->upgrade = false;
+	client->keep_alive = true;
+
+	while (!client->close) {
+		received = zsock_recv(client->fd, client->rx_buf,
+				      sizeof(client->rx_buf), 0);
+		if (received == 0) {
+			NET_DBG("[%d] Connection closed by peer", client->fd);
+			break;
+		}
+
+		if (received < 0) {
+			if (errno == EAGAIN && client->in_message) {
+				(void)send_error(client,
+						 HTTP_408_REQUEST_TIMEOUT);
+			}
+
+			NET_DBG("[%d] Connection closed (%d)", client->fd,
+				errno);
+			break;
+		}
+
+		parsed = http_parser_execute(&client->parser, &parser_settings,
+					     (const char *)client->rx_buf,
+					     received);
+
+		if (client->upgrade) {
+			handle_upgrade(client);
+			break;
+		}
+
+		if (client->close) {
+			break;
+		}
+
+		if (parsed != received ||
+		    HTTP_PARSER_ERRNO(&client->parser) != HPE_OK) {
+			NET_DBG("[%d] Invalid request (%s)", client->fd,
+				http_errno_name(HTTP_PARSER_ERRNO(&client->parser)));
+			(void)send_error(client, client->error != 0 ?
+					 client->error : HTTP_400_BAD_REQUEST);
+			break;
+		}
+	}
+}
+
+/* Returns the socket of the next client, and its listener in @p out. The
+ * clients above the limit of their service are turned away.
+ */
+static int accept_client(struct http_server_listener **out)
+{
+	int ret, sock, i;
+
+	while (true) {
+		ret = zsock_poll(listen_fds, listeners_count, -1);
+		if (ret < 0) {
+			NET_ERR("poll error (%d)", errno);
+			return -errno;
+		}
+
+		for (i = 0; i < listeners_count; i++) {
+			struct http_server_listener *listener = &listeners[i];
+
+			if (!(listen_fds[i].revents & ZSOCK_POLLIN)) {
+				continue;
+			}
+
+			sock = zsock_accept(listen_fds[i].fd, NULL, NULL);
+			if (sock < 0) {
+				NET_DBG("accept error (%d)", errno);
+				continue;
+			}
+
+			if (listener->service->concurrent > 0 &&
+			    atomic_get(&listener->clients) >=
+			    listener->service->concurrent) {
+				static const char busy[] =
+					"HTTP/1.1 503 Service Unavailable\r\n"
+					"Content-Length: 0\r\n"
+					"Connection: close\r\n\r\n";
+
+				(void)sendall(sock, busy, sizeof(busy) - 1);
+				(void)zsock_close(sock);
+				continue;
+			}
+
+			atomic_inc(&listener->clients);
+			*out = listener;
+
+			return sock;
+		}
+	}
+}
+
+static void worker_thread(void *p1, void *p2, void *p3)
+{
+	struct http_client_ctx *client = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_mutex_lock(&accept_lock, K_FOREVER);
+		client->fd = accept_client(&client->listener);
+		k_mutex_unlock(&accept_lock);
+
+		if (client->fd < 0) {
+			k_msleep(MSEC_PER_SEC);
+			continue;
+		}
+
+		NET_DBG("[%d] New client", client->fd);
+
+		serve_client(client);
+
+		(void)zsock_close(client->fd);
+		atomic_dec(&client->listener->clients);
+	}
+}
+
+static int service_listen(const struct http_service_desc *service)
+{
+	struct sockaddr addr;
+	socklen_t addr_len;
+	int sock, ret;
+	int optval = 1;
+
+	memset(&addr, 0, sizeof(addr));
+
+	if (zsock_inet_pton(AF_INET6, service->host,
+			    &net_sin6(&addr)->sin6_addr) == 1) {
+		addr.sa_family = AF_INET6;
+		net_sin6(&addr)->sin6_port = htons(*service->port);
+		addr_len = sizeof(struct sockaddr_in6);
+	} else if (zsock_inet_pton(AF_INET, service->host,
+				   &net_sin(&addr)->sin_addr) == 1) {
+		addr.sa_family = AF_INET;
+		net_sin(&addr)->sin_port = htons(*service->port);
+		addr_len = sizeof(struct sockaddr_in);
+	} else {
+		NET_ERR("Invalid address %s", service->host);
+		return -EINVAL;
+	}
+
+	sock = zsock_socket(addr.sa_family, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0) {
+		NET_ERR("socket error (%d)", errno);
+		return -errno;
+	}
+
+	(void)zsock_setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &optval,
+			       sizeof(optval));
+
+	if (zsock_bind(sock, &addr, addr_len) < 0) {
+		NET_ERR("bind error (%d)", errno);
+		goto fail;
+	}
+
+	if (zsock_listen(sock, service->backlog) < 0) {
+		NET_ERR("listen error (%d)", errno);
+		goto fail;
+	}
+
+	/* Report the ephemeral port */
+	if (*service->port == 0 &&
+	    zsock_getsockname(sock, &addr, &addr_len) == 0) {
+		*service->port = ntohs(addr.sa_family == AF_INET6 ?
+				       net_sin6(&addr)->sin6_port :
+				       net_sin(&addr)->sin_port);
+	}
+
+	NET_DBG("Listening on %s port %d", service->host, *service->port);
+
+	return sock;
+
+fail:
+	ret = -errno;
+	(void)zsock_close(sock);
+
+	return ret;
+}
+
+int http_server_start(void)
+{
+	int i, sock;
+
+	if (server_started) {
+		return -EALREADY;
+	}
+
+	HTTP_SERVICE_FOREACH(service) {
+		if (listeners_count == ARRAY_SIZE(listeners)) {
+			NET_ERR("Too many services, see "
+				"CONFIG_HTTP_SERVER_MAX_SERVICES");
+			break;
+		}
+
+		sock = service_listen(service);
+		if (sock < 0) {
+			continue;
+		}
+
+		listeners[listeners_count].service = service;
+		atomic_clear(&listeners[listeners_count].clients);
+		listen_fds[listeners_count].fd = sock;
+		listen_fds[listeners_count].events = ZSOCK_POLLIN;
+		listeners_count++;
+	}
+
+	if (listeners_count == 0) {
+		return -ENOENT;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(workers); i++) {
+		k_thread_create(&workers[i], worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+				worker_thread, &clients[i], NULL, NULL,
+				K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+		k_thread_name_set(&workers[i], "http_server");
+	}
+
+	server_started = true;
+
+	return 0;
+}
@@ -982,6 +982,18 @@ int lwm2m_set_default_sockopt(struct lwm2m_ctx *ctx)
 			}
 		}
 
+		if (IS_ENABLED(CONFIG_LWM2M_DTLS_CID)) {
+			int cid = TLS_DTLS_CID_SUPPORTED;
+
+			ret = zsock_setsockopt(ctx->sock_fd, SOL_TLS, TLS_DTLS_CID, &cid,
+					       sizeof(cid));
+			if (ret < 0) {
+				ret = -errno;
+				LOG_ERR("Failed to set TLS_DTLS_CID option: %d", ret);
+				return ret;
+			}
+		}
+
 		if (ctx->hostname_verify && (ctx->desthostname != NULL)) {
 			/** store character at len position */
 			tmp = ctx->desthostname[ctx->desthostnamelen];
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define LOG_MODULE_NAME net_lwm2m_perf_stats
+#define LOG_LEVEL CONFIG_LWM2M_LOG_LEVEL
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(LOG_MODULE_NAME);
+
+#include <errno.h>
+#include <zephyr/net/lwm2m.h>
+#include <zephyr/stats/perf_stats.h>
+
+#include "lwm2m_object.h"
+#include "lwm2m_obj_binaryappdata.h"
+
+static uint8_t perf_stats_buf[CONFIG_LWM2M_PERF_STATS_BUFFER_SIZE];
+
+static void *perf_stats_read_cb(uint16_t obj_inst_id, uint16_t res_id,
+				uint16_t res_inst_id, size_t *data_len)
+{
+	/* Encoded on each read, for the server to get the latest counts */
+	if (perf_stats_encode_all(perf_stats_buf, sizeof(perf_stats_buf), data_len) < 0) {
+		LOG_ERR("Performance histograms do not fit in %zu bytes",
+			sizeof(perf_stats_buf));
+		*data_len = 0;
+	}
+
+	return perf_stats_buf;
+}
+
+int lwm2m_perf_stats_register(uint16_t obj_inst_id)
+{
+	int ret;
+
+	ret = lwm2m_create_object_inst(&LWM2M_OBJ(LWM2M_OBJECT_BINARYAPPDATACONTAINER_ID,
+						  obj_inst_id));
+	if (ret < 0 && ret != -EEXIST) {
+		return ret;
+	}
+
+	ret = lwm2m_create_res_inst(&LWM2M_OBJ(LWM2M_OBJECT_BINARYAPPDATACONTAINER_ID,
+					       obj_inst_id, LWM2M_BINARYAPPDATA_DATA_ID, 0));
+	if (ret < 0) {
+		return ret;
+	}
+
+	return lwm2m_register_read_callback(&LWM2M_OBJ(LWM2M_OBJECT_BINARYAPPDATACONTAINER_ID,
+						       obj_inst_id, LWM2M_BINARYAPPDATA_DATA_ID),
+					    perf_stats_read_cb);
+}
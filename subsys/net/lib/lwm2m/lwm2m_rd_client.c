@@ -565,11 +565,33 @@ static int do_update_reply_cb(const struct coap_packet *response,
 	return 0;
 }
 
+static bool sm_dtls_cid_in_use(void)
+{
+#if defined(CONFIG_LWM2M_DTLS_CID)
+	int status;
+	socklen_t len = sizeof(status);
+
+	if (!client.ctx->use_dtls ||
+	    zsock_getsockopt(client.ctx->sock_fd, SOL_TLS, TLS_DTLS_CID_STATUS, &status,
+			     &len) < 0) {
+		return false;
+	}
+
+	return status == TLS_DTLS_CID_STATUS_UPLINK ||
+	       status == TLS_DTLS_CID_STATUS_BIDIRECTIONAL;
+#else
+	return false;
+#endif
+}
+
 static void do_update_timeout_cb(struct lwm2m_message *msg)
 {
 	LOG_WRN("Registration Update Timeout");
 
-	if (client.ctx->sock_fd > -1) {
+	/* The server identifies the DTLS session by its Connection ID even if
+	 * our address has changed, so keep the session.
+	 */
+	if (client.ctx->sock_fd > -1 && !sm_dtls_cid_in_use()) {
 		client.close_socket = true;
 	}
 	/* Re-do registration */
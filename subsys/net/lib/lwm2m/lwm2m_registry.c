@@ -54,6 +54,17 @@ void lwm2m_registry_unlock(void)
 static sys_slist_t engine_obj_list;
 static sys_slist_t engine_obj_inst_list;
 
+#if defined(CONFIG_LWM2M_REGISTRY_INDEX)
+static sys_slist_t engine_obj_inst_index[CONFIG_LWM2M_REGISTRY_INDEX_BUCKETS];
+
+static sys_slist_t *engine_obj_inst_bucket(uint16_t obj_id, uint16_t obj_inst_id)
+{
+	uint32_t hash = ((uint32_t)obj_id << 16 | obj_inst_id) * 2654435761U;
+
+	return &engine_obj_inst_index[(hash >> 16) % CONFIG_LWM2M_REGISTRY_INDEX_BUCKETS];
+}
+#endif
+
 /* Resource wrappers */
 sys_slist_t *lwm2m_engine_obj_list(void) { return &engine_obj_list; }
 
@@ -110,6 +121,12 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 	int i;
 
 	if (obj && obj->fields && obj->field_count > 0) {
+		/* Fields are usually declared in resource id order */
+		if (res_id >= 0 && res_id < obj->field_count &&
+		    obj->fields[res_id].res_id == res_id) {
+			return &obj->fields[res_id];
+		}
+
 		for (i = 0; i < obj->field_count; i++) {
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
@@ -141,6 +158,10 @@ static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+#if defined(CONFIG_LWM2M_REGISTRY_INDEX)
+	sys_slist_append(engine_obj_inst_bucket(obj_inst->obj->obj_id, obj_inst->obj_inst_id),
+			 &obj_inst->index_node);
+#endif
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -150,17 +171,35 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+#if defined(CONFIG_LWM2M_REGISTRY_INDEX)
+	sys_slist_find_and_remove(engine_obj_inst_bucket(obj_inst->obj->obj_id,
+							 obj_inst->obj_inst_id),
+				  &obj_inst->index_node);
+#endif
 }
 
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
+#if defined(CONFIG_LWM2M_REGISTRY_INDEX)
+	if (obj_id < 0 || obj_id > UINT16_MAX || obj_inst_id < 0 || obj_inst_id > UINT16_MAX) {
+		return NULL;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(engine_obj_inst_bucket(obj_id, obj_inst_id), obj_inst,
+				     index_node) {
+		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+			return obj_inst;
+		}
+	}
+#else
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
 		}
 	}
+#endif
 
 	return NULL;
 }
@@ -392,10 +431,15 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
+	/* Resources are usually declared in resource id order */
+	if (path->res_id < oi->resource_count &&
+	    oi->resources[path->res_id].res_id == path->res_id) {
+		r = &oi->resources[path->res_id];
+	}
+
+	for (i = 0; !r && i < oi->resource_count; i++) {
 		if (oi->resources[i].res_id == path->res_id) {
 			r = &oi->resources[i];
-			break;
 		}
 	}
 
@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include <inttypes.h>
 #include <ctype.h>
 #include <time.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/kernel.h>
 
@@ -34,6 +35,8 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include "lwm2m_util.h"
 
 #define SENML_MAX_NAME_SIZE sizeof("/65535/65535/")
+/* Largest CBOR header of the record array, array(65535) */
+#define SENML_ARRAY_HDR_MAX_SIZE 3
 
 struct cbor_out_fmt_data {
 	/* Data */
@@ -55,6 +58,14 @@ struct cbor_out_fmt_data {
 		size_t objlnk_sz; /* Object link buff size */
 		uint8_t objlnk_cnt;
 	};
+
+#if defined(CONFIG_LWM2M_RW_SENML_CBOR_STREAM)
+	/* Records already encoded into the output packet */
+	struct {
+		uint16_t array_offset; /* Packet offset of the record array */
+		uint16_t record_cnt;
+	} stream;
+#endif
 };
 
 struct cbor_in_fmt_data {
@@ -185,11 +196,97 @@ static int put_empty_array(struct lwm2m_output_context *out)
 	return len;
 }
 
+#if defined(CONFIG_LWM2M_RW_SENML_CBOR_STREAM)
+/* Encode the completed record straight into the output packet, so the formatter data only
+ * ever holds the record being written. The array header is written by put_end().
+ */
+static int put_record(struct lwm2m_output_context *out)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+	struct coap_packet *cpkt = out->out_cpkt;
+	struct record *record;
+	size_t len;
+	uint_fast8_t ret;
+
+	if (fd->stream.record_cnt == UINT16_MAX) {
+		return -ENOMEM;
+	}
+
+	if (fd->stream.record_cnt == 0) {
+		if (CPKT_BUF_W_SIZE(cpkt) < SENML_ARRAY_HDR_MAX_SIZE) {
+			return -ENOMEM;
+		}
+
+		/* Reserve room for the largest array header */
+		fd->stream.array_offset = cpkt->offset;
+		cpkt->offset += SENML_ARRAY_HDR_MAX_SIZE;
+	}
+
+	record = &fd->input._lwm2m_senml__record[fd->input._lwm2m_senml__record_count - 1];
+
+	ret = cbor_encode_record(CPKT_BUF_W_REGION(cpkt), record, &len);
+	if (ret != ZCBOR_SUCCESS) {
+		LOG_ERR("unable to encode senml cbor record");
+		return -ENOMEM;
+	}
+
+	cpkt->offset += len;
+	fd->stream.record_cnt++;
+
+	/* Names and object links are only referenced by the encoded record */
+	(void)memset(&fd->input, 0, sizeof(fd->input));
+	fd->name_cnt = 0;
+	fd->objlnk_cnt = 0;
+
+	return 0;
+}
+
+static int put_stream_end(struct lwm2m_output_context *out)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+	struct coap_packet *cpkt = out->out_cpkt;
+	uint8_t *array = cpkt->data + fd->stream.array_offset;
+	uint16_t cnt = fd->stream.record_cnt;
+	size_t hdr_len;
+
+	/* Shortest encoding of the array header, as the CBOR encoder does */
+	if (cnt < 24) {
+		array[0] = 0x80 | cnt;
+		hdr_len = 1;
+	} else if (cnt <= UINT8_MAX) {
+		array[0] = 0x98;
+		array[1] = cnt;
+		hdr_len = 2;
+	} else {
+		array[0] = 0x99;
+		sys_put_be16(cnt, &array[1]);
+		hdr_len = 3;
+	}
+
+	memmove(array + hdr_len, array + SENML_ARRAY_HDR_MAX_SIZE,
+		cpkt->offset - fd->stream.array_offset - SENML_ARRAY_HDR_MAX_SIZE);
+	cpkt->offset -= SENML_ARRAY_HDR_MAX_SIZE - hdr_len;
+
+	return cpkt->offset - fd->stream.array_offset;
+}
+#else
+static int put_record(struct lwm2m_output_context *out)
+{
+	return 0;
+}
+#endif /* CONFIG_LWM2M_RW_SENML_CBOR_STREAM */
+
 static int put_end(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
 {
 	size_t len;
 	struct lwm2m_senml *input = &(LWM2M_OFD_CBOR(out)->input);
 
+#if defined(CONFIG_LWM2M_RW_SENML_CBOR_STREAM)
+	if (LWM2M_OFD_CBOR(out)->stream.record_cnt > 0) {
+		return put_stream_end(out);
+	}
+#endif
+
 	if (!input->_lwm2m_senml__record_count) {
 		len = put_empty_array(out);
 
@@ -376,7 +473,7 @@ static int put_value(struct lwm2m_output_context *out, struct lwm2m_obj_path *pa
 	record->_record_union._union_vi = value;
 	record->_record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_s8(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, int8_t value)
@@ -414,7 +511,7 @@ static int put_time(struct lwm2m_output_context *out, struct lwm2m_obj_path *pat
 	record->_record_union._union_vi = (int64_t)value;
 	record->_record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_float(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, double *value)
@@ -432,7 +529,7 @@ static int put_float(struct lwm2m_output_context *out, struct lwm2m_obj_path *pa
 	record->_record_union._union_vf = *value;
 	record->_record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_string(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, char *buf,
@@ -452,7 +549,7 @@ static int put_string(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	record->_record_union._union_vs.len = buflen;
 	record->_record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_bool(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, bool value)
@@ -470,7 +567,7 @@ static int put_bool(struct lwm2m_output_context *out, struct lwm2m_obj_path *pat
 	record->_record_union._union_vb = value;
 	record->_record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_opaque(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, char *buf,
@@ -490,7 +587,7 @@ static int put_opaque(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	record->_record_union._union_vd.len = buflen;
 	record->_record_union_present = 1;
 
-	return 0;
+	return put_record(out);
 }
 
 static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *path,
@@ -529,7 +626,7 @@ static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 
 	fd->objlnk_cnt++;
 
-	return 0;
+	return put_record(out);
 }
 
 static int get_opaque(struct lwm2m_input_context *in,
@@ -260,3 +260,25 @@ int cbor_encode_lwm2m_senml(uint8_t *payload, size_t payload_len, const struct l
 	}
 	return ZCBOR_SUCCESS;
 }
+
+int cbor_encode_record(uint8_t *payload, size_t payload_len, const struct record *input,
+		       size_t *payload_len_out)
+{
+	zcbor_state_t states[4];
+
+	zcbor_new_state(states, sizeof(states) / sizeof(zcbor_state_t), payload, payload_len, 1);
+
+	bool ret = encode_record(states, input);
+
+	if (ret && (payload_len_out != NULL)) {
+		*payload_len_out = MIN(payload_len, (size_t)states[0].payload - (size_t)payload);
+	}
+
+	if (!ret) {
+		int err = zcbor_pop_error(states);
+
+		zcbor_print("Return error: %d\r\n", err);
+		return (err == ZCBOR_SUCCESS) ? ZCBOR_ERR_UNKNOWN : err;
+	}
+	return ZCBOR_SUCCESS;
+}
@@ -236,14 +236,239 @@ static int verify_tx_state(const struct mqtt_client *client)
 	return 0;
 }
 
-int mqtt_publish(struct mqtt_client *client,
-		 const struct mqtt_publish_param *param)
+static int publish_write(struct mqtt_client *client,
+			 const struct mqtt_publish_param *param)
 {
 	int err_code;
 	struct buf_ctx packet;
 	struct iovec io_vector[2];
 	struct msghdr msg;
 
+	tx_buf_init(client, &packet);
+
+	err_code = publish_encode(param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	io_vector[0].iov_base = packet.cur;
+	io_vector[0].iov_len = packet.end - packet.cur;
+	io_vector[1].iov_base = param->message.payload.data;
+	io_vector[1].iov_len = param->message.payload.len;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+
+	return client_write_msg(client, &msg);
+}
+
+#if defined(CONFIG_MQTT_INFLIGHT)
+static struct mqtt_inflight_msg *inflight_find(struct mqtt_client *client,
+					       uint16_t message_id)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight_msg *entry = &client->internal.inflight[i];
+
+		if (entry->state != MQTT_INFLIGHT_FREE &&
+		    entry->param.message_id == message_id) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* Reserve an entry for a QoS 1 or QoS 2 publication, allocating its message
+ * id if none is given. The entry is NULL for QoS 0.
+ */
+static int inflight_add(struct mqtt_client *client,
+			struct mqtt_publish_param *param,
+			struct mqtt_inflight_msg **entry)
+{
+	*entry = NULL;
+
+	if (param->message.topic.qos == MQTT_QOS_0_AT_MOST_ONCE) {
+		return 0;
+	}
+
+	if (param->message_id == 0U) {
+		/* The window is smaller than the id space, so this ends. */
+		do {
+			param->message_id = ++client->internal.last_message_id;
+		} while (param->message_id == 0U ||
+			 inflight_find(client, param->message_id) != NULL);
+	} else if (inflight_find(client, param->message_id) != NULL) {
+		return -EBUSY;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		if (client->internal.inflight[i].state == MQTT_INFLIGHT_FREE) {
+			*entry = &client->internal.inflight[i];
+			break;
+		}
+	}
+
+	if (*entry == NULL) {
+		return -EAGAIN;
+	}
+
+	(*entry)->param = *param;
+	(*entry)->state = MQTT_INFLIGHT_PUBLISH;
+	(*entry)->sent_at = mqtt_sys_tick_in_ms_get();
+
+	return 0;
+}
+
+static void inflight_remove(struct mqtt_inflight_msg *entry)
+{
+	if (entry != NULL) {
+		entry->state = MQTT_INFLIGHT_FREE;
+	}
+}
+
+static int inflight_send_pubrel(struct mqtt_client *client,
+				struct mqtt_inflight_msg *entry)
+{
+	const struct mqtt_pubrel_param param = {
+		.message_id = entry->param.message_id,
+	};
+	struct buf_ctx packet;
+	int err_code;
+
+	tx_buf_init(client, &packet);
+
+	err_code = publish_release_encode(&param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	entry->sent_at = mqtt_sys_tick_in_ms_get();
+
+	return client_write(client, packet.cur, packet.end - packet.cur);
+}
+
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id)
+{
+	struct mqtt_inflight_msg *entry = inflight_find(client, message_id);
+
+	if (entry == NULL) {
+		NET_DBG("[CID %p]: Unknown message id 0x%04x", client,
+			message_id);
+		return;
+	}
+
+	switch (type) {
+	case MQTT_PKT_TYPE_PUBACK:
+		if (entry->param.message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+			inflight_remove(entry);
+		}
+		break;
+
+	case MQTT_PKT_TYPE_PUBREC:
+		if (entry->param.message.topic.qos == MQTT_QOS_2_EXACTLY_ONCE) {
+			entry->state = MQTT_INFLIGHT_PUBREL;
+			/* A failure closes the connection, the PUBREL is sent
+			 * again once reconnected.
+			 */
+			(void)inflight_send_pubrel(client, entry);
+		}
+		break;
+
+	case MQTT_PKT_TYPE_PUBCOMP:
+		if (entry->state == MQTT_INFLIGHT_PUBREL) {
+			inflight_remove(entry);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void mqtt_inflight_connected(struct mqtt_client *client)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight_msg *entry = &client->internal.inflight[i];
+
+		/* Send again on the next mqtt_live() call. */
+		entry->sent_at = mqtt_sys_tick_in_ms_get() -
+				 CONFIG_MQTT_INFLIGHT_RETRY_TIMEOUT;
+	}
+}
+
+static int inflight_retransmit(struct mqtt_client *client, bool *sent)
+{
+	int err_code = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight_msg *entry = &client->internal.inflight[i];
+
+		if (entry->state == MQTT_INFLIGHT_FREE ||
+		    mqtt_elapsed_time_in_ms_get(entry->sent_at) <
+		    CONFIG_MQTT_INFLIGHT_RETRY_TIMEOUT) {
+			continue;
+		}
+
+		NET_DBG("[CID %p]: Retransmitting message id 0x%04x", client,
+			entry->param.message_id);
+
+		if (entry->state == MQTT_INFLIGHT_PUBLISH) {
+			entry->param.dup_flag = 1U;
+			entry->sent_at = mqtt_sys_tick_in_ms_get();
+			err_code = publish_write(client, &entry->param);
+		} else {
+			err_code = inflight_send_pubrel(client, entry);
+		}
+
+		if (err_code < 0) {
+			break;
+		}
+
+		*sent = true;
+	}
+
+	return err_code;
+}
+
+static int inflight_time_left(const struct mqtt_client *client)
+{
+	int time_left = -1;
+
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		const struct mqtt_inflight_msg *entry =
+			&client->internal.inflight[i];
+		uint32_t elapsed_time;
+		int entry_left;
+
+		if (entry->state == MQTT_INFLIGHT_FREE) {
+			continue;
+		}
+
+		elapsed_time = mqtt_elapsed_time_in_ms_get(entry->sent_at);
+		entry_left = (elapsed_time >= CONFIG_MQTT_INFLIGHT_RETRY_TIMEOUT) ?
+			     0 : CONFIG_MQTT_INFLIGHT_RETRY_TIMEOUT - elapsed_time;
+
+		if (time_left < 0 || entry_left < time_left) {
+			time_left = entry_left;
+		}
+	}
+
+	return time_left;
+}
+#endif /* CONFIG_MQTT_INFLIGHT */
+
+int mqtt_publish(struct mqtt_client *client,
+		 const struct mqtt_publish_param *param)
+{
+	int err_code;
+	struct mqtt_publish_param publish;
+#if defined(CONFIG_MQTT_INFLIGHT)
+	struct mqtt_inflight_msg *entry;
+#endif
+
 	NULL_PARAM_CHECK(client);
 	NULL_PARAM_CHECK(param);
 
@@ -254,29 +479,27 @@ int mqtt_publish(struct mqtt_client *client,
 
 	mqtt_mutex_lock(client);
 
-	tx_buf_init(client, &packet);
-
 	err_code = verify_tx_state(client);
 	if (err_code < 0) {
 		goto error;
 	}
 
-	err_code = publish_encode(param, &packet);
+	publish = *param;
+
+#if defined(CONFIG_MQTT_INFLIGHT)
+	err_code = inflight_add(client, &publish, &entry);
 	if (err_code < 0) {
 		goto error;
 	}
+#endif
 
-	io_vector[0].iov_base = packet.cur;
-	io_vector[0].iov_len = packet.end - packet.cur;
-	io_vector[1].iov_base = param->message.payload.data;
-	io_vector[1].iov_len = param->message.payload.len;
-
-	memset(&msg, 0, sizeof(msg));
-
-	msg.msg_iov = io_vector;
-	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+	err_code = publish_write(client, &publish);
 
-	err_code = client_write_msg(client, &msg);
+#if defined(CONFIG_MQTT_INFLIGHT)
+	if (err_code < 0) {
+		inflight_remove(entry);
+	}
+#endif
 
 error:
 	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
@@ -287,6 +510,103 @@ error:
 	return err_code;
 }
 
+/* Maximum number of messages sent by one transport write in
+ * mqtt_publish_bulk().
+ */
+#define MQTT_PUBLISH_BULK_MAX 8
+
+int mqtt_publish_bulk(struct mqtt_client *client,
+		      const struct mqtt_publish_param *params, size_t count)
+{
+	struct iovec io_vector[2 * MQTT_PUBLISH_BULK_MAX];
+#if defined(CONFIG_MQTT_INFLIGHT)
+	struct mqtt_inflight_msg *entries[MQTT_PUBLISH_BULK_MAX];
+#endif
+	size_t published = 0;
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(params);
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
+
+	while (err_code == 0 && published < count) {
+		struct buf_ctx packet;
+		struct msghdr msg;
+		size_t n = 0;
+
+		tx_buf_init(client, &packet);
+
+		/* Encode the headers one after the other in the TX buffer. */
+		while (n < MQTT_PUBLISH_BULK_MAX && published + n < count) {
+			struct mqtt_publish_param publish = params[published + n];
+			uint8_t *start = packet.cur;
+			uint8_t *end = packet.end;
+
+#if defined(CONFIG_MQTT_INFLIGHT)
+			err_code = inflight_add(client, &publish, &entries[n]);
+			if (err_code < 0) {
+				break;
+			}
+#endif
+
+			err_code = publish_encode(&publish, &packet);
+			if (err_code < 0) {
+#if defined(CONFIG_MQTT_INFLIGHT)
+				inflight_remove(entries[n]);
+#endif
+				packet.cur = start;
+				packet.end = end;
+				break;
+			}
+
+			io_vector[2 * n].iov_base = packet.cur;
+			io_vector[2 * n].iov_len = packet.end - packet.cur;
+			io_vector[2 * n + 1].iov_base = publish.message.payload.data;
+			io_vector[2 * n + 1].iov_len = publish.message.payload.len;
+
+			packet.cur = packet.end;
+			packet.end = end;
+			n++;
+		}
+
+		if (n == 0) {
+			break;
+		}
+
+		/* The TX buffer is full, send what fits and continue. */
+		if (err_code == -ENOMEM) {
+			err_code = 0;
+		}
+
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = io_vector;
+		msg.msg_iovlen = 2 * n;
+
+		if (client_write_msg(client, &msg) < 0) {
+#if defined(CONFIG_MQTT_INFLIGHT)
+			for (size_t i = 0; i < n; i++) {
+				inflight_remove(entries[i]);
+			}
+#endif
+			err_code = -ENOTCONN;
+			break;
+		}
+
+		published += n;
+	}
+
+	NET_DBG("[CID %p]:[State 0x%02x]: << published %zu of %zu, "
+		"result %d", client, client->internal.state, published, count,
+		err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return (published > 0) ? published : err_code;
+}
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -382,6 +702,13 @@ int mqtt_publish_qos2_release(struct mqtt_client *client,
 		goto error;
 	}
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+	/* Already sent on reception of PUBREC. */
+	if (inflight_find(client, param->message_id) != NULL) {
+		goto error;
+	}
+#endif
+
 	err_code = publish_release_encode(param, &packet);
 	if (err_code < 0) {
 		goto error;
@@ -601,6 +928,15 @@ int mqtt_live(struct mqtt_client *client)
 
 	mqtt_mutex_lock(client);
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+	if (MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED)) {
+		err_code = inflight_retransmit(client, &ping_sent);
+		if (err_code < 0) {
+			goto out;
+		}
+	}
+#endif
+
 	elapsed_time = mqtt_elapsed_time_in_ms_get(
 				client->internal.last_activity);
 	if ((client->keepalive > 0) &&
@@ -609,6 +945,9 @@ int mqtt_live(struct mqtt_client *client)
 		ping_sent = true;
 	}
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+out:
+#endif
 	mqtt_mutex_unlock(client);
 
 	if (ping_sent) {
@@ -623,17 +962,27 @@ int mqtt_keepalive_time_left(const struct mqtt_client *client)
 	uint32_t elapsed_time = mqtt_elapsed_time_in_ms_get(
 					client->internal.last_activity);
 	uint32_t keepalive_ms = 1000U * client->keepalive;
+	int time_left;
 
 	if (client->keepalive == 0) {
 		/* Keep alive not enabled. */
-		return -1;
+		time_left = -1;
+	} else if (keepalive_ms <= elapsed_time) {
+		time_left = 0;
+	} else {
+		time_left = keepalive_ms - elapsed_time;
 	}
 
-	if (keepalive_ms <= elapsed_time) {
-		return 0;
+#if defined(CONFIG_MQTT_INFLIGHT)
+	int retransmit_left = inflight_time_left(client);
+
+	if (retransmit_left >= 0 &&
+	    (time_left < 0 || retransmit_left < time_left)) {
+		time_left = retransmit_left;
 	}
+#endif
 
-	return keepalive_ms - elapsed_time;
+	return time_left;
 }
 
 int mqtt_input(struct mqtt_client *client)
@@ -154,6 +154,37 @@ enum mqtt_state {
  */
 void event_notify(struct mqtt_client *client, const struct mqtt_evt *evt);
 
+#if defined(CONFIG_MQTT_INFLIGHT)
+/**@brief States of an in-flight publication. */
+enum mqtt_inflight_state {
+	/** Entry is free. */
+	MQTT_INFLIGHT_FREE = 0,
+
+	/** PUBLISH sent, waiting for PUBACK or PUBREC. */
+	MQTT_INFLIGHT_PUBLISH,
+
+	/** PUBREL sent, waiting for PUBCOMP. */
+	MQTT_INFLIGHT_PUBREL,
+};
+
+/**@brief Updates the in-flight publications on reception of an
+ *        acknowledgment. Sends PUBREL on reception of PUBREC.
+ *
+ * @param[in] client Identifies the client for which the packet was received.
+ * @param[in] type Type of the received packet.
+ * @param[in] message_id Message id of the received packet.
+ */
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id);
+
+/**@brief Schedules the retransmission of the in-flight publications once
+ *        connected to the broker.
+ *
+ * @param[in] client Identifies the client which got connected.
+ */
+void mqtt_inflight_connected(struct mqtt_client *client);
+#endif /* CONFIG_MQTT_INFLIGHT */
+
 /**@brief Handles MQTT messages received from the peer.
  *
  * @param[in] client Identifies the client for which the data was received.
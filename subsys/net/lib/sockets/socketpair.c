@@ -54,6 +54,10 @@ __net_socket struct spair {
 	struct k_poll_signal writeable;
 	/** buffer for @a recv_q recv_q */
 	uint8_t buf[CONFIG_NET_SOCKETPAIR_BUFFER_SIZE];
+#ifdef CONFIG_NET_SOCKETS_EPOLL
+	/** epoll instances watching the local endpoint */
+	sys_slist_t epoll;
+#endif
 };
 
 #ifdef CONFIG_NET_SOCKETPAIR_STATIC
@@ -120,6 +124,16 @@ static inline size_t spair_read_avail(struct spair *spair)
 	return k_pipe_read_avail(&spair->recv_q);
 }
 
+/** Wake the epoll instances watching @p spair */
+static inline void spair_epoll_notify(struct spair *spair)
+{
+#ifdef CONFIG_NET_SOCKETS_EPOLL
+	zsock_epoll_notify(&spair->epoll);
+#else
+	ARG_UNUSED(spair);
+#endif
+}
+
 /** Swap two 32-bit integers */
 static inline void swap32(uint32_t *a, uint32_t *b)
 {
@@ -182,6 +196,7 @@ static void spair_delete(struct spair *spair)
 				__ASSERT(res == 0,
 					"k_poll_signal_raise() failed: %d",
 					res);
+				spair_epoll_notify(remote);
 			}
 		}
 	}
@@ -191,6 +206,10 @@ static void spair_delete(struct spair *spair)
 	res = k_poll_signal_raise(&spair->writeable, SPAIR_SIG_CANCEL);
 	__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
 
+#ifdef CONFIG_NET_SOCKETS_EPOLL
+	zsock_epoll_forget(&spair->epoll);
+#endif
+
 	/* ensure no private information is released to the memory pool */
 	memset(spair, 0, sizeof(*spair));
 #ifdef CONFIG_NET_SOCKETPAIR_STATIC
@@ -555,6 +574,8 @@ static ssize_t spair_write(void *obj, const void *buffer, size_t count)
 	res = k_poll_signal_raise(&remote->readable, SPAIR_SIG_DATA);
 	__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
 
+	spair_epoll_notify(remote);
+
 	res = bytes_written;
 
 out:
@@ -727,8 +748,17 @@ static ssize_t spair_read(void *obj, void *buffer, size_t count)
 	}
 
 	if (is_connected) {
+		struct spair *remote;
+
 		res = k_poll_signal_raise(&spair->writeable, SPAIR_SIG_DATA);
 		__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
+
+		/* The remote endpoint can write again */
+		remote = z_get_fd_obj(spair->remote,
+			(const struct fd_op_vtable *)&spair_fd_op_vtable, 0);
+		if (remote != NULL) {
+			spair_epoll_notify(remote);
+		}
 	}
 
 	res = bytes_read;
@@ -968,6 +998,18 @@ static int spair_ioctl(void *obj, unsigned int request, va_list args)
 			goto out;
 		}
 
+#ifdef CONFIG_NET_SOCKETS_EPOLL
+		case ZFD_IOCTL_EPOLL_WATCHERS: {
+			sys_slist_t **watchers;
+
+			watchers = va_arg(args, sys_slist_t **);
+			*watchers = &spair->epoll;
+
+			res = 0;
+			goto out;
+		}
+#endif
+
 		default: {
 			errno = EOPNOTSUPP;
 			res = -1;
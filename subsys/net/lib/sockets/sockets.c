@@ -28,6 +28,10 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include "socks.h"
 #endif
 
+#if defined(CONFIG_PERF_STATS_NET_RX)
+#include <zephyr/stats/perf_stats.h>
+#endif
+
 #include "../../ip/net_stats.h"
 
 #include "sockets_internal.h"
@@ -254,6 +258,8 @@ static inline int z_vrfy_zsock_socket(int family, int type, int proto)
 
 int zsock_close_ctx(struct net_context *ctx)
 {
+	sock_epoll_forget(ctx);
+
 	/* Reset callbacks to avoid any race conditions while
 	 * flushing queues. No need to check return values here,
 	 * as these are fail-free operations and we're closing
@@ -372,6 +378,8 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 		net_context_ref(new_ctx);
 
 		(void)k_condvar_signal(&parent->cond.recv);
+
+		sock_epoll_notify(parent);
 	}
 
 }
@@ -429,6 +437,8 @@ unlock:
 
 	/* Wake reader if it was sleeping */
 	(void)k_condvar_signal(&ctx->cond.recv);
+
+	sock_epoll_notify(ctx);
 }
 
 int zsock_shutdown_ctx(struct net_context *ctx, int how)
@@ -919,6 +929,14 @@ static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
 
 	Z_OOPS(z_user_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
 
+	/* The data is copied from user mode, there are no application
+	 * buffers to reference.
+	 */
+	if (flags & ZSOCK_MSG_ZEROCOPY) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
 	msg_copy.msg_name = NULL;
 	msg_copy.msg_control = NULL;
 
@@ -997,6 +1015,139 @@ fail:
 #include <syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static int zsock_sendmmsg_ctx(struct net_context *ctx, struct mmsghdr *msgvec,
+			      unsigned int vlen, int flags)
+{
+	unsigned int i;
+	ssize_t len;
+
+	for (i = 0; i < vlen; i++) {
+		len = zsock_sendmsg_ctx(ctx, &msgvec[i].msg_hdr, flags);
+		if (len < 0) {
+			/* Like on Linux, an error is only reported if nothing
+			 * was sent, the caller retries from the failing message.
+			 */
+			return i > 0 ? i : -1;
+		}
+
+		msgvec[i].msg_len = len;
+	}
+
+	return i;
+}
+
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	VTABLE_CALL(sendmmsg, sock, msgvec, vlen, flags);
+}
+
+#ifdef CONFIG_USERSPACE
+static void mmsghdr_free(struct mmsghdr *msgvec, unsigned int vlen)
+{
+	for (unsigned int i = 0; i < vlen; i++) {
+		k_free(msgvec[i].msg_hdr.msg_iov);
+	}
+
+	k_free(msgvec);
+}
+
+/* Copy the headers and the iovec arrays of a user message vector, and check
+ * the access to the buffers they point to. The data itself is not copied.
+ */
+static struct mmsghdr *mmsghdr_from_user(struct mmsghdr *msgvec,
+					 unsigned int vlen, int write)
+{
+	struct mmsghdr *copy;
+	struct msghdr *hdr;
+	size_t size;
+	unsigned int i;
+
+	if (size_mul_overflow(vlen, sizeof(*msgvec), &size)) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	copy = z_user_alloc_from_copy(msgvec, size);
+	if (copy == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		hdr = &copy[i].msg_hdr;
+
+		if (hdr->msg_iovlen == 0) {
+			hdr->msg_iov = NULL;
+		} else if (size_mul_overflow(hdr->msg_iovlen,
+					     sizeof(struct iovec), &size)) {
+			errno = EINVAL;
+			goto fail;
+		} else {
+			hdr->msg_iov = z_user_alloc_from_copy(hdr->msg_iov,
+							      size);
+			if (hdr->msg_iov == NULL) {
+				errno = ENOMEM;
+				goto fail;
+			}
+		}
+
+		for (size_t j = 0; j < hdr->msg_iovlen; j++) {
+			Z_OOPS(Z_SYSCALL_MEMORY(hdr->msg_iov[j].iov_base,
+						hdr->msg_iov[j].iov_len, write));
+		}
+
+		Z_OOPS(hdr->msg_name &&
+		       Z_SYSCALL_MEMORY(hdr->msg_name, hdr->msg_namelen, write));
+		Z_OOPS(hdr->msg_control &&
+		       Z_SYSCALL_MEMORY(hdr->msg_control, hdr->msg_controllen,
+					write));
+	}
+
+	return copy;
+
+fail:
+	/* The iovec arrays which were not replaced yet are user pointers */
+	mmsghdr_free(copy, i);
+
+	return NULL;
+}
+
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	struct mmsghdr *copy;
+	int ret;
+
+	/* There are no application buffers to reference from user mode */
+	if (flags & ZSOCK_MSG_ZEROCOPY) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (vlen == 0) {
+		return z_impl_zsock_sendmmsg(sock, NULL, 0, flags);
+	}
+
+	copy = mmsghdr_from_user(msgvec, vlen, 0);
+	if (copy == NULL) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_sendmmsg(sock, copy, vlen, flags);
+
+	for (int i = 0; i < ret; i++) {
+		Z_OOPS(z_user_to_copy(&msgvec[i].msg_len, &copy[i].msg_len,
+				      sizeof(msgvec[i].msg_len)));
+	}
+
+	mmsghdr_free(copy, vlen);
+
+	return ret;
+}
+#include <syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 static int sock_get_pkt_src_addr(struct net_pkt *pkt,
 				 enum net_ip_protocol proto,
 				 struct sockaddr *addr,
@@ -1109,6 +1260,10 @@ void net_socket_update_tc_rx_time(struct net_pkt *pkt, uint32_t end_tick)
 				    net_pkt_create_time(pkt),
 				    end_tick);
 
+#ifdef CONFIG_PERF_STATS_NET_RX
+	perf_stats_record(PERF_STATS_HIST(net_rx), end_tick - net_pkt_create_time(pkt));
+#endif
+
 	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)) {
 		uint32_t val, prev = net_pkt_create_time(pkt);
 		int i;
@@ -1160,6 +1315,48 @@ int zsock_wait_data(struct net_context *ctx, k_timeout_t *timeout)
 	return 0;
 }
 
+static int sock_get_src_addr(struct net_context *ctx, struct net_pkt *pkt,
+			     struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		/*
+		 * Packets from offloaded IP stack do not have IP
+		 * headers, so src address cannot be figured out at this
+		 * point. The best we can do is returning remote address
+		 * if that was set using connect() call.
+		 */
+		if (ctx->flags & NET_CONTEXT_REMOTE_ADDR_SET) {
+			memcpy(src_addr, &ctx->remote,
+			       MIN(*addrlen, sizeof(ctx->remote)));
+		} else {
+			return -ENOTSUP;
+		}
+	} else {
+		int rv;
+
+		rv = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
+					   src_addr, *addrlen);
+		if (rv < 0) {
+			LOG_ERR("sock_get_pkt_src_addr %d", rv);
+			return rv;
+		}
+	}
+
+	/* addrlen is a value-result argument, set to actual
+	 * size of source address
+	 */
+	if (src_addr->sa_family == AF_INET) {
+		*addrlen = sizeof(struct sockaddr_in);
+	} else if (src_addr->sa_family == AF_INET6) {
+		*addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
 static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 				       void *buf,
 				       size_t max_len,
@@ -1210,42 +1407,11 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 	net_pkt_cursor_backup(pkt, &backup);
 
 	if (src_addr && addrlen) {
-		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
-		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
-			/*
-			 * Packets from offloaded IP stack do not have IP
-			 * headers, so src address cannot be figured out at this
-			 * point. The best we can do is returning remote address
-			 * if that was set using connect() call.
-			 */
-			if (ctx->flags & NET_CONTEXT_REMOTE_ADDR_SET) {
-				memcpy(src_addr, &ctx->remote,
-				       MIN(*addrlen, sizeof(ctx->remote)));
-			} else {
-				errno = ENOTSUP;
-				goto fail;
-			}
-		} else {
-			int rv;
-
-			rv = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
-						   src_addr, *addrlen);
-			if (rv < 0) {
-				errno = -rv;
-				LOG_ERR("sock_get_pkt_src_addr %d", rv);
-				goto fail;
-			}
-		}
+		int rv;
 
-		/* addrlen is a value-result argument, set to actual
-		 * size of source address
-		 */
-		if (src_addr->sa_family == AF_INET) {
-			*addrlen = sizeof(struct sockaddr_in);
-		} else if (src_addr->sa_family == AF_INET6) {
-			*addrlen = sizeof(struct sockaddr_in6);
-		} else {
-			errno = ENOTSUP;
+		rv = sock_get_src_addr(ctx, pkt, src_addr, addrlen);
+		if (rv < 0) {
+			errno = -rv;
 			goto fail;
 		}
 	}
@@ -1459,6 +1625,363 @@ ssize_t z_vrfy_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 #include <syscalls/zsock_recvfrom_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* Scatter the datagram pkt into the buffers of msg */
+static ssize_t sock_pkt_read_msg(struct net_context *ctx, struct net_pkt *pkt,
+				 struct msghdr *msg)
+{
+	size_t recv_len = net_pkt_remaining_data(pkt);
+	size_t read_len = 0;
+	size_t len;
+	int ret;
+
+	msg->msg_flags = 0;
+	msg->msg_controllen = 0;
+
+	if (msg->msg_name != NULL) {
+		ret = sock_get_src_addr(ctx, pkt, msg->msg_name,
+					&msg->msg_namelen);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	for (size_t i = 0; i < msg->msg_iovlen && read_len < recv_len; i++) {
+		len = MIN(msg->msg_iov[i].iov_len, recv_len - read_len);
+
+		if (net_pkt_read(pkt, msg->msg_iov[i].iov_base, len)) {
+			return -ENOBUFS;
+		}
+
+		read_len += len;
+	}
+
+	if (read_len < recv_len) {
+		msg->msg_flags |= ZSOCK_MSG_TRUNC;
+	}
+
+	return read_len;
+}
+
+static int zsock_recvmmsg_ctx(struct net_context *ctx, struct mmsghdr *msgvec,
+			      unsigned int vlen, int flags)
+{
+	k_timeout_t timeout = K_FOREVER;
+	unsigned int count = 0;
+	struct net_pkt *pkt;
+	ssize_t len;
+	int ret;
+
+	if (net_context_get_type(ctx) != SOCK_DGRAM) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (flags & ZSOCK_MSG_PEEK) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (vlen == 0) {
+		return 0;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	/* Only the first datagram is waited for, the following ones are
+	 * the ones already queued, all taken under the same socket lock.
+	 */
+	while (count < vlen) {
+		pkt = k_fifo_get(&ctx->recv_q, count == 0 ? timeout : K_NO_WAIT);
+		if (pkt == NULL) {
+			break;
+		}
+
+		len = sock_pkt_read_msg(ctx, pkt, &msgvec[count].msg_hdr);
+
+		if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS)) {
+			net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+		}
+
+		net_pkt_unref(pkt);
+
+		if (len < 0) {
+			if (count == 0) {
+				errno = -len;
+				return -1;
+			}
+
+			break;
+		}
+
+		msgvec[count].msg_len = len;
+		count++;
+	}
+
+	if (count == 0) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	return count;
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	VTABLE_CALL(recvmmsg, sock, msgvec, vlen, flags);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	struct mmsghdr *copy;
+	struct msghdr *hdr;
+	int ret;
+
+	if (vlen == 0) {
+		return z_impl_zsock_recvmmsg(sock, NULL, 0, flags);
+	}
+
+	copy = mmsghdr_from_user(msgvec, vlen, 1);
+	if (copy == NULL) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_recvmmsg(sock, copy, vlen, flags);
+
+	for (int i = 0; i < ret; i++) {
+		hdr = &msgvec[i].msg_hdr;
+
+		Z_OOPS(z_user_to_copy(&msgvec[i].msg_len, &copy[i].msg_len,
+				      sizeof(msgvec[i].msg_len)));
+		Z_OOPS(z_user_to_copy(&hdr->msg_namelen,
+				      &copy[i].msg_hdr.msg_namelen,
+				      sizeof(hdr->msg_namelen)));
+		Z_OOPS(z_user_to_copy(&hdr->msg_controllen,
+				      &copy[i].msg_hdr.msg_controllen,
+				      sizeof(hdr->msg_controllen)));
+		Z_OOPS(z_user_to_copy(&hdr->msg_flags,
+				      &copy[i].msg_hdr.msg_flags,
+				      sizeof(hdr->msg_flags)));
+	}
+
+	mmsghdr_free(copy, vlen);
+
+	return ret;
+}
+#include <syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_RECV_ZC)
+/* Detach the unread data of pkt from it, without copying it */
+static struct net_buf *sock_pkt_take_data(struct net_pkt *pkt)
+{
+	size_t hdr_len = net_pkt_get_len(pkt) - net_pkt_remaining_data(pkt);
+	struct net_buf *buf = pkt->buffer;
+
+	pkt->buffer = NULL;
+
+	while (buf && hdr_len >= buf->len) {
+		hdr_len -= buf->len;
+		buf = net_buf_frag_del(NULL, buf);
+	}
+
+	if (buf && hdr_len > 0) {
+		net_buf_pull(buf, hdr_len);
+	}
+
+	return buf;
+}
+
+static ssize_t zsock_recvfrom_zc_ctx(struct net_context *ctx,
+				     struct net_buf **frags, int flags,
+				     struct sockaddr *src_addr,
+				     socklen_t *addrlen)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	ssize_t len;
+	int res;
+
+	*frags = NULL;
+
+	if (flags & ~ZSOCK_MSG_DONTWAIT) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (sock_type == SOCK_STREAM &&
+	    net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+		errno = ENOTCONN;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else if (!sock_is_eof(ctx) && !sock_is_error(ctx)) {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+	}
+
+	while (true) {
+		if (sock_type == SOCK_STREAM) {
+			if (sock_is_error(ctx)) {
+				errno = POINTER_TO_INT(ctx->user_data);
+				return -1;
+			}
+
+			if (sock_is_eof(ctx)) {
+				return 0;
+			}
+		}
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			res = zsock_wait_data(ctx, &timeout);
+			if (res < 0) {
+				errno = -res;
+				return -1;
+			}
+		}
+
+		pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+		if (pkt == NULL) {
+			if (sock_type == SOCK_STREAM &&
+			    (sock_is_error(ctx) || sock_is_eof(ctx))) {
+				continue;
+			}
+
+			errno = EAGAIN;
+			return -1;
+		}
+
+		if (sock_type != SOCK_STREAM || !net_pkt_eof(pkt)) {
+			break;
+		}
+
+		/* Last data of the stream */
+		sock_set_eof(ctx);
+
+		if (net_pkt_remaining_data(pkt) > 0) {
+			break;
+		}
+
+		net_pkt_unref(pkt);
+	}
+
+	if (sock_type == SOCK_DGRAM && src_addr && addrlen) {
+		res = sock_get_src_addr(ctx, pkt, src_addr, addrlen);
+		if (res < 0) {
+			net_pkt_unref(pkt);
+			errno = -res;
+			return -1;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	len = net_pkt_remaining_data(pkt);
+	*frags = sock_pkt_take_data(pkt);
+	net_pkt_unref(pkt);
+
+	return len;
+}
+
+static void zsock_recv_zc_release_ctx(struct net_context *ctx,
+				      struct net_buf *frags)
+{
+	if (frags == NULL) {
+		return;
+	}
+
+	/* The data counted against the receive window until now */
+	if (net_context_get_type(ctx) == SOCK_STREAM) {
+		net_context_update_recv_wnd(ctx, net_buf_frags_len(frags));
+	}
+
+	net_buf_unref(frags);
+}
+
+/* Zero-copy calls are only valid on the native sockets */
+static struct net_context *sock_get_native_ctx(int sock, struct k_mutex **lock)
+{
+	const struct socket_op_vtable *vtable;
+	struct net_context *ctx;
+
+	ctx = get_sock_vtable(sock, &vtable, lock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	if (vtable != &sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return NULL;
+	}
+
+	return ctx;
+}
+
+ssize_t zsock_recvfrom_zc(int sock, struct net_buf **frags, int flags,
+			  struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	*frags = NULL;
+
+	ctx = sock_get_native_ctx(sock, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_recvfrom_zc_ctx(ctx, frags, flags, src_addr, addrlen);
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+int zsock_recv_zc_release(int sock, struct net_buf *frags)
+{
+	struct net_context *ctx;
+	struct k_mutex *lock;
+
+	ctx = sock_get_native_ctx(sock, &lock);
+	if (ctx == NULL) {
+		/* The socket is gone, the data can still be freed */
+		if (frags != NULL) {
+			net_buf_unref(frags);
+		}
+
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	zsock_recv_zc_release_ctx(ctx, frags);
+
+	k_mutex_unlock(lock);
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZC */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -1917,6 +2440,16 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 		case TCP_NODELAY:
 			ret = net_tcp_get_option(ctx, TCP_OPT_NODELAY, optval, optlen);
 			return ret;
+
+		case TCP_CONGESTION:
+			ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+						 optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
 		}
 
 		break;
@@ -2142,6 +2675,32 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 			break;
 
+		case SO_ZEROCOPY_CB:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_ZEROCOPY)) {
+				const struct zsock_zerocopy_cb *zsock_zc = optval;
+				struct net_context_zerocopy zc;
+
+				if (optlen != sizeof(*zsock_zc)) {
+					errno = EINVAL;
+					return -1;
+				}
+
+				zc.cb = zsock_zc->cb;
+				zc.user_data = zsock_zc->user_data;
+
+				ret = net_context_set_option(ctx,
+							     NET_OPT_ZEROCOPY,
+							     &zc, sizeof(zc));
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case SO_SOCKS5:
 			if (IS_ENABLED(CONFIG_SOCKS)) {
 				ret = net_context_set_option(ctx,
@@ -2215,6 +2774,16 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 			ret = net_tcp_set_option(ctx,
 						 TCP_OPT_NODELAY, optval, optlen);
 			return ret;
+
+		case TCP_CONGESTION:
+			ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+						 optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
 		}
 		break;
 
@@ -2284,6 +2853,12 @@ int z_vrfy_zsock_setsockopt(int sock, int level, int optname,
 	void *kernel_optval;
 	int ret;
 
+	/* The callback would run in supervisor mode */
+	if (level == SOL_SOCKET && optname == SO_ZEROCOPY_CB) {
+		errno = EPERM;
+		return -1;
+	}
+
 	kernel_optval = z_user_alloc_from_copy((const void *)optval, optlen);
 	Z_OOPS(!kernel_optval);
 
@@ -2530,6 +3105,18 @@ static int sock_ioctl_vmeth(void *obj, unsigned int request, va_list args)
 		return 0;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+	case ZFD_IOCTL_EPOLL_WATCHERS: {
+		struct net_context *ctx = obj;
+		sys_slist_t **watchers;
+
+		watchers = va_arg(args, sys_slist_t **);
+		*watchers = &ctx->epoll;
+
+		return 0;
+	}
+#endif
+
 	default:
 		errno = EOPNOTSUPP;
 		return -1;
@@ -2577,6 +3164,18 @@ static ssize_t sock_sendmsg_vmeth(void *obj, const struct msghdr *msg,
 	return zsock_sendmsg_ctx(obj, msg, flags);
 }
 
+static int sock_sendmmsg_vmeth(void *obj, struct mmsghdr *msgvec,
+			      unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg_ctx(obj, msgvec, vlen, flags);
+}
+
+static int sock_recvmmsg_vmeth(void *obj, struct mmsghdr *msgvec,
+			      unsigned int vlen, int flags)
+{
+	return zsock_recvmmsg_ctx(obj, msgvec, vlen, flags);
+}
+
 static ssize_t sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				   int flags, struct sockaddr *src_addr,
 				   socklen_t *addrlen)
@@ -2627,7 +3226,9 @@ const struct socket_op_vtable sock_fd_op_vtable = {
 	.accept = sock_accept_vmeth,
 	.sendto = sock_sendto_vmeth,
 	.sendmsg = sock_sendmsg_vmeth,
+	.sendmmsg = sock_sendmmsg_vmeth,
 	.recvfrom = sock_recvfrom_vmeth,
+	.recvmmsg = sock_recvmmsg_vmeth,
 	.getsockopt = sock_getsockopt_vmeth,
 	.setsockopt = sock_setsockopt_vmeth,
 	.getpeername = sock_getpeername_vmeth,
@@ -183,6 +183,8 @@ static void zcan_received_cb(struct net_context *ctx, struct net_pkt *pkt,
 		}
 
 		k_condvar_signal(&ctx->cond.recv);
+
+		sock_epoll_notify(ctx);
 	}
 
 	if (clone && clone != pkt) {
@@ -451,6 +453,8 @@ static int can_sock_close_vmeth(void *obj)
 {
 	int ret;
 
+	sock_epoll_forget(obj);
+
 	ret = can_close_socket(obj);
 	if (ret < 0) {
 		NET_DBG("Cannot detach net_context %p (%d)", obj, ret);
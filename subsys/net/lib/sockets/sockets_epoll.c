@@ -0,0 +1,691 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_sock_epoll, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/syscall_handler.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/net/socket.h>
+#include "sockets_internal.h"
+#include "../../ip/net_private.h"
+
+struct epoll_instance;
+
+/* One file descriptor in the interest list of one instance.
+ *
+ * The item is linked in the watcher list of the file descriptor object,
+ * which the object implementation walks in zsock_epoll_notify(). A
+ * notification only puts the item on the ready list of its instance, the
+ * events are checked when zsock_epoll_wait() picks the item up, so the
+ * notifications do not need to be precise.
+ */
+struct epoll_item {
+	/* Node in the interest list of the instance */
+	sys_snode_t node;
+	/* Node in the watcher list of the object */
+	sys_snode_t watch_node;
+	/* Node in the ready list of the instance */
+	sys_dnode_t ready_node;
+	/* Watcher list of the object */
+	sys_slist_t *watchers;
+	struct epoll_instance *ep;
+	struct zsock_epoll_event event;
+	int fd;
+	/* On the ready list */
+	bool ready : 1;
+	/* Reported with ZSOCK_EPOLLONESHOT, until ZSOCK_EPOLL_CTL_MOD */
+	bool disabled : 1;
+	/* The file descriptor was closed, the item is freed on next use of
+	 * the instance.
+	 */
+	bool dead : 1;
+};
+
+__net_socket struct epoll_instance {
+	/* Interest list, protected by the fdtable lock of the instance */
+	sys_slist_t items;
+	/* Ready list, protected by epoll_lock */
+	sys_dlist_t ready;
+	int ready_count;
+	/* Raised when an item gets ready, for the waiters */
+	struct k_poll_signal signal;
+	bool in_use;
+};
+
+/* Protects the watcher lists, the ready lists and the item flags. These
+ * are touched from the notifications of the objects, which run with the
+ * object locked, so the fdtable locks cannot be used.
+ */
+static struct k_spinlock epoll_lock;
+
+static struct epoll_instance epoll_instances[CONFIG_NET_SOCKETS_EPOLL_MAX];
+
+K_MEM_SLAB_DEFINE_STATIC(epoll_item_slab, sizeof(struct epoll_item),
+			 CONFIG_NET_SOCKETS_EPOLL_ITEMS, 4);
+
+static const struct fd_op_vtable epoll_fd_vtable;
+
+/* Must be called with epoll_lock held */
+static void epoll_set_ready(struct epoll_item *item)
+{
+	if (item->ready || item->disabled || item->dead) {
+		return;
+	}
+
+	item->ready = true;
+	sys_dlist_append(&item->ep->ready, &item->ready_node);
+	item->ep->ready_count++;
+
+	(void)k_poll_signal_raise(&item->ep->signal, 0);
+}
+
+/* Must be called with epoll_lock held */
+static void epoll_clear_ready(struct epoll_item *item)
+{
+	if (!item->ready) {
+		return;
+	}
+
+	item->ready = false;
+	sys_dlist_remove(&item->ready_node);
+	item->ep->ready_count--;
+}
+
+void zsock_epoll_notify(sys_slist_t *watchers)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(watchers, item, watch_node) {
+		epoll_set_ready(item);
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+void zsock_epoll_forget(sys_slist_t *watchers)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	key = k_spin_lock(&epoll_lock);
+
+	while ((node = sys_slist_get(watchers)) != NULL) {
+		item = CONTAINER_OF(node, struct epoll_item, watch_node);
+
+		epoll_clear_ready(item);
+		item->dead = true;
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+void net_socket_epoll_notify(struct net_context *context)
+{
+	zsock_epoll_notify(&context->epoll);
+}
+
+static struct epoll_instance *epoll_get(int epfd, struct k_mutex **lock)
+{
+	const struct fd_op_vtable *vtable;
+	void *obj;
+
+	obj = z_get_fd_obj_and_vtable(epfd, &vtable, lock);
+	if (obj == NULL) {
+		return NULL;
+	}
+
+	if (vtable != &epoll_fd_vtable) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return obj;
+}
+
+static void epoll_item_free(struct epoll_instance *ep, struct epoll_item *item)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	if (!item->dead) {
+		(void)sys_slist_find_and_remove(item->watchers,
+						&item->watch_node);
+	}
+
+	epoll_clear_ready(item);
+
+	k_spin_unlock(&epoll_lock, key);
+
+	(void)sys_slist_find_and_remove(&ep->items, &item->node);
+	k_mem_slab_free(&epoll_item_slab, (void *)item);
+}
+
+/* Free the items of the file descriptors closed since last call */
+static void epoll_reap(struct epoll_instance *ep)
+{
+	struct epoll_item *item, *next;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ep->items, item, next, node) {
+		if (item->dead) {
+			epoll_item_free(ep, item);
+		}
+	}
+}
+
+static struct epoll_item *epoll_find(struct epoll_instance *ep, int fd)
+{
+	struct epoll_item *item;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ep->items, item, node) {
+		if (item->fd == fd && !item->dead) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+static int epoll_add(struct epoll_instance *ep, int fd,
+		     const struct zsock_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	sys_slist_t *watchers = NULL;
+	struct epoll_item *item;
+	struct k_mutex *lock;
+	k_spinlock_key_t key;
+	void *obj;
+	int ret;
+
+	obj = z_get_fd_obj_and_vtable(fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	if (k_mem_slab_alloc(&epoll_item_slab, (void **)&item, K_NO_WAIT) < 0) {
+		return -ENOMEM;
+	}
+
+	memset(item, 0, sizeof(*item));
+	item->ep = ep;
+	item->fd = fd;
+	item->event = *event;
+
+	/* The object lock keeps it from being closed before the item is
+	 * linked, zsock_epoll_forget() then takes care of it.
+	 */
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_EPOLL_WATCHERS,
+				   &watchers);
+	if (ret == 0 && watchers != NULL) {
+		item->watchers = watchers;
+
+		key = k_spin_lock(&epoll_lock);
+		sys_slist_append(watchers, &item->watch_node);
+		/* Let the first wait find out the current state */
+		epoll_set_ready(item);
+		k_spin_unlock(&epoll_lock, key);
+	}
+
+	k_mutex_unlock(lock);
+
+	if (item->watchers == NULL) {
+		k_mem_slab_free(&epoll_item_slab, (void *)item);
+		return -EPERM;
+	}
+
+	sys_slist_append(&ep->items, &item->node);
+
+	return 0;
+}
+
+static void epoll_mod(struct epoll_item *item,
+		      const struct zsock_epoll_event *event)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&epoll_lock);
+
+	item->event = *event;
+	item->disabled = false;
+	epoll_set_ready(item);
+
+	k_spin_unlock(&epoll_lock, key);
+}
+
+int z_impl_zsock_epoll_create1(int flags)
+{
+	struct epoll_instance *ep = NULL;
+	k_spinlock_key_t key;
+	int fd;
+
+	if (flags & ~ZSOCK_EPOLL_CLOEXEC) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	key = k_spin_lock(&epoll_lock);
+
+	for (int i = 0; i < ARRAY_SIZE(epoll_instances); i++) {
+		if (!epoll_instances[i].in_use) {
+			ep = &epoll_instances[i];
+			ep->in_use = true;
+			break;
+		}
+	}
+
+	k_spin_unlock(&epoll_lock, key);
+
+	if (ep == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	fd = z_reserve_fd();
+	if (fd < 0) {
+		ep->in_use = false;
+		return -1;
+	}
+
+	sys_slist_init(&ep->items);
+	sys_dlist_init(&ep->ready);
+	ep->ready_count = 0;
+	k_poll_signal_init(&ep->signal);
+
+	z_finalize_fd(fd, ep, &epoll_fd_vtable);
+
+	NET_DBG("epoll: ep=%p, fd=%d", ep, fd);
+
+	return fd;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_create1(int flags)
+{
+	return z_impl_zsock_epoll_create1(flags);
+}
+#include <syscalls/zsock_epoll_create1_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_epoll_ctl(int epfd, int op, int fd,
+			   struct zsock_epoll_event *event)
+{
+	struct epoll_instance *ep;
+	struct epoll_item *item;
+	struct k_mutex *lock;
+	int ret = 0;
+
+	ep = epoll_get(epfd, &lock);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd == epfd) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL && event == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	epoll_reap(ep);
+
+	item = epoll_find(ep, fd);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		ret = epoll_add(ep, fd, event);
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_mod(item, event);
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_free(ep, item);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_ctl(int epfd, int op, int fd,
+					 struct zsock_epoll_event *event)
+{
+	struct zsock_epoll_event event_copy;
+
+	if (event != NULL) {
+		Z_OOPS(z_user_from_copy(&event_copy, (void *)event,
+					sizeof(event_copy)));
+		event = &event_copy;
+	}
+
+	return z_impl_zsock_epoll_ctl(epfd, op, fd, event);
+}
+#include <syscalls/zsock_epoll_ctl_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+/* Check the events of an item taken off the ready list */
+static uint32_t epoll_check(struct epoll_item *item)
+{
+	struct zsock_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events & (ZSOCK_EPOLLIN | ZSOCK_EPOLLOUT),
+	};
+
+	if (zsock_poll_internal(&pfd, 1, K_NO_WAIT) <= 0) {
+		return 0;
+	}
+
+	/* The file descriptor is being closed */
+	if (pfd.revents & ZSOCK_POLLNVAL) {
+		return 0;
+	}
+
+	return pfd.revents;
+}
+
+/* Report the ready items, the cost only depends on the number of items on
+ * the ready list. Must be called with the instance locked, so that the
+ * items are not freed while being checked.
+ */
+static int epoll_collect(struct epoll_instance *ep,
+			 struct zsock_epoll_event *events, int maxevents)
+{
+	struct epoll_item *item;
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+	uint32_t revents;
+	int pending;
+	int count = 0;
+
+	key = k_spin_lock(&epoll_lock);
+	pending = ep->ready_count;
+	k_spin_unlock(&epoll_lock, key);
+
+	/* The level-triggered items go back to the tail of the list, so
+	 * each item is looked at once at most.
+	 */
+	while (pending-- > 0 && count < maxevents) {
+		key = k_spin_lock(&epoll_lock);
+
+		node = sys_dlist_get(&ep->ready);
+		if (node == NULL) {
+			k_spin_unlock(&epoll_lock, key);
+			break;
+		}
+
+		item = CONTAINER_OF(node, struct epoll_item, ready_node);
+		item->ready = false;
+		ep->ready_count--;
+
+		k_spin_unlock(&epoll_lock, key);
+
+		/* A notification coming during the check puts the item
+		 * back on the ready list, so none is lost.
+		 */
+		revents = epoll_check(item);
+		if (revents == 0) {
+			continue;
+		}
+
+		key = k_spin_lock(&epoll_lock);
+
+		if (item->dead) {
+			k_spin_unlock(&epoll_lock, key);
+			continue;
+		}
+
+		events[count].events = revents;
+		events[count].data = item->event.data;
+		count++;
+
+		if (item->event.events & ZSOCK_EPOLLONESHOT) {
+			item->disabled = true;
+		} else if (!(item->event.events & ZSOCK_EPOLLET)) {
+			epoll_set_ready(item);
+		}
+
+		k_spin_unlock(&epoll_lock, key);
+	}
+
+	return count;
+}
+
+int z_impl_zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			    int maxevents, int timeout)
+{
+	struct k_poll_event poll_event;
+	struct epoll_instance *ep;
+	struct k_mutex *lock;
+	k_timeout_t wait;
+	k_timepoint_t end;
+	int count;
+	int ret;
+
+	if (maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout < 0) {
+		wait = K_FOREVER;
+	} else {
+		wait = K_MSEC(timeout);
+	}
+
+	end = sys_timepoint_calc(wait);
+
+	while (true) {
+		/* Looked up again after sleeping, the instance might have
+		 * been closed in the meantime.
+		 */
+		ep = epoll_get(epfd, &lock);
+		if (ep == NULL) {
+			return -1;
+		}
+
+		(void)k_mutex_lock(lock, K_FOREVER);
+
+		/* Reset before collecting, so that an item getting ready
+		 * after the collect wakes us up.
+		 */
+		k_poll_signal_reset(&ep->signal);
+
+		epoll_reap(ep);
+		count = epoll_collect(ep, events, maxevents);
+
+		k_poll_event_init(&poll_event, K_POLL_TYPE_SIGNAL,
+				  K_POLL_MODE_NOTIFY_ONLY, &ep->signal);
+
+		k_mutex_unlock(lock);
+
+		if (count > 0 || K_TIMEOUT_EQ(wait, K_NO_WAIT)) {
+			return count;
+		}
+
+		ret = k_poll(&poll_event, 1, wait);
+		if (ret == -EAGAIN) {
+			return 0;
+		}
+
+		wait = sys_timepoint_timeout(end);
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_wait(int epfd,
+					  struct zsock_epoll_event *events,
+					  int maxevents, int timeout)
+{
+	struct zsock_epoll_event *events_copy;
+	size_t events_size;
+	int ret;
+
+	if (maxevents <= 0 ||
+	    size_mul_overflow(maxevents, sizeof(*events), &events_size)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(events, events_size));
+
+	events_copy = k_malloc(events_size);
+	if (events_copy == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ret = z_impl_zsock_epoll_wait(epfd, events_copy, maxevents, timeout);
+	if (ret > 0) {
+		Z_OOPS(z_user_to_copy(events, events_copy,
+				      ret * sizeof(*events)));
+	}
+
+	k_free(events_copy);
+
+	return ret;
+}
+#include <syscalls/zsock_epoll_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static ssize_t epoll_read_vmeth(void *obj, void *buffer, size_t count)
+{
+	errno = EINVAL;
+	return -1;
+}
+
+static ssize_t epoll_write_vmeth(void *obj, const void *buffer, size_t count)
+{
+	errno = EINVAL;
+	return -1;
+}
+
+static int epoll_close_vmeth(void *obj)
+{
+	struct epoll_instance *ep = obj;
+	struct epoll_item *item, *next;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ep->items, item, next, node) {
+		epoll_item_free(ep, item);
+	}
+
+	/* Wake the waiters, they will find the instance closed */
+	(void)k_poll_signal_raise(&ep->signal, 0);
+
+	ep->in_use = false;
+
+	return 0;
+}
+
+static int epoll_ioctl_vmeth(void *obj, unsigned int request, va_list args)
+{
+	struct epoll_instance *ep = obj;
+
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+		struct k_poll_event *pev_end;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+		pev_end = va_arg(args, struct k_poll_event *);
+
+		if (!(pfd->events & ZSOCK_POLLIN)) {
+			return 0;
+		}
+
+		if (*pev == pev_end) {
+			return -ENOMEM;
+		}
+
+		k_poll_event_init(*pev, K_POLL_TYPE_SIGNAL,
+				  K_POLL_MODE_NOTIFY_ONLY, &ep->signal);
+		(*pev)++;
+
+		if (!sys_dlist_is_empty(&ep->ready)) {
+			return -EALREADY;
+		}
+
+		return 0;
+	}
+
+	case ZFD_IOCTL_POLL_UPDATE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+
+		if (!(pfd->events & ZSOCK_POLLIN)) {
+			return 0;
+		}
+
+		/* The ready list may hold items which are not ready
+		 * anymore, zsock_epoll_wait() can then return 0.
+		 */
+		if (!sys_dlist_is_empty(&ep->ready)) {
+			pfd->revents |= ZSOCK_POLLIN;
+		}
+
+		(*pev)++;
+
+		return 0;
+	}
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable epoll_fd_vtable = {
+	.read = epoll_read_vmeth,
+	.write = epoll_write_vmeth,
+	.close = epoll_close_vmeth,
+	.ioctl = epoll_ioctl_vmeth,
+};
@@ -47,6 +47,28 @@ static inline bool net_socket_is_tls(void *obj)
 }
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_EPOLL)
+static inline void sock_epoll_notify(struct net_context *ctx)
+{
+	zsock_epoll_notify(&ctx->epoll);
+}
+
+static inline void sock_epoll_forget(struct net_context *ctx)
+{
+	zsock_epoll_forget(&ctx->epoll);
+}
+#else
+static inline void sock_epoll_notify(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static inline void sock_epoll_forget(struct net_context *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif
+
 #define sock_is_eof(ctx) sock_get_flag(ctx, SOCK_EOF)
 #define sock_set_eof(ctx) sock_set_flag(ctx, SOCK_EOF, SOCK_EOF)
 #define sock_is_nonblock(ctx) sock_get_flag(ctx, SOCK_NONBLOCK)
@@ -70,6 +92,10 @@ struct socket_op_vtable {
 	int (*setsockopt)(void *obj, int level, int optname,
 			  const void *optval, socklen_t optlen);
 	ssize_t (*sendmsg)(void *obj, const struct msghdr *msg, int flags);
+	int (*sendmmsg)(void *obj, struct mmsghdr *msgvec, unsigned int vlen,
+			int flags);
+	int (*recvmmsg)(void *obj, struct mmsghdr *msgvec, unsigned int vlen,
+			int flags);
 	int (*getpeername)(void *obj, struct sockaddr *addr,
 			   socklen_t *addrlen);
 	int (*getsockname)(void *obj, struct sockaddr *addr,
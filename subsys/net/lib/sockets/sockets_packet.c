@@ -106,6 +106,8 @@ static void zpacket_received_cb(struct net_context *ctx,
 			NET_DBG("Set EOF flag on pkt %p", ctx);
 		}
 
+		sock_epoll_notify(ctx);
+
 		return;
 	}
 
@@ -113,6 +115,8 @@ static void zpacket_received_cb(struct net_context *ctx,
 	net_pkt_set_eof(pkt, false);
 
 	k_fifo_put(&ctx->recv_q, pkt);
+
+	sock_epoll_notify(ctx);
 }
 
 static int zpacket_bind_ctx(struct net_context *ctx,
@@ -51,6 +51,9 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#if defined(MBEDTLS_SSL_TICKET_C)
+#include <mbedtls/ssl_ticket.h>
+#endif
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -105,6 +108,11 @@ struct tls_session_cache {
 	/** Peer address. */
 	struct sockaddr peer_addr;
 
+	/** Peer hostname, if set on the socket. Takes precedence over
+	 *  the peer address when looking up a session.
+	 */
+	char *hostname;
+
 	/** Session buffer. */
 	uint8_t *session;
 
@@ -186,6 +194,17 @@ __net_socket struct tls_context {
 		uint32_t dtls_handshake_timeout_min;
 		uint32_t dtls_handshake_timeout_max;
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+		/** DTLS Connection ID mode. */
+		int dtls_cid;
+
+		/** Own DTLS Connection ID, generated if its length is 0. */
+		uint8_t dtls_cid_value[MBEDTLS_SSL_CID_IN_LEN_MAX];
+
+		/** Own DTLS Connection ID length. */
+		size_t dtls_cid_len;
+#endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
 	} options;
 
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
@@ -200,6 +219,16 @@ __net_socket struct tls_context {
 
 	/** DTLS peer address length. */
 	socklen_t dtls_peer_addrlen;
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	/** New DTLS peer address, taken into use once a record with our
+	 *  Connection ID received from it is authenticated.
+	 */
+	struct sockaddr dtls_cid_peer_addr;
+
+	/** New DTLS peer address length. */
+	socklen_t dtls_cid_peer_addrlen;
+#endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
 #if defined(CONFIG_MBEDTLS)
@@ -233,6 +262,10 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+static mbedtls_ssl_ticket_context server_ticket;
+#endif
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -241,12 +274,18 @@ static struct k_mutex context_lock;
  */
 #define TLS_WAIT_MS 100
 
+static void tls_session_entry_free(struct tls_session_cache *entry)
+{
+	mbedtls_free(entry->session);
+	mbedtls_free(entry->hostname);
+	entry->session = NULL;
+	entry->hostname = NULL;
+}
+
 static void tls_session_cache_reset(void)
 {
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
-		if (client_cache[i].session != NULL) {
-			mbedtls_free(client_cache[i].session);
-		}
+		tls_session_entry_free(&client_cache[i]);
 	}
 
 	(void)memset(client_cache, 0, sizeof(client_cache));
@@ -334,6 +373,25 @@ static int dtls_get_remaining_timeout(struct tls_context *ctx)
 }
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+static void tls_ticket_setup(void)
+{
+	int ret;
+
+	mbedtls_ssl_ticket_init(&server_ticket);
+
+	/* A new random key is generated, so tickets issued before are
+	 * no longer accepted.
+	 */
+	ret = mbedtls_ssl_ticket_setup(&server_ticket, tls_ctr_drbg_random,
+				       NULL, MBEDTLS_CIPHER_AES_256_GCM,
+				       CONFIG_NET_SOCKETS_TLS_TICKET_LIFETIME);
+	if (ret != 0) {
+		NET_ERR("Failed to setup session tickets, err: 0x%x.", -ret);
+	}
+}
+#endif /* MBEDTLS_SSL_TICKET_C */
+
 /* Initialize TLS internals. */
 static int tls_init(void)
 {
@@ -352,6 +410,10 @@ static int tls_init(void)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+	tls_ticket_setup();
+#endif
+
 	return 0;
 }
 
@@ -542,7 +604,27 @@ static bool peer_addr_cmp(const struct sockaddr *addr,
 	return false;
 }
 
+static bool tls_session_match(struct tls_session_cache *entry,
+			      const struct sockaddr *peer_addr,
+			      const char *hostname)
+{
+	if (hostname != NULL || entry->hostname != NULL) {
+		return hostname != NULL && entry->hostname != NULL &&
+		       strcmp(entry->hostname, hostname) == 0;
+	}
+
+	return peer_addr_cmp(&entry->peer_addr, peer_addr);
+}
+
+static bool tls_session_expired(struct tls_session_cache *entry)
+{
+	return CONFIG_NET_SOCKETS_TLS_SESSION_LIFETIME > 0 &&
+	       k_uptime_get() - entry->timestamp >
+	       (int64_t)CONFIG_NET_SOCKETS_TLS_SESSION_LIFETIME * MSEC_PER_SEC;
+}
+
 static int tls_session_save(const struct sockaddr *peer_addr,
+			    const char *hostname,
 			    mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -556,7 +638,8 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				entry = &client_cache[i];
 			}
 		} else {
-			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+			if (tls_session_match(&client_cache[i], peer_addr,
+					      hostname)) {
 				/* Reuse old entry for given address. */
 				entry = &client_cache[i];
 				break;
@@ -573,10 +656,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 
 	/* Allocate session and save */
 
-	if (entry->session != NULL) {
-		mbedtls_free(entry->session);
-		entry->session = NULL;
-	}
+	tls_session_entry_free(entry);
 
 	(void)mbedtls_ssl_session_save(session, NULL, 0, &session_len);
 
@@ -590,11 +670,21 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				       &session_len);
 	if (ret < 0) {
 		NET_ERR("Failed to serialize session, err: 0x%x.", -ret);
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_entry_free(entry);
 		return -ENOMEM;
 	}
 
+	if (hostname != NULL) {
+		entry->hostname = mbedtls_calloc(1, strlen(hostname) + 1);
+		if (entry->hostname == NULL) {
+			NET_ERR("Failed to allocate hostname buffer.");
+			tls_session_entry_free(entry);
+			return -ENOMEM;
+		}
+
+		strcpy(entry->hostname, hostname);
+	}
+
 	entry->session_len = session_len;
 	entry->timestamp = k_uptime_get();
 	memcpy(&entry->peer_addr, peer_addr, sizeof(*peer_addr));
@@ -603,6 +693,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 }
 
 static int tls_session_get(const struct sockaddr *peer_addr,
+			   const char *hostname,
 			   mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -610,7 +701,7 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
 		if (client_cache[i].session != NULL &&
-		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+		    tls_session_match(&client_cache[i], peer_addr, hostname)) {
 			entry = &client_cache[i];
 			break;
 		}
@@ -620,18 +711,33 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 		return -ENOENT;
 	}
 
+	if (tls_session_expired(entry)) {
+		tls_session_entry_free(entry);
+		return -ENOENT;
+	}
+
 	ret = mbedtls_ssl_session_load(session, entry->session,
 				       entry->session_len);
 	if (ret < 0) {
 		/* Discard corrupted session data. */
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_entry_free(entry);
 		return -EIO;
 	}
 
 	return 0;
 }
 
+static const char *tls_session_hostname(struct tls_context *context)
+{
+#if defined(MBEDTLS_X509_CRT_PARSE_C)
+	if (context->options.is_hostname_set) {
+		return context->ssl.hostname;
+	}
+#endif
+
+	return NULL;
+}
+
 static void tls_session_store(struct tls_context *context,
 			      const struct sockaddr *addr,
 			      socklen_t addrlen)
@@ -653,7 +759,8 @@ static void tls_session_store(struct tls_context *context,
 		goto exit;
 	}
 
-	ret = tls_session_save(&peer_addr, &session);
+	ret = tls_session_save(&peer_addr, tls_session_hostname(context),
+			       &session);
 	if (ret < 0) {
 		NET_ERR("Failed to save session for %p", context);
 	}
@@ -677,7 +784,8 @@ static void tls_session_restore(struct tls_context *context,
 	memcpy(&peer_addr, addr, addrlen);
 	mbedtls_ssl_session_init(&session);
 
-	ret = tls_session_get(&peer_addr, &session);
+	ret = tls_session_get(&peer_addr, tls_session_hostname(context),
+			      &session);
 	if (ret < 0) {
 		NET_DBG("Session not found for %p", context);
 		goto exit;
@@ -700,6 +808,11 @@ static void tls_session_purge(void)
 	mbedtls_ssl_cache_free(&server_cache);
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+	mbedtls_ssl_ticket_free(&server_ticket);
+	tls_ticket_setup();
+#endif
 }
 
 static inline int time_left(uint32_t start, uint32_t timeout)
@@ -829,6 +942,42 @@ static int dtls_tx(void *ctx, const unsigned char *buf, size_t len)
 	return sent;
 }
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+/* Offset of the Connection ID in a DTLS 1.2 record header: content type,
+ * version, epoch and sequence number.
+ */
+#define DTLS_CID_OFFSET 11
+
+static bool dtls_cid_record_match(struct tls_context *ctx,
+				  const unsigned char *buf, size_t len)
+{
+	size_t cid_len = ctx->options.dtls_cid_len;
+
+	if (ctx->options.dtls_cid != TLS_DTLS_CID_ENABLED || cid_len == 0 ||
+	    !is_handshake_complete(ctx)) {
+		return false;
+	}
+
+	return len > DTLS_CID_OFFSET + cid_len &&
+	       buf[0] == MBEDTLS_SSL_MSG_CID &&
+	       memcmp(&buf[DTLS_CID_OFFSET], ctx->options.dtls_cid_value,
+		      cid_len) == 0;
+}
+
+static void dtls_cid_peer_address_update(struct tls_context *ctx)
+{
+	if (ctx->dtls_cid_peer_addrlen == 0) {
+		return;
+	}
+
+	NET_DBG("DTLS peer address changed for %p", ctx);
+
+	dtls_peer_address_set(ctx, &ctx->dtls_cid_peer_addr,
+			      ctx->dtls_cid_peer_addrlen);
+	ctx->dtls_cid_peer_addrlen = 0;
+}
+#endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
 static int dtls_rx(void *ctx, unsigned char *buf, size_t len)
 {
 	struct tls_context *tls_ctx = ctx;
@@ -865,9 +1014,23 @@ static int dtls_rx(void *ctx, unsigned char *buf, size_t len)
 			return MBEDTLS_ERR_SSL_PEER_VERIFY_FAILED;
 		}
 	} else if (!dtls_is_peer_addr_valid(tls_ctx, &addr, addrlen)) {
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+		if (dtls_cid_record_match(tls_ctx, buf, received)) {
+			/* The peer address may have changed, confirm it once
+			 * the record is authenticated.
+			 */
+			memcpy(&tls_ctx->dtls_cid_peer_addr, &addr, addrlen);
+			tls_ctx->dtls_cid_peer_addrlen = addrlen;
+			return received;
+		}
+#endif
 		return MBEDTLS_ERR_SSL_WANT_READ;
 	}
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	tls_ctx->dtls_cid_peer_addrlen = 0;
+#endif
+
 	return received;
 }
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
@@ -1140,6 +1303,10 @@ static int tls_mbedtls_reset(struct tls_context *context)
 			     sizeof(context->dtls_peer_addr));
 		context->dtls_peer_addrlen = 0;
 	}
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	context->dtls_cid_peer_addrlen = 0;
+#endif
 #endif
 
 	return 0;
@@ -1241,6 +1408,37 @@ static int tls_mbedtls_handshake(struct tls_context *context,
 	return ret;
 }
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+static int tls_mbedtls_cid_conf(struct tls_context *context)
+{
+	int ret;
+
+	if (context->options.dtls_cid == TLS_DTLS_CID_SUPPORTED) {
+		/* Zero-length own Connection ID, only the peer's one is
+		 * used.
+		 */
+		context->options.dtls_cid_len = 0;
+	} else if (context->options.dtls_cid_len == 0) {
+		context->options.dtls_cid_len =
+			sizeof(context->options.dtls_cid_value);
+		ret = tls_ctr_drbg_random(NULL, context->options.dtls_cid_value,
+					  context->options.dtls_cid_len);
+		if (ret != 0) {
+			return -EIO;
+		}
+	}
+
+	ret = mbedtls_ssl_conf_cid(&context->config,
+				   context->options.dtls_cid_len,
+				   MBEDTLS_SSL_UNEXPECTED_CID_IGNORE);
+	if (ret != 0) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+#endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
+
 static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 {
 	int role, type, ret;
@@ -1364,6 +1562,32 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_CLI_C)
+	mbedtls_ssl_conf_session_tickets(&context->config,
+					 context->options.cache_enabled ?
+					 MBEDTLS_SSL_SESSION_TICKETS_ENABLED :
+					 MBEDTLS_SSL_SESSION_TICKETS_DISABLED);
+#endif
+
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_SRV_C)
+	if (is_server && context->options.cache_enabled) {
+		mbedtls_ssl_conf_session_tickets_cb(&context->config,
+						    mbedtls_ssl_ticket_write,
+						    mbedtls_ssl_ticket_parse,
+						    &server_ticket);
+	}
+#endif
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	if (type == MBEDTLS_SSL_TRANSPORT_DATAGRAM &&
+	    context->options.dtls_cid != TLS_DTLS_CID_DISABLED) {
+		ret = tls_mbedtls_cid_conf(context);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+#endif
+
 	ret = mbedtls_ssl_setup(&context->ssl,
 				&context->config);
 	if (ret != 0) {
@@ -1373,6 +1597,18 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 		return -ENOMEM;
 	}
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	if (type == MBEDTLS_SSL_TRANSPORT_DATAGRAM &&
+	    context->options.dtls_cid != TLS_DTLS_CID_DISABLED) {
+		ret = mbedtls_ssl_set_cid(&context->ssl, MBEDTLS_SSL_CID_ENABLED,
+					  context->options.dtls_cid_value,
+					  context->options.dtls_cid_len);
+		if (ret != 0) {
+			return -EINVAL;
+		}
+	}
+#endif
+
 	context->is_initialized = true;
 
 	return 0;
@@ -1613,6 +1849,149 @@ static int tls_opt_dtls_handshake_timeout_set(struct tls_context *context,
 
 	return 0;
 }
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+static int tls_opt_dtls_cid_set(struct tls_context *context,
+				const void *optval, socklen_t optlen)
+{
+	int *val = (int *)optval;
+
+	if (!optval) {
+		return -EINVAL;
+	}
+
+	if (sizeof(int) != optlen) {
+		return -EINVAL;
+	}
+
+	if (*val != TLS_DTLS_CID_DISABLED && *val != TLS_DTLS_CID_SUPPORTED &&
+	    *val != TLS_DTLS_CID_ENABLED) {
+		return -EINVAL;
+	}
+
+	context->options.dtls_cid = *val;
+
+	return 0;
+}
+
+static int tls_opt_dtls_cid_get(struct tls_context *context,
+				void *optval, socklen_t *optlen)
+{
+	if (*optlen != sizeof(int)) {
+		return -EINVAL;
+	}
+
+	*(int *)optval = context->options.dtls_cid;
+
+	return 0;
+}
+
+static int tls_opt_dtls_cid_value_set(struct tls_context *context,
+				      const void *optval, socklen_t optlen)
+{
+	if (!optval || optlen == 0) {
+		return -EINVAL;
+	}
+
+	if (optlen > sizeof(context->options.dtls_cid_value)) {
+		return -EINVAL;
+	}
+
+	memcpy(context->options.dtls_cid_value, optval, optlen);
+	context->options.dtls_cid_len = optlen;
+
+	return 0;
+}
+
+static int tls_opt_dtls_cid_value_get(struct tls_context *context,
+				      void *optval, socklen_t *optlen)
+{
+	if (*optlen < context->options.dtls_cid_len) {
+		return -EINVAL;
+	}
+
+	memcpy(optval, context->options.dtls_cid_value,
+	       context->options.dtls_cid_len);
+	*optlen = context->options.dtls_cid_len;
+
+	return 0;
+}
+
+static int dtls_peer_cid_get(struct tls_context *context,
+			     uint8_t *peer_cid, size_t *peer_cid_len)
+{
+	int enabled = MBEDTLS_SSL_CID_DISABLED;
+	int ret;
+
+	*peer_cid_len = 0;
+
+	if (!is_handshake_complete(context)) {
+		return 0;
+	}
+
+	ret = mbedtls_ssl_get_peer_cid(&context->ssl, &enabled, peer_cid,
+				       peer_cid_len);
+	if (ret != 0) {
+		return -EIO;
+	}
+
+	return enabled == MBEDTLS_SSL_CID_ENABLED ? 1 : 0;
+}
+
+static int tls_opt_dtls_peer_cid_value_get(struct tls_context *context,
+					   void *optval, socklen_t *optlen)
+{
+	uint8_t peer_cid[MBEDTLS_SSL_CID_OUT_LEN_MAX];
+	size_t peer_cid_len;
+	int ret;
+
+	ret = dtls_peer_cid_get(context, peer_cid, &peer_cid_len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (*optlen < peer_cid_len) {
+		return -EINVAL;
+	}
+
+	memcpy(optval, peer_cid, peer_cid_len);
+	*optlen = peer_cid_len;
+
+	return 0;
+}
+
+static int tls_opt_dtls_cid_status_get(struct tls_context *context,
+				       void *optval, socklen_t *optlen)
+{
+	uint8_t peer_cid[MBEDTLS_SSL_CID_OUT_LEN_MAX];
+	size_t peer_cid_len;
+	int status = TLS_DTLS_CID_STATUS_DISABLED;
+	int ret;
+
+	if (*optlen != sizeof(int)) {
+		return -EINVAL;
+	}
+
+	ret = dtls_peer_cid_get(context, peer_cid, &peer_cid_len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ret > 0) {
+		if (context->options.dtls_cid_len > 0) {
+			status |= TLS_DTLS_CID_STATUS_DOWNLINK;
+		}
+
+		if (peer_cid_len > 0) {
+			status |= TLS_DTLS_CID_STATUS_UPLINK;
+		}
+	}
+
+	*(int *)optval = status;
+
+	return 0;
+}
+#endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
 static int tls_opt_alpn_list_get(struct tls_context *context,
@@ -2356,6 +2735,10 @@ static ssize_t recvfrom_dtls_common(struct tls_context *ctx, void *buf,
 			}
 		}
 
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+		dtls_cid_peer_address_update(ctx);
+#endif
+
 		if (src_addr && addrlen) {
 			dtls_peer_address_get(ctx, src_addr, addrlen);
 		}
@@ -3004,6 +3387,24 @@ int ztls_getsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_dtls_handshake_timeout_get(ctx, optval,
 							 optlen, true);
 		break;
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	case TLS_DTLS_CID:
+		err = tls_opt_dtls_cid_get(ctx, optval, optlen);
+		break;
+
+	case TLS_DTLS_CID_VALUE:
+		err = tls_opt_dtls_cid_value_get(ctx, optval, optlen);
+		break;
+
+	case TLS_DTLS_PEER_CID_VALUE:
+		err = tls_opt_dtls_peer_cid_value_get(ctx, optval, optlen);
+		break;
+
+	case TLS_DTLS_CID_STATUS:
+		err = tls_opt_dtls_cid_status_get(ctx, optval, optlen);
+		break;
+#endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
 	default:
@@ -3108,6 +3509,16 @@ int ztls_setsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_dtls_handshake_timeout_set(ctx, optval,
 							 optlen, true);
 		break;
+
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+	case TLS_DTLS_CID:
+		err = tls_opt_dtls_cid_set(ctx, optval, optlen);
+		break;
+
+	case TLS_DTLS_CID_VALUE:
+		err = tls_opt_dtls_cid_value_set(ctx, optval, optlen);
+		break;
+#endif /* MBEDTLS_SSL_DTLS_CONNECTION_ID */
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
 	case TLS_NATIVE:
@@ -3148,7 +3559,9 @@ static int tls_sock_ioctl_vmeth(void *obj, unsigned int request, va_list args)
 	switch (request) {
 	/* fcntl() commands */
 	case F_GETFL:
-	case F_SETFL: {
+	case F_SETFL:
+	/* Watch the underlying socket, readiness is checked through TLS */
+	case ZFD_IOCTL_EPOLL_WATCHERS: {
 		const struct fd_op_vtable *vtable;
 		struct k_mutex *lock;
 		void *obj;
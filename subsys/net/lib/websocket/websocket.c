@@ -274,6 +274,7 @@ int websocket_connect(int sock, struct websocket_request *wreq,
 	}
 
 	ctx->real_sock = sock;
+	ctx->is_server = false;
 	ctx->recv_buf.buf = wreq->tmp_buf;
 	ctx->recv_buf.size = wreq->tmp_buf_len;
 	ctx->sec_accept_key = sec_accept_key;
@@ -404,6 +405,54 @@ out:
 	return ret;
 }
 
+int websocket_register(int sock, uint8_t *recv_buf, size_t recv_buf_len)
+{
+	struct websocket_context *ctx;
+	int ret, fd;
+
+	if (sock < 0 || recv_buf == NULL || recv_buf_len == 0) {
+		return -EINVAL;
+	}
+
+	ctx = websocket_find(sock);
+	if (ctx) {
+		NET_DBG("[%p] Websocket for sock %d already exists!", ctx,
+			sock);
+		return -EEXIST;
+	}
+
+	ctx = websocket_get();
+	if (!ctx) {
+		return -ENOENT;
+	}
+
+	fd = z_reserve_fd();
+	if (fd < 0) {
+		ret = -ENOSPC;
+		goto out;
+	}
+
+	ctx->real_sock = sock;
+	ctx->recv_buf.buf = recv_buf;
+	ctx->recv_buf.size = recv_buf_len;
+	ctx->recv_buf.count = 0;
+	ctx->user_data = NULL;
+	ctx->is_server = true;
+	ctx->parser_state = WEBSOCKET_PARSER_STATE_OPCODE;
+
+	ctx->sock = fd;
+	z_finalize_fd(fd, ctx,
+		      (const struct fd_op_vtable *)&websocket_fd_op_vtable);
+
+	NET_DBG("[%p] WS connection from peer registered (fd %d)", ctx, fd);
+
+	return fd;
+
+out:
+	websocket_context_unref(ctx);
+	return ret;
+}
+
 int websocket_disconnect(int ws_sock)
 {
 	return close(ws_sock);
@@ -419,8 +468,9 @@ static int websocket_interal_disconnect(struct websocket_context *ctx)
 
 	NET_DBG("[%p] Disconnecting", ctx);
 
+	/* Only the client masks the frames it sends */
 	ret = websocket_send_msg(ctx->sock, NULL, 0, WEBSOCKET_OPCODE_CLOSE,
-				 true, true, SYS_FOREVER_MS);
+				 !ctx->is_server, true, SYS_FOREVER_MS);
 	if (ret < 0) {
 		NET_ERR("[%p] Failed to send close message (err %d).", ctx, ret);
 	}
@@ -574,30 +624,66 @@ static int sendmsg_all(int sock, const struct msghdr *message, int flags)
 }
 #endif /* !defined(CONFIG_NET_TEST) */
 
+/* Masks or unmasks the data at @p offset of the payload. The bulk of the
+ * data is handled a word at a time.
+ */
+static void websocket_mask(uint8_t *data, size_t len, uint32_t masking_value,
+			   uint64_t offset)
+{
+	uint8_t key[sizeof(uintptr_t)];
+	uintptr_t word_key, word;
+	size_t i = 0;
+	int j;
+
+	for (; i < len && !IS_PTR_ALIGNED(&data[i], uintptr_t); i++) {
+		data[i] ^= masking_value >> (8 * (3 - (offset + i) % 4));
+	}
+
+	/* key[j] masks the bytes at i + j, i + j + sizeof(key) and so on */
+	for (j = 0; j < sizeof(key); j++) {
+		key[j] = masking_value >> (8 * (3 - (offset + i + j) % 4));
+	}
+
+	memcpy(&word_key, key, sizeof(word_key));
+
+	for (; i + sizeof(word) <= len; i += sizeof(word)) {
+		memcpy(&word, &data[i], sizeof(word));
+		word ^= word_key;
+		memcpy(&data[i], &word, sizeof(word));
+	}
+
+	for (j = 0; i < len; i++, j++) {
+		data[i] ^= key[j];
+	}
+}
+
 static int websocket_prepare_and_send(struct websocket_context *ctx,
 				      uint8_t *header, size_t header_len,
-				      uint8_t *payload, size_t payload_len,
-				      int32_t timeout)
+				      const struct iovec *payload,
+				      int payload_cnt, int32_t timeout)
 {
-	struct iovec io_vector[2];
+	struct iovec io_vector[1 + MAX_PAYLOAD_IOV];
 	struct msghdr msg;
+	int i;
 
 	io_vector[0].iov_base = header;
 	io_vector[0].iov_len = header_len;
-	io_vector[1].iov_base = payload;
-	io_vector[1].iov_len = payload_len;
+
+	/* The vector is modified while it is sent */
+	for (i = 0; i < payload_cnt; i++) {
+		io_vector[1 + i] = payload[i];
+	}
 
 	memset(&msg, 0, sizeof(msg));
 
 	msg.msg_iov = io_vector;
-	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+	msg.msg_iovlen = 1 + payload_cnt;
 
 	if (HEXDUMP_SENT_PACKETS) {
 		LOG_HEXDUMP_DBG(header, header_len, "Header");
-		if ((payload != NULL) && (payload_len > 0)) {
-			LOG_HEXDUMP_DBG(payload, payload_len, "Payload");
-		} else {
-			LOG_DBG("No payload");
+		for (i = 0; i < payload_cnt; i++) {
+			LOG_HEXDUMP_DBG(payload[i].iov_base, payload[i].iov_len,
+					"Payload");
 		}
 	}
 
@@ -618,14 +704,16 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
-int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
-		       enum websocket_opcode opcode, bool mask, bool final,
-		       int32_t timeout)
+int websocket_send_msgv(int ws_sock, const struct iovec *iov, int iovcnt,
+			enum websocket_opcode opcode, bool mask, bool final,
+			int32_t timeout)
 {
 	struct websocket_context *ctx;
 	uint8_t header[MAX_HEADER_LEN], hdr_len = 2;
-	uint8_t *data_to_send = (uint8_t *)payload;
-	int ret;
+	struct iovec masked;
+	uint8_t *data_to_send = NULL;
+	size_t payload_len = 0;
+	int ret, i;
 
 	if (opcode != WEBSOCKET_OPCODE_DATA_TEXT &&
 	    opcode != WEBSOCKET_OPCODE_DATA_BINARY &&
@@ -636,6 +724,11 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		return -EINVAL;
 	}
 
+	if (iovcnt < 0 || iovcnt > MAX_PAYLOAD_IOV ||
+	    (iovcnt > 0 && iov == NULL)) {
+		return -EINVAL;
+	}
+
 	ctx = z_get_fd_obj(ws_sock, NULL, 0);
 	if (ctx == NULL) {
 		return -EBADF;
@@ -651,6 +744,10 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 	}
 #endif /* !defined(CONFIG_NET_TEST) */
 
+	for (i = 0; i < iovcnt; i++) {
+		payload_len += iov[i].iov_len;
+	}
+
 	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
 		mask, final ? "final" : "more");
 
@@ -687,7 +784,7 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
+		size_t offset = 0;
 
 		ctx->masking_value = sys_rand32_get();
 
@@ -696,31 +793,40 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		header[hdr_len++] |= ctx->masking_value >> 8;
 		header[hdr_len++] |= ctx->masking_value;
 
-		if ((payload != NULL) && (payload_len > 0)) {
+		/* The caller data is not modified, the masked payload is
+		 * assembled in a temporary buffer.
+		 */
+		if (payload_len > 0) {
 			data_to_send = k_malloc(payload_len);
 			if (!data_to_send) {
 				return -ENOMEM;
 			}
 
-			memcpy(data_to_send, payload, payload_len);
-
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
+			for (i = 0; i < iovcnt; i++) {
+				memcpy(&data_to_send[offset], iov[i].iov_base,
+				       iov[i].iov_len);
+				offset += iov[i].iov_len;
 			}
+
+			websocket_mask(data_to_send, payload_len,
+				       ctx->masking_value, 0);
+
+			masked.iov_base = data_to_send;
+			masked.iov_len = payload_len;
+			iov = &masked;
+			iovcnt = 1;
 		}
 	}
 
-	ret = websocket_prepare_and_send(ctx, header, hdr_len,
-					 data_to_send, payload_len, timeout);
+	ret = websocket_prepare_and_send(ctx, header, hdr_len, iov, iovcnt,
+					 timeout);
 	if (ret < 0) {
 		NET_DBG("Cannot send ws msg (%d)", -errno);
 		goto quit;
 	}
 
 quit:
-	if (data_to_send != payload) {
-		k_free(data_to_send);
-	}
+	k_free(data_to_send);
 
 	/* Do no math with 0 and error codes */
 	if (ret <= 0) {
@@ -730,6 +836,19 @@ quit:
 	return ret - hdr_len;
 }
 
+int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
+		       enum websocket_opcode opcode, bool mask, bool final,
+		       int32_t timeout)
+{
+	struct iovec iov = {
+		.iov_base = (void *)payload,
+		.iov_len = payload_len,
+	};
+
+	return websocket_send_msgv(ws_sock, &iov, 1, opcode, mask, final,
+				   timeout);
+}
+
 static uint32_t websocket_opcode2flag(uint8_t data)
 {
 	switch (data & 0x0f) {
@@ -945,12 +1064,27 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		size_t parsed_count;
 
 		if (ctx->recv_buf.count == 0) {
+			uint8_t *target = ctx->recv_buf.buf;
+			size_t target_len = ctx->recv_buf.size;
+			bool direct = false;
+
+			/* The payload is received directly in the caller
+			 * buffer, without going through the temporary buffer.
+			 */
+			if (ctx->parser_state == WEBSOCKET_PARSER_STATE_PAYLOAD &&
+			    payload.count < payload.size) {
+				target = &payload.buf[payload.count];
+				target_len = MIN(payload.size - payload.count,
+						 ctx->parser_remaining);
+				direct = true;
+			}
+
 #if defined(CONFIG_NET_TEST)
-			size_t input_len = MIN(ctx->recv_buf.size,
+			size_t input_len = MIN(target_len,
 					       test_data->input_len - test_data->input_pos);
 
 			if (input_len > 0) {
-				memcpy(ctx->recv_buf.buf,
+				memcpy(target,
 				       &test_data->input_buf[test_data->input_pos], input_len);
 				test_data->input_pos += input_len;
 				ret = input_len;
@@ -963,8 +1097,8 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 			ret = wait_rx(ctx->real_sock, timeout_to_ms(&tout));
 			if (ret == 0) {
-				ret = recv(ctx->real_sock, ctx->recv_buf.buf,
-					   ctx->recv_buf.size, MSG_DONTWAIT);
+				ret = recv(ctx->real_sock, target, target_len,
+					   MSG_DONTWAIT);
 				if (ret < 0) {
 					ret = -errno;
 				}
@@ -984,9 +1118,17 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 				return -ENOTCONN;
 			}
 
-			ctx->recv_buf.count = ret;
-
 			NET_DBG("[%p] Received %d bytes", ctx, ret);
+
+			if (direct) {
+				payload.count += ret;
+				ctx->parser_remaining -= ret;
+				if (ctx->parser_remaining == 0) {
+					ctx->parser_state = WEBSOCKET_PARSER_STATE_OPCODE;
+				}
+			} else {
+				ctx->recv_buf.count = ret;
+			}
 		}
 
 		ret = websocket_parse(ctx, &payload);
@@ -1017,17 +1159,10 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	} while (true);
 
-	/* Unmask the data */
+	/* Unmask the data in place */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
-		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
-
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask(payload.buf, payload.count, ctx->masking_value,
+			       ctx->message_len - ctx->parser_remaining - payload.count);
 	}
 
 	return payload.count;
@@ -20,6 +20,9 @@
 /* Max Websocket header length */
 #define MAX_HEADER_LEN 14
 
+/* Max number of payload parts of a vectored send */
+#define MAX_PAYLOAD_IOV 8
+
 /* From RFC 6455 chapter 4.2.2 */
 #define WS_MAGIC "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
 
@@ -119,6 +122,9 @@ __net_socket struct websocket_context {
 
 	/** Did we receive all from peer during HTTP handshake */
 	uint8_t all_received : 1;
+
+	/** Is this the server side of the connection */
+	uint8_t is_server : 1;
 };
 
 #if defined(CONFIG_NET_TEST)
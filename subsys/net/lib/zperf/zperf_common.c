@@ -202,12 +202,83 @@ int zperf_prepare_upload_sock(const struct sockaddr *peer_addr, int tos,
 	return sock;
 }
 
+/* Returns the number of sockets opened, one per stream */
+int zperf_prepare_upload_socks(const struct zperf_upload_params *param,
+			       int proto, int *socks)
+{
+	int num_socks = MAX(param->options.num_streams, 1);
+	int i;
+
+	if (num_socks > CONFIG_NET_ZPERF_MAX_STREAMS) {
+		NET_ERR("Too many streams (max %d)", CONFIG_NET_ZPERF_MAX_STREAMS);
+		return -EINVAL;
+	}
+
+	for (i = 0; i < num_socks; i++) {
+		socks[i] = zperf_prepare_upload_sock(&param->peer_addr,
+						     param->options.tos, proto);
+		if (socks[i] < 0) {
+			int ret = socks[i];
+
+			zperf_close_upload_socks(socks, i);
+			return ret;
+		}
+	}
+
+	return num_socks;
+}
+
+void zperf_close_upload_socks(int *socks, int num_socks)
+{
+	int i;
+
+	for (i = 0; i < num_socks; i++) {
+		zsock_close(socks[i]);
+	}
+}
+
 uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps)
 {
 	return (uint32_t)(((uint64_t)packet_size * 8U * USEC_PER_SEC) /
 			  (rate_in_kbps * 1024U));
 }
 
+void zperf_cpu_usage_start(struct zperf_cpu_usage *usage)
+{
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	(void)k_thread_runtime_stats_all_get(&usage->start);
+#else
+	ARG_UNUSED(usage);
+#endif
+}
+
+/* Returns the share of non-idle cycles since zperf_cpu_usage_start(),
+ * in percent.
+ */
+uint32_t zperf_cpu_usage_get(struct zperf_cpu_usage *usage)
+{
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	k_thread_runtime_stats_t now;
+	uint64_t busy, total;
+
+	if (k_thread_runtime_stats_all_get(&now) < 0) {
+		return 0;
+	}
+
+	busy = now.total_cycles - usage->start.total_cycles;
+	total = now.execution_cycles - usage->start.execution_cycles;
+	if (total == 0) {
+		return 0;
+	}
+
+	return (uint32_t)((busy * 100U) / total);
+#else
+	ARG_UNUSED(usage);
+
+	return 0;
+#endif
+}
+
 void zperf_async_work_submit(struct k_work *work)
 {
 	k_work_submit_to_queue(&zperf_work_q, work);
@@ -82,6 +82,12 @@ struct zperf_async_upload_context {
 	void *user_data;
 };
 
+struct zperf_cpu_usage {
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	k_thread_runtime_stats_t start;
+#endif
+};
+
 static inline uint32_t time_delta(uint32_t ts, uint32_t t)
 {
 	return (t >= ts) ? (t - ts) : (ULONG_MAX - ts + t);
@@ -101,8 +107,15 @@ const struct in6_addr *zperf_get_default_if_in6_addr(void);
 int zperf_prepare_upload_sock(const struct sockaddr *peer_addr, int tos,
 			      int proto);
 
+int zperf_prepare_upload_socks(const struct zperf_upload_params *param,
+			       int proto, int *socks);
+void zperf_close_upload_socks(int *socks, int num_socks);
+
 uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps);
 
+void zperf_cpu_usage_start(struct zperf_cpu_usage *usage);
+uint32_t zperf_cpu_usage_get(struct zperf_cpu_usage *usage);
+
 void zperf_async_work_submit(struct k_work *work);
 void zperf_udp_uploader_init(void);
 void zperf_tcp_uploader_init(void);
@@ -423,6 +423,11 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "\t(");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, ")\n");
+
+		if (IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)) {
+			shell_fprintf(sh, SHELL_NORMAL, "CPU usage:\t\t%u %%\n",
+				      results->cpu_usage);
+		}
 	}
 }
 
@@ -456,6 +461,86 @@ static void shell_tcp_upload_print_stats(const struct shell *sh,
 		shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t");
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
+
+		if (IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)) {
+			shell_fprintf(sh, SHELL_NORMAL, "CPU usage:\t%u %%\n",
+				      results->cpu_usage);
+		}
+	}
+}
+
+static uint32_t rate_kbps(uint64_t len, uint32_t time_in_us)
+{
+	if (time_in_us == 0U) {
+		return 0U;
+	}
+
+	return (uint32_t)((len * 8ULL * USEC_PER_SEC) /
+			  ((uint64_t)time_in_us * 1024ULL));
+}
+
+static void shell_upload_print_json(const struct shell *sh,
+				    const struct zperf_upload_params *param,
+				    bool is_udp,
+				    struct zperf_results *results)
+{
+	uint64_t client_len = (uint64_t)results->nb_packets_sent *
+			      results->packet_size;
+
+	shell_fprintf(sh, SHELL_NORMAL,
+		      "{\"proto\":\"%s\",\"streams\":%u,"
+		      "\"duration_us\":%u,\"packet_size\":%u,"
+		      "\"packets_sent\":%u,\"packets_rcvd\":%u,"
+		      "\"packets_lost\":%u,\"packets_outorder\":%u,"
+		      "\"errors\":%u,\"jitter_us\":%u,\"rate_kbps\":%u,"
+		      "\"client_rate_kbps\":%u,\"cpu_usage\":%u}\n",
+		      is_udp ? "udp" : "tcp",
+		      MAX(param->options.num_streams, 1),
+		      results->client_time_in_us, results->packet_size,
+		      results->nb_packets_sent, results->nb_packets_rcvd,
+		      results->nb_packets_lost, results->nb_packets_outorder,
+		      results->nb_packets_errors, results->jitter_in_us,
+		      rate_kbps(results->total_len, results->time_in_us),
+		      rate_kbps(client_len, results->client_time_in_us),
+		      results->cpu_usage);
+}
+
+static void shell_latency_print_stats(const struct shell *sh,
+				      struct zperf_latency_results *results,
+				      bool json)
+{
+	if (json) {
+		shell_fprintf(sh, SHELL_NORMAL,
+			      "{\"proto\":\"udp\",\"mode\":\"latency\","
+			      "\"duration_us\":%u,\"packets_sent\":%u,"
+			      "\"packets_rcvd\":%u,\"min_us\":%u,"
+			      "\"avg_us\":%u,\"p50_us\":%u,\"p99_us\":%u,"
+			      "\"p999_us\":%u,\"max_us\":%u,"
+			      "\"cpu_usage\":%u}\n",
+			      results->client_time_in_us,
+			      results->nb_packets_sent, results->nb_packets_rcvd,
+			      results->min_us, results->avg_us, results->p50_us,
+			      results->p99_us, results->p999_us, results->max_us,
+			      results->cpu_usage);
+		return;
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "-\nLatency measurement completed!\n");
+	shell_fprintf(sh, SHELL_NORMAL, "Duration:\t");
+	print_number(sh, results->client_time_in_us, TIME_US, TIME_US_UNIT);
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
+	shell_fprintf(sh, SHELL_NORMAL, "Num packets:\t%u\t(%u replies)\n",
+		      results->nb_packets_sent, results->nb_packets_rcvd);
+	shell_fprintf(sh, SHELL_NORMAL,
+		      "Round trip:\tmin %u us, avg %u us, max %u us\n",
+		      results->min_us, results->avg_us, results->max_us);
+	shell_fprintf(sh, SHELL_NORMAL,
+		      "Percentiles:\tp50 %u us, p99 %u us, p99.9 %u us\n",
+		      results->p50_us, results->p99_us, results->p999_us);
+
+	if (IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)) {
+		shell_fprintf(sh, SHELL_NORMAL, "CPU usage:\t%u %%\n",
+			      results->cpu_usage);
 	}
 }
 
@@ -503,7 +588,7 @@ static void tcp_upload_cb(enum zperf_status status,
 
 static int execute_upload(const struct shell *sh,
 			  const struct zperf_upload_params *param,
-			  bool is_udp, bool async)
+			  bool is_udp, bool async, bool json)
 {
 	struct zperf_results results = { 0 };
 	int ret;
@@ -516,6 +601,10 @@ static int execute_upload(const struct shell *sh,
 		      param->packet_size);
 	shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t%u kbps\n",
 		      param->rate_kbps);
+	if (param->options.num_streams > 1) {
+		shell_fprintf(sh, SHELL_NORMAL, "Streams:\t%u\n",
+			      param->options.num_streams);
+	}
 	shell_fprintf(sh, SHELL_NORMAL, "Starting...\n");
 
 	if (IS_ENABLED(CONFIG_NET_IPV6) && param->peer_addr.sa_family == AF_INET6) {
@@ -563,7 +652,12 @@ static int execute_upload(const struct shell *sh,
 				return ret;
 			}
 
-			shell_udp_upload_print_stats(sh, &results);
+			if (json) {
+				shell_upload_print_json(sh, param, is_udp,
+							&results);
+			} else {
+				shell_udp_upload_print_stats(sh, &results);
+			}
 		}
 	} else {
 		if (!IS_ENABLED(CONFIG_NET_UDP)) {
@@ -589,7 +683,12 @@ static int execute_upload(const struct shell *sh,
 				return ret;
 			}
 
-			shell_tcp_upload_print_stats(sh, &results);
+			if (json) {
+				shell_upload_print_json(sh, param, is_udp,
+							&results);
+			} else {
+				shell_tcp_upload_print_stats(sh, &results);
+			}
 		}
 	} else {
 		if (!IS_ENABLED(CONFIG_NET_TCP)) {
@@ -601,6 +700,44 @@ static int execute_upload(const struct shell *sh,
 	return 0;
 }
 
+static int execute_latency(const struct shell *sh,
+			   const struct zperf_upload_params *param, bool json)
+{
+#if defined(CONFIG_NET_ZPERF_LATENCY)
+	struct zperf_latency_results results = { 0 };
+	int ret;
+
+	shell_fprintf(sh, SHELL_NORMAL, "Duration:\t");
+	print_number(sh, param->duration_ms * USEC_PER_MSEC, TIME_US,
+		     TIME_US_UNIT);
+	shell_fprintf(sh, SHELL_NORMAL, "\n");
+	shell_fprintf(sh, SHELL_NORMAL, "Packet size:\t%u bytes\n",
+		      param->packet_size);
+	shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t%u kbps\n",
+		      param->rate_kbps);
+	shell_fprintf(sh, SHELL_NORMAL, "Starting...\n");
+
+	ret = zperf_udp_latency(param, &results);
+	if (ret < 0) {
+		shell_fprintf(sh, SHELL_ERROR,
+			      "UDP latency measurement failed (%d)\n", ret);
+		return ret;
+	}
+
+	shell_latency_print_stats(sh, &results, json);
+
+	return 0;
+#else
+	ARG_UNUSED(param);
+	ARG_UNUSED(json);
+
+	shell_fprintf(sh, SHELL_INFO, "UDP latency support is not enabled. "
+		      "Set CONFIG_NET_ZPERF_LATENCY=y in your config file.\n");
+
+	return -ENOTSUP;
+#endif
+}
+
 static int parse_arg(size_t *i, size_t argc, char *argv[])
 {
 	int res = -1;
@@ -631,13 +768,15 @@ static int parse_arg(size_t *i, size_t argc, char *argv[])
 }
 
 static int shell_cmd_upload(const struct shell *sh, size_t argc,
-			     char *argv[], enum net_ip_protocol proto)
+			     char *argv[], enum net_ip_protocol proto,
+			     bool latency)
 {
 	struct zperf_upload_params param = { 0 };
 	struct sockaddr_in6 ipv6 = { .sin6_family = AF_INET6 };
 	struct sockaddr_in ipv4 = { .sin_family = AF_INET };
 	char *port_str;
 	bool async = false;
+	bool json = false;
 	bool is_udp;
 	int start = 0;
 	size_t opt_cnt = 0;
@@ -670,6 +809,25 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+		case 'j':
+			json = true;
+			opt_cnt += 1;
+			break;
+
+		case 'P': {
+			int streams = parse_arg(&i, argc, argv);
+
+			if (streams < 1 || streams > CONFIG_NET_ZPERF_MAX_STREAMS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.num_streams = streams;
+			opt_cnt += 2;
+			break;
+		}
+
 		case 'n':
 			if (is_udp) {
 				shell_fprintf(sh, SHELL_WARNING,
@@ -687,6 +845,19 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 		}
 	}
 
+	if (latency && (async || param.options.num_streams > 1)) {
+		shell_fprintf(sh, SHELL_WARNING,
+			      "The -a and -P options are not supported "
+			      "for latency measurements\n");
+		return -ENOEXEC;
+	}
+
+	if (async && json) {
+		shell_fprintf(sh, SHELL_WARNING,
+			      "The -j option is not supported with -a\n");
+		return -ENOEXEC;
+	}
+
 	start += opt_cnt;
 	argc -= opt_cnt;
 
@@ -792,17 +963,26 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 		param.rate_kbps = 10U;
 	}
 
-	return execute_upload(sh, &param, is_udp, async);
+	if (latency) {
+		return execute_latency(sh, &param, json);
+	}
+
+	return execute_upload(sh, &param, is_udp, async, json);
 }
 
 static int cmd_tcp_upload(const struct shell *sh, size_t argc, char *argv[])
 {
-	return shell_cmd_upload(sh, argc, argv, IPPROTO_TCP);
+	return shell_cmd_upload(sh, argc, argv, IPPROTO_TCP, false);
 }
 
 static int cmd_udp_upload(const struct shell *sh, size_t argc, char *argv[])
 {
-	return shell_cmd_upload(sh, argc, argv, IPPROTO_UDP);
+	return shell_cmd_upload(sh, argc, argv, IPPROTO_UDP, false);
+}
+
+static int cmd_udp_latency(const struct shell *sh, size_t argc, char *argv[])
+{
+	return shell_cmd_upload(sh, argc, argv, IPPROTO_UDP, true);
 }
 
 static int shell_cmd_upload2(const struct shell *sh, size_t argc,
@@ -812,6 +992,7 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 	sa_family_t family;
 	uint8_t is_udp;
 	bool async = false;
+	bool json = false;
 	int start = 0;
 	size_t opt_cnt = 0;
 
@@ -843,6 +1024,25 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+		case 'j':
+			json = true;
+			opt_cnt += 1;
+			break;
+
+		case 'P': {
+			int streams = parse_arg(&i, argc, argv);
+
+			if (streams < 1 || streams > CONFIG_NET_ZPERF_MAX_STREAMS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.num_streams = streams;
+			opt_cnt += 2;
+			break;
+		}
+
 		case 'n':
 			if (is_udp) {
 				shell_fprintf(sh, SHELL_WARNING,
@@ -860,6 +1060,12 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 		}
 	}
 
+	if (async && json) {
+		shell_fprintf(sh, SHELL_WARNING,
+			      "The -j option is not supported with -a\n");
+		return -ENOEXEC;
+	}
+
 	start += opt_cnt;
 	argc -= opt_cnt;
 
@@ -930,7 +1136,7 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 		param.rate_kbps = 10U;
 	}
 
-	return execute_upload(sh, &param, is_udp, async);
+	return execute_upload(sh, &param, is_udp, async, json);
 }
 
 static int cmd_tcp_upload2(const struct shell *sh, size_t argc,
@@ -1136,7 +1342,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp_download,
 SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 	SHELL_CMD(upload, NULL,
 		  "[<options>] <dest ip> <dest port> <duration> <packet size>[K]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -P num -j]\n"
 		  "<dest ip>     IP destination\n"
 		  "<dest port>   port destination\n"
 		  "<duration>    of the test in seconds\n"
@@ -1145,13 +1351,15 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
+		  "-P num: Number of parallel streams\n"
+		  "-j: Print the results in JSON format (not with -a)\n"
 		  "-n: Disable Nagle's algorithm\n"
 		  "Example: tcp upload 192.0.2.2 1111 1 1K\n"
 		  "Example: tcp upload 2001:db8::2\n",
 		  cmd_tcp_upload),
 	SHELL_CMD(upload2, NULL,
 		  "[<options>] v6|v4 <duration> <packet size>[K] <baud rate>[K|M]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -P num -j]\n"
 		  "<v6|v4>:      Use either IPv6 or IPv4\n"
 		  "<duration>    Duration of the test in seconds\n"
 		  "<packet size> Size of the packet in byte or kilobyte "
@@ -1159,6 +1367,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
+		  "-P num: Number of parallel streams\n"
+		  "-j: Print the results in JSON format (not with -a)\n"
 		  "Example: tcp upload2 v6 1 1K\n"
 		  "Example: tcp upload2 v4\n"
 		  "-n: Disable Nagle's algorithm\n"
@@ -1188,7 +1398,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 	SHELL_CMD(upload, NULL,
 		  "[<options>] <dest ip> [<dest port> <duration> <packet size>[K] "
 							"<baud rate>[K|M]]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -P num -j]\n"
 		  "<dest ip>     IP destination\n"
 		  "<dest port>   port destination\n"
 		  "<duration>    of the test in seconds\n"
@@ -1198,12 +1408,14 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
+		  "-P num: Number of parallel streams\n"
+		  "-j: Print the results in JSON format (not with -a)\n"
 		  "Example: udp upload 192.0.2.2 1111 1 1K 1M\n"
 		  "Example: udp upload 2001:db8::2\n",
 		  cmd_udp_upload),
 	SHELL_CMD(upload2, NULL,
 		  "[<options>] v6|v4 [<duration> <packet size>[K] <baud rate>[K|M]]\n"
-		  "<options>     command options (optional): [-S tos -a]\n"
+		  "<options>     command options (optional): [-S tos -a -P num -j]\n"
 		  "<v6|v4>:      Use either IPv6 or IPv4\n"
 		  "<duration>    Duration of the test in seconds\n"
 		  "<packet size> Size of the packet in byte or kilobyte "
@@ -1212,6 +1424,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "Available options:\n"
 		  "-S tos: Specify IPv4/6 type of service\n"
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
+		  "-P num: Number of parallel streams\n"
+		  "-j: Print the results in JSON format (not with -a)\n"
 		  "Example: udp upload2 v4 1 1K 1M\n"
 		  "Example: udp upload2 v6\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
@@ -1224,6 +1438,23 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #endif
 		  ,
 		  cmd_udp_upload2),
+	SHELL_CMD(latency, NULL,
+		  "[<options>] <dest ip> [<dest port> <duration> <packet size>[K] "
+							"<baud rate>[K|M]]\n"
+		  "<options>     command options (optional): [-S tos -j]\n"
+		  "<dest ip>     IP address of a UDP echo server\n"
+		  "<dest port>   port of the echo server\n"
+		  "<duration>    of the test in seconds\n"
+		  "<packet size> Size of the packet in byte or kilobyte "
+							"(with suffix K)\n"
+		  "<baud rate>   Baudrate in kilobyte or megabyte\n"
+		  "Measures the round-trip time of the datagrams and reports "
+		  "its median, 99th and 99.9th percentiles.\n"
+		  "Available options:\n"
+		  "-S tos: Specify IPv4/6 type of service\n"
+		  "-j: Print the results in JSON format\n"
+		  "Example: udp latency 192.0.2.2 4242 10 64 100K\n",
+		  cmd_udp_latency),
 	SHELL_CMD(download, &zperf_cmd_udp_download,
 		  "[<port>]\n"
 		  "Example: udp download 5001\n",
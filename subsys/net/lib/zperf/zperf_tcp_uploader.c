@@ -20,7 +20,7 @@ static char sample_packet[PACKET_SIZE_MAX];
 
 static struct zperf_async_upload_context tcp_async_upload_ctx;
 
-static int tcp_upload(int sock,
+static int tcp_upload(int *socks, int num_socks,
 		      unsigned int duration_in_ms,
 		      unsigned int packet_size,
 		      struct zperf_results *results)
@@ -29,6 +29,8 @@ static int tcp_upload(int sock,
 	int64_t start_time, end_time;
 	uint32_t nb_packets = 0U, nb_errors = 0U;
 	uint32_t alloc_errors = 0U;
+	struct zperf_cpu_usage usage;
+	int stream = 0;
 	int ret = 0;
 
 	if (packet_size > PACKET_SIZE_MAX) {
@@ -39,6 +41,7 @@ static int tcp_upload(int sock,
 
 	/* Start the loop */
 	start_time = k_uptime_ticks();
+	zperf_cpu_usage_start(&usage);
 
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
@@ -49,8 +52,9 @@ static int tcp_upload(int sock,
 	(void)memset(sample_packet, 0, sizeof(uint32_t));
 
 	do {
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		/* Send the packet, the streams taking turns */
+		ret = zsock_send(socks[stream], sample_packet, packet_size, 0);
+		stream = (stream + 1) % num_socks;
 		if (ret < 0) {
 			if (nb_errors == 0 && ret != -ENOMEM) {
 				NET_ERR("Failed to send the packet (%d)", errno);
@@ -84,6 +88,7 @@ static int tcp_upload(int sock,
 	end_time = k_uptime_ticks();
 
 	/* Add result coming from the client */
+	results->cpu_usage = zperf_cpu_usage_get(&usage);
 	results->nb_packets_sent = nb_packets;
 	results->client_time_in_us =
 				k_ticks_to_us_ceil32(end_time - start_time);
@@ -109,30 +114,34 @@ static int tcp_upload(int sock,
 int zperf_tcp_upload(const struct zperf_upload_params *param,
 		     struct zperf_results *result)
 {
-	int sock;
+	int socks[CONFIG_NET_ZPERF_MAX_STREAMS];
+	int num_socks;
 	int ret;
 
 	if (param == NULL || result == NULL) {
 		return -EINVAL;
 	}
 
-	sock = zperf_prepare_upload_sock(&param->peer_addr, param->options.tos,
-					 IPPROTO_TCP);
-	if (sock < 0) {
-		return sock;
+	num_socks = zperf_prepare_upload_socks(param, IPPROTO_TCP, socks);
+	if (num_socks < 0) {
+		return num_socks;
 	}
 
-	if (param->options.tcp_nodelay &&
-	    zsock_setsockopt(sock, IPPROTO_TCP, TCP_NODELAY,
-			     &param->options.tcp_nodelay,
-			     sizeof(param->options.tcp_nodelay)) != 0) {
-		NET_WARN("Failed to set IPPROTO_TCP - TCP_NODELAY socket option.");
-		return -EINVAL;
+	for (int i = 0; i < num_socks; i++) {
+		if (param->options.tcp_nodelay &&
+		    zsock_setsockopt(socks[i], IPPROTO_TCP, TCP_NODELAY,
+				     &param->options.tcp_nodelay,
+				     sizeof(param->options.tcp_nodelay)) != 0) {
+			NET_WARN("Failed to set IPPROTO_TCP - TCP_NODELAY socket option.");
+			zperf_close_upload_socks(socks, num_socks);
+			return -EINVAL;
+		}
 	}
 
-	ret = tcp_upload(sock, param->duration_ms, param->packet_size, result);
+	ret = tcp_upload(socks, num_socks, param->duration_ms,
+			 param->packet_size, result);
 
-	zsock_close(sock);
+	zperf_close_upload_socks(socks, num_socks);
 
 	return ret;
 }
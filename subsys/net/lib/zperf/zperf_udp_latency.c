@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/zperf.h>
+
+#include "zperf_internal.h"
+
+/* Round-trip times are counted in a log-linear histogram: values below
+ * HIST_SUB us are exact, larger ones fall in one of the HIST_SUB buckets
+ * between two powers of two.
+ */
+#define HIST_SUB_BITS 4
+#define HIST_SUB BIT(HIST_SUB_BITS)
+#define HIST_SIZE ((32 - HIST_SUB_BITS + 1) * HIST_SUB)
+
+#define REPLY_TIMEOUT_SEC 1
+
+static uint8_t sample_packet[PACKET_SIZE_MAX];
+
+/* Like the uploaders, only one measurement runs at a time */
+static uint32_t latency_hist[HIST_SIZE];
+
+static int hist_index(uint32_t value)
+{
+	int shift;
+
+	if (value < HIST_SUB) {
+		return value;
+	}
+
+	shift = 31 - __builtin_clz(value) - HIST_SUB_BITS;
+
+	return (shift + 1) * HIST_SUB + (value >> shift) - HIST_SUB;
+}
+
+/* Highest value counted in a bucket */
+static uint32_t hist_value(int index)
+{
+	int shift;
+
+	if (index < HIST_SUB) {
+		return index;
+	}
+
+	shift = index / HIST_SUB - 1;
+
+	return (((uint64_t)HIST_SUB + index % HIST_SUB + 1) << shift) - 1;
+}
+
+/* The percentile is given in parts per ten thousand */
+static uint32_t hist_percentile(uint32_t count, uint32_t percentile)
+{
+	uint32_t rank = DIV_ROUND_UP((uint64_t)count * percentile, 10000U);
+	uint32_t seen = 0U;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(latency_hist); i++) {
+		seen += latency_hist[i];
+		if (seen >= rank && seen > 0U) {
+			return hist_value(i);
+		}
+	}
+
+	return 0U;
+}
+
+/* Returns 0 and the round-trip time once the reply to the request seq is
+ * received, -EAGAIN if it did not come back in time.
+ */
+static int latency_wait_reply(int sock, uint32_t seq, uint32_t sent,
+			      uint32_t *rtt_us)
+{
+	struct zperf_udp_datagram reply;
+	int ret;
+
+	while (true) {
+		ret = zsock_recv(sock, &reply, sizeof(reply), 0);
+		if (ret < 0) {
+			return errno == EAGAIN ? -EAGAIN : -errno;
+		}
+
+		/* Replies to earlier requests came back too late */
+		if (ret == sizeof(reply) && ntohl(reply.id) == seq) {
+			break;
+		}
+	}
+
+	*rtt_us = k_cyc_to_us_floor32(k_cycle_get_32() - sent);
+
+	return 0;
+}
+
+static int udp_latency(int sock, unsigned int duration_in_ms,
+		       unsigned int packet_size, unsigned int rate_in_kbps,
+		       struct zperf_latency_results *results)
+{
+	uint32_t packet_duration = k_us_to_ticks_ceil32(
+		zperf_packet_duration(packet_size, rate_in_kbps));
+	k_timepoint_t end = sys_timepoint_calc(K_MSEC(duration_in_ms));
+	struct zperf_udp_datagram *datagram =
+		(struct zperf_udp_datagram *)sample_packet;
+	struct zperf_cpu_usage usage;
+	int64_t start_time, next_time;
+	uint64_t rtt_sum = 0U;
+	int ret = 0;
+
+	memset(results, 0, sizeof(*results));
+	memset(latency_hist, 0, sizeof(latency_hist));
+	(void)memset(sample_packet, 'z', sizeof(sample_packet));
+
+	results->min_us = UINT32_MAX;
+
+	start_time = k_uptime_ticks();
+	next_time = start_time;
+	zperf_cpu_usage_start(&usage);
+
+	do {
+		uint32_t seq = results->nb_packets_sent;
+		uint32_t rtt_us;
+		uint32_t sent;
+		int64_t now;
+
+		datagram->id = htonl(seq);
+		datagram->tv_sec = 0U;
+		datagram->tv_usec = 0U;
+
+		sent = k_cycle_get_32();
+
+		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		if (ret < 0) {
+			NET_ERR("Failed to send the packet (%d)", errno);
+			ret = -errno;
+			break;
+		}
+
+		results->nb_packets_sent++;
+
+		ret = latency_wait_reply(sock, seq, sent, &rtt_us);
+		if (ret == 0) {
+			results->nb_packets_rcvd++;
+			results->min_us = MIN(results->min_us, rtt_us);
+			results->max_us = MAX(results->max_us, rtt_us);
+			rtt_sum += rtt_us;
+			latency_hist[hist_index(rtt_us)]++;
+		} else if (ret != -EAGAIN) {
+			NET_ERR("Failed to receive the reply (%d)", ret);
+			break;
+		}
+
+		ret = 0;
+
+		/* Keep the requested rate, a reply arriving late delays
+		 * the next request.
+		 */
+		next_time += packet_duration;
+		now = k_uptime_ticks();
+		if (next_time > now) {
+			k_sleep(K_TICKS(next_time - now));
+		}
+	} while (!sys_timepoint_expired(end));
+
+	results->cpu_usage = zperf_cpu_usage_get(&usage);
+	results->client_time_in_us =
+		k_ticks_to_us_ceil32(k_uptime_ticks() - start_time);
+
+	if (results->nb_packets_rcvd == 0U) {
+		results->min_us = 0U;
+		return ret;
+	}
+
+	results->avg_us = rtt_sum / results->nb_packets_rcvd;
+	results->p50_us = MIN(hist_percentile(results->nb_packets_rcvd, 5000U),
+			      results->max_us);
+	results->p99_us = MIN(hist_percentile(results->nb_packets_rcvd, 9900U),
+			      results->max_us);
+	results->p999_us = MIN(hist_percentile(results->nb_packets_rcvd, 9990U),
+			       results->max_us);
+
+	return ret;
+}
+
+int zperf_udp_latency(const struct zperf_upload_params *param,
+		      struct zperf_latency_results *result)
+{
+	struct timeval rcvtimeo = {
+		.tv_sec = REPLY_TIMEOUT_SEC,
+		.tv_usec = 0,
+	};
+	unsigned int packet_size;
+	int sock;
+	int ret;
+
+	if (param == NULL || result == NULL || param->rate_kbps == 0U) {
+		return -EINVAL;
+	}
+
+	packet_size = CLAMP(param->packet_size,
+			    sizeof(struct zperf_udp_datagram), PACKET_SIZE_MAX);
+
+	sock = zperf_prepare_upload_sock(&param->peer_addr, param->options.tos,
+					 IPPROTO_UDP);
+	if (sock < 0) {
+		return sock;
+	}
+
+	ret = zsock_setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &rcvtimeo,
+			       sizeof(rcvtimeo));
+	if (ret < 0) {
+		NET_ERR("setsockopt error (%d)", errno);
+		ret = -errno;
+	} else {
+		ret = udp_latency(sock, param->duration_ms, packet_size,
+				  param->rate_kbps, result);
+	}
+
+	zsock_close(sock);
+
+	return ret;
+}
@@ -131,7 +131,19 @@ static inline int zperf_upload_fin(int sock,
 	return 0;
 }
 
-static int udp_upload(int sock, int port,
+/* Sums the server statistics of the streams */
+static void zperf_upload_merge_stat(struct zperf_results *results,
+				    const struct zperf_results *stream)
+{
+	results->nb_packets_rcvd += stream->nb_packets_rcvd;
+	results->nb_packets_lost += stream->nb_packets_lost;
+	results->nb_packets_outorder += stream->nb_packets_outorder;
+	results->total_len += stream->total_len;
+	results->time_in_us = MAX(results->time_in_us, stream->time_in_us);
+	results->jitter_in_us = MAX(results->jitter_in_us, stream->jitter_in_us);
+}
+
+static int udp_upload(int *socks, int num_socks, int port,
 		      unsigned int duration_in_ms,
 		      unsigned int packet_size,
 		      unsigned int rate_in_kbps,
@@ -140,7 +152,10 @@ static int udp_upload(int sock, int port,
 	uint32_t packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps);
 	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
 	uint32_t delay = packet_duration;
+	uint32_t stream_packets[CONFIG_NET_ZPERF_MAX_STREAMS] = { 0 };
 	uint32_t nb_packets = 0U;
+	struct zperf_cpu_usage usage;
+	int stream = 0;
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
 	uint32_t print_period;
@@ -158,6 +173,7 @@ static int udp_upload(int sock, int port,
 
 	/* Start the loop */
 	start_time = k_uptime_ticks();
+	zperf_cpu_usage_start(&usage);
 	last_loop_time = start_time;
 	end_time = start_time + k_ms_to_ticks_ceil64(duration_in_ms);
 
@@ -203,7 +219,7 @@ static int udp_upload(int sock, int port,
 		/* Fill the packet header */
 		datagram = (struct zperf_udp_datagram *)sample_packet;
 
-		datagram->id = htonl(nb_packets);
+		datagram->id = htonl(stream_packets[stream]);
 		datagram->tv_sec = htonl(secs);
 		datagram->tv_usec = htonl(usecs);
 
@@ -217,15 +233,18 @@ static int udp_upload(int sock, int port,
 		hdr->bandwidth = htonl(rate_in_kbps);
 		hdr->num_of_bytes = htonl(packet_size);
 
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		/* Send the packet, the streams taking turns */
+		ret = zsock_send(socks[stream], sample_packet, packet_size, 0);
 		if (ret < 0) {
 			NET_ERR("Failed to send the packet (%d)", errno);
 			return -errno;
 		} else {
+			stream_packets[stream]++;
 			nb_packets++;
 		}
 
+		stream = (stream + 1) % num_socks;
+
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
 			if (print_time >= loop_time) {
 				NET_DBG("nb_packets=%u\tdelay=%u\tadjust=%d",
@@ -247,10 +266,19 @@ static int udp_upload(int sock, int port,
 
 	end_time = k_uptime_ticks();
 
-	ret = zperf_upload_fin(sock, nb_packets, end_time, packet_size,
-			       results);
-	if (ret < 0) {
-		return ret;
+	memset(results, 0, sizeof(*results));
+	results->cpu_usage = zperf_cpu_usage_get(&usage);
+
+	for (stream = 0; stream < num_socks; stream++) {
+		struct zperf_results stream_results = { 0 };
+
+		ret = zperf_upload_fin(socks[stream], stream_packets[stream],
+				       end_time, packet_size, &stream_results);
+		if (ret < 0) {
+			return ret;
+		}
+
+		zperf_upload_merge_stat(results, &stream_results);
 	}
 
 	/* Add result coming from the client */
@@ -265,8 +293,9 @@ static int udp_upload(int sock, int port,
 int zperf_udp_upload(const struct zperf_upload_params *param,
 		     struct zperf_results *result)
 {
+	int socks[CONFIG_NET_ZPERF_MAX_STREAMS];
+	int num_socks;
 	int port = 0;
-	int sock;
 	int ret;
 
 	if (param == NULL || result == NULL) {
@@ -283,16 +312,15 @@ int zperf_udp_upload(const struct zperf_upload_params *param,
 		return -EINVAL;
 	}
 
-	sock = zperf_prepare_upload_sock(&param->peer_addr, param->options.tos,
-					 IPPROTO_UDP);
-	if (sock < 0) {
-		return sock;
+	num_socks = zperf_prepare_upload_socks(param, IPPROTO_UDP, socks);
+	if (num_socks < 0) {
+		return num_socks;
 	}
 
-	ret = udp_upload(sock, port, param->duration_ms, param->packet_size,
-			 param->rate_kbps, result);
+	ret = udp_upload(socks, num_socks, port, param->duration_ms,
+			 param->packet_size, param->rate_kbps, result);
 
-	zsock_close(sock);
+	zperf_close_upload_socks(socks, num_socks);
 
 	return ret;
 }
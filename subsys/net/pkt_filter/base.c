@@ -46,6 +46,13 @@ struct npf_rule_list npf_ipv6_recv_rules = {
 };
 #endif /* CONFIG_NET_PKT_FILTER_IPV6_HOOK */
 
+#ifdef CONFIG_NET_PKT_FILTER_CAPTURE_HOOK
+struct npf_rule_list npf_capture_rules = {
+	.rule_head = SYS_SLIST_STATIC_INIT(&capture_rules.rule_head),
+	.lock = { },
+};
+#endif /* CONFIG_NET_PKT_FILTER_CAPTURE_HOOK */
+
 /*
  * Helper function
  */
@@ -119,10 +126,174 @@ static enum net_verdict evaluate(sys_slist_t *rule_head, struct net_pkt *pkt)
 	return NET_DROP;
 }
 
+/*
+ * Reads the transport protocol from the IP header and, for TCP and UDP,
+ * the ports at the start of the transport header. IPv6 extension headers
+ * are not walked. Returns true if the ports were read.
+ */
+static bool pkt_ports_get(struct net_pkt *pkt, uint8_t *proto,
+			  uint16_t *src_port, uint16_t *dst_port)
+{
+	struct net_pkt_cursor backup;
+	bool overwrite;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		*proto = NET_IPV4_HDR(pkt)->proto;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		*proto = NET_IPV6_HDR(pkt)->nexthdr;
+	} else {
+		*proto = 0;
+		return false;
+	}
+
+	if (*proto != IPPROTO_TCP && *proto != IPPROTO_UDP) {
+		return false;
+	}
+
+	overwrite = net_pkt_is_being_overwritten(pkt);
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	ret = net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt));
+	if (ret == 0) {
+		ret = net_pkt_read_be16(pkt, src_port);
+	}
+	if (ret == 0) {
+		ret = net_pkt_read_be16(pkt, dst_port);
+	}
+
+	net_pkt_cursor_restore(pkt, &backup);
+	net_pkt_set_overwrite(pkt, overwrite);
+
+	return ret == 0;
+}
+
+#if defined(CONFIG_NET_PKT_FILTER_VERDICT_CACHE)
+static bool is_flow_addr_test(struct npf_test *test)
+{
+	return test->fn == npf_ip_src_addr_match || test->fn == npf_ip_src_addr_unmatch ||
+	       test->fn == npf_src_port_inbounds || test->fn == npf_dst_port_inbounds;
+}
+
+/*
+ * Tests whose result only depends on the fields of the flow key.
+ */
+static bool is_flow_test(struct npf_test *test)
+{
+	return test->fn == npf_iface_match || test->fn == npf_iface_unmatch ||
+	       test->fn == npf_orig_iface_match || test->fn == npf_orig_iface_unmatch ||
+	       is_flow_addr_test(test);
+}
+
+/* Must be called with the rule list lock held */
+static void cache_update(struct npf_rule_list *rules)
+{
+	struct npf_rule *rule;
+	unsigned int i;
+
+	rules->cacheable = true;
+	rules->cache_flow = false;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&rules->rule_head, rule, node) {
+		for (i = 0; i < rule->nb_tests; i++) {
+			struct npf_test *test = rule->tests[i];
+
+			if (!is_flow_test(test)) {
+				rules->cacheable = false;
+			}
+
+			if (is_flow_addr_test(test)) {
+				rules->cache_flow = true;
+			}
+		}
+	}
+
+	memset(rules->cache, 0, sizeof(rules->cache));
+}
+
+/* Reads the same packet fields as the flow tests do */
+static void flow_key_get(struct npf_rule_list *rules, struct net_pkt *pkt,
+			 struct npf_flow_key *key)
+{
+	memset(key, 0, sizeof(*key));
+
+	key->iface = net_pkt_iface(pkt);
+	key->orig_iface = net_pkt_orig_iface(pkt);
+
+	if (!rules->cache_flow) {
+		return;
+	}
+
+	key->family = net_pkt_family(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && key->family == AF_INET) {
+		memcpy(key->src_addr, NET_IPV4_HDR(pkt)->src, sizeof(struct in_addr));
+		memcpy(key->dst_addr, NET_IPV4_HDR(pkt)->dst, sizeof(struct in_addr));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && key->family == AF_INET6) {
+		memcpy(key->src_addr, NET_IPV6_HDR(pkt)->src, sizeof(struct in6_addr));
+		memcpy(key->dst_addr, NET_IPV6_HDR(pkt)->dst, sizeof(struct in6_addr));
+	}
+
+	if (!pkt_ports_get(pkt, &key->proto, &key->src_port, &key->dst_port)) {
+		key->src_port = 0U;
+		key->dst_port = 0U;
+	}
+}
+
+static struct npf_verdict_cache_entry *cache_entry(struct npf_rule_list *rules,
+						    const struct npf_flow_key *key)
+{
+	const uint8_t *data = (const uint8_t *)key;
+	uint32_t hash = 2166136261U;
+
+	/* FNV-1a */
+	for (size_t i = 0; i < sizeof(*key); i++) {
+		hash = (hash ^ data[i]) * 16777619U;
+	}
+
+	return &rules->cache[hash % ARRAY_SIZE(rules->cache)];
+}
+
+static enum net_verdict cache_evaluate(struct npf_rule_list *rules, struct net_pkt *pkt)
+{
+	struct npf_verdict_cache_entry *entry;
+	struct npf_flow_key key;
+
+	if (!rules->cacheable) {
+		return evaluate(&rules->rule_head, pkt);
+	}
+
+	flow_key_get(rules, pkt, &key);
+	entry = cache_entry(rules, &key);
+
+	if (entry->valid && memcmp(&entry->key, &key, sizeof(key)) == 0) {
+		NET_DBG("cached verdict %d for pkt %p", entry->result, pkt);
+		return entry->result;
+	}
+
+	memcpy(&entry->key, &key, sizeof(key));
+	entry->result = evaluate(&rules->rule_head, pkt);
+	entry->valid = true;
+
+	return entry->result;
+}
+#else
+static inline void cache_update(struct npf_rule_list *rules)
+{
+	ARG_UNUSED(rules);
+}
+#endif /* CONFIG_NET_PKT_FILTER_VERDICT_CACHE */
+
 static enum net_verdict lock_evaluate(struct npf_rule_list *rules, struct net_pkt *pkt)
 {
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
+#if defined(CONFIG_NET_PKT_FILTER_VERDICT_CACHE)
+	enum net_verdict result = cache_evaluate(rules, pkt);
+#else
 	enum net_verdict result = evaluate(&rules->rule_head, pkt);
+#endif
 
 	k_spin_unlock(&rules->lock, key);
 	return result;
@@ -151,6 +322,15 @@ bool net_pkt_filter_local_in_recv_ok(struct net_pkt *pkt)
 }
 #endif /* CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK */
 
+#ifdef CONFIG_NET_PKT_FILTER_CAPTURE_HOOK
+bool net_pkt_filter_capture_ok(struct net_pkt *pkt)
+{
+	enum net_verdict result = lock_evaluate(&npf_capture_rules, pkt);
+
+	return result == NET_OK;
+}
+#endif /* CONFIG_NET_PKT_FILTER_CAPTURE_HOOK */
+
 #if defined(CONFIG_NET_PKT_FILTER_IPV4_HOOK) || defined(CONFIG_NET_PKT_FILTER_IPV6_HOOK)
 bool net_pkt_filter_ip_recv_ok(struct net_pkt *pkt)
 {
@@ -177,6 +357,7 @@ void npf_insert_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 
 	NET_DBG("inserting rule %p into %p", rule, rules);
 	sys_slist_prepend(&rules->rule_head, &rule->node);
+	cache_update(rules);
 
 	k_spin_unlock(&rules->lock, key);
 }
@@ -190,6 +371,7 @@ void npf_append_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 
 	NET_DBG("appending rule %p into %p", rule, rules);
 	sys_slist_append(&rules->rule_head, &rule->node);
+	cache_update(rules);
 
 	k_spin_unlock(&rules->lock, key);
 }
@@ -199,6 +381,7 @@ bool npf_remove_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
 	bool result = sys_slist_find_and_remove(&rules->rule_head, &rule->node);
 
+	cache_update(rules);
 	k_spin_unlock(&rules->lock, key);
 	NET_DBG("removing rule %p from %p: %d", rule, rules, result);
 	return result;
@@ -211,6 +394,7 @@ bool npf_remove_all_rules(struct npf_rule_list *rules)
 
 	if (result) {
 		sys_slist_init(&rules->rule_head);
+		cache_update(rules);
 		NET_DBG("removing all rules from %p", rules);
 	}
 
@@ -297,3 +481,31 @@ bool npf_ip_src_addr_unmatch(struct npf_test *test, struct net_pkt *pkt)
 {
 	return !npf_ip_src_addr_match(test, pkt);
 }
+
+bool npf_src_port_inbounds(struct npf_test *test, struct net_pkt *pkt)
+{
+	struct npf_test_port_bounds *bounds =
+			CONTAINER_OF(test, struct npf_test_port_bounds, test);
+	uint16_t src_port, dst_port;
+	uint8_t proto;
+
+	if (!pkt_ports_get(pkt, &proto, &src_port, &dst_port)) {
+		return false;
+	}
+
+	return src_port >= bounds->min && src_port <= bounds->max;
+}
+
+bool npf_dst_port_inbounds(struct npf_test *test, struct net_pkt *pkt)
+{
+	struct npf_test_port_bounds *bounds =
+			CONTAINER_OF(test, struct npf_test_port_bounds, test);
+	uint16_t src_port, dst_port;
+	uint8_t proto;
+
+	if (!pkt_ports_get(pkt, &proto, &src_port, &dst_port)) {
+		return false;
+	}
+
+	return dst_port >= bounds->min && dst_port <= bounds->max;
+}
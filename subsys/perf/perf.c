@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/perf/perf.h>
+#include <ksched.h>
+
+static uint32_t events;
+
+/* Counters are started on a CPU when they are first read on it */
+static bool started[CONFIG_MP_MAX_NUM_CPUS];
+
+#ifdef CONFIG_SYS_PERF_THREAD
+static struct k_spinlock lock;
+#endif
+
+/* Called with interrupts locked */
+static void cpu_read(struct sys_perf_snapshot *snapshot)
+{
+	uint8_t cpu = _current_cpu->id;
+
+	if (!started[cpu]) {
+		(void)arch_perf_init();
+		started[cpu] = true;
+	}
+
+	arch_perf_read(snapshot->raw);
+}
+
+uint32_t sys_perf_events_get(void)
+{
+	return events;
+}
+
+void sys_perf_snapshot(struct sys_perf_snapshot *snapshot)
+{
+	unsigned int key = arch_irq_lock();
+
+	memset(snapshot, 0, sizeof(*snapshot));
+	cpu_read(snapshot);
+	arch_irq_unlock(key);
+}
+
+void sys_perf_elapsed(const struct sys_perf_snapshot *start,
+		      const struct sys_perf_snapshot *end,
+		      struct sys_perf_counters *counters)
+{
+	for (int i = 0; i < SYS_PERF_EVENTS; i++) {
+		counters->count[i] = (events & BIT(i)) != 0 ?
+				     (uint32_t)(end->raw[i] - start->raw[i]) : 0;
+	}
+}
+
+#ifdef CONFIG_SYS_PERF_THREAD
+void z_sys_perf_switch(struct k_thread *from, struct k_thread *to)
+{
+	struct sys_perf_snapshot now;
+	struct sys_perf_counters elapsed;
+	k_spinlock_key_t key;
+
+	memset(&now, 0, sizeof(now));
+	cpu_read(&now);
+
+	key = k_spin_lock(&lock);
+
+	if (from != NULL) {
+		sys_perf_elapsed(&from->perf_start, &now, &elapsed);
+		for (int i = 0; i < SYS_PERF_EVENTS; i++) {
+			from->perf.count[i] += elapsed.count[i];
+		}
+	}
+
+	if (to != NULL) {
+		to->perf_start = now;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+int sys_perf_thread_get(k_tid_t thread, struct sys_perf_counters *counters)
+{
+	struct sys_perf_snapshot now;
+	struct sys_perf_counters elapsed;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+	*counters = thread->perf;
+
+	if (thread == _current) {
+		memset(&now, 0, sizeof(now));
+		cpu_read(&now);
+		sys_perf_elapsed(&thread->perf_start, &now, &elapsed);
+		for (int i = 0; i < SYS_PERF_EVENTS; i++) {
+			counters->count[i] += elapsed.count[i];
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+#else
+int sys_perf_thread_get(k_tid_t thread, struct sys_perf_counters *counters)
+{
+	ARG_UNUSED(thread);
+	ARG_UNUSED(counters);
+
+	return -ENOTSUP;
+}
+#endif /* CONFIG_SYS_PERF_THREAD */
+
+static int sys_perf_init(void)
+{
+	unsigned int key = arch_irq_lock();
+
+	events = arch_perf_init();
+	started[_current_cpu->id] = true;
+	arch_irq_unlock(key);
+
+	return 0;
+}
+
+SYS_INIT(sys_perf_init, PRE_KERNEL_2, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -24,6 +24,115 @@ LOG_MODULE_DECLARE(pm_device, CONFIG_PM_DEVICE_LOG_LEVEL);
 
 #define EVENT_MASK		(EVENT_STATE_ACTIVE | EVENT_STATE_SUSPENDED)
 
+static void runtime_suspend_finish(struct pm_device *pm);
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH
+static void batch_work_handler(struct k_work *work);
+
+/** Devices waiting for the batched suspend */
+static sys_slist_t batch_list = SYS_SLIST_STATIC_INIT(&batch_list);
+static struct k_spinlock batch_lock;
+static K_WORK_DELAYABLE_DEFINE(batch_work, batch_work_handler);
+
+static void batch_work_handler(struct k_work *work)
+{
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		key = k_spin_lock(&batch_lock);
+		node = sys_slist_get(&batch_list);
+		k_spin_unlock(&batch_lock, key);
+
+		if (node == NULL) {
+			break;
+		}
+
+		runtime_suspend_finish(CONTAINER_OF(node, struct pm_device, batch_node));
+	}
+}
+
+static void batch_add(struct pm_device *pm)
+{
+	k_spinlock_key_t key = k_spin_lock(&batch_lock);
+
+	sys_slist_append(&batch_list, &pm->batch_node);
+	k_spin_unlock(&batch_lock, key);
+
+	/* the first put opens the batch window, the following ones join it */
+	(void)k_work_schedule(&batch_work,
+			      K_MSEC(CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH_DELAY_MS));
+}
+
+/** @brief Remove a device from the batch if its suspend has not started. */
+static bool batch_cancel(struct pm_device *pm)
+{
+	k_spinlock_key_t key = k_spin_lock(&batch_lock);
+	bool found = sys_slist_find_and_remove(&batch_list, &pm->batch_node);
+
+	k_spin_unlock(&batch_lock, key);
+
+	return found;
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH */
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+static void stats_resume(struct pm_device *pm, uint32_t start, bool waited)
+{
+	uint32_t cyc = k_cycle_get_32() - start;
+
+	pm->stats.resume_count++;
+	if (waited) {
+		pm->stats.resume_wait_count++;
+	}
+	pm->stats.resume_last_cyc = cyc;
+	pm->stats.resume_max_cyc = MAX(pm->stats.resume_max_cyc, cyc);
+	pm->stats.resume_total_cyc += cyc;
+}
+
+static void stats_resume_avoided(struct pm_device *pm)
+{
+	pm->stats.resume_avoided_count++;
+}
+#else
+#define stats_resume(...)
+#define stats_resume_avoided(...)
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+
+/**
+ * @brief Check if a get can be served without resuming the device.
+ *
+ * This is the case if its batched suspend has not started yet, or if it
+ * holds a reference taken to resume it ahead. Called with the lock held.
+ */
+static bool runtime_get_avoided(struct pm_device *pm)
+{
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH
+	if ((pm->state == PM_DEVICE_STATE_SUSPENDING) && batch_cancel(pm)) {
+		/* the power domain stays claimed, as the suspend did not happen */
+		pm->usage++;
+		pm->state = PM_DEVICE_STATE_ACTIVE;
+		stats_resume_avoided(pm);
+		return true;
+	}
+#endif
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+	if (atomic_test_and_clear_bit(&pm->flags, PM_DEVICE_FLAG_RUNTIME_AHEAD)) {
+		/* take over the reference of the resume ahead */
+		(void)k_work_cancel_delayable(&pm->ahead_work);
+		stats_resume_avoided(pm);
+		return true;
+	}
+#endif
+
+	ARG_UNUSED(pm);
+
+	return false;
+}
+
 /**
  * @brief Suspend a device
  *
@@ -77,7 +186,11 @@ static int runtime_suspend(const struct device *dev, bool async)
 	if (async && !k_is_pre_kernel()) {
 		/* queue suspend */
 		pm->state = PM_DEVICE_STATE_SUSPENDING;
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC_BATCH
+		batch_add(pm);
+#else
 		(void)k_work_schedule(&pm->work, K_NO_WAIT);
+#endif
 	} else {
 		/* suspend now */
 		ret = pm->action_cb(pm->dev, PM_DEVICE_ACTION_SUSPEND);
@@ -97,11 +210,10 @@ unlock:
 	return ret;
 }
 
-static void runtime_suspend_work(struct k_work *work)
+/** @brief Complete a suspend queued by pm_device_runtime_put_async(). */
+static void runtime_suspend_finish(struct pm_device *pm)
 {
 	int ret;
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct pm_device *pm = CONTAINER_OF(dwork, struct pm_device, work);
 
 	ret = pm->action_cb(pm->dev, PM_DEVICE_ACTION_SUSPEND);
 
@@ -126,16 +238,27 @@ static void runtime_suspend_work(struct k_work *work)
 	__ASSERT(ret == 0, "Could not suspend device (%d)", ret);
 }
 
-int pm_device_runtime_get(const struct device *dev)
+static void runtime_suspend_work(struct k_work *work)
 {
-	int ret = 0;
-	struct pm_device *pm = dev->pm;
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct pm_device *pm = CONTAINER_OF(dwork, struct pm_device, work);
 
-	if (pm == NULL) {
-		return 0;
-	}
+	runtime_suspend_finish(pm);
+}
 
-	SYS_PORT_TRACING_FUNC_ENTER(pm, device_runtime_get, dev);
+/**
+ * @brief Resume a device based on usage count
+ *
+ * @param dev Device instance.
+ * @param wait Wait for an asynchronous suspend to complete, -EWOULDBLOCK is
+ * returned instead otherwise.
+ */
+static int runtime_get(const struct device *dev, bool wait)
+{
+	int ret = 0;
+	struct pm_device *pm = dev->pm;
+	uint32_t start = 0U;
+	bool waited = false;
 
 	/*
 	 * Early return if device runtime is not enabled.
@@ -144,14 +267,22 @@ int pm_device_runtime_get(const struct device *dev)
 		return 0;
 	}
 
+	if (IS_ENABLED(CONFIG_PM_DEVICE_RUNTIME_STATS)) {
+		start = k_cycle_get_32();
+	}
+
 	if (!k_is_pre_kernel()) {
 		ret = k_sem_take(&pm->lock, k_is_in_isr() ? K_NO_WAIT : K_FOREVER);
 		if (ret < 0) {
 			return -EWOULDBLOCK;
 		}
+
+		if (runtime_get_avoided(pm)) {
+			goto unlock;
+		}
 	}
 
-	if (k_is_in_isr() && (pm->state == PM_DEVICE_STATE_SUSPENDING)) {
+	if (!wait && (pm->state == PM_DEVICE_STATE_SUSPENDING)) {
 		ret = -EWOULDBLOCK;
 		goto unlock;
 	}
@@ -183,6 +314,7 @@ int pm_device_runtime_get(const struct device *dev)
 			k_sem_give(&pm->lock);
 
 			k_event_wait(&pm->event, EVENT_MASK, true, K_FOREVER);
+			waited = true;
 
 			(void)k_sem_take(&pm->lock, K_FOREVER);
 		}
@@ -199,17 +331,99 @@ int pm_device_runtime_get(const struct device *dev)
 	}
 
 	pm->state = PM_DEVICE_STATE_ACTIVE;
+	stats_resume(pm, start, waited);
 
 unlock:
 	if (!k_is_pre_kernel()) {
 		k_sem_give(&pm->lock);
 	}
 
+	return ret;
+}
+
+int pm_device_runtime_get(const struct device *dev)
+{
+	int ret;
+
+	if (dev->pm == NULL) {
+		return 0;
+	}
+
+	SYS_PORT_TRACING_FUNC_ENTER(pm, device_runtime_get, dev);
+	ret = runtime_get(dev, !k_is_in_isr());
 	SYS_PORT_TRACING_FUNC_EXIT(pm, device_runtime_get, dev, ret);
 
 	return ret;
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+static void runtime_ahead_work(struct k_work *work)
+{
+	int ret;
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct pm_device *pm = CONTAINER_OF(dwork, struct pm_device, ahead_work);
+
+	if (atomic_test_and_clear_bit(&pm->flags, PM_DEVICE_FLAG_RUNTIME_AHEAD)) {
+		/* no get within the hold time */
+		(void)pm_device_runtime_put_async(pm->dev);
+		return;
+	}
+
+	/*
+	 * Do not wait for an asynchronous suspend, it may be queued behind
+	 * this work item. Try again once it had a chance to complete.
+	 */
+	ret = runtime_get(pm->dev, false);
+	if (ret == -EWOULDBLOCK) {
+		(void)k_work_schedule(&pm->ahead_work, K_TICKS(1));
+		return;
+	}
+
+	if (ret == 0) {
+		atomic_set_bit(&pm->flags, PM_DEVICE_FLAG_RUNTIME_AHEAD);
+		(void)k_work_schedule(&pm->ahead_work,
+				      K_MSEC(CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD_HOLD_MS));
+	}
+}
+
+int pm_device_runtime_resume_ahead(const struct device *dev, k_timeout_t delay)
+{
+	struct pm_device *pm = dev->pm;
+
+	if (!pm_device_runtime_is_enabled(dev)) {
+		return -ENOTSUP;
+	}
+
+	if (atomic_test_bit(&pm->flags, PM_DEVICE_FLAG_RUNTIME_AHEAD)) {
+		/* already resumed ahead, extend the hold */
+		(void)k_work_reschedule(&pm->ahead_work,
+					K_MSEC(CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD_HOLD_MS));
+	} else {
+		(void)k_work_schedule(&pm->ahead_work, delay);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+int pm_device_runtime_stats_get(const struct device *dev,
+				struct pm_device_runtime_stats *stats)
+{
+	struct pm_device *pm = dev->pm;
+
+	if (pm == NULL) {
+		return -ENOTSUP;
+	}
+
+	(void)k_sem_take(&pm->lock, K_FOREVER);
+	*stats = pm->stats;
+	k_sem_give(&pm->lock);
+
+	return 0;
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+
 int pm_device_runtime_put(const struct device *dev)
 {
 	int ret;
@@ -290,6 +504,9 @@ int pm_device_runtime_enable(const struct device *dev)
 	if (pm->dev == NULL) {
 		pm->dev = dev;
 		k_work_init_delayable(&pm->work, runtime_suspend_work);
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+		k_work_init_delayable(&pm->ahead_work, runtime_ahead_work);
+#endif
 	}
 
 	if (pm->state == PM_DEVICE_STATE_ACTIVE) {
@@ -354,6 +571,14 @@ int pm_device_runtime_disable(const struct device *dev)
 		pm->state = PM_DEVICE_STATE_ACTIVE;
 	}
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+	/* drop the reference of a pending resume ahead */
+	(void)k_work_cancel_delayable(&pm->ahead_work);
+	if (atomic_test_and_clear_bit(&pm->flags, PM_DEVICE_FLAG_RUNTIME_AHEAD)) {
+		pm->usage--;
+	}
+#endif
+
 	atomic_clear_bit(&pm->flags, PM_DEVICE_FLAG_RUNTIME_ENABLED);
 
 unlock:
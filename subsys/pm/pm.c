@@ -174,6 +174,7 @@ bool pm_system_suspend(int32_t ticks)
 {
 	uint8_t id = CURRENT_CPU;
 	k_spinlock_key_t key;
+	uint32_t idle_start = 0;
 
 	SYS_PORT_TRACING_FUNC_ENTER(pm, system_suspend, ticks);
 
@@ -237,7 +238,13 @@ bool pm_system_suspend(int32_t ticks)
 	/* Enter power state */
 	pm_state_notify(true);
 	atomic_set_bit(z_post_ops_required, id);
+	if (IS_ENABLED(CONFIG_PM_POLICY_PREDICTIVE)) {
+		idle_start = k_cycle_get_32();
+	}
 	pm_state_set(z_cpus_pm_state[id].state, z_cpus_pm_state[id].substate_id);
+	if (IS_ENABLED(CONFIG_PM_POLICY_PREDICTIVE)) {
+		pm_policy_residency_update(id, k_cycle_get_32() - idle_start);
+	}
 	pm_stats_stop();
 
 	/* Wake up sequence starts here */
@@ -246,7 +253,7 @@ bool pm_system_suspend(int32_t ticks)
 		pm_resume_devices();
 	}
 #endif
-	pm_stats_update(z_cpus_pm_state[id].state);
+	pm_stats_update(&z_cpus_pm_state[id]);
 	pm_system_resume();
 	k_sched_unlock();
 	SYS_PORT_TRACING_FUNC_EXIT(pm, system_suspend, ticks,
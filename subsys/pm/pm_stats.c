@@ -9,6 +9,7 @@
 
 #include <zephyr/init.h>
 #include <zephyr/kernel.h>
+#include <zephyr/pm/policy.h>
 #include <zephyr/stats/stats.h>
 #include <zephyr/sys/printk.h>
 
@@ -16,12 +17,16 @@ STATS_SECT_START(pm_stats)
 STATS_SECT_ENTRY32(state_count)
 STATS_SECT_ENTRY32(state_last_cycles)
 STATS_SECT_ENTRY32(state_total_cycles)
+STATS_SECT_ENTRY32(state_too_deep)
+STATS_SECT_ENTRY32(state_too_shallow)
 STATS_SECT_END;
 
 STATS_NAME_START(pm_stats)
 STATS_NAME(pm_stats, state_count)
 STATS_NAME(pm_stats, state_last_cycles)
 STATS_NAME(pm_stats, state_total_cycles)
+STATS_NAME(pm_stats, state_too_deep)
+STATS_NAME(pm_stats, state_too_shallow)
 STATS_NAME_END(pm_stats);
 
 static STATS_SECT_DECL(pm_stats) stats[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT];
@@ -40,7 +45,7 @@ static int pm_stats_init(void)
 		for (uint8_t j = 0U; j < PM_STATE_COUNT; j++) {
 			snprintk(names[i][j], PM_STAT_NAME_LEN,
 				 "pm_cpu_%03d_state_%1d_stats", i, j);
-			stats_init(&(stats[i][j].s_hdr), STATS_SIZE_32, 3U,
+			stats_init(&(stats[i][j].s_hdr), STATS_SIZE_32, 5U,
 				   STATS_NAME_INIT_PARMS(pm_stats));
 			stats_register(names[i][j], &(stats[i][j].s_hdr));
 		}
@@ -61,12 +66,45 @@ void pm_stats_stop(void)
 	time_stop[_current_cpu->id] = k_cycle_get_32();
 }
 
-void pm_stats_update(enum pm_state state)
+/*
+ * A state was too deep if the CPU woke up before its minimum residency, and
+ * too shallow if a deeper state which is not locked would have fit.
+ */
+static void pm_stats_check_state(uint8_t cpu, const struct pm_state_info *info,
+				 uint32_t time_total)
+{
+	const struct pm_state_info *cpu_states;
+	uint8_t num_cpu_states;
+	uint32_t time_us = k_cyc_to_us_floor32(time_total);
+
+	if (time_us < info->min_residency_us) {
+		STATS_INC(stats[cpu][info->state], state_too_deep);
+		return;
+	}
+
+	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+
+	for (uint8_t i = 0U; i < num_cpu_states; i++) {
+		const struct pm_state_info *state = &cpu_states[i];
+
+		if (state->min_residency_us > info->min_residency_us &&
+		    time_us >= state->min_residency_us + state->exit_latency_us &&
+		    !pm_policy_state_lock_is_active(state->state, state->substate_id)) {
+			STATS_INC(stats[cpu][info->state], state_too_shallow);
+			return;
+		}
+	}
+}
+
+void pm_stats_update(const struct pm_state_info *info)
 {
 	uint8_t cpu = _current_cpu->id;
+	enum pm_state state = info->state;
 	uint32_t time_total = time_stop[cpu] - time_start[cpu];
 
 	STATS_INC(stats[cpu][state], state_count);
 	STATS_INCN(stats[cpu][state], state_total_cycles, time_total);
 	STATS_SET(stats[cpu][state], state_last_cycles, time_total);
+
+	pm_stats_check_state(cpu, info, time_total);
 }
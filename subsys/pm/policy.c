@@ -129,19 +129,16 @@ static void update_next_event(uint32_t cyc)
 	next_event_cyc = new_next_event_cyc;
 }
 
-#ifdef CONFIG_PM_POLICY_DEFAULT
-const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+#if defined(CONFIG_PM_POLICY_DEFAULT) || defined(CONFIG_PM_POLICY_PREDICTIVE)
+/** @brief Cycles until the next wakeup (<0: none) */
+static int64_t next_wakeup_cyc(int32_t ticks)
 {
 	int64_t cyc = -1;
-	uint8_t num_cpu_states;
-	const struct pm_state_info *cpu_states;
 
 	if (ticks != K_TICKS_FOREVER) {
 		cyc = k_ticks_to_cyc_ceil32(ticks);
 	}
 
-	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
-
 	if (next_event_cyc >= 0) {
 		uint32_t cyc_curr = k_cycle_get_32();
 		int64_t cyc_evt = next_event_cyc - cyc_curr;
@@ -163,31 +160,174 @@ const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 		}
 	}
 
+	return cyc;
+}
+
+/**
+ * @brief Check if a state can be used for an idle duration.
+ *
+ * @param state Power state.
+ * @param cyc Idle duration in cycles (<0: unbounded).
+ */
+static bool state_fits(const struct pm_state_info *state, int64_t cyc)
+{
+	uint32_t min_residency_cyc, exit_latency_cyc;
+
+	/* check if there is a lock on state + substate */
+	if (pm_policy_state_lock_is_active(state->state, state->substate_id)) {
+		return false;
+	}
+
+	min_residency_cyc = k_us_to_cyc_ceil32(state->min_residency_us);
+	exit_latency_cyc = k_us_to_cyc_ceil32(state->exit_latency_us);
+
+	/* skip state if it brings too much latency */
+	if ((max_latency_cyc >= 0) &&
+	    (exit_latency_cyc >= max_latency_cyc)) {
+		return false;
+	}
+
+	return (cyc < 0) || (cyc >= (min_residency_cyc + exit_latency_cyc));
+}
+
+/** @brief Deepest state of a CPU which can be used for an idle duration. */
+static const struct pm_state_info *state_select(uint8_t cpu, int64_t cyc)
+{
+	uint8_t num_cpu_states;
+	const struct pm_state_info *cpu_states;
+
+	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+
 	for (int16_t i = (int16_t)num_cpu_states - 1; i >= 0; i--) {
-		const struct pm_state_info *state = &cpu_states[i];
-		uint32_t min_residency_cyc, exit_latency_cyc;
+		if (state_fits(&cpu_states[i], cyc)) {
+			return &cpu_states[i];
+		}
+	}
+
+	return NULL;
+}
+#endif
+
+#ifdef CONFIG_PM_POLICY_DEFAULT
+const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+{
+	return state_select(cpu, next_wakeup_cyc(ticks));
+}
+#endif
+
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+/** Idle durations above this value, in us, are recorded as this value */
+#define IDLE_US_MAX BIT_MASK(24)
 
-		/* check if there is a lock on state + substate */
-		if (pm_policy_state_lock_is_active(state->state, state->substate_id)) {
-			continue;
+/** Recent idle durations of a CPU, in us. */
+static struct {
+	uint32_t idle_us[CONFIG_PM_POLICY_PREDICTIVE_HISTORY];
+	uint8_t next;
+	uint8_t count;
+} idle_history[CONFIG_MP_MAX_NUM_CPUS];
+
+/**
+ * @brief Typical idle duration of a CPU in us (<0: none).
+ *
+ * As in the menu governor of Linux, the longest idle durations are dropped
+ * as outliers until the standard deviation of the remaining ones is at most
+ * a sixth of their average. There is no typical duration if more than a
+ * quarter of the history would have to be dropped.
+ */
+static int64_t typical_idle_us(uint8_t cpu)
+{
+	const uint32_t *idle_us = idle_history[cpu].idle_us;
+	uint32_t threshold = UINT32_MAX;
+
+	if (idle_history[cpu].count < CONFIG_PM_POLICY_PREDICTIVE_HISTORY) {
+		return -1;
+	}
+
+	while (true) {
+		uint64_t sum = 0U, variance = 0U, avg;
+		uint32_t max = 0U;
+		uint8_t num = 0U;
+
+		for (uint8_t i = 0U; i < CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+			if (idle_us[i] <= threshold) {
+				sum += idle_us[i];
+				max = MAX(max, idle_us[i]);
+				num++;
+			}
+		}
+
+		if ((num * 4U) < (CONFIG_PM_POLICY_PREDICTIVE_HISTORY * 3U)) {
+			return -1;
 		}
 
-		min_residency_cyc = k_us_to_cyc_ceil32(state->min_residency_us);
-		exit_latency_cyc = k_us_to_cyc_ceil32(state->exit_latency_us);
+		avg = sum / num;
 
-		/* skip state if it brings too much latency */
-		if ((max_latency_cyc >= 0) &&
-		    (exit_latency_cyc >= max_latency_cyc)) {
-			continue;
+		for (uint8_t i = 0U; i < CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+			if (idle_us[i] <= threshold) {
+				int64_t diff = (int64_t)idle_us[i] - (int64_t)avg;
+
+				variance += (uint64_t)(diff * diff);
+			}
 		}
 
-		if ((cyc < 0) ||
-		    (cyc >= (min_residency_cyc + exit_latency_cyc))) {
-			return state;
+		variance /= num;
+
+		/* durations are at most 24 bits, so this can't overflow */
+		if ((variance * 36U) <= (avg * avg)) {
+			return avg;
 		}
+
+		threshold = max - 1U;
 	}
+}
 
-	return NULL;
+void pm_policy_residency_update(uint8_t cpu, uint32_t cyc)
+{
+	idle_history[cpu].idle_us[idle_history[cpu].next] =
+		MIN(k_cyc_to_us_floor32(cyc), IDLE_US_MAX);
+	idle_history[cpu].next = (idle_history[cpu].next + 1U) %
+				 CONFIG_PM_POLICY_PREDICTIVE_HISTORY;
+	if (idle_history[cpu].count < CONFIG_PM_POLICY_PREDICTIVE_HISTORY) {
+		idle_history[cpu].count++;
+	}
+}
+
+const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+{
+	const struct pm_state_info *state;
+	int64_t cyc = next_wakeup_cyc(ticks);
+	int64_t typical_us = typical_idle_us(cpu);
+	int64_t typical_cyc;
+
+	if (typical_us < 0) {
+		return state_select(cpu, cyc);
+	}
+
+	typical_cyc = k_us_to_cyc_ceil64(typical_us);
+	if ((cyc >= 0) && (cyc <= typical_cyc)) {
+		return state_select(cpu, cyc);
+	}
+
+	state = state_select(cpu, typical_cyc);
+	if (state == NULL) {
+		uint8_t num_cpu_states;
+		const struct pm_state_info *cpu_states;
+
+		/*
+		 * Idle durations are only learned when a state is entered, so
+		 * fall back to the shallowest state allowed until the next
+		 * wakeup, as staying active would keep the prediction stale.
+		 */
+		num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+
+		for (uint8_t i = 0U; i < num_cpu_states; i++) {
+			if (state_fits(&cpu_states[i], cyc)) {
+				return &cpu_states[i];
+			}
+		}
+	}
+
+	return state;
 }
 #endif
 
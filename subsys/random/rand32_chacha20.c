@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * ChaCha20 based CSPRNG with fast key erasure: each block of keystream
+ * replaces the key it was generated with by its first half, so that the
+ * output already returned cannot be recovered from the state.
+ *
+ * Each CPU has its own state, used with its local interrupts locked, and
+ * a CPU specific nonce so that the CPUs never produce the same keystream.
+ * The entropy driver is only used from the system work queue, which
+ * periodically fetches a new seed, mixed into the key of each CPU on its
+ * next request.
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/entropy.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#include "rand32_chacha20.h"
+
+/* Requests up to this size are served from the buffered keystream */
+#define CHACHA20_BUF_SIZE (CHACHA20_BLOCK_SIZE - sizeof(uint32_t) * CHACHA20_KEY_WORDS)
+
+struct chacha20_cpu {
+	uint32_t key[CHACHA20_KEY_WORDS];
+	/* Keystream left from the last block, used from its end */
+	uint8_t buf[CHACHA20_BUF_SIZE];
+	size_t buf_len;
+	/* Seed last mixed into the key */
+	uint32_t seed_gen;
+};
+
+static const struct device *const entropy_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
+
+static struct chacha20_cpu chacha20_cpus[CONFIG_MP_MAX_NUM_CPUS];
+
+static struct k_spinlock seed_lock;
+static uint32_t seed[CHACHA20_KEY_WORDS];
+static atomic_t seed_gen;
+
+static void reseed_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(reseed_work, reseed_handler);
+
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QUARTERROUND(x, a, b, c, d)				\
+	do {							\
+		x[a] += x[b]; x[d] = ROTL32(x[d] ^ x[a], 16);	\
+		x[c] += x[d]; x[b] = ROTL32(x[b] ^ x[c], 12);	\
+		x[a] += x[b]; x[d] = ROTL32(x[d] ^ x[a], 8);	\
+		x[c] += x[d]; x[b] = ROTL32(x[b] ^ x[c], 7);	\
+	} while (false)
+
+void z_chacha20_block(const uint32_t key[CHACHA20_KEY_WORDS], uint32_t counter,
+		      const uint32_t nonce[CHACHA20_NONCE_WORDS],
+		      uint8_t out[CHACHA20_BLOCK_SIZE])
+{
+	uint32_t in[CHACHA20_BLOCK_WORDS] = {
+		0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+		key[0], key[1], key[2], key[3],
+		key[4], key[5], key[6], key[7],
+		counter, nonce[0], nonce[1], nonce[2],
+	};
+	uint32_t x[CHACHA20_BLOCK_WORDS];
+
+	memcpy(x, in, sizeof(x));
+
+	for (int i = 0; i < 10; i++) {
+		QUARTERROUND(x, 0, 4, 8, 12);
+		QUARTERROUND(x, 1, 5, 9, 13);
+		QUARTERROUND(x, 2, 6, 10, 14);
+		QUARTERROUND(x, 3, 7, 11, 15);
+		QUARTERROUND(x, 0, 5, 10, 15);
+		QUARTERROUND(x, 1, 6, 11, 12);
+		QUARTERROUND(x, 2, 7, 8, 13);
+		QUARTERROUND(x, 3, 4, 9, 14);
+	}
+
+	for (int i = 0; i < CHACHA20_BLOCK_WORDS; i++) {
+		sys_put_le32(x[i] + in[i], &out[i * sizeof(uint32_t)]);
+	}
+}
+
+/* Replaces the key with the start of a new block and keeps the rest */
+static void chacha20_refill(struct chacha20_cpu *cpu, uint32_t nonce)
+{
+	const uint32_t cpu_nonce[CHACHA20_NONCE_WORDS] = { nonce, 0, 0 };
+	uint8_t block[CHACHA20_BLOCK_SIZE];
+
+	z_chacha20_block(cpu->key, 0, cpu_nonce, block);
+
+	for (int i = 0; i < CHACHA20_KEY_WORDS; i++) {
+		cpu->key[i] = sys_get_le32(&block[i * sizeof(uint32_t)]);
+	}
+	memcpy(cpu->buf, &block[sizeof(cpu->key)], sizeof(cpu->buf));
+	cpu->buf_len = sizeof(cpu->buf);
+
+	memset(block, 0, sizeof(block));
+}
+
+static int chacha20_seed(void)
+{
+	uint32_t buf[CHACHA20_KEY_WORDS];
+	k_spinlock_key_t key;
+	int ret;
+
+	ret = entropy_get_entropy(entropy_dev, (uint8_t *)buf, sizeof(buf));
+	if (ret != 0) {
+		return -EIO;
+	}
+
+	key = k_spin_lock(&seed_lock);
+	memcpy(seed, buf, sizeof(seed));
+	atomic_inc(&seed_gen);
+	k_spin_unlock(&seed_lock, key);
+
+	memset(buf, 0, sizeof(buf));
+
+	return 0;
+}
+
+static void reseed_handler(struct k_work *work)
+{
+	if (chacha20_seed() != 0) {
+		/* The current keys are kept until the driver recovers */
+		k_work_schedule(&reseed_work, K_SECONDS(1));
+		return;
+	}
+
+	k_work_schedule(&reseed_work, K_SECONDS(CONFIG_CS_CHACHA20_RESEED_INTERVAL));
+}
+
+/* Mixes the latest seed into the key of the CPU if it changed */
+static void chacha20_reseed(struct chacha20_cpu *cpu, uint32_t nonce)
+{
+	uint32_t gen = (uint32_t)atomic_get(&seed_gen);
+	k_spinlock_key_t key;
+
+	if (likely(gen == cpu->seed_gen)) {
+		return;
+	}
+
+	key = k_spin_lock(&seed_lock);
+	for (int i = 0; i < CHACHA20_KEY_WORDS; i++) {
+		cpu->key[i] ^= seed[i];
+	}
+	cpu->seed_gen = (uint32_t)atomic_get(&seed_gen);
+	k_spin_unlock(&seed_lock, key);
+
+	/* Drop the keystream of the old key */
+	chacha20_refill(cpu, nonce);
+}
+
+/* Generates a large request from a key of its own, without the CPU state */
+static void chacha20_bulk(const uint32_t key[CHACHA20_KEY_WORDS], uint8_t *dst,
+			  size_t len)
+{
+	static const uint32_t bulk_nonce[CHACHA20_NONCE_WORDS];
+	uint8_t block[CHACHA20_BLOCK_SIZE];
+	uint32_t counter = 0;
+
+	for (; len >= CHACHA20_BLOCK_SIZE; len -= CHACHA20_BLOCK_SIZE) {
+		z_chacha20_block(key, counter++, bulk_nonce, dst);
+		dst += CHACHA20_BLOCK_SIZE;
+	}
+
+	if (len > 0) {
+		z_chacha20_block(key, counter, bulk_nonce, block);
+		memcpy(dst, block, len);
+		memset(block, 0, sizeof(block));
+	}
+}
+
+int z_impl_sys_csrand_get(void *dst, size_t outlen)
+{
+	uint32_t bulk_key[CHACHA20_KEY_WORDS];
+	struct chacha20_cpu *cpu;
+	uint8_t *out = dst;
+	unsigned int key;
+	uint32_t nonce;
+
+	/* Seeded in the caller context until the first seed succeeded */
+	if (unlikely(atomic_get(&seed_gen) == 0) && chacha20_seed() != 0) {
+		return -EIO;
+	}
+
+	/* Only this CPU uses its state */
+	key = arch_irq_lock();
+	nonce = arch_curr_cpu()->id;
+	cpu = &chacha20_cpus[nonce];
+
+	chacha20_reseed(cpu, nonce);
+
+	if (outlen > CHACHA20_BUF_SIZE) {
+		/* The request key is the buffered keystream */
+		if (cpu->buf_len < sizeof(bulk_key)) {
+			chacha20_refill(cpu, nonce);
+		}
+		cpu->buf_len -= sizeof(bulk_key);
+		memcpy(bulk_key, &cpu->buf[cpu->buf_len], sizeof(bulk_key));
+		memset(&cpu->buf[cpu->buf_len], 0, sizeof(bulk_key));
+
+		arch_irq_unlock(key);
+
+		chacha20_bulk(bulk_key, out, outlen);
+		memset(bulk_key, 0, sizeof(bulk_key));
+
+		return 0;
+	}
+
+	if (cpu->buf_len < outlen) {
+		chacha20_refill(cpu, nonce);
+	}
+	cpu->buf_len -= outlen;
+	memcpy(out, &cpu->buf[cpu->buf_len], outlen);
+	memset(&cpu->buf[cpu->buf_len], 0, outlen);
+
+	arch_irq_unlock(key);
+
+	return 0;
+}
+
+static int chacha20_initialize(void)
+{
+	if (!device_is_ready(entropy_dev)) {
+		return -ENODEV;
+	}
+
+	/* A failed seed is retried by the first request */
+	(void)chacha20_seed();
+
+	k_work_schedule(&reseed_work, K_SECONDS(CONFIG_CS_CHACHA20_RESEED_INTERVAL));
+
+	return 0;
+}
+
+/* After the entropy drivers and the system work queue */
+SYS_INIT(chacha20_initialize, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
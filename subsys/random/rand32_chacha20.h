@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_RANDOM_RAND32_CHACHA20_H_
+#define ZEPHYR_SUBSYS_RANDOM_RAND32_CHACHA20_H_
+
+#include <stdint.h>
+
+#define CHACHA20_KEY_WORDS 8
+#define CHACHA20_NONCE_WORDS 3
+#define CHACHA20_BLOCK_WORDS 16
+#define CHACHA20_BLOCK_SIZE (CHACHA20_BLOCK_WORDS * sizeof(uint32_t))
+
+/**
+ * @brief Generate one block of ChaCha20 keystream, as in RFC 8439
+ *
+ * Internal to the ChaCha20 CSPRNG, exposed for its known-answer tests.
+ *
+ * @param key Key, as little-endian words
+ * @param counter Block counter
+ * @param nonce Nonce, as little-endian words
+ * @param out Keystream block
+ */
+void z_chacha20_block(const uint32_t key[CHACHA20_KEY_WORDS], uint32_t counter,
+		      const uint32_t nonce[CHACHA20_NONCE_WORDS],
+		      uint8_t out[CHACHA20_BLOCK_SIZE]);
+
+#endif /* ZEPHYR_SUBSYS_RANDOM_RAND32_CHACHA20_H_ */
@@ -16,11 +16,17 @@
  * thread.
  *
  * Each op code that is acceptable from user mode must also be validated.
+ *
+ * The iodev which was last found valid is given in @p iodev so that the
+ * object is not looked up again for each SQE of a batch using it.
  */
-static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe)
+static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe, const struct rtio_iodev **iodev)
 {
-	if (sqe->iodev != NULL && Z_SYSCALL_OBJ(sqe->iodev, K_OBJ_RTIO_IODEV)) {
-		return false;
+	if (sqe->iodev != NULL && sqe->iodev != *iodev) {
+		if (Z_SYSCALL_OBJ(sqe->iodev, K_OBJ_RTIO_IODEV)) {
+			return false;
+		}
+		*iodev = sqe->iodev;
 	}
 
 	bool valid_sqe = true;
@@ -76,20 +82,19 @@ static inline int z_vrfy_rtio_sqe_cancel(struct rtio_sqe *sqe)
 }
 #include <syscalls/rtio_sqe_cancel_mrsh.c>
 
-static inline int z_vrfy_rtio_sqe_copy_in_get_handles(struct rtio *r, const struct rtio_sqe *sqes,
-						      struct rtio_sqe **handle, size_t sqe_count)
+/* Copy in and verify SQEs, oopses if any is invalid */
+static int rtio_vrfy_copy_in(struct rtio *r, const struct rtio_sqe *sqes,
+			     struct rtio_sqe **handle, size_t sqe_count)
 {
-	Z_OOPS(Z_SYSCALL_OBJ(r, K_OBJ_RTIO));
+	const struct rtio_iodev *iodev = NULL;
+	struct rtio_sqe *sqe;
 
 	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(sqes, sqe_count, sizeof(struct rtio_sqe)));
-	struct rtio_sqe *sqe;
-	uint32_t acquirable = rtio_sqe_acquirable(r);
 
-	if (acquirable < sqe_count) {
+	if (rtio_sqe_acquirable(r) < sqe_count) {
 		return -ENOMEM;
 	}
 
-
 	for (int i = 0; i < sqe_count; i++) {
 		sqe = rtio_sqe_acquire(r);
 		__ASSERT_NO_MSG(sqe != NULL);
@@ -98,12 +103,26 @@ static inline int z_vrfy_rtio_sqe_copy_in_get_handles(struct rtio *r, const stru
 		}
 		*sqe = sqes[i];
 
-		if (!rtio_vrfy_sqe(sqe)) {
+		if (!rtio_vrfy_sqe(sqe, &iodev)) {
 			rtio_sqe_drop_all(r);
 			Z_OOPS(true);
 		}
 	}
 
+	return 0;
+}
+
+static inline int z_vrfy_rtio_sqe_copy_in_get_handles(struct rtio *r, const struct rtio_sqe *sqes,
+						      struct rtio_sqe **handle, size_t sqe_count)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(r, K_OBJ_RTIO));
+
+	int res = rtio_vrfy_copy_in(r, sqes, handle, sqe_count);
+
+	if (res < 0) {
+		return res;
+	}
+
 	/* Already copied *and* verified, no need to redo */
 	return z_impl_rtio_sqe_copy_in_get_handles(r, NULL, NULL, 0);
 }
@@ -133,3 +152,26 @@ static inline int z_vrfy_rtio_submit(struct rtio *r, uint32_t wait_count)
 	return z_impl_rtio_submit(r, wait_count);
 }
 #include <syscalls/rtio_submit_mrsh.c>
+
+static inline int z_vrfy_rtio_submit_copy(struct rtio *r, const struct rtio_sqe *sqes,
+					  size_t sqe_count, struct rtio_cqe *cqes,
+					  size_t cqe_count, k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(r, K_OBJ_RTIO));
+
+#ifdef CONFIG_RTIO_SUBMIT_SEM
+	Z_OOPS(Z_SYSCALL_OBJ(r->submit_sem, K_OBJ_SEM));
+#endif
+
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(cqes, cqe_count, sizeof(struct rtio_cqe)));
+
+	int res = rtio_vrfy_copy_in(r, sqes, NULL, sqe_count);
+
+	if (res < 0) {
+		return res;
+	}
+
+	/* Already copied *and* verified, no need to redo */
+	return z_impl_rtio_submit_copy(r, NULL, 0, cqes, cqe_count, timeout);
+}
+#include <syscalls/rtio_submit_copy_mrsh.c>
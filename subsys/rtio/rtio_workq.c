@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/rtio/work.h>
+
+K_P4WQ_DEFINE(rtio_workq, CONFIG_RTIO_WORKQ_THREADS, CONFIG_RTIO_WORKQ_STACK_SIZE);
+
+/* A request is free while its done semaphore is available. The work queue
+ * gives it once it no longer uses the request, after the handler returns,
+ * so that it cannot be submitted again before that.
+ */
+static struct rtio_work_req reqs[CONFIG_RTIO_WORKQ_POOL_ITEMS];
+
+struct rtio_work_req *rtio_work_req_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(reqs); i++) {
+		if (k_sem_take(&reqs[i].work.done_sem, K_NO_WAIT) == 0) {
+			return &reqs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int workq_prio(uint8_t prio)
+{
+	if (prio > RTIO_PRIO_NORM) {
+		return CONFIG_RTIO_WORKQ_PRIO_HIGH;
+	} else if (prio < RTIO_PRIO_NORM) {
+		return CONFIG_RTIO_WORKQ_PRIO_LOW;
+	}
+
+	return CONFIG_RTIO_WORKQ_PRIO_MED;
+}
+
+static void rtio_work_handler(struct k_p4wq_work *work)
+{
+	struct rtio_work_req *req = CONTAINER_OF(work, struct rtio_work_req, work);
+
+	req->handler(req->iodev_sqe);
+}
+
+void rtio_work_req_submit(struct rtio_work_req *req, struct rtio_iodev_sqe *iodev_sqe,
+			  rtio_work_submit_t handler)
+{
+	req->iodev_sqe = iodev_sqe;
+	req->handler = handler;
+	req->work.handler = rtio_work_handler;
+	req->work.priority = workq_prio(iodev_sqe->sqe.prio);
+	req->work.deadline = 0;
+	req->work.sync = false;
+
+	k_p4wq_submit(&rtio_workq, &req->work);
+}
+
+uint32_t rtio_work_req_used_count_get(void)
+{
+	uint32_t count = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(reqs); i++) {
+		if (k_sem_count_get(&reqs[i].work.done_sem) == 0) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static int rtio_workq_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(reqs); i++) {
+		k_sem_init(&reqs[i].work.done_sem, 1, 1);
+	}
+
+	return 0;
+}
+
+SYS_INIT(rtio_workq_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
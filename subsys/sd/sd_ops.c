@@ -471,12 +471,32 @@ int card_app_command(struct sd_card *card, int relative_card_address)
 	return 0;
 }
 
+/* Wait for the end of the programming of the last write, if it was deferred */
+static int card_wait_write(struct sd_card *card)
+{
+#ifdef CONFIG_SD_DEFER_WRITE_BUSY
+	if (card->write_busy) {
+		card->write_busy = false;
+		if (sdmmc_wait_ready(card)) {
+			LOG_ERR("Card did not return to ready state");
+			return -ETIMEDOUT;
+		}
+	}
+#endif
+	return 0;
+}
+
 static int card_read(struct sd_card *card, uint8_t *rbuf, uint32_t start_block, uint32_t num_blocks)
 {
 	int ret;
 	struct sdhc_command cmd = {0};
 	struct sdhc_data data = {0};
 
+	ret = card_wait_write(card);
+	if (ret) {
+		return ret;
+	}
+
 	/*
 	 * Note: The SD specification allows for CMD23 to be sent before a
 	 * transfer in order to set the block length (often preferable).
@@ -640,6 +660,11 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 	struct sdhc_command cmd = {0};
 	struct sdhc_data data = {0};
 
+	ret = card_wait_write(card);
+	if (ret) {
+		return ret;
+	}
+
 	/*
 	 * See the note in card_read() above. We will not issue CMD23
 	 * or CMD12, and expect the host to handle those details.
@@ -678,6 +703,11 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 		LOG_ERR("Only %d blocks of %d were written", blocks, num_blocks);
 		return -EIO;
 	}
+#ifdef CONFIG_SD_DEFER_WRITE_BUSY
+	/* The next access waits for the card to be ready */
+	card->write_busy = true;
+	return 0;
+#endif
 	/* Verify card is back in transfer state after write */
 	ret = sdmmc_wait_ready(card);
 	if (ret) {
@@ -768,6 +798,9 @@ int card_ioctl(struct sd_card *card, uint8_t cmd, void *buf)
 		 * Note that SD stack does not support enabling caching, so
 		 * cache flush is not required here
 		 */
+#ifdef CONFIG_SD_DEFER_WRITE_BUSY
+		card->write_busy = false;
+#endif
 		return sdmmc_wait_ready(card);
 	default:
 		return -ENOTSUP;
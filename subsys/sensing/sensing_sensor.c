@@ -8,6 +8,7 @@
 #include <zephyr/sensing/sensing.h>
 #include <zephyr/sensing/sensing_sensor.h>
 #include <zephyr/sys/__assert.h>
+#include "sensor_mgmt.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(sensing, CONFIG_SENSING_LOG_LEVEL);
@@ -24,5 +25,12 @@ int sensing_sensor_set_data_ready(const struct device *dev, bool data_ready)
 
 int sensing_sensor_post_data(const struct device *dev, void *buf, int size)
 {
-	return -ENOTSUP;
+	struct sensing_sensor *sensor = get_sensor_by_dev(dev);
+
+	if (sensor == NULL) {
+		LOG_ERR("cannot get sensor from dev:%p", dev);
+		return -ENODEV;
+	}
+
+	return post_sensor_data(sensor, buf, size);
 }
@@ -34,6 +34,7 @@ DT_FOREACH_CHILD_STATUS_OKAY(DT_DRV_INST(0), SENSING_SENSOR_DEFINE)
 struct sensing_context {
 	bool sensing_initialized;
 	int sensor_num;
+	struct k_mutex lock;
 	struct sensing_sensor *sensors[SENSING_SENSOR_NUM];
 };
 
@@ -51,6 +52,62 @@ static int set_sensor_state(struct sensing_sensor *sensor, enum sensing_sensor_s
 	return 0;
 }
 
+/* client gets one sample out of the ratio of its interval to the reporter one */
+static uint32_t compute_decimation(uint32_t sensor_interval, uint32_t client_interval)
+{
+	if (sensor_interval == 0 || client_interval <= sensor_interval) {
+		return 1;
+	}
+
+	return (client_interval + sensor_interval / 2) / sensor_interval;
+}
+
+/* the sensor runs at the shortest interval of its clients, other clients get their
+ * samples by decimation, so that there is a single interval configured per sensor
+ */
+static int arbitrate_interval(struct sensing_sensor *sensor)
+{
+	const struct sensing_sensor_api *sensor_api = sensor->dev->api;
+	struct sensing_connection *conn;
+	uint32_t interval = 0;
+	int ret;
+	int i;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&sensor->client_list, conn, snode) {
+		if (conn->interval != 0 && (interval == 0 || conn->interval < interval)) {
+			interval = conn->interval;
+		}
+	}
+
+	if (interval != sensor->interval) {
+		if (sensor_api->set_interval != NULL) {
+			ret = sensor_api->set_interval(sensor->dev, interval);
+			if (ret) {
+				LOG_ERR("sensor:%s set interval:%d(us) error:%d",
+					sensor->dev->name, interval, ret);
+				return ret;
+			}
+		}
+		sensor->interval = interval;
+
+		/* virtual sensor needs its reporters at its own interval */
+		for (i = 0; i < sensor->reporter_num; i++) {
+			sensor->conns[i].interval = interval;
+			ret = arbitrate_interval(sensor->conns[i].source);
+			if (ret) {
+				return ret;
+			}
+		}
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&sensor->client_list, conn, snode) {
+		conn->decimation = compute_decimation(interval, conn->interval);
+		conn->sample_count = 0;
+	}
+
+	return 0;
+}
+
 static void init_connection(struct sensing_connection *conn,
 			    struct sensing_sensor *source,
 			    struct sensing_sensor *sink)
@@ -60,6 +117,8 @@ static void init_connection(struct sensing_connection *conn,
 	conn->source = source;
 	conn->sink = sink;
 	conn->interval = 0;
+	conn->decimation = 1;
+	conn->sample_count = 0;
 	memset(conn->sensitivity, 0x00, sizeof(conn->sensitivity));
 	/* link connection to its reporter's client_list */
 	sys_slist_append(&source->client_list, &conn->snode);
@@ -114,8 +173,6 @@ static int pre_init_sensor(struct sensing_sensor *sensor)
 {
 	struct sensing_sensor_ctx *sensor_ctx;
 	uint16_t sample_size, total_size;
-	uint16_t conn_sample_size = 0;
-	int i = 0;
 	void *tmp_data;
 
 	__ASSERT(sensor && sensor->dev, "sensor or sensor dev is invalid");
@@ -123,17 +180,14 @@ static int pre_init_sensor(struct sensing_sensor *sensor)
 	__ASSERT(sensor_ctx, "sensing sensor context is invalid");
 
 	sample_size = sensor_ctx->register_info->sample_size;
-	for (i = 0; i < sensor->reporter_num; i++) {
-		conn_sample_size += get_reporter_sample_size(sensor, i);
-	}
 
 	/* total memory to be allocated for a sensor according to sensor device tree:
 	 * 1) sample data point to struct sensing_sensor->data_buf
 	 * 2) size of struct sensing_connection* for sensor connection to its reporter
-	 * 3) reporter sample size to be stored in connection data
+	 * reporter samples are not copied to the connections, all the clients of a
+	 * reporter are given the buffer it posted.
 	 */
-	total_size = sample_size + sensor->reporter_num * sizeof(*sensor->conns) +
-		     conn_sample_size;
+	total_size = sample_size + sensor->reporter_num * sizeof(*sensor->conns);
 
 	/* total size for different sensor maybe different, for example:
 	 * there's no reporter for physical sensor, so no connection memory is needed
@@ -150,11 +204,6 @@ static int pre_init_sensor(struct sensing_sensor *sensor)
 	sensor->conns = (struct sensing_connection *)((uint8_t *)sensor->data_buf + sample_size);
 
 	tmp_data = sensor->conns + sensor->reporter_num;
-	for (i = 0; i < sensor->reporter_num; i++) {
-		sensor->conns[i].data = tmp_data;
-		tmp_data = (uint8_t *)tmp_data + get_reporter_sample_size(sensor, i);
-	}
-
 	if (tmp_data != ((uint8_t *)sensor->data_buf + total_size)) {
 		LOG_ERR("sensor memory assign error, data_buf:%p, tmp_data:%p, size:%d",
 			sensor->data_buf, tmp_data, total_size);
@@ -190,6 +239,8 @@ static int sensing_init(void)
 
 	LOG_INF("sensing init begin...");
 
+	k_mutex_init(&ctx->lock);
+
 	if (ctx->sensing_initialized) {
 		LOG_INF("sensing is already initialized");
 		return 0;
@@ -231,16 +282,17 @@ int open_sensor(struct sensing_sensor *sensor, struct sensing_connection **conn)
 	if (sensor->state != SENSING_SENSOR_STATE_READY)
 		return -EINVAL;
 
-	/* allocate struct sensing_connection *conn and conn data for application client */
-	tmp_conn = malloc(sizeof(*tmp_conn) + sensor->sample_size);
+	/* allocate struct sensing_connection *conn for application client */
+	tmp_conn = malloc(sizeof(*tmp_conn));
 	if (!tmp_conn) {
 		LOG_ERR("malloc memory for struct sensing_connection error");
 		return -ENOMEM;
 	}
-	tmp_conn->data = (uint8_t *)tmp_conn + sizeof(*tmp_conn);
 
 	/* create connection from sensor to application(client = NULL) */
+	k_mutex_lock(&sensing_ctx.lock, K_FOREVER);
 	init_connection(tmp_conn, sensor, NULL);
+	k_mutex_unlock(&sensing_ctx.lock);
 
 	*conn = tmp_conn;
 
@@ -258,10 +310,13 @@ int close_sensor(struct sensing_connection **conn)
 
 	__ASSERT(!tmp_conn->sink, "sensor derived from device tree cannot be closed");
 
+	k_mutex_lock(&sensing_ctx.lock, K_FOREVER);
 	sys_slist_find_and_remove(&tmp_conn->source->client_list, &tmp_conn->snode);
+	(void)arbitrate_interval(tmp_conn->source);
+	k_mutex_unlock(&sensing_ctx.lock);
 
 	*conn = NULL;
-	free(*conn);
+	free(tmp_conn);
 
 	return 0;
 }
@@ -287,12 +342,37 @@ int sensing_register_callback(struct sensing_connection *conn,
 
 int set_interval(struct sensing_connection *conn, uint32_t interval)
 {
-	return -ENOTSUP;
+	int ret;
+
+	if (conn == NULL) {
+		LOG_ERR("set interval, connection should not be NULL");
+		return -ENODEV;
+	}
+
+	if (interval != 0 && interval < conn->source->info->minimal_interval) {
+		LOG_ERR("interval:%d(us) should be at least:%d(us)",
+			interval, conn->source->info->minimal_interval);
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&sensing_ctx.lock, K_FOREVER);
+	conn->interval = interval;
+	ret = arbitrate_interval(conn->source);
+	k_mutex_unlock(&sensing_ctx.lock);
+
+	return ret;
 }
 
 int get_interval(struct sensing_connection *conn, uint32_t *interval)
 {
-	return -ENOTSUP;
+	if (conn == NULL) {
+		LOG_ERR("get interval, connection should not be NULL");
+		return -ENODEV;
+	}
+
+	*interval = conn->interval;
+
+	return 0;
 }
 
 int set_sensitivity(struct sensing_connection *conn, int8_t index, uint32_t sensitivity)
@@ -305,6 +385,48 @@ int get_sensitivity(struct sensing_connection *conn, int8_t index, uint32_t *sen
 	return -ENOTSUP;
 }
 
+int post_sensor_data(struct sensing_sensor *sensor, void *buf, int size)
+{
+	const struct sensing_sensor_api *sink_api;
+	struct sensing_connection *conn;
+
+	if (size > sensor->sample_size) {
+		LOG_ERR("sensor:%s sample size:%d exceeds:%d",
+			sensor->dev->name, size, sensor->sample_size);
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&sensing_ctx.lock, K_FOREVER);
+
+	/* every client is given the same buffer, there is no copy per client */
+	SYS_SLIST_FOR_EACH_CONTAINER(&sensor->client_list, conn, snode) {
+		if (conn->interval == 0) {
+			continue;
+		}
+
+		if (++conn->sample_count < conn->decimation) {
+			continue;
+		}
+		conn->sample_count = 0;
+
+		if (conn->sink == NULL) {
+			if (conn->data_evt_cb != NULL) {
+				conn->data_evt_cb(conn, buf);
+			}
+		} else {
+			sink_api = conn->sink->dev->api;
+			if (sink_api->process != NULL) {
+				sink_api->process(conn->sink->dev, conn - conn->sink->conns,
+						  buf, size);
+			}
+		}
+	}
+
+	k_mutex_unlock(&sensing_ctx.lock);
+
+	return 0;
+}
+
 int sensing_get_sensors(int *sensor_nums, const struct sensing_sensor_info **info)
 {
 	if (info == NULL) {
@@ -72,8 +72,9 @@ struct sensing_connection {
 	/* interval and sensitivity set from client(sink) to reporter(source) */
 	uint32_t interval;
 	int sensitivity[CONFIG_SENSING_MAX_SENSITIVITY_COUNT];
-	/* copy sensor data to connection data buf from reporter */
-	void *data;
+	/* client(sink) gets one of every decimation samples of reporter(source) */
+	uint32_t decimation;
+	uint32_t sample_count;
 	/* client(sink) next consume time */
 	sys_snode_t snode;
 	/* post data to application */
@@ -115,6 +116,7 @@ int set_interval(struct sensing_connection *conn, uint32_t interval);
 int get_interval(struct sensing_connection *con, uint32_t *sensitivity);
 int set_sensitivity(struct sensing_connection *conn, int8_t index, uint32_t interval);
 int get_sensitivity(struct sensing_connection *con, int8_t index, uint32_t *sensitivity);
+int post_sensor_data(struct sensing_sensor *sensor, void *buf, int size);
 
 
 static inline bool is_phy_sensor(struct sensing_sensor *sensor)
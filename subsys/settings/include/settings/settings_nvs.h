@@ -46,6 +46,22 @@ struct settings_nvs {
 
 	uint16_t cache_next;
 #endif
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	/* ID and hashes of the stored names, sorted by ID */
+	struct {
+		uint16_t name_id;
+		uint16_t name_hash;
+		/* hash of the first element of the name */
+		uint16_t root_hash;
+	} index[CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE];
+
+	uint16_t index_count;
+	/* some names did not fit, the index cannot be used */
+	bool index_full;
+#endif
+	/* the largest name ID in use is written at the end of the batch */
+	bool in_batch;
+	uint16_t stored_last_name_id;
 };
 
 /* register nvs to be a source of settings */
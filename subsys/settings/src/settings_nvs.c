@@ -32,11 +32,15 @@ static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
+static int settings_nvs_save_start(struct settings_store *cs);
+static int settings_nvs_save_end(struct settings_store *cs);
 static void *settings_nvs_storage_get(struct settings_store *cs);
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
+	.csi_save_start = settings_nvs_save_start,
 	.csi_save = settings_nvs_save,
+	.csi_save_end = settings_nvs_save_end,
 	.csi_storage_get = settings_nvs_storage_get
 };
 
@@ -118,6 +122,167 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+static uint16_t settings_nvs_root_hash(const char *name)
+{
+	int len = settings_name_next(name, NULL);
+
+	return crc16_ccitt(0xffff, name, len);
+}
+
+/* position of the first entry with an ID larger or equal to name_id */
+static size_t settings_nvs_index_pos(struct settings_nvs *cf, uint16_t name_id)
+{
+	size_t lo = 0;
+	size_t hi = cf->index_count;
+
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+
+		if (cf->index[mid].name_id < name_id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static void settings_nvs_index_add(struct settings_nvs *cf, const char *name,
+				   uint16_t name_id)
+{
+	size_t pos = settings_nvs_index_pos(cf, name_id);
+
+	if ((pos == cf->index_count) || (cf->index[pos].name_id != name_id)) {
+		if (cf->index_count == CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE) {
+			LOG_WRN("NVS name index full");
+			cf->index_full = true;
+			return;
+		}
+
+		memmove(&cf->index[pos + 1], &cf->index[pos],
+			(cf->index_count - pos) * sizeof(cf->index[0]));
+		cf->index_count++;
+	}
+
+	cf->index[pos].name_id = name_id;
+	cf->index[pos].name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	cf->index[pos].root_hash = settings_nvs_root_hash(name);
+}
+
+static void settings_nvs_index_remove(struct settings_nvs *cf, uint16_t name_id)
+{
+	size_t pos = settings_nvs_index_pos(cf, name_id);
+
+	if ((pos == cf->index_count) || (cf->index[pos].name_id != name_id)) {
+		return;
+	}
+
+	cf->index_count--;
+	memmove(&cf->index[pos], &cf->index[pos + 1],
+		(cf->index_count - pos) * sizeof(cf->index[0]));
+}
+
+static uint16_t settings_nvs_index_match(struct settings_nvs *cf, const char *name,
+					 char *rdname, size_t len)
+{
+	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	int rc;
+
+	for (size_t i = 0; i < cf->index_count; i++) {
+		if (cf->index[i].name_hash != name_hash) {
+			continue;
+		}
+
+		rc = nvs_read(&cf->cf_nvs, cf->index[i].name_id, rdname, len);
+		if (rc < 0) {
+			continue;
+		}
+
+		rdname[MIN((size_t)rc, len - 1)] = '\0';
+
+		if (strcmp(name, rdname)) {
+			continue;
+		}
+
+		return cf->index[i].name_id;
+	}
+
+	return NVS_NAMECNT_ID;
+}
+
+/* lowest name ID which is not in use */
+static uint16_t settings_nvs_index_free_id(struct settings_nvs *cf)
+{
+	uint16_t name_id = NVS_NAMECNT_ID + 1;
+
+	for (size_t i = 0; i < cf->index_count; i++) {
+		if (cf->index[i].name_id != name_id) {
+			break;
+		}
+		name_id++;
+	}
+
+	return name_id;
+}
+
+/* largest name ID below name_id whose first name element has root_hash */
+static uint16_t settings_nvs_index_prev(struct settings_nvs *cf, uint16_t name_id,
+					uint16_t root_hash)
+{
+	size_t pos = settings_nvs_index_pos(cf, name_id);
+
+	while (pos-- > 0) {
+		if (cf->index[pos].root_hash == root_hash) {
+			return cf->index[pos].name_id;
+		}
+	}
+
+	return NVS_NAMECNT_ID;
+}
+
+static void settings_nvs_index_build(struct settings_nvs *cf)
+{
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	ssize_t rc;
+
+	cf->index_count = 0;
+	cf->index_full = false;
+
+	for (uint16_t name_id = NVS_NAMECNT_ID + 1;
+	     (name_id <= cf->last_name_id) && !cf->index_full; name_id++) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name) - 1);
+		if (rc <= 0) {
+			continue;
+		}
+
+		name[MIN((size_t)rc, sizeof(name) - 1)] = '\0';
+		settings_nvs_index_add(cf, name, name_id);
+	}
+}
+#endif /* CONFIG_SETTINGS_NVS_NAME_INDEX */
+
+/* Write the largest name ID in use, unless a batch of writes is ongoing.
+ * The names added by an interrupted batch are then not loaded.
+ */
+static int settings_nvs_last_name_id_write(struct settings_nvs *cf)
+{
+	int rc;
+
+	if (cf->in_batch) {
+		return 0;
+	}
+
+	rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id,
+		       sizeof(uint16_t));
+	if (rc >= 0) {
+		cf->stored_last_name_id = cf->last_name_id;
+	}
+
+	return rc;
+}
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -128,12 +293,30 @@ static int settings_nvs_load(struct settings_store *cs,
 	char buf;
 	ssize_t rc1, rc2;
 	uint16_t name_id = NVS_NAMECNT_ID;
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	bool indexed = false;
+	uint16_t root_hash = 0;
+
+	/* subtree loads only read the names with the same first element */
+	if (!cf->index_full && arg->subtree && (arg->subtree[0] != '\0')) {
+		indexed = true;
+		root_hash = settings_nvs_root_hash(arg->subtree);
+	}
+#endif
 
 	name_id = cf->last_name_id + 1;
 
 	while (1) {
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		if (indexed) {
+			name_id = settings_nvs_index_prev(cf, name_id, root_hash);
+		} else {
+			name_id--;
+		}
+#else
 		name_id--;
+#endif
 		if (name_id == NVS_NAMECNT_ID) {
 			break;
 		}
@@ -158,11 +341,13 @@ static int settings_nvs_load(struct settings_store *cs,
 			 */
 			if (name_id == cf->last_name_id) {
 				cf->last_name_id--;
-				nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-					  &cf->last_name_id, sizeof(uint16_t));
+				(void)settings_nvs_last_name_id_write(cf);
 			}
 			nvs_delete(&cf->cf_nvs, name_id);
 			nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+			settings_nvs_index_remove(cf, name_id);
+#endif
 			continue;
 		}
 
@@ -186,6 +371,28 @@ static int settings_nvs_load(struct settings_store *cs,
 	return ret;
 }
 
+static int settings_nvs_save_start(struct settings_store *cs)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+
+	cf->in_batch = true;
+
+	return 0;
+}
+
+static int settings_nvs_save_end(struct settings_store *cs)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+
+	cf->in_batch = false;
+
+	if (cf->last_name_id == cf->stored_last_name_id) {
+		return 0;
+	}
+
+	return settings_nvs_last_name_id_write(cf);
+}
+
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len)
 {
@@ -202,6 +409,21 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 	/* Find out if we are doing a delete */
 	delete = ((value == NULL) || (val_len == 0));
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	/* all the stored names are in the index */
+	if (!cf->index_full) {
+		name_id = settings_nvs_index_match(cf, name, rdname, sizeof(rdname));
+		if (name_id != NVS_NAMECNT_ID) {
+			write_name_id = name_id;
+			write_name = false;
+		} else {
+			write_name_id = settings_nvs_index_free_id(cf);
+			write_name = true;
+		}
+		goto found;
+	}
+#endif
+
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	name_id = settings_nvs_cache_match(cf, name, rdname, sizeof(rdname));
 	if (name_id != NVS_NAMECNT_ID) {
@@ -256,8 +478,7 @@ found:
 
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
-			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-				       &cf->last_name_id, sizeof(uint16_t));
+			rc = settings_nvs_last_name_id_write(cf);
 			if (rc < 0) {
 				/* Error: can't to store
 				 * the largest name ID in use.
@@ -277,6 +498,9 @@ found:
 			return rc;
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		settings_nvs_index_remove(cf, name_id);
+#endif
 		return 0;
 	}
 
@@ -298,13 +522,15 @@ found:
 		if (rc < 0) {
 			return rc;
 		}
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		settings_nvs_index_add(cf, name, write_name_id);
+#endif
 	}
 
 	/* update the last_name_id and write to flash if required*/
 	if (write_name_id > cf->last_name_id) {
 		cf->last_name_id = write_name_id;
-		rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id,
-			       sizeof(uint16_t));
+		rc = settings_nvs_last_name_id_write(cf);
 	}
 
 	if (rc < 0) {
@@ -337,6 +563,11 @@ int settings_nvs_backend_init(struct settings_nvs *cf)
 	} else {
 		cf->last_name_id = last_name_id;
 	}
+	cf->stored_last_name_id = cf->last_name_id;
+
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	settings_nvs_index_build(cf);
+#endif
 
 	LOG_DBG("Initialized");
 	return 0;
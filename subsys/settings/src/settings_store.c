@@ -110,6 +110,58 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 	return rc;
 }
 
+/* Checks if the item is overwritten by a later item of the batch */
+static bool settings_batch_item_overwritten(const struct settings_batch_item *items,
+					    size_t idx, size_t count)
+{
+	for (size_t i = idx + 1; i < count; i++) {
+		if (!strcmp(items[idx].name, items[i].name)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int settings_save_batch(const struct settings_batch_item *items, size_t count)
+{
+	int rc = 0;
+	struct settings_store *cs;
+
+	cs = settings_save_dst;
+	if (!cs) {
+		return -ENOENT;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	for (size_t i = 0; (i < count) && !rc; i++) {
+		if (!items[i].name) {
+			rc = -EINVAL;
+			break;
+		}
+
+		if (settings_batch_item_overwritten(items, i, count)) {
+			continue;
+		}
+
+		rc = cs->cs_itf->csi_save(cs, items[i].name, (char *)items[i].value,
+					  items[i].val_len);
+	}
+
+	if (cs->cs_itf->csi_save_end) {
+		cs->cs_itf->csi_save_end(cs);
+	}
+
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
 int settings_delete(const char *name)
 {
 	return settings_save_one(name, NULL, 0);
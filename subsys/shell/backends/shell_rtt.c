@@ -34,6 +34,12 @@ static void timer_handler(struct k_timer *timer)
 	if (SEGGER_RTT_HasData(CONFIG_SHELL_BACKEND_RTT_BUFFER)) {
 		sh_rtt->handler(SHELL_TRANSPORT_EVT_RX_RDY, sh_rtt->context);
 	}
+
+	/* Retry the output once the host had time to read the up-buffer. */
+	if (sh_rtt->tx_pending) {
+		sh_rtt->tx_pending = false;
+		sh_rtt->handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_rtt->context);
+	}
 }
 
 static int init(const struct shell_transport *transport,
@@ -52,9 +58,10 @@ static int init(const struct shell_transport *transport,
 			K_MSEC(CONFIG_SHELL_RTT_RX_POLL_PERIOD));
 
 	if (CONFIG_SHELL_BACKEND_RTT_BUFFER > 0) {
+		/* Partial writes let long output fill the whole up-buffer. */
 		SEGGER_RTT_ConfigUpBuffer(CONFIG_SHELL_BACKEND_RTT_BUFFER, "Shell",
 					  shell_rtt_up_buf, sizeof(shell_rtt_up_buf),
-					  SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+					  SEGGER_RTT_MODE_NO_BLOCK_TRIM);
 
 		SEGGER_RTT_ConfigDownBuffer(CONFIG_SHELL_BACKEND_RTT_BUFFER, "Shell",
 					  shell_rtt_down_buf, sizeof(shell_rtt_down_buf),
@@ -98,6 +105,14 @@ static int write(const struct shell_transport *transport,
 		}
 	} else {
 		*cnt = SEGGER_RTT_Write(CONFIG_SHELL_BACKEND_RTT_BUFFER, data8, length);
+
+		/* The up-buffer is full: instead of retrying at once, the shell
+		 * waits for the next poll period.
+		 */
+		if (*cnt < length) {
+			sh_rtt->tx_pending = true;
+			return 0;
+		}
 	}
 
 	sh_rtt->handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_rtt->context);
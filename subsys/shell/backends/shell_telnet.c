@@ -444,9 +444,10 @@ static int write(const struct shell_transport *transport,
 		lb->len += copy_len;
 
 		/* Send the data immediately if the buffer is full or line feed
-		 * is recognized.
+		 * is recognized, unless lines are batched.
 		 */
-		if (lb->buf[lb->len - 1] == '\n' ||
+		if ((!IS_ENABLED(CONFIG_SHELL_TELNET_TX_BATCH) &&
+		     lb->buf[lb->len - 1] == '\n') ||
 		    lb->len == TELNET_LINE_SIZE) {
 			err = telnet_send();
 			if (err != 0) {
@@ -181,6 +181,125 @@ static void uart_callback(const struct device *dev, void *user_data)
 }
 #endif /* CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN */
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC
+/* Sends the contiguous data at the beginning of the TX ring buffer in a
+ * single transfer. Called by the owner of tx_busy.
+ */
+static void async_tx_start(const struct shell_uart *sh_uart)
+{
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+	uint8_t *data;
+	uint32_t len;
+	int err;
+
+	do {
+		len = ring_buf_get_claim(sh_uart->tx_ringbuf, &data,
+					 sh_uart->tx_ringbuf->size);
+		if (len > 0 && !ctrl_blk->blocking_tx) {
+			err = uart_tx(ctrl_blk->dev, data, len, SYS_FOREVER_US);
+			if (err == 0) {
+				return;
+			}
+
+			LOG_WRN("TX failed (%d), data dropped.", err);
+			(void)ring_buf_get_finish(sh_uart->tx_ringbuf, len);
+		} else {
+			(void)ring_buf_get_finish(sh_uart->tx_ringbuf, 0);
+		}
+
+		atomic_clear(&ctrl_blk->tx_busy);
+
+		/* Data written after the claim, when TX was still busy. */
+	} while (!ring_buf_is_empty(sh_uart->tx_ringbuf) &&
+		 !ctrl_blk->blocking_tx &&
+		 atomic_set(&ctrl_blk->tx_busy, 1) == 0);
+}
+
+static void async_rx_enable(const struct shell_uart *sh_uart)
+{
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+	int err;
+
+	ctrl_blk->rx_buf_idx = 0;
+	err = uart_rx_enable(ctrl_blk->dev, ctrl_blk->rx_bufs[0],
+			     sizeof(ctrl_blk->rx_bufs[0]),
+			     CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_TIMEOUT);
+	if (err != 0) {
+		LOG_ERR("Failed to enable RX (%d)", err);
+	}
+}
+
+static void async_rx_handle(const struct shell_uart *sh_uart,
+			    const uint8_t *data, size_t len)
+{
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+	size_t i = 0;
+
+#ifdef CONFIG_MCUMGR_TRANSPORT_SHELL
+	/* Divert bytes from shell handling if it is part of an mcumgr frame. */
+	i = smp_shell_rx_bytes(&ctrl_blk->smp, data, len);
+#endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
+
+	if (ring_buf_put(sh_uart->rx_ringbuf, &data[i], len - i) < len - i) {
+		LOG_WRN("RX ring buffer full.");
+	}
+
+	ctrl_blk->handler(SHELL_TRANSPORT_EVT_RX_RDY, ctrl_blk->context);
+}
+
+static void async_callback(const struct device *dev, struct uart_event *evt,
+			   void *user_data)
+{
+	const struct shell_uart *sh_uart = (struct shell_uart *)user_data;
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		(void)ring_buf_get_finish(sh_uart->tx_ringbuf, evt->data.tx.len);
+		async_tx_start(sh_uart);
+		ctrl_blk->handler(SHELL_TRANSPORT_EVT_TX_RDY, ctrl_blk->context);
+		break;
+	case UART_RX_RDY:
+		async_rx_handle(sh_uart, &evt->data.rx.buf[evt->data.rx.offset],
+				evt->data.rx.len);
+		break;
+	case UART_RX_BUF_REQUEST:
+		ctrl_blk->rx_buf_idx ^= 1;
+		(void)uart_rx_buf_rsp(dev, ctrl_blk->rx_bufs[ctrl_blk->rx_buf_idx],
+				      sizeof(ctrl_blk->rx_bufs[0]));
+		break;
+	case UART_RX_DISABLED:
+		/* Reception stops after an error, restart it. */
+		if (!ctrl_blk->rx_stopped) {
+			async_rx_enable(sh_uart);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static int async_init(const struct shell_uart *sh_uart)
+{
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+	int err;
+
+	ring_buf_reset(sh_uart->tx_ringbuf);
+	ring_buf_reset(sh_uart->rx_ringbuf);
+	ctrl_blk->tx_busy = 0;
+	ctrl_blk->rx_stopped = false;
+
+	err = uart_callback_set(ctrl_blk->dev, async_callback, (void *)sh_uart);
+	if (err != 0) {
+		return err;
+	}
+
+	async_rx_enable(sh_uart);
+
+	return 0;
+}
+#else /* CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC */
 static void uart_irq_init(const struct shell_uart *sh_uart)
 {
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
@@ -213,6 +332,7 @@ static void timer_handler(struct k_timer *timer)
 					   sh_uart->ctrl_blk->context);
 	}
 }
+#endif /* CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC */
 
 static int init(const struct shell_transport *transport,
 		const void *config,
@@ -230,6 +350,9 @@ static int init(const struct shell_transport *transport,
 	k_fifo_init(&sh_uart->ctrl_blk->smp.buf_ready);
 #endif
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC
+	return async_init(sh_uart);
+#else
 	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		uart_irq_init(sh_uart);
 	} else {
@@ -239,12 +362,18 @@ static int init(const struct shell_transport *transport,
 	}
 
 	return 0;
+#endif
 }
 
 static int uninit(const struct shell_transport *transport)
 {
 	const struct shell_uart *sh_uart = (struct shell_uart *)transport->ctx;
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC
+	sh_uart->ctrl_blk->rx_stopped = true;
+	(void)uart_rx_disable(sh_uart->ctrl_blk->dev);
+	(void)uart_tx_abort(sh_uart->ctrl_blk->dev);
+#else
 	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		const struct device *dev = sh_uart->ctrl_blk->dev;
 
@@ -254,6 +383,7 @@ static int uninit(const struct shell_transport *transport)
 	} else {
 		k_timer_stop(sh_uart->timer);
 	}
+#endif
 
 	return 0;
 }
@@ -267,6 +397,8 @@ static int enable(const struct shell_transport *transport, bool blocking_tx)
 	if (blocking_tx) {
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
 		uart_irq_tx_disable(sh_uart->ctrl_blk->dev);
+#elif defined(CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC)
+		(void)uart_tx_abort(sh_uart->ctrl_blk->dev);
 #endif
 	}
 
@@ -281,6 +413,8 @@ static void irq_write(const struct shell_uart *sh_uart, const void *data,
 	if (atomic_set(&sh_uart->ctrl_blk->tx_busy, 1) == 0) {
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
 		uart_irq_tx_enable(sh_uart->ctrl_blk->dev);
+#elif defined(CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC)
+		async_tx_start(sh_uart);
 #endif
 	}
 }
@@ -291,7 +425,8 @@ static int write(const struct shell_transport *transport,
 	const struct shell_uart *sh_uart = (struct shell_uart *)transport->ctx;
 	const uint8_t *data8 = (const uint8_t *)data;
 
-	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) &&
+	if ((IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) ||
+	     IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_API_ASYNC)) &&
 		!sh_uart->ctrl_blk->blocking_tx) {
 		irq_write(sh_uart, data, length, cnt);
 	} else {
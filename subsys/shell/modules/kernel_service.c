@@ -22,6 +22,9 @@
 #if defined(CONFIG_LOG_RUNTIME_FILTERING)
 #include <zephyr/logging/log_ctrl.h>
 #endif
+#if defined(CONFIG_INIT_PROFILING)
+#include <zephyr/timing/timing.h>
+#endif
 
 #if defined(CONFIG_THREAD_MAX_NAME_LEN)
 #define THREAD_MAX_NAM_LEN CONFIG_THREAD_MAX_NAME_LEN
@@ -64,6 +67,66 @@ static int cmd_kernel_cycles(const struct shell *sh,
 	return 0;
 }
 
+#if defined(CONFIG_INIT_PROFILING)
+/* Find the longest record shorter than the previous one, or as long and
+ * after it, so that the records are printed by decreasing duration without
+ * sorting them.
+ */
+static int boot_profile_next(const struct init_profile_record *records, size_t count,
+			     int prev)
+{
+	int next = -1;
+
+	for (int i = 0; i < (int)count; i++) {
+		if (records[i].entry == NULL) {
+			continue;
+		}
+
+		if ((prev >= 0) && ((records[i].cycles > records[prev].cycles) ||
+				    ((records[i].cycles == records[prev].cycles) && (i <= prev)))) {
+			continue;
+		}
+
+		if ((next < 0) || (records[i].cycles > records[next].cycles)) {
+			next = i;
+		}
+	}
+
+	return next;
+}
+
+static int cmd_kernel_boot_profile(const struct shell *sh,
+				   size_t argc, char **argv)
+{
+	const struct init_profile_record *records;
+	size_t count = sys_init_profile_get(&records);
+	uint64_t total = 0;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%12s  %s", "time (us)", "init entry");
+
+	for (int i = boot_profile_next(records, count, -1); i >= 0;
+	     i = boot_profile_next(records, count, i)) {
+		const struct init_entry *entry = records[i].entry;
+		uint32_t us = timing_cycles_to_ns(records[i].cycles) / NSEC_PER_USEC;
+
+		total += records[i].cycles;
+
+		if (entry->dev != NULL) {
+			shell_print(sh, "%12u  device %s", us, entry->dev->name);
+		} else {
+			shell_print(sh, "%12u  SYS_INIT %p", us, (void *)entry->init_fn.sys);
+		}
+	}
+
+	shell_print(sh, "%12u  total", (uint32_t)(timing_cycles_to_ns(total) / NSEC_PER_USEC));
+
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
 	defined(CONFIG_THREAD_MONITOR)
 static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
@@ -244,6 +307,70 @@ static int cmd_kernel_stacks(const struct shell *sh,
 }
 #endif
 
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) && defined(CONFIG_THREAD_MONITOR)
+/* Prints the non-empty buckets of a histogram, by bound in cycles */
+static void shell_histogram_print(const struct shell *sh, const char *name,
+				  const uint32_t *histogram)
+{
+	const unsigned int last = CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS - 1;
+
+	for (unsigned int i = 0; i <= last; i++) {
+		if (histogram[i] == 0U) {
+			continue;
+		}
+
+		if (i < last) {
+			shell_print(sh, "\t%-16s <  2^%-2u: %u", name,
+				    CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT + i, histogram[i]);
+		} else {
+			shell_print(sh, "\t%-16s >= 2^%-2u: %u", name,
+				    CONFIG_SCHED_THREAD_USAGE_LATENCY_SHIFT + i - 1, histogram[i]);
+		}
+
+		name = "";
+	}
+}
+
+static void shell_latency_dump(const struct k_thread *cthread, void *user_data)
+{
+	static const char *const wait_names[K_SCHED_WAIT_TYPES] = {
+		[K_SCHED_WAIT_OBJECT] = "blocked object",
+		[K_SCHED_WAIT_SLEEP] = "blocked sleep",
+		[K_SCHED_WAIT_SUSPEND] = "blocked suspend",
+	};
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	/* Too large for the stack of the shell */
+	static k_thread_runtime_stats_t stats;
+	const char *tname;
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	tname = k_thread_name_get(thread);
+
+	shell_print(sh, "%p %-10s", thread, tname ? tname : "NA");
+	shell_histogram_print(sh, "ready", stats.latency.ready);
+	shell_histogram_print(sh, "preempted", stats.latency.preempted);
+
+	for (int i = 0; i < K_SCHED_WAIT_TYPES; i++) {
+		shell_histogram_print(sh, wait_names[i], stats.latency.blocked[i]);
+	}
+}
+
+static int cmd_kernel_latency(const struct shell *sh,
+			      size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_thread_foreach_unlocked(shell_latency_dump, (void *)sh);
+
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 extern struct sys_heap _system_heap;
 
@@ -359,6 +486,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_reboot,
 #endif
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
+#if defined(CONFIG_INIT_PROFILING)
+	SHELL_CMD(boot-profile, NULL, "Time spent in the init entries during boot.",
+		  cmd_kernel_boot_profile),
+#endif
 	SHELL_CMD(cycles, NULL, "Kernel cycles.", cmd_kernel_cycles),
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
@@ -370,6 +501,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 #endif
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 	SHELL_CMD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap),
+#endif
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) && defined(CONFIG_THREAD_MONITOR)
+	SHELL_CMD(latency, NULL, "Threads scheduling latency histograms.",
+		  cmd_kernel_latency),
 #endif
 	SHELL_CMD(uptime, NULL, "Kernel uptime.", cmd_kernel_uptime),
 	SHELL_CMD(version, NULL, "Kernel version.", cmd_kernel_version),
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/stats/perf_stats.h>
+
+#ifdef CONFIG_PERF_STATS_ISR
+PERF_STATS_HIST_DEFINE(isr);
+#endif
+
+#ifdef CONFIG_PERF_STATS_SYSCALL
+PERF_STATS_HIST_DEFINE(syscall);
+#endif
+
+#ifdef CONFIG_PERF_STATS_NET_RX
+PERF_STATS_HIST_DEFINE(net_rx);
+#endif
+
+#ifdef CONFIG_PERF_STATS_FLASH_WRITE
+PERF_STATS_HIST_DEFINE(flash_write);
+#endif
+
+uint32_t perf_stats_bucket_min(uint32_t bucket)
+{
+	uint32_t group = bucket >> CONFIG_PERF_STATS_SUB_BUCKETS_LOG2;
+
+	if (group == 0U) {
+		return bucket;
+	}
+
+	return (PERF_STATS_SUB_BUCKETS | (bucket & (PERF_STATS_SUB_BUCKETS - 1U))) <<
+	       (group - 1U);
+}
+
+void perf_stats_record(struct perf_stats_hist *hist, uint32_t cycles)
+{
+	/* Only this CPU records into its copy */
+	unsigned int key = arch_irq_lock();
+	struct perf_stats_cpu *cpu = &hist->cpu[arch_curr_cpu()->id];
+
+	cpu->counts[perf_stats_bucket(cycles)]++;
+	cpu->sum += cycles;
+	cpu->max = MAX(cpu->max, cycles);
+
+	arch_irq_unlock(key);
+}
+
+void perf_stats_snapshot(const struct perf_stats_hist *hist,
+			 struct perf_stats_snapshot *snap)
+{
+	memset(snap, 0, sizeof(*snap));
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		const struct perf_stats_cpu *cpu = &hist->cpu[i];
+
+		for (size_t b = 0; b < PERF_STATS_BUCKETS; b++) {
+			snap->counts[b] += cpu->counts[b];
+			snap->count += cpu->counts[b];
+		}
+		snap->sum += cpu->sum;
+		snap->max = MAX(snap->max, cpu->max);
+	}
+}
+
+void perf_stats_reset(struct perf_stats_hist *hist)
+{
+	memset(hist->cpu, 0, sizeof(hist->cpu));
+}
+
+struct perf_stats_hist *perf_stats_find(const char *name)
+{
+	STRUCT_SECTION_FOREACH(perf_stats_hist, hist) {
+		if (strcmp(hist->name, name) == 0) {
+			return hist;
+		}
+	}
+
+	return NULL;
+}
+
+#ifdef CONFIG_PERF_STATS_ISR
+/* Start of the outermost ISR of each CPU */
+static uint32_t isr_start[CONFIG_MP_MAX_NUM_CPUS];
+
+void perf_stats_isr_enter(int nested)
+{
+	if (nested == 0) {
+		isr_start[arch_curr_cpu()->id] = perf_stats_start();
+	}
+}
+
+void perf_stats_isr_exit(int nested)
+{
+	if (nested == 0) {
+		perf_stats_stop(PERF_STATS_HIST(isr), isr_start[arch_curr_cpu()->id]);
+	}
+}
+#endif /* CONFIG_PERF_STATS_ISR */
+
+#ifdef CONFIG_PERF_STATS_SYSCALL
+uint32_t perf_stats_syscall_enter(void)
+{
+	return perf_stats_start();
+}
+
+void perf_stats_syscall_exit(uint32_t start)
+{
+	perf_stats_stop(PERF_STATS_HIST(syscall), start);
+}
+#endif /* CONFIG_PERF_STATS_SYSCALL */
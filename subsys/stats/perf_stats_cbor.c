@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/stats/perf_stats.h>
+
+#include <zcbor_common.h>
+#include <zcbor_encode.h>
+
+bool perf_stats_encode(zcbor_state_t *zse, const struct perf_stats_hist *hist)
+{
+	struct perf_stats_snapshot snap;
+	size_t buckets = 0;
+	bool ok;
+
+	perf_stats_snapshot(hist, &snap);
+
+	for (size_t b = 0; b < PERF_STATS_BUCKETS; b++) {
+		if (snap.counts[b] != 0U) {
+			buckets++;
+		}
+	}
+
+	ok = zcbor_map_start_encode(zse, 6)					&&
+	     zcbor_tstr_put_lit(zse, "n")					&&
+	     zcbor_uint64_put(zse, snap.count)					&&
+	     zcbor_tstr_put_lit(zse, "s")					&&
+	     zcbor_uint64_put(zse, snap.sum)					&&
+	     zcbor_tstr_put_lit(zse, "m")					&&
+	     zcbor_uint32_put(zse, snap.max)					&&
+	     zcbor_tstr_put_lit(zse, "hz")					&&
+	     zcbor_uint32_put(zse, sys_clock_hw_cycles_per_sec())		&&
+	     zcbor_tstr_put_lit(zse, "sb")					&&
+	     zcbor_uint32_put(zse, CONFIG_PERF_STATS_SUB_BUCKETS_LOG2)		&&
+	     zcbor_tstr_put_lit(zse, "b")					&&
+	     zcbor_list_start_encode(zse, buckets * 2);
+
+	/* Only the buckets which are not empty, most of them usually being */
+	for (size_t b = 0; ok && b < PERF_STATS_BUCKETS; b++) {
+		if (snap.counts[b] != 0U) {
+			ok = zcbor_uint32_put(zse, b) &&
+			     zcbor_uint32_put(zse, snap.counts[b]);
+		}
+	}
+
+	return ok &&
+	       zcbor_list_end_encode(zse, buckets * 2) &&
+	       zcbor_map_end_encode(zse, 6);
+}
+
+int perf_stats_encode_all(uint8_t *buf, size_t size, size_t *len)
+{
+	size_t count;
+	bool ok;
+
+	/* Map of histograms, each a map with a list of buckets */
+	ZCBOR_STATE_E(zse, 3, buf, size, 1);
+
+	STRUCT_SECTION_COUNT(perf_stats_hist, &count);
+
+	ok = zcbor_map_start_encode(zse, count);
+
+	STRUCT_SECTION_FOREACH(perf_stats_hist, hist) {
+		ok = ok &&
+		     zcbor_tstr_put_term(zse, hist->name) &&
+		     perf_stats_encode(zse, hist);
+	}
+
+	if (!ok || !zcbor_map_end_encode(zse, count)) {
+		return -ENOMEM;
+	}
+
+	*len = zse->payload - buf;
+
+	return 0;
+}
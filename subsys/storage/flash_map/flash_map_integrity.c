@@ -23,6 +23,9 @@
 #if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC)
 #include <tinycrypt/constants.h>
 #include <tinycrypt/sha256.h>
+#elif defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_CRYPTO_DEV)
+#include <zephyr/crypto/crypto.h>
+#define CRYPTO_DEV DEVICE_DT_GET(DT_CHOSEN(zephyr_crypto))
 #else
 #include <mbedtls/md.h>
 #endif
@@ -35,6 +38,13 @@ int flash_area_check_int_sha256(const struct flash_area *fa,
 	unsigned char hash[SHA256_DIGEST_SIZE];
 #if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC)
 	struct tc_sha256_state_struct sha;
+#elif defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_CRYPTO_DEV)
+	struct hash_ctx hash_ctx = {
+		.flags = CAP_SEPARATE_IO_BUFS | CAP_SYNC_OPS,
+	};
+	struct hash_pkt pkt = {
+		.out_buf = hash,
+	};
 #else /* CONFIG_FLASH_AREA_CHECK_INTEGRITY_MBEDTLS */
 	mbedtls_md_context_t mbed_hash_ctx;
 	const mbedtls_md_info_t *mbed_hash_info;
@@ -56,6 +66,14 @@ int flash_area_check_int_sha256(const struct flash_area *fa,
 	if (tc_sha256_init(&sha) != TC_CRYPTO_SUCCESS) {
 		return -ESRCH;
 	}
+#elif defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_CRYPTO_DEV)
+	if (!device_is_ready(CRYPTO_DEV)) {
+		return -ENODEV;
+	}
+
+	if (hash_begin_session(CRYPTO_DEV, &hash_ctx, CRYPTO_HASH_ALGO_SHA256) != 0) {
+		return -ESRCH;
+	}
 #else /* CONFIG_FLASH_AREA_CHECK_INTEGRITY_MBEDTLS */
 	mbed_hash_info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
 
@@ -83,7 +101,7 @@ int flash_area_check_int_sha256(const struct flash_area *fa,
 		if (rc != 0) {
 #if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC)
 			return rc;
-#else /* CONFIG_FLASH_AREA_CHECK_INTEGRITY_MBEDTLS */
+#else
 			goto error;
 #endif
 		}
@@ -94,6 +112,14 @@ int flash_area_check_int_sha256(const struct flash_area *fa,
 				     to_read) != TC_CRYPTO_SUCCESS) {
 			return -ESRCH;
 		}
+#elif defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_CRYPTO_DEV)
+		pkt.in_buf = fac->rbuf;
+		pkt.in_len = to_read;
+
+		if (hash_update(&hash_ctx, &pkt) != 0) {
+			rc = -ESRCH;
+			goto error;
+		}
 #else /* CONFIG_FLASH_AREA_CHECK_INTEGRITY_MBEDTLS */
 		if (mbedtls_md_update(&mbed_hash_ctx, fac->rbuf, to_read) != 0) {
 			rc = -ESRCH;
@@ -106,6 +132,13 @@ int flash_area_check_int_sha256(const struct flash_area *fa,
 	if (tc_sha256_final(hash, &sha) != TC_CRYPTO_SUCCESS) {
 		return -ESRCH;
 	}
+#elif defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_CRYPTO_DEV)
+	pkt.in_len = 0;
+
+	if (hash_compute(&hash_ctx, &pkt) != 0) {
+		rc = -ESRCH;
+		goto error;
+	}
 #else /* CONFIG_FLASH_AREA_CHECK_INTEGRITY_MBEDTLS */
 	if (mbedtls_md_finish(&mbed_hash_ctx, hash) != 0) {
 		rc = -ESRCH;
@@ -116,13 +149,16 @@ int flash_area_check_int_sha256(const struct flash_area *fa,
 	if (memcmp(hash, fac->match, SHA256_DIGEST_SIZE)) {
 #if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC)
 		return -EILSEQ;
-#else /* CONFIG_FLASH_AREA_CHECK_INTEGRITY_MBEDTLS */
+#else
 		rc = -EILSEQ;
 		goto error;
 #endif
 	}
 
-#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_MBEDTLS)
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_CRYPTO_DEV)
+error:
+	hash_free_session(CRYPTO_DEV, &hash_ctx);
+#elif defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_MBEDTLS)
 error:
 	mbedtls_md_free(&mbed_hash_ctx);
 #endif
@@ -72,9 +72,13 @@ static int settings_direct_loader(const char *key, size_t len,
 
 #endif /* CONFIG_STREAM_FLASH_PROGRESS */
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+static int flash_sync_wait(struct stream_flash_ctx *ctx);
+#endif
+
 #ifdef CONFIG_STREAM_FLASH_ERASE
 
-int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
+static int erase_page(struct stream_flash_ctx *ctx, off_t off)
 {
 	int rc;
 	struct flash_pages_info page;
@@ -102,44 +106,54 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 	return rc;
 }
 
+int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
+{
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	/* The work writing the pending buffer also erases pages */
+	int rc = flash_sync_wait(ctx);
+
+	if (rc != 0) {
+		return rc;
+	}
+#endif
+
+	return erase_page(ctx, off);
+}
+
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+/* Write len bytes of buf at the given offset of the flash device, erasing
+ * the page first if needed, and verify them with the callback.
+ */
+static int flash_program(struct stream_flash_ctx *ctx, uint8_t *buf, size_t len,
+			 size_t write_addr)
 {
 	int rc = 0;
-	size_t write_addr = ctx->offset + ctx->bytes_written;
 	size_t buf_bytes_aligned;
 	size_t fill_length;
 	uint8_t filler;
 
-
-	if (ctx->buf_bytes == 0) {
-		return 0;
-	}
-
-	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
-
-		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
-		if (rc < 0) {
-			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
-				rc, write_addr);
-			return rc;
-		}
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	rc = erase_page(ctx, write_addr + len - 1);
+	if (rc < 0) {
+		LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
+			rc, write_addr);
+		return rc;
 	}
+#endif
 
 	fill_length = flash_get_write_block_size(ctx->fdev);
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (len % fill_length) {
+		fill_length -= len % fill_length;
 		filler = flash_get_parameters(ctx->fdev)->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + len, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = len + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -151,30 +165,140 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < len; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, len);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, len, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
 		}
 	}
 
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+
+static K_THREAD_STACK_DEFINE(stream_flash_stack, CONFIG_STREAM_FLASH_ASYNC_STACK_SIZE);
+static struct k_work_q stream_flash_work_q;
+
+static int stream_flash_work_q_init(void)
+{
+	const struct k_work_queue_config cfg = {.name = "stream_flash"};
+
+	k_work_queue_init(&stream_flash_work_q);
+
+	k_work_queue_start(&stream_flash_work_q, stream_flash_stack,
+			   K_THREAD_STACK_SIZEOF(stream_flash_stack),
+			   CONFIG_STREAM_FLASH_ASYNC_PRIO, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+static void flash_sync_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx, work);
+	size_t write_addr = ctx->offset + ctx->bytes_written;
+
+	ctx->pending_rc = flash_program(ctx, ctx->pending_buf, ctx->pending_bytes,
+					write_addr);
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	size_t next_addr = write_addr + ctx->pending_bytes;
+
+	/* Erase the page of the next write ahead, an error is reported
+	 * when that write erases the page again.
+	 */
+	if ((ctx->pending_rc == 0) &&
+	    (next_addr < ctx->offset + ctx->available)) {
+		(void)erase_page(ctx, next_addr);
+	}
+#endif
+}
+
+/* Wait for the end of the write of the pending buffer and account for it.
+ * A failed write is reported until the context is initialized again.
+ */
+static int flash_sync_wait(struct stream_flash_ctx *ctx)
+{
+	struct k_work_sync sync;
+
+	if (ctx->pending_bytes == 0) {
+		return 0;
+	}
+
+	(void)k_work_flush(&ctx->work, &sync);
+
+	if (ctx->pending_rc != 0) {
+		return ctx->pending_rc;
+	}
+
+	ctx->bytes_written += ctx->pending_bytes;
+	ctx->pending_bytes = 0;
+
+	return 0;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	uint8_t *buf;
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = flash_sync_wait(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+
+	/* Write the buffer from the work queue and fill the other one */
+	buf = ctx->pending_buf;
+	ctx->pending_buf = ctx->buf;
+	ctx->pending_bytes = ctx->buf_bytes;
+	ctx->buf = buf;
+	ctx->buf_bytes = 0U;
+
+	(void)k_work_submit_to_queue(&stream_flash_work_q, &ctx->work);
+
+	return 0;
+}
+
+#else /* CONFIG_STREAM_FLASH_ASYNC */
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = flash_program(ctx, ctx->buf, ctx->buf_bytes,
+			   ctx->offset + ctx->bytes_written);
+	if (rc != 0) {
+		return rc;
+	}
+
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
 	return rc;
 }
 
+#endif /* CONFIG_STREAM_FLASH_ASYNC */
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
@@ -186,7 +310,13 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	size_t bytes = ctx->bytes_written + ctx->buf_bytes;
+
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	bytes += ctx->pending_bytes;
+#endif
+
+	if (bytes + len > ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -216,6 +346,12 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	if (flush && rc == 0) {
+		rc = flash_sync_wait(ctx);
+	}
+#endif
+
 	return rc;
 }
 
@@ -262,6 +398,11 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	}
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	/* One half of the buffer is written while the other is filled */
+	buf_len /= 2;
+#endif
+
 	struct _inspect_flash inspect_flash_ctx = {
 		.buf_len = buf_len,
 		.total_size = 0
@@ -300,6 +441,13 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	ctx->last_erased_page_start_offset = -1;
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	k_work_init(&ctx->work, flash_sync_work_handler);
+	ctx->pending_buf = buf + buf_len;
+	ctx->pending_bytes = 0U;
+	ctx->pending_rc = 0;
+#endif
+
 	return 0;
 }
 
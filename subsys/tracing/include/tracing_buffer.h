@@ -104,6 +104,32 @@ int tracing_buffer_get_finish(uint32_t size);
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
 
+/**
+ * @brief Put one event in the tracing buffer of the current CPU.
+ *
+ * Only available with CONFIG_TRACING_PERCPU_BUFFERS, interrupts of the
+ * current CPU must be locked.
+ *
+ * @param data Address of the event.
+ * @param size Event size (in bytes).
+ *
+ * @retval True if the event was put; False if the buffer is full.
+ */
+bool tracing_buffer_event_put(const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Read events of all the CPUs, oldest first, to output buffer.
+ *
+ * Only available with CONFIG_TRACING_PERCPU_BUFFERS. Only whole events
+ * are read.
+ *
+ * @param data Address of the output buffer.
+ * @param size Output buffer size (in bytes).
+ *
+ * @retval Number of bytes written to the output buffer.
+ */
+uint32_t tracing_buffer_events_get(uint8_t *data, uint32_t size);
+
 /**
  * @brief Get buffer from tracing command buffer.
  *
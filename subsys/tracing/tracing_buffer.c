@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/ring_buffer.h>
+#include <tracing_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
@@ -17,6 +19,222 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 	return sizeof(tracing_cmd_buffer);
 }
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+/* Each CPU puts its events in its own buffer, with its interrupts locked,
+ * and the tracing thread gets them: a buffer has a single producer and a
+ * single consumer, so that the CPUs share no lock.
+ *
+ * An event is preceded by its length and the number of cycles elapsed since
+ * the previous event of the CPU, both encoded as variable length integers,
+ * so that the thread outputs the events of all the CPUs oldest first.
+ */
+#define EVENT_HDR_MAX_LEN 10
+
+struct tracing_cpu_buffer {
+	struct ring_buf rb;
+	/* Timestamp of the last event put, used by the CPU. */
+	uint32_t put_ts;
+	/* Timestamp, header and event lengths of the next event to get, used
+	 * by the tracing thread. The event length is 0 until the header is
+	 * read.
+	 */
+	uint32_t get_ts;
+	uint32_t get_len;
+	uint32_t get_hdr_len;
+	uint8_t buffer[CONFIG_TRACING_BUFFER_SIZE];
+};
+
+static struct tracing_cpu_buffer tracing_cpu_buffers[CONFIG_MP_MAX_NUM_CPUS];
+
+static size_t varint_put(uint8_t *buf, uint32_t value)
+{
+	size_t len = 0;
+
+	while (value >= 0x80) {
+		buf[len++] = (uint8_t)value | 0x80;
+		value >>= 7;
+	}
+
+	buf[len++] = (uint8_t)value;
+
+	return len;
+}
+
+static size_t varint_get(const uint8_t *buf, size_t size, uint32_t *value)
+{
+	size_t len = 0;
+
+	*value = 0;
+	while (len < size) {
+		*value |= (uint32_t)(buf[len] & 0x7f) << (7 * len);
+		if ((buf[len++] & 0x80) == 0) {
+			break;
+		}
+	}
+
+	return len;
+}
+
+static struct tracing_cpu_buffer *cpu_buffer_get(void)
+{
+	/* Interrupts of the CPU are locked by the caller, so the thread
+	 * cannot migrate.
+	 */
+	return &tracing_cpu_buffers[arch_curr_cpu()->id];
+}
+
+static void buf_put(struct ring_buf *rb, const uint8_t *data, uint32_t size)
+{
+	uint32_t claimed;
+	uint8_t *dst;
+
+	while (size > 0) {
+		claimed = ring_buf_put_claim(rb, &dst, size);
+		memcpy(dst, data, claimed);
+		data += claimed;
+		size -= claimed;
+	}
+}
+
+/* Copies, if data is not NULL, the next bytes of the buffer without
+ * releasing them.
+ */
+static uint32_t buf_get(struct ring_buf *rb, uint8_t *data, uint32_t size)
+{
+	uint32_t total = 0;
+	uint32_t claimed;
+	uint8_t *src;
+
+	while (total < size) {
+		claimed = ring_buf_get_claim(rb, &src, size - total);
+		if (claimed == 0) {
+			break;
+		}
+
+		/* Data is read after the CPU published it. */
+		barrier_dmem_fence_full();
+		if (data != NULL) {
+			memcpy(&data[total], src, claimed);
+		}
+
+		total += claimed;
+	}
+
+	return total;
+}
+
+bool tracing_buffer_event_put(const uint8_t *data, uint32_t size)
+{
+	struct tracing_cpu_buffer *cb = cpu_buffer_get();
+	uint8_t hdr[EVENT_HDR_MAX_LEN];
+	uint32_t now = k_cycle_get_32();
+	uint32_t hdr_len;
+
+	hdr_len = varint_put(hdr, size);
+	hdr_len += varint_put(&hdr[hdr_len], now - cb->put_ts);
+
+	if (ring_buf_space_get(&cb->rb) < hdr_len + size) {
+		return false;
+	}
+
+	buf_put(&cb->rb, hdr, hdr_len);
+	buf_put(&cb->rb, data, size);
+
+	/* The thread sees the whole event once it is published. */
+	barrier_dmem_fence_full();
+	(void)ring_buf_put_finish(&cb->rb, hdr_len + size);
+
+	cb->put_ts = now;
+
+	return true;
+}
+
+static bool event_peek(struct tracing_cpu_buffer *cb)
+{
+	uint8_t hdr[EVENT_HDR_MAX_LEN];
+	uint32_t delta;
+	uint32_t len;
+	size_t off;
+
+	if (cb->get_len != 0) {
+		return true;
+	}
+
+	len = buf_get(&cb->rb, hdr, sizeof(hdr));
+	(void)ring_buf_get_finish(&cb->rb, 0);
+	if (len == 0) {
+		return false;
+	}
+
+	off = varint_get(hdr, len, &cb->get_len);
+	off += varint_get(&hdr[off], len - off, &delta);
+
+	cb->get_hdr_len = off;
+	cb->get_ts += delta;
+
+	return true;
+}
+
+uint32_t tracing_buffer_events_get(uint8_t *data, uint32_t size)
+{
+	struct tracing_cpu_buffer *oldest;
+	uint32_t total = 0;
+
+	while (true) {
+		oldest = NULL;
+
+		for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+			struct tracing_cpu_buffer *cb = &tracing_cpu_buffers[i];
+
+			if (event_peek(cb) &&
+			    (oldest == NULL || (int32_t)(cb->get_ts - oldest->get_ts) < 0)) {
+				oldest = cb;
+			}
+		}
+
+		if (oldest == NULL || oldest->get_len > size - total) {
+			break;
+		}
+
+		(void)buf_get(&oldest->rb, NULL, oldest->get_hdr_len);
+		(void)buf_get(&oldest->rb, &data[total], oldest->get_len);
+
+		/* The CPU reuses the space once the event is copied. */
+		barrier_dmem_fence_full();
+		(void)ring_buf_get_finish(&oldest->rb, oldest->get_hdr_len + oldest->get_len);
+
+		total += oldest->get_len;
+		oldest->get_len = 0;
+	}
+
+	return total;
+}
+
+void tracing_buffer_init(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		struct tracing_cpu_buffer *cb = &tracing_cpu_buffers[i];
+
+		ring_buf_init(&cb->rb, sizeof(cb->buffer), cb->buffer);
+		cb->put_ts = 0;
+		cb->get_ts = 0;
+		cb->get_len = 0;
+	}
+}
+
+bool tracing_buffer_is_empty(void)
+{
+	return ring_buf_is_empty(&cpu_buffer_get()->rb);
+}
+
+uint32_t tracing_buffer_capacity_get(void)
+{
+	return sizeof(tracing_cpu_buffers[0].buffer);
+}
+#else
+static struct ring_buf tracing_ring_buf;
+static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
 	return ring_buf_put_claim(&tracing_ring_buf, data, size);
@@ -67,3 +285,4 @@ uint32_t tracing_buffer_space_get(void)
 {
 	return ring_buf_space_get(&tracing_ring_buf);
 }
+#endif /* CONFIG_TRACING_PERCPU_BUFFERS */
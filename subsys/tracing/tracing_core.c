@@ -52,6 +52,31 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+/* Events of all the CPUs are merged in this buffer, which can hold the
+ * largest event.
+ */
+static uint8_t tracing_output_buffer[CONFIG_TRACING_BUFFER_SIZE];
+
+static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
+{
+	uint32_t transferring_length;
+
+	tracing_thread_tid = k_current_get();
+
+	while (true) {
+		transferring_length =
+			tracing_buffer_events_get(tracing_output_buffer,
+						  sizeof(tracing_output_buffer));
+		if (transferring_length == 0) {
+			k_sem_take(&tracing_thread_sem, K_FOREVER);
+		} else {
+			tracing_buffer_handle(tracing_output_buffer,
+					      transferring_length);
+		}
+	}
+}
+#else
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -75,6 +100,7 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		}
 	}
 }
+#endif
 
 static void tracing_thread_timer_expiry_fn(struct k_timer *timer)
 {
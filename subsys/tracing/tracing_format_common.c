@@ -6,9 +6,53 @@
 
 #include <string.h>
 #include <zephyr/sys/cbprintf.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
 #include <tracing_buffer.h>
 #include <tracing_format_common.h>
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+/* Events are formatted on the stack and put at once in the buffer of the
+ * CPU, strings are truncated to the packet size.
+ */
+bool tracing_format_string_put(const char *str, va_list args)
+{
+	uint8_t packet[CONFIG_TRACING_PACKET_MAX_SIZE];
+	int length;
+
+	length = vsnprintk((char *)packet, sizeof(packet), str, args);
+	if (length < 0) {
+		return false;
+	}
+
+	return tracing_buffer_event_put(packet, MIN(length, sizeof(packet) - 1));
+}
+
+bool tracing_format_raw_data_put(uint8_t *data, uint32_t size)
+{
+	return tracing_buffer_event_put(data, size);
+}
+
+bool tracing_format_data_put(tracing_data_t *tracing_data_array, uint32_t count)
+{
+	uint8_t packet[CONFIG_TRACING_PACKET_MAX_SIZE];
+	uint32_t total_size = 0U;
+
+	for (uint32_t i = 0; i < count; i++) {
+		tracing_data_t *tracing_data = tracing_data_array + i;
+
+		if (tracing_data->length > sizeof(packet) - total_size) {
+			return false;
+		}
+
+		memcpy(&packet[total_size], tracing_data->data, tracing_data->length);
+		total_size += tracing_data->length;
+	}
+
+	return tracing_buffer_event_put(packet, total_size);
+}
+#else
+
 static int str_put(int c, void *ctx)
 {
 	tracing_ctx_t *str_ctx = (tracing_ctx_t *)ctx;
@@ -83,3 +127,4 @@ bool tracing_format_data_put(tracing_data_t *tracing_data_array, uint32_t count)
 	tracing_buffer_put_finish(total_size);
 	return true;
 }
+#endif /* CONFIG_TRACING_PERCPU_BUFFERS */
@@ -12,6 +12,11 @@
 
 static int nested_interrupts[CONFIG_MP_MAX_NUM_CPUS];
 
+#ifdef CONFIG_PERF_STATS_ISR
+void perf_stats_isr_enter(int nested);
+void perf_stats_isr_exit(int nested);
+#endif
+
 void __weak sys_trace_thread_create_user(struct k_thread *thread) {}
 void __weak sys_trace_thread_abort_user(struct k_thread *thread) {}
 void __weak sys_trace_thread_suspend_user(struct k_thread *thread) {}
@@ -105,6 +110,9 @@ void sys_trace_isr_enter(void)
 	unsigned int key = irq_lock();
 	_cpu_t *curr_cpu = _current_cpu;
 
+#ifdef CONFIG_PERF_STATS_ISR
+	perf_stats_isr_enter(nested_interrupts[curr_cpu->id]);
+#endif
 	sys_trace_isr_enter_user(nested_interrupts[curr_cpu->id]);
 	nested_interrupts[curr_cpu->id]++;
 
@@ -118,6 +126,9 @@ void sys_trace_isr_exit(void)
 
 	nested_interrupts[curr_cpu->id]--;
 	sys_trace_isr_exit_user(nested_interrupts[curr_cpu->id]);
+#ifdef CONFIG_PERF_STATS_ISR
+	perf_stats_isr_exit(nested_interrupts[curr_cpu->id]);
+#endif
 
 	irq_unlock(key);
 }
@@ -205,6 +205,72 @@ static struct loopback_desc lb_desc_##x = {			\
 	},							\
 };								\
 
+#if CONFIG_USBD_LOOPBACK_BULK_BUF_COUNT > 0
+/*
+ * Bulk source and sink buffers, kept queued on the bulk endpoints of the
+ * first interface while the configuration is enabled.
+ */
+NET_BUF_POOL_FIXED_DEFINE(lb_bulk_pool,
+			  CONFIG_USBD_LOOPBACK_INSTANCES_COUNT *
+			  CONFIG_USBD_LOOPBACK_BULK_BUF_COUNT * 2,
+			  CONFIG_USBD_LOOPBACK_BULK_BUF_SIZE,
+			  sizeof(struct udc_buf_info), NULL);
+
+static int lb_bulk_enqueue(struct usbd_class_node *c_nd, struct net_buf *buf)
+{
+	struct udc_buf_info *bi = udc_get_buf_info(buf);
+	uint8_t ep = bi->ep;
+	int ret;
+
+	memset(bi, 0, sizeof(struct udc_buf_info));
+	bi->ep = ep;
+	net_buf_reset(buf);
+
+	if (USB_EP_DIR_IS_IN(ep)) {
+		/* Source data is left as it is, zeroes on allocation */
+		net_buf_add(buf, buf->size);
+	}
+
+	ret = usbd_ep_enqueue(c_nd, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		net_buf_unref(buf);
+	}
+
+	return ret;
+}
+
+static void lb_bulk_start(struct usbd_class_node *c_nd, const uint8_t ep)
+{
+	struct net_buf *buf;
+
+	for (int i = 0; i < CONFIG_USBD_LOOPBACK_BULK_BUF_COUNT; i++) {
+		buf = net_buf_alloc(&lb_bulk_pool, K_NO_WAIT);
+		if (buf == NULL) {
+			LOG_ERR("Failed to allocate net_buf for 0x%02x", ep);
+			return;
+		}
+
+		udc_get_buf_info(buf)->ep = ep;
+		if (USB_EP_DIR_IS_IN(ep)) {
+			memset(buf->__buf, 0, buf->size);
+		}
+
+		if (lb_bulk_enqueue(c_nd, buf)) {
+			return;
+		}
+	}
+}
+
+static void lb_enable(struct usbd_class_node *c_nd)
+{
+	struct loopback_desc *desc = (struct loopback_desc *)c_nd->data->desc;
+
+	lb_bulk_start(c_nd, desc->if0_out_ep.bEndpointAddress);
+	lb_bulk_start(c_nd, desc->if0_in_ep.bEndpointAddress);
+}
+#endif
+
 static void lb_update(struct usbd_class_node *c_nd,
 		      uint8_t iface, uint8_t alternate)
 {
@@ -269,6 +335,20 @@ static int lb_request_handler(struct usbd_class_node *c_nd,
 
 	bi = (struct udc_buf_info *)net_buf_user_data(buf);
 	LOG_DBG("%p -> ep 0x%02x, len %u, err %d", c_nd, bi->ep, buf->len, err);
+
+#if CONFIG_USBD_LOOPBACK_BULK_BUF_COUNT > 0
+	if (net_buf_pool_get(buf->pool_id) == &lb_bulk_pool) {
+		if (err) {
+			/* Transfer cancelled, the endpoint is disabled */
+			net_buf_unref(buf);
+			return 0;
+		}
+
+		/* Keep the transfer queue full */
+		return lb_bulk_enqueue(c_nd, buf);
+	}
+#endif
+
 	usbd_ep_buf_free(c_nd->data->uds_ctx, buf);
 
 	return 0;
@@ -286,6 +366,9 @@ struct usbd_class_api lb_api = {
 	.control_to_host = lb_control_to_host,
 	.control_to_dev = lb_control_to_dev,
 	.request = lb_request_handler,
+#if CONFIG_USBD_LOOPBACK_BULK_BUF_COUNT > 0
+	.enable = lb_enable,
+#endif
 	.init = lb_init,
 };
 
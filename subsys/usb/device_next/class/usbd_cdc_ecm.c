@@ -28,15 +28,16 @@ enum {
 	CDC_ECM_IFACE_UP,
 	CDC_ECM_CLASS_ENABLED,
 	CDC_ECM_CLASS_SUSPENDED,
-	CDC_ECM_OUT_ENGAGED,
 };
 
 /*
- * Transfers through two endpoints proceed in a synchronous manner,
- * with maximum block of NET_ETH_MAX_FRAME_SIZE.
+ * Transfers through the bulk IN endpoint proceed in a synchronous manner,
+ * CONFIG_USBD_CDC_ECM_OUT_BUF_COUNT transfers are kept queued on the bulk
+ * OUT endpoint, all with maximum block of NET_ETH_MAX_FRAME_SIZE.
  */
 NET_BUF_POOL_FIXED_DEFINE(cdc_ecm_ep_pool,
-			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
+			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) *
+			  (CONFIG_USBD_CDC_ECM_OUT_BUF_COUNT + 1),
 			  NET_ETH_MAX_FRAME_SIZE,
 			  sizeof(struct udc_buf_info), NULL);
 
@@ -61,6 +62,8 @@ struct cdc_ecm_eth_data {
 	struct k_sem sync_sem;
 	struct k_sem notif_sem;
 	atomic_t state;
+	/* Number of transfers queued on the bulk OUT endpoint */
+	atomic_t out_queued;
 };
 
 struct usbd_cdc_ecm_desc {
@@ -167,23 +170,26 @@ static int cdc_ecm_out_start(struct usbd_class_node *const c_nd)
 		return -EACCES;
 	}
 
-	if (atomic_test_and_set_bit(&data->state, CDC_ECM_OUT_ENGAGED)) {
-		return -EBUSY;
-	}
-
 	ep = cdc_ecm_get_bulk_out(c_nd);
-	buf = cdc_ecm_buf_alloc(ep);
-	if (buf == NULL) {
-		return -ENOMEM;
-	}
 
-	ret = usbd_ep_enqueue(c_nd, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
-		net_buf_unref(buf);
+	while (atomic_get(&data->out_queued) < CONFIG_USBD_CDC_ECM_OUT_BUF_COUNT) {
+		buf = cdc_ecm_buf_alloc(ep);
+		if (buf == NULL) {
+			return -ENOMEM;
+		}
+
+		atomic_inc(&data->out_queued);
+		ret = usbd_ep_enqueue(c_nd, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			atomic_dec(&data->out_queued);
+			net_buf_unref(buf);
+
+			return ret;
+		}
 	}
 
-	return  ret;
+	return 0;
 }
 
 static int cdc_ecm_acl_out_cb(struct usbd_class_node *const c_nd,
@@ -231,7 +237,7 @@ static int cdc_ecm_acl_out_cb(struct usbd_class_node *const c_nd,
 
 restart_out_transfer:
 	net_buf_unref(buf);
-	atomic_clear_bit(&data->state, CDC_ECM_OUT_ENGAGED);
+	atomic_dec(&data->out_queued);
 
 	return cdc_ecm_out_start(c_nd);
 }
@@ -434,7 +440,6 @@ static int cdc_ecm_send(const struct device *dev, struct net_pkt *const pkt)
 	struct usbd_class_node *c_nd = data->c_nd;
 	size_t len = net_pkt_get_len(pkt);
 	struct net_buf *buf;
-	uint16_t bulk_mps;
 
 	if (len > NET_ETH_MAX_FRAME_SIZE) {
 		LOG_WRN("Trying to send too large packet, drop");
@@ -461,20 +466,8 @@ static int cdc_ecm_send(const struct device *dev, struct net_pkt *const pkt)
 	}
 
 	net_buf_add(buf, len);
-
-	/*
-	 * REVISE: It should be more abstract and
-	 * not pull UDC stuff in the class code.
-	 */
-	if (udc_device_speed(c_nd->data->uds_ctx->dev) == UDC_BUS_SPEED_FS) {
-		bulk_mps = 64;
-	} else {
-		bulk_mps = 512;
-	}
-
-	if (!(buf->len % bulk_mps)) {
-		udc_ep_buf_set_zlp(buf);
-	}
+	/* Terminates the transfer if its length is a multiple of MPS */
+	udc_ep_buf_set_zlp(buf);
 
 	usbd_ep_enqueue(c_nd, buf);
 	k_sem_take(&data->sync_sem, K_FOREVER);
@@ -0,0 +1,1120 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT zephyr_cdc_ncm_ethernet
+
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ethernet.h>
+
+#include <eth.h>
+
+#include <zephyr/usb/usbd.h>
+#include <zephyr/usb/usb_ch9.h>
+#include <zephyr/usb/class/usb_cdc.h>
+#include <zephyr/drivers/usb/udc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(cdc_ncm, CONFIG_USBD_CDC_NCM_LOG_LEVEL);
+
+#define CDC_NCM_EP_MPS_BULK		0
+#define CDC_NCM_EP_MPS_INT		16
+#define CDC_NCM_EP_INTERVAL_INT		0x0A
+
+/* NCM10.pdf, 3.2.1 NTB Header and 3.3.1 NDP signatures */
+#define CDC_NCM_NTH16_SIGNATURE		0x484D434E
+#define CDC_NCM_NDP16_SIGNATURE		0x304D434E
+
+/* Only 16-bit NTBs are supported */
+#define CDC_NCM_NTB_FORMAT_16		0x0001
+#define CDC_NCM_NTB_MIN_IN_SIZE		2048
+
+/* Datagrams and NDPs are aligned to 4 bytes in both directions */
+#define CDC_NCM_ALIGNMENT		4
+
+/* Number of NDP entries reserved in an IN NTB, without the terminator */
+#define CDC_NCM_DATAGRAMS_IN		32
+
+/* Limit of NDPs followed in a single OUT NTB */
+#define CDC_NCM_NDPS_OUT		8
+
+/* One transfer is received while the previous one is unpacked */
+#define CDC_NCM_OUT_BUF_COUNT		2
+
+enum {
+	CDC_NCM_IFACE_UP,
+	CDC_NCM_CLASS_ENABLED,
+	CDC_NCM_CLASS_SUSPENDED,
+	CDC_NCM_DATA_IFACE_ENABLED,
+	CDC_NCM_NOTIF_PENDING,
+};
+
+/*
+ * An IN NTB is sent while the next one collects the frames passed down by
+ * the network stack, OUT NTBs are received while the previous one is
+ * unpacked.
+ */
+NET_BUF_POOL_FIXED_DEFINE(cdc_ncm_in_pool,
+			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
+			  CONFIG_USBD_CDC_NCM_NTB_IN_SIZE,
+			  sizeof(struct udc_buf_info), NULL);
+
+NET_BUF_POOL_FIXED_DEFINE(cdc_ncm_out_pool,
+			  DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) *
+			  CDC_NCM_OUT_BUF_COUNT,
+			  CONFIG_USBD_CDC_NCM_NTB_OUT_SIZE,
+			  sizeof(struct udc_buf_info), NULL);
+
+/* NCM10.pdf, 6.2.1 GetNtbParameters */
+struct cdc_ncm_ntb_parameters {
+	uint16_t wLength;
+	uint16_t bmNtbFormatsSupported;
+	uint32_t dwNtbInMaxSize;
+	uint16_t wNdpInDivisor;
+	uint16_t wNdpInPayloadRemainder;
+	uint16_t wNdpInAlignment;
+	uint16_t wReserved;
+	uint32_t dwNtbOutMaxSize;
+	uint16_t wNdpOutDivisor;
+	uint16_t wNdpOutPayloadRemainder;
+	uint16_t wNdpOutAlignment;
+	uint16_t wNtbOutMaxDatagrams;
+} __packed;
+
+/* NCM10.pdf, 3.2.1 NCM Transfer Header (16-bit) */
+struct cdc_ncm_nth16 {
+	uint32_t dwSignature;
+	uint16_t wHeaderLength;
+	uint16_t wSequence;
+	uint16_t wBlockLength;
+	uint16_t wNdpIndex;
+} __packed;
+
+/* NCM10.pdf, 3.3.1 NCM Datagram Pointer Entry (16-bit) */
+struct cdc_ncm_dpe16 {
+	uint16_t wDatagramIndex;
+	uint16_t wDatagramLength;
+} __packed;
+
+/* NCM10.pdf, 3.3.1 NCM Datagram Pointer (16-bit) */
+struct cdc_ncm_ndp16 {
+	uint32_t dwSignature;
+	uint16_t wLength;
+	uint16_t wNextNdpIndex;
+	struct cdc_ncm_dpe16 dpe[];
+} __packed;
+
+/* Length of the NDP reserved in an IN NTB, including the terminator */
+#define CDC_NCM_NDP16_IN_LEN	(sizeof(struct cdc_ncm_ndp16) +		\
+				 (CDC_NCM_DATAGRAMS_IN + 1) *		\
+				 sizeof(struct cdc_ncm_dpe16))
+
+/* Offset of the first datagram in an IN NTB */
+#define CDC_NCM_IN_DATA_OFFSET	ROUND_UP(sizeof(struct cdc_ncm_nth16) +	\
+					 CDC_NCM_NDP16_IN_LEN,		\
+					 CDC_NCM_ALIGNMENT)
+
+BUILD_ASSERT(CONFIG_USBD_CDC_NCM_NTB_IN_SIZE >= CDC_NCM_NTB_MIN_IN_SIZE,
+	     "IN NTB must be able to hold the NCM minimum");
+
+struct cdc_ncm_notification {
+	union {
+		uint8_t bmRequestType;
+		struct usb_req_type_field RequestType;
+	};
+	uint8_t bNotificationType;
+	uint16_t wValue;
+	uint16_t wIndex;
+	uint16_t wLength;
+} __packed;
+
+struct cdc_ncm_eth_data {
+	struct usbd_class_node *c_nd;
+	struct usbd_desc_node *const mac_desc_nd;
+
+	struct net_if *iface;
+	uint8_t mac_addr[6];
+
+	struct k_sem notif_sem;
+	atomic_t state;
+	/* Connection state to notify on resume, see CDC_NCM_NOTIF_PENDING */
+	bool notif_connected;
+	/* Sends what was held back while the bus was suspended */
+	struct k_work resume_work;
+
+	/* Serializes IN NTB aggregation and transmission */
+	struct k_mutex tx_lock;
+	/* Given when an IN NTB transfer completes */
+	struct k_sem tx_sem;
+	/* IN NTB collecting frames, NULL if there is none */
+	struct net_buf *tx_buf;
+	/* Number of datagrams in tx_buf */
+	uint16_t tx_count;
+	/* An IN NTB transfer is in progress */
+	bool tx_busy;
+	uint16_t tx_sequence;
+	/* Maximum IN NTB size as set by the host */
+	uint32_t ntb_in_size;
+};
+
+struct usbd_cdc_ncm_desc {
+	struct usb_association_descriptor iad;
+
+	struct usb_if_descriptor if0;
+	struct cdc_header_descriptor if0_header;
+	struct cdc_union_descriptor if0_union;
+	struct cdc_ecm_descriptor if0_ecm;
+	struct cdc_ncm_descriptor if0_ncm;
+	struct usb_ep_descriptor if0_int_ep;
+
+	struct usb_if_descriptor if1_0;
+
+	struct usb_if_descriptor if1_1;
+	struct usb_ep_descriptor if1_1_in_ep;
+	struct usb_ep_descriptor if1_1_out_ep;
+
+	struct usb_desc_header nil_desc;
+} __packed;
+
+static uint8_t cdc_ncm_get_ctrl_if(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+
+	return desc->if0.bInterfaceNumber;
+}
+
+static uint8_t cdc_ncm_get_int_in(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+
+	return desc->if0_int_ep.bEndpointAddress;
+}
+
+static uint8_t cdc_ncm_get_bulk_in(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+
+	return desc->if1_1_in_ep.bEndpointAddress;
+}
+
+static uint8_t cdc_ncm_get_bulk_out(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+
+	return desc->if1_1_out_ep.bEndpointAddress;
+}
+
+static struct net_buf *cdc_ncm_buf_alloc(struct net_buf_pool *const pool,
+					 const uint8_t ep)
+{
+	struct net_buf *buf = NULL;
+	struct udc_buf_info *bi;
+
+	buf = net_buf_alloc(pool, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	bi = udc_get_buf_info(buf);
+	memset(bi, 0, sizeof(struct udc_buf_info));
+	bi->ep = ep;
+
+	return buf;
+}
+
+static int cdc_ncm_out_start(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct net_buf *buf;
+	uint8_t ep;
+	int ret;
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+		return -EACCES;
+	}
+
+	ep = cdc_ncm_get_bulk_out(c_nd);
+	buf = cdc_ncm_buf_alloc(&cdc_ncm_out_pool, ep);
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	ret = usbd_ep_enqueue(c_nd, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		net_buf_unref(buf);
+	}
+
+	return ret;
+}
+
+static void cdc_ncm_recv_datagram(struct cdc_ncm_eth_data *const data,
+				  const uint8_t *const dgram, const size_t len)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_with_buffer(data->iface, len,
+					   AF_UNSPEC, 0, K_FOREVER);
+	if (!pkt) {
+		LOG_ERR("No memory for net_pkt");
+		return;
+	}
+
+	if (net_pkt_write(pkt, dgram, len)) {
+		LOG_ERR("Unable to write into pkt");
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	LOG_DBG("Received packet len %zu", net_pkt_get_len(pkt));
+	if (net_recv_data(data->iface, pkt) < 0) {
+		LOG_ERR("Packet %p dropped by network stack", pkt);
+		net_pkt_unref(pkt);
+	}
+}
+
+/* Passes all datagrams of an OUT NTB to the network stack */
+static void cdc_ncm_unpack(struct cdc_ncm_eth_data *const data,
+			   const uint8_t *const ntb, const size_t len)
+{
+	const struct cdc_ncm_nth16 *nth = (const void *)ntb;
+	const struct cdc_ncm_ndp16 *ndp;
+	size_t block_len;
+	size_t ndp_idx;
+	size_t ndp_len;
+
+	if (len < sizeof(struct cdc_ncm_nth16) ||
+	    sys_le32_to_cpu(nth->dwSignature) != CDC_NCM_NTH16_SIGNATURE ||
+	    sys_le16_to_cpu(nth->wHeaderLength) != sizeof(struct cdc_ncm_nth16)) {
+		LOG_WRN("Invalid NTH16");
+		return;
+	}
+
+	block_len = sys_le16_to_cpu(nth->wBlockLength);
+	if (block_len > len) {
+		LOG_WRN("NTB block length %zu exceeds transfer length %zu",
+			block_len, len);
+		return;
+	}
+
+	ndp_idx = sys_le16_to_cpu(nth->wNdpIndex);
+
+	for (int i = 0; i < CDC_NCM_NDPS_OUT && ndp_idx != 0; i++) {
+		if (ndp_idx % CDC_NCM_ALIGNMENT != 0 ||
+		    ndp_idx < sizeof(struct cdc_ncm_nth16) ||
+		    ndp_idx + sizeof(struct cdc_ncm_ndp16) > block_len) {
+			LOG_WRN("Invalid NDP index %zu", ndp_idx);
+			return;
+		}
+
+		ndp = (const void *)&ntb[ndp_idx];
+		ndp_len = sys_le16_to_cpu(ndp->wLength);
+		if (sys_le32_to_cpu(ndp->dwSignature) != CDC_NCM_NDP16_SIGNATURE ||
+		    ndp_len < sizeof(struct cdc_ncm_ndp16) ||
+		    ndp_idx + ndp_len > block_len) {
+			LOG_WRN("Invalid NDP16");
+			return;
+		}
+
+		for (size_t n = 0; n < (ndp_len - sizeof(struct cdc_ncm_ndp16)) /
+				       sizeof(struct cdc_ncm_dpe16); n++) {
+			size_t idx = sys_le16_to_cpu(ndp->dpe[n].wDatagramIndex);
+			size_t dlen = sys_le16_to_cpu(ndp->dpe[n].wDatagramLength);
+
+			if (idx == 0 || dlen == 0) {
+				/* Terminating entry */
+				break;
+			}
+
+			if (idx + dlen > block_len || dlen > NET_ETH_MAX_FRAME_SIZE) {
+				LOG_WRN("Invalid datagram %zu at %zu", dlen, idx);
+				continue;
+			}
+
+			cdc_ncm_recv_datagram(data, &ntb[idx], dlen);
+		}
+
+		ndp_idx = sys_le16_to_cpu(ndp->wNextNdpIndex);
+	}
+}
+
+static int cdc_ncm_acl_out_cb(struct usbd_class_node *const c_nd,
+			      struct net_buf *const buf, const int err)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (err == 0 && buf->len != 0) {
+		cdc_ncm_unpack(data, buf->data, buf->len);
+	}
+
+	net_buf_unref(buf);
+
+	if (err) {
+		/* Transfer cancelled, the data interface is disabled */
+		return 0;
+	}
+
+	return cdc_ncm_out_start(c_nd);
+}
+
+/* Completes the headers of an IN NTB and starts its transfer */
+static void cdc_ncm_tx_flush(struct usbd_class_node *const c_nd,
+			     struct cdc_ncm_eth_data *const data)
+{
+	struct net_buf *buf = data->tx_buf;
+	struct cdc_ncm_nth16 *nth = (void *)buf->data;
+	struct cdc_ncm_ndp16 *ndp = (void *)&buf->data[sizeof(struct cdc_ncm_nth16)];
+	int ret;
+
+	nth->dwSignature = sys_cpu_to_le32(CDC_NCM_NTH16_SIGNATURE);
+	nth->wHeaderLength = sys_cpu_to_le16(sizeof(struct cdc_ncm_nth16));
+	nth->wSequence = sys_cpu_to_le16(data->tx_sequence++);
+	nth->wBlockLength = sys_cpu_to_le16(buf->len);
+	nth->wNdpIndex = sys_cpu_to_le16(sizeof(struct cdc_ncm_nth16));
+
+	ndp->dwSignature = sys_cpu_to_le32(CDC_NCM_NDP16_SIGNATURE);
+	ndp->wLength = sys_cpu_to_le16(CDC_NCM_NDP16_IN_LEN);
+	ndp->wNextNdpIndex = 0;
+
+	/* The host expects a short packet unless the NTB has maximum size */
+	if (buf->len < data->ntb_in_size) {
+		udc_ep_buf_set_zlp(buf);
+	}
+
+	data->tx_buf = NULL;
+	data->tx_count = 0;
+
+	ret = usbd_ep_enqueue(c_nd, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue IN NTB");
+		net_buf_unref(buf);
+		return;
+	}
+
+	data->tx_busy = true;
+}
+
+static int cdc_ncm_acl_in_cb(struct usbd_class_node *const c_nd,
+			     struct net_buf *const buf, const int err)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	net_buf_unref(buf);
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+	data->tx_busy = false;
+
+	if (data->tx_buf != NULL) {
+		if (err == 0 &&
+		    atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+			/* Send the frames collected in the meantime */
+			cdc_ncm_tx_flush(c_nd, data);
+		} else {
+			net_buf_unref(data->tx_buf);
+			data->tx_buf = NULL;
+			data->tx_count = 0;
+		}
+	}
+
+	k_mutex_unlock(&data->tx_lock);
+	k_sem_give(&data->tx_sem);
+
+	return 0;
+}
+
+/*
+ * Drops the IN NTB held back while suspended, once the data interface is
+ * disabled, and wakes up the senders waiting for it to be sent.
+ */
+static void cdc_ncm_tx_drop(struct cdc_ncm_eth_data *const data)
+{
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	if (data->tx_buf != NULL && !data->tx_busy) {
+		net_buf_unref(data->tx_buf);
+		data->tx_buf = NULL;
+		data->tx_count = 0;
+	}
+
+	k_mutex_unlock(&data->tx_lock);
+	k_sem_give(&data->tx_sem);
+}
+
+static int usbd_cdc_ncm_request(struct usbd_class_node *const c_nd,
+				struct net_buf *buf, int err)
+{
+	struct usbd_contex *uds_ctx = c_nd->data->uds_ctx;
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct udc_buf_info *bi;
+
+	bi = udc_get_buf_info(buf);
+
+	if (bi->ep == cdc_ncm_get_bulk_out(c_nd)) {
+		return cdc_ncm_acl_out_cb(c_nd, buf, err);
+	}
+
+	if (bi->ep == cdc_ncm_get_bulk_in(c_nd)) {
+		return cdc_ncm_acl_in_cb(c_nd, buf, err);
+	}
+
+	if (bi->ep == cdc_ncm_get_int_in(c_nd)) {
+		k_sem_give(&data->notif_sem);
+
+		return 0;
+	}
+
+	return usbd_ep_buf_free(uds_ctx, buf);
+}
+
+static int cdc_ncm_send_notification(const struct device *dev,
+				     const bool connected)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct usbd_class_node *c_nd = data->c_nd;
+	struct cdc_ncm_notification notification = {
+		.RequestType = {
+			.direction = USB_REQTYPE_DIR_TO_HOST,
+			.type = USB_REQTYPE_TYPE_CLASS,
+			.recipient = USB_REQTYPE_RECIPIENT_INTERFACE,
+		},
+		.bNotificationType = USB_CDC_NETWORK_CONNECTION,
+		.wValue = sys_cpu_to_le16((uint16_t)connected),
+		.wIndex = sys_cpu_to_le16(cdc_ncm_get_ctrl_if(c_nd)),
+		.wLength = 0,
+	};
+	struct net_buf *buf;
+	uint8_t ep;
+	int ret;
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED)) {
+		LOG_INF("USB configuration is not enabled");
+		return 0;
+	}
+
+	if (atomic_test_bit(&data->state, CDC_NCM_CLASS_SUSPENDED)) {
+		/* Only the latest connection state is sent on resume */
+		data->notif_connected = connected;
+		atomic_set_bit(&data->state, CDC_NCM_NOTIF_PENDING);
+		LOG_DBG("USB device is suspended, notification deferred");
+		return 0;
+	}
+
+	ep = cdc_ncm_get_int_in(c_nd);
+	buf = usbd_ep_buf_alloc(c_nd, ep, sizeof(struct cdc_ncm_notification));
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	net_buf_add_mem(buf, &notification, sizeof(struct cdc_ncm_notification));
+	ret = usbd_ep_enqueue(c_nd, buf);
+	if (ret) {
+		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+		net_buf_unref(buf);
+		return ret;
+	}
+
+	k_sem_take(&data->notif_sem, K_FOREVER);
+	net_buf_unref(buf);
+
+	return 0;
+}
+
+static void usbd_cdc_ncm_update(struct usbd_class_node *const c_nd,
+				const uint8_t iface, const uint8_t alternate)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+	const uint8_t data_iface = desc->if1_1.bInterfaceNumber;
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	LOG_INF("New configuration, interface %u alternate %u",
+		iface, alternate);
+
+	if (data_iface == iface && alternate == 0) {
+		atomic_clear_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
+		net_if_carrier_off(data->iface);
+		cdc_ncm_tx_drop(data);
+	}
+
+	if (data_iface == iface && alternate == 1) {
+		/* NTB parameters return to their defaults with the interface */
+		data->ntb_in_size = CONFIG_USBD_CDC_NCM_NTB_IN_SIZE;
+		data->tx_sequence = 0;
+		atomic_set_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
+
+		for (int i = 0; i < CDC_NCM_OUT_BUF_COUNT; i++) {
+			if (cdc_ncm_out_start(c_nd)) {
+				LOG_ERR("Failed to start OUT transfer");
+			}
+		}
+
+		net_if_carrier_on(data->iface);
+	}
+}
+
+static void usbd_cdc_ncm_enable(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_set_bit(&data->state, CDC_NCM_CLASS_ENABLED);
+	LOG_INF("Configuration enabled");
+}
+
+static void usbd_cdc_ncm_disable(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_clear_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED);
+	if (atomic_test_and_clear_bit(&data->state, CDC_NCM_CLASS_ENABLED)) {
+		net_if_carrier_off(data->iface);
+	}
+
+	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+	atomic_clear_bit(&data->state, CDC_NCM_NOTIF_PENDING);
+	cdc_ncm_tx_drop(data);
+	LOG_INF("Configuration disabled");
+}
+
+static void usbd_cdc_ncm_suspended(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_set_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+}
+
+/*
+ * Runs from the system work queue, as the notification transfer completes
+ * in the context which reports the resume.
+ */
+static void cdc_ncm_resume_handler(struct k_work *work)
+{
+	struct cdc_ncm_eth_data *data =
+		CONTAINER_OF(work, struct cdc_ncm_eth_data, resume_work);
+	const struct device *dev = data->c_nd->data->priv;
+
+	if (atomic_test_and_clear_bit(&data->state, CDC_NCM_NOTIF_PENDING)) {
+		(void)cdc_ncm_send_notification(dev, data->notif_connected);
+	}
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+	if (data->tx_buf != NULL && !data->tx_busy &&
+	    !atomic_test_bit(&data->state, CDC_NCM_CLASS_SUSPENDED) &&
+	    atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+		cdc_ncm_tx_flush(data->c_nd, data);
+	}
+	k_mutex_unlock(&data->tx_lock);
+}
+
+static void usbd_cdc_ncm_resumed(struct usbd_class_node *const c_nd)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	atomic_clear_bit(&data->state, CDC_NCM_CLASS_SUSPENDED);
+	k_work_submit(&data->resume_work);
+}
+
+static int usbd_cdc_ncm_cth(struct usbd_class_node *const c_nd,
+			    const struct usb_setup_packet *const setup,
+			    struct net_buf *const buf)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct cdc_ncm_ntb_parameters params = {
+		.wLength = sys_cpu_to_le16(sizeof(struct cdc_ncm_ntb_parameters)),
+		.bmNtbFormatsSupported = sys_cpu_to_le16(CDC_NCM_NTB_FORMAT_16),
+		.dwNtbInMaxSize = sys_cpu_to_le32(CONFIG_USBD_CDC_NCM_NTB_IN_SIZE),
+		.wNdpInDivisor = sys_cpu_to_le16(CDC_NCM_ALIGNMENT),
+		.wNdpInPayloadRemainder = 0,
+		.wNdpInAlignment = sys_cpu_to_le16(CDC_NCM_ALIGNMENT),
+		.dwNtbOutMaxSize = sys_cpu_to_le32(CONFIG_USBD_CDC_NCM_NTB_OUT_SIZE),
+		.wNdpOutDivisor = sys_cpu_to_le16(CDC_NCM_ALIGNMENT),
+		.wNdpOutPayloadRemainder = 0,
+		.wNdpOutAlignment = sys_cpu_to_le16(CDC_NCM_ALIGNMENT),
+		.wNtbOutMaxDatagrams = 0,
+	};
+	uint32_t ntb_in_size;
+	uint16_t ntb_format;
+
+	if (setup->RequestType.recipient != USB_REQTYPE_RECIPIENT_INTERFACE) {
+		errno = -ENOTSUP;
+		return 0;
+	}
+
+	switch (setup->bRequest) {
+	case GET_NTB_PARAMETERS:
+		net_buf_add_mem(buf, &params, MIN(setup->wLength, sizeof(params)));
+		break;
+	case GET_NTB_INPUT_SIZE:
+		ntb_in_size = sys_cpu_to_le32(data->ntb_in_size);
+		net_buf_add_mem(buf, &ntb_in_size,
+				MIN(setup->wLength, sizeof(ntb_in_size)));
+		break;
+	case GET_NTB_FORMAT:
+		ntb_format = 0;
+		net_buf_add_mem(buf, &ntb_format,
+				MIN(setup->wLength, sizeof(ntb_format)));
+		break;
+	default:
+		LOG_DBG("bmRequestType 0x%02x bRequest 0x%02x unsupported",
+			setup->bmRequestType, setup->bRequest);
+		errno = -ENOTSUP;
+	}
+
+	return 0;
+}
+
+static int usbd_cdc_ncm_ctd(struct usbd_class_node *const c_nd,
+			    const struct usb_setup_packet *const setup,
+			    const struct net_buf *const buf)
+{
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *data = dev->data;
+	uint32_t ntb_in_size;
+
+	if (setup->RequestType.recipient != USB_REQTYPE_RECIPIENT_INTERFACE) {
+		errno = -ENOTSUP;
+		return 0;
+	}
+
+	switch (setup->bRequest) {
+	case SET_ETHERNET_PACKET_FILTER:
+		LOG_INF("bRequest 0x%02x (SetPacketFilter) not implemented",
+			setup->bRequest);
+		break;
+	case SET_NTB_INPUT_SIZE:
+		if (buf == NULL || buf->len < sizeof(ntb_in_size)) {
+			errno = -EINVAL;
+			break;
+		}
+
+		ntb_in_size = sys_get_le32(buf->data);
+		if (ntb_in_size < CDC_NCM_NTB_MIN_IN_SIZE ||
+		    ntb_in_size > CONFIG_USBD_CDC_NCM_NTB_IN_SIZE) {
+			LOG_WRN("Unsupported IN NTB size %u", ntb_in_size);
+			errno = -ENOTSUP;
+			break;
+		}
+
+		k_mutex_lock(&data->tx_lock, K_FOREVER);
+		data->ntb_in_size = ntb_in_size;
+		k_mutex_unlock(&data->tx_lock);
+		LOG_INF("IN NTB size %u", ntb_in_size);
+		break;
+	case SET_NTB_FORMAT:
+		if (setup->wValue != 0) {
+			/* Only NTB-16 is supported */
+			errno = -ENOTSUP;
+		}
+		break;
+	default:
+		LOG_DBG("bmRequestType 0x%02x bRequest 0x%02x unsupported",
+			setup->bmRequestType, setup->bRequest);
+		errno = -ENOTSUP;
+	}
+
+	return 0;
+}
+
+static int usbd_cdc_ncm_init(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+	const uint8_t if_num = desc->if0.bInterfaceNumber;
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *const data = dev->data;
+
+	/* Update relevant b*Interface fields */
+	desc->iad.bFirstInterface = if_num;
+	desc->if0_union.bControlInterface = if_num;
+	desc->if0_union.bSubordinateInterface0 = if_num + 1;
+	LOG_DBG("CDC NCM class initialized");
+
+	if (usbd_add_descriptor(c_nd->data->uds_ctx, data->mac_desc_nd)) {
+		LOG_ERR("Failed to add iMACAddress string descriptor");
+	} else {
+		desc->if0_ecm.iMACAddress = data->mac_desc_nd->idx;
+	}
+
+	return 0;
+}
+
+static void usbd_cdc_ncm_shutdown(struct usbd_class_node *const c_nd)
+{
+	struct usbd_cdc_ncm_desc *desc = c_nd->data->desc;
+	const struct device *dev = c_nd->data->priv;
+	struct cdc_ncm_eth_data *const data = dev->data;
+
+	desc->if0_ecm.iMACAddress = 0;
+	sys_dlist_remove(&data->mac_desc_nd->node);
+}
+
+/* Returns the offset of the frame in the IN NTB, 0 if it does not fit */
+static size_t cdc_ncm_tx_fit(struct cdc_ncm_eth_data *const data, const size_t len)
+{
+	size_t offset = ROUND_UP(data->tx_buf->len, CDC_NCM_ALIGNMENT);
+
+	if (data->tx_count == CDC_NCM_DATAGRAMS_IN ||
+	    offset + len > data->ntb_in_size) {
+		return 0;
+	}
+
+	return offset;
+}
+
+static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
+{
+	struct cdc_ncm_eth_data *const data = dev->data;
+	struct usbd_class_node *c_nd = data->c_nd;
+	size_t len = net_pkt_get_len(pkt);
+	struct cdc_ncm_ndp16 *ndp;
+	size_t offset;
+	int ret = 0;
+
+	if (len > NET_ETH_MAX_FRAME_SIZE) {
+		LOG_WRN("Trying to send too large packet, drop");
+		return -ENOMEM;
+	}
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	while (data->tx_buf != NULL && cdc_ncm_tx_fit(data, len) == 0) {
+		if (!data->tx_busy &&
+		    !atomic_test_bit(&data->state, CDC_NCM_CLASS_SUSPENDED)) {
+			cdc_ncm_tx_flush(c_nd, data);
+			continue;
+		}
+
+		if (!atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED)) {
+			break;
+		}
+
+		/* The IN NTB is full, wait until it is sent */
+		k_mutex_unlock(&data->tx_lock);
+		k_sem_take(&data->tx_sem, K_FOREVER);
+		k_mutex_lock(&data->tx_lock, K_FOREVER);
+	}
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_DATA_IFACE_ENABLED) ||
+	    !atomic_test_bit(&data->state, CDC_NCM_IFACE_UP)) {
+		LOG_INF("Configuration is not enabled or interface not ready");
+		ret = -EACCES;
+		goto send_unlock;
+	}
+
+	if (data->tx_buf == NULL) {
+		data->tx_buf = cdc_ncm_buf_alloc(&cdc_ncm_in_pool,
+						 cdc_ncm_get_bulk_in(c_nd));
+		if (data->tx_buf == NULL) {
+			LOG_ERR("Failed to allocate buffer");
+			ret = -ENOMEM;
+			goto send_unlock;
+		}
+
+		/* Headers are completed when the NTB is sent */
+		memset(net_buf_add(data->tx_buf, CDC_NCM_IN_DATA_OFFSET), 0,
+		       CDC_NCM_IN_DATA_OFFSET);
+	}
+
+	offset = cdc_ncm_tx_fit(data, len);
+	memset(net_buf_add(data->tx_buf, offset - data->tx_buf->len), 0,
+	       offset - data->tx_buf->len);
+
+	if (net_pkt_read(pkt, net_buf_add(data->tx_buf, len), len)) {
+		LOG_ERR("Failed copy net_pkt");
+		net_buf_remove_mem(data->tx_buf, len);
+		ret = -ENOBUFS;
+		goto send_unlock;
+	}
+
+	ndp = (void *)&data->tx_buf->data[sizeof(struct cdc_ncm_nth16)];
+	ndp->dpe[data->tx_count].wDatagramIndex = sys_cpu_to_le16(offset);
+	ndp->dpe[data->tx_count].wDatagramLength = sys_cpu_to_le16(len);
+	data->tx_count++;
+
+	/*
+	 * Send at once if the endpoint is idle, otherwise more frames are
+	 * collected until the current transfer completes, or until resume
+	 * while the bus is suspended.
+	 */
+	if (!data->tx_busy &&
+	    !atomic_test_bit(&data->state, CDC_NCM_CLASS_SUSPENDED)) {
+		cdc_ncm_tx_flush(c_nd, data);
+	}
+
+send_unlock:
+	k_mutex_unlock(&data->tx_lock);
+
+	return ret;
+}
+
+static int cdc_ncm_set_config(const struct device *dev,
+			      const enum ethernet_config_type type,
+			      const struct ethernet_config *config)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (type == ETHERNET_CONFIG_TYPE_MAC_ADDRESS) {
+		memcpy(data->mac_addr, config->mac_address.addr,
+		       sizeof(data->mac_addr));
+
+		return 0;
+	}
+
+	return -ENOTSUP;
+}
+
+static int cdc_ncm_get_config(const struct device *dev,
+			      enum ethernet_config_type type,
+			      struct ethernet_config *config)
+{
+	return -ENOTSUP;
+}
+
+static enum ethernet_hw_caps cdc_ncm_get_capabilities(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return ETHERNET_LINK_10BASE_T;
+}
+
+static int cdc_ncm_iface_start(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	int ret;
+
+	LOG_DBG("Start interface %p", data->iface);
+	ret = cdc_ncm_send_notification(dev, true);
+	if (!ret) {
+		atomic_set_bit(&data->state, CDC_NCM_IFACE_UP);
+	}
+
+	return ret;
+}
+
+static int cdc_ncm_iface_stop(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	int ret;
+
+	LOG_DBG("Stop interface %p", data->iface);
+	ret = cdc_ncm_send_notification(dev, false);
+	if (!ret) {
+		atomic_clear_bit(&data->state, CDC_NCM_IFACE_UP);
+	}
+
+	return ret;
+}
+
+static void cdc_ncm_iface_init(struct net_if *const iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	data->iface = iface;
+	ethernet_init(iface);
+	net_if_set_link_addr(iface, data->mac_addr,
+			     sizeof(data->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	net_if_carrier_off(iface);
+
+	LOG_DBG("CDC NCM interface initialized");
+}
+
+static int usbd_cdc_ncm_preinit(const struct device *dev)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+
+	if (sys_get_le48(data->mac_addr) == sys_cpu_to_le48(0)) {
+		gen_random_mac(data->mac_addr, 0, 0, 0);
+	}
+
+	data->ntb_in_size = CONFIG_USBD_CDC_NCM_NTB_IN_SIZE;
+	k_work_init(&data->resume_work, cdc_ncm_resume_handler);
+
+	LOG_DBG("CDC NCM device initialized");
+
+	return 0;
+}
+
+static struct usbd_class_api usbd_cdc_ncm_api = {
+	.request = usbd_cdc_ncm_request,
+	.update = usbd_cdc_ncm_update,
+	.enable = usbd_cdc_ncm_enable,
+	.disable = usbd_cdc_ncm_disable,
+	.suspended = usbd_cdc_ncm_suspended,
+	.resumed = usbd_cdc_ncm_resumed,
+	.control_to_dev = usbd_cdc_ncm_ctd,
+	.control_to_host = usbd_cdc_ncm_cth,
+	.init = usbd_cdc_ncm_init,
+	.shutdown = usbd_cdc_ncm_shutdown,
+};
+
+static const struct ethernet_api cdc_ncm_eth_api = {
+	.iface_api.init = cdc_ncm_iface_init,
+	.get_config = cdc_ncm_get_config,
+	.set_config = cdc_ncm_set_config,
+	.get_capabilities = cdc_ncm_get_capabilities,
+	.send = cdc_ncm_send,
+	.start = cdc_ncm_iface_start,
+	.stop = cdc_ncm_iface_stop,
+};
+
+#define CDC_NCM_DEFINE_DESCRIPTOR(n)						\
+static struct usbd_cdc_ncm_desc cdc_ncm_desc_##n = {				\
+	.iad = {								\
+		.bLength = sizeof(struct usb_association_descriptor),		\
+		.bDescriptorType = USB_DESC_INTERFACE_ASSOC,			\
+		.bFirstInterface = 0,						\
+		.bInterfaceCount = 0x02,					\
+		.bFunctionClass = USB_BCC_CDC_CONTROL,				\
+		.bFunctionSubClass = NCM_SUBCLASS,				\
+		.bFunctionProtocol = 0,						\
+		.iFunction = 0,							\
+	},									\
+										\
+	.if0 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 0,						\
+		.bAlternateSetting = 0,						\
+		.bNumEndpoints = 1,						\
+		.bInterfaceClass = USB_BCC_CDC_CONTROL,				\
+		.bInterfaceSubClass = NCM_SUBCLASS,				\
+		.bInterfaceProtocol = 0,					\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if0_header = {								\
+		.bFunctionLength = sizeof(struct cdc_header_descriptor),	\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = HEADER_FUNC_DESC,				\
+		.bcdCDC = sys_cpu_to_le16(USB_SRN_1_1),				\
+	},									\
+										\
+	.if0_union = {								\
+		.bFunctionLength = sizeof(struct cdc_union_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = UNION_FUNC_DESC,				\
+		.bControlInterface = 0,						\
+		.bSubordinateInterface0 = 1,					\
+	},									\
+										\
+	.if0_ecm = {								\
+		.bFunctionLength = sizeof(struct cdc_ecm_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = ETHERNET_FUNC_DESC,			\
+		.iMACAddress = 0,						\
+		.bmEthernetStatistics = sys_cpu_to_le32(0),			\
+		.wMaxSegmentSize = sys_cpu_to_le16(NET_ETH_MAX_FRAME_SIZE),	\
+		.wNumberMCFilters = sys_cpu_to_le16(0),				\
+		.bNumberPowerFilters = 0,					\
+	},									\
+										\
+	.if0_ncm = {								\
+		.bFunctionLength = sizeof(struct cdc_ncm_descriptor),		\
+		.bDescriptorType = USB_DESC_CS_INTERFACE,			\
+		.bDescriptorSubtype = NCM_FUNC_DESC,				\
+		.bcdNcmVersion = sys_cpu_to_le16(0x0100),			\
+		.bmNetworkCapabilities = 0,					\
+	},									\
+										\
+	.if0_int_ep = {								\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x81,					\
+		.bmAttributes = USB_EP_TYPE_INTERRUPT,				\
+		.wMaxPacketSize = sys_cpu_to_le16(CDC_NCM_EP_MPS_INT),		\
+		.bInterval = CDC_NCM_EP_INTERVAL_INT,				\
+	},									\
+										\
+	.if1_0 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 1,						\
+		.bAlternateSetting = 0,						\
+		.bNumEndpoints = 0,						\
+		.bInterfaceClass = USB_BCC_CDC_DATA,				\
+		.bInterfaceSubClass = 0,					\
+		.bInterfaceProtocol = NCM_DATA_PROTOCOL,			\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if1_1 = {								\
+		.bLength = sizeof(struct usb_if_descriptor),			\
+		.bDescriptorType = USB_DESC_INTERFACE,				\
+		.bInterfaceNumber = 1,						\
+		.bAlternateSetting = 1,						\
+		.bNumEndpoints = 2,						\
+		.bInterfaceClass = USB_BCC_CDC_DATA,				\
+		.bInterfaceSubClass = 0,					\
+		.bInterfaceProtocol = NCM_DATA_PROTOCOL,			\
+		.iInterface = 0,						\
+	},									\
+										\
+	.if1_1_in_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x82,					\
+		.bmAttributes = USB_EP_TYPE_BULK,				\
+		.wMaxPacketSize = sys_cpu_to_le16(CDC_NCM_EP_MPS_BULK),		\
+		.bInterval = 0,							\
+	},									\
+										\
+	.if1_1_out_ep = {							\
+		.bLength = sizeof(struct usb_ep_descriptor),			\
+		.bDescriptorType = USB_DESC_ENDPOINT,				\
+		.bEndpointAddress = 0x01,					\
+		.bmAttributes = USB_EP_TYPE_BULK,				\
+		.wMaxPacketSize = sys_cpu_to_le16(CDC_NCM_EP_MPS_BULK),		\
+		.bInterval = 0,							\
+	},									\
+										\
+	.nil_desc = {								\
+		.bLength = 0,							\
+		.bDescriptorType = 0,						\
+	},									\
+}
+
+#define USBD_CDC_NCM_DT_DEVICE_DEFINE(n)					\
+	CDC_NCM_DEFINE_DESCRIPTOR(n);						\
+	USBD_DESC_STRING_DEFINE(mac_desc_nd_##n,				\
+				DT_INST_PROP(n, remote_mac_address),		\
+				USBD_DUT_STRING_INTERFACE);			\
+										\
+	static struct usbd_class_data usbd_cdc_ncm_data_##n;			\
+										\
+	USBD_DEFINE_CLASS(cdc_ncm_##n,						\
+			  &usbd_cdc_ncm_api,					\
+			  &usbd_cdc_ncm_data_##n);				\
+										\
+	static struct cdc_ncm_eth_data eth_data_##n = {				\
+		.c_nd = &cdc_ncm_##n,						\
+		.mac_addr = DT_INST_PROP_OR(n, local_mac_address, {0}),		\
+		.notif_sem = Z_SEM_INITIALIZER(eth_data_##n.notif_sem, 0, 1),	\
+		.tx_lock = Z_MUTEX_INITIALIZER(eth_data_##n.tx_lock),		\
+		.tx_sem = Z_SEM_INITIALIZER(eth_data_##n.tx_sem, 0, 1),		\
+		.mac_desc_nd = &mac_desc_nd_##n,				\
+	};									\
+										\
+	static struct usbd_class_data usbd_cdc_ncm_data_##n = {			\
+		.desc = (struct usb_desc_header *)&cdc_ncm_desc_##n,		\
+		.priv = (void *)DEVICE_DT_GET(DT_DRV_INST(n)),			\
+	};									\
+										\
+	ETH_NET_DEVICE_DT_INST_DEFINE(n, usbd_cdc_ncm_preinit, NULL,		\
+		&eth_data_##n, NULL,						\
+		CONFIG_ETH_INIT_PRIORITY,					\
+		&cdc_ncm_eth_api,						\
+		NET_ETH_MTU);
+
+DT_INST_FOREACH_STATUS_OKAY(USBD_CDC_NCM_DT_DEVICE_DEFINE);
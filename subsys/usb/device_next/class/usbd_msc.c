@@ -71,8 +71,17 @@ struct CSW {
 /* Can be 64 if device is not High-Speed capable */
 #define MSC_BUF_SIZE 512
 
+/* Number of buffers per bulk endpoint, transfers overlap disk access with
+ * two of them.
+ */
+#if defined(CONFIG_USBD_MSC_DOUBLE_BUFFERING)
+#define MSC_BULK_BUF_COUNT 2
+#else
+#define MSC_BULK_BUF_COUNT 1
+#endif
+
 NET_BUF_POOL_FIXED_DEFINE(msc_ep_pool,
-			  MSC_NUM_INSTANCES * 2, MSC_BUF_SIZE,
+			  MSC_NUM_INSTANCES * 2 * MSC_BULK_BUF_COUNT, MSC_BUF_SIZE,
 			  sizeof(struct udc_buf_info), NULL);
 
 struct msc_event {
@@ -101,7 +110,6 @@ struct msc_bot_desc {
 enum {
 	MSC_CLASS_ENABLED,
 	MSC_BULK_OUT_QUEUED,
-	MSC_BULK_IN_QUEUED,
 	MSC_BULK_IN_WEDGED,
 	MSC_BULK_OUT_WEDGED,
 };
@@ -119,6 +127,8 @@ enum msc_bot_state {
 struct msc_bot_ctx {
 	struct usbd_class_node *class_node;
 	atomic_t bits;
+	/* Number of buffers queued on the Bulk-In endpoint */
+	atomic_t in_queued;
 	enum msc_bot_state state;
 	uint8_t registered_luns;
 	struct scsi_ctx luns[CONFIG_USBD_MSC_LUNS_PER_INSTANCE];
@@ -249,13 +259,7 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 	size_t len;
 	int ret;
 
-	/* Fill SCSI Data IN buffer if there is no data available */
-	if (ctx->scsi_bytes == 0) {
-		ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
-		ctx->scsi_offset = 0;
-	}
-
-	if (atomic_test_and_set_bit(&ctx->bits, MSC_BULK_IN_QUEUED)) {
+	if (atomic_get(&ctx->in_queued) >= MSC_BULK_BUF_COUNT) {
 		__ASSERT_NO_MSG(false);
 		LOG_ERR("IN already queued");
 		return;
@@ -268,34 +272,44 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 	 */
 	__ASSERT_NO_MSG(buf);
 
-	while (ctx->scsi_bytes - ctx->scsi_offset > 0) {
+	while (bytes_queued < MSC_BUF_SIZE) {
+		if (ctx->scsi_bytes == ctx->scsi_offset) {
+			/* SCSI buffer can be reused now */
+			ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
+			ctx->scsi_offset = 0;
+		}
+
 		len = MIN(ctx->scsi_bytes - ctx->scsi_offset,
 			  MSC_BUF_SIZE - bytes_queued);
 		if (len == 0) {
-			/* Either queued as much as possible or there is no more
-			 * SCSI IN data available
-			 */
+			/* There is no more SCSI IN data available */
 			break;
 		}
 
 		net_buf_add_mem(buf, &ctx->scsi_buf[ctx->scsi_offset], len);
 		bytes_queued += len;
 		ctx->scsi_offset += len;
-
-		if (ctx->scsi_bytes == ctx->scsi_offset) {
-			/* SCSI buffer can be reused now */
-			ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
-			ctx->scsi_offset = 0;
-		}
 	}
 
 	/* Either the net buf is full or there is no more SCSI data */
 	ctx->csw.dCSWDataResidue -= bytes_queued;
+	atomic_inc(&ctx->in_queued);
 	ret = usbd_ep_enqueue(ctx->class_node, buf);
 	if (ret) {
 		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
 		net_buf_unref(buf);
-		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+		atomic_dec(&ctx->in_queued);
+	}
+
+	/* Read the next data while the host picks up the queued data */
+	if (ctx->scsi_bytes == ctx->scsi_offset) {
+		ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
+		ctx->scsi_offset = 0;
+
+		if (IS_ENABLED(CONFIG_USBD_MSC_READ_AHEAD) && ctx->scsi_bytes == 0) {
+			/* The following sectors are likely requested next */
+			scsi_read_ahead(lun, ctx->scsi_buf);
+		}
 	}
 }
 
@@ -306,6 +320,15 @@ static void msc_process_cbw(struct msc_bot_ctx *ctx)
 	size_t data_len;
 	int cb_len;
 
+	if (IS_ENABLED(CONFIG_USBD_MSC_READ_AHEAD)) {
+		/* Read ahead data of other LUNs is lost with the SCSI buffer */
+		for (int i = 0; i < ctx->registered_luns; i++) {
+			if (&ctx->luns[i] != lun) {
+				scsi_read_ahead_drop(&ctx->luns[i]);
+			}
+		}
+	}
+
 	cb_len = scsi_usb_boot_cmd_len(ctx->cbw.CBWCB, ctx->cbw.bCBWCBLength);
 	data_len = scsi_cmd(lun, ctx->cbw.CBWCB, cb_len, ctx->scsi_buf);
 	ctx->scsi_bytes = data_len;
@@ -438,6 +461,12 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 			 * progress. We do not intend to process more data so
 			 * stall the Bulk-Out pipe.
 			 */
+			if (atomic_test_bit(&ctx->bits, MSC_BULK_OUT_QUEUED)) {
+				/* Cancel data transfer queued ahead */
+				usbd_ep_dequeue(ctx->class_node->data->uds_ctx,
+						msc_get_bulk_out(ctx->class_node));
+			}
+
 			msc_stall_bulk_out_ep(ctx->class_node);
 		}
 
@@ -451,6 +480,15 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 	}
 }
 
+/* Number of data bytes the host still sends and the SCSI layer accepts */
+static size_t msc_write_data_expected(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+
+	return MIN(ctx->cbw.dCBWDataTransferLength - ctx->transferred_data,
+		   scsi_cmd_remaining_data_len(lun) - ctx->scsi_bytes);
+}
+
 static void msc_handle_bulk_out(struct msc_bot_ctx *ctx,
 				uint8_t *buf, size_t len)
 {
@@ -490,6 +528,12 @@ static void msc_handle_bulk_out(struct msc_bot_ctx *ctx,
 			ctx->state = MSC_BBB_WAIT_FOR_RESET_RECOVERY;
 		}
 	} else if (ctx->state == MSC_BBB_PROCESS_WRITE) {
+		if (IS_ENABLED(CONFIG_USBD_MSC_DOUBLE_BUFFERING) &&
+		    msc_write_data_expected(ctx) > len) {
+			/* Receive next data while this data is written */
+			msc_queue_bulk_out_ep(ctx->class_node);
+		}
+
 		msc_process_write(ctx, buf, len);
 	}
 }
@@ -504,7 +548,7 @@ static void msc_handle_bulk_in(struct msc_bot_ctx *ctx,
 		struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
 
 		ctx->transferred_data += len;
-		if (ctx->scsi_bytes == 0) {
+		if (ctx->scsi_bytes == 0 && atomic_get(&ctx->in_queued) == 0) {
 			if (ctx->csw.dCSWDataResidue > 0) {
 				/* Case (5) Hi > Di
 				 * While we may have sent short packet, device
@@ -529,7 +573,7 @@ static void msc_send_csw(struct msc_bot_ctx *ctx)
 	uint8_t ep;
 	int ret;
 
-	if (atomic_test_and_set_bit(&ctx->bits, MSC_BULK_IN_QUEUED)) {
+	if (atomic_get(&ctx->in_queued) > 0) {
 		__ASSERT_NO_MSG(false);
 		LOG_ERR("IN already queued");
 		return;
@@ -545,11 +589,12 @@ static void msc_send_csw(struct msc_bot_ctx *ctx)
 	__ASSERT_NO_MSG(buf);
 
 	net_buf_add_mem(buf, &ctx->csw, sizeof(ctx->csw));
+	atomic_inc(&ctx->in_queued);
 	ret = usbd_ep_enqueue(ctx->class_node, buf);
 	if (ret) {
 		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
 		net_buf_unref(buf);
-		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
+		atomic_dec(&ctx->in_queued);
 	}
 	ctx->state = MSC_BBB_WAIT_FOR_CSW_SENT;
 }
@@ -562,6 +607,12 @@ static void usbd_msc_handle_request(struct usbd_class_node *node,
 	struct udc_buf_info *bi;
 
 	bi = udc_get_buf_info(buf);
+	if (bi->ep == msc_get_bulk_out(node)) {
+		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
+	} else if (bi->ep == msc_get_bulk_in(node)) {
+		atomic_dec(&ctx->in_queued);
+	}
+
 	if (err) {
 		if (err == -ECONNABORTED) {
 			LOG_WRN("request ep 0x%02x, len %u cancelled",
@@ -581,11 +632,6 @@ static void usbd_msc_handle_request(struct usbd_class_node *node,
 	}
 
 ep_request_error:
-	if (bi->ep == msc_get_bulk_out(node)) {
-		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
-	} else if (bi->ep == msc_get_bulk_in(node)) {
-		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
-	}
 	usbd_ep_buf_free(uds_ctx, buf);
 }
 
@@ -596,6 +642,7 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 	ARG_UNUSED(arg3);
 	struct msc_event evt;
 	struct msc_bot_ctx *ctx;
+	atomic_val_t in_queued;
 
 	while (1) {
 		k_msgq_get(&msc_msgq, &evt, K_FOREVER);
@@ -622,9 +669,13 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 		}
 
 		/* Skip (potentially) response generating code if there is
-		 * IN data already available for the host to pick up.
+		 * IN data already available for the host to pick up, unless
+		 * more SCSI IN data can be queued behind it.
 		 */
-		if (atomic_test_bit(&ctx->bits, MSC_BULK_IN_QUEUED)) {
+		in_queued = atomic_get(&ctx->in_queued);
+		if (in_queued > 0 && (ctx->state != MSC_BBB_PROCESS_READ ||
+				      ctx->scsi_bytes == 0 ||
+				      in_queued >= MSC_BULK_BUF_COUNT)) {
 			continue;
 		}
 
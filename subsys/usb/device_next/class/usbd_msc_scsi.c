@@ -398,6 +398,7 @@ void scsi_reset(struct scsi_ctx *ctx)
 {
 	ctx->prevent_removal = false;
 	ctx->medium_loaded = true;
+	ctx->read_ahead_len = 0;
 }
 
 /* SPC-5 TEST UNIT READY command */
@@ -725,8 +726,11 @@ SCSI_CMD_HANDLER(READ_10)
 {
 	uint32_t lba = sys_be32_to_cpu(cmd->lba);
 	uint16_t transfer_length = sys_be16_to_cpu(cmd->transfer_length);
+	size_t read_ahead_len = ctx->read_ahead_len;
+	size_t len;
 
 	ctx->cmd_is_data_read = true;
+	ctx->read_ahead_len = 0;
 
 	if (!ctx->medium_loaded || update_disk_info(ctx) != DISK_STATUS_OK) {
 		return not_ready(ctx, MEDIUM_NOT_PRESENT);
@@ -740,6 +744,15 @@ SCSI_CMD_HANDLER(READ_10)
 	ctx->lba = lba;
 	ctx->remaining_data = ctx->sector_size * transfer_length;
 
+	if (read_ahead_len > 0 && lba == ctx->read_ahead_lba) {
+		/* Sequential read, first sectors are already in the buffer */
+		len = MIN(read_ahead_len, ctx->remaining_data);
+		ctx->lba += len / ctx->sector_size;
+		ctx->remaining_data -= len;
+
+		return good(ctx, len);
+	}
+
 	return good(ctx, 0);
 }
 
@@ -855,6 +868,11 @@ size_t scsi_cmd(struct scsi_ctx *ctx, const uint8_t *cb, int len,
 	ctx->read_cb = NULL;
 	ctx->write_cb = NULL;
 
+	if (len < 1 || cb[0] != READ_10) {
+		/* Buffer may be overwritten or the data may change */
+		ctx->read_ahead_len = 0;
+	}
+
 #define SCSI_CMD(opcode) do {							\
 	if (len == sizeof(SCSI_CMD_STRUCT(opcode)) && cb[0] == opcode) {	\
 		LOG_DBG("SCSI " #opcode);					\
@@ -933,6 +951,36 @@ size_t scsi_write_data(struct scsi_ctx *ctx, const uint8_t *buf, size_t length)
 	return processed;
 }
 
+size_t scsi_read_ahead(struct scsi_ctx *ctx,
+		       uint8_t buf[static CONFIG_USBD_MSC_SCSI_BUFFER_SIZE])
+{
+	uint32_t sectors;
+
+	ctx->read_ahead_len = 0;
+
+	/* Only the sectors following a completed READ(10) are read ahead */
+	if (ctx->read_cb != fill_read_10 || ctx->remaining_data > 0 ||
+	    ctx->sector_size == 0 || ctx->lba >= ctx->sector_count) {
+		return 0;
+	}
+
+	sectors = MIN(CONFIG_USBD_MSC_SCSI_BUFFER_SIZE / ctx->sector_size,
+		      ctx->sector_count - ctx->lba);
+	if (disk_access_read(ctx->disk, buf, ctx->lba, sectors) != 0) {
+		return 0;
+	}
+
+	ctx->read_ahead_lba = ctx->lba;
+	ctx->read_ahead_len = sectors * ctx->sector_size;
+
+	return ctx->read_ahead_len;
+}
+
+void scsi_read_ahead_drop(struct scsi_ctx *ctx)
+{
+	ctx->read_ahead_len = 0;
+}
+
 enum scsi_status_code scsi_cmd_get_status(struct scsi_ctx *ctx)
 {
 	return ctx->status;
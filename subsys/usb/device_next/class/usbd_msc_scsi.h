@@ -73,6 +73,8 @@ struct scsi_ctx {
 	uint32_t lba;
 	uint32_t sector_count;
 	uint32_t sector_size;
+	uint32_t read_ahead_lba;
+	size_t read_ahead_len;
 	enum scsi_status_code status;
 	enum scsi_sense_key sense_key;
 	enum scsi_additional_sense_code asc;
@@ -95,6 +97,9 @@ size_t scsi_cmd_remaining_data_len(struct scsi_ctx *ctx);
 size_t scsi_read_data(struct scsi_ctx *ctx,
 		      uint8_t data_in_buf[static CONFIG_USBD_MSC_SCSI_BUFFER_SIZE]);
 size_t scsi_write_data(struct scsi_ctx *ctx, const uint8_t *buf, size_t length);
+size_t scsi_read_ahead(struct scsi_ctx *ctx,
+		       uint8_t data_in_buf[static CONFIG_USBD_MSC_SCSI_BUFFER_SIZE]);
+void scsi_read_ahead_drop(struct scsi_ctx *ctx);
 
 enum scsi_status_code scsi_cmd_get_status(struct scsi_ctx *ctx);
 
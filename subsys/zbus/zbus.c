@@ -7,8 +7,55 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/zbus/zbus.h>
+#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
+#include <zephyr/net/buf.h>
+#endif
 LOG_MODULE_REGISTER(zbus, CONFIG_ZBUS_LOG_LEVEL);
 
+#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
+/* The channel of a message is kept in the user data of its buffer */
+NET_BUF_POOL_FIXED_DEFINE(_zbus_msg_subscribers_pool, CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_COUNT,
+			  CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_SIZE, sizeof(struct zbus_channel *), NULL);
+
+static inline int _zbus_deliver_msg(const struct zbus_observer *obs,
+				    const struct zbus_channel *chan, k_timepoint_t end_time)
+{
+	struct net_buf *buf;
+
+	if (chan->message_size > CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_SIZE) {
+		return -EMSGSIZE;
+	}
+
+	buf = net_buf_alloc(&_zbus_msg_subscribers_pool, sys_timepoint_timeout(end_time));
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	*(const struct zbus_channel **)net_buf_user_data(buf) = chan;
+	net_buf_add_mem(buf, chan->message, chan->message_size);
+
+	net_buf_put(obs->message_fifo, buf);
+
+	return 0;
+}
+
+static inline bool _zbus_is_msg_subscriber(const struct zbus_observer *obs)
+{
+	return obs->message_fifo != NULL;
+}
+#else
+static inline int _zbus_deliver_msg(const struct zbus_observer *obs,
+				    const struct zbus_channel *chan, k_timepoint_t end_time)
+{
+	return -ENOTSUP;
+}
+
+static inline bool _zbus_is_msg_subscriber(const struct zbus_observer *obs)
+{
+	return false;
+}
+#endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+
 #if (CONFIG_ZBUS_RUNTIME_OBSERVERS_POOL_SIZE > 0)
 static inline void _zbus_notify_runtime_listeners(const struct zbus_channel *chan)
 {
@@ -46,6 +93,16 @@ static inline int _zbus_notify_runtime_subscribers(const struct zbus_channel *ch
 				     "could not deliver notification to observer %s. Error code %d",
 				     _ZBUS_OBS_NAME(obs_nd->obs), err);
 
+			if (err) {
+				last_error = err;
+			}
+		} else if (obs_nd->obs->enabled && _zbus_is_msg_subscriber(obs_nd->obs)) {
+			err = _zbus_deliver_msg(obs_nd->obs, chan, end_time);
+
+			_ZBUS_ASSERT(err == 0,
+				     "could not deliver message to observer %s. Error code %d",
+				     _ZBUS_OBS_NAME(obs_nd->obs), err);
+
 			if (err) {
 				last_error = err;
 			}
@@ -81,6 +138,15 @@ static int _zbus_notify_observers(const struct zbus_channel *chan, k_timepoint_t
 					_ZBUS_OBS_NAME(*obs), *obs, err);
 				last_error = err;
 			}
+		} else if ((*obs)->enabled && _zbus_is_msg_subscriber(*obs)) {
+			err = _zbus_deliver_msg(*obs, chan, end_time);
+			_ZBUS_ASSERT(err == 0, "could not deliver message to observer %s.",
+				     _ZBUS_OBS_NAME(*obs));
+			if (err) {
+				LOG_ERR("Observer %s at %p could not receive the message. Error code %d",
+					_ZBUS_OBS_NAME(*obs), *obs, err);
+				last_error = err;
+			}
 		}
 	}
 
@@ -93,9 +159,39 @@ static int _zbus_notify_observers(const struct zbus_channel *chan, k_timepoint_t
 	return last_error;
 }
 
+/* Notifies the observers of a locked channel, started publishing at the cycle count start */
+static int _zbus_dispatch(const struct zbus_channel *chan, k_timepoint_t end_time, uint32_t start)
+{
+#if defined(CONFIG_ZBUS_CHANNEL_PUB_STATS)
+	struct zbus_channel_pub_stats *stats = chan->pub_stats;
+	uint32_t observers_start = k_cycle_get_32();
+	uint32_t observers_time, time, now;
+	int err;
+
+	err = _zbus_notify_observers(chan, end_time);
+
+	now = k_cycle_get_32();
+	observers_time = k_cyc_to_us_floor32(now - observers_start);
+	time = k_cyc_to_us_floor32(now - start);
+
+	stats->count++;
+	stats->time_total += time;
+	stats->time_max = MAX(stats->time_max, time);
+	stats->observers_time_total += observers_time;
+	stats->observers_time_max = MAX(stats->observers_time_max, observers_time);
+
+	return err;
+#else
+	ARG_UNUSED(start);
+
+	return _zbus_notify_observers(chan, end_time);
+#endif /* CONFIG_ZBUS_CHANNEL_PUB_STATS */
+}
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
+	uint32_t start = IS_ENABLED(CONFIG_ZBUS_CHANNEL_PUB_STATS) ? k_cycle_get_32() : 0;
 	k_timepoint_t end_time = sys_timepoint_calc(timeout);
 
 	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
@@ -113,7 +209,7 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	memcpy(chan->message, msg, chan->message_size);
 
-	err = _zbus_notify_observers(chan, end_time);
+	err = _zbus_dispatch(chan, end_time, start);
 
 	k_mutex_unlock(chan->mutex);
 
@@ -141,6 +237,7 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 {
 	int err;
+	uint32_t start = IS_ENABLED(CONFIG_ZBUS_CHANNEL_PUB_STATS) ? k_cycle_get_32() : 0;
 	k_timepoint_t end_time = sys_timepoint_calc(timeout);
 
 	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
@@ -151,7 +248,7 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
-	err = _zbus_notify_observers(chan, end_time);
+	err = _zbus_dispatch(chan, end_time, start);
 
 	k_mutex_unlock(chan->mutex);
 
@@ -195,3 +292,57 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 
 	return k_msgq_get(sub->queue, chan, timeout);
 }
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUB_STATS)
+int zbus_chan_pub_stats_get(const struct zbus_channel *chan, struct zbus_channel_pub_stats *stats,
+			    bool reset, k_timeout_t timeout)
+{
+	int err;
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(stats != NULL, "stats is required");
+
+	err = k_mutex_lock(chan->mutex, timeout);
+	if (err) {
+		return err;
+	}
+
+	*stats = *chan->pub_stats;
+
+	if (reset) {
+		memset(chan->pub_stats, 0, sizeof(*chan->pub_stats));
+	}
+
+	return k_mutex_unlock(chan->mutex);
+}
+#endif /* CONFIG_ZBUS_CHANNEL_PUB_STATS */
+
+#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
+int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel **chan,
+		      void *msg, k_timeout_t timeout)
+{
+	struct net_buf *buf;
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
+	_ZBUS_ASSERT(sub != NULL, "sub is required");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	if (sub->message_fifo == NULL) {
+		return -EINVAL;
+	}
+
+	buf = net_buf_get(sub->message_fifo, timeout);
+	if (buf == NULL) {
+		return K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? -ENOMSG : -EAGAIN;
+	}
+
+	*chan = *(const struct zbus_channel **)net_buf_user_data(buf);
+	memcpy(msg, buf->data, buf->len);
+
+	net_buf_unref(buf);
+
+	return 0;
+}
+#endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/ztest.h>
+
+#define ROUNDS 16
+
+static char buf[128];
+
+/* Prints the average cycles taken by a snprintk() call */
+#define BENCH_PRF(name, expected, fmt, ...)					\
+	do {									\
+		uint32_t start = k_cycle_get_32();				\
+		int rc = 0;							\
+										\
+		for (int r = 0; r < ROUNDS; r++) {				\
+			rc = snprintk(buf, sizeof(buf), fmt, __VA_ARGS__);	\
+		}								\
+										\
+		TC_PRINT("%-12s %u cycles\n", name,				\
+			 (k_cycle_get_32() - start) / ROUNDS);			\
+		zassert_equal(rc, strlen(expected));				\
+		zassert_equal(strcmp(buf, expected), 0);			\
+	} while (false)
+
+ZTEST(cbprintf_bench, test_integers)
+{
+	BENCH_PRF("%d", "-2147483648", "%d", INT32_MIN);
+	BENCH_PRF("%u", "4294967295", "%u", UINT32_MAX);
+	BENCH_PRF("%llu", "18446744073709551615", "%llu", UINT64_MAX);
+	BENCH_PRF("%x", "deadbeef", "%x", 0xdeadbeefU);
+	BENCH_PRF("%o", "37777777777", "%o", UINT32_MAX);
+	BENCH_PRF("%5d x4", "    1   22  333 4444", "%5d%5d%5d%5d", 1, 22, 333, 4444);
+}
+
+ZTEST(cbprintf_bench, test_floats)
+{
+	BENCH_PRF("%f", "3.141593", "%f", 3.14159265358979);
+	BENCH_PRF("%.2f", "-1234.57", "%.2f", -1234.567);
+	BENCH_PRF("%.0f", "2", "%.0f", 2.5);
+	BENCH_PRF("%e", "1.234568e+05", "%e", 123456.789);
+	BENCH_PRF("%g", "0.001", "%g", 0.001);
+}
+
+ZTEST(cbprintf_bench, test_text)
+{
+	BENCH_PRF("text", "temperature: 21 degrees, humidity: 40 percent",
+		  "temperature: %d degrees, humidity: %d percent", 21, 40);
+	BENCH_PRF("%s", "temperature", "%s", "temperature");
+}
+
+ZTEST_SUITE(cbprintf_bench, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+#define N_ENTRIES 256
+
+SYS_HASHMAP_SC_DEFINE(sc_map);
+SYS_HASHMAP_OA_LP_DEFINE(oa_lp_map);
+SYS_HASHMAP_SWISS_DEFINE(swiss_map);
+
+/* spread keys, as connection identifiers or addresses would be */
+static inline uint64_t key(size_t i)
+{
+	return (uint64_t)i * 0x9E3779B97F4A7C15ULL;
+}
+
+static void run(const char *name, struct sys_hashmap *map)
+{
+	uint32_t start;
+	uint32_t insert_cyc;
+	uint32_t hit_cyc;
+	uint32_t miss_cyc;
+	uint32_t remove_cyc;
+	uint64_t value;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		zassert_equal(1, sys_hashmap_insert(map, key(i), i, NULL));
+	}
+	insert_cyc = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		zassert_true(sys_hashmap_get(map, key(i), &value));
+	}
+	hit_cyc = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (size_t i = N_ENTRIES; i < 2 * N_ENTRIES; ++i) {
+		zassert_false(sys_hashmap_get(map, key(i), &value));
+	}
+	miss_cyc = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_ENTRIES; ++i) {
+		zassert_true(sys_hashmap_remove(map, key(i), NULL));
+	}
+	remove_cyc = k_cycle_get_32() - start;
+
+	TC_PRINT("%-6s cycles per op: insert %u, get hit %u, get miss %u, remove %u\n", name,
+		 insert_cyc / N_ENTRIES, hit_cyc / N_ENTRIES, miss_cyc / N_ENTRIES,
+		 remove_cyc / N_ENTRIES);
+
+	sys_hashmap_clear(map, NULL, NULL);
+}
+
+/**
+ * @brief Compare the hashmap implementations
+ *
+ * Insert, look up, miss and remove the same keys with each of them and
+ * report the average number of cycles per operation.
+ */
+ZTEST(hash_map_perf, test_hash_map_perf)
+{
+	run("sc", &sc_map);
+	run("oa_lp", &oa_lp_map);
+	run("swiss", &swiss_map);
+}
+
+ZTEST_SUITE(hash_map_perf, NULL, NULL, NULL, NULL, NULL);
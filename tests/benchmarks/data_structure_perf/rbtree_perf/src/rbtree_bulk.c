@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/rb.h>
+
+#define BULK_SIZE 1024
+
+static struct rbnode bulk_nodes[BULK_SIZE];
+static struct rbnode *bulk_sorted[BULK_SIZE];
+static struct rbtree bulk_tree;
+
+static bool bulk_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return a < b;
+}
+
+static void bulk_reset(void)
+{
+	(void)memset(&bulk_tree, 0, sizeof(bulk_tree));
+	(void)memset(bulk_nodes, 0, sizeof(bulk_nodes));
+	bulk_tree.lessthan_fn = bulk_lessthan;
+}
+
+static uint32_t bulk_iterate(void)
+{
+	struct rbnode *n, *last = NULL;
+	uint32_t count = 0;
+
+	RB_FOR_EACH(&bulk_tree, n) {
+		zassert_true(last == NULL || bulk_lessthan(last, n),
+			     "nodes out of order");
+		last = n;
+		count++;
+	}
+
+	return count;
+}
+
+/**
+ * @brief Compare building a tree node by node and in bulk
+ *
+ * @details Build the same tree with rb_insert() and with
+ * rb_build_sorted(), then iterate over it and remove all of its
+ * nodes, printing the number of cycles taken by each step.
+ *
+ * @ingroup lib_rbtree_tests
+ *
+ * @see rb_insert(), rb_build_sorted(), rb_remove()
+ */
+ZTEST(rbtree_bulk, test_rbtree_bulk_build)
+{
+	uint32_t start, insert_cycles, build_cycles, iter_cycles;
+	uint32_t remove_cycles;
+
+	bulk_reset();
+	start = k_cycle_get_32();
+	for (int i = 0; i < BULK_SIZE; i++) {
+		rb_insert(&bulk_tree, &bulk_nodes[i]);
+	}
+	insert_cycles = k_cycle_get_32() - start;
+
+	bulk_reset();
+	for (int i = 0; i < BULK_SIZE; i++) {
+		bulk_sorted[i] = &bulk_nodes[i];
+	}
+	start = k_cycle_get_32();
+	rb_build_sorted(&bulk_tree, bulk_sorted, BULK_SIZE);
+	build_cycles = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	zassert_equal(bulk_iterate(), BULK_SIZE, "nodes missing");
+	iter_cycles = k_cycle_get_32() - start;
+
+	/* Remove the nodes in an order unrelated to their position */
+	start = k_cycle_get_32();
+	for (int i = 0; i < BULK_SIZE; i++) {
+		rb_remove(&bulk_tree, &bulk_nodes[(i * 37) % BULK_SIZE]);
+	}
+	remove_cycles = k_cycle_get_32() - start;
+	zassert_is_null(bulk_tree.root, "tree not empty");
+
+	TC_PRINT("%d nodes: insert %u, bulk build %u, iterate %u, remove %u cycles\n",
+		 BULK_SIZE, insert_cycles, build_cycles, iter_cycles,
+		 remove_cycles);
+}
+
+ZTEST_SUITE(rbtree_bulk, NULL, NULL, NULL, NULL, NULL);
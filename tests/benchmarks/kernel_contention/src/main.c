@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Runs one to CONFIG_MP_MAX_NUM_CPUS threads hammering the same kernel
+ * object, and reports for each object and number of threads the total
+ * throughput and the latency percentiles of an operation.
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define ITERATIONS  1000
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BLOCK_SIZE  32
+
+/* Lower priority than main, which starts all the threads before they run */
+#define WORKER_PRIO K_PRIO_PREEMPT(5)
+
+BUILD_ASSERT(MAX_THREADS <= 32, "one event bit per thread");
+
+struct primitive {
+	const char *name;
+	void (*setup)(int threads);
+	/* Operation leaving the object as it found it */
+	int (*op)(int id);
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+static struct k_thread threads[MAX_THREADS];
+
+/* Latency of each operation in cycles, contiguous across the threads */
+static uint32_t samples[MAX_THREADS][ITERATIONS];
+/* Cycles since the epoch when each thread started and finished */
+static timing_t epoch;
+static uint64_t begin[MAX_THREADS];
+static uint64_t finish[MAX_THREADS];
+static atomic_t ready;
+static atomic_t errors;
+
+static struct k_sem sem;
+static struct k_mutex mutex;
+static struct k_queue queue;
+static struct k_msgq msgq;
+static struct k_pipe pipe;
+static struct k_event event;
+
+static void *queue_items[MAX_THREADS][2];
+static void *queue_held[MAX_THREADS];
+static char __aligned(4) msgq_buf[MAX_THREADS * sizeof(uint32_t)];
+static unsigned char pipe_buf[MAX_THREADS * sizeof(uint32_t)];
+
+K_HEAP_DEFINE(heap, MAX_THREADS * BLOCK_SIZE * 4);
+K_MEM_SLAB_DEFINE_STATIC(slab, BLOCK_SIZE, MAX_THREADS, 4);
+
+static void sem_setup(int threads)
+{
+	k_sem_init(&sem, 1, 1);
+}
+
+static int sem_op(int id)
+{
+	k_sem_take(&sem, K_FOREVER);
+	k_sem_give(&sem);
+
+	return 0;
+}
+
+static void mutex_setup(int threads)
+{
+	k_mutex_init(&mutex);
+}
+
+static int mutex_op(int id)
+{
+	k_mutex_lock(&mutex, K_FOREVER);
+	k_mutex_unlock(&mutex);
+
+	return 0;
+}
+
+static void queue_setup(int threads)
+{
+	k_queue_init(&queue);
+	for (int i = 0; i < threads; i++) {
+		queue_held[i] = queue_items[i];
+	}
+}
+
+/* Each thread puts the item it holds and gets whichever item comes first */
+static int queue_op(int id)
+{
+	k_queue_append(&queue, queue_held[id]);
+	queue_held[id] = k_queue_get(&queue, K_FOREVER);
+
+	return 0;
+}
+
+static void msgq_setup(int threads)
+{
+	k_msgq_init(&msgq, msgq_buf, sizeof(uint32_t), threads);
+}
+
+static int msgq_op(int id)
+{
+	uint32_t data = id;
+
+	k_msgq_put(&msgq, &data, K_FOREVER);
+
+	return k_msgq_get(&msgq, &data, K_FOREVER);
+}
+
+static void pipe_setup(int threads)
+{
+	k_pipe_init(&pipe, pipe_buf, threads * sizeof(uint32_t));
+}
+
+static int pipe_op(int id)
+{
+	uint32_t data = id;
+	size_t bytes;
+
+	k_pipe_put(&pipe, &data, sizeof(data), &bytes, sizeof(data), K_FOREVER);
+
+	return k_pipe_get(&pipe, &data, sizeof(data), &bytes, sizeof(data), K_FOREVER);
+}
+
+static void event_setup(int threads)
+{
+	k_event_init(&event);
+}
+
+static int event_op(int id)
+{
+	k_event_post(&event, BIT(id));
+	if (k_event_wait(&event, BIT(id), false, K_FOREVER) == 0) {
+		return -EAGAIN;
+	}
+	k_event_clear(&event, BIT(id));
+
+	return 0;
+}
+
+static void heap_setup(int threads)
+{
+}
+
+static int heap_op(int id)
+{
+	void *block = k_heap_alloc(&heap, BLOCK_SIZE, K_NO_WAIT);
+
+	if (block == NULL) {
+		return -ENOMEM;
+	}
+	k_heap_free(&heap, block);
+
+	return 0;
+}
+
+static void slab_setup(int threads)
+{
+}
+
+static int slab_op(int id)
+{
+	void *block;
+
+	if (k_mem_slab_alloc(&slab, &block, K_NO_WAIT) != 0) {
+		return -ENOMEM;
+	}
+	k_mem_slab_free(&slab, &block);
+
+	return 0;
+}
+
+static const struct primitive primitives[] = {
+	{ "k_sem", sem_setup, sem_op },
+	{ "k_mutex", mutex_setup, mutex_op },
+	{ "k_queue", queue_setup, queue_op },
+	{ "k_msgq", msgq_setup, msgq_op },
+	{ "k_pipe", pipe_setup, pipe_op },
+	{ "k_event", event_setup, event_op },
+	{ "k_heap", heap_setup, heap_op },
+	{ "k_mem_slab", slab_setup, slab_op },
+};
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	const struct primitive *prim = p1;
+	int id = POINTER_TO_INT(p2);
+	int count = POINTER_TO_INT(p3);
+	timing_t start, end;
+	timing_t now;
+
+	/* Start hammering together, each thread being on its own CPU */
+	atomic_inc(&ready);
+	while (atomic_get(&ready) < count) {
+	}
+
+	now = timing_counter_get();
+	begin[id] = timing_cycles_get(&epoch, &now);
+	for (int i = 0; i < ITERATIONS; i++) {
+		start = timing_counter_get();
+		if (prim->op(id) != 0) {
+			atomic_inc(&errors);
+		}
+		end = timing_counter_get();
+		samples[id][i] = (uint32_t)timing_cycles_get(&start, &end);
+	}
+	now = timing_counter_get();
+	finish[id] = timing_cycles_get(&epoch, &now);
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static uint32_t cycles_to_ns(uint64_t cycles)
+{
+	return (uint32_t)timing_cycles_to_ns(cycles);
+}
+
+/* Returns the throughput in operations per second */
+static uint32_t run(const struct primitive *prim, unsigned int count, uint32_t base)
+{
+	uint32_t *all = &samples[0][0];
+	size_t n = count * ITERATIONS;
+	uint64_t first, last;
+	uint64_t elapsed_ns;
+	uint32_t ops_per_sec;
+
+	prim->setup(count);
+	atomic_set(&ready, 0);
+	epoch = timing_counter_get();
+
+	for (unsigned int i = 0; i < count; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, worker,
+				(void *)prim, INT_TO_POINTER(i), INT_TO_POINTER(count),
+				WORKER_PRIO, 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		k_thread_cpu_pin(&threads[i], i);
+#endif
+	}
+	for (unsigned int i = 0; i < count; i++) {
+		k_thread_start(&threads[i]);
+	}
+	for (unsigned int i = 0; i < count; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	/* The counter is assumed synchronized across the CPUs */
+	first = begin[0];
+	last = finish[0];
+	for (unsigned int i = 1; i < count; i++) {
+		first = MIN(first, begin[i]);
+		last = MAX(last, finish[i]);
+	}
+	elapsed_ns = MAX(timing_cycles_to_ns(last - first), 1);
+	ops_per_sec = (uint32_t)(((uint64_t)n * NSEC_PER_SEC) / elapsed_ns);
+
+	qsort(all, n, sizeof(*all), compare_samples);
+
+	TC_PRINT("CONTENTION primitive=%s threads=%u ops_per_sec=%u scaling_pct=%u "
+		 "p50_ns=%u p99_ns=%u max_ns=%u\n",
+		 prim->name, count, ops_per_sec,
+		 (uint32_t)(base != 0 ? ((uint64_t)ops_per_sec * 100) / base : 100),
+		 cycles_to_ns(all[n / 2]), cycles_to_ns(all[(n * 99) / 100]),
+		 cycles_to_ns(all[n - 1]));
+
+	return ops_per_sec;
+}
+
+int main(void)
+{
+	unsigned int cpus = arch_num_cpus();
+	uint32_t base;
+
+	timing_init();
+	timing_start();
+
+	TC_START("Kernel object contention");
+	TC_PRINT("CPUs: %u, %d operations per thread, clock frequency: %u MHz\n",
+		 cpus, ITERATIONS, timing_freq_get_mhz());
+
+	for (size_t p = 0; p < ARRAY_SIZE(primitives); p++) {
+		base = 0;
+		for (unsigned int count = 1; count <= cpus; count++) {
+			uint32_t ops_per_sec = run(&primitives[p], count, base);
+
+			if (count == 1) {
+				base = ops_per_sec;
+			}
+		}
+	}
+
+	timing_stop();
+
+	if (atomic_get(&errors) != 0) {
+		TC_PRINT("%d operations failed\n", (int)atomic_get(&errors));
+	}
+
+	TC_END_REPORT(atomic_get(&errors) == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -55,6 +55,7 @@ static void thread_one(void)
 {
 	k_sem_take(&sync_sema, K_FOREVER);
 
+	PERF_START();
 	timestamp_start = timing_counter_get();
 
 	while (ctx_switch_counter < NCTXSWITCH) {
@@ -64,6 +65,7 @@ static void thread_one(void)
 	}
 
 	timestamp_end = timing_counter_get();
+	PERF_END();
 }
 
 /**
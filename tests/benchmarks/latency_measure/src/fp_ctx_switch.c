@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * This file contains the benchmark that measures the average time it takes
+ * to do context switches between threads using the floating point unit,
+ * with k_yield() to force the context switches. It shows the cost of saving
+ * and restoring the floating point context, which architectures switching
+ * it lazily only pay when both threads use it.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h" /* PRINT () and other macros */
+
+#ifdef CONFIG_FPU_SHARING
+
+/* context switch enough time so our measurement is precise */
+#define NB_OF_YIELD 1000
+
+#define FP_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+/* Above the priority of the test thread, so that only the two threads of
+ * the benchmark yield to each other.
+ */
+#define FP_PRIORITY K_PRIO_PREEMPT(9)
+
+K_THREAD_STACK_DEFINE(fp_stack_a, FP_STACK_SIZE);
+K_THREAD_STACK_DEFINE(fp_stack_b, FP_STACK_SIZE);
+static struct k_thread fp_thread_a;
+static struct k_thread fp_thread_b;
+
+static timing_t timestamp_start;
+static timing_t timestamp_end;
+
+static volatile float fp_sink;
+
+/**
+ * @brief Thread yielding, using the floating point unit in between if
+ * @a arg1 is true and measuring the time of the loop if @a arg2 is true
+ */
+static void fp_yield_thread(void *arg1, void *arg2, void *arg3)
+{
+	bool use_fp = (bool)POINTER_TO_UINT(arg1);
+	bool measure = (bool)POINTER_TO_UINT(arg2);
+
+	ARG_UNUSED(arg3);
+
+	if (measure) {
+		timestamp_start = timing_counter_get();
+	}
+
+	for (int i = 0; i < NB_OF_YIELD; i++) {
+		if (use_fp) {
+			fp_sink = fp_sink * 1.0001f + 1.0f;
+		}
+		k_yield();
+	}
+
+	if (measure) {
+		timestamp_end = timing_counter_get();
+	}
+}
+
+static void fp_switch_measure(const char *summary, bool both_fp)
+{
+	const char *notes = "";
+	uint32_t ts_diff;
+	int end;
+
+	k_thread_create(&fp_thread_a, fp_stack_a, FP_STACK_SIZE, fp_yield_thread,
+			UINT_TO_POINTER(true), UINT_TO_POINTER(true), NULL,
+			FP_PRIORITY, K_FP_REGS, K_FOREVER);
+	k_thread_create(&fp_thread_b, fp_stack_b, FP_STACK_SIZE, fp_yield_thread,
+			UINT_TO_POINTER(both_fp), UINT_TO_POINTER(false), NULL,
+			FP_PRIORITY, both_fp ? K_FP_REGS : 0, K_FOREVER);
+
+	bench_test_start();
+
+	/* Start both threads before either of them runs */
+	k_sched_lock();
+	k_thread_start(&fp_thread_a);
+	k_thread_start(&fp_thread_b);
+	k_sched_unlock();
+
+	k_thread_join(&fp_thread_a, K_FOREVER);
+	k_thread_join(&fp_thread_b, K_FOREVER);
+
+	end = bench_test_end();
+	if (end != 0) {
+		error_count++;
+		notes = TICK_OCCURRENCE_ERROR;
+	}
+
+	ts_diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+	PRINT_STATS_AVG(summary, ts_diff, 2 * NB_OF_YIELD, end != 0, notes);
+}
+
+/**
+ * @brief Entry point for the floating point context switch tests
+ */
+void fp_ctx_switch(void)
+{
+	timing_start();
+
+	fp_switch_measure("Average context switch, FP used by one thread", false);
+	fp_switch_measure("Average context switch, FP used by both threads", true);
+
+	timing_stop();
+}
+
+#else
+
+void fp_ctx_switch(void)
+{
+}
+
+#endif /* CONFIG_FPU_SHARING */
@@ -11,6 +11,92 @@
 #define TEST_COUNT 100
 #define TEST_SIZE 10
 
+/*
+ * Fragmented heap: free blocks of FRAG_HOLE_SIZE bytes, pinned apart
+ * by small allocations, fall in the same size class as FRAG_SIZE
+ * requests but are too small to satisfy them.
+ */
+#define FRAG_HOLES 8
+#define FRAG_HOLE_SIZE 36
+#define FRAG_SIZE 52
+
+static void *frag_holes[FRAG_HOLES];
+static void *frag_pins[FRAG_HOLES];
+
+static bool heap_fragment(void)
+{
+	bool ok = true;
+
+	for (int i = 0; i < FRAG_HOLES; i++) {
+		frag_holes[i] = k_malloc(FRAG_HOLE_SIZE);
+		frag_pins[i] = k_malloc(1);
+		ok = ok && frag_holes[i] != NULL && frag_pins[i] != NULL;
+	}
+
+	for (int i = 0; i < FRAG_HOLES; i++) {
+		k_free(frag_holes[i]);
+	}
+
+	return ok;
+}
+
+static void heap_defragment(void)
+{
+	for (int i = 0; i < FRAG_HOLES; i++) {
+		k_free(frag_pins[i]);
+	}
+}
+
+static void heap_malloc_free_fragmented(void)
+{
+	timing_t start, end;
+	uint32_t count = 0U;
+	uint32_t cycles, max_malloc = 0U;
+	uint32_t sum_malloc = 0U;
+	uint32_t sum_free = 0U;
+	bool failed = false;
+	const char *notes = "";
+
+	if (!heap_fragment()) {
+		failed = true;
+		notes = "Memory heap too small--increase it.";
+	}
+
+	while (!failed && count != TEST_COUNT) {
+		start = timing_counter_get();
+		void *allocated_mem = k_malloc(FRAG_SIZE);
+
+		end = timing_counter_get();
+		if (allocated_mem == NULL) {
+			error_count++;
+			failed = true;
+			notes = "alloc memory in fragmented heap";
+			break;
+		}
+
+		cycles = timing_cycles_get(&start, &end);
+		sum_malloc += cycles;
+		max_malloc = MAX(max_malloc, cycles);
+
+		start = timing_counter_get();
+		k_free(allocated_mem);
+		end = timing_counter_get();
+
+		sum_free += timing_cycles_get(&start, &end);
+		count++;
+	}
+
+	heap_defragment();
+
+	count = MAX(count, 1U);
+	PRINT_STATS_AVG("Average time for heap malloc (fragmented)",
+			sum_malloc, count, failed, notes);
+	PRINT_STATS("Maximum time for heap malloc (fragmented)",
+		    max_malloc, failed, notes);
+	PRINT_STATS_AVG("Average time for heap free (fragmented)",
+			sum_free, count, failed, notes);
+}
+
 void heap_malloc_free(void)
 {
 	timing_t heap_malloc_start_time = 0U;
@@ -68,5 +154,7 @@ void heap_malloc_free(void)
 	PRINT_STATS_AVG("Average time for heap free", sum_free, count,
 			failed, notes);
 
+	heap_malloc_free_fragmented();
+
 	timing_stop();
 }
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief measure time from ISR to an interrupt thread
+ *
+ * This file contains test that measures time to switch from an interrupt
+ * handler to executing the handler of an interrupt thread it wakes, to
+ * compare with handing the interrupt off to a work item.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+
+#include "utils.h"
+
+#ifdef CONFIG_IRQ_THREAD
+
+static timing_t timestamp_start;
+static timing_t timestamp_end;
+
+static void handler(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	timestamp_end = timing_counter_get();
+	PERF_END();
+}
+
+K_IRQ_THREAD_DEFINE(irq_thread, -1, handler, NULL, 512, K_PRIO_COOP(1));
+
+static void latency_test_isr(const void *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_irq_thread_wake(&irq_thread);
+	PERF_START();
+	timestamp_start = timing_counter_get();
+}
+
+/**
+ *
+ * @brief The test main function
+ *
+ * @return 0 on success
+ */
+int int_to_irq_thread(void)
+{
+	uint32_t diff;
+
+	timing_start();
+	TICK_SYNCH();
+	irq_offload(latency_test_isr, NULL);
+	(void)k_irq_thread_flush(&irq_thread, K_FOREVER);
+	timing_stop();
+
+	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
+
+	PRINT_STATS("Time from ISR to executing an interrupt thread",
+		    diff, false, "");
+
+	return 0;
+}
+
+#else
+
+int int_to_irq_thread(void)
+{
+	return 0;
+}
+
+#endif /* CONFIG_IRQ_THREAD */
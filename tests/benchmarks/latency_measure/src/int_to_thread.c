@@ -36,6 +36,7 @@ static void latency_test_isr(const void *unused)
 	ARG_UNUSED(unused);
 	flag_var = 1;
 
+	PERF_START();
 	timestamp_start = timing_counter_get();
 }
 
@@ -52,6 +53,7 @@ static void make_int(void)
 	flag_var = 0;
 	irq_offload(latency_test_isr, NULL);
 	timestamp_end = timing_counter_get();
+	PERF_END();
 }
 
 /**
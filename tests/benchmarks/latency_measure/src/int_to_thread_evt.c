@@ -39,6 +39,7 @@ static void latency_test_isr(const void *unused)
 	ARG_UNUSED(unused);
 
 	k_work_submit(&work);
+	PERF_START();
 	timestamp_start = timing_counter_get();
 }
 
@@ -47,6 +48,7 @@ static void worker(struct k_work *item)
 	(void)item;
 
 	timestamp_end = timing_counter_get();
+	PERF_END();
 	k_sem_give(&WORKSEMA);
 }
 
@@ -18,9 +18,60 @@
 uint32_t tm_off; /* time necessary to read the time */
 int error_count; /* track number of errors */
 
+#ifdef CONFIG_SYS_PERF
+struct sys_perf_snapshot perf_start;
+struct sys_perf_snapshot perf_end;
+bool perf_measured;
+
+/* Prints a value per operation, with two decimals */
+static void perf_print_avg(const char *name, uint64_t count, uint32_t counter)
+{
+	uint32_t x100 = (uint32_t)((count * 100) / counter);
+
+	printk(" %u.%02u %s", x100 / 100, x100 % 100, name);
+}
+
+void perf_print(uint32_t counter, bool error)
+{
+	uint32_t events = sys_perf_events_get();
+	struct sys_perf_counters counters;
+	uint32_t ipc;
+
+	if (!perf_measured || error || counter == 0) {
+		perf_measured = false;
+		return;
+	}
+
+	perf_measured = false;
+	sys_perf_elapsed(&perf_start, &perf_end, &counters);
+
+	printk("%-52s:", "  hardware counters per operation");
+	if ((events & BIT(SYS_PERF_INSTRUCTIONS)) != 0) {
+		perf_print_avg("instructions", counters.count[SYS_PERF_INSTRUCTIONS], counter);
+	}
+	if ((events & BIT(SYS_PERF_CACHE_MISSES)) != 0) {
+		perf_print_avg("cache misses", counters.count[SYS_PERF_CACHE_MISSES], counter);
+	}
+	if ((events & BIT(SYS_PERF_BRANCH_MISSES)) != 0) {
+		perf_print_avg("branch misses", counters.count[SYS_PERF_BRANCH_MISSES], counter);
+	}
+	if ((events & BIT(SYS_PERF_STALLS)) != 0) {
+		perf_print_avg("stall cycles", counters.count[SYS_PERF_STALLS], counter);
+	}
+
+	ipc = sys_perf_ipc_x100(&counters);
+	if (ipc != 0) {
+		printk(", IPC %u.%02u", ipc / 100, ipc % 100);
+	}
+	printk("\n");
+}
+#endif
+
 extern void thread_switch_yield(void);
+extern void fp_ctx_switch(void);
 extern void int_to_thread(void);
 extern void int_to_thread_evt(void);
+extern int int_to_irq_thread(void);
 extern void sema_test_signal(void);
 extern void mutex_lock_unlock(void);
 extern int coop_ctx_switch(void);
@@ -44,12 +95,16 @@ void test_thread(void *arg1, void *arg2, void *arg3)
 
 	thread_switch_yield();
 
+	fp_ctx_switch();
+
 	coop_ctx_switch();
 
 	int_to_thread();
 
 	int_to_thread_evt();
 
+	int_to_irq_thread();
+
 	suspend_resume();
 
 	sema_test_signal();
@@ -36,6 +36,7 @@ int mutex_lock_unlock(void)
 	timing_start();
 	bench_test_start();
 
+	PERF_START();
 	timestamp_start = timing_counter_get();
 
 	for (i = 0; i < N_TEST_MUTEX; i++) {
@@ -43,6 +44,7 @@ int mutex_lock_unlock(void)
 	}
 
 	timestamp_end = timing_counter_get();
+	PERF_END();
 	end = bench_test_end();
 
 	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
@@ -56,6 +58,7 @@ int mutex_lock_unlock(void)
 			false, notes);
 
 	bench_test_start();
+	PERF_START();
 	timestamp_start = timing_counter_get();
 
 	for (i = 0; i < N_TEST_MUTEX; i++) {
@@ -63,6 +66,7 @@ int mutex_lock_unlock(void)
 	}
 
 	timestamp_end = timing_counter_get();
+	PERF_END();
 	end = bench_test_end();
 	diff = timing_cycles_get(&timestamp_start, &timestamp_end);
 
@@ -90,6 +90,7 @@ int sema_test_signal(void)
 	bench_test_start();
 	timing_start();
 
+	PERF_START();
 	timestamp_start = timing_counter_get();
 
 	for (i = 0; i < N_TEST_SEMA; i++) {
@@ -97,6 +98,7 @@ int sema_test_signal(void)
 	}
 
 	timestamp_end = timing_counter_get();
+	PERF_END();
 	end = bench_test_end();
 	timing_stop();
 
@@ -112,6 +114,7 @@ int sema_test_signal(void)
 	bench_test_start();
 	timing_start();
 
+	PERF_START();
 	timestamp_start = timing_counter_get();
 
 	for (i = 0; i < N_TEST_SEMA; i++) {
@@ -119,6 +122,7 @@ int sema_test_signal(void)
 	}
 
 	timestamp_end = timing_counter_get();
+	PERF_END();
 	end = bench_test_end();
 	timing_stop();
 
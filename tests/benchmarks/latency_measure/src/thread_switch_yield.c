@@ -64,6 +64,7 @@ void thread_switch_yield(void)
 			NULL, NULL, NULL, Y_PRIORITY, 0, K_NO_WAIT);
 
 	/* get initial timestamp */
+	PERF_START();
 	timestamp_start = timing_counter_get();
 
 	/* loop until either helper or this routine reaches number of yields */
@@ -75,6 +76,7 @@ void thread_switch_yield(void)
 
 	/* get the number of cycles it took to do the test */
 	timestamp_end = timing_counter_get();
+	PERF_END();
 	end = bench_test_end();
 
 	/* Ensure both helper and this routine were context switching back &
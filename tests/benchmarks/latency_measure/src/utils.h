@@ -16,6 +16,10 @@
 #include <stdio.h>
 #include <zephyr/timestamp.h>
 
+#ifdef CONFIG_SYS_PERF
+#include <zephyr/perf/perf.h>
+#endif
+
 #define INT_IMM8_OFFSET   1
 #define IRQ_PRIORITY      3
 
@@ -60,15 +64,44 @@ extern int error_count;
 		printk(FORMAT_STR, summary, cycle_str, nsec_str, notes); \
 	} while (0)
 
+#ifdef CONFIG_SYS_PERF
+extern struct sys_perf_snapshot perf_start;
+extern struct sys_perf_snapshot perf_end;
+extern bool perf_measured;
+
+/*
+ * The hardware performance counters are read around the timestamps of the
+ * measurements which support it, and reported after their statistics.
+ */
+#define PERF_START() sys_perf_snapshot(&perf_start)
+#define PERF_END()                            \
+	do {                                  \
+		sys_perf_snapshot(&perf_end); \
+		perf_measured = true;         \
+	} while (0)
+
+void perf_print(uint32_t counter, bool error);
+#else
+#define PERF_START()
+#define PERF_END()
+#define perf_print(counter, error)
+#endif
+
 #define PRINT_STATS(summary, value, error, notes)     \
-	PRINT_F(summary, value,                       \
-		(uint32_t)timing_cycles_to_ns(value), \
-		error, notes)
+	do {                                          \
+		PRINT_F(summary, value,               \
+			(uint32_t)timing_cycles_to_ns(value), \
+			error, notes);                \
+		perf_print(1, error);                 \
+	} while (0)
 
 #define PRINT_STATS_AVG(summary, value, counter, error, notes)      \
-	PRINT_F(summary, value / counter,                           \
-		(uint32_t)timing_cycles_to_ns_avg(value, counter),  \
-		error, notes);
+	do {                                                        \
+		PRINT_F(summary, value / counter,                   \
+			(uint32_t)timing_cycles_to_ns_avg(value, counter), \
+			error, notes);                              \
+		perf_print(counter, error);                         \
+	} while (0)
 
 
 #endif
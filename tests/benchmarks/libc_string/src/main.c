@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#define BUF_SIZE 1024
+#define ROUNDS 16
+
+static uint32_t src_buf[BUF_SIZE / 4 + 1];
+static uint32_t dst_buf[BUF_SIZE / 4 + 1];
+
+static const size_t sizes[] = { 8, 64, 256, BUF_SIZE };
+
+/* Misalignments of the destination and of the source */
+static const struct {
+	size_t dst;
+	size_t src;
+} offsets[] = {
+	{ 0, 0 },
+	{ 1, 1 },
+	{ 0, 1 },
+	{ 3, 2 },
+};
+
+static void *src_at(size_t offset)
+{
+	return (uint8_t *)src_buf + offset;
+}
+
+static void *dst_at(size_t offset)
+{
+	return (uint8_t *)dst_buf + offset;
+}
+
+ZTEST(libc_string, test_memcpy)
+{
+	for (size_t o = 0; o < ARRAY_SIZE(offsets); o++) {
+		for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+			uint32_t start = k_cycle_get_32();
+
+			for (int r = 0; r < ROUNDS; r++) {
+				(void)memcpy(dst_at(offsets[o].dst),
+					     src_at(offsets[o].src), sizes[s]);
+			}
+
+			TC_PRINT("memcpy  %4zu bytes, offsets %zu/%zu: %u cycles\n",
+				 sizes[s], offsets[o].dst, offsets[o].src,
+				 (k_cycle_get_32() - start) / ROUNDS);
+			zassert_equal(memcmp(dst_at(offsets[o].dst),
+					     src_at(offsets[o].src), sizes[s]), 0);
+		}
+	}
+}
+
+ZTEST(libc_string, test_memset)
+{
+	for (size_t o = 0; o < ARRAY_SIZE(offsets); o++) {
+		for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+			uint32_t start = k_cycle_get_32();
+
+			for (int r = 0; r < ROUNDS; r++) {
+				(void)memset(dst_at(offsets[o].dst), 'b', sizes[s]);
+			}
+
+			TC_PRINT("memset  %4zu bytes, offset %zu: %u cycles\n",
+				 sizes[s], offsets[o].dst,
+				 (k_cycle_get_32() - start) / ROUNDS);
+		}
+	}
+}
+
+ZTEST(libc_string, test_memcmp)
+{
+	for (size_t o = 0; o < ARRAY_SIZE(offsets); o++) {
+		for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+			uint32_t start = k_cycle_get_32();
+			int ret = 0;
+
+			for (int r = 0; r < ROUNDS; r++) {
+				ret |= memcmp(dst_at(offsets[o].dst),
+					      src_at(offsets[o].src), sizes[s]);
+			}
+
+			TC_PRINT("memcmp  %4zu bytes, offsets %zu/%zu: %u cycles\n",
+				 sizes[s], offsets[o].dst, offsets[o].src,
+				 (k_cycle_get_32() - start) / ROUNDS);
+			zassert_equal(ret, 0);
+		}
+	}
+}
+
+ZTEST(libc_string, test_strlen)
+{
+	for (size_t o = 0; o < ARRAY_SIZE(offsets); o++) {
+		for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+			char *str = src_at(offsets[o].src);
+			size_t len = sizes[s] - 1;
+			uint32_t start;
+			size_t ret = 0;
+
+			str[len] = '\0';
+			start = k_cycle_get_32();
+
+			for (int r = 0; r < ROUNDS; r++) {
+				ret += strlen(str);
+			}
+
+			TC_PRINT("strlen  %4zu bytes, offset %zu: %u cycles\n",
+				 len, offsets[o].src,
+				 (k_cycle_get_32() - start) / ROUNDS);
+			str[len] = 'a';
+			zassert_equal(ret, ROUNDS * len);
+		}
+	}
+}
+
+static void *libc_string_setup(void)
+{
+	(void)memset(src_buf, 'a', sizeof(src_buf));
+	(void)memset(dst_buf, 'a', sizeof(dst_buf));
+
+	return NULL;
+}
+
+ZTEST_SUITE(libc_string, NULL, libc_string_setup, NULL, NULL, NULL);
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/ztest.h>
+
+#include "connection.h"
+#include "ipv6.h"
+#include "net_private.h"
+#include "route.h"
+#include "udp_internal.h"
+
+#define ROUNDS 100
+#define PAYLOAD 1024
+#define LOCAL_PORT 4000
+#define PEER_PORT 5000
+#define SOCK_PORT 6000
+#define NUM_CONNS 32
+
+static struct net_if *iface;
+
+/* 2001:db8::2, off link so that the packets are not taken as our own */
+static struct in6_addr peer_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					 0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+static struct in6_addr nexthop_addr = { { { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+					    0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+
+static uint8_t tx_buf[PAYLOAD];
+static uint8_t rx_buf[PAYLOAD];
+static uint32_t start;
+
+static void bench_start(void)
+{
+	start = k_cycle_get_32();
+}
+
+static void bench_end(const char *name, int packets)
+{
+	TC_PRINT("%-32s %8u cycles per packet\n", name,
+		 (k_cycle_get_32() - start) / packets);
+}
+
+static struct net_pkt *udp_pkt(size_t len)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(iface, len, AF_INET6, IPPROTO_UDP, K_NO_WAIT);
+	zassert_not_null(pkt, "out of packets");
+
+	zassert_ok(net_ipv6_create(pkt, &peer_addr, &in6addr_loopback));
+	zassert_ok(net_udp_create(pkt, htons(PEER_PORT), htons(LOCAL_PORT)));
+	zassert_ok(net_pkt_memset(pkt, 0xa5, len));
+	net_pkt_cursor_init(pkt);
+	net_ipv6_finalize(pkt, IPPROTO_UDP);
+
+	return pkt;
+}
+
+ZTEST(net_bench, test_pkt_alloc)
+{
+	static const size_t sizes[] = { 64, PAYLOAD };
+	struct net_pkt *pkt;
+	char name[32];
+
+	for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+		bench_start();
+		for (int i = 0; i < ROUNDS; i++) {
+			pkt = net_pkt_alloc_with_buffer(iface, sizes[s], AF_INET6,
+							IPPROTO_UDP, K_NO_WAIT);
+			zassert_not_null(pkt, "out of packets");
+			net_pkt_unref(pkt);
+		}
+		snprintk(name, sizeof(name), "alloc and unref, %zu bytes", sizes[s]);
+		bench_end(name, ROUNDS);
+	}
+}
+
+ZTEST(net_bench, test_chksum)
+{
+	static const size_t sizes[] = { 64, PAYLOAD };
+	struct net_pkt *pkt;
+	uint16_t sum = 0;
+	char name[32];
+
+	for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+		pkt = udp_pkt(sizes[s]);
+
+		bench_start();
+		for (int i = 0; i < ROUNDS; i++) {
+			sum = net_calc_chksum(pkt, IPPROTO_UDP);
+		}
+		snprintk(name, sizeof(name), "UDP checksum, %zu bytes", sizes[s]);
+		bench_end(name, ROUNDS);
+
+		/* Verified over a finalized packet, the checksum field included */
+		zassert_equal(sum, 0, "bad checksum 0x%04x", sum);
+		net_pkt_unref(pkt);
+	}
+}
+
+static int conn_hits;
+
+static enum net_verdict conn_cb(struct net_conn *conn, struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr, void *user_data)
+{
+	/* The packet is kept, to be fed again */
+	conn_hits++;
+
+	return NET_OK;
+}
+
+ZTEST(net_bench, test_conn_input)
+{
+	static const int counts[] = { 1, 8, NUM_CONNS };
+	struct net_conn_handle *handles[NUM_CONNS];
+	struct net_ipv6_hdr ipv6 = { 0 };
+	struct net_udp_hdr udp = { 0 };
+	union net_ip_header ip_hdr = { .ipv6 = &ipv6 };
+	union net_proto_header proto_hdr = { .udp = &udp };
+	struct net_pkt *pkt;
+	int registered = 0;
+	char name[32];
+
+	pkt = net_pkt_alloc_on_iface(iface, K_NO_WAIT);
+	zassert_not_null(pkt, "out of packets");
+	net_pkt_set_family(pkt, AF_INET6);
+
+	net_ipv6_addr_copy_raw(ipv6.src, (const uint8_t *)&peer_addr);
+	net_ipv6_addr_copy_raw(ipv6.dst, (const uint8_t *)&in6addr_loopback);
+	udp.src_port = htons(PEER_PORT);
+
+	for (size_t c = 0; c < ARRAY_SIZE(counts); c++) {
+		for (; registered < counts[c]; registered++) {
+			zassert_ok(net_conn_register(IPPROTO_UDP, AF_INET6, NULL, NULL, 0,
+						     LOCAL_PORT + registered, NULL, conn_cb,
+						     NULL, &handles[registered]));
+		}
+
+		/* Demultiplexed to the last connection registered */
+		udp.dst_port = htons(LOCAL_PORT + registered - 1);
+		conn_hits = 0;
+
+		bench_start();
+		for (int i = 0; i < ROUNDS; i++) {
+			net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr);
+		}
+		snprintk(name, sizeof(name), "conn input, %d conns", registered);
+		bench_end(name, ROUNDS);
+
+		zassert_equal(conn_hits, ROUNDS, "packets not delivered");
+	}
+
+	for (int i = 0; i < registered; i++) {
+		net_conn_unregister(handles[i]);
+	}
+	net_pkt_unref(pkt);
+}
+
+ZTEST(net_bench, test_route_lookup)
+{
+	static const int counts[] = { 1, 8, CONFIG_NET_MAX_ROUTES };
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x02 };
+	struct net_linkaddr lladdr = {
+		.addr = mac,
+		.len = sizeof(mac),
+		.type = NET_LINK_DUMMY,
+	};
+	struct net_route_entry *entry = NULL;
+	struct in6_addr prefix = peer_addr;
+	struct in6_addr dst;
+	int added = 0;
+	char name[32];
+
+	zassert_not_null(net_ipv6_nbr_add(iface, &nexthop_addr, &lladdr, false,
+					  NET_IPV6_NBR_STATE_REACHABLE));
+
+	for (size_t c = 0; c < ARRAY_SIZE(counts); c++) {
+		/* 2001:db8:0:<n>::/64 */
+		for (; added < counts[c]; added++) {
+			prefix.s6_addr[6] = added >> 8;
+			prefix.s6_addr[7] = added;
+			zassert_not_null(net_route_add(iface, &prefix, 64, &nexthop_addr,
+						       NET_IPV6_ND_INFINITE_LIFETIME,
+						       NET_ROUTE_PREFERENCE_LOW));
+		}
+
+		/* Matching the last route added */
+		dst = prefix;
+
+		bench_start();
+		for (int i = 0; i < ROUNDS; i++) {
+			entry = net_route_lookup(iface, &dst);
+		}
+		snprintk(name, sizeof(name), "route lookup, %d routes", added);
+		bench_end(name, ROUNDS);
+
+		zassert_not_null(entry, "route not found");
+	}
+
+	net_route_del_by_nexthop(iface, &nexthop_addr);
+	net_ipv6_nbr_rm(iface, &nexthop_addr);
+}
+
+ZTEST(net_bench, test_udp_loopback)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SOCK_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(sock >= 0, "socket failed (%d)", errno);
+	zassert_ok(zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)));
+
+	bench_start();
+	for (int i = 0; i < ROUNDS; i++) {
+		zassert_equal(zsock_sendto(sock, tx_buf, PAYLOAD, 0,
+					   (struct sockaddr *)&addr, sizeof(addr)),
+			      PAYLOAD, "send failed (%d)", errno);
+		zassert_equal(zsock_recv(sock, rx_buf, sizeof(rx_buf), 0), PAYLOAD,
+			      "recv failed (%d)", errno);
+	}
+	bench_end("UDP loopback, 1024 bytes", ROUNDS);
+
+	zsock_close(sock);
+}
+
+ZTEST(net_bench, test_tcp_loopback)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SOCK_PORT + 1),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int listener, client, server;
+	ssize_t received, ret;
+
+	listener = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(listener >= 0, "socket failed (%d)", errno);
+	zassert_ok(zsock_bind(listener, (struct sockaddr *)&addr, sizeof(addr)));
+	zassert_ok(zsock_listen(listener, 1));
+
+	client = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(client >= 0, "socket failed (%d)", errno);
+	zassert_ok(zsock_connect(client, (struct sockaddr *)&addr, sizeof(addr)));
+	server = zsock_accept(listener, NULL, NULL);
+	zassert_true(server >= 0, "accept failed (%d)", errno);
+
+	bench_start();
+	for (int i = 0; i < ROUNDS; i++) {
+		zassert_equal(zsock_send(client, tx_buf, PAYLOAD, 0), PAYLOAD,
+			      "send failed (%d)", errno);
+		for (received = 0; received < PAYLOAD; received += ret) {
+			ret = zsock_recv(server, rx_buf, PAYLOAD - received, 0);
+			zassert_true(ret > 0, "recv failed (%d)", errno);
+		}
+	}
+	bench_end("TCP loopback, 1024 bytes", ROUNDS);
+
+	zsock_close(client);
+	zsock_close(server);
+	zsock_close(listener);
+}
+
+static void *net_bench_setup(void)
+{
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "no loopback interface");
+
+	return NULL;
+}
+
+ZTEST_SUITE(net_bench, NULL, net_bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BENCH_STORAGE_H_
+#define BENCH_STORAGE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/storage/flash_map.h>
+
+#define BENCH_PARTITION_ID FIXED_PARTITION_ID(storage_partition)
+
+/* Largest record written */
+#define BENCH_RECORD_MAX 1024
+
+/* Most write latencies collected for a distribution */
+#define BENCH_SAMPLES 2048
+
+extern const uint16_t bench_record_sizes[4];
+extern const uint8_t bench_fill_levels[4];
+extern uint8_t bench_buf[BENCH_RECORD_MAX];
+extern uint32_t bench_samples[BENCH_SAMPLES];
+
+/* Erases the benchmark partition and returns its size */
+size_t bench_erase(void);
+
+/* Prints one result line */
+void bench_report(const char *backend, const char *metric, uint32_t size,
+		  uint32_t value, const char *unit);
+
+/* Reports bytes processed in a number of cycles, in bytes per second */
+void bench_throughput(const char *backend, const char *metric, uint32_t size,
+		      size_t bytes, uint32_t cycles);
+
+/* Reports the p50, p99 and max of latencies in cycles, in microseconds */
+void bench_latencies(const char *backend, const char *metric, uint32_t size,
+		     uint32_t *cycles, size_t count);
+
+/*
+ * Bytes written to the flash so far, only known with the flash simulator.
+ * Returns 0 when unknown.
+ */
+uint32_t bench_flash_written(void);
+
+/* Reports the flash bytes written per user byte, in percents */
+void bench_write_amp(const char *backend, uint32_t size, uint32_t flash_start,
+		     size_t user_bytes);
+
+/* Backend benchmarks, returning 0 or a negative errno */
+int bench_nvs(void);
+int bench_fcb(void);
+int bench_fs(void);
+int bench_settings(void);
+
+#endif /* BENCH_STORAGE_H_ */
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fcb.h>
+
+#include "bench.h"
+
+#define BACKEND "fcb"
+
+#define MAX_SECTORS 64
+
+/* Records appended per record size */
+#define RECORDS 32
+
+#define GC_RECORD 256
+
+static struct flash_sector sectors[MAX_SECTORS];
+static uint32_t sector_count;
+static struct fcb fcb;
+
+static int fcb_bench_init(void)
+{
+	memset(&fcb, 0, sizeof(fcb));
+	fcb.f_magic = 0x42454e43;
+	fcb.f_sectors = sectors;
+	fcb.f_sector_cnt = sector_count;
+	fcb.f_scratch_cnt = 1;
+
+	return fcb_init(BENCH_PARTITION_ID, &fcb);
+}
+
+static int append(const void *data, uint16_t len)
+{
+	struct fcb_entry loc;
+	int ret;
+
+	ret = fcb_append(&fcb, len, &loc);
+	if (ret == -ENOSPC) {
+		/* Garbage collection, by dropping the oldest sector */
+		ret = fcb_rotate(&fcb);
+		if (ret == 0) {
+			ret = fcb_append(&fcb, len, &loc);
+		}
+	}
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = fcb_flash_write(&fcb, loc.fe_sector, loc.fe_data_off, data, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return fcb_append_finish(&fcb, &loc);
+}
+
+static int read_entry(struct fcb_entry_ctx *ctx, void *arg)
+{
+	size_t *bytes = arg;
+	int ret;
+
+	ret = fcb_flash_read(&fcb, ctx->loc.fe_sector, ctx->loc.fe_data_off, bench_buf,
+			     ctx->loc.fe_data_len);
+	if (ret < 0) {
+		return ret;
+	}
+	*bytes += ctx->loc.fe_data_len;
+
+	return 0;
+}
+
+static int bench_rw(void)
+{
+	uint32_t start;
+	size_t bytes;
+	int ret;
+
+	for (size_t s = 0; s < ARRAY_SIZE(bench_record_sizes); s++) {
+		uint16_t size = bench_record_sizes[s];
+
+		bench_erase();
+		ret = fcb_bench_init();
+		if (ret < 0) {
+			return ret;
+		}
+
+		start = k_cycle_get_32();
+		for (int i = 0; i < RECORDS; i++) {
+			ret = append(bench_buf, size);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+		bench_throughput(BACKEND, "write", size, RECORDS * size,
+				 k_cycle_get_32() - start);
+
+		bytes = 0;
+		start = k_cycle_get_32();
+		ret = fcb_walk(&fcb, NULL, read_entry, &bytes);
+		if (ret < 0) {
+			return ret;
+		}
+		bench_throughput(BACKEND, "read", size, bytes, k_cycle_get_32() - start);
+	}
+
+	return 0;
+}
+
+static int bench_mount(void)
+{
+	uint32_t start;
+	int ret;
+
+	bench_erase();
+	ret = fcb_bench_init();
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (size_t l = 0; l < ARRAY_SIZE(bench_fill_levels); l++) {
+		/* Fill with records, the initialization walking the last sector */
+		while ((sector_count - fcb_free_sector_cnt(&fcb)) * 100 <
+		       bench_fill_levels[l] * sector_count) {
+			ret = append(bench_buf, 64);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		start = k_cycle_get_32();
+		ret = fcb_bench_init();
+		if (ret < 0) {
+			return ret;
+		}
+		bench_report(BACKEND, "mount", bench_fill_levels[l],
+			     k_cyc_to_us_floor32(k_cycle_get_32() - start), "us");
+	}
+
+	return 0;
+}
+
+static int bench_gc(void)
+{
+	uint32_t flash_start;
+	uint32_t start;
+	int ret;
+
+	bench_erase();
+	ret = fcb_bench_init();
+	if (ret < 0) {
+		return ret;
+	}
+
+	flash_start = bench_flash_written();
+
+	for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+		start = k_cycle_get_32();
+		ret = append(bench_buf, GC_RECORD);
+		bench_samples[i] = k_cycle_get_32() - start;
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	bench_write_amp(BACKEND, GC_RECORD, flash_start, BENCH_SAMPLES * GC_RECORD);
+	bench_latencies(BACKEND, "write", GC_RECORD, bench_samples, BENCH_SAMPLES);
+
+	return 0;
+}
+
+int bench_fcb(void)
+{
+	int ret;
+
+	sector_count = ARRAY_SIZE(sectors);
+	ret = flash_area_get_sectors(BENCH_PARTITION_ID, &sector_count, sectors);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = bench_rw();
+	if (ret == 0) {
+		ret = bench_mount();
+	}
+	if (ret == 0) {
+		ret = bench_gc();
+	}
+
+	return ret;
+}
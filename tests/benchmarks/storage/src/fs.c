@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+
+#include "bench.h"
+
+#ifdef CONFIG_FILE_SYSTEM_LITTLEFS
+#include <zephyr/fs/littlefs.h>
+
+#define BACKEND "littlefs"
+#define MNT_POINT "/lfs"
+
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(storage);
+
+static struct fs_mount_t mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &storage,
+	.storage_dev = (void *)BENCH_PARTITION_ID,
+	.mnt_point = MNT_POINT,
+};
+#else
+#include <ff.h>
+
+#define BACKEND "fat"
+/* Disk name of the zephyr,flash-disk node over the storage partition */
+#define MNT_POINT "/NAND:"
+
+static FATFS fat_fs;
+
+static struct fs_mount_t mnt = {
+	.type = FS_FATFS,
+	.fs_data = &fat_fs,
+	.mnt_point = MNT_POINT,
+};
+#endif
+
+/* Size of the file written per record size */
+#define FILE_SIZE KB(16)
+
+/* Size of the files filling the file system */
+#define FILL_SIZE KB(4)
+
+#define GC_RECORD 256
+
+static bool mounted;
+
+/* Remounts over an erased partition, the file system being formatted again */
+static int reformat(void)
+{
+	int ret;
+
+	if (mounted) {
+		ret = fs_unmount(&mnt);
+		if (ret < 0) {
+			return ret;
+		}
+		mounted = false;
+	}
+
+	bench_erase();
+
+	ret = fs_mount(&mnt);
+	if (ret == 0) {
+		mounted = true;
+	}
+
+	return ret;
+}
+
+static int write_file(const char *path, size_t size, size_t chunk)
+{
+	struct fs_file_t file;
+	ssize_t written;
+	int ret;
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, path, FS_O_CREATE | FS_O_WRITE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (size_t off = 0; off < size; off += chunk) {
+		written = fs_write(&file, bench_buf, chunk);
+		if (written != chunk) {
+			fs_close(&file);
+			return written < 0 ? written : -ENOSPC;
+		}
+	}
+
+	return fs_close(&file);
+}
+
+static int bench_rw(void)
+{
+	struct fs_file_t file;
+	uint32_t start;
+	ssize_t ret;
+
+	for (size_t s = 0; s < ARRAY_SIZE(bench_record_sizes); s++) {
+		uint16_t size = bench_record_sizes[s];
+
+		ret = reformat();
+		if (ret < 0) {
+			return ret;
+		}
+
+		start = k_cycle_get_32();
+		ret = write_file(MNT_POINT "/rw", FILE_SIZE, size);
+		if (ret < 0) {
+			return ret;
+		}
+		bench_throughput(BACKEND, "write", size, FILE_SIZE, k_cycle_get_32() - start);
+
+		fs_file_t_init(&file);
+		start = k_cycle_get_32();
+		ret = fs_open(&file, MNT_POINT "/rw", FS_O_READ);
+		if (ret < 0) {
+			return ret;
+		}
+		for (size_t off = 0; off < FILE_SIZE; off += size) {
+			ret = fs_read(&file, bench_buf, size);
+			if (ret != size) {
+				fs_close(&file);
+				return ret < 0 ? ret : -EIO;
+			}
+		}
+		fs_close(&file);
+		bench_throughput(BACKEND, "read", size, FILE_SIZE, k_cycle_get_32() - start);
+	}
+
+	return 0;
+}
+
+static int used_pct(uint32_t *pct)
+{
+	struct fs_statvfs stat;
+	int ret;
+
+	ret = fs_statvfs(MNT_POINT, &stat);
+	if (ret < 0) {
+		return ret;
+	}
+
+	*pct = ((stat.f_blocks - stat.f_bfree) * 100) / stat.f_blocks;
+
+	return 0;
+}
+
+static int bench_mount(void)
+{
+	char path[32];
+	uint32_t start;
+	uint32_t pct;
+	int files = 0;
+	int ret;
+
+	ret = reformat();
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (size_t l = 0; l < ARRAY_SIZE(bench_fill_levels); l++) {
+		for (;;) {
+			ret = used_pct(&pct);
+			if (ret < 0) {
+				return ret;
+			}
+			if (pct >= bench_fill_levels[l]) {
+				break;
+			}
+
+			snprintk(path, sizeof(path), MNT_POINT "/fill%d", files++);
+			ret = write_file(path, FILL_SIZE, BENCH_RECORD_MAX);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		ret = fs_unmount(&mnt);
+		if (ret < 0) {
+			return ret;
+		}
+		mounted = false;
+
+		start = k_cycle_get_32();
+		ret = fs_mount(&mnt);
+		if (ret < 0) {
+			return ret;
+		}
+		bench_report(BACKEND, "mount", bench_fill_levels[l],
+			     k_cyc_to_us_floor32(k_cycle_get_32() - start), "us");
+		mounted = true;
+	}
+
+	return 0;
+}
+
+/* Rewrites the same record over and over, each write committed by a sync */
+static int bench_gc(void)
+{
+	struct fs_file_t file;
+	uint32_t flash_start;
+	uint32_t start;
+	ssize_t ret;
+
+	ret = reformat();
+	if (ret < 0) {
+		return ret;
+	}
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, MNT_POINT "/gc", FS_O_CREATE | FS_O_RDWR);
+	if (ret < 0) {
+		return ret;
+	}
+
+	flash_start = bench_flash_written();
+
+	for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+		start = k_cycle_get_32();
+		ret = fs_seek(&file, 0, FS_SEEK_SET);
+		if (ret == 0) {
+			ret = fs_write(&file, bench_buf, GC_RECORD);
+		}
+		if (ret == GC_RECORD) {
+			ret = fs_sync(&file);
+		} else if (ret >= 0) {
+			ret = -ENOSPC;
+		}
+		bench_samples[i] = k_cycle_get_32() - start;
+		if (ret < 0) {
+			fs_close(&file);
+			return ret;
+		}
+	}
+
+	fs_close(&file);
+
+	bench_write_amp(BACKEND, GC_RECORD, flash_start, BENCH_SAMPLES * GC_RECORD);
+	bench_latencies(BACKEND, "write", GC_RECORD, bench_samples, BENCH_SAMPLES);
+
+	return 0;
+}
+
+int bench_fs(void)
+{
+	int ret;
+
+	ret = bench_rw();
+	if (ret == 0) {
+		ret = bench_mount();
+	}
+	if (ret == 0) {
+		ret = bench_gc();
+	}
+
+	if (mounted) {
+		fs_unmount(&mnt);
+		mounted = false;
+	}
+
+	return ret;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/stats/stats.h>
+#include <zephyr/tc_util.h>
+
+#include "bench.h"
+
+const uint16_t bench_record_sizes[4] = { 16, 64, 256, BENCH_RECORD_MAX };
+const uint8_t bench_fill_levels[4] = { 0, 25, 50, 75 };
+uint8_t bench_buf[BENCH_RECORD_MAX];
+uint32_t bench_samples[BENCH_SAMPLES];
+
+size_t bench_erase(void)
+{
+	const struct flash_area *fa;
+	size_t size;
+
+	if (flash_area_open(BENCH_PARTITION_ID, &fa) != 0) {
+		return 0;
+	}
+
+	size = fa->fa_size;
+	if (flash_area_erase(fa, 0, size) != 0) {
+		size = 0;
+	}
+	flash_area_close(fa);
+
+	return size;
+}
+
+void bench_report(const char *backend, const char *metric, uint32_t size,
+		  uint32_t value, const char *unit)
+{
+	TC_PRINT("STORAGE backend=%s metric=%s size=%u value=%u unit=%s\n",
+		 backend, metric, size, value, unit);
+}
+
+void bench_throughput(const char *backend, const char *metric, uint32_t size,
+		      size_t bytes, uint32_t cycles)
+{
+	uint64_t us = MAX(k_cyc_to_us_floor64(cycles), 1);
+
+	bench_report(backend, metric, size, (uint32_t)((bytes * USEC_PER_SEC) / us), "B/s");
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+void bench_latencies(const char *backend, const char *metric, uint32_t size,
+		     uint32_t *cycles, size_t count)
+{
+	char name[32];
+
+	if (count == 0) {
+		return;
+	}
+
+	qsort(cycles, count, sizeof(*cycles), compare_samples);
+
+	snprintk(name, sizeof(name), "%s_p50", metric);
+	bench_report(backend, name, size, k_cyc_to_us_floor32(cycles[count / 2]), "us");
+	snprintk(name, sizeof(name), "%s_p99", metric);
+	bench_report(backend, name, size, k_cyc_to_us_floor32(cycles[(count * 99) / 100]),
+		     "us");
+	snprintk(name, sizeof(name), "%s_max", metric);
+	bench_report(backend, name, size, k_cyc_to_us_floor32(cycles[count - 1]), "us");
+}
+
+#ifdef CONFIG_FLASH_SIMULATOR_STATS
+static int find_bytes_written(struct stats_hdr *hdr, void *arg, const char *name,
+			      uint16_t off)
+{
+	if (strcmp(name, "bytes_written") == 0) {
+		*(uint32_t *)arg = *(uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+#endif
+
+uint32_t bench_flash_written(void)
+{
+	uint32_t bytes = 0;
+
+#ifdef CONFIG_FLASH_SIMULATOR_STATS
+	struct stats_hdr *hdr = stats_group_find("flash_sim_stats");
+
+	if (hdr != NULL) {
+		stats_walk(hdr, find_bytes_written, &bytes);
+	}
+#endif
+
+	return bytes;
+}
+
+void bench_write_amp(const char *backend, uint32_t size, uint32_t flash_start,
+		     size_t user_bytes)
+{
+	uint32_t flash_bytes = bench_flash_written() - flash_start;
+
+	/* Not known on real hardware */
+	if (flash_bytes == 0 || user_bytes == 0) {
+		return;
+	}
+
+	bench_report(backend, "write_amp", size,
+		     (uint32_t)(((uint64_t)flash_bytes * 100) / user_bytes), "pct");
+}
+
+static int check(const char *backend, int ret)
+{
+	if (ret < 0) {
+		TC_PRINT("%s benchmark failed: %d\n", backend, ret);
+		return TC_FAIL;
+	}
+
+	return TC_PASS;
+}
+
+int main(void)
+{
+	int result = TC_PASS;
+
+	for (size_t i = 0; i < sizeof(bench_buf); i++) {
+		bench_buf[i] = i;
+	}
+
+	TC_START("Storage benchmark");
+
+	/* NVS is only the storage backend of the settings when both are enabled */
+#if defined(CONFIG_NVS) && !defined(CONFIG_SETTINGS)
+	result |= check("nvs", bench_nvs());
+#endif
+#ifdef CONFIG_FCB
+	result |= check("fcb", bench_fcb());
+#endif
+#ifdef CONFIG_FILE_SYSTEM
+	result |= check("fs", bench_fs());
+#endif
+#ifdef CONFIG_SETTINGS
+	result |= check("settings", bench_settings());
+#endif
+
+	TC_END_REPORT(result);
+
+	return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/fs/nvs.h>
+
+#include "bench.h"
+
+#define BACKEND "nvs"
+
+/* Distinct IDs written per record size */
+#define IDS 32
+
+/* Record size and number of IDs cycled through to force garbage collections */
+#define GC_RECORD 256
+#define GC_IDS 16
+
+static struct nvs_fs fs;
+
+static int nvs_bench_mount(size_t size)
+{
+	struct flash_pages_info info;
+	int ret;
+
+	fs.flash_device = FIXED_PARTITION_DEVICE(storage_partition);
+	fs.offset = FIXED_PARTITION_OFFSET(storage_partition);
+
+	ret = flash_get_page_info_by_offs(fs.flash_device, fs.offset, &info);
+	if (ret < 0) {
+		return ret;
+	}
+
+	fs.sector_size = info.size;
+	fs.sector_count = size / info.size;
+
+	return nvs_mount(&fs);
+}
+
+static int bench_rw(size_t part_size)
+{
+	uint32_t start;
+	ssize_t ret;
+
+	for (size_t s = 0; s < ARRAY_SIZE(bench_record_sizes); s++) {
+		uint16_t size = bench_record_sizes[s];
+
+		bench_erase();
+		ret = nvs_bench_mount(part_size);
+		if (ret < 0) {
+			return ret;
+		}
+
+		start = k_cycle_get_32();
+		for (uint16_t id = 0; id < IDS; id++) {
+			ret = nvs_write(&fs, id, bench_buf, size);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+		bench_throughput(BACKEND, "write", size, IDS * size, k_cycle_get_32() - start);
+
+		start = k_cycle_get_32();
+		for (uint16_t id = 0; id < IDS; id++) {
+			ret = nvs_read(&fs, id, bench_buf, size);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+		bench_throughput(BACKEND, "read", size, IDS * size, k_cycle_get_32() - start);
+	}
+
+	return 0;
+}
+
+static int bench_mount(size_t part_size)
+{
+	uint16_t id = 0;
+	uint32_t start;
+	ssize_t ret;
+
+	bench_erase();
+	ret = nvs_bench_mount(part_size);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (size_t l = 0; l < ARRAY_SIZE(bench_fill_levels); l++) {
+		/* Fill with distinct records, the mount scanning all of them */
+		while ((part_size - nvs_calc_free_space(&fs)) * 100 <
+		       bench_fill_levels[l] * part_size) {
+			ret = nvs_write(&fs, id++, bench_buf, 64);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		start = k_cycle_get_32();
+		ret = nvs_bench_mount(part_size);
+		if (ret < 0) {
+			return ret;
+		}
+		bench_report(BACKEND, "mount", bench_fill_levels[l],
+			     k_cyc_to_us_floor32(k_cycle_get_32() - start), "us");
+	}
+
+	return 0;
+}
+
+static int bench_gc(size_t part_size)
+{
+	uint32_t flash_start;
+	uint32_t start;
+	ssize_t ret;
+
+	bench_erase();
+	ret = nvs_bench_mount(part_size);
+	if (ret < 0) {
+		return ret;
+	}
+
+	flash_start = bench_flash_written();
+
+	for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+		/* Identical data would not be written again */
+		bench_buf[0] = i;
+
+		start = k_cycle_get_32();
+		ret = nvs_write(&fs, i % GC_IDS, bench_buf, GC_RECORD);
+		bench_samples[i] = k_cycle_get_32() - start;
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	bench_write_amp(BACKEND, GC_RECORD, flash_start, BENCH_SAMPLES * GC_RECORD);
+	bench_latencies(BACKEND, "write", GC_RECORD, bench_samples, BENCH_SAMPLES);
+
+	return 0;
+}
+
+int bench_nvs(void)
+{
+	size_t part_size = bench_erase();
+	int ret;
+
+	if (part_size == 0) {
+		return -EIO;
+	}
+
+	ret = bench_rw(part_size);
+	if (ret == 0) {
+		ret = bench_mount(part_size);
+	}
+	if (ret == 0) {
+		ret = bench_gc(part_size);
+	}
+
+	return ret;
+}
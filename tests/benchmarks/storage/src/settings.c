@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+
+#include "bench.h"
+
+#define BACKEND "settings"
+
+/* Keys saved per value size */
+#define KEYS 8
+
+/* Value size and number of keys cycled through to force garbage collections */
+#define GC_VALUE 64
+#define GC_KEYS 16
+
+static size_t loaded;
+
+static int bench_set(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	ssize_t ret;
+
+	ret = read_cb(cb_arg, bench_buf, MIN(len, sizeof(bench_buf)));
+	if (ret < 0) {
+		return ret;
+	}
+	loaded++;
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bench, "bench", NULL, bench_set, NULL, NULL);
+
+static int bench_save_load(void)
+{
+	char key[SETTINGS_MAX_NAME_LEN];
+	uint32_t start;
+	int ret;
+
+	for (size_t s = 0; s < ARRAY_SIZE(bench_record_sizes); s++) {
+		uint16_t size = bench_record_sizes[s];
+
+		start = k_cycle_get_32();
+		for (int i = 0; i < KEYS; i++) {
+			snprintk(key, sizeof(key), "bench/%u/%d", size, i);
+			ret = settings_save_one(key, bench_buf, size);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+		bench_throughput(BACKEND, "save", size, KEYS * size, k_cycle_get_32() - start);
+
+		/* Loads all the keys saved so far */
+		loaded = 0;
+		start = k_cycle_get_32();
+		ret = settings_load_subtree("bench");
+		if (ret < 0) {
+			return ret;
+		}
+		bench_report(BACKEND, "load", size,
+			     k_cyc_to_us_floor32(k_cycle_get_32() - start), "us");
+		if (loaded != (s + 1) * KEYS) {
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+static int bench_gc(void)
+{
+	char key[SETTINGS_MAX_NAME_LEN];
+	uint32_t flash_start;
+	uint32_t start;
+	int ret;
+
+	flash_start = bench_flash_written();
+
+	for (size_t i = 0; i < BENCH_SAMPLES; i++) {
+		snprintk(key, sizeof(key), "bench/gc/%zu", i % GC_KEYS);
+		/* Identical values would not be saved again */
+		bench_buf[0] = i;
+
+		start = k_cycle_get_32();
+		ret = settings_save_one(key, bench_buf, GC_VALUE);
+		bench_samples[i] = k_cycle_get_32() - start;
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	bench_write_amp(BACKEND, GC_VALUE, flash_start, BENCH_SAMPLES * GC_VALUE);
+	bench_latencies(BACKEND, "save", GC_VALUE, bench_samples, BENCH_SAMPLES);
+
+	return 0;
+}
+
+int bench_settings(void)
+{
+	int ret;
+
+	/* The storage backend is only initialized once, over an erased partition */
+	if (bench_erase() == 0) {
+		return -EIO;
+	}
+
+	ret = settings_subsys_init();
+	if (ret == 0) {
+		ret = bench_save_load();
+	}
+	if (ret == 0) {
+		ret = bench_gc();
+	}
+
+	return ret;
+}
@@ -13,6 +13,10 @@
 
 #include <string.h>
 
+#ifdef CONFIG_SYS_PERF
+#include <zephyr/perf/perf.h>
+#endif
+
 K_THREAD_STACK_DEFINE(thread_stack1, STACK_SIZE);
 K_THREAD_STACK_DEFINE(thread_stack2, STACK_SIZE);
 struct k_thread thread_data1;
@@ -32,6 +36,47 @@ uint32_t tm_off;
 /* Holds the loop count that need to be carried out. */
 uint32_t number_of_loops;
 
+#ifdef CONFIG_SYS_PERF
+static struct sys_perf_snapshot perf_start;
+static struct sys_perf_snapshot perf_end;
+
+/* Prints a value per iteration, with two decimals */
+static void perf_print_avg(const char *name, uint64_t count)
+{
+	uint32_t x100 = (uint32_t)((count * 100) / number_of_loops);
+
+	fprintf(output_file, " %u.%02u %s", x100 / 100, x100 % 100, name);
+}
+
+static void perf_print(void)
+{
+	uint32_t events = sys_perf_events_get();
+	struct sys_perf_counters counters;
+	uint32_t ipc;
+
+	sys_perf_elapsed(&perf_start, &perf_end, &counters);
+
+	fprintf(output_file, "\nHARDWARE COUNTERS PER ITERATION:");
+	if ((events & BIT(SYS_PERF_INSTRUCTIONS)) != 0) {
+		perf_print_avg("instructions", counters.count[SYS_PERF_INSTRUCTIONS]);
+	}
+	if ((events & BIT(SYS_PERF_CACHE_MISSES)) != 0) {
+		perf_print_avg("cache misses", counters.count[SYS_PERF_CACHE_MISSES]);
+	}
+	if ((events & BIT(SYS_PERF_BRANCH_MISSES)) != 0) {
+		perf_print_avg("branch misses", counters.count[SYS_PERF_BRANCH_MISSES]);
+	}
+	if ((events & BIT(SYS_PERF_STALLS)) != 0) {
+		perf_print_avg("stall cycles", counters.count[SYS_PERF_STALLS]);
+	}
+
+	ipc = sys_perf_ipc_x100(&counters);
+	if (ipc != 0) {
+		fprintf(output_file, ", IPC %u.%02u", ipc / 100, ipc % 100);
+	}
+}
+#endif
+
 /**
  *
  * @brief Get the time ticks before test starts
@@ -46,6 +91,9 @@ void begin_test(void)
 	 * timestamp_check static variable.
 	 */
 	bench_test_start();
+#ifdef CONFIG_SYS_PERF
+	sys_perf_snapshot(&perf_start);
+#endif
 }
 
 /**
@@ -59,6 +107,10 @@ void begin_test(void)
  */
 int check_result(int i, uint32_t t)
 {
+#ifdef CONFIG_SYS_PERF
+	sys_perf_snapshot(&perf_end);
+#endif
+
 	/*
 	 * bench_test_end checks timestamp_check static variable.
 	 * bench_test_start modifies it
@@ -82,6 +134,9 @@ int check_result(int i, uint32_t t)
 			"Average time for 1 iteration: ");
 	fprintf(output_file, sz_case_timing_fmt,
 			SYS_CLOCK_HW_CYCLES_TO_NS_AVG(t, number_of_loops));
+#ifdef CONFIG_SYS_PERF
+	perf_print();
+#endif
 
 	fprintf(output_file, sz_case_end_fmt);
 	return 1;
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* This benchmark measures the cost of tracing an event. It times
+ * k_sem_give(), which emits an enter and an exit event, in batches small
+ * enough for the events to fit in the tracing buffer, and sleeps between
+ * batches so that the tracing thread empties the buffer. Building it with
+ * CONFIG_TRACING=n gives the cost of k_sem_give() itself.
+ */
+
+#define N_BATCHES 64
+#define BATCH_SIZE 16
+
+static K_SEM_DEFINE(sem, 0, K_SEM_MAX_LIMIT);
+
+int main(void)
+{
+	uint64_t total = 0;
+	uint32_t start;
+
+	for (int i = 0; i < N_BATCHES; i++) {
+		k_sem_reset(&sem);
+		k_msleep(10);
+
+		start = k_cycle_get_32();
+		for (int j = 0; j < BATCH_SIZE; j++) {
+			k_sem_give(&sem);
+		}
+		total += k_cycle_get_32() - start;
+	}
+
+	printk("k_sem_give: %u cycles (%u cycles per second)\n",
+	       (uint32_t)(total / (N_BATCHES * BATCH_SIZE)),
+	       sys_clock_hw_cycles_per_sec());
+	printk("fin\n");
+
+	return 0;
+}
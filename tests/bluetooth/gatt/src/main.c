@@ -177,6 +177,17 @@ ZTEST(test_gatt, test_gatt_foreach)
 	bt_gatt_foreach_attr(test_attrs[0].handle, 0xffff, count_attr, &num);
 	zassert_equal(num, 7, "Number of attributes don't match");
 
+	/* Iterate attributes starting within a service */
+	num = 0;
+	bt_gatt_foreach_attr(test_attrs[2].handle, 0xffff, count_attr, &num);
+	zassert_equal(num, 5, "Number of attributes don't match");
+
+	/* Iterate 1 attribute by handle */
+	num = 0;
+	bt_gatt_foreach_attr(test1_attrs[1].handle, test1_attrs[1].handle,
+			     count_attr, &num);
+	zassert_equal(num, 1, "Number of attributes don't match");
+
 	/* Iterate 1 attribute */
 	num = 0;
 	bt_gatt_foreach_attr_type(test_attrs[0].handle, 0xffff, NULL, NULL, 1,
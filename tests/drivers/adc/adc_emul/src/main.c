@@ -640,6 +640,83 @@ ZTEST_USER(adc_emul, test_adc_emul_ref_voltage_set)
 	check_empty_samples(samples * 2);
 }
 
+#ifdef CONFIG_ADC_RTIO
+
+#define RTIO_SAMPLINGS 4
+
+static const struct adc_sequence_options rtio_options = {
+	.extra_samplings = RTIO_SAMPLINGS - 1,
+};
+
+static const struct adc_sequence rtio_sequence = {
+	.options = &rtio_options,
+	.channels = BIT(ADC_1ST_CHANNEL_ID),
+	.resolution = ADC_RESOLUTION,
+};
+
+ADC_IODEV_DEFINE(adc_iodev, ADC_DEVICE_NODE, &rtio_sequence);
+RTIO_DEFINE_WITH_MEMPOOL(adc_rtio, 4, 4, 8, 64, 4);
+
+/** @brief Test streaming buffers of samplings with a multishot read */
+ZTEST(adc_emul, test_adc_emul_rtio_stream)
+{
+	const uint16_t input_mv = 1500;
+	const struct device *adc_dev = get_adc_device();
+	struct adc_rtio_header *header;
+	struct rtio_sqe *handle;
+	struct rtio_cqe *cqe;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int ret;
+
+	channel_setup(adc_dev, ADC_REF_INTERNAL, ADC_GAIN_1,
+		      ADC_1ST_CHANNEL_ID);
+
+	ret = adc_emul_const_value_set(adc_dev, ADC_1ST_CHANNEL_ID, input_mv);
+	zassert_ok(ret, "adc_emul_const_value_set() failed with code %d", ret);
+
+	handle = rtio_sqe_acquire(&adc_rtio);
+	zassert_not_null(handle);
+	rtio_sqe_prep_read_multishot(handle, &adc_iodev, RTIO_PRIO_NORM, NULL);
+	zassert_ok(rtio_submit(&adc_rtio, 0));
+
+	for (int i = 0; i < 2; i++) {
+		cqe = rtio_cqe_consume_block(&adc_rtio);
+		zassert_ok(cqe->result, "Read failed with code %d", cqe->result);
+		zassert_ok(rtio_cqe_get_mempool_buffer(&adc_rtio, cqe, &buf, &buf_len));
+		rtio_cqe_release(&adc_rtio, cqe);
+
+		zassert_true(buf_len >= adc_rtio_buf_size(&rtio_sequence));
+		header = (struct adc_rtio_header *)buf;
+		zassert_equal(header->samplings, RTIO_SAMPLINGS);
+		zassert_equal(header->channels, BIT(ADC_1ST_CHANNEL_ID));
+
+		for (int j = 0; j < RTIO_SAMPLINGS; j++) {
+			int32_t output = ((int16_t *)(header + 1))[j];
+
+			ret = adc_raw_to_millivolts(ADC_REF_INTERNAL_MV, ADC_GAIN_1,
+						    ADC_RESOLUTION, &output);
+			zassert_ok(ret);
+			zassert_within(input_mv, output, MV_OUTPUT_EPS,
+				       "%u != %u [%u]", input_mv, output, j);
+		}
+
+		rtio_release_buffer(&adc_rtio, buf, buf_len);
+	}
+
+	rtio_sqe_cancel(handle);
+
+	/* Flush the buffers read while canceling */
+	k_msleep(15);
+	while ((cqe = rtio_cqe_consume(&adc_rtio)) != NULL) {
+		rtio_cqe_get_mempool_buffer(&adc_rtio, cqe, &buf, &buf_len);
+		rtio_cqe_release(&adc_rtio, cqe);
+		rtio_release_buffer(&adc_rtio, buf, buf_len);
+	}
+}
+
+#endif /* CONFIG_ADC_RTIO */
+
 void *adc_emul_setup(void)
 {
 	k_object_access_grant(get_adc_device(), k_current_get());
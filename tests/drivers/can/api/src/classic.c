@@ -601,7 +601,39 @@ static void add_remove_max_filters(bool ide)
 
 	filter.id++;
 	filter_id = can_add_rx_filter_msgq(can_dev, &can_msgq, &filter);
-	zassert_equal(filter_id, -ENOSPC, "added more than max filters");
+
+	if (IS_ENABLED(CONFIG_CAN_RX_FILTER_MANAGER)) {
+		/*
+		 * The software filter, the first filter and the last filter, which may
+		 * have been moved to software, all receive frames.
+		 */
+		const uint32_t ids[] = { filter.id, 1, max };
+		struct can_frame frame = {
+			.flags = ide ? CAN_FRAME_IDE : 0,
+		};
+		struct can_frame frame_buffer;
+		uint32_t hits;
+		int err;
+
+		zassert_true(filter_id >= 0, "failed to add software filter (err %d)", filter_id);
+
+		for (i = 0; i < ARRAY_SIZE(ids); i++) {
+			frame.id = ids[i];
+			send_test_frame(can_dev, &frame);
+
+			err = k_msgq_get(&can_msgq, &frame_buffer, TEST_RECEIVE_TIMEOUT);
+			zassert_equal(err, 0, "receive timeout");
+			assert_frame_equal(&frame_buffer, &frame, 0);
+		}
+
+		err = can_get_rx_filter_hits(can_dev, filter_id, &hits);
+		zassert_equal(err, 0, "failed to get filter hits (err %d)", err);
+		zassert_equal(hits, 1, "wrong number of filter hits (%u)", hits);
+
+		can_remove_rx_filter(can_dev, filter_id);
+	} else {
+		zassert_equal(filter_id, -ENOSPC, "added more than max filters");
+	}
 
 	for (i = 0; i < max; i++) {
 		can_remove_rx_filter(can_dev, filter_ids[i]);
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/drivers/flash/flash_cache.h>
+#include <zephyr/drivers/flash/flash_simulator.h>
+#include <zephyr/storage/flash_map.h>
+
+#define CACHE_NODE DT_NODELABEL(flash_cache)
+#define PAGE_SIZE DT_PROP(CACHE_NODE, cache_page_size)
+#define PAGE_COUNT DT_PROP(CACHE_NODE, cache_page_count)
+#define TEST_OFFSET FIXED_PARTITION_OFFSET(storage_partition)
+#define ERASE_SIZE 4096
+
+static const struct device *const cache_dev = DEVICE_DT_GET(CACHE_NODE);
+static const struct device *const flash_dev =
+	DEVICE_DT_GET(DT_PHANDLE(CACHE_NODE, flash_device));
+static uint8_t *flash_mem;
+
+static uint8_t buf[PAGE_SIZE];
+
+/* Value of the byte at the given offset, read through the cache */
+static uint8_t cached_byte(off_t offset)
+{
+	uint8_t val;
+
+	zassert_equal(flash_read(cache_dev, offset, &val, 1), 0, "Read failed");
+
+	return val;
+}
+
+ZTEST(flash_cache, test_read)
+{
+	memset(buf, 0x5a, sizeof(buf));
+	zassert_equal(flash_write(cache_dev, TEST_OFFSET, buf, 16), 0, "Write failed");
+	zassert_equal(flash_cache_flush(cache_dev), 0, "Flush failed");
+	zassert_equal(flash_mem[TEST_OFFSET], 0x5a, "Not written to the flash");
+
+	/* The cached page is read, not the flash */
+	flash_mem[TEST_OFFSET] = 0x00;
+	zassert_equal(cached_byte(TEST_OFFSET), 0x5a, "Page not cached");
+
+	zassert_equal(flash_cache_invalidate(cache_dev), 0, "Invalidate failed");
+	zassert_equal(cached_byte(TEST_OFFSET), 0x00, "Page not invalidated");
+}
+
+ZTEST(flash_cache, test_write_back)
+{
+	for (int i = 0; i < 3; i++) {
+		memset(buf, i, 64);
+		zassert_equal(flash_write(cache_dev, TEST_OFFSET + i * 64, buf, 64), 0,
+			      "Write failed");
+	}
+
+	/* Contiguous writes are kept in the cache */
+	zassert_equal(flash_mem[TEST_OFFSET + 64], 0xff, "Written to the flash");
+	zassert_equal(cached_byte(TEST_OFFSET + 64), 1, "Invalid cached data");
+
+	/* A write which is not contiguous flushes the previous ones */
+	zassert_equal(flash_write(cache_dev, TEST_OFFSET + 224, buf, 16), 0, "Write failed");
+	zassert_equal(flash_mem[TEST_OFFSET + 128], 2, "Not written to the flash");
+	zassert_equal(flash_mem[TEST_OFFSET + 224], 0xff, "Written to the flash");
+
+	zassert_equal(flash_cache_flush(cache_dev), 0, "Flush failed");
+	zassert_equal(flash_mem[TEST_OFFSET + 224], 2, "Not written to the flash");
+}
+
+ZTEST(flash_cache, test_erase)
+{
+	memset(buf, 0x5a, sizeof(buf));
+	zassert_equal(flash_write(cache_dev, TEST_OFFSET, buf, 16), 0, "Write failed");
+
+	zassert_equal(flash_erase(cache_dev, TEST_OFFSET, ERASE_SIZE), 0, "Erase failed");
+	zassert_equal(cached_byte(TEST_OFFSET), 0xff, "Cached data not erased");
+
+	zassert_equal(flash_cache_flush(cache_dev), 0, "Flush failed");
+	zassert_equal(flash_mem[TEST_OFFSET], 0xff, "Erased data written");
+}
+
+ZTEST(flash_cache, test_prefetch)
+{
+	/* Reading two pages in a row loads the third one */
+	(void)cached_byte(TEST_OFFSET);
+	(void)cached_byte(TEST_OFFSET + PAGE_SIZE);
+
+	flash_mem[TEST_OFFSET + 2 * PAGE_SIZE] = 0x00;
+	zassert_equal(cached_byte(TEST_OFFSET + 2 * PAGE_SIZE), 0xff, "Page not prefetched");
+}
+
+ZTEST(flash_cache, test_lru)
+{
+	/* Fill the cache without sequential reads */
+	for (int i = 0; i < PAGE_COUNT; i++) {
+		(void)cached_byte(TEST_OFFSET + 2 * i * PAGE_SIZE);
+	}
+
+	/* Use the first page again, so that the second one is evicted */
+	(void)cached_byte(TEST_OFFSET);
+	(void)cached_byte(TEST_OFFSET + 2 * PAGE_COUNT * PAGE_SIZE);
+
+	flash_mem[TEST_OFFSET] = 0x00;
+	flash_mem[TEST_OFFSET + 2 * PAGE_SIZE] = 0x00;
+	zassert_equal(cached_byte(TEST_OFFSET), 0xff, "Recently used page evicted");
+	zassert_equal(cached_byte(TEST_OFFSET + 2 * PAGE_SIZE), 0x00,
+		      "Least recently used page not evicted");
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	zassert_equal(flash_cache_invalidate(cache_dev), 0, "Invalidate failed");
+	zassert_equal(flash_erase(flash_dev, TEST_OFFSET, 2 * ERASE_SIZE), 0, "Erase failed");
+}
+
+static void *setup(void)
+{
+	size_t size;
+
+	zassert_true(device_is_ready(cache_dev), "Flash cache not ready");
+
+	flash_mem = flash_simulator_get_memory(flash_dev, &size);
+	zassert_not_null(flash_mem, "No flash memory");
+
+	return NULL;
+}
+
+ZTEST_SUITE(flash_cache, NULL, setup, before, NULL, NULL);
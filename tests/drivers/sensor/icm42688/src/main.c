@@ -12,6 +12,8 @@
 #include <zephyr/fff.h>
 #include <zephyr/ztest.h>
 
+#include "icm42688.h"
+#include "icm42688_decoder.h"
 #include "icm42688_emul.h"
 #include "icm42688_reg.h"
 
@@ -240,3 +242,109 @@ ZTEST_F(icm42688, test_interrupt)
 	/* Verify the handler was called */
 	zassert_equal(test_interrupt_trigger_handler_fake.call_count, 1);
 }
+
+static uint8_t fifo_buffer[sizeof(struct icm42688_fifo_data) + 3 * ICM42688_FIFO_PACKET_SIZE];
+
+/* Two packets with acceleration on the X axis, then an empty one */
+static void fill_fifo_buffer(void)
+{
+	struct icm42688_fifo_data *edata = (struct icm42688_fifo_data *)fifo_buffer;
+
+	memset(fifo_buffer, 0, sizeof(fifo_buffer));
+	edata->header.is_fifo = true;
+	edata->header.accel_fs = ICM42688_ACCEL_FS_2G;
+	edata->header.gyro_fs = ICM42688_GYRO_FS_2000;
+	edata->header.timestamp = 10000000;
+	edata->int_status = BIT_INT_STATUS_FIFO_THS;
+	edata->accel_odr = ICM42688_ACCEL_ODR_1000;
+	edata->gyro_odr = ICM42688_GYRO_ODR_1000;
+	edata->fifo_count = 3 * ICM42688_FIFO_PACKET_SIZE;
+
+	for (int i = 0; i < 2; i++) {
+		uint8_t *packet = &edata->frames[i * ICM42688_FIFO_PACKET_SIZE];
+
+		packet[0] = BIT_FIFO_HEAD_ACCEL | BIT_FIFO_HEAD_GYRO;
+		sys_put_be16(8192 * (i + 1), &packet[1]);
+	}
+	edata->frames[2 * ICM42688_FIFO_PACKET_SIZE] = BIT_FIFO_HEAD_MSG;
+}
+
+ZTEST_F(icm42688, test_fifo_decode)
+{
+	const struct sensor_decoder_api *decoder;
+	sensor_frame_iterator_t fit = 0;
+	sensor_channel_iterator_t cit = 0;
+	enum sensor_channel channels[7];
+	q31_t values[7];
+	q31_t accel_x = 0;
+	uint16_t frame_count;
+	uint64_t timestamp;
+
+	fill_fifo_buffer();
+
+	zassert_ok(sensor_get_decoder(fixture->dev, &decoder));
+	zassert_ok(decoder->get_frame_count(fifo_buffer, &frame_count));
+	zassert_equal(2, frame_count);
+
+	/* The timestamp of the interrupt is the one of the last frame */
+	zassert_ok(decoder->get_timestamp(fifo_buffer, &timestamp));
+	zassert_equal(9000000, timestamp);
+
+	zassert_true(decoder->has_trigger(fifo_buffer, SENSOR_TRIG_FIFO_WATERMARK));
+	zassert_false(decoder->has_trigger(fifo_buffer, SENSOR_TRIG_FIFO_FULL));
+
+	for (int i = 0; i < 2; i++) {
+		zassert_equal(7, decoder->decode(fifo_buffer, &fit, &cit, channels, values, 7));
+		zassert_equal(i + 1, fit);
+		zassert_equal(SENSOR_CHAN_ACCEL_X, channels[1]);
+		zassert_equal(SENSOR_CHAN_ACCEL_Y, channels[2]);
+		zassert_true(values[1] > accel_x);
+		zassert_equal(0, values[2]);
+		accel_x = values[1];
+	}
+
+	zassert_equal(0, decoder->decode(fifo_buffer, &fit, &cit, channels, values, 7),
+		      "Empty packet decoded");
+}
+
+ZTEST_F(icm42688, test_fifo_decode_channel)
+{
+	const struct sensor_decoder_api *decoder;
+	struct sensor_decoder_api fallback;
+	sensor_frame_iterator_t fit = 0;
+	sensor_channel_iterator_t cit = 0;
+	enum sensor_channel channels[7];
+	q31_t values[7];
+	q31_t accel_x[4];
+
+	fill_fifo_buffer();
+	zassert_ok(sensor_get_decoder(fixture->dev, &decoder));
+
+	/* Same values as the ones decoded frame by frame */
+	zassert_equal(2, sensor_decode_channel(decoder, fifo_buffer, SENSOR_CHAN_ACCEL_X, &fit,
+					       ARRAY_SIZE(accel_x), accel_x));
+	zassert_equal(2, fit);
+	zassert_equal(0, sensor_decode_channel(decoder, fifo_buffer, SENSOR_CHAN_ACCEL_X, &fit,
+					       ARRAY_SIZE(accel_x), accel_x));
+
+	fit = 0;
+	for (int i = 0; i < 2; i++) {
+		zassert_equal(7, decoder->decode(fifo_buffer, &fit, &cit, channels, values, 7));
+		zassert_equal(values[1], accel_x[i]);
+	}
+
+	/* Decoders without a batch implementation are iterated */
+	fallback = *decoder;
+	fallback.decode_channel = NULL;
+	memset(accel_x, 0, sizeof(accel_x));
+	fit = 0;
+	zassert_equal(1, sensor_decode_channel(&fallback, fifo_buffer, SENSOR_CHAN_ACCEL_X, &fit,
+					       1, accel_x));
+	zassert_equal(1, sensor_decode_channel(&fallback, fifo_buffer, SENSOR_CHAN_ACCEL_X, &fit,
+					       ARRAY_SIZE(accel_x) - 1, &accel_x[1]));
+	zassert_equal(2, fit);
+	zassert_equal(values[1], accel_x[1]);
+
+	zassert_equal(-EINVAL, sensor_decode_channel(decoder, fifo_buffer, SENSOR_CHAN_ACCEL_XYZ,
+						     &fit, ARRAY_SIZE(accel_x), accel_x));
+}
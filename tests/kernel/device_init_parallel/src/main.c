@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/device.h>
+
+#define BASE_A DT_NODELABEL(test_init_base_a)
+#define BASE_B DT_NODELABEL(test_init_base_b)
+#define MID    DT_NODELABEL(test_init_mid)
+#define TOP    DT_NODELABEL(test_init_top)
+#define FWD    DT_NODELABEL(test_init_fwd)
+#define LATE   DT_NODELABEL(test_init_late)
+
+#define INIT_SLEEP_MS 50
+
+struct init_data {
+	/* Order in which the initializations started and ended */
+	int start;
+	int end;
+	/* Required devices not initialized when the initialization started */
+	int missing;
+};
+
+static struct k_spinlock lock;
+static int init_seq;
+
+static int dev_init(const struct device *dev)
+{
+	struct init_data *data = dev->data;
+	const device_handle_t *handles;
+	k_spinlock_key_t key;
+	size_t count;
+
+	handles = device_required_handles_get(dev, &count);
+
+	key = k_spin_lock(&lock);
+	data->start = ++init_seq;
+	for (size_t i = 0; i < count; i++) {
+		const struct device *req = device_from_handle(handles[i]);
+
+		if ((req != NULL) && !device_is_ready(req)) {
+			data->missing++;
+		}
+	}
+	k_spin_unlock(&lock, key);
+
+	k_msleep(INIT_SLEEP_MS);
+
+	key = k_spin_lock(&lock);
+	data->end = ++init_seq;
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+#define TEST_DEVICE_DEFINE(node_id, prio)					\
+	static struct init_data data_##prio;					\
+	DEVICE_DT_DEFINE(node_id, dev_init, NULL, &data_##prio, NULL,		\
+			 POST_KERNEL, prio, NULL)
+
+TEST_DEVICE_DEFINE(BASE_A, 10);
+TEST_DEVICE_DEFINE(BASE_B, 11);
+TEST_DEVICE_DEFINE(MID, 12);
+TEST_DEVICE_DEFINE(TOP, 13);
+/* NB: Intentionally initialized before the device it requires */
+TEST_DEVICE_DEFINE(FWD, 14);
+TEST_DEVICE_DEFINE(LATE, 15);
+
+#define INIT_DATA(node_id) ((struct init_data *)DEVICE_DT_GET(node_id)->data)
+
+ZTEST(device_init_parallel, test_all_initialized)
+{
+	/* Reaching the test at all means that boot completed */
+	zassert_true(device_is_ready(DEVICE_DT_GET(BASE_A)));
+	zassert_true(device_is_ready(DEVICE_DT_GET(BASE_B)));
+	zassert_true(device_is_ready(DEVICE_DT_GET(MID)));
+	zassert_true(device_is_ready(DEVICE_DT_GET(TOP)));
+	zassert_true(device_is_ready(DEVICE_DT_GET(FWD)));
+	zassert_true(device_is_ready(DEVICE_DT_GET(LATE)));
+}
+
+ZTEST(device_init_parallel, test_dependencies)
+{
+	zassert_equal(INIT_DATA(MID)->missing, 0, "mid started before its suppliers");
+	zassert_equal(INIT_DATA(TOP)->missing, 0, "top started before mid");
+	zassert_true(INIT_DATA(MID)->start > INIT_DATA(BASE_A)->end);
+	zassert_true(INIT_DATA(MID)->start > INIT_DATA(BASE_B)->end);
+	zassert_true(INIT_DATA(TOP)->start > INIT_DATA(MID)->end);
+}
+
+ZTEST(device_init_parallel, test_independent_overlap)
+{
+	/* Neither waited for the other */
+	zassert_true(INIT_DATA(BASE_B)->start < INIT_DATA(BASE_A)->end,
+		     "independent devices initialized one after the other");
+}
+
+ZTEST(device_init_parallel, test_forward_dependency)
+{
+	/* Not waited for, as without parallel initialization */
+	zassert_equal(INIT_DATA(FWD)->missing, 1);
+	zassert_true(INIT_DATA(FWD)->start < INIT_DATA(LATE)->end);
+}
+
+ZTEST_SUITE(device_init_parallel, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#define PRIO_MAIN K_PRIO_PREEMPT(5)
+#define PRIO_HIGH K_PRIO_PREEMPT(1)
+#define PRIO_LOW  K_PRIO_PREEMPT(10)
+
+static volatile int high_count;
+static volatile int low_count;
+static volatile int low_prio;
+
+static void high_handler(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	high_count++;
+}
+
+static void low_handler(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	low_prio = k_thread_priority_get(k_current_get());
+	low_count++;
+}
+
+K_IRQ_THREAD_DEFINE(high_thread, -1, high_handler, NULL, STACK_SIZE, PRIO_HIGH);
+K_IRQ_THREAD_DEFINE(low_thread, -1, low_handler, NULL, STACK_SIZE, PRIO_LOW);
+
+static void wake_isr(const void *arg)
+{
+	k_irq_thread_wake((struct k_irq_thread *)arg);
+}
+
+ZTEST(irq_thread, test_wake_from_isr)
+{
+	irq_offload(wake_isr, &high_thread);
+
+	/* The handler ran on the way out of the interrupt */
+	zassert_equal(high_count, 1, "Handler did not run");
+	zassert_ok(k_irq_thread_flush(&high_thread, K_NO_WAIT));
+}
+
+ZTEST(irq_thread, test_coalesce)
+{
+	k_sched_lock();
+	for (int i = 0; i < 3; i++) {
+		irq_offload(wake_isr, &high_thread);
+	}
+	zassert_equal(high_count, 0, "Handler ran with the scheduler locked");
+	k_sched_unlock();
+
+	zassert_equal(high_count, 1, "Wake-ups not coalesced");
+}
+
+ZTEST(irq_thread, test_flush_inherit)
+{
+	k_irq_thread_wake(&low_thread);
+	zassert_equal(low_count, 0, "Lower priority handler ran");
+	zassert_equal(k_irq_thread_flush(&low_thread, K_NO_WAIT), -EBUSY);
+
+	zassert_ok(k_irq_thread_flush(&low_thread, K_FOREVER));
+	zassert_equal(low_count, 1, "Handler did not run");
+	zassert_equal(low_prio, PRIO_MAIN, "Handler did not inherit the priority");
+	zassert_equal(k_thread_priority_get(&low_thread.thread), PRIO_LOW,
+		      "Priority not restored");
+}
+
+ZTEST(irq_thread, test_wake_suspended)
+{
+	k_thread_suspend(&high_thread.thread);
+
+	irq_offload(wake_isr, &high_thread);
+	zassert_equal(high_count, 0, "Suspended handler thread resumed");
+
+	k_thread_resume(&high_thread.thread);
+	zassert_equal(high_count, 1, "Handler did not run once resumed");
+}
+
+ZTEST(irq_thread, test_stats)
+{
+	struct k_irq_thread_stats stats;
+
+	irq_offload(wake_isr, &high_thread);
+	irq_offload(wake_isr, &high_thread);
+
+	k_irq_thread_stats_get(&high_thread, &stats);
+	zassert_equal(stats.count, 2);
+	zassert_true(stats.min_cycles <= stats.max_cycles);
+	zassert_true(stats.total_cycles >= (uint64_t)stats.min_cycles + stats.max_cycles);
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_thread_priority_set(k_current_get(), PRIO_MAIN);
+	k_irq_thread_stats_reset(&high_thread);
+	high_count = 0;
+	low_count = 0;
+}
+
+ZTEST_SUITE(irq_thread, NULL, NULL, before, NULL, NULL);
@@ -6,6 +6,7 @@
 
 #include <zephyr/ztest.h>
 #include <zephyr/irq_offload.h>
+#include <zephyr/sys/heap_listener.h>
 #include "test_kheap.h"
 
 #define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
@@ -265,3 +266,115 @@ ZTEST(k_heap_api, test_k_heap_alloc_pending_null)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+static int listener_bytes;
+
+static void on_alloc(uintptr_t heap_id, void *mem, size_t bytes)
+{
+	listener_bytes += (int)bytes;
+}
+
+static void on_free(uintptr_t heap_id, void *mem, size_t bytes)
+{
+	listener_bytes -= (int)bytes;
+}
+
+HEAP_LISTENER_ALLOC_DEFINE(alloc_listener, HEAP_ID_FROM_POINTER(&k_heap_test.heap),
+			   on_alloc);
+HEAP_LISTENER_FREE_DEFINE(free_listener, HEAP_ID_FROM_POINTER(&k_heap_test.heap),
+			  on_free);
+#endif
+
+#define MAG_ALLOC_SIZE 24
+#define MAG_MAX_BLOCKS (HEAP_SIZE / MAG_ALLOC_SIZE)
+
+/**
+ * @brief Validate the per-CPU magazine caches of a k_heap
+ *
+ * @details Check that a small block freed to the heap is handed out
+ * again, that runtime statistics and heap listeners see cached blocks
+ * as free, and that memory parked in magazines is returned to the
+ * heap when a large allocation needs it.
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_magazines)
+{
+	static void *blocks[MAG_MAX_BLOCKS];
+	int n;
+
+	if (!IS_ENABLED(CONFIG_KHEAP_MAGAZINES)) {
+		ztest_test_skip();
+	}
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	heap_listener_register(&alloc_listener);
+	heap_listener_register(&free_listener);
+	listener_bytes = 0;
+#endif
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	struct sys_memory_stats before, during, after;
+
+	sys_heap_runtime_stats_get(&k_heap_test.heap, &before);
+#endif
+
+	char *p = k_heap_alloc(&k_heap_test, MAG_ALLOC_SIZE, K_NO_WAIT);
+
+	zassert_not_null(p, "k_heap_alloc operation failed");
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	sys_heap_runtime_stats_get(&k_heap_test.heap, &during);
+	zassert_true(during.allocated_bytes >= before.allocated_bytes + MAG_ALLOC_SIZE,
+		     "allocation not accounted");
+#endif
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	zassert_true(listener_bytes >= MAG_ALLOC_SIZE, "allocation not notified");
+#endif
+
+	k_heap_free(&k_heap_test, p);
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	sys_heap_runtime_stats_get(&k_heap_test.heap, &after);
+	zassert_equal(after.allocated_bytes, before.allocated_bytes,
+		      "cached block still counted as allocated");
+	zassert_true(after.free_bytes > during.free_bytes,
+		     "cached block not counted as free");
+#endif
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	zassert_equal(listener_bytes, 0, "free of cached block not notified");
+#endif
+
+	/* The block just freed is handed out again first */
+	zassert_equal_ptr(k_heap_alloc(&k_heap_test, MAG_ALLOC_SIZE, K_NO_WAIT), p,
+			  "freed block not reused");
+	k_heap_free(&k_heap_test, p);
+
+	/* Fill the heap with small blocks and free them all: most end up
+	 * parked in magazines, yet a large allocation must still succeed.
+	 */
+	for (n = 0; n < MAG_MAX_BLOCKS; n++) {
+		blocks[n] = k_heap_alloc(&k_heap_test, MAG_ALLOC_SIZE, K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > 0, "no small allocation succeeded");
+	while (n-- > 0) {
+		k_heap_free(&k_heap_test, blocks[n]);
+	}
+
+	p = k_heap_alloc(&k_heap_test, ALLOC_SIZE_1, K_NO_WAIT);
+	zassert_not_null(p, "memory parked in magazines was not reclaimed");
+	k_heap_free(&k_heap_test, p);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	sys_heap_runtime_stats_get(&k_heap_test.heap, &after);
+	zassert_equal(after.allocated_bytes, before.allocated_bytes,
+		      "allocated bytes leaked");
+#endif
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	zassert_equal(listener_bytes, 0, "listener events unbalanced");
+
+	heap_listener_unregister(&alloc_listener);
+	heap_listener_unregister(&free_listener);
+#endif
+}
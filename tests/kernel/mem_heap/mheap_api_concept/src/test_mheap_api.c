@@ -296,3 +296,87 @@ ZTEST(mheap_api, test_multi_heap)
 		zassert_not_null(blocks[i], "final re-allocation failed");
 	}
 }
+
+static bool in_mheap(void *block, int i)
+{
+	return (char *)block >= &heap_mem[i][0] &&
+	       (char *)block < &heap_mem[i][MHEAP_BYTES];
+}
+
+/**
+ * @brief Test the latency class placement policy
+ *
+ * @details Put the heaps in classes 2, 0, 1 and 1, and check that
+ * allocations go to the preferred class first and fall back only in
+ * the directions the hint allows.  Then move a block from the slowest
+ * heap to the fastest one and check its contents followed it.
+ *
+ * @see sys_multi_heap_placement_choice(), sys_multi_heap_migrate()
+ */
+ZTEST(mheap_api, test_multi_heap_placement)
+{
+	static const unsigned int latency[N_MULTI_HEAPS] = { 2, 0, 1, 1 };
+	static SYS_MULTI_HEAP_HINT_DEFINE(fast, 0, SYS_MULTI_HEAP_FALLBACK_SLOWER);
+	static SYS_MULTI_HEAP_HINT_DEFINE(mid_only, 1, 0);
+	static SYS_MULTI_HEAP_HINT_DEFINE(mid_faster, 1, SYS_MULTI_HEAP_FALLBACK_FASTER);
+	static SYS_MULTI_HEAP_HINT_DEFINE(mid_slower, 1, SYS_MULTI_HEAP_FALLBACK_SLOWER);
+	int served[N_MULTI_HEAPS] = { 0 };
+	char *block, *moved;
+
+	sys_multi_heap_init(&multi_heap, sys_multi_heap_placement_choice);
+	for (int i = 0; i < N_MULTI_HEAPS; i++) {
+		sys_heap_init(&mheaps[i], &heap_mem[i][0], MHEAP_BYTES);
+		sys_multi_heap_add_heap(&multi_heap, &mheaps[i], NULL);
+		zassert_equal(sys_multi_heap_set_latency(&multi_heap, &mheaps[i],
+							 latency[i]), 0);
+	}
+	zassert_equal(sys_multi_heap_set_latency(&multi_heap, NULL, 0), -ENOENT);
+
+	block = sys_multi_heap_alloc(&multi_heap, &fast, 8);
+	zassert_true(in_mheap(block, 1), "fast block not in class 0");
+	served[1]++;
+
+	/* Exhaust class 1, filling the heaps in memory order */
+	while ((block = sys_multi_heap_alloc(&multi_heap, &mid_only, 8)) != NULL) {
+		zassert_true(in_mheap(block, 2) || in_mheap(block, 3),
+			     "block outside class 1");
+		zassert_true(in_mheap(block, 2) || served[2] > 0,
+			     "second class 1 heap used first");
+		served[in_mheap(block, 2) ? 2 : 3]++;
+	}
+	zassert_true(served[3] > 0, "class 1 heaps not both used");
+
+	block = sys_multi_heap_alloc(&multi_heap, &mid_faster, 8);
+	zassert_true(in_mheap(block, 1), "no fallback to a faster class");
+	served[1]++;
+
+	block = sys_multi_heap_alloc(&multi_heap, &mid_slower, 8);
+	zassert_true(in_mheap(block, 0), "no fallback to a slower class");
+	served[0]++;
+
+	/* Hot block found in slow memory: move it to class 0 */
+	memset(block, 0x5a, 8);
+	moved = sys_multi_heap_migrate(&multi_heap, block, &fast, 0);
+	zassert_true(in_mheap(moved, 1), "block not moved to class 0");
+	for (int i = 0; i < 8; i++) {
+		zassert_equal(moved[i], 0x5a, "contents not copied");
+	}
+	served[1]++;
+
+	/* Already in the fastest class available: stays put */
+	zassert_equal_ptr(sys_multi_heap_migrate(&multi_heap, moved, &fast, 0), moved);
+	zassert_is_null(sys_multi_heap_migrate(&multi_heap, NULL, &fast, 0));
+
+#ifdef CONFIG_SYS_MULTI_HEAP_STATS
+	for (int i = 0; i < N_MULTI_HEAPS; i++) {
+		struct sys_multi_heap_stats stats;
+
+		zassert_equal(sys_multi_heap_stats_get(&multi_heap, &mheaps[i], &stats), 0);
+		zassert_equal(stats.served[0], served[i], "heap %d served %u, not %d",
+			      i, stats.served[0], served[i]);
+		for (int j = 1; j < SYS_MULTI_HEAP_STATS_SIZES; j++) {
+			zassert_equal(stats.served[j], 0, "8 byte block in size class %d", j);
+		}
+	}
+#endif
+}
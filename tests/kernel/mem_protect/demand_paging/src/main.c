@@ -402,6 +402,12 @@ ZTEST_USER(demand_paging_stat, test_user_get_hist)
 	zassert_true(print_histogram(&hist),
 		     "should have non-zero counts in histogram.");
 	printk("\n");
+
+	printk("Page Fault Histogram:\n");
+	k_mem_paging_histogram_page_fault_get(&hist);
+	zassert_true(print_histogram(&hist),
+		     "should have non-zero counts in histogram.");
+	printk("\n");
 }
 
 void *demand_paging_api_setup(void)
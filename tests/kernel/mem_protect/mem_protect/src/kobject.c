@@ -244,6 +244,60 @@ ZTEST(mem_protect_kobj, test_kobject_revoke_access)
 	k_thread_join(&child_thread, K_FOREVER);
 }
 
+/****************************************************************************/
+K_SEM_DEFINE(kobject_cached_sem, 0, 1);
+K_SEM_DEFINE(kobject_cached_sync, 0, 1);
+ZTEST_BMEM volatile bool cached_sem_used;
+
+static void kobject_revoke_cached_child(void *p1, void *p2, void *p3)
+{
+	/* Validated, and cached if the object cache is enabled */
+	k_sem_give(&kobject_cached_sem);
+	k_sem_take(&kobject_cached_sync, K_FOREVER);
+
+	/* Access was revoked meanwhile, so this must fault */
+	set_fault_valid(true);
+	k_sem_give(&kobject_cached_sem);
+	cached_sem_used = true;
+}
+
+/**
+ * @brief Test access revoke after a validation
+ *
+ * @details A user thread uses a semaphore, which gets its validation
+ * cached, then its access is revoked. Check that its next system call
+ * on the semaphore faults.
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_object_access_revoke()
+ */
+ZTEST(mem_protect_kobj, test_kobject_revoke_cached_access)
+{
+	set_fault_valid(false);
+	cached_sem_used = false;
+
+	k_thread_create(&child_thread,
+			child_stack,
+			KOBJECT_STACK_SIZE,
+			kobject_revoke_cached_child,
+			NULL, NULL, NULL,
+			0, K_USER, K_FOREVER);
+	k_thread_access_grant(&child_thread, &kobject_cached_sem,
+			      &kobject_cached_sync);
+	k_thread_start(&child_thread);
+
+	/* Given once the child validated the semaphore */
+	k_sem_take(&kobject_cached_sem, K_FOREVER);
+	k_object_access_revoke(&kobject_cached_sem, &child_thread);
+	k_sem_give(&kobject_cached_sync);
+
+	k_thread_join(&child_thread, K_FOREVER);
+
+	zassert_false(cached_sem_used, "semaphore used after its access was revoked");
+	zassert_false(valid_fault, "no fault after revoking access");
+}
+
 /****************************************************************************/
 /* grant access to all user threads that follow */
 static void kobject_grant_access_child_entry(void *p1, void *p2, void *p3)
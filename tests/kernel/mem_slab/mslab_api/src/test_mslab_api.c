@@ -338,3 +338,49 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, &b);
 }
+
+/**
+ * @brief Verify bulk allocation and free of blocks
+ *
+ * @details Allocate more blocks than the slab holds in one call and
+ * check only the available ones are returned, that an empty slab
+ * fails or times out like a single allocation, and that a bulk free
+ * returns all blocks.
+ *
+ * @ingroup kernel_memory_slab_tests
+ *
+ * @see k_mem_slab_alloc_bulk(), k_mem_slab_free_bulk()
+ */
+ZTEST(mslab_api, test_mslab_bulk)
+{
+	void *block[BLK_NUM + 1];
+	void *extra;
+
+	k_mem_slab_init(&mslab, tslab, BLK_SIZE, BLK_NUM);
+
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, block, 0, K_NO_WAIT), 0);
+
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, block, BLK_NUM + 1, K_NO_WAIT),
+		      BLK_NUM);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), BLK_NUM);
+	for (int i = 0; i < BLK_NUM; i++) {
+		zassert_not_null(block[i], "block %d not allocated", i);
+		for (int j = 0; j < i; j++) {
+			zassert_not_equal(block[i], block[j], "block handed out twice");
+		}
+	}
+
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, &extra, 1, K_NO_WAIT), -ENOMEM);
+	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
+		zassert_equal(k_mem_slab_alloc_bulk(&mslab, &extra, 1, K_MSEC(10)),
+			      -EAGAIN);
+	}
+
+	k_mem_slab_free_bulk(&mslab, block, BLK_NUM);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+
+	zassert_equal(k_mem_slab_alloc_bulk(&mslab, block, 2, K_NO_WAIT), 2);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), BLK_NUM - 2);
+	k_mem_slab_free_bulk(&mslab, block, 2);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), BLK_NUM);
+}
@@ -71,10 +71,11 @@ static void tmslab_api(void *p1, void *p2, void *p3)
  *
  * @ingroup kernel_memory_slab_tests
  */
-ZTEST(mslab_threadsafe, test_mslab_threadsafe)
+static void run_threads(void)
 {
 	k_tid_t tid[THREAD_NUM];
 
+	atomic_clear(&slab_id);
 	k_mem_slab_init(&mslab2, tslab, BLK_SIZE2, SLAB_BLOCKS);
 
 	/* create multiple threads to invoke same memory slab APIs*/
@@ -90,5 +91,47 @@ ZTEST(mslab_threadsafe, test_mslab_threadsafe)
 
 		zassert_false(ret, "k_thread_join() failed");
 		zassert_true(success[i], "thread %d failed", i);
+		success[i] = false;
+	}
+
+	for (int i = 0; i < SLAB_NUM; i++) {
+		zassert_equal(k_mem_slab_num_used_get(slabs[i]), 0,
+			      "slab %d leaked blocks", i);
 	}
 }
+
+ZTEST(mslab_threadsafe, test_mslab_threadsafe)
+{
+	run_threads();
+}
+
+static void isr_alloc_free(struct k_timer *timer)
+{
+	void *block;
+
+	ARG_UNUSED(timer);
+
+	for (int i = 0; i < SLAB_NUM; i++) {
+		if (k_mem_slab_alloc(slabs[i], &block, K_NO_WAIT) == 0) {
+			k_mem_slab_free(slabs[i], &block);
+		}
+	}
+}
+
+K_TIMER_DEFINE(isr_timer, isr_alloc_free, NULL);
+
+/**
+ * @brief Verify alloc and free from threads interleaved with an ISR
+ *
+ * @details Same as test_mslab_threadsafe(), with a timer ISR taking
+ * and returning blocks in the middle of the threads' allocations and
+ * frees, including while some of them are waiting for a block.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_threadsafe, test_mslab_threadsafe_isr)
+{
+	k_timer_start(&isr_timer, K_MSEC(1), K_MSEC(1));
+	run_threads();
+	k_timer_stop(&isr_timer);
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#ifdef CONFIG_MSGQ_ZERO_COPY
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+static struct k_msgq cmsgq;
+static char __aligned(4) cbuffer[MSG_SIZE * MSGQ_LEN];
+
+static void put_claimed(struct k_msgq *q, uint32_t msg)
+{
+	void *slot;
+
+	zassert_equal(k_msgq_put_claim(q, &slot, K_NO_WAIT), 0);
+	zassert_true((char *)slot >= cbuffer && (char *)slot < cbuffer + sizeof(cbuffer),
+		     "slot outside the message buffer");
+	*(uint32_t *)slot = msg;
+	zassert_equal(k_msgq_put_commit(q), 0);
+}
+
+static uint32_t get_claimed(struct k_msgq *q)
+{
+	uint32_t msg;
+	void *slot;
+
+	zassert_equal(k_msgq_get_claim(q, &slot, K_NO_WAIT), 0);
+	msg = *(uint32_t *)slot;
+	zassert_equal(k_msgq_get_finish(q), 0);
+
+	return msg;
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test claiming slots and messages in place
+ * @see k_msgq_put_claim(), k_msgq_put_commit(), k_msgq_get_claim(),
+ * k_msgq_get_finish()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim)
+{
+	uint32_t msg = MSG1;
+	void *slot;
+
+	k_msgq_init(&cmsgq, cbuffer, MSG_SIZE, MSGQ_LEN);
+
+	zassert_equal(k_msgq_put_commit(&cmsgq), -EINVAL, "commit without claim");
+	zassert_equal(k_msgq_get_finish(&cmsgq), -EINVAL, "finish without claim");
+	zassert_equal(k_msgq_get_claim(&cmsgq, &slot, K_NO_WAIT), -ENOMSG);
+
+	/* Claimed and copied messages keep their order */
+	put_claimed(&cmsgq, MSG0);
+	zassert_equal(k_msgq_put(&cmsgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_num_free_get(&cmsgq), 0);
+	zassert_equal(k_msgq_put_claim(&cmsgq, &slot, K_NO_WAIT), -ENOMSG);
+	zassert_equal(get_claimed(&cmsgq), MSG0);
+	zassert_equal(get_claimed(&cmsgq), MSG1);
+
+	/* A claimed slot is not free, and holds other writers off */
+	zassert_equal(k_msgq_put_claim(&cmsgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_num_free_get(&cmsgq), MSGQ_LEN - 1);
+	zassert_equal(k_msgq_num_used_get(&cmsgq), 0);
+	zassert_equal(k_msgq_put(&cmsgq, &msg, K_NO_WAIT), -ENOMSG);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_put_commit(&cmsgq), 0);
+
+	/* A claimed message holds other readers off */
+	zassert_equal(k_msgq_put(&cmsgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_claim(&cmsgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_get(&cmsgq, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_finish(&cmsgq), 0);
+	zassert_equal(k_msgq_get(&cmsgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(msg, MSG1);
+}
+
+static void claim_reader(void *p1, void *p2, void *p3)
+{
+	void *slot;
+
+	zassert_equal(k_msgq_get_claim(&cmsgq, &slot, TIMEOUT), 0);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_get_finish(&cmsgq), 0);
+}
+
+static void claim_writer(void *p1, void *p2, void *p3)
+{
+	void *slot;
+
+	zassert_equal(k_msgq_put_claim(&cmsgq, &slot, TIMEOUT), 0);
+	*(uint32_t *)slot = MSG1;
+	zassert_equal(k_msgq_put_commit(&cmsgq), 0);
+}
+
+static void run_thread(k_thread_entry_t entry)
+{
+	k_thread_create(&tdata, tstack, STACK_SIZE, entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	/* Let it block */
+	k_msleep(TIMEOUT_MS >> 2);
+}
+
+/**
+ * @brief Test waiting for a slot or a message to claim
+ * @see k_msgq_put_claim(), k_msgq_get_claim()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim_wait)
+{
+	uint32_t msg = MSG0;
+	void *slot;
+
+	k_msgq_init(&cmsgq, cbuffer, MSG_SIZE, MSGQ_LEN);
+
+	/* A waiting reader is handed the next message, copied or not */
+	run_thread(claim_reader);
+	zassert_equal(k_msgq_put(&cmsgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(k_thread_join(&tdata, K_FOREVER), 0);
+	zassert_equal(k_msgq_num_used_get(&cmsgq), 0);
+
+	run_thread(claim_reader);
+	put_claimed(&cmsgq, MSG0);
+	zassert_equal(k_thread_join(&tdata, K_FOREVER), 0);
+
+	/* A waiting writer is handed the next free slot */
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(&cmsgq, &msg, K_NO_WAIT), 0);
+	}
+	run_thread(claim_writer);
+	zassert_equal(get_claimed(&cmsgq), MSG0);
+	zassert_equal(k_thread_join(&tdata, K_FOREVER), 0);
+	zassert_equal(get_claimed(&cmsgq), MSG0);
+	zassert_equal(get_claimed(&cmsgq), MSG1);
+
+	/* and writers wait for the slot claimed by another one */
+	zassert_equal(k_msgq_put_claim(&cmsgq, &slot, K_NO_WAIT), 0);
+	run_thread(claim_writer);
+	*(uint32_t *)slot = MSG0;
+	zassert_equal(k_msgq_put_commit(&cmsgq), 0);
+	zassert_equal(k_thread_join(&tdata, K_FOREVER), 0);
+	zassert_equal(get_claimed(&cmsgq), MSG0);
+	zassert_equal(get_claimed(&cmsgq), MSG1);
+
+	/* Timeouts */
+	zassert_equal(k_msgq_get_claim(&cmsgq, &slot, TIMEOUT), -EAGAIN);
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(&cmsgq, &msg, K_NO_WAIT), 0);
+	}
+	zassert_equal(k_msgq_put_claim(&cmsgq, &slot, TIMEOUT), -EAGAIN);
+	k_msgq_purge(&cmsgq);
+}
+
+static void claim_isr(const void *param)
+{
+	void **slot = (void **)param;
+
+	zassert_equal(k_msgq_put_claim(&cmsgq, slot, K_NO_WAIT), 0);
+	*(uint32_t *)*slot = MSG1;
+	zassert_equal(k_msgq_put_commit(&cmsgq), 0);
+}
+
+/**
+ * @brief Test claiming from an ISR
+ * @see k_msgq_put_claim()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim_isr)
+{
+	void *slot;
+
+	k_msgq_init(&cmsgq, cbuffer, MSG_SIZE, MSGQ_LEN);
+
+	irq_offload(claim_isr, &slot);
+	zassert_equal(get_claimed(&cmsgq), MSG1);
+}
+
+/**
+ * @brief Test purging while a message is claimed for reading
+ * @see k_msgq_purge(), k_msgq_get_claim()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim_purge)
+{
+	uint32_t msg = MSG0;
+	void *slot;
+
+	k_msgq_init(&cmsgq, cbuffer, MSG_SIZE, MSGQ_LEN);
+
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(&cmsgq, &msg, K_NO_WAIT), 0);
+	}
+	zassert_equal(k_msgq_get_claim(&cmsgq, &slot, K_NO_WAIT), 0);
+	k_msgq_purge(&cmsgq);
+
+	/* The claimed message survives, the others are gone but their
+	 * slots are only released with it
+	 */
+	zassert_equal(k_msgq_num_used_get(&cmsgq), 1);
+	zassert_equal(k_msgq_num_free_get(&cmsgq), 0);
+	zassert_equal(k_msgq_peek_at(&cmsgq, &msg, 1), -ENOMSG);
+	zassert_equal(*(uint32_t *)slot, MSG0);
+	zassert_equal(k_msgq_get_finish(&cmsgq), 0);
+	zassert_equal(k_msgq_num_used_get(&cmsgq), 0);
+	zassert_equal(k_msgq_num_free_get(&cmsgq), MSGQ_LEN);
+
+	/* and their slots are reused in order */
+	put_claimed(&cmsgq, MSG1);
+	zassert_equal(k_msgq_get(&cmsgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(msg, MSG1);
+}
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Test polling while a message is claimed for reading
+ * @see k_msgq_get_claim(), k_poll()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_MSGQ_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &cmsgq);
+	uint32_t msg = MSG0;
+	void *slot;
+
+	k_msgq_init(&cmsgq, cbuffer, MSG_SIZE, MSGQ_LEN);
+
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(&cmsgq, &msg, K_NO_WAIT), 0);
+	}
+	zassert_equal(k_msgq_get_claim(&cmsgq, &slot, K_NO_WAIT), 0);
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN,
+		      "message reported while the queue is claimed");
+
+	zassert_equal(k_msgq_get_finish(&cmsgq), 0);
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), 0);
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	k_msgq_purge(&cmsgq);
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_MSGQ_ZERO_COPY */
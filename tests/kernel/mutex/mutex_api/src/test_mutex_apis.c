@@ -449,6 +449,121 @@ ZTEST(mutex_api_1cpu, test_mutex_timeout_race_during_priority_inversion)
 	k_mutex_unlock(&mutex);
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+enum spin_owner_mode {
+	/* Release the mutex half the spin bound after the test locks it */
+	SPIN_OWNER_RELEASE,
+	/* Keep the mutex, running, until spin_done is set */
+	SPIN_OWNER_RUN,
+	/* Keep the mutex, pending on spin_sem */
+	SPIN_OWNER_PEND,
+};
+
+static struct k_mutex spin_mutex;
+static K_SEM_DEFINE(spin_sem, 0, 1);
+static atomic_t spin_locked;
+static atomic_t spin_go;
+static atomic_t spin_done;
+
+static void tThread_spin_owner(void *p1, void *p2, void *p3)
+{
+	enum spin_owner_mode mode = POINTER_TO_INT(p1);
+	uint32_t start;
+
+	zassert_ok(k_mutex_lock(&spin_mutex, K_NO_WAIT));
+	atomic_set(&spin_locked, 1);
+
+	switch (mode) {
+	case SPIN_OWNER_RELEASE:
+		while (!atomic_get(&spin_go)) {
+		}
+		start = k_cycle_get_32();
+		while ((k_cycle_get_32() - start) < CONFIG_MUTEX_ADAPTIVE_SPIN_CYCLES / 2) {
+		}
+		break;
+	case SPIN_OWNER_RUN:
+		while (!atomic_get(&spin_done)) {
+		}
+		break;
+	case SPIN_OWNER_PEND:
+		k_sem_take(&spin_sem, K_FOREVER);
+		break;
+	}
+
+	k_mutex_unlock(&spin_mutex);
+}
+
+/* Starts an owner, which runs on another CPU while the caller spins */
+static void spin_owner_start(enum spin_owner_mode mode)
+{
+	k_mutex_init(&spin_mutex);
+	atomic_clear(&spin_locked);
+	atomic_clear(&spin_go);
+	atomic_clear(&spin_done);
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, tThread_spin_owner,
+			INT_TO_POINTER(mode), NULL, NULL,
+			K_PRIO_PREEMPT(THREAD_LOW_PRIORITY), 0, K_NO_WAIT);
+
+	while (!atomic_get(&spin_locked)) {
+	}
+}
+
+/**
+ * @brief Test adaptive spinning on a contended mutex
+ *
+ * @details A lock spins and acquires the mutex when its owner, running
+ * on another CPU, releases it within the spin bound. A lock that does
+ * not wait, or whose owner is not running, does not spin.
+ *
+ * @ingroup kernel_mutex_tests
+ *
+ * @see k_mutex_spin_stats_get()
+ */
+ZTEST(mutex_api, test_mutex_adaptive_spin)
+{
+	struct k_mutex_spin_stats before, after;
+
+	/* Owner running on another CPU, releasing within the bound */
+	spin_owner_start(SPIN_OWNER_RELEASE);
+	k_mutex_spin_stats_get(&before);
+	atomic_set(&spin_go, 1);
+	zassert_ok(k_mutex_lock(&spin_mutex, K_FOREVER));
+	k_mutex_spin_stats_get(&after);
+	k_mutex_unlock(&spin_mutex);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(after.spins, before.spins + 1, "lock did not spin");
+	zassert_equal(after.acquired, before.acquired + 1,
+		      "spin did not acquire the mutex");
+
+	/* Owner running, lock not waiting */
+	spin_owner_start(SPIN_OWNER_RUN);
+	k_mutex_spin_stats_get(&before);
+	zassert_equal(k_mutex_lock(&spin_mutex, K_NO_WAIT), -EBUSY);
+	k_mutex_spin_stats_get(&after);
+	atomic_set(&spin_done, 1);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(after.spins, before.spins, "K_NO_WAIT lock spun");
+	zassert_equal(after.acquired, before.acquired);
+
+	/* Owner not running */
+	spin_owner_start(SPIN_OWNER_PEND);
+	while ((tdata.base.thread_state & _THREAD_PENDING) == 0U) {
+		k_busy_wait(100);
+	}
+	k_mutex_spin_stats_get(&before);
+	zassert_equal(k_mutex_lock(&spin_mutex, K_MSEC(10)), -EAGAIN);
+	k_mutex_spin_stats_get(&after);
+	k_sem_give(&spin_sem);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(after.spins, before.spins, "spun on a pending owner");
+	zassert_equal(after.acquired, before.acquired);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 static void *mutex_api_tests_setup(void)
 {
 #ifdef CONFIG_USERSPACE
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define VPIPE_LEN	8
+#define TIMEOUT_MS	100
+
+static K_THREAD_STACK_DEFINE(vstack, STACK_SIZE);
+static struct k_thread vdata;
+
+K_PIPE_DEFINE(vpipe, VPIPE_LEN, 4);
+K_PIPE_DEFINE(vpipe_nobuf, 0, 4);
+
+static const char stream[] = "0123456789abcdef";
+
+static unsigned char hdr[3], body[6], tail[7];
+
+static const struct k_pipe_iovec out_iov[] = {
+	{ (void *)&stream[0], 3 },
+	{ NULL, 0 },
+	{ (void *)&stream[3], 6 },
+	{ (void *)&stream[9], 7 },
+};
+
+static const struct k_pipe_iovec in_iov[] = {
+	{ hdr, sizeof(hdr) },
+	{ body, sizeof(body) },
+	{ NULL, 0 },
+	{ tail, sizeof(tail) },
+};
+
+static void check_scattered(void)
+{
+	zassert_mem_equal(hdr, &stream[0], sizeof(hdr));
+	zassert_mem_equal(body, &stream[3], sizeof(body));
+	zassert_mem_equal(tail, &stream[9], sizeof(tail));
+}
+
+static void clear_scattered(void)
+{
+	(void)memset(hdr, 0, sizeof(hdr));
+	(void)memset(body, 0, sizeof(body));
+	(void)memset(tail, 0, sizeof(tail));
+}
+
+static void vreader(void *p1, void *p2, void *p3)
+{
+	struct k_pipe *p = p1;
+	size_t read;
+
+	zassert_equal(k_pipe_getv(p, in_iov, ARRAY_SIZE(in_iov), &read,
+				  sizeof(stream) - 1, K_FOREVER), 0);
+	zassert_equal(read, sizeof(stream) - 1);
+}
+
+static void vwriter(void *p1, void *p2, void *p3)
+{
+	struct k_pipe *p = p1;
+	size_t written;
+
+	zassert_equal(k_pipe_putv(p, out_iov, ARRAY_SIZE(out_iov), &written,
+				  sizeof(stream) - 1, K_FOREVER), 0);
+	zassert_equal(written, sizeof(stream) - 1);
+}
+
+static void run_thread(k_thread_entry_t entry, struct k_pipe *p)
+{
+	k_thread_create(&vdata, vstack, STACK_SIZE, entry, p, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	/* Let it block */
+	k_msleep(TIMEOUT_MS);
+}
+
+/**
+ * @addtogroup kernel_pipe_tests
+ * @{
+ */
+
+/**
+ * @brief Test vectored transfers through the pipe buffer
+ *
+ * Segments are written and read across the wrap-around of the ring
+ * buffer, and segment boundaries need not match on both sides.
+ *
+ * @see k_pipe_putv(), k_pipe_getv()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_iovec_buffer)
+{
+	unsigned char buf[VPIPE_LEN];
+	unsigned char a[5], b[3];
+	struct k_pipe_iovec rd[] = { { a, sizeof(a) }, { b, sizeof(b) } };
+	size_t written, read;
+
+	/* Move the indices to the middle of the buffer */
+	zassert_equal(k_pipe_put(&vpipe, (void *)stream, 5, &written, 5,
+				 K_NO_WAIT), 0);
+	zassert_equal(k_pipe_get(&vpipe, buf, 5, &read, 5, K_NO_WAIT), 0);
+
+	/* Only what fits is written */
+	zassert_equal(k_pipe_putv(&vpipe, out_iov, ARRAY_SIZE(out_iov),
+				  &written, 1, K_NO_WAIT), 0);
+	zassert_equal(written, VPIPE_LEN);
+	zassert_equal(k_pipe_read_avail(&vpipe), VPIPE_LEN);
+
+	zassert_equal(k_pipe_getv(&vpipe, rd, ARRAY_SIZE(rd), &read,
+				  VPIPE_LEN, K_NO_WAIT), 0);
+	zassert_equal(read, VPIPE_LEN);
+	zassert_mem_equal(a, &stream[0], sizeof(a));
+	zassert_mem_equal(b, &stream[5], sizeof(b));
+
+	/* Not enough room or data for the minimum */
+	zassert_equal(k_pipe_putv(&vpipe, out_iov, ARRAY_SIZE(out_iov), &written,
+				  VPIPE_LEN + 1, K_NO_WAIT), -EIO);
+	zassert_equal(written, 0);
+	zassert_equal(k_pipe_getv(&vpipe, rd, ARRAY_SIZE(rd), &read, 1,
+				  K_NO_WAIT), -EIO);
+
+	zassert_equal(k_pipe_putv(&vpipe, out_iov, ARRAY_SIZE(out_iov),
+				  &written, sizeof(stream), K_NO_WAIT), -EINVAL);
+	zassert_equal(k_pipe_getv(&vpipe, NULL, 1, &read, 0, K_NO_WAIT),
+		      -EINVAL);
+}
+
+/**
+ * @brief Test vectored transfers to and from waiting threads
+ *
+ * @see k_pipe_putv(), k_pipe_getv()
+ */
+ZTEST(pipe_api_1cpu, test_pipe_iovec_waiters)
+{
+	unsigned char buf[sizeof(stream) - 1];
+	size_t written, read;
+
+	/* Directly into the segments of a waiting reader */
+	clear_scattered();
+	run_thread(vreader, &vpipe_nobuf);
+	zassert_equal(k_pipe_putv(&vpipe_nobuf, out_iov, ARRAY_SIZE(out_iov),
+				  &written, sizeof(stream) - 1, K_NO_WAIT), 0);
+	zassert_equal(k_thread_join(&vdata, K_FOREVER), 0);
+	check_scattered();
+
+	/* Directly out of the segments of a waiting writer */
+	run_thread(vwriter, &vpipe_nobuf);
+	zassert_equal(k_pipe_get(&vpipe_nobuf, buf, sizeof(buf), &read,
+				 sizeof(buf), K_NO_WAIT), 0);
+	zassert_equal(k_thread_join(&vdata, K_FOREVER), 0);
+	zassert_mem_equal(buf, stream, sizeof(buf));
+
+	/* A waiting writer partly through the buffer, partly directly */
+	clear_scattered();
+	run_thread(vwriter, &vpipe);
+	zassert_equal(k_pipe_read_avail(&vpipe), VPIPE_LEN);
+	zassert_equal(k_pipe_getv(&vpipe, in_iov, ARRAY_SIZE(in_iov), &read,
+				  sizeof(stream) - 1, K_NO_WAIT), 0);
+	zassert_equal(k_thread_join(&vdata, K_FOREVER), 0);
+	check_scattered();
+	zassert_equal(k_pipe_read_avail(&vpipe), 0);
+}
+
+/**
+ * @}
+ */
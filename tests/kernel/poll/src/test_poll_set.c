@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define NUM_SEMS 8
+
+static struct k_poll_set set;
+static struct k_sem sems[NUM_SEMS];
+static struct k_poll_event sem_events[NUM_SEMS];
+static struct k_poll_signal signal;
+static struct k_poll_event signal_event;
+static struct k_fifo fifo;
+static struct k_poll_event fifo_event;
+static struct k_timer timer;
+
+static void poll_set_setup(void)
+{
+	k_poll_set_init(&set);
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_sem_init(&sems[i], 0, 1);
+		k_poll_event_init(&sem_events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+		zassert_ok(k_poll_set_add(&set, &sem_events[i]));
+	}
+}
+
+static void poll_set_teardown(void)
+{
+	for (int i = 0; i < NUM_SEMS; i++) {
+		zassert_ok(k_poll_set_remove(&set, &sem_events[i]));
+	}
+}
+
+/**
+ * @brief Test that a poll set returns the ready events only
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_remove(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ready)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	poll_set_setup();
+
+	zassert_equal(k_poll_set_add(&set, &sem_events[0]), -EBUSY);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&sems[3]);
+	k_sem_give(&sems[5]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 2);
+	zassert_equal_ptr(ready[0], &sem_events[3]);
+	zassert_equal_ptr(ready[1], &sem_events[5]);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* Returned again until taken, in turn when there is no room for all */
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[3]);
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[5]);
+
+	zassert_ok(k_sem_take(&sems[3], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[5]);
+
+	/* Still registered once taken */
+	zassert_ok(k_sem_take(&sems[5], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), -EAGAIN);
+	k_sem_give(&sems[5]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[5]);
+
+	/* Not returned once removed, ready or not */
+	zassert_ok(k_poll_set_remove(&set, &sem_events[5]));
+	zassert_equal(k_poll_set_remove(&set, &sem_events[5]), -EINVAL);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), -EAGAIN);
+	zassert_ok(k_poll_set_add(&set, &sem_events[5]));
+	zassert_ok(k_sem_take(&sems[5], K_NO_WAIT));
+
+	/* Added while its object is ready */
+	k_sem_give(&sems[0]);
+	zassert_ok(k_poll_set_remove(&set, &sem_events[0]));
+	zassert_ok(k_poll_set_add(&set, &sem_events[0]));
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &sem_events[0]);
+	zassert_ok(k_sem_take(&sems[0], K_NO_WAIT));
+
+	poll_set_teardown();
+}
+
+static void timer_raise(struct k_timer *t)
+{
+	k_poll_signal_raise(&signal, 1);
+}
+
+/**
+ * @brief Test waiting on a poll set for an event raised from an ISR
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait(), k_poll_signal_raise()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[2];
+
+	poll_set_setup();
+
+	k_poll_signal_init(&signal);
+	k_poll_event_init(&signal_event, K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &signal);
+	zassert_ok(k_poll_set_add(&set, &signal_event));
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(10)),
+		      -EAGAIN);
+
+	k_timer_init(&timer, timer_raise, NULL);
+	k_timer_start(&timer, K_MSEC(10), K_NO_WAIT);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_FOREVER), 1);
+	zassert_equal_ptr(ready[0], &signal_event);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+
+	k_poll_signal_reset(&signal);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	zassert_ok(k_poll_set_remove(&set, &signal_event));
+	poll_set_teardown();
+}
+
+/**
+ * @brief Test that a cancelled wait on a FIFO is returned once
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait(), k_fifo_cancel_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_cancel)
+{
+	struct k_poll_event *ready[1];
+
+	k_poll_set_init(&set);
+	k_fifo_init(&fifo);
+	k_poll_event_init(&fifo_event, K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &fifo);
+	zassert_ok(k_poll_set_add(&set, &fifo_event));
+
+	k_fifo_cancel_wait(&fifo);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 1);
+	zassert_equal(ready[0]->state, K_POLL_STATE_CANCELLED);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	zassert_ok(k_poll_set_remove(&set, &fifo_event));
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_READERS 3
+
+#define PRIO_MAIN   K_PRIO_PREEMPT(5)
+#define PRIO_HELPER K_PRIO_PREEMPT(1)
+
+K_THREAD_STACK_ARRAY_DEFINE(helper_stacks, NUM_READERS, STACK_SIZE);
+static struct k_thread helper_threads[NUM_READERS];
+
+K_RWLOCK_DEFINE(static_rwlock);
+static struct k_rwlock rwlock;
+
+static ZTEST_BMEM int readers_in;
+static ZTEST_BMEM int max_readers_in;
+static ZTEST_BMEM int helper_ret;
+static ZTEST_BMEM bool writer_done;
+
+/* p1 is the timeout in milliseconds, or -1 to wait forever */
+static void reader(void *p1, void *p2, void *p3)
+{
+	int ms = POINTER_TO_INT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	helper_ret = k_rwlock_read_lock(&rwlock, (ms < 0) ? K_FOREVER : K_MSEC(ms));
+	if (helper_ret != 0) {
+		return;
+	}
+
+	readers_in++;
+	max_readers_in = MAX(max_readers_in, readers_in);
+	k_msleep(10);
+	readers_in--;
+
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+}
+
+static void writer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	helper_ret = k_rwlock_write_lock(&rwlock, K_FOREVER);
+	zassert_equal(helper_ret, 0);
+	zassert_equal(readers_in, 0, "writer in with readers");
+	writer_done = true;
+	zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+}
+
+static k_tid_t spawn(int i, k_thread_entry_t entry, void *arg, int prio)
+{
+	return k_thread_create(&helper_threads[i], helper_stacks[i], STACK_SIZE,
+			       entry, arg, NULL, NULL, prio, 0, K_NO_WAIT);
+}
+
+/**
+ * @brief Test uncontended locking and error returns
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_uncontended)
+{
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EINVAL);
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EPERM);
+
+	/* Readers share */
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EPERM);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EINVAL);
+
+	/* Writers exclude */
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EINVAL);
+	zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+
+	/* Statically defined lock starts out free */
+	zassert_equal(k_rwlock_write_lock(&static_rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_write_unlock(&static_rwlock), 0);
+}
+
+/**
+ * @brief Test that a waiting writer blocks new readers
+ *
+ * @details Hold the lock for reading while a writer waits, check that
+ * new readers are turned away, and that the writer gets the lock when
+ * the last reader leaves.
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_writer_preference)
+{
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+	readers_in = 1;
+
+	spawn(0, writer, NULL, PRIO_HELPER);
+	zassert_false(writer_done, "writer got in with a reader");
+
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY,
+		      "reader got past a waiting writer");
+
+	readers_in = 0;
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+	zassert_true(writer_done, "writer not handed the lock");
+
+	k_thread_join(&helper_threads[0], K_FOREVER);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+}
+
+/**
+ * @brief Test that a write unlock admits all waiting readers together
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_readers_together)
+{
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), 0);
+
+	for (int i = 0; i < NUM_READERS; i++) {
+		spawn(i, reader, INT_TO_POINTER(-1), PRIO_HELPER);
+	}
+	zassert_equal(readers_in, 0, "reader got in with a writer");
+
+	zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_join(&helper_threads[i], K_FOREVER);
+	}
+
+	zassert_equal(max_readers_in, NUM_READERS, "readers were serialized");
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+}
+
+/**
+ * @brief Test that timed out waiters leave the lock consistent
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_timeout)
+{
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), 0);
+
+	spawn(0, reader, INT_TO_POINTER(20), PRIO_HELPER);
+	k_thread_join(&helper_threads[0], K_FOREVER);
+	zassert_equal(helper_ret, -EAGAIN, "reader did not time out");
+
+	/* No waiters left: everything is uncontended again */
+	zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_read_unlock(&rwlock), 0);
+}
+
+/**
+ * @brief Test priority inheritance from a waiting writer
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_priority_inheritance)
+{
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), 0);
+
+	spawn(0, writer, NULL, PRIO_HELPER);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_HELPER,
+		      "writer holding the lock not boosted");
+
+	zassert_equal(k_rwlock_write_unlock(&rwlock), 0);
+	zassert_equal(k_thread_priority_get(k_current_get()), PRIO_MAIN,
+		      "priority not restored");
+	zassert_true(writer_done);
+	k_thread_join(&helper_threads[0], K_FOREVER);
+}
+
+static void user_rwlock(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_equal(k_rwlock_read_lock(&static_rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_write_lock(&static_rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_read_unlock(&static_rwlock), 0);
+	zassert_equal(k_rwlock_write_lock(&static_rwlock, K_NO_WAIT), 0);
+	zassert_equal(k_rwlock_write_unlock(&static_rwlock), 0);
+}
+
+/**
+ * @brief Test the reader-writer lock from a user mode thread
+ *
+ * @ingroup kernel_rwlock_tests
+ */
+ZTEST(rwlock_api, test_rwlock_user)
+{
+	k_thread_create(&helper_threads[0], helper_stacks[0], STACK_SIZE,
+			user_rwlock, NULL, NULL, NULL, PRIO_HELPER,
+			K_USER | K_INHERIT_PERMS, K_FOREVER);
+	k_object_access_grant(&static_rwlock, &helper_threads[0]);
+	k_thread_start(&helper_threads[0]);
+	k_thread_join(&helper_threads[0], K_FOREVER);
+}
+
+static void rwlock_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_thread_priority_set(k_current_get(), PRIO_MAIN);
+	k_rwlock_init(&rwlock);
+	readers_in = 0;
+	max_readers_in = 0;
+	helper_ret = 1;
+	writer_done = false;
+}
+
+ZTEST_SUITE(rwlock_api, NULL, NULL, rwlock_before, NULL, NULL);
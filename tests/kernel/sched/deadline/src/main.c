@@ -213,4 +213,150 @@ ZTEST(suite_deadline, test_unqueued)
 	}
 }
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+static volatile uint32_t spin_count;
+
+static void spin_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		spin_count++;
+		k_busy_wait(100);
+	}
+}
+
+/**
+ * @brief Validate admission control of k_thread_cbs_set()
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_cbs_admission)
+{
+	uint32_t period = sys_clock_hw_cycles_per_sec() / 10;
+	uint32_t max = (uint32_t)(((uint64_t)period *
+				   CONFIG_SCHED_DEADLINE_CBS_MAX_UTILIZATION) / 100);
+
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], period + 1, period),
+		      -EINVAL, "budget larger than period accepted");
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], 1, 0),
+		      -EINVAL, "zero period accepted");
+
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], max / 2, period), 0,
+		      "first reservation rejected");
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], max, period), -EBUSY,
+		      "over-subscription admitted");
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], max / 4, period), 0,
+		      "reservation within bound rejected");
+
+	/* Releasing a reservation makes room again */
+	zassert_equal(k_thread_cbs_set(&worker_threads[0], 0, 0), 0, "");
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], max / 2, period), 0,
+		      "resizing a reservation rejected");
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], 0, 0), 0, "");
+}
+
+/**
+ * @brief Validate that an overrunning thread is throttled
+ *
+ * @details Give a thread that never blocks a 20% reservation and check
+ * that it is throttled every period, leaving the rest of the CPU to a
+ * lower priority thread, and that its missed deadlines are counted.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_cbs_throttle)
+{
+	uint32_t period = sys_clock_hw_cycles_per_sec() / 10;
+	k_thread_runtime_stats_t stats;
+	uint32_t spins;
+
+	spin_count = 0;
+	n_exec = 0;
+
+	worker_tids[0] = k_thread_create(&worker_threads[0], worker_stacks[0],
+					 STACK_SIZE, spin_worker, NULL, NULL, NULL,
+					 K_HIGHEST_APPLICATION_THREAD_PRIO, 0,
+					 K_FOREVER);
+	zassert_equal(k_thread_cbs_set(worker_tids[0], period / 5, period), 0, "");
+
+	/* The low priority worker can only run while the spinner is throttled */
+	worker_tids[1] = k_thread_create(&worker_threads[1], worker_stacks[1],
+					 STACK_SIZE, worker, INT_TO_POINTER(1),
+					 NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO,
+					 0, K_NO_WAIT);
+	k_thread_start(worker_tids[0]);
+
+	k_sleep(K_MSEC(550));
+
+	spins = spin_count;
+	k_thread_runtime_stats_get(worker_tids[0], &stats);
+	k_thread_abort(worker_tids[0]);
+	k_thread_abort(worker_tids[1]);
+
+	zassert_true(spins > 0, "reserved thread never ran");
+	zassert_equal(n_exec, 1, "throttled thread starved lower priority");
+	zassert_true(stats.budget_overruns >= 4, "only %u overruns",
+		     stats.budget_overruns);
+	zassert_true(stats.deadline_misses >= 4, "only %u deadline misses",
+		     stats.deadline_misses);
+}
+
+/**
+ * @brief Validate that a reused thread struct starts without a server
+ *
+ * @details Abort a thread which had a reservation and overran it, fill
+ * its server with garbage as left by non-zeroed memory, and create a new
+ * thread in the same struct. The new thread must have no reservation,
+ * no statistics and must not be accounted for by admission control.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_cbs_reuse)
+{
+	uint32_t period = sys_clock_hw_cycles_per_sec() / 10;
+	uint32_t max = (uint32_t)(((uint64_t)period *
+				   CONFIG_SCHED_DEADLINE_CBS_MAX_UTILIZATION) / 100);
+	k_thread_runtime_stats_t stats;
+
+	worker_tids[0] = k_thread_create(&worker_threads[0], worker_stacks[0],
+					 STACK_SIZE, spin_worker, NULL, NULL, NULL,
+					 K_HIGHEST_APPLICATION_THREAD_PRIO, 0,
+					 K_FOREVER);
+	zassert_equal(k_thread_cbs_set(worker_tids[0], period / 5, period), 0, "");
+	k_thread_start(worker_tids[0]);
+	k_sleep(K_MSEC(250));
+	k_thread_abort(worker_tids[0]);
+
+	(void)memset(&worker_threads[0].base.cbs, 0xa5,
+		     sizeof(worker_threads[0].base.cbs));
+
+	n_exec = 0;
+	worker_tids[0] = k_thread_create(&worker_threads[0], worker_stacks[0],
+					 STACK_SIZE, worker, INT_TO_POINTER(0),
+					 NULL, NULL, K_HIGHEST_APPLICATION_THREAD_PRIO,
+					 0, K_FOREVER);
+
+	k_thread_runtime_stats_get(worker_tids[0], &stats);
+	zassert_equal(stats.deadline_misses, 0, "stale deadline misses");
+	zassert_equal(stats.budget_overruns, 0, "stale budget overruns");
+
+	/* Not throttled, it runs as soon as it is started */
+	k_thread_start(worker_tids[0]);
+	k_sleep(K_MSEC(10));
+	zassert_equal(n_exec, 1, "reused thread did not run");
+
+	/* Neither it nor its abort is accounted for by admission control */
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], max, period), 0,
+		      "stale reservation accounted for");
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], 0, 0), 0, "");
+	k_thread_abort(worker_tids[0]);
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], max, period), 0,
+		      "utilization corrupted by the abort");
+	zassert_equal(k_thread_cbs_set(&worker_threads[1], 0, 0), 0, "");
+}
+#endif
+
 ZTEST_SUITE(suite_deadline, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/sys/seqlock.h>
+
+#define TEST_DURATION_MS 200
+
+static SYS_SEQLOCK_DEFINE(seqlock);
+
+/* Writers keep both halves equal, readers check they never see them differ */
+static struct {
+	uint32_t a;
+	uint32_t b;
+} shared;
+
+static void write_shared(void)
+{
+	k_spinlock_key_t key = sys_seqlock_write_lock(&seqlock);
+
+	shared.a++;
+	shared.b = shared.a;
+
+	sys_seqlock_write_unlock(&seqlock, key);
+}
+
+static void offload_writer(const void *param)
+{
+	ARG_UNUSED(param);
+
+	write_shared();
+}
+
+static void timer_writer(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	write_shared();
+}
+
+K_TIMER_DEFINE(writer_timer, timer_writer, NULL);
+
+/**
+ * @brief Tests for sequence locks
+ *
+ * @defgroup kernel_seqlock_tests Sequence Lock Tests
+ *
+ * @ingroup all_tests
+ *
+ * @{
+ * @}
+ */
+
+/**
+ * @brief Test that only an intervening write forces a retry
+ *
+ * @ingroup kernel_seqlock_tests
+ *
+ * @see sys_seqlock_read_begin(), sys_seqlock_read_retry()
+ */
+ZTEST(seqlock, test_seqlock_retry)
+{
+	uint32_t seq;
+
+	seq = sys_seqlock_read_begin(&seqlock);
+	zassert_equal(seq & 1U, 0, "read section started inside a write");
+	zassert_false(sys_seqlock_read_retry(&seqlock, seq),
+		      "retry without a writer");
+
+	seq = sys_seqlock_read_begin(&seqlock);
+	irq_offload(offload_writer, NULL);
+	zassert_true(sys_seqlock_read_retry(&seqlock, seq),
+		     "no retry after an interrupting writer");
+
+	seq = sys_seqlock_read_begin(&seqlock);
+	zassert_equal(shared.a, shared.b);
+	zassert_false(sys_seqlock_read_retry(&seqlock, seq),
+		      "retry without a writer");
+}
+
+/**
+ * @brief Test that readers never accept a torn snapshot
+ *
+ * @details Update a pair of values from a timer ISR while a thread
+ * repeatedly reads them with a delay between the two loads, so that
+ * writes land in the middle of read sections.
+ *
+ * @ingroup kernel_seqlock_tests
+ *
+ * @see sys_seqlock_write_lock(), sys_seqlock_write_unlock()
+ */
+ZTEST(seqlock, test_seqlock_consistent)
+{
+	int64_t end = k_uptime_get() + TEST_DURATION_MS;
+	unsigned int reads = 0, retries = 0;
+	uint32_t seq, a, b;
+
+	k_timer_start(&writer_timer, K_MSEC(1), K_MSEC(1));
+
+	while (k_uptime_get() < end) {
+		seq = sys_seqlock_read_begin(&seqlock);
+		a = shared.a;
+		k_busy_wait(100);
+		b = shared.b;
+
+		if (sys_seqlock_read_retry(&seqlock, seq)) {
+			retries++;
+			continue;
+		}
+
+		zassert_equal(a, b, "torn read accepted: %u != %u", a, b);
+		reads++;
+	}
+
+	k_timer_stop(&writer_timer);
+
+	zassert_true(reads > 0, "no read ever completed");
+	zassert_true(retries > 0, "writer never raced a reader");
+}
+
+ZTEST_SUITE(seqlock, NULL, NULL, NULL, NULL, NULL);
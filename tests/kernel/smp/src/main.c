@@ -1155,6 +1155,88 @@ ZTEST(smp, test_smp_switch_torture)
 	}
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+#define RUNQ_SPIN_US 20000
+#define RUNQ_YIELDS 100
+
+static volatile int runq_first_cpu[MAX_NUM_THREADS];
+static volatile int runq_migrations[MAX_NUM_THREADS];
+static atomic_t runq_done;
+
+static void runq_thread(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	int cpu = curr_cpu();
+
+	runq_first_cpu[id] = cpu;
+
+	/* Keep the CPU long enough for the others to start */
+	k_busy_wait(RUNQ_SPIN_US);
+
+	/* Alone in the queue of its CPU, a yielding thread stays there */
+	for (int i = 0; i < RUNQ_YIELDS; i++) {
+		k_busy_wait(100);
+		k_yield();
+		if (curr_cpu() != cpu) {
+			runq_migrations[id]++;
+			cpu = curr_cpu();
+		}
+	}
+
+	/* No CPU goes idle, and steals, before all are done yielding */
+	atomic_inc(&runq_done);
+	while (atomic_get(&runq_done) < arch_num_cpus()) {
+	}
+}
+
+/**
+ * @brief Test stealing and affinity with per-CPU run queues
+ *
+ * @details Queue one thread per CPU on the queue of the current CPU. The
+ * other CPUs, idle, must steal them so that each thread runs on its own
+ * CPU. Then each thread yields repeatedly, and must not migrate, since
+ * no other queue holds a better thread.
+ *
+ * @ingroup kernel_smp_tests
+ */
+ZTEST(smp, test_per_cpu_runq_steal)
+{
+	unsigned int num_threads = arch_num_cpus();
+	uint32_t cpus_used = 0;
+
+	atomic_set(&runq_done, 0);
+
+	for (int i = 0; i < num_threads; i++) {
+		runq_first_cpu[i] = -1;
+		runq_migrations[i] = 0;
+		k_thread_create(&tthread[i], tstack[i], STACK_SIZE,
+				runq_thread, INT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		/* Queued on this CPU when started */
+		tthread[i].base.cpu = curr_cpu();
+	}
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_start(&tthread[i]);
+	}
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_join(&tthread[i], K_FOREVER);
+	}
+
+	for (int i = 0; i < num_threads; i++) {
+		zassert_true(runq_first_cpu[i] >= 0, "thread %d did not run", i);
+		cpus_used |= BIT(runq_first_cpu[i]);
+		zassert_equal(runq_migrations[i], 0, "thread %d migrated %d times",
+			      i, runq_migrations[i]);
+	}
+
+	zassert_equal(cpus_used, BIT_MASK(num_threads),
+		      "threads not stolen by the idle CPUs (CPUs used 0x%x)",
+		      cpus_used);
+}
+#endif
+
 static void *smp_tests_setup(void)
 {
 	/* Sleep a bit to guarantee that both CPUs enter an idle
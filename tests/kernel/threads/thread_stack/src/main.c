@@ -503,6 +503,54 @@ ZTEST(userspace_thread_stack, test_idle_stack)
 
 }
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+#define WATERMARK_DEPTH 128
+
+static void watermark_entry(void *p1, void *p2, void *p3)
+{
+	volatile uint8_t buf[WATERMARK_DEPTH];
+
+	/* Switched out with the buffer on the stack */
+	buf[0] = 1;
+	k_sleep(K_MSEC(1));
+	buf[WATERMARK_DEPTH - 1] = buf[0];
+}
+
+/**
+ * @brief Test the stack usage sampled at context switches
+ *
+ * Show that the sampled unused stack space goes down when the thread is
+ * switched out deeper into its stack, and that it is never below the
+ * unused stack space found by scanning the stack.
+ *
+ * @ingroup kernel_memprotect_tests
+ */
+ZTEST(userspace_thread_stack, test_stack_watermark)
+{
+	size_t sampled, scanned;
+	size_t initial;
+
+	k_thread_create(&test_thread, kern_stack, STEST_STACKSIZE,
+			watermark_entry, NULL, NULL, NULL,
+			-1, 0, K_FOREVER);
+
+	zassert_ok(k_thread_stack_watermark_get(&test_thread, &initial));
+	zassert_true(initial <= test_thread.stack_info.size, "watermark out of the stack");
+
+	k_thread_start(&test_thread);
+	k_thread_join(&test_thread, K_FOREVER);
+
+	zassert_ok(k_thread_stack_watermark_get(&test_thread, &sampled));
+	zassert_true(sampled + WATERMARK_DEPTH <= initial,
+		     "sampled unused stack space %zu, initially %zu", sampled, initial);
+
+	zassert_ok(k_thread_stack_space_get(&test_thread, &scanned));
+	zassert_true(sampled >= scanned, "sampled %zu below scanned %zu", sampled, scanned);
+	printk("target thread unused stack space: sampled %zu, scanned %zu\n",
+	       sampled, scanned);
+}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 void *thread_setup(void)
 {
 	k_thread_system_pool_assign(k_current_get());
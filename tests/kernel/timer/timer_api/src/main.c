@@ -809,6 +809,73 @@ ZTEST_USER(timer_api, test_sleep_abs)
 		     start + sleep_ticks, end, late);
 }
 
+#define NUM_ORDER_TIMERS 48
+
+static struct k_timer order_timers[NUM_ORDER_TIMERS];
+static int64_t order_deadline[NUM_ORDER_TIMERS];
+static int64_t order_fired[NUM_ORDER_TIMERS];
+
+static void order_expire(struct k_timer *timer)
+{
+	order_fired[timer - order_timers] = k_uptime_ticks();
+}
+
+/**
+ * @brief Test expiry of many concurrently pending timers
+ *
+ * @details Arm a set of timers whose expiries are spread across
+ * several hundred ticks in a scrambled order, abort some of them, and
+ * check that every remaining timer fires on its own deadline no
+ * matter how far in the future, or in which order, it was queued.
+ * This exercises the cascading and overflow paths of the timeout
+ * queue backends.
+ *
+ * @ingroup kernel_timer_tests
+ */
+ZTEST(timer_api, test_timer_many_pending)
+{
+#ifdef CONFIG_TIMEOUT_64BIT
+	int64_t start;
+
+	tick_sync();
+	start = k_uptime_ticks();
+
+	for (int i = 0; i < NUM_ORDER_TIMERS; i++) {
+		/* Scramble the order with a multiplicative step */
+		k_ticks_t dt = 1 + (i * 37) % 301;
+
+		k_timer_init(&order_timers[i], order_expire, NULL);
+		order_fired[i] = -1;
+		order_deadline[i] = start + dt;
+		k_timer_start(&order_timers[i], K_TIMEOUT_ABS_TICKS(start + dt),
+			      K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_ORDER_TIMERS; i += 5) {
+		k_timer_stop(&order_timers[i]);
+	}
+
+	k_sleep(K_TICKS(310));
+
+	for (int i = 0; i < NUM_ORDER_TIMERS; i++) {
+		if ((i % 5) == 0) {
+			zassert_equal(order_fired[i], -1,
+				      "stopped timer %d fired", i);
+			continue;
+		}
+
+		zassert_true(order_fired[i] >= order_deadline[i],
+			     "timer %d fired early: %lld < %lld", i,
+			     order_fired[i], order_deadline[i]);
+		zassert_true(order_fired[i] <= order_deadline[i] + 1,
+			     "timer %d fired late: %lld > %lld", i,
+			     order_fired[i], order_deadline[i]);
+	}
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn,
 		       k_timer_stop_t stop_fn)
 {
@@ -539,5 +539,85 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+static K_SEM_DEFINE(latency_sem, 0, 1);
+
+static uint32_t histogram_sum(const uint32_t *histogram)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+		sum += histogram[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Helper thread to test_thread_stats_latency()
+ */
+void helper_latency(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < 3; i++) {
+		k_sem_take(&latency_sem, K_FOREVER);
+	}
+
+	k_sleep(K_TICKS(1));
+	k_thread_suspend(_current);
+}
+
+/**
+ * @brief Test the scheduling latency histograms
+ *
+ * A higher priority helper thread blocks three times on a semaphore,
+ * sleeps once and suspends itself once. Each wake up preempts the main
+ * thread.
+ */
+ZTEST(usage_api, test_thread_stats_latency)
+{
+	k_thread_runtime_stats_t  main_stats1;
+	k_thread_runtime_stats_t  main_stats2;
+	k_thread_runtime_stats_t  stats;
+	k_tid_t  tid;
+	int  priority;
+
+	priority = k_thread_priority_get(_current);
+	k_thread_runtime_stats_get(_current, &main_stats1);
+
+	/* The helper runs until it blocks on the semaphore */
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper_latency, NULL, NULL, NULL,
+			      priority - 1, 0, K_NO_WAIT);
+
+	for (int i = 0; i < 3; i++) {
+		k_sem_give(&latency_sem);
+	}
+
+	/* The helper sleeps for 1 tick, then suspends itself */
+
+	k_sleep(K_TICKS(2));
+	k_thread_resume(tid);
+	k_thread_join(tid, K_FOREVER);
+
+	k_thread_runtime_stats_get(tid, &stats);
+	k_thread_runtime_stats_get(_current, &main_stats2);
+
+	zassert_equal(histogram_sum(stats.latency.blocked[K_SCHED_WAIT_OBJECT]), 3);
+	zassert_equal(histogram_sum(stats.latency.blocked[K_SCHED_WAIT_SLEEP]), 1);
+	zassert_equal(histogram_sum(stats.latency.blocked[K_SCHED_WAIT_SUSPEND]), 1);
+
+	/* Started, woken up three times, after the sleep and resumed */
+
+	zassert_equal(histogram_sum(stats.latency.ready), 6);
+
+	/* The main thread was preempted by each wake up of the helper */
+
+	zassert_true(histogram_sum(main_stats2.latency.preempted) -
+		     histogram_sum(main_stats1.latency.preempted) >= 4);
+}
+#endif
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -1441,6 +1441,90 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+#ifdef CONFIG_WORKQUEUE_MULTI_THREAD
+static K_THREAD_STACK_DEFINE(multi_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(multi_stack1, STACK_SIZE);
+static struct k_work_q multi_queue;
+static struct k_work_q_thread multi_thread1;
+static struct k_sem multi_sem;
+static atomic_t multi_ctr;
+
+static void multi_handler(struct k_work *work)
+{
+	k_sem_take(&multi_sem, K_FOREVER);
+	atomic_inc(&multi_ctr);
+}
+
+/* Work items of a queue with several threads run concurrently, and a
+ * work item is never run by two threads at the same time.
+ */
+ZTEST(work, test_multi_thread_queue)
+{
+	static struct k_work_sync multi_sync;
+	int rc;
+
+	k_sem_init(&multi_sem, 0, K_SEM_MAX_LIMIT);
+	k_work_queue_init(&multi_queue);
+	k_work_queue_start(&multi_queue, multi_stack,
+			   K_THREAD_STACK_SIZEOF(multi_stack),
+			   COOPLO_PRIORITY, NULL);
+	k_work_queue_thread_add(&multi_queue, &multi_thread1, multi_stack1,
+				K_THREAD_STACK_SIZEOF(multi_stack1),
+				COOPLO_PRIORITY, NULL);
+
+	k_work_init(&work, multi_handler);
+	k_work_init(&work1, multi_handler);
+
+	/* Both items run at the same time */
+	zassert_equal(k_work_submit_to_queue(&multi_queue, &work), 1);
+	zassert_equal(k_work_submit_to_queue(&multi_queue, &work1), 1);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_work_busy_get(&work), K_WORK_RUNNING);
+	zassert_equal(k_work_busy_get(&work1), K_WORK_RUNNING);
+
+	/* A resubmission waits for the running instance */
+	rc = k_work_submit_to_queue(&multi_queue, &work);
+	zassert_equal(rc, 2);
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_work_busy_get(&work), K_WORK_RUNNING | K_WORK_QUEUED);
+
+	k_sem_give(&multi_sem);
+	k_sem_give(&multi_sem);
+	k_sem_give(&multi_sem);
+
+	/* Flushing waits for both instances */
+	zassert_true(k_work_flush(&work, &multi_sync));
+	zassert_equal(k_work_busy_get(&work), 0);
+	zassert_false(k_work_flush(&work1, &multi_sync));
+	zassert_equal(atomic_get(&multi_ctr), 3);
+
+	zassert_equal(k_work_queue_drain(&multi_queue, false), 0);
+}
+#endif /* CONFIG_WORKQUEUE_MULTI_THREAD */
+
+#ifdef CONFIG_TIMER_SLACK
+/* A delayable work item with slack expires with an earlier timeout within
+ * its slack window.
+ */
+ZTEST(work_1cpu, test_delayable_slack)
+{
+	static struct k_work_delayable dwork1;
+	k_ticks_t slack = k_ms_to_ticks_ceil64(DELAY_MS);
+
+	k_work_init_delayable(&dwork, rel_handler);
+	k_work_init_delayable(&dwork1, rel_handler);
+	k_work_delayable_slack_set(&dwork1, K_TICKS(slack));
+
+	zassert_equal(k_work_schedule(&dwork, K_MSEC(DELAY_MS)), 1);
+	zassert_equal(k_work_schedule(&dwork1, K_MSEC(DELAY_MS / 2)), 1);
+	zassert_equal(k_work_delayable_expires_get(&dwork1),
+		      k_work_delayable_expires_get(&dwork));
+
+	zassert_equal(k_work_cancel_delayable(&dwork), 0);
+	zassert_equal(k_work_cancel_delayable(&dwork1), 0);
+}
+#endif /* CONFIG_TIMER_SLACK */
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
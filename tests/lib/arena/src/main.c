@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/arena.h>
+#include <zephyr/sys/sys_heap.h>
+
+#define BUF_SIZE   256
+#define HEAP_SIZE  2048
+#define CHUNK_SIZE 128
+
+static uint8_t __aligned(8) arena_buf[BUF_SIZE];
+static uint8_t __aligned(8) heap_mem[HEAP_SIZE];
+
+static struct sys_heap heap;
+static struct sys_arena arena;
+
+static bool in_buf(void *p, size_t bytes)
+{
+	return (uint8_t *)p >= arena_buf &&
+	       (uint8_t *)p + bytes <= arena_buf + sizeof(arena_buf);
+}
+
+static size_t heap_allocated(void)
+{
+	struct sys_memory_stats stats;
+
+	zassert_equal(sys_heap_runtime_stats_get(&heap, &stats), 0);
+
+	return stats.allocated_bytes;
+}
+
+/**
+ * @brief Test bump allocation and reset from a caller buffer only
+ */
+ZTEST(arena, test_arena_buffer)
+{
+	void *first, *p, *prev = NULL;
+	int count = 0;
+
+	sys_arena_init(&arena, arena_buf, sizeof(arena_buf), NULL, 0);
+
+	zassert_is_null(sys_arena_alloc(&arena, 0), "zero-sized allocation");
+
+	first = sys_arena_alloc(&arena, 10);
+	zassert_not_null(first);
+	zassert_true(in_buf(first, 10));
+
+	for (prev = first; (p = sys_arena_alloc(&arena, 10)) != NULL; prev = p) {
+		zassert_true(in_buf(p, 10), "allocation outside the buffer");
+		zassert_true((uint8_t *)p >= (uint8_t *)prev + 10, "overlap");
+		zassert_equal((uintptr_t)p % SYS_ARENA_ALIGN, 0, "misaligned");
+		count++;
+	}
+	zassert_true(count > 0);
+	zassert_true(sys_arena_used_get(&arena) <= sizeof(arena_buf));
+
+	sys_arena_reset(&arena);
+	zassert_equal(sys_arena_used_get(&arena), 0);
+	zassert_equal_ptr(sys_arena_alloc(&arena, 10), first,
+			  "reset did not rewind the arena");
+}
+
+/**
+ * @brief Test alignment of sys_arena_aligned_alloc()
+ */
+ZTEST(arena, test_arena_aligned)
+{
+	sys_arena_init(&arena, arena_buf, sizeof(arena_buf), NULL, 0);
+
+	for (size_t align = 1; align <= 64; align <<= 1) {
+		void *p;
+
+		(void)sys_arena_aligned_alloc(&arena, 1, 1);
+		p = sys_arena_aligned_alloc(&arena, align, 3);
+		zassert_not_null(p, "align %zu", align);
+		zassert_equal((uintptr_t)p % align, 0, "align %zu", align);
+	}
+
+	zassert_is_null(sys_arena_alloc(&arena, BUF_SIZE), "larger than the buffer");
+}
+
+/**
+ * @brief Test nested checkpoints and rollback
+ */
+ZTEST(arena, test_arena_checkpoint)
+{
+	struct sys_arena_mark outer, inner;
+	void *a, *b, *c;
+
+	sys_arena_init(&arena, arena_buf, sizeof(arena_buf), NULL, 0);
+
+	a = sys_arena_alloc(&arena, 16);
+	outer = sys_arena_checkpoint(&arena);
+	b = sys_arena_alloc(&arena, 16);
+	inner = sys_arena_checkpoint(&arena);
+	c = sys_arena_alloc(&arena, 16);
+	zassert_true(a != NULL && b != NULL && c != NULL);
+
+	sys_arena_rollback(&arena, inner);
+	zassert_equal_ptr(sys_arena_alloc(&arena, 16), c);
+
+	/* Rolling back to the outer mark skips over the inner one */
+	sys_arena_rollback(&arena, outer);
+	zassert_equal_ptr(sys_arena_alloc(&arena, 16), b);
+
+	sys_arena_reset(&arena);
+	zassert_equal_ptr(sys_arena_alloc(&arena, 16), a);
+}
+
+/**
+ * @brief Test overflow into the backing heap
+ *
+ * @details Allocate past the end of the caller buffer, check that the
+ * extra chunks come from the heap and that rollback and reset return
+ * them.
+ */
+ZTEST(arena, test_arena_overflow)
+{
+	struct sys_arena_mark mark;
+	void *p, *big;
+	size_t base_used;
+
+	sys_arena_init(&arena, arena_buf, sizeof(arena_buf), &heap, CHUNK_SIZE);
+
+	do {
+		p = sys_arena_alloc(&arena, 24);
+		zassert_not_null(p);
+	} while (in_buf(p, 24));
+	zassert_true(heap_allocated() > 0, "no overflow chunk allocated");
+	zassert_true(sys_heap_validate(&heap));
+
+	/* Later small allocations share the overflow chunk */
+	zassert_not_null(sys_arena_alloc(&arena, 24));
+	base_used = heap_allocated();
+
+	mark = sys_arena_checkpoint(&arena);
+	big = sys_arena_alloc(&arena, 4 * CHUNK_SIZE);
+	zassert_not_null(big, "large request not served");
+	zassert_true(heap_allocated() > base_used + 4 * CHUNK_SIZE);
+	memset(big, 0xaa, 4 * CHUNK_SIZE);
+	zassert_true(sys_heap_validate(&heap));
+
+	sys_arena_rollback(&arena, mark);
+	zassert_equal(heap_allocated(), base_used, "chunk not returned on rollback");
+
+	sys_arena_reset(&arena);
+	zassert_equal(heap_allocated(), 0, "chunks not returned on reset");
+	zassert_true(in_buf(sys_arena_alloc(&arena, 24), 24));
+
+	/* A request the heap cannot satisfy fails cleanly */
+	zassert_is_null(sys_arena_alloc(&arena, 2 * HEAP_SIZE));
+	zassert_true(sys_heap_validate(&heap));
+}
+
+/**
+ * @brief Test an arena without a caller buffer
+ */
+ZTEST(arena, test_arena_heap_only)
+{
+	struct sys_arena_mark mark;
+	void *p;
+
+	sys_arena_init(&arena, NULL, 0, &heap, CHUNK_SIZE);
+	mark = sys_arena_checkpoint(&arena);
+
+	for (int i = 0; i < 16; i++) {
+		p = sys_arena_alloc(&arena, 40);
+		zassert_not_null(p);
+		zassert_equal((uintptr_t)p % SYS_ARENA_ALIGN, 0, "misaligned");
+	}
+	zassert_true(sys_arena_used_get(&arena) >= 16 * 40);
+
+	sys_arena_rollback(&arena, mark);
+	zassert_equal(heap_allocated(), 0);
+	zassert_equal(sys_arena_used_get(&arena), 0);
+
+	zassert_not_null(sys_arena_alloc(&arena, 40));
+	sys_arena_reset(&arena);
+	zassert_equal(heap_allocated(), 0);
+}
+
+static void arena_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sys_heap_init(&heap, heap_mem, sizeof(heap_mem));
+}
+
+ZTEST_SUITE(arena, NULL, NULL, arena_before, NULL, NULL);
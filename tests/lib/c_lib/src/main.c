@@ -590,6 +590,63 @@ ZTEST(test_c_lib, test_memcpy)
 		0, "memcpy failed");
 }
 
+/**
+ * @brief Test memory and string functions with all alignments
+ *
+ * @details Copy, set, compare and measure buffers at all combinations
+ * of source and destination offsets within a word and of lengths, to
+ * exercise the word-sized paths of the implementations.
+ *
+ * @see memcpy(), memset(), memcmp(), strlen()
+ */
+ZTEST(test_c_lib, test_mem_alignments)
+{
+	/* make sure the buffers are word aligned */
+	uintptr_t src_words[16];
+	uintptr_t dst_words[16];
+	unsigned char *src = (unsigned char *)src_words;
+	unsigned char *dst = (unsigned char *)dst_words;
+	const size_t max_len = sizeof(dst_words) - 2 * sizeof(uintptr_t);
+
+	for (size_t i = 0; i < sizeof(src_words); i++) {
+		src[i] = (unsigned char)(i * 7 + 1);
+	}
+
+	for (size_t so = 0; so < sizeof(uintptr_t); so++) {
+		for (size_t doff = 0; doff < sizeof(uintptr_t); doff++) {
+			for (size_t n = 0; n <= max_len; n++) {
+				(void)memset(dst, 0xAA, sizeof(dst_words));
+				zassert_equal(memcpy(dst + doff, src + so, n),
+					      dst + doff, "memcpy error");
+				zassert_equal(memcmp(dst + doff, src + so, n), 0,
+					      "memcpy failed");
+				zassert_true(doff == 0 || dst[doff - 1] == 0xAA,
+					     "memcpy wrote before buffer");
+				zassert_equal(dst[doff + n], 0xAA,
+					      "memcpy wrote past buffer");
+
+				if (n > 0) {
+					dst[doff + n - 1] ^= 0x81;
+					zassert_true(memcmp(dst + doff, src + so, n) != 0,
+						     "memcmp missed difference");
+				}
+
+				(void)memset(dst, 0xAA, sizeof(dst_words));
+				(void)memset(dst + doff, 0x5C, n);
+				for (size_t i = 0; i < sizeof(dst_words); i++) {
+					zassert_equal(dst[i],
+						      (i >= doff && i < doff + n) ?
+						      0x5C : 0xAA, "memset failed");
+				}
+
+				dst[doff + n] = '\0';
+				zassert_equal(strlen((char *)dst + doff), n,
+					      "strlen failed");
+			}
+		}
+	}
+}
+
 /**
  * @brief Test memmove operation
  *
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/cpp/coroutine.hpp>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE 1024
+
+K_THREAD_STACK_DEFINE(queue_stack, STACK_SIZE);
+K_THREAD_STACK_DEFINE(other_queue_stack, STACK_SIZE);
+static struct k_work_q queue;
+static struct k_work_q other_queue;
+
+static zephyr::executor exec(&queue);
+static zephyr::executor other_exec(&other_queue);
+
+K_SEM_DEFINE(wake_sem, 0, 1);
+K_SEM_DEFINE(done_sem, 0, 1);
+K_SEM_DEFINE(poll_sem, 0, 1);
+K_MSGQ_DEFINE(msgq, sizeof(int), 4, 4);
+
+static int result;
+static int received;
+
+static zephyr::task take_sem(k_timeout_t timeout)
+{
+	result = co_await zephyr::take(&wake_sem, timeout);
+	k_sem_give(&done_sem);
+}
+
+ZTEST(coroutine, test_take)
+{
+	zassert_ok(zephyr::spawn(exec, take_sem(K_FOREVER)));
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_sem_take(&done_sem, K_NO_WAIT), -EBUSY,
+		      "coroutine did not wait");
+
+	k_sem_give(&wake_sem);
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_equal(result, 0);
+	zassert_equal(k_sem_count_get(&wake_sem), 0);
+}
+
+ZTEST(coroutine, test_take_available)
+{
+	k_sem_give(&wake_sem);
+	zassert_ok(zephyr::spawn(exec, take_sem(K_NO_WAIT)));
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_equal(result, 0);
+}
+
+ZTEST(coroutine, test_take_timeout)
+{
+	zassert_ok(zephyr::spawn(exec, take_sem(K_MSEC(20))));
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_equal(result, -EAGAIN);
+}
+
+static zephyr::task get_msgs(int count)
+{
+	int data;
+
+	for (int i = 0; i < count; i++) {
+		result = co_await zephyr::get(&msgq, &data, K_FOREVER);
+		if (result != 0) {
+			break;
+		}
+		received += data;
+	}
+	k_sem_give(&done_sem);
+}
+
+ZTEST(coroutine, test_get)
+{
+	received = 0;
+	zassert_ok(zephyr::spawn(exec, get_msgs(3)));
+
+	for (int i = 1; i <= 3; i++) {
+		zassert_ok(k_msgq_put(&msgq, &i, K_NO_WAIT));
+		k_sleep(K_MSEC(1));
+	}
+
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_equal(result, 0);
+	zassert_equal(received, 6);
+}
+
+static struct k_poll_event poll_event;
+
+static zephyr::task poll_sem_event(k_timeout_t timeout)
+{
+	k_poll_event_init(&poll_event, K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &poll_sem);
+	result = co_await zephyr::poll(&poll_event, 1, timeout);
+	k_sem_give(&done_sem);
+}
+
+ZTEST(coroutine, test_poll)
+{
+	zassert_ok(zephyr::spawn(exec, poll_sem_event(K_FOREVER)));
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_sem_take(&done_sem, K_NO_WAIT), -EBUSY,
+		      "coroutine did not wait");
+
+	k_sem_give(&poll_sem);
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_equal(result, 0);
+	zassert_equal(poll_event.state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* Polling does not take the semaphore */
+	zassert_ok(k_sem_take(&poll_sem, K_NO_WAIT));
+}
+
+ZTEST(coroutine, test_poll_timeout)
+{
+	zassert_ok(zephyr::spawn(exec, poll_sem_event(K_MSEC(20))));
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_equal(result, -EAGAIN);
+	zassert_equal(poll_event.state, K_POLL_STATE_NOT_READY);
+}
+
+static zephyr::task sleep_then_give(k_timeout_t timeout)
+{
+	co_await zephyr::sleep_for(timeout);
+	k_sem_give(&done_sem);
+}
+
+ZTEST(coroutine, test_sleep_for)
+{
+	int64_t start = k_uptime_get();
+
+	zassert_ok(zephyr::spawn(exec, sleep_then_give(K_MSEC(30))));
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_true(k_uptime_get() - start >= 30, "woke up too early");
+}
+
+static k_tid_t threads[2];
+
+static zephyr::task switch_queue(void)
+{
+	threads[0] = k_current_get();
+	co_await zephyr::resume_on(other_exec);
+	threads[1] = k_current_get();
+	k_sem_give(&done_sem);
+}
+
+ZTEST(coroutine, test_resume_on)
+{
+	zassert_ok(zephyr::spawn(exec, switch_queue()));
+	zassert_ok(k_sem_take(&done_sem, K_MSEC(100)));
+	zassert_equal(threads[0], &queue.thread);
+	zassert_equal(threads[1], &other_queue.thread);
+}
+
+static void *coroutine_setup(void)
+{
+	k_work_queue_start(&queue, queue_stack, K_THREAD_STACK_SIZEOF(queue_stack),
+			   K_PRIO_PREEMPT(1), NULL);
+	k_work_queue_start(&other_queue, other_queue_stack,
+			   K_THREAD_STACK_SIZEOF(other_queue_stack), K_PRIO_PREEMPT(1), NULL);
+
+	return NULL;
+}
+
+ZTEST_SUITE(coroutine, NULL, coroutine_setup, NULL, NULL, NULL);
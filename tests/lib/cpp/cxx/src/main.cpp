@@ -137,4 +137,40 @@ ZTEST(cxx_tests, test_new_delete)
 	zassert_equal(test_foo->get_foo(), 10);
 	delete test_foo;
 }
+
+#ifdef CONFIG_CPP_NEW_POOL
+struct alignas(64) aligned_foo {
+	int v1;
+};
+
+ZTEST(cxx_tests, test_new_delete_pool)
+{
+	/* More objects than a slab holds, to use the larger ones and the heap */
+	static foo_class *foos_new[CONFIG_CPP_NEW_POOL_BLOCKS * 3];
+
+	for (size_t i = 0; i < ARRAY_SIZE(foos_new); i++) {
+		foos_new[i] = new foo_class((int)i);
+		zassert_not_null(foos_new[i]);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(foos_new); i++) {
+		zassert_equal(foos_new[i]->get_foo(), (int)i);
+		delete foos_new[i];
+	}
+
+	int *array = new int[100];
+
+	zassert_not_null(array);
+	delete[] array;
+
+#if __cplusplus >= 201703L
+	aligned_foo *aligned = new aligned_foo;
+
+	zassert_not_null(aligned);
+	zassert_equal((uintptr_t)aligned % 64, 0);
+	delete aligned;
+#endif
+}
+#endif /* CONFIG_CPP_NEW_POOL */
+
 ZTEST_SUITE(cxx_tests, NULL, NULL, NULL, NULL, NULL);
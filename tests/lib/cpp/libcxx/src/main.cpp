@@ -10,6 +10,10 @@
 #include <vector>
 #include <zephyr/ztest.h>
 
+#if __has_include(<memory_resource>)
+#include <zephyr/cpp/memory_resource.hpp>
+#endif
+
 BUILD_ASSERT(__cplusplus == 201703);
 
 std::array<int, 4> array = {1, 2, 3, 4};
@@ -67,6 +71,53 @@ ZTEST(libcxx_tests, test_make_unique)
 	zassert_equal(make_unique_data::dtors, 1, "dtor count not incremented");
 }
 
+#if __has_include(<memory_resource>)
+K_HEAP_DEFINE(pmr_heap, 1024);
+
+ZTEST(libcxx_tests, test_pmr_heap)
+{
+	zephyr::heap_resource res(&pmr_heap);
+	std::pmr::vector<int> pmr_vector(&res);
+
+	for (int i = 0; i < 64; i++) {
+		pmr_vector.push_back(i);
+	}
+	zassert_equal(pmr_vector.size(), 64, "vector store failed");
+	zassert_equal(pmr_vector[63], 63, "vector[63] wrong");
+	zassert_true(res.is_equal(res), "resource not equal to itself");
+}
+
+ZTEST(libcxx_tests, test_pmr_arena)
+{
+	static uint8_t arena_buf[512];
+	struct sys_arena arena;
+
+	sys_arena_init(&arena, arena_buf, sizeof(arena_buf), NULL, 0);
+
+	zephyr::arena_resource res(&arena);
+	std::pmr::vector<int> pmr_vector(&res);
+
+	pmr_vector.reserve(32);
+	for (int i = 0; i < 32; i++) {
+		pmr_vector.push_back(i);
+	}
+	zassert_equal(pmr_vector[31], 31, "vector[31] wrong");
+	zassert_true(sys_arena_used_get(&arena) >= 32 * sizeof(int),
+		     "vector not allocated from the arena");
+}
+#else
+
+ZTEST(libcxx_tests, test_pmr_heap)
+{
+	ztest_test_skip();
+}
+
+ZTEST(libcxx_tests, test_pmr_arena)
+{
+	ztest_test_skip();
+}
+#endif
+
 #if defined(CONFIG_CPP_EXCEPTIONS) && !defined(CONFIG_BOARD_M2GL025_MIV)
 static void throw_exception(void)
 {
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+#include "_main.h"
+
+/* More keys than a group of the swiss table holds */
+#define N_COLLIDING 16
+
+/* Only the 7 low bits vary, so that all the keys probe the same group first */
+static uint32_t collide_hash(const void *str, size_t n)
+{
+	uint64_t key;
+
+	__ASSERT_NO_MSG(n == sizeof(key));
+	memcpy(&key, str, sizeof(key));
+
+	return (uint32_t)key & 0x7f;
+}
+
+SYS_HASHMAP_DEFAULT_DEFINE_STATIC_ADVANCED(collide_map, collide_hash, realloc,
+					   SYS_HASHMAP_CONFIG(SIZE_MAX,
+							      SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
+
+ZTEST(hash_map, test_collide)
+{
+	uint64_t value;
+	int ret;
+
+	for (size_t i = 0; i < N_COLLIDING; ++i) {
+		ret = sys_hashmap_insert(&collide_map, i, i + 100, NULL);
+		zassert_equal(1, ret, "failed to insert (%zu, %zu): %d", i, i + 100, ret);
+	}
+
+	for (size_t i = 0; i < N_COLLIDING; ++i) {
+		zassert_true(sys_hashmap_get(&collide_map, i, &value), "%zu not found", i);
+		zassert_equal(i + 100, value, "wrong value for %zu", i);
+	}
+
+	for (size_t i = 0; i < N_COLLIDING; ++i) {
+		zassert_true(sys_hashmap_remove(&collide_map, i, &value), "%zu not removed", i);
+		zassert_equal(i + 100, value, "wrong value removed for %zu", i);
+
+		for (size_t j = i + 1; j < N_COLLIDING; ++j) {
+			zassert_true(sys_hashmap_contains_key(&collide_map, j),
+				     "%zu lost when removing %zu", j, i);
+		}
+	}
+
+	zassert_true(sys_hashmap_is_empty(&collide_map));
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/heap_profile.h>
+#include <zephyr/sys/sys_heap.h>
+
+#define HEAP_SIZE 2048
+
+/* Upper bound on the size of the helpers below, to check call sites.
+ * The barriers keep the allocation calls from being made tail calls,
+ * which would charge them to the test functions instead.
+ */
+#define HELPER_SIZE 256
+
+static uint8_t __aligned(8) heap_mem[HEAP_SIZE];
+static struct sys_heap heap;
+static struct sys_heap_profile heap_prof;
+
+K_HEAP_DEFINE(kheap, 1024);
+static struct sys_heap_profile kheap_prof;
+
+static __attribute__((noinline)) void *alloc_a(size_t bytes)
+{
+	void *p = sys_heap_alloc(&heap, bytes);
+
+	compiler_barrier();
+
+	return p;
+}
+
+static __attribute__((noinline)) void *alloc_b(size_t bytes)
+{
+	void *p = sys_heap_aligned_alloc(&heap, 16, bytes);
+
+	compiler_barrier();
+
+	return p;
+}
+
+static __attribute__((noinline)) void *kheap_alloc(size_t bytes)
+{
+	void *p = k_heap_alloc(&kheap, bytes, K_NO_WAIT);
+
+	compiler_barrier();
+
+	return p;
+}
+
+static __attribute__((noinline)) void *system_alloc(size_t bytes)
+{
+	void *p = k_malloc(bytes);
+
+	compiler_barrier();
+
+	return p;
+}
+
+/* The helpers may sit closer together than HELPER_SIZE, so take the
+ * first site past the start of the function
+ */
+static struct sys_heap_profile_site *find_site(struct sys_heap_profile *prof,
+					       void *fn)
+{
+	struct sys_heap_profile_site *found = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(prof->sites); i++) {
+		uintptr_t site = (uintptr_t)prof->sites[i].site;
+
+		if (site > (uintptr_t)fn && site < (uintptr_t)fn + HELPER_SIZE &&
+		    (found == NULL || site < (uintptr_t)found->site)) {
+			found = &prof->sites[i];
+		}
+	}
+
+	return found;
+}
+
+/**
+ * @brief Test that allocations are charged to their call sites
+ */
+ZTEST(heap_profile, test_call_sites)
+{
+	struct sys_heap_profile_site *a, *b;
+	void *p;
+
+	for (int i = 0; i < 3; i++) {
+		p = alloc_a(8);
+		zassert_not_null(p);
+		sys_heap_free(&heap, p);
+	}
+	p = alloc_b(100);
+	zassert_not_null(p);
+	sys_heap_free(&heap, p);
+	zassert_is_null(alloc_b(2 * HEAP_SIZE));
+
+	a = find_site(&heap_prof, alloc_a);
+	b = find_site(&heap_prof, alloc_b);
+	zassert_not_null(a, "alloc_a call site not recorded");
+	zassert_not_null(b, "alloc_b call site not recorded");
+	zassert_equal(a->count, 3);
+	zassert_equal(a->bytes, 3 * 8);
+	zassert_equal(a->failures, 0);
+	zassert_equal(b->count, 1);
+	zassert_equal(b->bytes, 100);
+	zassert_equal(b->failures, 1);
+
+	zassert_equal(heap_prof.allocs, 4);
+	zassert_equal(heap_prof.failures, 1);
+	zassert_equal(heap_prof.max_request, 100);
+	zassert_equal(heap_prof.sizes[0], 3, "8 byte requests not in class 0");
+	zassert_equal(heap_prof.sizes[4], 1, "100 byte request not in class 4");
+
+	sys_heap_profile_reset(&heap_prof);
+	zassert_equal(heap_prof.allocs, 0);
+	zassert_is_null(find_site(&heap_prof, alloc_a));
+}
+
+/**
+ * @brief Test the fragmentation metrics
+ */
+ZTEST(heap_profile, test_fragmentation)
+{
+	struct sys_heap_frag_info info;
+	void *blocks[8];
+
+	sys_heap_profile_frag_get(&heap_prof, &info);
+	zassert_equal(info.free_chunks, 1);
+	zassert_equal(info.largest_free, info.free_bytes);
+	zassert_equal(info.frag_permille, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(blocks); i++) {
+		blocks[i] = alloc_a(64);
+		zassert_not_null(blocks[i]);
+	}
+
+	/* Free every other block, leaving equally sized holes */
+	for (int i = 0; i < ARRAY_SIZE(blocks); i += 2) {
+		sys_heap_free(&heap, blocks[i]);
+	}
+
+	sys_heap_profile_frag_get(&heap_prof, &info);
+	zassert_true(info.free_chunks >= ARRAY_SIZE(blocks) / 2);
+	zassert_true(info.largest_free < info.free_bytes);
+	zassert_true(info.frag_permille > 0 && info.frag_permille < 1000);
+	zassert_true(info.max_allocated >= 8 * 64, "high-water mark not kept");
+
+	for (int i = 1; i < ARRAY_SIZE(blocks); i += 2) {
+		sys_heap_free(&heap, blocks[i]);
+	}
+
+	sys_heap_profile_frag_get(&heap_prof, &info);
+	zassert_equal(info.free_chunks, 1);
+	zassert_equal(info.frag_permille, 0);
+
+#ifdef CONFIG_SYS_HEAP_PROFILE_STATS
+	zassert_equal(heap_prof.stats.allocs, heap_prof.allocs);
+	zassert_equal(heap_prof.stats.largest_free, info.largest_free);
+	zassert_equal_ptr(stats_group_find("test"), &heap_prof.stats.s_hdr,
+			  "statistics group not registered");
+#endif
+}
+
+/**
+ * @brief Test profiling k_heap and the system heap
+ */
+ZTEST(heap_profile, test_kernel_heaps)
+{
+	struct sys_heap_profile *sys_prof = sys_heap_profile_find("system");
+	struct sys_heap_profile_site *s;
+	void *p;
+
+	zassert_equal_ptr(sys_heap_profile_find("kheap"), &kheap_prof);
+
+	for (int i = 0; i < 2; i++) {
+		p = kheap_alloc(32);
+		zassert_not_null(p);
+		k_heap_free(&kheap, p);
+	}
+	s = find_site(&kheap_prof, kheap_alloc);
+	zassert_not_null(s, "k_heap_alloc() caller not recorded");
+	zassert_equal(s->count, 2);
+	zassert_equal(kheap_prof.allocs, 2, "k_heap internals recorded too");
+
+	zassert_not_null(sys_prof, "system heap not profiled");
+	p = system_alloc(24);
+	zassert_not_null(p);
+	k_free(p);
+	s = find_site(sys_prof, system_alloc);
+	zassert_not_null(s, "k_malloc() caller not recorded");
+	zassert_equal(s->count, 1);
+}
+
+static void *heap_profile_setup(void)
+{
+	sys_heap_init(&heap, heap_mem, sizeof(heap_mem));
+	zassert_equal(sys_heap_profile_attach(&heap, &heap_prof, "test", NULL), 0);
+	zassert_equal(sys_heap_profile_attach(&heap, &heap_prof, "test", NULL), -EALREADY);
+	zassert_equal(sys_heap_profile_attach(&kheap.heap, &kheap_prof, "kheap",
+					      &kheap.lock), 0);
+
+	return NULL;
+}
+
+ZTEST_SUITE(heap_profile, NULL, heap_profile_setup, NULL, NULL, NULL);
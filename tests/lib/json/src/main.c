@@ -8,6 +8,7 @@
 #include <stdbool.h>
 #include <zephyr/ztest.h>
 #include <zephyr/data/json.h>
+#include <zephyr/net/buf.h>
 
 struct test_nested {
 	int nested_int;
@@ -1209,4 +1210,99 @@ ZTEST(lib_json_test, test_large_descriptor)
 	zassert_true(ret & ((int64_t)1 << 39), "Field int39 not decoded");
 }
 
+struct stream_tokens {
+	char text[128];
+	size_t len;
+};
+
+static int stream_token_cb(enum json_tokens type, const char *value, size_t len,
+			   void *user_data)
+{
+	struct stream_tokens *tokens = user_data;
+	int ret;
+
+	ret = snprintk(&tokens->text[tokens->len], sizeof(tokens->text) - tokens->len,
+		       "%c%.*s ", type, (int)len, value);
+	zassert_true(ret > 0 && ret < sizeof(tokens->text) - tokens->len);
+	tokens->len += ret;
+
+	return 0;
+}
+
+ZTEST(lib_json_test, test_json_stream)
+{
+	const char doc[] = " {\"a\\\"b\\u00e9\" : [1, -2.5, true,false , null],\"n\":{}} 42";
+	/* each token as its type followed by its text */
+	const char expected[] = "{{ \"a\\\"b\\u00e9 :: [[ 01 ,, 0-2.5 ,, ttrue ,, ffalse ,, "
+				"nnull ]] ,, \"n :: {{ }} }} 042 ";
+	struct stream_tokens tokens;
+	struct json_stream stream;
+	char buf[16];
+
+	json_stream_init(&stream, buf, sizeof(buf), stream_token_cb, &tokens);
+
+	/* Split the document at every position, tokens must not change */
+	for (size_t split = 0; split < sizeof(doc); split++) {
+		tokens.len = 0;
+
+		zassert_ok(json_stream_feed(&stream, doc, split));
+		zassert_ok(json_stream_feed(&stream, &doc[split], sizeof(doc) - 1 - split));
+		zassert_ok(json_stream_finish(&stream));
+
+		zassert_mem_equal(tokens.text, expected, sizeof(expected) - 1,
+				  "split at %zu", split);
+		zassert_equal(tokens.len, sizeof(expected) - 1);
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_invalid)
+{
+	struct stream_tokens tokens = { 0 };
+	struct json_stream stream;
+	char buf[4];
+
+	json_stream_init(&stream, buf, sizeof(buf), stream_token_cb, &tokens);
+
+	zassert_equal(json_stream_feed(&stream, "[tru", 4), 0);
+	zassert_equal(json_stream_finish(&stream), -EINVAL, "Truncated literal");
+
+	zassert_equal(json_stream_feed(&stream, "[trux]", 6), -EINVAL);
+	zassert_equal(json_stream_feed(&stream, "[]", 2), -EINVAL, "Fed after error");
+	(void)json_stream_finish(&stream);
+
+	zassert_equal(json_stream_feed(&stream, "\"abcdef", 7), -ENOMEM,
+		      "Token spanning chunks exceeds the buffer");
+	(void)json_stream_finish(&stream);
+}
+
+NET_BUF_POOL_DEFINE(json_pool, 8, 16, 0, NULL);
+
+ZTEST(lib_json_test, test_json_obj_encode_net_buf)
+{
+	struct test_nested nested = {
+		.nested_int = -1234,
+		.nested_bool = true,
+		.nested_string = "escape: \t",
+	};
+	const char encoded[] = "{\"nested_int\":-1234,\"nested_bool\":true,"
+			       "\"nested_string\":\"escape: \\t\"}";
+	char linear[sizeof(encoded)];
+	struct net_buf *buf;
+	int ret;
+
+	buf = net_buf_alloc(&json_pool, K_NO_WAIT);
+	zassert_not_null(buf);
+
+	/* The object spans the fragments of the chain */
+	ret = json_obj_encode_net_buf(nested_descr, ARRAY_SIZE(nested_descr), &nested,
+				      buf, K_NO_WAIT);
+	zassert_ok(ret, "Encoding function failed");
+	zassert_equal(net_buf_frags_len(buf), sizeof(encoded) - 1);
+
+	net_buf_linearize(linear, sizeof(linear), buf, 0, sizeof(encoded) - 1);
+	zassert_mem_equal(linear, encoded, sizeof(encoded) - 1);
+
+	net_buf_unref(buf);
+}
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
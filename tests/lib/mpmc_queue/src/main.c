@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/mpmc_queue.h>
+
+#define QUEUE_LEN 4
+#define NUM_PRODUCERS 2
+#define NUM_CONSUMERS 2
+#define ITEMS_PER_PRODUCER 200
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct item {
+	uint32_t id;
+	uint8_t payload[6];
+};
+
+SYS_MPMC_QUEUE_DEFINE(static_q, sizeof(struct item), QUEUE_LEN);
+
+static struct sys_mpmc_queue q;
+static atomic_t q_buf[SYS_MPMC_QUEUE_BUF_SIZE(sizeof(struct item), QUEUE_LEN) /
+		      sizeof(atomic_t)];
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_PRODUCERS + NUM_CONSUMERS, STACK_SIZE);
+static struct k_thread threads[NUM_PRODUCERS + NUM_CONSUMERS];
+static atomic_t seen[ATOMIC_BITMAP_SIZE(NUM_PRODUCERS * ITEMS_PER_PRODUCER)];
+static atomic_t duplicates;
+
+static struct item make_item(uint32_t id)
+{
+	struct item it = { .id = id };
+
+	(void)memset(it.payload, (uint8_t)id, sizeof(it.payload));
+
+	return it;
+}
+
+static void check_item(const struct item *it, uint32_t id)
+{
+	zassert_equal(it->id, id, "got item %u, expected %u", it->id, id);
+	for (int i = 0; i < sizeof(it->payload); i++) {
+		zassert_equal(it->payload[i], (uint8_t)id, "item %u corrupted", id);
+	}
+}
+
+static void fill_and_drain(struct sys_mpmc_queue *queue, uint32_t first)
+{
+	struct item it;
+
+	for (uint32_t i = 0; i < QUEUE_LEN; i++) {
+		it = make_item(first + i);
+		zassert_equal(sys_mpmc_queue_put(queue, &it), 0);
+	}
+	zassert_equal(sys_mpmc_queue_put(queue, &it), -ENOMSG, "put into a full queue");
+	zassert_equal(sys_mpmc_queue_num_used_get(queue), QUEUE_LEN);
+
+	for (uint32_t i = 0; i < QUEUE_LEN; i++) {
+		zassert_equal(sys_mpmc_queue_get(queue, &it), 0);
+		check_item(&it, first + i);
+	}
+	zassert_equal(sys_mpmc_queue_get(queue, &it), -ENOMSG, "get from an empty queue");
+	zassert_equal(sys_mpmc_queue_num_used_get(queue), 0);
+}
+
+/**
+ * @brief Test FIFO order and the full and empty conditions
+ */
+ZTEST(mpmc_queue, test_put_get)
+{
+	zassert_equal(sys_mpmc_queue_capacity(&q), QUEUE_LEN);
+
+	/* Several laps, so that every slot is reused */
+	for (uint32_t lap = 0; lap < 3; lap++) {
+		fill_and_drain(&q, lap * QUEUE_LEN);
+	}
+
+	/* Interleaved, keeping the queue partially full */
+	for (uint32_t i = 0; i < 3 * QUEUE_LEN; i++) {
+		struct item it = make_item(i);
+
+		zassert_equal(sys_mpmc_queue_put(&q, &it), 0);
+		if (i > 0) {
+			zassert_equal(sys_mpmc_queue_get(&q, &it), 0);
+			check_item(&it, i - 1);
+		}
+	}
+}
+
+/**
+ * @brief Test a statically defined queue and initialization errors
+ */
+ZTEST(mpmc_queue, test_define_init)
+{
+	struct sys_mpmc_queue bad;
+
+	fill_and_drain(&static_q, 100);
+
+	zassert_equal(sys_mpmc_queue_init(&bad, q_buf, sizeof(struct item), 3), -EINVAL,
+		      "length not a power of two accepted");
+	zassert_equal(sys_mpmc_queue_init(&bad, (uint8_t *)q_buf + 1, sizeof(struct item),
+					  QUEUE_LEN), -EINVAL, "misaligned buffer accepted");
+}
+
+/**
+ * @brief Test the non-blocking behavior and timeouts of the wait calls
+ */
+ZTEST(mpmc_queue, test_wait_timeout)
+{
+	struct item it = make_item(0);
+	int64_t start;
+
+	zassert_equal(sys_mpmc_queue_get_wait(&q, &it, K_NO_WAIT), -ENOMSG);
+
+	start = k_uptime_get();
+	zassert_equal(sys_mpmc_queue_get_wait(&q, &it, K_MSEC(20)), -EAGAIN);
+	zassert_true(k_uptime_get() - start >= 20, "returned before the timeout");
+
+	for (int i = 0; i < QUEUE_LEN; i++) {
+		zassert_equal(sys_mpmc_queue_put_wait(&q, &it, K_NO_WAIT), 0);
+	}
+	zassert_equal(sys_mpmc_queue_put_wait(&q, &it, K_NO_WAIT), -ENOMSG);
+	zassert_equal(sys_mpmc_queue_put_wait(&q, &it, K_MSEC(20)), -EAGAIN);
+}
+
+static void timer_put(struct k_timer *timer)
+{
+	struct item it = make_item(42);
+
+	zassert_equal(sys_mpmc_queue_put(&q, &it), 0);
+}
+
+/**
+ * @brief Test waking a waiting consumer from an ISR
+ */
+ZTEST(mpmc_queue, test_wait_isr)
+{
+	struct k_timer timer;
+	struct item it;
+
+	k_timer_init(&timer, timer_put, NULL);
+	k_timer_start(&timer, K_MSEC(10), K_NO_WAIT);
+
+	zassert_equal(sys_mpmc_queue_get_wait(&q, &it, K_FOREVER), 0);
+	check_item(&it, 42);
+}
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	uint32_t base = POINTER_TO_UINT(p1) * ITEMS_PER_PRODUCER;
+
+	for (uint32_t i = 0; i < ITEMS_PER_PRODUCER; i++) {
+		struct item it = make_item(base + i);
+
+		zassert_equal(sys_mpmc_queue_put_wait(&q, &it, K_FOREVER), 0);
+		if ((i % 7) == 0) {
+			k_yield();
+		}
+	}
+}
+
+static void consumer(void *p1, void *p2, void *p3)
+{
+	uint32_t count = POINTER_TO_UINT(p1);
+	struct item it;
+
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_equal(sys_mpmc_queue_get_wait(&q, &it, K_FOREVER), 0);
+		check_item(&it, it.id);
+		zassert_true(it.id < NUM_PRODUCERS * ITEMS_PER_PRODUCER);
+		if (atomic_test_and_set_bit(seen, it.id)) {
+			(void)atomic_inc(&duplicates);
+		}
+		if ((i % 5) == 0) {
+			k_yield();
+		}
+	}
+}
+
+/**
+ * @brief Test several producers and consumers blocking on a short queue
+ */
+ZTEST(mpmc_queue, test_producers_consumers)
+{
+	const uint32_t total = NUM_PRODUCERS * ITEMS_PER_PRODUCER;
+	int n = 0;
+
+	for (int i = 0; i < NUM_CONSUMERS; i++, n++) {
+		/* The first consumer takes the remainder */
+		uint32_t count = total / NUM_CONSUMERS + (i == 0 ? total % NUM_CONSUMERS : 0);
+
+		k_thread_create(&threads[n], stacks[n], STACK_SIZE, consumer,
+				UINT_TO_POINTER(count), NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+	for (int i = 0; i < NUM_PRODUCERS; i++, n++) {
+		k_thread_create(&threads[n], stacks[n], STACK_SIZE, producer,
+				UINT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < n; i++) {
+		zassert_equal(k_thread_join(&threads[i], K_SECONDS(10)), 0,
+			      "thread %d stuck", i);
+	}
+
+	zassert_equal(atomic_get(&duplicates), 0, "items received twice");
+	for (uint32_t id = 0; id < total; id++) {
+		zassert_true(atomic_test_bit(seen, id), "item %u lost", id);
+	}
+	zassert_equal(sys_mpmc_queue_num_used_get(&q), 0);
+}
+
+static void mpmc_queue_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(sys_mpmc_queue_init(&q, q_buf, sizeof(struct item), QUEUE_LEN), 0);
+}
+
+ZTEST_SUITE(mpmc_queue, NULL, NULL, mpmc_queue_before, NULL, NULL);
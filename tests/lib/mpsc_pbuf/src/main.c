@@ -553,6 +553,46 @@ ZTEST(log_buffer, test_item_alloc_commit)
 	item_alloc_commit(false);
 }
 
+void item_alloc_discard(bool overwrite)
+{
+	struct mpsc_pbuf_buffer buffer;
+	struct test_data_var *packet;
+
+	init(&buffer, 8, overwrite);
+
+	for (int i = 0; i < 4; i++) {
+		/* A discarded packet is skipped by the consumer. */
+		packet = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, 3,
+								 K_NO_WAIT);
+		zassert_true(packet != NULL);
+		packet->hdr.len = 3;
+		packet->hdr.data = i;
+		mpsc_pbuf_discard(&buffer, (union mpsc_pbuf_generic *)packet);
+
+		packet = (struct test_data_var *)mpsc_pbuf_alloc(&buffer, 2,
+								 K_NO_WAIT);
+		zassert_true(packet != NULL);
+		packet->hdr.len = 2;
+		packet->hdr.data = i;
+		mpsc_pbuf_commit(&buffer, (union mpsc_pbuf_generic *)packet);
+
+		packet = (struct test_data_var *)mpsc_pbuf_claim(&buffer);
+		zassert_true(packet != NULL);
+		zassert_equal(packet->hdr.len, 2);
+		zassert_equal(packet->hdr.data, i);
+		mpsc_pbuf_free(&buffer, (union mpsc_pbuf_generic *)packet);
+	}
+
+	zassert_is_null(mpsc_pbuf_claim(&buffer));
+	zassert_false(mpsc_pbuf_is_pending(&buffer));
+}
+
+ZTEST(log_buffer, test_item_alloc_discard)
+{
+	item_alloc_discard(false);
+	item_alloc_discard(true);
+}
+
 void item_max_alloc(bool overwrite)
 {
 	struct mpsc_pbuf_buffer buffer;
@@ -274,5 +274,37 @@ ZTEST(lib_p4wq_1cpu, test_p4wq_simple)
 	zassert_true(has_run, "high-priority item didn't run");
 }
 
+#ifdef CONFIG_P4WQ_PER_CPU
+static volatile int run_cpu;
+
+static void cpu_handler(struct k_p4wq_work *work)
+{
+	unsigned int key = arch_irq_lock();
+
+	run_cpu = arch_curr_cpu()->id;
+	arch_irq_unlock(key);
+	has_run = true;
+}
+
+/* Items restricted to a CPU run on it */
+ZTEST(lib_p4wq, test_cpu_mask)
+{
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		simple_item = (struct k_p4wq_work){};
+		simple_item.priority = 1;
+		simple_item.handler = cpu_handler;
+		simple_item.cpu_mask = BIT(cpu);
+
+		has_run = false;
+		run_cpu = -1;
+		k_p4wq_submit(&wq, &simple_item);
+
+		k_msleep(10);
+		zassert_true(has_run, "item didn't run");
+		zassert_equal(run_cpu, cpu, "item ran on CPU %d, not %u", run_cpu, cpu);
+	}
+}
+#endif /* CONFIG_P4WQ_PER_CPU */
+
 ZTEST_SUITE(lib_p4wq, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(lib_p4wq_1cpu, NULL, NULL, ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -70,6 +70,7 @@ static void var_destroy(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, 128, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_FIXED_DEFINE(bulk_pool, 6, 64, 0, NULL);
 
 static void buf_destroy(struct net_buf *buf)
 {
@@ -461,6 +462,49 @@ ZTEST(net_buf_tests, test_net_buf_var_pool)
 	zassert_equal(destroy_called, 3, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_bulk)
+{
+	struct net_buf *bufs[8];
+	struct net_buf *var_buf, *held;
+	int n;
+
+	destroy_called = 0;
+
+	/* Never used buffers, then only what the pool has */
+	n = net_buf_alloc_bulk(&bulk_pool, bufs, ARRAY_SIZE(bufs), K_NO_WAIT);
+	zassert_equal(n, 6, "Got %d buffers", n);
+	for (int i = 0; i < n; i++) {
+		zassert_equal(bufs[i]->ref, 1, "Invalid ref count");
+		zassert_equal(bufs[i]->size, 64, "Invalid buffer size");
+		net_buf_add_u8(bufs[i], i);
+	}
+	zassert_equal(net_buf_alloc_bulk(&bulk_pool, bufs + n, 1, K_NO_WAIT),
+		      -ENOMEM, "Allocated from an empty pool");
+
+	net_buf_unref_bulk(bufs, n);
+
+	/* Recycled buffers, freed with fragments and a foreign pool */
+	n = net_buf_alloc_len_bulk(&bulk_pool, 32, bufs, 4, K_NO_WAIT);
+	zassert_equal(n, 4, "Got %d buffers", n);
+	zassert_equal(bufs[0]->len, 0, "Buffer not reset");
+
+	var_buf = net_buf_alloc_len(&var_pool, 20, K_NO_WAIT);
+	zassert_not_null(var_buf, "Failed to get buffer");
+	net_buf_frag_add(bufs[0], var_buf);
+	net_buf_frag_add(bufs[0], bufs[1]);
+	held = net_buf_ref(bufs[2]);
+	bufs[1] = bufs[3];
+
+	net_buf_unref_bulk(bufs, 3);
+	zassert_equal(destroy_called, 1, "Incorrect destroy callback count");
+	zassert_equal(held->ref, 1, "Extra reference dropped");
+	net_buf_unref(held);
+
+	n = net_buf_alloc_bulk(&bulk_pool, bufs, ARRAY_SIZE(bufs), K_NO_WAIT);
+	zassert_equal(n, 6, "Buffers not all returned, got %d", n);
+	net_buf_unref_bulk(bufs, n);
+}
+
 ZTEST(net_buf_tests, test_net_buf_byte_order)
 {
 	struct net_buf *buf;
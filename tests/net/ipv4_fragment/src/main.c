@@ -873,6 +873,78 @@ ZTEST(net_ipv4_fragment, test_do_not_fragment)
 	zassert_equal(pkt_recv_size, pkt_recv_expected_size, "Packet size mismatch");
 }
 
+/* Callback function for finding a reassembly by its identification */
+static void reassembly_find_cb(struct net_ipv4_reassembly *reassembly, void *data)
+{
+	uint16_t *id = data;
+
+	if (reassembly->id == *id) {
+		*id = 0;
+	}
+}
+
+static bool reassembly_pending(uint16_t id)
+{
+	net_ipv4_frag_foreach(reassembly_find_cb, &id);
+
+	return id == 0;
+}
+
+/* Test that the oldest incomplete packet is evicted when all the reassembly slots are used */
+ZTEST(net_ipv4_fragment, test_fragment_evict)
+{
+	struct net_pkt *pkt;
+	uint8_t packets;
+	uint16_t id;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT_EVICT)) {
+		ztest_test_skip();
+	}
+
+	for (id = 1; id <= CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT + 1; id++) {
+		pkt = net_pkt_alloc_with_buffer(iface1, sizeof(ipv4_udp_frag), AF_INET,
+						IPPROTO_UDP, ALLOC_TIMEOUT);
+		zassert_not_null(pkt, "Packet creation failure");
+
+		net_pkt_set_family(pkt, AF_INET);
+		net_pkt_set_ip_hdr_len(pkt, sizeof(struct net_ipv4_hdr));
+
+		net_pkt_cursor_init(pkt);
+		ret = net_pkt_write(pkt, ipv4_udp_frag, sizeof(ipv4_udp_frag));
+		zassert_equal(ret, 0, "IPv4 fragmented frame append failed");
+
+		/* Each fragment belongs to a different packet */
+		net_pkt_cursor_init(pkt);
+		net_pkt_set_overwrite(pkt, true);
+		sys_put_be16(id, NET_IPV4_HDR(pkt)->id);
+		NET_IPV4_HDR(pkt)->chksum = net_calc_chksum_ipv4(pkt);
+		net_pkt_set_overwrite(pkt, false);
+
+		net_pkt_set_iface(pkt, iface1);
+		ret = net_recv_data(net_pkt_iface(pkt), pkt);
+		zassert_equal(ret, 0, "Cannot receive data (%d)", ret);
+
+		k_sleep(K_MSEC(10));
+	}
+
+	packets = 0;
+	net_ipv4_frag_foreach(reassembly_foreach_cb, &packets);
+	zassert_equal(packets, CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT,
+		      "Expected all reassembly slots to be used");
+
+	zassert_false(reassembly_pending(1), "Expected the oldest packet to be evicted");
+	zassert_true(reassembly_pending(CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT + 1),
+		     "Expected the newest packet to be pending");
+
+	/* Let the remaining reassemblies time out */
+	k_sleep(K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT + 1));
+
+	packets = 0;
+	net_ipv4_frag_foreach(reassembly_foreach_cb, &packets);
+	zassert_equal(packets, 0, "Expected fragments to be dropped after timeout");
+}
+
 static void test_pre(void *ptr)
 {
 	k_sem_reset(&wait_data);
@@ -268,6 +268,54 @@ ZTEST(coap_client, test_send_large_data)
 	zassert_equal(last_response_code, COAP_RESPONSE_CODE_OK, "Unexpected response");
 }
 
+static size_t streamed_len;
+
+static int stream_payload(size_t offset, const uint8_t **payload, size_t *len, bool *last_block,
+			  void *user_data)
+{
+	size_t total = strlen(long_payload);
+
+	zassert_true(offset < total, "Invalid offset %zu", offset);
+
+	*payload = long_payload + offset;
+	*len = MIN(*len, total - offset);
+	*last_block = offset + *len == total;
+
+	streamed_len = MAX(streamed_len, offset + *len);
+
+	return 0;
+}
+
+ZTEST(coap_client, test_send_streamed_data)
+{
+	int ret = 0;
+	struct sockaddr address = {0};
+	struct coap_client_request client_request = {
+		.method = COAP_METHOD_PUT,
+		.confirmable = true,
+		.path = test_path,
+		.fmt = COAP_CONTENT_FORMAT_TEXT_PLAIN,
+		.cb = coap_callback,
+		.payload = NULL,
+		.len = 0,
+		.payload_cb = stream_payload
+	};
+
+	streamed_len = 0;
+
+	k_sleep(K_MSEC(1));
+
+	LOG_INF("Send request");
+	ret = coap_client_req(&client, 0, &address, &client_request, -1);
+	zassert_true(ret >= 0, "Sending request failed, %d", ret);
+	set_socket_events(ZSOCK_POLLIN);
+
+	k_sleep(K_MSEC(5));
+	k_sleep(K_MSEC(1000));
+	zassert_equal(last_response_code, COAP_RESPONSE_CODE_OK, "Unexpected response");
+	zassert_equal(streamed_len, strlen(long_payload), "Payload not fully sent");
+}
+
 ZTEST(coap_client, test_no_response)
 {
 	int ret = 0;
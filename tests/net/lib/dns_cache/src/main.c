@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/net_ip.h>
+#include <dns_cache.h>
+
+#define NAME "www.example.com"
+
+static struct dns_addrinfo info[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES];
+
+static void make_addr(struct dns_addrinfo *ai, uint8_t last)
+{
+	struct sockaddr_in *addr = net_sin(&ai->ai_addr);
+
+	memset(ai, 0, sizeof(*ai));
+	ai->ai_family = AF_INET;
+	ai->ai_addrlen = sizeof(struct sockaddr_in);
+	addr->sin_family = AF_INET;
+	addr->sin_addr.s4_addr[0] = 192;
+	addr->sin_addr.s4_addr[1] = 0;
+	addr->sin_addr.s4_addr[2] = 2;
+	addr->sin_addr.s4_addr[3] = last;
+}
+
+static void add_addr(const char *name, uint8_t last, uint32_t ttl)
+{
+	struct dns_addrinfo ai;
+
+	make_addr(&ai, last);
+	dns_cache_add(name, DNS_QUERY_TYPE_A, &ai, ttl);
+}
+
+static uint8_t addr_last(struct dns_addrinfo *ai)
+{
+	return net_sin(&ai->ai_addr)->sin_addr.s4_addr[3];
+}
+
+ZTEST(dns_cache, test_add_find)
+{
+	int ret;
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     NULL);
+	zassert_equal(ret, 0, "Name found in an empty cache");
+
+	add_addr(NAME, 1, 60);
+	add_addr(NAME, 2, 60);
+	/* Adding an address again only updates it */
+	add_addr(NAME, 1, 60);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     NULL);
+	zassert_equal(ret, 2, "Invalid number of addresses (%d)", ret);
+	zassert_equal(addr_last(&info[0]) + addr_last(&info[1]), 3,
+		      "Invalid addresses");
+
+	/* Names are not case sensitive */
+	ret = dns_cache_find("WWW.Example.com", DNS_QUERY_TYPE_A, info,
+			     ARRAY_SIZE(info), NULL);
+	zassert_equal(ret, 2, "Name not found (%d)", ret);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_AAAA, info,
+			     ARRAY_SIZE(info), NULL);
+	zassert_equal(ret, 0, "Name found with another type");
+
+	/* Only as many addresses as there is room for are returned */
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, 1, NULL);
+	zassert_equal(ret, 1, "Invalid number of addresses (%d)", ret);
+}
+
+ZTEST(dns_cache, test_expiry)
+{
+	int ret;
+
+	add_addr(NAME, 1, 1);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     NULL);
+	zassert_equal(ret, 1, "Name not found (%d)", ret);
+
+	k_msleep(MSEC_PER_SEC + 100);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     NULL);
+	zassert_equal(ret, 0, "Expired name found");
+
+	/* A time to live of 0 means that the answer must not be cached */
+	add_addr(NAME, 1, 0);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     NULL);
+	zassert_equal(ret, 0, "Uncacheable name found");
+}
+
+ZTEST(dns_cache, test_negative)
+{
+	int ret;
+
+	add_addr(NAME, 1, 60);
+	dns_cache_add_negative(NAME, DNS_QUERY_TYPE_A);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     NULL);
+	zassert_equal(ret, -ENOENT, "Name not negatively cached (%d)", ret);
+
+	/* An address replaces the negative answer */
+	add_addr(NAME, 2, 60);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     NULL);
+	zassert_equal(ret, 1, "Invalid number of addresses (%d)", ret);
+	zassert_equal(addr_last(&info[0]), 2, "Invalid address");
+
+	dns_cache_add_negative(NAME, DNS_QUERY_TYPE_A);
+
+	k_msleep(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL * MSEC_PER_SEC + 100);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     NULL);
+	zassert_equal(ret, 0, "Expired negative answer found");
+}
+
+ZTEST(dns_cache, test_full)
+{
+	int ret;
+
+	add_addr("a.example.com", 1, 60);
+	add_addr("b.example.com", 2, 30);
+	add_addr("c.example.com", 3, 90);
+
+	/* The entry that expires first is replaced */
+	add_addr("d.example.com", 4, 60);
+
+	ret = dns_cache_find("b.example.com", DNS_QUERY_TYPE_A, info,
+			     ARRAY_SIZE(info), NULL);
+	zassert_equal(ret, 0, "Replaced name found");
+
+	ret = dns_cache_find("d.example.com", DNS_QUERY_TYPE_A, info,
+			     ARRAY_SIZE(info), NULL);
+	zassert_equal(ret, 1, "New name not found (%d)", ret);
+}
+
+ZTEST(dns_cache, test_refresh)
+{
+	struct dns_resolve_cache_stats before, after;
+	bool refresh;
+	int ret;
+
+	dns_resolve_cache_get_stats(&before);
+
+	add_addr(NAME, 1, 1);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     &refresh);
+	zassert_equal(ret, 1, "Name not found (%d)", ret);
+	zassert_false(refresh, "Refresh requested too early");
+
+	/* Within the last tenth of the time to live */
+	k_msleep(MSEC_PER_SEC - 50);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     &refresh);
+	zassert_equal(ret, 1, "Name not found (%d)", ret);
+	zassert_true(refresh, "Refresh not requested");
+
+	/* Requested only once */
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     &refresh);
+	zassert_equal(ret, 1, "Name not found (%d)", ret);
+	zassert_false(refresh, "Refresh requested twice");
+
+	/* The answer of the refresh query is cached for its whole time to
+	 * live again.
+	 */
+	add_addr(NAME, 1, 60);
+
+	ret = dns_cache_find(NAME, DNS_QUERY_TYPE_A, info, ARRAY_SIZE(info),
+			     &refresh);
+	zassert_equal(ret, 1, "Name not found (%d)", ret);
+	zassert_false(refresh, "Refresh requested after the refresh");
+
+	ret = dns_cache_find("other.example.com", DNS_QUERY_TYPE_A, info,
+			     ARRAY_SIZE(info), &refresh);
+	zassert_equal(ret, 0, "Unknown name found");
+
+	dns_resolve_cache_get_stats(&after);
+
+	zassert_equal(after.hits - before.hits, 4, "Invalid hits");
+	zassert_equal(after.misses - before.misses, 1, "Invalid misses");
+	zassert_equal(after.prefetches - before.prefetches, 1,
+		      "Invalid prefetches");
+}
+
+static void cache_flush(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	dns_resolve_cache_flush();
+}
+
+ZTEST_SUITE(dns_cache, NULL, NULL, cache_flush, NULL, NULL);
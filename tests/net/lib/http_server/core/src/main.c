@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http/server.h>
+
+#define SERVER_ADDR "127.0.0.1"
+
+static const char index_html[] = "<html>hello</html>";
+
+static struct http_resource_detail_static index_detail = {
+	.common = {
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET) | BIT(HTTP_HEAD),
+		.type = HTTP_RESOURCE_TYPE_STATIC,
+		.content_type = "text/html",
+	},
+	.static_data = index_html,
+	.static_data_len = sizeof(index_html) - 1,
+};
+
+/* Echoes the body of the request */
+static int echo_cb(struct http_client_ctx *client, const uint8_t *data,
+		   size_t len, bool final, void *user_data)
+{
+	int ret;
+
+	ARG_UNUSED(user_data);
+
+	ret = http_server_response_begin(client, HTTP_200_OK);
+	if (ret < 0 && ret != -EALREADY) {
+		return ret;
+	}
+
+	ret = http_server_response_write(client, data, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return final ? http_server_response_end(client) : 0;
+}
+
+static struct http_resource_detail_dynamic echo_detail = {
+	.common = {
+		.bitmask_of_supported_http_methods = BIT(HTTP_POST),
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+	},
+	.cb = echo_cb,
+};
+
+static uint16_t test_service_port;
+
+HTTP_SERVICE_DEFINE(test_service, SERVER_ADDR, &test_service_port, 4, 2, NULL);
+HTTP_RESOURCE_DEFINE(index_resource, test_service, "/index.html",
+		     &index_detail);
+HTTP_RESOURCE_DEFINE(echo_resource, test_service, "/echo", &echo_detail);
+
+static char response[512];
+
+static int client_connect(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(test_service_port),
+	};
+	int sock;
+	int ret;
+
+	zsock_inet_pton(AF_INET, SERVER_ADDR, &addr.sin_addr);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(sock >= 0, "Cannot create socket (%d)", errno);
+
+	ret = zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr));
+	zassert_equal(ret, 0, "Cannot connect (%d)", errno);
+
+	return sock;
+}
+
+static void client_send(int sock, const char *request)
+{
+	int ret;
+
+	ret = zsock_send(sock, request, strlen(request), 0);
+	zassert_equal(ret, strlen(request), "Cannot send (%d)", errno);
+}
+
+/* Receives until the response contains @p end, or the connection is
+ * closed.
+ */
+static size_t client_recv(int sock, const char *end)
+{
+	size_t len = 0;
+	int ret;
+
+	while (len < sizeof(response) - 1) {
+		ret = zsock_recv(sock, &response[len],
+				 sizeof(response) - 1 - len, 0);
+		zassert_true(ret >= 0, "Cannot receive (%d)", errno);
+		if (ret == 0) {
+			break;
+		}
+
+		len += ret;
+		response[len] = '\0';
+
+		if (end != NULL && strstr(response, end) != NULL) {
+			break;
+		}
+	}
+
+	response[len] = '\0';
+
+	return len;
+}
+
+static int count_matches(const char *str, const char *pattern)
+{
+	int count = 0;
+
+	while ((str = strstr(str, pattern)) != NULL) {
+		count++;
+		str += strlen(pattern);
+	}
+
+	return count;
+}
+
+ZTEST(http_server, test_static_keep_alive)
+{
+	int sock = client_connect();
+
+	client_send(sock, "GET /index.html HTTP/1.1\r\nHost: test\r\n\r\n");
+	client_recv(sock, index_html);
+
+	zassert_not_null(strstr(response, "HTTP/1.1 200 OK\r\n"),
+			 "Invalid status: %s", response);
+	zassert_not_null(strstr(response, "Content-Type: text/html\r\n"),
+			 "No content type: %s", response);
+	zassert_is_null(strstr(response, "Connection: close"),
+			"Connection not kept alive: %s", response);
+
+	/* The same connection serves the next request */
+	client_send(sock, "HEAD /index.html HTTP/1.1\r\nHost: test\r\n\r\n");
+	client_recv(sock, "\r\n\r\n");
+
+	zassert_not_null(strstr(response, "HTTP/1.1 200 OK\r\n"),
+			 "Invalid status: %s", response);
+	zassert_is_null(strstr(response, index_html), "Body sent for HEAD");
+
+	zsock_close(sock);
+}
+
+ZTEST(http_server, test_pipelining)
+{
+	int sock = client_connect();
+
+	client_send(sock,
+		    "GET /index.html HTTP/1.1\r\nHost: test\r\n\r\n"
+		    "GET /missing HTTP/1.1\r\nHost: test\r\n\r\n"
+		    "PUT /index.html HTTP/1.1\r\nHost: test\r\n"
+		    "Content-Length: 0\r\nConnection: close\r\n\r\n");
+	client_recv(sock, NULL);
+
+	zassert_equal(count_matches(response, "HTTP/1.1 "), 3,
+		      "Invalid number of responses: %s", response);
+
+	/* The responses come in the order of the requests */
+	zassert_true(strstr(response, "200 OK") <
+		     strstr(response, "404 Not Found"),
+		     "Invalid order: %s", response);
+	zassert_true(strstr(response, "404 Not Found") <
+		     strstr(response, "405 Method Not Allowed"),
+		     "Invalid order: %s", response);
+
+	zsock_close(sock);
+}
+
+ZTEST(http_server, test_dynamic_chunked)
+{
+	int sock = client_connect();
+
+	client_send(sock, "POST /echo HTTP/1.1\r\nHost: test\r\n"
+			  "Content-Length: 5\r\n\r\nhello");
+	client_recv(sock, "0\r\n\r\n");
+
+	zassert_not_null(strstr(response, "Transfer-Encoding: chunked\r\n"),
+			 "Response not chunked: %s", response);
+	zassert_not_null(strstr(response, "5\r\nhello\r\n"),
+			 "Invalid body: %s", response);
+
+	zsock_close(sock);
+}
+
+ZTEST(http_server, test_limits)
+{
+	static char request[CONFIG_HTTP_SERVER_MAX_URL_LENGTH + 64];
+	int sock = client_connect();
+	int len;
+
+	len = snprintk(request, sizeof(request), "GET /");
+	memset(&request[len], 'a', CONFIG_HTTP_SERVER_MAX_URL_LENGTH);
+	strcpy(&request[len + CONFIG_HTTP_SERVER_MAX_URL_LENGTH],
+	       " HTTP/1.1\r\n\r\n");
+
+	client_send(sock, request);
+	client_recv(sock, NULL);
+
+	zassert_not_null(strstr(response, "414 URI Too Long"),
+			 "Invalid status: %s", response);
+
+	zsock_close(sock);
+
+	/* An idle connection is closed */
+	sock = client_connect();
+	zassert_equal(client_recv(sock, NULL), 0, "Unexpected data");
+
+	zsock_close(sock);
+}
+
+static void *setup(void)
+{
+	zassert_equal(http_server_start(), 0, "Cannot start the server");
+	zassert_not_equal(test_service_port, 0, "No port assigned");
+
+	return NULL;
+}
+
+ZTEST_SUITE(http_server, NULL, setup, NULL, NULL, NULL);
@@ -354,4 +354,145 @@ ZTEST(mgmt_fn_test_suite, test_mgmt)
 		      "test_synchronous_event_listener failed");
 }
 
+#ifdef CONFIG_NET_MGMT_EVENT_WORKQ
+static K_THREAD_STACK_DEFINE(workq_stack, 1024 + CONFIG_TEST_EXTRA_STACK_SIZE);
+static struct k_work_q workq;
+static struct k_work blocker;
+static K_SEM_DEFINE(blocker_sem, 0, 1);
+static struct net_mgmt_event_callback workq_cb;
+static uint32_t workq_calls;
+
+static void blocker_handler(struct k_work *work)
+{
+	k_sem_take(&blocker_sem, K_FOREVER);
+}
+
+static void workq_start(void)
+{
+	static bool started;
+
+	if (!started) {
+		k_work_queue_start(&workq, workq_stack, K_THREAD_STACK_SIZEOF(workq_stack),
+				   K_PRIO_COOP(8), NULL);
+		k_work_init(&blocker, blocker_handler);
+		started = true;
+	}
+}
+
+static void workq_receiver_cb(struct net_mgmt_event_callback *cb,
+			      uint32_t nm_event, struct net_if *iface)
+{
+	zassert_equal(k_current_get(), k_work_queue_thread_get(&workq),
+		      "handler not run from its work queue");
+	zassert_equal(nm_event, TEST_MGMT_EVENT, "unexpected event");
+	workq_calls++;
+}
+
+static uint32_t workq_deliver(bool coalesce, uint32_t times)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+
+	net_mgmt_init_event_callback(&workq_cb, workq_receiver_cb, TEST_MGMT_EVENT);
+	net_mgmt_event_callback_set_workq(&workq_cb, &workq, coalesce);
+	net_mgmt_add_event_callback(&workq_cb);
+	workq_calls = 0U;
+
+	/* Events pile up while the work queue is busy */
+	k_work_submit_to_queue(&workq, &blocker);
+	for (uint32_t i = 0; i < times; i++) {
+		net_mgmt_event_notify(TEST_MGMT_EVENT, iface);
+	}
+	k_msleep(THREAD_SLEEP);
+	zassert_equal(workq_calls, 0U, "handler run while its work queue is busy");
+
+	k_sem_give(&blocker_sem);
+	k_msleep(THREAD_SLEEP);
+
+	net_mgmt_del_event_callback(&workq_cb);
+
+	return workq_calls;
+}
+
+ZTEST(mgmt_fn_test_suite, test_workq)
+{
+	struct net_mgmt_event_stats stats;
+
+	workq_start();
+
+	zassert_equal(workq_deliver(false, 3), 3U, "events not all delivered");
+	zassert_equal(workq_cb.coalesced, 0U);
+
+	zassert_equal(workq_deliver(true, 3), 1U, "events not coalesced");
+	zassert_equal(workq_cb.coalesced, 2U);
+	zassert_equal(workq_cb.dropped, 0U);
+
+	net_mgmt_event_stats_get(&stats);
+	zassert_equal(stats.coalesced, 2U);
+	zassert_equal(stats.workq_overflows, 0U);
+}
+
+static K_SEM_DEFINE(del_started, 0, 1);
+static K_SEM_DEFINE(del_release, 0, 1);
+static bool del_handler_done;
+
+static void del_release_expiry(struct k_timer *timer)
+{
+	k_sem_give(&del_release);
+}
+
+static K_TIMER_DEFINE(del_release_timer, del_release_expiry, NULL);
+
+static void del_blocked_cb(struct net_mgmt_event_callback *cb,
+			   uint32_t nm_event, struct net_if *iface)
+{
+	k_sem_give(&del_started);
+	k_sem_take(&del_release, K_FOREVER);
+	del_handler_done = true;
+}
+
+static void del_self_cb(struct net_mgmt_event_callback *cb,
+			uint32_t nm_event, struct net_if *iface)
+{
+	workq_calls++;
+	net_mgmt_del_event_callback(cb);
+	k_sem_give(&del_started);
+}
+
+ZTEST(mgmt_fn_test_suite, test_workq_del_running)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+
+	workq_start();
+
+	net_mgmt_init_event_callback(&workq_cb, del_blocked_cb, TEST_MGMT_EVENT);
+	net_mgmt_event_callback_set_workq(&workq_cb, &workq, false);
+	net_mgmt_add_event_callback(&workq_cb);
+	del_handler_done = false;
+
+	net_mgmt_event_notify(TEST_MGMT_EVENT, iface);
+	zassert_ok(k_sem_take(&del_started, K_MSEC(THREAD_SLEEP * 10)),
+		   "handler not run");
+
+	/* Deletion must wait for the blocked handler to return */
+	k_timer_start(&del_release_timer, K_MSEC(THREAD_SLEEP), K_NO_WAIT);
+	net_mgmt_del_event_callback(&workq_cb);
+	zassert_true(del_handler_done, "deleted while the handler runs");
+	zassert_equal(k_work_busy_get(&workq_cb.work), 0, "work not idle");
+
+	/* A handler deleting its own callback */
+	net_mgmt_init_event_callback(&workq_cb, del_self_cb, TEST_MGMT_EVENT);
+	net_mgmt_event_callback_set_workq(&workq_cb, &workq, false);
+	net_mgmt_add_event_callback(&workq_cb);
+	workq_calls = 0U;
+
+	net_mgmt_event_notify(TEST_MGMT_EVENT, iface);
+	zassert_ok(k_sem_take(&del_started, K_MSEC(THREAD_SLEEP * 10)),
+		   "handler did not delete its callback");
+
+	net_mgmt_event_notify(TEST_MGMT_EVENT, iface);
+	k_msleep(THREAD_SLEEP);
+	zassert_equal(workq_calls, 1U, "handler run after its deletion");
+}
+#endif /* CONFIG_NET_MGMT_EVENT_WORKQ */
+
 ZTEST_SUITE(mgmt_fn_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -18,12 +18,14 @@ LOG_MODULE_REGISTER(npf_test, NET_LOG_LEVEL);
 
 #include "ipv4.h"
 #include "ipv6.h"
+#include "udp_internal.h"
 
 #include <zephyr/ztest.h>
 
 #include <zephyr/net/net_if.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/net_pkt_filter.h>
+#include <zephyr/net/capture.h>
 
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 #define DBG(fmt, ...) printk(fmt, ##__VA_ARGS__)
@@ -240,6 +242,66 @@ ZTEST(net_pkt_filter_test_suite, test_npf_example2)
 	zassert_false(npf_remove_all_recv_rules(), "");
 }
 
+/*
+ * Selection of the packets recorded in the capture ring
+ */
+
+#if defined(CONFIG_NET_PKT_FILTER_CAPTURE_HOOK)
+static int capture_export_cb(const void *data, size_t len, void *user_data)
+{
+	size_t *total = user_data;
+
+	ARG_UNUSED(data);
+
+	*total += len;
+
+	return 0;
+}
+#endif
+
+ZTEST(net_pkt_filter_test_suite, test_npf_capture)
+{
+#if defined(CONFIG_NET_PKT_FILTER_CAPTURE_HOOK)
+	struct net_pkt *pkt_ip, *pkt_arp;
+	size_t len = 0;
+	int ret;
+
+	pkt_ip = build_test_pkt(NET_ETH_PTYPE_IP, 100, &dummy_iface_a);
+	pkt_arp = build_test_pkt(NET_ETH_PTYPE_ARP, 100, &dummy_iface_a);
+
+	npf_append_capture_rule(&small_ip_pkt);
+	net_capture_ring_clear();
+
+	net_capture_ring_pkt(&dummy_iface_a, pkt_ip);
+	net_capture_ring_pkt(&dummy_iface_a, pkt_arp);
+
+	ret = net_capture_ring_export(capture_export_cb, &len);
+	zassert_equal(ret, 1, "Invalid number of packets (%d)", ret);
+
+	/* Section header, packet header, truncated packet and trailer */
+	zassert_true(len >= 28 + 28 +
+		     ROUND_UP(MIN(100, CONFIG_NET_CAPTURE_RING_SNAPLEN), 4) + 4,
+		     "Export too short (%zu)", len);
+
+	/* Nothing is recorded while disabled */
+	net_capture_ring_enable(false);
+	net_capture_ring_clear();
+
+	net_capture_ring_pkt(&dummy_iface_a, pkt_ip);
+
+	ret = net_capture_ring_export(capture_export_cb, &len);
+	zassert_equal(ret, 0, "Packet recorded while disabled (%d)", ret);
+
+	net_capture_ring_enable(true);
+
+	zassert_true(npf_remove_all_capture_rules(), "");
+	net_pkt_unref(pkt_ip);
+	net_pkt_unref(pkt_arp);
+#else
+	ztest_test_skip();
+#endif
+}
+
 /*
  * Ethernet MAC address filtering
  */
@@ -483,4 +545,74 @@ ZTEST(net_pkt_filter_test_suite, test_npf_ipv6_address_filtering)
 	net_pkt_unref(pkt_v4);
 }
 
+/*
+ * Port filtering and verdict caching
+ */
+
+static struct net_pkt *build_test_udp_pkt(uint16_t src_port, uint16_t dst_port,
+					  struct net_if *iface)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, sizeof(struct net_udp_hdr), AF_INET,
+					   IPPROTO_UDP, K_NO_WAIT);
+	zassert_not_null(pkt, "");
+
+	ret = net_ipv4_create(pkt, &ipv4_address_list[0], &ipv4_address_list[1]);
+	zassert_equal(ret, 0, "Cannot create IPv4 packet (%d)", ret);
+
+	ret = net_udp_create(pkt, htons(src_port), htons(dst_port));
+	zassert_equal(ret, 0, "Cannot create UDP header (%d)", ret);
+
+	net_pkt_cursor_init(pkt);
+	ret = net_ipv4_finalize(pkt, IPPROTO_UDP);
+	zassert_equal(ret, 0, "Cannot finalize UDP packet (%d)", ret);
+
+	DBG("pkt %p: iface %p ports %u -> %u\n", pkt, iface, src_port, dst_port);
+	return pkt;
+}
+
+static NPF_DST_PORT_RANGE(dst_port_range, 5000, 5000);
+
+static NPF_RULE(accept_dst_port, NET_OK, dst_port_range);
+
+ZTEST(net_pkt_filter_test_suite, test_npf_port_filtering)
+{
+	struct net_pkt *pkt_in = build_test_udp_pkt(4242, 5000, &dummy_iface_a);
+	struct net_pkt *pkt_out = build_test_udp_pkt(4242, 5001, &dummy_iface_a);
+
+	npf_insert_ipv4_recv_rule(&npf_default_drop);
+	npf_insert_ipv4_recv_rule(&accept_dst_port);
+
+	zassert_true(net_pkt_filter_ip_recv_ok(pkt_in), "");
+	zassert_false(net_pkt_filter_ip_recv_ok(pkt_out), "");
+
+	/*
+	 * Changing a test behind the back of the rule list only shows once
+	 * the cached verdicts are flushed by a rule list update.
+	 */
+	dst_port_range.min = 5001;
+	dst_port_range.max = 5001;
+
+	if (IS_ENABLED(CONFIG_NET_PKT_FILTER_VERDICT_CACHE)) {
+		zassert_true(net_pkt_filter_ip_recv_ok(pkt_in), "");
+		zassert_false(net_pkt_filter_ip_recv_ok(pkt_out), "");
+	} else {
+		zassert_false(net_pkt_filter_ip_recv_ok(pkt_in), "");
+		zassert_true(net_pkt_filter_ip_recv_ok(pkt_out), "");
+	}
+
+	zassert_true(npf_remove_ipv4_recv_rule(&npf_default_drop), "");
+
+	zassert_false(net_pkt_filter_ip_recv_ok(pkt_in), "");
+	zassert_true(net_pkt_filter_ip_recv_ok(pkt_out), "");
+
+	zassert_true(npf_remove_all_ipv4_recv_rules(), "");
+	dst_port_range.min = 5000;
+	dst_port_range.max = 5000;
+	net_pkt_unref(pkt_out);
+	net_pkt_unref(pkt_in);
+}
+
 ZTEST_SUITE(net_pkt_filter_test_suite, NULL, test_npf_iface, NULL, NULL, NULL);
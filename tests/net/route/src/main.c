@@ -544,6 +544,64 @@ static void test_route_preference(void)
 	net_route_del(entry);
 }
 
+static void test_route_longest_prefix(void)
+{
+	struct net_route_entry *routes[3];
+	struct net_route_entry *found;
+	struct in6_addr addr;
+
+	/* Nested prefixes of dest_addr: /48, /64 and /128 */
+	routes[0] = net_route_add(my_iface, &dest_addr, 48, &peer_addr,
+				  NET_IPV6_ND_INFINITE_LIFETIME,
+				  NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(routes[0], "Route add failed");
+
+	routes[1] = net_route_add(my_iface, &dest_addr, 64, &peer_addr_alt,
+				  NET_IPV6_ND_INFINITE_LIFETIME,
+				  NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(routes[1], "Route add failed");
+	zassert_not_equal(routes[1], routes[0], "Covering route replaced");
+
+	routes[2] = net_route_add(my_iface, &dest_addr, 128, &peer_addr,
+				  NET_IPV6_ND_INFINITE_LIFETIME,
+				  NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(routes[2], "Route add failed");
+
+	found = net_route_lookup(my_iface, &dest_addr);
+	zassert_equal_ptr(found, routes[2], "Host route not found");
+
+	net_ipaddr_copy(&addr, &dest_addr);
+	addr.s6_addr[15]++;
+
+	found = net_route_lookup(my_iface, &addr);
+	zassert_equal_ptr(found, routes[1], "/64 route not found");
+
+	addr.s6_addr[7]++;
+
+	found = net_route_lookup(my_iface, &addr);
+	zassert_equal_ptr(found, routes[0], "/48 route not found");
+
+	addr.s6_addr[5]++;
+
+	found = net_route_lookup(my_iface, &addr);
+	zassert_is_null(found, "Route found outside of the prefixes");
+
+	/* The covering routes are found again once the others are gone */
+	zassert_equal(net_route_del(routes[2]), 0, "Route del failed");
+
+	found = net_route_lookup(my_iface, &dest_addr);
+	zassert_equal_ptr(found, routes[1], "/64 route not found");
+
+	zassert_equal(net_route_del(routes[1]), 0, "Route del failed");
+
+	found = net_route_lookup(my_iface, &dest_addr);
+	zassert_equal_ptr(found, routes[0], "/48 route not found");
+
+	zassert_equal(net_route_del(routes[0]), 0, "Route del failed");
+
+	found = net_route_lookup(my_iface, &dest_addr);
+	zassert_is_null(found, "Route found after deletion");
+}
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +624,7 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <stdio.h>
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket.h>
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define STRLEN(buf) (sizeof(buf) - 1)
+
+#define TEST_STR_SMALL "test"
+
+#define MY_IPV6_ADDR "::1"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+/* On QEMU, waiting takes +10ms from the requested time. */
+#define FUZZ 10
+
+static void prepare_udp_pair(int *c_sock, int *s_sock)
+{
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	int res;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, s_sock, &s_addr);
+
+	res = bind(*s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = connect(*c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+}
+
+static void epoll_add(int epfd, int fd, uint32_t events)
+{
+	struct epoll_event event = {
+		.events = events,
+		.data.fd = fd,
+	};
+	int res;
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &event);
+	zassert_equal(res, 0, "epoll_ctl failed (%d)", errno);
+}
+
+ZTEST(net_socket_epoll, test_level_triggered)
+{
+	struct epoll_event events[2];
+	struct pollfd pollfd;
+	uint32_t tstamp;
+	int c_sock;
+	int s_sock;
+	int epfd;
+	ssize_t len;
+	char buf[10];
+	int res;
+
+	prepare_udp_pair(&c_sock, &s_sock);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed (%d)", errno);
+
+	epoll_add(epfd, c_sock, EPOLLIN);
+	epoll_add(epfd, s_sock, EPOLLIN);
+
+	/* Nothing ready */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	tstamp = k_uptime_get_32();
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	tstamp = k_uptime_get_32() - tstamp;
+	zassert_true(tstamp >= 30U && tstamp <= 30 + FUZZ * 2, "tstamp %d",
+		     tstamp);
+	zassert_equal(res, 0, "");
+
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLIN, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* Still reported until the data is read */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	len = recv(s_sock, BUF_AND_SIZE(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* The instance itself can be polled */
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	memset(&pollfd, 0, sizeof(pollfd));
+	pollfd.fd = epfd;
+	pollfd.events = POLLIN;
+
+	res = poll(&pollfd, 1, 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(pollfd.revents, POLLIN, "");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_edge_triggered)
+{
+	struct epoll_event events[1];
+	int c_sock;
+	int s_sock;
+	int epfd;
+	ssize_t len;
+	char buf[10];
+	int res;
+
+	prepare_udp_pair(&c_sock, &s_sock);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed (%d)", errno);
+
+	epoll_add(epfd, s_sock, EPOLLIN | EPOLLET);
+
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* Reported once, although the data is still there */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* New data is a new event */
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	for (int i = 0; i < 2; i++) {
+		len = recv(s_sock, BUF_AND_SIZE(buf), 0);
+		zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+	}
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_ctl)
+{
+	struct epoll_event event = { .events = EPOLLIN };
+	struct epoll_event events[1];
+	int c_sock;
+	int s_sock;
+	int epfd;
+	ssize_t len;
+	int res;
+
+	prepare_udp_pair(&c_sock, &s_sock);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed (%d)", errno);
+
+	epoll_add(epfd, s_sock, EPOLLIN | EPOLLONESHOT);
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, s_sock, &event);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EEXIST, "");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_MOD, c_sock, &event);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	/* An epoll instance cannot watch itself */
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, epfd, &event);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+
+	/* Disabled by EPOLLONESHOT until modified */
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	event.data.fd = s_sock;
+	res = epoll_ctl(epfd, EPOLL_CTL_MOD, s_sock, &event);
+	zassert_equal(res, 0, "epoll_ctl failed (%d)", errno);
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "epoll_ctl failed (%d)", errno);
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* Closing a file descriptor removes it from the instance */
+	epoll_add(epfd, s_sock, EPOLLIN);
+
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, -1, "");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_socketpair)
+{
+	struct epoll_event events[2];
+	int epfd;
+	int sv[2];
+	char c;
+	int res;
+
+	res = socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+	zassert_equal(res, 0, "socketpair() failed: %d", errno);
+
+	epfd = epoll_create1(0);
+	zassert_true(epfd >= 0, "epoll_create1 failed (%d)", errno);
+
+	epoll_add(epfd, sv[1], EPOLLIN);
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	res = send(sv[0], "x", 1, 0);
+	zassert_equal(res, 1, "send failed");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, EPOLLIN, "");
+	zassert_equal(events[0].data.fd, sv[1], "");
+
+	res = recv(sv[1], &c, 1, 0);
+	zassert_equal(res, 1, "recv failed");
+
+	res = epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+	res = close(sv[0]);
+	zassert_equal(res, 0, "close failed");
+	res = close(sv[1]);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, NULL, NULL, NULL, NULL);
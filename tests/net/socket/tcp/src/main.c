@@ -11,6 +11,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <fcntl.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/loopback.h>
+#include <zephyr/net/buf.h>
 
 #include "../../socket_helpers.h"
 
@@ -1188,6 +1189,105 @@ ZTEST(net_socket_tcp, test_so_protocol)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_tcp_congestion)
+{
+	struct sockaddr_in bind_addr4;
+	int sock, rv;
+	char name[16];
+	socklen_t optlen = sizeof(name);
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_CONTROL);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optlen, strlen(name) + 1, "getsockopt got invalid size");
+
+	rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno",
+			strlen("reno"));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	optlen = sizeof(name);
+	rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(strcmp(name, "reno"), 0,
+		      "getsockopt got invalid algorithm");
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CC_CUBIC)) {
+		rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "cubic",
+				sizeof("cubic"));
+		zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+	}
+
+	rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "unknown",
+			strlen("unknown"));
+	zassert_equal(rv, -1, "setsockopt accepted an unknown algorithm");
+	zassert_equal(errno, ENOENT, "setsockopt failed with %d", errno);
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
+ZTEST(net_socket_tcp, test_v4_recv_zc)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *frags;
+	char data[sizeof(TEST_STR_SMALL)];
+	ssize_t len;
+	int rv;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_SOCKETS_RECV_ZC);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	len = zsock_recv_zc(new_sock, &frags, MSG_PEEK);
+	zassert_equal(len, -1, "MSG_PEEK should not be supported");
+	zassert_equal(errno, EOPNOTSUPP, "unexpected errno %d", errno);
+
+	len = zsock_recv_zc(new_sock, &frags, 0);
+	zassert_equal(len, strlen(TEST_STR_SMALL), "invalid recv_zc len");
+	zassert_not_null(frags, "no data returned");
+	zassert_equal(net_buf_frags_len(frags), len, "invalid frags len");
+
+	net_buf_linearize(data, sizeof(data), frags, 0, len);
+	zassert_mem_equal(data, TEST_STR_SMALL, len, "invalid data");
+
+	rv = zsock_recv_zc_release(new_sock, frags);
+	zassert_equal(rv, 0, "release failed (%d)", errno);
+
+	len = zsock_recv_zc(new_sock, &frags, MSG_DONTWAIT);
+	zassert_equal(len, -1, "recv_zc should fail without data");
+	zassert_equal(errno, EAGAIN, "unexpected errno %d", errno);
+
+	test_close(c_sock);
+
+	len = zsock_recv_zc(new_sock, &frags, 0);
+	zassert_equal(len, 0, "recv_zc should report EOF");
+	zassert_is_null(frags, "no data expected at EOF");
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_so_rcvbuf)
 {
 	struct sockaddr_in bind_addr4;
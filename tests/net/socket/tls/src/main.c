@@ -603,6 +603,92 @@ ZTEST(net_socket_tls, test_v6_dtls_sendmsg)
 			  (struct sockaddr *)&server_addr, sizeof(server_addr));
 }
 
+ZTEST(net_socket_tls, test_v4_dtls_cid)
+{
+	static const uint8_t server_cid[] = { 0x01, 0x02, 0x03, 0x04 };
+	uint8_t cid[sizeof(server_cid)];
+	socklen_t cidlen = sizeof(cid);
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	uint8_t rx_buf[sizeof(TEST_STR_SMALL) - 1];
+	int role = TLS_DTLS_ROLE_SERVER;
+	int mode = TLS_DTLS_CID_ENABLED;
+	int status;
+	socklen_t optlen = sizeof(status);
+	struct iovec iov = {
+		.iov_base = TEST_STR_SMALL,
+		.iov_len = sizeof(TEST_STR_SMALL) - 1,
+	};
+	struct msghdr msg = {
+		.msg_iov = &iov,
+		.msg_iovlen = 1,
+	};
+	struct test_sendmsg_data test_data = {
+		.msg = &msg,
+	};
+	int rv;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_MBEDTLS_SSL_DTLS_CONNECTION_ID);
+
+	prepare_sock_dtls_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr, IPPROTO_DTLS_1_2);
+	prepare_sock_dtls_v4(MY_IPV4_ADDR, ANY_PORT, &server_sock, &server_addr, IPPROTO_DTLS_1_2);
+
+	test_config_psk(server_sock, client_sock);
+
+	rv = setsockopt(server_sock, SOL_TLS, TLS_DTLS_ROLE, &role, sizeof(role));
+	zassert_equal(rv, 0, "failed to set DTLS server role");
+
+	rv = setsockopt(server_sock, SOL_TLS, TLS_DTLS_CID, &mode, sizeof(mode));
+	zassert_equal(rv, 0, "failed to enable server CID");
+	rv = setsockopt(server_sock, SOL_TLS, TLS_DTLS_CID_VALUE, server_cid,
+			sizeof(server_cid));
+	zassert_equal(rv, 0, "failed to set server CID");
+	rv = setsockopt(client_sock, SOL_TLS, TLS_DTLS_CID, &mode, sizeof(mode));
+	zassert_equal(rv, 0, "failed to enable client CID");
+
+	rv = getsockopt(client_sock, SOL_TLS, TLS_DTLS_CID_STATUS, &status, &optlen);
+	zassert_equal(rv, 0, "failed to get CID status");
+	zassert_equal(status, TLS_DTLS_CID_STATUS_DISABLED, "CID in use before handshake");
+
+	rv = bind(server_sock, (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = bind(client_sock, (struct sockaddr *)&client_addr, sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	rv = connect(client_sock, (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "connect failed");
+
+	test_data.sock = client_sock;
+	k_work_init_delayable(&test_data.tx_work, test_sendmsg_tx_work_handler);
+	k_work_reschedule(&test_data.tx_work, K_MSEC(10));
+
+	rv = recv(server_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(rv, sizeof(TEST_STR_SMALL) - 1, "recv failed");
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, sizeof(TEST_STR_SMALL) - 1, "invalid rx data");
+
+	rv = getsockopt(client_sock, SOL_TLS, TLS_DTLS_CID_STATUS, &status, &optlen);
+	zassert_equal(rv, 0, "failed to get CID status");
+	zassert_equal(status, TLS_DTLS_CID_STATUS_BIDIRECTIONAL, "invalid client CID status");
+
+	rv = getsockopt(server_sock, SOL_TLS, TLS_DTLS_CID_STATUS, &status, &optlen);
+	zassert_equal(rv, 0, "failed to get CID status");
+	zassert_equal(status, TLS_DTLS_CID_STATUS_BIDIRECTIONAL, "invalid server CID status");
+
+	/* The client sends records with the CID chosen by the server */
+	rv = getsockopt(client_sock, SOL_TLS, TLS_DTLS_PEER_CID_VALUE, cid, &cidlen);
+	zassert_equal(rv, 0, "failed to get peer CID");
+	zassert_equal(cidlen, sizeof(server_cid), "invalid peer CID length");
+	zassert_mem_equal(cid, server_cid, sizeof(server_cid), "invalid peer CID");
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 struct close_data {
 	struct k_work_delayable work;
 	int fd;
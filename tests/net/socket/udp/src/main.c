@@ -1286,4 +1286,175 @@ ZTEST(net_socket_udp, test_23_v6_dgram_overflow)
 			    BUF_AND_SIZE(test_str_all_tx_bufs));
 }
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+static K_SEM_DEFINE(zerocopy_sem, 0, 1);
+static uint32_t zerocopy_id;
+
+static void zerocopy_cb(uint32_t id, void *user_data)
+{
+	zerocopy_id = id;
+	k_sem_give(&zerocopy_sem);
+}
+#endif
+
+ZTEST(net_socket_udp, test_24_v4_sendmsg_zerocopy)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_CONTEXT_ZEROCOPY);
+
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct zsock_zerocopy_cb zc = { .cb = zerocopy_cb };
+	static char tx_buf[] = TEST_STR2;
+	char rx_buf[sizeof(tx_buf)];
+	struct iovec io_vector[2];
+	struct msghdr msg;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = bind(server_sock, (struct sockaddr *)&server_addr,
+		  sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = setsockopt(client_sock, SOL_SOCKET, SO_ZEROCOPY_CB, &zc, sizeof(zc));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	/* Split the data so that it is referenced by two buffers */
+	io_vector[0].iov_base = tx_buf;
+	io_vector[0].iov_len = 10;
+	io_vector[1].iov_base = tx_buf + 10;
+	io_vector[1].iov_len = STRLEN(TEST_STR2) - 10;
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+	msg.msg_name = &server_addr;
+	msg.msg_namelen = sizeof(server_addr);
+
+	rv = sendmsg(client_sock, &msg, MSG_ZEROCOPY);
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendmsg failed (%d)", errno);
+
+	rv = k_sem_take(&zerocopy_sem, K_MSEC(100));
+	zassert_equal(rv, 0, "no completion");
+	zassert_equal(zerocopy_id, 0, "wrong completion id");
+
+	/* The buffers are released, the next send gets the next id */
+	rv = sendmsg(client_sock, &msg, MSG_ZEROCOPY);
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendmsg failed (%d)", errno);
+
+	rv = k_sem_take(&zerocopy_sem, K_MSEC(100));
+	zassert_equal(rv, 0, "no completion");
+	zassert_equal(zerocopy_id, 1, "wrong completion id");
+
+	for (int i = 0; i < 2; i++) {
+		rv = recv(server_sock, rx_buf, sizeof(rx_buf), 0);
+		zassert_equal(rv, STRLEN(TEST_STR2), "recv failed");
+		zassert_mem_equal(rx_buf, TEST_STR2, STRLEN(TEST_STR2),
+				  "wrong data");
+	}
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+#endif
+}
+
+ZTEST_USER(net_socket_udp, test_25_v4_sendmmsg_recvmmsg)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in addr[3];
+	struct iovec tx_iov[3];
+	struct iovec rx_iov[3][2];
+	char bufs[3][2][4];
+	struct mmsghdr msgs[3];
+	struct mmsghdr rx_msgs[4];
+	static const char * const data[] = { "a", "bcdef", "ghijklmnopq" };
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = bind(server_sock, (struct sockaddr *)&server_addr,
+		  sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = bind(client_sock, (struct sockaddr *)&client_addr,
+		  sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		tx_iov[i].iov_base = (void *)data[i];
+		tx_iov[i].iov_len = strlen(data[i]);
+		msgs[i].msg_hdr.msg_iov = &tx_iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &server_addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	rv = sendmmsg(client_sock, msgs, ARRAY_SIZE(msgs), 0);
+	zassert_equal(rv, ARRAY_SIZE(msgs), "sendmmsg failed (%d)", errno);
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_equal(msgs[i].msg_len, strlen(data[i]), "wrong length");
+	}
+
+	/* Let all the datagrams be queued, they are received in one call */
+	k_msleep(100);
+
+	memset(rx_msgs, 0, sizeof(rx_msgs));
+	for (int i = 0; i < ARRAY_SIZE(bufs); i++) {
+		rx_iov[i][0].iov_base = bufs[i][0];
+		rx_iov[i][0].iov_len = sizeof(bufs[i][0]);
+		rx_iov[i][1].iov_base = bufs[i][1];
+		rx_iov[i][1].iov_len = sizeof(bufs[i][1]);
+		rx_msgs[i].msg_hdr.msg_iov = rx_iov[i];
+		rx_msgs[i].msg_hdr.msg_iovlen = 2;
+		rx_msgs[i].msg_hdr.msg_name = &addr[i];
+		rx_msgs[i].msg_hdr.msg_namelen = sizeof(addr[i]);
+	}
+
+	rv = recvmmsg(server_sock, rx_msgs, ARRAY_SIZE(rx_msgs), MSG_DONTWAIT);
+	zassert_equal(rv, ARRAY_SIZE(msgs), "recvmmsg failed (%d)", errno);
+
+	zassert_equal(rx_msgs[0].msg_len, 1, "wrong length");
+	zassert_mem_equal(bufs[0][0], "a", 1, "wrong data");
+
+	/* Scattered over both buffers */
+	zassert_equal(rx_msgs[1].msg_len, 5, "wrong length");
+	zassert_mem_equal(bufs[1][0], "bcde", 4, "wrong data");
+	zassert_mem_equal(bufs[1][1], "f", 1, "wrong data");
+	zassert_equal(rx_msgs[1].msg_hdr.msg_flags, 0, "wrong flags");
+
+	/* Longer than the buffers */
+	zassert_equal(rx_msgs[2].msg_len, 8, "wrong length");
+	zassert_mem_equal(bufs[2][0], "ghij", 4, "wrong data");
+	zassert_mem_equal(bufs[2][1], "klmn", 4, "wrong data");
+	zassert_equal(rx_msgs[2].msg_hdr.msg_flags, MSG_TRUNC, "wrong flags");
+
+	for (int i = 0; i < ARRAY_SIZE(addr); i++) {
+		zassert_equal(rx_msgs[i].msg_hdr.msg_namelen, sizeof(addr[i]),
+			      "wrong address length");
+		zassert_equal(addr[i].sin_family, AF_INET,
+			      "wrong source address family");
+	}
+
+	rv = recvmmsg(server_sock, rx_msgs, ARRAY_SIZE(rx_msgs), MSG_DONTWAIT);
+	zassert_equal(rv, -1, "recvmmsg should fail");
+	zassert_equal(errno, EAGAIN, "wrong errno");
+
+	rv = close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 ZTEST_SUITE(net_socket_udp, NULL, NULL, NULL, NULL, NULL);
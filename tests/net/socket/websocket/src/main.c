@@ -398,6 +398,38 @@ ZTEST(net_websocket, test_send_and_recv_lorem_ipsum)
 	z_free_fd(fd);
 }
 
+ZTEST(net_websocket, test_send_msgv_and_recv_lorem_ipsum)
+{
+	static struct websocket_context ctx;
+	struct iovec iov[3];
+	int fd, ret;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.recv_buf.buf = temp_recv_buf;
+	ctx.recv_buf.size = sizeof(temp_recv_buf);
+
+	test_msg_len = sizeof(lorem_ipsum) - 1;
+
+	/* Parts which do not end on a word boundary */
+	iov[0].iov_base = (void *)lorem_ipsum;
+	iov[0].iov_len = 5;
+	iov[1].iov_base = (void *)&lorem_ipsum[5];
+	iov[1].iov_len = 130;
+	iov[2].iov_base = (void *)&lorem_ipsum[135];
+	iov[2].iov_len = test_msg_len - 135;
+
+	fd = test_fd_alloc(&ctx);
+	ret = websocket_send_msgv(fd, iov, ARRAY_SIZE(iov),
+				  WEBSOCKET_OPCODE_DATA_TEXT, true, true,
+				  SYS_FOREVER_MS);
+	zassert_equal(ret, test_msg_len,
+		      "Should have sent %zd bytes but sent %d instead",
+		      test_msg_len, ret);
+
+	z_free_fd(fd);
+}
+
 ZTEST(net_websocket, test_recv_two_large_split_msg)
 {
 	static struct websocket_context ctx;
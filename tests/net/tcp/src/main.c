@@ -30,7 +30,8 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
 #include "ipv4.h"
 #include "ipv6.h"
 #include "tcp.h"
-#include "tcp_private.h"
+#include "tcp_internal.h"
+#include "net_private.h"
 #include "net_stats.h"
 
 #include <zephyr/ztest.h>
@@ -125,6 +126,7 @@ static void handle_syn_resend(void);
 static void handle_client_fin_wait_2_test(sa_family_t af, struct tcphdr *th);
 static void handle_client_closing_test(sa_family_t af, struct tcphdr *th);
 static void handle_server_recv_out_of_order(struct net_pkt *pkt);
+static void handle_gso_segment(struct net_pkt *pkt, struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -420,6 +422,9 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case 9:
 		handle_server_recv_out_of_order(pkt);
 		break;
+	case 10:
+		handle_gso_segment(pkt, &th);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -1410,8 +1415,14 @@ static struct out_of_order_check_struct out_of_order_check_list[] = {
 	{ 30, 10, 0, 0}, /* First packet will be out-of-order */
 	{ 20, 12, 0, 0},
 	{ 10,  9, 0, 0}, /* Section with a gap */
+#if defined(CONFIG_NET_TCP_SACK)
+	/* The section with a gap is kept and follows the in-order data */
+	{ 0,  10, 19, 0},
+	{ 19,  1, 40, 0}, /* First sequence complete */
+#else
 	{ 0,  10, 10, 0},
 	{ 10, 10, 40, 0}, /* First sequence complete */
+#endif
 	{ 50,  6, 40, 0},
 	{ 50,  3, 40, 0}, /* Discardable packet */
 	{ 55,  5, 40, 0},
@@ -1539,4 +1550,88 @@ ZTEST(net_tcp, test_server_out_of_order_data)
 	test_server_timeout_out_of_order_data();
 }
 
+#define GSO_MSS 100
+#define GSO_DATA_LEN (3 * GSO_MSS + 42)
+#define GSO_SEQ 1000
+
+static size_t gso_received;
+static int gso_segments;
+
+static void handle_gso_segment(struct net_pkt *pkt, struct tcphdr *th)
+{
+	size_t hdrs_len = net_pkt_ip_hdr_len(pkt) + th->th_off * 4;
+	size_t len = net_pkt_get_len(pkt) - hdrs_len;
+	bool last = (gso_received + len == GSO_DATA_LEN);
+	uint8_t data[GSO_MSS];
+
+	zassert_equal(len, MIN(GSO_MSS, GSO_DATA_LEN - gso_received),
+		      "segment length %zu", len);
+	zassert_equal(ntohl(th->th_seq), GSO_SEQ + gso_received, "wrong seq");
+	zassert_equal(th->th_flags, last ? (PSH | ACK) : ACK, "wrong flags");
+	zassert_equal(net_calc_chksum_ipv4(pkt), 0, "wrong IPv4 checksum");
+	zassert_equal(net_calc_chksum_tcp(pkt), 0, "wrong TCP checksum");
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, hdrs_len);
+	zassert_ok(net_pkt_read(pkt, data, len));
+
+	for (size_t i = 0; i < len; i++) {
+		zassert_equal(data[i], (uint8_t)(gso_received + i),
+			      "wrong data at %zu", gso_received + i);
+	}
+
+	gso_received += len;
+	gso_segments++;
+
+	if (last) {
+		k_sem_give(&test_sem);
+	}
+}
+
+/* Test that a super-packet is split into segments of its GSO size */
+ZTEST(net_tcp, test_gso_segmentation)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	struct net_pkt *pkt;
+	struct tcphdr *th;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_GSO);
+
+	test_case_no = 10;
+	gso_received = 0;
+	gso_segments = 0;
+	k_sem_reset(&test_sem);
+
+	pkt = net_pkt_alloc_with_buffer(iface, sizeof(struct tcphdr) + GSO_DATA_LEN,
+					AF_INET, IPPROTO_TCP, K_NO_WAIT);
+	zassert_not_null(pkt, "super-packet allocation failed");
+	zassert_ok(net_ipv4_create(pkt, &my_addr, &peer_addr));
+
+	th = (struct tcphdr *)net_pkt_get_data(pkt, &tcp_access);
+	zassert_not_null(th);
+	memset(th, 0U, sizeof(struct tcphdr));
+	th->th_sport = htons(MY_PORT);
+	th->th_dport = htons(PEER_PORT);
+	th->th_off = 5;
+	th->th_flags = PSH | ACK;
+	UNALIGNED_PUT(htonl(GSO_SEQ), &th->th_seq);
+	UNALIGNED_PUT(htonl(ack), &th->th_ack);
+	zassert_ok(net_pkt_set_data(pkt, &tcp_access));
+
+	for (int i = 0; i < GSO_DATA_LEN; i++) {
+		zassert_ok(net_pkt_write_u8(pkt, (uint8_t)i));
+	}
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_TCP));
+	net_pkt_set_gso_size(pkt, GSO_MSS);
+
+	zassert_ok(net_tcp_gso_send(pkt));
+	net_pkt_unref(pkt);
+
+	test_sem_take(K_MSEC(100), __LINE__);
+	zassert_equal(gso_segments, DIV_ROUND_UP(GSO_DATA_LEN, GSO_MSS),
+		      "%d segments sent", gso_segments);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
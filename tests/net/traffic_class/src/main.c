@@ -108,6 +108,58 @@ struct eth_context {
 
 static struct eth_context eth_context;
 
+#if defined(CONFIG_NET_NAPI)
+/* Simulated RX ring of a driver polled from the RX thread */
+static K_FIFO_DEFINE(rx_ring);
+static struct net_napi napi;
+
+static int eth_poll(struct net_napi *napi, int budget)
+{
+	struct net_pkt *pkt;
+	int count;
+
+	for (count = 0; count < budget; count++) {
+		pkt = k_fifo_get(&rx_ring, K_NO_WAIT);
+		if (pkt == NULL) {
+			break;
+		}
+
+		if (net_recv_data(net_pkt_iface(pkt), pkt) < 0) {
+			net_pkt_unref(pkt);
+			test_failed = true;
+		}
+	}
+
+	if (count < budget) {
+		net_napi_complete(napi);
+
+		/* What a real driver sees as an interrupt when unmasking it */
+		if (!k_fifo_is_empty(&rx_ring)) {
+			net_napi_schedule(napi);
+		}
+	}
+
+	return count;
+}
+
+static struct net_napi race_napi;
+static int race_polls;
+
+static int race_poll(struct net_napi *napi, int budget)
+{
+	race_polls++;
+	net_napi_complete(napi);
+
+	if (race_polls == 1) {
+		/* Interrupt between completing and returning a full budget */
+		net_napi_schedule(napi);
+		return budget;
+	}
+
+	return 0;
+}
+#endif
+
 static void eth_iface_init(struct net_if *iface)
 {
 	const struct device *dev = net_if_get_device(iface);
@@ -188,11 +240,20 @@ static int eth_tx(const struct device *dev, struct net_pkt *pkt)
 		udp_hdr->src_port = udp_hdr->dst_port;
 		udp_hdr->dst_port = port;
 
+#if defined(CONFIG_NET_NAPI)
+		struct net_pkt *clone = net_pkt_clone(pkt, K_NO_WAIT);
+
+		zassert_not_null(clone, "Packet %p clone failed\n", pkt);
+
+		k_fifo_put(&rx_ring, clone);
+		net_napi_schedule(&napi);
+#else
 		if (net_recv_data(net_pkt_iface(pkt),
 				  net_pkt_clone(pkt, K_NO_WAIT)) < 0) {
 			test_failed = true;
 			zassert_true(false, "Packet %p receive failed\n", pkt);
 		}
+#endif
 
 		return 0;
 	}
@@ -263,6 +324,10 @@ static int eth_init(const struct device *dev)
 
 	generate_mac(context->mac_addr);
 
+#if defined(CONFIG_NET_NAPI)
+	napi.poll = eth_poll;
+#endif
+
 	return 0;
 }
 
@@ -1069,4 +1134,18 @@ static void run_after(void *dummy)
 	test_traffic_class_cleanup_rx();
 }
 
+#if defined(CONFIG_NET_NAPI)
+ZTEST(net_traffic_class, test_napi_complete_race)
+{
+	race_napi.poll = race_poll;
+	race_polls = 0;
+
+	net_napi_schedule(&race_napi);
+	k_sleep(K_MSEC(100));
+
+	/* Polled once more for the interrupt, and no more */
+	zassert_equal(race_polls, 2, "polled %d times", race_polls);
+}
+#endif
+
 ZTEST_SUITE(net_traffic_class, NULL, NULL, run_before, run_after, NULL);
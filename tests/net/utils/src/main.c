@@ -923,4 +923,49 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 }
 
+ZTEST(test_utils_fn, test_ip_checksum_update)
+{
+	uint8_t old_data[40];
+	uint8_t new_data[40];
+	uint16_t chksum;
+	uint16_t got;
+	uint16_t exp;
+
+	for (int i = 0; i < sizeof(old_data); i++) {
+		old_data[i] = (uint8_t)(i + 13) * 17;
+	}
+
+	chksum = htons(~calc_chksum(0, old_data, sizeof(old_data)));
+
+	/* Rewrite fields of various sizes at even offsets */
+	for (int offset = 0; offset < sizeof(old_data); offset += 2) {
+		for (int length = 2; offset + length <= sizeof(old_data);
+		     length += 2) {
+			memcpy(new_data, old_data, sizeof(new_data));
+
+			for (int i = offset; i < offset + length; i++) {
+				new_data[i] = (uint8_t)(new_data[i] * 31 + i);
+			}
+
+			exp = htons(~calc_chksum(0, new_data, sizeof(new_data)));
+			got = net_chksum_update(chksum, old_data + offset,
+						new_data + offset, length);
+
+			zassert_equal(got, exp,
+				      "Wrong updated checksum (offset %d, length %d)",
+				      offset, length);
+		}
+	}
+
+	/* Single field, e.g. a port number */
+	memcpy(new_data, old_data, sizeof(new_data));
+	UNALIGNED_PUT(htons(4242), (uint16_t *)&new_data[2]);
+
+	exp = htons(~calc_chksum(0, new_data, sizeof(new_data)));
+	got = net_chksum_update16(chksum, UNALIGNED_GET((uint16_t *)&old_data[2]),
+				  htons(4242));
+
+	zassert_equal(got, exp, "Wrong updated checksum");
+}
+
 ZTEST_SUITE(test_utils_fn, NULL, NULL, NULL, NULL, NULL);
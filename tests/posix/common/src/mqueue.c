@@ -7,6 +7,9 @@
 #include <fcntl.h>
 #include <mqueue.h>
 #include <pthread.h>
+#ifdef CONFIG_POSIX_MQUEUE_FD
+#include <poll.h>
+#endif
 
 #include <zephyr/sys/util.h>
 #include <zephyr/ztest.h>
@@ -111,3 +114,41 @@ ZTEST(posix_apis, test_mqueue)
 		      "unable to close message queue descriptor.");
 	zassert_false(mq_unlink(queue), "Not able to unlink Queue");
 }
+
+#ifdef CONFIG_POSIX_MQUEUE_FD
+ZTEST(posix_apis, test_mqueue_poll)
+{
+	mqd_t mqd;
+	struct mq_attr attrs = {
+		.mq_msgsize = MESSAGE_SIZE,
+		.mq_maxmsg = 1,
+	};
+	struct pollfd pfd;
+
+	mqd = mq_open(queue, O_RDWR | O_CREAT, 0777, &attrs);
+	zassert_not_equal(mqd, (mqd_t)-1, "unable to open message queue");
+
+	pfd.fd = mq_getfd_np(mqd);
+	zassert_true(pfd.fd >= 0, "no file descriptor");
+
+	/* Empty: writable only */
+	pfd.events = POLLIN | POLLOUT;
+	zassert_equal(poll(&pfd, 1, 0), 1);
+	zassert_equal(pfd.revents, POLLOUT);
+
+	/* Full: readable only */
+	zassert_ok(mq_send(mqd, send_data, MESSAGE_SIZE, 0));
+	zassert_equal(poll(&pfd, 1, 0), 1);
+	zassert_equal(pfd.revents, POLLIN);
+
+	pfd.events = POLLOUT;
+	zassert_equal(poll(&pfd, 1, 10), 0);
+
+	zassert_equal(mq_receive(mqd, rec_data, MESSAGE_SIZE, NULL), MESSAGE_SIZE);
+	pfd.events = POLLIN;
+	zassert_equal(poll(&pfd, 1, 10), 0);
+
+	zassert_false(mq_close(mqd), "unable to close message queue descriptor.");
+	zassert_false(mq_unlink(queue), "Not able to unlink Queue");
+}
+#endif /* CONFIG_POSIX_MQUEUE_FD */
@@ -411,6 +411,34 @@ ZTEST(isotp_implementation, test_buffer_allocation_wait)
 	isotp_unbind(&recv_ctx);
 }
 
+ZTEST(isotp_implementation, test_send_receive_rx_buf)
+{
+	static uint8_t rx_buf[CONFIG_ISOTP_RX_BUF_COUNT *
+			      CONFIG_ISOTP_RX_BUF_SIZE * 2 + 10];
+	int ret, i;
+
+	ret = isotp_bind_buf(&recv_ctx, can_dev, &rx_addr, &tx_addr, &fc_opts,
+			     rx_buf, sizeof(rx_buf), K_NO_WAIT);
+	zassert_equal(ret, 0, "Binding failed (%d)", ret);
+
+	for (i = 0; i < NUMBER_OF_REPETITIONS; i++) {
+		send_test_data(can_dev, random_data, sizeof(rx_buf));
+		ret = isotp_recv_buf(&recv_ctx, K_MSEC(1000));
+		zassert_equal(ret, sizeof(rx_buf), "recv returned %d", ret);
+		check_data(rx_buf, random_data, sizeof(rx_buf));
+
+		send_sf(can_dev);
+		ret = isotp_recv_buf(&recv_ctx, K_MSEC(1000));
+		zassert_equal(ret, DATA_SIZE_SF, "recv returned %d", ret);
+		check_data(rx_buf, random_data, DATA_SIZE_SF);
+	}
+
+	ret = isotp_recv_buf(&recv_ctx, K_MSEC(50));
+	zassert_equal(ret, ISOTP_RECV_TIMEOUT,
+		      "Expected timeout but got %d", ret);
+	isotp_unbind(&recv_ctx);
+}
+
 void *isotp_implementation_setup(void)
 {
 	int ret;
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/debug/profiler.h>
+
+#define RATE_HZ 100
+#define BUSY_MS 500
+
+static __noinit struct profiler_sample samples[RATE_HZ * BUSY_MS / MSEC_PER_SEC * 2];
+
+static __noinline void busy(void)
+{
+	int64_t end = k_uptime_get() + BUSY_MS;
+
+	while (k_uptime_get() < end) {
+	}
+}
+
+static size_t samples_get(void)
+{
+	size_t cnt = 0;
+
+	while ((cnt < ARRAY_SIZE(samples)) && (profiler_sample_get(&samples[cnt]) == 0)) {
+		cnt++;
+	}
+
+	return cnt;
+}
+
+ZTEST(profiler, test_sampling)
+{
+	size_t cnt, own = 0;
+
+	zassert_equal(profiler_start(RATE_HZ), 0, "Cannot start");
+	busy();
+	profiler_stop();
+
+	cnt = samples_get();
+	zassert_true(cnt > 0, "No samples");
+
+	for (size_t i = 0; i < cnt; i++) {
+		zassert_true(samples[i].num_frames <= PROFILER_SAMPLE_FRAMES,
+			     "Invalid number of frames: %zu", samples[i].num_frames);
+		if ((samples[i].thread == k_current_get()) && (samples[i].num_frames > 0)) {
+			own++;
+		}
+	}
+
+	zassert_true(own > cnt / 2, "Only %zu of %zu samples from the thread", own, cnt);
+	zassert_equal(profiler_dropped_get(), 0, "Samples dropped");
+}
+
+ZTEST(profiler, test_stop)
+{
+	zassert_equal(profiler_start(RATE_HZ), 0, "Cannot start");
+	k_msleep(100);
+	profiler_stop();
+	profiler_reset();
+
+	k_msleep(100);
+	zassert_equal(samples_get(), 0, "Sampled after stop");
+}
+
+ZTEST(profiler, test_invalid_rate)
+{
+	zassert_equal(profiler_start(0), -EINVAL, "Accepted null rate");
+	zassert_equal(profiler_start(CONFIG_SYS_CLOCK_TICKS_PER_SEC + 1), -EINVAL,
+		      "Accepted rate above the tick rate");
+}
+
+#ifdef CONFIG_PROFILER_SAMPLING_STACK
+ZTEST(profiler, test_stack)
+{
+	size_t cnt, deep = 0;
+
+	zassert_equal(profiler_start(RATE_HZ), 0, "Cannot start");
+	busy();
+	profiler_stop();
+
+	cnt = samples_get();
+	for (size_t i = 0; i < cnt; i++) {
+		if ((samples[i].thread == k_current_get()) && (samples[i].num_frames > 1)) {
+			deep++;
+		}
+	}
+
+	zassert_true(deep > 0, "No callers sampled");
+}
+#endif
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	profiler_reset();
+}
+
+ZTEST_SUITE(profiler, NULL, NULL, before, NULL, NULL);
@@ -8,6 +8,9 @@
 #include <zephyr/ztest.h>
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/dfu/flash_img.h>
+#ifdef CONFIG_IMG_DELTA
+#include <zephyr/dfu/flash_img_delta.h>
+#endif
 
 #define SLOT0_PARTITION		slot0_partition
 #define SLOT1_PARTITION		slot1_partition
@@ -16,6 +19,9 @@
 
 #define SLOT1_PARTITION_ID	FIXED_PARTITION_ID(SLOT1_PARTITION)
 
+/* Holds the source image of delta patches, slot0 may hold the test itself */
+#define SOURCE_PARTITION_ID	FIXED_PARTITION_ID(storage_partition)
+
 ZTEST(img_util, test_init_id)
 {
 	struct flash_img_context ctx_no_id;
@@ -165,4 +171,85 @@ ZTEST(img_util, test_check_flash)
 	flash_area_close(ctx.flash_area);
 }
 
+#ifdef CONFIG_IMG_DELTA
+ZTEST(img_util, test_delta)
+{
+	/* 32 bytes copied from the source, "ZEPH", then 28 bytes of the source
+	 * starting 100 bytes further, each incremented by one.
+	 */
+	const uint8_t patch[] = {
+		'Z', 'D', 'P', '1', 64,
+		32, 4, 0x00, 31, 'Z', 'E', 'P', 'H', 0xc8, 0x01,
+		28, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+	};
+	struct flash_img_delta_context delta_ctx;
+	struct flash_img_context ctx;
+	const struct flash_area *src;
+	uint8_t src_data[256];
+	uint8_t data[64];
+	size_t size;
+	int ret;
+
+	for (size_t i = 0; i < sizeof(src_data); i++) {
+		src_data[i] = i * 7;
+	}
+
+	ret = flash_area_open(SOURCE_PARTITION_ID, &src);
+	zassert_true(ret == 0, "Flash area open");
+	ret = flash_area_erase(src, 0, src->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+	ret = flash_area_write(src, 0, src_data, sizeof(src_data));
+	zassert_true(ret == 0, "Flash write failure (%d)", ret);
+
+	ret = flash_img_delta_target_size(patch, sizeof(patch), &size);
+	zassert_true(ret == 0 && size == sizeof(data), "Delta target size");
+	ret = flash_img_delta_target_size(src_data, sizeof(src_data), &size);
+	zassert_equal(ret, -EINVAL, "Delta target size of a non patch");
+
+	ret = flash_img_init_id(&ctx, SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img init");
+	ret = flash_area_erase(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	ret = flash_img_delta_init(&delta_ctx, &ctx, SOURCE_PARTITION_ID);
+	zassert_true(ret == 0, "Delta init");
+
+	/* Patch split at arbitrary points */
+	ret = flash_img_delta_write(&delta_ctx, patch, 8, false);
+	zassert_true(ret == 0, "Delta write 1 (%d)", ret);
+	ret = flash_img_delta_write(&delta_ctx, &patch[8], 6, false);
+	zassert_true(ret == 0, "Delta write 2 (%d)", ret);
+	ret = flash_img_delta_write(&delta_ctx, &patch[14], 20, false);
+	zassert_true(ret == 0, "Delta write 3 (%d)", ret);
+
+	/* The patch is not complete yet */
+	ret = flash_img_delta_write(&delta_ctx, NULL, 0, true);
+	zassert_equal(ret, -EINVAL, "Delta flush of an incomplete patch");
+
+	ret = flash_img_delta_write(&delta_ctx, &patch[34], sizeof(patch) - 34, true);
+	zassert_true(ret == 0, "Delta write 4 (%d)", ret);
+	zassert_equal(flash_img_bytes_written(&ctx), sizeof(data), "Bytes written");
+
+	ret = flash_area_read(ctx.flash_area, 0, data, sizeof(data));
+	zassert_true(ret == 0, "Flash read failure (%d)", ret);
+	zassert_mem_equal(data, src_data, 32, "Copied source data");
+	zassert_mem_equal(&data[32], "ZEPH", 4, "Extra data");
+
+	for (int i = 0; i < 28; i++) {
+		zassert_equal(data[36 + i], (uint8_t)(src_data[132 + i] + 1), "Diff data");
+	}
+
+	/* Bytes past the end of the patch */
+	ret = flash_img_delta_init(&delta_ctx, &ctx, SOURCE_PARTITION_ID);
+	zassert_true(ret == 0, "Delta init");
+	ret = flash_img_delta_write(&delta_ctx, patch, sizeof(patch), false);
+	zassert_true(ret == 0, "Delta write (%d)", ret);
+	ret = flash_img_delta_write(&delta_ctx, patch, 1, false);
+	zassert_equal(ret, -EINVAL, "Delta write past the end");
+
+	flash_area_close(src);
+}
+#endif
+
 ZTEST_SUITE(img_util, NULL, NULL, NULL, NULL, NULL);
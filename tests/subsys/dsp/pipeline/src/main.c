@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/dsp/pipeline.h>
+
+#define BLOCK_SIZE 64
+#define LEVEL 1000
+
+static q15_t data[BLOCK_SIZE];
+static q15_t scratch[BLOCK_SIZE];
+static struct zdsp_pipeline pipeline;
+
+/* Identity filter, coefficients are in time reversed order */
+static const q15_t identity[4] = { 0, 0, 0, INT16_MAX };
+
+static void fill(q15_t value)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(data); i++) {
+		data[i] = value;
+	}
+}
+
+static int double_process(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+	for (size_t i = 0; i < *len; i++) {
+		out[i] = in[i] * 2;
+	}
+
+	return 0;
+}
+
+static int halve_process(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+	zassert_not_equal(in, out, "out of place stage run in place");
+
+	for (size_t i = 0; i < *len / 2; i++) {
+		out[i] = in[2 * i];
+	}
+	*len /= 2;
+
+	return 0;
+}
+
+static int32_t tap_sum;
+
+static int tap_process(struct zdsp_stage *stage, q15_t *in, q15_t *out, size_t *len)
+{
+	zassert_is_null(out);
+
+	tap_sum = 0;
+	for (size_t i = 0; i < *len; i++) {
+		tap_sum += in[i];
+	}
+
+	return 0;
+}
+
+ZTEST(dsp_pipeline, test_buffers)
+{
+	struct zdsp_stage stages[4];
+	struct zdsp_stage_stats stats;
+	size_t len = 8;
+	q15_t *out;
+
+	zdsp_stage_init(&stages[0], "double", double_process, ZDSP_STAGE_IN_PLACE);
+	zdsp_stage_init(&stages[1], "halve", halve_process, 0);
+	zdsp_stage_init(&stages[2], "tap", tap_process, ZDSP_STAGE_TAP);
+	zdsp_stage_init(&stages[3], "halve", halve_process, 0);
+	for (size_t i = 0; i < ARRAY_SIZE(stages); i++) {
+		zdsp_pipeline_add(&pipeline, &stages[i]);
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		data[i] = i + 1;
+	}
+
+	zassert_ok(zdsp_pipeline_process(&pipeline, data, &len, &out));
+	zassert_equal(out, data, "output not back in the block");
+	zassert_equal(len, 2);
+	zassert_equal(out[0], 2);
+	zassert_equal(out[1], 10);
+	zassert_equal(tap_sum, 2 + 6 + 10 + 14);
+
+	zdsp_stage_stats_get(&stages[1], &stats);
+	zassert_equal(stats.blocks, 1);
+	zassert_equal(stats.samples, 8);
+	zassert_true(stats.cycles >= stats.max_cycles);
+
+	zdsp_stage_stats_reset(&stages[1]);
+	zdsp_stage_stats_get(&stages[1], &stats);
+	zassert_equal(stats.blocks, 0);
+}
+
+ZTEST(dsp_pipeline, test_scratch_too_small)
+{
+	struct zdsp_stage stage;
+	size_t len = BLOCK_SIZE;
+	q15_t *out;
+
+	zdsp_pipeline_init(&pipeline, scratch, BLOCK_SIZE / 2);
+	zdsp_stage_init(&stage, "halve", halve_process, 0);
+	zdsp_pipeline_add(&pipeline, &stage);
+
+	zassert_equal(zdsp_pipeline_process(&pipeline, data, &len, &out), -ENOMEM);
+}
+
+ZTEST(dsp_pipeline, test_filters)
+{
+	static q15_t fir_state[ARRAY_SIZE(identity) + BLOCK_SIZE - 1];
+	static q15_t biquad_state[4];
+	/* b0 = 0.5 scaled back by a post shift of 1 */
+	static const q15_t biquad_coeffs[6] = { 0x4000, 0, 0, 0, 0, 0 };
+	struct zdsp_fir_q15 fir;
+	struct zdsp_biquad_q15 biquad;
+	struct zdsp_rms_q15 rms;
+	size_t len = BLOCK_SIZE;
+	q15_t *out;
+
+	zassert_ok(zdsp_fir_q15_init(&fir, identity, ARRAY_SIZE(identity), fir_state,
+				     BLOCK_SIZE));
+	zdsp_biquad_q15_init(&biquad, 1, biquad_coeffs, biquad_state, 1);
+	zdsp_rms_q15_init(&rms);
+	zdsp_pipeline_add(&pipeline, &fir.stage);
+	zdsp_pipeline_add(&pipeline, &biquad.stage);
+	zdsp_pipeline_add(&pipeline, &rms.stage);
+
+	fill(LEVEL);
+	zassert_ok(zdsp_pipeline_process(&pipeline, data, &len, &out));
+	zassert_equal(out, scratch, "FIR output not in the scratch buffer");
+	zassert_equal(len, BLOCK_SIZE);
+	for (size_t i = 0; i < len; i++) {
+		zassert_within(out[i], LEVEL, 2, "sample %zu is %d", i, out[i]);
+	}
+	zassert_within(rms.rms, LEVEL, 2, "RMS is %d", rms.rms);
+}
+
+ZTEST(dsp_pipeline, test_decimate)
+{
+	static q15_t state[ARRAY_SIZE(identity) + BLOCK_SIZE - 1];
+	struct zdsp_decimate_q15 decimate;
+	size_t len = BLOCK_SIZE;
+	q15_t *out;
+
+	zassert_equal(zdsp_decimate_q15_init(&decimate, identity, ARRAY_SIZE(identity), 3,
+					     state, BLOCK_SIZE), -EINVAL);
+	zassert_ok(zdsp_decimate_q15_init(&decimate, identity, ARRAY_SIZE(identity), 4,
+					  state, BLOCK_SIZE));
+	zdsp_pipeline_add(&pipeline, &decimate.stage);
+
+	fill(LEVEL);
+	zassert_ok(zdsp_pipeline_process(&pipeline, data, &len, &out));
+	zassert_equal(len, BLOCK_SIZE / 4);
+	for (size_t i = 0; i < len; i++) {
+		zassert_within(out[i], LEVEL, 2, "sample %zu is %d", i, out[i]);
+	}
+}
+
+ZTEST(dsp_pipeline, test_fft)
+{
+	static q15_t buf[2 * BLOCK_SIZE];
+	struct zdsp_fft_q15 fft;
+	size_t len = BLOCK_SIZE;
+	q15_t *out;
+
+	zassert_ok(zdsp_fft_q15_init(&fft, BLOCK_SIZE, buf));
+	zdsp_pipeline_add(&pipeline, &fft.stage);
+
+	/* A constant signal only has a DC component */
+	fill(LEVEL);
+	zassert_ok(zdsp_pipeline_process(&pipeline, data, &len, &out));
+	zassert_equal(out, data);
+	zassert_equal(len, BLOCK_SIZE / 2);
+	zassert_true(out[0] > 0, "no DC component");
+	for (size_t i = 1; i < len; i++) {
+		zassert_within(out[i], 0, 1, "bin %zu is %d", i, out[i]);
+	}
+}
+
+static void dsp_pipeline_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zdsp_pipeline_init(&pipeline, scratch, ARRAY_SIZE(scratch));
+}
+
+ZTEST_SUITE(dsp_pipeline, NULL, NULL, dsp_pipeline_before, NULL, NULL);
@@ -155,6 +155,47 @@ static int test_file_truncate(void)
 		return TC_FAIL;
 	}
 
+	/* Test expanding empty file, which preallocates clusters with
+	 * CONFIG_FS_FATFS_EXPAND
+	 */
+	TC_PRINT("\nTesting expanding empty file\n");
+	res = fs_truncate(&filep, 1000);
+	if (res) {
+		TC_PRINT("fs_truncate failed [%d]\n", res);
+		fs_close(&filep);
+		return res;
+	}
+
+	fs_seek(&filep, -(off_t)sizeof(read_buff), FS_SEEK_END);
+	if (fs_tell(&filep) != 1000 - (off_t)sizeof(read_buff)) {
+		TC_PRINT("File size after fs_truncate not as expected\n");
+		fs_close(&filep);
+		return TC_FAIL;
+	}
+
+	brw = fs_read(&filep, read_buff, sizeof(read_buff));
+	if (brw < (ssize_t)sizeof(read_buff)) {
+		TC_PRINT("Read failed after truncating\n");
+		fs_close(&filep);
+		return -1;
+	}
+
+	for (int i = 0; i < sizeof(read_buff); i++) {
+		if (read_buff[i]) {
+			TC_PRINT("Expanded regions are not zeroed\n");
+			fs_close(&filep);
+			return TC_FAIL;
+		}
+	}
+
+	res = fs_truncate(&filep, 0);
+	if (res) {
+		TC_PRINT("fs_truncate failed [%d]\n", res);
+		fs_close(&filep);
+		return res;
+	}
+	fs_seek(&filep, 0, FS_SEEK_SET);
+
 	TC_PRINT("Testing write after truncating\n");
 	res = test_file_write();
 	if (res) {
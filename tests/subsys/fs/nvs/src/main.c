@@ -337,6 +337,9 @@ ZTEST_F(nvs, test_nvs_gc_3sectors)
 {
 	int err;
 
+	/* The lookup cache snapshots change the number of writes per sector */
+	Z_TEST_SKIP_IFDEF(CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT);
+
 	const uint16_t max_id = 10;
 	/* 50th write will trigger 1st GC. */
 	const uint16_t max_writes = 51;
@@ -869,3 +872,134 @@ ZTEST_F(nvs, test_nvs_cache_gc)
 	zassert_equal(num, 2, "invalid cache content after gc");
 #endif
 }
+
+/*
+ * Test that the NVS lookup cache loaded from a snapshot on nvs_mount() is the
+ * same as the one maintained during the writes.
+ */
+ZTEST_F(nvs, test_nvs_cache_snapshot)
+{
+#ifdef CONFIG_NVS_LOOKUP_CACHE_SNAPSHOT
+	int err;
+	uint32_t cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	const uint16_t max_id = 10;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	/* Move to the third sector, so that a snapshot is written, and add
+	 * entries after the snapshot.
+	 */
+	write_content(max_id, 0, max_id, &fixture->fs);
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) != 2) {
+		write_content(max_id, max_id, 2 * max_id, &fixture->fs);
+	}
+	write_content(max_id, 2 * max_id, 2 * max_id + 3, &fixture->fs);
+	err = nvs_delete(&fixture->fs, max_id - 1);
+	zassert_true(err == 0, "nvs_delete call failure: %d", err);
+
+	memcpy(cache, fixture->fs.lookup_cache, sizeof(cache));
+	memset(fixture->fs.lookup_cache, 0xAA, sizeof(fixture->fs.lookup_cache));
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	zassert_mem_equal(cache, fixture->fs.lookup_cache, sizeof(cache),
+			  "invalid cache loaded from snapshot");
+
+	for (uint16_t id = 0; id < max_id; id++) {
+		uint8_t buf[32];
+		ssize_t len = nvs_read(&fixture->fs, id, buf, sizeof(buf));
+
+		if (id == max_id - 1) {
+			zassert_equal(len, -ENOENT, "deleted entry found: %d", len);
+		} else {
+			zassert_equal(len, sizeof(buf), "nvs_read failure: %d", len);
+		}
+	}
+#endif
+}
+
+/*
+ * Test that the NVS lookup index holds one entry per ID, and that the entry of
+ * a deleted ID is removed when the sector of the deletion is gc-ed.
+ */
+ZTEST_F(nvs, test_nvs_lookup_index)
+{
+#ifdef CONFIG_NVS_LOOKUP_INDEX
+	int err;
+	size_t num;
+	uint8_t buf[32];
+	const uint16_t max_id = 10;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	write_content(max_id, 0, max_id, &fixture->fs);
+	err = nvs_delete(&fixture->fs, max_id - 1);
+	zassert_true(err == 0, "nvs_delete call failure: %d", err);
+
+	num = num_matching_cache_entries(NVS_LOOKUP_CACHE_NO_ADDR, false, &fixture->fs);
+	zassert_equal(num, CONFIG_NVS_LOOKUP_CACHE_SIZE - max_id,
+		      "invalid index content after writes");
+
+	/* Move to the third sector, so that the first one is gc-ed */
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) != 2) {
+		write_content(max_id - 1, 0, max_id - 1, &fixture->fs);
+	}
+
+	num = num_matching_cache_entries(NVS_LOOKUP_CACHE_NO_ADDR, false, &fixture->fs) +
+	      num_matching_cache_entries(NVS_LOOKUP_INDEX_DELETED, false, &fixture->fs);
+	zassert_equal(num, CONFIG_NVS_LOOKUP_CACHE_SIZE - (max_id - 1),
+		      "deleted ID not removed from the index after gc");
+	zassert_false(fixture->fs.lookup_overflow, "index overflow");
+
+	err = nvs_read(&fixture->fs, max_id - 1, buf, sizeof(buf));
+	zassert_equal(err, -ENOENT, "deleted entry found: %d", err);
+	check_content(max_id - 1, &fixture->fs);
+#endif
+}
+
+/*
+ * Test that the work queue moves to the next sector when the write sector
+ * fills up and erases the garbage collected sector.
+ */
+ZTEST_F(nvs, test_nvs_gc_background)
+{
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	int err;
+	uint32_t sector;
+	const uint16_t max_id = 10;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	sector = fixture->fs.ate_wra >> ADDR_SECT_SHIFT;
+
+	/* Fill the write sector up to the threshold, the work queue only
+	 * runs when the test thread sleeps
+	 */
+	for (uint16_t i = 0; ((fixture->fs.ate_wra - fixture->fs.data_wra) * 100U) >=
+			     (CONFIG_NVS_GC_BACKGROUND_THRESHOLD * fixture->fs.sector_size); i++) {
+		write_content(max_id, i, i + 1, &fixture->fs);
+	}
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, sector,
+		      "sector changed by the writes");
+
+	while (k_work_busy_get(&fixture->fs.gc_work)) {
+		k_msleep(1);
+	}
+
+	zassert_not_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, sector,
+			  "no background garbage collection");
+	zassert_equal(fixture->fs.gc_erase_len, 0, "garbage collected sector not erased");
+	check_content(max_id, &fixture->fs);
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	check_content(max_id, &fixture->fs);
+#endif
+}
@@ -12,7 +12,111 @@ static const struct device fake_dev;
 static int message_count_filtered;
 static int message_count_unfiltered;
 
-#if CONFIG_INPUT_MODE_THREAD
+#if CONFIG_INPUT_BATCH
+
+#define MAX_EVENTS CONFIG_INPUT_BATCH_MAX_EVENTS
+
+static struct input_event events[2 * MAX_EVENTS];
+static K_SEM_DEFINE(cb_done, 0, 1);
+static int expected_count;
+
+static void input_cb_filtered(struct input_event *evt)
+{
+	if (message_count_filtered < ARRAY_SIZE(events)) {
+		events[message_count_filtered] = *evt;
+	}
+
+	message_count_filtered++;
+	if (message_count_filtered == expected_count) {
+		k_sem_give(&cb_done);
+	}
+}
+INPUT_LISTENER_CB_DEFINE(&fake_dev, input_cb_filtered);
+
+static void input_cb_unfiltered(struct input_event *evt)
+{
+	message_count_unfiltered++;
+}
+INPUT_LISTENER_CB_DEFINE(NULL, input_cb_unfiltered);
+
+static void check_event(int i, uint8_t type, uint16_t code, int32_t value,
+			bool sync)
+{
+	zassert_equal(events[i].type, type, "event %d", i);
+	zassert_equal(events[i].code, code, "event %d", i);
+	zassert_equal(events[i].value, value, "event %d", i);
+	zassert_equal(events[i].sync, sync, "event %d", i);
+}
+
+static void batch_before(void)
+{
+	message_count_filtered = 0;
+	message_count_unfiltered = 0;
+	k_sem_reset(&cb_done);
+}
+
+/* The input thread has the lowest priority, so that it only runs once the
+ * test thread waits for the callbacks
+ */
+ZTEST(input_api, test_batch_coalesce)
+{
+	batch_before();
+	expected_count = 5;
+
+	/* Within a frame, absolute values replace each other and relative
+	 * ones add up
+	 */
+	zassert_ok(input_report_abs(&fake_dev, INPUT_ABS_X, 10, false, K_FOREVER));
+	zassert_ok(input_report_rel(&fake_dev, INPUT_REL_WHEEL, 1, false, K_FOREVER));
+	zassert_ok(input_report_abs(&fake_dev, INPUT_ABS_X, 20, false, K_FOREVER));
+	zassert_ok(input_report_abs(&fake_dev, INPUT_ABS_Y, 5, true, K_FOREVER));
+	zassert_false(input_queue_empty());
+
+	/* A motion frame is merged with the one not delivered yet */
+	zassert_ok(input_report_abs(&fake_dev, INPUT_ABS_X, 30, false, K_FOREVER));
+	zassert_ok(input_report_rel(&fake_dev, INPUT_REL_WHEEL, 2, true, K_FOREVER));
+
+	/* But not across a key frame */
+	zassert_ok(input_report_key(&fake_dev, INPUT_KEY_A, 1, true, K_FOREVER));
+	zassert_ok(input_report_abs(&fake_dev, INPUT_ABS_X, 40, true, K_FOREVER));
+
+	zassert_ok(k_sem_take(&cb_done, K_SECONDS(1)));
+	zassert_true(input_queue_empty());
+
+	zassert_equal(message_count_filtered, 5);
+	zassert_equal(message_count_unfiltered, 5);
+	check_event(0, INPUT_EV_ABS, INPUT_ABS_X, 30, false);
+	check_event(1, INPUT_EV_REL, INPUT_REL_WHEEL, 3, false);
+	check_event(2, INPUT_EV_ABS, INPUT_ABS_Y, 5, true);
+	check_event(3, INPUT_EV_KEY, INPUT_KEY_A, 1, true);
+	check_event(4, INPUT_EV_ABS, INPUT_ABS_X, 40, true);
+}
+
+ZTEST(input_api, test_batch_full)
+{
+	int i;
+
+	batch_before();
+	expected_count = MAX_EVENTS;
+
+	/* Key events are never merged, fill the frames waiting for the
+	 * input thread
+	 */
+	for (i = 0; i < MAX_EVENTS; i++) {
+		zassert_ok(input_report_key(&fake_dev, i, 1, true, K_NO_WAIT));
+	}
+
+	zassert_equal(input_report_key(&fake_dev, i, 1, true, K_NO_WAIT),
+		      -ENOMSG);
+
+	zassert_ok(k_sem_take(&cb_done, K_SECONDS(1)));
+
+	for (i = 0; i < MAX_EVENTS; i++) {
+		check_event(i, INPUT_EV_KEY, i, 1, true);
+	}
+}
+
+#elif CONFIG_INPUT_MODE_THREAD
 
 static K_SEM_DEFINE(cb_start, 1, 1);
 static K_SEM_DEFINE(cb_done, 1, 1);
@@ -185,6 +289,6 @@ ZTEST(input_api, test_report_apis)
 	zassert_equal(last_event.sync, 1);
 }
 
-#endif /* CONFIG_INPUT_MODE_THREAD */
+#endif /* CONFIG_INPUT_BATCH */
 
 ZTEST_SUITE(input_api, NULL, NULL, NULL, NULL, NULL);
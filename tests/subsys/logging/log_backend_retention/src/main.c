@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_retention.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_DBG);
+
+/* Size of the data area of the retained memory, without the header */
+#define DATA_SIZE (DT_REG_SIZE(DT_PARENT(DT_CHOSEN(zephyr_log_retained_mem))) - 24)
+
+static char output[4096];
+static size_t output_len;
+static uint8_t output_buf[32];
+
+static int output_func(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	length = MIN(length, sizeof(output) - 1 - output_len);
+	memcpy(&output[output_len], data, length);
+	output_len += length;
+	output[output_len] = '\0';
+
+	return length;
+}
+
+LOG_OUTPUT_DEFINE(log_output, output_func, output_buf, sizeof(output_buf));
+
+static void flush(void)
+{
+	while (log_process()) {
+	}
+}
+
+static int dump(void)
+{
+	output_len = 0;
+	output[0] = '\0';
+
+	return log_backend_retention_dump(&log_output, 0);
+}
+
+ZTEST(log_backend_retention, test_dump)
+{
+	char str[] = "transient";
+	int cnt;
+
+	LOG_INF("first %d", 1);
+	LOG_WRN("second %s", str);
+	LOG_HEXDUMP_DBG("abc", 3, "third");
+	flush();
+
+	/* The string is copied in the message */
+	strcpy(str, "changed");
+
+	cnt = dump();
+	zassert_equal(cnt, 3, "Unexpected number of messages: %d", cnt);
+	zassert_not_null(strstr(output, "first 1"), "Missing message: %s", output);
+	zassert_not_null(strstr(output, "second transient"), "Missing message: %s", output);
+	zassert_not_null(strstr(output, "third"), "Missing message: %s", output);
+	zassert_true(strstr(output, "first 1") < strstr(output, "second transient"),
+		     "Invalid order: %s", output);
+}
+
+ZTEST(log_backend_retention, test_overwrite)
+{
+	int cnt;
+
+	for (int i = 0; i < 100; i++) {
+		LOG_INF("msg %d end", i);
+		flush();
+	}
+
+	cnt = dump();
+	zassert_true(cnt > 0 && cnt < 100, "Unexpected number of messages: %d", cnt);
+	zassert_is_null(strstr(output, "msg 0 end"), "Oldest message kept: %s", output);
+	zassert_not_null(strstr(output, "msg 99 end"), "Newest message lost: %s", output);
+	zassert_true(log_backend_retention_size() <= DATA_SIZE, "Invalid size");
+}
+
+ZTEST(log_backend_retention, test_read)
+{
+	static uint8_t buf[DATA_SIZE];
+	size_t size;
+	size_t off = 0;
+	int len;
+
+	for (int i = 0; i < 40; i++) {
+		LOG_INF("msg %d", i);
+	}
+	flush();
+
+	size = log_backend_retention_size();
+	zassert_true(size > 0, "No retained messages");
+
+	/* Read in chunks which do not match the messages */
+	do {
+		len = log_backend_retention_read(off, &buf[off], 7);
+		zassert_true(len >= 0, "Read failed: %d", len);
+		off += len;
+	} while (len > 0);
+
+	zassert_equal(off, size, "Invalid read size: %zu", off);
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	flush();
+	zassert_equal(log_backend_retention_clear(), 0, "Clear failed");
+	zassert_equal(log_backend_retention_size(), 0, "Not cleared");
+}
+
+static void *setup(void)
+{
+	const struct log_backend *backend = log_backend_get_by_name("log_backend_retention");
+
+	zassert_not_null(backend, "No backend");
+	zassert_equal(log_backend_is_ready(backend), 0, "Backend not ready");
+	log_backend_enable(backend, NULL, LOG_LEVEL_DBG);
+
+	return NULL;
+}
+
+ZTEST_SUITE(log_backend_retention, NULL, setup, before, NULL, NULL);
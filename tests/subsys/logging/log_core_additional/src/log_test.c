@@ -498,6 +498,50 @@ ZTEST(test_log_core_additional, test_log_msg_create)
 	}
 }
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+/**
+ * @brief Overflow the buffer of one CPU
+ *
+ * @details Log more messages than the buffer of a CPU holds, without
+ *          leaving that CPU, and check that the drops are only counted
+ *          for that CPU.
+ *
+ * @addtogroup logging
+ */
+ZTEST(test_log_core_additional, test_log_percpu_overflow)
+{
+	uint32_t before[CONFIG_MP_MAX_NUM_CPUS];
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int cpu, key;
+
+	log_setup(false);
+
+	for (int i = 0; i < num_cpus; i++) {
+		before[i] = log_cpu_dropped_cnt_get(i);
+	}
+
+	/* No migration while the local interrupts are locked */
+	key = arch_irq_lock();
+	cpu = arch_curr_cpu()->id;
+	for (int i = 0; i < CONFIG_LOG_BUFFER_SIZE / sizeof(int); i++) {
+		LOG_INF("overflow %d", i);
+	}
+	arch_irq_unlock(key);
+
+	zassert_true(log_cpu_dropped_cnt_get(cpu) > before[cpu],
+		     "no drop counted for CPU %u", cpu);
+	for (int i = 0; i < num_cpus; i++) {
+		if (i != cpu) {
+			zassert_equal(log_cpu_dropped_cnt_get(i), before[i],
+				      "drop counted for CPU %d", i);
+		}
+	}
+
+	while (log_test_process()) {
+	}
+}
+#endif /* CONFIG_LOG_PERCPU_BUFFERS */
+
 #else
 
 ZTEST_USER(test_log_core_additional, test_log_msg_create_user)
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_DBG);
+
+static char output[1024];
+static size_t output_len;
+static uint8_t output_buf[32];
+
+static int output_func(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	length = MIN(length, sizeof(output) - 1 - output_len);
+	memcpy(&output[output_len], data, length);
+	output_len += length;
+	output[output_len] = '\0';
+
+	return length;
+}
+
+LOG_OUTPUT_DEFINE(log_output, output_func, output_buf, sizeof(output_buf));
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	ARG_UNUSED(backend);
+
+	log_output_msg_process(&log_output, &msg->log, 0);
+}
+
+static const struct log_backend_api test_backend_api = {
+	.process = process,
+};
+
+LOG_BACKEND_DEFINE(test_backend, test_backend_api, false);
+
+static void flush(void)
+{
+	while (log_process()) {
+	}
+}
+
+static int count_matches(const char *pattern)
+{
+	const char *str = output;
+	int count = 0;
+
+	while ((str = strstr(str, pattern)) != NULL) {
+		count++;
+		str += strlen(pattern);
+	}
+
+	return count;
+}
+
+/* Checks that the second pattern follows the first one in the output */
+static void check_order(const char *first, const char *second)
+{
+	const char *a = strstr(output, first);
+
+	zassert_not_null(a, "No \"%s\" in: %s", first, output);
+	zassert_not_null(strstr(a, second), "No \"%s\" after \"%s\" in: %s",
+			 second, first, output);
+}
+
+/* Waits for the start of a rate limiting interval */
+static void align_interval(void)
+{
+	uint32_t now = k_uptime_get_32();
+
+	k_msleep(CONFIG_LOG_RATELIMIT_INTERVAL_MS -
+		 now % CONFIG_LOG_RATELIMIT_INTERVAL_MS);
+}
+
+static void log_burst(int cnt)
+{
+	for (int i = 0; i < cnt; i++) {
+		LOG_WRN("burst %d", i);
+	}
+}
+
+ZTEST(log_ratelimit, test_dedup)
+{
+	for (int i = 0; i < 5; i++) {
+		LOG_INF("same %d", 1);
+	}
+
+	LOG_INF("other");
+	flush();
+
+	zassert_equal(count_matches("same 1"), 1, "Not deduplicated: %s", output);
+	check_order("same 1", "last message repeated 4 times");
+	check_order("last message repeated 4 times", "other");
+}
+
+ZTEST(log_ratelimit, test_dedup_flush)
+{
+	for (int i = 0; i < 3; i++) {
+		LOG_INF("flushed %d", 2);
+	}
+
+	flush();
+	zassert_equal(count_matches("last message repeated"), 0,
+		      "Reported too early: %s", output);
+
+	k_msleep(CONFIG_LOG_FAILURE_REPORT_PERIOD);
+	flush();
+
+	check_order("flushed 2", "last message repeated 2 times");
+
+	/* The next identical message is logged again */
+	LOG_INF("flushed %d", 2);
+	flush();
+
+	zassert_equal(count_matches("flushed 2"), 2, "Not logged: %s", output);
+}
+
+ZTEST(log_ratelimit, test_ratelimit_flush)
+{
+	align_interval();
+	log_burst(CONFIG_LOG_RATELIMIT_BURST + 5);
+	flush();
+
+	zassert_equal(count_matches("burst"), CONFIG_LOG_RATELIMIT_BURST,
+		      "Not limited: %s", output);
+	zassert_equal(count_matches("suppressed"), 0,
+		      "Reported too early: %s", output);
+
+	k_msleep(CONFIG_LOG_RATELIMIT_INTERVAL_MS);
+	flush();
+
+	zassert_equal(count_matches("5 messages suppressed"), 1,
+		      "Not reported: %s", output);
+}
+
+ZTEST(log_ratelimit, test_ratelimit_next_interval)
+{
+	align_interval();
+	log_burst(CONFIG_LOG_RATELIMIT_BURST + 3);
+
+	/* The first message of the next interval reports the suppressed ones */
+	k_msleep(CONFIG_LOG_RATELIMIT_INTERVAL_MS);
+	log_burst(1);
+	flush();
+
+	zassert_equal(count_matches("burst"), CONFIG_LOG_RATELIMIT_BURST + 1,
+		      "Not limited: %s", output);
+	check_order("burst 9", "3 messages suppressed");
+	check_order("3 messages suppressed", "burst 0");
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	flush();
+	output_len = 0;
+	output[0] = '\0';
+}
+
+static void *setup(void)
+{
+	log_init();
+	log_backend_enable(&test_backend, NULL, LOG_LEVEL_DBG);
+
+	return NULL;
+}
+
+ZTEST_SUITE(log_ratelimit, NULL, setup, before, NULL, NULL);
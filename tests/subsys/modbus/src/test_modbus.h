@@ -17,6 +17,8 @@
 #define MB_TEST_RESPONSE_TO	50000
 #define MB_TEST_NODE_ADDR	0x01
 #define MB_TEST_FP_OFFSET	5000
+#define MB_TEST_TABLE_OFFSET	100
+#define MB_TEST_TABLE_SIZE	125
 
 /*
  * Integration platform for this test is FRDM-K64F.
@@ -14,6 +14,7 @@ const static uint16_t fp_offset = MB_TEST_FP_OFFSET;
 const static uint8_t node = MB_TEST_NODE_ADDR;
 const static uint16_t offset_oor = 32;
 const static uint16_t fp_offset_oor = fp_offset + offset_oor;
+const static uint16_t table_offset = MB_TEST_TABLE_OFFSET;
 
 static uint8_t client_iface;
 
@@ -107,6 +108,8 @@ void test_holding_reg(void)
 	uint16_t hr_rd[8] = {0};
 	float fhr_wr[4] = {48.56470489501953125, 0.3, 0.2, 0.1};
 	float fhr_rd[4] = {0.0};
+	static uint16_t table_wr[MB_TEST_TABLE_SIZE];
+	static uint16_t table_rd[MB_TEST_TABLE_SIZE];
 	int err;
 
 	/* Test FC06 | FC03 */
@@ -146,6 +149,29 @@ void test_holding_reg(void)
 	zassert_equal(memcmp(hr_wr, hr_rd, sizeof(hr_wr)), 0,
 		      "FC16 verify failed");
 
+	/* Test FC16 | FC03 on the register table of the server */
+	for (uint16_t idx = 0; idx < ARRAY_SIZE(table_wr); idx++) {
+		table_wr[idx] = 0xa500 + idx;
+	}
+
+	err = modbus_write_holding_regs(client_iface, node, table_offset,
+					table_wr, ARRAY_SIZE(table_wr));
+	zassert_equal(err, 0, "FC16 table write request failed");
+
+	err = modbus_write_holding_reg(client_iface, node, table_offset + 1, 0xcafe);
+	zassert_equal(err, 0, "FC06 table write request failed");
+	table_wr[1] = 0xcafe;
+
+	err = modbus_read_holding_regs(client_iface, node, table_offset,
+				       table_rd, ARRAY_SIZE(table_rd));
+	zassert_equal(err, 0, "FC03 table read request failed");
+	zassert_equal(memcmp(table_wr, table_rd, sizeof(table_wr)), 0,
+		      "FC16 table verify failed");
+
+	err = modbus_read_holding_regs(client_iface, node, table_offset + 1,
+				       table_rd, ARRAY_SIZE(table_rd));
+	zassert_not_equal(err, 0, "FC03 table out of range request not failed");
+
 	/* Test FC16 | FC03 */
 	for (uint16_t idx = 0; idx < ARRAY_SIZE(fhr_wr); idx++) {
 		err = modbus_write_holding_regs_fp(client_iface,
@@ -13,6 +13,7 @@ const static uint16_t fp_offset = MB_TEST_FP_OFFSET;
 static uint16_t coils;
 static uint16_t holding_reg[8];
 static float holding_fp[4];
+static uint16_t holding_table[MB_TEST_TABLE_SIZE];
 
 uint8_t server_iface;
 
@@ -171,11 +172,22 @@ static struct modbus_user_callbacks mbs_cbs = {
 	.holding_reg_wr_fp = holding_reg_wr_fp,
 };
 
+static const struct modbus_table mbs_tables[] = {
+	{
+		.type = MODBUS_TABLE_HOLDING_REGS,
+		.addr = MB_TEST_TABLE_OFFSET,
+		.num = MB_TEST_TABLE_SIZE,
+		.data = holding_table,
+	},
+};
+
 static struct modbus_iface_param server_param = {
 	.mode = MODBUS_MODE_RTU,
 	.server = {
 		.user_cb = &mbs_cbs,
 		.unit_id = MB_TEST_NODE_ADDR,
+		.tables = mbs_tables,
+		.num_tables = ARRAY_SIZE(mbs_tables),
 	},
 	.serial = {
 		.baud = MB_TEST_BAUDRATE_LOW,
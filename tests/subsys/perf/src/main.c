@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/perf/perf.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(stack, STACK_SIZE);
+static struct k_thread thread;
+
+static volatile uint32_t sink;
+
+static __noinline void work(void)
+{
+	for (int i = 0; i < 10000; i++) {
+		sink += i;
+	}
+}
+
+static void check_counted(const struct sys_perf_counters *counters)
+{
+	uint32_t events = sys_perf_events_get();
+
+	for (int i = 0; i < SYS_PERF_EVENTS; i++) {
+		if ((events & BIT(i)) == 0) {
+			zassert_equal(counters->count[i], 0, "Event %d not counted", i);
+		}
+	}
+
+	zassert_true(counters->count[SYS_PERF_CYCLES] > 0, "No cycles");
+	if ((events & BIT(SYS_PERF_INSTRUCTIONS)) != 0) {
+		zassert_true(counters->count[SYS_PERF_INSTRUCTIONS] >= 10000,
+			     "Too few instructions: %llu",
+			     counters->count[SYS_PERF_INSTRUCTIONS]);
+	}
+}
+
+ZTEST(perf, test_elapsed)
+{
+	struct sys_perf_snapshot start, end;
+	struct sys_perf_counters counters;
+
+	sys_perf_snapshot(&start);
+	work();
+	sys_perf_snapshot(&end);
+
+	sys_perf_elapsed(&start, &end, &counters);
+	check_counted(&counters);
+}
+
+static void thread_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	work();
+}
+
+ZTEST(perf, test_thread)
+{
+	struct sys_perf_counters before, after, counters;
+	int err;
+
+	err = sys_perf_thread_get(k_current_get(), &before);
+	if (!IS_ENABLED(CONFIG_SYS_PERF_THREAD)) {
+		zassert_equal(err, -ENOTSUP, "Threads tracked");
+		ztest_test_skip();
+	}
+
+	zassert_equal(err, 0, "Cannot get counters");
+
+	k_thread_create(&thread, stack, STACK_SIZE, thread_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_thread_join(&thread, K_FOREVER);
+
+	zassert_equal(sys_perf_thread_get(&thread, &counters), 0, "Cannot get counters");
+	check_counted(&counters);
+
+	/* The current thread was not charged while the other one ran */
+	work();
+	zassert_equal(sys_perf_thread_get(k_current_get(), &after), 0, "Cannot get counters");
+	zassert_true(after.count[SYS_PERF_CYCLES] > before.count[SYS_PERF_CYCLES],
+		     "Current thread not charged");
+}
+
+static void *setup(void)
+{
+	if ((sys_perf_events_get() & BIT(SYS_PERF_CYCLES)) == 0) {
+		ztest_test_skip();
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(perf, NULL, setup, NULL, NULL, NULL);
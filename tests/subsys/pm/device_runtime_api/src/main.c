@@ -217,6 +217,60 @@ ZTEST(device_runtime_api, test_api)
 	zassert_equal(ret, 0);
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD
+/**
+ * @brief Test resuming a device ahead of its use.
+ *
+ * Scenarios tested:
+ *
+ * - resume ahead + get + put
+ * - resume ahead not claimed within the hold time
+ */
+ZTEST(device_runtime_api, test_api_resume_ahead)
+{
+	int ret;
+	enum pm_device_state state;
+
+	/*** resume ahead + get + put ***/
+
+	ret = pm_device_runtime_resume_ahead(dev, K_NO_WAIT);
+	zassert_equal(ret, 0);
+	k_sleep(K_MSEC(1));
+
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_ACTIVE);
+
+	/* usage: 1 (ahead), taken over, resume: no */
+	ret = pm_device_runtime_get(dev);
+	zassert_equal(ret, 0);
+
+	/* usage: 1, -1, suspend: yes */
+	ret = pm_device_runtime_put(dev);
+	zassert_equal(ret, 0);
+
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+	struct pm_device_runtime_stats stats;
+
+	ret = pm_device_runtime_stats_get(dev, &stats);
+	zassert_equal(ret, 0);
+	zassert_equal(stats.resume_count, 1U);
+	zassert_equal(stats.resume_avoided_count, 1U);
+#endif
+
+	/*** resume ahead not claimed within the hold time ***/
+
+	ret = pm_device_runtime_resume_ahead(dev, K_NO_WAIT);
+	zassert_equal(ret, 0);
+	k_sleep(K_MSEC(2 * CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD_HOLD_MS));
+
+	(void)pm_device_state_get(dev, &state);
+	zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_RESUME_AHEAD */
+
 DEVICE_DEFINE(pm_unsupported_device, "PM Unsupported", NULL, NULL, NULL, NULL,
 	      APPLICATION, 0, NULL);
 
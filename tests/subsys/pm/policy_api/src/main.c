@@ -23,10 +23,11 @@ void pm_state_exit_post_ops(enum pm_state state, uint8_t substate_id)
 	irq_unlock(0);
 }
 
-#ifdef CONFIG_PM_POLICY_DEFAULT
+#if defined(CONFIG_PM_POLICY_DEFAULT) || defined(CONFIG_PM_POLICY_PREDICTIVE)
 /**
  * @brief Test the behavior of pm_policy_next_state() when
- * CONFIG_PM_POLICY_DEFAULT=y.
+ * CONFIG_PM_POLICY_DEFAULT=y, which CONFIG_PM_POLICY_PREDICTIVE=y matches
+ * as long as it has no typical idle duration shorter than the next wakeup.
  */
 ZTEST(policy_api, test_pm_policy_next_state_default)
 {
@@ -304,7 +305,7 @@ ZTEST(policy_api, test_pm_policy_next_state_custom)
 }
 #endif /* CONFIG_PM_POLICY_CUSTOM */
 
-#ifdef CONFIG_PM_POLICY_DEFAULT
+#if defined(CONFIG_PM_POLICY_DEFAULT) || defined(CONFIG_PM_POLICY_PREDICTIVE)
 /* note: we can't easily mock k_cycle_get_32(), so test is not ideal */
 ZTEST(policy_api, test_pm_policy_events)
 {
@@ -368,4 +369,56 @@ ZTEST(policy_api, test_pm_policy_events)
 }
 #endif /* CONFIG_PM_POLICY_CUSTOM */
 
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+static void idle_history_fill(uint8_t cpu, uint32_t idle_us)
+{
+	for (uint8_t i = 0U; i < CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+		pm_policy_residency_update(cpu, k_us_to_cyc_floor32(idle_us));
+	}
+}
+
+/**
+ * @brief Test the behavior of pm_policy_next_state() when
+ * CONFIG_PM_POLICY_PREDICTIVE=y.
+ */
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	const struct pm_state_info *next;
+
+	/* idle periods end after 150ms, too early for suspend to ram */
+	idle_history_fill(0U, 150000);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	/* the next wakeup still wins if it comes earlier */
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(10999));
+	zassert_is_null(next);
+
+	/* too short for any state, keep learning with the shallowest one */
+	idle_history_fill(0U, 50000);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	/* no typical duration, the next wakeup decides */
+	for (uint8_t i = 0U; i < CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+		pm_policy_residency_update(0U, k_us_to_cyc_floor32((i % 2U) ? 10000 : 4000000));
+	}
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* long idle periods allow suspend to ram again */
+	idle_history_fill(0U, 2000000);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* leave a history which doesn't affect the other tests */
+	idle_history_fill(0U, 10000000);
+}
+#else
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
+
 ZTEST_SUITE(policy_api, NULL, NULL, NULL, NULL, NULL);
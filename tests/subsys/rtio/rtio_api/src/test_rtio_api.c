@@ -274,6 +274,32 @@ ZTEST_USER(rtio_api, test_rtio_syscalls)
 	}
 }
 
+ZTEST_USER(rtio_api, test_rtio_submit_copy)
+{
+	int res;
+	struct rtio_sqe sqes[SQE_POOL_SIZE + 1];
+	struct rtio_cqe cqes[4];
+
+	struct rtio *r = &r_syscall;
+
+	for (int i = 0; i < ARRAY_SIZE(sqes); i++) {
+		rtio_sqe_prep_nop(&sqes[i], &iodev_test_syscall, &syscall_bufs[i % 4]);
+	}
+
+	TC_PRINT("submitting and consuming in one call\n");
+	res = rtio_submit_copy(r, sqes, 4, cqes, 4, K_FOREVER);
+	zassert_equal(res, 4, "Expected 4 copied cqes, got %d", res);
+
+	for (int i = 0; i < 4; i++) {
+		zassert_ok(cqes[i].result, "Result should be ok");
+		zassert_equal_ptr(cqes[i].userdata, &syscall_bufs[i],
+				  "Expected in order completions");
+	}
+
+	res = rtio_submit_copy(r, sqes, ARRAY_SIZE(sqes), NULL, 0, K_NO_WAIT);
+	zassert_equal(res, -ENOMEM, "Expected too many sqes to fail");
+}
+
 RTIO_BMEM uint8_t mempool_data[MEM_BLK_SIZE];
 
 static void test_rtio_simple_mempool_(struct rtio *r, int run_count)
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/work.h>
+
+#define OP_TIME_MS 50
+
+static atomic_t running;
+static atomic_t max_running;
+
+/* Blocking operation of an iodev without asynchronous support */
+static void blocking_op(struct rtio_iodev_sqe *iodev_sqe)
+{
+	atomic_val_t cnt = atomic_inc(&running) + 1;
+
+	if (cnt > atomic_get(&max_running)) {
+		atomic_set(&max_running, cnt);
+	}
+
+	k_msleep(OP_TIME_MS);
+	atomic_dec(&running);
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void blocking_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	if (req == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, blocking_op);
+}
+
+static const struct rtio_iodev_api blocking_api = {
+	.submit = blocking_submit,
+};
+
+RTIO_IODEV_DEFINE(iodev_sensor, &blocking_api, NULL);
+RTIO_IODEV_DEFINE(iodev_flash, &blocking_api, NULL);
+
+RTIO_DEFINE(r, 8, 8);
+
+ZTEST(rtio_workq, test_chains)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int64_t start;
+
+	/* Two chains reading a sensor then writing to a flash */
+	for (int i = 0; i < 2; i++) {
+		sqe = rtio_sqe_acquire(&r);
+		zassert_not_null(sqe);
+		rtio_sqe_prep_nop(sqe, &iodev_sensor, NULL);
+		sqe->flags |= RTIO_SQE_CHAINED;
+
+		sqe = rtio_sqe_acquire(&r);
+		zassert_not_null(sqe);
+		rtio_sqe_prep_nop(sqe, &iodev_flash, NULL);
+	}
+
+	start = k_uptime_get();
+	zassert_ok(rtio_submit(&r, 0));
+	zassert_true(k_uptime_get() - start < OP_TIME_MS, "Submitter blocked");
+
+	for (int i = 0; i < 4; i++) {
+		cqe = rtio_cqe_consume_block(&r);
+		zassert_ok(cqe->result);
+		rtio_cqe_release(&r, cqe);
+	}
+
+	/* The chains ran concurrently */
+	zassert_equal(atomic_get(&max_running), 2);
+	zassert_true(k_uptime_get() - start < 3 * OP_TIME_MS, "Chains not concurrent");
+
+	/* The last request is released once its handler returns */
+	k_msleep(1);
+	zassert_equal(rtio_work_req_used_count_get(), 0, "Requests not released");
+}
+
+static void nop_op(struct rtio_iodev_sqe *iodev_sqe)
+{
+	ARG_UNUSED(iodev_sqe);
+}
+
+ZTEST(rtio_workq, test_alloc)
+{
+	static struct rtio_iodev_sqe iodev_sqe;
+	struct rtio_work_req *req[CONFIG_RTIO_WORKQ_POOL_ITEMS];
+
+	for (int i = 0; i < ARRAY_SIZE(req); i++) {
+		req[i] = rtio_work_req_alloc();
+		zassert_not_null(req[i]);
+	}
+
+	zassert_is_null(rtio_work_req_alloc(), "Too many requests");
+	zassert_equal(rtio_work_req_used_count_get(), CONFIG_RTIO_WORKQ_POOL_ITEMS);
+
+	/* Requests are released once run */
+	for (int i = 0; i < ARRAY_SIZE(req); i++) {
+		rtio_work_req_submit(req[i], &iodev_sqe, nop_op);
+	}
+
+	k_msleep(10);
+	zassert_equal(rtio_work_req_used_count_get(), 0, "Requests not released");
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	atomic_clear(&max_running);
+}
+
+ZTEST_SUITE(rtio_workq, NULL, NULL, before, NULL, NULL);
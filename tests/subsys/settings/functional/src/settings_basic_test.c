@@ -474,6 +474,38 @@ ZTEST(settings_functional, test_direct_loading)
 	settings_deregister(&val123_settings);
 }
 
+ZTEST(settings_functional, test_save_batch)
+{
+	int rc;
+	uint8_t vals[] = {41, 42, 43};
+	const struct settings_batch_item items[] = {
+		{ .name = "val/1", .value = &vals[0], .val_len = sizeof(uint8_t) },
+		{ .name = "val/2", .value = &vals[1], .val_len = sizeof(uint8_t) },
+		/* overwrites the first item */
+		{ .name = "val/1", .value = &vals[2], .val_len = sizeof(uint8_t) },
+		{ .name = "val/3", .value = NULL, .val_len = 0 },
+	};
+
+	settings_subsys_init();
+	rc = settings_save_one("val/3", &vals[0], sizeof(uint8_t));
+	zassert_true(rc == 0, "settings_save_one failed");
+
+	rc = settings_save_batch(items, ARRAY_SIZE(items));
+	zassert_true(rc == 0, "settings_save_batch failed");
+
+	rc = settings_register(&val123_settings);
+	zassert_true(rc == 0);
+	memset(&data, 0, sizeof(data));
+
+	rc = settings_load_subtree("val");
+	zassert_true(rc == 0);
+
+	zassert_equal(43, data.val1);
+	zassert_equal(42, data.val2);
+	zassert_false(data.en3, "deleted item loaded");
+	settings_deregister(&val123_settings);
+}
+
 struct test_loading_data {
 	const char *n;
 	const char *v;
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/stats/perf_stats.h>
+
+#include <zcbor_common.h>
+#include <zcbor_decode.h>
+
+PERF_STATS_HIST_DEFINE(test_a);
+PERF_STATS_HIST_DEFINE(test_b);
+
+static uint8_t buf[1024];
+
+ZTEST(perf_stats, test_buckets)
+{
+	uint32_t prev = 0;
+	uint32_t min;
+
+	/* Exact below the number of sub-buckets */
+	for (uint32_t v = 0; v < PERF_STATS_SUB_BUCKETS; v++) {
+		zassert_equal(perf_stats_bucket(v), v);
+	}
+
+	zassert_equal(perf_stats_bucket(UINT32_MAX), PERF_STATS_BUCKETS - 1);
+
+	/* Contiguous buckets, each starting at its shortest duration */
+	for (uint32_t b = 0; b < PERF_STATS_BUCKETS; b++) {
+		min = perf_stats_bucket_min(b);
+		zassert_true(b == 0 || min > prev, "bucket %u not increasing", b);
+		zassert_equal(perf_stats_bucket(min), b, "bucket %u starts at %u", b, min);
+		if (b > 0) {
+			zassert_equal(perf_stats_bucket(min - 1), b - 1,
+				      "gap before bucket %u", b);
+		}
+		prev = min;
+	}
+
+	/* Relative error bounded by the number of sub-buckets */
+	min = perf_stats_bucket_min(perf_stats_bucket(1000000));
+	zassert_true(1000000 - min <= 1000000 / PERF_STATS_SUB_BUCKETS);
+}
+
+ZTEST(perf_stats, test_record)
+{
+	struct perf_stats_snapshot snap;
+	uint32_t start;
+
+	perf_stats_record(PERF_STATS_HIST(test_a), 1);
+	perf_stats_record(PERF_STATS_HIST(test_a), 1);
+	perf_stats_record(PERF_STATS_HIST(test_a), 1000);
+
+	start = perf_stats_start();
+	k_busy_wait(10);
+	perf_stats_stop(PERF_STATS_HIST(test_b), start);
+
+	perf_stats_snapshot(PERF_STATS_HIST(test_a), &snap);
+	zassert_equal(snap.count, 3);
+	zassert_equal(snap.sum, 1002);
+	zassert_equal(snap.max, 1000);
+	zassert_equal(snap.counts[perf_stats_bucket(1)], 2);
+	zassert_equal(snap.counts[perf_stats_bucket(1000)], 1);
+
+	perf_stats_snapshot(PERF_STATS_HIST(test_b), &snap);
+	zassert_equal(snap.count, 1);
+	zassert_true(snap.max > 0);
+
+	perf_stats_reset(PERF_STATS_HIST(test_a));
+	perf_stats_snapshot(PERF_STATS_HIST(test_a), &snap);
+	zassert_equal(snap.count, 0);
+	zassert_equal(snap.sum, 0);
+}
+
+ZTEST(perf_stats, test_find)
+{
+	zassert_equal_ptr(perf_stats_find("test_a"), PERF_STATS_HIST(test_a));
+	zassert_equal_ptr(perf_stats_find("test_b"), PERF_STATS_HIST(test_b));
+	zassert_is_null(perf_stats_find("test_c"));
+}
+
+static bool key_is(zcbor_state_t *zsd, const char *name)
+{
+	struct zcbor_string key;
+
+	return zcbor_tstr_decode(zsd, &key) && key.len == strlen(name) &&
+	       memcmp(key.value, name, key.len) == 0;
+}
+
+ZTEST(perf_stats, test_encode)
+{
+	struct zcbor_string name;
+	uint32_t bucket, count;
+	uint64_t n, sum;
+	uint32_t value;
+	size_t len;
+
+	perf_stats_record(PERF_STATS_HIST(test_a), 3);
+	perf_stats_record(PERF_STATS_HIST(test_a), 500);
+	perf_stats_record(PERF_STATS_HIST(test_a), 500);
+
+	zassert_equal(perf_stats_encode_all(buf, 8, &len), -ENOMEM);
+	zassert_ok(perf_stats_encode_all(buf, sizeof(buf), &len));
+
+	ZCBOR_STATE_D(zsd, 3, buf, len, 1);
+
+	zassert_true(zcbor_map_start_decode(zsd));
+
+	/* The histograms of this test, the others being defined by Kconfig options */
+	do {
+		zassert_true(zcbor_tstr_decode(zsd, &name));
+		if (name.len == strlen("test_a") && memcmp(name.value, "test_a", name.len) == 0) {
+			break;
+		}
+		zassert_true(zcbor_any_skip(zsd, NULL));
+	} while (true);
+
+	zassert_true(zcbor_map_start_decode(zsd));
+	zassert_true(key_is(zsd, "n") && zcbor_uint64_decode(zsd, &n));
+	zassert_equal(n, 3);
+	zassert_true(key_is(zsd, "s") && zcbor_uint64_decode(zsd, &sum));
+	zassert_equal(sum, 1003);
+	zassert_true(key_is(zsd, "m") && zcbor_uint32_decode(zsd, &value));
+	zassert_equal(value, 500);
+	zassert_true(key_is(zsd, "hz") && zcbor_uint32_decode(zsd, &value));
+	zassert_equal(value, sys_clock_hw_cycles_per_sec());
+	zassert_true(key_is(zsd, "sb") && zcbor_uint32_decode(zsd, &value));
+	zassert_equal(value, CONFIG_PERF_STATS_SUB_BUCKETS_LOG2);
+
+	/* Only the buckets which are not empty */
+	zassert_true(key_is(zsd, "b") && zcbor_list_start_decode(zsd));
+	zassert_true(zcbor_uint32_decode(zsd, &bucket) && zcbor_uint32_decode(zsd, &count));
+	zassert_equal(bucket, perf_stats_bucket(3));
+	zassert_equal(count, 1);
+	zassert_true(zcbor_uint32_decode(zsd, &bucket) && zcbor_uint32_decode(zsd, &count));
+	zassert_equal(bucket, perf_stats_bucket(500));
+	zassert_equal(count, 2);
+	zassert_true(zcbor_list_end_decode(zsd));
+	zassert_true(zcbor_map_end_decode(zsd));
+}
+
+static void perf_stats_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	perf_stats_reset(PERF_STATS_HIST(test_a));
+	perf_stats_reset(PERF_STATS_HIST(test_b));
+}
+
+ZTEST_SUITE(perf_stats, NULL, NULL, perf_stats_before, NULL, NULL);
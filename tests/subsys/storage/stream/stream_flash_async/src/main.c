@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/flash.h>
+
+#include <zephyr/storage/stream_flash.h>
+
+#define BUF_LEN 512
+#define HALF_LEN (BUF_LEN / 2)
+#define NUM_PAGES 4
+
+/* so that we don't overwrite the application when running on hw */
+#define FLASH_BASE (128*1024)
+
+static const struct device *const fdev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+static struct stream_flash_ctx ctx;
+static struct flash_pages_info page;
+static size_t cb_len;
+static int cb_ret;
+
+static uint8_t buf[BUF_LEN];
+static uint8_t write_buf[NUM_PAGES * 4096];
+static uint8_t read_buf[NUM_PAGES * 4096];
+
+static int stream_flash_callback(uint8_t *data, size_t len, size_t offset)
+{
+	zassert_true((data == buf) || (data == buf + HALF_LEN), "incorrect buf");
+	zassert_mem_equal(data, write_buf + offset - FLASH_BASE, len, "incorrect data");
+	cb_len += len;
+
+	return cb_ret;
+}
+
+static void verify_written(size_t start, size_t size)
+{
+	zassert_equal(flash_read(fdev, FLASH_BASE + start, read_buf, size), 0, "read failed");
+	zassert_mem_equal(read_buf, write_buf + start, size, "unexpected data");
+}
+
+ZTEST(lib_stream_flash_async, test_write)
+{
+	size_t size = NUM_PAGES * page.size - 3;
+	size_t written;
+	int rc;
+
+	/* Chunks which do not match the buffer halves */
+	for (written = 0; written < size; written += MIN(size - written, 100)) {
+		rc = stream_flash_buffered_write(&ctx, write_buf + written,
+						 MIN(size - written, 100), false);
+		zassert_equal(rc, 0, "expected success");
+		zassert_true(stream_flash_bytes_written(&ctx) <= written, "too many bytes written");
+	}
+
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), size, "all bytes should be written");
+	zassert_equal(cb_len, size, "all bytes should be verified");
+
+	verify_written(0, size);
+}
+
+ZTEST(lib_stream_flash_async, test_erase_ahead)
+{
+	uint8_t val;
+	int rc;
+
+	rc = flash_write(fdev, FLASH_BASE + page.size, write_buf, 8);
+	zassert_equal(rc, 0, "expected success");
+
+	/* Writing up to the end of the page erases the next one */
+	rc = stream_flash_buffered_write(&ctx, write_buf, page.size, true);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = flash_read(fdev, FLASH_BASE + page.size, &val, 1);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(val, flash_get_parameters(fdev)->erase_value, "next page not erased");
+}
+
+ZTEST(lib_stream_flash_async, test_error)
+{
+	int rc;
+
+	cb_ret = -EFAULT;
+
+	/* The failure of the background write is reported by the next call */
+	rc = stream_flash_buffered_write(&ctx, write_buf, HALF_LEN, false);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, HALF_LEN, false);
+	zassert_equal(rc, -EFAULT, "expected failure from callback");
+
+	/* Until the context is initialized again */
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, -EFAULT, "expected failure from callback");
+	zassert_equal(stream_flash_bytes_written(&ctx), 0, "no bytes should be written");
+}
+
+static void before(void *unused)
+{
+	int rc;
+
+	ARG_UNUSED(unused);
+
+	rc = flash_erase(fdev, FLASH_BASE, NUM_PAGES * page.size);
+	zassert_equal(rc, 0, "should succeed");
+
+	cb_len = 0;
+	cb_ret = 0;
+
+	rc = stream_flash_init(&ctx, fdev, buf, BUF_LEN, FLASH_BASE, 0,
+			       stream_flash_callback);
+	zassert_equal(rc, 0, "expected success");
+}
+
+static void *setup(void)
+{
+	zassert_true(device_is_ready(fdev), "Device is not ready");
+	zassert_equal(flash_get_page_info_by_offs(fdev, FLASH_BASE, &page), 0,
+		      "Can't get page info");
+	zassert_true(page.size <= sizeof(write_buf) / NUM_PAGES, "page size too large");
+
+	for (size_t i = 0; i < sizeof(write_buf); i++) {
+		write_buf[i] = i % 251;
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(lib_stream_flash_async, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+
+struct sensor_msg {
+	int seq;
+};
+
+ZBUS_MSG_SUBSCRIBER_DEFINE(msg_sub);
+ZBUS_MSG_SUBSCRIBER_DEFINE(rt_msg_sub);
+ZBUS_SUBSCRIBER_DEFINE(sub, 4);
+
+ZBUS_CHAN_DEFINE(sensor_chan,	   /* Name */
+		 struct sensor_msg, /* Message type */
+
+		 NULL,			       /* Validator */
+		 NULL,			       /* User data */
+		 ZBUS_OBSERVERS(msg_sub, sub), /* observers */
+		 ZBUS_MSG_INIT(0)	       /* Initial value */
+);
+
+ZTEST(msg_subscriber, test_messages_copied)
+{
+	const struct zbus_channel *chan;
+	struct sensor_msg msg;
+
+	/* Each message is kept, even if the channel is published again */
+	for (int i = 1; i <= 3; i++) {
+		msg.seq = i;
+		zassert_ok(zbus_chan_pub(&sensor_chan, &msg, K_MSEC(100)));
+	}
+
+	for (int i = 1; i <= 3; i++) {
+		zassert_ok(zbus_sub_wait_msg(&msg_sub, &chan, &msg, K_MSEC(100)));
+		zassert_equal_ptr(chan, &sensor_chan);
+		zassert_equal(msg.seq, i);
+
+		/* The notifications of the subscriber are unchanged */
+		zassert_ok(zbus_sub_wait(&sub, &chan, K_NO_WAIT));
+		zassert_equal_ptr(chan, &sensor_chan);
+	}
+
+	zassert_equal(zbus_sub_wait_msg(&msg_sub, &chan, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(zbus_sub_wait_msg(&msg_sub, &chan, &msg, K_MSEC(10)), -EAGAIN);
+	zassert_equal(zbus_sub_wait_msg(&sub, &chan, &msg, K_NO_WAIT), -EINVAL);
+}
+
+ZTEST(msg_subscriber, test_runtime_observer)
+{
+	const struct zbus_channel *chan;
+	struct sensor_msg msg = {.seq = 42};
+
+	zassert_ok(zbus_chan_add_obs(&sensor_chan, &rt_msg_sub, K_MSEC(100)));
+
+	zassert_ok(zbus_chan_pub(&sensor_chan, &msg, K_MSEC(100)));
+
+	msg.seq = 0;
+	zassert_ok(zbus_sub_wait_msg(&rt_msg_sub, &chan, &msg, K_NO_WAIT));
+	zassert_equal_ptr(chan, &sensor_chan);
+	zassert_equal(msg.seq, 42);
+
+	zassert_ok(zbus_chan_rm_obs(&sensor_chan, &rt_msg_sub, K_MSEC(100)));
+
+	/* Drain the static observers */
+	zassert_ok(zbus_sub_wait_msg(&msg_sub, &chan, &msg, K_NO_WAIT));
+	zassert_ok(zbus_sub_wait(&sub, &chan, K_NO_WAIT));
+}
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUB_STATS)
+ZTEST(msg_subscriber, test_pub_stats)
+{
+	const struct zbus_channel *chan;
+	struct zbus_channel_pub_stats stats;
+	struct sensor_msg msg = {0};
+
+	zassert_ok(zbus_chan_pub_stats_get(&sensor_chan, &stats, true, K_NO_WAIT));
+
+	zassert_ok(zbus_chan_pub(&sensor_chan, &msg, K_MSEC(100)));
+	zassert_ok(zbus_chan_notify(&sensor_chan, K_MSEC(100)));
+
+	zassert_ok(zbus_chan_pub_stats_get(&sensor_chan, &stats, true, K_NO_WAIT));
+	zassert_equal(stats.count, 2);
+	zassert_true(stats.time_max <= stats.time_total);
+	zassert_true(stats.observers_time_total <= stats.time_total);
+	zassert_true(stats.observers_time_max <= stats.time_max);
+
+	zassert_ok(zbus_chan_pub_stats_get(&sensor_chan, &stats, false, K_NO_WAIT));
+	zassert_equal(stats.count, 0);
+
+	for (int i = 0; i < 2; i++) {
+		zassert_ok(zbus_sub_wait_msg(&msg_sub, &chan, &msg, K_NO_WAIT));
+		zassert_ok(zbus_sub_wait(&sub, &chan, K_NO_WAIT));
+	}
+}
+#endif /* CONFIG_ZBUS_CHANNEL_PUB_STATS */
+
+ZTEST_SUITE(msg_subscriber, NULL, NULL, NULL, NULL, NULL);
@@ -880,6 +880,29 @@ ZTEST(prf, test_fp_value)
 	PRF_CHECK("8.98846567431158e+307", rc);
 }
 
+ZTEST(prf, test_fp_fixed)
+{
+	if (!IS_ENABLED(CONFIG_CBPRINTF_FP_SUPPORT) ||
+	    !IS_ENABLED(CONFIG_CBPRINTF_FAST_CONV)) {
+		TC_PRINT("skipping unsupported feature\n");
+		return;
+	}
+
+	int rc;
+
+	/* The fixed point conversion is exact and rounds ties to even */
+	TEST_PRF(&rc, "/%.0f/%.0f/%.0f/", 0.5, 1.5, 2.5);
+	PRF_CHECK("/0/2/2/", rc);
+	TEST_PRF(&rc, "/%.1f/%.1f/", 0.25, 0.35);
+	PRF_CHECK("/0.2/0.3/", rc);
+	TEST_PRF(&rc, "/%.2f/%.2f/", 1.005, 9.999);
+	PRF_CHECK("/1.00/10.00/", rc);
+	TEST_PRF(&rc, "/%.6f/%#.0f/", -4095.99999975, 99.5);
+	PRF_CHECK("/-4096.000000/100./", rc);
+	TEST_PRF(&rc, "/%.3f/", 4294967296.0625);
+	PRF_CHECK("/4294967296.062/", rc);
+}
+
 ZTEST(prf, test_fp_length)
 {
 	if (IS_ENABLED(CONFIG_CBPRINTF_NANO)) {
@@ -1377,6 +1400,9 @@ static void *cbprintf_setup(void)
 	if (IS_ENABLED(CONFIG_CBPRINTF_LIBC_SUBSTS)) {
 		TC_PRINT(" LIBC_SUBSTS\n");
 	}
+	if (IS_ENABLED(CONFIG_CBPRINTF_FAST_CONV)) {
+		TC_PRINT(" FAST_CONV\n");
+	}
 
 	printf("sizeof:  int=%zu long=%zu ptr=%zu long long=%zu double=%zu long double=%zu\n",
 	       sizeof(int), sizeof(long), sizeof(void *), sizeof(long long),
@@ -50,6 +50,24 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+/* Lengths and offsets not aligned to the words processed per step */
+ZTEST(crc, test_crc32_long)
+{
+	uint8_t data[1000];
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 7U + 3U);
+	}
+
+	zassert_equal(crc32_ieee(data, sizeof(data)), 0x17BC2A46);
+	zassert_equal(crc32_ieee_update(crc32_ieee(data, 13), &data[13],
+					sizeof(data) - 13), 0x17BC2A46);
+
+	zassert_equal(crc32_c(0, data, sizeof(data), true, true), 0xDD2EDFF7);
+	zassert_equal(crc32_c(crc32_c(0, data, 13, true, false), &data[13],
+			      sizeof(data) - 13, false, true), 0xDD2EDFF7);
+}
+
 ZTEST(crc, test_crc16)
 {
 	uint8_t test[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
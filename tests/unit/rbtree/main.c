@@ -26,6 +26,11 @@ static struct rbnode *walked_nodes[MAX_NODES];
 /* Node currently being inserted, for testing lessthan() argument order */
 static struct rbnode *current_insertee;
 
+#ifdef CONFIG_RB_AUGMENT
+/* Augmented data: the number of nodes in the subtree of each node */
+static int subtree_size[MAX_NODES];
+#endif
+
 void set_node_mask(int node, int val)
 {
 	unsigned int *p = &node_mask[node / 32];
@@ -59,6 +64,19 @@ bool node_lessthan(struct rbnode *a, struct rbnode *b)
 	return a < b;
 }
 
+#ifdef CONFIG_RB_AUGMENT
+static int get_subtree_size(struct rbnode *n)
+{
+	return (n != NULL) ? subtree_size[node_index(n)] : 0;
+}
+
+void node_augment(struct rbnode *n)
+{
+	subtree_size[node_index(n)] = 1 + get_subtree_size(rb_left(n)) +
+				      get_subtree_size(rb_right(n));
+}
+#endif
+
 /* Simple LCRNG (modulus is 2^64!) cribbed from:
  * https://nuclear.llnl.gov/CNP/rng/rngman/node4.html
  *
@@ -93,6 +111,11 @@ void check_rbnode(struct rbnode *node, int blacks_above)
 {
 	int side, bheight = blacks_above + z_rb_is_black(node);
 
+#ifdef CONFIG_RB_AUGMENT
+	_CHECK(get_subtree_size(node) == 1 + get_subtree_size(rb_left(node)) +
+	       get_subtree_size(rb_right(node)));
+#endif
+
 	for (side = 0; side < 2; side++) {
 		struct rbnode *ch = z_rb_child(node, side);
 
@@ -107,6 +130,10 @@ void check_rbnode(struct rbnode *node, int blacks_above)
 			/* Can't have adjacent red nodes */
 			_CHECK(z_rb_is_black(node) || z_rb_is_black(ch));
 
+#ifdef CONFIG_RB_PARENT
+			_CHECK(rb_parent(ch) == node);
+#endif
+
 			/* Recurse */
 			check_rbnode(ch, bheight);
 		} else {
@@ -125,6 +152,9 @@ void check_rb(void)
 
 	_CHECK(tree.root);
 	_CHECK(z_rb_is_black(tree.root));
+#ifdef CONFIG_RB_PARENT
+	_CHECK(rb_parent(tree.root) == NULL);
+#endif
 
 	check_rbnode(tree.root, 0);
 }
@@ -202,6 +232,9 @@ void test_tree(int size)
 
 	(void)memset(&tree, 0, sizeof(tree));
 	tree.lessthan_fn = node_lessthan;
+#ifdef CONFIG_RB_AUGMENT
+	tree.augment_fn = node_augment;
+#endif
 	(void)memset(nodes, 0, sizeof(nodes));
 	(void)memset(node_mask, 0, sizeof(node_mask));
 
@@ -277,4 +310,100 @@ ZTEST(rbtree_api, test_rb_get_minmax)
 	zassert_true(rb_get_max(&tree) == &nodes[7], "the tree is invalid");
 }
 
+/**
+ * @brief Test building a tree from sorted nodes
+ *
+ * @details Build trees of all sizes with rb_build_sorted(), check
+ * them, then keep inserting and removing nodes to check the trees can
+ * be modified.
+ *
+ * @ingroup lib_rbtree_tests
+ *
+ * @see rb_build_sorted()
+ */
+ZTEST(rbtree_api, test_rb_build_sorted)
+{
+	static struct rbnode *sorted[MAX_NODES];
+
+	for (int size = 0; size <= MAX_NODES; size++) {
+		(void)memset(&tree, 0, sizeof(tree));
+		tree.lessthan_fn = node_lessthan;
+#ifdef CONFIG_RB_AUGMENT
+		tree.augment_fn = node_augment;
+#endif
+		(void)memset(nodes, 0, sizeof(nodes));
+		(void)memset(node_mask, 0, sizeof(node_mask));
+
+		for (int i = 0; i < size; i++) {
+			sorted[i] = &nodes[i];
+			set_node_mask(i, 1);
+		}
+
+		rb_build_sorted(&tree, sorted, size);
+		check_tree(size);
+
+		for (int i = 0; i < 2 * size; i++) {
+			int node = next_rand_mod(size);
+
+			if (!get_node_mask(node)) {
+				rb_insert(&tree, &nodes[node]);
+				set_node_mask(node, 1);
+			} else {
+				rb_remove(&tree, &nodes[node]);
+				set_node_mask(node, 0);
+			}
+
+			if (size <= 32) {
+				check_tree(size);
+			}
+		}
+
+		check_tree(size);
+	}
+}
+
+#ifdef CONFIG_RB_PARENT
+/**
+ * @brief Test iterating over a tree with parent pointers
+ *
+ * @details Walk a tree forward with rb_next() and backward with
+ * rb_prev(), check that all nodes are visited in order.
+ *
+ * @ingroup lib_rbtree_tests
+ *
+ * @see rb_next(), rb_prev()
+ */
+ZTEST(rbtree_api, test_rb_next_prev)
+{
+	struct rbnode *n;
+	int count = 0;
+
+	(void)memset(&tree, 0, sizeof(tree));
+	tree.lessthan_fn = node_lessthan;
+	(void)memset(nodes, 0, sizeof(nodes));
+
+	for (int i = 0; i < MAX_NODES; i += 2) {
+		rb_insert(&tree, &nodes[i]);
+	}
+
+	for (n = rb_get_min(&tree); n != NULL; n = rb_next(n)) {
+		zassert_equal(node_index(n), 2 * count, "wrong next node");
+		count++;
+	}
+	zassert_equal(count, MAX_NODES / 2, "nodes missed");
+
+	for (n = rb_get_max(&tree); n != NULL; n = rb_prev(n)) {
+		count--;
+		zassert_equal(node_index(n), 2 * count, "wrong previous node");
+	}
+	zassert_equal(count, 0, "nodes missed");
+
+	/* Removing a node that is not in the tree has no effect */
+	rb_remove(&tree, &nodes[1]);
+	rb_remove(&tree, &nodes[0]);
+	rb_remove(&tree, &nodes[0]);
+	zassert_true(rb_get_min(&tree) == &nodes[2], "the tree is invalid");
+}
+#endif
+
 ZTEST_SUITE(rbtree_api, NULL, NULL, NULL, NULL, NULL);